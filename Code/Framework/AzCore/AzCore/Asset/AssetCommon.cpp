@@ -161,7 +161,7 @@ namespace AZ::Data
         {
             if (AssetManager::IsReady())
             {
-                AZStd::lock_guard<AZStd::recursive_mutex> assetLock(AssetManager::Instance().m_assetMutex);
+                AZStd::lock_guard<AssetManager::AssetMapMutex> assetLock(AssetManager::Instance().m_assetMutex);
                 auto it = AssetManager::Instance().m_assets.find(id);
                 if (it != AssetManager::Instance().m_assets.end())
                 {
@@ -10,6 +10,7 @@
 #include <AzCore/Outcome/Outcome.h>
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/std/sort.h>
 
 namespace AZ::Data
 {
@@ -55,13 +56,43 @@ namespace AZ::Data
             dependencyAssets.emplace_back(thisInfo, AZStd::move(dependentAsset));
         }
 
+        // An asset can't signal ready until every PreLoad dependency below it is ready, so the deepest assets in the preload graph
+        // sit on the critical path of the whole container.  Queue them first so that the streamer sees the full graph at once and
+        // serves the bottom of long preload chains before the assets waiting on them.
+        AZStd::unordered_map<AssetId, AZ::u32> preloadDepths;
+        AZ::u32 maxPreloadDepth = 0;
+        {
+            AZStd::lock_guard<AZStd::recursive_mutex> preloadGuard(m_preloadMutex);
+            for (const auto& dependency : dependencyAssets)
+            {
+                maxPreloadDepth = AZStd::max(maxPreloadDepth, CalculatePreloadDepth(dependency.second.GetId(), preloadDepths));
+            }
+        }
+
+        if (maxPreloadDepth > 0)
+        {
+            AZStd::stable_sort(dependencyAssets.begin(), dependencyAssets.end(),
+                [&preloadDepths](const auto& lhs, const auto& rhs)
+                {
+                    return preloadDepths[lhs.second.GetId()] > preloadDepths[rhs.second.GetId()];
+                });
+        }
+
         // Queue the loading of all of the dependent assets before loading the root asset.
         for (auto& [dependentAssetInfo, dependentAsset] : dependencyAssets)
         {
+            const AZ::u32 preloadDepth = preloadDepths[dependentAsset.GetId()];
+            AssetLoadParameters dependentLoadParams;
+            if (preloadDepth > 0)
+            {
+                dependentLoadParams = loadParamsCopyWithNoLoadingFilter;
+                ApplyPreloadDepth(dependentLoadParams, dependentAsset.GetType(), preloadDepth, maxPreloadDepth);
+            }
+
             // Queue each asset to load.
             auto queuedDependentAsset = AssetManager::Instance().GetAssetInternal(
                 dependentAsset.GetId(), dependentAsset.GetType(),
-                AZ::Data::AssetLoadBehavior::Default, loadParamsCopyWithNoLoadingFilter,
+                AZ::Data::AssetLoadBehavior::Default, preloadDepth > 0 ? dependentLoadParams : loadParamsCopyWithNoLoadingFilter,
                 dependentAssetInfo, HasPreloads(dependentAsset.GetId()));
 
             // Verify that the returned asset reference matches the one that we found or created and queued to load.
@@ -685,6 +716,64 @@ namespace AZ::Data
         return false;
     }
 
+    AZ::u32 AssetContainer::CalculatePreloadDepth(const AssetId& assetId, AZStd::unordered_map<AssetId, AZ::u32>& calculatedDepths) const
+    {
+        if (auto depthIter = calculatedDepths.find(assetId); depthIter != calculatedDepths.end())
+        {
+            return depthIter->second;
+        }
+
+        // Seed the entry before walking the waiters so that a circular preload chain which slipped past SetupPreloadLists
+        // terminates instead of recursing forever.
+        calculatedDepths[assetId] = 0;
+
+        AZ::u32 depth = 0;
+        if (auto waitersIter = m_preloadWaitList.find(assetId); waitersIter != m_preloadWaitList.end())
+        {
+            for (const AssetId& waiterId : waitersIter->second)
+            {
+                // Assets with preloads are added to their own wait list, which doesn't add a level to the chain.
+                if (waiterId != assetId)
+                {
+                    depth = AZStd::max(depth, CalculatePreloadDepth(waiterId, calculatedDepths) + 1);
+                }
+            }
+        }
+
+        calculatedDepths[assetId] = depth;
+        return depth;
+    }
+
+    void AssetContainer::ApplyPreloadDepth(
+        AssetLoadParameters& loadParams, const AssetType& assetType, AZ::u32 preloadDepth, AZ::u32 maxPreloadDepth) const
+    {
+        // Every level of preload depth raises the streamer priority by this amount.
+        constexpr AZ::u32 PriorityStepPerPreloadDepth = 16;
+
+        AssetHandler* handler = AssetManager::Instance().GetHandler(assetType);
+        if (!handler)
+        {
+            return;
+        }
+
+        IO::IStreamerTypes::Deadline deadline;
+        IO::IStreamerTypes::Priority priority;
+        handler->GetDefaultAssetLoadPriority(assetType, deadline, priority);
+        deadline = loadParams.m_deadline.value_or(deadline);
+        priority = loadParams.m_priority.value_or(priority);
+
+        const AZ::u32 raisedPriority = AZStd::min<AZ::u32>(
+            priority + preloadDepth * PriorityStepPerPreloadDepth, IO::IStreamerTypes::s_priorityHighest);
+        loadParams.m_priority = aznumeric_cast<IO::IStreamerTypes::Priority>(raisedPriority);
+
+        // Split a requested deadline into one slice per level of the preload graph so the deepest assets are due first and
+        // every level above has time to finish once the assets it waits on are ready.
+        if (deadline != IO::IStreamerTypes::s_noDeadline)
+        {
+            loadParams.m_deadline = deadline * (maxPreloadDepth + 1 - preloadDepth) / (maxPreloadDepth + 1);
+        }
+    }
+
     Asset<AssetData> AssetContainer::GetAssetData(const AssetId& assetId) const
     {
         AZStd::lock_guard<AZStd::recursive_mutex> dependenciesGuard(m_dependencyMutex);
@@ -109,6 +109,13 @@ namespace AZ
             void SetupPreloadLists(PreloadAssetListType&& preloadList, const AZ::Data::AssetId& rootAssetId);
             bool HasPreloads(const AZ::Data::AssetId& assetId) const;
 
+            // Returns the length of the longest chain of PreLoad waiters above an asset.  An asset at depth N gates the ready signal
+            // of N levels of assets above it, so deeper assets are queued first and read with a higher streamer priority.
+            // Must be called with m_preloadMutex held.
+            AZ::u32 CalculatePreloadDepth(const AZ::Data::AssetId& assetId, AZStd::unordered_map<AZ::Data::AssetId, AZ::u32>& calculatedDepths) const;
+            // Adjusts the streamer deadline and priority of a dependent asset load based on its depth in the preload graph.
+            void ApplyPreloadDepth(AssetLoadParameters& loadParams, const AZ::Data::AssetType& assetType, AZ::u32 preloadDepth, AZ::u32 maxPreloadDepth) const;
+
             // Remove a specific id from the list an asset is waiting for and complete the load if everything is ready
             void RemoveFromWaitingPreloads(const AZ::Data::AssetId& waitingId, const AZ::Data::AssetId& preloadAssetId);
             // Iterate over the list that was waiting for this asset and remove it from each
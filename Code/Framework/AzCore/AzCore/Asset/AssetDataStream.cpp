@@ -316,5 +316,17 @@ namespace AZ::Data
         return bytes;
     }
 
+    const void* AssetDataStream::ReadInPlace(AZ::IO::SizeType bytes)
+    {
+        // The loaded data stays in m_buffer until the stream is closed
+        if (m_curOffset > m_loadedSize || bytes > m_loadedSize - m_curOffset)
+        {
+            return nullptr;
+        }
+        const AZ::u8* data = reinterpret_cast<const AZ::u8*>(m_buffer) + m_curOffset;
+        m_curOffset += aznumeric_cast<size_t>(bytes);
+        return data;
+    }
+
 } // AZ::Data
 
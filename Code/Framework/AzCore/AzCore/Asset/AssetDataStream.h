@@ -72,6 +72,7 @@ namespace AZ::Data
         }
 
         AZ::IO::SizeType Read(AZ::IO::SizeType bytes, void* oBuffer) override;
+        const void* ReadInPlace(AZ::IO::SizeType bytes) override;
 
         AZ::IO::SizeType GetCurPos() const override { return m_curOffset; }
         AZ::IO::SizeType GetLength() const override { return m_requestedAssetSize; }
@@ -567,7 +567,7 @@ namespace AZ::Data
         PrepareShutDown();
 
         // Acquire the asset lock to make sure nobody else is trying to do anything fancy with assets
-        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+        AZStd::scoped_lock<AssetMapMutex> assetLock(m_assetMutex);
 
         while (!m_handlers.empty())
         {
@@ -699,7 +699,7 @@ namespace AZ::Data
 
                     {
                         // this scope is used to control the scope of the lock.
-                        AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
+                        AZStd::lock_guard<AssetMapMutex> assetLock(m_assetMutex);
                         for (const auto &assetEntry : m_assets)
                         {
                             // is the handler that handles this type, this handler we're removing?
@@ -732,7 +732,7 @@ namespace AZ::Data
         AZ_Error("AssetDatabase", catalog != nullptr, "Attempting to register a null catalog!");
         if (catalog)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> l(m_catalogMutex);
+            AZStd::scoped_lock<AssetMapMutex> l(m_catalogMutex);
             if (m_catalogs.insert(AZStd::make_pair(assetType, catalog)).second == false)
             {
                 AZ_Error("AssetDatabase", false, "Asset type %s already has a catalog registered! New registration ignored!", assetType.ToString<AZStd::string>().c_str());
@@ -749,7 +749,7 @@ namespace AZ::Data
         AZ_Error("AssetDatabase", catalog != nullptr, "Attempting to unregister a null catalog!");
         if (catalog)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> l(m_catalogMutex);
+            AZStd::scoped_lock<AssetMapMutex> l(m_catalogMutex);
             for (AssetCatalogMap::iterator iter = m_catalogs.begin(); iter != m_catalogs.end(); )
             {
                 if (iter->second == catalog)
@@ -792,7 +792,7 @@ namespace AZ::Data
             return;
         }
 
-        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+        AZStd::scoped_lock<AssetMapMutex> assetLock(m_assetMutex);
         // First, release any containers that were loading this asset
         for (auto asset = m_assets.begin();asset != m_assets.end();)
         {
@@ -872,7 +872,7 @@ namespace AZ::Data
         // If the catalog is not available, use the original assetId
         const AssetId& assetToFind(assetInfo.m_assetId.IsValid() ? assetInfo.m_assetId : assetId);
 
-        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+        AZStd::scoped_lock<AssetMapMutex> assetLock(m_assetMutex);
         AssetMap::iterator it = m_assets.find(assetToFind);
         if (it != m_assets.end())
         {
@@ -1013,7 +1013,7 @@ namespace AZ::Data
 
         // Control the scope of the assetMutex lock
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            AZStd::scoped_lock<AssetMapMutex> assetLock(m_assetMutex);
             bool isNewEntry = false;
 
             // check if asset already exists
@@ -1230,7 +1230,7 @@ namespace AZ::Data
         // If the catalog is not available, use the original assetId
         const AssetId& assetToFind(assetInfo.m_assetId.IsValid() ? assetInfo.m_assetId : assetId);
 
-        AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
+        AZStd::scoped_lock<AssetMapMutex> asset_lock(m_assetMutex);
 
         Asset<AssetData> asset = FindAsset(assetToFind, assetReferenceLoadBehavior);
 
@@ -1257,7 +1257,7 @@ namespace AZ::Data
             nullAsset.SetAutoLoadBehavior(assetReferenceLoadBehavior);
             return nullAsset;
         }
-        AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
+        AZStd::scoped_lock<AssetMapMutex> asset_lock(m_assetMutex);
 
         // check if asset already exist
         AssetMap::iterator it = m_assets.find(assetId);
@@ -1313,7 +1313,7 @@ namespace AZ::Data
 
         if (removeAssetFromHash)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
+            AZStd::scoped_lock<AssetMapMutex> asset_lock(m_assetMutex);
             AssetMap::iterator it = m_assets.find(assetId);
             // need to check the count again in here in case
            // someone was trying to get the asset on another thread
@@ -1460,7 +1460,7 @@ namespace AZ::Data
         Asset<AssetData> newAsset;
 
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            AZStd::scoped_lock<AssetMapMutex> assetLock(m_assetMutex);
             auto assetIter = m_assets.find(assetId);
 
             if (assetIter == m_assets.end() || assetIter->second->IsLoading())
@@ -1620,7 +1620,7 @@ namespace AZ::Data
 
         {
             AZ_Assert(asset.Get(), "Asset data for reload is missing.");
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            AZStd::scoped_lock<AssetMapMutex> assetLock(m_assetMutex);
             AZ_Assert(
                 m_assets.find(asset.GetId()) != m_assets.end(),
                 "Unable to reload asset %s because it's not in the AssetManager's asset list.", asset.ToString<AZStd::string>().c_str());
@@ -1691,7 +1691,7 @@ namespace AZ::Data
         {
             bool requeue{ false };
             {
-                AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+                AZStd::scoped_lock<AssetMapMutex> assetLock(m_assetMutex);
                 auto found = m_assets.find(assetId);
                 AZ_Assert(found == m_assets.end() || asset.Get()->RTTI_GetType() == found->second->RTTI_GetType(),
                     "New and old data types are mismatched!");
@@ -1784,7 +1784,7 @@ namespace AZ::Data
                 AZ_PROFILE_SCOPE(AzCore, "AZ::Data::LoadAssetStreamerCallback %s",
                     loadingAsset.GetHint().c_str());
                 {
-                    AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+                    AZStd::scoped_lock<AssetMapMutex> assetLock(m_assetMutex);
                     AssetData* data = loadingAsset.Get();
                     if (data->GetStatus() != AssetData::AssetStatus::Queued)
                     {
@@ -1893,7 +1893,7 @@ namespace AZ::Data
     {
         // Failed reloads have no side effects. Just notify observers (error reporting, etc).
         {
-            AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            AZStd::lock_guard<AssetMapMutex> assetLock(m_assetMutex);
             m_reloads.erase(asset.GetId());
         }
         AssetLoadBus::Event(asset.GetId(), &AssetLoadBus::Events::OnAssetReloadError, asset); // Broadcast to any containers first
@@ -1939,7 +1939,7 @@ namespace AZ::Data
         AssetData* data = asset.Get();
         {
 
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            AZStd::scoped_lock<AssetMapMutex> assetLock(m_assetMutex);
             if (data)
             {
                 // The purpose of this function is to validate this asset is still in a StreamReady
@@ -2082,7 +2082,7 @@ namespace AZ::Data
     //=========================================================================
     AssetStreamInfo AssetManager::GetLoadStreamInfoForAsset(const AssetId& assetId, const AssetType& assetType)
     {
-        AZStd::scoped_lock<AZStd::recursive_mutex> catalogLock(m_catalogMutex);
+        AZStd::scoped_lock<AssetMapMutex> catalogLock(m_catalogMutex);
         AssetCatalogMap::iterator catIt = m_catalogs.find(assetType);
         if (catIt == m_catalogs.end())
         {
@@ -2098,7 +2098,7 @@ namespace AZ::Data
     //=========================================================================
     AssetStreamInfo AssetManager::GetSaveStreamInfoForAsset(const AssetId& assetId, const AssetType& assetType)
     {
-        AZStd::scoped_lock<AZStd::recursive_mutex> catalogLock(m_catalogMutex);
+        AZStd::scoped_lock<AssetMapMutex> catalogLock(m_catalogMutex);
         AssetCatalogMap::iterator catIt = m_catalogs.find(assetType);
         if (catIt == m_catalogs.end())
         {
@@ -2316,7 +2316,7 @@ namespace AZ::Data
     {
         {
             // We may need to revalidate that this asset hasn't already passed through postLoad
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            AZStd::scoped_lock<AssetMapMutex> assetLock(m_assetMutex);
             if (asset->IsReady() || asset->m_status == AssetData::AssetStatus::LoadedPreReady)
             {
                 return;
@@ -2404,7 +2404,7 @@ namespace AZ::Data
         AZStd::map<AZStd::string, TypeInfo> assetTypeInfos;
         uint64_t totalSize = 0;
 
-        AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
+        AZStd::lock_guard<AssetMapMutex> assetLock(m_assetMutex);
 
         // we need to cache the AssetStreamInfo since json objects are referencing the names in it. 
         AZStd::vector<AssetStreamInfo> cachedStreamInfos;
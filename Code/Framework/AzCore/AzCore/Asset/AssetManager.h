@@ -12,6 +12,7 @@
 #include <AzCore/Asset/AssetContainer.h>
 #include <AzCore/Asset/AssetDataStream.h>
 #include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/Debug/LockContentionProfiler.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h> // used as allocator for most components
 #include <AzCore/std/parallel/mutex.h>
@@ -155,6 +156,7 @@ namespace AZ
             typedef AZStd::unordered_map<AssetId, AssetData*> AssetMap;
             typedef AZStd::unordered_map<AssetContainerKey, AZStd::weak_ptr<AssetContainer>> WeakAssetContainerMap;
             typedef AZStd::unordered_map<AssetContainer*, AZStd::shared_ptr<AssetContainer>> OwnedAssetContainerMap;
+            using AssetMapMutex = AZ::Debug::ProfiledMutex<AZStd::recursive_mutex>;
 
             AZ_CLASS_ALLOCATOR(AssetManager, SystemAllocator);
 
@@ -408,9 +410,9 @@ namespace AZ
 
             AssetHandlerMap         m_handlers;
             AssetCatalogMap         m_catalogs;
-            AZStd::recursive_mutex  m_catalogMutex;     // lock when accessing the catalog map
+            AssetMapMutex           m_catalogMutex{ "AssetManager::m_catalogMutex" };   // lock when accessing the catalog map
             AssetMap                m_assets;
-            AZStd::recursive_mutex  m_assetMutex;       // lock when accessing the asset map
+            AssetMapMutex           m_assetMutex{ "AssetManager::m_assetMutex" };       // lock when accessing the asset map
 
             WeakAssetContainerMap   m_assetContainers;
             OwnedAssetContainerMap  m_ownedAssetContainers;
@@ -270,6 +270,7 @@ namespace AZ
     template<class Comp, class Void> friend class AZ::HasComponentDependentServices;                                                    \
     template<class Comp, class Void> friend class AZ::HasComponentRequiredServices;                                                     \
     template<class Comp, class Void> friend class AZ::HasComponentIncompatibleServices;                                                 \
+    template<class Comp, class Void> friend class AZ::HasComponentSupportsParallelActivation;                                           \
     static AZ::ComponentDescriptor* CreateDescriptor()                                                                                  \
     { \
         static const char* s_typeName = _ComponentClass::RTTI_TypeName(); \
@@ -299,6 +300,7 @@ namespace AZ
     template<class Comp, class Void> friend class AZ::HasComponentDependentServices; \
     template<class Comp, class Void> friend class AZ::HasComponentRequiredServices; \
     template<class Comp, class Void> friend class AZ::HasComponentIncompatibleServices; \
+    template<class Comp, class Void> friend class AZ::HasComponentSupportsParallelActivation; \
     static AZ::ComponentDescriptor* CreateDescriptor();
 
     #define AZ_COMPONENT_BASE_IMPL_0(_ComponentClass, _Inline, _TemplateParamsParen) \
@@ -603,6 +605,16 @@ namespace AZ
          */
         virtual void GetIncompatibleServices(DependencyArrayType& incompatible, const Component* instance) const    { (void)incompatible;  (void)instance; }
 
+        /**
+         * Specifies whether the component's Init and Activate functions can run on a task worker thread, at the same time
+         * as the components of other entities. EntityBatchActivator initializes and activates the entities whose components
+         * all support this on the task executor.
+         * Components that connect to buses or use systems which aren't thread-safe while doing so shouldn't enable this.
+         * @param instance Optional parameter with which you can refine the support for each instance. This value is null if no instance exists.
+         * @return True if the component can be initialized and activated on any thread.
+         */
+        virtual bool SupportsParallelActivation(const Component* instance) const { (void)instance; return false; }
+
         /**
          * Specifies warnings that you want in the component (will put a warning and a continue button).
          * @param warnings provided array of strings that would be the actual warnings.
@@ -705,6 +717,7 @@ namespace AZ
     AZ_HAS_STATIC_MEMBER(ComponentDependentServices, GetDependentServices, void, (ComponentDescriptor::DependencyArrayType &));
     AZ_HAS_STATIC_MEMBER(ComponentRequiredServices, GetRequiredServices, void, (ComponentDescriptor::DependencyArrayType &));
     AZ_HAS_STATIC_MEMBER(ComponentIncompatibleServices, GetIncompatibleServices, void, (ComponentDescriptor::DependencyArrayType &));
+    AZ_HAS_STATIC_MEMBER(ComponentSupportsParallelActivation, SupportsParallelActivation, bool, ());
     /// @endcond
 
     /**
@@ -777,6 +790,23 @@ namespace AZ
             CallIncompatibleServices(incompatible, typename HasComponentIncompatibleServices<ComponentClass>::type());
         }
 
+        /**
+         * Calls the static function SupportsParallelActivation, if the user provided it.
+         * @param instance Optional parameter with which you can refine the support for each instance. This value is null if no instance exists.
+         */
+        bool SupportsParallelActivation(const Component* instance) const override
+        {
+            (void)instance;
+            if constexpr (HasComponentSupportsParallelActivation<ComponentClass>::value)
+            {
+                return ComponentClass::SupportsParallelActivation();
+            }
+            else
+            {
+                return false;
+            }
+        }
+
     private:
 
         void CallReflect(ReflectContext* reflection, const AZStd::true_type&) const
@@ -21,6 +21,7 @@
 #include <AzCore/Memory/AllocationRecords.h>
 
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 
 #include <AzCore/Metrics/EventLoggerFactoryImpl.h>
 #include <AzCore/Metrics/JsonTraceEventLogger.h>
@@ -41,6 +42,7 @@
 #include <AzCore/Settings/CommandLineParser.h>
 #include <AzCore/Settings/ConfigParser.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Settings/SettingsRegistryMergeCache.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/Settings/SettingsRegistryScriptUtils.h>
 #include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
@@ -53,7 +55,9 @@
 #include <AzCore/IO/Path/PathReflect.h>
 #include <AzCore/IO/SystemFile.h>
 
+#include <AzCore/EBus/DispatchStatistics.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Debug/StartupTimeline.h>
 #include <AzCore/Script/ScriptSystemBus.h>
 
 #include <AzCore/Math/PolygonPrism.h>
@@ -445,6 +449,8 @@ namespace AZ
     ComponentApplication::ComponentApplication(int argC, char** argV, ComponentApplicationSettings componentAppSettings)
         : m_timeSystem(AZStd::make_unique<TimeSystem>())
     {
+        Debug::StartupTimeline::AddEvent("Lifecycle", "ComponentApplicationCreated");
+
         if (Interface<ComponentApplicationRequests>::Get() == nullptr)
         {
             Interface<ComponentApplicationRequests>::Register(this);
@@ -582,7 +588,10 @@ namespace AZ
         // Create the settings registry and register it with the AZ interface system
         // This is done after the AppRoot has been calculated so that the Bootstrap.cfg
         // can be read to determine the Game folder and the asset platform
-        m_settingsRegistry = AZStd::make_unique<SettingsRegistryImpl>();
+        auto settingsRegistry = AZStd::make_unique<SettingsRegistryImpl>();
+        // Systems read the application registry from worker threads, let them read without contending on the settings mutex
+        settingsRegistry->SetUseSnapshotReads(true);
+        m_settingsRegistry = AZStd::move(settingsRegistry);
         // Merge the bootstrap settings to the root of the Settings Registry
         m_settingsRegistry->MergeSettings(componentAppSettings.m_setregBootstrapJson, componentAppSettings.m_setregFormat);
 
@@ -1086,6 +1095,14 @@ namespace AZ
         const AZ::SettingsRegistryInterface::Specializations& specializations,
         AZStd::vector<char>& scratchBuffer)
     {
+        // When none of the settings files changed since the last launch, the merged result is loaded from the cache
+        SettingsRegistryMergeCache mergeCache(registry, specializations);
+        if (mergeCache.ApplyCachedSettings())
+        {
+            return;
+        }
+        mergeCache.StartRecording();
+
         constexpr bool overridesAllowedFromCommandLine =
             AZ::Internal::GetDevelopmentSettingsOverrides() == AZ::Internal::DevelopmentSettingsOverrides::CommandLineOnly ||
             AZ::Internal::GetDevelopmentSettingsOverrides() == AZ::Internal::DevelopmentSettingsOverrides::CommandLineAndProject ||
@@ -1148,6 +1165,8 @@ namespace AZ
                 registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
         }
 #endif
+
+        mergeCache.StopRecordingAndWriteCache();
     }
 
     void ComponentApplication::MergeUserSettings(
@@ -1605,6 +1624,12 @@ namespace AZ
     {
         AZ_PROFILE_SCOPE(System, "Component application simulation tick");
 
+        // The startup ends with the first tick
+        if (Debug::StartupTimeline::IsRecording())
+        {
+            Debug::StartupTimeline::Finish();
+        }
+
         // Only record when the record metrics on tick callback is set
         if (m_recordMetricsOnTickCallback)
         {
@@ -1632,6 +1657,15 @@ namespace AZ
             m_lastTickTime = currentMonotonicTime;
         }
 
+        {
+            AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:ResetFrameArena");
+            // Transient allocations from the previous frame are no longer referenced once the new tick starts
+            static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::Get()).Reset();
+        }
+
+        // The EBus dispatch statistics are reported per frame
+        EBusDispatchStatistics::EndFrame();
+
         {
             AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:ExecuteQueuedEvents");
             TickBus::ExecuteQueuedEvents();
@@ -1641,7 +1675,7 @@ namespace AZ
             AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:OnTick");
             const AZ::TimeUs deltaTimeUs = m_timeSystem->AdvanceTickDeltaTimes();
             const float deltaTimeSeconds = AZ::TimeUsToSeconds(deltaTimeUs);
-            AZ::TickBus::Broadcast(&TickEvents::OnTick, deltaTimeSeconds, GetTimeAtCurrentTick());
+            m_tickBusDispatcher.Dispatch(deltaTimeSeconds, GetTimeAtCurrentTick());
         }
 
         m_timeSystem->ApplyTickRateLimiterIfNeeded();
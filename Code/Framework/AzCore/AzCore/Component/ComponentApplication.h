@@ -12,6 +12,7 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Component/TickBusDispatcher.h>
 #include <AzCore/Memory/AllocationRecords.h>
 #include <AzCore/Debug/BudgetTracker.h>
 #include <AzCore/Memory/OSAllocator.h>
@@ -383,6 +384,7 @@ namespace AZ
         AZ::SettingsRegistryInterface::NotifyEventHandler m_commandLineUpdatedHandler;
 
         AZStd::unique_ptr<AZ::TimeSystem> m_timeSystem;
+        TickBusDispatcher m_tickBusDispatcher;
 
         // ConsoleFunctorHandle is responsible for unregistering the Settings Registry Console
         // from the m_console member when it goes out of scope
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Component/ComponentApplicationLifecycle.h>
+#include <AzCore/Debug/StartupTimeline.h>
 #include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
 
 namespace AZ::ComponentApplicationLifecycle
@@ -33,6 +34,8 @@ namespace AZ::ComponentApplicationLifecycle
                 " or in *.setreg within the project", AZ_STRING_ARG(eventName), AZ_STRING_ARG(ApplicationLifecycleEventRegistrationKey));
             return false;
         }
+        AZ::Debug::StartupTimeline::AddEvent("Lifecycle", eventName);
+
         // The Settings Registry key used to signal the event is a transient runtime key which is separate from the registration key
         auto eventSignalKey = FixedValueString::format("%.*s/%.*s", AZ_STRING_ARG(ApplicationLifecycleEventSignalKey),
             AZ_STRING_ARG(eventName));
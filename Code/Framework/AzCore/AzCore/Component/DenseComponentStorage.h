@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/string/fixed_string.h>
+
+namespace AZ
+{
+    /**
+     * Data oriented storage for the hot component types. The components of a type declared with AZ_DENSE_COMPONENT
+     * aren't allocated one by one, they are placed in chunks of ChunkCapacity contiguous slots, filling the lowest free
+     * slot first. A system can then update all the components of the type in bulk, walking the chunks linearly instead
+     * of reaching each component through its entity or an EBus, and split the chunks between the job threads.
+     *
+     * The components stay regular polymorphic AZ::Components owned by their entity, only their memory changes.
+     * The storage contains every allocated component of the type, including the ones of entities that aren't active
+     * (e.g. the entities of a loaded prefab that isn't spawned), so a system filters them with the entity state.
+     * The storage is locked while iterating: the callbacks must not create or destroy components of the same type.
+     * The storage is shared through the environment, the modules can create and delete the components of each other.
+     */
+    template<class ComponentType, size_t ChunkCapacity = 64>
+    class DenseComponentStorage
+    {
+        static_assert(ChunkCapacity > 0 && ChunkCapacity <= 64, "The slots of a chunk are tracked in a 64 bit mask");
+
+    public:
+        //! Returns the memory for a new component, called by the operator new of AZ_DENSE_COMPONENT.
+        static void* Allocate()
+        {
+            EnvironmentVariable<Storage>& storage = GetStorage();
+            AZStd::scoped_lock lock(storage->m_mutex);
+            return storage->Allocate();
+        }
+
+        //! Releases the memory of a component, called by the operator delete of AZ_DENSE_COMPONENT.
+        static void Deallocate(void* address)
+        {
+            EnvironmentVariable<Storage>& storage = GetStorage();
+            AZStd::scoped_lock lock(storage->m_mutex);
+            storage->Deallocate(address);
+        }
+
+        //! Calls @function(ComponentType&) for each component, in memory order.
+        template<class Function>
+        static void ForEach(const Function& function)
+        {
+            EnvironmentVariable<Storage>& storage = GetStorage();
+            AZStd::scoped_lock lock(storage->m_mutex);
+            for (Chunk* chunk : storage->m_chunks)
+            {
+                chunk->ForEach(function);
+            }
+        }
+
+        //! Calls @function(ComponentType&) for each component, the chunks are processed in parallel by the job threads
+        //! when there is a global job context. @function must be safe to call concurrently for different components.
+        template<class Function>
+        static void ParallelForEach(const Function& function)
+        {
+            EnvironmentVariable<Storage>& storage = GetStorage();
+            AZStd::scoped_lock lock(storage->m_mutex);
+            const auto& chunks = storage->m_chunks;
+            if (chunks.size() > 1 && JobContext::GetGlobalContext())
+            {
+                AZ::parallel_for(0, static_cast<int>(chunks.size()),
+                    [&chunks, &function](int chunkIndex)
+                    {
+                        chunks[chunkIndex]->ForEach(function);
+                    });
+            }
+            else
+            {
+                for (Chunk* chunk : chunks)
+                {
+                    chunk->ForEach(function);
+                }
+            }
+        }
+
+        //! Returns the number of components in the storage.
+        static size_t GetCount()
+        {
+            EnvironmentVariable<Storage>& storage = GetStorage();
+            AZStd::scoped_lock lock(storage->m_mutex);
+            return storage->m_count;
+        }
+
+        //! Returns the number of allocated chunks, a chunk is released once its last component is deleted.
+        static size_t GetChunkCount()
+        {
+            EnvironmentVariable<Storage>& storage = GetStorage();
+            AZStd::scoped_lock lock(storage->m_mutex);
+            return storage->m_chunks.size();
+        }
+
+    private:
+        struct Chunk
+        {
+            static constexpr AZ::u64 FullMask = ChunkCapacity == 64 ? ~AZ::u64{ 0 } : (AZ::u64{ 1 } << ChunkCapacity) - 1;
+
+            ComponentType* GetSlot(size_t slotIndex)
+            {
+                return reinterpret_cast<ComponentType*>(m_slots + slotIndex * sizeof(ComponentType));
+            }
+
+            template<class Function>
+            void ForEach(const Function& function)
+            {
+                for (AZ::u64 liveMask = m_liveMask; liveMask != 0; liveMask &= liveMask - 1)
+                {
+                    function(*GetSlot(az_ctz_u64(liveMask)));
+                }
+            }
+
+            alignas(ComponentType) unsigned char m_slots[ChunkCapacity * sizeof(ComponentType)];
+            AZ::u64 m_liveMask = 0;
+        };
+
+        struct Storage
+        {
+            void* Allocate()
+            {
+                for (; m_firstNonFullChunk < m_chunks.size(); ++m_firstNonFullChunk)
+                {
+                    Chunk* chunk = m_chunks[m_firstNonFullChunk];
+                    if (chunk->m_liveMask != Chunk::FullMask)
+                    {
+                        const size_t slotIndex = az_ctz_u64(~chunk->m_liveMask);
+                        chunk->m_liveMask |= AZ::u64{ 1 } << slotIndex;
+                        ++m_count;
+                        return chunk->GetSlot(slotIndex);
+                    }
+                }
+
+                // The chunks are sorted by address so the chunk of a component can be found with a binary search
+                Chunk* chunk = new (AllocatorInstance<SystemAllocator>::Get().allocate(sizeof(Chunk), alignof(Chunk))) Chunk;
+                auto insertPosition = AZStd::upper_bound(m_chunks.begin(), m_chunks.end(), chunk);
+                const size_t chunkIndex = static_cast<size_t>(insertPosition - m_chunks.begin());
+                m_chunks.insert(insertPosition, chunk);
+                m_firstNonFullChunk = AZStd::min(m_firstNonFullChunk, chunkIndex);
+
+                chunk->m_liveMask = 1;
+                ++m_count;
+                return chunk->GetSlot(0);
+            }
+
+            void Deallocate(void* address)
+            {
+                auto chunkIter = AZStd::upper_bound(m_chunks.begin(), m_chunks.end(), static_cast<Chunk*>(address));
+                AZ_Assert(chunkIter != m_chunks.begin(), "Component %p of %s doesn't belong to the dense storage.", address,
+                    AzTypeInfo<ComponentType>::Name());
+                --chunkIter;
+                Chunk* chunk = *chunkIter;
+                const size_t slotIndex = static_cast<size_t>(static_cast<unsigned char*>(address) - chunk->m_slots) / sizeof(ComponentType);
+                AZ_Assert(slotIndex < ChunkCapacity && (chunk->m_liveMask & (AZ::u64{ 1 } << slotIndex)),
+                    "Component %p of %s doesn't belong to the dense storage.", address, AzTypeInfo<ComponentType>::Name());
+
+                chunk->m_liveMask &= ~(AZ::u64{ 1 } << slotIndex);
+                --m_count;
+                const size_t chunkIndex = static_cast<size_t>(chunkIter - m_chunks.begin());
+                if (chunk->m_liveMask == 0)
+                {
+                    m_chunks.erase(chunkIter);
+                    chunk->~Chunk();
+                    AllocatorInstance<SystemAllocator>::Get().deallocate(chunk, sizeof(Chunk), alignof(Chunk));
+                    if (chunkIndex < m_firstNonFullChunk)
+                    {
+                        --m_firstNonFullChunk;
+                    }
+                }
+                else
+                {
+                    m_firstNonFullChunk = AZStd::min(m_firstNonFullChunk, chunkIndex);
+                }
+            }
+
+            AZStd::mutex m_mutex;
+            // Outlives the system allocator when the environment is destroyed last
+            AZStd::vector<Chunk*, OSStdAllocator> m_chunks;
+            //! The chunks before this index are full.
+            size_t m_firstNonFullChunk = 0;
+            size_t m_count = 0;
+        };
+
+        static EnvironmentVariable<Storage>& GetStorage()
+        {
+            static EnvironmentVariable<Storage> s_storage = []()
+            {
+                const auto variableName = AZStd::fixed_string<128>::format("DenseComponentStorage<%s>", AzTypeInfo<ComponentType>::Name());
+                EnvironmentVariable<Storage> storage = Environment::FindVariable<Storage>(variableName.c_str());
+                return storage ? storage : Environment::CreateVariable<Storage>(variableName.c_str());
+            }();
+            return s_storage;
+        }
+    };
+} // namespace AZ
+
+//! Allocates the component in its AZ::DenseComponentStorage, replaces the AZ_CLASS_ALLOCATOR of the component.
+#define AZ_DENSE_COMPONENT_ALLOCATOR(_ComponentClass)                                                                                      \
+    AZ_FORCE_INLINE void* operator new(std::size_t, void* p) { return p; }                                                                 \
+    AZ_FORCE_INLINE void* operator new[](std::size_t, void* p) { return p; }                                                               \
+    AZ_FORCE_INLINE void operator delete(void*, void*) {}                                                                                  \
+    AZ_FORCE_INLINE void operator delete[](void*, void*) {}                                                                                \
+    AZ_FORCE_INLINE void* operator new([[maybe_unused]] std::size_t size) {                                                                \
+        AZ_Assert(size == sizeof(_ComponentClass), "Size mismatch! Did you forget to declare the macro in derived class? Size: %d sizeof(%s): %d", \
+            size, #_ComponentClass, sizeof(_ComponentClass));                                                                              \
+        return AZ::DenseComponentStorage<_ComponentClass>::Allocate();                                                                    \
+    }                                                                                                                                      \
+    AZ_FORCE_INLINE void operator delete(void* p, std::size_t) {                                                                           \
+        if (p) { AZ::DenseComponentStorage<_ComponentClass>::Deallocate(p); }                                                              \
+    }                                                                                                                                      \
+    AZ_FORCE_INLINE void* operator new[](std::size_t) {                                                                                    \
+        AZ_Assert(false, "Dense components can't be allocated in arrays, they are stored in AZ::DenseComponentStorage.");                  \
+        return AZ_INVALID_POINTER;                                                                                                         \
+    }                                                                                                                                      \
+    AZ_FORCE_INLINE void operator delete[](void*) {                                                                                        \
+        AZ_Assert(false, "Dense components can't be allocated in arrays, they are stored in AZ::DenseComponentStorage.");                  \
+    }                                                                                                                                      \
+    AZ_FORCE_INLINE static void* AZ_CLASS_ALLOCATOR_Allocate() {                                                                           \
+        return AZ::DenseComponentStorage<_ComponentClass>::Allocate();                                                                    \
+    }                                                                                                                                      \
+    AZ_FORCE_INLINE static void AZ_CLASS_ALLOCATOR_DeAllocate(void* object) {                                                              \
+        AZ::DenseComponentStorage<_ComponentClass>::Deallocate(object);                                                                   \
+    }
+
+//! Declares a component like AZ_COMPONENT, with its instances stored in an AZ::DenseComponentStorage.
+#define AZ_DENSE_COMPONENT(_ComponentClass, ...)                                                                                           \
+    AZ_RTTI(_ComponentClass, __VA_ARGS__, AZ::Component)                                                                                   \
+    AZ_COMPONENT_INTRUSIVE_DESCRIPTOR_TYPE(_ComponentClass)                                                                                \
+    AZ_COMPONENT_BASE(_ComponentClass)                                                                                                     \
+    AZ_DENSE_COMPONENT_ALLOCATOR(_ComponentClass)
@@ -33,6 +33,7 @@
 #include <AzCore/Platform.h>
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Debug/StartupTimeline.h>
 
 DECLARE_EBUS_INSTANTIATION(EntityEvents);
 DECLARE_EBUS_INSTANTIATION(TransformInterface);
@@ -162,6 +163,13 @@ namespace AZ
     }
 
     void Entity::Init()
+    {
+        BeginInit();
+        InitComponents();
+        EndInit();
+    }
+
+    void Entity::BeginInit()
     {
         AZ_Assert(m_state == State::Constructed, "Component should be in Constructed state to be Initialized!");
         SetState(State::Initializing);
@@ -171,7 +179,10 @@ namespace AZ
             [[maybe_unused]] const bool result = AZ::Interface<ComponentApplicationRequests>::Get()->AddEntity(this);
             AZ_Assert(result, "Failed to add entity '%s' [0x%llx]! Did you already register an entity with this ID?", m_name.c_str(), m_id);
         }
+    }
 
+    void Entity::InitComponents()
+    {
         for (ComponentArrayType::iterator it = m_components.begin(); it != m_components.end();)
         {
             Component* component = *it;
@@ -186,7 +197,10 @@ namespace AZ
                 it = m_components.erase(it);
             }
         }
+    }
 
+    void Entity::EndInit()
+    {
         SetState(State::Init);
 
         EntityBus::Event(m_id, &EntityBus::Events::OnEntityExists, m_id);
@@ -197,22 +211,48 @@ namespace AZ
     {
         AZ_PROFILE_FUNCTION(AzCore);
 
+        if (BeginActivate())
+        {
+            ActivateComponents();
+            EndActivate();
+        }
+    }
+
+    bool Entity::BeginActivate()
+    {
         AZ_Assert(m_state == State::Init, "Entity should be in Init state to be Activated!");
 
         const DependencySortOutcome sortOutcome = EvaluateDependenciesGetDetails();
         if (!sortOutcome.IsSuccess())
         {
             AZ_Error("Entity", false, "Entity '%s' %s cannot be activated. %s", m_name.c_str(), m_id.ToString().c_str(), sortOutcome.GetError().m_message.c_str());
-            return;
+            return false;
         }
 
         SetState(State::Activating);
+        return true;
+    }
+
+    void Entity::ActivateComponents()
+    {
+        if (Debug::StartupTimeline::IsRecording())
+        {
+            for (Component* component : m_components)
+            {
+                Debug::StartupTimeline::Scope startupScope("Activate", component->RTTI_GetTypeName());
+                ActivateComponent(*component);
+            }
+            return;
+        }
 
         for (ComponentArrayType::iterator it = m_components.begin(); it != m_components.end(); ++it)
         {
             ActivateComponent(**it);
         }
+    }
 
+    void Entity::EndActivate()
+    {
         SetState(State::Active);
 
         EntityBus::Event(m_id, &EntityBus::Events::OnEntityActivated, m_id);
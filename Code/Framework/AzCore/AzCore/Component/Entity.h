@@ -32,6 +32,7 @@ namespace AZ
     class Entity
     {
         friend class JsonEntitySerializer;
+        friend class EntityBatchActivator;
 
     public:
 
@@ -395,6 +396,18 @@ namespace AZ
         //! @return True if the entity is in a state in which that components can be added or removed, otherwise false.
         bool CanAddRemoveComponents() const;
 
+        //! Steps of Init and Activate, which EntityBatchActivator runs separately so the components of
+        //! multiple entities can be initialized and activated together.
+        //! @{
+        void BeginInit();
+        void InitComponents();
+        void EndInit();
+        //! Returns false if the component dependencies can't be sorted, in which case the entity isn't activated.
+        bool BeginActivate();
+        void ActivateComponents();
+        void EndActivate();
+        //! @}
+
         // Helpers for child classes
         static void ActivateComponent(Component& component) { component.Activate(); }
         static void DeactivateComponent(Component& component) { component.Deactivate(); }
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/EntityBatchActivator.h>
+#include <AzCore/Component/Component.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
+
+namespace AZ
+{
+    namespace EntityBatchActivatorInternal
+    {
+        //! Number of entities initialized or activated by each task
+        constexpr size_t EntitiesPerTask = 8;
+
+        //! Classes derived from Entity can override Init and Activate, so they're always processed through those functions
+        bool IsPlainEntity(const Entity& entity)
+        {
+            return azrtti_typeid(&entity) == azrtti_typeid<Entity>();
+        }
+
+        //! Waiting for tasks from a task worker could deadlock the executor
+        bool CanRunTasks()
+        {
+            const TaskGraphActiveInterface* taskGraphActive = Interface<TaskGraphActiveInterface>::Get();
+            return taskGraphActive && taskGraphActive->IsTaskGraphActive() && TaskExecutor::GetCurrentExecutor() == nullptr;
+        }
+
+        //! Runs the parallel callback for each of the parallel entities on the task executor, while the sequential
+        //! callback runs for each of the sequential entities on the calling thread.
+        template<class ParallelCallback, class SequentialCallback>
+        void Process(AZStd::span<Entity* const> parallelEntities, const ParallelCallback& parallelCallback,
+            AZStd::span<Entity* const> sequentialEntities, const SequentialCallback& sequentialCallback)
+        {
+            static const TaskDescriptor processDescriptor{ "EntityBatchActivator::Process", "Entity" };
+            TaskGraph graph{ "EntityBatchActivator" };
+            for (size_t begin = 0; begin < parallelEntities.size(); begin += EntitiesPerTask)
+            {
+                AZStd::span<Entity* const> taskEntities =
+                    parallelEntities.subspan(begin, AZStd::min(EntitiesPerTask, parallelEntities.size() - begin));
+                graph.AddTask(processDescriptor,
+                    [taskEntities, &parallelCallback]()
+                    {
+                        for (Entity* entity : taskEntities)
+                        {
+                            parallelCallback(*entity);
+                        }
+                    });
+            }
+
+            TaskGraphEvent finishedEvent{ "EntityBatchActivator Wait" };
+            graph.Submit(&finishedEvent);
+            for (Entity* entity : sequentialEntities)
+            {
+                sequentialCallback(*entity);
+            }
+            finishedEvent.Wait();
+        }
+    } // namespace EntityBatchActivatorInternal
+
+    void EntityBatchActivator::InitEntities(AZStd::span<Entity* const> entities)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        using namespace EntityBatchActivatorInternal;
+
+        if (!CanRunTasks())
+        {
+            for (Entity* entity : entities)
+            {
+                if (entity->GetState() == Entity::State::Constructed)
+                {
+                    entity->Init();
+                }
+            }
+            return;
+        }
+
+        AZStd::vector<Entity*> parallelEntities;
+        AZStd::vector<Entity*> sequentialEntities;
+        for (Entity* entity : entities)
+        {
+            if (entity->GetState() != Entity::State::Constructed)
+            {
+                continue;
+            }
+
+            const CachedSignature* signature = IsPlainEntity(*entity) ? FindOrAddSignature(*entity) : nullptr;
+            if (signature && signature->m_supportsParallelActivation)
+            {
+                parallelEntities.push_back(entity);
+            }
+            else
+            {
+                sequentialEntities.push_back(entity);
+            }
+        }
+
+        for (Entity* entity : parallelEntities)
+        {
+            entity->BeginInit();
+        }
+        Process(parallelEntities, [](Entity& entity) { entity.InitComponents(); },
+            sequentialEntities, [](Entity& entity) { entity.Init(); });
+        for (Entity* entity : parallelEntities)
+        {
+            entity->EndInit();
+        }
+    }
+
+    void EntityBatchActivator::ActivateEntities(AZStd::span<Entity* const> entities)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        using namespace EntityBatchActivatorInternal;
+
+        const bool canRunTasks = CanRunTasks();
+        AZStd::vector<Entity*> parallelEntities;
+        AZStd::vector<Entity*> sequentialEntities;
+        for (Entity* entity : entities)
+        {
+            if (entity->GetState() != Entity::State::Init)
+            {
+                continue;
+            }
+
+            CachedSignature* signature = IsPlainEntity(*entity) ? FindOrAddSignature(*entity) : nullptr;
+            const bool isSorted = SortComponents(*entity, signature);
+            if (!canRunTasks)
+            {
+                // Keep the order of the entities when everything runs on the calling thread
+                entity->Activate();
+            }
+            else if (isSorted && signature && signature->m_supportsParallelActivation)
+            {
+                parallelEntities.push_back(entity);
+            }
+            else
+            {
+                sequentialEntities.push_back(entity);
+            }
+        }
+
+        if (!canRunTasks)
+        {
+            return;
+        }
+
+        for (Entity* entity : parallelEntities)
+        {
+            [[maybe_unused]] const bool canActivate = entity->BeginActivate();
+            AZ_Assert(canActivate, "The components of entities activated in parallel were sorted in advance.");
+        }
+        Process(parallelEntities, [](Entity& entity) { entity.ActivateComponents(); },
+            sequentialEntities, [](Entity& entity) { entity.Activate(); });
+        for (Entity* entity : parallelEntities)
+        {
+            entity->EndActivate();
+        }
+    }
+
+    void EntityBatchActivator::ClearCache()
+    {
+        m_signatures.clear();
+    }
+
+    auto EntityBatchActivator::FindOrAddSignature(const Entity& entity) -> CachedSignature*
+    {
+        const Entity::ComponentArrayType& components = entity.GetComponents();
+        if (AZStd::find(components.begin(), components.end(), nullptr) != components.end())
+        {
+            return nullptr;
+        }
+
+        m_canonicalComponents = components;
+        AZStd::sort(m_canonicalComponents.begin(), m_canonicalComponents.end(),
+            [](const Component* lhs, const Component* rhs)
+            {
+                const TypeId lhsType = azrtti_typeid(lhs);
+                const TypeId rhsType = azrtti_typeid(rhs);
+                if (lhsType != rhsType)
+                {
+                    return lhsType < rhsType;
+                }
+                const TypeId lhsUnderlyingType = lhs->GetUnderlyingComponentType();
+                const TypeId rhsUnderlyingType = rhs->GetUnderlyingComponentType();
+                if (lhsUnderlyingType != rhsUnderlyingType)
+                {
+                    return lhsUnderlyingType < rhsUnderlyingType;
+                }
+                return lhs->GetId() < rhs->GetId();
+            });
+
+        AZStd::vector<TypeId> signature;
+        signature.reserve(m_canonicalComponents.size() * 2);
+        size_t signatureHash = 0;
+        for (const Component* component : m_canonicalComponents)
+        {
+            signature.push_back(azrtti_typeid(component));
+            signature.push_back(component->GetUnderlyingComponentType());
+            AZStd::hash_combine(signatureHash, signature[signature.size() - 2], signature.back());
+        }
+
+        auto [signatureIt, inserted] = m_signatures.try_emplace(signatureHash);
+        CachedSignature& cachedSignature = signatureIt->second;
+        if (!inserted)
+        {
+            // A different signature with the same hash keeps using the regular path
+            return cachedSignature.m_signature == signature ? &cachedSignature : nullptr;
+        }
+
+        cachedSignature.m_signature = AZStd::move(signature);
+        cachedSignature.m_supportsParallelActivation = !m_canonicalComponents.empty();
+        for (const Component* component : m_canonicalComponents)
+        {
+            ComponentDescriptor* descriptor = nullptr;
+            ComponentDescriptorBus::EventResult(descriptor, azrtti_typeid(component), &ComponentDescriptorBus::Events::GetDescriptor);
+            if (!descriptor || !descriptor->SupportsParallelActivation(component))
+            {
+                cachedSignature.m_supportsParallelActivation = false;
+                break;
+            }
+        }
+        return &cachedSignature;
+    }
+
+    bool EntityBatchActivator::SortComponents(Entity& entity, CachedSignature* signature)
+    {
+        if (entity.m_isDependencyReady)
+        {
+            return true;
+        }
+
+        // FindOrAddSignature left the components of the entity in signature order in the scratch buffer
+        if (signature && !signature->m_order.empty())
+        {
+            Entity::ComponentArrayType& components = entity.m_components;
+            for (size_t i = 0; i < components.size(); ++i)
+            {
+                components[i] = m_canonicalComponents[signature->m_order[i]];
+            }
+            entity.m_isDependencyReady = true;
+            return true;
+        }
+
+        // The error is reported when the entity is activated
+        if (!entity.EvaluateDependenciesGetDetails().IsSuccess())
+        {
+            return false;
+        }
+
+        if (signature)
+        {
+            const Entity::ComponentArrayType& components = entity.m_components;
+            signature->m_order.reserve(components.size());
+            for (const Component* component : components)
+            {
+                signature->m_order.push_back(
+                    AZStd::find(m_canonicalComponents.begin(), m_canonicalComponents.end(), component) - m_canonicalComponents.begin());
+            }
+        }
+        return true;
+    }
+} // namespace AZ
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    //! Initializes and activates batches of entities, such as all the entities of a spawnable that arrive in the same frame.
+    //! The service dependency order of the components is computed once per component type signature and cached, so
+    //! entities made of the same component types don't need to be sorted again. This assumes that the services of a
+    //! component are the same for all instances with the same type and underlying type.
+    //! Entities whose components all support parallel activation (see ComponentDescriptor::SupportsParallelActivation)
+    //! have their components initialized and activated on the task executor. The other entities are processed one at a
+    //! time on the calling thread, in the order they were provided.
+    //! Registering the entities with the component application, sending the entity bus events and changing the entity
+    //! states always happens on the calling thread.
+    class EntityBatchActivator
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(EntityBatchActivator, SystemAllocator);
+
+        //! Same as calling Init on each of the entities that are in the Constructed state.
+        void InitEntities(AZStd::span<Entity* const> entities);
+        //! Same as calling Activate on each of the entities that are in the Init state.
+        void ActivateEntities(AZStd::span<Entity* const> entities);
+
+        //! Clears the cached dependency orders, for instance after component descriptors were replaced.
+        void ClearCache();
+
+    private:
+        //! Information shared by all the entities with the same component signature.
+        //! The signature contains the type and underlying type of each component, with the components sorted by type,
+        //! underlying type and component id. The dependency sort result is a permutation of that order.
+        struct CachedSignature
+        {
+            AZStd::vector<TypeId> m_signature;
+            //! Index in the signature of each component, in dependency order. Empty until the components were sorted.
+            AZStd::vector<size_t> m_order;
+            bool m_supportsParallelActivation = false;
+        };
+
+        //! Returns the cached information for the components of the entity, or nullptr if the entity can't use the cache.
+        CachedSignature* FindOrAddSignature(const Entity& entity);
+        //! Sorts the components of the entity in dependency order, using the cached order if there is one.
+        //! @return False if the components couldn't be sorted.
+        bool SortComponents(Entity& entity, CachedSignature* signature);
+
+        AZStd::unordered_map<size_t, CachedSignature> m_signatures;
+        Entity::ComponentArrayType m_canonicalComponents; //!< Scratch buffer for the components sorted by signature order
+    };
+} // namespace AZ
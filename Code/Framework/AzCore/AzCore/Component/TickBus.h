@@ -16,7 +16,9 @@
 #define AZCORE_COMPONENT_TICK_BUS_H
 
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/Math/Crc.h>
 #include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/parallel/mutex.h> // For TickBus thread events.
 #include <AzCore/Script/ScriptTimePoint.h>
 
@@ -133,6 +135,30 @@ namespace AZ
             return m_tickOrder;
         }
 
+        /**
+         * The data that a handler reads and writes in OnTick.
+         * The ids are chosen by the handlers, for instance the Crc32 of a component or system name.
+         */
+        struct TickDataAccess
+        {
+            AZStd::span<const Crc32> m_reads;
+            AZStd::span<const Crc32> m_writes;
+        };
+
+        /**
+         * Opts the handler in to parallel ticks. Handlers with the same tick order that declare their data access
+         * can receive OnTick at the same time on the task executor, unless one of them writes data that the other
+         * reads or writes. Handlers that don't declare their data access are ticked alone, in tick order.
+         * Handlers ticked in parallel must not connect or disconnect TickBus handlers in OnTick.
+         * @param[out] access The data read and written in OnTick. The spans must stay valid until the next tick.
+         * @return True if the handler declared its data access.
+         */
+        virtual bool    GetTickDataAccess(TickDataAccess& access)
+        {
+            (void)access;
+            return false;
+        }
+
     protected:
         // Only the component application is allowed to issue ticks.
         friend class ComponentApplication;
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/TickBusDispatcher.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ
+{
+    namespace TickBusDispatcherInternal
+    {
+        bool CanRunTasks()
+        {
+            const TaskGraphActiveInterface* taskGraphActive = Interface<TaskGraphActiveInterface>::Get();
+            return taskGraphActive && taskGraphActive->IsTaskGraphActive() && TaskExecutor::GetCurrentExecutor() == nullptr;
+        }
+
+        bool Contains(const AZStd::vector<Crc32>& ids, Crc32 id)
+        {
+            return AZStd::find(ids.begin(), ids.end(), id) != ids.end();
+        }
+    } // namespace TickBusDispatcherInternal
+
+    //! Sits on the TickBus callstack for the whole dispatch, so the dispatcher hears about the handlers that
+    //! disconnect (or are destroyed) while it still holds them in its phase and waves.
+    class TickBusDispatcher::DisconnectWatcher
+        : public Internal::CallstackEntry<TickEvents, TickEvents>
+    {
+        using Base = Internal::CallstackEntry<TickEvents, TickEvents>;
+
+    public:
+        DisconnectWatcher(TickBus::Context* context, TickBusDispatcher& dispatcher)
+            : Base(context, nullptr)
+            , m_dispatcher(dispatcher)
+        {
+        }
+
+        void OnRemoveHandler(TickEvents* handler) override
+        {
+            m_dispatcher.OnHandlerDisconnected(handler);
+            Base::OnRemoveHandler(handler);
+        }
+
+    private:
+        TickBusDispatcher& m_dispatcher;
+    };
+
+    void TickBusDispatcher::Dispatch(float deltaTime, ScriptTimePoint time)
+    {
+        if (!TickBusDispatcherInternal::CanRunTasks())
+        {
+            TickBus::Broadcast(&TickEvents::OnTick, deltaTime, time);
+            return;
+        }
+
+        TickBus::Context* context = TickBus::GetContext();
+        if (!context)
+        {
+            return;
+        }
+
+        DisconnectWatcher watcher(context, *this);
+        TickBus::EnumerateHandlers(
+            [this, deltaTime, &time](TickEvents* handler)
+            {
+                TickEvents::TickDataAccess access;
+                const bool declaresAccess = handler->GetTickDataAccess(access);
+                const int tickOrder = handler->GetTickOrder();
+
+                // Handlers that didn't declare their data access can connect and disconnect handlers, so the
+                // handlers before them are ticked first
+                if (!m_phase.empty() && (!declaresAccess || tickOrder != m_phaseTickOrder))
+                {
+                    // The flushed handlers can disconnect the current one, in which case it's skipped
+                    m_currentHandler = handler;
+                    FlushPhase(deltaTime, time);
+                    handler = m_currentHandler;
+                    m_currentHandler = nullptr;
+                    if (!handler)
+                    {
+                        return true;
+                    }
+                }
+
+                if (declaresAccess)
+                {
+                    m_phaseTickOrder = tickOrder;
+                    m_phase.push_back({ handler, access });
+                }
+                else
+                {
+                    handler->OnTick(deltaTime, time);
+                }
+                return true;
+            });
+        FlushPhase(deltaTime, time);
+    }
+
+    void TickBusDispatcher::OnHandlerDisconnected(TickEvents* handler)
+    {
+        if (m_currentHandler == handler)
+        {
+            m_currentHandler = nullptr;
+        }
+        for (PhaseHandler& phaseHandler : m_phase)
+        {
+            if (phaseHandler.m_handler == handler)
+            {
+                phaseHandler.m_handler = nullptr;
+            }
+        }
+        for (Wave& wave : m_waves)
+        {
+            AZStd::replace(wave.m_handlers.begin(), wave.m_handlers.end(), handler, static_cast<TickEvents*>(nullptr));
+        }
+    }
+
+    void TickBusDispatcher::FlushPhase(float deltaTime, const ScriptTimePoint& time)
+    {
+        using namespace TickBusDispatcherInternal;
+
+        if (m_phase.size() <= 1)
+        {
+            if (!m_phase.empty())
+            {
+                TickEvents* handler = m_phase.front().m_handler;
+                m_phase.clear();
+                if (handler)
+                {
+                    handler->OnTick(deltaTime, time);
+                }
+            }
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        // Each handler goes in the first wave after the last wave it conflicts with
+        size_t waveCount = 0;
+        for (const PhaseHandler& phaseHandler : m_phase)
+        {
+            if (!phaseHandler.m_handler)
+            {
+                continue; // Disconnected, its data access may not be valid anymore
+            }
+
+            const TickEvents::TickDataAccess& access = phaseHandler.m_access;
+            size_t waveIndex = waveCount;
+            while (waveIndex > 0)
+            {
+                const Wave& previousWave = m_waves[waveIndex - 1];
+                const bool conflicts =
+                    AZStd::any_of(access.m_writes.begin(), access.m_writes.end(),
+                        [&previousWave](Crc32 id)
+                        {
+                            return Contains(previousWave.m_reads, id) || Contains(previousWave.m_writes, id);
+                        }) ||
+                    AZStd::any_of(access.m_reads.begin(), access.m_reads.end(),
+                        [&previousWave](Crc32 id)
+                        {
+                            return Contains(previousWave.m_writes, id);
+                        });
+                if (conflicts)
+                {
+                    break;
+                }
+                --waveIndex;
+            }
+
+            if (waveIndex == waveCount)
+            {
+                if (m_waves.size() == waveCount)
+                {
+                    m_waves.emplace_back();
+                }
+                ++waveCount;
+            }
+
+            Wave& wave = m_waves[waveIndex];
+            wave.m_handlers.push_back(phaseHandler.m_handler);
+            wave.m_reads.insert(wave.m_reads.end(), access.m_reads.begin(), access.m_reads.end());
+            wave.m_writes.insert(wave.m_writes.end(), access.m_writes.begin(), access.m_writes.end());
+        }
+        m_phase.clear();
+
+        for (size_t waveIndex = 0; waveIndex < waveCount; ++waveIndex)
+        {
+            Wave& wave = m_waves[waveIndex];
+            TickWave(wave, deltaTime, time);
+            wave.m_handlers.clear();
+            wave.m_reads.clear();
+            wave.m_writes.clear();
+        }
+    }
+
+    void TickBusDispatcher::TickWave(const Wave& wave, float deltaTime, const ScriptTimePoint& time)
+    {
+        if (wave.m_handlers.size() == 1)
+        {
+            if (TickEvents* handler = wave.m_handlers.front())
+            {
+                handler->OnTick(deltaTime, time);
+            }
+            return;
+        }
+
+        static const TaskDescriptor tickDescriptor{ "TickBusDispatcher::OnTick", "TickBus" };
+        TaskGraph graph{ "TickBus Wave" };
+        for (TickEvents* handler : wave.m_handlers)
+        {
+            if (!handler)
+            {
+                continue;
+            }
+            graph.AddTask(tickDescriptor,
+                [handler, deltaTime, &time]()
+                {
+                    handler->OnTick(deltaTime, time);
+                });
+        }
+        if (graph.IsEmpty())
+        {
+            return;
+        }
+
+        TaskGraphEvent finishedEvent{ "TickBus Wave Wait" };
+        graph.Submit(&finishedEvent);
+        finishedEvent.Wait();
+    }
+} // namespace AZ
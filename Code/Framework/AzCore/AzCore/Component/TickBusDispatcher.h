@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    //! Sends OnTick to the TickBus handlers in tick order.
+    //! Consecutive handlers with the same tick order that declare their data access (see TickEvents::GetTickDataAccess)
+    //! form a phase. The handlers of a phase are split in waves of handlers that don't conflict with each other, and
+    //! the handlers of a wave are ticked at the same time on the task executor. A handler is always ticked after the
+    //! handlers of the phase that come before it in tick order and conflict with it.
+    //! Everything is ticked on the calling thread when the task graph isn't active.
+    //! Handlers that disconnect while the dispatcher holds on to them are skipped.
+    class TickBusDispatcher
+    {
+    public:
+        void Dispatch(float deltaTime, ScriptTimePoint time);
+
+    private:
+        class DisconnectWatcher;
+
+        struct PhaseHandler
+        {
+            TickEvents* m_handler = nullptr;
+            TickEvents::TickDataAccess m_access;
+        };
+
+        struct Wave
+        {
+            AZStd::vector<TickEvents*> m_handlers;
+            AZStd::vector<Crc32> m_reads;
+            AZStd::vector<Crc32> m_writes;
+        };
+
+        //! Ticks the handlers of the current phase, then clears it.
+        void FlushPhase(float deltaTime, const ScriptTimePoint& time);
+        void TickWave(const Wave& wave, float deltaTime, const ScriptTimePoint& time);
+        //! Forgets a handler that disconnected from the TickBus during the dispatch.
+        void OnHandlerDisconnected(TickEvents* handler);
+
+        AZStd::vector<PhaseHandler> m_phase;
+        AZStd::vector<Wave> m_waves; //!< Reused between ticks to keep the allocations
+        int m_phaseTickOrder = TICK_DEFAULT;
+        TickEvents* m_currentHandler = nullptr; //!< Handler being enumerated while the phase before it is flushed
+    };
+} // namespace AZ
@@ -8,6 +8,19 @@
 
 #include <AzCore/Console/LoggerSystemComponent.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/fixed_string.h>
+
+AZ_CVAR(
+    bool,
+    sys_asyncLogging,
+    false,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "If set, the logs below the error level are queued by the logging threads and dispatched to the log handlers and the trace "
+    "system on a background thread. The logs are dropped when the queue is full. Errors and fatal logs are still dispatched "
+    "immediately, after the queued logs.");
 
 namespace AZ
 {
@@ -35,6 +48,142 @@ namespace AZ
         return "UNKNOWN";
     }
 
+    // Bounded multiple producer, single consumer ring of formatted logs. The producers claim a slot with a compare and swap on
+    // the enqueue position and publish it with the slot sequence, the dispatch side is serialized by a mutex so Flush can drain
+    // the ring from any thread.
+    class LoggerSystemComponent::AsyncDispatcher
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(AsyncDispatcher, AZ::SystemAllocator);
+
+        static constexpr size_t Capacity = 1024;
+        static_assert(IsPowerOfTwo(Capacity), "The async log ring capacity must be a power of two");
+
+        explicit AsyncDispatcher(LoggerSystemComponent& logger)
+            : m_logger(logger)
+        {
+            for (size_t index = 0; index < Capacity; ++index)
+            {
+                m_records[index].m_sequence.store(index, AZStd::memory_order_relaxed);
+            }
+
+            AZStd::thread_desc threadDesc;
+            threadDesc.m_name = "Async Logger";
+            m_thread = AZStd::thread(
+                threadDesc,
+                [this]()
+                {
+                    while (m_running.load(AZStd::memory_order_acquire))
+                    {
+                        m_wakeSemaphore.acquire();
+                        DispatchPending();
+                    }
+                });
+        }
+
+        ~AsyncDispatcher()
+        {
+            m_running.store(false, AZStd::memory_order_release);
+            m_wakeSemaphore.release();
+            m_thread.join();
+            DispatchPending();
+        }
+
+        //! Queues a log, returns false when the ring is full and the log was dropped.
+        bool Enqueue(LogLevel level, AZStd::string_view message, const char* file, const char* function, int32_t line)
+        {
+            size_t position = m_enqueuePosition.load(AZStd::memory_order_relaxed);
+            Record* record = nullptr;
+            for (;;)
+            {
+                record = &m_records[position & (Capacity - 1)];
+                const size_t sequence = record->m_sequence.load(AZStd::memory_order_acquire);
+                const ptrdiff_t difference = static_cast<ptrdiff_t>(sequence - position);
+                if (difference == 0)
+                {
+                    if (m_enqueuePosition.compare_exchange_weak(position, position + 1, AZStd::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    m_droppedCount.fetch_add(1, AZStd::memory_order_relaxed);
+                    return false;
+                }
+                else
+                {
+                    position = m_enqueuePosition.load(AZStd::memory_order_relaxed);
+                }
+            }
+
+            record->m_level = level;
+            record->m_message = message;
+            record->m_file = file;
+            record->m_function = function;
+            record->m_line = line;
+            record->m_sequence.store(position + 1, AZStd::memory_order_release);
+
+            m_wakeSemaphore.release();
+            return true;
+        }
+
+        //! Dispatches the queued logs on the calling thread.
+        void DispatchPending()
+        {
+            // recursive, a log handler may log an error, which flushes the queue
+            AZStd::scoped_lock lock(m_dispatchMutex);
+            for (;;)
+            {
+                Record& record = m_records[m_dequeuePosition & (Capacity - 1)];
+                if (record.m_sequence.load(AZStd::memory_order_acquire) != m_dequeuePosition + 1)
+                {
+                    break;
+                }
+
+                // release the slot before dispatching, the handlers can log again
+                const LogLevel level = record.m_level;
+                const MessageString message = record.m_message;
+                const char* file = record.m_file;
+                const char* function = record.m_function;
+                const int32_t line = record.m_line;
+                record.m_sequence.store(m_dequeuePosition + Capacity, AZStd::memory_order_release);
+                ++m_dequeuePosition;
+
+                m_logger.DispatchLog(level, message.c_str(), file, function, line);
+            }
+
+            if (const size_t droppedCount = m_droppedCount.exchange(0, AZStd::memory_order_relaxed); droppedCount > 0)
+            {
+                AZ::Debug::Trace::Instance().Printf(
+                    Debug::Trace::GetDefaultSystemWindow(), "%zu logs were dropped, the async log queue was full.\n", droppedCount);
+            }
+        }
+
+    private:
+        using MessageString = AZStd::fixed_string<MaxLogBufferSize>;
+
+        struct Record
+        {
+            AZStd::atomic<size_t> m_sequence{ 0 };
+            LogLevel m_level = LogLevel::Info;
+            MessageString m_message;
+            const char* m_file = nullptr;
+            const char* m_function = nullptr;
+            int32_t m_line = 0;
+        };
+
+        LoggerSystemComponent& m_logger;
+        Record m_records[Capacity];
+        AZStd::atomic<size_t> m_enqueuePosition{ 0 };
+        AZStd::atomic<size_t> m_droppedCount{ 0 };
+        size_t m_dequeuePosition = 0;
+        AZStd::recursive_mutex m_dispatchMutex;
+        AZStd::binary_semaphore m_wakeSemaphore;
+        AZStd::atomic_bool m_running{ true };
+        AZStd::thread m_thread;
+    };
+
     void LoggerSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -62,6 +211,9 @@ namespace AZ
 
     LoggerSystemComponent::~LoggerSystemComponent()
     {
+        // dispatches the logs still queued
+        delete m_asyncDispatcher.exchange(nullptr);
+
         ILoggerRequestBus::Handler::BusDisconnect();
         AZ::Interface<ILogger>::Unregister(this);
     }
@@ -113,31 +265,64 @@ namespace AZ
 
     void LoggerSystemComponent::Flush()
     {
-        ;
+        if (AsyncDispatcher* asyncDispatcher = m_asyncDispatcher.load(AZStd::memory_order_acquire))
+        {
+            asyncDispatcher->DispatchPending();
+        }
     }
 
     void LoggerSystemComponent::LogInternalV(LogLevel level, const char* format, const char* file, const char* function, int32_t line, va_list args)
     {
-        constexpr AZStd::size_t MaxLogBufferSize = 1000;
+        // The message is formatted on the calling thread, the arguments don't outlive the call
         auto buffer = AZStd::fixed_string<MaxLogBufferSize>::format_arg(format, args);
-        m_logEvent.Signal(level, buffer.c_str(), file, function, line);
-        buffer += '\n';
+
+        // Errors stay synchronous so they are reported before a crash or an assert they may precede
+        if (sys_asyncLogging && level < LogLevel::Error)
+        {
+            GetAsyncDispatcher().Enqueue(level, buffer, file, function, line);
+            return;
+        }
+
+        // Keep the order with the logs that are still queued
+        Flush();
+        DispatchLog(level, buffer.c_str(), file, function, line);
+    }
+
+    void LoggerSystemComponent::DispatchLog(LogLevel level, const char* message, const char* file, const char* function, int32_t line)
+    {
+        m_logEvent.Signal(level, message, file, function, line);
 
         // use %s to avoid potential format security issues
         switch (level)
         {
         case LogLevel::Warn:
-            AZ_Warning(Debug::Trace::GetDefaultSystemWindow(), false, "%s", buffer.c_str());
+            AZ_Warning(Debug::Trace::GetDefaultSystemWindow(), false, "%s\n", message);
             break;
         case LogLevel::Error:
-            AZ_Error(Debug::Trace::GetDefaultSystemWindow(), false, "%s", buffer.c_str());
+            AZ_Error(Debug::Trace::GetDefaultSystemWindow(), false, "%s\n", message);
             break;
         default:
-            AZ::Debug::Trace::Instance().Printf(Debug::Trace::GetDefaultSystemWindow(), "%s", buffer.c_str());
+            AZ::Debug::Trace::Instance().Printf(Debug::Trace::GetDefaultSystemWindow(), "%s\n", message);
             break;
         }
     }
 
+    LoggerSystemComponent::AsyncDispatcher& LoggerSystemComponent::GetAsyncDispatcher()
+    {
+        AsyncDispatcher* asyncDispatcher = m_asyncDispatcher.load(AZStd::memory_order_acquire);
+        if (!asyncDispatcher)
+        {
+            AZStd::scoped_lock lock(m_asyncDispatcherMutex);
+            asyncDispatcher = m_asyncDispatcher.load(AZStd::memory_order_acquire);
+            if (!asyncDispatcher)
+            {
+                asyncDispatcher = aznew AsyncDispatcher(*this);
+                m_asyncDispatcher.store(asyncDispatcher, AZStd::memory_order_release);
+            }
+        }
+        return *asyncDispatcher;
+    }
+
     void LoggerSystemComponent::SetLevel(const AZ::ConsoleCommandContainer& arguments)
     {
         if (arguments.empty())
@@ -13,6 +13,8 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/containers/bitset.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace AZ
 {
@@ -60,6 +62,13 @@ namespace AZ
 
     private:
 
+        //! Dispatches the logs queued by the threads on a background thread when sys_asyncLogging is set.
+        class AsyncDispatcher;
+
+        //! Signals the log event and forwards the message to the trace system.
+        void DispatchLog(LogLevel level, const char* message, const char* file, const char* function, int32_t line);
+        AsyncDispatcher& GetAsyncDispatcher();
+
         void EnableLogHelper(AZ::HashValue32 a_HashValue);
         void DisableLogHelper(AZ::HashValue32 a_HashValue);
         bool IsTagEnabledHelper(AZ::HashValue32 a_HashValue);
@@ -69,6 +78,8 @@ namespace AZ
         AZ_CONSOLEFUNC(LoggerSystemComponent, DisableLog, AZ::ConsoleFunctorFlags::Null, "Disables conditional logs with the provided tag");
         AZ_CONSOLEFUNC(LoggerSystemComponent, ToggleLog,  AZ::ConsoleFunctorFlags::Null, "Toggles conditional logs with the provided tag");
 
+        static constexpr AZStd::size_t MaxLogBufferSize = 1000;
+
         // Store a trivial bloom filter using the lower 10 bits.  This filter can be safely checked outside of lock to reduce contention.
         static constexpr uint32_t BitsetSize = 1024;
         static_assert(IsPowerOfTwo(BitsetSize), "Bloom filter bitset size must be a power of two");
@@ -79,5 +90,9 @@ namespace AZ
         AZStd::bitset<BitsetSize> m_quickHash;
         AZStd::mutex m_enabledTagsMutex;
         AZStd::vector<AZ::HashValue32> m_enabledTags;
+
+        //! Created the first time a log is queued.
+        AZStd::atomic<AsyncDispatcher*> m_asyncDispatcher{ nullptr };
+        AZStd::mutex m_asyncDispatcherMutex;
     };
 }
@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/LockContentionProfiler.h>
+#include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ::Debug
+{
+    namespace
+    {
+        // Sites are never removed, so ProfiledMutex instances can keep pointers to them
+        struct LockContentionState
+        {
+            static constexpr size_t MaxSiteCount = 512;
+
+            AZStd::mutex m_mutex;
+            LockContentionSite m_sites[MaxSiteCount];
+            size_t m_siteCount = 0;
+        };
+
+        // Only the sites are shared through the environment. The switches are per module, they are set on
+        // every module by the cvars, and can be read by locks that are used before the environment exists.
+        AZStd::atomic_bool s_enabled{ false };
+        AZStd::atomic<AZStd::sys_time_t> s_markerThresholdTicks{ AZStd::numeric_limits<AZStd::sys_time_t>::max() };
+
+        struct PendingWaitMarker
+        {
+            const char* m_siteName;
+            AZStd::sys_time_t m_startTicks;
+            AZStd::sys_time_t m_endTicks;
+        };
+        constexpr size_t MaxPendingWaitMarkers = 8;
+        AZ_THREAD_LOCAL PendingWaitMarker t_pendingWaitMarkers[MaxPendingWaitMarkers];
+        AZ_THREAD_LOCAL size_t t_pendingWaitMarkerCount = 0;
+        AZ_THREAD_LOCAL bool t_flushingWaitMarkers = false;
+
+        LockContentionState* GetLockContentionState()
+        {
+            static AZStd::atomic<LockContentionState*> s_cachedState{ nullptr };
+            if (LockContentionState* state = s_cachedState.load(AZStd::memory_order_acquire))
+            {
+                return state;
+            }
+
+            static AZStd::mutex s_stateMutex;
+            static EnvironmentVariable<LockContentionState> s_state;
+            AZStd::scoped_lock lock(s_stateMutex);
+            if (!s_state)
+            {
+                s_state = Environment::CreateVariable<LockContentionState>("LockContentionProfilerState");
+            }
+            s_cachedState.store(&s_state.Get(), AZStd::memory_order_release);
+            return &s_state.Get();
+        }
+
+        void OnLockContentionProfilingChanged(const bool& enabled)
+        {
+            LockContentionProfiler::SetEnabled(enabled);
+        }
+
+        void OnLockContentionMarkerChanged(const int& microseconds)
+        {
+            LockContentionProfiler::SetMarkerThresholdMicroseconds(microseconds);
+        }
+    } // namespace
+
+    AZ_CVAR(bool, sys_lockContentionProfiling, false, &OnLockContentionProfilingChanged, ConsoleFunctorFlags::DontReplicate,
+        "Measures the wait time, hold time and contention of the locks wrapped in AZ::Debug::ProfiledMutex.");
+
+    AZ_CVAR(int, sys_lockContentionMarkerUs, 500, &OnLockContentionMarkerChanged, ConsoleFunctorFlags::DontReplicate,
+        "Lock waits of at least this many microseconds are added to the \"Lock waits\" track of the CPU profiler.");
+
+    static void sys_dumpLockContention(const AZ::ConsoleCommandContainer& arguments)
+    {
+        size_t maxSiteCount = 30;
+        if (!arguments.empty() && !ConsoleTypeHelpers::ToValue(maxSiteCount, arguments[0]))
+        {
+            AZ_Error("LockContention", false, R"(Unable to convert the site count argument of "%.*s" to an integer.)", AZ_STRING_ARG(arguments[0]));
+            return;
+        }
+        LockContentionProfiler::PrintStatistics(maxSiteCount);
+    }
+    AZ_CONSOLEFREEFUNC(sys_dumpLockContention, AZ::ConsoleFunctorFlags::Null,
+        "Prints the lock sites with the longest total wait, requires sys_lockContentionProfiling to be enabled.\n"
+        "usage: sys_dumpLockContention [<site count>]");
+
+    static void sys_resetLockContention([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        LockContentionProfiler::ResetStatistics();
+    }
+    AZ_CONSOLEFREEFUNC(sys_resetLockContention, AZ::ConsoleFunctorFlags::Null, "Clears the lock contention statistics.");
+
+    void LockContentionSite::RecordAcquire(bool contended, AZStd::sys_time_t waitTicks)
+    {
+        m_acquireCount.fetch_add(1, AZStd::memory_order_relaxed);
+        if (!contended)
+        {
+            return;
+        }
+
+        const AZ::u64 wait = static_cast<AZ::u64>(waitTicks);
+        m_contendedCount.fetch_add(1, AZStd::memory_order_relaxed);
+        m_waitTicks.fetch_add(wait, AZStd::memory_order_relaxed);
+        AZ::u64 maxWait = m_maxWaitTicks.load(AZStd::memory_order_relaxed);
+        while (wait > maxWait && !m_maxWaitTicks.compare_exchange_weak(maxWait, wait, AZStd::memory_order_relaxed))
+        {
+        }
+    }
+
+    void LockContentionSite::RecordHold(AZStd::sys_time_t holdTicks)
+    {
+        m_holdTicks.fetch_add(static_cast<AZ::u64>(holdTicks), AZStd::memory_order_relaxed);
+    }
+
+    bool LockContentionProfiler::IsEnabled()
+    {
+        return s_enabled.load(AZStd::memory_order_relaxed);
+    }
+
+    void LockContentionProfiler::SetEnabled(bool enabled)
+    {
+        s_enabled.store(enabled, AZStd::memory_order_relaxed);
+    }
+
+    AZStd::sys_time_t LockContentionProfiler::GetMarkerThresholdTicks()
+    {
+        return s_markerThresholdTicks.load(AZStd::memory_order_relaxed);
+    }
+
+    void LockContentionProfiler::SetMarkerThresholdMicroseconds(AZ::s64 microseconds)
+    {
+        // A negative threshold turns the markers off
+        s_markerThresholdTicks.store(
+            microseconds < 0 ? AZStd::numeric_limits<AZStd::sys_time_t>::max()
+                             : microseconds * AZStd::GetTimeTicksPerSecond() / 1000000,
+            AZStd::memory_order_relaxed);
+    }
+
+    LockContentionSite* LockContentionProfiler::FindOrCreateSite(const char* siteName)
+    {
+        LockContentionState* state = GetLockContentionState();
+        if (!state)
+        {
+            return nullptr;
+        }
+
+        const AZStd::string_view name(siteName);
+        AZStd::scoped_lock lock(state->m_mutex);
+        for (size_t siteIndex = 0; siteIndex < state->m_siteCount; ++siteIndex)
+        {
+            if (state->m_sites[siteIndex].m_name == name)
+            {
+                return &state->m_sites[siteIndex];
+            }
+        }
+
+        if (state->m_siteCount == LockContentionState::MaxSiteCount)
+        {
+            AZ_WarningOnce("LockContention", false, "All %zu lock contention sites are in use, %s is not profiled.",
+                LockContentionState::MaxSiteCount, siteName);
+            return nullptr;
+        }
+
+        LockContentionSite& site = state->m_sites[state->m_siteCount++];
+        site.m_name = name.substr(0, site.m_name.max_size());
+        return &site;
+    }
+
+    void LockContentionProfiler::QueueWaitMarker(const char* siteName, AZStd::sys_time_t startTicks, AZStd::sys_time_t endTicks)
+    {
+        // The marker can't be sent to the profiler while the lock is held, the profiler might take the same lock
+        if (t_flushingWaitMarkers)
+        {
+            return;
+        }
+
+        if (t_pendingWaitMarkerCount < MaxPendingWaitMarkers)
+        {
+            t_pendingWaitMarkers[t_pendingWaitMarkerCount++] = { siteName, startTicks, endTicks };
+        }
+    }
+
+    void LockContentionProfiler::FlushWaitMarkers()
+    {
+        if (t_pendingWaitMarkerCount == 0 || t_flushingWaitMarkers)
+        {
+            return;
+        }
+
+        t_flushingWaitMarkers = true;
+        if (auto profilerSystem = ProfilerSystemInterface::Get(); profilerSystem)
+        {
+            for (size_t markerIndex = 0; markerIndex < t_pendingWaitMarkerCount; ++markerIndex)
+            {
+                const PendingWaitMarker& marker = t_pendingWaitMarkers[markerIndex];
+                profilerSystem->AddTimelineRegion("Lock waits", marker.m_siteName, marker.m_startTicks, marker.m_endTicks);
+            }
+        }
+        t_pendingWaitMarkerCount = 0;
+        t_flushingWaitMarkers = false;
+    }
+
+    void LockContentionProfiler::GetStatistics(AZStd::vector<SiteStatistics>& statistics)
+    {
+        statistics.clear();
+        LockContentionState* state = GetLockContentionState();
+        if (!state)
+        {
+            return;
+        }
+
+        const double ticksPerMs = static_cast<double>(AZStd::GetTimeTicksPerSecond()) / 1000.0;
+        {
+            AZStd::scoped_lock lock(state->m_mutex);
+            statistics.reserve(state->m_siteCount);
+            for (size_t siteIndex = 0; siteIndex < state->m_siteCount; ++siteIndex)
+            {
+                const LockContentionSite& site = state->m_sites[siteIndex];
+                SiteStatistics& siteStatistics = statistics.emplace_back();
+                siteStatistics.m_name = site.m_name;
+                siteStatistics.m_acquireCount = site.m_acquireCount.load(AZStd::memory_order_relaxed);
+                siteStatistics.m_contendedCount = site.m_contendedCount.load(AZStd::memory_order_relaxed);
+                siteStatistics.m_waitTimeMs = static_cast<double>(site.m_waitTicks.load(AZStd::memory_order_relaxed)) / ticksPerMs;
+                siteStatistics.m_maxWaitTimeMs = static_cast<double>(site.m_maxWaitTicks.load(AZStd::memory_order_relaxed)) / ticksPerMs;
+                siteStatistics.m_holdTimeMs = static_cast<double>(site.m_holdTicks.load(AZStd::memory_order_relaxed)) / ticksPerMs;
+            }
+        }
+
+        AZStd::sort(
+            statistics.begin(), statistics.end(),
+            [](const SiteStatistics& lhs, const SiteStatistics& rhs)
+            {
+                return lhs.m_waitTimeMs > rhs.m_waitTimeMs;
+            });
+    }
+
+    void LockContentionProfiler::ResetStatistics()
+    {
+        LockContentionState* state = GetLockContentionState();
+        if (!state)
+        {
+            return;
+        }
+
+        AZStd::scoped_lock lock(state->m_mutex);
+        for (size_t siteIndex = 0; siteIndex < state->m_siteCount; ++siteIndex)
+        {
+            LockContentionSite& site = state->m_sites[siteIndex];
+            site.m_acquireCount.store(0, AZStd::memory_order_relaxed);
+            site.m_contendedCount.store(0, AZStd::memory_order_relaxed);
+            site.m_waitTicks.store(0, AZStd::memory_order_relaxed);
+            site.m_maxWaitTicks.store(0, AZStd::memory_order_relaxed);
+            site.m_holdTicks.store(0, AZStd::memory_order_relaxed);
+        }
+    }
+
+    void LockContentionProfiler::PrintStatistics(size_t maxSiteCount)
+    {
+        if (!IsEnabled())
+        {
+            AZ_Printf("LockContention", "Lock contention profiling is disabled, enable it with sys_lockContentionProfiling.\n");
+            return;
+        }
+
+        AZStd::vector<SiteStatistics> statistics;
+        GetStatistics(statistics);
+
+        AZ_Printf("LockContention", "%-48s %12s %12s %12s %12s %12s\n", "Lock", "Acquires", "Contended", "Wait ms", "Max wait ms", "Hold ms");
+        for (size_t siteIndex = 0; siteIndex < AZStd::min(maxSiteCount, statistics.size()); ++siteIndex)
+        {
+            const SiteStatistics& siteStatistics = statistics[siteIndex];
+            AZ_Printf(
+                "LockContention", "%-48s %12llu %12llu %12.3f %12.3f %12.3f\n", siteStatistics.m_name.c_str(),
+                static_cast<unsigned long long>(siteStatistics.m_acquireCount),
+                static_cast<unsigned long long>(siteStatistics.m_contendedCount), siteStatistics.m_waitTimeMs,
+                siteStatistics.m_maxWaitTimeMs, siteStatistics.m_holdTimeMs);
+        }
+    }
+} // namespace AZ::Debug
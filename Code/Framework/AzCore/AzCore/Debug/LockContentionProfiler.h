@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/string/fixed_string.h>
+#include <AzCore/std/time.h>
+#include <AzCore/std/utils.h>
+
+// Set AZ_LOCK_CONTENTION_PROFILING to 0 to turn every ProfiledMutex into its plain mutex.
+// When compiled in, the locks are only measured while the sys_lockContentionProfiling cvar is set.
+#if !defined(AZ_LOCK_CONTENTION_PROFILING)
+#   if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
+#       define AZ_LOCK_CONTENTION_PROFILING 1
+#   else
+#       define AZ_LOCK_CONTENTION_PROFILING 0
+#   endif
+#endif
+
+namespace AZ::Debug
+{
+    //! Counters shared by all the ProfiledMutex instances that use the same site name.
+    class LockContentionSite
+    {
+        friend class LockContentionProfiler;
+
+    public:
+        void RecordAcquire(bool contended, AZStd::sys_time_t waitTicks);
+        void RecordHold(AZStd::sys_time_t holdTicks);
+
+    private:
+        AZStd::fixed_string<64> m_name;
+        AZStd::atomic<AZ::u64> m_acquireCount{ 0 };
+        AZStd::atomic<AZ::u64> m_contendedCount{ 0 };
+        AZStd::atomic<AZ::u64> m_waitTicks{ 0 };
+        AZStd::atomic<AZ::u64> m_maxWaitTicks{ 0 };
+        AZStd::atomic<AZ::u64> m_holdTicks{ 0 };
+    };
+
+    /**
+     * Measures how long threads wait for the locks wrapped in a ProfiledMutex, how long they hold them and how often
+     * they find them already taken, per lock site name. Waits longer than the sys_lockContentionMarkerUs cvar are also
+     * added to the "Lock waits" track of the CPU profiler.
+     * Enable with the sys_lockContentionProfiling cvar, print with sys_dumpLockContention and clear with sys_resetLockContention.
+     */
+    class LockContentionProfiler
+    {
+    public:
+        struct SiteStatistics
+        {
+            AZStd::fixed_string<64> m_name;
+            AZ::u64 m_acquireCount = 0;
+            AZ::u64 m_contendedCount = 0;
+            double m_waitTimeMs = 0.0;
+            double m_maxWaitTimeMs = 0.0;
+            double m_holdTimeMs = 0.0;
+        };
+
+        static bool IsEnabled();
+        static void SetEnabled(bool enabled);
+
+        //! Waits of at least this many ticks are reported to the CPU profiler.
+        static AZStd::sys_time_t GetMarkerThresholdTicks();
+        static void SetMarkerThresholdMicroseconds(AZ::s64 microseconds);
+
+        //! Returns the site with that name, creating it on first use. Returns nullptr if all the sites are taken.
+        static LockContentionSite* FindOrCreateSite(const char* siteName);
+
+        //! Remembers a long wait of the current thread, it is reported by FlushWaitMarkers() once the lock is released.
+        static void QueueWaitMarker(const char* siteName, AZStd::sys_time_t startTicks, AZStd::sys_time_t endTicks);
+
+        //! Reports the waits queued by the current thread to the CPU profiler.
+        static void FlushWaitMarkers();
+
+        //! Returns the statistics of all the sites since they were last reset, the longest total wait first.
+        static void GetStatistics(AZStd::vector<SiteStatistics>& statistics);
+
+        static void ResetStatistics();
+
+        static void PrintStatistics(size_t maxSiteCount);
+    };
+
+#if AZ_LOCK_CONTENTION_PROFILING
+    /**
+     * Wraps a mutex to report its contention to the LockContentionProfiler under @siteName.
+     * All the instances constructed with the same name, e.g. the buckets of an allocator, share their statistics.
+     * Works with the exclusive and the shared AZStd mutexes and the AZStd lock types.
+     * @code{.cpp}
+     * AZ::Debug::ProfiledMutex<AZStd::shared_mutex> m_mutex{ "MySystem::m_mutex" };
+     * @endcode
+     */
+    template<class Mutex>
+    class ProfiledMutex
+    {
+    public:
+        explicit ProfiledMutex(const char* siteName)
+            : m_siteName(siteName)
+        {
+        }
+
+        ProfiledMutex(const ProfiledMutex&) = delete;
+        ProfiledMutex& operator=(const ProfiledMutex&) = delete;
+
+        void lock()
+        {
+            if (!LockContentionProfiler::IsEnabled())
+            {
+                m_mutex.lock();
+                return;
+            }
+
+            if (m_mutex.try_lock())
+            {
+                OnAcquired(false, 0, 0);
+                return;
+            }
+
+            const AZStd::sys_time_t startTicks = AZStd::GetTimeNowTicks();
+            m_mutex.lock();
+            OnAcquired(true, startTicks, AZStd::GetTimeNowTicks());
+        }
+
+        bool try_lock()
+        {
+            if (!m_mutex.try_lock())
+            {
+                return false;
+            }
+
+            if (LockContentionProfiler::IsEnabled())
+            {
+                OnAcquired(false, 0, 0);
+            }
+            return true;
+        }
+
+        void unlock()
+        {
+            // The hold state is only touched while the lock is held
+            if (m_holdStartTicks != 0 && --m_holdDepth == 0)
+            {
+                if (LockContentionSite* site = GetSite())
+                {
+                    site->RecordHold(AZStd::GetTimeNowTicks() - m_holdStartTicks);
+                }
+                m_holdStartTicks = 0;
+            }
+            m_mutex.unlock();
+
+            if (LockContentionProfiler::IsEnabled())
+            {
+                LockContentionProfiler::FlushWaitMarkers();
+            }
+        }
+
+        template<class M = Mutex>
+        auto lock_shared() -> decltype(AZStd::declval<M&>().lock_shared())
+        {
+            if (!LockContentionProfiler::IsEnabled())
+            {
+                m_mutex.lock_shared();
+                return;
+            }
+
+            // Readers overlap, so only the waits are measured for them
+            if (m_mutex.try_lock_shared())
+            {
+                RecordWait(false, 0, 0);
+                return;
+            }
+
+            const AZStd::sys_time_t startTicks = AZStd::GetTimeNowTicks();
+            m_mutex.lock_shared();
+            RecordWait(true, startTicks, AZStd::GetTimeNowTicks());
+        }
+
+        template<class M = Mutex>
+        auto try_lock_shared() -> decltype(AZStd::declval<M&>().try_lock_shared())
+        {
+            if (!m_mutex.try_lock_shared())
+            {
+                return false;
+            }
+
+            if (LockContentionProfiler::IsEnabled())
+            {
+                RecordWait(false, 0, 0);
+            }
+            return true;
+        }
+
+        template<class M = Mutex>
+        auto unlock_shared() -> decltype(AZStd::declval<M&>().unlock_shared())
+        {
+            m_mutex.unlock_shared();
+
+            if (LockContentionProfiler::IsEnabled())
+            {
+                LockContentionProfiler::FlushWaitMarkers();
+            }
+        }
+
+    private:
+        LockContentionSite* GetSite()
+        {
+            LockContentionSite* site = m_site.load(AZStd::memory_order_acquire);
+            if (!site)
+            {
+                site = LockContentionProfiler::FindOrCreateSite(m_siteName);
+                m_site.store(site, AZStd::memory_order_release);
+            }
+            return site;
+        }
+
+        void RecordWait(bool contended, AZStd::sys_time_t startTicks, AZStd::sys_time_t endTicks)
+        {
+            if (LockContentionSite* site = GetSite())
+            {
+                site->RecordAcquire(contended, endTicks - startTicks);
+            }
+
+            if (contended && endTicks - startTicks >= LockContentionProfiler::GetMarkerThresholdTicks())
+            {
+                LockContentionProfiler::QueueWaitMarker(m_siteName, startTicks, endTicks);
+            }
+        }
+
+        void OnAcquired(bool contended, AZStd::sys_time_t startTicks, AZStd::sys_time_t endTicks)
+        {
+            RecordWait(contended, startTicks, endTicks);
+
+            // Recursive mutexes are held until their outermost unlock
+            if (m_holdStartTicks == 0)
+            {
+                m_holdStartTicks = contended ? endTicks : AZStd::GetTimeNowTicks();
+                m_holdDepth = 1;
+            }
+            else
+            {
+                ++m_holdDepth;
+            }
+        }
+
+        Mutex m_mutex;
+        const char* m_siteName;
+        AZStd::atomic<LockContentionSite*> m_site{ nullptr };
+        AZStd::sys_time_t m_holdStartTicks = 0;
+        AZ::u32 m_holdDepth = 0;
+    };
+#else
+    template<class Mutex>
+    class ProfiledMutex
+        : public Mutex
+    {
+    public:
+        explicit ProfiledMutex(const char*)
+        {
+        }
+    };
+#endif
+} // namespace AZ::Debug
@@ -14,6 +14,7 @@
 #include <AzCore/Date/DateFormat.h>
 
 #include "PerformanceCollector.h"
+#include "PerformanceMetricsExporter.h"
 
 
 namespace AZ::Debug
@@ -31,6 +32,7 @@ namespace AZ::Debug
         {
             [[maybe_unused]] const auto statisticPtr = m_statisticsManager.AddStatistic(metricName, metricName, "us");
             AZ_Assert(statisticPtr, "Failed to add metric with name <%.*s>. Maybe already added?", AZ_STRING_ARG(metricName));
+            m_histograms.emplace(metricName, MetricHistograms{});
         }
         RestartPeriodicEventStamps();
     }
@@ -85,6 +87,10 @@ namespace AZ::Debug
             //It is time to write the statistical summaries to the Log file.
             RecordStatistics();
             m_statisticsManager.ResetAllStatistics();
+            for (auto& [metricName, histograms] : m_histograms)
+            {
+                histograms.m_batch.Reset();
+            }
         }
         RestartPeriodicEventStamps();
 
@@ -100,9 +106,20 @@ namespace AZ::Debug
 
     void PerformanceCollector::RecordSample(AZStd::string_view metricName, AZStd::chrono::microseconds microSeconds)
     {
+        auto histogramsIt = m_histograms.find(metricName);
+        const AZ::u64 sampleValue = aznumeric_cast<AZ::u64>(AZStd::max(microSeconds.count(), AZStd::chrono::microseconds::rep(0)));
+        if (histogramsIt != m_histograms.end())
+        {
+            histogramsIt->second.m_cumulative.RecordValue(sampleValue);
+        }
+
         if (m_dataLogType == DataLogType::LogStatistics)
         {
             m_statisticsManager.PushSampleForStatistic(metricName, aznumeric_caster(microSeconds.count()));
+            if (histogramsIt != m_histograms.end())
+            {
+                histogramsIt->second.m_batch.RecordValue(sampleValue);
+            }
         }
         else
         {
@@ -138,7 +155,7 @@ namespace AZ::Debug
         AZ_Warning(LogName, !statistics.empty(), "There are no statistics to report.");
         for (const auto statistic : statistics)
         {
-            using EventObjectStorage = AZStd::fixed_vector<AZ::Metrics::EventField, 8>;
+            using EventObjectStorage = AZStd::fixed_vector<AZ::Metrics::EventField, 12>;
             EventObjectStorage statisticalParams;
             statisticalParams.emplace_back(AVG, statistic->GetAverage());
             statisticalParams.emplace_back(MIN, statistic->GetMinimum());
@@ -148,6 +165,14 @@ namespace AZ::Debug
             statisticalParams.emplace_back(VARIANCE, statistic->GetVariance());
             statisticalParams.emplace_back(STDEV, statistic->GetStdev());
             statisticalParams.emplace_back(MOST_RECENT_SAMPLE, statistic->GetMostRecentSample());
+            if (auto histogramsIt = m_histograms.find(statistic->GetName()); histogramsIt != m_histograms.end())
+            {
+                const Statistics::LatencyHistogram& histogram = histogramsIt->second.m_batch;
+                statisticalParams.emplace_back(P50, histogram.GetValueAtPercentile(50.0));
+                statisticalParams.emplace_back(P95, histogram.GetValueAtPercentile(95.0));
+                statisticalParams.emplace_back(P99, histogram.GetValueAtPercentile(99.0));
+                statisticalParams.emplace_back(P999, histogram.GetValueAtPercentile(99.9));
+            }
 
             Metrics::CompleteArgs completeArgs;
             completeArgs.m_name = statistic->GetName();
@@ -158,6 +183,20 @@ namespace AZ::Debug
         }
     }
 
+    const Statistics::LatencyHistogram* PerformanceCollector::GetLatencyHistogram(AZStd::string_view metricName) const
+    {
+        auto histogramsIt = m_histograms.find(metricName);
+        return histogramsIt != m_histograms.end() ? &histogramsIt->second.m_cumulative : nullptr;
+    }
+
+    void PerformanceCollector::ExportHistograms(PerformanceMetricsExporter& exporter) const
+    {
+        for (const auto& [metricName, histograms] : m_histograms)
+        {
+            exporter.ExportHistogram(m_logCategory, metricName, "us", histograms.m_cumulative);
+        }
+    }
+
     void PerformanceCollector::RestartPeriodicEventStamps()
     {
         AZStd::vector<Statistics::NamedRunningStatistic*> statistics;
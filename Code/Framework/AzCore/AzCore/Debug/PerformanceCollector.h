@@ -9,11 +9,14 @@
 
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Metrics/JsonTraceEventLogger.h>
+#include <AzCore/Statistics/LatencyHistogram.h>
 #include <AzCore/Statistics/StatisticsManager.h>
 #include <AzCore/std/chrono/chrono.h>
 
 namespace AZ::Debug
 {
+    class PerformanceMetricsExporter;
+
     //! A helper class that facilitates collecting performance metrics as part of blocks
     //! of code, or measuring time lapses of periodically called functions.
     //! The metrics can be recorded as raw events (DataLogType::LogAllSamples)
@@ -33,6 +36,10 @@ namespace AZ::Debug
         static constexpr AZStd::string_view VARIANCE = "variance";
         static constexpr AZStd::string_view STDEV = "stdev";
         static constexpr AZStd::string_view MOST_RECENT_SAMPLE = "mostRecentSampleValue";
+        static constexpr AZStd::string_view P50 = "p50";
+        static constexpr AZStd::string_view P95 = "p95";
+        static constexpr AZStd::string_view P99 = "p99";
+        static constexpr AZStd::string_view P999 = "p99.9";
 
         //! Function signature for the notification callback that will be dispatched
         //! each time a batch of frames are measured.
@@ -105,6 +112,13 @@ namespace AZ::Debug
 
         const AZStd::string& GetFileExtension() const { return m_fileExtension; }
 
+        //! Returns the histogram of all the samples recorded for @metricName since this collector was created,
+        //! regardless of the DataLogType and of the capture batches. Returns nullptr for unknown metrics.
+        const Statistics::LatencyHistogram* GetLatencyHistogram(AZStd::string_view metricName) const;
+
+        //! Pull style export of the cumulative histograms of all the metrics, e.g. from a metrics endpoint.
+        void ExportHistograms(PerformanceMetricsExporter& exporter) const;
+
     private:
         //! A helper function that loops across all statistics in @m_statisticsManager
         //! and reports each result into @m_eventLogger.
@@ -130,6 +144,14 @@ namespace AZ::Debug
         //! Only used when @m_captureType == CaptureType::LogStatistics.
         AZ::Statistics::StatisticsManager<AZStd::string> m_statisticsManager;
 
+        struct MetricHistograms
+        {
+            Statistics::LatencyHistogram m_batch; // Reset after each batch, only used when @m_dataLogType == DataLogType::LogStatistics.
+            Statistics::LatencyHistogram m_cumulative; // Never reset, for ExportHistograms().
+        };
+        //! Percentiles of each metric, which the running statistics in @m_statisticsManager can't provide.
+        AZStd::unordered_map<AZStd::string, MetricHistograms> m_histograms;
+
         //! Only used to store the previous value when RecordPeriodicEvent() is called
         //! for any given metrics.
         AZStd::unordered_map<AZStd::string, AZStd::chrono::steady_clock::time_point> m_periodicEventStamps;
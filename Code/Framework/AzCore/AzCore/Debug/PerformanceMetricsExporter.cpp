@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/PerformanceMetricsExporter.h>
+
+namespace AZ::Debug
+{
+    PrometheusTextExporter::PrometheusTextExporter(AZStd::string& output)
+        : m_output(output)
+    {
+    }
+
+    AZStd::string PrometheusTextExporter::SanitizeMetricName(AZStd::string_view name)
+    {
+        AZStd::string sanitized;
+        sanitized.reserve(name.size() + 1);
+        for (const char c : name)
+        {
+            const bool isLetter = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+            const bool isDigit = c >= '0' && c <= '9';
+            if (sanitized.empty() && isDigit)
+            {
+                sanitized.push_back('_');
+            }
+            sanitized.push_back((isLetter || isDigit || c == '_' || c == ':') ? c : '_');
+        }
+        return sanitized;
+    }
+
+    void PrometheusTextExporter::ExportHistogram(
+        AZStd::string_view category,
+        AZStd::string_view metricName,
+        AZStd::string_view units,
+        const Statistics::LatencyHistogram& histogram)
+    {
+        const AZStd::string name = SanitizeMetricName(AZStd::string::format(
+            "o3de_%.*s_%.*s_%.*s", AZ_STRING_ARG(category), AZ_STRING_ARG(metricName), AZ_STRING_ARG(units)));
+
+        // Summary with the quantiles of this process
+        m_output += AZStd::string::format("# TYPE %s summary\n", name.c_str());
+        constexpr double Quantiles[] = { 0.5, 0.95, 0.99, 0.999 };
+        for (const double quantile : Quantiles)
+        {
+            m_output += AZStd::string::format(
+                "%s{quantile=\"%g\"} %llu\n", name.c_str(), quantile,
+                static_cast<unsigned long long>(histogram.GetValueAtPercentile(quantile * 100.0)));
+        }
+        m_output += AZStd::string::format("%s_sum %llu\n", name.c_str(), static_cast<unsigned long long>(histogram.GetSum()));
+        m_output += AZStd::string::format("%s_count %llu\n", name.c_str(), static_cast<unsigned long long>(histogram.GetTotalCount()));
+
+        // Cumulative histogram with power of two bounds. Bucket counts, unlike quantiles, can be summed across servers.
+        const AZStd::string bucketsName = name + "_buckets";
+        m_output += AZStd::string::format("# TYPE %s histogram\n", bucketsName.c_str());
+        AZ::u64 cumulativeCount = 0;
+        AZ::u64 upperBound = 1;
+        histogram.EnumerateBuckets(
+            [&](AZ::u64, AZ::u64 highestValue, AZ::u64 count)
+            {
+                // Each sub bucket is counted under the first bound that covers its highest value
+                while (highestValue > upperBound)
+                {
+                    m_output += AZStd::string::format(
+                        "%s_bucket{le=\"%llu\"} %llu\n", bucketsName.c_str(), static_cast<unsigned long long>(upperBound),
+                        static_cast<unsigned long long>(cumulativeCount));
+                    upperBound <<= 1;
+                }
+                cumulativeCount += count;
+            });
+        if (histogram.GetTotalCount() != 0)
+        {
+            m_output += AZStd::string::format(
+                "%s_bucket{le=\"%llu\"} %llu\n", bucketsName.c_str(), static_cast<unsigned long long>(upperBound),
+                static_cast<unsigned long long>(cumulativeCount));
+        }
+        m_output += AZStd::string::format(
+            "%s_bucket{le=\"+Inf\"} %llu\n", bucketsName.c_str(), static_cast<unsigned long long>(histogram.GetTotalCount()));
+        m_output += AZStd::string::format("%s_sum %llu\n", bucketsName.c_str(), static_cast<unsigned long long>(histogram.GetSum()));
+        m_output += AZStd::string::format(
+            "%s_count %llu\n", bucketsName.c_str(), static_cast<unsigned long long>(histogram.GetTotalCount()));
+    }
+} // namespace AZ::Debug
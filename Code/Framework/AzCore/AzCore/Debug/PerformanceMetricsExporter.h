@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Statistics/LatencyHistogram.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ::Debug
+{
+    //! Receives the latency histograms of a PerformanceCollector when PerformanceCollector::ExportHistograms()
+    //! is called. Implement it to publish the metrics to a monitoring system.
+    class PerformanceMetricsExporter
+    {
+    public:
+        virtual ~PerformanceMetricsExporter() = default;
+
+        virtual void ExportHistogram(
+            AZStd::string_view category,
+            AZStd::string_view metricName,
+            AZStd::string_view units,
+            const Statistics::LatencyHistogram& histogram) = 0;
+    };
+
+    //! Appends the histograms to @output in the Prometheus text exposition format, e.g. to be served on a metrics endpoint.
+    //! Each metric is written twice:
+    //! - As a summary with the p50, p95, p99 and p99.9 quantiles of this process.
+    //! - As a histogram with power of two bucket bounds, which can be aggregated across servers with histogram_quantile().
+    class PrometheusTextExporter final
+        : public PerformanceMetricsExporter
+    {
+    public:
+        explicit PrometheusTextExporter(AZStd::string& output);
+
+        void ExportHistogram(
+            AZStd::string_view category,
+            AZStd::string_view metricName,
+            AZStd::string_view units,
+            const Statistics::LatencyHistogram& histogram) override;
+
+        //! Replaces the characters that are not allowed in Prometheus metric names with '_'.
+        static AZStd::string SanitizeMetricName(AZStd::string_view name);
+
+    private:
+        AZStd::string& m_output;
+    };
+} // namespace AZ::Debug
@@ -12,6 +12,7 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/IO/Path/Path_fwd.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/time.h>
 
 namespace AZ
 {
@@ -62,6 +63,16 @@ namespace AZ
             //! Check to see if a programmatic capture is currently in progress, implies
             //! that the profiler is active if returns True.
             virtual bool IsCaptureInProgress() const = 0;
+
+            //! Adds a region that was not timed by a profiler marker, e.g. a GPU timestamp converted to the CPU clock,
+            //! to a named track of the profiler timeline. The ticks are in the AZStd::GetTimeNowTicks clock domain.
+            virtual void AddTimelineRegion(
+                [[maybe_unused]] AZStd::string_view trackName,
+                [[maybe_unused]] AZStd::string_view regionName,
+                [[maybe_unused]] AZStd::sys_time_t startTick,
+                [[maybe_unused]] AZStd::sys_time_t endTick)
+            {
+            }
         };
 
         using ProfilerSystemInterface = AZ::Interface<ProfilerRequests>;
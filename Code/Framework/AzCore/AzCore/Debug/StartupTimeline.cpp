@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/Debug/StartupTimeline.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ::Debug
+{
+    namespace
+    {
+        struct StartupTimelineEvent
+        {
+            AZStd::fixed_string<32> m_category;
+            AZStd::fixed_string<128> m_name;
+            AZStd::sys_time_t m_startTicks = 0;
+            AZStd::sys_time_t m_endTicks = 0;
+            size_t m_threadId = 0;
+            bool m_instant = false;
+        };
+
+        // Shared through the environment so the modules record into the same timeline
+        struct StartupTimelineState
+        {
+            // Bounds the memory of the applications that never tick, the tools for instance
+            static constexpr size_t MaxEventCount = 4096;
+
+            AZStd::atomic_bool m_recording{ true };
+            AZStd::sys_time_t m_startTicks = AZStd::GetTimeNowTicks();
+            AZStd::sys_time_t m_finishTicks = 0;
+            AZStd::mutex m_mutex;
+            AZStd::vector<StartupTimelineEvent, AZ::OSStdAllocator> m_events;
+        };
+
+        EnvironmentVariable<StartupTimelineState>& GetStartupTimelineState()
+        {
+            static EnvironmentVariable<StartupTimelineState> s_state =
+                Environment::CreateVariable<StartupTimelineState>("StartupTimelineState");
+            return s_state;
+        }
+
+        void AddStartupTimelineEvent(
+            const char* category, AZStd::string_view name, AZStd::sys_time_t startTicks, AZStd::sys_time_t endTicks, bool instant)
+        {
+            EnvironmentVariable<StartupTimelineState>& state = GetStartupTimelineState();
+            AZStd::scoped_lock lock(state->m_mutex);
+            if (!state->m_recording.load(AZStd::memory_order_relaxed) || state->m_events.size() == StartupTimelineState::MaxEventCount)
+            {
+                return;
+            }
+
+            StartupTimelineEvent& event = state->m_events.emplace_back();
+            event.m_category = category;
+            event.m_name = name.substr(0, event.m_name.max_size());
+            event.m_startTicks = startTicks;
+            event.m_endTicks = endTicks;
+            event.m_threadId = AZStd::hash<AZStd::thread_id>{}(AZStd::this_thread::get_id());
+            event.m_instant = instant;
+        }
+
+        void AppendJsonString(AZStd::string& output, AZStd::string_view value)
+        {
+            output += '"';
+            for (const char c : value)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    output += '\\';
+                    output += c;
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    output += AZStd::string::format("\\u%04x", static_cast<unsigned int>(c));
+                }
+                else
+                {
+                    output += c;
+                }
+            }
+            output += '"';
+        }
+    } // namespace
+
+    StartupTimeline::Scope::Scope(const char* category, AZStd::string_view name)
+    {
+        if (IsRecording())
+        {
+            m_category = category;
+            m_name = name.substr(0, m_name.max_size());
+            m_startTicks = AZStd::GetTimeNowTicks();
+        }
+    }
+
+    StartupTimeline::Scope::~Scope()
+    {
+        if (m_category)
+        {
+            AddStartupTimelineEvent(m_category, m_name, m_startTicks, AZStd::GetTimeNowTicks(), false);
+        }
+    }
+
+    bool StartupTimeline::IsRecording()
+    {
+        return GetStartupTimelineState()->m_recording.load(AZStd::memory_order_relaxed);
+    }
+
+    void StartupTimeline::AddEvent(const char* category, AZStd::string_view name)
+    {
+        if (IsRecording())
+        {
+            const AZStd::sys_time_t nowTicks = AZStd::GetTimeNowTicks();
+            AddStartupTimelineEvent(category, name, nowTicks, nowTicks, true);
+        }
+    }
+
+    void StartupTimeline::AddRegion(const char* category, AZStd::string_view name, AZStd::sys_time_t startTicks, AZStd::sys_time_t endTicks)
+    {
+        if (IsRecording())
+        {
+            AddStartupTimelineEvent(category, name, startTicks, endTicks, false);
+        }
+    }
+
+    void StartupTimeline::Finish()
+    {
+        EnvironmentVariable<StartupTimelineState>& state = GetStartupTimelineState();
+        {
+            AZStd::scoped_lock lock(state->m_mutex);
+            if (!state->m_recording.exchange(false, AZStd::memory_order_relaxed))
+            {
+                return;
+            }
+            state->m_finishTicks = AZStd::GetTimeNowTicks();
+        }
+
+        const double startupMs = static_cast<double>(state->m_finishTicks - state->m_startTicks) * 1000.0 /
+            static_cast<double>(AZStd::GetTimeTicksPerSecond());
+        AZ_TracePrintf("StartupTimeline", "Startup took %.1f ms, %zu events were recorded.\n", startupMs, state->m_events.size());
+
+#if defined(AZ_RELEASE_BUILD)
+        bool writeTrace = false;
+#else
+        bool writeTrace = true;
+#endif
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry)
+        {
+            settingsRegistry->Get(writeTrace, RegistryKey_WriteTrace);
+        }
+        // The file aliases of the trace location need the FileIO, which the unit tests don't always have
+        if (!writeTrace || !AZ::IO::FileIOBase::GetInstance())
+        {
+            return;
+        }
+
+        const AZStd::string traceFile = AZStd::string::format(
+            "%s/startup_timeline_%lld.json", GetProfilerCaptureLocation().c_str(), static_cast<long long>(AZStd::GetTimeNowSecond()));
+        if (auto writeOutcome = AZ::Utils::WriteFile(GetChromeTrace(), traceFile); writeOutcome.IsSuccess())
+        {
+            AZ_TracePrintf("StartupTimeline", "Startup timeline written to %s\n", traceFile.c_str());
+        }
+        else
+        {
+            AZ_Warning("StartupTimeline", false, "Failed to write the startup timeline: %s", writeOutcome.GetError().c_str());
+        }
+    }
+
+    AZStd::string StartupTimeline::GetChromeTrace()
+    {
+        EnvironmentVariable<StartupTimelineState>& state = GetStartupTimelineState();
+        AZStd::scoped_lock lock(state->m_mutex);
+
+        // Chrome trace timestamps are in microseconds, relative to the first recorded event
+        const double ticksPerMicrosecond = static_cast<double>(AZStd::GetTimeTicksPerSecond()) / 1000000.0;
+        auto toMicroseconds = [&state, ticksPerMicrosecond](AZStd::sys_time_t ticks)
+        {
+            return static_cast<double>(ticks - state->m_startTicks) / ticksPerMicrosecond;
+        };
+
+        AZStd::string trace = R"({"displayTimeUnit":"ms","traceEvents":[)";
+        bool firstEvent = true;
+        for (const StartupTimelineEvent& event : state->m_events)
+        {
+            trace += firstEvent ? "{" : ",\n{";
+            firstEvent = false;
+
+            trace += R"("name":)";
+            AppendJsonString(trace, event.m_name);
+            trace += R"(,"cat":)";
+            AppendJsonString(trace, event.m_category);
+            if (event.m_instant)
+            {
+                trace += AZStd::string::format(R"(,"ph":"i","s":"g","ts":%.3f)", toMicroseconds(event.m_startTicks));
+            }
+            else
+            {
+                trace += AZStd::string::format(
+                    R"(,"ph":"X","ts":%.3f,"dur":%.3f)", toMicroseconds(event.m_startTicks),
+                    static_cast<double>(event.m_endTicks - event.m_startTicks) / ticksPerMicrosecond);
+            }
+            trace += AZStd::string::format(R"(,"pid":1,"tid":%zu})", event.m_threadId);
+        }
+
+        if (state->m_finishTicks != 0)
+        {
+            trace += AZStd::string::format(
+                R"(%s{"name":"Startup","cat":"Lifecycle","ph":"X","ts":0.000,"dur":%.3f,"pid":1,"tid":0})", firstEvent ? "" : ",\n",
+                toMicroseconds(state->m_finishTicks));
+        }
+        trace += "]}\n";
+        return trace;
+    }
+} // namespace AZ::Debug
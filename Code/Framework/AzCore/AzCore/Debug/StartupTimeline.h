@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/string/fixed_string.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+#include <AzCore/std/time.h>
+
+namespace AZ::Debug
+{
+    /**
+     * Timeline of the application startup: the lifecycle events, the load of every dynamic module, the activation of
+     * every component, the settings registry merges and the asset catalog load, from the first recorded event until
+     * the first ComponentApplication::Tick().
+     * The timeline is then written in the Chrome trace event format, which chrome://tracing and Perfetto can open, to
+     * <profiler capture location>/startup_timeline_<time>.json. Writing it is on by default outside of release builds and
+     * is controlled by the RegistryKey_WriteTrace setting, e.g. --regset="/O3DE/AzCore/Debug/StartupTimeline/WriteTrace=true".
+     */
+    class StartupTimeline
+    {
+    public:
+        static constexpr const char* RegistryKey_WriteTrace = "/O3DE/AzCore/Debug/StartupTimeline/WriteTrace";
+
+        //! Measures the lifetime of the scope as a region of the timeline while the startup is being recorded.
+        class Scope
+        {
+        public:
+            Scope(const char* category, AZStd::string_view name);
+            ~Scope();
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            const char* m_category = nullptr;
+            AZStd::fixed_string<128> m_name;
+            AZStd::sys_time_t m_startTicks = 0;
+        };
+
+        //! Returns false once the startup is finished, the instrumented code can skip building its event names then.
+        static bool IsRecording();
+
+        //! Adds an instant event, e.g. a lifecycle event.
+        static void AddEvent(const char* category, AZStd::string_view name);
+
+        //! Adds a region between the two tick counts of AZStd::GetTimeNowTicks().
+        static void AddRegion(const char* category, AZStd::string_view name, AZStd::sys_time_t startTicks, AZStd::sys_time_t endTicks);
+
+        //! Stops the recording and writes the trace if RegistryKey_WriteTrace is set. Only the first call has an effect.
+        static void Finish();
+
+        //! Returns the recorded timeline in the Chrome trace event format.
+        static AZStd::string GetChromeTrace();
+    };
+} // namespace AZ::Debug
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/EBus/DispatchStatistics.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+namespace AZ
+{
+    namespace
+    {
+        const char* DispatchStatisticsStateName = "EBusDispatchStatisticsState";
+
+        EnvironmentVariable<Internal::EBusDispatchStatisticsState>& GetDispatchStatisticsState()
+        {
+            // Shared through the environment so the buses of every module report to the same place
+            static EnvironmentVariable<Internal::EBusDispatchStatisticsState> s_state =
+                Environment::CreateVariable<Internal::EBusDispatchStatisticsState>(DispatchStatisticsStateName);
+            return s_state;
+        }
+
+        // Copy of the enabled flag of this module, checked by every EBus dispatch. Reading it avoids the environment lookup of
+        // GetDispatchStatisticsState(). It registers itself with the shared state on first use, and SetEnabled updates it.
+        struct ModuleEnabledFlag
+        {
+            ~ModuleEnabledFlag()
+            {
+                if (m_registered.load(AZStd::memory_order_acquire) && m_state)
+                {
+                    AZStd::scoped_lock lock(m_state->m_mutex);
+                    AZStd::erase(m_state->m_moduleEnabledFlags, &m_enabled);
+                }
+                // Dispatches made while the module shuts down read the flag as disabled instead of registering it again
+                m_enabled.store(false, AZStd::memory_order_relaxed);
+                m_registered.store(true, AZStd::memory_order_release);
+            }
+
+            AZStd::atomic_bool m_enabled{ false };
+            AZStd::atomic_bool m_registered{ false };
+            EnvironmentVariable<Internal::EBusDispatchStatisticsState> m_state;
+        };
+        ModuleEnabledFlag s_moduleEnabledFlag;
+
+        void RegisterModuleEnabledFlag()
+        {
+            EnvironmentVariable<Internal::EBusDispatchStatisticsState>& state = GetDispatchStatisticsState();
+            AZStd::scoped_lock lock(state->m_mutex);
+            if (s_moduleEnabledFlag.m_registered.load(AZStd::memory_order_relaxed))
+            {
+                return;
+            }
+
+            state->m_moduleEnabledFlags.push_back(&s_moduleEnabledFlag.m_enabled);
+            s_moduleEnabledFlag.m_enabled.store(state->m_enabled.load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
+            s_moduleEnabledFlag.m_state = state;
+            s_moduleEnabledFlag.m_registered.store(true, AZStd::memory_order_release);
+        }
+
+        void OnDispatchStatisticsChanged(const bool& enabled)
+        {
+            EBusDispatchStatistics::SetEnabled(enabled);
+        }
+    } // namespace
+
+    AZ_CVAR(bool, bus_dispatchStatistics, false, &OnDispatchStatisticsChanged, ConsoleFunctorFlags::DontReplicate,
+        "Counts the dispatches, handler calls, lock wait time and dispatch time of every EBus, per frame.");
+
+    static void bus_dumpDispatchStatistics(const AZ::ConsoleCommandContainer& arguments)
+    {
+        size_t maxBusCount = 20;
+        if (!arguments.empty() && !ConsoleTypeHelpers::ToValue(maxBusCount, arguments[0]))
+        {
+            AZ_Error("EBus", false, R"(Unable to convert the bus count argument of "%.*s" to an integer.)", AZ_STRING_ARG(arguments[0]));
+            return;
+        }
+        EBusDispatchStatistics::PrintLastFrameStatistics(maxBusCount);
+    }
+    AZ_CONSOLEFREEFUNC(bus_dumpDispatchStatistics, AZ::ConsoleFunctorFlags::Null,
+        "Prints the most expensive EBuses of the last frame, requires bus_dispatchStatistics to be enabled.\n"
+        "usage: bus_dumpDispatchStatistics [<bus count>]");
+
+    namespace Internal
+    {
+        EBusDispatchCounters::~EBusDispatchCounters()
+        {
+            if (!m_registered.load(AZStd::memory_order_acquire) || !m_state)
+            {
+                return;
+            }
+
+            AZStd::scoped_lock lock(m_state->m_mutex);
+            if (m_prev)
+            {
+                m_prev->m_next = m_next;
+            }
+            else
+            {
+                m_state->m_head = m_next;
+            }
+            if (m_next)
+            {
+                m_next->m_prev = m_prev;
+            }
+        }
+
+        void EBusDispatchCounters::Record(
+            const char* busSignature, AZStd::sys_time_t lockWaitTicks, AZStd::sys_time_t dispatchTicks, AZ::u64 handlerCalls)
+        {
+            if (!m_registered.load(AZStd::memory_order_acquire))
+            {
+                Register(busSignature);
+            }
+
+            m_dispatchCount.fetch_add(1, AZStd::memory_order_relaxed);
+            m_handlerCallCount.fetch_add(handlerCalls, AZStd::memory_order_relaxed);
+            m_lockWaitTicks.fetch_add(static_cast<AZ::u64>(lockWaitTicks), AZStd::memory_order_relaxed);
+            m_dispatchTicks.fetch_add(static_cast<AZ::u64>(dispatchTicks), AZStd::memory_order_relaxed);
+        }
+
+        void EBusDispatchCounters::Register(const char* busSignature)
+        {
+            EnvironmentVariable<EBusDispatchStatisticsState>& state = GetDispatchStatisticsState();
+            AZStd::scoped_lock lock(state->m_mutex);
+            if (m_registered.load(AZStd::memory_order_relaxed))
+            {
+                return;
+            }
+
+            m_busName = EBusDispatchStatistics::GetBusNameFromSignature(busSignature);
+            m_state = state;
+            m_prev = nullptr;
+            m_next = state->m_head;
+            if (m_next)
+            {
+                m_next->m_prev = this;
+            }
+            state->m_head = this;
+            m_registered.store(true, AZStd::memory_order_release);
+        }
+    } // namespace Internal
+
+    bool EBusDispatchStatistics::IsEnabled()
+    {
+        if (!s_moduleEnabledFlag.m_registered.load(AZStd::memory_order_acquire))
+        {
+            RegisterModuleEnabledFlag();
+        }
+        return s_moduleEnabledFlag.m_enabled.load(AZStd::memory_order_relaxed);
+    }
+
+    void EBusDispatchStatistics::SetEnabled(bool enabled)
+    {
+        EnvironmentVariable<Internal::EBusDispatchStatisticsState>& state = GetDispatchStatisticsState();
+        AZStd::scoped_lock lock(state->m_mutex);
+        if (state->m_enabled.load(AZStd::memory_order_relaxed) == enabled)
+        {
+            return;
+        }
+
+        // Drop what was counted before, the first frame would otherwise include everything since the last time
+        for (Internal::EBusDispatchCounters* counters = state->m_head; counters; counters = counters->m_next)
+        {
+            counters->m_dispatchCount.store(0, AZStd::memory_order_relaxed);
+            counters->m_handlerCallCount.store(0, AZStd::memory_order_relaxed);
+            counters->m_lockWaitTicks.store(0, AZStd::memory_order_relaxed);
+            counters->m_dispatchTicks.store(0, AZStd::memory_order_relaxed);
+        }
+        state->m_lastFrame.clear();
+        state->m_enabled.store(enabled, AZStd::memory_order_relaxed);
+        for (AZStd::atomic_bool* moduleEnabledFlag : state->m_moduleEnabledFlags)
+        {
+            moduleEnabledFlag->store(enabled, AZStd::memory_order_relaxed);
+        }
+    }
+
+    void EBusDispatchStatistics::EndFrame()
+    {
+        EnvironmentVariable<Internal::EBusDispatchStatisticsState>& state = GetDispatchStatisticsState();
+        if (!state->m_enabled.load(AZStd::memory_order_relaxed))
+        {
+            return;
+        }
+
+        const double ticksPerMs = static_cast<double>(AZStd::GetTimeTicksPerSecond()) / 1000.0;
+
+        AZStd::scoped_lock lock(state->m_mutex);
+        state->m_lastFrame.clear();
+        for (Internal::EBusDispatchCounters* counters = state->m_head; counters; counters = counters->m_next)
+        {
+            const AZ::u64 dispatchCount = counters->m_dispatchCount.exchange(0, AZStd::memory_order_relaxed);
+            const AZ::u64 handlerCallCount = counters->m_handlerCallCount.exchange(0, AZStd::memory_order_relaxed);
+            const AZ::u64 lockWaitTicks = counters->m_lockWaitTicks.exchange(0, AZStd::memory_order_relaxed);
+            const AZ::u64 dispatchTicks = counters->m_dispatchTicks.exchange(0, AZStd::memory_order_relaxed);
+            if (dispatchCount == 0)
+            {
+                continue;
+            }
+
+            BusStatistics& busStatistics = state->m_lastFrame.emplace_back();
+            busStatistics.m_busName = counters->m_busName;
+            busStatistics.m_dispatchCount = dispatchCount;
+            busStatistics.m_handlerCallCount = handlerCallCount;
+            busStatistics.m_lockWaitTimeMs = static_cast<double>(lockWaitTicks) / ticksPerMs;
+            busStatistics.m_dispatchTimeMs = static_cast<double>(dispatchTicks) / ticksPerMs;
+        }
+
+        AZStd::sort(
+            state->m_lastFrame.begin(), state->m_lastFrame.end(),
+            [](const BusStatistics& lhs, const BusStatistics& rhs)
+            {
+                return lhs.m_dispatchTimeMs > rhs.m_dispatchTimeMs;
+            });
+    }
+
+    void EBusDispatchStatistics::GetLastFrameStatistics(AZStd::vector<BusStatistics>& statistics)
+    {
+        EnvironmentVariable<Internal::EBusDispatchStatisticsState>& state = GetDispatchStatisticsState();
+        AZStd::scoped_lock lock(state->m_mutex);
+        statistics.assign(state->m_lastFrame.begin(), state->m_lastFrame.end());
+    }
+
+    void EBusDispatchStatistics::PrintLastFrameStatistics(size_t maxBusCount)
+    {
+        if (!IsEnabled())
+        {
+            AZ_Printf("EBus", "EBus dispatch statistics are disabled, enable them with bus_dispatchStatistics.\n");
+            return;
+        }
+
+        AZStd::vector<BusStatistics> statistics;
+        GetLastFrameStatistics(statistics);
+
+        AZ_Printf("EBus", "%-64s %10s %10s %12s %12s\n", "Bus", "Dispatches", "Handlers", "Dispatch ms", "Lock ms");
+        for (size_t busIndex = 0; busIndex < AZStd::min(maxBusCount, statistics.size()); ++busIndex)
+        {
+            const BusStatistics& busStatistics = statistics[busIndex];
+            AZ_Printf(
+                "EBus", "%-64s %10llu %10llu %12.3f %12.3f\n", busStatistics.m_busName.c_str(),
+                static_cast<unsigned long long>(busStatistics.m_dispatchCount),
+                static_cast<unsigned long long>(busStatistics.m_handlerCallCount), busStatistics.m_dispatchTimeMs,
+                busStatistics.m_lockWaitTimeMs);
+        }
+    }
+
+    AZStd::fixed_string<128> EBusDispatchStatistics::GetBusNameFromSignature(const char* busSignature)
+    {
+        // GetName() returns the function signature of the EBus, which names the interface differently per compiler:
+        // clang "AZ::EBus<AZ::TickEvents>::GetName() [Interface = AZ::TickEvents, ...]"
+        // gcc   "AZ::EBus<Interface, Traits>::GetName() [with Interface = AZ::TickEvents; ...]"
+        // msvc  "AZ::EBus<class AZ::TickEvents,class AZ::TickEvents>::GetName(void)"
+        const AZStd::string_view signature(busSignature ? busSignature : "");
+        size_t start = signature.find("Interface = ");
+        if (start != AZStd::string_view::npos)
+        {
+            start += AZStd::string_view("Interface = ").size();
+        }
+        else if (start = signature.find("EBus<"); start != AZStd::string_view::npos)
+        {
+            start += AZStd::string_view("EBus<").size();
+        }
+        else
+        {
+            return AZStd::fixed_string<128>(signature.substr(0, 128));
+        }
+
+        for (const AZStd::string_view prefix : { AZStd::string_view("class "), AZStd::string_view("struct ") })
+        {
+            if (signature.substr(start).starts_with(prefix))
+            {
+                start += prefix.size();
+            }
+        }
+
+        // The interface name ends at the first separator that is not inside its own template arguments
+        size_t end = start;
+        int depth = 0;
+        for (; end < signature.size(); ++end)
+        {
+            const char c = signature[end];
+            if (c == '<')
+            {
+                ++depth;
+            }
+            else if (c == '>' && depth > 0)
+            {
+                --depth;
+            }
+            else if (depth == 0 && (c == '>' || c == ',' || c == ';' || c == ']'))
+            {
+                break;
+            }
+        }
+        return AZStd::fixed_string<128>(signature.substr(start, AZStd::min<size_t>(end - start, 128)));
+    }
+} // namespace AZ
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/fixed_string.h>
+#include <AzCore/std/time.h>
+
+// The dispatch counters are recorded in debug and profile builds, while the bus_dispatchStatistics cvar is set.
+// The switch follows the build configuration so every module agrees on it. The counters are part of every EBus
+// context regardless, so the layout of the contexts shared between modules never depends on it.
+#if defined(AZ_EBUS_DISPATCH_STATISTICS)
+#   error "AZ_EBUS_DISPATCH_STATISTICS follows the build configuration and can't be overridden"
+#elif defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
+#   define AZ_EBUS_DISPATCH_STATISTICS 1
+#else
+#   define AZ_EBUS_DISPATCH_STATISTICS 0
+#endif
+
+namespace AZ
+{
+    /**
+     * Per EBus dispatch cost, to find the buses worth converting to AZ::Interface or to batched calls.
+     * For each bus it counts the Event/Broadcast calls, the handlers they walked, the time spent waiting for the
+     * context mutex and the total time spent in the dispatches, including the handlers. The counters are aggregated
+     * per frame by EndFrame(), which ComponentApplication::Tick() calls.
+     * The statistics are enabled with the bus_dispatchStatistics cvar and printed with bus_dumpDispatchStatistics.
+     */
+    class EBusDispatchStatistics
+    {
+    public:
+        struct BusStatistics
+        {
+            AZStd::fixed_string<128> m_busName;
+            AZ::u64 m_dispatchCount = 0;
+            AZ::u64 m_handlerCallCount = 0;
+            double m_lockWaitTimeMs = 0.0;
+            double m_dispatchTimeMs = 0.0;
+        };
+
+        static bool IsEnabled();
+        static void SetEnabled(bool enabled);
+
+        //! Moves the counters of all the buses into the last frame statistics and restarts them.
+        static void EndFrame();
+
+        //! Returns the buses that were dispatched during the last completed frame, the most expensive first.
+        static void GetLastFrameStatistics(AZStd::vector<BusStatistics>& statistics);
+
+        //! Prints the @maxBusCount most expensive buses of the last completed frame.
+        static void PrintLastFrameStatistics(size_t maxBusCount);
+
+        //! Returns the interface name from the GetName() signature of an EBus, e.g. "AZ::TickEvents".
+        static AZStd::fixed_string<128> GetBusNameFromSignature(const char* busSignature);
+    };
+
+    namespace Internal
+    {
+        class EBusDispatchCounters;
+
+        //! State shared by all the modules through the AZ::Environment.
+        struct EBusDispatchStatisticsState
+        {
+            AZStd::atomic_bool m_enabled{ false };
+            AZStd::mutex m_mutex;
+            //! The copy of m_enabled of each module, which the dispatches read instead of the environment.
+            AZStd::vector<AZStd::atomic_bool*, AZ::OSStdAllocator> m_moduleEnabledFlags;
+            EBusDispatchCounters* m_head = nullptr;
+            AZStd::vector<EBusDispatchStatistics::BusStatistics, AZ::OSStdAllocator> m_lastFrame;
+        };
+
+        /**
+         * Dispatch counters of a single EBus context, updated by every Event/Broadcast while the statistics are enabled.
+         * The counters register themselves with EBusDispatchStatistics on their first dispatch.
+         */
+        class EBusDispatchCounters
+        {
+            friend class AZ::EBusDispatchStatistics;
+
+        public:
+            EBusDispatchCounters() = default;
+            ~EBusDispatchCounters();
+
+            EBusDispatchCounters(const EBusDispatchCounters&) = delete;
+            EBusDispatchCounters& operator=(const EBusDispatchCounters&) = delete;
+
+            //! @param busSignature The EBus GetName(), only read the first time the counters are used.
+            void Record(const char* busSignature, AZStd::sys_time_t lockWaitTicks, AZStd::sys_time_t dispatchTicks, AZ::u64 handlerCalls);
+
+        private:
+            void Register(const char* busSignature);
+
+            AZStd::atomic<AZ::u64> m_dispatchCount{ 0 };
+            AZStd::atomic<AZ::u64> m_handlerCallCount{ 0 };
+            AZStd::atomic<AZ::u64> m_lockWaitTicks{ 0 };
+            AZStd::atomic<AZ::u64> m_dispatchTicks{ 0 };
+            AZStd::atomic_bool m_registered{ false };
+
+            // Guarded by the mutex of the shared state
+            AZStd::fixed_string<128> m_busName;
+            EBusDispatchCounters* m_prev = nullptr;
+            EBusDispatchCounters* m_next = nullptr;
+            EnvironmentVariable<EBusDispatchStatisticsState> m_state;
+        };
+    } // namespace Internal
+} // namespace AZ
@@ -206,6 +206,19 @@ namespace AZ
         */
         static constexpr bool LocklessDispatch = false;
 
+        /**
+         * Specifies whether the EBus caches its handler so that callers can call it directly.
+         * Only valid on a bus with a single address and a single handler (AZ::EBusAddressPolicy::Single
+         * and AZ::EBusHandlerPolicy::Single).
+         * `<BusName>::GetCachedHandler()` returns the connected handler without looking up the bus context,
+         * locking the dispatch mutex or tracking the callstack, so a hot path can call the handler like it
+         * would call an AZ::Interface. The cached handler is updated every time the handler connects or disconnects.
+         * Calls made through the cached handler skip routers and the event queue, and, as with AZ::Interface,
+         * the caller is responsible for making sure the handler doesn't disconnect while it's being called.
+         * By default, the handler is not cached.
+         */
+        static constexpr bool EnableHandlerCache = false;
+
         /**
          * Specifies where EBus data is stored.
          * This drives how many instances of this EBus exist at runtime.
@@ -592,6 +605,8 @@ namespace AZ
             "When you use EBusAddressPolicy::Single or EBusAddressPolicy::ById there is no need to define BusIdOrderCompare!");
         static_assert((BusTraits::AddressPolicy != EBusAddressPolicy::ByIdAndOrdered || !AZStd::is_same<BusIdOrderCompare, NullBusIdCompare>::value),
             "When you use EBusAddressPolicy::ByIdAndOrdered you must define BusIdOrderCompare (ex. using BusIdOrderCompare = AZStd::less<BusIdType>)");
+        static_assert((!BusTraits::EnableHandlerCache || (BusTraits::AddressPolicy == EBusAddressPolicy::Single && BusTraits::HandlerPolicy == EBusHandlerPolicy::Single)),
+            "EnableHandlerCache can only be used with EBusAddressPolicy::Single and EBusHandlerPolicy::Single!");
         /// @endcond
         /// //////////////////////////////////////////////////////////////////////////
 
@@ -700,6 +715,14 @@ namespace AZ
          */
         static const char* GetName();
 
+        /**
+         * Returns the handler that is connected to the EBus, for buses that set EBusTraits::EnableHandlerCache.
+         * The handler can be called directly, which avoids the locking, routing and callstack tracking of a Broadcast.
+         * The caller must make sure the handler doesn't disconnect while it's being called.
+         * @return The connected handler, or a null pointer if no handler is connected.
+         */
+        static InterfaceType* GetCachedHandler();
+
         /// @cond EXCLUDE_DOCS
         class Context : public AZ::Internal::ContextBase
         {
@@ -743,6 +766,8 @@ namespace AZ
             ContextMutexType        m_contextMutex;  ///< Mutex to control access when modifying the context
             QueuePolicy             m_queue;
             RouterPolicy            m_routing;
+            AZStd::atomic<InterfaceType*> m_cachedHandler{ nullptr }; ///< Connected handler, only kept up to date when EnableHandlerCache is set
+            AZ::Internal::EBusDispatchCounters m_dispatchCounters; ///< Dispatch cost of this bus, see EBusDispatchStatistics
 
             Context();
             Context(EBusEnvironment* environment);
@@ -1100,6 +1125,10 @@ AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
 
         // Do the actual connection
         context.m_buses.Connect(handler, id);
+        if constexpr (Traits::EnableHandlerCache)
+        {
+            context.m_cachedHandler.store(context.m_buses.m_handler, AZStd::memory_order_release);
+        }
 
         BusPtr ptr;
         if constexpr (EBus::HasId)
@@ -1151,6 +1180,10 @@ AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
 
         // Do the actual disconnection
         context.m_buses.Disconnect(handler);
+        if constexpr (Traits::EnableHandlerCache)
+        {
+            context.m_cachedHandler.store(context.m_buses.m_handler, AZStd::memory_order_release);
+        }
 
         if (callstack)
         {
@@ -1211,6 +1244,20 @@ AZ_POP_DISABLE_WARNING
         return BaseImpl::FindFirstHandler(ptr) != nullptr;
     }
 
+    //=========================================================================
+    // GetCachedHandler
+    //=========================================================================
+    template<class Interface, class Traits>
+    inline auto EBus<Interface, Traits>::GetCachedHandler() -> InterfaceType*
+    {
+        static_assert(Traits::EnableHandlerCache, "GetCachedHandler requires EnableHandlerCache to be set in the EBus traits");
+        if (Context* context = GetContext(false))
+        {
+            return context->m_cachedHandler.load(AZStd::memory_order_acquire);
+        }
+        return nullptr;
+    }
+
     //=========================================================================
     // GetCurrentBusId
     //=========================================================================
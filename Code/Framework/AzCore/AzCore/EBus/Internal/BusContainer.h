@@ -15,6 +15,7 @@
 #include <AzCore/EBus/Internal/Handlers.h>
 #include <AzCore/EBus/Internal/StoragePolicies.h>
 #include <AzCore/EBus/Internal/Debug.h>
+#include <AzCore/EBus/Internal/DispatchScope.h>
 
 AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
 
@@ -115,7 +116,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -146,6 +147,7 @@ namespace AZ
                             while (handlerIt != handlersEnd)
                             {
                                 auto itr = handlerIt++;
+                                dispatchScope.OnHandlerCall();
                                 Traits::EventProcessingPolicy::Call(func, *itr, args...);
                             }
 
@@ -158,7 +160,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -189,6 +191,7 @@ namespace AZ
                             while (handlerIt != handlersEnd)
                             {
                                 auto itr = handlerIt++;
+                                dispatchScope.OnHandlerCall();
                                 Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                             }
 
@@ -201,7 +204,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -218,6 +221,7 @@ namespace AZ
                             while (handlerIt != handlers.rend())
                             {
                                 auto itr = handlerIt++;
+                                dispatchScope.OnHandlerCall();
                                 Traits::EventProcessingPolicy::Call(func, *itr, args...);
                             }
 
@@ -230,7 +234,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -247,6 +251,7 @@ namespace AZ
                             while (handlerIt != handlers.rend())
                             {
                                 auto itr = handlerIt++;
+                                dispatchScope.OnHandlerCall();
                                 Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                             }
 
@@ -261,7 +266,7 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
@@ -286,6 +291,7 @@ namespace AZ
                         while (handlerIt != handlersEnd)
                         {
                             auto itr = handlerIt++;
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::Call(func, *itr, args...);
                         }
                     }
@@ -297,7 +303,7 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
@@ -322,6 +328,7 @@ namespace AZ
                         while (handlerIt != handlersEnd)
                         {
                             auto itr = handlerIt++;
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                         }
                     }
@@ -333,7 +340,7 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
@@ -344,6 +351,7 @@ namespace AZ
                         while (handlerIt != handlers.rend())
                         {
                             auto itr = handlerIt++;
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::Call(func, *itr, args...);
                         }
                     }
@@ -355,7 +363,7 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
@@ -366,6 +374,7 @@ namespace AZ
                         while (handlerIt != handlers.rend())
                         {
                             auto itr = handlerIt++;
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                         }
                     }
@@ -377,7 +386,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -408,6 +417,7 @@ namespace AZ
                             while (handlerIt != handlersEnd)
                             {
                                 auto itr = handlerIt++;
+                                dispatchScope.OnHandlerCall();
                                 Traits::EventProcessingPolicy::Call(func, *itr, args...);
                             }
 
@@ -423,7 +433,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -454,6 +464,7 @@ namespace AZ
                             while (handlerIt != handlersEnd)
                             {
                                 auto itr = handlerIt++;
+                                dispatchScope.OnHandlerCall();
                                 Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                             }
 
@@ -469,7 +480,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -497,6 +508,7 @@ namespace AZ
                             while (handlerIt != handlers.rend())
                             {
                                 auto itr = handlerIt++;
+                                dispatchScope.OnHandlerCall();
                                 Traits::EventProcessingPolicy::Call(func, *itr, args...);
                             }
                             holder.release();
@@ -527,7 +539,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -555,6 +567,7 @@ namespace AZ
                             while (handlerIt != handlers.rend())
                             {
                                 auto itr = handlerIt++;
+                                dispatchScope.OnHandlerCall();
                                 Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                             }
                             holder.release();
@@ -587,7 +600,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
 
                         auto& addresses = context->m_buses.m_addresses;
                         auto addressIt = addresses.begin();
@@ -606,7 +619,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
 
                         auto& addresses = context->m_buses.m_addresses;
                         auto addressIt = addresses.find(id);
@@ -621,7 +634,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
 
                         if (ptr)
                         {
@@ -795,7 +808,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -803,6 +816,7 @@ namespace AZ
                         if (addressIt != addresses.end() && addressIt->m_interface)
                         {
                             CallstackEntry entry(context, &addressIt->m_busId);
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), addressIt->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -812,7 +826,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -820,6 +834,7 @@ namespace AZ
                         if (addressIt != addresses.end() && addressIt->m_interface)
                         {
                             CallstackEntry entry(context, &addressIt->m_busId);
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), addressIt->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -829,7 +844,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -837,6 +852,7 @@ namespace AZ
                         if (addressIt != addresses.end() && addressIt->m_interface)
                         {
                             CallstackEntry entry(context, &addressIt->m_busId);
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), addressIt->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -846,7 +862,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -854,6 +870,7 @@ namespace AZ
                         if (addressIt != addresses.end() && addressIt->m_interface)
                         {
                             CallstackEntry entry(context, &addressIt->m_busId);
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), addressIt->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -865,13 +882,14 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
                         if (busPtr->m_interface)
                         {
                             CallstackEntry entry(context, &busPtr->m_busId);
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), busPtr->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -883,13 +901,14 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
                         if (busPtr->m_interface)
                         {
                             CallstackEntry entry(context, &busPtr->m_busId);
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), busPtr->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -901,13 +920,14 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
                         if (busPtr->m_interface)
                         {
                             CallstackEntry entry(context, &busPtr->m_busId);
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), busPtr->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -919,13 +939,14 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
                         if (busPtr->m_interface)
                         {
                             CallstackEntry entry(context, &busPtr->m_busId);
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), busPtr->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -937,7 +958,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -965,6 +986,7 @@ namespace AZ
                             {
                                 // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                                 // due to potential of multiple addresses of this EBus container invoking the function multiple times
+                                dispatchScope.OnHandlerCall();
                                 Traits::EventProcessingPolicy::Call(func, inst, args...);
                             }
                         }
@@ -975,7 +997,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -1003,6 +1025,7 @@ namespace AZ
                             {
                                 // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                                 // due to potential of multiple addresses of this EBus container invoking the function multiple times
+                                dispatchScope.OnHandlerCall();
                                 Traits::EventProcessingPolicy::CallResult(results, func, inst, args...);
                             }
                         }
@@ -1013,7 +1036,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -1039,6 +1062,7 @@ namespace AZ
                                 CallstackEntry entry(context, &holder.m_busId);
                                 // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                                 // due to potential of multiple addresses of this EBus container invoking the function multiple times
+                                dispatchScope.OnHandlerCall();
                                 Traits::EventProcessingPolicy::Call(func, inst, args...);
                             }
                             holder.release();
@@ -1069,7 +1093,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -1095,6 +1119,7 @@ namespace AZ
                                 CallstackEntry entry(context, &holder.m_busId);
                                 // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                                 // due to potential of multiple addresses of this EBus container invoking the function multiple times
+                                dispatchScope.OnHandlerCall();
                                 Traits::EventProcessingPolicy::CallResult(results, func, inst, args...);
                             }
                             holder.release();
@@ -1127,7 +1152,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
 
                         auto& addresses = context->m_buses.m_addresses;
                         auto addressIt = addresses.begin();
@@ -1153,6 +1178,7 @@ namespace AZ
                             if (Interface* inst = (addressIt++)->m_interface)
                             {
                                 bool result = false;
+                                dispatchScope.OnHandlerCall();
                                 Traits::EventProcessingPolicy::CallResult(result, callback, inst);
                                 if (!result)
                                 {
@@ -1167,7 +1193,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
 
                         auto& addresses = context->m_buses.m_addresses;
                         auto addressIt = addresses.find(id);
@@ -1177,6 +1203,7 @@ namespace AZ
                             {
                                 CallstackEntry entry(context, &id);
                                 bool result = false;
+                                dispatchScope.OnHandlerCall();
                                 Traits::EventProcessingPolicy::CallResult(result, callback, inst);
                                 if (!result)
                                 {
@@ -1191,7 +1218,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
 
                         if (ptr)
                         {
@@ -1199,6 +1226,7 @@ namespace AZ
                             {
                                 CallstackEntry entry(context, &ptr->m_busId);
                                 bool result = false;
+                                dispatchScope.OnHandlerCall();
                                 Traits::EventProcessingPolicy::CallResult(result, callback, inst);
                                 if (!result)
                                 {
@@ -1336,7 +1364,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1362,6 +1390,7 @@ namespace AZ
                             // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                             // due to potential of multiple handlers of this EBus container invoking the function multiple times
                             auto itr = handlerIt++;
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::Call(func, *itr, args...);
                         }
                     }
@@ -1371,7 +1400,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1397,6 +1426,7 @@ namespace AZ
                             // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                             // due to potential of multiple handlers of this EBus container invoking the function multiple times
                             auto itr = handlerIt++;
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                         }
                     }
@@ -1406,7 +1436,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1418,6 +1448,7 @@ namespace AZ
                             // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                             // due to potential of multiple handlers of this EBus container invoking the function multiple times
                             auto itr = handlerIt++;
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::Call(func, *itr, args...);
                         }
                     }
@@ -1427,7 +1458,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1439,6 +1470,7 @@ namespace AZ
                             // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                             // due to potential of multiple handlers of this EBus container invoking the function multiple times
                             auto itr = handlerIt++;
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                         }
                     }
@@ -1450,7 +1482,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
 
                         auto& handlers = context->m_buses.m_handlers;
                         auto handlerIt = handlers.begin();
@@ -1474,6 +1506,7 @@ namespace AZ
                         {
                             bool result = false;
                             auto itr = handlerIt++;
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::CallResult(result, callback, itr->m_interface);
                             if (!result)
                             {
@@ -1530,13 +1563,14 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto handler = context->m_buses.m_handler;
                         if (handler)
                         {
                             CallstackEntry entry(context, nullptr);
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), handler, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -1546,13 +1580,14 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto handler = context->m_buses.m_handler;
                         if (handler)
                         {
                             CallstackEntry entry(context, nullptr);
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), handler, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -1562,13 +1597,14 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto handler = context->m_buses.m_handler;
                         if (handler)
                         {
                             CallstackEntry entry(context, nullptr);
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), handler, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -1578,13 +1614,14 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto handler = context->m_buses.m_handler;
                         if (handler)
                         {
                             CallstackEntry entry(context, nullptr);
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), handler, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -1596,12 +1633,13 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        AZ::Internal::DispatchScope<Bus> dispatchScope(*context);
 
                         auto handler = context->m_buses.m_handler;
                         if (handler)
                         {
                             CallstackEntry entry(context, nullptr);
+                            dispatchScope.OnHandlerCall();
                             Traits::EventProcessingPolicy::Call(callback, handler);
                         }
                     }
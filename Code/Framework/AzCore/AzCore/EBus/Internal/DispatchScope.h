@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/EBus/DispatchStatistics.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        // Holds the dispatch lock of a bus for the duration of an Event/Broadcast and, when the
+        // EBus dispatch statistics are enabled, measures the dispatch for EBusDispatchStatistics.
+        template <typename Bus>
+        class DispatchScope
+        {
+        public:
+#if AZ_EBUS_DISPATCH_STATISTICS
+            explicit DispatchScope(typename Bus::Context& context)
+                : m_counters(EBusDispatchStatistics::IsEnabled() ? &context.m_dispatchCounters : nullptr)
+                , m_startTicks(m_counters ? AZStd::GetTimeNowTicks() : 0)
+                , m_lock(context.m_contextMutex)
+                , m_lockedTicks(m_counters ? AZStd::GetTimeNowTicks() : 0)
+            {
+            }
+
+            ~DispatchScope()
+            {
+                if (m_counters)
+                {
+                    m_counters->Record(Bus::GetName(), m_lockedTicks - m_startTicks, AZStd::GetTimeNowTicks() - m_startTicks, m_handlerCalls);
+                }
+            }
+
+            void OnHandlerCall()
+            {
+                ++m_handlerCalls;
+            }
+#else
+            explicit DispatchScope(typename Bus::Context& context)
+                : m_lock(context.m_contextMutex)
+            {
+            }
+
+            void OnHandlerCall()
+            {
+            }
+#endif
+
+            DispatchScope(const DispatchScope&) = delete;
+            DispatchScope& operator=(const DispatchScope&) = delete;
+
+        private:
+#if AZ_EBUS_DISPATCH_STATISTICS
+            EBusDispatchCounters* m_counters;
+            AZStd::sys_time_t m_startTicks;
+#endif
+            typename Bus::Context::DispatchLockGuard m_lock;
+#if AZ_EBUS_DISPATCH_STATISTICS
+            AZStd::sys_time_t m_lockedTicks;
+            AZ::u64 m_handlerCalls = 0;
+#endif
+        };
+    } // namespace Internal
+} // namespace AZ
@@ -23,6 +23,8 @@ namespace AZ::IO
         m_offset = rhs.m_offset;
         m_compressedSize = rhs.m_compressedSize;
         m_uncompressedSize = rhs.m_uncompressedSize;
+        m_frameOffsets = AZStd::move(rhs.m_frameOffsets);
+        m_uncompressedFrameSize = rhs.m_uncompressedFrameSize;
         m_conflictResolution = rhs.m_conflictResolution;
         m_isCompressed = rhs.m_isCompressed;
         m_isSharedPak = rhs.m_isSharedPak;
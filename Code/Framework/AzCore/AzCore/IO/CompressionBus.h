@@ -10,6 +10,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/string/string_view.h>
@@ -55,6 +56,14 @@ namespace AZ
             size_t m_compressedSize = 0;
             //! Size after the file has been decompressed.
             size_t m_uncompressedSize = 0;
+            //! Optional frame table for block-framed compression. If filled in, the file is stored as a series of independently
+            //! compressed frames that each decompress to m_uncompressedFrameSize bytes, except for the last frame which can be smaller.
+            //! Every entry is the offset of a frame relative to m_offset, followed by a closing entry that matches m_compressedSize.
+            //! Frames are decompressed in parallel and partial reads only decompress the frames they overlap. The decompressor is
+            //! called once per frame with a CompressionInfo that describes only that frame.
+            AZStd::vector<size_t> m_frameOffsets;
+            //! Size of a single frame after decompression. Only used if m_frameOffsets is filled in.
+            size_t m_uncompressedFrameSize = 0;
             //! Preferred solution when an archive is found in the archive and as a separate file.
             ConflictResolution m_conflictResolution = ConflictResolution::UseArchiveOnly;
             //! Whether or not the file is compressed. If the file is not compressed, the compressed and uncompressed sizes should match.
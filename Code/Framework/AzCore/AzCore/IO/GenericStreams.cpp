@@ -292,6 +292,17 @@ namespace AZ::IO
         return bytes;
     }
 
+    const void* MemoryStream::ReadInPlace(SizeType bytes)
+    {
+        if (m_curOffset > GetLength() || bytes > GetLength() - m_curOffset)
+        {
+            return nullptr;
+        }
+        const char* data = m_buffer + m_curOffset;
+        m_curOffset += static_cast<size_t>(bytes);
+        return data;
+    }
+
     SizeType MemoryStream::PrepareForWrite(SizeType bytes)
     {
         AZ_Assert(m_mode == MSM_READWRITE, "This memory stream is not writable!");
@@ -47,6 +47,11 @@ namespace AZ::IO
         virtual SizeType    GetLength() const = 0;
         virtual SizeType    ReadAtOffset(SizeType bytes, void* oBuffer, OffsetType offset = -1);
         virtual SizeType    WriteAtOffset(SizeType bytes, const void* iBuffer, OffsetType offset = -1);
+        //! Alternate version of Read for streams backed by a memory buffer that stays valid while the stream is open.
+        //! Returns a pointer to the next bytes in that buffer and advances the read position as Read would, so callers
+        //! can use the data without copying it. Returns nullptr without moving the read position if the stream
+        //! doesn't have such a buffer or if fewer than bytes are available.
+        virtual const void* ReadInPlace([[maybe_unused]] SizeType bytes) { return nullptr; }
         virtual bool        IsCompressed() const { return false; }
         virtual const char* GetFilename() const { return ""; }
         virtual OpenMode    GetModeFlags() const { return OpenMode(); }
@@ -148,6 +153,7 @@ namespace AZ::IO
         SizeType    Read(SizeType bytes, void* oBuffer) override;
         SizeType    Write(SizeType bytes, const void* iBuffer) override;
         SizeType    WriteFromStream(SizeType bytes, GenericStream* inputStream) override;
+        const void* ReadInPlace(SizeType bytes) override;
         virtual const void* GetData() const { return m_buffer; }
         SizeType    GetCurPos() const override { return m_curOffset; }
         SizeType    GetLength() const override { return m_curLen; }
@@ -101,7 +101,8 @@ namespace AZ::IO::IStreamerTypes
     //! RequestMemoryAllocators can be used to provide a mechanic to allow the Streamer to allocate memory right before the request is
     //! processed. This can be useful in avoiding having to track memory buffers as these are managed by Streamer until the buffer is
     //! claimed. It can also help reduce peak memory if processing data requires temporary buffers as these do not all have to be
-    //! created upfront.
+    //! created upfront. It can also be used to have data read directly into memory owned by another system, such as a mapped staging
+    //! buffer used for uploads to the gpu, in which case the MemoryType returned from Allocate should describe that memory.
     //! The RequestMemoryAllocator typically outlives the request and a completed request does not mean the allocator isn't still in use as
     //! internal processing may still need the allocator. Calls to LockAllocator and UnlockAllocator can be used to keep track of the
     //! number of requests that still require processing.
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MappedFile.h>
+#include <AzCore/Casting/numeric_cast.h>
+
+namespace AZ::IO
+{
+    AZStd::intrusive_ptr<MappedFile> MappedFile::Open(const char* filePath)
+    {
+        AZ_Assert(filePath, "A file path is required to map a file.");
+
+        const AZStd::byte* data = nullptr;
+        u64 size = 0;
+        if (!Platform::MapFile(filePath, data, size))
+        {
+            return nullptr;
+        }
+        return AZStd::intrusive_ptr<MappedFile>(aznew MappedFile(data, size));
+    }
+
+    MappedFile::MappedFile(const AZStd::byte* data, u64 size)
+        : m_data(data)
+        , m_size(size)
+    {
+    }
+
+    MappedFile::~MappedFile()
+    {
+        Platform::UnmapFile(m_data, m_size);
+    }
+
+    AZStd::span<const AZStd::byte> MappedFile::GetData() const
+    {
+        return AZStd::span<const AZStd::byte>(m_data, aznumeric_cast<size_t>(m_size));
+    }
+
+    MappedFileView::MappedFileView(AZStd::intrusive_ptr<const MappedFile> mappedFile, u64 offset, u64 size)
+    {
+        if (mappedFile)
+        {
+            AZStd::span<const AZStd::byte> data = mappedFile->GetData();
+            if (offset <= data.size() && size <= data.size() - offset)
+            {
+                m_data = data.subspan(aznumeric_cast<size_t>(offset), aznumeric_cast<size_t>(size));
+                m_mappedFile = AZStd::move(mappedFile);
+            }
+            else
+            {
+                AZ_Error("MappedFile", false, "Requested a view of %llu bytes at offset %llu, but the mapped file is only %zu bytes.",
+                    size, offset, data.size());
+            }
+        }
+    }
+
+    AZStd::span<const AZStd::byte> MappedFileView::GetData() const
+    {
+        return m_data;
+    }
+
+    bool MappedFileView::IsValid() const
+    {
+        return m_mappedFile != nullptr;
+    }
+
+    MappedFileView::operator bool() const
+    {
+        return IsValid();
+    }
+} // namespace AZ::IO
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/smart_ptr/intrusive_base.h>
+#include <AzCore/std/smart_ptr/intrusive_ptr.h>
+
+namespace AZ::IO
+{
+    //! Read-only memory mapping of an entire file. The mapping is reference counted and stays valid for as long as
+    //! there's a MappedFile or MappedFileView referencing it, even if the file is closed by its original owner.
+    //! The contents of the file must not be changed while it's mapped.
+    class MappedFile final
+        : public AZStd::intrusive_base
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(MappedFile, AZ::SystemAllocator);
+
+        //! Maps the file at the provided path. Returns null if the file can't be opened or mapped, or is empty.
+        static AZStd::intrusive_ptr<MappedFile> Open(const char* filePath);
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile(MappedFile&&) = delete;
+        ~MappedFile();
+
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile& operator=(MappedFile&&) = delete;
+
+        AZStd::span<const AZStd::byte> GetData() const;
+
+    private:
+        MappedFile(const AZStd::byte* data, u64 size);
+
+        const AZStd::byte* m_data{ nullptr };
+        u64 m_size{ 0 };
+    };
+
+    //! A range of a MappedFile. The view keeps the file mapped so the data can be used directly for as long as the view
+    //! is alive, which avoids having to copy it into a separate buffer.
+    class MappedFileView
+    {
+    public:
+        MappedFileView() = default;
+        MappedFileView(AZStd::intrusive_ptr<const MappedFile> mappedFile, u64 offset, u64 size);
+
+        //! Returns the data in the view, or an empty span if the view is invalid.
+        AZStd::span<const AZStd::byte> GetData() const;
+        bool IsValid() const;
+        explicit operator bool() const;
+
+    private:
+        AZStd::intrusive_ptr<const MappedFile> m_mappedFile;
+        AZStd::span<const AZStd::byte> m_data;
+    };
+
+    namespace Platform
+    {
+        //! Maps the entire file at the provided path as read-only memory. Implemented per platform.
+        bool MapFile(const char* filePath, const AZStd::byte*& data, u64& size);
+        //! Releases a mapping created with MapFile. Implemented per platform.
+        void UnmapFile(const AZStd::byte* data, u64 size);
+    } // namespace Platform
+} // namespace AZ::IO
@@ -121,6 +121,7 @@ namespace AZ::IO
     void DedicatedCache::QueueRequest(FileRequest* request)
     {
         AZ_Assert(request, "QueueRequest was provided a null request.");
+        request->RecordTraceStage(m_name.c_str());
 
         AZStd::visit([this, request](auto&& args)
         {
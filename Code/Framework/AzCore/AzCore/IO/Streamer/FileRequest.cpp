@@ -8,6 +8,7 @@
 
 #include <limits>
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/IO/Streamer/RequestPath.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
@@ -154,6 +155,10 @@ namespace AZ::IO::Requests
 
 namespace AZ::IO
 {
+    AZ_CVAR(bool, io_requestTracing, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Records the time every Streamer request spends in the scheduler queue and in each entry of the streaming stack. "
+        "The stages are added to the \"Streamer requests\" tracks of the profiler timeline and summarized in the Streamer statistics.");
+
     //
     // FileRequest
     //
@@ -411,6 +416,7 @@ namespace AZ::IO
         m_parent = nullptr;
         m_status = IStreamerTypes::RequestStatus::Pending;
         m_dependencies = 0;
+        m_traceStageCount = 0;
     }
 
     void FileRequest::SetOptionalParent(FileRequest* parent)
@@ -462,6 +468,14 @@ namespace AZ::IO
         return m_estimatedCompletion;
     }
 
+    void FileRequest::RecordTraceStage(const char* stageName)
+    {
+        if (io_requestTracing && m_traceStageCount < s_maxTraceStages)
+        {
+            m_traceStages[m_traceStageCount++] = { stageName, AZStd::GetTimeNowTicks() };
+        }
+    }
+
     //
     // ExternalFileRequest
     //
@@ -21,6 +21,7 @@
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/string/string_view.h>
+#include <AzCore/std/time.h>
 
 namespace AZ::IO
 {
@@ -348,7 +349,19 @@ namespace AZ::IO
         void SetEstimatedCompletion(AZStd::chrono::steady_clock::time_point time);
         AZStd::chrono::steady_clock::time_point GetEstimatedCompletion() const;
 
+        //! Records that the request entered a stage of its processing, such as a stream stack entry, while the
+        //! io_requestTracing cvar is on. The time spent in each stage is reported to the profiler once the
+        //! request completes. The stage name needs to outlive the request.
+        void RecordTraceStage(const char* stageName);
+
     private:
+        struct TraceStage
+        {
+            const char* m_name;
+            AZStd::sys_time_t m_enterTicks;
+        };
+        inline constexpr static size_t s_maxTraceStages = 8;
+
         explicit FileRequest(Usage usage = Usage::Internal);
         ~FileRequest();
 
@@ -393,6 +406,12 @@ namespace AZ::IO
 
         //! Whether or not this request is currently in a recycle bin. This allows detecting double deletes.
         bool m_inRecycleBin{ false };
+
+        //! The number of stages in m_traceStages. Stages past the maximum are dropped, so the last stage
+        //! will cover the remaining time until completion.
+        u8 m_traceStageCount{ 0 };
+        //! Stages the request entered while request tracing was on, in the order they were entered.
+        TraceStage m_traceStages[s_maxTraceStages];
     };
 
     class StreamerContext;
@@ -110,13 +110,21 @@ namespace AZ::IO
     void FullFileDecompressor::QueueRequest(FileRequest* request)
     {
         AZ_Assert(request, "QueueRequest was provided a null request.");
+        request->RecordTraceStage(m_name.c_str());
 
         AZStd::visit([this, request](auto&& args)
         {
             using Command = AZStd::decay_t<decltype(args)>;
             if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
             {
-                m_pendingReads.push_back(request);
+                if (args.m_compressionInfo.m_frameOffsets.empty())
+                {
+                    m_pendingReads.push_back(request);
+                }
+                else
+                {
+                    QueueFramedRead(request, args);
+                }
             }
             else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
             {
@@ -507,6 +515,59 @@ namespace AZ::IO
         }
     }
 
+    void FullFileDecompressor::QueueFramedRead(FileRequest* compressedReadRequest, Requests::CompressedReadData& data)
+    {
+        const CompressionInfo& info = data.m_compressionInfo;
+        const size_t frameSize = info.m_uncompressedFrameSize;
+        const size_t frameCount = info.m_frameOffsets.size() - 1;
+        if (frameCount == 0 || frameSize == 0 || info.m_frameOffsets.back() != info.m_compressedSize ||
+            (frameCount - 1) * frameSize >= info.m_uncompressedSize || frameCount * frameSize < info.m_uncompressedSize)
+        {
+            AZ_Error("Streamer", false, "Frame table for '%s' doesn't match the compressed (%zu) and uncompressed (%zu) sizes.",
+                info.m_archiveFilename.GetRelativePathCStr(), info.m_compressedSize, info.m_uncompressedSize);
+            compressedReadRequest->SetStatus(IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(compressedReadRequest);
+            return;
+        }
+
+        if (data.m_readSize == 0)
+        {
+            compressedReadRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(compressedReadRequest);
+            return;
+        }
+
+        // Every frame gets its own compressed read as a child of the original request. These are processed like any other compressed
+        // read, which spreads the frames over the available read and job slots. The original request completes once all frames are done.
+        const u64 readEnd = data.m_readOffset + data.m_readSize;
+        const size_t firstFrame = aznumeric_cast<size_t>(data.m_readOffset / frameSize);
+        const size_t lastFrame = AZStd::min(aznumeric_cast<size_t>((readEnd - 1) / frameSize), frameCount - 1);
+        u8* output = reinterpret_cast<u8*>(data.m_output);
+        for (size_t frame = firstFrame; frame <= lastFrame; ++frame)
+        {
+            const u64 frameStart = frame * frameSize;
+            const u64 frameEnd = AZStd::min<u64>(frameStart + frameSize, info.m_uncompressedSize);
+            const u64 copyStart = AZStd::max(frameStart, data.m_readOffset);
+            const u64 copyEnd = AZStd::min(frameEnd, readEnd);
+
+            CompressionInfo frameInfo;
+            frameInfo.m_archiveFilename = info.m_archiveFilename;
+            frameInfo.m_decompressor = info.m_decompressor;
+            frameInfo.m_compressionTag = info.m_compressionTag;
+            frameInfo.m_offset = info.m_offset + info.m_frameOffsets[frame];
+            frameInfo.m_compressedSize = info.m_frameOffsets[frame + 1] - info.m_frameOffsets[frame];
+            frameInfo.m_uncompressedSize = aznumeric_cast<size_t>(frameEnd - frameStart);
+            frameInfo.m_conflictResolution = info.m_conflictResolution;
+            frameInfo.m_isCompressed = true;
+            frameInfo.m_isSharedPak = info.m_isSharedPak;
+
+            FileRequest* frameRequest = m_context->GetNewInternalRequest();
+            frameRequest->CreateCompressedRead(compressedReadRequest, AZStd::move(frameInfo), output + (copyStart - data.m_readOffset),
+                copyStart - frameStart, copyEnd - copyStart);
+            m_pendingReads.push_back(frameRequest);
+        }
+    }
+
     void FullFileDecompressor::StartArchiveRead(FileRequest* compressedReadRequest)
     {
         if (!m_next)
@@ -650,7 +711,14 @@ namespace AZ::IO
                 info.m_alignmentOffset = aznumeric_caster(data->m_compressionInfo.m_offset -
                     AZ_SIZE_ALIGN_DOWN(data->m_compressionInfo.m_offset, aznumeric_cast<size_t>(m_alignment)));
 
-                if (data->m_readOffset == 0 && data->m_readSize == data->m_compressionInfo.m_uncompressedSize)
+                // Decompressors read back from their output, so memory the caller marked as write-combined, such as mapped
+                // upload heaps, only receives the final copy.
+                const Requests::ReadRequestData* readRequest = compressedRequest->GetCommandFromChain<Requests::ReadRequestData>();
+                const bool isWriteCombined = readRequest && readRequest->m_memoryType == IStreamerTypes::MemoryType::WriteCombined;
+                info.m_usesTemporaryBuffer = isWriteCombined ||
+                    data->m_readOffset != 0 || data->m_readSize != data->m_compressionInfo.m_uncompressedSize;
+
+                if (!info.m_usesTemporaryBuffer)
                 {
                     auto job = [this, &info]()
                     {
@@ -703,7 +771,7 @@ namespace AZ::IO
         size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
         size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
         m_memoryUsage -= bufferSize;
-        if (data->m_readOffset != 0 || data->m_readSize != data->m_compressionInfo.m_uncompressedSize)
+        if (jobInfo.m_usesTemporaryBuffer)
         {
             m_memoryUsage -= data->m_compressionInfo.m_uncompressedSize;
         }
@@ -23,6 +23,7 @@ namespace AZ::IO
 {
     namespace Requests
     {
+        struct CompressedReadData;
         struct ReadRequestData;
         struct ReportData;
     }
@@ -53,6 +54,9 @@ namespace AZ::IO
     //! Finally, the lack of an upper limit also means that the duration of the decompression job
     //! can vary largely so a dedicated job system is used to decompress on to avoid blocking
     //! the main job system from working.
+    //! Files that provide a frame table in their CompressionInfo are the exception. These are split
+    //! into a read per frame, so frames are read and decompressed in parallel and only the frames that
+    //! overlap the requested range are processed.
     class FullFileDecompressor
         : public StreamStackEntry
     {
@@ -89,6 +93,9 @@ namespace AZ::IO
             Buffer m_compressedData{ nullptr };
             FileRequest* m_waitRequest{ nullptr };
             u32 m_alignmentOffset{ 0 };
+            //! The decompression will be done in a temporary buffer first and the requested range copied to the output afterwards.
+            //! This is needed for partial reads and for output memory that shouldn't be read back, such as write-combined memory.
+            bool m_usesTemporaryBuffer{ false };
         };
 
         bool IsIdle() const;
@@ -100,6 +107,7 @@ namespace AZ::IO
         void EstimateCompressedReadRequest(FileRequest* request, AZStd::chrono::microseconds& cumulativeDelay,
             AZStd::chrono::microseconds decompressionDelay, double totalDecompressionDurationUs, double totalBytesDecompressed) const;
 
+        void QueueFramedRead(FileRequest* compressedReadRequest, Requests::CompressedReadData& data);
         void StartArchiveRead(FileRequest* compressedReadRequest);
         void FinishArchiveRead(FileRequest* readRequest, u32 readSlot);
         bool StartDecompressions();
@@ -0,0 +1,675 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/PersistentCache.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/string/fixed_string.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> PersistentCacheConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        FileIOBase* fileIO = FileIOBase::GetInstance();
+        AZStd::optional<AZ::IO::FixedMaxPath> cacheFolder = fileIO ? fileIO->ResolvePath(AZ::IO::PathView(m_cacheFolder)) : AZStd::nullopt;
+        if (!cacheFolder)
+        {
+            AZ_Warning("Streamer", false, "Unable to resolve the folder '%s' for the persistent cache. The cache will not be used.",
+                m_cacheFolder.c_str());
+            return parent;
+        }
+
+        auto stackEntry = AZStd::make_shared<PersistentCache>(AZ::IO::Path(cacheFolder->Native()), m_cacheSizeMib * 1_mib,
+            AZStd::min(m_maxEntrySizeMib, m_cacheSizeMib) * 1_mib, aznumeric_cast<u32>(hardware.m_maxPhysicalSectorSize));
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void PersistentCacheConfig::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<PersistentCacheConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("CacheFolder", &PersistentCacheConfig::m_cacheFolder)
+                ->Field("CacheSizeMib", &PersistentCacheConfig::m_cacheSizeMib)
+                ->Field("MaxEntrySizeMib", &PersistentCacheConfig::m_maxEntrySizeMib);
+        }
+    }
+
+    static constexpr char CacheHitRateName[] = "Cache hit rate";
+    static constexpr char IndexFileName[] = "index.dat";
+    static constexpr char IndexTempFileName[] = "index.tmp";
+    static constexpr char EntryFileExtension[] = ".bin";
+
+    PersistentCache::PersistentCache(AZ::IO::Path cacheFolder, u64 cacheSize, u64 maxEntrySize, u32 alignment)
+        : StreamStackEntry("Persistent cache")
+        , m_cacheFolder(AZStd::move(cacheFolder))
+        , m_cacheSize(cacheSize)
+        , m_maxEntrySize(AZStd::min(maxEntrySize, cacheSize))
+        , m_alignment(alignment)
+    {
+        AZ_Assert(IStreamerTypes::IsPowerOf2(alignment), "Alignment needs to be a power of 2.");
+        LoadIndex();
+        RemoveUnindexedFiles();
+    }
+
+    PersistentCache::~PersistentCache()
+    {
+        AZ_Assert(m_pendingHits.empty() && m_pendingFills.empty(), "The persistent cache was destroyed while reads were still pending.");
+        SaveIndex();
+    }
+
+    void PersistentCache::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (auto data = AZStd::get_if<Requests::ReadRequestData>(&request->GetCommand()); data != nullptr)
+        {
+            PrepareReadRequest(request, *data);
+            return;
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void PersistentCache::QueueRequest(FileRequest* request)
+    {
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+        request->RecordTraceStage(m_name.c_str());
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::CancelData>)
+            {
+                CancelRequest(request, args.m_target);
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushData>)
+            {
+                FlushCache(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushAllData>)
+            {
+                FlushEntireCache();
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::ReportData>)
+            {
+                Report(args);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool PersistentCache::ExecuteRequests()
+    {
+        bool processed = false;
+        for (auto it = m_pendingFills.begin(); it != m_pendingFills.end();)
+        {
+            if (it->m_fill == nullptr)
+            {
+                CompleteFill(*it);
+                it = m_pendingFills.erase(it);
+                processed = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Cached reads are done synchronously, so only do one per tick to give the rest of the stack a chance to keep busy.
+        if (!m_pendingHits.empty())
+        {
+            PendingRead pending = AZStd::move(m_pendingHits.front());
+            m_pendingHits.pop_front();
+            ReadFromCache(pending);
+            processed = true;
+        }
+
+        bool nextResult = StreamStackEntry::ExecuteRequests();
+        return nextResult || processed;
+    }
+
+    void PersistentCache::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        status.m_isIdle = status.m_isIdle && m_pendingHits.empty() && m_pendingFills.empty();
+    }
+
+    void PersistentCache::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        statistics.push_back(Statistic::CreatePercentage(
+            m_name, CacheHitRateName, m_hitRateStat.GetAverage(),
+            "The percentage of cacheable reads that were serviced from the cache on disk. A low value after the first run indicates "
+            "that the cache is too small for the working set or files are frequently flushed."));
+        statistics.push_back(Statistic::CreateByteSize(
+            m_name, "Used cache size", m_usedCacheSize, "The amount of data that's currently stored in the cache."));
+        statistics.push_back(Statistic::CreateInteger(
+            m_name, "Cache entry count", aznumeric_cast<s64>(m_entries.size()), "The number of reads that are stored in the cache."));
+
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    bool PersistentCache::SaveIndex() const
+    {
+        AZ::IO::Path tempPath = m_cacheFolder / IndexTempFileName;
+        SystemFile file;
+        if (!file.Open(tempPath.c_str(),
+            SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH | SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Streamer", false, "Unable to write the index for the persistent cache to '%s'.", tempPath.c_str());
+            return false;
+        }
+
+        // The index is written to a temporary file first and then moved in place, so an interrupted write can't leave a partial index.
+        AZStd::vector<u8> buffer;
+        auto append = [&buffer](const void* data, size_t size)
+        {
+            const u8* bytes = reinterpret_cast<const u8*>(data);
+            buffer.insert(buffer.end(), bytes, bytes + size);
+        };
+        const u32 entryCount = aznumeric_cast<u32>(m_entries.size());
+        append(&IndexMagic, sizeof(IndexMagic));
+        append(&IndexVersion, sizeof(IndexVersion));
+        append(&m_useCounter, sizeof(m_useCounter));
+        append(&m_nextFileId, sizeof(m_nextFileId));
+        append(&entryCount, sizeof(entryCount));
+        for (const auto& [path, entry] : m_entries)
+        {
+            const u32 pathLength = aznumeric_cast<u32>(path.size());
+            append(&entry.m_source.m_size, sizeof(entry.m_source.m_size));
+            append(&entry.m_source.m_modificationTime, sizeof(entry.m_source.m_modificationTime));
+            append(&entry.m_offset, sizeof(entry.m_offset));
+            append(&entry.m_size, sizeof(entry.m_size));
+            append(&entry.m_lastUsed, sizeof(entry.m_lastUsed));
+            append(&entry.m_fileId, sizeof(entry.m_fileId));
+            append(&pathLength, sizeof(pathLength));
+            append(path.data(), path.size());
+        }
+
+        const bool written = file.Write(buffer.data(), buffer.size()) == buffer.size();
+        file.Close();
+        if (!written)
+        {
+            SystemFile::Delete(tempPath.c_str());
+            return false;
+        }
+        return SystemFile::Rename(tempPath.c_str(), (m_cacheFolder / IndexFileName).c_str(), true);
+    }
+
+    void PersistentCache::FlushCache(const RequestPath& filePath)
+    {
+        AZStd::string path(filePath.GetRelativePath().Native());
+        auto [begin, end] = m_entries.equal_range(path);
+        for (auto it = begin; it != end;)
+        {
+            auto next = AZStd::next(it);
+            RemoveFromCache(it);
+            it = next;
+        }
+        // The file is checked again on its next read, and fills that are in flight may hold the data from before the flush.
+        m_sourceStamps.erase(path);
+        ++m_flushGeneration;
+    }
+
+    void PersistentCache::FlushEntireCache()
+    {
+        while (!m_entries.empty())
+        {
+            RemoveFromCache(m_entries.begin());
+        }
+        m_sourceStamps.clear();
+        ++m_flushGeneration;
+        SaveIndex();
+    }
+
+    u64 PersistentCache::GetUsedCacheSize() const
+    {
+        return m_usedCacheSize;
+    }
+
+    size_t PersistentCache::GetNumCacheEntries() const
+    {
+        return m_entries.size();
+    }
+
+    void PersistentCache::PrepareReadRequest(FileRequest* request, Requests::ReadRequestData& data)
+    {
+        if (data.m_size == 0 || data.m_size > m_maxEntrySize)
+        {
+            StreamStackEntry::PrepareRequest(request);
+            return;
+        }
+
+        PendingRead pending;
+        pending.m_path = data.m_path.GetRelativePath().Native();
+        if (!GetSourceStamp(data.m_path, pending.m_path, pending.m_source))
+        {
+            StreamStackEntry::PrepareRequest(request);
+            return;
+        }
+
+        pending.m_request = request;
+        pending.m_offset = data.m_offset;
+        pending.m_size = data.m_size;
+        // The original request is held back by a wait until the data has been delivered by this node. This allows the data to be
+        // read into a buffer this node controls on a cache miss, so it can be stored in the cache before it's handed off.
+        pending.m_wait = m_context->GetNewInternalRequest();
+        pending.m_wait->CreateWait(request);
+
+        if (auto entry = FindInCache(pending.m_path, pending.m_source, pending.m_offset, pending.m_size); entry != m_entries.end())
+        {
+            m_hitRateStat.PushSample(1.0);
+            entry->second.m_lastUsed = ++m_useCounter;
+            m_pendingHits.push_back(AZStd::move(pending));
+        }
+        else
+        {
+            m_hitRateStat.PushSample(0.0);
+            StartFill(pending);
+        }
+    }
+
+    void PersistentCache::StartFill(PendingRead& pending)
+    {
+        auto& data = AZStd::get<Requests::ReadRequestData>(pending.m_request->GetCommand());
+
+        pending.m_fillBuffer = reinterpret_cast<u8*>(
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(pending.m_size, m_alignment));
+
+        // The fill is a separate request so the rest of the stack doesn't need to know about this node. It inherits the deadline and
+        // priority of the original request to be scheduled the same.
+        FileRequest* fill = m_context->GetNewInternalRequest();
+        fill->CreateReadRequest(data.m_path, pending.m_fillBuffer, pending.m_size, pending.m_offset, pending.m_size,
+            data.m_deadline, data.m_priority);
+        fill->SetCompletionCallback([this](FileRequest& request)
+            {
+                AZ_PROFILE_FUNCTION(AzCore);
+                for (PendingRead& fillRead : m_pendingFills)
+                {
+                    if (fillRead.m_fill == &request)
+                    {
+                        fillRead.m_fillStatus = request.GetStatus();
+                        // The request is recycled after the callback, so don't hold on to it.
+                        fillRead.m_fill = nullptr;
+                        return;
+                    }
+                }
+                AZ_Assert(false, "A read for the persistent cache completed, but it wasn't registered.");
+            });
+        pending.m_fill = fill;
+        pending.m_flushGeneration = m_flushGeneration;
+        m_pendingFills.push_back(AZStd::move(pending));
+
+        StreamStackEntry::PrepareRequest(fill);
+    }
+
+    void PersistentCache::ReadFromCache(PendingRead& pending)
+    {
+        if (pending.m_request == nullptr)
+        {
+            // Canceled before the data could be retrieved.
+            return;
+        }
+
+        // The entry could have been evicted after the request was prepared, in which case the data is retrieved from the next node.
+        auto entry = FindInCache(pending.m_path, pending.m_source, pending.m_offset, pending.m_size);
+        if (entry == m_entries.end())
+        {
+            StartFill(pending);
+            return;
+        }
+
+        auto& data = AZStd::get<Requests::ReadRequestData>(pending.m_request->GetCommand());
+        if (!AssignOutput(data))
+        {
+            FinishPendingRead(pending, IStreamerTypes::RequestStatus::Failed);
+            return;
+        }
+
+        AZ::IO::Path entryPath = GetEntryPath(entry->second.m_fileId);
+        SystemFile::SizeType bytesRead = SystemFile::Read(entryPath.c_str(), data.m_output, pending.m_size,
+            pending.m_offset - entry->second.m_offset);
+        if (bytesRead == pending.m_size)
+        {
+            FinishPendingRead(pending, IStreamerTypes::RequestStatus::Completed);
+        }
+        else
+        {
+            AZ_Warning("Streamer", false, "Unable to read '%s' from the persistent cache. The data will be read from its source instead.",
+                pending.m_path.c_str());
+            RemoveFromCache(entry);
+            StartFill(pending);
+        }
+    }
+
+    void PersistentCache::CompleteFill(PendingRead& pending)
+    {
+        if (pending.m_fillStatus == IStreamerTypes::RequestStatus::Completed)
+        {
+            // The file may have changed if it was flushed while the data was being read, so only the request gets the data.
+            if (pending.m_flushGeneration == m_flushGeneration)
+            {
+                AddToCache(pending.m_path, pending.m_source, pending.m_offset, pending.m_size, pending.m_fillBuffer);
+            }
+            if (pending.m_request != nullptr)
+            {
+                auto& data = AZStd::get<Requests::ReadRequestData>(pending.m_request->GetCommand());
+                if (AssignOutput(data))
+                {
+                    memcpy(data.m_output, pending.m_fillBuffer, pending.m_size);
+                    FinishPendingRead(pending, IStreamerTypes::RequestStatus::Completed);
+                }
+                else
+                {
+                    FinishPendingRead(pending, IStreamerTypes::RequestStatus::Failed);
+                }
+            }
+        }
+        else if (pending.m_request != nullptr)
+        {
+            FinishPendingRead(pending, pending.m_fillStatus);
+        }
+        ReleaseFillBuffer(pending);
+    }
+
+    void PersistentCache::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        auto cancel = [this, &target](PendingRead& pending)
+        {
+            if (pending.m_request != nullptr && pending.m_wait->WorksOn(target))
+            {
+                // Fills continue as the data can still be added to the cache, but the original request no longer waits for it.
+                FinishPendingRead(pending, IStreamerTypes::RequestStatus::Canceled);
+            }
+        };
+        AZStd::for_each(m_pendingHits.begin(), m_pendingHits.end(), cancel);
+        AZStd::for_each(m_pendingFills.begin(), m_pendingFills.end(), cancel);
+        cancelRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+    }
+
+    bool PersistentCache::AssignOutput(Requests::ReadRequestData& data)
+    {
+        if (data.m_output != nullptr)
+        {
+            return true;
+        }
+
+        AZ_Assert(data.m_allocator, "The read request was issued without a memory allocator or valid output address.");
+        IStreamerTypes::RequestMemoryAllocatorResult allocation = data.m_allocator->Allocate(data.m_size, data.m_size, m_alignment);
+        if (allocation.m_address == nullptr || allocation.m_size < data.m_size)
+        {
+            return false;
+        }
+        data.m_output = allocation.m_address;
+        data.m_outputSize = allocation.m_size;
+        data.m_memoryType = allocation.m_type;
+        return true;
+    }
+
+    void PersistentCache::FinishPendingRead(PendingRead& pending, IStreamerTypes::RequestStatus status)
+    {
+        pending.m_wait->SetStatus(status);
+        m_context->MarkRequestAsCompleted(pending.m_wait);
+        pending.m_wait = nullptr;
+        pending.m_request = nullptr;
+    }
+
+    void PersistentCache::ReleaseFillBuffer(PendingRead& pending)
+    {
+        if (pending.m_fillBuffer != nullptr)
+        {
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(pending.m_fillBuffer, pending.m_size, m_alignment);
+            pending.m_fillBuffer = nullptr;
+        }
+    }
+
+    bool PersistentCache::GetSourceStamp(const RequestPath& filePath, const AZStd::string& path, SourceStamp& stamp)
+    {
+        if (auto it = m_sourceStamps.find(path); it != m_sourceStamps.end())
+        {
+            stamp = it->second;
+            return true;
+        }
+
+        const char* absolutePath = filePath.GetAbsolutePathCStr();
+        if (!SystemFile::Exists(absolutePath))
+        {
+            return false;
+        }
+        stamp.m_size = SystemFile::Length(absolutePath);
+        stamp.m_modificationTime = SystemFile::ModificationTime(absolutePath);
+        m_sourceStamps.emplace(path, stamp);
+
+        // Data that was cached before the file was changed, for instance by an asset rebuild in between runs, is no longer valid.
+        auto [begin, end] = m_entries.equal_range(path);
+        for (auto it = begin; it != end;)
+        {
+            auto next = AZStd::next(it);
+            if (it->second.m_source != stamp)
+            {
+                RemoveFromCache(it);
+            }
+            it = next;
+        }
+        return true;
+    }
+
+    PersistentCache::CacheEntries::iterator PersistentCache::FindInCache(
+        const AZStd::string& path, const SourceStamp& source, u64 offset, u64 size)
+    {
+        auto [begin, end] = m_entries.equal_range(path);
+        for (auto it = begin; it != end; ++it)
+        {
+            const CacheEntry& entry = it->second;
+            if (entry.m_source == source && entry.m_offset <= offset && offset + size <= entry.m_offset + entry.m_size)
+            {
+                return it;
+            }
+        }
+        return m_entries.end();
+    }
+
+    void PersistentCache::AddToCache(const AZStd::string& path, const SourceStamp& source, u64 offset, u64 size, const void* data)
+    {
+        if (size > m_maxEntrySize || FindInCache(path, source, offset, size) != m_entries.end())
+        {
+            return;
+        }
+
+        while (m_usedCacheSize + size > m_cacheSize)
+        {
+            if (!EvictOldestEntry())
+            {
+                return;
+            }
+        }
+
+        CacheEntry entry;
+        entry.m_source = source;
+        entry.m_offset = offset;
+        entry.m_size = size;
+        entry.m_lastUsed = ++m_useCounter;
+        entry.m_fileId = m_nextFileId++;
+
+        AZ::IO::Path entryPath = GetEntryPath(entry.m_fileId);
+        SystemFile file;
+        if (!file.Open(entryPath.c_str(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH | SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Streamer", false, "Unable to create '%s' for the persistent cache.", entryPath.c_str());
+            return;
+        }
+        const bool written = file.Write(data, size) == size;
+        file.Close();
+        if (!written)
+        {
+            SystemFile::Delete(entryPath.c_str());
+            return;
+        }
+
+        m_entries.emplace(path, entry);
+        m_usedCacheSize += size;
+    }
+
+    void PersistentCache::RemoveFromCache(CacheEntries::iterator entry)
+    {
+        SystemFile::Delete(GetEntryPath(entry->second.m_fileId).c_str());
+        m_usedCacheSize -= entry->second.m_size;
+        m_entries.erase(entry);
+    }
+
+    bool PersistentCache::EvictOldestEntry()
+    {
+        if (m_entries.empty())
+        {
+            return false;
+        }
+
+        auto oldest = m_entries.begin();
+        for (auto it = AZStd::next(oldest); it != m_entries.end(); ++it)
+        {
+            if (it->second.m_lastUsed < oldest->second.m_lastUsed)
+            {
+                oldest = it;
+            }
+        }
+        RemoveFromCache(oldest);
+        return true;
+    }
+
+    AZ::IO::Path PersistentCache::GetEntryPath(u32 fileId) const
+    {
+        return m_cacheFolder / AZStd::fixed_string<16>::format("%08x%s", fileId, EntryFileExtension);
+    }
+
+    void PersistentCache::LoadIndex()
+    {
+        AZ::IO::Path indexPath = m_cacheFolder / IndexFileName;
+        if (!SystemFile::Exists(indexPath.c_str()))
+        {
+            return;
+        }
+
+        AZStd::vector<u8> buffer(SystemFile::Length(indexPath.c_str()));
+        if (buffer.empty() || SystemFile::Read(indexPath.c_str(), buffer.data(), buffer.size()) != buffer.size())
+        {
+            AZ_Warning("Streamer", false, "Unable to read the index for the persistent cache at '%s'.", indexPath.c_str());
+            return;
+        }
+
+        size_t cursor = 0;
+        auto read = [&buffer, &cursor](void* target, size_t size) -> bool
+        {
+            if (cursor + size > buffer.size())
+            {
+                return false;
+            }
+            memcpy(target, buffer.data() + cursor, size);
+            cursor += size;
+            return true;
+        };
+
+        u32 magic = 0;
+        u32 version = 0;
+        u32 entryCount = 0;
+        if (!read(&magic, sizeof(magic)) || magic != IndexMagic || !read(&version, sizeof(version)) || version != IndexVersion ||
+            !read(&m_useCounter, sizeof(m_useCounter)) || !read(&m_nextFileId, sizeof(m_nextFileId)) ||
+            !read(&entryCount, sizeof(entryCount)))
+        {
+            AZ_Warning("Streamer", false, "The index for the persistent cache at '%s' isn't recognized and will be discarded.",
+                indexPath.c_str());
+            m_useCounter = 0;
+            m_nextFileId = 0;
+            return;
+        }
+
+        for (u32 i = 0; i < entryCount; ++i)
+        {
+            CacheEntry entry;
+            u32 pathLength = 0;
+            if (!read(&entry.m_source.m_size, sizeof(entry.m_source.m_size)) ||
+                !read(&entry.m_source.m_modificationTime, sizeof(entry.m_source.m_modificationTime)) ||
+                !read(&entry.m_offset, sizeof(entry.m_offset)) || !read(&entry.m_size, sizeof(entry.m_size)) ||
+                !read(&entry.m_lastUsed, sizeof(entry.m_lastUsed)) || !read(&entry.m_fileId, sizeof(entry.m_fileId)) ||
+                !read(&pathLength, sizeof(pathLength)) || cursor + pathLength > buffer.size())
+            {
+                AZ_Warning("Streamer", false, "The index for the persistent cache at '%s' is truncated.", indexPath.c_str());
+                break;
+            }
+            AZStd::string path(reinterpret_cast<const char*>(buffer.data() + cursor), pathLength);
+            cursor += pathLength;
+
+            // Entries from a larger cache are dropped once the cache is full. They're stored from most to least
+            // recently added, so this mostly keeps the newest data.
+            if (entry.m_size <= m_maxEntrySize && m_usedCacheSize + entry.m_size <= m_cacheSize)
+            {
+                m_usedCacheSize += entry.m_size;
+                m_entries.emplace(AZStd::move(path), entry);
+            }
+        }
+    }
+
+    void PersistentCache::RemoveUnindexedFiles()
+    {
+        // Files can be left behind if the application didn't shut down cleanly or the cache got smaller. These are removed
+        // so the cache folder doesn't grow beyond the configured size.
+        AZStd::unordered_set<u32> indexedFiles;
+        for (const auto& [path, entry] : m_entries)
+        {
+            indexedFiles.insert(entry.m_fileId);
+        }
+
+        AZStd::vector<AZStd::fixed_string<16>> unindexedFiles;
+        AZ::IO::Path filter = m_cacheFolder / AZStd::fixed_string<16>::format("*%s", EntryFileExtension);
+        SystemFile::FindFiles(filter.c_str(), [&indexedFiles, &unindexedFiles](const char* fileName, bool isFile)
+            {
+                unsigned int fileId = 0;
+                if (isFile && (sscanf(fileName, "%08x", &fileId) != 1 || !indexedFiles.contains(fileId)))
+                {
+                    unindexedFiles.emplace_back(fileName);
+                }
+                return true;
+            });
+        for (const auto& fileName : unindexedFiles)
+        {
+            SystemFile::Delete((m_cacheFolder / fileName).c_str());
+        }
+    }
+
+    void PersistentCache::Report(const Requests::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case IStreamerTypes::ReportType::Config:
+            data.m_output.push_back(Statistic::CreatePersistentString(
+                m_name, "Cache folder", m_cacheFolder.Native(), "The folder on disk where the cached data is stored."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Cache size", m_cacheSize,
+                "The maximum amount of data stored on disk. When this limit is reached the least recently used data is removed."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Max entry size", m_maxEntrySize,
+                "The largest read that will be stored in the cache. Larger reads are passed on to the next node unchanged."));
+            data.m_output.push_back(Statistic::CreateReferenceString(
+                m_name, "Next node", m_next ? AZStd::string_view(m_next->GetName()) : AZStd::string_view("<None>"),
+                "The name of the node that follows this node or none."));
+            break;
+        default:
+            break;
+        };
+    }
+} // namespace AZ::IO
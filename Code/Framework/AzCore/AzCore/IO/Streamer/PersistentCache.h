@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO
+{
+    class RequestPath;
+    namespace Requests
+    {
+        struct ReadRequestData;
+        struct ReportData;
+    }
+
+    struct PersistentCacheConfig final :
+        public IStreamerStackConfig
+    {
+        AZ_RTTI(AZ::IO::PersistentCacheConfig, "{5C1E7A0B-8D5B-4C8E-9F3A-2B6E1D4F7A90}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(PersistentCacheConfig, AZ::SystemAllocator);
+
+        ~PersistentCacheConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! The folder that stores the cached data. Aliases such as @user@ are resolved.
+        AZStd::string m_cacheFolder{ "@user@/Streamer/PersistentCache" };
+        //! The maximum amount of data kept on disk in megabytes. The least recently used data is removed first when the limit is reached.
+        u32 m_cacheSizeMib{ 1024 };
+        //! Reads that are larger than this will not be stored in the cache, in megabytes.
+        u32 m_maxEntrySizeMib{ 64 };
+    };
+
+    //! Entry in the streaming stack that keeps the data from read requests in a folder on disk so it's still available in
+    //! later runs. Placed above nodes such as FullFileDecompressor or a remote storage drive it stores the final data, so
+    //! repeated reads skip decompression and network transfers.
+    //! The cache is keyed on the file path and read range. Each entry also stores the size and modification time of its source
+    //! file, and entries that no longer match the source file are discarded, so data cached before assets were rebuilt isn't
+    //! used. Source files are checked on their first read in a run, after that flush requests report changes to them.
+    //! Reads of files that don't exist on disk, and so can't be checked, are passed on to the next node without caching.
+    //! Cached reads are read from disk synchronously on the streaming thread, similar to the generic StorageDrive, so the
+    //! cache folder should be on local storage.
+    class PersistentCache
+        : public StreamStackEntry
+    {
+    public:
+        PersistentCache(AZ::IO::Path cacheFolder, u64 cacheSize, u64 maxEntrySize, u32 alignment);
+        PersistentCache(PersistentCache&& rhs) = delete;
+        PersistentCache(const PersistentCache& rhs) = delete;
+        ~PersistentCache() override;
+
+        PersistentCache& operator=(PersistentCache&& rhs) = delete;
+        PersistentCache& operator=(const PersistentCache& rhs) = delete;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+        //! Writes the index of the cache to disk. This is automatically done when the cache is destroyed.
+        bool SaveIndex() const;
+
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        u64 GetUsedCacheSize() const;
+        size_t GetNumCacheEntries() const;
+
+    protected:
+        inline static constexpr u32 IndexMagic = 0x43505A41; // "AZPC"
+        inline static constexpr u32 IndexVersion = 2;
+
+        //! Size and modification time of a source file, used to detect that the file changed after its data was cached.
+        struct SourceStamp
+        {
+            bool operator==(const SourceStamp& rhs) const
+            {
+                return m_size == rhs.m_size && m_modificationTime == rhs.m_modificationTime;
+            }
+            bool operator!=(const SourceStamp& rhs) const
+            {
+                return !(*this == rhs);
+            }
+
+            u64 m_size{ 0 };
+            u64 m_modificationTime{ 0 };
+        };
+
+        struct CacheEntry
+        {
+            SourceStamp m_source; //!< The source file at the time the data was cached.
+            u64 m_offset{ 0 }; //!< Offset into the source file where the cached data starts.
+            u64 m_size{ 0 }; //!< The number of cached bytes.
+            u64 m_lastUsed{ 0 }; //!< Value of the use counter when the entry was last read from or written to.
+            u32 m_fileId{ 0 }; //!< Id used to construct the name of the file holding the data.
+        };
+        using CacheEntries = AZStd::unordered_multimap<AZStd::string, CacheEntry>;
+
+        //! A read that's waiting on its data to be read from the cache or the rest of the stack.
+        struct PendingRead
+        {
+            FileRequest* m_request{ nullptr }; //!< The original read request. This is null if the request has been canceled.
+            FileRequest* m_wait{ nullptr }; //!< Wait that keeps the original request from completing until the data has been delivered.
+            FileRequest* m_fill{ nullptr }; //!< Internal read request used to retrieve the data from the next node on a cache miss.
+            u8* m_fillBuffer{ nullptr }; //!< Buffer the data for a cache miss is read into before it's stored and delivered.
+            AZStd::string m_path; //!< Key the read is stored under.
+            SourceStamp m_source; //!< The source file when the read was prepared.
+            u64 m_offset{ 0 };
+            u64 m_size{ 0 };
+            //! Value of m_flushGeneration when the fill was started. Data from fills started before a flush isn't cached.
+            u64 m_flushGeneration{ 0 };
+            //! Result of the fill. Only valid after m_fill has been cleared by its completion callback.
+            IStreamerTypes::RequestStatus m_fillStatus{ IStreamerTypes::RequestStatus::Pending };
+        };
+
+        void PrepareReadRequest(FileRequest* request, Requests::ReadRequestData& data);
+        void StartFill(PendingRead& pending);
+        void ReadFromCache(PendingRead& pending);
+        void CompleteFill(PendingRead& pending);
+        void CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        bool AssignOutput(Requests::ReadRequestData& data);
+        void FinishPendingRead(PendingRead& pending, IStreamerTypes::RequestStatus status);
+        void ReleaseFillBuffer(PendingRead& pending);
+
+        bool GetSourceStamp(const RequestPath& filePath, const AZStd::string& path, SourceStamp& stamp);
+        CacheEntries::iterator FindInCache(const AZStd::string& path, const SourceStamp& source, u64 offset, u64 size);
+        void AddToCache(const AZStd::string& path, const SourceStamp& source, u64 offset, u64 size, const void* data);
+        void RemoveFromCache(CacheEntries::iterator entry);
+        bool EvictOldestEntry();
+
+        AZ::IO::Path GetEntryPath(u32 fileId) const;
+        void LoadIndex();
+        void RemoveUnindexedFiles();
+
+        void Report(const Requests::ReportData& data) const;
+
+        CacheEntries m_entries;
+        //! Stamps of the source files read during this run, so each file is only checked on disk once. Cleared by flushes.
+        AZStd::unordered_map<AZStd::string, SourceStamp> m_sourceStamps;
+        //! Reads that are waiting to be serviced from the cache.
+        AZStd::deque<PendingRead> m_pendingHits;
+        //! Reads that are waiting on the next node to read the data.
+        AZStd::deque<PendingRead> m_pendingFills;
+
+        AZ::Statistics::RunningStatistic m_hitRateStat;
+
+        AZ::IO::Path m_cacheFolder;
+        u64 m_cacheSize;
+        u64 m_maxEntrySize;
+        u64 m_usedCacheSize{ 0 };
+        u64 m_useCounter{ 0 };
+        //! Incremented by every flush.
+        u64 m_flushGeneration{ 0 };
+        u32 m_alignment;
+        u32 m_nextFileId{ 0 };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,645 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/Prefetcher.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> PrefetcherConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        FileIOBase* fileIO = FileIOBase::GetInstance();
+        AZStd::optional<AZ::IO::FixedMaxPath> manifestFolder =
+            fileIO ? fileIO->ResolvePath(AZ::IO::PathView(m_manifestFolder)) : AZStd::nullopt;
+        if (!manifestFolder)
+        {
+            AZ_Warning("Streamer", false, "Unable to resolve the folder '%s' for the prefetch manifests. Prefetching will not be used.",
+                m_manifestFolder.c_str());
+            return parent;
+        }
+
+        Prefetcher::Settings settings;
+        settings.m_maxMemory = m_maxMemoryMib * 1_mib;
+        settings.m_maxGap = m_maxGapKib * 1_kib;
+        settings.m_maxCombinedReadSize = m_maxCombinedReadSizeMib * 1_mib;
+        settings.m_maxPendingPrefetches = m_maxPendingPrefetches;
+        settings.m_alignment = aznumeric_cast<u32>(hardware.m_maxPhysicalSectorSize);
+
+        auto stackEntry = AZStd::make_shared<Prefetcher>(AZ::IO::Path(manifestFolder->Native()), settings);
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void PrefetcherConfig::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<PrefetcherConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("ManifestFolder", &PrefetcherConfig::m_manifestFolder)
+                ->Field("MaxMemoryMib", &PrefetcherConfig::m_maxMemoryMib)
+                ->Field("MaxGapKib", &PrefetcherConfig::m_maxGapKib)
+                ->Field("MaxCombinedReadSizeMib", &PrefetcherConfig::m_maxCombinedReadSizeMib)
+                ->Field("MaxPendingPrefetches", &PrefetcherConfig::m_maxPendingPrefetches);
+        }
+    }
+
+    static constexpr char PrefetchHitRateName[] = "Prefetch hit rate";
+    static constexpr char ManifestFileExtension[] = ".prefetch";
+    static constexpr char ManifestTempFileExtension[] = ".prefetch.tmp";
+
+    Prefetcher::Prefetcher(AZ::IO::Path manifestFolder, const Settings& settings)
+        : StreamStackEntry("Prefetcher")
+        , m_manifestFolder(AZStd::move(manifestFolder))
+        , m_settings(settings)
+    {
+        AZ_Assert(IStreamerTypes::IsPowerOf2(m_settings.m_alignment), "Alignment needs to be a power of 2.");
+        m_settings.m_maxCombinedReadSize = AZStd::min(m_settings.m_maxCombinedReadSize, m_settings.m_maxMemory);
+        m_settings.m_maxPendingPrefetches = AZStd::max(m_settings.m_maxPendingPrefetches, 1u);
+    }
+
+    Prefetcher::~Prefetcher()
+    {
+        AZ_Assert(m_pendingPrefetches == 0, "The prefetcher was destroyed while prefetches were still pending.");
+        if (m_sessionActive)
+        {
+            EndSession();
+        }
+        ReleaseAllBlocks();
+    }
+
+    void Prefetcher::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (auto data = AZStd::get_if<Requests::ReadRequestData>(&request->GetCommand()); data != nullptr)
+        {
+            PrepareReadRequest(request, *data);
+            return;
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void Prefetcher::QueueRequest(FileRequest* request)
+    {
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+        request->RecordTraceStage(m_name.c_str());
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::CustomData>)
+            {
+                if (QueueSessionCommand(request))
+                {
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushData>)
+            {
+                FlushCache(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushAllData>)
+            {
+                FlushEntireCache();
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::ReportData>)
+            {
+                Report(args);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool Prefetcher::ExecuteRequests()
+    {
+        bool started = StartPrefetches();
+        bool nextResult = StreamStackEntry::ExecuteRequests();
+        return nextResult || started;
+    }
+
+    void Prefetcher::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        status.m_isIdle = status.m_isIdle && m_pendingPrefetches == 0 && !CanStartPrefetch();
+    }
+
+    void Prefetcher::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        statistics.push_back(Statistic::CreatePercentage(
+            m_name, PrefetchHitRateName, m_hitRateStat.GetAverage(),
+            "The percentage of reads during a replayed session that were serviced from prefetched data. A low value means that "
+            "the reads no longer match the recorded manifest or that the prefetches can't keep ahead of demand."));
+        statistics.push_back(Statistic::CreateByteSize(
+            m_name, "Used memory", m_usedMemory, "The amount of memory that's used by prefetched and pending data."));
+        statistics.push_back(Statistic::CreateByteSize(
+            m_name, "Prefetched data", m_prefetchedBytes, "The total amount of data that has been prefetched."));
+
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void Prefetcher::BeginSession(AZStd::string_view name)
+    {
+        if (m_sessionActive)
+        {
+            EndSession();
+        }
+
+        m_sessionName = name;
+        m_sessionActive = true;
+        m_nextBlock = m_blocks.size();
+
+        AZStd::vector<RecordedRead> reads;
+        AZ::IO::Path manifestPath = GetManifestPath(m_sessionName);
+        if (SystemFile::Exists(manifestPath.c_str()) && LoadManifest(manifestPath, reads))
+        {
+            PlanBlocks(reads);
+        }
+    }
+
+    void Prefetcher::EndSession()
+    {
+        if (!m_sessionActive)
+        {
+            return;
+        }
+
+        if (!m_recordedReads.empty())
+        {
+            SaveManifest(GetManifestPath(m_sessionName), m_recordedReads);
+        }
+        m_recordedReads.clear();
+        m_sessionActive = false;
+
+        // Blocks that are still being read are released when their read completes.
+        for (Block& block : m_blocks)
+        {
+            block.m_remainingUses = 0;
+            if (block.m_state != Block::State::Pending)
+            {
+                ReleaseBlock(block);
+            }
+        }
+        if (m_pendingPrefetches == 0)
+        {
+            m_blocks.clear();
+            m_blocksByPath.clear();
+        }
+        m_nextBlock = m_blocks.size();
+    }
+
+    bool Prefetcher::IsSessionActive() const
+    {
+        return m_sessionActive;
+    }
+
+    void Prefetcher::FlushCache(const RequestPath& filePath)
+    {
+        auto it = m_blocksByPath.find(AZStd::string(filePath.GetRelativePath().Native()));
+        if (it != m_blocksByPath.end())
+        {
+            for (size_t index : it->second)
+            {
+                Block& block = m_blocks[index];
+                // Pending reads could return outdated data so are released once they complete.
+                block.m_remainingUses = 0;
+                if (block.m_state != Block::State::Pending)
+                {
+                    ReleaseBlock(block);
+                }
+            }
+        }
+    }
+
+    void Prefetcher::FlushEntireCache()
+    {
+        for (Block& block : m_blocks)
+        {
+            block.m_remainingUses = 0;
+            if (block.m_state != Block::State::Pending)
+            {
+                ReleaseBlock(block);
+            }
+        }
+    }
+
+    size_t Prefetcher::GetNumPlannedPrefetches() const
+    {
+        return AZStd::count_if(m_blocks.begin(), m_blocks.end(),
+            [](const Block& block) { return block.m_state != Block::State::Released; });
+    }
+
+    u64 Prefetcher::GetUsedMemory() const
+    {
+        return m_usedMemory;
+    }
+
+    void Prefetcher::PrepareReadRequest(FileRequest* request, Requests::ReadRequestData& data)
+    {
+        if (data.m_size == 0)
+        {
+            StreamStackEntry::PrepareRequest(request);
+            return;
+        }
+
+        AZStd::string path(data.m_path.GetRelativePath().Native());
+        if (m_sessionActive && m_recordedReads.size() < MaxRecordedReads)
+        {
+            m_recordedReads.push_back(RecordedRead{ path, data.m_offset, data.m_size });
+        }
+
+        if (Block* block = FindBlock(path, data.m_offset, data.m_size); block != nullptr)
+        {
+            if (block->m_state == Block::State::Available)
+            {
+                m_hitRateStat.PushSample(1.0);
+                ServeHit(request, data, *block);
+                return;
+            }
+            // Demand has caught up with the prefetches, so account for the read so data that's no longer needed
+            // isn't prefetched.
+            m_hitRateStat.PushSample(0.0);
+            ConsumeBlock(*block, data.m_size);
+        }
+        else if (!m_blocksByPath.empty())
+        {
+            m_hitRateStat.PushSample(0.0);
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    bool Prefetcher::QueueSessionCommand(FileRequest* request)
+    {
+        auto& data = AZStd::get<Requests::CustomData>(request->GetCommand());
+        const PrefetchSessionCommand* command = AZStd::any_cast<PrefetchSessionCommand>(&data.m_data);
+        if (command == nullptr)
+        {
+            return false;
+        }
+
+        switch (command->m_action)
+        {
+        case PrefetchSessionCommand::Action::Begin:
+            BeginSession(command->m_name);
+            break;
+        case PrefetchSessionCommand::Action::End:
+            EndSession();
+            break;
+        default:
+            AZ_Assert(false, "Unsupported prefetch session action %i.", aznumeric_cast<int>(command->m_action));
+            break;
+        }
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+        return true;
+    }
+
+    bool Prefetcher::CanStartPrefetch() const
+    {
+        return
+            m_sessionActive &&
+            m_nextBlock < m_blocks.size() &&
+            m_pendingPrefetches < m_settings.m_maxPendingPrefetches &&
+            m_usedMemory + m_blocks[m_nextBlock].m_size <= m_settings.m_maxMemory;
+    }
+
+    bool Prefetcher::StartPrefetches()
+    {
+        bool started = false;
+        while (true)
+        {
+            while (m_nextBlock < m_blocks.size() && m_blocks[m_nextBlock].m_state != Block::State::Planned)
+            {
+                ++m_nextBlock;
+            }
+            if (!CanStartPrefetch())
+            {
+                break;
+            }
+
+            size_t blockIndex = m_nextBlock++;
+            Block& block = m_blocks[blockIndex];
+            block.m_buffer = reinterpret_cast<u8*>(
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(block.m_size, m_settings.m_alignment));
+            block.m_state = Block::State::Pending;
+            m_usedMemory += block.m_size;
+            m_pendingPrefetches++;
+
+            // Prefetches are issued at the lowest priority and without a deadline so the scheduler always favors demand reads.
+            FileRequest* prefetch = m_context->GetNewInternalRequest();
+            prefetch->CreateReadRequest(block.m_path, block.m_buffer, block.m_size, block.m_offset, block.m_size,
+                FileRequest::s_noDeadlineTime, IStreamerTypes::s_priorityLowest);
+            prefetch->SetCompletionCallback([this, blockIndex](FileRequest& request)
+                {
+                    AZ_PROFILE_FUNCTION(AzCore);
+                    CompletePrefetch(blockIndex, request);
+                });
+            StreamStackEntry::PrepareRequest(prefetch);
+            started = true;
+        }
+        return started;
+    }
+
+    void Prefetcher::CompletePrefetch(size_t blockIndex, FileRequest& request)
+    {
+        AZ_Assert(m_pendingPrefetches > 0, "A prefetch completed, but there were no pending prefetches.");
+        m_pendingPrefetches--;
+
+        Block& block = m_blocks[blockIndex];
+        if (request.GetStatus() == IStreamerTypes::RequestStatus::Completed && m_sessionActive && block.m_remainingUses > 0)
+        {
+            block.m_state = Block::State::Available;
+            m_prefetchedBytes += block.m_size;
+        }
+        else
+        {
+            ReleaseBlock(block);
+        }
+
+        if (!m_sessionActive && m_pendingPrefetches == 0)
+        {
+            m_blocks.clear();
+            m_blocksByPath.clear();
+            m_nextBlock = 0;
+        }
+    }
+
+    void Prefetcher::ServeHit(FileRequest* request, Requests::ReadRequestData& data, Block& block)
+    {
+        if (AssignOutput(data))
+        {
+            memcpy(data.m_output, block.m_buffer + (data.m_offset - block.m_offset), data.m_size);
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        }
+        else
+        {
+            request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+        }
+        ConsumeBlock(block, data.m_size);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void Prefetcher::ConsumeBlock(Block& block, u64 size)
+    {
+        block.m_remainingUses -= AZStd::min(block.m_remainingUses, size);
+        if (block.m_remainingUses == 0 && block.m_state != Block::State::Pending)
+        {
+            ReleaseBlock(block);
+        }
+    }
+
+    bool Prefetcher::AssignOutput(Requests::ReadRequestData& data)
+    {
+        if (data.m_output != nullptr)
+        {
+            return true;
+        }
+
+        AZ_Assert(data.m_allocator, "The read request was issued without a memory allocator or valid output address.");
+        IStreamerTypes::RequestMemoryAllocatorResult allocation =
+            data.m_allocator->Allocate(data.m_size, data.m_size, m_settings.m_alignment);
+        if (allocation.m_address == nullptr || allocation.m_size < data.m_size)
+        {
+            return false;
+        }
+        data.m_output = allocation.m_address;
+        data.m_outputSize = allocation.m_size;
+        data.m_memoryType = allocation.m_type;
+        return true;
+    }
+
+    void Prefetcher::ReleaseBlock(Block& block)
+    {
+        if (block.m_buffer != nullptr)
+        {
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(block.m_buffer, block.m_size, m_settings.m_alignment);
+            block.m_buffer = nullptr;
+            m_usedMemory -= block.m_size;
+        }
+        block.m_state = Block::State::Released;
+    }
+
+    void Prefetcher::ReleaseAllBlocks()
+    {
+        for (Block& block : m_blocks)
+        {
+            ReleaseBlock(block);
+        }
+        m_blocks.clear();
+        m_blocksByPath.clear();
+        m_nextBlock = 0;
+    }
+
+    Prefetcher::Block* Prefetcher::FindBlock(const AZStd::string& path, u64 offset, u64 size)
+    {
+        auto it = m_blocksByPath.find(path);
+        if (it == m_blocksByPath.end())
+        {
+            return nullptr;
+        }
+
+        Block* result = nullptr;
+        for (size_t index : it->second)
+        {
+            Block& block = m_blocks[index];
+            if (block.m_state != Block::State::Released && block.m_offset <= offset && offset + size <= block.m_offset + block.m_size)
+            {
+                if (block.m_state == Block::State::Available)
+                {
+                    return &block;
+                }
+                result = result ? result : &block;
+            }
+        }
+        return result;
+    }
+
+    void Prefetcher::PlanBlocks(const AZStd::vector<RecordedRead>& reads)
+    {
+        const size_t firstNewBlock = m_blocks.size();
+        for (const RecordedRead& read : reads)
+        {
+            if (read.m_size == 0 || read.m_size > m_settings.m_maxMemory)
+            {
+                continue;
+            }
+
+            // Try to combine the read with one of the most recently planned blocks for the same file. Only a small window is
+            // checked to keep the order of the prefetches close to the recorded order.
+            bool combined = false;
+            const size_t windowStart = AZStd::max(firstNewBlock, m_blocks.size() - AZStd::min(m_blocks.size(), CombineWindow));
+            for (size_t i = m_blocks.size(); i > windowStart; --i)
+            {
+                Block& block = m_blocks[i - 1];
+                const u64 blockEnd = block.m_offset + block.m_size;
+                const u64 readEnd = read.m_offset + read.m_size;
+                if (block.m_path.GetRelativePath().Native() != read.m_path ||
+                    read.m_offset > blockEnd + m_settings.m_maxGap ||
+                    readEnd + m_settings.m_maxGap < block.m_offset)
+                {
+                    continue;
+                }
+
+                const u64 start = AZStd::min(block.m_offset, read.m_offset);
+                const u64 end = AZStd::max(blockEnd, readEnd);
+                if (end - start <= m_settings.m_maxCombinedReadSize)
+                {
+                    block.m_offset = start;
+                    block.m_size = end - start;
+                    block.m_remainingUses += read.m_size;
+                    combined = true;
+                    break;
+                }
+            }
+
+            if (!combined)
+            {
+                Block& block = m_blocks.emplace_back();
+                block.m_path = RequestPath(AZ::IO::PathView(read.m_path));
+                block.m_offset = read.m_offset;
+                block.m_size = read.m_size;
+                block.m_remainingUses = read.m_size;
+                m_blocksByPath[read.m_path].push_back(m_blocks.size() - 1);
+            }
+        }
+    }
+
+    AZ::IO::Path Prefetcher::GetManifestPath(AZStd::string_view name) const
+    {
+        return m_manifestFolder / AZStd::string::format("%.*s%s", AZ_STRING_ARG(name), ManifestFileExtension);
+    }
+
+    bool Prefetcher::LoadManifest(const AZ::IO::Path& path, AZStd::vector<RecordedRead>& reads) const
+    {
+        AZStd::vector<u8> buffer(SystemFile::Length(path.c_str()));
+        if (buffer.empty() || SystemFile::Read(path.c_str(), buffer.data(), buffer.size()) != buffer.size())
+        {
+            AZ_Warning("Streamer", false, "Unable to read the prefetch manifest '%s'.", path.c_str());
+            return false;
+        }
+
+        size_t cursor = 0;
+        auto read = [&buffer, &cursor](void* target, size_t size) -> bool
+        {
+            if (cursor + size > buffer.size())
+            {
+                return false;
+            }
+            memcpy(target, buffer.data() + cursor, size);
+            cursor += size;
+            return true;
+        };
+
+        u32 magic = 0;
+        u32 version = 0;
+        u32 readCount = 0;
+        if (!read(&magic, sizeof(magic)) || magic != ManifestMagic || !read(&version, sizeof(version)) || version != ManifestVersion ||
+            !read(&readCount, sizeof(readCount)))
+        {
+            AZ_Warning("Streamer", false, "The prefetch manifest '%s' isn't recognized and will be ignored.", path.c_str());
+            return false;
+        }
+
+        reads.reserve(AZStd::min(aznumeric_cast<size_t>(readCount), MaxRecordedReads));
+        for (u32 i = 0; i < readCount && reads.size() < MaxRecordedReads; ++i)
+        {
+            RecordedRead& entry = reads.emplace_back();
+            u32 pathLength = 0;
+            if (!read(&entry.m_offset, sizeof(entry.m_offset)) || !read(&entry.m_size, sizeof(entry.m_size)) ||
+                !read(&pathLength, sizeof(pathLength)) || cursor + pathLength > buffer.size())
+            {
+                AZ_Warning("Streamer", false, "The prefetch manifest '%s' is truncated.", path.c_str());
+                reads.pop_back();
+                break;
+            }
+            entry.m_path.assign(reinterpret_cast<const char*>(buffer.data() + cursor), pathLength);
+            cursor += pathLength;
+        }
+        return true;
+    }
+
+    bool Prefetcher::SaveManifest(const AZ::IO::Path& path, const AZStd::vector<RecordedRead>& reads) const
+    {
+        AZ::IO::Path tempPath = path;
+        tempPath.ReplaceExtension(ManifestTempFileExtension);
+        SystemFile file;
+        if (!file.Open(tempPath.c_str(),
+            SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH | SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Streamer", false, "Unable to write the prefetch manifest to '%s'.", tempPath.c_str());
+            return false;
+        }
+
+        // The manifest is written to a temporary file first and then moved in place, so an interrupted write can't
+        // leave a partial manifest.
+        AZStd::vector<u8> buffer;
+        auto append = [&buffer](const void* data, size_t size)
+        {
+            const u8* bytes = reinterpret_cast<const u8*>(data);
+            buffer.insert(buffer.end(), bytes, bytes + size);
+        };
+        const u32 readCount = aznumeric_cast<u32>(reads.size());
+        append(&ManifestMagic, sizeof(ManifestMagic));
+        append(&ManifestVersion, sizeof(ManifestVersion));
+        append(&readCount, sizeof(readCount));
+        for (const RecordedRead& read : reads)
+        {
+            const u32 pathLength = aznumeric_cast<u32>(read.m_path.size());
+            append(&read.m_offset, sizeof(read.m_offset));
+            append(&read.m_size, sizeof(read.m_size));
+            append(&pathLength, sizeof(pathLength));
+            append(read.m_path.data(), read.m_path.size());
+        }
+
+        const bool written = file.Write(buffer.data(), buffer.size()) == buffer.size();
+        file.Close();
+        if (!written)
+        {
+            SystemFile::Delete(tempPath.c_str());
+            return false;
+        }
+        return SystemFile::Rename(tempPath.c_str(), path.c_str(), true);
+    }
+
+    void Prefetcher::Report(const Requests::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case IStreamerTypes::ReportType::Config:
+            data.m_output.push_back(Statistic::CreatePersistentString(
+                m_name, "Manifest folder", m_manifestFolder.Native(), "The folder on disk where the prefetch manifests are stored."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Max memory", m_settings.m_maxMemory,
+                "The maximum amount of memory used for prefetched data. No new prefetches are issued until enough data is used."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Max gap", m_settings.m_maxGap,
+                "Recorded reads in the same file that are at most this far apart are combined into a single prefetch."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Max combined read size", m_settings.m_maxCombinedReadSize,
+                "The largest prefetch that recorded reads are combined into."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max pending prefetches", aznumeric_cast<s64>(m_settings.m_maxPendingPrefetches),
+                "The maximum number of prefetches that are queued with the next node at the same time."));
+            data.m_output.push_back(Statistic::CreateReferenceString(
+                m_name, "Next node", m_next ? AZStd::string_view(m_next->GetName()) : AZStd::string_view("<None>"),
+                "The name of the node that follows this node or none."));
+            break;
+        default:
+            break;
+        };
+    }
+} // namespace AZ::IO
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO
+{
+    namespace Requests
+    {
+        struct ReadRequestData;
+        struct ReportData;
+    }
+
+    //! Command to start or stop a prefetch session. Send it with IStreamer::Custom. A session records the reads that are
+    //! made between Begin and End, such as the reads for a level load, and stores them in a manifest under the session name.
+    //! When a session with the same name is started again the reads in the manifest are issued ahead of demand.
+    //! The request fails if there's no Prefetcher in the streaming stack.
+    struct PrefetchSessionCommand
+    {
+        AZ_TYPE_INFO(AZ::IO::PrefetchSessionCommand, "{3E8B0F61-2A7C-4D95-B1E4-6C0F9A5D2E83}");
+
+        enum class Action
+        {
+            Begin, //!< Starts recording reads and prefetches the reads from a previously recorded manifest.
+            End //!< Stores the recorded reads in the manifest and releases any unused prefetched data.
+        };
+
+        Action m_action{ Action::Begin };
+        //! The name of the session. This is used as the file name for the manifest, so it should be a simple name such as
+        //! the name of the level.
+        AZStd::string m_name;
+    };
+
+    struct PrefetcherConfig final :
+        public IStreamerStackConfig
+    {
+        AZ_RTTI(AZ::IO::PrefetcherConfig, "{A4D27E93-5B1F-4C08-8E6A-F93B20C7D514}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(PrefetcherConfig, AZ::SystemAllocator);
+
+        ~PrefetcherConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! The folder that stores the manifests. Aliases such as @user@ are resolved.
+        AZStd::string m_manifestFolder{ "@user@/Streamer/Prefetch" };
+        //! The maximum amount of memory in megabytes that's used to hold prefetched data that hasn't been requested yet.
+        u32 m_maxMemoryMib{ 128 };
+        //! Recorded reads that are at most this many kilobytes apart in the same file are combined into a single read. This
+        //! reads some unneeded data, but avoids seeks on devices where those are expensive.
+        u32 m_maxGapKib{ 64 };
+        //! The largest read in megabytes that recorded reads will be combined into.
+        u32 m_maxCombinedReadSizeMib{ 4 };
+        //! The maximum number of prefetch reads that are queued with the rest of the stack at the same time. Keeping this low
+        //! makes sure that demand reads are not held up behind a large number of prefetch reads.
+        u32 m_maxPendingPrefetches{ 4 };
+    };
+
+    //! Entry in the streaming stack that records the order of read requests and replays it as prefetches on later runs.
+    //! Recorded reads are combined into larger sequential reads and issued at the lowest priority. Reads that are covered
+    //! by prefetched data are copied from memory instead of being forwarded.
+    //! Placed above nodes such as FullFileDecompressor the prefetched data is the final data, so decompression is also done
+    //! ahead of demand.
+    class Prefetcher
+        : public StreamStackEntry
+    {
+    public:
+        struct Settings
+        {
+            u64 m_maxMemory{ 0 };
+            u64 m_maxGap{ 0 };
+            u64 m_maxCombinedReadSize{ 0 };
+            u32 m_maxPendingPrefetches{ 1 };
+            u32 m_alignment{ AZCORE_GLOBAL_NEW_ALIGNMENT };
+        };
+
+        Prefetcher(AZ::IO::Path manifestFolder, const Settings& settings);
+        Prefetcher(Prefetcher&& rhs) = delete;
+        Prefetcher(const Prefetcher& rhs) = delete;
+        ~Prefetcher() override;
+
+        Prefetcher& operator=(Prefetcher&& rhs) = delete;
+        Prefetcher& operator=(const Prefetcher& rhs) = delete;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+        void BeginSession(AZStd::string_view name);
+        void EndSession();
+        bool IsSessionActive() const;
+
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        //! The number of reads that will be issued for the active session after recorded reads have been combined.
+        size_t GetNumPlannedPrefetches() const;
+        u64 GetUsedMemory() const;
+
+    protected:
+        inline static constexpr u32 ManifestMagic = 0x46505A41; // "AZPF"
+        inline static constexpr u32 ManifestVersion = 1;
+        //! The number of most recently planned blocks a recorded read is checked against to be combined with.
+        inline static constexpr size_t CombineWindow = 8;
+        //! The maximum number of reads recorded in a single session. Long sessions will only prefetch the start.
+        inline static constexpr size_t MaxRecordedReads = 64 * 1024;
+
+        struct RecordedRead
+        {
+            AZStd::string m_path;
+            u64 m_offset{ 0 };
+            u64 m_size{ 0 };
+        };
+
+        //! A range of a file that's prefetched, which covers one or more recorded reads.
+        struct Block
+        {
+            enum class State
+            {
+                Planned,
+                Pending,
+                Available,
+                Released
+            };
+
+            RequestPath m_path;
+            u8* m_buffer{ nullptr };
+            u64 m_offset{ 0 };
+            u64 m_size{ 0 };
+            //! The number of bytes of recorded reads that haven't been requested yet. The block is released when this
+            //! reaches zero as the data isn't expected to be needed again.
+            u64 m_remainingUses{ 0 };
+            State m_state{ State::Planned };
+        };
+
+        void PrepareReadRequest(FileRequest* request, Requests::ReadRequestData& data);
+        bool QueueSessionCommand(FileRequest* request);
+        bool CanStartPrefetch() const;
+        bool StartPrefetches();
+        void CompletePrefetch(size_t blockIndex, FileRequest& request);
+        void ServeHit(FileRequest* request, Requests::ReadRequestData& data, Block& block);
+        void ConsumeBlock(Block& block, u64 size);
+        bool AssignOutput(Requests::ReadRequestData& data);
+        void ReleaseBlock(Block& block);
+        void ReleaseAllBlocks();
+        Block* FindBlock(const AZStd::string& path, u64 offset, u64 size);
+
+        void PlanBlocks(const AZStd::vector<RecordedRead>& reads);
+        AZ::IO::Path GetManifestPath(AZStd::string_view name) const;
+        bool LoadManifest(const AZ::IO::Path& path, AZStd::vector<RecordedRead>& reads) const;
+        bool SaveManifest(const AZ::IO::Path& path, const AZStd::vector<RecordedRead>& reads) const;
+
+        void Report(const Requests::ReportData& data) const;
+
+        AZStd::vector<RecordedRead> m_recordedReads;
+        AZStd::vector<Block> m_blocks;
+        //! Indices into m_blocks for every file that has prefetches, so demand reads only need to check the blocks for their file.
+        AZStd::unordered_map<AZStd::string, AZStd::vector<size_t>> m_blocksByPath;
+
+        AZ::Statistics::RunningStatistic m_hitRateStat;
+
+        AZ::IO::Path m_manifestFolder;
+        AZStd::string m_sessionName;
+        Settings m_settings;
+        size_t m_nextBlock{ 0 };
+        u64 m_usedMemory{ 0 };
+        u64 m_prefetchedBytes{ 0 };
+        u32 m_pendingPrefetches{ 0 };
+        bool m_sessionActive{ false };
+    };
+} // namespace AZ::IO
@@ -111,6 +111,7 @@ namespace AZ::IO
     void ReadSplitter::QueueRequest(FileRequest* request)
     {
         AZ_Assert(request, "QueueRequest was provided a null request.");
+        request->RecordTraceStage(m_name.c_str());
         if (!m_next)
         {
             request->SetStatus(IStreamerTypes::RequestStatus::Failed);
@@ -17,6 +17,7 @@
 namespace AZ::IO
 {
     static constexpr const char* SchedulerName = "Scheduler";
+    static constexpr const char* PendingStageName = "Scheduler pending";
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
     static constexpr const char* ImmediateReadsName = "Immediate reads";
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
@@ -79,6 +80,7 @@ namespace AZ::IO
     {
         AZ_Assert(m_isRunning, "Trying to queue a request when Streamer's scheduler isn't running.");
 
+        request->m_request.RecordTraceStage(PendingStageName);
         {
             AZStd::scoped_lock lock(m_pendingRequestsLock);
             m_pendingRequests.push_back(AZStd::move(request));
@@ -90,6 +92,10 @@ namespace AZ::IO
     {
         AZ_Assert(m_isRunning, "Trying to queue a batch of requests when Streamer's scheduler isn't running.");
 
+        for (const FileRequestPtr& request : requests)
+        {
+            request->m_request.RecordTraceStage(PendingStageName);
+        }
         {
             AZStd::scoped_lock lock(m_pendingRequestsLock);
             m_pendingRequests.insert(m_pendingRequests.end(), requests.begin(), requests.end());
@@ -101,6 +107,10 @@ namespace AZ::IO
     {
         AZ_Assert(m_isRunning, "Trying to queue a batch of requests when Streamer's scheduler isn't running.");
 
+        for (const FileRequestPtr& request : requests)
+        {
+            request->m_request.RecordTraceStage(PendingStageName);
+        }
         {
             AZStd::scoped_lock lock(m_pendingRequestsLock);
             AZStd::move(requests.begin(), requests.end(), AZStd::back_inserter(m_pendingRequests));
@@ -76,6 +76,7 @@ namespace AZ::IO
     void StorageDrive::QueueRequest(FileRequest* request)
     {
         AZ_Assert(request, "QueueRequest was provided a null request.");
+        request->RecordTraceStage(m_name.c_str());
         AZStd::visit([this, request](auto&& args)
         {
             using Command = AZStd::decay_t<decltype(args)>;
@@ -8,6 +8,7 @@
 
 #include <AzCore/std/algorithm.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Debug/ProfilerBus.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
 #include <AzCore/IO/Streamer/StreamStackEntry.h>
@@ -22,6 +23,12 @@ namespace AZ
         static constexpr const char* LatePredictionName = "Early completions";
         static constexpr const char* MissedDeadlinesName = "Missed deadlines";
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        static constexpr const char* RequestTracingName = "Request tracing";
+        static constexpr const char* PreparedStageName = "Scheduler queue";
+        static constexpr const char* CompletedStageName = "Completion";
+        // Traced requests are spread over a fixed number of tracks so the profiler doesn't have to name a track per request.
+        static constexpr const char* RequestTraceTrackNames[] = { "Streamer requests 1", "Streamer requests 2", "Streamer requests 3",
+            "Streamer requests 4", "Streamer requests 5", "Streamer requests 6", "Streamer requests 7", "Streamer requests 8" };
 
         StreamerContext::StreamerContext() = default;
 
@@ -101,6 +108,7 @@ namespace AZ
         void StreamerContext::PushPreparedRequest(FileRequest* request)
         {
             request->m_pendingId = ++m_pendingIdCounter;
+            request->RecordTraceStage(PreparedStageName);
             m_preparedRequests.push_back(request);
         }
 
@@ -119,6 +127,7 @@ namespace AZ
             AZStd::scoped_lock<AZStd::recursive_mutex> guard(m_completedGuard);
             AZ_Assert(request->m_dependencies == 0, "A request with dependencies is marked as completed.");
             AZ_Assert(!request->m_inRecycleBin, "Request that's already been marked for deletion has been added again.");
+            request->RecordTraceStage(CompletedStageName);
             m_completed.push(request);
         }
 
@@ -213,6 +222,11 @@ namespace AZ
                     }
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
 
+                    if (top->m_traceStageCount > 0)
+                    {
+                        ReportRequestTrace(*top);
+                    }
+
                     // Get all information before calling the completion routine as it's technically possible that an external
                     // request is recycled during the callback.
                     IStreamerTypes::RequestStatus status = top->GetStatus();
@@ -267,6 +281,48 @@ namespace AZ
             return hasCompletedRequests;
         }
 
+        void StreamerContext::ReportRequestTrace(const FileRequest& request)
+        {
+            const AZStd::sys_time_t nowTicks = AZStd::GetTimeNowTicks();
+            const AZStd::sys_time_t ticksPerSecond = AZStd::GetTimeTicksPerSecond();
+
+            // Sub-requests share the track of the queued request they work on, so a request and everything it spawned line up.
+            size_t pendingId = request.m_pendingId;
+            for (const FileRequest* parent = request.m_parent; parent; parent = parent->m_parent)
+            {
+                pendingId = parent->m_pendingId != 0 ? parent->m_pendingId : pendingId;
+            }
+            const char* trackName = RequestTraceTrackNames[pendingId % AZ_ARRAY_SIZE(RequestTraceTrackNames)];
+            auto profilerSystem = AZ::Debug::ProfilerSystemInterface::Get();
+
+            for (u8 i = 0; i < request.m_traceStageCount; ++i)
+            {
+                const FileRequest::TraceStage& stage = request.m_traceStages[i];
+                const AZStd::sys_time_t exitTicks = (i + 1 < request.m_traceStageCount) ? request.m_traceStages[i + 1].m_enterTicks : nowTicks;
+
+                TraceStageStatistics* statistics = nullptr;
+                for (TraceStageStatistics& entry : m_traceStageStatistics)
+                {
+                    if (AZStd::string_view(entry.m_name) == stage.m_name)
+                    {
+                        statistics = &entry;
+                        break;
+                    }
+                }
+                if (!statistics)
+                {
+                    statistics = &m_traceStageStatistics.emplace_back();
+                    statistics->m_name = stage.m_name;
+                }
+                statistics->m_duration.PushEntry(Statistic::TimeValue((exitTicks - stage.m_enterTicks) * 1000000 / ticksPerSecond));
+
+                if (profilerSystem)
+                {
+                    profilerSystem->AddTimelineRegion(trackName, stage.m_name, stage.m_enterTicks, exitTicks);
+                }
+            }
+        }
+
         void StreamerContext::WakeUpSchedulingThread()
         {
             m_threadSync.Resume();
@@ -316,6 +372,14 @@ namespace AZ
                 "be a callback on a request that should be handed off to another thread. While the callback is processing Streamer can not "
                 "schedule or process any other requests."));
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILNG_INFO
+            for (const TraceStageStatistics& stageStatistics : m_traceStageStatistics)
+            {
+                statistics.push_back(Statistic::CreateTimeRange(
+                    RequestTracingName, stageStatistics.m_name, stageStatistics.m_duration.CalculateAverage(),
+                    stageStatistics.m_duration.GetMinimum(), stageStatistics.m_duration.GetMaximum(),
+                    "The average amount of time in microseconds traced requests spent in this stage, with the scheduler stages covering "
+                    "the time requests wait before being processed. Only available while the io_requestTracing cvar is on."));
+            }
             statistics.push_back(Statistic::CreateInteger(
                 ContextName, "Total requests", aznumeric_caster(m_pendingIdCounter), "The total number of requests Streamer has processed.",
                 Statistic::GraphType::None));
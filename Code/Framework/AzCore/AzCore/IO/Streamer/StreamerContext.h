@@ -99,6 +99,9 @@ namespace AZ::IO
         //! for managing the lock to the recycle bin.
         FileRequestPtr GetNewExternalRequestUnguarded();
 
+        //! Adds the stages recorded by a traced request to the profiler timeline and the stage statistics.
+        void ReportRequestTrace(const FileRequest& request);
+
         inline static constexpr size_t s_initialRecycleBinSize = 64;
 
         AZStd::mutex m_externalRecycleBinGuard;
@@ -131,6 +134,14 @@ namespace AZ::IO
         TimedAverageWindow<s_statisticsWindowSize> m_externalCompletionTimeAverage;
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
 
+        struct TraceStageStatistics
+        {
+            const char* m_name{ nullptr };
+            TimedAverageWindow<s_statisticsWindowSize> m_duration;
+        };
+        //! The time requests spent in each of the stages recorded while the io_requestTracing cvar is on.
+        AZStd::vector<TraceStageStatistics> m_traceStageStatistics;
+
         //! Platform-specific synchronization object used to suspend the Streamer thread and wake it up to resume procesing.
         AZ::Platform::StreamerContextThreadSync m_threadSync;
 
@@ -18,6 +18,8 @@
 #include <AzCore/std/chrono/chrono.h>
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 
 #ifdef JOBMANAGER_ENABLE_STATS
 #   include <stdio.h>
@@ -82,9 +84,19 @@ Job* WorkQueue::TryStealFront()
 
 
 AZ_THREAD_LOCAL JobManagerWorkStealing::ThreadInfo* JobManagerWorkStealing::m_currentThreadInfo = nullptr;
+AZ_THREAD_LOCAL JobManagerWorkStealing::ThreadInfo* JobManagerWorkStealing::m_taskExecutorThreadInfo = nullptr;
+AZ_THREAD_LOCAL AZ::u32 JobManagerWorkStealing::m_taskExecutorThreadInfoOwnerId = 0;
+
+static AZ::u32 NextJobManagerInstanceId()
+{
+    static AZStd::atomic_uint s_nextInstanceId{1};
+    return s_nextInstanceId.fetch_add(1, AZStd::memory_order_relaxed);
+}
 
 JobManagerWorkStealing::JobManagerWorkStealing(const JobManagerDesc& desc)
-    : m_isAsynchronous(!desc.m_workerThreads.empty())
+    : m_taskExecutor(desc.m_taskExecutor)
+    , m_instanceId(NextJobManagerInstanceId())
+    , m_isAsynchronous(desc.m_taskExecutor || !desc.m_workerThreads.empty())
     , m_workerThreads(AZStd::move(CreateWorkerThreads(desc)))
 {
     //allow workers to begin processing after they have all been created, needed to wait since they may access each others queues
@@ -93,6 +105,12 @@ JobManagerWorkStealing::JobManagerWorkStealing(const JobManagerDesc& desc)
 
 JobManagerWorkStealing::~JobManagerWorkStealing()
 {
+    //tasks submitted to a shared task executor reference this manager, wait for them to drain
+    while (m_numPendingExecutorTasks.load(AZStd::memory_order_acquire) > 0)
+    {
+        AZStd::this_thread::yield();
+    }
+
     //kill worker threads
     if (!m_workerThreads.empty())
     {
@@ -159,15 +177,23 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
         //current thread is not a worker thread, insert into the global queue based on the job's priority
         if (IsAsynchronous())
         {
-            AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-            const GlobalJobQueue::const_iterator locationToinsert = AZStd::upper_bound(m_globalJobQueue.begin(),
-                                                                                       m_globalJobQueue.end(),
-                                                                                       job->GetPriority(),
-                                                                                       CompareJobPriorities);
-            m_globalJobQueue.insert(locationToinsert, job);
-
-            //checking/changing global queue empty state or worker availability must be done atomically while holding the global queue lock
-            ActivateWorker();
+            {
+                AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
+                const GlobalJobQueue::const_iterator locationToinsert = AZStd::upper_bound(m_globalJobQueue.begin(),
+                                                                                           m_globalJobQueue.end(),
+                                                                                           job->GetPriority(),
+                                                                                           CompareJobPriorities);
+                m_globalJobQueue.insert(locationToinsert, job);
+
+                //checking/changing global queue empty state or worker availability must be done atomically while holding the global queue lock
+                ActivateWorker();
+            }
+
+            if (m_taskExecutor)
+            {
+                //each queued job is matched by one executor task that pops a job from the global queue
+                SubmitToTaskExecutor();
+            }
         }
         else
         {
@@ -286,6 +312,11 @@ Job* JobManagerWorkStealing::GetCurrentJob() const
     return info ? info->m_currentJob : nullptr;
 }
 
+AZ::u32 JobManagerWorkStealing::GetNumWorkerThreads() const
+{
+    return m_taskExecutor ? m_taskExecutor->GetWorkerCount() : static_cast<AZ::u32>(m_workerThreads.size());
+}
+
 AZ::u32 JobManagerWorkStealing::GetWorkerThreadId() const
 {
     const ThreadInfo* info = m_currentThreadInfo;
@@ -546,9 +577,87 @@ void JobManagerWorkStealing::ProcessJobsSynchronous(ThreadInfo* info, Job* suspe
     m_currentThreadInfo = oldInfo; //restore previous ThreadInfo, necessary as must be NULL when returning to user code to support multiple job contexts
 }
 
+void JobManagerWorkStealing::SubmitToTaskExecutor()
+{
+    static const TaskDescriptor jobDescriptor{ "Job", "JobManager" };
+
+    m_numPendingExecutorTasks.fetch_add(1, AZStd::memory_order_acq_rel);
+
+    TaskGraph graph{ "JobManager" };
+    graph.AddTask(
+        jobDescriptor,
+        [this]
+        {
+            ProcessJobOnTaskExecutor();
+            m_numPendingExecutorTasks.fetch_sub(1, AZStd::memory_order_acq_rel);
+        });
+    graph.Detach();
+    graph.SubmitOnExecutor(*m_taskExecutor);
+}
+
+void JobManagerWorkStealing::ProcessJobOnTaskExecutor()
+{
+    Job* job = nullptr;
+    {
+        AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
+        if (!m_globalJobQueue.empty())
+        {
+            job = m_globalJobQueue.front();
+            m_globalJobQueue.pop_front();
+        }
+    }
+
+    //the job may have been picked up by a thread assisting while waiting on a suspended job
+    if (!job)
+    {
+        return;
+    }
+
+    ThreadInfo* info = GetOrCreateTaskExecutorThreadInfo();
+    ThreadInfo* oldInfo = m_currentThreadInfo;
+    m_currentThreadInfo = info;
+
+    Job* previousJob = info->m_currentJob;
+    info->m_currentJob = job;
+    Process(job);
+    info->m_currentJob = previousJob;
+#ifdef JOBMANAGER_ENABLE_STATS
+    ++info->m_globalJobs;
+    ++info->m_jobsDone;
+#endif
+
+    m_currentThreadInfo = oldInfo;
+}
+
+JobManagerWorkStealing::ThreadInfo* JobManagerWorkStealing::GetOrCreateTaskExecutorThreadInfo()
+{
+    if (m_taskExecutorThreadInfo && m_taskExecutorThreadInfoOwnerId == m_instanceId)
+    {
+        return m_taskExecutorThreadInfo;
+    }
+
+    //task executor threads are not workers of this manager (they don't own a local queue that can be stolen from), but they
+    //get a stable worker id so code partitioning work per worker thread keeps functioning
+    ThreadInfo* info = aznew ThreadInfo;
+    info->m_threadId = AZStd::this_thread::get_id();
+    info->m_owningManager = this;
+    info->m_workerId = m_numExecutorThreadInfos.fetch_add(1, AZStd::memory_order_acq_rel);
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadsMutex);
+        m_threads.push_back(info);
+    }
+    m_taskExecutorThreadInfo = info;
+    m_taskExecutorThreadInfoOwnerId = m_instanceId;
+    return info;
+}
+
 JobManagerWorkStealing::ThreadInfo* JobManagerWorkStealing::GetCurrentOrCreateThreadInfo()
 {
     ThreadInfo* info = m_currentThreadInfo;
+    if (!info && m_taskExecutor && m_taskExecutor == TaskExecutor::GetCurrentExecutor())
+    {
+        info = GetOrCreateTaskExecutorThreadInfo();
+    }
     if (!info)
     {
         info = FindCurrentThreadInfo();
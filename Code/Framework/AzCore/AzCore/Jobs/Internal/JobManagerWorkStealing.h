@@ -26,6 +26,7 @@
 namespace AZ
 {
     class Job;
+    class TaskExecutor;
 
     namespace Internal
     {
@@ -78,7 +79,7 @@ namespace AZ
 
             Job* GetCurrentJob() const;
 
-            AZ::u32 GetNumWorkerThreads() const { return static_cast<AZ::u32>(m_workerThreads.size()); }
+            AZ::u32 GetNumWorkerThreads() const;
 
             AZ::u32 GetWorkerThreadId() const;
 
@@ -124,6 +125,16 @@ namespace AZ
             ThreadInfo* FindCurrentThreadInfo() const;
             ThreadInfo* GetCurrentOrCreateThreadInfo();
 
+            // Shared thread pool mode, jobs are run by tasks submitted to the task executor
+            void SubmitToTaskExecutor();
+            void ProcessJobOnTaskExecutor();
+            ThreadInfo* GetOrCreateTaskExecutorThreadInfo();
+
+            TaskExecutor* m_taskExecutor = nullptr;
+            const AZ::u32 m_instanceId; //unique per manager, used to validate the thread-local task executor info cache
+            AZStd::atomic_uint m_numPendingExecutorTasks{0};
+            AZStd::atomic_uint m_numExecutorThreadInfos{0};
+
             bool m_isAsynchronous;
 
             ThreadList m_threads;
@@ -145,6 +156,10 @@ namespace AZ
             //thread-local pointer to the info for this thread. This is set for worker threads all the time,
             //and user threads only while they are processing jobs
             static AZ_THREAD_LOCAL ThreadInfo* m_currentThreadInfo;
+
+            //thread-local cache of the info used by a task executor thread, valid only if the id of its owning manager matches
+            static AZ_THREAD_LOCAL ThreadInfo* m_taskExecutorThreadInfo;
+            static AZ_THREAD_LOCAL AZ::u32 m_taskExecutorThreadInfoOwnerId;
         };
     }
 }
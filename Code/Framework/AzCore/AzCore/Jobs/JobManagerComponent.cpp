@@ -20,11 +20,15 @@
 
 #include <AzCore/Console/IConsole.h>
 
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Threading/ThreadUtils.h>
 
 AZ_CVAR(float, cl_jobThreadsConcurrencyRatio, AZ_TRAIT_USE_JOB_THREADS_CONCURRENCY_RATIO, nullptr, AZ::ConsoleFunctorFlags::Null, "Legacy Job system multiplier on the number of hw threads the machine creates at initialization");
 AZ_CVAR(uint32_t, cl_jobThreadsNumReserved, 2, nullptr, AZ::ConsoleFunctorFlags::Null, "Legacy Job system number of hardware threads that are reserved for O3DE system threads");
 AZ_CVAR(uint32_t, cl_jobThreadsMinNumber, 3, nullptr, AZ::ConsoleFunctorFlags::Null, "Legacy Job system minimum number of worker threads to create after scaling the number of hw threads");
+AZ_CVAR(bool, cl_jobsUseTaskGraphWorkers, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Legacy Job system runs jobs on the TaskGraph worker threads instead of creating its own threads (read at activation)");
 
 namespace AZ
 {
@@ -54,8 +58,14 @@ namespace AZ
         desc.m_jobManagerName = "Default JobManager";
         JobManagerThreadDesc threadDesc;
 
-        int numberOfWorkerThreads = m_numberOfWorkerThreads;
-        if (numberOfWorkerThreads <= 0) // spawn default number of threads
+        if (cl_jobsUseTaskGraphWorkers && Interface<TaskGraphActiveInterface>::Get())
+        {
+            // Share the TaskGraph worker threads instead of oversubscribing the CPU with a second pool
+            desc.m_taskExecutor = &TaskExecutor::Instance();
+        }
+
+        int numberOfWorkerThreads = desc.m_taskExecutor ? 0 : m_numberOfWorkerThreads;
+        if (!desc.m_taskExecutor && numberOfWorkerThreads <= 0) // spawn default number of threads
         {
         #if (AZ_TRAIT_THREAD_NUM_JOB_MANAGER_WORKER_THREADS)
             numberOfWorkerThreads = AZ_TRAIT_THREAD_NUM_JOB_MANAGER_WORKER_THREADS;
@@ -116,6 +126,8 @@ namespace AZ
     void JobManagerComponent::GetDependentServices(ComponentDescriptor::DependencyArrayType& dependent)
     {
         dependent.push_back(AZ_CRC_CE("ProfilerService"));
+        // Activate after the TaskGraph so its workers can be shared (see cl_jobsUseTaskGraphWorkers)
+        dependent.push_back(AZ_CRC_CE("TaskExecutorService"));
     }
 
     //=========================================================================
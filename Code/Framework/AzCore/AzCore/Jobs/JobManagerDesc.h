@@ -12,6 +12,8 @@
 
 namespace AZ
 {
+    class TaskExecutor;
+
     /**
      * Descriptor for a single job manager thread, an array of these is specified in JobManagerDesc.
      */
@@ -56,6 +58,13 @@ namespace AZ
         using DescList = AZStd::fixed_vector<JobManagerThreadDesc, 64>;
         DescList m_workerThreads; ///< List of worker threads to create
 
+        /**
+         *  When set, the job manager doesn't create any threads of its own and m_workerThreads is ignored. Jobs are instead
+         *  executed on the worker threads of the task executor, so both systems share one pool of threads.
+         *  The executor must outlive the job manager.
+         */
+        TaskExecutor* m_taskExecutor = nullptr;
+
         /**
          *  Limits the number of worker threads to fit in m_workerThreads.
          */
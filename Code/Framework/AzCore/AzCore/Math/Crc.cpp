@@ -11,13 +11,202 @@
 
 #include <string.h>
 
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+    #include <nmmintrin.h>
+    #if defined(AZ_COMPILER_MSVC)
+        #include <intrin.h>
+    #endif
+#elif defined(__ARM_FEATURE_CRC32)
+    #include <arm_acle.h>
+#endif
+
 namespace AZ::Internal
 {
     template struct AggregateTypes<Crc32>;
 }
 
+namespace AZ::CrcInternal
+{
+    //! Tables for slicing-by-8, where Tables[k][i] is the CRC of the byte i followed by k zero bytes
+    struct SlicingTables
+    {
+        constexpr explicit SlicingTables(u32 polynomial)
+        {
+            for (u32 i = 0; i < 256; ++i)
+            {
+                u32 crc = i;
+                for (int bit = 0; bit < 8; ++bit)
+                {
+                    crc = (crc & 1) ? (crc >> 1) ^ polynomial : crc >> 1;
+                }
+                m_tables[0][i] = crc;
+            }
+            for (u32 i = 0; i < 256; ++i)
+            {
+                for (size_t k = 1; k < 8; ++k)
+                {
+                    const u32 previous = m_tables[k - 1][i];
+                    m_tables[k][i] = (previous >> 8) ^ m_tables[0][previous & 0xff];
+                }
+            }
+        }
+
+        u32 m_tables[8][256] = {};
+    };
+
+    constexpr SlicingTables Crc32Tables{ 0xedb88320 };
+    constexpr SlicingTables Crc32CTables{ 0x82f63b78 };
+    static_assert(Crc32Tables.m_tables[0][255] == crc_table[255], "The slicing tables must use the polynomial of Crc32");
+
+    AZ_FORCE_INLINE u64 LoadBlock(const uint8_t* data)
+    {
+        u64 block;
+        memcpy(&block, data, sizeof(block));
+        return block;
+    }
+
+    //! Converts the ASCII upper case letters of 8 bytes to lower case, leaving the other bytes unchanged
+    AZ_FORCE_INLINE u64 ToLowerBlock(u64 block)
+    {
+        constexpr u64 Ones = 0x0101010101010101ull;
+        constexpr u64 HighBits = Ones * 0x80;
+        // The high bit of each byte is set in these when the byte is an ASCII character that is >= 'A' or > 'Z'
+        const u64 lowBits = block & (Ones * 0x7f);
+        const u64 aboveOrA = lowBits + Ones * (0x80 - 'A');
+        const u64 aboveZ = lowBits + Ones * (0x7f - 'Z');
+        const u64 upperCase = (aboveOrA ^ aboveZ) & ~block & HighBits;
+        // 'a' - 'A' is 0x20, the high bit shifted right twice
+        return block | (upperCase >> 2);
+    }
+
+    AZ_FORCE_INLINE uint8_t ToLower(uint8_t value)
+    {
+        return (value >= 'A' && value <= 'Z') ? static_cast<uint8_t>(value + 'a' - 'A') : value;
+    }
+
+    //! Processes the data 8 bytes at a time with slicing-by-8, which gives the same result as the byte table
+    u32 UpdateCrcSoftware(const SlicingTables& slicingTables, u32 crc, const uint8_t* data, size_t size, bool forceLowerCase)
+    {
+        const auto& tables = slicingTables.m_tables;
+        for (; size >= 8; size -= 8, data += 8)
+        {
+            u64 block = LoadBlock(data);
+            if (forceLowerCase)
+            {
+                block = ToLowerBlock(block);
+            }
+            const u32 low = crc ^ static_cast<u32>(block);
+            const u32 high = static_cast<u32>(block >> 32);
+            crc = tables[7][low & 0xff] ^ tables[6][(low >> 8) & 0xff] ^ tables[5][(low >> 16) & 0xff] ^ tables[4][low >> 24] ^
+                tables[3][high & 0xff] ^ tables[2][(high >> 8) & 0xff] ^ tables[1][(high >> 16) & 0xff] ^ tables[0][high >> 24];
+        }
+        for (; size > 0; --size, ++data)
+        {
+            const uint8_t value = forceLowerCase ? ToLower(*data) : *data;
+            crc = tables[0][(crc ^ value) & 0xff] ^ (crc >> 8);
+        }
+        return crc;
+    }
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+    // The CRC32 instruction of SSE4.2 only calculates CRC-32C, so Crc32 always uses the tables on these platforms
+    #if defined(__SSE4_2__) || defined(AZ_COMPILER_MSVC)
+        #define AZ_CRC32C_TARGET
+    #else
+        #define AZ_CRC32C_TARGET __attribute__((target("sse4.2")))
+    #endif
+
+    bool HasCrc32CInstructions()
+    {
+    #if defined(__SSE4_2__)
+        return true;
+    #elif defined(AZ_COMPILER_MSVC)
+        int cpuInfo[4];
+        __cpuid(cpuInfo, 1);
+        return (cpuInfo[2] & (1 << 20)) != 0;
+    #else
+        return __builtin_cpu_supports("sse4.2");
+    #endif
+    }
+
+    AZ_CRC32C_TARGET u32 UpdateCrc32CHardware(u32 crc, const uint8_t* data, size_t size)
+    {
+        u64 crc64 = crc;
+        for (; size >= 8; size -= 8, data += 8)
+        {
+            crc64 = _mm_crc32_u64(crc64, LoadBlock(data));
+        }
+        crc = static_cast<u32>(crc64);
+        for (; size > 0; --size, ++data)
+        {
+            crc = _mm_crc32_u8(crc, *data);
+        }
+        return crc;
+    }
+
+    #undef AZ_CRC32C_TARGET
+#elif defined(__ARM_FEATURE_CRC32)
+    // ARMv8 has instructions for both polynomials
+    u32 UpdateCrc32Hardware(u32 crc, const uint8_t* data, size_t size, bool forceLowerCase)
+    {
+        for (; size >= 8; size -= 8, data += 8)
+        {
+            const u64 block = LoadBlock(data);
+            crc = __crc32d(crc, forceLowerCase ? ToLowerBlock(block) : block);
+        }
+        for (; size > 0; --size, ++data)
+        {
+            crc = __crc32b(crc, forceLowerCase ? ToLower(*data) : *data);
+        }
+        return crc;
+    }
+
+    u32 UpdateCrc32CHardware(u32 crc, const uint8_t* data, size_t size)
+    {
+        for (; size >= 8; size -= 8, data += 8)
+        {
+            crc = __crc32cd(crc, LoadBlock(data));
+        }
+        for (; size > 0; --size, ++data)
+        {
+            crc = __crc32cb(crc, *data);
+        }
+        return crc;
+    }
+#endif
+}
+
 namespace AZ
 {
+    namespace Internal
+    {
+        u32 CalculateCrc32(const uint8_t* data, size_t size, bool forceLowerCase)
+        {
+        #if defined(__ARM_FEATURE_CRC32) && !AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+            return ~CrcInternal::UpdateCrc32Hardware(0xffffffff, data, size, forceLowerCase);
+        #else
+            return ~CrcInternal::UpdateCrcSoftware(CrcInternal::Crc32Tables, 0xffffffff, data, size, forceLowerCase);
+        #endif
+        }
+    }
+
+    u32 CalculateCrc32C(const void* data, size_t size, u32 crc)
+    {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+    #if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        static const bool hasCrc32CInstructions = CrcInternal::HasCrc32CInstructions();
+        if (hasCrc32CInstructions)
+        {
+            return ~CrcInternal::UpdateCrc32CHardware(~crc, bytes, size);
+        }
+        return ~CrcInternal::UpdateCrcSoftware(CrcInternal::Crc32CTables, ~crc, bytes, size, false);
+    #elif defined(__ARM_FEATURE_CRC32)
+        return ~CrcInternal::UpdateCrc32CHardware(~crc, bytes, size);
+    #else
+        return ~CrcInternal::UpdateCrcSoftware(CrcInternal::Crc32CTables, ~crc, bytes, size, false);
+    #endif
+    }
+
     AZ_TYPE_INFO_WITH_NAME_IMPL(Crc32, "Crc32", "{9F4E062E-06A0-46D4-85DF-E0DA96467D3A}")
 
     //=========================================================================
@@ -108,6 +108,13 @@ namespace AZ
 
         u32 m_value;
     };
+
+    //! Calculates the CRC-32C checksum (Castagnoli polynomial) of a block of data.
+    //! This isn't the checksum calculated by Crc32, so it can't replace it for values that are saved or calculated
+    //! offline. It uses the CRC32 instructions of SSE4.2 and ARMv8 when the CPU has them, which makes it faster than
+    //! Crc32 for checksums of runtime data.
+    //! @param crc The checksum of the previous blocks, to calculate the checksum of data split in several blocks.
+    u32 CalculateCrc32C(const void* data, size_t size, u32 crc = 0);
 }
 
 namespace AZStd
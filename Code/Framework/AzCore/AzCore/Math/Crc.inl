@@ -80,6 +80,9 @@ namespace AZ
         template <auto CrcValue>
         inline static constexpr AZ::Crc32 CompileTimeCrc32 = AZ::Crc32(CrcValue);
 
+        //! Runtime version of Crc32Set, processing 8 bytes at a time.
+        AZ::u32 CalculateCrc32(const uint8_t* data, size_t size, bool forceLowerCase);
+
         constexpr unsigned int ComputeCrc32Octet(unsigned int currentCrc, uint8_t dataOctet)
         {
             return crc_table[(static_cast<int>(currentCrc) ^ dataOctet) & 0xff] ^ (currentCrc >> 8);
@@ -93,6 +96,10 @@ namespace AZ
             {
                 value = 0;
             }
+            else if (!az_builtin_is_constant_evaluated())
+            {
+                value = CalculateCrc32(reinterpret_cast<const uint8_t*>(buf), size, forceLowerCase);
+            }
             else
             {
                 unsigned int crc = 0xffffffffL;
@@ -657,14 +657,47 @@ namespace AZ
             out[3] = _mm_shuffle_ps(tmp2, tmp3, 0xDD);
         }
 
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX2
+        namespace Avx
+        {
+            // Computes two rows of the result of a 4x4 matrix multiplication in each 256 bit register,
+            // in the same order as Common::Mat4x4MultiplyAdd
+            AZ_MATH_INLINE void Mat4x4MultiplyAdd(const __m128* __restrict rowsA, const __m128* __restrict rowsB, const __m128* __restrict add, __m128* __restrict out)
+            {
+                const __m256 rowB0 = _mm256_broadcast_ps(&rowsB[0]);
+                const __m256 rowB1 = _mm256_broadcast_ps(&rowsB[1]);
+                const __m256 rowB2 = _mm256_broadcast_ps(&rowsB[2]);
+                const __m256 rowB3 = _mm256_broadcast_ps(&rowsB[3]);
+                for (int32_t row = 0; row < 4; row += 2)
+                {
+                    const __m256 rowsAB = _mm256_loadu_ps(reinterpret_cast<const float*>(rowsA + row));
+                    __m256 result = add ? _mm256_loadu_ps(reinterpret_cast<const float*>(add + row)) : _mm256_setzero_ps();
+                    result = _mm256_fmadd_ps(_mm256_shuffle_ps(rowsAB, rowsAB, _MM_SHUFFLE(0, 0, 0, 0)), rowB0, result);
+                    result = _mm256_fmadd_ps(_mm256_shuffle_ps(rowsAB, rowsAB, _MM_SHUFFLE(1, 1, 1, 1)), rowB1, result);
+                    result = _mm256_fmadd_ps(_mm256_shuffle_ps(rowsAB, rowsAB, _MM_SHUFFLE(2, 2, 2, 2)), rowB2, result);
+                    result = _mm256_fmadd_ps(_mm256_shuffle_ps(rowsAB, rowsAB, _MM_SHUFFLE(3, 3, 3, 3)), rowB3, result);
+                    _mm256_storeu_ps(reinterpret_cast<float*>(out + row), result);
+                }
+            }
+        }
+#endif
+
         AZ_MATH_INLINE void Vec4::Mat4x4Multiply(const FloatType* __restrict rowsA, const FloatType* __restrict rowsB, FloatType* __restrict out)
         {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX2
+            Avx::Mat4x4MultiplyAdd(rowsA, rowsB, nullptr, out);
+#else
             Common::Mat4x4Multiply<Vec4>(rowsA, rowsB, out);
+#endif
         }
 
         AZ_MATH_INLINE void Vec4::Mat4x4MultiplyAdd(const FloatType* __restrict rowsA, const FloatType* __restrict rowsB, const FloatType* __restrict add, FloatType* __restrict out)
         {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX2
+            Avx::Mat4x4MultiplyAdd(rowsA, rowsB, add, out);
+#else
             Common::Mat4x4MultiplyAdd<Vec4>(rowsA, rowsB, add, out);
+#endif
         }
 
         AZ_MATH_INLINE void Vec4::Mat4x4TransposeMultiply(const FloatType* __restrict rowsA, const FloatType* __restrict rowsB, FloatType* __restrict out)
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AZ
+{
+    namespace Simd
+    {
+        AZ_MATH_INLINE Vec8::FloatType Vec8::LoadAligned(const float* __restrict addr)
+        {
+            AZ_MATH_ASSERT(IsAligned<32>(addr), "Alignment failure");
+            return { Vec4::LoadAligned(addr), Vec4::LoadAligned(addr + Vec4::ElementCount) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::LoadUnaligned(const float* __restrict addr)
+        {
+            return { Vec4::LoadUnaligned(addr), Vec4::LoadUnaligned(addr + Vec4::ElementCount) };
+        }
+
+        AZ_MATH_INLINE void Vec8::StoreAligned(float* __restrict addr, FloatArgType value)
+        {
+            AZ_MATH_ASSERT(IsAligned<32>(addr), "Alignment failure");
+            Vec4::StoreAligned(addr, value.m_low);
+            Vec4::StoreAligned(addr + Vec4::ElementCount, value.m_high);
+        }
+
+        AZ_MATH_INLINE void Vec8::StoreUnaligned(float* __restrict addr, FloatArgType value)
+        {
+            Vec4::StoreUnaligned(addr, value.m_low);
+            Vec4::StoreUnaligned(addr + Vec4::ElementCount, value.m_high);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Splat(float value)
+        {
+            const Vec4::FloatType splat = Vec4::Splat(value);
+            return { splat, splat };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::ZeroFloat()
+        {
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            return { zero, zero };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Add(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { Vec4::Add(arg1.m_low, arg2.m_low), Vec4::Add(arg1.m_high, arg2.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Sub(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { Vec4::Sub(arg1.m_low, arg2.m_low), Vec4::Sub(arg1.m_high, arg2.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Mul(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { Vec4::Mul(arg1.m_low, arg2.m_low), Vec4::Mul(arg1.m_high, arg2.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Madd(FloatArgType mul1, FloatArgType mul2, FloatArgType add)
+        {
+            return { Vec4::Madd(mul1.m_low, mul2.m_low, add.m_low), Vec4::Madd(mul1.m_high, mul2.m_high, add.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Div(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { Vec4::Div(arg1.m_low, arg2.m_low), Vec4::Div(arg1.m_high, arg2.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Abs(FloatArgType value)
+        {
+            return { Vec4::Abs(value.m_low), Vec4::Abs(value.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Not(FloatArgType value)
+        {
+            return { Vec4::Not(value.m_low), Vec4::Not(value.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::And(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { Vec4::And(arg1.m_low, arg2.m_low), Vec4::And(arg1.m_high, arg2.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::AndNot(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { Vec4::AndNot(arg1.m_low, arg2.m_low), Vec4::AndNot(arg1.m_high, arg2.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Or(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { Vec4::Or(arg1.m_low, arg2.m_low), Vec4::Or(arg1.m_high, arg2.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Xor(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { Vec4::Xor(arg1.m_low, arg2.m_low), Vec4::Xor(arg1.m_high, arg2.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Min(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { Vec4::Min(arg1.m_low, arg2.m_low), Vec4::Min(arg1.m_high, arg2.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Max(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { Vec4::Max(arg1.m_low, arg2.m_low), Vec4::Max(arg1.m_high, arg2.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Clamp(FloatArgType value, FloatArgType min, FloatArgType max)
+        {
+            return { Vec4::Clamp(value.m_low, min.m_low, max.m_low), Vec4::Clamp(value.m_high, min.m_high, max.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { Vec4::CmpEq(arg1.m_low, arg2.m_low), Vec4::CmpEq(arg1.m_high, arg2.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpNeq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { Vec4::CmpNeq(arg1.m_low, arg2.m_low), Vec4::CmpNeq(arg1.m_high, arg2.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpGt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { Vec4::CmpGt(arg1.m_low, arg2.m_low), Vec4::CmpGt(arg1.m_high, arg2.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpGtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { Vec4::CmpGtEq(arg1.m_low, arg2.m_low), Vec4::CmpGtEq(arg1.m_high, arg2.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpLt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { Vec4::CmpLt(arg1.m_low, arg2.m_low), Vec4::CmpLt(arg1.m_high, arg2.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpLtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { Vec4::CmpLtEq(arg1.m_low, arg2.m_low), Vec4::CmpLtEq(arg1.m_high, arg2.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Select(FloatArgType arg1, FloatArgType arg2, FloatArgType mask)
+        {
+            return { Vec4::Select(arg1.m_low, arg2.m_low, mask.m_low), Vec4::Select(arg1.m_high, arg2.m_high, mask.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Sqrt(FloatArgType value)
+        {
+            return { Vec4::Sqrt(value.m_low), Vec4::Sqrt(value.m_high) };
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Reciprocal(FloatArgType value)
+        {
+            return { Vec4::Reciprocal(value.m_low), Vec4::Reciprocal(value.m_high) };
+        }
+    }
+}
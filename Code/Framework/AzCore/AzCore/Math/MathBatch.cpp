@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathBatch.h>
+
+namespace AZ
+{
+    namespace MathBatch
+    {
+        //! The kernels process eight values at a time, which is a single register with the AVX2 backend
+        using Vec8 = Simd::Vec8;
+        using Vec4 = Simd::Vec4;
+        constexpr size_t ElementCount = Simd::Vec8::ElementCount;
+
+        namespace Internal
+        {
+            //! Quaternions in structure of arrays form, one per lane.
+            template<class VecType>
+            struct QuaternionLanes
+            {
+                typename VecType::FloatType m_x;
+                typename VecType::FloatType m_y;
+                typename VecType::FloatType m_z;
+                typename VecType::FloatType m_w;
+            };
+
+            //! Vectors in structure of arrays form, one per lane.
+            template<class VecType>
+            struct Vector3Lanes
+            {
+                typename VecType::FloatType m_x;
+                typename VecType::FloatType m_y;
+                typename VecType::FloatType m_z;
+            };
+
+            template<class VecType>
+            AZ_MATH_INLINE QuaternionLanes<VecType> LoadQuaternions(const QuaternionSoa& quaternions, size_t index)
+            {
+                return { VecType::LoadUnaligned(quaternions.GetX() + index), VecType::LoadUnaligned(quaternions.GetY() + index),
+                         VecType::LoadUnaligned(quaternions.GetZ() + index), VecType::LoadUnaligned(quaternions.GetW() + index) };
+            }
+
+            template<class VecType>
+            AZ_MATH_INLINE void StoreQuaternions(QuaternionSoa& quaternions, size_t index, const QuaternionLanes<VecType>& value)
+            {
+                VecType::StoreUnaligned(quaternions.GetX() + index, value.m_x);
+                VecType::StoreUnaligned(quaternions.GetY() + index, value.m_y);
+                VecType::StoreUnaligned(quaternions.GetZ() + index, value.m_z);
+                VecType::StoreUnaligned(quaternions.GetW() + index, value.m_w);
+            }
+
+            template<class VecType>
+            AZ_MATH_INLINE Vector3Lanes<VecType> LoadVectors(const Vector3Soa& vectors, size_t index)
+            {
+                return { VecType::LoadUnaligned(vectors.GetX() + index), VecType::LoadUnaligned(vectors.GetY() + index),
+                         VecType::LoadUnaligned(vectors.GetZ() + index) };
+            }
+
+            template<class VecType>
+            AZ_MATH_INLINE void StoreVectors(Vector3Soa& vectors, size_t index, const Vector3Lanes<VecType>& value)
+            {
+                VecType::StoreUnaligned(vectors.GetX() + index, value.m_x);
+                VecType::StoreUnaligned(vectors.GetY() + index, value.m_y);
+                VecType::StoreUnaligned(vectors.GetZ() + index, value.m_z);
+            }
+
+            AZ_MATH_INLINE QuaternionLanes<Vec8> SplatQuaternion(const Quaternion& quaternion)
+            {
+                return { Vec8::Splat(quaternion.GetX()), Vec8::Splat(quaternion.GetY()),
+                         Vec8::Splat(quaternion.GetZ()), Vec8::Splat(quaternion.GetW()) };
+            }
+
+            AZ_MATH_INLINE Vec8::FloatType Dot3(const Vector3Lanes<Vec8>& lhs, const Vector3Lanes<Vec8>& rhs)
+            {
+                return Vec8::Madd(lhs.m_x, rhs.m_x, Vec8::Madd(lhs.m_y, rhs.m_y, Vec8::Mul(lhs.m_z, rhs.m_z)));
+            }
+
+            //! Same as Quaternion::operator*
+            AZ_MATH_INLINE QuaternionLanes<Vec8> Multiply(const QuaternionLanes<Vec8>& lhs, const QuaternionLanes<Vec8>& rhs)
+            {
+                QuaternionLanes<Vec8> result;
+                result.m_x = Vec8::Sub(
+                    Vec8::Madd(lhs.m_w, rhs.m_x, Vec8::Madd(lhs.m_x, rhs.m_w, Vec8::Mul(lhs.m_y, rhs.m_z))), Vec8::Mul(lhs.m_z, rhs.m_y));
+                result.m_y = Vec8::Sub(
+                    Vec8::Madd(lhs.m_w, rhs.m_y, Vec8::Madd(lhs.m_y, rhs.m_w, Vec8::Mul(lhs.m_z, rhs.m_x))), Vec8::Mul(lhs.m_x, rhs.m_z));
+                result.m_z = Vec8::Sub(
+                    Vec8::Madd(lhs.m_w, rhs.m_z, Vec8::Madd(lhs.m_z, rhs.m_w, Vec8::Mul(lhs.m_x, rhs.m_y))), Vec8::Mul(lhs.m_y, rhs.m_x));
+                result.m_w = Vec8::Sub(
+                    Vec8::Mul(lhs.m_w, rhs.m_w),
+                    Vec8::Madd(lhs.m_x, rhs.m_x, Vec8::Madd(lhs.m_y, rhs.m_y, Vec8::Mul(lhs.m_z, rhs.m_z))));
+                return result;
+            }
+
+            //! Same as Quaternion::TransformVector, which computes
+            //! 2 * dot(q, v) * q + (w * w - dot(q, q)) * v + 2 * w * cross(q, v) with q the imaginary part.
+            AZ_MATH_INLINE Vector3Lanes<Vec8> Rotate(const QuaternionLanes<Vec8>& rotation, const Vector3Lanes<Vec8>& vector)
+            {
+                using FloatType = Vec8::FloatType;
+                const FloatType two = Vec8::Splat(2.0f);
+                const Vector3Lanes<Vec8> imaginary{ rotation.m_x, rotation.m_y, rotation.m_z };
+                const FloatType dotScale = Vec8::Mul(two, Dot3(imaginary, vector));
+                const FloatType vectorScale = Vec8::Sub(Vec8::Mul(rotation.m_w, rotation.m_w), Dot3(imaginary, imaginary));
+                const FloatType crossScale = Vec8::Mul(two, rotation.m_w);
+
+                const FloatType crossX = Vec8::Sub(Vec8::Mul(rotation.m_y, vector.m_z), Vec8::Mul(rotation.m_z, vector.m_y));
+                const FloatType crossY = Vec8::Sub(Vec8::Mul(rotation.m_z, vector.m_x), Vec8::Mul(rotation.m_x, vector.m_z));
+                const FloatType crossZ = Vec8::Sub(Vec8::Mul(rotation.m_x, vector.m_y), Vec8::Mul(rotation.m_y, vector.m_x));
+
+                Vector3Lanes<Vec8> result;
+                result.m_x = Vec8::Madd(dotScale, rotation.m_x, Vec8::Madd(vectorScale, vector.m_x, Vec8::Mul(crossScale, crossX)));
+                result.m_y = Vec8::Madd(dotScale, rotation.m_y, Vec8::Madd(vectorScale, vector.m_y, Vec8::Mul(crossScale, crossY)));
+                result.m_z = Vec8::Madd(dotScale, rotation.m_z, Vec8::Madd(vectorScale, vector.m_z, Vec8::Mul(crossScale, crossZ)));
+                return result;
+            }
+        } // namespace Internal
+
+        void TransformPoints(const Transform& transform, const Vector3Soa& points, Vector3Soa& results)
+        {
+            results.Resize(points.GetSize());
+            const size_t paddedSize = MathBatchInternal::GetPaddedSize(points.GetSize());
+
+            const Internal::QuaternionLanes<Vec8> rotation = Internal::SplatQuaternion(transform.GetRotation());
+            const Vec8::FloatType scale = Vec8::Splat(transform.GetUniformScale());
+            const Vector3& translation = transform.GetTranslation();
+            const Vec8::FloatType translationX = Vec8::Splat(translation.GetX());
+            const Vec8::FloatType translationY = Vec8::Splat(translation.GetY());
+            const Vec8::FloatType translationZ = Vec8::Splat(translation.GetZ());
+
+            for (size_t i = 0; i < paddedSize; i += ElementCount)
+            {
+                Internal::Vector3Lanes<Vec8> point = Internal::LoadVectors<Vec8>(points, i);
+                point.m_x = Vec8::Mul(point.m_x, scale);
+                point.m_y = Vec8::Mul(point.m_y, scale);
+                point.m_z = Vec8::Mul(point.m_z, scale);
+
+                Internal::Vector3Lanes<Vec8> result = Internal::Rotate(rotation, point);
+                result.m_x = Vec8::Add(result.m_x, translationX);
+                result.m_y = Vec8::Add(result.m_y, translationY);
+                result.m_z = Vec8::Add(result.m_z, translationZ);
+                Internal::StoreVectors(results, i, result);
+            }
+        }
+
+        void TransformPoints(const Matrix3x4& matrix, const Vector3Soa& points, Vector3Soa& results)
+        {
+            results.Resize(points.GetSize());
+            const size_t paddedSize = MathBatchInternal::GetPaddedSize(points.GetSize());
+
+            Vec8::FloatType elements[3][4];
+            for (int32_t row = 0; row < 3; ++row)
+            {
+                for (int32_t column = 0; column < 4; ++column)
+                {
+                    elements[row][column] = Vec8::Splat(matrix.GetElement(row, column));
+                }
+            }
+
+            for (size_t i = 0; i < paddedSize; i += ElementCount)
+            {
+                const Internal::Vector3Lanes<Vec8> point = Internal::LoadVectors<Vec8>(points, i);
+                Internal::Vector3Lanes<Vec8> result;
+                Vec8::FloatType* resultRows[3] = { &result.m_x, &result.m_y, &result.m_z };
+                for (int32_t row = 0; row < 3; ++row)
+                {
+                    *resultRows[row] = Vec8::Madd(elements[row][0], point.m_x,
+                        Vec8::Madd(elements[row][1], point.m_y, Vec8::Madd(elements[row][2], point.m_z, elements[row][3])));
+                }
+                Internal::StoreVectors(results, i, result);
+            }
+        }
+
+        void ComposeTransforms(const TransformSoa& lhs, const TransformSoa& rhs, TransformSoa& results)
+        {
+            AZ_MATH_ASSERT(lhs.GetSize() == rhs.GetSize(), "The transform arrays must have the same size");
+            results.Resize(lhs.GetSize());
+            const size_t paddedSize = MathBatchInternal::GetPaddedSize(lhs.GetSize());
+
+            for (size_t i = 0; i < paddedSize; i += ElementCount)
+            {
+                const Internal::QuaternionLanes<Vec8> lhsRotation = Internal::LoadQuaternions<Vec8>(lhs.GetRotations(), i);
+                const Internal::QuaternionLanes<Vec8> rhsRotation = Internal::LoadQuaternions<Vec8>(rhs.GetRotations(), i);
+                const Vec8::FloatType lhsScale = Vec8::LoadUnaligned(lhs.GetScales() + i);
+                const Vec8::FloatType rhsScale = Vec8::LoadUnaligned(rhs.GetScales() + i);
+
+                Internal::StoreQuaternions(results.GetRotations(), i, Internal::Multiply(lhsRotation, rhsRotation));
+                Vec8::StoreUnaligned(results.GetScales() + i, Vec8::Mul(lhsScale, rhsScale));
+
+                // Same as lhs.TransformPoint(rhs.GetTranslation())
+                Internal::Vector3Lanes<Vec8> rhsTranslation = Internal::LoadVectors<Vec8>(rhs.GetTranslations(), i);
+                rhsTranslation.m_x = Vec8::Mul(rhsTranslation.m_x, lhsScale);
+                rhsTranslation.m_y = Vec8::Mul(rhsTranslation.m_y, lhsScale);
+                rhsTranslation.m_z = Vec8::Mul(rhsTranslation.m_z, lhsScale);
+                const Internal::Vector3Lanes<Vec8> lhsTranslation = Internal::LoadVectors<Vec8>(lhs.GetTranslations(), i);
+                Internal::Vector3Lanes<Vec8> translation = Internal::Rotate(lhsRotation, rhsTranslation);
+                translation.m_x = Vec8::Add(translation.m_x, lhsTranslation.m_x);
+                translation.m_y = Vec8::Add(translation.m_y, lhsTranslation.m_y);
+                translation.m_z = Vec8::Add(translation.m_z, lhsTranslation.m_z);
+                Internal::StoreVectors(results.GetTranslations(), i, translation);
+            }
+        }
+
+        void IntersectAabbs(const Frustum& frustum, const AabbSoa& aabbs, AZStd::span<IntersectResult> results)
+        {
+            AZ_MATH_ASSERT(aabbs.GetSize() == results.size(), "There must be one result per AABB");
+            const size_t size = AZStd::min(aabbs.GetSize(), results.size());
+            const size_t paddedSize = MathBatchInternal::GetPaddedSize(size);
+
+            // For each plane, the components of the AABB corners that are the farthest and the nearest along the plane normal
+            struct PlaneSetup
+            {
+                Vec8::FloatType m_normal[3];
+                Vec8::FloatType m_distance;
+                const float* m_farthest[3];
+                const float* m_nearest[3];
+            };
+            PlaneSetup planes[Frustum::PlaneId::MAX];
+            const Vector3Soa& mins = aabbs.GetMins();
+            const Vector3Soa& maxs = aabbs.GetMaxs();
+            const float* minComponents[3] = { mins.GetX(), mins.GetY(), mins.GetZ() };
+            const float* maxComponents[3] = { maxs.GetX(), maxs.GetY(), maxs.GetZ() };
+            for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                const Vector4 plane = frustum.GetPlane(planeId).GetPlaneEquationCoefficients();
+                PlaneSetup& setup = planes[planeId];
+                for (int32_t component = 0; component < 3; ++component)
+                {
+                    const float normal = plane.GetElement(component);
+                    setup.m_normal[component] = Vec8::Splat(normal);
+                    // Matches Aabb::GetSupport
+                    setup.m_farthest[component] = normal > 0.0f ? maxComponents[component] : minComponents[component];
+                    setup.m_nearest[component] = normal < 0.0f ? maxComponents[component] : minComponents[component];
+                }
+                setup.m_distance = Vec8::Splat(plane.GetW());
+            }
+
+            const Vec8::FloatType zero = Vec8::ZeroFloat();
+            const Vec8::FloatType one = Vec8::Splat(1.0f);
+            const Vec8::FloatType two = Vec8::Splat(2.0f);
+            for (size_t i = 0; i < paddedSize; i += ElementCount)
+            {
+                Vec8::FloatType exterior = zero;
+                Vec8::FloatType interior = Vec8::CmpEq(zero, zero);
+                for (const PlaneSetup& setup : planes)
+                {
+                    Vec8::FloatType farthestDistance = setup.m_distance;
+                    Vec8::FloatType nearestDistance = setup.m_distance;
+                    for (int32_t component = 0; component < 3; ++component)
+                    {
+                        farthestDistance =
+                            Vec8::Madd(setup.m_normal[component], Vec8::LoadUnaligned(setup.m_farthest[component] + i), farthestDistance);
+                        nearestDistance =
+                            Vec8::Madd(setup.m_normal[component], Vec8::LoadUnaligned(setup.m_nearest[component] + i), nearestDistance);
+                    }
+                    exterior = Vec8::Or(exterior, Vec8::CmpLt(farthestDistance, zero));
+                    interior = Vec8::And(interior, Vec8::CmpGtEq(nearestDistance, zero));
+                }
+
+                // 0 for interior, 1 for overlaps and 2 for exterior, in the order of IntersectResult
+                const Vec8::FloatType code = Vec8::Select(two, Vec8::Select(zero, one, interior), exterior);
+                float codes[ElementCount];
+                Vec8::StoreUnaligned(codes, code);
+                const size_t laneCount = AZStd::min(ElementCount, size - i);
+                for (size_t lane = 0; lane < laneCount; ++lane)
+                {
+                    results[i + lane] = static_cast<IntersectResult>(static_cast<int>(codes[lane]));
+                }
+            }
+        }
+
+        void SlerpQuaternions(const QuaternionSoa& from, const QuaternionSoa& to, float t, QuaternionSoa& results)
+        {
+            AZ_MATH_ASSERT(from.GetSize() == to.GetSize(), "The quaternion arrays must have the same size");
+            results.Resize(from.GetSize());
+            const size_t paddedSize = MathBatchInternal::GetPaddedSize(from.GetSize());
+
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType lerpThreshold = Vec4::Splat(0.9999f);
+            const Vec4::FloatType fromWeight = Vec4::Splat(1.0f - t);
+            const Vec4::FloatType toWeight = Vec4::Splat(t);
+            for (size_t i = 0; i < paddedSize; i += Vec4::ElementCount)
+            {
+                const Internal::QuaternionLanes<Vec4> fromQuaternion = Internal::LoadQuaternions<Vec4>(from, i);
+                const Internal::QuaternionLanes<Vec4> toQuaternion = Internal::LoadQuaternions<Vec4>(to, i);
+
+                const Vec4::FloatType dot = Vec4::Madd(fromQuaternion.m_x, toQuaternion.m_x,
+                    Vec4::Madd(fromQuaternion.m_y, toQuaternion.m_y,
+                        Vec4::Madd(fromQuaternion.m_z, toQuaternion.m_z, Vec4::Mul(fromQuaternion.m_w, toQuaternion.m_w))));
+                const Vec4::FloatType cosom = Vec4::Abs(dot);
+
+                // Same as Quaternion::Slerp, which lerps when the quaternions are very close
+                const Vec4::FloatType omega = Vec4::Acos(Vec4::Min(cosom, Vec4::Splat(1.0f)));
+                const Vec4::FloatType inverseSinom = Vec4::Reciprocal(Vec4::Sin(omega));
+                const Vec4::FloatType useLerp = Vec4::CmpGtEq(cosom, lerpThreshold);
+                Vec4::FloatType fromScale = Vec4::Select(fromWeight, Vec4::Mul(Vec4::Sin(Vec4::Mul(fromWeight, omega)), inverseSinom), useLerp);
+                const Vec4::FloatType toScale = Vec4::Select(toWeight, Vec4::Mul(Vec4::Sin(Vec4::Mul(toWeight, omega)), inverseSinom), useLerp);
+                fromScale = Vec4::Select(Vec4::Sub(zero, fromScale), fromScale, Vec4::CmpLt(dot, zero));
+
+                Internal::QuaternionLanes<Vec4> result;
+                result.m_x = Vec4::Madd(fromQuaternion.m_x, fromScale, Vec4::Mul(toQuaternion.m_x, toScale));
+                result.m_y = Vec4::Madd(fromQuaternion.m_y, fromScale, Vec4::Mul(toQuaternion.m_y, toScale));
+                result.m_z = Vec4::Madd(fromQuaternion.m_z, fromScale, Vec4::Mul(toQuaternion.m_z, toScale));
+                result.m_w = Vec4::Madd(fromQuaternion.m_w, fromScale, Vec4::Mul(toQuaternion.m_w, toScale));
+                Internal::StoreQuaternions(results, i, result);
+            }
+        }
+    } // namespace MathBatch
+} // namespace AZ
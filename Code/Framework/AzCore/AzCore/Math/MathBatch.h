@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    //! Structure of arrays storage for the batch kernels in MathBatch.
+    //! Each component is stored in its own array, padded to a multiple of Simd::Vec8::ElementCount with zeros so the
+    //! kernels can process eight values at a time without a scalar remainder loop.
+    //! @{
+    class Vector3Soa
+    {
+    public:
+        Vector3Soa() = default;
+        explicit Vector3Soa(size_t size);
+
+        //! Changes the number of values. New values are set to zero.
+        void Resize(size_t size);
+        size_t GetSize() const;
+
+        Vector3 Get(size_t index) const;
+        void Set(size_t index, const Vector3& value);
+
+        //! Component arrays, which can be accessed up to the padded size.
+        //! @{
+        float* GetX();
+        float* GetY();
+        float* GetZ();
+        const float* GetX() const;
+        const float* GetY() const;
+        const float* GetZ() const;
+        //! @}
+
+    private:
+        AZStd::vector<float> m_x;
+        AZStd::vector<float> m_y;
+        AZStd::vector<float> m_z;
+        size_t m_size = 0;
+    };
+
+    class QuaternionSoa
+    {
+    public:
+        QuaternionSoa() = default;
+        explicit QuaternionSoa(size_t size);
+
+        //! Changes the number of values. New values are set to zero.
+        void Resize(size_t size);
+        size_t GetSize() const;
+
+        Quaternion Get(size_t index) const;
+        void Set(size_t index, const Quaternion& value);
+
+        //! Component arrays, which can be accessed up to the padded size.
+        //! @{
+        float* GetX();
+        float* GetY();
+        float* GetZ();
+        float* GetW();
+        const float* GetX() const;
+        const float* GetY() const;
+        const float* GetZ() const;
+        const float* GetW() const;
+        //! @}
+
+    private:
+        AZStd::vector<float> m_x;
+        AZStd::vector<float> m_y;
+        AZStd::vector<float> m_z;
+        AZStd::vector<float> m_w;
+        size_t m_size = 0;
+    };
+
+    class TransformSoa
+    {
+    public:
+        TransformSoa() = default;
+        explicit TransformSoa(size_t size);
+
+        //! Changes the number of values. New values are set to zero.
+        void Resize(size_t size);
+        size_t GetSize() const;
+
+        Transform Get(size_t index) const;
+        void Set(size_t index, const Transform& value);
+
+        QuaternionSoa& GetRotations();
+        Vector3Soa& GetTranslations();
+        float* GetScales();
+        const QuaternionSoa& GetRotations() const;
+        const Vector3Soa& GetTranslations() const;
+        const float* GetScales() const;
+
+    private:
+        QuaternionSoa m_rotations;
+        Vector3Soa m_translations;
+        AZStd::vector<float> m_scales;
+    };
+
+    class AabbSoa
+    {
+    public:
+        AabbSoa() = default;
+        explicit AabbSoa(size_t size);
+
+        //! Changes the number of values. New values are set to zero.
+        void Resize(size_t size);
+        size_t GetSize() const;
+
+        Aabb Get(size_t index) const;
+        void Set(size_t index, const Aabb& value);
+
+        Vector3Soa& GetMins();
+        Vector3Soa& GetMaxs();
+        const Vector3Soa& GetMins() const;
+        const Vector3Soa& GetMaxs() const;
+
+    private:
+        Vector3Soa m_mins;
+        Vector3Soa m_maxs;
+    };
+    //! @}
+
+    //! Kernels processing arrays of math values, eight values at a time.
+    //! They give the same results as the matching per-object functions, within floating point tolerance.
+    //! The output containers are resized to the size of the input.
+    namespace MathBatch
+    {
+        //! Same as calling Transform::TransformPoint for each of the points.
+        void TransformPoints(const Transform& transform, const Vector3Soa& points, Vector3Soa& results);
+
+        //! Same as calling Matrix3x4::TransformPoint for each of the points.
+        void TransformPoints(const Matrix3x4& matrix, const Vector3Soa& points, Vector3Soa& results);
+
+        //! Same as lhs[i] * rhs[i] for each pair of transforms. The inputs must have the same size.
+        void ComposeTransforms(const TransformSoa& lhs, const TransformSoa& rhs, TransformSoa& results);
+
+        //! Same as calling Frustum::IntersectAabb for each of the AABBs.
+        //! @param results Receives one result per AABB, must be the same size as aabbs.
+        void IntersectAabbs(const Frustum& frustum, const AabbSoa& aabbs, AZStd::span<IntersectResult> results);
+
+        //! Same as from[i].Slerp(to[i], t) for each pair of quaternions. The inputs must have the same size.
+        void SlerpQuaternions(const QuaternionSoa& from, const QuaternionSoa& to, float t, QuaternionSoa& results);
+    } // namespace MathBatch
+} // namespace AZ
+
+#include <AzCore/Math/MathBatch.inl>
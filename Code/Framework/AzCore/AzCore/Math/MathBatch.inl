@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AZ
+{
+    namespace MathBatchInternal
+    {
+        AZ_MATH_INLINE size_t GetPaddedSize(size_t size)
+        {
+            constexpr size_t ElementCount = Simd::Vec8::ElementCount;
+            return (size + ElementCount - 1) / ElementCount * ElementCount;
+        }
+    } // namespace MathBatchInternal
+
+
+    AZ_MATH_INLINE Vector3Soa::Vector3Soa(size_t size)
+    {
+        Resize(size);
+    }
+
+
+    AZ_MATH_INLINE void Vector3Soa::Resize(size_t size)
+    {
+        const size_t paddedSize = MathBatchInternal::GetPaddedSize(size);
+        // Shrinking keeps the padding at zero
+        for (size_t i = size; i < AZStd::min(m_size, paddedSize); ++i)
+        {
+            m_x[i] = m_y[i] = m_z[i] = 0.0f;
+        }
+        m_x.resize(paddedSize, 0.0f);
+        m_y.resize(paddedSize, 0.0f);
+        m_z.resize(paddedSize, 0.0f);
+        m_size = size;
+    }
+
+
+    AZ_MATH_INLINE size_t Vector3Soa::GetSize() const
+    {
+        return m_size;
+    }
+
+
+    AZ_MATH_INLINE Vector3 Vector3Soa::Get(size_t index) const
+    {
+        AZ_MATH_ASSERT(index < m_size, "Index %zu out of range", index);
+        return Vector3(m_x[index], m_y[index], m_z[index]);
+    }
+
+
+    AZ_MATH_INLINE void Vector3Soa::Set(size_t index, const Vector3& value)
+    {
+        AZ_MATH_ASSERT(index < m_size, "Index %zu out of range", index);
+        m_x[index] = value.GetX();
+        m_y[index] = value.GetY();
+        m_z[index] = value.GetZ();
+    }
+
+
+    AZ_MATH_INLINE float* Vector3Soa::GetX()
+    {
+        return m_x.data();
+    }
+
+
+    AZ_MATH_INLINE float* Vector3Soa::GetY()
+    {
+        return m_y.data();
+    }
+
+
+    AZ_MATH_INLINE float* Vector3Soa::GetZ()
+    {
+        return m_z.data();
+    }
+
+
+    AZ_MATH_INLINE const float* Vector3Soa::GetX() const
+    {
+        return m_x.data();
+    }
+
+
+    AZ_MATH_INLINE const float* Vector3Soa::GetY() const
+    {
+        return m_y.data();
+    }
+
+
+    AZ_MATH_INLINE const float* Vector3Soa::GetZ() const
+    {
+        return m_z.data();
+    }
+
+
+    AZ_MATH_INLINE QuaternionSoa::QuaternionSoa(size_t size)
+    {
+        Resize(size);
+    }
+
+
+    AZ_MATH_INLINE void QuaternionSoa::Resize(size_t size)
+    {
+        const size_t paddedSize = MathBatchInternal::GetPaddedSize(size);
+        // Shrinking keeps the padding at zero
+        for (size_t i = size; i < AZStd::min(m_size, paddedSize); ++i)
+        {
+            m_x[i] = m_y[i] = m_z[i] = m_w[i] = 0.0f;
+        }
+        m_x.resize(paddedSize, 0.0f);
+        m_y.resize(paddedSize, 0.0f);
+        m_z.resize(paddedSize, 0.0f);
+        m_w.resize(paddedSize, 0.0f);
+        m_size = size;
+    }
+
+
+    AZ_MATH_INLINE size_t QuaternionSoa::GetSize() const
+    {
+        return m_size;
+    }
+
+
+    AZ_MATH_INLINE Quaternion QuaternionSoa::Get(size_t index) const
+    {
+        AZ_MATH_ASSERT(index < m_size, "Index %zu out of range", index);
+        return Quaternion(m_x[index], m_y[index], m_z[index], m_w[index]);
+    }
+
+
+    AZ_MATH_INLINE void QuaternionSoa::Set(size_t index, const Quaternion& value)
+    {
+        AZ_MATH_ASSERT(index < m_size, "Index %zu out of range", index);
+        m_x[index] = value.GetX();
+        m_y[index] = value.GetY();
+        m_z[index] = value.GetZ();
+        m_w[index] = value.GetW();
+    }
+
+
+    AZ_MATH_INLINE float* QuaternionSoa::GetX()
+    {
+        return m_x.data();
+    }
+
+
+    AZ_MATH_INLINE float* QuaternionSoa::GetY()
+    {
+        return m_y.data();
+    }
+
+
+    AZ_MATH_INLINE float* QuaternionSoa::GetZ()
+    {
+        return m_z.data();
+    }
+
+
+    AZ_MATH_INLINE float* QuaternionSoa::GetW()
+    {
+        return m_w.data();
+    }
+
+
+    AZ_MATH_INLINE const float* QuaternionSoa::GetX() const
+    {
+        return m_x.data();
+    }
+
+
+    AZ_MATH_INLINE const float* QuaternionSoa::GetY() const
+    {
+        return m_y.data();
+    }
+
+
+    AZ_MATH_INLINE const float* QuaternionSoa::GetZ() const
+    {
+        return m_z.data();
+    }
+
+
+    AZ_MATH_INLINE const float* QuaternionSoa::GetW() const
+    {
+        return m_w.data();
+    }
+
+
+    AZ_MATH_INLINE TransformSoa::TransformSoa(size_t size)
+    {
+        Resize(size);
+    }
+
+
+    AZ_MATH_INLINE void TransformSoa::Resize(size_t size)
+    {
+        const size_t paddedSize = MathBatchInternal::GetPaddedSize(size);
+        // Shrinking keeps the padding at zero
+        for (size_t i = size; i < AZStd::min(GetSize(), paddedSize); ++i)
+        {
+            m_scales[i] = 0.0f;
+        }
+        m_rotations.Resize(size);
+        m_translations.Resize(size);
+        m_scales.resize(paddedSize, 0.0f);
+    }
+
+
+    AZ_MATH_INLINE size_t TransformSoa::GetSize() const
+    {
+        return m_rotations.GetSize();
+    }
+
+
+    AZ_MATH_INLINE Transform TransformSoa::Get(size_t index) const
+    {
+        return Transform(m_translations.Get(index), m_rotations.Get(index), m_scales[index]);
+    }
+
+
+    AZ_MATH_INLINE void TransformSoa::Set(size_t index, const Transform& value)
+    {
+        m_rotations.Set(index, value.GetRotation());
+        m_translations.Set(index, value.GetTranslation());
+        m_scales[index] = value.GetUniformScale();
+    }
+
+
+    AZ_MATH_INLINE QuaternionSoa& TransformSoa::GetRotations()
+    {
+        return m_rotations;
+    }
+
+
+    AZ_MATH_INLINE Vector3Soa& TransformSoa::GetTranslations()
+    {
+        return m_translations;
+    }
+
+
+    AZ_MATH_INLINE float* TransformSoa::GetScales()
+    {
+        return m_scales.data();
+    }
+
+
+    AZ_MATH_INLINE const QuaternionSoa& TransformSoa::GetRotations() const
+    {
+        return m_rotations;
+    }
+
+
+    AZ_MATH_INLINE const Vector3Soa& TransformSoa::GetTranslations() const
+    {
+        return m_translations;
+    }
+
+
+    AZ_MATH_INLINE const float* TransformSoa::GetScales() const
+    {
+        return m_scales.data();
+    }
+
+
+    AZ_MATH_INLINE AabbSoa::AabbSoa(size_t size)
+    {
+        Resize(size);
+    }
+
+
+    AZ_MATH_INLINE void AabbSoa::Resize(size_t size)
+    {
+        m_mins.Resize(size);
+        m_maxs.Resize(size);
+    }
+
+
+    AZ_MATH_INLINE size_t AabbSoa::GetSize() const
+    {
+        return m_mins.GetSize();
+    }
+
+
+    AZ_MATH_INLINE Aabb AabbSoa::Get(size_t index) const
+    {
+        return Aabb::CreateFromMinMax(m_mins.Get(index), m_maxs.Get(index));
+    }
+
+
+    AZ_MATH_INLINE void AabbSoa::Set(size_t index, const Aabb& value)
+    {
+        m_mins.Set(index, value.GetMin());
+        m_maxs.Set(index, value.GetMax());
+    }
+
+
+    AZ_MATH_INLINE Vector3Soa& AabbSoa::GetMins()
+    {
+        return m_mins;
+    }
+
+
+    AZ_MATH_INLINE Vector3Soa& AabbSoa::GetMaxs()
+    {
+        return m_maxs;
+    }
+
+
+    AZ_MATH_INLINE const Vector3Soa& AabbSoa::GetMins() const
+    {
+        return m_mins;
+    }
+
+
+    AZ_MATH_INLINE const Vector3Soa& AabbSoa::GetMaxs() const
+    {
+        return m_maxs;
+    }
+} // namespace AZ
@@ -89,6 +89,11 @@ namespace AZ
             return static_cast<size_t>(stream.Write(sizeof(tempData), reinterpret_cast<void*>(&tempData)));
         }
 
+        size_t GetTriviallyCopyableSize() const override
+        {
+            return AZStd::is_trivially_copyable_v<T> ? sizeof(T) : 0;
+        }
+
         size_t DataToText(IO::GenericStream& in, IO::GenericStream& out, bool isDataBigEndian /*= false*/) override
         {
             if (in.GetLength() < NumFloats * sizeof(float))
@@ -21,6 +21,12 @@
 #   endif
 #endif
 
+// AVX2 is an extension of the SSE implementation for platforms that can target it
+#if !defined(AZ_TRAIT_USE_PLATFORM_SIMD_AVX2) || !AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#   undef AZ_TRAIT_USE_PLATFORM_SIMD_AVX2
+#   define AZ_TRAIT_USE_PLATFORM_SIMD_AVX2 0
+#endif
+
 namespace AZ
 {
     namespace Simd
@@ -50,6 +56,7 @@ namespace AZ
 #include <AzCore/Math/SimdMathVec2.h>
 #include <AzCore/Math/SimdMathVec3.h>
 #include <AzCore/Math/SimdMathVec4.h>
+#include <AzCore/Math/SimdMathVec8.h>
 
 namespace AZ
 {
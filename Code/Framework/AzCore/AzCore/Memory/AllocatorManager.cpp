@@ -422,6 +422,69 @@ namespace AZ
         "NOTE: smaller values for the max index can be specified and still print out all the allocations, as long as it larger than the "
         "total number of allocation records\n");
 
+    static void AllocationSamplingStart(const AZ::ConsoleCommandContainer& arguments)
+    {
+        size_t samplingInterval = AllocationSampler::DefaultSamplingInterval;
+        if (!arguments.empty() && (!ConsoleTypeHelpers::ToValue(samplingInterval, arguments[0]) || samplingInterval == 0))
+        {
+            AZ_Error("mem", false, R"(Unable to convert the sampling interval argument of "%.*s" to a positive integer.)", AZ_STRING_ARG(arguments[0]));
+            return;
+        }
+        AllocatorManager::Instance().GetAllocationSampler().SetSamplingInterval(samplingInterval);
+        AZ_Printf("mem", "Sampling allocations on average once every %zu bytes.\n", samplingInterval);
+    }
+    AZ_CONSOLEFREEFUNC("sys_AllocationSamplingStart", AllocationSamplingStart, AZ::ConsoleFunctorFlags::Null,
+        "Start sampling the SystemAllocator allocations, on average once every <interval> bytes.\n"
+        "The sampled allocations are aggregated by call stack, use sys_AllocationSamplingDump to write them out.\n"
+        "usage: sys_AllocationSamplingStart [<interval>]\n"
+        "Ex. `sys_AllocationSamplingStart 65536`");
+
+    static void AllocationSamplingStop([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        AllocatorManager::Instance().GetAllocationSampler().SetSamplingInterval(0);
+    }
+    AZ_CONSOLEFREEFUNC("sys_AllocationSamplingStop", AllocationSamplingStop, AZ::ConsoleFunctorFlags::Null,
+        "Stop sampling allocations. The samples collected so far are kept and their frees are still tracked.");
+
+    static void AllocationSamplingReset([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        AllocatorManager::Instance().GetAllocationSampler().Reset();
+    }
+    AZ_CONSOLEFREEFUNC("sys_AllocationSamplingReset", AllocationSamplingReset, AZ::ConsoleFunctorFlags::Null,
+        "Discard all the allocation samples collected so far.");
+
+    static void AllocationSamplingDump(const AZ::ConsoleCommandContainer& arguments)
+    {
+        AZ::IO::FixedMaxPath filePath;
+        if (!arguments.empty())
+        {
+            filePath = arguments[0];
+        }
+        else
+        {
+            // Write to <dev-write-storage>/allocation_samples/samples.<iso8601-timestamp>.<process-id>.json
+            AZ::Date::Iso8601TimestampString utcTimestampString;
+            AZ::Date::GetFilenameCompatibleFormatNow(utcTimestampString);
+            AZStd::fixed_string<32> processIdString;
+            AZStd::to_string(processIdString, AZ::Platform::GetCurrentProcessId());
+            filePath = AZ::IO::FixedMaxPath{ AZ::Utils::GetDevWriteStoragePath() } / "allocation_samples" /
+                AZ::IO::FixedMaxPathString::format("samples.%s.%s.json", utcTimestampString.c_str(), processIdString.c_str());
+        }
+
+        constexpr auto openMode = AZ::IO::OpenMode::ModeCreatePath | AZ::IO::OpenMode::ModeWrite;
+        AZ::IO::SystemFileStream sampleStream(filePath.c_str(), openMode);
+        if (!sampleStream.IsOpen() || !AllocatorManager::Instance().GetAllocationSampler().WriteToStream(sampleStream))
+        {
+            AZ_Error("mem", false, R"("sys_AllocationSamplingDump" command could not write to file path of "%s".)", filePath.c_str());
+            return;
+        }
+        AZ_Printf("mem", "Allocation samples written to \"%s\".\n", filePath.c_str());
+    }
+    AZ_CONSOLEFREEFUNC("sys_AllocationSamplingDump", AllocationSamplingDump, AZ::ConsoleFunctorFlags::Null,
+        "Write the sampled allocation call sites as json to the specified file path, which can be loaded in the Profiler gem's heap memory profiler.\n"
+        "If no file path is specified, the samples are written to <dev-write-storage>/allocation_samples/samples.<iso8601-timestamp>.<process-id>.json\n"
+        "usage: sys_AllocationSamplingDump [<file-path>]");
+
     static EnvironmentVariable<AllocatorManager>& GetAllocatorManagerEnvVar()
     {
         static EnvironmentVariable<AllocatorManager> s_allocManager;
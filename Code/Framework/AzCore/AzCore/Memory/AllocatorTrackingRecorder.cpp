@@ -8,14 +8,21 @@
 
 #include <AzCore/Memory/AllocatorTrackingRecorder.h>
 
-#if defined(AZ_ENABLE_TRACING)
-
+#include <AzCore/IO/GenericStreams.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/std/allocator_stateless.h>
-#include <AzCore/std/parallel/scoped_lock.h>
-#include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/parallel/spin_mutex.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/fixed_string.h>
+
+#include <math.h>
+
+#if defined(AZ_ENABLE_TRACING)
+
+#include <AzCore/std/containers/set.h>
 
 // Amount of stack trace entries to record (amount of functions to record)
 #define STACK_TRACE_DEPTH_RECORDING 20
@@ -197,6 +204,328 @@ namespace AZ
     }
 #endif
 
+    //////////////////////////////////////////////////////////////////////////
+    // AllocationSampler
+
+    struct AllocationSamplerData
+    {
+        struct LiveSample
+        {
+            size_t m_callSiteKey;
+            AZ::u64 m_estimatedBytes;
+        };
+
+        AZStd::spin_mutex m_mutex;
+        // Call sites keyed by the hash of their stack trace, colliding stacks are stored at the next free key
+        AZStd::unordered_map<size_t, AllocationSampler::CallSite, AZStd::hash<size_t>, AZStd::equal_to<size_t>, AZStd::stateless_allocator> m_callSites;
+        AZStd::unordered_map<void*, LiveSample, AZStd::hash<void*>, AZStd::equal_to<void*>, AZStd::stateless_allocator> m_liveSamples;
+    };
+
+    namespace
+    {
+        constexpr AZ::u16 LiveFilterSaturated = AZStd::numeric_limits<AZ::u16>::max();
+
+        // Trivially destructible so it is safe to use from allocations that happen during thread shutdown
+        struct AllocationSamplerThreadState
+        {
+            AZ::s64 m_bytesUntilSample;
+            size_t m_samplingInterval;
+            AZ::u64 m_randomState;
+            bool m_isSampling; //!< Guards against sampling the allocations made while recording a sample
+        };
+        thread_local AllocationSamplerThreadState t_allocationSamplerState;
+
+        // Draws the distance in bytes to the next sample from an exponential distribution, which makes every byte
+        // equally likely to be sampled independently of the allocation pattern
+        AZ::s64 GetNextSampleDistance(AllocationSamplerThreadState& state)
+        {
+            if (state.m_randomState == 0)
+            {
+                state.m_randomState = static_cast<AZ::u64>(reinterpret_cast<uintptr_t>(&state)) * 0x9E3779B97F4A7C15ull | 1;
+            }
+            // xorshift64*
+            state.m_randomState ^= state.m_randomState >> 12;
+            state.m_randomState ^= state.m_randomState << 25;
+            state.m_randomState ^= state.m_randomState >> 27;
+            const AZ::u64 random = state.m_randomState * 0x2545F4914F6CDD1Dull;
+            // uniform in (0, 1]
+            const double uniform = (static_cast<double>(random >> 11) + 1.0) * (1.0 / 9007199254740992.0);
+            return static_cast<AZ::s64>(-log(uniform) * static_cast<double>(state.m_samplingInterval)) + 1;
+        }
+
+        size_t HashStackTrace(const Debug::StackFrame* frames, unsigned int frameCount)
+        {
+            size_t hash = 0;
+            for (unsigned int i = 0; i < frameCount; ++i)
+            {
+                AZStd::hash_combine(hash, frames[i].m_programCounter);
+            }
+            return hash;
+        }
+
+        bool IsSameStackTrace(const AllocationSampler::CallSite& callSite, const Debug::StackFrame* frames, unsigned int frameCount)
+        {
+            if (callSite.m_stackFrameCount != frameCount)
+            {
+                return false;
+            }
+            for (unsigned int i = 0; i < frameCount; ++i)
+            {
+                if (callSite.m_stackTrace[i].m_programCounter != frames[i].m_programCounter)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void WriteEscapedString(IO::GenericStream& stream, const char* text)
+        {
+            const char* runStart = text;
+            for (const char* c = text; *c; ++c)
+            {
+                const unsigned char character = static_cast<unsigned char>(*c);
+                if (character == '"' || character == '\\' || character < 0x20)
+                {
+                    stream.Write(c - runStart, runStart);
+                    AZStd::fixed_string<8> escaped;
+                    if (character == '"' || character == '\\')
+                    {
+                        escaped = AZStd::fixed_string<8>::format("\\%c", character);
+                    }
+                    else
+                    {
+                        escaped = AZStd::fixed_string<8>::format("\\u%04x", character);
+                    }
+                    stream.Write(escaped.size(), escaped.data());
+                    runStart = c + 1;
+                }
+            }
+            stream.Write(strlen(runStart), runStart);
+        }
+    } // namespace
+
+    AllocationSampler::AllocationSampler()
+        : m_data(new (AZStd::stateless_allocator().allocate(sizeof(AllocationSamplerData), alignof(AllocationSamplerData))) AllocationSamplerData())
+    {
+    }
+
+    AllocationSampler::~AllocationSampler()
+    {
+        m_samplingInterval.store(0, AZStd::memory_order_relaxed);
+        if (AZStd::atomic<AZ::u16>* liveFilter = m_liveFilter.exchange(nullptr, AZStd::memory_order_acq_rel))
+        {
+            AZStd::stateless_allocator().deallocate(liveFilter, sizeof(AZStd::atomic<AZ::u16>) << LiveFilterBits, alignof(AZStd::atomic<AZ::u16>));
+        }
+        m_data->~AllocationSamplerData();
+        AZStd::stateless_allocator().deallocate(m_data, sizeof(AllocationSamplerData), alignof(AllocationSamplerData));
+    }
+
+    void AllocationSampler::SetSamplingInterval(size_t samplingInterval)
+    {
+        if (samplingInterval != 0 && !m_liveFilter.load(AZStd::memory_order_acquire))
+        {
+            AZStd::scoped_lock lock(m_data->m_mutex);
+            if (!m_liveFilter.load(AZStd::memory_order_relaxed))
+            {
+                // The filter is only created once and kept until destruction, OnDeallocation can read it without locking
+                void* memory = AZStd::stateless_allocator().allocate(sizeof(AZStd::atomic<AZ::u16>) << LiveFilterBits, alignof(AZStd::atomic<AZ::u16>));
+                auto liveFilter = static_cast<AZStd::atomic<AZ::u16>*>(memory);
+                for (size_t i = 0; i < (size_t{ 1 } << LiveFilterBits); ++i)
+                {
+                    new (&liveFilter[i]) AZStd::atomic<AZ::u16>(0);
+                }
+                m_liveFilter.store(liveFilter, AZStd::memory_order_release);
+            }
+        }
+        m_samplingInterval.store(samplingInterval, AZStd::memory_order_relaxed);
+    }
+
+    size_t AllocationSampler::GetSamplingInterval() const
+    {
+        return m_samplingInterval.load(AZStd::memory_order_relaxed);
+    }
+
+    void AllocationSampler::Reset()
+    {
+        AZStd::scoped_lock lock(m_data->m_mutex);
+        m_data->m_callSites.clear();
+        m_data->m_liveSamples.clear();
+        if (AZStd::atomic<AZ::u16>* liveFilter = m_liveFilter.load(AZStd::memory_order_relaxed))
+        {
+            for (size_t i = 0; i < (size_t{ 1 } << LiveFilterBits); ++i)
+            {
+                liveFilter[i].store(0, AZStd::memory_order_relaxed);
+            }
+        }
+    }
+
+    void AllocationSampler::SampleAllocation(void* address, size_t byteSize)
+    {
+        AllocationSamplerThreadState& state = t_allocationSamplerState;
+        const size_t samplingInterval = m_samplingInterval.load(AZStd::memory_order_relaxed);
+        if (state.m_samplingInterval != samplingInterval)
+        {
+            state.m_samplingInterval = samplingInterval;
+            state.m_bytesUntilSample = GetNextSampleDistance(state);
+        }
+
+        state.m_bytesUntilSample -= static_cast<AZ::s64>(byteSize);
+        if (state.m_bytesUntilSample > 0 || state.m_isSampling)
+        {
+            return;
+        }
+        state.m_isSampling = true;
+        do
+        {
+            state.m_bytesUntilSample += GetNextSampleDistance(state);
+        } while (state.m_bytesUntilSample <= 0);
+
+        // Weight the sample by the inverse of the probability that an allocation of this size is sampled
+        const double probability = 1.0 - exp(-static_cast<double>(byteSize) / static_cast<double>(samplingInterval));
+        const double weight = probability > 0.0 ? 1.0 / probability : 1.0;
+        const AZ::u64 estimatedAllocations = static_cast<AZ::u64>(weight + 0.5);
+        const AZ::u64 estimatedBytes = static_cast<AZ::u64>(static_cast<double>(byteSize) * weight + 0.5);
+
+        Debug::StackFrame frames[MaxStackFrames];
+        // skip this function and OnAllocation
+        const unsigned int frameCount = Debug::StackRecorder::Record(frames, MaxStackFrames, 2);
+        size_t callSiteKey = HashStackTrace(frames, frameCount);
+
+        {
+            AZStd::scoped_lock lock(m_data->m_mutex);
+            auto callSiteIt = m_data->m_callSites.find(callSiteKey);
+            while (callSiteIt != m_data->m_callSites.end() && !IsSameStackTrace(callSiteIt->second, frames, frameCount))
+            {
+                callSiteIt = m_data->m_callSites.find(++callSiteKey);
+            }
+            if (callSiteIt == m_data->m_callSites.end())
+            {
+                callSiteIt = m_data->m_callSites.emplace(callSiteKey, CallSite()).first;
+                AZStd::copy(frames, frames + frameCount, callSiteIt->second.m_stackTrace);
+                callSiteIt->second.m_stackFrameCount = frameCount;
+            }
+            CallSite& callSite = callSiteIt->second;
+            callSite.m_sampleCount++;
+            callSite.m_estimatedAllocations += estimatedAllocations;
+            callSite.m_estimatedBytes += estimatedBytes;
+            callSite.m_liveSampleCount++;
+            callSite.m_liveEstimatedBytes += estimatedBytes;
+
+            auto [liveSampleIt, inserted] = m_data->m_liveSamples.emplace(address, AllocationSamplerData::LiveSample{ callSiteKey, estimatedBytes });
+            if (inserted)
+            {
+                AZStd::atomic<AZ::u16>& filterCount = m_liveFilter.load(AZStd::memory_order_relaxed)[GetFilterIndex(address)];
+                if (filterCount.load(AZStd::memory_order_relaxed) != LiveFilterSaturated)
+                {
+                    filterCount.fetch_add(1, AZStd::memory_order_relaxed);
+                }
+            }
+            else
+            {
+                // The previous allocation at this address was freed without being reported, drop its sample
+                auto previousCallSiteIt = m_data->m_callSites.find(liveSampleIt->second.m_callSiteKey);
+                if (previousCallSiteIt != m_data->m_callSites.end())
+                {
+                    previousCallSiteIt->second.m_liveSampleCount--;
+                    previousCallSiteIt->second.m_liveEstimatedBytes -= liveSampleIt->second.m_estimatedBytes;
+                }
+                liveSampleIt->second = AllocationSamplerData::LiveSample{ callSiteKey, estimatedBytes };
+            }
+        }
+        state.m_isSampling = false;
+    }
+
+    void AllocationSampler::RemoveSample(void* address)
+    {
+        AZStd::scoped_lock lock(m_data->m_mutex);
+        auto liveSampleIt = m_data->m_liveSamples.find(address);
+        if (liveSampleIt == m_data->m_liveSamples.end())
+        {
+            // another address with the same filter index is sampled
+            return;
+        }
+
+        auto callSiteIt = m_data->m_callSites.find(liveSampleIt->second.m_callSiteKey);
+        if (callSiteIt != m_data->m_callSites.end())
+        {
+            callSiteIt->second.m_liveSampleCount--;
+            callSiteIt->second.m_liveEstimatedBytes -= liveSampleIt->second.m_estimatedBytes;
+        }
+        m_data->m_liveSamples.erase(liveSampleIt);
+
+        // A saturated count no longer knows how many samples it covers, it stays set and only costs a lookup
+        AZStd::atomic<AZ::u16>& filterCount = m_liveFilter.load(AZStd::memory_order_relaxed)[GetFilterIndex(address)];
+        if (filterCount.load(AZStd::memory_order_relaxed) != LiveFilterSaturated)
+        {
+            filterCount.fetch_sub(1, AZStd::memory_order_relaxed);
+        }
+    }
+
+    AllocationSampler::CallSiteVector AllocationSampler::GetCallSites() const
+    {
+        CallSiteVector callSites;
+        {
+            AZStd::scoped_lock lock(m_data->m_mutex);
+            callSites.reserve(m_data->m_callSites.size());
+            for (const auto& callSite : m_data->m_callSites)
+            {
+                callSites.push_back(callSite.second);
+            }
+        }
+        AZStd::sort(callSites.begin(), callSites.end(),
+            [](const CallSite& lhs, const CallSite& rhs)
+            {
+                return lhs.m_liveEstimatedBytes != rhs.m_liveEstimatedBytes ? lhs.m_liveEstimatedBytes > rhs.m_liveEstimatedBytes
+                                                                            : lhs.m_estimatedBytes > rhs.m_estimatedBytes;
+            });
+        return callSites;
+    }
+
+    bool AllocationSampler::WriteToStream(IO::GenericStream& stream) const
+    {
+        if (!stream.CanWrite())
+        {
+            return false;
+        }
+
+        const CallSiteVector callSites = GetCallSites();
+
+        using LineString = AZStd::fixed_string<256>;
+        auto writeLine = [&stream](const LineString& line)
+        {
+            stream.Write(line.size(), line.data());
+        };
+
+        writeLine(LineString::format("{\n    \"SamplingInterval\": %zu,\n    \"CallSites\": [", GetSamplingInterval()));
+        Debug::SymbolStorage::StackLine lines[MaxStackFrames];
+        for (size_t callSiteIndex = 0; callSiteIndex < callSites.size(); ++callSiteIndex)
+        {
+            const CallSite& callSite = callSites[callSiteIndex];
+            writeLine(LineString::format(
+                "%s\n        {\n"
+                "            \"SampleCount\": %llu,\n"
+                "            \"EstimatedAllocations\": %llu,\n"
+                "            \"EstimatedBytes\": %llu,\n"
+                "            \"LiveSampleCount\": %llu,\n"
+                "            \"LiveEstimatedBytes\": %llu,\n"
+                "            \"StackTrace\": [",
+                callSiteIndex == 0 ? "" : ",", callSite.m_sampleCount, callSite.m_estimatedAllocations, callSite.m_estimatedBytes,
+                callSite.m_liveSampleCount, callSite.m_liveEstimatedBytes));
+
+            Debug::SymbolStorage::DecodeFrames(callSite.m_stackTrace, callSite.m_stackFrameCount, lines);
+            for (unsigned int frameIndex = 0; frameIndex < callSite.m_stackFrameCount; ++frameIndex)
+            {
+                writeLine(LineString::format("%s\n                \"", frameIndex == 0 ? "" : ","));
+                WriteEscapedString(stream, lines[frameIndex]);
+                writeLine("\"");
+            }
+            writeLine("\n            ]\n        }");
+        }
+        writeLine("\n    ]\n}\n");
+        return true;
+    }
+
 } // namespace AZ
 
 #if defined(AZ_ENABLE_TRACING)
@@ -13,17 +13,22 @@
 #include <AzCore/Memory/IAllocator.h>
 #include <AzCore/RTTI/RTTI.h>
 
-#if defined(AZ_ENABLE_TRACING)
 #include <AzCore/Debug/StackTracer.h>
 #include <AzCore/std/allocator_stateless.h>
 #include <AzCore/std/containers/vector.h>
-#endif
+#include <AzCore/std/parallel/atomic.h>
 
 namespace AZ
 {
 #if defined(AZ_ENABLE_TRACING)
     struct IAllocatorTrackingRecorderData;
 #endif
+    struct AllocationSamplerData;
+
+    namespace IO
+    {
+        class GenericStream;
+    }
 
     class IAllocatorTrackingRecorder
     {
@@ -147,4 +152,81 @@ namespace AZ
         IAllocatorTrackingRecorderData* m_data;
 #endif
     };
+
+    //! Samples allocations in proportion to their size, on average once every sampling interval bytes in the style of heapprofd,
+    //! and aggregates the call stacks of the sampled allocations by call site.
+    //! Allocations that aren't sampled only cost a thread local counter update, so unlike the allocation records
+    //! the sampler can be left running in production builds. Each sample is weighted by the inverse of its sampling
+    //! probability so the per call site totals are unbiased estimates of the real allocation counts and sizes.
+    class AllocationSampler
+    {
+    public:
+        static constexpr size_t DefaultSamplingInterval = 512 * 1024;
+        static constexpr unsigned int MaxStackFrames = 20;
+
+        struct CallSite
+        {
+            Debug::StackFrame m_stackTrace[MaxStackFrames];
+            unsigned int m_stackFrameCount = 0;
+            AZ::u64 m_sampleCount = 0; //!< Number of allocations that were sampled
+            AZ::u64 m_estimatedAllocations = 0; //!< Estimated number of allocations made from the call site
+            AZ::u64 m_estimatedBytes = 0; //!< Estimated number of bytes allocated from the call site
+            AZ::u64 m_liveSampleCount = 0; //!< Number of sampled allocations that weren't freed yet
+            AZ::u64 m_liveEstimatedBytes = 0; //!< Estimated number of bytes allocated from the call site that weren't freed yet
+        };
+        using CallSiteVector = AZStd::vector<CallSite, AZStd::stateless_allocator>;
+
+        AllocationSampler();
+        AllocationSampler(const AllocationSampler&) = delete;
+        AllocationSampler& operator=(const AllocationSampler&) = delete;
+        ~AllocationSampler();
+
+        //! Sets the average amount of bytes allocated between two samples, 0 stops sampling.
+        //! Allocations sampled before stopping are still tracked until they are freed.
+        void SetSamplingInterval(size_t samplingInterval);
+        size_t GetSamplingInterval() const;
+
+        //! Discards all the collected call sites
+        void Reset();
+
+        AZ_FORCE_INLINE void OnAllocation(void* address, size_t byteSize)
+        {
+            if (address && m_samplingInterval.load(AZStd::memory_order_relaxed) != 0)
+            {
+                SampleAllocation(address, byteSize);
+            }
+        }
+
+        AZ_FORCE_INLINE void OnDeallocation(void* address)
+        {
+            // The filter counts the live samples per address hash, so frees of unsampled memory almost never take the lock
+            const AZStd::atomic<AZ::u16>* liveFilter = m_liveFilter.load(AZStd::memory_order_acquire);
+            if (liveFilter && address && liveFilter[GetFilterIndex(address)].load(AZStd::memory_order_relaxed) != 0)
+            {
+                RemoveSample(address);
+            }
+        }
+
+        //! Returns the call sites sorted by the amount of estimated live bytes
+        CallSiteVector GetCallSites() const;
+
+        //! Writes the call sites with their decoded stack traces as json, this is the format loaded by the Profiler gem's heap profiler
+        bool WriteToStream(IO::GenericStream& stream) const;
+
+    private:
+        static constexpr unsigned int LiveFilterBits = 16;
+
+        static size_t GetFilterIndex(const void* address)
+        {
+            // Fibonacci hashing of the address, the low bits are dropped since they are mostly alignment
+            return static_cast<size_t>((static_cast<AZ::u64>(reinterpret_cast<uintptr_t>(address) >> 4) * 0x9E3779B97F4A7C15ull) >> (64 - LiveFilterBits));
+        }
+
+        void SampleAllocation(void* address, size_t byteSize);
+        void RemoveSample(void* address);
+
+        AZStd::atomic<size_t> m_samplingInterval{ 0 };
+        AZStd::atomic<AZStd::atomic<AZ::u16>*> m_liveFilter{ nullptr };
+        AllocationSamplerData* m_data;
+    };
 }
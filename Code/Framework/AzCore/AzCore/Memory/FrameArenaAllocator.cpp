@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+namespace AZ
+{
+    struct alignas(16) FrameArenaAllocator::Block
+    {
+        Block* m_next = nullptr;
+        size_type m_capacity = 0;
+        AZStd::atomic<size_type> m_offset{ 0 };
+
+        char* GetData()
+        {
+            return reinterpret_cast<char*>(this + 1);
+        }
+    };
+
+    FrameArenaAllocator::FrameArenaAllocator()
+    {
+        PostCreate();
+    }
+
+    FrameArenaAllocator::~FrameArenaAllocator()
+    {
+        PreDestroy();
+        AZStd::scoped_lock lock(m_blockMutex);
+        DestroyBlocks();
+    }
+
+    AllocatorDebugConfig FrameArenaAllocator::GetDebugConfig()
+    {
+        // Allocations are never individually freed, so recording them would only report leaks
+        return AllocatorDebugConfig().ExcludeFromDebugging();
+    }
+
+    AllocateAddress FrameArenaAllocator::allocate(size_type byteSize, size_type alignment)
+    {
+        if (byteSize == 0)
+        {
+            return AllocateAddress{};
+        }
+        AZ_Assert((alignment & (alignment - 1)) == 0, "Alignment must be power of 2!");
+        // The size of each allocation is stored right before it, so reallocate knows how many bytes to copy
+        alignment = AZStd::GetMax<size_type>(alignment, alignof(size_type));
+
+        Block* block = m_currentBlock.load(AZStd::memory_order_acquire);
+        for (;;)
+        {
+            if (block)
+            {
+                char* data = block->GetData();
+                size_type offset = block->m_offset.load(AZStd::memory_order_relaxed);
+                for (;;)
+                {
+                    const size_type alignedOffset =
+                        AZ::SizeAlignUp(reinterpret_cast<size_t>(data) + offset + SizeHeaderSize, alignment) - reinterpret_cast<size_t>(data);
+                    const size_type newOffset = alignedOffset + byteSize;
+                    if (newOffset > block->m_capacity)
+                    {
+                        break;
+                    }
+                    if (block->m_offset.compare_exchange_weak(offset, newOffset, AZStd::memory_order_relaxed))
+                    {
+                        *reinterpret_cast<size_type*>(data + alignedOffset - SizeHeaderSize) = byteSize;
+                        return AllocateAddress{ data + alignedOffset, byteSize };
+                    }
+                }
+            }
+
+            // The current block is full, only one thread adds the next block, the others retry with it
+            {
+                AZStd::scoped_lock lock(m_blockMutex);
+                if (m_currentBlock.load(AZStd::memory_order_relaxed) == block)
+                {
+                    block = CreateBlock(AZStd::GetMax(DefaultBlockSize, SizeHeaderSize + byteSize + alignment - 1));
+                    m_currentBlock.store(block, AZStd::memory_order_release);
+                }
+                else
+                {
+                    block = m_currentBlock.load(AZStd::memory_order_relaxed);
+                }
+            }
+            if (!block)
+            {
+                // Reported without holding the lock, the out of memory report queries NumAllocatedBytes
+                OnOutOfMemory(byteSize, alignment);
+                return AllocateAddress{};
+            }
+        }
+    }
+
+    auto FrameArenaAllocator::deallocate(
+        [[maybe_unused]] pointer ptr, [[maybe_unused]] size_type byteSize, [[maybe_unused]] size_type alignment) -> size_type
+    {
+        return 0;
+    }
+
+    AllocateAddress FrameArenaAllocator::reallocate(pointer ptr, size_type newSize, align_type newAlignment)
+    {
+        AllocateAddress newAddress = allocate(newSize, newAlignment);
+        if (ptr && newAddress)
+        {
+            // The new allocation never overlaps the old one, which is still allocated until the next Reset
+            memcpy(newAddress, ptr, AZStd::GetMin(get_allocated_size(ptr), newSize));
+        }
+        return newAddress;
+    }
+
+    auto FrameArenaAllocator::get_allocated_size(pointer ptr, [[maybe_unused]] align_type alignment) const -> size_type
+    {
+        return ptr ? *reinterpret_cast<const size_type*>(static_cast<const char*>(ptr) - SizeHeaderSize) : 0;
+    }
+
+    auto FrameArenaAllocator::NumAllocatedBytes() const -> size_type
+    {
+        AZStd::scoped_lock lock(m_blockMutex);
+        return GetAllocatedBytesLocked();
+    }
+
+    void FrameArenaAllocator::GarbageCollect()
+    {
+        AZStd::scoped_lock lock(m_blockMutex);
+        if (GetAllocatedBytesLocked() == 0)
+        {
+            DestroyBlocks();
+        }
+    }
+
+    void FrameArenaAllocator::Reset()
+    {
+        AZStd::scoped_lock lock(m_blockMutex);
+        if (!m_blocks)
+        {
+            m_frameIndex.fetch_add(1, AZStd::memory_order_relaxed);
+            return;
+        }
+
+        m_highWaterMark = AZStd::GetMax(m_highWaterMark, GetAllocatedBytesLocked());
+        if (m_blocks->m_next)
+        {
+            // The frame didn't fit in one block, replace all of them with a single block of the combined size
+            const size_type capacity = m_capacity;
+            DestroyBlocks();
+            m_currentBlock.store(CreateBlock(capacity), AZStd::memory_order_release);
+        }
+        else
+        {
+#if defined(AZ_DEBUG_BUILD)
+            // make use of memory from a previous frame easy to spot
+            memset(m_blocks->GetData(), 0xcd, m_blocks->m_offset.load(AZStd::memory_order_relaxed));
+#endif
+            m_blocks->m_offset.store(0, AZStd::memory_order_relaxed);
+        }
+        m_frameIndex.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+
+    auto FrameArenaAllocator::GetCapacity() const -> size_type
+    {
+        AZStd::scoped_lock lock(m_blockMutex);
+        return m_capacity;
+    }
+
+    auto FrameArenaAllocator::GetHighWaterMark() const -> size_type
+    {
+        AZStd::scoped_lock lock(m_blockMutex);
+        return AZStd::GetMax(m_highWaterMark, GetAllocatedBytesLocked());
+    }
+
+    AZ::u64 FrameArenaAllocator::GetFrameIndex() const
+    {
+        return m_frameIndex.load(AZStd::memory_order_relaxed);
+    }
+
+    auto FrameArenaAllocator::CreateBlock(size_type capacity) -> Block*
+    {
+        void* memory = AZ_OS_MALLOC(sizeof(Block) + capacity, alignof(Block));
+        if (!memory)
+        {
+            return nullptr;
+        }
+        Block* block = new (memory) Block;
+        block->m_capacity = capacity;
+        block->m_next = m_blocks;
+        m_blocks = block;
+        m_capacity += capacity;
+        return block;
+    }
+
+    void FrameArenaAllocator::DestroyBlocks()
+    {
+        m_currentBlock.store(nullptr, AZStd::memory_order_release);
+        while (Block* block = m_blocks)
+        {
+            m_blocks = block->m_next;
+            block->~Block();
+            AZ_OS_FREE(block);
+        }
+        m_capacity = 0;
+    }
+
+    auto FrameArenaAllocator::GetAllocatedBytesLocked() const -> size_type
+    {
+        size_type allocatedBytes = 0;
+        for (const Block* block = m_blocks; block; block = block->m_next)
+        {
+            allocatedBytes += block->m_offset.load(AZStd::memory_order_relaxed);
+        }
+        return allocatedBytes;
+    }
+} // namespace AZ
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/AllocatorBase.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    /**
+     * Linear arena for transient allocations that only live for a single frame.
+     * Allocations bump a pointer inside the current block (lock free, safe to use from multiple threads),
+     * deallocations are no-ops and all the memory is reclaimed at once by Reset, which the ComponentApplication
+     * calls at the start of every tick.
+     * IMPORTANT: Nothing allocated from this allocator can be kept past the end of the frame, containers using
+     * \ref FrameArenaStdAllocator must be destroyed or cleared before the next tick.
+     * When a frame needs more than one block, Reset replaces them with a single block large enough for the
+     * whole frame, so steady state frames allocate from one block without ever going to the OS.
+     */
+    class FrameArenaAllocator
+        : public AllocatorBase
+    {
+    public:
+        AZ_RTTI(FrameArenaAllocator, "{91A5430E-8755-4C8A-A068-C53E378A188A}", AllocatorBase)
+
+        /// Size of the first block and the minimum size of any additional block
+        static constexpr size_type DefaultBlockSize = 1024 * 1024;
+
+        FrameArenaAllocator();
+        FrameArenaAllocator(const FrameArenaAllocator&) = delete;
+        FrameArenaAllocator& operator=(const FrameArenaAllocator&) = delete;
+        ~FrameArenaAllocator() override;
+
+        //////////////////////////////////////////////////////////////////////////
+        // IAllocator
+        AllocatorDebugConfig GetDebugConfig() override;
+
+        AllocateAddress allocate(size_type byteSize, size_type alignment) override;
+        /// Individual allocations are not freed, the memory is reclaimed by Reset
+        size_type       deallocate(pointer ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        AllocateAddress reallocate(pointer ptr, size_type newSize, align_type newAlignment) override;
+        /// Returns the size requested for the allocation, stored in a header right before it
+        size_type       get_allocated_size(pointer ptr, align_type alignment = 1) const override;
+
+        /// Bytes allocated since the last Reset, including the size headers and alignment padding
+        size_type       NumAllocatedBytes() const override;
+        /// Returns the retained blocks to the OS when nothing was allocated since the last Reset
+        void            GarbageCollect() override;
+        //////////////////////////////////////////////////////////////////////////
+
+        /// Reclaims all the allocations made since the last Reset. No thread may still use memory from this frame.
+        void Reset();
+
+        /// Total size of the blocks currently owned by the arena
+        size_type GetCapacity() const;
+        /// Largest amount of bytes allocated within a single frame
+        size_type GetHighWaterMark() const;
+        /// Number of times the arena was Reset
+        AZ::u64 GetFrameIndex() const;
+
+    private:
+        struct Block;
+
+        /// Size of the header storing the size of each allocation
+        static constexpr size_type SizeHeaderSize = sizeof(size_type);
+
+        Block* CreateBlock(size_type capacity);
+        void DestroyBlocks();
+        size_type GetAllocatedBytesLocked() const;
+
+        AZStd::atomic<Block*> m_currentBlock{ nullptr };
+        Block* m_blocks = nullptr; ///< All blocks, most recent first, protected by m_blockMutex
+        mutable AZStd::mutex m_blockMutex;
+        size_type m_capacity = 0;
+        size_type m_highWaterMark = 0;
+        AZStd::atomic<AZ::u64> m_frameIndex{ 0 };
+    };
+
+    /// AZStd allocator for scratch containers that only live for the current frame
+    typedef AZStdAlloc<FrameArenaAllocator> FrameArenaStdAllocator;
+} // namespace AZ
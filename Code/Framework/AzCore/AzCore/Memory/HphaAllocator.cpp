@@ -14,6 +14,7 @@
 #include <AzCore/Memory/OSAllocator.h> // required by certain platforms
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/spin_mutex.h>
 #include <AzCore/std/containers/intrusive_list.h>
 #include <AzCore/std/containers/intrusive_set.h>
 
@@ -64,6 +65,11 @@ namespace AZ
 // Enabled mutex per bucket
 #define USE_MUTEX_PER_BUCKET
 
+#ifdef MULTITHREADED
+// Enable per thread caches of free small blocks in front of the buckets (see HphaSchemaBase::SetThreadCacheSize)
+#   define USE_THREAD_CACHE
+#endif
+
     //////////////////////////////////////////////////////////////////////////
 
     template<bool DebugAllocatorEnable>
@@ -322,6 +328,69 @@ namespace AZ
         };
 
         AZ_POP_DISABLE_WARNING_MSVC
+
+#if defined(USE_THREAD_CACHE)
+        // maximum number of allocators a thread can cache blocks for at the same time,
+        // small allocations from any further allocator go directly to the buckets
+        static constexpr size_t MAX_THREAD_CACHES = 4;
+
+        // per thread free lists of small blocks, one list per bucket
+        // blocks in a thread cache are accounted as free and are returned to their bucket in batches
+        struct thread_cache
+        {
+            HpAllocator* mOwner;
+            thread_cache* mNext; // next thread cache of the owner, protected by thread_cache_mutex()
+            free_link* mFreeList[NUM_BUCKETS];
+            unsigned mCount[NUM_BUCKETS];
+        };
+
+        // Trivially destructible so it stays valid until the thread is gone, the caches
+        // are flushed by thread_cache_releaser which is destroyed when the thread exits
+        struct thread_cache_set
+        {
+            thread_cache mCaches[MAX_THREAD_CACHES];
+            bool mReleased;
+        };
+
+        struct thread_cache_releaser
+        {
+            ~thread_cache_releaser()
+            {
+                thread_cache_release_all();
+            }
+        };
+
+        static thread_cache_set& thread_caches()
+        {
+            static thread_local thread_cache_set s_threadCaches{};
+            return s_threadCaches;
+        }
+
+        // protects the attachment of thread caches to their owner, spin_mutex is trivially destructible
+        // so threads that exit during static destruction can still flush their caches
+        static AZStd::spin_mutex& thread_cache_mutex()
+        {
+            static AZStd::spin_mutex s_mutex;
+            return s_mutex;
+        }
+
+        // returns the calling thread's cache for this allocator, attaching one if needed
+        // returns nullptr when the cache is disabled or the thread caches for too many allocators
+        thread_cache* thread_cache_get();
+        // returns the calling thread's cache for this allocator if it has one
+        thread_cache* thread_cache_find() const;
+        void thread_cache_refill(thread_cache& cache, unsigned bi, unsigned count);
+        void thread_cache_flush(thread_cache& cache, unsigned bi, unsigned count);
+        void thread_cache_flush_all(thread_cache& cache);
+        void thread_cache_unlink(thread_cache& cache);
+        // returns the blocks of all thread caches to the buckets, the threads must not use the allocator anymore
+        void thread_cache_detach_all();
+        static void thread_cache_release_all();
+
+        thread_cache* mThreadCaches = nullptr;
+        AZStd::atomic<unsigned> mThreadCacheSize{ DebugAllocatorEnable ? 0U : static_cast<unsigned>(DefaultThreadCacheSize) };
+#endif
+
         void* bucket_system_alloc();
         void bucket_system_free(void* ptr);
         page* bucket_grow(size_t elemSize, size_t marker);
@@ -934,6 +1003,15 @@ namespace AZ
             tree_purge();
         }
 
+#if defined(USE_THREAD_CACHE)
+        // set the maximum number of free blocks each thread caches per bucket, 0 disables the cache
+        void SetThreadCacheSize(size_t maxBlocksPerBucket);
+        size_t GetThreadCacheSize() const
+        {
+            return mThreadCacheSize.load(AZStd::memory_order_relaxed);
+        }
+#endif
+
         // print HpAllocator statistics
         void report();
 
@@ -1054,6 +1132,9 @@ namespace AZ
             check();
         }
 
+#if defined(USE_THREAD_CACHE)
+        thread_cache_detach_all();
+#endif
         purge();
 
         if constexpr (DebugAllocatorEnable)
@@ -1204,35 +1285,34 @@ namespace AZ
         HPPA_ASSERT(size <= MAX_SMALL_ALLOCATION);
         unsigned bi = bucket_spacing_function(size);
         HPPA_ASSERT(bi < NUM_BUCKETS);
-#ifdef MULTITHREADED
-#if defined(USE_MUTEX_PER_BUCKET)
-        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
-#else
-        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
-#endif
-#endif
-        // get the page info and check if there's any available elements
-        page* p = mBuckets[bi].get_free_page();
-        if (!p)
-        {
-            // get a page from the OS, initialize it and add it to the list
-            size_t bsize = bucket_spacing_function_inverse(bi);
-            p = bucket_grow(bsize, mBuckets[bi].marker());
-            if (!p)
-            {
-                return AllocateAddress{};
-            }
-            mBuckets[bi].add_free_page(p);
-        }
-        HPPA_ASSERT(p->elem_size() >= size);
-        mTotalAllocatedSizeBuckets += p->elem_size();
-        return AllocateAddress{ mBuckets[bi].alloc(p), p->elem_size() };
+        AllocateAddress ptr = bucket_alloc_direct(bi);
+        HPPA_ASSERT(!ptr || ptr.GetAllocatedBytes() >= size);
+        return ptr;
     }
 
     template<bool DebugAllocatorEnable>
     AllocateAddress HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::bucket_alloc_direct(unsigned bi)
     {
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#if defined(USE_THREAD_CACHE)
+        if (thread_cache* cache = thread_cache_get())
+        {
+            if (!cache->mFreeList[bi])
+            {
+                // take half a cache worth of blocks at once so the bucket lock is only taken once for all of them
+                thread_cache_refill(*cache, bi, AZStd::GetMax(mThreadCacheSize.load(AZStd::memory_order_relaxed) / 2, 1U));
+            }
+            if (free_link* lnk = cache->mFreeList[bi])
+            {
+                cache->mFreeList[bi] = lnk->mNext;
+                --cache->mCount[bi];
+                const size_t elemSize = bucket_spacing_function_inverse(bi);
+                mTotalAllocatedSizeBuckets += elemSize;
+                return AllocateAddress(lnk, elemSize);
+            }
+            return AllocateAddress{};
+        }
+#endif
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1303,18 +1383,7 @@ namespace AZ
         page* p = ptr_get_page(ptr);
         unsigned bi = p->bucket_index();
         HPPA_ASSERT(bi < NUM_BUCKETS);
-#ifdef MULTITHREADED
-#if defined(USE_MUTEX_PER_BUCKET)
-        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
-#else
-        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
-#endif
-#endif
-        size_type allocatedByteCount = p->elem_size();
-        mTotalAllocatedSizeBuckets -= allocatedByteCount;
-        mBuckets[bi].free(p, ptr);
-
-        return allocatedByteCount;
+        return bucket_free_direct(ptr, bi);
     }
 
     template<bool DebugAllocatorEnable>
@@ -1325,6 +1394,23 @@ namespace AZ
         // if this asserts, the free size doesn't match the allocated size
         // most likely a class needs a base virtual destructor
         HPPA_ASSERT(bi == p->bucket_index());
+#if defined(USE_THREAD_CACHE)
+        if (thread_cache* cache = thread_cache_get())
+        {
+            size_type allocatedByteCount = p->elem_size();
+            mTotalAllocatedSizeBuckets -= allocatedByteCount;
+            free_link* lnk = (free_link*)ptr;
+            lnk->mNext = cache->mFreeList[bi];
+            cache->mFreeList[bi] = lnk;
+            const unsigned threadCacheSize = mThreadCacheSize.load(AZStd::memory_order_relaxed);
+            if (++cache->mCount[bi] > threadCacheSize)
+            {
+                // keep half of the cache so alternating allocations and frees don't flush on every call
+                thread_cache_flush(*cache, bi, cache->mCount[bi] - threadCacheSize / 2);
+            }
+            return allocatedByteCount;
+        }
+#endif
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1418,6 +1504,13 @@ namespace AZ
     template<bool DebugAllocatorEnable>
     void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::bucket_purge()
     {
+#if defined(USE_THREAD_CACHE)
+        // blocks held by the calling thread's cache keep their pages alive, caches of other threads can't be touched here
+        if (thread_cache* cache = thread_cache_find())
+        {
+            thread_cache_flush_all(*cache);
+        }
+#endif
         for (unsigned i = 0; i < NUM_BUCKETS; i++)
         {
 #ifdef MULTITHREADED
@@ -1448,6 +1541,182 @@ namespace AZ
         }
     }
 
+#if defined(USE_THREAD_CACHE)
+    template<bool DebugAllocatorEnable>
+    auto HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_get() -> thread_cache*
+    {
+        if (mThreadCacheSize.load(AZStd::memory_order_relaxed) == 0)
+        {
+            return nullptr;
+        }
+        thread_cache_set& caches = thread_caches();
+        thread_cache* freeCache = nullptr;
+        for (thread_cache& cache : caches.mCaches)
+        {
+            if (cache.mOwner == this)
+            {
+                return &cache;
+            }
+            if (!cache.mOwner && !freeCache)
+            {
+                freeCache = &cache;
+            }
+        }
+        if (!freeCache || caches.mReleased)
+        {
+            // either the thread already caches blocks for too many allocators or it is exiting
+            return nullptr;
+        }
+
+        // make sure the blocks are returned when the thread exits
+        static thread_local thread_cache_releaser s_releaser;
+        (void)s_releaser;
+
+        AZStd::lock_guard<AZStd::spin_mutex> lock(thread_cache_mutex());
+        freeCache->mOwner = this;
+        freeCache->mNext = mThreadCaches;
+        mThreadCaches = freeCache;
+        return freeCache;
+    }
+
+    template<bool DebugAllocatorEnable>
+    auto HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_find() const -> thread_cache*
+    {
+        for (thread_cache& cache : thread_caches().mCaches)
+        {
+            if (cache.mOwner == this)
+            {
+                return &cache;
+            }
+        }
+        return nullptr;
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_refill(thread_cache& cache, unsigned bi, unsigned count)
+    {
+#if defined(USE_MUTEX_PER_BUCKET)
+        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+#else
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+#endif
+        for (unsigned i = 0; i < count; ++i)
+        {
+            page* p = mBuckets[bi].get_free_page();
+            if (!p)
+            {
+                // only grow for the block that was requested, the rest of the batch is opportunistic
+                if (i > 0)
+                {
+                    break;
+                }
+                p = bucket_grow(bucket_spacing_function_inverse(bi), mBuckets[bi].marker());
+                if (!p)
+                {
+                    break;
+                }
+                mBuckets[bi].add_free_page(p);
+            }
+            free_link* lnk = (free_link*)mBuckets[bi].alloc(p);
+            lnk->mNext = cache.mFreeList[bi];
+            cache.mFreeList[bi] = lnk;
+            ++cache.mCount[bi];
+        }
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_flush(thread_cache& cache, unsigned bi, unsigned count)
+    {
+        HPPA_ASSERT(count <= cache.mCount[bi]);
+#if defined(USE_MUTEX_PER_BUCKET)
+        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+#else
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+#endif
+        for (unsigned i = 0; i < count; ++i)
+        {
+            free_link* lnk = cache.mFreeList[bi];
+            cache.mFreeList[bi] = lnk->mNext;
+            mBuckets[bi].free(ptr_get_page(lnk), lnk);
+        }
+        cache.mCount[bi] -= count;
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_flush_all(thread_cache& cache)
+    {
+        for (unsigned i = 0; i < NUM_BUCKETS; i++)
+        {
+            if (cache.mCount[i])
+            {
+                thread_cache_flush(cache, i, cache.mCount[i]);
+            }
+        }
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_unlink(thread_cache& cache)
+    {
+        // must be called with thread_cache_mutex() locked
+        thread_cache** link = &mThreadCaches;
+        while (*link != &cache)
+        {
+            HPPA_ASSERT(*link, "thread cache is not attached to this allocator");
+            link = &(*link)->mNext;
+        }
+        *link = cache.mNext;
+        cache.mNext = nullptr;
+        cache.mOwner = nullptr;
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_detach_all()
+    {
+        AZStd::lock_guard<AZStd::spin_mutex> lock(thread_cache_mutex());
+        while (thread_cache* cache = mThreadCaches)
+        {
+            thread_cache_flush_all(*cache);
+            thread_cache_unlink(*cache);
+        }
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_release_all()
+    {
+        thread_cache_set& caches = thread_caches();
+        AZStd::lock_guard<AZStd::spin_mutex> lock(thread_cache_mutex());
+        // allocations made by thread_local destructors that run after this one bypass the cache
+        caches.mReleased = true;
+        for (thread_cache& cache : caches.mCaches)
+        {
+            // the owner can't be destroyed while the lock is held, it detaches all caches before going away
+            if (HpAllocator* owner = cache.mOwner)
+            {
+                owner->thread_cache_flush_all(cache);
+                owner->thread_cache_unlink(cache);
+            }
+        }
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::SetThreadCacheSize(size_t maxBlocksPerBucket)
+    {
+        HPPA_ASSERT(maxBlocksPerBucket <= AZStd::numeric_limits<unsigned short>::max());
+        mThreadCacheSize.store(static_cast<unsigned>(maxBlocksPerBucket), AZStd::memory_order_relaxed);
+        // other threads trim their caches on their next free
+        if (thread_cache* cache = thread_cache_find())
+        {
+            for (unsigned i = 0; i < NUM_BUCKETS; i++)
+            {
+                if (cache->mCount[i] > maxBlocksPerBucket)
+                {
+                    thread_cache_flush(*cache, i, cache->mCount[i] - static_cast<unsigned>(maxBlocksPerBucket));
+                }
+            }
+        }
+    }
+#endif
+
     template<bool DebugAllocatorEnable>
     void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::split_block(block_header* bl, size_t size)
     {
@@ -2604,6 +2873,24 @@ namespace AZ
         m_allocator->purge();
     }
 
+    template<bool DebugAllocator>
+    void HphaSchemaBase<DebugAllocator>::SetThreadCacheSize([[maybe_unused]] size_t maxBlocksPerBucket)
+    {
+#if defined(USE_THREAD_CACHE)
+        m_allocator->SetThreadCacheSize(maxBlocksPerBucket);
+#endif
+    }
+
+    template<bool DebugAllocator>
+    size_t HphaSchemaBase<DebugAllocator>::GetThreadCacheSize() const
+    {
+#if defined(USE_THREAD_CACHE)
+        return m_allocator->GetThreadCacheSize();
+#else
+        return 0;
+#endif
+    }
+
     template<bool DebugAllocator>
     size_t HphaSchemaBase<DebugAllocator>::GetMemoryGuardSize()
     {
@@ -38,8 +38,19 @@ namespace AZ
         size_type       NumAllocatedBytes() const override;
 
         /// Return unused memory to the OS. Don't call this unless you really need free memory, it is slow.
+        /// Only the thread cache of the calling thread is flushed, blocks cached by other threads are kept.
         void            GarbageCollect() override;
 
+        /// Default number of free small blocks each thread caches per bucket. The debug schema disables the cache by default
+        /// so freed blocks are returned to their page immediately.
+        static constexpr size_t DefaultThreadCacheSize = 16;
+
+        /// Set the maximum number of free small blocks each thread keeps per size bucket, 0 disables the thread cache.
+        /// Allocations and frees served from the thread cache don't take the bucket locks, the cache is refilled and
+        /// flushed in batches and returned to the buckets when the thread exits.
+        void            SetThreadCacheSize(size_t maxBlocksPerBucket);
+        size_t          GetThreadCacheSize() const;
+
         static size_t GetMemoryGuardSize();
         static size_t GetFreeLinkSize();
 
@@ -30,6 +30,7 @@ namespace AZ
     AZ_RTTI_NO_TYPE_INFO_IMPL(SystemAllocator, AllocatorBase);
 
     SystemAllocator::SystemAllocator()
+        : m_allocationSampler(&AllocatorManager::Instance().GetAllocationSampler())
     {
         AllocatorInstance<OSAllocator>::Get();
         Create();
@@ -100,6 +101,7 @@ namespace AZ
 
         AZ_PROFILE_MEMORY_ALLOC_EX(MemoryReserved, fileName, lineNum, address, byteSize, name);
         AZ_MEMORY_PROFILE(ProfileAllocation(address, byteSize, alignment, 1));
+        m_allocationSampler->OnAllocation(address, byteSize);
 
         return address;
     }
@@ -113,6 +115,8 @@ namespace AZ
         byteSize = MemorySizeAdjustedUp(byteSize);
         AZ_PROFILE_MEMORY_FREE(MemoryReserved, ptr);
         AZ_MEMORY_PROFILE(ProfileDeallocation(ptr, byteSize, alignment, nullptr));
+        // Before the memory is freed, another thread could otherwise receive and sample the same address first
+        m_allocationSampler->OnDeallocation(ptr);
         return m_subAllocator->deallocate(ptr, byteSize, alignment);
     }
 
@@ -125,8 +129,10 @@ namespace AZ
         newSize = MemorySizeAdjustedUp(newSize);
 
         AZ_PROFILE_MEMORY_FREE(MemoryReserved, ptr);
+        m_allocationSampler->OnDeallocation(ptr);
 
         AllocateAddress newAddress = m_subAllocator->reallocate(ptr, newSize, newAlignment);
+        m_allocationSampler->OnAllocation(newAddress, newSize);
 
 #if defined(AZ_ENABLE_TRACING)
         [[maybe_unused]] const size_type allocatedSize = get_allocated_size(newAddress, 1);
@@ -13,6 +13,7 @@
 
 namespace AZ
 {
+    class AllocationSampler;
     class HphaSchema;
 
     /**
@@ -58,6 +59,7 @@ namespace AZ
         SystemAllocator& operator=(const SystemAllocator&);
 
         AZStd::unique_ptr<IAllocator> m_subAllocator;
+        AllocationSampler* m_allocationSampler; ///< Owned by the AllocatorManager, which outlives all allocators
     };
 }
 
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Module/Internal/ModuleFilePrefetcher.h>
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        ModuleFilePrefetcher::ModuleFilePrefetcher(AZStd::vector<AZ::IO::FixedMaxPathString> filePaths, size_t threadCount)
+            : m_filePaths(AZStd::move(filePaths))
+        {
+            threadCount = AZStd::min(threadCount, m_filePaths.size());
+            AZStd::thread_desc threadDesc;
+            threadDesc.m_name = "ModulePrefetch";
+            m_threads.reserve(threadCount);
+            for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+            {
+                m_threads.emplace_back(threadDesc, [this]() { ReadFiles(); });
+            }
+        }
+
+        ModuleFilePrefetcher::~ModuleFilePrefetcher()
+        {
+            // The modules that weren't read by now are already loaded or failed to load
+            m_stop.store(true, AZStd::memory_order_relaxed);
+            Wait();
+        }
+
+        void ModuleFilePrefetcher::Wait()
+        {
+            for (AZStd::thread& thread : m_threads)
+            {
+                if (thread.joinable())
+                {
+                    thread.join();
+                }
+            }
+        }
+
+        size_t ModuleFilePrefetcher::GetReadFileCount() const
+        {
+            return m_readFileCount.load();
+        }
+
+        void ModuleFilePrefetcher::ReadFiles()
+        {
+            constexpr AZ::IO::SystemFile::SizeType ChunkSize = 1024 * 1024;
+            AZStd::unique_ptr<char[]> chunk = AZStd::make_unique<char[]>(ChunkSize);
+            for (size_t fileIndex = m_nextFile.fetch_add(1); fileIndex < m_filePaths.size() && !m_stop.load(AZStd::memory_order_relaxed);
+                 fileIndex = m_nextFile.fetch_add(1))
+            {
+                AZ::IO::SystemFile file;
+                if (!file.Open(m_filePaths[fileIndex].c_str(), AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+                {
+                    // The loader reports the missing modules
+                    continue;
+                }
+
+                while (!m_stop.load(AZStd::memory_order_relaxed) && file.Read(ChunkSize, chunk.get()) == ChunkSize)
+                {
+                }
+
+                if (!m_stop.load(AZStd::memory_order_relaxed))
+                {
+                    m_readFileCount.fetch_add(1);
+                }
+            }
+        }
+    } // namespace Internal
+} // namespace AZ
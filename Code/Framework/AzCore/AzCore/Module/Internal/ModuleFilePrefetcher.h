@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/IO/Path/Path_fwd.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        /**
+         * Reads the files of the dynamic modules on worker threads, in load order, while the main thread loads them.
+         * The modules themselves are still loaded and initialized one at a time on the main thread, since their static
+         * initialization, environment attachment and descriptor registration aren't thread safe. Reading them ahead
+         * moves the disk I/O of a cold start off the main thread, the loader then finds them in the OS file cache.
+         */
+        class ModuleFilePrefetcher
+        {
+        public:
+            /// Starts reading the files on at most threadCount threads, and no more threads than there are files
+            ModuleFilePrefetcher(AZStd::vector<AZ::IO::FixedMaxPathString> filePaths, size_t threadCount);
+            /// Stops reading the files that weren't read yet
+            ~ModuleFilePrefetcher();
+
+            /// Waits until every file was read
+            void Wait();
+
+            /// Returns the number of files that were read completely, files that can't be opened are skipped
+            size_t GetReadFileCount() const;
+
+        private:
+            void ReadFiles();
+
+            AZStd::vector<AZ::IO::FixedMaxPathString> m_filePaths;
+            AZStd::vector<AZStd::thread> m_threads;
+            AZStd::atomic<size_t> m_nextFile{ 0 };
+            AZStd::atomic<size_t> m_readFileCount{ 0 };
+            AZStd::atomic_bool m_stop{ false };
+        };
+    } // namespace Internal
+} // namespace AZ
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Module/ModuleManager.h>
+#include <AzCore/Module/Internal/ModuleFilePrefetcher.h>
 #include <AzCore/Module/Internal/ModuleManagerSearchPathTool.h>
 
 #include <AzCore/Module/Module.h>
@@ -16,18 +17,41 @@
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/ComponentApplicationLifecycle.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/StartupTimeline.h>
 #include <AzCore/NativeUI/NativeUIRequests.h>
 
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace
 {
     static const char* s_moduleLoggingScope = "Module Manager";
+
+    const char* GetInitializationStepName(AZ::ModuleInitializationSteps step)
+    {
+        switch (step)
+        {
+        case AZ::ModuleInitializationSteps::Load:
+            return "Load";
+        case AZ::ModuleInitializationSteps::CreateClass:
+            return "CreateClass";
+        case AZ::ModuleInitializationSteps::RegisterComponentDescriptors:
+            return "RegisterComponentDescriptors";
+        case AZ::ModuleInitializationSteps::ActivateEntity:
+            return "ActivateEntity";
+        default:
+            return "None";
+        }
+    }
 }
 
 namespace AZ
 {
+    AZ_CVAR(uint32_t, sys_modulePrefetchThreadCount, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of threads that read the dynamic modules from disk ahead of the loader, 0 loads them without prefetching.");
+
     bool ShouldUseSystemComponent(const ComponentDescriptor& descriptor, const AZStd::vector<Crc32>& requiredTags, const SerializeContext& serialize)
     {
         const SerializeContext::ClassData* classData = serialize.FindClassData(descriptor.GetUuid());
@@ -483,6 +507,11 @@ namespace AZ
                 continue;
             }
 
+            AZStd::string_view moduleFileName(preprocessedModulePath);
+            moduleFileName.remove_prefix(moduleFileName.find_last_of("\\/") + 1);
+            const Debug::StartupTimeline::Scope startupScope("Module",
+                AZStd::fixed_string<128>::format("%.*s %s", AZ_STRING_ARG(moduleFileName), GetInitializationStepName(phasePair.first)));
+
             PhaseOutcome phaseResult = phasePair.second();
             if (!phaseResult.IsSuccess())
             {
@@ -519,6 +548,34 @@ namespace AZ
 
         Internal::ModuleManagerSearchPathTool moduleSearchPathHelper;
 
+        // Start reading the modules that aren't loaded yet, the prefetcher is joined once all of them are loaded
+        AZStd::unique_ptr<Internal::ModuleFilePrefetcher> prefetcher;
+        if (const uint32_t prefetchThreadCount = sys_modulePrefetchThreadCount; prefetchThreadCount > 0 && modules.size() > 1)
+        {
+            AZStd::vector<AZ::IO::FixedMaxPathString> filePaths;
+            filePaths.reserve(modules.size());
+            for (const auto& moduleDescriptor : modules)
+            {
+                if (GetLoadedModule(moduleDescriptor.m_dynamicLibraryPath))
+                {
+                    continue;
+                }
+
+                // Creating the handle resolves the platform file name without loading the module
+                moduleSearchPathHelper.SetModuleSearchPath(moduleDescriptor);
+                const AZ::OSString preprocessedModulePath = PreProcessModule(moduleDescriptor.m_dynamicLibraryPath);
+                if (auto dynamicHandle = DynamicModuleHandle::Create(preprocessedModulePath.c_str()); dynamicHandle)
+                {
+                    filePaths.emplace_back(dynamicHandle->GetFilename());
+                }
+            }
+
+            if (filePaths.size() > 1)
+            {
+                prefetcher = AZStd::make_unique<Internal::ModuleFilePrefetcher>(AZStd::move(filePaths), prefetchThreadCount);
+            }
+        }
+
         // Load DLLs specified in the application descriptor
         for (const auto& moduleDescriptor : modules)
         {
@@ -88,6 +88,25 @@ namespace AZ
         SetName(name, nameDictionary);
     }
 
+    Name::Name(const NameLiteral& nameLiteral)
+    {
+        if (nameLiteral.GetStringView().empty())
+        {
+            return;
+        }
+
+        auto nameDictionary = AZ::Interface<NameDictionary>::Get();
+        AZ_Assert(nameDictionary != nullptr, "Attempted to initialize Name '%.*s' using the global NameDictionary before it is ready.\n"
+            "Alternatively the Name(const NameLiteral&, NameDictionary&) overload can be used to supply an explicit name dictionary reference",
+            AZ_STRING_ARG(nameLiteral.GetStringView()));
+        *this = nameDictionary->MakeName(nameLiteral);
+    }
+
+    Name::Name(const NameLiteral& nameLiteral, NameDictionary& nameDictionary)
+    {
+        *this = nameDictionary.MakeName(nameLiteral);
+    }
+
     Name::Name(Hash hash)
     {
         auto nameDictionary = AZ::Interface<NameDictionary>::Get();
@@ -60,6 +60,46 @@ namespace AZ
         AZStd::intrusive_ptr<Internal::NameData> m_data = nullptr;
     };
 
+    //! A name string paired with its hash, computed at compile time when the NameLiteral is constexpr.
+    //! Constructing a Name from a NameLiteral skips hashing the string, so names that are looked up repeatedly
+    //! but can't be cached in a Name (e.g. in per frame shader option lookups) should be declared as
+    //!     static constexpr AZ::NameLiteral ShadowOptionName{ "o_enableShadows" };
+    //! and converted with AZ::Name(ShadowOptionName) when needed.
+    class NameLiteral final
+    {
+    public:
+        using Hash = Internal::NameData::Hash;
+
+        constexpr explicit NameLiteral(AZStd::string_view name)
+            : m_view(name)
+            , m_hash(CalcHash(name))
+        {
+        }
+
+        constexpr AZStd::string_view GetStringView() const
+        {
+            return m_view;
+        }
+
+        //! Returns the hash of the string before it is mapped into the hash slots of a NameDictionary
+        constexpr Hash GetHash() const
+        {
+            return m_hash;
+        }
+
+        //! Hash function used for all names.
+        //! AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
+        //! of network synchronization. So just take the low 32 bits.
+        static constexpr Hash CalcHash(AZStd::string_view name)
+        {
+            return static_cast<Hash>(AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF);
+        }
+
+    private:
+        AZStd::string_view m_view;
+        Hash m_hash;
+    };
+
     //! The Name class provides very fast string equality comparison, so that names can be used as IDs without sacrificing performance.
     //! It is a smart pointer to a NameData held in a NameDictionary, where names are tracked, de-duplicated, and ref-counted.
     //!
@@ -112,6 +152,10 @@ namespace AZ
         explicit Name(AZStd::string_view name);
         Name(AZStd::string_view name, NameDictionary& nameDictionary);
 
+        //! Creates an instance of a name from a NameLiteral, using its precomputed hash for the lookup.
+        explicit Name(const NameLiteral& nameLiteral);
+        Name(const NameLiteral& nameLiteral, NameDictionary& nameDictionary);
+
         //! Creates an instance of a name from a hash.
         //! The hash will be used to find an existing name in the dictionary. If there is no
         //! name with this hash, the resulting name will be empty.
@@ -25,8 +25,69 @@ namespace AZ
         // Pointer which indicated that the NameDictonary associated with the AZ::Interface
         // was created by the Create function below
         static AZ::EnvironmentVariable<AZStd::unique_ptr<AZ::NameDictionary>> s_staticNameDictionary;
+
+        constexpr size_t MinLookupTableCapacity = 64;
+
+        // Marks lookup table slots of names that were removed, they can't be cleared without breaking the probe sequences
+        Internal::NameData* GetRemovedEntry()
+        {
+            return reinterpret_cast<Internal::NameData*>(static_cast<uintptr_t>(1));
+        }
+
+        // Spreads the threads over the reader counts
+        size_t GetThreadReaderIndex()
+        {
+            static AZStd::atomic<size_t> s_nextReaderIndex{ 0 };
+            thread_local const size_t t_readerIndex = s_nextReaderIndex.fetch_add(1, AZStd::memory_order_relaxed);
+            return t_readerIndex;
+        }
     }
 
+    struct NameDictionary::LookupTable
+    {
+        size_t m_capacity; //!< Always a power of 2
+        unsigned int m_shift;
+        size_t m_usedSlots; //!< Slots holding names or removed entries, one slot is never reused
+        AZStd::atomic<Internal::NameData*>* m_slots;
+
+        static LookupTable* Create(size_t capacity)
+        {
+            void* memory = AZ_OS_MALLOC(sizeof(LookupTable) + capacity * sizeof(AZStd::atomic<Internal::NameData*>), alignof(LookupTable));
+            LookupTable* table = new (memory) LookupTable;
+            table->m_capacity = capacity;
+            unsigned int capacityBits = 0;
+            while ((size_t{ 1 } << capacityBits) < capacity)
+            {
+                ++capacityBits;
+            }
+            table->m_shift = 64 - capacityBits;
+            table->m_usedSlots = 0;
+            table->m_slots = reinterpret_cast<AZStd::atomic<Internal::NameData*>*>(table + 1);
+            for (size_t i = 0; i < capacity; ++i)
+            {
+                new (&table->m_slots[i]) AZStd::atomic<Internal::NameData*>(nullptr);
+            }
+            return table;
+        }
+
+        static void Destroy(LookupTable* table)
+        {
+            table->~LookupTable();
+            AZ_OS_FREE(table);
+        }
+
+        size_t GetFirstIndex(Name::Hash hash) const
+        {
+            // Fibonacci hashing, names with colliding hashes use consecutive hash values which would otherwise cluster
+            return static_cast<size_t>((static_cast<AZ::u64>(hash) * 0x9E3779B97F4A7C15ull) >> m_shift);
+        }
+
+        size_t GetNextIndex(size_t index) const
+        {
+            return (index + 1) & (m_capacity - 1);
+        }
+    };
+
     void NameDictionary::Create()
     {
         using namespace NameDictionaryInternal;
@@ -125,25 +186,69 @@ namespace AZ
         }
 
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
+
+        // No lookups can be in flight anymore
+        for (Internal::NameData* nameData : m_retiredNames)
+        {
+            delete nameData;
+        }
+        for (LookupTable* table : m_retiredTables)
+        {
+            LookupTable::Destroy(table);
+        }
+        if (LookupTable* table = m_lookupTable.exchange(nullptr))
+        {
+            LookupTable::Destroy(table);
+        }
     }
 
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-
-        // The NameData m_useCount check is to avoid a multithread race condition
-        // where thread B is in NameData::release and reduces the m_useCount to 0
-        // and this thread(thread A) construct a Name using that NameData pointer
-        // causing the m_useCount to go back up to 1.
-        // If thread A continues along and releases the NameData again, before thread B can run
-        // the the m_useCount can be reduced to 0 and multiple threads can be in the
-        // NameData::release `if (m_useCount.fetch_sub(1) == 1)` block
-        if (auto iter = m_dictionary.find(hash);
-            iter != m_dictionary.end() && iter->second.m_nameData->m_useCount > 0)
+        // While the reader count is raised, names and tables found through m_lookupTable are not deleted.
+        // The increment and the loads of the table and its slots are sequentially consistent, pairing with the
+        // removal of entries and the reader count checks in ReclaimRetired.
+        AZStd::atomic<uint32_t>& readerCount = m_readerCounts[NameDictionaryInternal::GetThreadReaderIndex() % ReaderCountStripes].m_count;
+        readerCount.fetch_add(1);
+
+        Name name;
+        if (const LookupTable* table = m_lookupTable.load(); table != nullptr)
         {
-            return Name(iter->second.m_nameData);
+            for (size_t index = table->GetFirstIndex(hash);; index = table->GetNextIndex(index))
+            {
+                Internal::NameData* nameData = table->m_slots[index].load();
+                if (nameData == nullptr)
+                {
+                    break;
+                }
+                if (nameData == NameDictionaryInternal::GetRemovedEntry() || nameData->m_hash != hash)
+                {
+                    continue;
+                }
+
+                // Only take a reference while the m_useCount is positive. This avoids a multithread race condition
+                // where thread B is in NameData::release and reduces the m_useCount to 0
+                // and this thread(thread A) construct a Name using that NameData pointer
+                // causing the m_useCount to go back up to 1.
+                // If thread A continues along and releases the NameData again, before thread B can run
+                // the the m_useCount can be reduced to 0 and multiple threads can be in the
+                // NameData::release `if (m_useCount.fetch_sub(1) == 1)` block.
+                // Names with a m_useCount of 0 are resolved by MakeName under the exclusive lock.
+                int32_t useCount = nameData->m_useCount.load(AZStd::memory_order_relaxed);
+                while (useCount > 0 && !nameData->m_useCount.compare_exchange_weak(useCount, useCount + 1))
+                {
+                }
+                if (useCount > 0)
+                {
+                    name = Name(nameData);
+                    // The Name holds its own reference, this one can't be the last
+                    nameData->m_useCount.fetch_sub(1);
+                }
+                break;
+            }
         }
-        return Name();
+
+        readerCount.fetch_sub(1, AZStd::memory_order_release);
+        return name;
     }
 
     void NameDictionary::LoadLiteral(Name& nameLiteral)
@@ -224,10 +329,23 @@ namespace AZ
             return Name();
         }
 
-        Name::Hash hash = CalcHash(nameString);
+        return MakeName(nameString, CalcHash(nameString));
+    }
 
+    Name NameDictionary::MakeName(const NameLiteral& nameLiteral)
+    {
+        if (nameLiteral.GetStringView().empty())
+        {
+            return Name();
+        }
+
+        return MakeName(nameLiteral.GetStringView(), static_cast<Name::Hash>(nameLiteral.GetHash() % m_maxHashSlots));
+    }
+
+    Name NameDictionary::MakeName(AZStd::string_view nameString, Name::Hash hash)
+    {
         // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
+        // This path is faster than the loop below because FindName() doesn't take any lock whereas the
         // loop requires a unique_lock to modify the dictionary.
         Name name = FindName(hash);
         if (name.GetStringView() == nameString)
@@ -236,7 +354,7 @@ namespace AZ
         }
 
         // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::unique_lock<decltype(m_sharedMutex)> lock(m_sharedMutex);
 
         auto iter = m_dictionary.find(hash);
         bool collisionDetected = false;
@@ -249,6 +367,8 @@ namespace AZ
                 nameData->m_hashCollision = collisionDetected;
                 // Piecewise construct to prevent creating a temporary ScopedNameDataWrapper that destructs
                 m_dictionary.emplace(AZStd::piecewise_construct, AZStd::forward_as_tuple(hash), AZStd::forward_as_tuple(*this, nameData));
+                AddToLookupTable(nameData);
+                ReclaimRetired();
                 return Name(nameData);
             }
             // Found the desired entry, return it
@@ -281,7 +401,7 @@ namespace AZ
         //      entry and Name objects pointing to the new entry will fail comparison operations.
 
 
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::unique_lock<decltype(m_sharedMutex)> lock(m_sharedMutex);
 
         auto dictIt = m_dictionary.find(hash);
         if (dictIt == m_dictionary.end())
@@ -312,8 +432,11 @@ namespace AZ
         if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
         {
             m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            // Lookups on other threads may have found the name before it was removed, its deletion is deferred until they finished
+            RemoveFromLookupTable(nameData);
+            m_retiredNames.push_back(nameData);
         }
+        ReclaimRetired();
 
         ReportStats();
     }
@@ -386,10 +509,111 @@ namespace AZ
 
     Name::Hash NameDictionary::CalcHash(AZStd::string_view name)
     {
-        // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
-        // of network synchronization. So just take the low 32 bits.
-        const uint32_t hash = AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF;
-        return static_cast<Name::Hash>(hash % m_maxHashSlots);
+        return static_cast<Name::Hash>(NameLiteral::CalcHash(name) % m_maxHashSlots);
+    }
+
+    void NameDictionary::AddToLookupTable(Internal::NameData* nameData)
+    {
+        LookupTable* table = m_lookupTable.load(AZStd::memory_order_relaxed);
+        // Keep at least half of the slots empty so probe sequences stay short
+        if (table == nullptr || (table->m_usedSlots + 1) * 2 > table->m_capacity)
+        {
+            // The new table is filled from m_dictionary, which already contains the name
+            RebuildLookupTable();
+            return;
+        }
+
+        size_t index = table->GetFirstIndex(nameData->GetHash());
+        while (table->m_slots[index].load(AZStd::memory_order_relaxed) != nullptr)
+        {
+            index = table->GetNextIndex(index);
+        }
+        table->m_slots[index].store(nameData, AZStd::memory_order_release);
+        ++table->m_usedSlots;
+    }
+
+    void NameDictionary::RemoveFromLookupTable(Internal::NameData* nameData)
+    {
+        LookupTable* table = m_lookupTable.load(AZStd::memory_order_relaxed);
+        if (table == nullptr)
+        {
+            return;
+        }
+
+        for (size_t index = table->GetFirstIndex(nameData->GetHash());; index = table->GetNextIndex(index))
+        {
+            Internal::NameData* slotData = table->m_slots[index].load(AZStd::memory_order_relaxed);
+            if (slotData == nullptr)
+            {
+                AZ_Assert(false, "Name '%.*s' is missing from the NameDictionary lookup table", AZ_STRING_ARG(nameData->GetName()));
+                return;
+            }
+            if (slotData == nameData)
+            {
+                // Sequentially consistent so ReclaimRetired observes any lookup that could still have found the name
+                table->m_slots[index].store(NameDictionaryInternal::GetRemovedEntry());
+                return;
+            }
+        }
+    }
+
+    void NameDictionary::RebuildLookupTable()
+    {
+        size_t capacity = NameDictionaryInternal::MinLookupTableCapacity;
+        while (capacity < m_dictionary.size() * 4)
+        {
+            capacity *= 2;
+        }
+
+        LookupTable* table = LookupTable::Create(capacity);
+        for (const auto& entry : m_dictionary)
+        {
+            size_t index = table->GetFirstIndex(entry.first);
+            while (table->m_slots[index].load(AZStd::memory_order_relaxed) != nullptr)
+            {
+                index = table->GetNextIndex(index);
+            }
+            table->m_slots[index].store(entry.second.m_nameData, AZStd::memory_order_relaxed);
+        }
+        table->m_usedSlots = m_dictionary.size();
+
+        if (LookupTable* previousTable = m_lookupTable.exchange(table))
+        {
+            m_retiredTables.push_back(previousTable);
+        }
+    }
+
+    bool NameDictionary::HasActiveReaders() const
+    {
+        // Each lookup raises the count from before it loads the lookup table until it is done with it. A count observed at 0 after
+        // an entry was retired means every lookup on that stripe that could have found the entry finished.
+        for (const ReaderCount& readerCount : m_readerCounts)
+        {
+            if (readerCount.m_count.load() != 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void NameDictionary::ReclaimRetired()
+    {
+        if ((m_retiredNames.empty() && m_retiredTables.empty()) || HasActiveReaders())
+        {
+            return;
+        }
+
+        for (Internal::NameData* nameData : m_retiredNames)
+        {
+            delete nameData;
+        }
+        m_retiredNames.clear();
+        for (LookupTable* table : m_retiredTables)
+        {
+            LookupTable::Destroy(table);
+        }
+        m_retiredTables.clear();
     }
 
 
@@ -9,9 +9,12 @@
 #pragma once
 
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/Debug/LockContentionProfiler.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Name/Name.h>
@@ -43,6 +46,11 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names
     //! that already exist.
+    //!
+    //! Lookups of existing names don't take any lock. They go through an open addressed index of the
+    //! dictionary that is only modified under the exclusive lock and is replaced as a whole when it grows.
+    //! Entries removed from the index, and replaced indices, are only deleted once no lookup that could
+    //! still reference them is in flight.
     class NameDictionary final
     {
     public:
@@ -71,6 +79,11 @@ namespace AZ
         //! @return A Name instance holding a dictionary entry associated with the provided raw string.
         Name MakeName(AZStd::string_view name);
 
+        //! Makes a Name from a NameLiteral, skipping the hashing of the string.
+        //! @param nameLiteral The name and precomputed hash to resolve against the dictionary.
+        //! @return A Name instance holding a dictionary entry associated with the literal's string.
+        Name MakeName(const NameLiteral& nameLiteral);
+
         //! Search for an existing name in the dictionary by hash.
         //! @param hash The key by which to search for the name.
         //! @return A Name instance. If the hash was not found, the Name will be empty.
@@ -104,6 +117,21 @@ namespace AZ
         // Does not attempt to resolve hash collisions; that is handled elsewhere.
         Name::Hash CalcHash(AZStd::string_view name);
 
+        // Makes a Name from the name string, starting the search for an entry at the provided hash.
+        Name MakeName(AZStd::string_view nameString, Name::Hash hash);
+
+        //! Open addressed index from the name hash to the NameData, read without holding m_sharedMutex.
+        struct LookupTable;
+
+        //! The following functions must be called with m_sharedMutex exclusively locked
+        void AddToLookupTable(Internal::NameData* nameData);
+        void RemoveFromLookupTable(Internal::NameData* nameData);
+        //! Replaces the lookup table by one sized for the current number of names, dropping removed entries
+        void RebuildLookupTable();
+        //! Deletes the retired names and lookup tables when no lookup is in flight
+        void ReclaimRetired();
+        bool HasActiveReaders() const;
+
         //! Loads the NameData for a given name literal (a Name created with Name::FromStringLiteral)
         void LoadLiteral(Name& name);
         //! Loads a name that was potentially created before this dictionary, ensuring its name data
@@ -128,7 +156,20 @@ namespace AZ
         };
 
         AZStd::unordered_map<Name::Hash, ScopedNameDataWrapper> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+        mutable AZ::Debug::ProfiledMutex<AZStd::shared_mutex> m_sharedMutex{ "NameDictionary::m_sharedMutex" };
+
+        AZStd::atomic<LookupTable*> m_lookupTable{ nullptr };
+        //! Names and lookup tables that lookups on other threads may still be reading, protected by m_sharedMutex
+        AZStd::vector<Internal::NameData*> m_retiredNames;
+        AZStd::vector<LookupTable*> m_retiredTables;
+
+        //! Number of lookups in flight, spread over cache lines so concurrent lookups on different threads don't contend
+        struct alignas(64) ReaderCount
+        {
+            AZStd::atomic<uint32_t> m_count{ 0 };
+        };
+        static constexpr size_t ReaderCountStripes = 16;
+        mutable ReaderCount m_readerCounts[ReaderCountStripes];
 
         //! A fixed Name used as the head of a linked list of Name literals.
         //! These literals can be static and have lifecycles not coupled to the name dictionary,
@@ -13,6 +13,8 @@
 #include <AzCore/Script/ScriptContextDebug.h>
 #include <AzCore/Script/ScriptProperty.h>
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Script/lua/lua.h>
 #include <AzCore/Serialization/Locale.h>
@@ -3460,11 +3462,18 @@ LUA_API const Node* lua_getDummyNode()
                         , arg->m_name, method->m_name.c_str(), arg->m_name, arg->m_name, arg->m_name, method->m_name.c_str());
 
                     m_fromLua.push_back(AZStd::make_pair(fromStack, argClass));
+                    m_arguments.push_back(arg);
                 }
 
+                // cache everything the method would otherwise be (virtually) asked for on every call
+                m_numArguments = static_cast<int>(m_method->GetNumArguments());
+                m_minNumArguments = static_cast<int>(m_method->GetMinNumberOfArguments());
+                m_isMember = m_method->IsMember();
+
                 if (method->HasResult())
                 {
-                    m_resultToLua = ToLuaStack(context, method->GetResult(), &m_prepareResult, m_resultClass);
+                    m_result = method->GetResult();
+                    m_resultToLua = ToLuaStack(context, m_result, &m_prepareResult, m_resultClass);
                 }
                 else
                 {
@@ -3487,34 +3496,45 @@ LUA_API const Node* lua_getDummyNode()
                 lua_pushcclosure(lua, &LuaScriptCaller::Call, 3);
             }
 
+            // everything the result callback needs, so it captures a single pointer and fits in the small buffer of the AZStd::function,
+            // rather than allocating on every call
+            struct ResultPushState
+            {
+                lua_State* m_lua;
+                const LuaScriptCaller* m_caller;
+                BehaviorArgument* m_result;
+                int m_numResults;
+            };
+
             static int Call(lua_State* lua)
             {
                 LuaScriptCaller* thisPtr = reinterpret_cast<LuaScriptCaller*>(lua_touserdata(lua, lua_upvalueindex(1)));
 
                 // check number of arguments
                 int numElementsOnStack = lua_gettop(lua);
-                if (numElementsOnStack < static_cast<int>(thisPtr->m_method->GetMinNumberOfArguments()))
+                if (numElementsOnStack < thisPtr->m_minNumArguments)
                 {
                     // we can here load default parameters
-                    ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "Not enough arguments for %s(%s) method, we expected %d arguments (left to right), provided %d!", thisPtr->m_method->m_name.c_str(), lua_tostring(lua, lua_upvalueindex(2)), thisPtr->m_method->GetMinNumberOfArguments(), numElementsOnStack);
+                    ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "Not enough arguments for %s(%s) method, we expected %d arguments (left to right), provided %d!", thisPtr->m_method->m_name.c_str(), lua_tostring(lua, lua_upvalueindex(2)), thisPtr->m_minNumArguments, numElementsOnStack);
                     return 0;
                 }
 
                 // there's no limit inherently in BehaviorContext (as there is no document limit in C++), but the LY supported limits default to 40 for Lua, ScriptCanvas, and ScriptEvents.
-                // this limit of 40 is however implicit, for now.
-                BehaviorArgument arguments[40];
+                // this limit of 40 is however implicit, for now. Only the arguments actually passed are constructed.
+                int numArguments = GetMin(thisPtr->m_numArguments, numElementsOnStack);
+                AZStd::fixed_vector<BehaviorArgument, 40> arguments;
+                AZ_Assert(static_cast<int>(arguments.capacity()) >= numArguments, "Increase the argument array size!");
+                arguments.resize(numArguments);
+
                 BehaviorArgument result;
                 ScriptContext::StackVariableAllocator tempData;
                 AZStd::allocator backupAllocator;
                 bool usedBackupAlloc  = false;
 
-                int numArguments = GetMin(static_cast<int>(thisPtr->m_method->GetNumArguments()), numElementsOnStack);
-                AZ_Assert(static_cast<int>(AZ_ARRAY_SIZE(arguments)) >= numArguments, "Increase the argument array size!");
-
                 // for each argument read a variable from the stack to a BehaviorArgument
                 for (int i = 0; i < numArguments; ++i)
                 {
-                    const AZ::BehaviorParameter* parameter = thisPtr->m_method->GetArgument(i);
+                    const AZ::BehaviorParameter* parameter = thisPtr->m_arguments[i];
                     arguments[i].Set(*parameter); // store the type of result we expect (pointer, const, etc.)
                     if (!thisPtr->m_fromLua[i].first(lua, i + 1, arguments[i], thisPtr->m_fromLua[i].second, &tempData))
                     {
@@ -3525,17 +3545,18 @@ LUA_API const Node* lua_getDummyNode()
                 }
 
                 // If this pointer passed, ensure it isn't nil
-                if (thisPtr->m_method->IsMember() &&
+                if (thisPtr->m_isMember &&
                     *arguments[0].GetAsUnsafe<void*>() == nullptr)
                 {
                     ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "Cannot pass nil as 'this' ptr to member function %s.", thisPtr->m_method->m_name.c_str());
                     return 0;
                 }
-                int numResults = 0;
+
+                ResultPushState resultPushState{ lua, thisPtr, &result, 0 };
 
                 if (thisPtr->m_resultToLua)
                 {
-                    result.Set(*thisPtr->m_method->GetResult());
+                    result.Set(*thisPtr->m_result);
 
                     if (thisPtr->m_prepareResult)
                     {
@@ -3543,23 +3564,26 @@ LUA_API const Node* lua_getDummyNode()
                     }
 
                     // TODO: Make it optional for EBuses only, make it light weight too, probably a virtual function for the store result.
-                    result.m_onAssignedResult = AZStd::function<void()>([&]()
+                    ResultPushState* state = &resultPushState;
+                    result.m_onAssignedResult = AZStd::function<void()>([state]()
                     {
-                        if (result.m_value)
+                        if (state->m_result->m_value)
                         {
-                            thisPtr->m_resultToLua(lua, result);
-                            ++numResults;
+                            state->m_caller->m_resultToLua(state->m_lua, *state->m_result);
+                            ++state->m_numResults;
                         }
                     });
                 }
 
-                bool isCalled = thisPtr->m_method->Call(arguments, numArguments, thisPtr->m_resultToLua ? &result : nullptr);
+                bool isCalled = thisPtr->m_method->Call(arguments.data(), numArguments, thisPtr->m_resultToLua ? &result : nullptr);
 
                 if (!isCalled)
                 {
                     ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "Lua failed to call %s method!", thisPtr->m_method->m_name.c_str());
                 }
 
+                int& numResults = resultPushState.m_numResults;
+
                 if (thisPtr->m_resultToLua)
                 {
                     // push result back to lua
@@ -3610,9 +3634,14 @@ LUA_API const Node* lua_getDummyNode()
             }
 
             AZStd::vector<AZStd::pair<LuaLoadFromStack, BehaviorClass*>> m_fromLua;
+            AZStd::vector<const BehaviorParameter*> m_arguments;
             LuaPushToStack m_resultToLua;
             LuaPrepareValue m_prepareResult;
             BehaviorClass* m_resultClass;
+            const BehaviorParameter* m_result = nullptr;
+            int m_numArguments = 0;
+            int m_minNumArguments = 0;
+            bool m_isMember = false;
 
             bool m_isResult;
         };
@@ -5864,6 +5893,7 @@ LUA_API const Node* lua_getDummyNode()
             AZStd::vector< ScriptTypeFactory >  m_scriptPropertyArrayFactories;
             ScriptTypeFactory                   m_scriptPropertyTableFactory;
             Internal::LuaSystemAllocator m_luaAllocator;
+            ScriptContext::GarbageCollectorMode m_garbageCollectorMode = ScriptContext::GarbageCollectorMode::Incremental;
             AZStd::thread::id m_ownerThreadId; // Check if Lua methods (including EBus handlers) are called from background threads.
         };
 
@@ -5910,6 +5940,63 @@ LUA_API const Node* lua_getDummyNode()
         lua_gc(m_impl->m_lua, LUA_GCSTEP, numberOfSteps);
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    bool ScriptContext::GarbageCollectStepBudgeted(int numberOfSteps, AZ::u32 budgetMicroseconds)
+    {
+        if (m_impl->m_garbageCollectorMode == GarbageCollectorMode::Generational)
+        {
+            return lua_gc(m_impl->m_lua, LUA_GCSTEP, numberOfSteps) != 0;
+        }
+
+        const auto startTime = AZStd::chrono::steady_clock::now();
+        const AZStd::chrono::microseconds budget(budgetMicroseconds);
+
+        do
+        {
+            if (lua_gc(m_impl->m_lua, LUA_GCSTEP, numberOfSteps) != 0)
+            {
+                return true;
+            }
+        }
+        while (AZStd::chrono::steady_clock::now() - startTime < budget);
+
+        return false;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    void ScriptContext::SetGarbageCollectorMode(GarbageCollectorMode mode)
+    {
+        if (mode == GarbageCollectorMode::Generational)
+        {
+            // zero keeps the current minor and major multipliers
+            lua_gc(m_impl->m_lua, LUA_GCGEN, 0, 0);
+        }
+        else
+        {
+            lua_gc(m_impl->m_lua, LUA_GCINC, 0, 0, 0);
+        }
+
+        m_impl->m_garbageCollectorMode = mode;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ScriptContext::GarbageCollectorMode ScriptContext::GetGarbageCollectorMode() const
+    {
+        return m_impl->m_garbageCollectorMode;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    void ScriptContext::SetAutomaticGarbageCollection(bool isEnabled)
+    {
+        lua_gc(m_impl->m_lua, isEnabled ? LUA_GCRESTART : LUA_GCSTOP, 0);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    bool ScriptContext::IsAutomaticGarbageCollectionEnabled() const
+    {
+        return lua_gc(m_impl->m_lua, LUA_GCISRUNNING, 0) != 0;
+    }
+
     //////////////////////////////////////////////////////////////////////////
     size_t ScriptContext::GetMemoryUsage() const
     {
@@ -868,6 +868,31 @@ namespace AZ
          */
         void GarbageCollectStep(int numberOfSteps = 2);
 
+        /**
+         * Steps the garbage collector until either the time budget is spent or a collection cycle completes, so the cost of
+         * collection can be bounded and placed at a known point of the frame. At least one step is always performed.
+         * In generational mode every step is a complete (minor) collection, so only a single step is performed.
+         * \returns true if a collection cycle completed.
+         */
+        bool GarbageCollectStepBudgeted(int numberOfSteps, AZ::u32 budgetMicroseconds);
+
+        enum class GarbageCollectorMode
+        {
+            Incremental,
+            Generational,
+        };
+
+        /// Switches the Lua collector between incremental mode (the default) and Lua 5.4 generational mode.
+        void SetGarbageCollectorMode(GarbageCollectorMode mode);
+        GarbageCollectorMode GetGarbageCollectorMode() const;
+
+        /**
+         * When automatic collection is disabled, Lua no longer collects as a side effect of allocation, and memory is only reclaimed
+         * by explicit calls to GarbageCollect, GarbageCollectStep or GarbageCollectStepBudgeted, which must then run regularly.
+         */
+        void SetAutomaticGarbageCollection(bool isEnabled);
+        bool IsAutomaticGarbageCollectionEnabled() const;
+
         lua_State* NativeContext();
 
         //////////////////////////////////////////////////////////////////////////
@@ -183,6 +183,14 @@ ScriptContext* ScriptSystemComponent::AddContextWithId(ScriptContextId id)
     cc.m_context = aznew ScriptContext(id);
     cc.m_isOwner = true;
     cc.m_garbageCollectorSteps = m_defaultGarbageCollectorSteps;
+    if (m_useGenerationalGarbageCollector)
+    {
+        cc.m_context->SetGarbageCollectorMode(ScriptContext::GarbageCollectorMode::Generational);
+    }
+    if (m_disableAutomaticGarbageCollection)
+    {
+        cc.m_context->SetAutomaticGarbageCollection(false);
+    }
     cc.m_context->SetRequireHook(
         [this](lua_State* lua, ScriptContext* context, const char* module) -> int
         {
@@ -310,7 +318,14 @@ void    ScriptSystemComponent::OnSystemTick()
             contextContainer.m_context->GetDebugContext()->ProcessDebugCommands();
         }
 
-        contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+        if (m_garbageCollectorBudgetMicroseconds > 0)
+        {
+            contextContainer.m_context->GarbageCollectStepBudgeted(contextContainer.m_garbageCollectorSteps, m_garbageCollectorBudgetMicroseconds);
+        }
+        else
+        {
+            contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+        }
     }
 }
 
@@ -871,6 +886,9 @@ void ScriptSystemComponent::Reflect(ReflectContext* reflection)
             ->Version(1)
             // ->Attribute(AZ::Edit::Attributes::SystemComponentTags, AZStd::vector<AZ::Crc32>({ AZ_CRC_CE("AssetBuilder") }))
             ->Field("garbageCollectorSteps", &ScriptSystemComponent::m_defaultGarbageCollectorSteps)
+            ->Field("garbageCollectorBudgetMicroseconds", &ScriptSystemComponent::m_garbageCollectorBudgetMicroseconds)
+            ->Field("garbageCollectorGenerational", &ScriptSystemComponent::m_useGenerationalGarbageCollector)
+            ->Field("garbageCollectorManualOnly", &ScriptSystemComponent::m_disableAutomaticGarbageCollection)
             ;
 
         if (EditContext* editContext = serializeContext->GetEditContext())
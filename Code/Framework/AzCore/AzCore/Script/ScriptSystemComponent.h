@@ -124,6 +124,9 @@ namespace AZ
             int                                 m_tableReference = -2; //< The reference to the table returned by the script (default -2 == LUA_NOREF)
         };
         int m_defaultGarbageCollectorSteps;
+        AZ::u32 m_garbageCollectorBudgetMicroseconds = 0; ///< When non zero, each tick keeps stepping the collector until this budget is spent
+        bool m_useGenerationalGarbageCollector = false; ///< Runs the contexts this component owns with the Lua 5.4 generational collector
+        bool m_disableAutomaticGarbageCollection = false; ///< Only collect in OnSystemTick, never as a side effect of a Lua allocation
 
         struct ContextContainer
         {
@@ -37,6 +37,9 @@ namespace AZ
         ///< Marks a node as an action that deactivates self, and does so in a way that is detectable at compile time
         static const AZ::Crc32 DeactivatesInputEntity = AZ_CRC_CE("DeactivatesInputEntity");
 
+        ///< Marks a method as safe to call from any thread, graphs that only call such methods may execute on worker threads
+        static const AZ::Crc32 ThreadSafe = AZ_CRC_CE("ThreadSafe");
+
         ///< This is used to provide a more readable name for ScriptCanvas nodes
         static const AZ::Crc32 PrettyName = AZ_CRC_CE("PrettyName");
         ///< This is used to forbid variable creation of types in ScriptCanvas nodes
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace AZ
+{
+    //! Holds data that is shared between copies until one of them modifies it.
+    //! Cloning an object through the SerializeContext, such as when entities are spawned from a Spawnable, doesn't clone the
+    //! data but shares it with the source object. This is intended for large component configuration that is not modified
+    //! after the component is spawned, for instance asset references, material overrides or collider configurations, so that
+    //! spawned instances share it with the Spawnable instead of each getting their own copy.
+    //! The held type needs to be reflected to the SerializeContext, as the data is serialized as if it was a regular field.
+    template<typename T>
+    class CopyOnWrite
+    {
+    public:
+        CopyOnWrite()
+            : m_data(AZStd::make_shared<T>())
+        {
+        }
+
+        explicit CopyOnWrite(T value)
+            : m_data(AZStd::make_shared<T>(AZStd::move(value)))
+        {
+        }
+
+        const T& Get() const
+        {
+            return *m_data;
+        }
+
+        const T& operator*() const
+        {
+            return *m_data;
+        }
+
+        const T* operator->() const
+        {
+            return m_data.get();
+        }
+
+        //! Returns a modifiable reference to the data, the data is copied first if it's shared with other instances.
+        T& Edit()
+        {
+            if (m_data.use_count() > 1)
+            {
+                m_data = AZStd::make_shared<T>(*m_data);
+            }
+            return *m_data;
+        }
+
+        void Set(T value)
+        {
+            m_data = AZStd::make_shared<T>(AZStd::move(value));
+        }
+
+        //! Returns true if the data is shared with another instance.
+        bool IsShared() const
+        {
+            return m_data.use_count() > 1;
+        }
+
+        static void Reflect(ReflectContext* context)
+        {
+            if (auto serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<CopyOnWrite>()
+                    ->Attribute(SerializeContextAttributes::CloneOverride, &CopyOnWrite::CloneShared)
+                    ->Field("Data", &CopyOnWrite::m_data);
+            }
+        }
+
+    private:
+        static bool CloneShared(const void* source, void* target)
+        {
+            *static_cast<CopyOnWrite*>(target) = *static_cast<const CopyOnWrite*>(source);
+            return true;
+        }
+
+        AZStd::shared_ptr<T> m_data;
+    };
+
+    AZ_TYPE_INFO_TEMPLATE(CopyOnWrite, "{5E0B7C2D-93A4-4F1E-8D26-C4B1E7A09F53}", AZ_TYPE_INFO_TYPENAME);
+} // namespace AZ
@@ -126,14 +126,30 @@ namespace AZ
         : JsonBaseContext(settings.m_metadata, settings.m_reporting,
             StackedString::Format::JsonPointer, settings.m_serializeContext, settings.m_registrationContext)
         , m_clearContainers(settings.m_clearContainers)
+        , m_parallelArrayLoadThreshold(settings.m_parallelArrayLoadThreshold)
     {
     }
 
+    JsonDeserializerContext::JsonDeserializerContext(
+        const JsonDeserializerContext& parent, JsonSerializationResult::JsonIssueCallback reporting)
+        : JsonBaseContext(parent.m_metadata, AZStd::move(reporting),
+            StackedString::Format::JsonPointer, parent.m_serializeContext, parent.m_registrationContext)
+        , m_clearContainers(parent.m_clearContainers)
+        , m_parallelArrayLoadThreshold(parent.m_parallelArrayLoadThreshold)
+    {
+        m_path = parent.m_path;
+    }
+
     bool JsonDeserializerContext::ShouldClearContainers() const
     {
         return m_clearContainers;
     }
 
+    size_t JsonDeserializerContext::GetParallelArrayLoadThreshold() const
+    {
+        return m_parallelArrayLoadThreshold;
+    }
+
 
 
     //
@@ -89,6 +89,9 @@ namespace AZ
     {
     public:
         explicit JsonDeserializerContext(JsonDeserializerSettings& settings);
+        //! Creates a context to load part of the same document on another thread. The new context shares the metadata and
+        //! contexts of the parent, starts at the parent's current path and sends its reports to the provided callback.
+        JsonDeserializerContext(const JsonDeserializerContext& parent, JsonSerializationResult::JsonIssueCallback reporting);
         ~JsonDeserializerContext() override = default;
 
         JsonDeserializerContext(const JsonDeserializerContext&) = delete;
@@ -101,8 +104,12 @@ namespace AZ
         //! Note that this does not apply to containers where elements have a fixed location such as smart pointers or AZStd::tuple.
         bool ShouldClearContainers() const;
 
+        //! Minimum number of entries in an array before its elements are loaded in parallel. 0 if arrays are never loaded in parallel.
+        size_t GetParallelArrayLoadThreshold() const;
+
     private:
         bool m_clearContainers = false;
+        size_t m_parallelArrayLoadThreshold = 0;
     };
 
     class JsonSerializerContext final
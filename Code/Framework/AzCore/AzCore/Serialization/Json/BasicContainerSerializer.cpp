@@ -12,6 +12,11 @@
 #include <AzCore/Serialization/Json/JsonSerializationResult.h>
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 
 namespace AZ
 {
@@ -198,54 +203,66 @@ namespace AZ
             retVal.Combine(result);
         }
         rapidjson::SizeType arraySize = inputValue.Size();
-        for (rapidjson::SizeType i = 0; i < arraySize; ++i)
+        if (CanLoadElementsInParallel(outputValue, *container, capacity, inputValue, context))
         {
-            ScopedContextPath subPath(context, i);
-
-            size_t expectedSize = container->Size(outputValue) + 1;
-
-            if (expectedSize > capacity)
-            {
-                retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Skipped,
-                    "Unable to load more entries in basic container because it's full."));
-                break;
-            }
-
-            void* elementAddress = container->ReserveElement(outputValue, classElement);
-            if (!elementAddress)
-            {
-                return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Catastrophic,
-                    "Failed to allocate an item in the basic container.");
-            }
-            if (classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
-            {
-                *reinterpret_cast<void**>(elementAddress) = nullptr;
-            }
-            
-            JSR::ResultCode result = ContinueLoading(elementAddress, classElement->m_typeId, inputValue[i], context, flags);
+            JSR::ResultCode result = LoadElementsInParallel(outputValue, *container, *classElement, flags, inputValue, context);
             if (result.GetProcessing() == JSR::Processing::Halted)
             {
-                container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
                 return context.Report(retVal, "Failed to read element for basic container.");
             }
-            else if (result.GetProcessing() == JSR::Processing::Altered)
-            {
-                container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
-                retVal.Combine(result);
-            }
-            else
+            retVal.Combine(result);
+        }
+        else
+        {
+            for (rapidjson::SizeType i = 0; i < arraySize; ++i)
             {
-                container->StoreElement(outputValue, elementAddress);
-                if (container->Size(outputValue) != expectedSize)
+                ScopedContextPath subPath(context, i);
+
+                size_t expectedSize = container->Size(outputValue) + 1;
+
+                if (expectedSize > capacity)
                 {
-                    retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Unavailable,
-                        "Unable to store element to basic container."));
+                    retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Skipped,
+                        "Unable to load more entries in basic container because it's full."));
+                    break;
                 }
-                else
+
+                void* elementAddress = container->ReserveElement(outputValue, classElement);
+                if (!elementAddress)
+                {
+                    return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Catastrophic,
+                        "Failed to allocate an item in the basic container.");
+                }
+                if (classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
                 {
+                    *reinterpret_cast<void**>(elementAddress) = nullptr;
+                }
+
+                JSR::ResultCode result = ContinueLoading(elementAddress, classElement->m_typeId, inputValue[i], context, flags);
+                if (result.GetProcessing() == JSR::Processing::Halted)
+                {
+                    container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
+                    return context.Report(retVal, "Failed to read element for basic container.");
+                }
+                else if (result.GetProcessing() == JSR::Processing::Altered)
+                {
+                    container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
                     retVal.Combine(result);
                 }
-            } 
+                else
+                {
+                    container->StoreElement(outputValue, elementAddress);
+                    if (container->Size(outputValue) != expectedSize)
+                    {
+                        retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Unavailable,
+                            "Unable to store element to basic container."));
+                    }
+                    else
+                    {
+                        retVal.Combine(result);
+                    }
+                } 
+            }
         }
 
         if (!retVal.HasDoneWork() && inputValue.Empty())
@@ -265,4 +282,187 @@ namespace AZ
             "Partially read data for basic container.";
         return context.Report(retVal, message);
     }
+
+    bool JsonBasicContainerSerializer::CanLoadElementsInParallel(void* outputValue, const SerializeContext::IDataContainer& container,
+        size_t capacity, const rapidjson::Value& inputValue, const JsonDeserializerContext& context) const
+    {
+        const size_t threshold = context.GetParallelArrayLoadThreshold();
+        if (threshold == 0 || inputValue.Size() < threshold)
+        {
+            return false;
+        }
+
+        // All elements are added before they're loaded, which requires their addresses to be retrievable by index.
+        // Fixed capacity containers that can't hold all entries are loaded sequentially so they report the same skipped entries.
+        if (!container.IsSequenceContainer() || !container.CanAccessElementsByIndex() ||
+            capacity - container.Size(outputValue) < inputValue.Size())
+        {
+            return false;
+        }
+
+        // Waiting for the tasks from a task worker could deadlock the executor, such as when the array is nested in another array
+        // that's being loaded in parallel.
+        return Interface<TaskGraphActiveInterface>::Get() != nullptr && Interface<TaskGraphActiveInterface>::Get()->IsTaskGraphActive() &&
+            TaskExecutor::GetCurrentExecutor() == nullptr;
+    }
+
+    JsonSerializationResult::ResultCode JsonBasicContainerSerializer::LoadElementsInParallel(void* outputValue,
+        SerializeContext::IDataContainer& container, const SerializeContext::ClassElement& classElement, ContinuationFlags flags,
+        const rapidjson::Value& inputValue, JsonDeserializerContext& context)
+    {
+        namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
+
+        const bool isPointer = (classElement.m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER) != 0;
+        const size_t elementCount = inputValue.Size();
+        const size_t firstIndex = container.Size(outputValue);
+        for (size_t i = 0; i < elementCount; ++i)
+        {
+            void* elementAddress = container.ReserveElement(outputValue, &classElement);
+            if (!elementAddress)
+            {
+                ScopedContextPath subPath(context, i);
+                return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Catastrophic,
+                    "Failed to allocate an item in the basic container.");
+            }
+            if (isPointer)
+            {
+                *reinterpret_cast<void**>(elementAddress) = nullptr;
+            }
+            container.StoreElement(outputValue, elementAddress);
+        }
+        if (container.Size(outputValue) != firstIndex + elementCount)
+        {
+            return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Unavailable, "Unable to store elements to basic container.");
+        }
+
+        // Each task loads a range of entries using its own context, which records the reports so they can be forwarded in order
+        struct Report
+        {
+            AZStd::string m_message;
+            AZStd::string m_path;
+            JSR::ResultCode m_result;
+            size_t m_index;
+        };
+        struct Batch
+        {
+            AZStd::vector<Report> m_reports;
+            AZStd::vector<JSR::ResultCode> m_results;
+            size_t m_begin = 0;
+            size_t m_end = 0;
+            size_t m_current = 0;
+        };
+
+        constexpr size_t MinElementsPerBatch = 64;
+        const size_t batchCount = AZStd::clamp<size_t>(
+            (elementCount + MinElementsPerBatch - 1) / MinElementsPerBatch, 1, TaskExecutor::Instance().GetWorkerCount() * 4);
+        const size_t elementsPerBatch = (elementCount + batchCount - 1) / batchCount;
+        AZStd::vector<Batch> batches(batchCount);
+
+        // Lowest index of an entry that halted so far. Entries after it are dropped anyway, so batches stop once they reach it.
+        AZStd::atomic<size_t> haltedIndex{ elementCount };
+
+        static const TaskDescriptor loadDescriptor{ "JsonBasicContainerSerializer::LoadElementsInParallel", "Serialization" };
+        TaskGraph graph{ "JsonArrayLoad" };
+        for (size_t batchIndex = 0; batchIndex < batchCount; ++batchIndex)
+        {
+            Batch& batch = batches[batchIndex];
+            batch.m_begin = batchIndex * elementsPerBatch;
+            batch.m_end = AZStd::min(elementCount, batch.m_begin + elementsPerBatch);
+            graph.AddTask(loadDescriptor,
+                [this, &batch, &haltedIndex, &container, &classElement, &inputValue, &context, outputValue, firstIndex, flags]()
+                {
+                    auto recordReport = [&batch](AZStd::string_view message, JSR::ResultCode result, AZStd::string_view path)
+                    {
+                        batch.m_reports.push_back(Report{ AZStd::string(message), AZStd::string(path), result, batch.m_current });
+                        return result;
+                    };
+                    JsonDeserializerContext batchContext(context, AZStd::move(recordReport));
+
+                    batch.m_results.reserve(batch.m_end - batch.m_begin);
+                    for (size_t i = batch.m_begin; i < batch.m_end && i < haltedIndex.load(AZStd::memory_order_relaxed); ++i)
+                    {
+                        batch.m_current = i;
+                        ScopedContextPath subPath(batchContext, i);
+                        void* elementAddress = container.GetElementByIndex(outputValue, &classElement, firstIndex + i);
+                        JSR::ResultCode result = ContinueLoading(elementAddress, classElement.m_typeId,
+                            inputValue[static_cast<rapidjson::SizeType>(i)], batchContext, flags);
+                        batch.m_results.push_back(result);
+                        if (result.GetProcessing() == JSR::Processing::Halted)
+                        {
+                            size_t lowestHaltedIndex = haltedIndex.load(AZStd::memory_order_relaxed);
+                            while (i < lowestHaltedIndex && !haltedIndex.compare_exchange_weak(lowestHaltedIndex, i, AZStd::memory_order_relaxed))
+                            {
+                            }
+                            break;
+                        }
+                    }
+                });
+        }
+        TaskGraphEvent finishedEvent{ "JsonArrayLoad Wait" };
+        graph.Submit(&finishedEvent);
+        finishedEvent.Wait();
+
+        // Forward the reports in order. The reporter decides whether an issue halts loading, so loading stops at the first entry
+        // it halted on, same as loading sequentially. Reports for entries after the one that halted are dropped, as those entries
+        // wouldn't have been loaded sequentially.
+        size_t lastIndex = haltedIndex.load();
+        JSR::ResultCode reporterHaltedResult(JSR::Tasks::ReadField);
+        bool reporterHalted = false;
+        for (const Batch& batch : batches)
+        {
+            for (const Report& report : batch.m_reports)
+            {
+                if (report.m_index > lastIndex)
+                {
+                    break;
+                }
+                JSR::ResultCode result = context.GetReporter()(report.m_message, report.m_result, report.m_path);
+                if (result.GetProcessing() == JSR::Processing::Halted && report.m_result.GetProcessing() != JSR::Processing::Halted)
+                {
+                    lastIndex = report.m_index;
+                    reporterHaltedResult = result;
+                    reporterHalted = true;
+                    break;
+                }
+            }
+            if (reporterHalted)
+            {
+                break;
+            }
+        }
+
+        JSR::ResultCode retVal(JSR::Tasks::ReadField);
+        AZStd::vector<size_t> rejectedIndices;
+        const bool halted = lastIndex < elementCount;
+        const size_t loadedCount = halted ? lastIndex : elementCount;
+        for (const Batch& batch : batches)
+        {
+            for (size_t i = batch.m_begin; i < batch.m_end && i < loadedCount; ++i)
+            {
+                const JSR::ResultCode& result = batch.m_results[i - batch.m_begin];
+                if (result.GetProcessing() == JSR::Processing::Altered)
+                {
+                    rejectedIndices.push_back(i);
+                }
+                retVal.Combine(result);
+            }
+        }
+        if (halted)
+        {
+            retVal.Combine(reporterHalted ? reporterHaltedResult : batches[lastIndex / elementsPerBatch].m_results[lastIndex % elementsPerBatch]);
+        }
+
+        // Same as loading sequentially: entries that were altered aren't stored and loading stops at the first entry that halted
+        for (size_t i = elementCount; i > loadedCount; --i)
+        {
+            container.RemoveElement(outputValue, container.GetElementByIndex(outputValue, &classElement, firstIndex + i - 1),
+                context.GetSerializeContext());
+        }
+        for (auto it = rejectedIndices.rbegin(); it != rejectedIndices.rend(); ++it)
+        {
+            container.RemoveElement(outputValue, container.GetElementByIndex(outputValue, &classElement, firstIndex + *it),
+                context.GetSerializeContext());
+        }
+        return retVal;
+    }
 } // namespace AZ
@@ -32,5 +32,15 @@ namespace AZ
     private:
         JsonSerializationResult::Result LoadContainer(void* outputValue, const Uuid& outputValueTypeId, const rapidjson::Value& inputValue,
             JsonDeserializerContext& context);
+
+        //! Returns true if the entries of the array can be loaded on multiple threads.
+        bool CanLoadElementsInParallel(void* outputValue, const SerializeContext::IDataContainer& container, size_t capacity,
+            const rapidjson::Value& inputValue, const JsonDeserializerContext& context) const;
+        //! Adds an element for every entry in the array to the container and loads them on the TaskExecutor.
+        //! Issues are forwarded to the reporter in order afterwards. Loading stops at the first entry that halted, either while loading
+        //! or because the reporter halted on one of its issues.
+        JsonSerializationResult::ResultCode LoadElementsInParallel(void* outputValue, SerializeContext::IDataContainer& container,
+            const SerializeContext::ClassElement& classElement, ContinuationFlags flags, const rapidjson::Value& inputValue,
+            JsonDeserializerContext& context);
     };
 } // namespace AZ
@@ -36,6 +36,13 @@ namespace AZ
         //! any values in the container will be kept and not overwritten.
         //! Note that this does not apply to containers where elements have a fixed location such as smart pointers or AZStd::tuple.
         bool m_clearContainers = false;
+
+        //! Arrays with at least this many entries that are loaded into a random access container such as AZStd::vector have their
+        //! elements loaded in parallel on the TaskExecutor. Set to 0 to load all arrays on the calling thread.
+        //! Only enable this if the serializers and the metadata used by the elements are safe to use from multiple threads.
+        //! Issues found while loading the elements in parallel are forwarded to the reporting callback after all elements have been
+        //! loaded, so changes made by the callback to their result codes don't affect how the elements are loaded.
+        size_t m_parallelArrayLoadThreshold = 0;
     };
 
     //! Optional settings used while storing an object to a json value.
@@ -236,6 +236,9 @@ namespace AZ
             AZStd::vector<char> m_buffer2;
             IO::ByteContainerStream<AZStd::vector<char> > m_inStream;
             IO::ByteContainerStream<AZStd::vector<char> > m_outStream;
+            /// Value of the last binary element read by ReadElement when it's used directly from the source stream's buffer
+            /// instead of being copied into m_inStream, nullptr otherwise.
+            const void* m_inPlaceValue = nullptr;
 
             // other state info
             // keep tracks of the number of WriteElements that have
@@ -790,15 +793,19 @@ namespace AZ
                     classData->m_eventHandler->OnWriteBegin(dataAddress);
                 }
 
+                // The value was read directly from the source stream's buffer
+                const void* inPlaceValue = isConvertedData ? nullptr : m_inPlaceValue;
+
                 if (const auto* genericTypeInfo = m_sc->FindGenericClassInfo(element.m_id); genericTypeInfo && genericTypeInfo->GetGenericTypeId() == GetAssetClassId())
                 {
                     AZ_Assert(dataAddress, "Reference field address is invalid");
                     AZ_Assert(classData->m_serializer, "Asset references should always have a serializer defined");
 
+                    IO::MemoryStream inPlaceStream(inPlaceValue, element.m_dataSize);
                     // Intercept asset references so we can forward asset load filter information.
                     bool loaded = static_cast<AssetSerializer*>(classData->m_serializer.get())->LoadWithFilter(
                         dataAddress,
-                        *element.m_stream,
+                        inPlaceValue ? static_cast<IO::GenericStream&>(inPlaceStream) : *element.m_stream,
                         element.m_version,
                         m_filterDesc.m_assetCB,
                         element.m_dataType == SerializeContext::DataElement::DT_BINARY_BE);
@@ -813,7 +820,9 @@ namespace AZ
                 {
                     // Wrap the stream
                     IO::GenericStream* currentStream = &m_inStream;
-                    IO::MemoryStream memStream(m_inStream.GetData()->data(), 0, element.m_dataSize);
+                    IO::MemoryStream memStream = inPlaceValue
+                        ? IO::MemoryStream(inPlaceValue, element.m_dataSize)
+                        : IO::MemoryStream(m_inStream.GetData()->data(), 0, element.m_dataSize);
                     currentStream = &memStream;
 
                     if (element.m_byteStream.GetLength() > 0)
@@ -1042,6 +1051,7 @@ namespace AZ
             element.m_buffer.clear();
             element.m_stream->Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
             element.m_id = AZ::Uuid::CreateNull();
+            m_inPlaceValue = nullptr;
 
             cd = nullptr;
 
@@ -1409,7 +1419,17 @@ namespace AZ
 
                     element.m_dataSize = valueBytes;
                     element.m_stream->Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
-                    if (element.m_dataSize)
+
+                    // Leaf values that are loaded straight into the object by their serializer don't need an intermediate
+                    // copy when the source stream is memory backed. Elements read for version conversion keep the copy,
+                    // as they outlive the read position.
+                    const bool canReadInPlace = element.m_stream == &m_inStream && cd && cd->m_serializer && !cd->IsDeprecated();
+                    if (element.m_dataSize && canReadInPlace)
+                    {
+                        m_inPlaceValue = m_stream->ReadInPlace(valueBytes);
+                    }
+
+                    if (element.m_dataSize && !m_inPlaceValue)
                     {
                         // Directly copy data from m_stream into element.m_stream
                         [[maybe_unused]] IO::SizeType bytesWritten = element.m_stream->WriteFromStream(valueBytes, m_stream);
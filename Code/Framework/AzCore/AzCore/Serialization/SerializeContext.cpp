@@ -85,6 +85,11 @@ namespace AZ
             AZ_SERIALIZE_SWAP_ENDIAN(value, isDataBigEndian);
             return static_cast<size_t>(stream.Write(sizeof(T), reinterpret_cast<const void*>(&value)));
         }
+
+        size_t GetTriviallyCopyableSize() const override
+        {
+            return sizeof(T);
+        }
     };
 
 
@@ -550,6 +555,7 @@ namespace AZ
 
     auto SerializeContext::RegisterType(const AZ::TypeId& typeId, AZ::Serialize::ClassData&& classData, CreateAnyFunc createAnyFunc) -> ClassBuilder
     {
+        ResetFlatLayouts();
         auto [typeToClassIter, inserted] = m_uuidMap.try_emplace(typeId, AZStd::move(classData));
         m_classNameToUuid.emplace(AZ::Crc32(typeToClassIter->second.m_name), typeId);
         m_uuidAnyCreationMap.emplace(typeId, createAnyFunc);
@@ -590,6 +596,7 @@ namespace AZ
     //=========================================================================
     void SerializeContext::ClassDeprecate(const char* name, const AZ::Uuid& typeUuid, VersionConverter converter)
     {
+        ResetFlatLayouts();
         if (IsRemovingReflection())
         {
             m_uuidMap.erase(typeUuid);
@@ -896,6 +903,7 @@ namespace AZ
         };
         callback(AddDeprecatedNames);
 
+        ResetFlatLayouts();
         m_classNameToUuid.emplace(AZ::Crc32(className), classTypeId);
         auto result = m_uuidMap.emplace(
             classTypeId,
@@ -1795,9 +1803,26 @@ namespace AZ
             classData->m_eventHandler->OnWriteBegin(destPtr);
         }
 
+        // Classes can copy their instances themselves, such as to share immutable data between the source and the clone
+        if (auto cloneOverride = azrtti_cast<AttributeFunction<bool(const void*, void*)>*>(
+                classData->FindAttribute(SerializeContextAttributes::CloneOverride));
+            cloneOverride && cloneOverride->Invoke(nullptr, srcPtr, destPtr))
+        {
+            ObjectCloneData::ParentInfo& parentInfo = cloneData->m_parentStack.emplace_back();
+            parentInfo.m_ptr = destPtr;
+            parentInfo.m_reservePtr = reservePtr;
+            parentInfo.m_classData = classData;
+            parentInfo.m_containerIndexCounter = 0;
+            return false;
+        }
+
         if (classData->m_serializer)
         {
-            if (const auto* genericInfo = elementData ? elementData->m_genericClassInfo : FindGenericClassInfo(classData->m_typeId);
+            if (const size_t valueSize = classData->m_serializer->GetTriviallyCopyableSize(); valueSize > 0)
+            {
+                memcpy(destPtr, srcPtr, valueSize);
+            }
+            else if (const auto* genericInfo = elementData ? elementData->m_genericClassInfo : FindGenericClassInfo(classData->m_typeId);
                     genericInfo && genericInfo->GetGenericTypeId() == GetAssetClassId())
             {
                 // Optimized clone path for asset references.
@@ -1823,15 +1848,128 @@ namespace AZ
             classData->m_container->ClearElements(destPtr, this);
         }
 
+        // Classes made only of trivially copyable elements are copied at once, without enumerating their elements
+        const FlatLayout* flatLayout = FindFlatLayout(classData);
+        if (flatLayout)
+        {
+            for (const TriviallyCopyableRange& range : *flatLayout)
+            {
+                memcpy(reinterpret_cast<char*>(destPtr) + range.m_offset, reinterpret_cast<const char*>(srcPtr) + range.m_offset, range.m_size);
+            }
+        }
+
         // push this node in the stack
         ObjectCloneData::ParentInfo& parentInfo = cloneData->m_parentStack.emplace_back();
         parentInfo.m_ptr = destPtr;
         parentInfo.m_reservePtr = reservePtr;
         parentInfo.m_classData = classData;
         parentInfo.m_containerIndexCounter = 0;
+        return flatLayout == nullptr;
+    }
+
+    //=========================================================================
+    // FindFlatLayout
+    //=========================================================================
+    auto SerializeContext::FindFlatLayout(const ClassData* classData) const -> const FlatLayout*
+    {
+        if (classData->m_container || classData->m_serializer || classData->m_elements.empty())
+        {
+            return nullptr;
+        }
+
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_flatLayoutMutex);
+            if (auto layoutIt = m_flatLayouts.find(classData); layoutIt != m_flatLayouts.end())
+            {
+                return layoutIt->second.empty() ? nullptr : &layoutIt->second;
+            }
+        }
+
+        FlatLayout layout;
+        if (BuildFlatLayout(classData, 0, layout))
+        {
+            // Merge adjacent ranges, so members without padding between them are copied together
+            AZStd::sort(layout.begin(), layout.end(),
+                [](const TriviallyCopyableRange& lhs, const TriviallyCopyableRange& rhs)
+                {
+                    return lhs.m_offset < rhs.m_offset;
+                });
+            FlatLayout mergedLayout;
+            for (const TriviallyCopyableRange& range : layout)
+            {
+                if (!mergedLayout.empty() && mergedLayout.back().m_offset + mergedLayout.back().m_size == range.m_offset)
+                {
+                    mergedLayout.back().m_size += range.m_size;
+                }
+                else
+                {
+                    mergedLayout.push_back(range);
+                }
+            }
+            layout = AZStd::move(mergedLayout);
+        }
+        else
+        {
+            layout.clear();
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_flatLayoutMutex);
+        auto [layoutIt, inserted] = m_flatLayouts.emplace(classData, AZStd::move(layout));
+        return layoutIt->second.empty() ? nullptr : &layoutIt->second;
+    }
+
+    //=========================================================================
+    // BuildFlatLayout
+    //=========================================================================
+    bool SerializeContext::BuildFlatLayout(const ClassData* classData, size_t baseOffset, FlatLayout& layout) const
+    {
+        if (classData->m_container || classData->m_eventHandler || classData->m_version == Serialize::VersionClassDeprecated ||
+            classData->m_typeId == SerializeTypeInfo<DynamicSerializableField>::GetUuid())
+        {
+            return false;
+        }
+
+        for (const ClassElement& element : classData->m_elements)
+        {
+            if (element.m_flags & (ClassElement::FLG_POINTER | ClassElement::FLG_DYNAMIC_FIELD))
+            {
+                return false;
+            }
+
+            const ClassData* elementClassData = element.m_genericClassInfo
+                ? element.m_genericClassInfo->GetClassData()
+                : FindClassData(element.m_typeId, classData, element.m_nameCrc);
+            if (!elementClassData || elementClassData->m_eventHandler)
+            {
+                return false;
+            }
+
+            if (elementClassData->m_serializer)
+            {
+                const size_t valueSize = elementClassData->m_serializer->GetTriviallyCopyableSize();
+                if (valueSize == 0 || valueSize != element.m_dataSize)
+                {
+                    return false;
+                }
+                layout.push_back({ baseOffset + element.m_offset, valueSize });
+            }
+            else if (!BuildFlatLayout(elementClassData, baseOffset + element.m_offset, layout))
+            {
+                return false;
+            }
+        }
         return true;
     }
 
+    //=========================================================================
+    // ResetFlatLayouts
+    //=========================================================================
+    void SerializeContext::ResetFlatLayouts()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_flatLayoutMutex);
+        m_flatLayouts.clear();
+    }
+
     //=========================================================================
     // EndCloneElement (internal element clone callbacks)
     //=========================================================================
@@ -2037,6 +2175,7 @@ namespace AZ
     //=========================================================================
     void SerializeContext::RemoveClassData(ClassData* classData)
     {
+        ResetFlatLayouts();
         if (m_editContext)
         {
             m_editContext->RemoveClassData(classData);
@@ -28,6 +28,7 @@
 #include <AzCore/std/typetraits/is_base_of.h>
 #include <AzCore/std/any.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 
 #include <AzCore/std/functional.h>
 
@@ -66,6 +67,11 @@ namespace AZ::SerializeContextAttributes
     // Attribute used to set an override function on a SerializeContext::ClassData attribute array
     // which can be used to override the ObjectStream WriteElement call to write out reflected data differently
     static const AZ::Crc32 ObjectStreamWriteElementOverride = AZ_CRC_CE("ObjectStreamWriteElementOverride");
+
+    // Attribute used to set a function with the signature bool(const void* source, void* target) on a SerializeContext::ClassData
+    // attribute array, which is called by CloneObject to copy an instance of the class instead of cloning its elements one by one.
+    // The function returns false to fall back to the default clone.
+    static const AZ::Crc32 CloneOverride = AZ_CRC_CE("CloneOverride");
 }
 namespace AZ
 {
@@ -444,6 +450,22 @@ namespace AZ
         bool BeginCloneElementInplace(void* rootDestPtr, void* ptr, const ClassData* classData, const ClassElement* elementData, void* stackData, ErrorHandler* errorHandler, AZStd::vector<char>* scratchBuffer);
         bool EndCloneElement(void* stackData);
 
+        /// Byte range of an object that cloning can copy with memcpy.
+        struct TriviallyCopyableRange
+        {
+            size_t m_offset;
+            size_t m_size;
+        };
+        using FlatLayout = AZStd::vector<TriviallyCopyableRange>;
+
+        /// Returns the cached flat layout of a class whose reflected elements are all trivially copyable, which lets
+        /// cloning copy the whole object without enumerating its elements.
+        /// Returns nullptr if some elements need to be cloned individually, such as pointers, containers or types with event handlers.
+        const FlatLayout* FindFlatLayout(const ClassData* classData) const;
+        bool BuildFlatLayout(const ClassData* classData, size_t baseOffset, FlatLayout& layout) const;
+        /// Clears the cached flat layouts, as they depend on the reflection of the element types
+        void ResetFlatLayouts();
+
         /**
          * Internal structure to maintain class information while we are describing a class.
          * User should call variety of functions to describe class features and data.
@@ -678,6 +700,9 @@ namespace AZ
         AZStd::unordered_map<TypeId, TypeId> m_enumTypeIdToUnderlyingTypeIdMap; ///< Uuid to keep track of the correspond underlying type id for an enum type that is reflected as a Field within the SerializeContext
         AZStd::vector<AZStd::unique_ptr<IDataContainer>> m_dataContainers; ///< Takes care of all related IDataContainer's lifetimes
 
+        mutable AZStd::shared_mutex m_flatLayoutMutex;
+        mutable AZStd::unordered_map<const ClassData*, FlatLayout> m_flatLayouts; ///< Flat layouts computed by cloning, empty if the class can't be copied flat
+
         class PerModuleGenericClassInfo;
         AZStd::unordered_set<PerModuleGenericClassInfo*>  m_perModuleSet; ///< Stores the static PerModuleGenericClass structures keeps track of reflected GenericClassInfo per module
 
@@ -1051,6 +1076,10 @@ namespace AZ::Serialize
 
         /// Optional post processing of the cloned data to deal with members that are not serialize-reflected.
         virtual void PostClone(void* /*classPtr*/) {}
+
+        /// Returns the size of the type if an instance can be cloned by copying its bytes, otherwise 0.
+        /// Cloning then copies the memory instead of saving and loading the value through a stream.
+        virtual size_t GetTriviallyCopyableSize() const { return 0; }
     };
 
     /**
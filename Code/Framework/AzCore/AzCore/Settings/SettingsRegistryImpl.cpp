@@ -9,6 +9,7 @@
 #include <cctype>
 #include <cerrno>
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/StartupTimeline.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/FileReader.h>
 #include <AzCore/JSON/error/en.h>
@@ -18,7 +19,9 @@
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/Serialization/Locale.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Settings/SettingsRegistryMergeCache.h>
 #include <AzCore/std/sort.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/ranges/ranges_algorithm.h>
 #include <AzCore/std/ranges/split_view.h>
@@ -49,10 +52,124 @@ namespace AZ::SettingsRegistryImplInternal
 
         return Type::NoType;
     }
+
+    [[nodiscard]] AZ::SettingsRegistryInterface::SettingsType GetSettingsType(const rapidjson::Value* value)
+    {
+        using Signedness = AZ::SettingsRegistryInterface::Signedness;
+        AZ::SettingsRegistryInterface::SettingsType type;
+        if (value != nullptr)
+        {
+            type.m_type = RapidjsonToSettingsRegistryType(*value);
+            if (value->IsInt64())
+            {
+                type.m_signedness = Signedness::Signed;
+            }
+            else if (value->IsUint64())
+            {
+                type.m_signedness = Signedness::Unsigned;
+            }
+        }
+        return type;
+    }
+
+    // Spreads the threads over the snapshot reader counts
+    size_t GetThreadReaderIndex()
+    {
+        static AZStd::atomic<size_t> s_nextReaderIndex{ 0 };
+        thread_local const size_t t_readerIndex = s_nextReaderIndex.fetch_add(1, AZStd::memory_order_relaxed);
+        return t_readerIndex;
+    }
+
+    struct IndexedValue
+    {
+        size_t m_pathOffset;
+        size_t m_pathLength;
+        const rapidjson::Value* m_value;
+    };
+
+    // Appends @value and all of its descendants to @indexedValues, using their JSON pointer appended to @paths as the key
+    void IndexValues(AZStd::vector<IndexedValue>& indexedValues, AZStd::string& paths, AZStd::string& path, const rapidjson::Value& value)
+    {
+        indexedValues.push_back({ paths.size(), path.size(), &value });
+        paths += path;
+
+        const size_t parentPathLength = path.size();
+        if (value.IsObject())
+        {
+            for (const auto& member : value.GetObject())
+            {
+                // Escape the key the same way as the JSON pointers used to look it up, '~' as "~0" and '/' as "~1"
+                path += '/';
+                for (const char* key = member.name.GetString(), *keyEnd = key + member.name.GetStringLength(); key != keyEnd; ++key)
+                {
+                    switch (*key)
+                    {
+                    case '~':
+                        path += "~0";
+                        break;
+                    case '/':
+                        path += "~1";
+                        break;
+                    default:
+                        path += *key;
+                        break;
+                    }
+                }
+                IndexValues(indexedValues, paths, path, member.value);
+                path.resize(parentPathLength);
+            }
+        }
+        else if (value.IsArray())
+        {
+            for (rapidjson::SizeType index = 0; index < value.Size(); ++index)
+            {
+                char indexString[16];
+                azsnprintf(indexString, AZ_ARRAY_SIZE(indexString), "/%u", index);
+                path += indexString;
+                IndexValues(indexedValues, paths, path, value[index]);
+                path.resize(parentPathLength);
+            }
+        }
+    }
 }
 
 namespace AZ
 {
+    struct SettingsRegistryImpl::SettingsSnapshot
+    {
+        AZ_CLASS_ALLOCATOR(SettingsSnapshot, AZ::OSAllocator);
+
+        SettingsSnapshot(const rapidjson::Value& settings, AZ::u64 version)
+            : m_version(version)
+        {
+            m_settings.CopyFrom(settings, m_settings.GetAllocator(), true);
+
+            AZStd::vector<SettingsRegistryImplInternal::IndexedValue> indexedValues;
+            AZStd::string path;
+            SettingsRegistryImplInternal::IndexValues(indexedValues, m_paths, path, m_settings);
+
+            // The keys can only refer to m_paths once it stopped growing
+            m_pathIndex.reserve(indexedValues.size());
+            for (const SettingsRegistryImplInternal::IndexedValue& indexedValue : indexedValues)
+            {
+                m_pathIndex.emplace(AZStd::string_view(m_paths).substr(indexedValue.m_pathOffset, indexedValue.m_pathLength), indexedValue.m_value);
+            }
+        }
+
+        //! Returns the value at the JSON pointer or nullptr if there is none
+        const rapidjson::Value* Find(AZStd::string_view path) const
+        {
+            auto foundIt = m_pathIndex.find(path);
+            return foundIt != m_pathIndex.end() ? foundIt->second : nullptr;
+        }
+
+        rapidjson::Document m_settings;
+        AZ::u64 m_version;
+        //! JSON pointers of all the values, the keys of m_pathIndex refer to it
+        AZStd::string m_paths;
+        AZStd::unordered_map<AZStd::string_view, const rapidjson::Value*> m_pathIndex;
+    };
+
     SettingsRegistryImpl::ScopedMergeEvent::ScopedMergeEvent(SettingsRegistryImpl& settingsRegistry,
         MergeEventArgs mergeEventArgs)
         : m_settingsRegistry{ settingsRegistry }
@@ -77,6 +194,98 @@ namespace AZ
         }
     }
 
+    template<typename ReadValue>
+    bool SettingsRegistryImpl::ReadFromSnapshot(AZStd::string_view path, ReadValue&& readValue) const
+    {
+        // URI fragment representations of JSON pointers aren't indexed, they are looked up in the locked settings
+        if (!m_useSnapshotReads.load(AZStd::memory_order_relaxed) || (!path.empty() && path.front() == '#'))
+        {
+            return false;
+        }
+
+        // While the reader count is raised, the snapshot loaded from m_snapshot is not deleted.
+        // The increment and the load of the snapshot are sequentially consistent, pairing with the exchange
+        // of the snapshot and the reader count checks in ReclaimRetiredSnapshots.
+        AZStd::atomic<AZ::u32>& readerCount =
+            m_snapshotReaderCounts[SettingsRegistryImplInternal::GetThreadReaderIndex() % SnapshotReaderCountStripes].m_count;
+        readerCount.fetch_add(1);
+
+        bool snapshotRead = false;
+        if (const SettingsSnapshot* snapshot = m_snapshot.load(); snapshot != nullptr && snapshot->m_version == m_settingsVersion.load())
+        {
+            readValue(snapshot->Find(path));
+            snapshotRead = true;
+        }
+
+        readerCount.fetch_sub(1, AZStd::memory_order_release);
+        return snapshotRead;
+    }
+
+    void SettingsRegistryImpl::InvalidateSnapshot()
+    {
+        m_settingsVersion.fetch_add(1);
+    }
+
+    void SettingsRegistryImpl::OnLockedRead() const
+    {
+        if (!m_useSnapshotReads.load(AZStd::memory_order_relaxed))
+        {
+            return;
+        }
+
+        // Rebuilding the snapshot copies all the settings, only do it once they are read more than they are modified
+        // instead of after every modification while the registry is being merged
+        const AZ::u64 settingsVersion = m_settingsVersion.load(AZStd::memory_order_relaxed);
+        if (m_lockedReadsVersion != settingsVersion)
+        {
+            m_lockedReadsVersion = settingsVersion;
+            m_lockedReadCount = 0;
+        }
+        if (++m_lockedReadCount >= SnapshotRebuildReadCount)
+        {
+            RebuildSnapshot();
+            m_lockedReadCount = 0;
+        }
+    }
+
+    void SettingsRegistryImpl::RebuildSnapshot() const
+    {
+        const SettingsSnapshot* currentSnapshot = m_snapshot.load(AZStd::memory_order_relaxed);
+        const AZ::u64 settingsVersion = m_settingsVersion.load(AZStd::memory_order_relaxed);
+        if (currentSnapshot == nullptr || currentSnapshot->m_version != settingsVersion)
+        {
+            if (SettingsSnapshot* previousSnapshot = m_snapshot.exchange(new SettingsSnapshot(m_settings, settingsVersion)))
+            {
+                m_retiredSnapshots.push_back(previousSnapshot);
+            }
+        }
+        ReclaimRetiredSnapshots();
+    }
+
+    void SettingsRegistryImpl::ReclaimRetiredSnapshots() const
+    {
+        if (m_retiredSnapshots.empty())
+        {
+            return;
+        }
+
+        // Each snapshot read raises the count from before it loads the snapshot until it is done with it. A count observed at 0
+        // after a snapshot was retired means every read on that stripe that could have loaded the snapshot finished.
+        for (const SnapshotReaderCount& readerCount : m_snapshotReaderCounts)
+        {
+            if (readerCount.m_count.load() != 0)
+            {
+                return;
+            }
+        }
+
+        for (SettingsSnapshot* snapshot : m_retiredSnapshots)
+        {
+            delete snapshot;
+        }
+        m_retiredSnapshots.clear();
+    }
+
     template<typename T>
     bool SettingsRegistryImpl::SetValueInternal(AZStd::string_view path, T value)
     {
@@ -90,6 +299,7 @@ namespace AZ
         rapidjson::Pointer pointer(path.data(), path.length());
         if (pointer.IsValid())
         {
+            InvalidateSnapshot();
             if constexpr (AZStd::is_same_v<T, bool> || AZStd::is_same_v<T, double>)
             {
                 pointer.Set(m_settings, value);
@@ -122,19 +332,8 @@ namespace AZ
     template<typename T>
     bool SettingsRegistryImpl::GetValueInternal(T& result, AZStd::string_view path) const
     {
-        if (path.empty())
+        auto readValue = [&result](const rapidjson::Value* value)
         {
-            // rapidjson::Pointer asserts that the supplied string
-            // is not nullptr even if the supplied size is 0
-            // Setting to empty string to prevent assert
-            path = "";
-        }
-        rapidjson::Pointer pointer(path.data(), path.length());
-        if (pointer.IsValid())
-        {
-            AZStd::scoped_lock lock(LockForReading());
-
-            const rapidjson::Value* value = pointer.Get(m_settings);
             if constexpr (AZStd::is_same_v<T, bool>)
             {
                 if (value && value->IsBool())
@@ -179,6 +378,28 @@ namespace AZ
             {
                 static_assert(!AZStd::is_same_v<T,T>, "SettingsRegistryImpl::GetValueInternal called with unsupported type.");
             }
+            return false;
+        };
+
+        bool valueRead = false;
+        if (ReadFromSnapshot(path, [&readValue, &valueRead](const rapidjson::Value* value) { valueRead = readValue(value); }))
+        {
+            return valueRead;
+        }
+
+        if (path.empty())
+        {
+            // rapidjson::Pointer asserts that the supplied string
+            // is not nullptr even if the supplied size is 0
+            // Setting to empty string to prevent assert
+            path = "";
+        }
+        rapidjson::Pointer pointer(path.data(), path.length());
+        if (pointer.IsValid())
+        {
+            AZStd::scoped_lock lock(LockForReading());
+            OnLockedRead();
+            return readValue(pointer.Get(m_settings));
         }
         return false;
     }
@@ -196,7 +417,15 @@ namespace AZ
         m_useFileIo = useFileIo;
     }
 
-    SettingsRegistryImpl::~SettingsRegistryImpl() = default;
+    SettingsRegistryImpl::~SettingsRegistryImpl()
+    {
+        // No read can be in flight while the registry is destroyed
+        delete m_snapshot.exchange(nullptr);
+        for (SettingsSnapshot* snapshot : m_retiredSnapshots)
+        {
+            delete snapshot;
+        }
+    }
 
     void SettingsRegistryImpl::SetContext(SerializeContext* context)
     {
@@ -402,10 +631,17 @@ namespace AZ
             path = "";
         }
 
+        if (SettingsType type; ReadFromSnapshot(path,
+            [&type](const rapidjson::Value* value) { type = SettingsRegistryImplInternal::GetSettingsType(value); }))
+        {
+            return type;
+        }
+
         rapidjson::Pointer pointer(path.data(), path.length());
         if (pointer.IsValid())
         {
             AZStd::scoped_lock lock(LockForReading());
+            OnLockedRead();
             return GetTypeNoLock(path);
         }
         return SettingsType{};
@@ -423,20 +659,7 @@ namespace AZ
         rapidjson::Pointer pointer(path.data(), path.length());
         if (pointer.IsValid())
         {
-            if (const rapidjson::Value* value = pointer.Get(m_settings); value != nullptr)
-            {
-                SettingsType type;
-                type.m_type = SettingsRegistryImplInternal::RapidjsonToSettingsRegistryType(*value);
-                if (value->IsInt64())
-                {
-                    type.m_signedness = Signedness::Signed;
-                }
-                else if (value->IsUint64())
-                {
-                    type.m_signedness = Signedness::Unsigned;
-                }
-                return type;
-            }
+            return SettingsRegistryImplInternal::GetSettingsType(pointer.Get(m_settings));
         }
         return { Type::NoType, Signedness::None };
     }
@@ -572,6 +795,7 @@ namespace AZ
                 SettingsType anchorType;
                 {
                     AZStd::scoped_lock lock(LockForWriting());
+                    InvalidateSnapshot();
                     rapidjson::Value& setting = pointer.Create(m_settings, m_settings.GetAllocator());
                     setting = AZStd::move(store);
                     anchorType = GetTypeNoLock(path);
@@ -601,6 +825,7 @@ namespace AZ
         bool removeSuccess;
         {
             AZStd::scoped_lock lock(LockForWriting());
+            InvalidateSnapshot();
             removeSuccess = pointerPath.Erase(m_settings);
         }
 
@@ -843,6 +1068,7 @@ namespace AZ
                 folderPath /= pathSegmentToAppend;
             }
 
+            SettingsRegistryMergeCache::RecordFolderInput(folderPath.Native());
             auto findFilesCallback = CreateSettingsFindCallback(findFilesPayload.m_isPlatformFile);
             if (AZ::IO::FileIOBase* fileIo = m_useFileIo ? AZ::IO::FileIOBase::GetInstance() : nullptr; fileIo != nullptr)
             {
@@ -1199,6 +1425,8 @@ namespace AZ
     auto SettingsRegistryImpl::MergeSettingsFileInternal(const char* path, Format format, AZStd::string_view rootKey)
         -> MergeSettingsResult
     {
+        const AZ::Debug::StartupTimeline::Scope startupScope("SettingsRegistry", path);
+
         AZStd::string jsonData;
         if (MergeSettingsResult loadFileResult = LoadJsonFileIntoString(jsonData, path);
             !loadFileResult)
@@ -1227,6 +1455,7 @@ namespace AZ
         }
         if (!fileReader.IsOpen())
         {
+            SettingsRegistryMergeCache::RecordFileInput(filePath, nullptr);
             MergeSettingsResult result;
             result.Combine(MergeSettingsReturnCode::Failure);
             result.m_operationMessages = AZStd::string::format(R"(Unable to open registry file "%s".)", filePath);
@@ -1236,6 +1465,7 @@ namespace AZ
         AZ::u64 fileSize = fileReader.Length();
         if (fileSize == 0)
         {
+            SettingsRegistryMergeCache::RecordFileInput(filePath, &jsonData);
             MergeSettingsResult result;
             result.Combine(MergeSettingsReturnCode::Failure);
             result.m_operationMessages = AZStd::string::format(R"(Registry file "%s" is 0 bytes in length. There is no nothing to merge)", filePath);
@@ -1249,6 +1479,7 @@ namespace AZ
             return fileReader.Read(size, buffer) == size ? size : 0;
         };
         jsonData.resize_and_overwrite(fileSize, ReadJsonIntoString);
+        SettingsRegistryMergeCache::RecordFileInput(filePath, &jsonData);
 
         // If the string is empty then the file could not be read
         if (jsonData.empty())
@@ -1429,6 +1660,7 @@ namespace AZ
         SettingsType anchorType;
         {
             AZStd::scoped_lock lock(LockForWriting());
+            InvalidateSnapshot();
 
             rapidjson::Value& anchorRoot = anchorPath.IsValid() ? anchorPath.Create(m_settings, m_settings.GetAllocator())
                 : m_settings;
@@ -1474,7 +1706,21 @@ namespace AZ
         m_useFileIo = useFileIo;
     }
 
-    AZStd::scoped_lock<AZStd::recursive_mutex> SettingsRegistryImpl::LockForWriting() const
+    void SettingsRegistryImpl::SetUseSnapshotReads(bool useSnapshotReads)
+    {
+        AZStd::scoped_lock lock(LockForReading());
+        m_useSnapshotReads = useSnapshotReads;
+        if (!useSnapshotReads)
+        {
+            if (SettingsSnapshot* previousSnapshot = m_snapshot.exchange(nullptr))
+            {
+                m_retiredSnapshots.push_back(previousSnapshot);
+            }
+            ReclaimRetiredSnapshots();
+        }
+    }
+
+    AZStd::scoped_lock<AZ::Debug::ProfiledMutex<AZStd::recursive_mutex>> SettingsRegistryImpl::LockForWriting() const
     {
         // ensure that we aren't actively iterating over this data that is about to be
         // invalid.
@@ -1483,7 +1729,7 @@ namespace AZ
         return AZStd::scoped_lock(m_settingMutex);
     }
 
-    AZStd::scoped_lock<AZStd::recursive_mutex> SettingsRegistryImpl::LockForReading() const
+    AZStd::scoped_lock<AZ::Debug::ProfiledMutex<AZStd::recursive_mutex>> SettingsRegistryImpl::LockForReading() const
     {
         return AZStd::scoped_lock(m_settingMutex);
     }
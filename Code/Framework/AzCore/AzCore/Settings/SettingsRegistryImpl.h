@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/Debug/LockContentionProfiler.h>
 #include <AzCore/JSON/document.h>
 #include <AzCore/JSON/pointer.h>
 #include <AzCore/IO/Path/Path.h>
@@ -16,6 +17,7 @@
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 
@@ -88,6 +90,12 @@ namespace AZ
 
         void SetUseFileIO(bool useFileIo) override;
 
+        //! When enabled, Get and GetType read from an immutable snapshot of the settings without locking,
+        //! so threads reading the registry at the same time don't serialize on the settings mutex.
+        //! The snapshot is rebuilt once the settings stopped changing for a few reads, until then reads
+        //! go through the settings mutex as usual. This costs the memory of a second copy of the settings.
+        void SetUseSnapshotReads(bool useSnapshotReads);
+
     private:
         using TagList = AZStd::fixed_vector<size_t, Specializations::MaxCount + 1>;
         struct RegistryFile
@@ -127,14 +135,31 @@ namespace AZ
 
         //! Locks the m_settingMutex but also checks to make sure that someone is not currently
         //! visiting/iterating over the registry, which is invalid if you're about to modify it
-        AZStd::scoped_lock<AZStd::recursive_mutex> LockForWriting() const;
+        AZStd::scoped_lock<AZ::Debug::ProfiledMutex<AZStd::recursive_mutex>> LockForWriting() const;
 
         //! For symmetry with the above, locks with intent to only read data.  This can be done
         //! even during iteration/visiting.
-        AZStd::scoped_lock<AZStd::recursive_mutex> LockForReading() const;
+        AZStd::scoped_lock<AZ::Debug::ProfiledMutex<AZStd::recursive_mutex>> LockForReading() const;
+
+        //! Immutable copy of m_settings with an index from the JSON pointer of each value to the value.
+        struct SettingsSnapshot;
+
+        //! Looks up the path in the current snapshot without locking and calls @readValue with the value found, or nullptr.
+        //! Returns false without calling @readValue if snapshot reads are disabled or the snapshot is out of date.
+        template<typename ReadValue>
+        bool ReadFromSnapshot(AZStd::string_view path, ReadValue&& readValue) const;
+
+        //! The following functions must be called with m_settingMutex locked
+        //! Marks the snapshot as out of date, called before modifying m_settings
+        void InvalidateSnapshot();
+        //! Counts the reads that had to lock because the snapshot is out of date and rebuilds it after enough of them
+        void OnLockedRead() const;
+        void RebuildSnapshot() const;
+        //! Deletes the retired snapshots when no snapshot read is in flight
+        void ReclaimRetiredSnapshots() const;
 
         // only use the setting mutex via the above functions.
-        mutable AZStd::recursive_mutex m_settingMutex;
+        mutable AZ::Debug::ProfiledMutex<AZStd::recursive_mutex> m_settingMutex{ "SettingsRegistryImpl::m_settingMutex" };
         mutable AZStd::recursive_mutex m_notifierMutex;
         NotifyEvent m_notifiers;
         PreMergeEvent m_preMergeEvent;
@@ -180,5 +205,26 @@ namespace AZ
         // of the tree during visit.
         mutable int m_visitDepth = 0; // mutable due to it being a debugging value used in const.
 
+        //! Number of locked reads of the same settings version after which the snapshot is rebuilt
+        static constexpr AZ::u32 SnapshotRebuildReadCount = 16;
+
+        AZStd::atomic_bool m_useSnapshotReads{};
+        //! Incremented every time m_settings is modified, the snapshot is only used when its version matches
+        AZStd::atomic<AZ::u64> m_settingsVersion{};
+        mutable AZStd::atomic<SettingsSnapshot*> m_snapshot{};
+        //! The following are protected by m_settingMutex
+        //! Snapshots that reads on other threads may still be using
+        mutable AZStd::vector<SettingsSnapshot*> m_retiredSnapshots;
+        mutable AZ::u64 m_lockedReadsVersion{};
+        mutable AZ::u32 m_lockedReadCount{};
+
+        //! Number of snapshot reads in flight, spread over cache lines so reads on different threads don't contend
+        struct alignas(64) SnapshotReaderCount
+        {
+            AZStd::atomic<AZ::u32> m_count{ 0 };
+        };
+        static constexpr size_t SnapshotReaderCountStripes = 16;
+        mutable SnapshotReaderCount m_snapshotReaderCounts[SnapshotReaderCountStripes];
+
     };
 } // namespace AZ
@@ -0,0 +1,368 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Settings/SettingsRegistryMergeCache.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace SettingsRegistryMergeCacheInternal
+    {
+        constexpr AZ::u32 CacheFileMagic = 0x434D5253; // "SRMC"
+        // Bump when the layout of the cache file or the way the cache key is computed changes
+        constexpr AZ::u32 CacheFileVersion = 2;
+
+        AZStd::mutex s_recorderMutex;
+        SettingsRegistryMergeCache* s_activeRecorder = nullptr;
+
+        AZ::u64 HashString(AZStd::string_view value)
+        {
+            return static_cast<AZ::u64>(AZStd::hash<AZStd::string_view>{}(value));
+        }
+
+        template<typename T>
+        void Write(AZStd::string& buffer, const T& value)
+        {
+            buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        void WriteString(AZStd::string& buffer, AZStd::string_view value)
+        {
+            Write(buffer, static_cast<AZ::u32>(value.size()));
+            buffer.append(value.data(), value.size());
+        }
+
+        struct Reader
+        {
+            template<typename T>
+            bool Read(T& value)
+            {
+                if (m_data.size() < sizeof(T))
+                {
+                    return false;
+                }
+                memcpy(&value, m_data.data(), sizeof(T));
+                m_data.remove_prefix(sizeof(T));
+                return true;
+            }
+
+            bool ReadString(AZStd::string_view& value, size_t length)
+            {
+                if (m_data.size() < length)
+                {
+                    return false;
+                }
+                value = m_data.substr(0, length);
+                m_data.remove_prefix(length);
+                return true;
+            }
+
+            AZStd::string_view m_data;
+        };
+    } // namespace SettingsRegistryMergeCacheInternal
+
+    SettingsRegistryMergeCache::SettingsRegistryMergeCache(
+        SettingsRegistryInterface& registry, const SettingsRegistryInterface::Specializations& specializations)
+        : m_registry(registry)
+    {
+        using namespace SettingsRegistryMergeCacheInternal;
+
+        if (!m_registry.Get(m_enabled, EnabledKey) || !m_enabled)
+        {
+            m_enabled = false;
+            return;
+        }
+
+        if (SettingsRegistryInterface::FixedValueString cacheFolder; m_registry.Get(cacheFolder, FolderKey) && !cacheFolder.empty())
+        {
+            m_cacheFilePath = cacheFolder;
+        }
+        else if (m_registry.Get(cacheFolder, SettingsRegistryMergeUtils::FilePathKey_ProjectUserPath) && !cacheFolder.empty())
+        {
+            m_cacheFilePath = AZ::IO::FixedMaxPath(cacheFolder) / "SettingsRegistryCache";
+        }
+        else
+        {
+            m_enabled = false;
+            return;
+        }
+        m_cacheFilePath /= CacheFileName;
+
+        // The merge result depends on everything in the registry before the merge (command line, runtime file paths, ...)
+        AZStd::string registryDump;
+        AZ::IO::ByteContainerStream registryStream(&registryDump);
+        SettingsRegistryMergeUtils::DumpSettingsRegistryToStream(m_registry, "", registryStream, {});
+
+        size_t cacheKey = HashString(registryDump);
+        AZStd::hash_combine(cacheKey, CacheFileVersion);
+        for (size_t index = 0; index < specializations.GetCount(); ++index)
+        {
+            AZStd::hash_combine(cacheKey, specializations.GetSpecialization(index));
+        }
+        m_cacheKey = static_cast<AZ::u64>(cacheKey);
+    }
+
+    SettingsRegistryMergeCache::~SettingsRegistryMergeCache()
+    {
+        using namespace SettingsRegistryMergeCacheInternal;
+
+        if (m_recording)
+        {
+            AZStd::scoped_lock lock(s_recorderMutex);
+            s_activeRecorder = nullptr;
+        }
+    }
+
+    bool SettingsRegistryMergeCache::IsEnabled() const
+    {
+        return m_enabled;
+    }
+
+    const AZ::IO::FixedMaxPath& SettingsRegistryMergeCache::GetCacheFilePath() const
+    {
+        return m_cacheFilePath;
+    }
+
+    bool SettingsRegistryMergeCache::ApplyCachedSettings()
+    {
+        using namespace SettingsRegistryMergeCacheInternal;
+
+        if (!m_enabled)
+        {
+            return false;
+        }
+
+        const AZ::IO::SystemFile::SizeType fileSize = AZ::IO::SystemFile::Length(m_cacheFilePath.c_str());
+        if (fileSize == 0)
+        {
+            return false;
+        }
+        AZStd::string fileData;
+        fileData.resize_no_construct(fileSize);
+        if (AZ::IO::SystemFile::Read(m_cacheFilePath.c_str(), fileData.data(), fileSize) != fileSize)
+        {
+            return false;
+        }
+
+        Reader reader{ fileData };
+        AZ::u32 magic{};
+        AZ::u32 version{};
+        AZ::u64 cacheKey{};
+        AZ::u32 inputCount{};
+        if (!reader.Read(magic) || magic != CacheFileMagic || !reader.Read(version) || version != CacheFileVersion ||
+            !reader.Read(cacheKey) || cacheKey != m_cacheKey || !reader.Read(inputCount))
+        {
+            return false;
+        }
+
+        for (AZ::u32 inputIndex = 0; inputIndex < inputCount; ++inputIndex)
+        {
+            AZ::u8 type{};
+            AZ::u32 pathLength{};
+            AZStd::string_view path;
+            Input input;
+            if (!reader.Read(type) || type > static_cast<AZ::u8>(InputType::Folder) || !reader.Read(input.m_hash) ||
+                !reader.Read(pathLength) || !reader.ReadString(path, pathLength))
+            {
+                return false;
+            }
+            input.m_type = static_cast<InputType>(type);
+            input.m_path = path;
+            if (!IsInputUpToDate(input))
+            {
+                return false;
+            }
+        }
+
+        AZ::u32 payloadLength{};
+        AZStd::string_view payload;
+        if (!reader.Read(payloadLength) || !reader.ReadString(payload, payloadLength))
+        {
+            return false;
+        }
+
+        // Replacing the root keeps anything that was removed during the recorded merge removed
+        AZStd::string patch = R"([{ "op": "replace", "path": "", "value": )";
+        patch += payload;
+        patch += "}]";
+        auto mergeResult = m_registry.MergeSettings(patch, SettingsRegistryInterface::Format::JsonPatch);
+        AZ_Warning("SettingsRegistryMergeCache", mergeResult, R"(Failed to merge the settings registry cache "%s". %s)",
+            m_cacheFilePath.c_str(), mergeResult.GetMessages().c_str());
+        return static_cast<bool>(mergeResult);
+    }
+
+    void SettingsRegistryMergeCache::StartRecording()
+    {
+        using namespace SettingsRegistryMergeCacheInternal;
+
+        if (!m_enabled)
+        {
+            return;
+        }
+
+        AZStd::scoped_lock lock(s_recorderMutex);
+        AZ_Assert(s_activeRecorder == nullptr, "Only one settings registry merge can be recorded at a time");
+        if (s_activeRecorder == nullptr)
+        {
+            s_activeRecorder = this;
+            m_recording = true;
+            m_inputsValid = true;
+            m_inputs.clear();
+        }
+    }
+
+    bool SettingsRegistryMergeCache::StopRecordingAndWriteCache()
+    {
+        using namespace SettingsRegistryMergeCacheInternal;
+
+        if (!m_recording)
+        {
+            return false;
+        }
+        {
+            AZStd::scoped_lock lock(s_recorderMutex);
+            s_activeRecorder = nullptr;
+            m_recording = false;
+        }
+        if (!m_inputsValid)
+        {
+            return false;
+        }
+
+        AZStd::string payload;
+        AZ::IO::ByteContainerStream payloadStream(&payload);
+        if (!SettingsRegistryMergeUtils::DumpSettingsRegistryToStream(m_registry, "", payloadStream, {}))
+        {
+            return false;
+        }
+
+        AZStd::string fileData;
+        Write(fileData, CacheFileMagic);
+        Write(fileData, CacheFileVersion);
+        Write(fileData, m_cacheKey);
+        Write(fileData, static_cast<AZ::u32>(m_inputs.size()));
+        for (const Input& input : m_inputs)
+        {
+            Write(fileData, static_cast<AZ::u8>(input.m_type));
+            Write(fileData, input.m_hash);
+            WriteString(fileData, input.m_path);
+        }
+        WriteString(fileData, payload);
+
+        // Write to a temporary file first so that a concurrent launch never reads a partially written cache
+        AZ::IO::FixedMaxPath tempFilePath = m_cacheFilePath;
+        tempFilePath.ReplaceExtension(".tmp");
+        {
+            AZ::IO::SystemFile tempFile;
+            if (!tempFile.Open(tempFilePath.c_str(),
+                    AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+            {
+                return false;
+            }
+            if (tempFile.Write(fileData.data(), fileData.size()) != fileData.size())
+            {
+                tempFile.Close();
+                AZ::IO::SystemFile::Delete(tempFilePath.c_str());
+                return false;
+            }
+        }
+        return AZ::IO::SystemFile::Rename(tempFilePath.c_str(), m_cacheFilePath.c_str(), true);
+    }
+
+    void SettingsRegistryMergeCache::RecordFileInput(AZStd::string_view filePath, const AZStd::string* contents)
+    {
+        using namespace SettingsRegistryMergeCacheInternal;
+
+        AZStd::scoped_lock lock(s_recorderMutex);
+        if (s_activeRecorder != nullptr)
+        {
+            s_activeRecorder->AddInput(
+                contents ? InputType::File : InputType::MissingFile, filePath, contents ? HashString(*contents) : 0);
+        }
+    }
+
+    void SettingsRegistryMergeCache::RecordFolderInput(AZStd::string_view folderPath)
+    {
+        using namespace SettingsRegistryMergeCacheInternal;
+
+        AZStd::scoped_lock lock(s_recorderMutex);
+        if (s_activeRecorder != nullptr)
+        {
+            s_activeRecorder->AddInput(InputType::Folder, folderPath, HashFolder(AZ::IO::FixedMaxPathString(folderPath).c_str()));
+        }
+    }
+
+    void SettingsRegistryMergeCache::AddInput(InputType type, AZStd::string_view path, AZ::u64 hash)
+    {
+        // Stdin and FileIO aliases can't be checked with the SystemFile on the next launch
+        if (path.empty() || path == "-" || path.front() == '@')
+        {
+            m_inputsValid = false;
+            return;
+        }
+        m_inputs.push_back(Input{ AZStd::string(path), hash, type });
+    }
+
+    AZ::u64 SettingsRegistryMergeCache::HashFolder(const char* folderPath)
+    {
+        using namespace SettingsRegistryMergeCacheInternal;
+
+        // Adding, removing or renaming a file changes which files are merged. The content of the merged files
+        // is tracked separately, as each of those files is recorded when it's read.
+        AZStd::vector<AZStd::string> fileNames;
+        AZ::IO::SystemFile::FindFiles((AZ::IO::FixedMaxPath(folderPath) / "*").c_str(),
+            [&fileNames](const char* fileName, bool isFile)
+            {
+                if (isFile)
+                {
+                    fileNames.emplace_back(fileName);
+                }
+                return true;
+            });
+        AZStd::sort(fileNames.begin(), fileNames.end());
+
+        size_t folderHash = HashString(folderPath);
+        for (const AZStd::string& fileName : fileNames)
+        {
+            AZStd::hash_combine(folderHash, HashString(fileName));
+        }
+        return static_cast<AZ::u64>(folderHash);
+    }
+
+    bool SettingsRegistryMergeCache::IsInputUpToDate(const Input& input)
+    {
+        using namespace SettingsRegistryMergeCacheInternal;
+
+        switch (input.m_type)
+        {
+        case InputType::File:
+        {
+            if (!AZ::IO::SystemFile::Exists(input.m_path.c_str()))
+            {
+                return false;
+            }
+            const AZ::IO::SystemFile::SizeType fileSize = AZ::IO::SystemFile::Length(input.m_path.c_str());
+            AZStd::string contents;
+            contents.resize_no_construct(fileSize);
+            return AZ::IO::SystemFile::Read(input.m_path.c_str(), contents.data(), fileSize) == fileSize &&
+                HashString(contents) == input.m_hash;
+        }
+        case InputType::MissingFile:
+            return !AZ::IO::SystemFile::Exists(input.m_path.c_str());
+        case InputType::Folder:
+            return HashFolder(input.m_path.c_str()) == input.m_hash;
+        }
+        return false;
+    }
+} // namespace AZ
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ
+{
+    //! Caches the result of merging the shared settings registry files, so that later launches can skip reading
+    //! and parsing every .setreg file when none of them changed.
+    //! While recording, every registry file read and every Registry folder scanned by any SettingsRegistryImpl is
+    //! stored alongside a hash of its content. The merged registry is written to the cache file together with those
+    //! inputs and with a key made from the registry state before the merge and the specializations.
+    //! Applying the cache re-hashes the recorded inputs and only merges the cached settings when the key and all the
+    //! inputs still match, otherwise it returns false and the caller merges the files as usual.
+    //! The cache is opt-in through the EnabledKey setting, as the settings merged from the cache are attributed to
+    //! the cache file instead of the individual .setreg files.
+    class SettingsRegistryMergeCache
+    {
+    public:
+        //! Set to true (e.g. with --regset on the command line) to use the merge cache
+        static constexpr AZStd::string_view EnabledKey = "/O3DE/Settings/SettingsRegistry/MergeCache/Enabled";
+        //! Folder to store the cache file in. Defaults to <ProjectUserPath>/SettingsRegistryCache
+        static constexpr AZStd::string_view FolderKey = "/O3DE/Settings/SettingsRegistry/MergeCache/Folder";
+        static constexpr AZStd::string_view CacheFileName = "merged.setregcache";
+
+        SettingsRegistryMergeCache(SettingsRegistryInterface& registry, const SettingsRegistryInterface::Specializations& specializations);
+        SettingsRegistryMergeCache(const SettingsRegistryMergeCache&) = delete;
+        SettingsRegistryMergeCache& operator=(const SettingsRegistryMergeCache&) = delete;
+        ~SettingsRegistryMergeCache();
+
+        //! Returns true if the cache is enabled and has a folder to store the cache file in
+        bool IsEnabled() const;
+        const AZ::IO::FixedMaxPath& GetCacheFilePath() const;
+
+        //! Merges the cached settings into the registry if the cache file is up to date.
+        //! @return True if the cached settings were merged, false if the settings files need to be merged.
+        bool ApplyCachedSettings();
+
+        //! Starts recording the settings files that are read until StopRecordingAndWriteCache is called.
+        //! Only one recording can be active at a time.
+        void StartRecording();
+        //! Stops the recording and stores the current content of the registry in the cache file.
+        //! @return True if the cache file was written. The cache isn't written if any of the inputs can't
+        //! be validated on the next launch, such as a file read from stdin or through a FileIO alias.
+        bool StopRecordingAndWriteCache();
+
+        //! Called by the SettingsRegistryImpl when a settings file is read.
+        //! @param contents The content of the file or nullptr if the file couldn't be opened.
+        static void RecordFileInput(AZStd::string_view filePath, const AZStd::string* contents);
+        //! Called by the SettingsRegistryImpl when a folder is scanned for settings files.
+        static void RecordFolderInput(AZStd::string_view folderPath);
+
+    private:
+        enum class InputType : AZ::u8
+        {
+            File,
+            MissingFile,
+            Folder
+        };
+
+        struct Input
+        {
+            AZStd::string m_path;
+            AZ::u64 m_hash{};
+            InputType m_type{};
+        };
+
+        static AZ::u64 HashFolder(const char* folderPath);
+        static bool IsInputUpToDate(const Input& input);
+        void AddInput(InputType type, AZStd::string_view path, AZ::u64 hash);
+
+        SettingsRegistryInterface& m_registry;
+        AZ::IO::FixedMaxPath m_cacheFilePath;
+        AZStd::vector<Input> m_inputs;
+        AZ::u64 m_cacheKey{};
+        bool m_enabled{};
+        bool m_recording{};
+        bool m_inputsValid{ true };
+    };
+} // namespace AZ
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/Statistics/LatencyHistogram.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ
+{
+    namespace Statistics
+    {
+        void LatencyHistogram::Reset()
+        {
+            AZStd::fill(m_counts.begin(), m_counts.end(), AZ::u64(0));
+            m_totalCount = 0;
+            m_minimum = 0;
+            m_maximum = 0;
+            m_sum = 0;
+        }
+
+        void LatencyHistogram::RecordValue(AZ::u64 value, AZ::u64 count)
+        {
+            if (count == 0)
+            {
+                return;
+            }
+
+            if (m_counts.empty())
+            {
+                m_counts.resize(BucketCount, 0);
+            }
+
+            const AZ::u64 clampedValue = AZStd::min(value, MaxTrackableValue);
+            m_counts[GetBucketIndex(clampedValue)] += count;
+            m_minimum = m_totalCount ? AZStd::min(m_minimum, clampedValue) : clampedValue;
+            m_maximum = AZStd::max(m_maximum, clampedValue);
+            m_totalCount += count;
+            m_sum += value * count;
+        }
+
+        void LatencyHistogram::Merge(const LatencyHistogram& other)
+        {
+            if (other.m_totalCount == 0)
+            {
+                return;
+            }
+
+            if (m_counts.empty())
+            {
+                m_counts.resize(BucketCount, 0);
+            }
+
+            for (size_t bucketIndex = 0; bucketIndex < BucketCount; ++bucketIndex)
+            {
+                m_counts[bucketIndex] += other.m_counts[bucketIndex];
+            }
+            m_minimum = m_totalCount ? AZStd::min(m_minimum, other.m_minimum) : other.m_minimum;
+            m_maximum = AZStd::max(m_maximum, other.m_maximum);
+            m_totalCount += other.m_totalCount;
+            m_sum += other.m_sum;
+        }
+
+        AZ::u64 LatencyHistogram::GetValueAtPercentile(double percentile) const
+        {
+            if (m_totalCount == 0)
+            {
+                return 0;
+            }
+
+            // Rank of the sample at the percentile, the lowest sample is rank 1
+            const double clampedPercentile = AZStd::clamp(percentile, 0.0, 100.0);
+            const AZ::u64 targetRank = AZStd::max<AZ::u64>(
+                1, static_cast<AZ::u64>(clampedPercentile / 100.0 * static_cast<double>(m_totalCount) + 0.5));
+
+            AZ::u64 rank = 0;
+            for (size_t bucketIndex = 0; bucketIndex < BucketCount; ++bucketIndex)
+            {
+                rank += m_counts[bucketIndex];
+                if (rank >= targetRank)
+                {
+                    // The bucket bounds can be wider than the recorded values, never report past them
+                    return AZStd::clamp(GetBucketHighestValue(bucketIndex), m_minimum, m_maximum);
+                }
+            }
+            return m_maximum;
+        }
+
+        size_t LatencyHistogram::GetBucketIndex(AZ::u64 value)
+        {
+            // The first SubBucketCount values each get their own bucket
+            if (value < SubBucketCount)
+            {
+                return static_cast<size_t>(value);
+            }
+
+            // Above that, SubBucketCount buckets per power of two
+            const AZ::u32 exponent = 63u - static_cast<AZ::u32>(az_clz_u64(value));
+            const AZ::u32 shift = exponent - SubBucketBits;
+            const AZ::u64 subBucket = (value >> shift) - SubBucketCount;
+            return static_cast<size_t>(SubBucketCount + shift * SubBucketCount + subBucket);
+        }
+
+        AZ::u64 LatencyHistogram::GetBucketLowestValue(size_t bucketIndex)
+        {
+            if (bucketIndex < SubBucketCount)
+            {
+                return bucketIndex;
+            }
+
+            const AZ::u64 shift = (bucketIndex - SubBucketCount) / SubBucketCount;
+            const AZ::u64 subBucket = (bucketIndex - SubBucketCount) % SubBucketCount;
+            return (SubBucketCount + subBucket) << shift;
+        }
+
+        AZ::u64 LatencyHistogram::GetBucketHighestValue(size_t bucketIndex)
+        {
+            if (bucketIndex < SubBucketCount)
+            {
+                return bucketIndex;
+            }
+
+            const AZ::u64 shift = (bucketIndex - SubBucketCount) / SubBucketCount;
+            return GetBucketLowestValue(bucketIndex) + (AZ::u64(1) << shift) - 1;
+        }
+    } // namespace Statistics
+} // namespace AZ
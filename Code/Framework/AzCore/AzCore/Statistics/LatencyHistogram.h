@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace Statistics
+    {
+        /**
+         * @brief Histogram of integer values (usually microseconds) with a fixed relative precision
+         *
+         * Uses the bucket layout of HDR histograms: every power of two range is split into 2^SubBucketBits
+         * linear sub buckets, so any recorded value, and every percentile, is known within 1/2^SubBucketBits
+         * of its real value no matter how large it is. Unlike RunningStatistic it can answer percentile queries,
+         * which is what tail latency budgets are expressed in.
+         *
+         * Histograms with the same layout can be merged exactly. Record from a single thread into each
+         * histogram and Merge() them to aggregate across threads, or across processes after exporting the
+         * bucket counts.
+         */
+        class LatencyHistogram
+        {
+        public:
+            //! 128 sub buckets per power of two, values are within 0.8% of the recorded value.
+            static constexpr AZ::u32 SubBucketBits = 7;
+            static constexpr AZ::u64 SubBucketCount = AZ::u64(1) << SubBucketBits;
+            //! Values above this are recorded as this value. 2^40 microseconds is about 12 days.
+            static constexpr AZ::u32 MaxValueBits = 40;
+            static constexpr AZ::u64 MaxTrackableValue = (AZ::u64(1) << MaxValueBits) - 1;
+            static constexpr size_t BucketCount = SubBucketCount + (MaxValueBits - SubBucketBits) * SubBucketCount;
+
+            void Reset();
+
+            void RecordValue(AZ::u64 value, AZ::u64 count = 1);
+
+            //! Adds the counts of @other to this histogram.
+            void Merge(const LatencyHistogram& other);
+
+            AZ::u64 GetTotalCount() const
+            {
+                return m_totalCount;
+            }
+
+            AZ::u64 GetMinimum() const
+            {
+                return m_totalCount ? m_minimum : 0;
+            }
+
+            AZ::u64 GetMaximum() const
+            {
+                return m_maximum;
+            }
+
+            //! Sum of the recorded values, using the values as passed to RecordValue().
+            AZ::u64 GetSum() const
+            {
+                return m_sum;
+            }
+
+            //! Returns the highest value that is equivalent to the value at @percentile (0 to 100), 0 when empty.
+            AZ::u64 GetValueAtPercentile(double percentile) const;
+
+            //! Calls @callback(lowestValue, highestValue, count) for each non empty bucket, in increasing value order.
+            template<typename Callback>
+            void EnumerateBuckets(Callback&& callback) const
+            {
+                for (size_t bucketIndex = 0; bucketIndex < m_counts.size(); ++bucketIndex)
+                {
+                    if (m_counts[bucketIndex] != 0)
+                    {
+                        callback(GetBucketLowestValue(bucketIndex), GetBucketHighestValue(bucketIndex), m_counts[bucketIndex]);
+                    }
+                }
+            }
+
+            static size_t GetBucketIndex(AZ::u64 value);
+            static AZ::u64 GetBucketLowestValue(size_t bucketIndex);
+            static AZ::u64 GetBucketHighestValue(size_t bucketIndex);
+
+        private:
+            // Allocated on the first recorded value, so unused metrics cost no memory
+            AZStd::vector<AZ::u64> m_counts;
+            AZ::u64 m_totalCount = 0;
+            AZ::u64 m_minimum = 0;
+            AZ::u64 m_maximum = 0;
+            AZ::u64 m_sum = 0;
+        };
+    } // namespace Statistics
+} // namespace AZ
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Task/TaskCoroutine.h>
+
+#if defined(AZ_TASK_COROUTINES_ENABLED)
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/IO/IStreamer.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+
+namespace AZ
+{
+    // Result of awaiting a StreamerReadAwaitable
+    struct StreamerReadResult
+    {
+        IO::IStreamerTypes::RequestStatus m_status = IO::IStreamerTypes::RequestStatus::Failed;
+        void* m_buffer = nullptr;
+        u64 m_bytesRead = 0;
+    };
+
+    // Queues an IStreamer request when awaited and resumes the awaiting coroutine on a worker of the executor once the
+    // request completes. The completion callback runs on the Streamer thread, so only the resume is scheduled from there
+    // to avoid running coroutine code on the Streamer thread.
+    //
+    //     AZ::IO::FileRequestPtr request = streamer->Read(path, buffer, bufferSize, readSize);
+    //     AZ::StreamerReadResult result = co_await AZ::StreamerReadAwaitable(*streamer, AZStd::move(request));
+    class StreamerReadAwaitable final
+    {
+    public:
+        StreamerReadAwaitable(IO::IStreamer& streamer, IO::FileRequestPtr request, TaskExecutor& executor = TaskExecutor::Instance())
+            : m_streamer{ streamer }
+            , m_request{ AZStd::move(request) }
+            , m_executor{ executor }
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            TaskExecutor* executor = &m_executor;
+            m_streamer.SetRequestCompleteCallback(
+                m_request,
+                [executor, handle](IO::FileRequestHandle)
+                {
+                    Internal::ResumeOnExecutor(*executor, handle);
+                });
+            m_streamer.QueueRequest(m_request);
+        }
+
+        StreamerReadResult await_resume()
+        {
+            StreamerReadResult result;
+            result.m_status = m_streamer.GetRequestStatus(m_request);
+            if (result.m_status == IO::IStreamerTypes::RequestStatus::Completed)
+            {
+                m_streamer.GetReadRequestResult(m_request, result.m_buffer, result.m_bytesRead);
+            }
+            return result;
+        }
+
+    private:
+        IO::IStreamer& m_streamer;
+        IO::FileRequestPtr m_request;
+        TaskExecutor& m_executor;
+    };
+
+    // Suspends the awaiting coroutine until the asset finished loading (successfully or not) and resumes it on a worker
+    // of the executor. The asset load must already be queued, for instance through AssetManager::GetAsset or
+    // Asset<T>::QueueLoad. Awaiting returns the asset so its status can be checked with IsReady/IsError.
+    //
+    //     auto asset = AZ::Data::AssetManager::Instance().GetAsset<MyAsset>(assetId, AZ::Data::AssetLoadBehavior::Default);
+    //     asset = co_await AZ::AssetLoadAwaitable<MyAsset>(asset);
+    template<typename AssetClass>
+    class AssetLoadAwaitable final : private Data::AssetBus::Handler
+    {
+    public:
+        explicit AssetLoadAwaitable(Data::Asset<AssetClass> asset, TaskExecutor& executor = TaskExecutor::Instance())
+            : m_asset{ AZStd::move(asset) }
+            , m_executor{ executor }
+        {
+        }
+
+        ~AssetLoadAwaitable() override
+        {
+            Data::AssetBus::Handler::BusDisconnect();
+        }
+
+        bool await_ready() const noexcept
+        {
+            return !m_asset.GetId().IsValid() || m_asset.IsReady() || m_asset.IsError();
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            m_handle = handle;
+            // The AssetBus connection policy dispatches OnAssetReady immediately if the asset finished loading between
+            // await_ready and now, so there is no window in which the completion can be missed.
+            Data::AssetBus::Handler::BusConnect(m_asset.GetId());
+        }
+
+        Data::Asset<AssetClass> await_resume()
+        {
+            return AZStd::move(m_asset);
+        }
+
+    private:
+        void OnAssetReady(Data::Asset<Data::AssetData> asset) override
+        {
+            Resume(asset);
+        }
+
+        void OnAssetError(Data::Asset<Data::AssetData> asset) override
+        {
+            Resume(asset);
+        }
+
+        void OnAssetCanceled([[maybe_unused]] Data::AssetId assetId) override
+        {
+            Resume({});
+        }
+
+        void Resume(Data::Asset<Data::AssetData> asset)
+        {
+            Data::AssetBus::Handler::BusDisconnect();
+            if (asset)
+            {
+                m_asset = asset;
+            }
+
+            // The awaitable lives in the coroutine frame, which may be destroyed as soon as the coroutine resumes.
+            // Copy what is needed and do not touch this object after scheduling the resume.
+            TaskExecutor& executor = m_executor;
+            std::coroutine_handle<> handle = AZStd::exchange(m_handle, {});
+            Internal::ResumeOnExecutor(executor, handle);
+        }
+
+        Data::Asset<AssetClass> m_asset;
+        TaskExecutor& m_executor;
+        std::coroutine_handle<> m_handle;
+    };
+} // namespace AZ
+
+#endif // defined(AZ_TASK_COROUTINES_ENABLED)
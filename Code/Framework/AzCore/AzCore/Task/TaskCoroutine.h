@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+// Coroutine support requires compiling with C++20 (see CMAKE_CXX_STANDARD). When unavailable this header is empty
+// and AZ_TASK_COROUTINES_ENABLED is not defined, so dependent code can be conditionally compiled.
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#define AZ_TASK_COROUTINES_ENABLED
+
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/utils.h>
+
+#include <coroutine>
+
+namespace AZ
+{
+    template<typename T>
+    class TaskCoroutine;
+
+    namespace Internal
+    {
+        // Resumes the supplied coroutine on a worker of the executor
+        inline void ResumeOnExecutor(TaskExecutor& executor, std::coroutine_handle<> handle)
+        {
+            static const TaskDescriptor resumeDescriptor{ "TaskCoroutine", "Coroutines" };
+
+            TaskGraph graph{ "TaskCoroutineResume" };
+            graph.AddTask(
+                resumeDescriptor,
+                [handle]
+                {
+                    handle.resume();
+                });
+            graph.Detach();
+            graph.SubmitOnExecutor(executor);
+        }
+
+        class TaskCoroutinePromiseBase
+        {
+        public:
+            struct FinalAwaiter
+            {
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                template<typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+                {
+                    TaskCoroutinePromiseBase& promise = handle.promise();
+                    if (promise.m_continuation)
+                    {
+                        // Symmetric transfer back to the awaiting coroutine, no executor round trip needed
+                        return promise.m_continuation;
+                    }
+                    if (promise.m_detached)
+                    {
+                        handle.destroy();
+                    }
+                    return std::noop_coroutine();
+                }
+
+                void await_resume() const noexcept
+                {
+                }
+            };
+
+            std::suspend_always initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            FinalAwaiter final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            void unhandled_exception() const noexcept
+            {
+                AZ_Assert(false, "Unhandled exception escaped a TaskCoroutine");
+            }
+
+        protected:
+            template<typename T>
+            friend class ::AZ::TaskCoroutine;
+
+            std::coroutine_handle<> m_continuation;
+            bool m_detached = false;
+        };
+
+        template<typename T>
+        class TaskCoroutinePromise final : public TaskCoroutinePromiseBase
+        {
+        public:
+            TaskCoroutine<T> get_return_object() noexcept;
+
+            template<typename U>
+            void return_value(U&& value)
+            {
+                m_value.emplace(AZStd::forward<U>(value));
+            }
+
+            T TakeValue()
+            {
+                AZ_Assert(m_value.has_value(), "TaskCoroutine finished without producing a value");
+                return AZStd::move(*m_value);
+            }
+
+        private:
+            AZStd::optional<T> m_value;
+        };
+
+        template<>
+        class TaskCoroutinePromise<void> final : public TaskCoroutinePromiseBase
+        {
+        public:
+            TaskCoroutine<void> get_return_object() noexcept;
+
+            void return_void() const noexcept
+            {
+            }
+
+            void TakeValue() const noexcept
+            {
+            }
+        };
+    } // namespace Internal
+
+    // A lazily started coroutine. Awaiting it from another coroutine starts it on the awaiting thread and resumes the
+    // awaiting coroutine when it finishes. Top level coroutines are started on an executor with Launch.
+    //
+    // Within a TaskCoroutine, `co_await ResumeOn(executor)` moves execution onto a worker thread of the executor, and
+    // the awaitables in TaskAwaitables.h suspend until IStreamer requests or asset loads complete without blocking.
+    template<typename T = void>
+    class [[nodiscard]] TaskCoroutine final
+    {
+    public:
+        using promise_type = Internal::TaskCoroutinePromise<T>;
+        using handle_type = std::coroutine_handle<promise_type>;
+
+        TaskCoroutine() = default;
+
+        explicit TaskCoroutine(handle_type handle) noexcept
+            : m_handle{ handle }
+        {
+        }
+
+        TaskCoroutine(TaskCoroutine&& other) noexcept
+            : m_handle{ AZStd::exchange(other.m_handle, {}) }
+        {
+        }
+
+        TaskCoroutine& operator=(TaskCoroutine&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Reset();
+                m_handle = AZStd::exchange(other.m_handle, {});
+            }
+            return *this;
+        }
+
+        TaskCoroutine(const TaskCoroutine&) = delete;
+        TaskCoroutine& operator=(const TaskCoroutine&) = delete;
+
+        ~TaskCoroutine()
+        {
+            Reset();
+        }
+
+        bool IsValid() const
+        {
+            return static_cast<bool>(m_handle);
+        }
+
+        bool IsDone() const
+        {
+            return m_handle && m_handle.done();
+        }
+
+        // Start the coroutine on a worker of the executor. Ownership of the coroutine frame is transferred to the
+        // coroutine itself, which destroys its frame once it finishes. Any value returned by the coroutine is dropped.
+        void Launch(TaskExecutor& executor = TaskExecutor::Instance()) &&
+        {
+            AZ_Assert(m_handle, "Launching an empty TaskCoroutine");
+            handle_type handle = AZStd::exchange(m_handle, {});
+            handle.promise().m_detached = true;
+            Internal::ResumeOnExecutor(executor, handle);
+        }
+
+        struct Awaiter
+        {
+            handle_type m_handle;
+
+            bool await_ready() const noexcept
+            {
+                return !m_handle || m_handle.done();
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+            {
+                m_handle.promise().m_continuation = awaiting;
+                return m_handle;
+            }
+
+            T await_resume()
+            {
+                return m_handle.promise().TakeValue();
+            }
+        };
+
+        Awaiter operator co_await() && noexcept
+        {
+            return Awaiter{ m_handle };
+        }
+
+    private:
+        void Reset()
+        {
+            if (m_handle)
+            {
+                m_handle.destroy();
+                m_handle = {};
+            }
+        }
+
+        handle_type m_handle;
+    };
+
+    namespace Internal
+    {
+        template<typename T>
+        TaskCoroutine<T> TaskCoroutinePromise<T>::get_return_object() noexcept
+        {
+            return TaskCoroutine<T>{ std::coroutine_handle<TaskCoroutinePromise<T>>::from_promise(*this) };
+        }
+
+        inline TaskCoroutine<void> TaskCoroutinePromise<void>::get_return_object() noexcept
+        {
+            return TaskCoroutine<void>{ std::coroutine_handle<TaskCoroutinePromise<void>>::from_promise(*this) };
+        }
+    } // namespace Internal
+
+    // Awaitable that continues the awaiting coroutine on a worker thread of the executor
+    class ResumeOn final
+    {
+    public:
+        explicit ResumeOn(TaskExecutor& executor = TaskExecutor::Instance())
+            : m_executor{ executor }
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            // Already running on this executor, no need to hop threads
+            return TaskExecutor::GetCurrentExecutor() == &m_executor;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle) const
+        {
+            Internal::ResumeOnExecutor(m_executor, handle);
+        }
+
+        void await_resume() const noexcept
+        {
+        }
+
+    private:
+        TaskExecutor& m_executor;
+    };
+} // namespace AZ
+
+#endif // defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
@@ -9,9 +9,10 @@
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
 
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
-#include <AzCore/std/parallel/exponential_backoff.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/parallel/semaphore.h>
@@ -64,6 +65,9 @@ namespace AZ
             bool isRetained = IsRetained();
             TaskGraph* parent = m_parent;
             TaskGraphEvent* waitEvent = m_waitEvent;
+            TaskGraph* continuation = m_continuation;
+            CompiledTaskGraph* enclosingGraph = m_enclosingGraph;
+            TaskExecutor* executor = m_executor;
             uint32_t remaining = --m_remaining;
 
             if (isRetained)
@@ -72,21 +76,12 @@ namespace AZ
                 {
                     // Allow the parent graph to be submitted again
                     parent->m_submitted = false;
-                    if (waitEvent)
-                    {
-                        eventTracker.WriteEventInfo(this, CTGEvent::Signalled, "CTG::Release parent=true");
-                        waitEvent->Signal();
-                    }
+                    Complete(eventTracker, executor, waitEvent, continuation, enclosingGraph);
                 }
             }
             else if (remaining == 0)
             {
-                if (waitEvent)
-                {
-
-                    eventTracker.WriteEventInfo(this, CTGEvent::Signalled, "CTG::Release parent=false");
-                    waitEvent->Signal();
-                }
+                Complete(eventTracker, executor, waitEvent, continuation, enclosingGraph);
 
                 eventTracker.WriteEventInfo(this, CTGEvent::Deallocated, "CTG::Release parent=false");
 
@@ -96,76 +91,239 @@ namespace AZ
             return remaining;
         }
 
-        struct QueueStatus
+        void CompiledTaskGraph::Complete(
+            CompiledTaskGraphTracker& eventTracker,
+            TaskExecutor* executor,
+            TaskGraphEvent* waitEvent,
+            TaskGraph* continuation,
+            CompiledTaskGraph* enclosingGraph)
         {
-            AZStd::atomic<uint16_t> head;
-            AZStd::atomic<uint16_t> tail;
-            AZStd::atomic<uint16_t> reserve;
+            // The continuation inherits the wait event, so it must be submitted before the event is signaled
+            // for this graph. The event can then only be signaled once the continuation completes as well.
+            if (continuation)
+            {
+                continuation->SubmitOnExecutor(*executor, waitEvent);
+            }
+
+            if (waitEvent)
+            {
+                eventTracker.WriteEventInfo(this, CTGEvent::Signalled, IsRetained() ? "CTG::Release parent=true" : "CTG::Release parent=false");
+                waitEvent->Signal();
+            }
+
+            if (enclosingGraph)
+            {
+                // Drop the reference that kept the enclosing graph from completing while this nested graph ran
+                bool isEnclosingRetained = enclosingGraph->IsRetained();
+                if (enclosingGraph->Release(eventTracker) == (isEnclosingRetained ? 1u : 0u))
+                {
+                    executor->ReleaseGraph();
+                }
+            }
+        }
+
+        // A bounded lock free multi-producer/multi-consumer ring. Each cell carries a sequence number which tells
+        // producers and consumers whether the cell is ready to be written or read for a given position.
+        class TaskQueueSegment final
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(TaskQueueSegment, SystemAllocator);
+
+            explicit TaskQueueSegment(uint32_t capacity)
+                : m_mask{ capacity - 1 }
+            {
+                AZ_Assert((capacity & m_mask) == 0, "Task queue segment capacity must be a power of two");
+                m_cells = reinterpret_cast<Cell*>(azmalloc(capacity * sizeof(Cell), alignof(Cell)));
+                for (uint32_t i = 0; i != capacity; ++i)
+                {
+                    new (m_cells + i) Cell{};
+                    m_cells[i].m_sequence.store(i, AZStd::memory_order_relaxed);
+                }
+            }
+
+            ~TaskQueueSegment()
+            {
+                for (uint32_t i = 0; i != Capacity(); ++i)
+                {
+                    m_cells[i].~Cell();
+                }
+                azfree(m_cells);
+            }
+
+            TaskQueueSegment(const TaskQueueSegment&) = delete;
+            TaskQueueSegment& operator=(const TaskQueueSegment&) = delete;
+
+            uint32_t Capacity() const
+            {
+                return m_mask + 1;
+            }
+
+            // Returns false if the segment is full
+            bool TryEnqueue(Task* task)
+            {
+                size_t position = m_enqueuePosition.load(AZStd::memory_order_relaxed);
+                Cell* cell;
+                while (true)
+                {
+                    cell = &m_cells[position & m_mask];
+                    const size_t sequence = cell->m_sequence.load(AZStd::memory_order_acquire);
+                    const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+                    if (difference == 0)
+                    {
+                        if (m_enqueuePosition.compare_exchange_weak(position, position + 1, AZStd::memory_order_relaxed))
+                        {
+                            break;
+                        }
+                    }
+                    else if (difference < 0)
+                    {
+                        return false;
+                    }
+                    else
+                    {
+                        position = m_enqueuePosition.load(AZStd::memory_order_relaxed);
+                    }
+                }
+
+                cell->m_task = task;
+                cell->m_sequence.store(position + 1, AZStd::memory_order_release);
+                return true;
+            }
+
+            // Returns nullptr if the segment is empty
+            Task* TryDequeue()
+            {
+                size_t position = m_dequeuePosition.load(AZStd::memory_order_relaxed);
+                Cell* cell;
+                while (true)
+                {
+                    cell = &m_cells[position & m_mask];
+                    const size_t sequence = cell->m_sequence.load(AZStd::memory_order_acquire);
+                    const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+                    if (difference == 0)
+                    {
+                        if (m_dequeuePosition.compare_exchange_weak(position, position + 1, AZStd::memory_order_relaxed))
+                        {
+                            break;
+                        }
+                    }
+                    else if (difference < 0)
+                    {
+                        return nullptr;
+                    }
+                    else
+                    {
+                        position = m_dequeuePosition.load(AZStd::memory_order_relaxed);
+                    }
+                }
+
+                Task* task = cell->m_task;
+                cell->m_sequence.store(position + m_mask + 1, AZStd::memory_order_release);
+                return task;
+            }
+
+            uint32_t Size() const
+            {
+                const size_t dequeuePosition = m_dequeuePosition.load(AZStd::memory_order_relaxed);
+                const size_t enqueuePosition = m_enqueuePosition.load(AZStd::memory_order_relaxed);
+                return enqueuePosition > dequeuePosition ? static_cast<uint32_t>(enqueuePosition - dequeuePosition) : 0;
+            }
+
+            AZStd::atomic<TaskQueueSegment*> m_next = nullptr;
+
+        private:
+            struct Cell
+            {
+                AZStd::atomic<size_t> m_sequence;
+                Task* m_task = nullptr;
+            };
+
+            Cell* m_cells;
+            const uint32_t m_mask;
+            // Keep producers and consumers on separate cache lines
+            alignas(64) AZStd::atomic<size_t> m_enqueuePosition = 0;
+            alignas(64) AZStd::atomic<size_t> m_dequeuePosition = 0;
         };
 
         // The Task Queue is a lock free 4-priority queue. Its basic operation is as follows:
-        // Each priority level is associated with a different queue, corresponding to the maximum size of a uint16_t.
-        // Each queue is implemented as a ring buffer, and a 64 bit atomic maintains the following state per queue:
-        // - offset to the "head" of the ring, from where we acquire elements
-        // - offset to the "tail" of the ring, which tracks where new elements should be enqueued
-        // - offset to a tail reservation index, which is used to reserve a slot to enqueue elements
+        // Each priority level is associated with a chain of ring buffer segments. The chain starts with a single
+        // small segment, and whenever every segment is full a new segment twice the size of the last one is
+        // appended with a single compare-exchange. Segments are never unlinked while the queue is alive, so no
+        // memory reclamation scheme is needed and the footprint only grows to the high water mark of the worker.
+        // Producers and consumers both walk the chain from the first segment, so tasks are dequeued in roughly,
+        // but not strictly, FIFO order within a priority level.
         class TaskQueue final
         {
         public:
-            // Preallocating upfront allows us to reserve slots to insert tasks without locks.
-            // Each thread allocated by the task manager consumes ~2 MB.
-            constexpr static uint16_t MaxQueueSize = 0xffff;
+            constexpr static uint32_t InitialSegmentCapacity = 256;
             constexpr static uint8_t PriorityLevelCount = static_cast<uint8_t>(TaskPriority::PRIORITY_COUNT);
 
-            TaskQueue() = default;
+            TaskQueue();
+            ~TaskQueue();
             TaskQueue(const TaskQueue&) = delete;
             TaskQueue& operator=(const TaskQueue&) = delete;
 
             void Enqueue(Task* task);
+
+            // Safe to call from any thread, which allows idle workers to steal from their peers
             Task* TryDequeue();
 
+            // Approximate number of tasks waiting across all priority levels
+            uint32_t Size() const;
+
         private:
-            QueueStatus m_status[PriorityLevelCount] = {};
-            Task* m_queues[PriorityLevelCount][MaxQueueSize] = {};
+            TaskQueueSegment* m_segments[PriorityLevelCount];
         };
 
+        TaskQueue::TaskQueue()
+        {
+            for (size_t priority = 0; priority != PriorityLevelCount; ++priority)
+            {
+                m_segments[priority] = aznew TaskQueueSegment(InitialSegmentCapacity);
+            }
+        }
+
+        TaskQueue::~TaskQueue()
+        {
+            for (size_t priority = 0; priority != PriorityLevelCount; ++priority)
+            {
+                TaskQueueSegment* segment = m_segments[priority];
+                while (segment)
+                {
+                    TaskQueueSegment* next = segment->m_next.load();
+                    delete segment;
+                    segment = next;
+                }
+            }
+        }
+
         void TaskQueue::Enqueue(Task* task)
         {
             uint8_t priority = task->GetPriorityNumber();
-            QueueStatus& status = m_status[priority];
+            TaskQueueSegment* segment = m_segments[priority];
 
-            AZStd::exponential_backoff backoff;
             while (true)
             {
-                uint16_t reserve = status.reserve.load();
-                uint16_t head = status.head.load();
+                if (segment->TryEnqueue(task))
+                {
+                    return;
+                }
 
-                // Enqueuing is done in two phases because we cannot atomically write the task to the slot we reserve
-                // and simulataneously publish the fact that the slot is now available.
-                if (reserve != head - 1)
+                TaskQueueSegment* next = segment->m_next.load(AZStd::memory_order_acquire);
+                if (!next)
                 {
-                    // Try to reserve a slot
-                    if (status.reserve.compare_exchange_weak(reserve, reserve + 1))
+                    // Every segment is full, grow the chain. If another producer beat us to it, use theirs.
+                    TaskQueueSegment* grown = aznew TaskQueueSegment(segment->Capacity() * 2);
+                    if (segment->m_next.compare_exchange_strong(next, grown, AZStd::memory_order_acq_rel))
                     {
-                        m_queues[priority][reserve] = task;
-
-                        uint16_t expectedReserve = reserve;
-
-                        // Increment the tail to advertise the new task
-                        while (!status.tail.compare_exchange_weak(expectedReserve, reserve + 1))
-                        {
-                            expectedReserve = reserve;
-                        }
-
-                        return;
+                        next = grown;
+                    }
+                    else
+                    {
+                        delete grown;
                     }
-
-                    // We failed to reserve a slot, try again
-                }
-                else
-                {
-                    backoff.wait();
                 }
+                segment = next;
             }
         }
 
@@ -173,23 +331,12 @@ namespace AZ
         {
             for (size_t priority = 0; priority != PriorityLevelCount; ++priority)
             {
-                QueueStatus& status = m_status[priority];
-                while (true)
+                for (TaskQueueSegment* segment = m_segments[priority]; segment;
+                     segment = segment->m_next.load(AZStd::memory_order_acquire))
                 {
-                    uint16_t head = status.head.load();
-                    uint16_t tail = status.tail.load();
-                    if (head == tail)
-                    {
-                        // Queue empty
-                        break;
-                    }
-                    else
+                    if (Task* task = segment->TryDequeue(); task)
                     {
-                        Task* task = m_queues[priority][status.head];
-                        if (status.head.compare_exchange_weak(head, head + 1))
-                        {
-                            return task;
-                        }
+                        return task;
                     }
                 }
             }
@@ -197,6 +344,20 @@ namespace AZ
             return nullptr;
         }
 
+        uint32_t TaskQueue::Size() const
+        {
+            uint32_t size = 0;
+            for (size_t priority = 0; priority != PriorityLevelCount; ++priority)
+            {
+                for (const TaskQueueSegment* segment = m_segments[priority]; segment;
+                     segment = segment->m_next.load(AZStd::memory_order_relaxed))
+                {
+                    size += segment->Size();
+                }
+            }
+            return size;
+        }
+
         class TaskWorker
         {
         public:
@@ -254,24 +415,83 @@ namespace AZ
                 m_semaphore.release();
             }
 
+            // Invoked by peers that ran out of work
+            Task* TrySteal()
+            {
+                return m_queue.TryDequeue();
+            }
+
+            bool IsSleeping() const
+            {
+                return m_sleeping.load(AZStd::memory_order_acquire);
+            }
+
+            void Wake()
+            {
+                m_semaphore.release();
+            }
+
+            TaskWorkerStatistics GetStatistics() const
+            {
+                TaskWorkerStatistics statistics;
+                statistics.m_tasksExecuted = m_tasksExecuted.load(AZStd::memory_order_relaxed);
+                statistics.m_tasksStolen = m_tasksStolen.load(AZStd::memory_order_relaxed);
+                statistics.m_idleTimeUs = m_idleTimeUs.load(AZStd::memory_order_relaxed);
+                statistics.m_queueDepth = m_queue.Size();
+                return statistics;
+            }
+
             const char* GetThreadName() {return m_threadName.c_str();}
 
+            CompiledTaskGraph* GetCurrentGraph() const
+            {
+                return m_currentTask ? m_currentTask->m_graph : nullptr;
+            }
+
         private:
+            Task* NextTask()
+            {
+                Task* task = m_queue.TryDequeue();
+                if (!task)
+                {
+                    task = m_executor->TrySteal(*this);
+                    if (task)
+                    {
+                        m_tasksStolen.fetch_add(1, AZStd::memory_order_relaxed);
+                    }
+                }
+                return task;
+            }
+
             void Run()
             {
                 while (m_active)
                 {
+                    m_sleeping.store(true, AZStd::memory_order_release);
+                    ++m_executor->m_idleWorkerCount;
+                    const auto idleStart = AZStd::chrono::steady_clock::now();
+
                     m_semaphore.acquire();
 
+                    m_idleTimeUs.fetch_add(
+                        AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - idleStart).count(),
+                        AZStd::memory_order_relaxed);
+                    --m_executor->m_idleWorkerCount;
+                    m_sleeping.store(false, AZStd::memory_order_release);
+
                     if (!m_active)
                     {
                         return;
                     }
 
-                    Task* task = m_queue.TryDequeue();
+                    Task* task = NextTask();
                     while (task)
                     {
+                        m_currentTask = task;
                         task->Invoke();
+                        m_currentTask = nullptr;
+                        m_tasksExecuted.fetch_add(1, AZStd::memory_order_relaxed);
+
                         // Decrement counts for all task successors
                         for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
                         {
@@ -288,7 +508,7 @@ namespace AZ
                             m_executor->ReleaseGraph();
                         }
 
-                        task = m_queue.TryDequeue();
+                        task = NextTask();
                     }
                 }
             }
@@ -296,9 +516,15 @@ namespace AZ
             AZStd::thread m_thread;
             AZStd::atomic<bool> m_active;
             AZStd::atomic<bool> m_enabled = true;
+            AZStd::atomic<bool> m_sleeping = false;
             AZStd::binary_semaphore m_semaphore;
 
+            AZStd::atomic<AZ::u64> m_tasksExecuted = 0;
+            AZStd::atomic<AZ::u64> m_tasksStolen = 0;
+            AZStd::atomic<AZ::u64> m_idleTimeUs = 0;
+
             ::AZ::TaskExecutor* m_executor;
+            Task* m_currentTask = nullptr;
             TaskQueue m_queue;
             AZStd::string m_threadName;
             friend class ::AZ::TaskExecutor;
@@ -412,6 +638,17 @@ namespace AZ
         return nullptr;
     }
 
+    TaskExecutor* TaskExecutor::GetCurrentExecutor()
+    {
+        return Internal::TaskWorker::t_worker ? Internal::TaskWorker::t_worker->m_executor : nullptr;
+    }
+
+    Internal::CompiledTaskGraph* TaskExecutor::GetCurrentGraph()
+    {
+        Internal::TaskWorker* worker = GetTaskWorker();
+        return worker ? worker->GetCurrentGraph() : nullptr;
+    }
+
     void TaskExecutor::Submit(Internal::CompiledTaskGraph& graph, TaskGraphEvent* event)
     {
 
@@ -428,6 +665,11 @@ namespace AZ
         auto& compiledTasks = graph.Tasks();
         if (compiledTasks.empty())
         {
+            if (graph.m_continuation)
+            {
+                graph.m_continuation->SubmitOnExecutor(*this, event);
+            }
+
             if (event != nullptr)
             {
                 event->Signal();
@@ -463,6 +705,60 @@ namespace AZ
         }
 
         m_workers[nextWorker].Enqueue(&task);
+
+        // If other workers are sleeping, nudge one of them awake so it can steal from the worker
+        // that just received the task in case that worker is still busy with earlier submissions.
+        if (m_idleWorkerCount.load(AZStd::memory_order_relaxed) > 0)
+        {
+            WakeIdleWorker(nextWorker);
+        }
+    }
+
+    Internal::Task* TaskExecutor::TrySteal(Internal::TaskWorker& thief)
+    {
+        const uint32_t thiefIndex = static_cast<uint32_t>(&thief - m_workers);
+
+        // Visit peers starting with the one after the thief so that multiple idle workers spread out across victims
+        for (uint32_t offset = 1; offset < m_threadCount; ++offset)
+        {
+            Internal::TaskWorker& victim = m_workers[(thiefIndex + offset) % m_threadCount];
+            if (Internal::Task* task = victim.TrySteal(); task)
+            {
+                return task;
+            }
+        }
+        return nullptr;
+    }
+
+    void TaskExecutor::WakeIdleWorker(uint32_t excludedWorker)
+    {
+        for (uint32_t offset = 1; offset < m_threadCount; ++offset)
+        {
+            Internal::TaskWorker& worker = m_workers[(excludedWorker + offset) % m_threadCount];
+            if (worker.IsSleeping() && worker.Enabled())
+            {
+                worker.Wake();
+                return;
+            }
+        }
+    }
+
+    TaskWorkerStatistics TaskExecutor::GetWorkerStatistics(uint32_t workerIndex) const
+    {
+        AZ_Assert(workerIndex < m_threadCount, "Task worker index %u is out of range (%u workers)", workerIndex, m_threadCount);
+        return m_workers[workerIndex].GetStatistics();
+    }
+
+    void TaskExecutor::RecordStatistics()
+    {
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            [[maybe_unused]] const TaskWorkerStatistics statistics = m_workers[i].GetStatistics();
+            AZ_PROFILE_DATAPOINT(AzCore, statistics.m_tasksExecuted, AZStd::wstring::format(L"TaskExecutor/Worker %u/Tasks executed", i).data());
+            AZ_PROFILE_DATAPOINT(AzCore, statistics.m_tasksStolen, AZStd::wstring::format(L"TaskExecutor/Worker %u/Tasks stolen", i).data());
+            AZ_PROFILE_DATAPOINT(AzCore, statistics.m_idleTimeUs, AZStd::wstring::format(L"TaskExecutor/Worker %u/Idle time (us)", i).data());
+            AZ_PROFILE_DATAPOINT(AzCore, statistics.m_queueDepth, AZStd::wstring::format(L"TaskExecutor/Worker %u/Queue depth", i).data());
+        }
     }
 
     void TaskExecutor::ReleaseGraph()
@@ -102,13 +102,27 @@ namespace AZ
 
         private:
             friend class ::AZ::TaskGraph;
+            friend class ::AZ::TaskExecutor;
             friend class TaskWorker;
 
+            // Invoked once all tasks of a submission have finished
+            void Complete(
+                CompiledTaskGraphTracker& eventTracker,
+                TaskExecutor* executor,
+                TaskGraphEvent* waitEvent,
+                TaskGraph* continuation,
+                CompiledTaskGraph* enclosingGraph);
+
             AZStd::vector<Task> m_tasks;
             AZStd::vector<Task*> m_successors;
             TaskGraphEvent* m_waitEvent = nullptr;
             // The pointer to the parent graph is set only if it is retained
             TaskGraph* m_parent = nullptr;
+            // Graph submitted on the same executor once this graph completes
+            TaskGraph* m_continuation = nullptr;
+            // Graph whose completion is held back until this nested graph completes
+            CompiledTaskGraph* m_enclosingGraph = nullptr;
+            TaskExecutor* m_executor = nullptr;
             AZStd::atomic<uint32_t> m_remaining;
             const char* m_parentLabel;
         };
@@ -116,6 +130,16 @@ namespace AZ
         class TaskWorker;
     } // namespace Internal
 
+    // Snapshot of the counters maintained by each task worker. Counters are cumulative since the executor
+    // was created, except for the queue depth which is sampled at the time of the query.
+    struct TaskWorkerStatistics
+    {
+        AZ::u64 m_tasksExecuted = 0;
+        AZ::u64 m_tasksStolen = 0;
+        AZ::u64 m_idleTimeUs = 0;
+        uint32_t m_queueDepth = 0;
+    };
+
     class TaskExecutor final
     {
     public:
@@ -136,20 +160,45 @@ namespace AZ
 
         void Submit(Internal::Task& task);
 
+        // Returns the executor owning the calling thread if it is a task worker, nullptr otherwise
+        static TaskExecutor* GetCurrentExecutor();
+
         Internal::CompiledTaskGraphTracker& GetEventTracker() {return m_eventTracker;}
 
+        uint32_t GetWorkerCount() const
+        {
+            return m_threadCount;
+        }
+
+        TaskWorkerStatistics GetWorkerStatistics(uint32_t workerIndex) const;
+
+        // Report the per worker statistics to the active profiler
+        void RecordStatistics();
+
     private:
         friend class Internal::TaskWorker;
+        friend class Internal::CompiledTaskGraph;
+        friend class TaskGraph;
         friend class TaskGraphEvent;
         friend class Internal::CompiledTaskGraphTracker;
 
         Internal::TaskWorker* GetTaskWorker();
+
+        // Graph owning the task currently executing on the calling worker thread
+        Internal::CompiledTaskGraph* GetCurrentGraph();
         void ReleaseGraph();
         void ReactivateTaskWorker();
 
+        // Attempts to take a task from the queue of any worker other than the supplied one
+        Internal::Task* TrySteal(Internal::TaskWorker& thief);
+
+        // Wakes up a sleeping worker (other than the one that just received work) so it can steal from its peers
+        void WakeIdleWorker(uint32_t excludedWorker);
+
         Internal::TaskWorker* m_workers;
         uint32_t m_threadCount = 0;
         AZStd::atomic<uint32_t> m_lastSubmission;
+        AZStd::atomic<uint32_t> m_idleWorkerCount = 0;
         AZStd::atomic<uint64_t> m_graphsRemaining;
 
         // Implement basic CompiledTaskGraph event breadcrumbs to help debug
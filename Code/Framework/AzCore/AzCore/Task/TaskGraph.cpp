@@ -112,6 +112,12 @@ namespace AZ
         // return immediately
         if (IsEmpty() && !m_compiledTaskGraph)
         {
+            if (m_continuation)
+            {
+                m_continuation->Submit(waitEvent);
+                return;
+            }
+
             if (waitEvent)
             {
                 Internal::CompiledTaskGraphTracker& eventTracker = TaskExecutor::Instance().GetEventTracker();
@@ -126,6 +132,26 @@ namespace AZ
     }
 
     void TaskGraph::SubmitOnExecutor(TaskExecutor& executor, TaskGraphEvent* waitEvent)
+    {
+        SubmitInternal(executor, waitEvent, nullptr);
+    }
+
+    void TaskGraph::SubmitNested(TaskGraphEvent* waitEvent)
+    {
+        TaskExecutor* executor = TaskExecutor::GetCurrentExecutor();
+        AZ_Assert(executor, "TaskGraph %s submitted as a nested graph outside of a task", m_label);
+        if (!executor)
+        {
+            Submit(waitEvent);
+            return;
+        }
+
+        Internal::CompiledTaskGraph* enclosingGraph = executor->GetCurrentGraph();
+        AZ_Assert(enclosingGraph, "TaskGraph %s submitted as a nested graph outside of a task", m_label);
+        SubmitInternal(*executor, waitEvent, enclosingGraph);
+    }
+
+    void TaskGraph::SubmitInternal(TaskExecutor& executor, TaskGraphEvent* waitEvent, Internal::CompiledTaskGraph* enclosingGraph)
     {
         Internal::CompiledTaskGraphTracker& eventTracker = executor.GetEventTracker();
         if (!m_compiledTaskGraph)
@@ -135,8 +161,18 @@ namespace AZ
         }
 
         m_compiledTaskGraph->m_waitEvent = waitEvent;
+        m_compiledTaskGraph->m_continuation = m_continuation;
+        m_compiledTaskGraph->m_executor = &executor;
         uint32_t taskCount = aznumeric_cast<uint32_t>(m_compiledTaskGraph->m_tasks.size());
         m_compiledTaskGraph->m_remaining = taskCount + (m_retained ? 1 : 0);
+
+        // An empty graph never releases itself, so it cannot hold back the enclosing graph either
+        m_compiledTaskGraph->m_enclosingGraph = taskCount != 0 ? enclosingGraph : nullptr;
+        if (m_compiledTaskGraph->m_enclosingGraph)
+        {
+            // Keep the enclosing graph from completing until this graph completes and releases it
+            ++m_compiledTaskGraph->m_enclosingGraph->m_remaining;
+        }
         for (uint32_t i = 0; i != taskCount; ++i)
         {
             m_compiledTaskGraph->m_tasks[i].Init();
@@ -155,10 +155,27 @@ namespace AZ
         // Same as submit but run on a different executor than the default system executor
         void SubmitOnExecutor(TaskExecutor& executor, TaskGraphEvent* waitEvent = nullptr);
 
+        // Submit this graph from inside a task of another graph, on the executor running that task. The enclosing
+        // graph is only considered complete (its wait event signaled and its continuation submitted) once this
+        // nested graph has completed as well, so no worker needs to block in TaskGraphEvent::Wait for child work.
+        // NOTE: Tasks in the enclosing graph that succeed the submitting task are NOT delayed by the nested graph.
+        // Express such dependencies with a continuation on the nested graph instead.
+        void SubmitNested(TaskGraphEvent* waitEvent = nullptr);
+
+        // Set a graph to submit on the same executor as soon as this graph completes. Any wait event supplied when
+        // submitting this graph is handed to the continuation, and is only signaled once the continuation (and any
+        // continuation it has itself) completes. Passing nullptr clears the continuation.
+        // NOTE: The continuation must remain alive until it is submitted, must not be in flight at that time, and
+        // is submitted after every submission of this graph while it remains set.
+        // NOTE: This operation is invalid if the graph is in-flight
+        void SetContinuation(TaskGraph* continuation);
+
     private:
         friend class TaskToken;
         friend class Internal::CompiledTaskGraph;
 
+        void SubmitInternal(TaskExecutor& executor, TaskGraphEvent* waitEvent, Internal::CompiledTaskGraph* enclosingGraph);
+
         Internal::CompiledTaskGraph* m_compiledTaskGraph = nullptr;
 
         AZStd::vector<Internal::Task> m_tasks;
@@ -166,6 +183,8 @@ namespace AZ
         // Task index |-> Dependent task indices
         AZStd::unordered_map<uint32_t, AZStd::vector<uint32_t>> m_links;
 
+        TaskGraph* m_continuation = nullptr;
+
         char const* m_label;
         uint32_t m_linkCount = 0;
         bool m_retained = true;
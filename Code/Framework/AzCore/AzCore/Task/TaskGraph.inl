@@ -63,4 +63,11 @@ namespace AZ
     {
         m_retained = false;
     }
+
+    inline void TaskGraph::SetContinuation(TaskGraph* continuation)
+    {
+        AZ_Assert(!m_submitted, "Cannot mutate a TaskGraph that was previously submitted or in flight.");
+        AZ_Assert(continuation != this, "A TaskGraph cannot be its own continuation.");
+        m_continuation = continuation;
+    }
 } // namespace AZ
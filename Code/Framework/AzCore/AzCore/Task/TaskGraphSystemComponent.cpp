@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/ProfilerBus.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Task/TaskGraphSystemComponent.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -57,11 +58,17 @@ namespace AZ
             Interface<TaskGraphActiveInterface>::Register(this); // small window that another thread can try to use taskgraph between this line and the set instance.
             m_taskExecutor = aznew TaskExecutor(numberOfWorkerThreads);
             TaskExecutor::SetInstance(m_taskExecutor);
+#if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
+            TickBus::Handler::BusConnect();
+#endif
         }
     }
 
     void TaskGraphSystemComponent::Deactivate()
     {
+#if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
+        TickBus::Handler::BusDisconnect();
+#endif
         if (&TaskExecutor::Instance() == m_taskExecutor) // check that our instance is the global instance (not always true in unit tests)
         {
             m_taskExecutor->SetInstance(nullptr);
@@ -77,6 +84,20 @@ namespace AZ
         }
     }
 
+    void TaskGraphSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        bool isEnabled = false;
+        if (auto profilerSystem = AZ::Debug::ProfilerSystemInterface::Get(); profilerSystem)
+        {
+            isEnabled = profilerSystem->IsActive();
+        }
+
+        if (isEnabled && m_taskExecutor)
+        {
+            m_taskExecutor->RecordStatistics();
+        }
+    }
+
     void TaskGraphSystemComponent::GetProvidedServices(ComponentDescriptor::DependencyArrayType& provided)
     {
         provided.push_back(TaskExecutorServiceCrc);
@@ -42,8 +42,11 @@ set(FILES
     Component/ComponentBus.cpp
     Component/ComponentBus.h
     Component/ComponentExport.h
+    Component/DenseComponentStorage.h
     Component/Entity.cpp
     Component/Entity.h
+    Component/EntityBatchActivator.cpp
+    Component/EntityBatchActivator.h
     Component/EntityBus.h
     Component/EntityId.h
     Component/EntityIdSerializer.cpp
@@ -57,6 +60,8 @@ set(FILES
     Component/NonUniformScaleBus.cpp
     Component/NonUniformScaleBus.h
     Component/TickBus.h
+    Component/TickBusDispatcher.cpp
+    Component/TickBusDispatcher.h
     Component/TransformBus.h
     Compression/compression.cpp
     Compression/Compression.h
@@ -82,15 +87,21 @@ set(FILES
     Debug/Budget.cpp
     Debug/BudgetTracker.h
     Debug/BudgetTracker.cpp
+    Debug/LockContentionProfiler.h
+    Debug/LockContentionProfiler.cpp
     Debug/MemoryProfiler.h
     Debug/PerformanceCollector.h
     Debug/PerformanceCollector.cpp
+    Debug/PerformanceMetricsExporter.h
+    Debug/PerformanceMetricsExporter.cpp
     Debug/Profiler.cpp
     Debug/Profiler.h
     Debug/ProfilerBus.h
     Debug/ProfilerReflection.cpp
     Debug/ProfilerReflection.h
     Debug/StackTracer.h
+    Debug/StartupTimeline.h
+    Debug/StartupTimeline.cpp
     Debug/Timer.h
     Debug/Trace.cpp
     Debug/Trace.h
@@ -123,6 +134,8 @@ set(FILES
     DOM/Backends/JSON/JsonSerializationUtils.cpp
     DOM/Backends/JSON/JsonSerializationUtils.h
     EBus/BusImpl.h
+    EBus/DispatchStatistics.cpp
+    EBus/DispatchStatistics.h
     EBus/EBus.h
     EBus/EBusEnvironment.cpp
     EBus/EBusSharedDispatchTraits.h
@@ -143,6 +156,7 @@ set(FILES
     EBus/Internal/BusContainer.h
     EBus/Internal/CallstackEntry.h
     EBus/Internal/Debug.h
+    EBus/Internal/DispatchScope.h
     EBus/Internal/Handlers.h
     EBus/Internal/StoragePolicies.h
     Instance/InstancePool.h
@@ -173,6 +187,8 @@ set(FILES
     IO/IStreamerTypes.cpp
     IO/GenericStreams.cpp
     IO/GenericStreams.h
+    IO/MappedFile.cpp
+    IO/MappedFile.h
     IO/OpenMode.h
     IO/OpenMode.cpp
     IO/Path/Path.cpp
@@ -197,6 +213,10 @@ set(FILES
     IO/Streamer/FileRequest.cpp
     IO/Streamer/FullFileDecompressor.h
     IO/Streamer/FullFileDecompressor.cpp
+    IO/Streamer/PersistentCache.h
+    IO/Streamer/PersistentCache.cpp
+    IO/Streamer/Prefetcher.h
+    IO/Streamer/Prefetcher.cpp
     IO/Streamer/ReadSplitter.h
     IO/Streamer/ReadSplitter.cpp
     IO/Streamer/RequestPath.h
@@ -304,6 +324,8 @@ set(FILES
     Math/Internal/SimdMathVec4_neon.inl
     Math/Internal/SimdMathVec4_scalar.inl
     Math/Internal/SimdMathVec4_sse.inl
+    Math/Internal/SimdMathVec8_avx.inl
+    Math/Internal/SimdMathVec8_vec4.inl
     Math/Internal/SimdMathCommon_neon.inl
     Math/Internal/SimdMathCommon_neonDouble.inl
     Math/Internal/SimdMathCommon_neonQuad.inl
@@ -318,6 +340,9 @@ set(FILES
     Math/IntersectSegment.h
     Math/LineSegment.cpp
     Math/LineSegment.h
+    Math/MathBatch.cpp
+    Math/MathBatch.h
+    Math/MathBatch.inl
     Math/MathIntrinsics.h
     Math/MathReflection.cpp
     Math/MathReflection.h
@@ -369,6 +394,7 @@ set(FILES
     Math/SimdMathVec2.h
     Math/SimdMathVec3.h
     Math/SimdMathVec4.h
+    Math/SimdMathVec8.h
     Math/Sha1.h
     Math/Spline.cpp
     Math/Spline.h
@@ -420,6 +446,8 @@ set(FILES
     Memory/ChildAllocatorSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameArenaAllocator.cpp
+    Memory/FrameArenaAllocator.h
     Memory/HphaAllocator.cpp
     Memory/HphaAllocator.h
     Memory/IAllocator.h
@@ -454,6 +482,8 @@ set(FILES
     Module/ModuleManagerBus.h
     Module/ModuleManager.cpp
     Module/ModuleManager.h
+    Module/Internal/ModuleFilePrefetcher.h
+    Module/Internal/ModuleFilePrefetcher.cpp
     Module/Internal/ModuleManagerSearchPathTool.h
     Module/Internal/ModuleManagerSearchPathTool.cpp
     Name/Name.h
@@ -549,6 +579,7 @@ set(FILES
     Serialization/DataOverlayProviderMsgs.h
     Serialization/AZStdContainers.inl
     Serialization/AZStdAnyDataContainer.inl
+    Serialization/CopyOnWrite.h
     Serialization/DynamicSerializableField.cpp
     Serialization/DynamicSerializableField.h
     Serialization/EnumConstantJsonSerializer.cpp
@@ -650,6 +681,8 @@ set(FILES
     Settings/SettingsRegistryConsoleUtils.h
     Settings/SettingsRegistryImpl.cpp
     Settings/SettingsRegistryImpl.h
+    Settings/SettingsRegistryMergeCache.cpp
+    Settings/SettingsRegistryMergeCache.h
     Settings/SettingsRegistryMergeUtils.cpp
     Settings/SettingsRegistryMergeUtils.h
     Settings/SettingsRegistryOriginTracker.cpp
@@ -677,6 +710,8 @@ set(FILES
     Socket/AzSocket.h
     State/HSM.cpp
     State/HSM.h
+    Statistics/LatencyHistogram.cpp
+    Statistics/LatencyHistogram.h
     Statistics/NamedRunningStatistic.h
     Statistics/RunningStatistic.cpp
     Statistics/RunningStatistic.h
@@ -691,6 +726,8 @@ set(FILES
     Task/Internal/Task.inl
     Task/Internal/Task.h
     Task/Internal/TaskConfig.h
+    Task/TaskAwaitables.h
+    Task/TaskCoroutine.h
     Task/TaskDescriptor.h
     Task/TaskExecutor.cpp
     Task/TaskExecutor.h
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/flat_hash_table.h>
+#include <AzCore/std/tuple.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+        struct FlatHashMapTableTraits
+        {
+            using key_type = Key;
+            using value_type = AZStd::pair<const Key, MappedType>;
+            // The slots hold a mutable key, so rehashing can move the elements
+            using slot_type = AZStd::pair<Key, MappedType>;
+            using hasher = Hasher;
+            using key_equal = EqualKey;
+            using allocator_type = Allocator;
+
+            static AZ_FORCE_INLINE const key_type& key(const slot_type& slot) { return slot.first; }
+            static AZ_FORCE_INLINE const key_type& key(const value_type& value) { return value.first; }
+            static AZ_FORCE_INLINE value_type& element(slot_type& slot) { return reinterpret_cast<value_type&>(slot); }
+            static AZ_FORCE_INLINE const value_type& element(const slot_type& slot) { return reinterpret_cast<const value_type&>(slot); }
+        };
+    }
+
+    /**
+     * Map of unique keys stored in place in an open addressing table, see \ref flat_hash_table.
+     * It has the interface of the unordered_map, without the buckets and the node handles, and with the difference
+     * that rehashing and erasing invalidate the iterators and rehashing moves the elements.
+     */
+    template<class Key, class MappedType, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_map
+        : public flat_hash_table<Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator>>
+    {
+        using base_type = flat_hash_table<Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator>>;
+
+    public:
+        using key_type = typename base_type::key_type;
+        using mapped_type = MappedType;
+        using value_type = typename base_type::value_type;
+        using hasher = typename base_type::hasher;
+        using key_equal = typename base_type::key_equal;
+        using allocator_type = typename base_type::allocator_type;
+        using size_type = typename base_type::size_type;
+        using iterator = typename base_type::iterator;
+        using const_iterator = typename base_type::const_iterator;
+
+        using base_type::base_type;
+
+        flat_hash_map() = default;
+
+        template<class InputIterator>
+        flat_hash_map(InputIterator first, InputIterator last, size_type bucketCount = 0, const hasher& hash = hasher(),
+            const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : base_type(bucketCount, hash, keyEqual, allocator)
+        {
+            this->insert(first, last);
+        }
+
+        flat_hash_map(AZStd::initializer_list<value_type> list, size_type bucketCount = 0, const hasher& hash = hasher(),
+            const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : base_type(bucketCount, hash, keyEqual, allocator)
+        {
+            this->insert(list);
+        }
+
+        flat_hash_map& operator=(AZStd::initializer_list<value_type> list)
+        {
+            this->clear();
+            this->insert(list);
+            return *this;
+        }
+
+        //! Constructs the mapped value only if @key isn't in the map.
+        template<class... Args>
+        AZStd::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args)
+        {
+            return TryEmplace(key, AZStd::forward<Args>(args)...);
+        }
+        template<class... Args>
+        AZStd::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args)
+        {
+            return TryEmplace(AZStd::move(key), AZStd::forward<Args>(args)...);
+        }
+        template<class... Args>
+        iterator try_emplace(const_iterator, const key_type& key, Args&&... args)
+        {
+            return try_emplace(key, AZStd::forward<Args>(args)...).first;
+        }
+        template<class... Args>
+        iterator try_emplace(const_iterator, key_type&& key, Args&&... args)
+        {
+            return try_emplace(AZStd::move(key), AZStd::forward<Args>(args)...).first;
+        }
+
+        template<class M>
+        AZStd::pair<iterator, bool> insert_or_assign(const key_type& key, M&& value)
+        {
+            return InsertOrAssign(key, AZStd::forward<M>(value));
+        }
+        template<class M>
+        AZStd::pair<iterator, bool> insert_or_assign(key_type&& key, M&& value)
+        {
+            return InsertOrAssign(AZStd::move(key), AZStd::forward<M>(value));
+        }
+        template<class M>
+        iterator insert_or_assign(const_iterator, const key_type& key, M&& value)
+        {
+            return insert_or_assign(key, AZStd::forward<M>(value)).first;
+        }
+        template<class M>
+        iterator insert_or_assign(const_iterator, key_type&& key, M&& value)
+        {
+            return insert_or_assign(AZStd::move(key), AZStd::forward<M>(value)).first;
+        }
+
+        MappedType& operator[](const key_type& key)
+        {
+            return try_emplace(key).first->second;
+        }
+        MappedType& operator[](key_type&& key)
+        {
+            return try_emplace(AZStd::move(key)).first->second;
+        }
+
+        MappedType& at(const key_type& key)
+        {
+            iterator iter = this->find(key);
+            AZSTD_CONTAINER_ASSERT(iter != this->end(), "flat_hash_map::at - key not found");
+            return iter->second;
+        }
+        const MappedType& at(const key_type& key) const
+        {
+            const_iterator iter = this->find(key);
+            AZSTD_CONTAINER_ASSERT(iter != this->end(), "flat_hash_map::at - key not found");
+            return iter->second;
+        }
+
+    private:
+        template<class K, class... Args>
+        AZStd::pair<iterator, bool> TryEmplace(K&& key, Args&&... args)
+        {
+            auto [index, inserted] = this->FindOrPrepareInsert(key);
+            if (inserted)
+            {
+                AZStd::construct_at(this->SlotAt(index), AZStd::piecewise_construct,
+                    AZStd::forward_as_tuple(AZStd::forward<K>(key)), AZStd::forward_as_tuple(AZStd::forward<Args>(args)...));
+            }
+            return { this->IteratorAt(index), inserted };
+        }
+
+        template<class K, class M>
+        AZStd::pair<iterator, bool> InsertOrAssign(K&& key, M&& value)
+        {
+            auto [index, inserted] = this->FindOrPrepareInsert(key);
+            if (inserted)
+            {
+                AZStd::construct_at(this->SlotAt(index), AZStd::forward<K>(key), AZStd::forward<M>(value));
+            }
+            else
+            {
+                this->SlotAt(index)->second = AZStd::forward<M>(value);
+            }
+            return { this->IteratorAt(index), inserted };
+        }
+    };
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    void swap(flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& lhs, flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator, class Predicate>
+    decltype(auto) erase_if(flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& container, Predicate predicate)
+    {
+        auto originalSize = container.size();
+        for (auto iter = container.begin(); iter != container.end();)
+        {
+            if (predicate(*iter))
+            {
+                iter = container.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+        return originalSize - container.size();
+    }
+} // namespace AZStd
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/flat_hash_table.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class Hasher, class EqualKey, class Allocator>
+        struct FlatHashSetTableTraits
+        {
+            using key_type = Key;
+            using value_type = Key;
+            using slot_type = Key;
+            using hasher = Hasher;
+            using key_equal = EqualKey;
+            using allocator_type = Allocator;
+
+            static AZ_FORCE_INLINE const key_type& key(const slot_type& slot) { return slot; }
+            static AZ_FORCE_INLINE value_type& element(slot_type& slot) { return slot; }
+            static AZ_FORCE_INLINE const value_type& element(const slot_type& slot) { return slot; }
+        };
+    }
+
+    /**
+     * Set of unique keys stored in place in an open addressing table, see \ref flat_hash_table.
+     * It has the interface of the unordered_set, without the buckets and the node handles, and with the difference
+     * that rehashing and erasing invalidate the iterators and rehashing moves the keys.
+     */
+    template<class Key, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_set
+        : public flat_hash_table<Internal::FlatHashSetTableTraits<Key, Hasher, EqualKey, Allocator>>
+    {
+        using base_type = flat_hash_table<Internal::FlatHashSetTableTraits<Key, Hasher, EqualKey, Allocator>>;
+
+    public:
+        using key_type = typename base_type::key_type;
+        using value_type = typename base_type::value_type;
+        using hasher = typename base_type::hasher;
+        using key_equal = typename base_type::key_equal;
+        using allocator_type = typename base_type::allocator_type;
+        using size_type = typename base_type::size_type;
+        using iterator = typename base_type::iterator;
+        using const_iterator = typename base_type::const_iterator;
+
+        using base_type::base_type;
+
+        flat_hash_set() = default;
+
+        template<class InputIterator>
+        flat_hash_set(InputIterator first, InputIterator last, size_type bucketCount = 0, const hasher& hash = hasher(),
+            const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : base_type(bucketCount, hash, keyEqual, allocator)
+        {
+            this->insert(first, last);
+        }
+
+        flat_hash_set(AZStd::initializer_list<value_type> list, size_type bucketCount = 0, const hasher& hash = hasher(),
+            const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : base_type(bucketCount, hash, keyEqual, allocator)
+        {
+            this->insert(list);
+        }
+
+        flat_hash_set& operator=(AZStd::initializer_list<value_type> list)
+        {
+            this->clear();
+            this->insert(list);
+            return *this;
+        }
+    };
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    void swap(flat_hash_set<Key, Hasher, EqualKey, Allocator>& lhs, flat_hash_set<Key, Hasher, EqualKey, Allocator>& rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator, class Predicate>
+    decltype(auto) erase_if(flat_hash_set<Key, Hasher, EqualKey, Allocator>& container, Predicate predicate)
+    {
+        auto originalSize = container.size();
+        for (auto iter = container.begin(); iter != container.end();)
+        {
+            if (predicate(*iter))
+            {
+                iter = container.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+        return originalSize - container.size();
+    }
+} // namespace AZStd
@@ -0,0 +1,543 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/containers/containers_concepts.h>
+#include <AzCore/std/createdestroy.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/typetraits/typetraits.h>
+
+namespace AZStd
+{
+    /**
+     * Vector that stores up to InlineCapacity elements inside the container and only allocates from the
+     * allocator once it grows past them. Use it where a container usually holds a few elements but has no
+     * hard limit, e.g. the locals of a frequently called function, where a fixed_vector would be too small
+     * and a vector would allocate on every call.
+     * Like the fixed_vector, moving or swapping a small_vector whose elements are inline moves the elements
+     * one by one. Once the elements are on the heap, moving only transfers the allocation.
+     */
+    template<class T, AZStd::size_t InlineCapacity, class Allocator = AZStd::allocator>
+    class small_vector
+    {
+        static_assert(InlineCapacity > 0, "small_vector needs an inline capacity, use AZStd::vector instead");
+
+    public:
+        using value_type = T;
+        using size_type = AZStd::size_t;
+        using difference_type = AZStd::ptrdiff_t;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using reference = T&;
+        using const_reference = const T&;
+        using allocator_type = Allocator;
+
+        using iterator = pointer;
+        using const_iterator = const_pointer;
+        using reverse_iterator = AZStd::reverse_iterator<iterator>;
+        using const_reverse_iterator = AZStd::reverse_iterator<const_iterator>;
+
+        small_vector() = default;
+
+        explicit small_vector(const allocator_type& allocator)
+            : m_allocator(allocator)
+        {
+        }
+
+        explicit small_vector(size_type numElements, const allocator_type& allocator = allocator_type())
+            : m_allocator(allocator)
+        {
+            resize(numElements);
+        }
+
+        small_vector(size_type numElements, const_reference value, const allocator_type& allocator = allocator_type())
+            : m_allocator(allocator)
+        {
+            resize(numElements, value);
+        }
+
+        template<class InputIt, typename = AZStd::enable_if_t<input_iterator<InputIt>>>
+        small_vector(InputIt first, InputIt last, const allocator_type& allocator = allocator_type())
+            : m_allocator(allocator)
+        {
+            assign(first, last);
+        }
+
+        template<class R, class = enable_if_t<Internal::container_compatible_range<R, value_type>>>
+        small_vector(from_range_t, R&& rg, const allocator_type& allocator = allocator_type())
+            : m_allocator(allocator)
+        {
+            assign(ranges::begin(rg), ranges::end(rg));
+        }
+
+        small_vector(AZStd::initializer_list<value_type> ilist, const allocator_type& allocator = allocator_type())
+            : m_allocator(allocator)
+        {
+            assign(ilist.begin(), ilist.end());
+        }
+
+        small_vector(const small_vector& rhs)
+            : m_allocator(rhs.m_allocator)
+        {
+            reserve(rhs.m_size);
+            AZStd::uninitialized_copy(rhs.begin(), rhs.end(), m_data);
+            m_size = rhs.m_size;
+        }
+
+        small_vector(small_vector&& rhs)
+            : m_allocator(rhs.m_allocator)
+        {
+            MoveFrom(rhs);
+        }
+
+        ~small_vector()
+        {
+            clear();
+            DeallocateHeap();
+        }
+
+        small_vector& operator=(const small_vector& rhs)
+        {
+            if (this != &rhs)
+            {
+                assign(rhs.begin(), rhs.end());
+            }
+            return *this;
+        }
+
+        small_vector& operator=(small_vector&& rhs)
+        {
+            if (this != &rhs)
+            {
+                clear();
+                if (!rhs.IsInline() && m_allocator == rhs.m_allocator)
+                {
+                    DeallocateHeap();
+                    MoveFrom(rhs);
+                }
+                else
+                {
+                    reserve(rhs.m_size);
+                    AZStd::uninitialized_move(rhs.begin(), rhs.end(), m_data);
+                    m_size = rhs.m_size;
+                    rhs.clear();
+                }
+            }
+            return *this;
+        }
+
+        small_vector& operator=(AZStd::initializer_list<value_type> ilist)
+        {
+            assign(ilist.begin(), ilist.end());
+            return *this;
+        }
+
+        iterator begin() { return m_data; }
+        const_iterator begin() const { return m_data; }
+        const_iterator cbegin() const { return m_data; }
+        iterator end() { return m_data + m_size; }
+        const_iterator end() const { return m_data + m_size; }
+        const_iterator cend() const { return m_data + m_size; }
+        reverse_iterator rbegin() { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        const_reverse_iterator crbegin() const { return const_reverse_iterator(end()); }
+        reverse_iterator rend() { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+        const_reverse_iterator crend() const { return const_reverse_iterator(begin()); }
+
+        pointer data() { return m_data; }
+        const_pointer data() const { return m_data; }
+        size_type size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+        size_type capacity() const { return m_capacity; }
+        size_type max_size() const { return m_allocator.max_size() / sizeof(T); }
+        static constexpr size_type inline_capacity() { return InlineCapacity; }
+
+        //! AZStd extension, returns true while the elements are stored in the container.
+        bool is_inline() const { return IsInline(); }
+
+        allocator_type& get_allocator() { return m_allocator; }
+        const allocator_type& get_allocator() const { return m_allocator; }
+
+        reference operator[](size_type position)
+        {
+            AZSTD_CONTAINER_ASSERT(position < m_size, "AZStd::small_vector::operator[] - position is out of range");
+            return m_data[position];
+        }
+        const_reference operator[](size_type position) const
+        {
+            AZSTD_CONTAINER_ASSERT(position < m_size, "AZStd::small_vector::operator[] - position is out of range");
+            return m_data[position];
+        }
+        reference at(size_type position) { return operator[](position); }
+        const_reference at(size_type position) const { return operator[](position); }
+
+        reference front()
+        {
+            AZSTD_CONTAINER_ASSERT(m_size != 0, "AZStd::small_vector::front - container is empty");
+            return m_data[0];
+        }
+        const_reference front() const
+        {
+            AZSTD_CONTAINER_ASSERT(m_size != 0, "AZStd::small_vector::front - container is empty");
+            return m_data[0];
+        }
+        reference back()
+        {
+            AZSTD_CONTAINER_ASSERT(m_size != 0, "AZStd::small_vector::back - container is empty");
+            return m_data[m_size - 1];
+        }
+        const_reference back() const
+        {
+            AZSTD_CONTAINER_ASSERT(m_size != 0, "AZStd::small_vector::back - container is empty");
+            return m_data[m_size - 1];
+        }
+
+        void reserve(size_type newCapacity)
+        {
+            if (newCapacity > m_capacity)
+            {
+                Reallocate(newCapacity);
+            }
+        }
+
+        //! Moves the elements back inline when they fit, otherwise to an allocation of their size.
+        void shrink_to_fit()
+        {
+            if (!IsInline() && m_size < m_capacity)
+            {
+                Reallocate(m_size);
+            }
+        }
+
+        void resize(size_type newSize)
+        {
+            if (newSize > m_size)
+            {
+                reserve(newSize);
+                AZStd::uninitialized_value_construct(m_data + m_size, m_data + newSize);
+                m_size = newSize;
+            }
+            else
+            {
+                erase(begin() + newSize, end());
+            }
+        }
+
+        void resize(size_type newSize, const_reference value)
+        {
+            if (newSize > m_size)
+            {
+                insert(end(), newSize - m_size, value);
+            }
+            else
+            {
+                erase(begin() + newSize, end());
+            }
+        }
+
+        void assign(size_type numElements, const_reference value)
+        {
+            // The value could be an element of the container
+            value_type copy(value);
+            clear();
+            reserve(numElements);
+            AZStd::uninitialized_fill_n(m_data, numElements, copy);
+            m_size = numElements;
+        }
+
+        template<class InputIt, typename = AZStd::enable_if_t<input_iterator<InputIt>>>
+        void assign(InputIt first, InputIt last)
+        {
+            clear();
+            if constexpr (forward_iterator<InputIt>)
+            {
+                reserve(static_cast<size_type>(AZStd::ranges::distance(first, last)));
+            }
+            for (; first != last; ++first)
+            {
+                emplace_back(*first);
+            }
+        }
+
+        void assign(AZStd::initializer_list<value_type> ilist)
+        {
+            assign(ilist.begin(), ilist.end());
+        }
+
+        template<class... Args>
+        reference emplace_back(Args&&... args)
+        {
+            if (m_size == m_capacity)
+            {
+                return ReallocateAndEmplaceBack(AZStd::forward<Args>(args)...);
+            }
+            pointer element = AZStd::construct_at(m_data + m_size, AZStd::forward<Args>(args)...);
+            ++m_size;
+            return *element;
+        }
+
+        void push_back(const_reference value)
+        {
+            emplace_back(value);
+        }
+
+        void push_back(value_type&& value)
+        {
+            emplace_back(AZStd::move(value));
+        }
+
+        void pop_back()
+        {
+            AZSTD_CONTAINER_ASSERT(m_size != 0, "AZStd::small_vector::pop_back - container is empty");
+            --m_size;
+            AZStd::destroy_at(m_data + m_size);
+        }
+
+        template<class... Args>
+        iterator emplace(const_iterator insertPos, Args&&... args)
+        {
+            AZSTD_CONTAINER_ASSERT(insertPos >= cbegin() && insertPos <= cend(), "insert position must be in range of container");
+            const size_type index = static_cast<size_type>(insertPos - cbegin());
+            if (index == m_size)
+            {
+                emplace_back(AZStd::forward<Args>(args)...);
+                return m_data + index;
+            }
+
+            // The arguments could refer to elements that are about to move
+            value_type value(AZStd::forward<Args>(args)...);
+            emplace_back(AZStd::move(m_data[m_size - 1]));
+            AZStd::move_backward(m_data + index, m_data + m_size - 2, m_data + m_size - 1);
+            m_data[index] = AZStd::move(value);
+            return m_data + index;
+        }
+
+        iterator insert(const_iterator insertPos, const_reference value)
+        {
+            return emplace(insertPos, value);
+        }
+
+        iterator insert(const_iterator insertPos, value_type&& value)
+        {
+            return emplace(insertPos, AZStd::move(value));
+        }
+
+        iterator insert(const_iterator insertPos, size_type numElements, const_reference value)
+        {
+            AZSTD_CONTAINER_ASSERT(insertPos >= cbegin() && insertPos <= cend(), "insert position must be in range of container");
+            const size_type index = static_cast<size_type>(insertPos - cbegin());
+            value_type copy(value);
+            reserve(m_size + numElements);
+            AZStd::uninitialized_fill_n(m_data + m_size, numElements, copy);
+            m_size += numElements;
+            AZStd::rotate(m_data + index, m_data + m_size - numElements, m_data + m_size);
+            return m_data + index;
+        }
+
+        //! Appends the elements and rotates them into place, which also handles the single pass iterators.
+        template<class InputIt, typename = AZStd::enable_if_t<input_iterator<InputIt>>>
+        iterator insert(const_iterator insertPos, InputIt first, InputIt last)
+        {
+            AZSTD_CONTAINER_ASSERT(insertPos >= cbegin() && insertPos <= cend(), "insert position must be in range of container");
+            const size_type index = static_cast<size_type>(insertPos - cbegin());
+            const size_type oldSize = m_size;
+            if constexpr (forward_iterator<InputIt>)
+            {
+                reserve(m_size + static_cast<size_type>(AZStd::ranges::distance(first, last)));
+            }
+            for (; first != last; ++first)
+            {
+                emplace_back(*first);
+            }
+            AZStd::rotate(m_data + index, m_data + oldSize, m_data + m_size);
+            return m_data + index;
+        }
+
+        iterator insert(const_iterator insertPos, AZStd::initializer_list<value_type> ilist)
+        {
+            return insert(insertPos, ilist.begin(), ilist.end());
+        }
+
+        iterator erase(const_iterator elementIter)
+        {
+            return erase(elementIter, elementIter + 1);
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            AZSTD_CONTAINER_ASSERT(first >= cbegin() && first <= last && last <= cend(), "erase iterators must be inside the range of the container");
+            pointer firstPtr = m_data + (first - cbegin());
+            pointer lastPtr = m_data + (last - cbegin());
+            if (firstPtr != lastPtr)
+            {
+                pointer newEnd = AZStd::move(lastPtr, end(), firstPtr);
+                AZStd::destroy(newEnd, end());
+                m_size = static_cast<size_type>(newEnd - m_data);
+            }
+            return firstPtr;
+        }
+
+        //! Destroys the elements, a heap allocation is kept for reuse.
+        void clear()
+        {
+            AZStd::destroy(begin(), end());
+            m_size = 0;
+        }
+
+        void swap(small_vector& rhs)
+        {
+            if (this == &rhs)
+            {
+                return;
+            }
+            if (!IsInline() && !rhs.IsInline() && m_allocator == rhs.m_allocator)
+            {
+                AZStd::swap(m_data, rhs.m_data);
+                AZStd::swap(m_size, rhs.m_size);
+                AZStd::swap(m_capacity, rhs.m_capacity);
+                return;
+            }
+            small_vector temp(AZStd::move(rhs));
+            rhs = AZStd::move(*this);
+            *this = AZStd::move(temp);
+        }
+
+    private:
+        bool IsInline() const
+        {
+            return m_data == InlineData();
+        }
+
+        pointer InlineData()
+        {
+            return reinterpret_cast<pointer>(m_inlineStorage);
+        }
+
+        const_pointer InlineData() const
+        {
+            return reinterpret_cast<const_pointer>(m_inlineStorage);
+        }
+
+        pointer Allocate(size_type capacity)
+        {
+            return reinterpret_cast<pointer>(static_cast<void*>(m_allocator.allocate(capacity * sizeof(T), alignof(T))));
+        }
+
+        void DeallocateHeap()
+        {
+            if (!IsInline())
+            {
+                m_allocator.deallocate(m_data, m_capacity * sizeof(T), alignof(T));
+                m_data = InlineData();
+                m_capacity = InlineCapacity;
+            }
+        }
+
+        //! Takes the allocation of @rhs when it has one, otherwise moves its elements inline.
+        //! Expects this container to have no elements and no allocation.
+        void MoveFrom(small_vector& rhs)
+        {
+            if (rhs.IsInline())
+            {
+                AZStd::uninitialized_move(rhs.begin(), rhs.end(), m_data);
+                m_size = rhs.m_size;
+                rhs.clear();
+            }
+            else
+            {
+                m_data = rhs.m_data;
+                m_size = rhs.m_size;
+                m_capacity = rhs.m_capacity;
+                rhs.m_data = rhs.InlineData();
+                rhs.m_size = 0;
+                rhs.m_capacity = InlineCapacity;
+            }
+        }
+
+        //! Moves the elements to the inline storage if @newCapacity fits in it, otherwise to a new allocation.
+        void Reallocate(size_type newCapacity)
+        {
+            pointer newData = newCapacity <= InlineCapacity ? InlineData() : Allocate(newCapacity);
+            if (newData == m_data)
+            {
+                return;
+            }
+            AZStd::uninitialized_move(begin(), end(), newData);
+            AZStd::destroy(begin(), end());
+            DeallocateHeap();
+            m_data = newData;
+            m_capacity = newCapacity <= InlineCapacity ? InlineCapacity : newCapacity;
+        }
+
+        //! The arguments could refer to an element, so the new element is constructed before the old ones move.
+        template<class... Args>
+        reference ReallocateAndEmplaceBack(Args&&... args)
+        {
+            const size_type newCapacity = AZStd::max<size_type>(m_capacity * 2, m_size + 1);
+            pointer newData = Allocate(newCapacity);
+            AZStd::construct_at(newData + m_size, AZStd::forward<Args>(args)...);
+            AZStd::uninitialized_move(begin(), end(), newData);
+            AZStd::destroy(begin(), end());
+            DeallocateHeap();
+            m_data = newData;
+            m_capacity = newCapacity;
+            return m_data[m_size++];
+        }
+
+        pointer m_data = InlineData();
+        size_type m_size = 0;
+        size_type m_capacity = InlineCapacity;
+        allocator_type m_allocator;
+        alignas(T) unsigned char m_inlineStorage[InlineCapacity * sizeof(T)];
+    };
+
+    template<class T, AZStd::size_t InlineCapacity1, AZStd::size_t InlineCapacity2, class Allocator>
+    bool operator==(const small_vector<T, InlineCapacity1, Allocator>& a, const small_vector<T, InlineCapacity2, Allocator>& b)
+    {
+        return AZStd::equal(a.begin(), a.end(), b.begin(), b.end());
+    }
+
+    template<class T, AZStd::size_t InlineCapacity1, AZStd::size_t InlineCapacity2, class Allocator>
+    bool operator!=(const small_vector<T, InlineCapacity1, Allocator>& a, const small_vector<T, InlineCapacity2, Allocator>& b)
+    {
+        return !operator==(a, b);
+    }
+
+    template<class T, AZStd::size_t InlineCapacity1, AZStd::size_t InlineCapacity2, class Allocator>
+    bool operator<(const small_vector<T, InlineCapacity1, Allocator>& a, const small_vector<T, InlineCapacity2, Allocator>& b)
+    {
+        return AZStd::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+    }
+
+    template<class T, AZStd::size_t InlineCapacity, class Allocator>
+    void swap(small_vector<T, InlineCapacity, Allocator>& a, small_vector<T, InlineCapacity, Allocator>& b)
+    {
+        a.swap(b);
+    }
+
+    template<class T, AZStd::size_t InlineCapacity, class Allocator, class U>
+    decltype(auto) erase(small_vector<T, InlineCapacity, Allocator>& container, const U& value)
+    {
+        auto iter = AZStd::remove(container.begin(), container.end(), value);
+        auto removedCount = AZStd::ranges::distance(iter, container.end());
+        container.erase(iter, container.end());
+        return removedCount;
+    }
+
+    template<class T, AZStd::size_t InlineCapacity, class Allocator, class Predicate>
+    decltype(auto) erase_if(small_vector<T, InlineCapacity, Allocator>& container, Predicate predicate)
+    {
+        auto iter = AZStd::remove_if(container.begin(), container.end(), predicate);
+        auto removedCount = AZStd::ranges::distance(iter, container.end());
+        container.erase(iter, container.end());
+        return removedCount;
+    }
+} // namespace AZStd
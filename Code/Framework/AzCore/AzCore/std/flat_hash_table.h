@@ -0,0 +1,856 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/createdestroy.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/utils.h>
+
+#include <string.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#   include <emmintrin.h>
+#endif
+#if defined(AZ_COMPILER_MSVC)
+#   include <intrin.h>
+#endif
+
+namespace AZStd::Internal::FlatHash
+{
+    //! Every slot of the table has a control byte. A full slot stores the 7 low bits of its hash (H2), the other
+    //! states have their top bit set so a group of control bytes can be tested for them at once.
+    using ctrl_t = AZ::s8;
+    inline constexpr ctrl_t Empty = -128;   // 0b10000000
+    inline constexpr ctrl_t Deleted = -2;   // 0b11111110
+    inline constexpr ctrl_t Sentinel = -1;  // 0b11111111, ends the control bytes for the iterators
+
+    AZ_FORCE_INLINE bool IsFull(ctrl_t ctrl)
+    {
+        return ctrl >= 0;
+    }
+
+    AZ_FORCE_INLINE AZ::u32 TrailingZeros(AZ::u32 value)
+    {
+        return static_cast<AZ::u32>(az_ctz_u32(value));
+    }
+
+    AZ_FORCE_INLINE AZ::u32 TrailingZeros(AZ::u64 value)
+    {
+        return static_cast<AZ::u32>(az_ctz_u64(value));
+    }
+
+    //! Iterates over the slots of a group that matched a test, from the lowest slot.
+    //! @Shift is the log2 of the number of mask bits per slot.
+    template<class MaskType, AZ::u32 Shift>
+    class BitMask
+    {
+    public:
+        explicit BitMask(MaskType mask)
+            : m_mask(mask)
+        {
+        }
+
+        explicit operator bool() const
+        {
+            return m_mask != 0;
+        }
+
+        AZ::u32 LowestBitSet() const
+        {
+            return TrailingZeros(m_mask) >> Shift;
+        }
+
+        void ClearLowestBit()
+        {
+            m_mask &= (m_mask - 1);
+        }
+
+    private:
+        MaskType m_mask;
+    };
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+    //! Tests the control bytes of 16 slots with SSE2 instructions.
+    class Group
+    {
+    public:
+        static constexpr size_t Width = 16;
+        using Mask = BitMask<AZ::u32, 0>;
+
+        explicit Group(const ctrl_t* ctrl)
+            : m_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))
+        {
+        }
+
+        Mask Match(ctrl_t h2) const
+        {
+            return Mask(static_cast<AZ::u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_ctrl))));
+        }
+
+        Mask MaskEmpty() const
+        {
+            return Mask(static_cast<AZ::u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(Empty), m_ctrl))));
+        }
+
+        //! Empty and deleted are the only states below the sentinel.
+        Mask MaskEmptyOrDeleted() const
+        {
+            return Mask(static_cast<AZ::u32>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(Sentinel), m_ctrl))));
+        }
+
+    private:
+        __m128i m_ctrl;
+    };
+#else
+    //! Tests the control bytes of 8 slots at once in a 64 bit integer. Match can return false positives,
+    //! which are filtered out by the key comparison.
+    class Group
+    {
+    public:
+        static constexpr size_t Width = 8;
+        using Mask = BitMask<AZ::u64, 3>;
+
+        explicit Group(const ctrl_t* ctrl)
+        {
+            memcpy(&m_ctrl, ctrl, sizeof(m_ctrl));
+        }
+
+        Mask Match(ctrl_t h2) const
+        {
+            const AZ::u64 x = m_ctrl ^ (Lsbs * static_cast<AZ::u8>(h2));
+            return Mask((x - Lsbs) & ~x & Msbs);
+        }
+
+        //! Only empty has its top bit set and its second bit cleared.
+        Mask MaskEmpty() const
+        {
+            return Mask((m_ctrl & (~m_ctrl << 6)) & Msbs);
+        }
+
+        //! Only empty and deleted have their top bit set and their lowest bit cleared.
+        Mask MaskEmptyOrDeleted() const
+        {
+            return Mask((m_ctrl & (~m_ctrl << 7)) & Msbs);
+        }
+
+    private:
+        static constexpr AZ::u64 Lsbs = 0x0101010101010101ull;
+        static constexpr AZ::u64 Msbs = 0x8080808080808080ull;
+
+        AZ::u64 m_ctrl;
+    };
+#endif
+
+    //! Spreads the bits of the hash, the AZStd::hash of the integer types is the identity.
+    AZ_FORCE_INLINE size_t MixHash(size_t hash)
+    {
+        const AZ::u64 mixed = static_cast<AZ::u64>(hash) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(mixed ^ (mixed >> 32));
+    }
+
+    //! Selects the first group that is probed.
+    AZ_FORCE_INLINE size_t H1(size_t hash)
+    {
+        return hash >> 7;
+    }
+
+    //! Stored in the control byte to filter the slots before comparing keys.
+    AZ_FORCE_INLINE ctrl_t H2(size_t hash)
+    {
+        return static_cast<ctrl_t>(hash & 0x7F);
+    }
+} // namespace AZStd::Internal::FlatHash
+
+namespace AZStd
+{
+    /**
+     * Open addressing hash table in the style of the Swiss tables, the base of the flat_hash_map and flat_hash_set.
+     * The elements are stored in a single array next to one control byte per slot, which a lookup tests a group of
+     * 8 or 16 at a time before comparing any key. So unlike the node based hash_table, inserting doesn't allocate
+     * unless the table grows and finding an element doesn't chase pointers.
+     * The price is that rehashing and erasing invalidate the iterators, rehashing also moves the elements.
+     *
+     * Traits provides key_type, value_type, slot_type, hasher, key_equal and allocator_type, plus:
+     *   static const key_type& key(const slot_type&)
+     *   static value_type& element(slot_type&) and static const value_type& element(const slot_type&)
+     */
+    template<class Traits>
+    class flat_hash_table
+    {
+        using ctrl_t = Internal::FlatHash::ctrl_t;
+        using Group = Internal::FlatHash::Group;
+
+    public:
+        using traits_type = Traits;
+        using key_type = typename Traits::key_type;
+        using value_type = typename Traits::value_type;
+        using slot_type = typename Traits::slot_type;
+        using hasher = typename Traits::hasher;
+        using key_equal = typename Traits::key_equal;
+        using allocator_type = typename Traits::allocator_type;
+
+        using size_type = AZStd::size_t;
+        using difference_type = AZStd::ptrdiff_t;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using pointer = value_type*;
+        using const_pointer = const value_type*;
+
+        template<bool IsConst>
+        class iterator_impl
+        {
+            friend class flat_hash_table;
+            template<bool>
+            friend class iterator_impl;
+
+        public:
+            using iterator_category = AZStd::forward_iterator_tag;
+            using value_type = typename flat_hash_table::value_type;
+            using difference_type = AZStd::ptrdiff_t;
+            using reference = AZStd::conditional_t<IsConst, const value_type&, value_type&>;
+            using pointer = AZStd::conditional_t<IsConst, const value_type*, value_type*>;
+
+            iterator_impl() = default;
+
+            template<bool RhsIsConst, class = AZStd::enable_if_t<IsConst && !RhsIsConst>>
+            iterator_impl(const iterator_impl<RhsIsConst>& rhs)
+                : m_ctrl(rhs.m_ctrl)
+                , m_slot(rhs.m_slot)
+            {
+            }
+
+            reference operator*() const
+            {
+                return Traits::element(*m_slot);
+            }
+
+            pointer operator->() const
+            {
+                return &Traits::element(*m_slot);
+            }
+
+            iterator_impl& operator++()
+            {
+                ++m_ctrl;
+                ++m_slot;
+                SkipEmptyOrDeleted();
+                return *this;
+            }
+
+            iterator_impl operator++(int)
+            {
+                iterator_impl result = *this;
+                ++*this;
+                return result;
+            }
+
+            friend bool operator==(const iterator_impl& lhs, const iterator_impl& rhs)
+            {
+                return lhs.m_ctrl == rhs.m_ctrl;
+            }
+
+            friend bool operator!=(const iterator_impl& lhs, const iterator_impl& rhs)
+            {
+                return lhs.m_ctrl != rhs.m_ctrl;
+            }
+
+        private:
+            iterator_impl(const ctrl_t* ctrl, slot_type* slot)
+                : m_ctrl(ctrl)
+                , m_slot(slot)
+            {
+            }
+
+            void SkipEmptyOrDeleted()
+            {
+                while (*m_ctrl < Internal::FlatHash::Sentinel)
+                {
+                    ++m_ctrl;
+                    ++m_slot;
+                }
+            }
+
+            const ctrl_t* m_ctrl = nullptr;
+            slot_type* m_slot = nullptr;
+        };
+
+        using iterator = iterator_impl<false>;
+        using const_iterator = iterator_impl<true>;
+
+        flat_hash_table() = default;
+
+        explicit flat_hash_table(size_type bucketCount, const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : m_hasher(hash)
+            , m_keyEqual(keyEqual)
+            , m_allocator(allocator)
+        {
+            rehash(bucketCount);
+        }
+
+        explicit flat_hash_table(const allocator_type& allocator)
+            : m_allocator(allocator)
+        {
+        }
+
+        flat_hash_table(const flat_hash_table& rhs)
+            : m_hasher(rhs.m_hasher)
+            , m_keyEqual(rhs.m_keyEqual)
+            , m_allocator(rhs.m_allocator)
+        {
+            CopyElements(rhs);
+        }
+
+        flat_hash_table(const flat_hash_table& rhs, const allocator_type& allocator)
+            : m_hasher(rhs.m_hasher)
+            , m_keyEqual(rhs.m_keyEqual)
+            , m_allocator(allocator)
+        {
+            CopyElements(rhs);
+        }
+
+        flat_hash_table(flat_hash_table&& rhs)
+            : m_hasher(AZStd::move(rhs.m_hasher))
+            , m_keyEqual(AZStd::move(rhs.m_keyEqual))
+            , m_allocator(AZStd::move(rhs.m_allocator))
+        {
+            StealStorage(rhs);
+        }
+
+        ~flat_hash_table()
+        {
+            DestroyStorage();
+        }
+
+        flat_hash_table& operator=(const flat_hash_table& rhs)
+        {
+            if (this != &rhs)
+            {
+                clear();
+                m_hasher = rhs.m_hasher;
+                m_keyEqual = rhs.m_keyEqual;
+                if (m_allocator != rhs.m_allocator)
+                {
+                    DestroyStorage();
+                    m_allocator = rhs.m_allocator;
+                }
+                CopyElements(rhs);
+            }
+            return *this;
+        }
+
+        flat_hash_table& operator=(flat_hash_table&& rhs)
+        {
+            if (this != &rhs)
+            {
+                DestroyStorage();
+                m_hasher = AZStd::move(rhs.m_hasher);
+                m_keyEqual = AZStd::move(rhs.m_keyEqual);
+                m_allocator = AZStd::move(rhs.m_allocator);
+                StealStorage(rhs);
+            }
+            return *this;
+        }
+
+        iterator begin()
+        {
+            if (m_size == 0)
+            {
+                return end();
+            }
+            iterator result(m_ctrl, m_slots);
+            result.SkipEmptyOrDeleted();
+            return result;
+        }
+        const_iterator begin() const
+        {
+            return const_cast<flat_hash_table*>(this)->begin();
+        }
+        const_iterator cbegin() const
+        {
+            return begin();
+        }
+        iterator end()
+        {
+            return iterator(m_ctrl + m_capacity, m_slots + m_capacity);
+        }
+        const_iterator end() const
+        {
+            return const_cast<flat_hash_table*>(this)->end();
+        }
+        const_iterator cend() const
+        {
+            return end();
+        }
+
+        bool empty() const
+        {
+            return m_size == 0;
+        }
+        size_type size() const
+        {
+            return m_size;
+        }
+        size_type max_size() const
+        {
+            return m_allocator.max_size() / (sizeof(slot_type) + sizeof(ctrl_t));
+        }
+        size_type capacity() const
+        {
+            return m_capacity;
+        }
+        size_type bucket_count() const
+        {
+            return m_capacity;
+        }
+        float load_factor() const
+        {
+            return m_capacity != 0 ? static_cast<float>(m_size) / static_cast<float>(m_capacity) : 0.0f;
+        }
+        float max_load_factor() const
+        {
+            return 7.0f / 8.0f;
+        }
+
+        hasher hash_function() const
+        {
+            return m_hasher;
+        }
+        key_equal key_eq() const
+        {
+            return m_keyEqual;
+        }
+        allocator_type& get_allocator()
+        {
+            return m_allocator;
+        }
+        const allocator_type& get_allocator() const
+        {
+            return m_allocator;
+        }
+
+        //! Destroys all the elements but keeps the storage.
+        void clear()
+        {
+            if (m_capacity == 0)
+            {
+                return;
+            }
+            if (m_size != 0)
+            {
+                for (size_type index = 0; index < m_capacity; ++index)
+                {
+                    if (Internal::FlatHash::IsFull(m_ctrl[index]))
+                    {
+                        AZStd::destroy_at(m_slots + index);
+                    }
+                }
+            }
+            ResetCtrl();
+            m_size = 0;
+            m_deleted = 0;
+        }
+
+        //! Makes room for at least @count elements without growing.
+        void reserve(size_type count)
+        {
+            const size_type newCapacity = CapacityForSize(count);
+            if (newCapacity > m_capacity)
+            {
+                Resize(newCapacity);
+            }
+        }
+
+        //! Sets the number of slots to at least @bucketCount, and at least what the current elements need.
+        //! A count of zero frees the storage of an empty table.
+        void rehash(size_type bucketCount)
+        {
+            if (bucketCount == 0 && m_size == 0)
+            {
+                DestroyStorage();
+                return;
+            }
+            size_type newCapacity = CapacityForSize(m_size);
+            while (newCapacity < bucketCount)
+            {
+                newCapacity *= 2;
+            }
+            if (newCapacity != m_capacity || m_deleted != 0)
+            {
+                Resize(newCapacity);
+            }
+        }
+
+        template<class K>
+        iterator find(const K& key)
+        {
+            const size_type index = FindIndex(key);
+            return index != m_capacity ? iterator(m_ctrl + index, m_slots + index) : end();
+        }
+        template<class K>
+        const_iterator find(const K& key) const
+        {
+            return const_cast<flat_hash_table*>(this)->find(key);
+        }
+        template<class K>
+        bool contains(const K& key) const
+        {
+            return FindIndex(key) != m_capacity;
+        }
+        template<class K>
+        size_type count(const K& key) const
+        {
+            return contains(key) ? 1 : 0;
+        }
+
+        AZStd::pair<iterator, bool> insert(const value_type& value)
+        {
+            return EmplaceKey(Traits::key(value), value);
+        }
+        AZStd::pair<iterator, bool> insert(value_type&& value)
+        {
+            return EmplaceKey(Traits::key(value), AZStd::move(value));
+        }
+        iterator insert(const_iterator, const value_type& value)
+        {
+            return insert(value).first;
+        }
+        iterator insert(const_iterator, value_type&& value)
+        {
+            return insert(AZStd::move(value)).first;
+        }
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last)
+        {
+            for (; first != last; ++first)
+            {
+                insert(*first);
+            }
+        }
+        void insert(AZStd::initializer_list<value_type> list)
+        {
+            reserve(m_size + list.size());
+            insert(list.begin(), list.end());
+        }
+
+        //! Constructs the element before looking for its key, prefer try_emplace for the maps to avoid that.
+        template<class... Args>
+        AZStd::pair<iterator, bool> emplace(Args&&... args)
+        {
+            slot_type element(AZStd::forward<Args>(args)...);
+            return EmplaceKey(Traits::key(element), AZStd::move(element));
+        }
+        template<class... Args>
+        iterator emplace_hint(const_iterator, Args&&... args)
+        {
+            return emplace(AZStd::forward<Args>(args)...).first;
+        }
+
+        iterator erase(const_iterator position)
+        {
+            const size_type index = static_cast<size_type>(position.m_ctrl - m_ctrl);
+            EraseIndex(index);
+            iterator result(m_ctrl + index, m_slots + index);
+            result.SkipEmptyOrDeleted();
+            return result;
+        }
+        iterator erase(iterator position)
+        {
+            return erase(const_iterator(position));
+        }
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            while (first != last)
+            {
+                first = erase(first);
+            }
+            return iterator(const_cast<ctrl_t*>(last.m_ctrl), last.m_slot);
+        }
+        template<class K>
+        size_type erase(const K& key)
+        {
+            const size_type index = FindIndex(key);
+            if (index == m_capacity)
+            {
+                return 0;
+            }
+            EraseIndex(index);
+            return 1;
+        }
+
+        void swap(flat_hash_table& rhs)
+        {
+            AZStd::swap(m_hasher, rhs.m_hasher);
+            AZStd::swap(m_keyEqual, rhs.m_keyEqual);
+            AZStd::swap(m_allocator, rhs.m_allocator);
+            AZStd::swap(m_ctrl, rhs.m_ctrl);
+            AZStd::swap(m_slots, rhs.m_slots);
+            AZStd::swap(m_capacity, rhs.m_capacity);
+            AZStd::swap(m_size, rhs.m_size);
+            AZStd::swap(m_deleted, rhs.m_deleted);
+        }
+
+        friend bool operator==(const flat_hash_table& lhs, const flat_hash_table& rhs)
+        {
+            if (lhs.size() != rhs.size())
+            {
+                return false;
+            }
+            for (const value_type& value : lhs)
+            {
+                auto found = rhs.find(Traits::key(value));
+                if (found == rhs.end() || !(*found == value))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        friend bool operator!=(const flat_hash_table& lhs, const flat_hash_table& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+    protected:
+        //! Returns the slot of @key, or a new slot for it that the caller must construct the element in right away.
+        //! The second member is true for a new slot.
+        template<class K>
+        AZStd::pair<size_type, bool> FindOrPrepareInsert(const K& key)
+        {
+            const size_t hash = Internal::FlatHash::MixHash(m_hasher(key));
+            const size_type index = FindIndex(key, hash);
+            if (index != m_capacity)
+            {
+                return { index, false };
+            }
+            return { PrepareInsert(hash), true };
+        }
+
+        iterator IteratorAt(size_type index)
+        {
+            return iterator(m_ctrl + index, m_slots + index);
+        }
+
+        slot_type* SlotAt(size_type index)
+        {
+            return m_slots + index;
+        }
+
+    private:
+        static size_type GrowthLimit(size_type capacity)
+        {
+            return capacity - capacity / 8;
+        }
+
+        static size_type CapacityForSize(size_type count)
+        {
+            size_type capacity = Group::Width;
+            while (GrowthLimit(capacity) < count)
+            {
+                capacity *= 2;
+            }
+            return capacity;
+        }
+
+        template<class K>
+        size_type FindIndex(const K& key) const
+        {
+            return m_size != 0 ? FindIndex(key, Internal::FlatHash::MixHash(m_hasher(key))) : m_capacity;
+        }
+
+        //! Probes the groups in triangular steps, which visits every group of a power of two sized table.
+        //! A key can't be past a group with an empty slot, because it would have been inserted there.
+        template<class K>
+        size_type FindIndex(const K& key, size_t hash) const
+        {
+            if (m_capacity == 0)
+            {
+                return m_capacity;
+            }
+            const ctrl_t h2 = Internal::FlatHash::H2(hash);
+            const size_type groupMask = m_capacity / Group::Width - 1;
+            size_type groupIndex = Internal::FlatHash::H1(hash) & groupMask;
+            for (size_type step = 1;; ++step)
+            {
+                const size_type groupStart = groupIndex * Group::Width;
+                const Group group(m_ctrl + groupStart);
+                for (auto match = group.Match(h2); match; match.ClearLowestBit())
+                {
+                    const size_type index = groupStart + match.LowestBitSet();
+                    if (m_keyEqual(Traits::key(m_slots[index]), key))
+                    {
+                        return index;
+                    }
+                }
+                if (group.MaskEmpty())
+                {
+                    return m_capacity;
+                }
+                groupIndex = (groupIndex + step) & groupMask;
+            }
+        }
+
+        size_type FindFirstNonFull(size_t hash) const
+        {
+            const size_type groupMask = m_capacity / Group::Width - 1;
+            size_type groupIndex = Internal::FlatHash::H1(hash) & groupMask;
+            for (size_type step = 1;; ++step)
+            {
+                const size_type groupStart = groupIndex * Group::Width;
+                if (auto mask = Group(m_ctrl + groupStart).MaskEmptyOrDeleted(); mask)
+                {
+                    return groupStart + mask.LowestBitSet();
+                }
+                groupIndex = (groupIndex + step) & groupMask;
+            }
+        }
+
+        size_type PrepareInsert(size_t hash)
+        {
+            if (m_capacity == 0)
+            {
+                Resize(Group::Width);
+            }
+            size_type index = FindFirstNonFull(hash);
+            if (m_ctrl[index] == Internal::FlatHash::Empty && m_size + m_deleted + 1 > GrowthLimit(m_capacity))
+            {
+                // Purge the deleted slots at the current capacity while they make up most of the load
+                Resize((m_size + 1) * 2 <= GrowthLimit(m_capacity) ? m_capacity : m_capacity * 2);
+                index = FindFirstNonFull(hash);
+            }
+            if (m_ctrl[index] == Internal::FlatHash::Deleted)
+            {
+                --m_deleted;
+            }
+            m_ctrl[index] = Internal::FlatHash::H2(hash);
+            ++m_size;
+            return index;
+        }
+
+        template<class K, class Value>
+        AZStd::pair<iterator, bool> EmplaceKey(const K& key, Value&& value)
+        {
+            auto [index, inserted] = FindOrPrepareInsert(key);
+            if (inserted)
+            {
+                AZStd::construct_at(m_slots + index, AZStd::forward<Value>(value));
+            }
+            return { IteratorAt(index), inserted };
+        }
+
+        void EraseIndex(size_type index)
+        {
+            AZStd::destroy_at(m_slots + index);
+            --m_size;
+            // Once a group was full the probes may have continued past it, so its slots have to stay marked as deleted.
+            // While it still has an empty slot it was never full and the slot can be emptied.
+            const size_type groupStart = index & ~(Group::Width - 1);
+            if (Group(m_ctrl + groupStart).MaskEmpty())
+            {
+                m_ctrl[index] = Internal::FlatHash::Empty;
+            }
+            else
+            {
+                m_ctrl[index] = Internal::FlatHash::Deleted;
+                ++m_deleted;
+            }
+        }
+
+        //! Moves the elements to new storage of @newCapacity slots, which drops the deleted slots.
+        void Resize(size_type newCapacity)
+        {
+            ctrl_t* oldCtrl = m_ctrl;
+            slot_type* oldSlots = m_slots;
+            const size_type oldCapacity = m_capacity;
+
+            m_slots = static_cast<slot_type*>(m_allocator.allocate(StorageSize(newCapacity), alignof(slot_type)));
+            m_ctrl = reinterpret_cast<ctrl_t*>(m_slots + newCapacity);
+            m_capacity = newCapacity;
+            m_deleted = 0;
+            ResetCtrl();
+
+            for (size_type oldIndex = 0; oldIndex < oldCapacity; ++oldIndex)
+            {
+                if (Internal::FlatHash::IsFull(oldCtrl[oldIndex]))
+                {
+                    const size_t hash = Internal::FlatHash::MixHash(m_hasher(Traits::key(oldSlots[oldIndex])));
+                    const size_type index = FindFirstNonFull(hash);
+                    m_ctrl[index] = Internal::FlatHash::H2(hash);
+                    AZStd::construct_at(m_slots + index, AZStd::move(oldSlots[oldIndex]));
+                    AZStd::destroy_at(oldSlots + oldIndex);
+                }
+            }
+
+            if (oldCapacity != 0)
+            {
+                m_allocator.deallocate(oldSlots, StorageSize(oldCapacity), alignof(slot_type));
+            }
+        }
+
+        //! The slots and the control bytes, plus the sentinel, share one allocation.
+        static size_type StorageSize(size_type capacity)
+        {
+            return capacity * sizeof(slot_type) + capacity + 1;
+        }
+
+        void ResetCtrl()
+        {
+            memset(m_ctrl, static_cast<AZ::u8>(Internal::FlatHash::Empty), m_capacity);
+            m_ctrl[m_capacity] = Internal::FlatHash::Sentinel;
+        }
+
+        void CopyElements(const flat_hash_table& rhs)
+        {
+            reserve(rhs.m_size);
+            for (const value_type& value : rhs)
+            {
+                const size_t hash = Internal::FlatHash::MixHash(m_hasher(Traits::key(value)));
+                AZStd::construct_at(m_slots + PrepareInsert(hash), value);
+            }
+        }
+
+        void StealStorage(flat_hash_table& rhs)
+        {
+            m_ctrl = rhs.m_ctrl;
+            m_slots = rhs.m_slots;
+            m_capacity = rhs.m_capacity;
+            m_size = rhs.m_size;
+            m_deleted = rhs.m_deleted;
+            rhs.m_ctrl = nullptr;
+            rhs.m_slots = nullptr;
+            rhs.m_capacity = 0;
+            rhs.m_size = 0;
+            rhs.m_deleted = 0;
+        }
+
+        void DestroyStorage()
+        {
+            clear();
+            if (m_capacity != 0)
+            {
+                m_allocator.deallocate(m_slots, StorageSize(m_capacity), alignof(slot_type));
+                m_ctrl = nullptr;
+                m_slots = nullptr;
+                m_capacity = 0;
+            }
+        }
+
+        hasher m_hasher;
+        key_equal m_keyEqual;
+        allocator_type m_allocator;
+        ctrl_t* m_ctrl = nullptr;
+        slot_type* m_slots = nullptr;
+        size_type m_capacity = 0;
+        size_type m_size = 0;
+        size_type m_deleted = 0;
+    };
+} // namespace AZStd
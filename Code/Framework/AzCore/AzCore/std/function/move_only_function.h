@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/createdestroy.h>
+#include <AzCore/std/function/invoke.h>
+#include <AzCore/std/typetraits/typetraits.h>
+#include <AzCore/std/utils.h>
+
+namespace AZStd
+{
+    //! Default inline size of the move_only_function, fits a lambda capturing 4 pointers.
+    inline constexpr size_t move_only_function_default_inline_size = 4 * sizeof(void*);
+
+    template<class Signature, size_t InlineSize = move_only_function_default_inline_size>
+    class move_only_function;
+
+    namespace Internal::MoveOnlyFunction
+    {
+        template<class F, size_t InlineSize>
+        inline constexpr bool IsStoredInline = sizeof(F) <= InlineSize && alignof(F) <= alignof(max_align_t) &&
+            AZStd::is_nothrow_move_constructible_v<F>;
+
+        template<class T>
+        struct IsMoveOnlyFunction : AZStd::false_type {};
+        template<class Signature, size_t InlineSize>
+        struct IsMoveOnlyFunction<move_only_function<Signature, InlineSize>> : AZStd::true_type {};
+    }
+
+    /**
+     * Callable wrapper in the spirit of the C++23 std::move_only_function, with a configurable inline size.
+     * Unlike AZStd::function it doesn't require the callable to be copyable, so it can hold lambdas that capture
+     * move only types, and callables up to InlineSize bytes are stored in the wrapper instead of on the heap.
+     * Larger callables, or the ones that can throw when moved, are allocated with AZStd::allocator.
+     * Use it for callbacks that are stored once and invoked later, e.g. completion callbacks, where the default
+     * 4 pointers of storage avoid the allocation AZStd::function makes for most captures.
+     */
+    template<class R, class... Args, size_t InlineSize>
+    class move_only_function<R(Args...), InlineSize>
+    {
+    public:
+        using result_type = R;
+
+        move_only_function() = default;
+
+        move_only_function(AZStd::nullptr_t)
+        {
+        }
+
+        template<class F, class Functor = AZStd::decay_t<F>,
+            class = AZStd::enable_if_t<!AZStd::is_same_v<Functor, move_only_function> && AZStd::is_invocable_r_v<R, Functor&, Args...>>>
+        move_only_function(F&& functor)
+        {
+            if constexpr (AZStd::is_pointer_v<Functor> || AZStd::is_member_pointer_v<Functor> ||
+                Internal::MoveOnlyFunction::IsMoveOnlyFunction<Functor>::value)
+            {
+                if (!functor)
+                {
+                    return;
+                }
+            }
+            Construct<Functor>(AZStd::forward<F>(functor));
+        }
+
+        move_only_function(move_only_function&& rhs)
+        {
+            MoveFrom(rhs);
+        }
+
+        move_only_function(const move_only_function&) = delete;
+
+        ~move_only_function()
+        {
+            Reset();
+        }
+
+        move_only_function& operator=(move_only_function&& rhs)
+        {
+            if (this != &rhs)
+            {
+                Reset();
+                MoveFrom(rhs);
+            }
+            return *this;
+        }
+
+        move_only_function& operator=(const move_only_function&) = delete;
+
+        move_only_function& operator=(AZStd::nullptr_t)
+        {
+            Reset();
+            return *this;
+        }
+
+        template<class F, class = AZStd::enable_if_t<!AZStd::is_same_v<AZStd::decay_t<F>, move_only_function>>>
+        move_only_function& operator=(F&& functor)
+        {
+            move_only_function(AZStd::forward<F>(functor)).swap(*this);
+            return *this;
+        }
+
+        R operator()(Args... args)
+        {
+            AZ_Assert(m_operations, "Invoking an empty move_only_function");
+            return m_operations->m_invoke(m_storage, AZStd::forward<Args>(args)...);
+        }
+
+        explicit operator bool() const
+        {
+            return m_operations != nullptr;
+        }
+
+        //! AZStd extension, returns true when the callable had to be allocated on the heap.
+        bool is_heap_allocated() const
+        {
+            return m_operations != nullptr && m_operations->m_heapAllocated;
+        }
+
+        void swap(move_only_function& rhs)
+        {
+            move_only_function temp(AZStd::move(rhs));
+            rhs = AZStd::move(*this);
+            *this = AZStd::move(temp);
+        }
+
+        friend bool operator==(const move_only_function& function, AZStd::nullptr_t)
+        {
+            return !function;
+        }
+
+        friend bool operator!=(const move_only_function& function, AZStd::nullptr_t)
+        {
+            return static_cast<bool>(function);
+        }
+
+        friend bool operator==(AZStd::nullptr_t, const move_only_function& function)
+        {
+            return !function;
+        }
+
+        friend bool operator!=(AZStd::nullptr_t, const move_only_function& function)
+        {
+            return static_cast<bool>(function);
+        }
+
+    private:
+        //! Type erased operations of the stored callable, one static instance per callable type.
+        struct Operations
+        {
+            R (*m_invoke)(void* storage, Args&&... args);
+            //! Move constructs the callable of @source into @destination and destroys the one in @source.
+            void (*m_relocate)(void* destination, void* source);
+            void (*m_destroy)(void* storage);
+            bool m_heapAllocated;
+        };
+
+        template<class Functor>
+        struct InlineOperations
+        {
+            static Functor& Get(void* storage)
+            {
+                return *reinterpret_cast<Functor*>(storage);
+            }
+
+            static R Invoke(void* storage, Args&&... args)
+            {
+                return AZStd::invoke(Get(storage), AZStd::forward<Args>(args)...);
+            }
+
+            static void Relocate(void* destination, void* source)
+            {
+                AZStd::construct_at(reinterpret_cast<Functor*>(destination), AZStd::move(Get(source)));
+                AZStd::destroy_at(&Get(source));
+            }
+
+            static void Destroy(void* storage)
+            {
+                AZStd::destroy_at(&Get(storage));
+            }
+
+            static constexpr Operations s_operations{ &Invoke, &Relocate, &Destroy, false };
+        };
+
+        //! The storage holds a pointer to the allocated callable, relocating only copies the pointer.
+        template<class Functor>
+        struct HeapOperations
+        {
+            static Functor*& Get(void* storage)
+            {
+                return *reinterpret_cast<Functor**>(storage);
+            }
+
+            static R Invoke(void* storage, Args&&... args)
+            {
+                return AZStd::invoke(*Get(storage), AZStd::forward<Args>(args)...);
+            }
+
+            static void Relocate(void* destination, void* source)
+            {
+                *reinterpret_cast<Functor**>(destination) = Get(source);
+            }
+
+            static void Destroy(void* storage)
+            {
+                Functor* functor = Get(storage);
+                AZStd::destroy_at(functor);
+                AZStd::allocator allocator;
+                allocator.deallocate(functor, sizeof(Functor), alignof(Functor));
+            }
+
+            static constexpr Operations s_operations{ &Invoke, &Relocate, &Destroy, true };
+        };
+
+        template<class Functor, class F>
+        void Construct(F&& functor)
+        {
+            if constexpr (Internal::MoveOnlyFunction::IsStoredInline<Functor, InlineSize>)
+            {
+                AZStd::construct_at(reinterpret_cast<Functor*>(m_storage), AZStd::forward<F>(functor));
+                m_operations = &InlineOperations<Functor>::s_operations;
+            }
+            else
+            {
+                AZStd::allocator allocator;
+                void* address = allocator.allocate(sizeof(Functor), alignof(Functor));
+                *reinterpret_cast<Functor**>(m_storage) = AZStd::construct_at(static_cast<Functor*>(address), AZStd::forward<F>(functor));
+                m_operations = &HeapOperations<Functor>::s_operations;
+            }
+        }
+
+        void MoveFrom(move_only_function& rhs)
+        {
+            if (rhs.m_operations)
+            {
+                rhs.m_operations->m_relocate(m_storage, rhs.m_storage);
+                m_operations = rhs.m_operations;
+                rhs.m_operations = nullptr;
+            }
+        }
+
+        void Reset()
+        {
+            if (m_operations)
+            {
+                m_operations->m_destroy(m_storage);
+                m_operations = nullptr;
+            }
+        }
+
+        static constexpr size_t StorageSize = InlineSize < sizeof(void*) ? sizeof(void*) : InlineSize;
+
+        const Operations* m_operations = nullptr;
+        alignas(max_align_t) unsigned char m_storage[StorageSize];
+    };
+
+    template<class Signature, size_t InlineSize>
+    void swap(move_only_function<Signature, InlineSize>& lhs, move_only_function<Signature, InlineSize>& rhs)
+    {
+        lhs.swap(rhs);
+    }
+} // namespace AZStd
@@ -1043,20 +1043,90 @@ namespace AZStd
         }
     }
 
-    /// For string hashing we are using FNV-1a algorithm 64 bit version.
+    namespace StringInternal
+    {
+        constexpr uint64_t hash_rotate_left(uint64_t value, int shift)
+        {
+            return (value << shift) | (value >> (64 - shift));
+        }
+
+        //! Mixes a block of 8 bytes in the hash, like the body of MurmurHash3
+        constexpr uint64_t hash_mix(uint64_t hash, uint64_t block)
+        {
+            block *= 0x87c37b91114253d5ULL;
+            block = hash_rotate_left(block, 31);
+            block *= 0x4cf5ad432745937fULL;
+            hash ^= block;
+            hash = hash_rotate_left(hash, 27);
+            return hash * 5 + 0x52dce729;
+        }
+
+        //! Reads 8 characters of a byte sized string in little endian order
+        template<class RandomAccessIterator>
+        constexpr uint64_t hash_load_block(RandomAccessIterator first)
+        {
+            if constexpr (is_pointer_v<RandomAccessIterator>)
+            {
+                if (!az_builtin_is_constant_evaluated())
+                {
+                    uint64_t block = 0;
+                    ::memcpy(&block, first, sizeof(block));
+                    return block;
+                }
+            }
+
+            uint64_t block = 0;
+            for (int i = 0; i < 8; ++i)
+            {
+                block |= static_cast<uint64_t>(static_cast<uint8_t>(first[i])) << (i * 8);
+            }
+            return block;
+        }
+    } // namespace StringInternal
+
+    /// String hashing uses the block mixing and finalizer of MurmurHash3 (64 bit) on 8 characters at a time for byte
+    /// sized characters, and on each character for wider characters.
+    /// The result only depends on the characters, so all the string types give the same hash for the same characters,
+    /// but it isn't stable across engine versions and shouldn't be saved.
     template<class RandomAccessIterator>
     constexpr size_t hash_string(RandomAccessIterator first, size_t length)
     {
-        size_t hash = 14695981039346656037ULL;
-        constexpr size_t fnvPrime = 1099511628211ULL;
+        using element_type = remove_cvref_t<decltype(*first)>;
+        uint64_t hash = 0x9e3779b97f4a7c15ULL;
 
-        const RandomAccessIterator last(first + length);
-        for (; first != last; ++first)
+        size_t index = 0;
+        if constexpr (sizeof(element_type) == 1)
         {
-            hash ^= static_cast<size_t>(*first);
-            hash *= fnvPrime;
+            for (; index + 8 <= length; index += 8)
+            {
+                hash = StringInternal::hash_mix(hash, StringInternal::hash_load_block(first + index));
+            }
+            if (index < length)
+            {
+                uint64_t block = 0;
+                for (int shift = 0; index < length; ++index, shift += 8)
+                {
+                    block |= static_cast<uint64_t>(static_cast<uint8_t>(first[index])) << shift;
+                }
+                hash = StringInternal::hash_mix(hash, block);
+            }
         }
-        return hash;
+        else
+        {
+            for (; index < length; ++index)
+            {
+                hash = StringInternal::hash_mix(hash, static_cast<uint64_t>(first[index]));
+            }
+        }
+
+        // Finalizer of MurmurHash3, so that all the bits of the result depend on all the characters
+        hash ^= length;
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ULL;
+        hash ^= hash >> 33;
+        return static_cast<size_t>(hash);
     }
 
     template<class T>
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MappedFile.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace AZ::IO::Platform
+{
+    bool MapFile(const char* filePath, const AZStd::byte*& data, u64& size)
+    {
+        int fileHandle = open(filePath, O_RDONLY | O_CLOEXEC);
+        if (fileHandle == -1)
+        {
+            return false;
+        }
+
+        struct stat fileInfo;
+        if (fstat(fileHandle, &fileInfo) != 0 || fileInfo.st_size <= 0)
+        {
+            close(fileHandle);
+            return false;
+        }
+
+        // The mapping holds its own reference to the file, so the handle can be closed immediately.
+        void* mapping = mmap(nullptr, static_cast<size_t>(fileInfo.st_size), PROT_READ, MAP_PRIVATE, fileHandle, 0);
+        close(fileHandle);
+        if (mapping == MAP_FAILED)
+        {
+            return false;
+        }
+
+        data = reinterpret_cast<const AZStd::byte*>(mapping);
+        size = static_cast<u64>(fileInfo.st_size);
+        return true;
+    }
+
+    void UnmapFile(const AZStd::byte* data, u64 size)
+    {
+        if (data)
+        {
+            munmap(const_cast<AZStd::byte*>(data), static_cast<size_t>(size));
+        }
+    }
+} // namespace AZ::IO::Platform
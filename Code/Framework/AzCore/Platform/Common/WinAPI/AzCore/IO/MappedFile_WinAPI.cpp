@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MappedFile.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/string/conversions.h>
+
+#include <AzCore/PlatformIncl.h>
+
+namespace AZ::IO::Platform
+{
+    bool MapFile(const char* filePath, const AZStd::byte*& data, u64& size)
+    {
+        AZStd::fixed_wstring<AZ::IO::MaxPathLength> filePathW;
+        AZStd::to_wstring(filePathW, filePath);
+
+        HANDLE fileHandle = CreateFileW(filePathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart <= 0)
+        {
+            CloseHandle(fileHandle);
+            return false;
+        }
+
+        HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(fileHandle);
+        if (mappingHandle == nullptr)
+        {
+            return false;
+        }
+
+        // The view holds its own reference to the mapping object, so both handles can be closed immediately.
+        void* mapping = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mappingHandle);
+        if (mapping == nullptr)
+        {
+            return false;
+        }
+
+        data = reinterpret_cast<const AZStd::byte*>(mapping);
+        size = static_cast<u64>(fileSize.QuadPart);
+        return true;
+    }
+
+    void UnmapFile(const AZStd::byte* data, [[maybe_unused]] u64 size)
+    {
+        if (data)
+        {
+            UnmapViewOfFile(data);
+        }
+    }
+} // namespace AZ::IO::Platform
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/std/string/fixed_string.h>
+
+#include <stdio.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+
+namespace AZ::IO
+{
+    static bool ReadBlockDeviceValue(dev_t device, const char* name, size_t& value)
+    {
+        // Partitions don't have their own queue information, so fall back to the parent device.
+        constexpr const char* parents[] = { "", "../" };
+        for (const char* parent : parents)
+        {
+            auto path = AZStd::fixed_string<128>::format("/sys/dev/block/%u:%u/%squeue/%s", major(device), minor(device), parent, name);
+            if (FILE* file = fopen(path.c_str(), "r"); file != nullptr)
+            {
+                unsigned long result = 0;
+                const bool hasValue = fscanf(file, "%lu", &result) == 1 && result > 0;
+                fclose(file);
+                if (hasValue)
+                {
+                    value = result;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    bool CollectIoHardwareInformation(HardwareInformation& info, [[maybe_unused]] bool includeAllHardware, bool reportHardware)
+    {
+        // The numbers below are based on common defaults from a local hardware survey.
+        info.m_maxPageSize = 4096;
+        info.m_maxTransfer = 512_kib;
+        info.m_maxPhysicalSectorSize = 4096;
+        info.m_maxLogicalSectorSize = 512;
+        info.m_profile = "Generic";
+
+        // Use the device that holds the working directory, which is typically where the assets are read from.
+        struct stat attributes;
+        if (stat(".", &attributes) == 0)
+        {
+            size_t value = 0;
+            if (ReadBlockDeviceValue(attributes.st_dev, "physical_block_size", value))
+            {
+                info.m_maxPhysicalSectorSize = AZStd::max(info.m_maxPhysicalSectorSize, value);
+            }
+            if (ReadBlockDeviceValue(attributes.st_dev, "logical_block_size", value))
+            {
+                info.m_maxLogicalSectorSize = AZStd::max(info.m_maxLogicalSectorSize, value);
+            }
+            if (ReadBlockDeviceValue(attributes.st_dev, "max_sectors_kb", value))
+            {
+                info.m_maxTransfer = value * 1_kib;
+            }
+        }
+
+        if (reportHardware)
+        {
+            AZ_Printf("Streamer", "Storage device: physical sector size %zu, logical sector size %zu, max transfer %zu.\n",
+                info.m_maxPhysicalSectorSize, info.m_maxLogicalSectorSize, info.m_maxTransfer);
+        }
+        return true;
+    }
+
+    void ReflectNative(ReflectContext* context)
+    {
+        LinuxStorageDriveConfig::Reflect(context);
+    }
+} // namespace AZ::IO
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/IO/Streamer/StreamerContext_Linux.h>
+#include <AzCore/std/parallel/thread.h>
+
+#include <errno.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace AZ::Platform
+{
+    StreamerContextThreadSync::StreamerContextThreadSync()
+    {
+        m_event = ::eventfd(0, EFD_CLOEXEC);
+        AZ_Error("StreamerContext", m_event >= 0, "Unable to create the event for the scheduling thread (errno %i).\n", errno);
+    }
+
+    StreamerContextThreadSync::~StreamerContextThreadSync()
+    {
+        if (m_event >= 0)
+        {
+            ::close(m_event);
+        }
+    }
+
+    void StreamerContextThreadSync::Suspend()
+    {
+        if (m_event >= 0)
+        {
+            // Blocks until the counter is non-zero, which happens for queued wake up calls and for io completions if the
+            // event is registered with an io_uring instance. Reading resets the counter.
+            eventfd_t value;
+            while (::eventfd_read(m_event, &value) != 0 && errno == EINTR)
+            {
+            }
+        }
+        else
+        {
+            AZStd::this_thread::yield();
+        }
+    }
+
+    void StreamerContextThreadSync::Resume()
+    {
+        if (m_event >= 0)
+        {
+            ::eventfd_write(m_event, 1);
+        }
+    }
+
+    int StreamerContextThreadSync::GetEventHandle() const
+    {
+        return m_event;
+    }
+} // namespace AZ::Platform
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/base.h>
+
+namespace AZ::Platform
+{
+    class StreamerContextThreadSync
+    {
+    public:
+        StreamerContextThreadSync();
+        ~StreamerContextThreadSync();
+
+        void Suspend();
+        void Resume();
+
+        //! Returns the eventfd the scheduling thread sleeps on, or -1 if it couldn't be created. Registering it with an
+        //! io_uring instance makes completed reads wake up the scheduling thread.
+        int GetEventHandle() const;
+
+    private:
+        int m_event{ -1 };
+    };
+
+} // namespace AZ::Platform
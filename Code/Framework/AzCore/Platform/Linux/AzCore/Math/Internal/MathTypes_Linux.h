@@ -13,6 +13,9 @@
     #include <pmmintrin.h>
     #include <emmintrin.h>
     #include <smmintrin.h>
+    #if AZ_TRAIT_USE_PLATFORM_SIMD_AVX2
+        #include <immintrin.h>
+    #endif
 #elif AZ_TRAIT_USE_PLATFORM_SIMD_NEON
     #include <arm_neon.h>
 #endif
@@ -13,6 +13,12 @@
 #define AZ_TRAIT_USE_PLATFORM_SIMD_SCALAR 0
 #define AZ_TRAIT_USE_PLATFORM_SIMD_NEON 0
 #define AZ_TRAIT_USE_PLATFORM_SIMD_SSE 1
+// AVX2 and FMA are used when the compiler targets them, for instance with -mavx2 -mfma
+#if defined(__AVX2__) && defined(__FMA__)
+#define AZ_TRAIT_USE_PLATFORM_SIMD_AVX2 1
+#else
+#define AZ_TRAIT_USE_PLATFORM_SIMD_AVX2 0
+#endif
 
 // OS traits ...
 #define AZ_TRAIT_OS_ALLOW_MULTICAST 0
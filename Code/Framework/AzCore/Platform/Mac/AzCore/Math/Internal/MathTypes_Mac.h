@@ -13,4 +13,7 @@
 #   include <pmmintrin.h>
 #   include <emmintrin.h>
 #   include <smmintrin.h>
+#   if AZ_TRAIT_USE_PLATFORM_SIMD_AVX2
+#       include <immintrin.h>
+#   endif
 #endif
@@ -13,6 +13,12 @@
 #define AZ_TRAIT_USE_PLATFORM_SIMD_SCALAR 0
 #define AZ_TRAIT_USE_PLATFORM_SIMD_NEON 0
 #define AZ_TRAIT_USE_PLATFORM_SIMD_SSE 1
+// AVX2 and FMA are used when the compiler targets them with /arch:AVX2
+#if defined(__AVX2__)
+#define AZ_TRAIT_USE_PLATFORM_SIMD_AVX2 1
+#else
+#define AZ_TRAIT_USE_PLATFORM_SIMD_AVX2 0
+#endif
 
 // OS traits ...
 #define AZ_TRAIT_OS_ALLOW_MULTICAST 1
@@ -191,6 +191,7 @@ namespace AZ::IO
     {
         AZ_PROFILE_FUNCTION(AzCore);
         AZ_Assert(request, "QueueRequest was provided a null request.");
+        request->RecordTraceStage(m_name.c_str());
 
         AZStd::visit([this, request](auto&& args)
         {
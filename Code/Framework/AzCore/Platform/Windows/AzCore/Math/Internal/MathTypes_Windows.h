@@ -13,4 +13,7 @@
 #   include <xmmintrin.h>
 #   include <pmmintrin.h>
 #   include <emmintrin.h>
+#   if AZ_TRAIT_USE_PLATFORM_SIMD_AVX2
+#       include <immintrin.h>
+#   endif
 #endif
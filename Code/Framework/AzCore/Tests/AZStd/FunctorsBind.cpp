@@ -11,6 +11,8 @@
 #include <AzCore/std/functional.h>
 #include <AzCore/std/delegate/delegate.h>
 #include <AzCore/std/delegate/delegate_bind.h>
+#include <AzCore/std/function/move_only_function.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
 
 #include <AzCore/Memory/SystemAllocator.h>
@@ -1648,4 +1650,51 @@ namespace UnitTest
         constexpr double expectedResult = static_cast<double>(32 + 16 + 128.0 + 512);
         EXPECT_DOUBLE_EQ(expectedResult, result);
     }
+
+    TEST_F(Function, MoveOnlyFunction_MoveOnlyCapture_IsStoredInline)
+    {
+        AZStd::move_only_function<int(int)> function;
+        EXPECT_FALSE(function);
+        EXPECT_TRUE(function == nullptr);
+
+        function = [value = AZStd::make_unique<int>(5)](int add) { return *value + add; };
+        ASSERT_TRUE(function);
+        EXPECT_FALSE(function.is_heap_allocated());
+        EXPECT_EQ(7, function(2));
+
+        AZStd::move_only_function<int(int)> moved(AZStd::move(function));
+        EXPECT_FALSE(function);
+        EXPECT_EQ(8, moved(3));
+
+        moved = nullptr;
+        EXPECT_FALSE(moved);
+    }
+
+    TEST_F(Function, MoveOnlyFunction_LargeCapture_UsesHeapOrLargerInlineSize)
+    {
+        struct LargeFunctor
+        {
+            int operator()() const
+            {
+                return m_values[0] + m_values[63];
+            }
+            int m_values[64] = {};
+        };
+        LargeFunctor functor;
+        functor.m_values[0] = 1;
+        functor.m_values[63] = 2;
+
+        AZStd::move_only_function<int()> heapFunction(functor);
+        EXPECT_TRUE(heapFunction.is_heap_allocated());
+        EXPECT_EQ(3, heapFunction());
+
+        AZStd::move_only_function<int(), sizeof(LargeFunctor)> inlineFunction(functor);
+        EXPECT_FALSE(inlineFunction.is_heap_allocated());
+        EXPECT_EQ(3, inlineFunction());
+
+        AZStd::move_only_function<int()> swapped([]() { return 4; });
+        swapped.swap(heapFunction);
+        EXPECT_EQ(3, swapped());
+        EXPECT_EQ(4, heapFunction());
+    }
 }
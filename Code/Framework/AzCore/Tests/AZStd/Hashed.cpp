@@ -12,6 +12,8 @@
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/fixed_unordered_set.h>
 #include <AzCore/std/containers/fixed_unordered_map.h>
+#include <AzCore/std/containers/flat_hash_map.h>
+#include <AzCore/std/containers/flat_hash_set.h>
 #include <AzCore/std/containers/span.h>
 #include <AzCore/std/ranges/transform_view.h>
 #include <AzCore/std/string/string.h>
@@ -1160,6 +1162,156 @@ namespace UnitTest
         EXPECT_EQ(idx, map.size());
     }
 
+    TEST_F(HashedContainers, FlatHashMapBasic)
+    {
+        AZStd::flat_hash_map<int, int> map;
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(map.begin(), map.end());
+        EXPECT_EQ(map.end(), map.find(1));
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            EXPECT_TRUE(map.emplace(i, i * 2).second);
+        }
+        EXPECT_EQ(1000, map.size());
+        EXPECT_LE(map.load_factor(), map.max_load_factor());
+        EXPECT_FALSE(map.insert(AZStd::make_pair(10, 0)).second);
+        EXPECT_EQ(20, map.at(10));
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            auto iter = map.find(i);
+            ASSERT_NE(map.end(), iter);
+            EXPECT_EQ(i * 2, iter->second);
+        }
+        EXPECT_FALSE(map.contains(1000));
+
+        size_t iterated = 0;
+        for (const auto& item : map)
+        {
+            EXPECT_EQ(item.first * 2, item.second);
+            ++iterated;
+        }
+        EXPECT_EQ(map.size(), iterated);
+
+        map[1000] = 5;
+        EXPECT_EQ(5, map[1000]);
+        EXPECT_EQ(0, map[1001]);
+        EXPECT_FALSE(map.insert_or_assign(1000, 6).second);
+        EXPECT_EQ(6, map.at(1000));
+
+        map.clear();
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(map.begin(), map.end());
+        EXPECT_NE(0, map.capacity());
+    }
+
+    TEST_F(HashedContainers, FlatHashMapEraseAndReinsert_MatchesUnorderedMap)
+    {
+        // Mixes the inserts and erases so that the deleted slots are reused and purged by the rehashes
+        AZStd::flat_hash_map<int, int> map;
+        AZStd::unordered_map<int, int> expected;
+        unsigned int seed = 12345;
+        for (int operation = 0; operation < 20000; ++operation)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const int key = static_cast<int>((seed >> 8) % 512);
+            if ((seed >> 4) & 1)
+            {
+                map[key] = operation;
+                expected[key] = operation;
+            }
+            else
+            {
+                EXPECT_EQ(expected.erase(key), map.erase(key));
+            }
+        }
+
+        ASSERT_EQ(expected.size(), map.size());
+        for (const auto& item : expected)
+        {
+            auto iter = map.find(item.first);
+            ASSERT_NE(map.end(), iter);
+            EXPECT_EQ(item.second, iter->second);
+        }
+    }
+
+    TEST_F(HashedContainers, FlatHashMapEraseWhileIterating_VisitsEveryElement)
+    {
+        AZStd::flat_hash_map<int, int> map;
+        for (int i = 0; i < 100; ++i)
+        {
+            map.emplace(i, i);
+        }
+
+        EXPECT_EQ(50, AZStd::erase_if(map, [](const auto& item) { return item.first % 2 != 0; }));
+        EXPECT_EQ(50, map.size());
+        for (const auto& item : map)
+        {
+            EXPECT_EQ(0, item.first % 2);
+        }
+    }
+
+    TEST_F(HashedContainers, FlatHashMapNonTrivialElements_CopyAndMove)
+    {
+        AZStd::flat_hash_map<AZStd::string, AZStd::string> map;
+        for (int i = 0; i < 64; ++i)
+        {
+            map.try_emplace(AZStd::string::format("key with a heap allocated string %d", i), AZStd::string::format("value %d", i));
+        }
+
+        AZStd::flat_hash_map<AZStd::string, AZStd::string> copy(map);
+        EXPECT_TRUE(map == copy);
+
+        AZStd::flat_hash_map<AZStd::string, AZStd::string> moved(AZStd::move(copy));
+        EXPECT_TRUE(map == moved);
+        EXPECT_TRUE(copy.empty());
+
+        moved.erase("key with a heap allocated string 3");
+        EXPECT_TRUE(map != moved);
+        moved.reserve(1024);
+        EXPECT_EQ(63, moved.size());
+        EXPECT_EQ("value 4", moved.at("key with a heap allocated string 4"));
+    }
+
+    TEST_F(HashedContainers, FlatHashMapTryEmplace_DoesNotMoveValue_OnExistingKey)
+    {
+        AZStd::flat_hash_map<int, AZStd::unique_ptr<int>> testMap;
+        auto testPtr = AZStd::make_unique<int>(5);
+        EXPECT_TRUE(testMap.try_emplace(1, AZStd::move(testPtr)).second);
+        EXPECT_EQ(nullptr, testPtr);
+
+        testPtr = AZStd::make_unique<int>(7000);
+        EXPECT_FALSE(testMap.try_emplace(1, AZStd::move(testPtr)).second);
+        ASSERT_NE(nullptr, testPtr);
+        EXPECT_EQ(5, *testMap.at(1));
+    }
+
+    TEST_F(HashedContainers, FlatHashSetBasic)
+    {
+        AZStd::flat_hash_set<int> set{ 1, 2, 3, 2 };
+        EXPECT_EQ(3, set.size());
+        EXPECT_TRUE(set.contains(2));
+        EXPECT_FALSE(set.contains(4));
+        EXPECT_EQ(1, set.count(3));
+
+        EXPECT_EQ(1, set.erase(2));
+        EXPECT_EQ(0, set.erase(2));
+        EXPECT_FALSE(set.contains(2));
+
+        AZStd::flat_hash_set<int> other{ 3, 1 };
+        EXPECT_TRUE(set == other);
+        other.insert(5);
+        set.swap(other);
+        EXPECT_EQ(3, set.size());
+        EXPECT_EQ(2, other.size());
+
+        set.clear();
+        set.rehash(0);
+        EXPECT_EQ(0, set.capacity());
+        EXPECT_EQ(set.begin(), set.end());
+    }
+
     template<typename ContainerType>
     class HashedSetContainers
         : public LeakDetectionFixture
@@ -2333,6 +2485,30 @@ namespace UnitTest
         Benchmark_Thrash<AZStd::unordered_map>(state);
     }
     BENCHMARK(Benchmark_UnorderedMapThrash);
+
+    void Benchmark_FlatHashMapLookup(benchmark::State& state)
+    {
+        Benchmark_Lookup<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapLookup);
+
+    void Benchmark_FlatHashMapInsert(benchmark::State& state)
+    {
+        Benchmark_Insert<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapInsert);
+
+    void Benchmark_FlatHashMapErase(benchmark::State& state)
+    {
+        Benchmark_Erase<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapErase);
+
+    void Benchmark_FlatHashMapThrash(benchmark::State& state)
+    {
+        Benchmark_Thrash<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapThrash);
 #endif
 } // namespace UnitTest
 
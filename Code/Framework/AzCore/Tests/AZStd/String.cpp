@@ -1225,6 +1225,23 @@ namespace UnitTest
         EXPECT_TRUE(cstr4.empty());
     }
 
+    TEST_F(String, Hash_SameCharacters_SameHashForAllStringTypes)
+    {
+        constexpr AZStd::string_view text = "Some text that is longer than a couple of hash blocks";
+        constexpr size_t compileTimeHash = AZStd::hash<AZStd::string_view>{}(text);
+        EXPECT_EQ(compileTimeHash, AZStd::hash<AZStd::string_view>{}(text));
+        EXPECT_EQ(compileTimeHash, AZStd::hash<AZStd::string>{}(AZStd::string(text)));
+        EXPECT_EQ(compileTimeHash, AZStd::hash<AZStd::fixed_string<64>>{}(AZStd::fixed_string<64>(text)));
+
+        // Every size of the remaining characters after the 8 character blocks
+        for (size_t size = 1; size <= 16; ++size)
+        {
+            const AZStd::string_view prefix = text.substr(0, size);
+            EXPECT_EQ(AZStd::hash<AZStd::string_view>{}(prefix), AZStd::hash<AZStd::string>{}(AZStd::string(prefix)));
+            EXPECT_NE(AZStd::hash<AZStd::string_view>{}(prefix), AZStd::hash<AZStd::string_view>{}(text.substr(1, size)));
+        }
+    }
+
     TEST_F(String, StringViewModifierTest)
     {
         AZStd::string_view emptyView1;
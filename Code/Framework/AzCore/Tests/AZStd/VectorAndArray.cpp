@@ -12,6 +12,7 @@
 #include <AzCore/std/containers/bitset.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/small_vector.h>
 #include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/ranges/subrange.h>
@@ -1177,4 +1178,69 @@ namespace UnitTest
         testVec.append_range(testView | AZStd::views::transform([](const char elem) -> char { return elem + 3; }));
         EXPECT_THAT(testVec, ::testing::ElementsAre('a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i'));
     }
+
+    TEST_F(Arrays, SmallVector_StaysInlineUntilCapacity)
+    {
+        AZStd::small_vector<int, 4> testVec;
+        EXPECT_TRUE(testVec.is_inline());
+        EXPECT_EQ(4, testVec.capacity());
+        for (int i = 0; i < 4; ++i)
+        {
+            testVec.push_back(i);
+        }
+        EXPECT_TRUE(testVec.is_inline());
+
+        testVec.push_back(4);
+        EXPECT_FALSE(testVec.is_inline());
+        EXPECT_GE(testVec.capacity(), 5);
+        EXPECT_THAT(testVec, ::testing::ElementsAre(0, 1, 2, 3, 4));
+
+        testVec.erase(testVec.begin() + 1, testVec.begin() + 3);
+        testVec.shrink_to_fit();
+        EXPECT_TRUE(testVec.is_inline());
+        EXPECT_THAT(testVec, ::testing::ElementsAre(0, 3, 4));
+    }
+
+    TEST_F(Arrays, SmallVector_InsertAndEraseNonTrivialElements_Succeeds)
+    {
+        AZStd::small_vector<AZStd::string, 2> testVec{ "first string that does not fit the small string buffer", "last" };
+        testVec.insert(testVec.begin() + 1, testVec.front());
+        testVec.emplace(testVec.begin(), 3, 'a');
+        testVec.insert(testVec.end(), 2, testVec.back());
+        EXPECT_THAT(testVec, ::testing::ElementsAre("aaa", "first string that does not fit the small string buffer",
+            "first string that does not fit the small string buffer", "last", "last", "last"));
+
+        EXPECT_EQ(3, AZStd::erase(testVec, "last"));
+        testVec.resize(4, "fill");
+        EXPECT_THAT(testVec, ::testing::ElementsAre("aaa", "first string that does not fit the small string buffer",
+            "first string that does not fit the small string buffer", "fill"));
+    }
+
+    TEST_F(Arrays, SmallVector_MoveAndSwap_TransfersElements)
+    {
+        AZStd::small_vector<AZStd::unique_ptr<int>, 2> inlineVec;
+        inlineVec.emplace_back(AZStd::make_unique<int>(1));
+        AZStd::small_vector<AZStd::unique_ptr<int>, 2> heapVec;
+        for (int i = 0; i < 3; ++i)
+        {
+            heapVec.emplace_back(AZStd::make_unique<int>(10 + i));
+        }
+
+        const int* heapData = heapVec.data()->get();
+        AZStd::small_vector<AZStd::unique_ptr<int>, 2> movedHeapVec(AZStd::move(heapVec));
+        EXPECT_TRUE(heapVec.empty());
+        EXPECT_EQ(heapData, movedHeapVec.front().get());
+
+        inlineVec.swap(movedHeapVec);
+        ASSERT_EQ(3, inlineVec.size());
+        ASSERT_EQ(1, movedHeapVec.size());
+        EXPECT_EQ(12, *inlineVec.back());
+        EXPECT_EQ(1, *movedHeapVec.front());
+        EXPECT_TRUE(movedHeapVec.is_inline());
+
+        AZStd::small_vector<AZStd::unique_ptr<int>, 2> copyTarget;
+        copyTarget = AZStd::move(inlineVec);
+        EXPECT_EQ(3, copyTarget.size());
+        EXPECT_TRUE(inlineVec.empty());
+    }
 }
@@ -1720,6 +1720,76 @@ namespace UnitTest
         m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
     }
 
+    // Records the order in which the container queues its dependent assets
+    struct QueueOrderRecordingAssetContainer : AssetContainer
+    {
+        QueueOrderRecordingAssetContainer(Asset<AssetData> assetData, const AssetLoadParameters& loadParams)
+        {
+            // Copying the code in the original constructor, we can't call that constructor because it will not invoke our virtual method
+            m_rootAsset = AssetInternal::WeakAsset<AssetData>(assetData);
+            m_containerAssetId = m_rootAsset.GetId();
+
+            AddDependentAssets(assetData, loadParams);
+        }
+
+        AZStd::vector<AssetId> m_queueOrder;
+
+    protected:
+        AZStd::vector<AZStd::pair<AssetInfo, Asset<AssetData>>> CreateAndQueueDependentAssets(
+            const AZStd::vector<AssetInfo>& dependencyInfoList, const AssetLoadParameters& loadParamsCopyWithNoLoadingFilter) override
+        {
+            auto result = AssetContainer::CreateAndQueueDependentAssets(dependencyInfoList, loadParamsCopyWithNoLoadingFilter);
+            for (const auto& dependency : result)
+            {
+                m_queueOrder.push_back(dependency.second.GetId());
+            }
+            return result;
+        }
+    };
+
+    // Assets at the bottom of a preload chain gate the ready signal of everything above them, so they should be queued first
+#if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    TEST_F(AssetJobsFloodTest, DISABLED_ContainerLoadTest_AssetWithPreLoadChain_QueuesDeepestPreloadsFirst)
+#else
+    TEST_F(AssetJobsFloodTest, ContainerLoadTest_AssetWithPreLoadChain_QueuesDeepestPreloadsFirst)
+#endif // !AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    {
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusConnect();
+        // Setup has already created/destroyed assets
+        m_assetHandlerAndCatalog->m_numCreations = 0;
+        m_assetHandlerAndCatalog->m_numDestructions = 0;
+        {
+            auto asset = m_testAssetManager->FindOrCreateAsset(PreloadAssetRootId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>(), AZ::Data::AssetLoadBehavior::Default);
+            QueueOrderRecordingAssetContainer container(asset, AssetLoadParameters{});
+
+            auto maxTimeout = AZStd::chrono::steady_clock::now() + DefaultTimeoutSeconds;
+            while (!container.IsReady())
+            {
+                m_testAssetManager->DispatchEvents();
+                if (AZStd::chrono::steady_clock::now() > maxTimeout)
+                {
+                    break;
+                }
+                AZStd::this_thread::yield();
+            }
+            EXPECT_TRUE(container.IsReady());
+
+            auto queuePosition = [&container](const AssetId& assetId)
+            {
+                return AZStd::distance(container.m_queueOrder.begin(),
+                    AZStd::find(container.m_queueOrder.begin(), container.m_queueOrder.end(), assetId));
+            };
+            ASSERT_EQ(container.m_queueOrder.size(), 6);
+            // Root <- PreloadA <- PreloadB is the longest preload chain, QueueLoadA <- PreloadC is one level deep
+            EXPECT_LT(queuePosition(PreloadAssetBId), queuePosition(PreloadAssetAId));
+            EXPECT_LT(queuePosition(PreloadAssetAId), queuePosition(QueueLoadAssetAId));
+            EXPECT_LT(queuePosition(PreloadAssetCId), queuePosition(QueueLoadAssetAId));
+        }
+
+        CheckFinishedCreationsAndDestructions();
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
+    }
+
     // If our preload list contains assets we can't load we should catch the errors and load what we can
 #if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
     TEST_F(AssetJobsFloodTest, DISABLED_ContainerLoadTest_RootHasBrokenPreloads_LoadsRoot)
@@ -35,7 +35,7 @@ namespace UnitTest
     */
     AZ::Data::AssetData::AssetStatus TestAssetManager::GetReloadStatus(const AssetId& assetId)
     {
-        AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
+        AZStd::lock_guard<AssetMapMutex> assetLock(m_assetMutex);
 
         auto reloadInfo = m_reloads.find(assetId);
         if (reloadInfo != m_reloads.end())
@@ -12,8 +12,10 @@
 #include <AzCore/Math/Sfmt.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/DenseComponentStorage.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Component/EntityUtils.h>
+#include <AzCore/Component/EntityBatchActivator.h>
 
 #include <AzCore/IO/Streamer/StreamerComponent.h>
 #include <AzCore/Serialization/ObjectStream.h>
@@ -26,6 +28,8 @@
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <AzCore/std/parallel/containers/concurrent_unordered_set.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AZTestShared/Utils/Utils.h>
 #include <AzTest/Utils.h>
 
@@ -1052,6 +1056,135 @@ namespace UnitTest
         EXPECT_EQ(Entity::DependencySortResult::HasIncompatibleServices, m_entity->EvaluateDependencies());
     }
 
+    class ParallelActivationComponent
+        : public Component
+    {
+    public:
+        AZ_COMPONENT(ParallelActivationComponent, "{5B0E9F3A-6C41-4D27-8E1B-2F7A9C3D4E58}");
+
+        static bool SupportsParallelActivation() { return true; }
+
+        void Init() override { ++s_initCount; }
+        void Activate() override { ++s_activateCount; }
+        void Deactivate() override {}
+
+        static void GetProvidedServices(ComponentDescriptor::DependencyArrayType& provided) { provided.push_back(AZ_CRC_CE("ParallelService")); }
+        static void Reflect(ReflectContext* /*reflection*/) {}
+
+        static AZStd::atomic_int s_initCount;
+        static AZStd::atomic_int s_activateCount;
+    };
+    AZStd::atomic_int ParallelActivationComponent::s_initCount{ 0 };
+    AZStd::atomic_int ParallelActivationComponent::s_activateCount{ 0 };
+
+    class TaskGraphActive
+        : public TaskGraphActiveInterface
+    {
+    public:
+        bool IsTaskGraphActive() const override
+        {
+            return true;
+        }
+    };
+
+    TEST_F(ComponentDependency, EntityBatchActivator_ActivateEntities_SortsComponentsLikeActivate)
+    {
+        CreateComponents_ABCDE();
+        m_entity->Init();
+        m_entity->Activate();
+
+        // same component types, created in a different order
+        AZStd::vector<AZStd::unique_ptr<Entity>> entities;
+        for (int i = 0; i < 3; ++i)
+        {
+            Entity* entity = entities.emplace_back(AZStd::make_unique<Entity>()).get();
+            entity->CreateComponent<ComponentE>();
+            entity->CreateComponent<ComponentC>();
+            entity->CreateComponent<ComponentA>();
+            entity->CreateComponent<ComponentD>();
+            entity->CreateComponent<ComponentB>();
+        }
+        AZStd::vector<Entity*> batch;
+        for (const AZStd::unique_ptr<Entity>& entity : entities)
+        {
+            batch.push_back(entity.get());
+        }
+
+        EntityBatchActivator activator;
+        activator.InitEntities(batch);
+        activator.ActivateEntities(batch);
+
+        for (Entity* entity : batch)
+        {
+            EXPECT_EQ(Entity::State::Active, entity->GetState());
+            const Entity::ComponentArrayType& components = entity->GetComponents();
+            ASSERT_EQ(m_entity->GetComponents().size(), components.size());
+            for (size_t i = 0; i < components.size(); ++i)
+            {
+                EXPECT_EQ(azrtti_typeid(m_entity->GetComponents()[i]), azrtti_typeid(components[i]));
+            }
+        }
+    }
+
+    TEST_F(ComponentDependency, EntityBatchActivator_ActivateEntitiesWithMissingRequirements_LeavesEntitiesInitialized)
+    {
+        Entity entity;
+        entity.CreateComponent<ComponentC>(); // requires ServiceB
+
+        Entity* batch[] = { &entity };
+        EntityBatchActivator activator;
+        activator.InitEntities(batch);
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        activator.ActivateEntities(batch);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        EXPECT_EQ(Entity::State::Init, entity.GetState());
+    }
+
+    TEST_F(ComponentDependency, EntityBatchActivator_ComponentsSupportingParallelActivation_AreActivatedOnTaskExecutor)
+    {
+        aznew ParallelActivationComponent::DescriptorType;
+        TaskGraphActive taskGraphActive;
+        TaskExecutor* executor = aznew TaskExecutor(4);
+        TaskExecutor::SetInstance(executor);
+        Interface<TaskGraphActiveInterface>::Register(&taskGraphActive);
+
+        ParallelActivationComponent::s_initCount = 0;
+        ParallelActivationComponent::s_activateCount = 0;
+        constexpr int EntityCount = 50;
+        AZStd::vector<AZStd::unique_ptr<Entity>> entities;
+        AZStd::vector<Entity*> batch;
+        for (int i = 0; i < EntityCount; ++i)
+        {
+            Entity* entity = entities.emplace_back(AZStd::make_unique<Entity>()).get();
+            entity->CreateComponent<ParallelActivationComponent>();
+            batch.push_back(entity);
+        }
+        // entities with components that don't support parallel activation are processed on the calling thread
+        Entity* sequentialEntity = entities.emplace_back(AZStd::make_unique<Entity>()).get();
+        sequentialEntity->CreateComponent<ParallelActivationComponent>();
+        sequentialEntity->CreateComponent<ComponentP>();
+        batch.push_back(sequentialEntity);
+
+        EntityBatchActivator activator;
+        activator.InitEntities(batch);
+        EXPECT_EQ(EntityCount + 1, ParallelActivationComponent::s_initCount);
+        activator.ActivateEntities(batch);
+        EXPECT_EQ(EntityCount + 1, ParallelActivationComponent::s_activateCount);
+        for (Entity* entity : batch)
+        {
+            EXPECT_EQ(Entity::State::Active, entity->GetState());
+        }
+
+        entities.clear();
+        Interface<TaskGraphActiveInterface>::Unregister(&taskGraphActive);
+        if (&TaskExecutor::Instance() == executor)
+        {
+            TaskExecutor::SetInstance(nullptr);
+        }
+        delete executor;
+    }
+
     /**
      * UserSettingsComponent test
      */
@@ -1996,6 +2129,63 @@ namespace UnitTest
             EXPECT_NE(nullptr, specializedDescriptorComponent);
         }
     }
+
+    class DenseTestComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_DENSE_COMPONENT(DenseTestComponent, "{5B0C5E61-91A4-4E39-9B5A-4C1B76A3D0F2}");
+        void Activate() override {}
+        void Deactivate() override {}
+
+        static void Reflect(AZ::ReflectContext*) {}
+
+        int m_value = 0;
+    };
+
+    TEST_F(Components, DenseComponentStorage_CreatedComponents_AreStoredInChunks)
+    {
+        using Storage = AZ::DenseComponentStorage<DenseTestComponent>;
+        AZStd::vector<DenseTestComponent*> components;
+        for (int i = 0; i < 100; ++i)
+        {
+            components.push_back(aznew DenseTestComponent());
+        }
+        EXPECT_EQ(100, Storage::GetCount());
+        EXPECT_EQ(2, Storage::GetChunkCount());
+        // The first chunk is filled in order
+        EXPECT_EQ(components[0] + 1, components[1]);
+
+        Storage::ForEach([](DenseTestComponent& component) { ++component.m_value; });
+        Storage::ParallelForEach([](DenseTestComponent& component) { ++component.m_value; });
+        for (DenseTestComponent* component : components)
+        {
+            EXPECT_EQ(2, component->m_value);
+        }
+
+        // A freed slot is reused before a new chunk is allocated
+        DenseTestComponent* freedSlot = components[10];
+        delete freedSlot;
+        components[10] = aznew DenseTestComponent();
+        EXPECT_EQ(freedSlot, components[10]);
+
+        for (DenseTestComponent* component : components)
+        {
+            delete component;
+        }
+        EXPECT_EQ(0, Storage::GetCount());
+        EXPECT_EQ(0, Storage::GetChunkCount());
+    }
+
+    TEST_F(Components, DenseComponentStorage_ComponentInEntity_IsDeletedWithEntity)
+    {
+        {
+            AZ::Entity entity;
+            entity.CreateComponent<DenseTestComponent>();
+            EXPECT_EQ(1, AZ::DenseComponentStorage<DenseTestComponent>::GetCount());
+        }
+        EXPECT_EQ(0, AZ::DenseComponentStorage<DenseTestComponent>::GetCount());
+    }
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
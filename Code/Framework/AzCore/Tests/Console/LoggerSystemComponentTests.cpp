@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Console/Console.h>
 #include <AzCore/Console/LoggerSystemComponent.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
@@ -160,4 +161,38 @@ namespace UnitTest
         EXPECT_EQ(m_lastLogLevel, AZ::LogLevel::Debug);
         EXPECT_EQ(strcmp("test debug", m_lastLogMessage.c_str()), 0);
     }
+
+    TEST_F(LoggerSystemComponentTests, AsyncLoggingTest)
+    {
+        AZ::Console* console = nullptr;
+        if (!AZ::Interface<AZ::IConsole>::Get())
+        {
+            console = aznew AZ::Console();
+            console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+            AZ::Interface<AZ::IConsole>::Register(console);
+        }
+        AZ::Interface<AZ::IConsole>::Get()->PerformCommand("sys_asyncLogging true");
+
+        // Flush waits for the queued logs to be dispatched
+        AZLOG_INFO("test async info");
+        AZLOG_WARN("test async warn");
+        AZ::Interface<AZ::ILogger>::Get()->Flush();
+        EXPECT_EQ(m_lastLogLevel, AZ::LogLevel::Warn);
+        EXPECT_EQ(strcmp("test async warn", m_lastLogMessage.c_str()), 0);
+
+        // Errors are dispatched immediately, after the queued logs
+        AZLOG_INFO("test async info");
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        AZLOG_ERROR("test async error");
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_EQ(m_lastLogLevel, AZ::LogLevel::Error);
+        EXPECT_EQ(strcmp("test async error", m_lastLogMessage.c_str()), 0);
+
+        AZ::Interface<AZ::IConsole>::Get()->PerformCommand("sys_asyncLogging false");
+        if (console)
+        {
+            AZ::Interface<AZ::IConsole>::Unregister(console);
+            delete console;
+        }
+    }
 }
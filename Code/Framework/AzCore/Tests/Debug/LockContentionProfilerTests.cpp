@@ -0,0 +1,114 @@
+/*
+* Copyright (c) Contributors to the Open 3D Engine Project.
+* For complete copyright and license terms please see the LICENSE at the root of this distribution.
+*
+* SPDX-License-Identifier: Apache-2.0 OR MIT
+*
+*/
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UnitTest/UnitTest.h>
+#include <AzTest/AzTest.h>
+
+#include <AzCore/Debug/LockContentionProfiler.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/parallel/thread.h>
+
+#if AZ_LOCK_CONTENTION_PROFILING
+namespace UnitTest
+{
+    class LockContentionProfilerTest
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_wasEnabled = AZ::Debug::LockContentionProfiler::IsEnabled();
+            AZ::Debug::LockContentionProfiler::SetEnabled(true);
+            AZ::Debug::LockContentionProfiler::ResetStatistics();
+        }
+
+        void TearDown() override
+        {
+            AZ::Debug::LockContentionProfiler::SetEnabled(m_wasEnabled);
+            LeakDetectionFixture::TearDown();
+        }
+
+        static AZ::Debug::LockContentionProfiler::SiteStatistics FindSite(const char* siteName)
+        {
+            AZStd::vector<AZ::Debug::LockContentionProfiler::SiteStatistics> statistics;
+            AZ::Debug::LockContentionProfiler::GetStatistics(statistics);
+            for (const auto& siteStatistics : statistics)
+            {
+                if (siteStatistics.m_name == siteName)
+                {
+                    return siteStatistics;
+                }
+            }
+            return {};
+        }
+
+    private:
+        bool m_wasEnabled = false;
+    };
+
+    TEST_F(LockContentionProfilerTest, ProfiledMutex_UncontendedLocks_CountsAcquires)
+    {
+        AZ::Debug::ProfiledMutex<AZStd::recursive_mutex> mutex{ "LockContentionProfilerTest::Uncontended" };
+        for (int lockIndex = 0; lockIndex < 3; ++lockIndex)
+        {
+            AZStd::scoped_lock outerLock(mutex);
+            AZStd::scoped_lock innerLock(mutex);
+        }
+
+        const auto siteStatistics = FindSite("LockContentionProfilerTest::Uncontended");
+        EXPECT_EQ(6, siteStatistics.m_acquireCount);
+        EXPECT_EQ(0, siteStatistics.m_contendedCount);
+        EXPECT_DOUBLE_EQ(0.0, siteStatistics.m_waitTimeMs);
+    }
+
+    TEST_F(LockContentionProfilerTest, ProfiledMutex_LockHeldByOtherThread_CountsContendedWait)
+    {
+        AZ::Debug::ProfiledMutex<AZStd::shared_mutex> mutex{ "LockContentionProfilerTest::Contended" };
+        AZStd::atomic_bool locked{ false };
+
+        AZStd::thread holder(
+            [&mutex, &locked]()
+            {
+                AZStd::scoped_lock lock(mutex);
+                locked = true;
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(20));
+            });
+        while (!locked)
+        {
+            AZStd::this_thread::yield();
+        }
+
+        {
+            AZStd::shared_lock lock(mutex);
+        }
+        holder.join();
+
+        const auto siteStatistics = FindSite("LockContentionProfilerTest::Contended");
+        EXPECT_EQ(2, siteStatistics.m_acquireCount);
+        EXPECT_EQ(1, siteStatistics.m_contendedCount);
+        EXPECT_GT(siteStatistics.m_waitTimeMs, 0.0);
+        EXPECT_GT(siteStatistics.m_holdTimeMs, 0.0);
+    }
+
+    TEST_F(LockContentionProfilerTest, ProfilingDisabled_LocksAreNotCounted)
+    {
+        AZ::Debug::LockContentionProfiler::SetEnabled(false);
+        AZ::Debug::ProfiledMutex<AZStd::mutex> mutex{ "LockContentionProfilerTest::Disabled" };
+        {
+            AZStd::scoped_lock lock(mutex);
+        }
+
+        EXPECT_EQ(0, FindSite("LockContentionProfilerTest::Disabled").m_acquireCount);
+    }
+} // namespace UnitTest
+#endif // AZ_LOCK_CONTENTION_PROFILING
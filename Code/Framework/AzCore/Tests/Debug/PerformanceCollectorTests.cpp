@@ -10,6 +10,7 @@
 #include <AzTest/AzTest.h>
 
 #include <AzCore/Debug/PerformanceCollector.h>
+#include <AzCore/Debug/PerformanceMetricsExporter.h>
 #include <AzCore/JSON/document.h>
 #include <AzCore/std/ranges/ranges_algorithm.h>
 
@@ -96,6 +97,9 @@ namespace UnitTest
             ASSERT_TRUE(argsObj.HasMember(AZ::Debug::PerformanceCollector::MAX.data()));
             ASSERT_TRUE(argsObj.HasMember(AZ::Debug::PerformanceCollector::STDEV.data()));
             ASSERT_TRUE(argsObj.HasMember(AZ::Debug::PerformanceCollector::SAMPLE_COUNT.data()));
+            ASSERT_TRUE(argsObj.HasMember(AZ::Debug::PerformanceCollector::P50.data()));
+            ASSERT_TRUE(argsObj.HasMember(AZ::Debug::PerformanceCollector::P99.data()));
+            ASSERT_TRUE(argsObj.HasMember(AZ::Debug::PerformanceCollector::P999.data()));
 
             auto sampleCount = argsObj[AZ::Debug::PerformanceCollector::SAMPLE_COUNT.data()].GetUint();
             if (paramName == PerfParam1)
@@ -214,4 +218,33 @@ namespace UnitTest
         ASSERT_EQ(testFileExtention, actualExtension);
     }
 
+    TEST_F(PerformanceCollectorTest, CreatePerformanceCollector_RecordSamples_ExportsPrometheusHistograms)
+    {
+        auto paramList = AZStd::to_array<AZStd::string_view>({ "frame time" });
+        auto onCompleteCallback = [](AZ::u32)
+        {
+        };
+
+        AZ::Debug::PerformanceCollector performanceCollector("PerformanceCollectorTest", paramList, onCompleteCallback);
+        for (AZ::u32 sample = 1; sample <= 100; ++sample)
+        {
+            performanceCollector.RecordSample("frame time", AZStd::chrono::microseconds(sample * 100));
+        }
+
+        const AZ::Statistics::LatencyHistogram* histogram = performanceCollector.GetLatencyHistogram("frame time");
+        ASSERT_NE(histogram, nullptr);
+        EXPECT_EQ(histogram->GetTotalCount(), 100);
+        EXPECT_EQ(performanceCollector.GetLatencyHistogram("unknown"), nullptr);
+
+        AZStd::string output;
+        AZ::Debug::PrometheusTextExporter exporter(output);
+        performanceCollector.ExportHistograms(exporter);
+
+        EXPECT_NE(output.find("# TYPE o3de_PerformanceCollectorTest_frame_time_us summary"), AZStd::string::npos);
+        EXPECT_NE(output.find("o3de_PerformanceCollectorTest_frame_time_us{quantile=\"0.99\"}"), AZStd::string::npos);
+        EXPECT_NE(output.find("o3de_PerformanceCollectorTest_frame_time_us_count 100"), AZStd::string::npos);
+        EXPECT_NE(output.find("o3de_PerformanceCollectorTest_frame_time_us_buckets_bucket{le=\"+Inf\"} 100"), AZStd::string::npos);
+        EXPECT_NE(output.find("o3de_PerformanceCollectorTest_frame_time_us_buckets_bucket{le=\"16384\"} 100"), AZStd::string::npos);
+    }
+
 }//namespace UnitTest
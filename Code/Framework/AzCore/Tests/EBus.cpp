@@ -6,8 +6,10 @@
  *
  */
 
+#include <AzCore/EBus/DispatchStatistics.h>
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/EBus/Results.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/parallel/mutex.h>
@@ -2204,6 +2206,106 @@ namespace UnitTest
             unsigned int m_numCalls;
         };
     }
+#if AZ_EBUS_DISPATCH_STATISTICS
+    class DispatchStatisticsInterface
+        : public AZ::EBusTraits
+    {
+    public:
+        virtual void OnDispatch() = 0;
+    };
+
+    using DispatchStatisticsBus = AZ::EBus<DispatchStatisticsInterface>;
+
+    class DispatchStatisticsHandler
+        : public DispatchStatisticsBus::Handler
+    {
+    public:
+        void OnDispatch() override
+        {
+            ++m_dispatchCount;
+        }
+
+        int m_dispatchCount = 0;
+    };
+
+    TEST_F(EBus, DispatchStatistics_BroadcastToTwoHandlers_CountsDispatchesAndHandlerCalls)
+    {
+        DispatchStatisticsHandler handler1;
+        DispatchStatisticsHandler handler2;
+        handler1.BusConnect();
+        handler2.BusConnect();
+
+        AZ::EBusDispatchStatistics::SetEnabled(true);
+        constexpr int BroadcastCount = 5;
+        for (int broadcastIndex = 0; broadcastIndex < BroadcastCount; ++broadcastIndex)
+        {
+            DispatchStatisticsBus::Broadcast(&DispatchStatisticsInterface::OnDispatch);
+        }
+        AZ::EBusDispatchStatistics::EndFrame();
+
+        AZStd::vector<AZ::EBusDispatchStatistics::BusStatistics> statistics;
+        AZ::EBusDispatchStatistics::GetLastFrameStatistics(statistics);
+        AZ::EBusDispatchStatistics::SetEnabled(false);
+
+        auto busIt = AZStd::find_if(statistics.begin(), statistics.end(),
+            [](const AZ::EBusDispatchStatistics::BusStatistics& busStatistics)
+            {
+                return busStatistics.m_busName.ends_with("DispatchStatisticsInterface");
+            });
+        ASSERT_NE(statistics.end(), busIt);
+        EXPECT_EQ(BroadcastCount, busIt->m_dispatchCount);
+        EXPECT_EQ(2 * BroadcastCount, busIt->m_handlerCallCount);
+        EXPECT_GE(busIt->m_dispatchTimeMs, busIt->m_lockWaitTimeMs);
+        EXPECT_EQ(BroadcastCount, handler1.m_dispatchCount);
+        EXPECT_EQ(BroadcastCount, handler2.m_dispatchCount);
+
+        handler1.BusDisconnect();
+        handler2.BusDisconnect();
+    }
+
+    TEST_F(EBus, DispatchStatistics_Disabled_DoesNotCount)
+    {
+        DispatchStatisticsHandler handler;
+        handler.BusConnect();
+        DispatchStatisticsBus::Broadcast(&DispatchStatisticsInterface::OnDispatch);
+
+        AZ::EBusDispatchStatistics::SetEnabled(true);
+        AZ::EBusDispatchStatistics::EndFrame();
+        AZStd::vector<AZ::EBusDispatchStatistics::BusStatistics> statistics;
+        AZ::EBusDispatchStatistics::GetLastFrameStatistics(statistics);
+        AZ::EBusDispatchStatistics::SetEnabled(false);
+
+        EXPECT_TRUE(AZStd::none_of(statistics.begin(), statistics.end(),
+            [](const AZ::EBusDispatchStatistics::BusStatistics& busStatistics)
+            {
+                return busStatistics.m_busName.ends_with("DispatchStatisticsInterface");
+            }));
+
+        handler.BusDisconnect();
+    }
+
+    TEST_F(EBus, DispatchStatistics_SetEnabled_UpdatesIsEnabled)
+    {
+        EXPECT_FALSE(AZ::EBusDispatchStatistics::IsEnabled());
+        AZ::EBusDispatchStatistics::SetEnabled(true);
+        EXPECT_TRUE(AZ::EBusDispatchStatistics::IsEnabled());
+        AZ::EBusDispatchStatistics::SetEnabled(false);
+        EXPECT_FALSE(AZ::EBusDispatchStatistics::IsEnabled());
+    }
+#endif // AZ_EBUS_DISPATCH_STATISTICS
+
+    TEST_F(EBus, DispatchStatistics_GetBusNameFromSignature_ExtractsInterfaceName)
+    {
+        EXPECT_EQ("AZ::TickEvents", AZ::EBusDispatchStatistics::GetBusNameFromSignature(
+            "static const char *AZ::EBus<AZ::TickEvents>::GetName() [Interface = AZ::TickEvents, Traits = AZ::TickEvents]"));
+        EXPECT_EQ("AZ::TickEvents", AZ::EBusDispatchStatistics::GetBusNameFromSignature(
+            "static const char* AZ::EBus<Interface, Traits>::GetName() [with Interface = AZ::TickEvents; Traits = AZ::TickEvents]"));
+        EXPECT_EQ("AZ::TickEvents", AZ::EBusDispatchStatistics::GetBusNameFromSignature(
+            "const char *__cdecl AZ::EBus<class AZ::TickEvents,class AZ::TickEvents>::GetName(void)"));
+        EXPECT_EQ("Foo<int, float>", AZ::EBusDispatchStatistics::GetBusNameFromSignature(
+            "const char *__cdecl AZ::EBus<class Foo<int, float>,struct Bar>::GetName(void)"));
+    }
+
     TEST_F(EBus, MultiHandler)
     {
         using namespace MultiHandlerTest;
@@ -4299,6 +4401,65 @@ namespace UnitTest
             &ReentrantEBusUseTestRequestBus::Events::EventCallsOtherEventOnDifferentEBusId, secondBusId);
     }
 
+    class CachedHandlerRequests
+        : public AZ::EBusTraits
+    {
+    public:
+        AZ_RTTI(CachedHandlerRequests, "{8E7FAC6B-D20B-438F-92ED-724484BE08FC}");
+
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+        static constexpr bool EnableHandlerCache = true;
+        using MutexType = AZStd::recursive_mutex;
+
+        virtual ~CachedHandlerRequests() = default;
+
+        virtual int OnEvent() = 0;
+    };
+    using CachedHandlerRequestBus = AZ::EBus<CachedHandlerRequests>;
+
+    // Handler that is reachable through the cached handler of the bus and through AZ::Interface
+    class CachedHandlerImpl
+        : public CachedHandlerRequestBus::Handler
+    {
+    public:
+        CachedHandlerImpl()
+        {
+            CachedHandlerRequestBus::Handler::BusConnect();
+            AZ::Interface<CachedHandlerRequests>::Register(this);
+        }
+
+        ~CachedHandlerImpl() override
+        {
+            AZ::Interface<CachedHandlerRequests>::Unregister(this);
+            CachedHandlerRequestBus::Handler::BusDisconnect();
+        }
+
+        // Doesn't modify the handler, so that the multithreaded benchmarks can call it without locking
+        int OnEvent() override
+        {
+            return EventResult;
+        }
+
+        static constexpr int EventResult = 42;
+    };
+
+    TEST_F(EBus, GetCachedHandler_FollowsHandlerConnection)
+    {
+        EXPECT_EQ(nullptr, CachedHandlerRequestBus::GetCachedHandler());
+        {
+            CachedHandlerImpl handler;
+            EXPECT_EQ(&handler, CachedHandlerRequestBus::GetCachedHandler());
+            EXPECT_EQ(CachedHandlerImpl::EventResult, CachedHandlerRequestBus::GetCachedHandler()->OnEvent());
+
+            handler.BusDisconnect();
+            EXPECT_EQ(nullptr, CachedHandlerRequestBus::GetCachedHandler());
+
+            handler.BusConnect();
+            EXPECT_EQ(&handler, CachedHandlerRequestBus::GetCachedHandler());
+        }
+        EXPECT_EQ(nullptr, CachedHandlerRequestBus::GetCachedHandler());
+    }
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -4640,6 +4801,63 @@ namespace Benchmark
     }
     BUS_BENCHMARK_REGISTER_ID(BM_EBus_EventCachedResult);
 
+    //////////////////////////////////////////////////////////////////////////
+    // Cached Handler
+    //////////////////////////////////////////////////////////////////////////
+
+    // Compares calling the handler of a bus with EnableHandlerCache through a Broadcast, through the cached
+    // handler, and through AZ::Interface
+    template <typename CallHandler>
+    static void CachedHandlerBenchmark(::benchmark::State& state, CallHandler&& callHandler)
+    {
+        AZStd::unique_ptr<UnitTest::CachedHandlerImpl> handler;
+        if (state.thread_index() == 0)
+        {
+            handler = AZStd::make_unique<UnitTest::CachedHandlerImpl>();
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ::benchmark::DoNotOptimize(callHandler());
+        }
+
+        if (state.thread_index() == 0)
+        {
+            handler.reset();
+        }
+    }
+
+    static void BM_EBus_CachedHandler_BroadcastResult(::benchmark::State& state)
+    {
+        CachedHandlerBenchmark(state, []()
+        {
+            int result = 0;
+            UnitTest::CachedHandlerRequestBus::BroadcastResult(result, &UnitTest::CachedHandlerRequests::OnEvent);
+            return result;
+        });
+    }
+    BENCHMARK(BM_EBus_CachedHandler_BroadcastResult)->Apply(&BenchmarkSettings::Common)->Apply(&BenchmarkSettings::Multithreaded);
+
+    static void BM_EBus_CachedHandler_GetCachedHandler(::benchmark::State& state)
+    {
+        CachedHandlerBenchmark(state, []()
+        {
+            UnitTest::CachedHandlerRequests* handler = UnitTest::CachedHandlerRequestBus::GetCachedHandler();
+            return handler ? handler->OnEvent() : 0;
+        });
+    }
+    BENCHMARK(BM_EBus_CachedHandler_GetCachedHandler)->Apply(&BenchmarkSettings::Common)->Apply(&BenchmarkSettings::Multithreaded);
+
+    static void BM_EBus_CachedHandler_Interface(::benchmark::State& state)
+    {
+        CachedHandlerBenchmark(state, []()
+        {
+            UnitTest::CachedHandlerRequests* handler = AZ::Interface<UnitTest::CachedHandlerRequests>::Get();
+            return handler ? handler->OnEvent() : 0;
+        });
+    }
+    BENCHMARK(BM_EBus_CachedHandler_Interface)->Apply(&BenchmarkSettings::Common)->Apply(&BenchmarkSettings::Multithreaded);
+
     //////////////////////////////////////////////////////////////////////////
     // Broadcast/Event Queuing
     //////////////////////////////////////////////////////////////////////////
@@ -134,6 +134,26 @@ TEST_F(GenericStreamTest, MemoryStreamWriteFromStream_MoreBytesThanTempBuffer_Co
     TestMemoryStreamWriteFromStream(aznumeric_cast<size_t>(AZ::IO::GenericStream::StreamToStreamCopyBufferSize * 2.6f));
 }
 
+TEST_F(GenericStreamTest, MemoryStreamReadInPlace_ReturnsPointerIntoBuffer)
+{
+    constexpr AZStd::string_view testData = "ReadInPlace test data";
+    AZ::IO::MemoryStream memoryStream(testData.data(), testData.size());
+
+    EXPECT_EQ(testData.data(), memoryStream.ReadInPlace(4));
+    EXPECT_EQ(4, memoryStream.GetCurPos());
+    EXPECT_EQ(testData.data() + 4, memoryStream.ReadInPlace(testData.size() - 4));
+    EXPECT_EQ(testData.size(), memoryStream.GetCurPos());
+
+    // Reading past the end fails without moving the read position
+    EXPECT_EQ(nullptr, memoryStream.ReadInPlace(1));
+    EXPECT_EQ(testData.size(), memoryStream.GetCurPos());
+}
+
+TEST_F(GenericStreamTest, GenericStreamReadInPlace_NotMemoryBacked_ReturnsNull)
+{
+    EXPECT_EQ(nullptr, m_mockGenericStream.ReadInPlace(1));
+}
+
 namespace AZ::IO::Test
 {
     class ByteContainerStreamTest
@@ -27,6 +27,8 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Memory/PoolAllocator.h>
 
+#include <AzCore/Task/TaskExecutor.h>
+
 #include <AzCore/std/time.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/UnitTest/TestTypes.h>
@@ -1549,6 +1551,66 @@ namespace UnitTest
     {
         RunTest();
     }
+
+    // Runs jobs on the worker threads of a TaskExecutor instead of threads owned by the JobManager
+    class TaskExecutorJobManagerSetupFixture
+        : public LeakDetectionFixture
+    {
+    protected:
+        TaskExecutor* m_taskExecutor = nullptr;
+        JobManager* m_jobManager = nullptr;
+        JobContext* m_jobContext = nullptr;
+
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            m_taskExecutor = aznew TaskExecutor(4);
+
+            JobManagerDesc desc;
+            desc.m_taskExecutor = m_taskExecutor;
+            m_jobManager = aznew JobManager(desc);
+            m_jobContext = aznew JobContext(*m_jobManager);
+        }
+
+        void TearDown() override
+        {
+            delete m_jobContext;
+            delete m_jobManager;
+            azdestroy(m_taskExecutor);
+
+            LeakDetectionFixture::TearDown();
+        }
+    };
+
+    TEST_F(TaskExecutorJobManagerSetupFixture, SharedWorkers_ReportExecutorWorkerCount)
+    {
+        EXPECT_TRUE(m_jobManager->IsAsynchronous());
+        EXPECT_EQ(m_taskExecutor->GetWorkerCount(), m_jobManager->GetNumWorkerThreads());
+    }
+
+    TEST_F(TaskExecutorJobManagerSetupFixture, SharedWorkers_ContinuationJobs)
+    {
+        int result = 0;
+        Job* job = aznew FibonacciJobFork(g_fibonacciFast, &result, m_jobContext);
+        JobCompletion doneJob(m_jobContext);
+        job->SetDependent(&doneJob);
+        job->Start();
+        doneJob.StartAndWaitForCompletion();
+        EXPECT_EQ(g_fibonacciFastResult, result);
+    }
+
+    TEST_F(TaskExecutorJobManagerSetupFixture, SharedWorkers_ChildJobsWaitedOnInsideJobs)
+    {
+        int result = 0;
+        Job* job = aznew FibonacciJob2(g_fibonacciFast, &result, m_jobContext);
+        JobCompletion doneJob(m_jobContext);
+        job->SetDependent(&doneJob);
+        job->Start();
+        doneJob.StartAndWaitForCompletion();
+        EXPECT_EQ(g_fibonacciFastResult, result);
+    }
 } // UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -8,6 +8,7 @@
 
 #include <AzCore/Math/Crc.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 
@@ -61,6 +62,51 @@ namespace Benchmark
     }
 
     BENCHMARK(MeasureCrc32ConstevalTime);
+
+    //! Mixed case text of the size given by the benchmark argument
+    static AZStd::vector<char> CreateTestText(::benchmark::State& state)
+    {
+        AZStd::vector<char> text(static_cast<size_t>(state.range(0)));
+        for (size_t i = 0; i < text.size(); ++i)
+        {
+            text[i] = static_cast<char>((i % 2 ? 'a' : 'A') + i % 26);
+        }
+        return text;
+    }
+
+    static void MeasureCrc32Runtime(::benchmark::State& state)
+    {
+        AZStd::vector<char> text = CreateTestText(state);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(AZ::Crc32(AZStd::string_view(text.data(), text.size())));
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+
+    static void MeasureCrc32CRuntime(::benchmark::State& state)
+    {
+        AZStd::vector<char> text = CreateTestText(state);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(AZ::CalculateCrc32C(text.data(), text.size()));
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+
+    static void MeasureStringHashRuntime(::benchmark::State& state)
+    {
+        AZStd::vector<char> text = CreateTestText(state);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(AZStd::hash<AZStd::string_view>{}(AZStd::string_view(text.data(), text.size())));
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK(MeasureCrc32Runtime)->RangeMultiplier(4)->Range(8, 8 << 10);
+    BENCHMARK(MeasureCrc32CRuntime)->RangeMultiplier(4)->Range(8, 8 << 10);
+    BENCHMARK(MeasureStringHashRuntime)->RangeMultiplier(4)->Range(8, 8 << 10);
 }
 
 #endif
@@ -118,4 +164,51 @@ namespace UnitTest
         EXPECT_EQ(AZ::Crc32(0x4727dc92), constEvalIntValue);
     }
 
+    TEST_F(Crc32Fixture, RuntimeCrc32_MatchesCompileTimeCrc32)
+    {
+        static constexpr AZStd::string_view text = "The Quick Brown Fox Jumps Over The Lazy Dog \xC0\xDA_[@]`{";
+        constexpr auto CompileTimeCrcs = [](AZStd::string_view view, bool forceLowerCase) constexpr
+        {
+            AZStd::array<AZ::u32, text.size() + 1> crcs{};
+            for (size_t size = 0; size <= view.size(); ++size)
+            {
+                crcs[size] = AZ::Crc32(view.data(), size, forceLowerCase);
+            }
+            return crcs;
+        };
+        constexpr auto lowerCaseCrcs = CompileTimeCrcs(text, true);
+        constexpr auto crcs = CompileTimeCrcs(text, false);
+
+        // Covers every size and alignment of the blocks processed at runtime
+        for (size_t size = 0; size <= text.size(); ++size)
+        {
+            const void* data = text.data();
+            EXPECT_EQ(lowerCaseCrcs[size], static_cast<AZ::u32>(AZ::Crc32(data, size, true)));
+            EXPECT_EQ(crcs[size], static_cast<AZ::u32>(AZ::Crc32(data, size, false)));
+        }
+        EXPECT_EQ(AZ::Crc32(0xf44f1a1d), AZ::Crc32(AZStd::string_view("EditorData")));
+    }
+
+    TEST_F(Crc32Fixture, CalculateCrc32C_MatchesCheckValue)
+    {
+        // Standard check value of CRC-32C
+        EXPECT_EQ(0xe3069283, AZ::CalculateCrc32C("123456789", 9));
+        EXPECT_EQ(0u, AZ::CalculateCrc32C(nullptr, 0));
+    }
+
+    TEST_F(Crc32Fixture, CalculateCrc32C_InBlocks_MatchesSingleBlock)
+    {
+        AZStd::array<uint8_t, 100> data;
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<uint8_t>(i * 37 + 11);
+        }
+
+        const AZ::u32 expected = AZ::CalculateCrc32C(data.data(), data.size());
+        for (size_t split = 0; split <= data.size(); split += 7)
+        {
+            const AZ::u32 first = AZ::CalculateCrc32C(data.data(), split);
+            EXPECT_EQ(expected, AZ::CalculateCrc32C(data.data() + split, data.size() - split, first));
+        }
+    }
 }
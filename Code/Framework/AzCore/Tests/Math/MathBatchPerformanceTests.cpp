@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Math/MathBatch.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <random>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Compares the batch kernels with the per-object functions they replace
+    class BM_MathBatch
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+        void internalSetUp()
+        {
+            const unsigned int seed = 1;
+            std::mt19937_64 rng(seed);
+            std::uniform_real_distribution<float> distFloat(-1.0f, 1.0f);
+            auto randomVector3 = [&distFloat, &rng](float scale)
+            {
+                return AZ::Vector3(distFloat(rng), distFloat(rng), distFloat(rng)) * scale;
+            };
+            auto randomQuaternion = [&distFloat, &rng]()
+            {
+                return AZ::Quaternion(distFloat(rng), distFloat(rng), distFloat(rng), distFloat(rng)).GetNormalized();
+            };
+
+            m_transform = AZ::Transform(randomVector3(10.0f), randomQuaternion(), 1.5f);
+            m_matrix = AZ::Matrix3x4::CreateFromTransform(m_transform);
+            m_frustum = AZ::Frustum(AZ::ViewFrustumAttributes(AZ::Transform::CreateIdentity(), 1.0f, AZ::Constants::HalfPi, 1.0f, 100.0f));
+
+            m_points.resize(Count);
+            m_lhsTransforms.resize(Count);
+            m_rhsTransforms.resize(Count);
+            m_aabbs.resize(Count);
+            m_fromQuaternions.resize(Count);
+            m_toQuaternions.resize(Count);
+            m_pointsSoa.Resize(Count);
+            m_lhsTransformsSoa.Resize(Count);
+            m_rhsTransformsSoa.Resize(Count);
+            m_aabbsSoa.Resize(Count);
+            m_fromQuaternionsSoa.Resize(Count);
+            m_toQuaternionsSoa.Resize(Count);
+            m_intersectResults.resize(Count);
+            for (size_t i = 0; i < Count; ++i)
+            {
+                m_points[i] = randomVector3(10.0f);
+                m_lhsTransforms[i] = AZ::Transform(randomVector3(10.0f), randomQuaternion(), 1.0f);
+                m_rhsTransforms[i] = AZ::Transform(randomVector3(10.0f), randomQuaternion(), 1.0f);
+                const AZ::Vector3 center = randomVector3(100.0f);
+                const AZ::Vector3 halfExtents = randomVector3(5.0f).GetAbs();
+                m_aabbs[i] = AZ::Aabb::CreateFromMinMax(center - halfExtents, center + halfExtents);
+                m_fromQuaternions[i] = randomQuaternion();
+                m_toQuaternions[i] = randomQuaternion();
+
+                m_pointsSoa.Set(i, m_points[i]);
+                m_lhsTransformsSoa.Set(i, m_lhsTransforms[i]);
+                m_rhsTransformsSoa.Set(i, m_rhsTransforms[i]);
+                m_aabbsSoa.Set(i, m_aabbs[i]);
+                m_fromQuaternionsSoa.Set(i, m_fromQuaternions[i]);
+                m_toQuaternionsSoa.Set(i, m_toQuaternions[i]);
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_points = {};
+            m_lhsTransforms = {};
+            m_rhsTransforms = {};
+            m_aabbs = {};
+            m_fromQuaternions = {};
+            m_toQuaternions = {};
+            m_intersectResults = {};
+            m_pointsSoa = {};
+            m_pointsSoaResults = {};
+            m_lhsTransformsSoa = {};
+            m_rhsTransformsSoa = {};
+            m_transformsSoaResults = {};
+            m_aabbsSoa = {};
+            m_fromQuaternionsSoa = {};
+            m_toQuaternionsSoa = {};
+            m_quaternionsSoaResults = {};
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        static constexpr size_t Count = 1000;
+
+        AZ::Transform m_transform;
+        AZ::Matrix3x4 m_matrix;
+        AZ::Frustum m_frustum;
+
+        AZStd::vector<AZ::Vector3> m_points;
+        AZStd::vector<AZ::Transform> m_lhsTransforms;
+        AZStd::vector<AZ::Transform> m_rhsTransforms;
+        AZStd::vector<AZ::Aabb> m_aabbs;
+        AZStd::vector<AZ::Quaternion> m_fromQuaternions;
+        AZStd::vector<AZ::Quaternion> m_toQuaternions;
+        AZStd::vector<AZ::IntersectResult> m_intersectResults;
+
+        AZ::Vector3Soa m_pointsSoa;
+        AZ::Vector3Soa m_pointsSoaResults;
+        AZ::TransformSoa m_lhsTransformsSoa;
+        AZ::TransformSoa m_rhsTransformsSoa;
+        AZ::TransformSoa m_transformsSoaResults;
+        AZ::AabbSoa m_aabbsSoa;
+        AZ::QuaternionSoa m_fromQuaternionsSoa;
+        AZ::QuaternionSoa m_toQuaternionsSoa;
+        AZ::QuaternionSoa m_quaternionsSoaResults;
+    };
+
+    BENCHMARK_F(BM_MathBatch, TransformPointsByTransform_PerObject)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AZ::Vector3& point : m_points)
+            {
+                AZ::Vector3 result = m_transform.TransformPoint(point);
+                benchmark::DoNotOptimize(result);
+            }
+        }
+        state.SetItemsProcessed(Count * state.iterations());
+    }
+
+    BENCHMARK_F(BM_MathBatch, TransformPointsByTransform_Batch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::MathBatch::TransformPoints(m_transform, m_pointsSoa, m_pointsSoaResults);
+            benchmark::DoNotOptimize(m_pointsSoaResults.GetX());
+        }
+        state.SetItemsProcessed(Count * state.iterations());
+    }
+
+    BENCHMARK_F(BM_MathBatch, TransformPointsByMatrix3x4_PerObject)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AZ::Vector3& point : m_points)
+            {
+                AZ::Vector3 result = m_matrix.TransformPoint(point);
+                benchmark::DoNotOptimize(result);
+            }
+        }
+        state.SetItemsProcessed(Count * state.iterations());
+    }
+
+    BENCHMARK_F(BM_MathBatch, TransformPointsByMatrix3x4_Batch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::MathBatch::TransformPoints(m_matrix, m_pointsSoa, m_pointsSoaResults);
+            benchmark::DoNotOptimize(m_pointsSoaResults.GetX());
+        }
+        state.SetItemsProcessed(Count * state.iterations());
+    }
+
+    BENCHMARK_F(BM_MathBatch, ComposeTransforms_PerObject)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < Count; ++i)
+            {
+                AZ::Transform result = m_lhsTransforms[i] * m_rhsTransforms[i];
+                benchmark::DoNotOptimize(result);
+            }
+        }
+        state.SetItemsProcessed(Count * state.iterations());
+    }
+
+    BENCHMARK_F(BM_MathBatch, ComposeTransforms_Batch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::MathBatch::ComposeTransforms(m_lhsTransformsSoa, m_rhsTransformsSoa, m_transformsSoaResults);
+            benchmark::DoNotOptimize(m_transformsSoaResults.GetScales());
+        }
+        state.SetItemsProcessed(Count * state.iterations());
+    }
+
+    BENCHMARK_F(BM_MathBatch, IntersectAabbs_PerObject)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < Count; ++i)
+            {
+                m_intersectResults[i] = m_frustum.IntersectAabb(m_aabbs[i]);
+            }
+            benchmark::DoNotOptimize(m_intersectResults.data());
+        }
+        state.SetItemsProcessed(Count * state.iterations());
+    }
+
+    BENCHMARK_F(BM_MathBatch, IntersectAabbs_Batch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::MathBatch::IntersectAabbs(m_frustum, m_aabbsSoa, m_intersectResults);
+            benchmark::DoNotOptimize(m_intersectResults.data());
+        }
+        state.SetItemsProcessed(Count * state.iterations());
+    }
+
+    BENCHMARK_F(BM_MathBatch, SlerpQuaternions_PerObject)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < Count; ++i)
+            {
+                AZ::Quaternion result = m_fromQuaternions[i].Slerp(m_toQuaternions[i], 0.3f);
+                benchmark::DoNotOptimize(result);
+            }
+        }
+        state.SetItemsProcessed(Count * state.iterations());
+    }
+
+    BENCHMARK_F(BM_MathBatch, SlerpQuaternions_Batch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::MathBatch::SlerpQuaternions(m_fromQuaternionsSoa, m_toQuaternionsSoa, 0.3f, m_quaternionsSoaResults);
+            benchmark::DoNotOptimize(m_quaternionsSoaResults.GetX());
+        }
+        state.SetItemsProcessed(Count * state.iterations());
+    }
+} // namespace Benchmark
+
+#endif
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathBatch.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
+
+namespace UnitTest
+{
+    class MathBatchFixture
+        : public LeakDetectionFixture
+    {
+    protected:
+        // Not a multiple of the batch width, to cover the padding
+        static constexpr size_t Count = 37;
+
+        float GetRandomFloat(float scale = 1.0f)
+        {
+            return (m_random.GetRandomFloat() * 2.0f - 1.0f) * scale;
+        }
+
+        AZ::Vector3 GetRandomVector3(float scale = 1.0f)
+        {
+            return AZ::Vector3(GetRandomFloat(scale), GetRandomFloat(scale), GetRandomFloat(scale));
+        }
+
+        AZ::Quaternion GetRandomQuaternion()
+        {
+            return AZ::Quaternion(GetRandomFloat(), GetRandomFloat(), GetRandomFloat(), GetRandomFloat()).GetNormalized();
+        }
+
+        AZ::Transform GetRandomTransform()
+        {
+            return AZ::Transform(GetRandomVector3(10.0f), GetRandomQuaternion(), 1.0f + GetRandomFloat(0.5f));
+        }
+
+        AZ::SimpleLcgRandom m_random{ 1234 };
+    };
+
+    TEST_F(MathBatchFixture, Resize_ShrinkThenGrow_NewValuesAreZero)
+    {
+        AZ::Vector3Soa vectors(5);
+        for (size_t i = 0; i < vectors.GetSize(); ++i)
+        {
+            vectors.Set(i, AZ::Vector3(1.0f));
+        }
+        vectors.Resize(2);
+        vectors.Resize(6);
+        EXPECT_EQ(6, vectors.GetSize());
+        EXPECT_THAT(vectors.Get(1), IsClose(AZ::Vector3(1.0f)));
+        EXPECT_THAT(vectors.Get(2), IsClose(AZ::Vector3::CreateZero()));
+        EXPECT_THAT(vectors.Get(5), IsClose(AZ::Vector3::CreateZero()));
+    }
+
+    TEST_F(MathBatchFixture, TransformPoints_Transform_MatchesTransformPoint)
+    {
+        const AZ::Transform transform = GetRandomTransform();
+        AZ::Vector3Soa points(Count);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            points.Set(i, GetRandomVector3(10.0f));
+        }
+
+        AZ::Vector3Soa results;
+        AZ::MathBatch::TransformPoints(transform, points, results);
+
+        ASSERT_EQ(Count, results.GetSize());
+        for (size_t i = 0; i < Count; ++i)
+        {
+            EXPECT_THAT(results.Get(i), IsCloseTolerance(transform.TransformPoint(points.Get(i)), 1e-4f));
+        }
+    }
+
+    TEST_F(MathBatchFixture, TransformPoints_Matrix3x4_MatchesTransformPoint)
+    {
+        const AZ::Matrix3x4 matrix = AZ::Matrix3x4::CreateFromTransform(GetRandomTransform());
+        AZ::Vector3Soa points(Count);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            points.Set(i, GetRandomVector3(10.0f));
+        }
+
+        AZ::Vector3Soa results;
+        AZ::MathBatch::TransformPoints(matrix, points, results);
+
+        ASSERT_EQ(Count, results.GetSize());
+        for (size_t i = 0; i < Count; ++i)
+        {
+            EXPECT_THAT(results.Get(i), IsCloseTolerance(matrix.TransformPoint(points.Get(i)), 1e-4f));
+        }
+    }
+
+    TEST_F(MathBatchFixture, ComposeTransforms_MatchesTransformMultiplication)
+    {
+        AZ::TransformSoa lhs(Count);
+        AZ::TransformSoa rhs(Count);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            lhs.Set(i, GetRandomTransform());
+            rhs.Set(i, GetRandomTransform());
+        }
+
+        AZ::TransformSoa results;
+        AZ::MathBatch::ComposeTransforms(lhs, rhs, results);
+
+        ASSERT_EQ(Count, results.GetSize());
+        for (size_t i = 0; i < Count; ++i)
+        {
+            EXPECT_THAT(results.Get(i), IsCloseTolerance(lhs.Get(i) * rhs.Get(i), 1e-4f));
+        }
+    }
+
+    TEST_F(MathBatchFixture, IntersectAabbs_MatchesFrustumIntersectAabb)
+    {
+        const AZ::Frustum frustum(
+            AZ::ViewFrustumAttributes(AZ::Transform::CreateIdentity(), 1.0f, AZ::Constants::HalfPi, 1.0f, 100.0f));
+
+        AZ::AabbSoa aabbs(Count);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const AZ::Vector3 center(GetRandomFloat(50.0f), GetRandomFloat(110.0f), GetRandomFloat(50.0f));
+            const AZ::Vector3 halfExtents = GetRandomVector3(10.0f).GetAbs();
+            aabbs.Set(i, AZ::Aabb::CreateFromMinMax(center - halfExtents, center + halfExtents));
+        }
+
+        AZStd::vector<AZ::IntersectResult> results(Count);
+        AZ::MathBatch::IntersectAabbs(frustum, aabbs, results);
+
+        for (size_t i = 0; i < Count; ++i)
+        {
+            EXPECT_EQ(frustum.IntersectAabb(aabbs.Get(i)), results[i]);
+        }
+    }
+
+    TEST_F(MathBatchFixture, SlerpQuaternions_MatchesQuaternionSlerp)
+    {
+        AZ::QuaternionSoa from(Count);
+        AZ::QuaternionSoa to(Count);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            from.Set(i, GetRandomQuaternion());
+            // Include identical quaternions, which are lerped
+            to.Set(i, (i % 5 == 0) ? from.Get(i) : GetRandomQuaternion());
+        }
+
+        AZ::QuaternionSoa results;
+        AZ::MathBatch::SlerpQuaternions(from, to, 0.3f, results);
+
+        ASSERT_EQ(Count, results.GetSize());
+        for (size_t i = 0; i < Count; ++i)
+        {
+            EXPECT_THAT(results.Get(i), IsCloseTolerance(from.Get(i).Slerp(to.Get(i), 0.3f), 1e-3f));
+        }
+    }
+} // namespace UnitTest
@@ -3153,4 +3153,125 @@ namespace UnitTest
     {
         TestZeroVectorInt<Simd::Vec4>();
     }
+
+    TEST(MATH_SimdMath, TestLoadStoreVec8)
+    {
+        alignas(32) float testLoadValues[8] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f };
+        alignas(32) float testStoreValues[8];
+
+        Simd::Vec8::StoreAligned(testStoreValues, Simd::Vec8::LoadAligned(testLoadValues));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(testLoadValues[i], testStoreValues[i]);
+        }
+
+        Simd::Vec8::StoreUnaligned(testStoreValues, Simd::Vec8::Splat(-2.0f));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(-2.0f, testStoreValues[i]);
+        }
+
+        Simd::Vec8::StoreUnaligned(testStoreValues, Simd::Vec8::ZeroFloat());
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(0.0f, testStoreValues[i]);
+        }
+    }
+
+    TEST(MATH_SimdMath, TestArithmeticVec8)
+    {
+        const float values1[8] = { 1.0f, -2.0f, 3.0f, -4.0f, 5.0f, -6.0f, 7.0f, -8.0f };
+        const float values2[8] = { 2.0f, 4.0f, -8.0f, 16.0f, 0.5f, -0.25f, 1.0f, 3.0f };
+        const float values3[8] = { 0.5f, 1.5f, 2.5f, 3.5f, -0.5f, -1.5f, -2.5f, -3.5f };
+        const Simd::Vec8::FloatType vector1 = Simd::Vec8::LoadUnaligned(values1);
+        const Simd::Vec8::FloatType vector2 = Simd::Vec8::LoadUnaligned(values2);
+        const Simd::Vec8::FloatType vector3 = Simd::Vec8::LoadUnaligned(values3);
+
+        float add[8], sub[8], mul[8], madd[8], div[8];
+        Simd::Vec8::StoreUnaligned(add, Simd::Vec8::Add(vector1, vector2));
+        Simd::Vec8::StoreUnaligned(sub, Simd::Vec8::Sub(vector1, vector2));
+        Simd::Vec8::StoreUnaligned(mul, Simd::Vec8::Mul(vector1, vector2));
+        Simd::Vec8::StoreUnaligned(madd, Simd::Vec8::Madd(vector1, vector2, vector3));
+        Simd::Vec8::StoreUnaligned(div, Simd::Vec8::Div(vector1, vector2));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_NEAR(values1[i] + values2[i], add[i], AZ::Constants::Tolerance);
+            EXPECT_NEAR(values1[i] - values2[i], sub[i], AZ::Constants::Tolerance);
+            EXPECT_NEAR(values1[i] * values2[i], mul[i], AZ::Constants::Tolerance);
+            EXPECT_NEAR(values1[i] * values2[i] + values3[i], madd[i], AZ::Constants::Tolerance);
+            EXPECT_NEAR(values1[i] / values2[i], div[i], AZ::Constants::Tolerance);
+        }
+    }
+
+    TEST(MATH_SimdMath, TestAbsMinMaxClampVec8)
+    {
+        const float values1[8] = { 1.0f, -2.0f, 3.0f, -4.0f, 5.0f, -6.0f, 7.0f, -8.0f };
+        const float values2[8] = { 2.0f, -4.0f, -8.0f, 16.0f, 0.5f, -0.25f, 1.0f, 3.0f };
+        const Simd::Vec8::FloatType vector1 = Simd::Vec8::LoadUnaligned(values1);
+        const Simd::Vec8::FloatType vector2 = Simd::Vec8::LoadUnaligned(values2);
+
+        float abs[8], min[8], max[8], clamp[8];
+        Simd::Vec8::StoreUnaligned(abs, Simd::Vec8::Abs(vector1));
+        Simd::Vec8::StoreUnaligned(min, Simd::Vec8::Min(vector1, vector2));
+        Simd::Vec8::StoreUnaligned(max, Simd::Vec8::Max(vector1, vector2));
+        Simd::Vec8::StoreUnaligned(clamp, Simd::Vec8::Clamp(vector1, Simd::Vec8::Splat(-3.0f), Simd::Vec8::Splat(4.0f)));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(AZ::GetAbs(values1[i]), abs[i]);
+            EXPECT_EQ(AZStd::min(values1[i], values2[i]), min[i]);
+            EXPECT_EQ(AZStd::max(values1[i], values2[i]), max[i]);
+            EXPECT_EQ(AZ::GetClamp(values1[i], -3.0f, 4.0f), clamp[i]);
+        }
+    }
+
+    TEST(MATH_SimdMath, TestCompareSelectVec8)
+    {
+        const float values1[8] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f };
+        const float values2[8] = { 1.0f, 3.0f, 2.0f, 4.0f, 6.0f, 5.0f, 7.0f, 7.0f };
+        const Simd::Vec8::FloatType vector1 = Simd::Vec8::LoadUnaligned(values1);
+        const Simd::Vec8::FloatType vector2 = Simd::Vec8::LoadUnaligned(values2);
+        const Simd::Vec8::FloatType one = Simd::Vec8::Splat(1.0f);
+        const Simd::Vec8::FloatType zero = Simd::Vec8::ZeroFloat();
+
+        auto storeMask = [&one, &zero](float* results, Simd::Vec8::FloatArgType mask)
+        {
+            Simd::Vec8::StoreUnaligned(results, Simd::Vec8::Select(one, zero, mask));
+        };
+        float eq[8], neq[8], gt[8], gtEq[8], lt[8], ltEq[8], notEq[8], andNot[8];
+        storeMask(eq, Simd::Vec8::CmpEq(vector1, vector2));
+        storeMask(neq, Simd::Vec8::CmpNeq(vector1, vector2));
+        storeMask(gt, Simd::Vec8::CmpGt(vector1, vector2));
+        storeMask(gtEq, Simd::Vec8::CmpGtEq(vector1, vector2));
+        storeMask(lt, Simd::Vec8::CmpLt(vector1, vector2));
+        storeMask(ltEq, Simd::Vec8::CmpLtEq(vector1, vector2));
+        storeMask(notEq, Simd::Vec8::Not(Simd::Vec8::CmpEq(vector1, vector2)));
+        // AndNot(a, b) is ~a & b, so this is (vector1 <= vector2) && (vector1 != vector2)
+        storeMask(andNot, Simd::Vec8::AndNot(Simd::Vec8::CmpEq(vector1, vector2), Simd::Vec8::CmpLtEq(vector1, vector2)));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(values1[i] == values2[i] ? 1.0f : 0.0f, eq[i]);
+            EXPECT_EQ(values1[i] != values2[i] ? 1.0f : 0.0f, neq[i]);
+            EXPECT_EQ(values1[i] > values2[i] ? 1.0f : 0.0f, gt[i]);
+            EXPECT_EQ(values1[i] >= values2[i] ? 1.0f : 0.0f, gtEq[i]);
+            EXPECT_EQ(values1[i] < values2[i] ? 1.0f : 0.0f, lt[i]);
+            EXPECT_EQ(values1[i] <= values2[i] ? 1.0f : 0.0f, ltEq[i]);
+            EXPECT_EQ(values1[i] != values2[i] ? 1.0f : 0.0f, notEq[i]);
+            EXPECT_EQ(values1[i] < values2[i] ? 1.0f : 0.0f, andNot[i]);
+        }
+    }
+
+    TEST(MATH_SimdMath, TestSqrtReciprocalVec8)
+    {
+        const float values[8] = { 1.0f, 4.0f, 9.0f, 16.0f, 0.25f, 2.0f, 100.0f, 0.5f };
+        const Simd::Vec8::FloatType vector = Simd::Vec8::LoadUnaligned(values);
+
+        float sqrt[8], reciprocal[8];
+        Simd::Vec8::StoreUnaligned(sqrt, Simd::Vec8::Sqrt(vector));
+        Simd::Vec8::StoreUnaligned(reciprocal, Simd::Vec8::Reciprocal(vector));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_NEAR(AZ::Sqrt(values[i]), sqrt[i], AZ::Constants::Tolerance);
+            EXPECT_NEAR(1.0f / values[i], reciprocal[i], AZ::Constants::Tolerance);
+        }
+    }
 }
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Memory/AllocatorTrackingRecorder.h>
+#include <AzCore/std/string/string.h>
+
+namespace UnitTest
+{
+    class AllocationSamplerTest
+        : public LeakDetectionFixture
+    {
+    protected:
+        // The sampler never touches the memory, so fake addresses are enough to feed it
+        static void* GetFakeAddress(size_t index)
+        {
+            return reinterpret_cast<void*>(0x100000 + index * 64);
+        }
+
+        static AZ::u64 GetTotal(const AZ::AllocationSampler::CallSiteVector& callSites, AZ::u64 AZ::AllocationSampler::CallSite::*counter)
+        {
+            AZ::u64 total = 0;
+            for (const AZ::AllocationSampler::CallSite& callSite : callSites)
+            {
+                total += callSite.*counter;
+            }
+            return total;
+        }
+    };
+
+    TEST_F(AllocationSamplerTest, NotSampling_RecordsNothing)
+    {
+        AZ::AllocationSampler sampler;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            sampler.OnAllocation(GetFakeAddress(i), 1024);
+        }
+        EXPECT_TRUE(sampler.GetCallSites().empty());
+    }
+
+    TEST_F(AllocationSamplerTest, Deallocation_RemovesLiveSamples)
+    {
+        AZ::AllocationSampler sampler;
+        // Allocations much larger than the interval are always sampled
+        sampler.SetSamplingInterval(1);
+        constexpr size_t numAllocations = 100;
+        for (size_t i = 0; i < numAllocations; ++i)
+        {
+            sampler.OnAllocation(GetFakeAddress(i), 64);
+        }
+
+        AZ::AllocationSampler::CallSiteVector callSites = sampler.GetCallSites();
+        ASSERT_FALSE(callSites.empty());
+        EXPECT_EQ(numAllocations, GetTotal(callSites, &AZ::AllocationSampler::CallSite::m_sampleCount));
+        EXPECT_EQ(numAllocations, GetTotal(callSites, &AZ::AllocationSampler::CallSite::m_liveSampleCount));
+        EXPECT_EQ(numAllocations * 64, GetTotal(callSites, &AZ::AllocationSampler::CallSite::m_liveEstimatedBytes));
+
+        // Frees are still tracked once sampling stopped
+        sampler.SetSamplingInterval(0);
+        for (size_t i = 0; i < numAllocations / 2; ++i)
+        {
+            sampler.OnDeallocation(GetFakeAddress(i));
+        }
+        // unknown addresses are ignored
+        sampler.OnDeallocation(GetFakeAddress(numAllocations * 2));
+
+        callSites = sampler.GetCallSites();
+        EXPECT_EQ(numAllocations, GetTotal(callSites, &AZ::AllocationSampler::CallSite::m_sampleCount));
+        EXPECT_EQ(numAllocations / 2, GetTotal(callSites, &AZ::AllocationSampler::CallSite::m_liveSampleCount));
+        EXPECT_EQ(numAllocations / 2 * 64, GetTotal(callSites, &AZ::AllocationSampler::CallSite::m_liveEstimatedBytes));
+
+        sampler.Reset();
+        EXPECT_TRUE(sampler.GetCallSites().empty());
+    }
+
+    TEST_F(AllocationSamplerTest, SmallAllocations_EstimatedBytesAreUnbiased)
+    {
+        AZ::AllocationSampler sampler;
+        sampler.SetSamplingInterval(4096);
+        constexpr size_t numAllocations = 100000;
+        constexpr size_t allocationSize = 64;
+        for (size_t i = 0; i < numAllocations; ++i)
+        {
+            sampler.OnAllocation(GetFakeAddress(i), allocationSize);
+        }
+        sampler.SetSamplingInterval(0);
+
+        const AZ::AllocationSampler::CallSiteVector callSites = sampler.GetCallSites();
+        const AZ::u64 sampleCount = GetTotal(callSites, &AZ::AllocationSampler::CallSite::m_sampleCount);
+        EXPECT_GT(sampleCount, 0u);
+        EXPECT_LT(sampleCount, numAllocations / 10);
+
+        // ~1500 samples are expected, the estimate is well within 10% of the real total
+        const double estimatedBytes = static_cast<double>(GetTotal(callSites, &AZ::AllocationSampler::CallSite::m_estimatedBytes));
+        EXPECT_NEAR(static_cast<double>(numAllocations * allocationSize), estimatedBytes, numAllocations * allocationSize * 0.1);
+        const double estimatedAllocations = static_cast<double>(GetTotal(callSites, &AZ::AllocationSampler::CallSite::m_estimatedAllocations));
+        EXPECT_NEAR(static_cast<double>(numAllocations), estimatedAllocations, numAllocations * 0.1);
+    }
+
+    TEST_F(AllocationSamplerTest, WriteToStream_WritesCallSites)
+    {
+        AZ::AllocationSampler sampler;
+        sampler.SetSamplingInterval(1);
+        sampler.OnAllocation(GetFakeAddress(0), 128);
+        sampler.SetSamplingInterval(0);
+
+        AZStd::string output;
+        AZ::IO::ByteContainerStream<AZStd::string> stream(&output);
+        ASSERT_TRUE(sampler.WriteToStream(stream));
+        EXPECT_NE(AZStd::string::npos, output.find(R"("CallSites": [)"));
+        EXPECT_NE(AZStd::string::npos, output.find(R"("LiveEstimatedBytes": 128)"));
+        sampler.OnDeallocation(GetFakeAddress(0));
+    }
+} // namespace UnitTest
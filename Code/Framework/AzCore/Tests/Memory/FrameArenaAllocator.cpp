@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    class FrameArenaAllocatorTest
+        : public LeakDetectionFixture
+    {
+    protected:
+        static AZ::FrameArenaAllocator& GetArena()
+        {
+            return static_cast<AZ::FrameArenaAllocator&>(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get());
+        }
+
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            GetArena().Reset();
+        }
+
+        void TearDown() override
+        {
+            GetArena().Reset();
+            GetArena().GarbageCollect();
+            LeakDetectionFixture::TearDown();
+        }
+    };
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_RespectsAlignment)
+    {
+        AZ::FrameArenaAllocator& arena = GetArena();
+        for (size_t alignment = 1; alignment <= 256; alignment *= 2)
+        {
+            void* allocation = arena.allocate(3, alignment);
+            ASSERT_NE(nullptr, allocation);
+            EXPECT_EQ(0u, reinterpret_cast<size_t>(allocation) % alignment);
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Reset_ReclaimsAllAllocations)
+    {
+        AZ::FrameArenaAllocator& arena = GetArena();
+        const AZ::u64 frameIndex = arena.GetFrameIndex();
+
+        void* first = arena.allocate(64, 16);
+        arena.deallocate(first, 64, 16);
+        EXPECT_GE(arena.NumAllocatedBytes(), 64u);
+
+        arena.Reset();
+        EXPECT_EQ(0u, arena.NumAllocatedBytes());
+        EXPECT_EQ(frameIndex + 1, arena.GetFrameIndex());
+
+        // Memory is handed out again from the start of the block
+        EXPECT_EQ(first, arena.allocate(64, 16).GetAddress());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Reset_CoalescesBlocksOfLargeFrames)
+    {
+        AZ::FrameArenaAllocator& arena = GetArena();
+        constexpr size_t allocationSize = AZ::FrameArenaAllocator::DefaultBlockSize / 4;
+        for (int i = 0; i < 10; ++i)
+        {
+            ASSERT_NE(nullptr, arena.allocate(allocationSize, 16).GetAddress());
+        }
+        const size_t capacity = arena.GetCapacity();
+        EXPECT_GT(capacity, AZ::FrameArenaAllocator::DefaultBlockSize);
+
+        // The next frame fits in the single coalesced block, the capacity doesn't grow any further
+        arena.Reset();
+        for (int i = 0; i < 10; ++i)
+        {
+            ASSERT_NE(nullptr, arena.allocate(allocationSize, 16).GetAddress());
+        }
+        EXPECT_EQ(capacity, arena.GetCapacity());
+        EXPECT_GE(arena.GetHighWaterMark(), 10 * allocationSize);
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Reallocate_PreservesContents)
+    {
+        AZ::FrameArenaAllocator& arena = GetArena();
+        int* values = static_cast<int*>(arena.allocate(4 * sizeof(int), alignof(int)));
+        for (int i = 0; i < 4; ++i)
+        {
+            values[i] = i;
+        }
+        int* grown = static_cast<int*>(arena.reallocate(values, 64 * sizeof(int), alignof(int)).GetAddress());
+        ASSERT_NE(nullptr, grown);
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_EQ(i, grown[i]);
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Reallocate_GrowLatestAllocation_CopiesOnlyItsContents)
+    {
+        AZ::FrameArenaAllocator& arena = GetArena();
+        auto older = static_cast<unsigned char*>(arena.allocate(16, 1).GetAddress());
+        auto latest = static_cast<unsigned char*>(arena.allocate(10, 1).GetAddress());
+        ASSERT_NE(nullptr, older);
+        ASSERT_NE(nullptr, latest);
+        memset(older, 0xaa, 16);
+        memset(latest, 0x5a, 10);
+        EXPECT_EQ(10u, arena.get_allocated_size(latest));
+
+        // The grown allocation is placed right after the latest one, the old range stays intact
+        auto grown = static_cast<unsigned char*>(arena.reallocate(latest, 100, 1).GetAddress());
+        ASSERT_NE(nullptr, grown);
+        EXPECT_GE(grown, latest + 10);
+        EXPECT_EQ(100u, arena.get_allocated_size(grown));
+        for (size_t i = 0; i < 10; ++i)
+        {
+            EXPECT_EQ(0x5a, grown[i]);
+            EXPECT_EQ(0x5a, latest[i]);
+        }
+        for (size_t i = 0; i < 16; ++i)
+        {
+            EXPECT_EQ(0xaa, older[i]);
+        }
+
+        // Shrinking only copies the bytes that still fit
+        auto shrunk = static_cast<unsigned char*>(arena.reallocate(grown, 4, 1).GetAddress());
+        ASSERT_NE(nullptr, shrunk);
+        EXPECT_EQ(4u, arena.get_allocated_size(shrunk));
+        for (size_t i = 0; i < 4; ++i)
+        {
+            EXPECT_EQ(0x5a, shrunk[i]);
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTest, StdContainers_UseFrameArena)
+    {
+        AZ::FrameArenaAllocator& arena = GetArena();
+        {
+            AZStd::vector<int, AZ::FrameArenaStdAllocator> scratchVector;
+            AZStd::unordered_map<int, int, AZStd::hash<int>, AZStd::equal_to<int>, AZ::FrameArenaStdAllocator> scratchMap;
+            for (int i = 0; i < 1000; ++i)
+            {
+                scratchVector.push_back(i);
+                scratchMap.emplace(i, i * 2);
+            }
+            EXPECT_EQ(1000u, scratchVector.size());
+            EXPECT_EQ(1998, scratchMap[999]);
+            EXPECT_GT(arena.NumAllocatedBytes(), 1000 * sizeof(int));
+        }
+        arena.Reset();
+        EXPECT_EQ(0u, arena.NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_FromMultipleThreads_ReturnsDisjointMemory)
+    {
+        AZ::FrameArenaAllocator& arena = GetArena();
+        constexpr size_t numThreads = 8;
+        constexpr size_t numAllocations = 10000;
+        constexpr size_t allocationSize = 24;
+
+        AZStd::vector<AZStd::thread, AZ::OSStdAllocator> threads;
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads.emplace_back(
+                [&arena, threadIndex]()
+                {
+                    AZStd::vector<unsigned char*, AZ::OSStdAllocator> allocations;
+                    allocations.reserve(numAllocations);
+                    for (size_t i = 0; i < numAllocations; ++i)
+                    {
+                        auto allocation = static_cast<unsigned char*>(arena.allocate(allocationSize, 8).GetAddress());
+                        ASSERT_NE(nullptr, allocation);
+                        memset(allocation, static_cast<int>(threadIndex), allocationSize);
+                        allocations.push_back(allocation);
+                    }
+                    for (unsigned char* allocation : allocations)
+                    {
+                        for (size_t i = 0; i < allocationSize; ++i)
+                        {
+                            ASSERT_EQ(threadIndex, allocation[i]);
+                        }
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        EXPECT_GE(arena.NumAllocatedBytes(), numThreads * numAllocations * allocationSize);
+    }
+} // namespace UnitTest
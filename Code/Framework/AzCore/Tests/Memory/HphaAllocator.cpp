@@ -9,6 +9,7 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/HphaAllocator.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace UnitTest
 {
@@ -102,4 +103,60 @@ namespace UnitTest
     INSTANTIATE_TEST_CASE_P(Mixed,
         HphaSchemaTestFixture,
         ::testing::ValuesIn(s_mixedInstancesParameters));
+
+    class HphaSchemaThreadCacheFixture
+        : public LeakDetectionFixture
+        , public ::testing::WithParamInterface<size_t>
+    {
+    };
+
+    TEST_P(HphaSchemaThreadCacheFixture, CachedBlocksAreReturnedOnThreadExit)
+    {
+        AZ::HphaSchema hpha;
+        hpha.SetThreadCacheSize(GetParam());
+        EXPECT_EQ(GetParam(), hpha.GetThreadCacheSize());
+
+        constexpr size_t numThreads = 4;
+        constexpr size_t numAllocations = 1000;
+        AZStd::vector<void*, AZ::OSStdAllocator> crossThreadAllocations[numThreads];
+        AZStd::vector<AZStd::thread, AZ::OSStdAllocator> threads;
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads.emplace_back(
+                [&hpha, &allocations = crossThreadAllocations[threadIndex]]()
+                {
+                    AZStd::vector<void*, AZ::OSStdAllocator> localAllocations;
+                    for (size_t i = 0; i < numAllocations; ++i)
+                    {
+                        const size_t allocationSize = s_smallAllocationSizes[i % s_smallAllocationSizes.size()];
+                        void* allocation = hpha.allocate(allocationSize, 0);
+                        ASSERT_NE(nullptr, allocation);
+                        (i % 2 ? localAllocations : allocations).emplace_back(allocation);
+                    }
+                    for (void* allocation : localAllocations)
+                    {
+                        hpha.deallocate(allocation);
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        // free the remaining blocks from a different thread than the one that allocated them
+        for (AZStd::vector<void*, AZ::OSStdAllocator>& allocations : crossThreadAllocations)
+        {
+            for (void* allocation : allocations)
+            {
+                hpha.deallocate(allocation);
+            }
+        }
+        EXPECT_EQ(0u, hpha.NumAllocatedBytes());
+        hpha.GarbageCollect();
+    }
+
+    INSTANTIATE_TEST_CASE_P(ThreadCache,
+        HphaSchemaThreadCacheFixture,
+        ::testing::Values(0, 1, AZ::HphaSchema::DefaultThreadCacheSize, 256));
 }
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Module/Internal/ModuleFilePrefetcher.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzTest/Utils.h>
+
+namespace UnitTest
+{
+    class ModuleFilePrefetcherTest
+        : public LeakDetectionFixture
+    {
+    protected:
+        //! Writes the given number of files to the temporary directory, the second one is larger than the chunks the prefetcher reads
+        AZStd::vector<AZ::IO::FixedMaxPathString> WriteFiles(size_t fileCount)
+        {
+            AZStd::vector<AZ::IO::FixedMaxPathString> filePaths;
+            for (size_t fileIndex = 0; fileIndex < fileCount; ++fileIndex)
+            {
+                const AZ::IO::FixedMaxPath filePath = m_tempDirectory.GetDirectoryAsFixedMaxPath() / AZStd::string::format("module%zu.bin", fileIndex);
+                const AZStd::string content(fileIndex == 1 ? 3 * 1024 * 1024 + 7 : 1024, 'm');
+                EXPECT_TRUE(AZ::Utils::WriteFile(content, filePath.Native()).IsSuccess());
+                filePaths.emplace_back(filePath.Native());
+            }
+            return filePaths;
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+    };
+
+    TEST_F(ModuleFilePrefetcherTest, Wait_MoreFilesThanThreads_ReadsEveryFile)
+    {
+        AZ::Internal::ModuleFilePrefetcher prefetcher(WriteFiles(8), 3);
+        prefetcher.Wait();
+        EXPECT_EQ(8u, prefetcher.GetReadFileCount());
+    }
+
+    TEST_F(ModuleFilePrefetcherTest, Wait_MoreThreadsThanFiles_ReadsEveryFile)
+    {
+        AZ::Internal::ModuleFilePrefetcher prefetcher(WriteFiles(2), 16);
+        prefetcher.Wait();
+        EXPECT_EQ(2u, prefetcher.GetReadFileCount());
+    }
+
+    TEST_F(ModuleFilePrefetcherTest, Wait_MissingFiles_SkipsThem)
+    {
+        AZStd::vector<AZ::IO::FixedMaxPathString> filePaths = WriteFiles(3);
+        filePaths.insert(filePaths.begin() + 1, (m_tempDirectory.GetDirectoryAsFixedMaxPath() / "missing.bin").Native());
+        filePaths.emplace_back((m_tempDirectory.GetDirectoryAsFixedMaxPath() / "missing_too.bin").Native());
+
+        AZ::Internal::ModuleFilePrefetcher prefetcher(AZStd::move(filePaths), 2);
+        prefetcher.Wait();
+        EXPECT_EQ(3u, prefetcher.GetReadFileCount());
+    }
+
+    TEST_F(ModuleFilePrefetcherTest, Wait_NoThreads_ReadsNothing)
+    {
+        AZ::Internal::ModuleFilePrefetcher prefetcher(WriteFiles(2), 0);
+        prefetcher.Wait();
+        EXPECT_EQ(0u, prefetcher.GetReadFileCount());
+    }
+
+    TEST_F(ModuleFilePrefetcherTest, Destructor_StopsReading)
+    {
+        const AZStd::vector<AZ::IO::FixedMaxPathString> filePaths = WriteFiles(64);
+        {
+            // Destroyed right away, like when the modules are loaded before the prefetcher got to them
+            AZ::Internal::ModuleFilePrefetcher prefetcher(filePaths, 2);
+        }
+
+        // The destructor joined the threads, so another prefetcher can read the same files
+        AZ::Internal::ModuleFilePrefetcher prefetcher(filePaths, 2);
+        prefetcher.Wait();
+        EXPECT_EQ(filePaths.size(), prefetcher.GetReadFileCount());
+    }
+} // namespace UnitTest
@@ -177,4 +177,123 @@ namespace AZ::NameBenchmarks
         state.SetItemsProcessed(state.iterations() * state.range(0));
     }
     BENCHMARK_REGISTER_F(NameBenchmarkFixture, NameLiteralCreateAndDestroy)->Arg(10)->Arg(100)->Arg(1000);
+
+    BENCHMARK_DEFINE_F(NameBenchmarkFixture, CreateNameFromPrecomputedLiteral)(::benchmark::State& state)
+    {
+        static constexpr AZ::NameLiteral precomputedLiteral{ "test_literal" };
+        const AZ::Name existingName(precomputedLiteral);
+
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            benchmark::DoNotOptimize(AZ::Name(precomputedLiteral));
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(NameBenchmarkFixture, CreateNameFromPrecomputedLiteral);
+
+    //! Measures contention on the NameDictionary between threads looking up existing names.
+    //! The dictionary and the names are created by the first thread only, the other threads only access them
+    //! inside the benchmark loop, which starts once every thread reached it.
+    class NameContentionBenchmarkFixture : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t PoolSize = 100;
+
+    protected:
+        void CreatePool(const ::benchmark::State& state)
+        {
+            if (state.thread_index() == 0)
+            {
+                AZ::NameDictionary::Create();
+                m_nameStrings = new AZStd::vector<AZStd::string>;
+                m_existingNames = new AZStd::vector<AZ::Name>;
+                for (size_t i = 0; i < PoolSize; ++i)
+                {
+                    m_nameStrings->emplace_back(AZStd::string::format("contended_name%zu", i));
+                    m_existingNames->emplace_back(m_nameStrings->back());
+                }
+            }
+        }
+
+        void DestroyPool(const ::benchmark::State& state)
+        {
+            if (state.thread_index() == 0)
+            {
+                delete m_existingNames;
+                delete m_nameStrings;
+                AZ::NameDictionary::Destroy();
+            }
+        }
+
+        AZStd::vector<AZStd::string>* m_nameStrings = nullptr;
+        AZStd::vector<AZ::Name>* m_existingNames = nullptr;
+    };
+
+#define REGISTER_NAME_CONTENTION_BENCHMARK(_fixture, _function) \
+    BENCHMARK_REGISTER_F(_fixture, _function) \
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency()) \
+        ->UseRealTime();
+
+    BENCHMARK_DEFINE_F(NameContentionBenchmarkFixture, CreateNameCacheHit_MultiThreaded)(::benchmark::State& state)
+    {
+        CreatePool(state);
+
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            for (const AZStd::string& nameString : *m_nameStrings)
+            {
+                benchmark::DoNotOptimize(AZ::Name(nameString));
+            }
+        }
+
+        DestroyPool(state);
+        state.SetItemsProcessed(state.iterations() * PoolSize);
+    }
+    REGISTER_NAME_CONTENTION_BENCHMARK(NameContentionBenchmarkFixture, CreateNameCacheHit_MultiThreaded);
+
+    BENCHMARK_DEFINE_F(NameContentionBenchmarkFixture, FindNameByHash_MultiThreaded)(::benchmark::State& state)
+    {
+        CreatePool(state);
+
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            for (const AZ::Name& existingName : *m_existingNames)
+            {
+                benchmark::DoNotOptimize(AZ::Name(existingName.GetHash()));
+            }
+        }
+
+        DestroyPool(state);
+        state.SetItemsProcessed(state.iterations() * PoolSize);
+    }
+    REGISTER_NAME_CONTENTION_BENCHMARK(NameContentionBenchmarkFixture, FindNameByHash_MultiThreaded);
+
+    BENCHMARK_DEFINE_F(NameContentionBenchmarkFixture, CreateNameCacheHitWithCacheMisses_MultiThreaded)(::benchmark::State& state)
+    {
+        CreatePool(state);
+        // One name in ten is new to the dictionary and released right away, so lookups contend with writers
+        const AZStd::string uniquePrefix = AZStd::string::format("thread%d_", state.thread_index());
+        size_t missIndex = 0;
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            for (size_t i = 0; i < PoolSize; ++i)
+            {
+                if (i % 10 == 0)
+                {
+                    benchmark::DoNotOptimize(AZ::Name(AZStd::string::format("%s%zu", uniquePrefix.c_str(), missIndex++ % PoolSize)));
+                }
+                else
+                {
+                    benchmark::DoNotOptimize(AZ::Name((*m_nameStrings)[i]));
+                }
+            }
+        }
+
+        DestroyPool(state);
+        state.SetItemsProcessed(state.iterations() * PoolSize);
+    }
+    REGISTER_NAME_CONTENTION_BENCHMARK(NameContentionBenchmarkFixture, CreateNameCacheHitWithCacheMisses_MultiThreaded);
+
+#undef REGISTER_NAME_CONTENTION_BENCHMARK
 } // namespace AZ::NameBenchmarks
@@ -703,6 +703,49 @@ namespace UnitTest
         EXPECT_EQ("global", globalName.GetStringView());
     }
 
+    TEST_F(NameTest, NameLiteral_PrecomputedHash_MatchesNameFromString)
+    {
+        static constexpr AZ::NameLiteral precomputedLiteral{ "precomputed" };
+        static_assert(precomputedLiteral.GetHash() == AZ::NameLiteral::CalcHash("precomputed"));
+
+        const AZ::Name fromLiteral{ precomputedLiteral };
+        const AZ::Name fromString{ "precomputed" };
+        EXPECT_EQ(fromString, fromLiteral);
+        EXPECT_EQ("precomputed", fromLiteral.GetStringView());
+        EXPECT_EQ(NameDictionaryTester::CalcDirectHashValue("precomputed"), fromLiteral.GetHash());
+
+        EXPECT_TRUE(AZ::Name(AZ::NameLiteral("")).IsEmpty());
+    }
+
+    TEST_F(NameTest, FindName_AfterManyNamesAreCreatedAndReleased_FindsRemainingNames)
+    {
+        // Enough names to grow the lookup table several times
+        constexpr size_t nameCount = 2000;
+        AZStd::vector<AZ::Name> names;
+        for (size_t i = 0; i < nameCount; ++i)
+        {
+            names.emplace_back(AZStd::string::format("name %zu", i));
+        }
+
+        AZStd::vector<AZ::Name::Hash> releasedHashes;
+        for (size_t i = 0; i < nameCount; i += 2)
+        {
+            releasedHashes.push_back(names[i].GetHash());
+            names[i] = AZ::Name();
+        }
+
+        for (size_t i = 1; i < nameCount; i += 2)
+        {
+            const AZ::Name found = AZ::NameDictionary::Instance().FindName(names[i].GetHash());
+            EXPECT_EQ(names[i].GetStringView(), found.GetStringView());
+        }
+        for (AZ::Name::Hash releasedHash : releasedHashes)
+        {
+            EXPECT_TRUE(AZ::NameDictionary::Instance().FindName(releasedHash).IsEmpty());
+        }
+        EXPECT_EQ(nameCount / 2, NameDictionaryTester::GetEntryCount());
+    }
+
     TEST_F(NameTest, DISABLED_NameVsStringPerf_Creation)
     {
         constexpr int CreateCount = 1000;
@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+
+namespace AZ::IO
+{
+    constexpr AZ::u32 TestMaxFileHandles = 1;
+    constexpr AZ::u32 TestMaxMetaDataEntries = 16;
+    constexpr size_t TestPhysicalSectorSize = 4_kib;
+    constexpr size_t TestLogicalSectorSize = 512;
+    constexpr AZ::u32 TestQueueDepth = 8;
+    constexpr AZ::s32 TestOverCommit = 0;
+    constexpr size_t TestRegisteredBufferSize = 16_kib;
+
+    StorageDriveLinux::ConstructionOptions CreateTestOptions()
+    {
+        StorageDriveLinux::ConstructionOptions options;
+        options.m_hasSeekPenalty = false;
+        options.m_enableUnbufferedReads = true;
+        options.m_minimalReporting = true;
+        return options;
+    }
+
+    //
+    // StreamStackEntry API Conformity
+    //
+    class StorageDriveLinuxTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<StorageDriveLinux>
+    {
+    public:
+        StorageDriveLinux CreateInstance() override
+        {
+            return StorageDriveLinux(TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize, TestLogicalSectorSize,
+                TestQueueDepth, TestOverCommit, TestRegisteredBufferSize, CreateTestOptions());
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_StorageDriveLinuxConformityTests, StreamStackEntryConformityTests, StorageDriveLinuxTestDescription);
+
+    //
+    // StorageDriveLinux Tests
+    //
+
+    class Streamer_StorageDriveLinuxTestFixture
+        : public UnitTest::LeakDetectionFixture
+        , public UnitTest::SetRestoreFileIOBaseRAII
+    {
+    public:
+        static constexpr char s_dummyFilename[] = "DummyLinux.bin";
+
+        UnitTest::TestFileIOBase m_fileIO{};
+        AZStd::string m_dummyFilepath;
+        RequestPath m_dummyRequestPath;
+        AZStd::shared_ptr<StorageDriveLinux> m_storageDrive;
+        StreamerContext* m_context = nullptr;
+
+        Streamer_StorageDriveLinuxTestFixture()
+            : UnitTest::SetRestoreFileIOBaseRAII(m_fileIO)
+        {
+            char exePath[AZ_MAX_PATH_LEN] = { 0 };
+            auto result = AZ::Utils::GetExecutablePath(exePath, AZ_MAX_PATH_LEN);
+            if (result.m_pathStored == AZ::Utils::ExecutablePathResult::Success)
+            {
+                AZStd::string filePath(exePath);
+                if (result.m_pathIncludesFilename)
+                {
+                    AZ::StringFunc::Path::StripFullName(filePath);
+                }
+                AZ::StringFunc::Path::Join(filePath.c_str(), s_dummyFilename, m_dummyFilepath);
+            }
+        }
+
+        void SetUp() override
+        {
+            ASSERT_FALSE(m_dummyFilepath.empty());
+            m_dummyRequestPath = RequestPath(AZ::IO::PathView(m_dummyFilepath));
+
+            m_context = new StreamerContext();
+            m_storageDrive = AZStd::make_shared<StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize,
+                TestLogicalSectorSize, TestQueueDepth, TestOverCommit, TestRegisteredBufferSize, CreateTestOptions());
+            m_storageDrive->SetContext(*m_context);
+        }
+
+        void TearDown() override
+        {
+            m_storageDrive.reset();
+            delete m_context;
+            m_context = nullptr;
+
+            AZ::IO::SystemFile::Delete(m_dummyFilepath.c_str());
+        }
+
+        // Creates a file where every byte contains the lower bits of its offset.
+        void CreateDummyFile(size_t fileSize)
+        {
+            SystemFile file;
+            ASSERT_TRUE(file.Open(m_dummyFilepath.c_str(), SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE));
+
+            AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+            for (size_t i = 0; i < fileSize; ++i)
+            {
+                buffer[i] = static_cast<char>(i & 0xff);
+            }
+            EXPECT_EQ(fileSize, file.Write(buffer.get(), fileSize));
+            file.Close();
+        }
+
+        void WaitTillCompleted()
+        {
+            StreamStackEntry::Status status;
+            auto startTime = AZStd::chrono::steady_clock::now();
+            do
+            {
+                m_storageDrive->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                status.m_isIdle = true;
+                m_storageDrive->UpdateStatus(status);
+
+                if (AZStd::chrono::steady_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+            } while (!status.m_isIdle);
+        }
+
+        //! Reads from the dummy file and checks that only the requested bytes were written.
+        void ReadAndVerify(char* buffer, u64 bufferSize, u64 offset, u64 size)
+        {
+            constexpr char untouched = 'Z';
+            ::memset(buffer, untouched, bufferSize);
+
+            IStreamerTypes::RequestStatus status = IStreamerTypes::RequestStatus::Pending;
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffer, bufferSize, m_dummyRequestPath, offset, size);
+            request->SetCompletionCallback([&status](const FileRequest& request)
+                {
+                    status = request.GetStatus();
+                });
+            m_storageDrive->QueueRequest(request);
+            WaitTillCompleted();
+
+            EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, status);
+            for (u64 i = 0; i < size; ++i)
+            {
+                ASSERT_EQ(static_cast<char>((offset + i) & 0xff), buffer[i]);
+            }
+            for (u64 i = size; i < bufferSize; ++i)
+            {
+                ASSERT_EQ(untouched, buffer[i]);
+            }
+        }
+    };
+
+    //! Reads need io_uring, so these tests are skipped on machines where it's unavailable or blocked.
+    class Streamer_StorageDriveLinuxReadTestFixture
+        : public Streamer_StorageDriveLinuxTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            Streamer_StorageDriveLinuxTestFixture::SetUp();
+            if (!m_storageDrive->IsAvailable())
+            {
+#if defined(GTEST_SKIP)
+                GTEST_SKIP() << "io_uring isn't available.";
+#endif
+            }
+        }
+    };
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidSizes_ErrorsAreReported)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDrive = AZStd::make_shared<StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries, 0, 0, TestQueueDepth,
+            TestOverCommit, TestRegisteredBufferSize, CreateTestOptions());
+        AZ_TEST_STOP_TRACE_SUPPRESSION(2);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidOvercommit_ErrorIsReportedAndSizeAdjusted)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDrive = AZStd::make_shared<StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize,
+            TestLogicalSectorSize, TestQueueDepth, -(aznumeric_cast<s32>(TestQueueDepth) + 2), TestRegisteredBufferSize,
+            CreateTestOptions());
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        StreamStackEntry::Status status{};
+        m_storageDrive->UpdateStatus(status);
+        EXPECT_EQ(1, status.m_numAvailableSlots);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxReadTestFixture, ReadDataRequest_AlignedRead_ReturnsCorrectData)
+    {
+        constexpr size_t fileSize = 64_kib;
+        CreateDummyFile(fileSize);
+
+        char* buffer = reinterpret_cast<char*>(azmalloc(fileSize, TestPhysicalSectorSize));
+        ReadAndVerify(buffer, fileSize, 0, fileSize);
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxReadTestFixture, ReadDataRequest_UnalignedSmallRead_ReturnsCorrectDataAndDoesNotWriteMore)
+    {
+        // Small enough to be read into the registered buffer.
+        CreateDummyFile(16_kib);
+
+        char* buffer = reinterpret_cast<char*>(azmalloc(300, TestPhysicalSectorSize));
+        ReadAndVerify(buffer, 300, 40, 280);
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxReadTestFixture, ReadDataRequest_UnalignedLargeRead_ReturnsCorrectDataAndDoesNotWriteMore)
+    {
+        // Too large for the registered buffer, so a temporary buffer is allocated.
+        constexpr u64 unalignedSize = 103630;
+        CreateDummyFile(unalignedSize);
+
+        char* memory = reinterpret_cast<char*>(azmalloc(unalignedSize + 16, TestPhysicalSectorSize));
+        ReadAndVerify(memory + 7, unalignedSize + 8, 0, unalignedSize);
+        azfree(memory);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxReadTestFixture, ReadDataRequest_MoreReadsThanQueueDepth_AllReadsComplete)
+    {
+        constexpr size_t chunkSize = 4_kib;
+        constexpr size_t chunkCount = TestQueueDepth * 4;
+        CreateDummyFile(chunkSize * chunkCount);
+
+        char* buffer = reinterpret_cast<char*>(azmalloc(chunkSize * chunkCount, TestPhysicalSectorSize));
+        size_t completedCount = 0;
+        for (size_t i = 0; i < chunkCount; ++i)
+        {
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffer + i * chunkSize, chunkSize, m_dummyRequestPath, i * chunkSize, chunkSize);
+            request->SetCompletionCallback([&completedCount](const FileRequest& request)
+                {
+                    EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                    ++completedCount;
+                });
+            m_storageDrive->QueueRequest(request);
+        }
+        WaitTillCompleted();
+
+        EXPECT_EQ(chunkCount, completedCount);
+        for (size_t i = 0; i < chunkSize * chunkCount; ++i)
+        {
+            ASSERT_EQ(static_cast<char>(i & 0xff), buffer[i]);
+        }
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileExists_ReportsAccurateFileSize)
+    {
+        CreateDummyFile(4_kib);
+
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<Requests::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_TRUE(fileMetaData.m_found);
+                EXPECT_EQ(4_kib, fileMetaData.m_fileSize);
+            });
+
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_FileDoesNotExist_ReturnsCompletedWithFileNotFound)
+    {
+        RequestPath path(AZ::IO::PathView(m_dummyFilepath + ".disappear"));
+
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(path);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileExistsCheck = AZStd::get<Requests::FileExistsCheckData>(request.GetCommand());
+                EXPECT_FALSE(fileExistsCheck.m_found);
+            });
+
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_FileExists_ReturnsCompletedWithFileFound)
+    {
+        CreateDummyFile(4_kib);
+
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileExistsCheck = AZStd::get<Requests::FileExistsCheckData>(request.GetCommand());
+                EXPECT_TRUE(fileExistsCheck.m_found);
+            });
+
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_PathIsDirectory_ReturnsCompletedWithFileNotFound)
+    {
+        AZStd::string directoryPath = m_dummyFilepath;
+        AZ::StringFunc::Path::StripFullName(directoryPath);
+        RequestPath path(AZ::IO::PathView{ directoryPath });
+
+        bool completed = false;
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(path);
+        request->SetCompletionCallback([&completed](const FileRequest& request)
+            {
+                completed = true;
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                auto& fileExistsCheck = AZStd::get<Requests::FileExistsCheckData>(request.GetCommand());
+                EXPECT_FALSE(fileExistsCheck.m_found);
+            });
+
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+        EXPECT_TRUE(completed);
+    }
+} // namespace AZ::IO
@@ -9,6 +9,7 @@
 set(FILES
     ../Common/UnixLike/Tests/IO/SystemFileTest_UnixLike.cpp
     ../Common/UnixLike/Tests/Process/ProcessInfoTests_UnixLike.cpp
+    Tests/IO/Streamer/StorageDriveTests_Linux.cpp
     Tests/UtilsTests_Linux.cpp
     ../Common/UnixLike/Tests/UtilsTests_UnixLike.cpp
     Tests/Memory/AllocatorBenchmarks_Linux.cpp
@@ -13,6 +13,7 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/CopyOnWrite.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/DataOverlayProviderMsgs.h>
 #include <AzCore/Serialization/DataOverlayInstanceMsgs.h>
@@ -2084,6 +2085,35 @@ TEST_F(SerializeBasicTest, BasicTypeTest_Succeed)
         test.run();
     }
 
+    /*
+    * Test loading an ObjectStream in place from a memory buffer
+    */
+    TEST_F(Serialization, BinaryByteStream_LoadedFromMemoryBuffer_MatchesSavedBytes)
+    {
+        m_serializeContext->RegisterGenericType<AZStd::vector<AZ::u8>>();
+
+        AZStd::vector<AZ::u8> byteStream(4096);
+        for (size_t i = 0; i < byteStream.size(); ++i)
+        {
+            byteStream[i] = static_cast<AZ::u8>(i * 7);
+        }
+
+        AZStd::vector<char> buffer;
+        IO::ByteContainerStream<AZStd::vector<char>> saveStream(&buffer);
+        ASSERT_TRUE(Utils::SaveObjectToStream(saveStream, DataStream::ST_BINARY, &byteStream, m_serializeContext.get()));
+
+        // The value is read directly from the memory buffer instead of being copied into the ObjectStream first
+        AZStd::vector<AZ::u8> loadedByteStream;
+        ASSERT_TRUE(Utils::LoadObjectFromBufferInPlace(buffer.data(), buffer.size(), loadedByteStream, m_serializeContext.get()));
+        EXPECT_EQ(byteStream, loadedByteStream);
+
+        // The same data is loaded when the source stream doesn't expose its buffer
+        loadedByteStream.clear();
+        saveStream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+        ASSERT_TRUE(Utils::LoadObjectFromStreamInPlace(saveStream, loadedByteStream, m_serializeContext.get()));
+        EXPECT_EQ(byteStream, loadedByteStream);
+    }
+
     TEST_F(Serialization, AssociativeContainerPtrTest)
     {
         using namespace ContainersTest;
@@ -3602,6 +3632,190 @@ TEST_F(SerializeBasicTest, BasicTypeTest_Succeed)
     }
 
 
+    namespace FlatClone
+    {
+        struct FlatPoint
+        {
+            AZ_TYPE_INFO(FlatPoint, "{3C1B5E0A-8F4D-4B71-A0E6-2D9C7F5B1A38}");
+            AZ_CLASS_ALLOCATOR(FlatPoint, AZ::SystemAllocator);
+
+            float m_x = 0.0f;
+            float m_y = 0.0f;
+            AZ::u8 m_flags = 0;
+        };
+
+        struct FlatShape
+        {
+            AZ_TYPE_INFO(FlatShape, "{A7E94C2D-51B3-4F08-9D6A-E3B2C8174F05}");
+            AZ_CLASS_ALLOCATOR(FlatShape, AZ::SystemAllocator);
+
+            FlatPoint m_min;
+            FlatPoint m_max;
+            double m_area = 0.0;
+            AZ::s64 m_id = 0;
+            bool m_visible = false;
+        };
+
+        struct MixedShape
+        {
+            AZ_TYPE_INFO(MixedShape, "{0E5D8B61-C2F7-4A93-B81E-6F4A0D3C92B7}");
+            AZ_CLASS_ALLOCATOR(MixedShape, AZ::SystemAllocator);
+
+            FlatShape m_bounds;
+            AZStd::string m_name;
+            AZStd::vector<FlatPoint> m_points;
+            int m_layer = 0;
+        };
+
+        void Reflect(AZ::SerializeContext& context)
+        {
+            context.Class<FlatPoint>()
+                ->Field("x", &FlatPoint::m_x)
+                ->Field("y", &FlatPoint::m_y)
+                ->Field("flags", &FlatPoint::m_flags);
+            context.Class<FlatShape>()
+                ->Field("min", &FlatShape::m_min)
+                ->Field("max", &FlatShape::m_max)
+                ->Field("area", &FlatShape::m_area)
+                ->Field("id", &FlatShape::m_id)
+                ->Field("visible", &FlatShape::m_visible);
+            context.Class<MixedShape>()
+                ->Field("bounds", &MixedShape::m_bounds)
+                ->Field("name", &MixedShape::m_name)
+                ->Field("points", &MixedShape::m_points)
+                ->Field("layer", &MixedShape::m_layer);
+        }
+
+        FlatShape CreateFlatShape(int seed)
+        {
+            FlatShape shape;
+            shape.m_min = { 1.0f * seed, 2.0f * seed, static_cast<AZ::u8>(seed) };
+            shape.m_max = { 3.0f * seed, 4.0f * seed, static_cast<AZ::u8>(seed + 1) };
+            shape.m_area = 0.5 * seed;
+            shape.m_id = 1000000000000ll * seed;
+            shape.m_visible = true;
+            return shape;
+        }
+
+        void ExpectEqual(const FlatPoint& expected, const FlatPoint& actual)
+        {
+            EXPECT_EQ(expected.m_x, actual.m_x);
+            EXPECT_EQ(expected.m_y, actual.m_y);
+            EXPECT_EQ(expected.m_flags, actual.m_flags);
+        }
+
+        void ExpectEqual(const FlatShape& expected, const FlatShape& actual)
+        {
+            ExpectEqual(expected.m_min, actual.m_min);
+            ExpectEqual(expected.m_max, actual.m_max);
+            EXPECT_EQ(expected.m_area, actual.m_area);
+            EXPECT_EQ(expected.m_id, actual.m_id);
+            EXPECT_EQ(expected.m_visible, actual.m_visible);
+        }
+    } // namespace FlatClone
+
+    TEST_F(Serialization, Clone_ClassWithOnlyTriviallyCopyableElements_CopiesAllValues)
+    {
+        using namespace FlatClone;
+        Reflect(*m_serializeContext);
+
+        FlatShape shape = CreateFlatShape(3);
+        AZStd::unique_ptr<FlatShape> clone(m_serializeContext->CloneObject(&shape));
+        ASSERT_NE(nullptr, clone);
+        ExpectEqual(shape, *clone);
+
+        // The cached layout is used by the following clones
+        FlatShape otherShape = CreateFlatShape(7);
+        FlatShape inplaceClone;
+        m_serializeContext->CloneObjectInplace(inplaceClone, &otherShape);
+        ExpectEqual(otherShape, inplaceClone);
+
+        m_serializeContext->EnableRemoveReflection();
+        Reflect(*m_serializeContext);
+        m_serializeContext->DisableRemoveReflection();
+    }
+
+    TEST_F(Serialization, Clone_ClassWithTriviallyCopyableAndContainerElements_CopiesAllValues)
+    {
+        using namespace FlatClone;
+        Reflect(*m_serializeContext);
+
+        MixedShape shape;
+        shape.m_bounds = CreateFlatShape(5);
+        shape.m_name = "Shape";
+        shape.m_points = { { 1.0f, 2.0f, 3 }, { 4.0f, 5.0f, 6 } };
+        shape.m_layer = 42;
+
+        AZStd::unique_ptr<MixedShape> clone(m_serializeContext->CloneObject(&shape));
+        ASSERT_NE(nullptr, clone);
+        ExpectEqual(shape.m_bounds, clone->m_bounds);
+        EXPECT_EQ(shape.m_name, clone->m_name);
+        ASSERT_EQ(shape.m_points.size(), clone->m_points.size());
+        for (size_t i = 0; i < shape.m_points.size(); ++i)
+        {
+            ExpectEqual(shape.m_points[i], clone->m_points[i]);
+        }
+        EXPECT_EQ(shape.m_layer, clone->m_layer);
+
+        m_serializeContext->EnableRemoveReflection();
+        Reflect(*m_serializeContext);
+        m_serializeContext->DisableRemoveReflection();
+    }
+
+    namespace CopyOnWriteClone
+    {
+        struct SharedConfig
+        {
+            AZ_TYPE_INFO(SharedConfig, "{0C6E4A1B-7D52-4B3E-A9F0-2E81C5D6B374}");
+            AZStd::vector<int> m_values;
+        };
+
+        struct ConfigOwner
+        {
+            AZ_TYPE_INFO(ConfigOwner, "{A27F3D90-5B1C-4E68-8C4D-91E0F6B2A5C7}");
+            AZ::CopyOnWrite<SharedConfig> m_config;
+            int m_instanceValue = 0;
+        };
+
+        void Reflect(AZ::SerializeContext& context)
+        {
+            context.Class<SharedConfig>()
+                ->Field("values", &SharedConfig::m_values);
+            AZ::CopyOnWrite<SharedConfig>::Reflect(&context);
+            context.Class<ConfigOwner>()
+                ->Field("config", &ConfigOwner::m_config)
+                ->Field("instanceValue", &ConfigOwner::m_instanceValue);
+        }
+    } // namespace CopyOnWriteClone
+
+    TEST_F(Serialization, Clone_CopyOnWriteElement_SharesDataUntilEdited)
+    {
+        using namespace CopyOnWriteClone;
+        Reflect(*m_serializeContext);
+
+        ConfigOwner owner;
+        owner.m_config.Edit().m_values = { 1, 2, 3 };
+        owner.m_instanceValue = 4;
+        EXPECT_FALSE(owner.m_config.IsShared());
+
+        AZStd::unique_ptr<ConfigOwner> clone(m_serializeContext->CloneObject(&owner));
+        ASSERT_NE(nullptr, clone);
+        EXPECT_EQ(4, clone->m_instanceValue);
+        EXPECT_EQ(&owner.m_config.Get(), &clone->m_config.Get());
+        EXPECT_TRUE(owner.m_config.IsShared());
+
+        // Editing the clone detaches it from the source
+        clone->m_config.Edit().m_values.push_back(5);
+        EXPECT_NE(&owner.m_config.Get(), &clone->m_config.Get());
+        EXPECT_FALSE(owner.m_config.IsShared());
+        EXPECT_EQ(3, owner.m_config->m_values.size());
+        EXPECT_EQ(4, clone->m_config->m_values.size());
+
+        m_serializeContext->EnableRemoveReflection();
+        Reflect(*m_serializeContext);
+        m_serializeContext->DisableRemoveReflection();
+    }
+
     // Prove that if a member of a vector of baseclass pointers is unreadable, the container
     // removes the element instead of leaving a null.  This is an arbitrary choice (to remove or leave
     // the null) and this test exists just to prove that the chosen way functions as expected.
@@ -6,7 +6,10 @@
  *
  */
 
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/Json/BasicContainerSerializer.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/list.h>
 #include <AzCore/std/containers/set.h>
@@ -434,4 +437,194 @@ namespace JsonSerializationTests
         EXPECT_EQ(Outcomes::Unavailable, result.GetOutcome());
         EXPECT_NE(instance.end(), instance.find(188));
     }
+
+    // Tests for loading large arrays across the task executor
+
+    class JsonVectorParallelLoadTests
+        : public JsonBasicContainerSerializerTests
+    {
+    public:
+        using Container = AZStd::vector<SimpleClass>;
+        static constexpr size_t ParallelThreshold = 64;
+
+        class TaskGraphActive
+            : public AZ::TaskGraphActiveInterface
+        {
+        public:
+            bool IsTaskGraphActive() const override
+            {
+                return true;
+            }
+        };
+
+        void SetUp() override
+        {
+            JsonBasicContainerSerializerTests::SetUp();
+            m_executor = aznew AZ::TaskExecutor(4);
+            AZ::TaskExecutor::SetInstance(m_executor);
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Register(&m_taskGraphActive);
+        }
+
+        void TearDown() override
+        {
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(&m_taskGraphActive);
+            if (&AZ::TaskExecutor::Instance() == m_executor)
+            {
+                AZ::TaskExecutor::SetInstance(nullptr);
+            }
+            delete m_executor;
+            JsonBasicContainerSerializerTests::TearDown();
+        }
+
+        using JsonBasicContainerSerializerTests::RegisterAdditional;
+        void RegisterAdditional(AZStd::unique_ptr<AZ::SerializeContext>& serializeContext) override
+        {
+            SimpleClass::Reflect(serializeContext, true);
+            serializeContext->RegisterGenericType<Container>();
+        }
+
+        rapidjson::Value CreateArray(size_t count)
+        {
+            rapidjson::Value array(rapidjson::kArrayType);
+            for (size_t i = 0; i < count; ++i)
+            {
+                rapidjson::Value entry(rapidjson::kObjectType);
+                entry.AddMember("var1", rapidjson::Value(static_cast<int>(i)), m_jsonDocument->GetAllocator());
+                entry.AddMember("var2", rapidjson::Value(static_cast<float>(i) * 0.5f), m_jsonDocument->GetAllocator());
+                array.PushBack(AZStd::move(entry), m_jsonDocument->GetAllocator());
+            }
+            return array;
+        }
+
+        //! Loads the array with the given threshold and records the paths of all reported issues
+        AZ::JsonSerializationResult::ResultCode Load(Container& instance, const rapidjson::Value& array, size_t threshold,
+            AZStd::vector<AZStd::string>& reportedPaths)
+        {
+            m_deserializationSettings->m_parallelArrayLoadThreshold = threshold;
+            m_deserializationSettings->m_reporting = [&reportedPaths](AZStd::string_view, AZ::JsonSerializationResult::ResultCode result,
+                AZStd::string_view path) -> AZ::JsonSerializationResult::ResultCode
+            {
+                reportedPaths.emplace_back(path);
+                return result;
+            };
+            ResetJsonContexts();
+            return m_serializer->Load(&instance, azrtti_typeid(&instance), array, *m_jsonDeserializationContext);
+        }
+
+    protected:
+        TaskGraphActive m_taskGraphActive;
+        AZ::TaskExecutor* m_executor = nullptr;
+    };
+
+    TEST_F(JsonVectorParallelLoadTests, Load_ArrayLargerThanThreshold_MatchesSequentialLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        rapidjson::Value testVal = CreateArray(ParallelThreshold * 20);
+
+        Container parallelInstance;
+        AZStd::vector<AZStd::string> parallelReports;
+        ResultCode parallelResult = Load(parallelInstance, testVal, ParallelThreshold, parallelReports);
+
+        Container sequentialInstance;
+        AZStd::vector<AZStd::string> sequentialReports;
+        ResultCode sequentialResult = Load(sequentialInstance, testVal, 0, sequentialReports);
+
+        EXPECT_EQ(Processing::Completed, parallelResult.GetProcessing());
+        EXPECT_EQ(sequentialResult.GetOutcome(), parallelResult.GetOutcome());
+        ASSERT_EQ(testVal.Size(), parallelInstance.size());
+        for (size_t i = 0; i < parallelInstance.size(); ++i)
+        {
+            EXPECT_TRUE(parallelInstance[i].Equals(sequentialInstance[i], true));
+        }
+        EXPECT_EQ(sequentialReports, parallelReports);
+    }
+
+    TEST_F(JsonVectorParallelLoadTests, Load_ArrayWithInvalidEntries_SkipsAndReportsEntriesInOrder)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        rapidjson::Value testVal = CreateArray(ParallelThreshold * 20);
+        testVal[100].SetString("invalid");
+        testVal[700].SetString("invalid");
+
+        Container parallelInstance;
+        AZStd::vector<AZStd::string> parallelReports;
+        ResultCode parallelResult = Load(parallelInstance, testVal, ParallelThreshold, parallelReports);
+
+        Container sequentialInstance;
+        AZStd::vector<AZStd::string> sequentialReports;
+        ResultCode sequentialResult = Load(sequentialInstance, testVal, 0, sequentialReports);
+
+        EXPECT_EQ(sequentialResult.GetProcessing(), parallelResult.GetProcessing());
+        EXPECT_EQ(sequentialResult.GetOutcome(), parallelResult.GetOutcome());
+        ASSERT_EQ(sequentialInstance.size(), parallelInstance.size());
+        EXPECT_LT(parallelInstance.size(), testVal.Size());
+        for (size_t i = 0; i < parallelInstance.size(); ++i)
+        {
+            EXPECT_TRUE(parallelInstance[i].Equals(sequentialInstance[i], true));
+        }
+        EXPECT_EQ(sequentialReports, parallelReports);
+    }
+
+    TEST_F(JsonVectorParallelLoadTests, Load_ReporterHaltsOnInvalidEntry_StopsLoadingAtThatEntry)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        rapidjson::Value testVal = CreateArray(ParallelThreshold * 20);
+        testVal[100].SetString("invalid");
+        testVal[700].SetString("invalid");
+
+        // Halts on the first issue, even though loading could have continued by skipping the entry.
+        auto load = [this, &testVal](Container& instance, size_t threshold, AZStd::vector<AZStd::string>& reportedPaths)
+        {
+            m_deserializationSettings->m_parallelArrayLoadThreshold = threshold;
+            m_deserializationSettings->m_reporting = [&reportedPaths](AZStd::string_view, ResultCode result, AZStd::string_view path)
+            {
+                reportedPaths.emplace_back(path);
+                return result.GetProcessing() == Processing::Completed ? result : ResultCode(result.GetTask(), Outcomes::Catastrophic);
+            };
+            ResetJsonContexts();
+            return m_serializer->Load(&instance, azrtti_typeid(&instance), testVal, *m_jsonDeserializationContext);
+        };
+
+        Container parallelInstance;
+        AZStd::vector<AZStd::string> parallelReports;
+        ResultCode parallelResult = load(parallelInstance, ParallelThreshold, parallelReports);
+
+        Container sequentialInstance;
+        AZStd::vector<AZStd::string> sequentialReports;
+        ResultCode sequentialResult = load(sequentialInstance, 0, sequentialReports);
+
+        EXPECT_EQ(Processing::Halted, sequentialResult.GetProcessing());
+        EXPECT_EQ(Processing::Halted, parallelResult.GetProcessing());
+        EXPECT_EQ(100u, sequentialInstance.size());
+        ASSERT_EQ(sequentialInstance.size(), parallelInstance.size());
+        for (size_t i = 0; i < parallelInstance.size(); ++i)
+        {
+            EXPECT_TRUE(parallelInstance[i].Equals(sequentialInstance[i], true));
+        }
+
+        // The second invalid entry is never reached, so its issue isn't reported either.
+        ASSERT_FALSE(parallelReports.empty());
+        for (const AZStd::string& path : parallelReports)
+        {
+            EXPECT_EQ(AZStd::string::npos, path.find("/700"));
+        }
+    }
+
+    TEST_F(JsonVectorParallelLoadTests, Load_ArraySmallerThanThreshold_LoadsAllEntries)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        rapidjson::Value testVal = CreateArray(ParallelThreshold - 1);
+
+        Container instance;
+        AZStd::vector<AZStd::string> reports;
+        ResultCode result = Load(instance, testVal, ParallelThreshold, reports);
+
+        EXPECT_EQ(Processing::Completed, result.GetProcessing());
+        ASSERT_EQ(testVal.Size(), instance.size());
+        EXPECT_EQ(static_cast<int>(ParallelThreshold - 2), instance.back().m_var1);
+    }
 } // namespace JsonSerializationTests
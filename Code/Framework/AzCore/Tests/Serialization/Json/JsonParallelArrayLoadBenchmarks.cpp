@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonSystemComponent.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace AZ::JsonParallelArrayLoadBenchmarks
+{
+    struct BenchmarkEntry
+    {
+        AZ_TYPE_INFO(BenchmarkEntry, "{6E2B7C51-0D4A-4C36-9F0B-5A8E3D2B91C4}");
+
+        AZStd::string m_name;
+        double m_weight{};
+        int m_index{};
+        bool m_enabled{};
+    };
+
+    class TaskGraphActive
+        : public AZ::TaskGraphActiveInterface
+    {
+    public:
+        bool IsTaskGraphActive() const override
+        {
+            return true;
+        }
+    };
+
+    class JsonParallelArrayLoadBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& st) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+            SetUpHarness();
+        }
+
+        void SetUp(::benchmark::State& st) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+            SetUpHarness();
+        }
+
+        void TearDown(::benchmark::State& st) override
+        {
+            TearDownHarness();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+        }
+
+        void TearDown(const ::benchmark::State& st) override
+        {
+            TearDownHarness();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+        }
+
+        void SetUpHarness()
+        {
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_registrationContext = AZStd::make_unique<AZ::JsonRegistrationContext>();
+            AZ::JsonSystemComponent::Reflect(m_registrationContext.get());
+            m_serializeContext->Class<BenchmarkEntry>()
+                ->Field("Name", &BenchmarkEntry::m_name)
+                ->Field("Weight", &BenchmarkEntry::m_weight)
+                ->Field("Index", &BenchmarkEntry::m_index)
+                ->Field("Enabled", &BenchmarkEntry::m_enabled);
+            m_serializeContext->RegisterGenericType<AZStd::vector<BenchmarkEntry>>();
+
+            m_executor = aznew AZ::TaskExecutor();
+            AZ::TaskExecutor::SetInstance(m_executor);
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Register(&m_taskGraphActive);
+        }
+
+        void TearDownHarness()
+        {
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(&m_taskGraphActive);
+            if (&AZ::TaskExecutor::Instance() == m_executor)
+            {
+                AZ::TaskExecutor::SetInstance(nullptr);
+            }
+            delete m_executor;
+
+            m_registrationContext->EnableRemoveReflection();
+            AZ::JsonSystemComponent::Reflect(m_registrationContext.get());
+            m_registrationContext->DisableRemoveReflection();
+            m_serializeContext->EnableRemoveReflection();
+            m_serializeContext->Class<BenchmarkEntry>();
+            m_serializeContext->RegisterGenericType<AZStd::vector<BenchmarkEntry>>();
+            m_serializeContext->DisableRemoveReflection();
+
+            m_registrationContext.reset();
+            m_serializeContext.reset();
+        }
+
+        rapidjson::Document CreatePayload(int64_t entryCount)
+        {
+            rapidjson::Document document(rapidjson::kArrayType);
+            for (int64_t i = 0; i < entryCount; ++i)
+            {
+                rapidjson::Value entry(rapidjson::kObjectType);
+                AZStd::string name = AZStd::string::format("Entry_%lld", static_cast<long long>(i));
+                entry.AddMember("Name", rapidjson::Value(name.c_str(), static_cast<rapidjson::SizeType>(name.size()), document.GetAllocator()),
+                    document.GetAllocator());
+                entry.AddMember("Weight", rapidjson::Value(static_cast<double>(i) * 0.25), document.GetAllocator());
+                entry.AddMember("Index", rapidjson::Value(static_cast<int>(i)), document.GetAllocator());
+                entry.AddMember("Enabled", rapidjson::Value((i % 2) == 0), document.GetAllocator());
+                document.PushBack(AZStd::move(entry), document.GetAllocator());
+            }
+            return document;
+        }
+
+        void RunLoadBenchmark(::benchmark::State& state, size_t parallelThreshold)
+        {
+            rapidjson::Document payload = CreatePayload(state.range(0));
+
+            AZ::JsonDeserializerSettings settings;
+            settings.m_serializeContext = m_serializeContext.get();
+            settings.m_registrationContext = m_registrationContext.get();
+            settings.m_parallelArrayLoadThreshold = parallelThreshold;
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                AZStd::vector<BenchmarkEntry> entries;
+                AZ::JsonSerialization::Load(entries, payload, settings);
+                benchmark::DoNotOptimize(entries.data());
+            }
+
+            state.SetItemsProcessed(state.range(0) * state.iterations());
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::JsonRegistrationContext> m_registrationContext;
+        TaskGraphActive m_taskGraphActive;
+        AZ::TaskExecutor* m_executor = nullptr;
+    };
+
+    BENCHMARK_DEFINE_F(JsonParallelArrayLoadBenchmarkFixture, LoadArraySequential)(::benchmark::State& state)
+    {
+        RunLoadBenchmark(state, 0);
+    }
+    BENCHMARK_REGISTER_F(JsonParallelArrayLoadBenchmarkFixture, LoadArraySequential)
+        ->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(JsonParallelArrayLoadBenchmarkFixture, LoadArrayParallel)(::benchmark::State& state)
+    {
+        RunLoadBenchmark(state, 1024);
+    }
+    BENCHMARK_REGISTER_F(JsonParallelArrayLoadBenchmarkFixture, LoadArrayParallel)
+        ->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMillisecond);
+} // namespace AZ::JsonParallelArrayLoadBenchmarks
+
+#endif // defined(HAVE_BENCHMARK)
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Settings/SettingsRegistryMergeCache.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace SettingsRegistryMergeCacheTests
+{
+    class SettingsRegistryMergeCacheFixture
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            m_registryFolder = m_tempDirectory.GetDirectoryAsFixedMaxPath() / AZ::SettingsRegistryInterface::RegistryFolder;
+            m_cacheFolder = m_tempDirectory.GetDirectoryAsFixedMaxPath() / "Cache";
+            AZ::Test::CreateTestFile(m_tempDirectory, "Registry/engine.setreg", R"({ "O3DE": { "Value": 1, "Name": "engine" } })");
+            AZ::Test::CreateTestFile(m_tempDirectory, "Registry/project.setreg", R"({ "O3DE": { "Value": 2 } })");
+        }
+
+        //! Creates a registry in the state it would be before merging the settings files
+        AZStd::unique_ptr<AZ::SettingsRegistryImpl> CreateRegistry(bool enableCache = true)
+        {
+            auto registry = AZStd::make_unique<AZ::SettingsRegistryImpl>();
+            registry->Set(AZ::SettingsRegistryMergeCache::EnabledKey, enableCache);
+            registry->Set(AZ::SettingsRegistryMergeCache::FolderKey, m_cacheFolder.c_str());
+            return registry;
+        }
+
+        //! Merges the Registry folder through the cache
+        //! @return True if the settings were loaded from the cache
+        bool MergeWithCache(AZ::SettingsRegistryInterface& registry)
+        {
+            AZ::SettingsRegistryInterface::Specializations specializations{ "test" };
+            AZ::SettingsRegistryMergeCache mergeCache(registry, specializations);
+            if (mergeCache.ApplyCachedSettings())
+            {
+                return true;
+            }
+            mergeCache.StartRecording();
+            EXPECT_TRUE(registry.MergeSettingsFolder(m_registryFolder.Native(), specializations, {}));
+            mergeCache.StopRecordingAndWriteCache();
+            return false;
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        AZ::IO::FixedMaxPath m_registryFolder;
+        AZ::IO::FixedMaxPath m_cacheFolder;
+    };
+
+    TEST_F(SettingsRegistryMergeCacheFixture, ApplyCachedSettings_AfterRecordedMerge_MergesSameSettings)
+    {
+        auto registry = CreateRegistry();
+        EXPECT_FALSE(MergeWithCache(*registry));
+        EXPECT_TRUE(AZ::IO::SystemFile::Exists((m_cacheFolder / AZ::SettingsRegistryMergeCache::CacheFileName).c_str()));
+
+        auto cachedRegistry = CreateRegistry();
+        EXPECT_TRUE(MergeWithCache(*cachedRegistry));
+
+        AZ::s64 value{};
+        EXPECT_TRUE(cachedRegistry->Get(value, "/O3DE/Value"));
+        EXPECT_EQ(2, value);
+        AZ::SettingsRegistryInterface::FixedValueString name;
+        EXPECT_TRUE(cachedRegistry->Get(name, "/O3DE/Name"));
+        EXPECT_EQ("engine", name);
+    }
+
+    TEST_F(SettingsRegistryMergeCacheFixture, ApplyCachedSettings_ModifiedInputFile_MergesFiles)
+    {
+        auto registry = CreateRegistry();
+        EXPECT_FALSE(MergeWithCache(*registry));
+
+        AZ::Test::CreateTestFile(m_tempDirectory, "Registry/project.setreg", R"({ "O3DE": { "Value": 3 } })");
+        auto updatedRegistry = CreateRegistry();
+        EXPECT_FALSE(MergeWithCache(*updatedRegistry));
+
+        AZ::s64 value{};
+        EXPECT_TRUE(updatedRegistry->Get(value, "/O3DE/Value"));
+        EXPECT_EQ(3, value);
+
+        // The cache was rewritten with the updated file
+        auto cachedRegistry = CreateRegistry();
+        EXPECT_TRUE(MergeWithCache(*cachedRegistry));
+        EXPECT_TRUE(cachedRegistry->Get(value, "/O3DE/Value"));
+        EXPECT_EQ(3, value);
+    }
+
+    TEST_F(SettingsRegistryMergeCacheFixture, ApplyCachedSettings_FileAddedToFolder_MergesFiles)
+    {
+        auto registry = CreateRegistry();
+        EXPECT_FALSE(MergeWithCache(*registry));
+
+        AZ::Test::CreateTestFile(m_tempDirectory, "Registry/user.setreg", R"({ "O3DE": { "User": true } })");
+        auto updatedRegistry = CreateRegistry();
+        EXPECT_FALSE(MergeWithCache(*updatedRegistry));
+
+        bool userValue{};
+        EXPECT_TRUE(updatedRegistry->Get(userValue, "/O3DE/User"));
+        EXPECT_TRUE(userValue);
+    }
+
+    TEST_F(SettingsRegistryMergeCacheFixture, ApplyCachedSettings_DifferentRegistryBeforeMerge_MergesFiles)
+    {
+        auto registry = CreateRegistry();
+        EXPECT_FALSE(MergeWithCache(*registry));
+
+        // e.g. a different command line
+        auto otherRegistry = CreateRegistry();
+        otherRegistry->Set("/O3DE/CommandLine", "--project-path=Other");
+        EXPECT_FALSE(MergeWithCache(*otherRegistry));
+    }
+
+    TEST_F(SettingsRegistryMergeCacheFixture, ApplyCachedSettings_CacheDisabled_DoesNotWriteCache)
+    {
+        auto registry = CreateRegistry(false);
+        AZ::SettingsRegistryMergeCache mergeCache(*registry, {});
+        EXPECT_FALSE(mergeCache.IsEnabled());
+        EXPECT_FALSE(MergeWithCache(*registry));
+        EXPECT_FALSE(AZ::IO::SystemFile::Exists((m_cacheFolder / AZ::SettingsRegistryMergeCache::CacheFileName).c_str()));
+
+        AZ::s64 value{};
+        EXPECT_TRUE(registry->Get(value, "/O3DE/Value"));
+        EXPECT_EQ(2, value);
+    }
+} // namespace SettingsRegistryMergeCacheTests
@@ -14,6 +14,8 @@
 #include <AzCore/Serialization/Json/JsonSystemComponent.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/UnitTest/TestTypes.h>
@@ -652,6 +654,93 @@ namespace SettingsRegistryTests
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, type);
     }
 
+    //
+    // Snapshot reads
+    //
+
+    TEST_F(SettingsRegistryTest, SnapshotReads_ReadsAfterModifications_ReturnLatestValues)
+    {
+        m_registry->SetUseSnapshotReads(true);
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Object": { "Value": 42, "Slash/Tilde~Key": "Escaped", "Array": [ 1.5, true ] } })",
+            AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+
+        // Enough reads for the snapshot to be rebuilt, each modification below makes it out of date again
+        for (int i = 0; i < 64; ++i)
+        {
+            AZ::s64 intValue{};
+            EXPECT_TRUE(m_registry->Get(intValue, "/Object/Value"));
+            EXPECT_EQ(42, intValue);
+        }
+
+        AZ::SettingsRegistryInterface::FixedValueString stringValue;
+        EXPECT_TRUE(m_registry->Get(stringValue, "/Object/Slash~1Tilde~0Key"));
+        EXPECT_STREQ("Escaped", stringValue.c_str());
+        double doubleValue{};
+        EXPECT_TRUE(m_registry->Get(doubleValue, "/Object/Array/0"));
+        EXPECT_DOUBLE_EQ(1.5, doubleValue);
+        bool boolValue{};
+        EXPECT_TRUE(m_registry->Get(boolValue, "/Object/Array/1"));
+        EXPECT_TRUE(boolValue);
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Object, m_registry->GetType("/Object"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, m_registry->GetType("/Object/Unknown"));
+
+        ASSERT_TRUE(m_registry->Set("/Object/Value", AZ::s64{ 7 }));
+        AZ::s64 intValue{};
+        EXPECT_TRUE(m_registry->Get(intValue, "/Object/Value"));
+        EXPECT_EQ(7, intValue);
+
+        ASSERT_TRUE(m_registry->Remove("/Object/Value"));
+        for (int i = 0; i < 64; ++i)
+        {
+            EXPECT_FALSE(m_registry->Get(intValue, "/Object/Value"));
+        }
+
+        m_registry->SetUseSnapshotReads(false);
+        ASSERT_TRUE(m_registry->Set("/Object/Value", AZ::s64{ 8 }));
+        EXPECT_TRUE(m_registry->Get(intValue, "/Object/Value"));
+        EXPECT_EQ(8, intValue);
+    }
+
+    TEST_F(SettingsRegistryTest, SnapshotReads_ReadsFromMultipleThreadsWhileWriting_ReturnWrittenValues)
+    {
+        m_registry->SetUseSnapshotReads(true);
+        ASSERT_TRUE(m_registry->Set("/Counter", AZ::u64{ 0 }));
+
+        static constexpr AZ::u64 numWrites = 1000;
+        AZStd::atomic_bool done{ false };
+        AZStd::vector<AZStd::thread> readers;
+        for (int threadIndex = 0; threadIndex < 4; ++threadIndex)
+        {
+            readers.emplace_back([this, &done]()
+            {
+                AZ::u64 previousValue = 0;
+                while (!done.load())
+                {
+                    AZ::u64 value{};
+                    ASSERT_TRUE(m_registry->Get(value, "/Counter"));
+                    // The counter only ever increases
+                    EXPECT_GE(value, previousValue);
+                    EXPECT_LE(value, numWrites);
+                    previousValue = value;
+                }
+            });
+        }
+
+        for (AZ::u64 value = 1; value <= numWrites; ++value)
+        {
+            ASSERT_TRUE(m_registry->Set("/Counter", value));
+        }
+        done = true;
+        for (AZStd::thread& reader : readers)
+        {
+            reader.join();
+        }
+
+        AZ::u64 value{};
+        EXPECT_TRUE(m_registry->Get(value, "/Counter"));
+        EXPECT_EQ(numWrites, value);
+    }
+
     //
     // Visit
     //
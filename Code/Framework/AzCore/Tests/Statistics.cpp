@@ -12,6 +12,7 @@
 #include <AzCore/Math/Crc.h>
 #include <AzCore/std/string/string.h>
 
+#include <AzCore/Statistics/LatencyHistogram.h>
 #include <AzCore/Statistics/StatisticsManager.h>
 
 using namespace AZ;
@@ -260,4 +261,66 @@ namespace UnitTest
         EXPECT_EQ(statsManager.GetStatistic(statName3)->GetNumSamples(), 0);
     }
 
+    TEST_F(StatisticsTest, LatencyHistogram_RecordUniformValues_PercentilesWithinPrecision)
+    {
+        Statistics::LatencyHistogram histogram;
+        EXPECT_EQ(histogram.GetValueAtPercentile(99.0), 0);
+
+        for (AZ::u64 value = 1; value <= 10000; ++value)
+        {
+            histogram.RecordValue(value);
+        }
+
+        EXPECT_EQ(histogram.GetTotalCount(), 10000);
+        EXPECT_EQ(histogram.GetMinimum(), 1);
+        EXPECT_EQ(histogram.GetMaximum(), 10000);
+        EXPECT_EQ(histogram.GetSum(), 50005000);
+
+        // Values are known within 1/128 of their real value
+        EXPECT_NEAR(static_cast<double>(histogram.GetValueAtPercentile(50.0)), 5000.0, 5000.0 / 128.0);
+        EXPECT_NEAR(static_cast<double>(histogram.GetValueAtPercentile(99.0)), 9900.0, 9900.0 / 128.0);
+        EXPECT_NEAR(static_cast<double>(histogram.GetValueAtPercentile(99.9)), 9990.0, 9990.0 / 128.0);
+        EXPECT_EQ(histogram.GetValueAtPercentile(100.0), 10000);
+        EXPECT_EQ(histogram.GetValueAtPercentile(0.0), 1);
+
+        histogram.Reset();
+        EXPECT_EQ(histogram.GetTotalCount(), 0);
+        EXPECT_EQ(histogram.GetValueAtPercentile(50.0), 0);
+    }
+
+    TEST_F(StatisticsTest, LatencyHistogram_MergeHistograms_SameAsRecordingIntoOne)
+    {
+        Statistics::LatencyHistogram first;
+        Statistics::LatencyHistogram second;
+        Statistics::LatencyHistogram combined;
+        for (AZ::u64 value = 0; value < 5000; ++value)
+        {
+            first.RecordValue(value * 3);
+            second.RecordValue(value * 7 + 1000000);
+            combined.RecordValue(value * 3);
+            combined.RecordValue(value * 7 + 1000000);
+        }
+
+        first.Merge(second);
+        EXPECT_EQ(first.GetTotalCount(), combined.GetTotalCount());
+        EXPECT_EQ(first.GetMinimum(), combined.GetMinimum());
+        EXPECT_EQ(first.GetMaximum(), combined.GetMaximum());
+        EXPECT_EQ(first.GetSum(), combined.GetSum());
+        for (double percentile : { 10.0, 50.0, 90.0, 99.0, 99.9 })
+        {
+            EXPECT_EQ(first.GetValueAtPercentile(percentile), combined.GetValueAtPercentile(percentile));
+        }
+    }
+
+    TEST_F(StatisticsTest, LatencyHistogram_BucketBounds_ContainTheirValues)
+    {
+        for (AZ::u64 value : { AZ::u64(0), AZ::u64(127), AZ::u64(128), AZ::u64(255), AZ::u64(256), AZ::u64(1000003), Statistics::LatencyHistogram::MaxTrackableValue })
+        {
+            const size_t bucketIndex = Statistics::LatencyHistogram::GetBucketIndex(value);
+            ASSERT_LT(bucketIndex, Statistics::LatencyHistogram::BucketCount);
+            EXPECT_LE(Statistics::LatencyHistogram::GetBucketLowestValue(bucketIndex), value);
+            EXPECT_GE(Statistics::LatencyHistogram::GetBucketHighestValue(bucketIndex), value);
+        }
+    }
+
 }//namespace UnitTest
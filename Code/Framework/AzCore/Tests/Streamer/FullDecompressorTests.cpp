@@ -210,6 +210,121 @@ namespace AZ::IO
             EXPECT_TRUE(result);
         }
 
+        //! Runs a full compressed read into m_buffer with a parent read request that reports the provided memory type and returns the
+        //! address the decompressor was asked to write to.
+        void* ProcessCompressedReadWithMemoryType(IStreamerTypes::MemoryType memoryType)
+        {
+            void* decompressionTarget = nullptr;
+
+            CompressionInfo compressionInfo;
+            compressionInfo.m_compressedSize = m_fakeFileLength;
+            compressionInfo.m_isCompressed = true;
+            compressionInfo.m_offset = 0;
+            compressionInfo.m_uncompressedSize = m_fakeFileLength;
+            compressionInfo.m_decompressor = [&decompressionTarget](const CompressionInfo&, const void* compressed,
+                size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize) -> bool
+            {
+                decompressionTarget = uncompressed;
+                return Streamer_FullDecompressorTest::Decompressor(false,
+                    compressed, compressedSize, uncompressed, uncompressedBufferSize);
+            };
+
+            FileRequest* readRequest = m_context->GetNewInternalRequest();
+            readRequest->CreateReadRequest(RequestPath(), m_buffer, m_fakeFileLength, 0, m_fakeFileLength,
+                AZStd::chrono::steady_clock::now(), IStreamerTypes::s_priorityMedium);
+            auto readRequestData = AZStd::get_if<Requests::ReadRequestData>(&readRequest->GetCommand());
+            EXPECT_NE(nullptr, readRequestData);
+            readRequestData->m_memoryType = memoryType;
+
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateCompressedRead(readRequest, AZStd::move(compressionInfo), m_buffer, 0, m_fakeFileLength);
+            bool result = true;
+            request->SetCompletionCallback([&result](const FileRequest& request)
+                {
+                    result = result && request.GetStatus() == IStreamerTypes::RequestStatus::Completed;
+                });
+
+            m_decompressor->QueueRequest(request);
+            bool hasCompleted = false;
+            while (m_decompressor->ExecuteRequests() || !hasCompleted)
+            {
+                StreamStackEntry::Status status;
+                m_decompressor->UpdateStatus(status);
+                if (status.m_isIdle)
+                {
+                    hasCompleted = true;
+                }
+
+                m_context->FinalizeCompletedRequests();
+            }
+
+            EXPECT_TRUE(result);
+            return decompressionTarget;
+        }
+
+        //! Runs a compressed read on a file that's split into frames of the given size and checks that only the frames that overlap
+        //! with the requested range are read.
+        void ProcessFramedCompressedRead(u64 offset, u64 size, size_t frameSize, size_t expectedFrameReads)
+        {
+            using ::testing::_;
+            using ::testing::AnyNumber;
+            using ::testing::Return;
+
+            EXPECT_CALL(*m_mock, ExecuteRequests())
+                .WillOnce(Return(true))
+                .WillRepeatedly(Return(false));
+            EXPECT_CALL(*m_mock, QueueRequest(_)).Times(aznumeric_cast<int>(expectedFrameReads));
+            EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+            ON_CALL(*m_mock, QueueRequest(_))
+                .WillByDefault(Invoke(this, &Streamer_FullDecompressorTest::PrepareReadRequest));
+
+            CompressionInfo compressionInfo;
+            compressionInfo.m_compressedSize = m_fakeFileLength;
+            compressionInfo.m_isCompressed = true;
+            compressionInfo.m_offset = 0;
+            compressionInfo.m_uncompressedSize = m_fakeFileLength;
+            compressionInfo.m_uncompressedFrameSize = frameSize;
+            // The fake decompressor copies the data, so the compressed frames line up with the uncompressed frames.
+            for (size_t frameOffset = 0; frameOffset < m_fakeFileLength; frameOffset += frameSize)
+            {
+                compressionInfo.m_frameOffsets.push_back(frameOffset);
+            }
+            compressionInfo.m_frameOffsets.push_back(m_fakeFileLength);
+            compressionInfo.m_decompressor = [](const CompressionInfo&, const void* compressed,
+                size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize) -> bool
+            {
+                return Streamer_FullDecompressorTest::Decompressor(false,
+                    compressed, compressedSize, uncompressed, uncompressedBufferSize);
+            };
+
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateCompressedRead(nullptr, AZStd::move(compressionInfo), m_buffer, offset, size);
+            bool result = true;
+            size_t completionCount = 0;
+            request->SetCompletionCallback([&result, &completionCount](const FileRequest& request)
+                {
+                    result = result && request.GetStatus() == IStreamerTypes::RequestStatus::Completed;
+                    ++completionCount;
+                });
+
+            m_decompressor->QueueRequest(request);
+            bool hasCompleted = false;
+            while (m_decompressor->ExecuteRequests() || !hasCompleted)
+            {
+                StreamStackEntry::Status status;
+                m_decompressor->UpdateStatus(status);
+                if (status.m_isIdle)
+                {
+                    hasCompleted = true;
+                }
+
+                m_context->FinalizeCompletedRequests();
+            }
+
+            EXPECT_TRUE(result);
+            EXPECT_EQ(1, completionCount);
+        }
+
         void ProcessMultipleCompressedReads()
         {
             using ::testing::_;
@@ -348,6 +463,54 @@ namespace AZ::IO
         ProcessCompressedRead(0, m_fakeFileLength, CompressionState::Corrupted, IStreamerTypes::RequestStatus::Failed);
     }
 
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FullFramedRead_SuccessfullyReadData)
+    {
+        SetupEnvironment(4, 4);
+        ProcessFramedCompressedRead(0, m_fakeFileLength, 64 * 1024, 16);
+        VerifyReadBuffer(0, m_fakeFileLength);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FullFramedReadWithSmallerLastFrame_SuccessfullyReadData)
+    {
+        SetupEnvironment(4, 4);
+        ProcessFramedCompressedRead(0, m_fakeFileLength, 96 * 1024, 11);
+        VerifyReadBuffer(0, m_fakeFileLength);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_PartialFramedRead_OnlyOverlappingFramesAreRead)
+    {
+        SetupEnvironment(2, 2);
+        // Starts 256 bytes into the second frame and ends 256 bytes into the fourth frame.
+        ProcessFramedCompressedRead(64 * 1024 + 256, 2 * 64 * 1024, 64 * 1024, 3);
+        VerifyReadBuffer(64 * 1024 + 256, 2 * 64 * 1024);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FullFramedReadWithSingleReadAndJob_SuccessfullyReadData)
+    {
+        SetupEnvironment(1, 1);
+        ProcessFramedCompressedRead(0, m_fakeFileLength, 256 * 1024, 4);
+        VerifyReadBuffer(0, m_fakeFileLength);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FullReadIntoReadWriteMemory_DecompressesDirectlyIntoOutput)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        void* target = ProcessCompressedReadWithMemoryType(IStreamerTypes::MemoryType::ReadWrite);
+        EXPECT_EQ(m_buffer, target);
+        VerifyReadBuffer(0, m_fakeFileLength);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FullReadIntoWriteCombinedMemory_DecompressesIntoTemporaryBuffer)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        void* target = ProcessCompressedReadWithMemoryType(IStreamerTypes::MemoryType::WriteCombined);
+        EXPECT_NE(nullptr, target);
+        EXPECT_NE(m_buffer, target);
+        VerifyReadBuffer(0, m_fakeFileLength);
+    }
+
     TEST_F(Streamer_FullDecompressorTest, DecompressedRead_MultipleRequestsWithSingleJob_AllRequestsComplete)
     {
         SetupEnvironment(4, 1);
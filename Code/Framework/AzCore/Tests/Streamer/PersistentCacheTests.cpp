@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/PersistentCache.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class PersistentCacheTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<PersistentCache>
+    {
+    public:
+        PersistentCache CreateInstance() override
+        {
+            return PersistentCache(m_tempDirectory.GetDirectoryAsPath(), 1_mib, 64 * 1024, AZCORE_GLOBAL_NEW_ALIGNMENT);
+        }
+
+        bool UsesSlots() const override
+        {
+            return false;
+        }
+
+    private:
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_PersistentCacheConformityTests, StreamStackEntryConformityTests, PersistentCacheTestDescription);
+
+    class Streamer_PersistentCacheTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            m_sourcePath = m_sourceDirectory.GetDirectoryAsPath() / "Test.bin";
+            WriteSourceFile(1024);
+            m_path = RequestPath(AZ::IO::PathView(m_sourcePath));
+            m_context = AZStd::make_unique<StreamerContext>();
+            CreateCache();
+        }
+
+        void TearDown() override
+        {
+            m_cache = nullptr;
+            m_mock = nullptr;
+            m_context.reset();
+        }
+
+        void CreateCache()
+        {
+            using ::testing::_;
+            using ::testing::AnyNumber;
+            using ::testing::Invoke;
+            using ::testing::Return;
+
+            m_cache = nullptr;
+            m_cache = AZStd::make_shared<PersistentCache>(
+                m_tempDirectory.GetDirectoryAsPath(), m_cacheSize, m_maxEntrySize, AZCORE_GLOBAL_NEW_ALIGNMENT);
+            m_mock = AZStd::make_shared<StreamStackEntryMock>();
+            m_cache->SetNext(m_mock);
+            EXPECT_CALL(*m_mock, SetContext(_)).Times(1);
+            m_cache->SetContext(*m_context);
+
+            EXPECT_CALL(*m_mock, ExecuteRequests()).WillRepeatedly(Return(false));
+            EXPECT_CALL(*m_mock, QueueRequest(_)).Times(AnyNumber());
+            EXPECT_CALL(*m_mock, PrepareRequest(_))
+                .WillRepeatedly(Invoke(this, &Streamer_PersistentCacheTest::CompleteForwardedRead));
+        }
+
+        // Writes the source file the reads are cached for. The content doesn't matter as the reads are completed by the mock.
+        void WriteSourceFile(size_t size)
+        {
+            AZStd::vector<u8> content(size, 0);
+            SystemFile file;
+            ASSERT_TRUE(file.Open(m_sourcePath.c_str(),
+                SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH | SystemFile::SF_OPEN_WRITE_ONLY));
+            EXPECT_EQ(size, file.Write(content.data(), size));
+            file.Close();
+        }
+
+        FileRequest* PrepareRead(AZStd::vector<u8>& buffer, u64 offset, u64 size, IStreamerTypes::RequestStatus& result)
+        {
+            buffer.resize(size);
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateReadRequest(m_path, buffer.data(), size, offset, size,
+                FileRequest::s_noDeadlineTime, IStreamerTypes::s_priorityMedium);
+            request->SetCompletionCallback([&result](FileRequest& request)
+                {
+                    result = request.GetStatus();
+                });
+
+            m_cache->PrepareRequest(request);
+            return request;
+        }
+
+        // Simulates the rest of the stack by filling the output with a pattern based on the file offset.
+        void CompleteForwardedRead(FileRequest* request)
+        {
+            auto data = AZStd::get_if<Requests::ReadRequestData>(&request->GetCommand());
+            ASSERT_NE(nullptr, data);
+            m_forwardedReadCount++;
+
+            u8* output = reinterpret_cast<u8*>(data->m_output);
+            for (u64 i = 0; i < data->m_size; ++i)
+            {
+                output[i] = aznumeric_cast<u8>((data->m_offset + i) & 0xff);
+            }
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        void RunProcessLoop()
+        {
+            do
+            {
+                while (m_context->FinalizeCompletedRequests())
+                {
+                }
+            } while (m_cache->ExecuteRequests());
+        }
+
+        void ProcessRead(u64 offset, u64 size, IStreamerTypes::RequestStatus expectedResult = IStreamerTypes::RequestStatus::Completed)
+        {
+            AZStd::vector<u8> buffer;
+            IStreamerTypes::RequestStatus result = IStreamerTypes::RequestStatus::Pending;
+            PrepareRead(buffer, offset, size, result);
+            RunProcessLoop();
+
+            EXPECT_EQ(expectedResult, result);
+            if (expectedResult == IStreamerTypes::RequestStatus::Completed)
+            {
+                for (u64 i = 0; i < size; ++i)
+                {
+                    // Using assert here because in case of a problem EXPECT would cause a large amount of log noise.
+                    ASSERT_EQ((offset + i) & 0xff, buffer[i]);
+                }
+            }
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        AZ::Test::ScopedAutoTempDirectory m_sourceDirectory;
+        AZ::IO::Path m_sourcePath;
+        AZStd::unique_ptr<StreamerContext> m_context;
+        AZStd::shared_ptr<PersistentCache> m_cache;
+        AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+        RequestPath m_path;
+
+        u64 m_cacheSize{ 256 * 1024 };
+        u64 m_maxEntrySize{ 64 * 1024 };
+        size_t m_forwardedReadCount{ 0 };
+    };
+
+    TEST_F(Streamer_PersistentCacheTest, Read_FirstRead_ReadIsForwardedAndStored)
+    {
+        ProcessRead(0, 1024);
+
+        EXPECT_EQ(1, m_forwardedReadCount);
+        EXPECT_EQ(1, m_cache->GetNumCacheEntries());
+        EXPECT_EQ(1024, m_cache->GetUsedCacheSize());
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, Read_RepeatedRead_SecondReadIsServicedFromCache)
+    {
+        ProcessRead(0, 1024);
+        ProcessRead(0, 1024);
+
+        EXPECT_EQ(1, m_forwardedReadCount);
+        EXPECT_EQ(1, m_cache->GetNumCacheEntries());
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, Read_ReadWithinCachedRange_ReadIsServicedFromCache)
+    {
+        ProcessRead(256, 4096);
+        ProcessRead(512, 1024);
+
+        EXPECT_EQ(1, m_forwardedReadCount);
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, Read_ReadPartiallyOutsideCachedRange_ReadIsForwarded)
+    {
+        ProcessRead(0, 1024);
+        ProcessRead(512, 1024);
+
+        EXPECT_EQ(2, m_forwardedReadCount);
+        EXPECT_EQ(2, m_cache->GetNumCacheEntries());
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, Read_ReadLargerThanMaxEntrySize_ReadIsPassedThroughWithoutCaching)
+    {
+        ProcessRead(0, m_maxEntrySize + 1);
+
+        EXPECT_EQ(1, m_forwardedReadCount);
+        EXPECT_EQ(0, m_cache->GetNumCacheEntries());
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, Read_CacheRecreated_CachedDataIsKeptBetweenInstances)
+    {
+        ProcessRead(0, 1024);
+        ProcessRead(4096, 2048);
+        CreateCache();
+
+        EXPECT_EQ(2, m_cache->GetNumCacheEntries());
+        EXPECT_EQ(3072, m_cache->GetUsedCacheSize());
+
+        ProcessRead(0, 1024);
+        ProcessRead(4096, 2048);
+        EXPECT_EQ(2, m_forwardedReadCount);
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, Read_SourceFileChangedBetweenInstances_StaleEntriesAreDiscarded)
+    {
+        ProcessRead(0, 1024);
+        ProcessRead(4096, 2048);
+        WriteSourceFile(2048);
+        CreateCache();
+
+        ProcessRead(0, 1024);
+        EXPECT_EQ(3, m_forwardedReadCount);
+        EXPECT_EQ(1, m_cache->GetNumCacheEntries());
+        EXPECT_EQ(1024, m_cache->GetUsedCacheSize());
+
+        ProcessRead(0, 1024);
+        EXPECT_EQ(3, m_forwardedReadCount);
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, Read_SourceFileMissing_ReadIsPassedThroughWithoutCaching)
+    {
+        m_path = RequestPath(AZ::IO::PathView(m_sourceDirectory.GetDirectoryAsPath() / "Missing.bin"));
+        ProcessRead(0, 1024);
+        ProcessRead(0, 1024);
+
+        EXPECT_EQ(2, m_forwardedReadCount);
+        EXPECT_EQ(0, m_cache->GetNumCacheEntries());
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, Read_CacheFull_LeastRecentlyUsedEntryIsEvicted)
+    {
+        const u64 readSize = m_cacheSize / 4;
+        ProcessRead(0, readSize);
+        ProcessRead(readSize, readSize);
+        ProcessRead(2 * readSize, readSize);
+        ProcessRead(3 * readSize, readSize);
+        // Touch the first entry so the second entry becomes the oldest.
+        ProcessRead(0, readSize);
+        EXPECT_EQ(4, m_forwardedReadCount);
+
+        ProcessRead(4 * readSize, readSize);
+        EXPECT_EQ(5, m_forwardedReadCount);
+        EXPECT_EQ(4, m_cache->GetNumCacheEntries());
+        EXPECT_EQ(m_cacheSize, m_cache->GetUsedCacheSize());
+
+        ProcessRead(0, readSize);
+        EXPECT_EQ(5, m_forwardedReadCount);
+        ProcessRead(readSize, readSize);
+        EXPECT_EQ(6, m_forwardedReadCount);
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, FlushCache_FlushCachedFile_EntriesAreRemoved)
+    {
+        ProcessRead(0, 1024);
+        ProcessRead(4096, 1024);
+
+        m_cache->FlushCache(m_path);
+        EXPECT_EQ(0, m_cache->GetNumCacheEntries());
+        EXPECT_EQ(0, m_cache->GetUsedCacheSize());
+
+        ProcessRead(0, 1024);
+        EXPECT_EQ(3, m_forwardedReadCount);
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, FlushCache_FlushWhileFillIsInFlight_FilledDataIsDeliveredButNotCached)
+    {
+        AZStd::vector<u8> buffer;
+        IStreamerTypes::RequestStatus result = IStreamerTypes::RequestStatus::Pending;
+        PrepareRead(buffer, 0, 1024, result);
+        // The fill has been read by the next node, but the cache hasn't processed its completion yet.
+        m_cache->FlushCache(m_path);
+        RunProcessLoop();
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, result);
+        for (u64 i = 0; i < buffer.size(); ++i)
+        {
+            ASSERT_EQ(i & 0xff, buffer[i]);
+        }
+        EXPECT_EQ(0, m_cache->GetNumCacheEntries());
+
+        ProcessRead(0, 1024);
+        EXPECT_EQ(2, m_forwardedReadCount);
+        EXPECT_EQ(1, m_cache->GetNumCacheEntries());
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, FlushCache_FlushOtherFile_EntriesAreKept)
+    {
+        ProcessRead(0, 1024);
+
+        m_cache->FlushCache(RequestPath("Other"));
+        EXPECT_EQ(1, m_cache->GetNumCacheEntries());
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, FlushEntireCache_AfterReads_CacheIsEmpty)
+    {
+        ProcessRead(0, 1024);
+        ProcessRead(4096, 1024);
+
+        m_cache->FlushEntireCache();
+        EXPECT_EQ(0, m_cache->GetNumCacheEntries());
+        EXPECT_EQ(0, m_cache->GetUsedCacheSize());
+    }
+} // namespace AZ::IO
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/Prefetcher.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class PrefetcherTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<Prefetcher>
+    {
+    public:
+        Prefetcher CreateInstance() override
+        {
+            Prefetcher::Settings settings;
+            settings.m_maxMemory = 1_mib;
+            settings.m_maxGap = 4_kib;
+            settings.m_maxCombinedReadSize = 256_kib;
+            return Prefetcher(m_tempDirectory.GetDirectoryAsPath(), settings);
+        }
+
+        bool UsesSlots() const override
+        {
+            return false;
+        }
+
+    private:
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_PrefetcherConformityTests, StreamStackEntryConformityTests, PrefetcherTestDescription);
+
+    class Streamer_PrefetcherTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            using ::testing::_;
+            using ::testing::AnyNumber;
+            using ::testing::Invoke;
+            using ::testing::Return;
+
+            m_path = "Test";
+            m_context = AZStd::make_unique<StreamerContext>();
+
+            m_settings.m_maxMemory = 64_kib;
+            m_settings.m_maxGap = 1_kib;
+            m_settings.m_maxCombinedReadSize = 16_kib;
+            m_settings.m_maxPendingPrefetches = 2;
+            m_prefetcher = AZStd::make_shared<Prefetcher>(m_tempDirectory.GetDirectoryAsPath(), m_settings);
+            m_mock = AZStd::make_shared<StreamStackEntryMock>();
+            m_prefetcher->SetNext(m_mock);
+            EXPECT_CALL(*m_mock, SetContext(_)).Times(1);
+            m_prefetcher->SetContext(*m_context);
+
+            EXPECT_CALL(*m_mock, ExecuteRequests()).WillRepeatedly(Return(false));
+            EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+            EXPECT_CALL(*m_mock, PrepareRequest(_))
+                .WillRepeatedly(Invoke(this, &Streamer_PrefetcherTest::CompleteForwardedRead));
+        }
+
+        void TearDown() override
+        {
+            m_prefetcher = nullptr;
+            m_mock = nullptr;
+            m_context.reset();
+        }
+
+        // Simulates the rest of the stack by filling the output with a pattern based on the file offset.
+        void CompleteForwardedRead(FileRequest* request)
+        {
+            auto data = AZStd::get_if<Requests::ReadRequestData>(&request->GetCommand());
+            ASSERT_NE(nullptr, data);
+            if (data->m_priority == IStreamerTypes::s_priorityLowest)
+            {
+                m_prefetchCount++;
+            }
+            else
+            {
+                m_demandReadCount++;
+            }
+
+            u8* output = reinterpret_cast<u8*>(data->m_output);
+            for (u64 i = 0; i < data->m_size; ++i)
+            {
+                output[i] = aznumeric_cast<u8>((data->m_offset + i) & 0xff);
+            }
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        void RunProcessLoop()
+        {
+            do
+            {
+                while (m_context->FinalizeCompletedRequests())
+                {
+                }
+            } while (m_prefetcher->ExecuteRequests());
+        }
+
+        void ProcessRead(u64 offset, u64 size)
+        {
+            AZStd::vector<u8> buffer(size);
+            IStreamerTypes::RequestStatus result = IStreamerTypes::RequestStatus::Pending;
+
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateReadRequest(m_path, buffer.data(), size, offset, size,
+                FileRequest::s_noDeadlineTime, IStreamerTypes::s_priorityMedium);
+            request->SetCompletionCallback([&result](FileRequest& request)
+                {
+                    result = request.GetStatus();
+                });
+
+            m_prefetcher->PrepareRequest(request);
+            RunProcessLoop();
+
+            EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, result);
+            for (u64 i = 0; i < size; ++i)
+            {
+                // Using assert here because in case of a problem EXPECT would cause a large amount of log noise.
+                ASSERT_EQ((offset + i) & 0xff, buffer[i]);
+            }
+        }
+
+        void RecordSession(AZStd::initializer_list<AZStd::pair<u64, u64>> reads)
+        {
+            m_prefetcher->BeginSession(SessionName);
+            for (auto& [offset, size] : reads)
+            {
+                ProcessRead(offset, size);
+            }
+            m_prefetcher->EndSession();
+            m_demandReadCount = 0;
+        }
+
+        static constexpr char SessionName[] = "Level";
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        AZStd::unique_ptr<StreamerContext> m_context;
+        AZStd::shared_ptr<Prefetcher> m_prefetcher;
+        AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+        Prefetcher::Settings m_settings;
+        RequestPath m_path;
+
+        size_t m_demandReadCount{ 0 };
+        size_t m_prefetchCount{ 0 };
+    };
+
+    TEST_F(Streamer_PrefetcherTest, BeginSession_NoManifest_NothingIsPrefetched)
+    {
+        m_prefetcher->BeginSession(SessionName);
+        RunProcessLoop();
+
+        EXPECT_EQ(0, m_prefetcher->GetNumPlannedPrefetches());
+        EXPECT_EQ(0, m_prefetchCount);
+        m_prefetcher->EndSession();
+    }
+
+    TEST_F(Streamer_PrefetcherTest, EndSession_AfterReads_ManifestIsWritten)
+    {
+        RecordSession({ { 0, 1024 } });
+
+        AZ::IO::Path manifestPath = m_tempDirectory.GetDirectoryAsPath() / "Level.prefetch";
+        EXPECT_TRUE(SystemFile::Exists(manifestPath.c_str()));
+    }
+
+    TEST_F(Streamer_PrefetcherTest, BeginSession_RecordedReads_ReadsArePrefetchedAndServedFromMemory)
+    {
+        RecordSession({ { 0, 1024 }, { 32_kib, 1024 } });
+
+        m_prefetcher->BeginSession(SessionName);
+        EXPECT_EQ(2, m_prefetcher->GetNumPlannedPrefetches());
+        RunProcessLoop();
+        EXPECT_EQ(2, m_prefetchCount);
+
+        ProcessRead(0, 1024);
+        ProcessRead(32_kib, 1024);
+        EXPECT_EQ(0, m_demandReadCount);
+        EXPECT_EQ(0, m_prefetcher->GetUsedMemory());
+        m_prefetcher->EndSession();
+    }
+
+    TEST_F(Streamer_PrefetcherTest, BeginSession_NearbyReads_ReadsAreCombined)
+    {
+        // The first three reads are within the maximum gap of each other. The last read is too far away.
+        RecordSession({ { 0, 1024 }, { 1536, 1024 }, { 3072, 512 }, { 8_kib, 1024 } });
+
+        m_prefetcher->BeginSession(SessionName);
+        EXPECT_EQ(2, m_prefetcher->GetNumPlannedPrefetches());
+        RunProcessLoop();
+        EXPECT_EQ(2, m_prefetchCount);
+
+        ProcessRead(0, 1024);
+        ProcessRead(1536, 1024);
+        ProcessRead(3072, 512);
+        ProcessRead(8_kib, 1024);
+        EXPECT_EQ(0, m_demandReadCount);
+        m_prefetcher->EndSession();
+    }
+
+    TEST_F(Streamer_PrefetcherTest, BeginSession_CombinedReadTooLarge_ReadsAreNotCombined)
+    {
+        RecordSession({ { 0, 12_kib }, { 12_kib, 12_kib } });
+
+        m_prefetcher->BeginSession(SessionName);
+        EXPECT_EQ(2, m_prefetcher->GetNumPlannedPrefetches());
+        m_prefetcher->EndSession();
+    }
+
+    TEST_F(Streamer_PrefetcherTest, ExecuteRequests_MemoryLimitReached_PrefetchingWaitsForDemand)
+    {
+        RecordSession({ { 0, 16_kib }, { 64_kib, 16_kib }, { 128_kib, 16_kib }, { 192_kib, 16_kib }, { 256_kib, 16_kib } });
+
+        m_prefetcher->BeginSession(SessionName);
+        RunProcessLoop();
+        EXPECT_EQ(4, m_prefetchCount);
+        EXPECT_EQ(m_settings.m_maxMemory, m_prefetcher->GetUsedMemory());
+
+        // Using the first block frees up memory for the last prefetch.
+        ProcessRead(0, 16_kib);
+        EXPECT_EQ(5, m_prefetchCount);
+        EXPECT_EQ(0, m_demandReadCount);
+        m_prefetcher->EndSession();
+    }
+
+    TEST_F(Streamer_PrefetcherTest, FlushCache_PrefetchedFile_DataIsReleasedAndReadIsForwarded)
+    {
+        RecordSession({ { 0, 1024 } });
+
+        m_prefetcher->BeginSession(SessionName);
+        RunProcessLoop();
+        m_prefetcher->FlushCache(m_path);
+        EXPECT_EQ(0, m_prefetcher->GetUsedMemory());
+
+        ProcessRead(0, 1024);
+        EXPECT_EQ(1, m_demandReadCount);
+        m_prefetcher->EndSession();
+    }
+
+    TEST_F(Streamer_PrefetcherTest, EndSession_UnusedPrefetches_MemoryIsReleased)
+    {
+        RecordSession({ { 0, 1024 }, { 32_kib, 1024 } });
+
+        m_prefetcher->BeginSession(SessionName);
+        RunProcessLoop();
+        EXPECT_LT(0, m_prefetcher->GetUsedMemory());
+
+        m_prefetcher->EndSession();
+        EXPECT_EQ(0, m_prefetcher->GetUsedMemory());
+        EXPECT_EQ(0, m_prefetcher->GetNumPlannedPrefetches());
+    }
+
+    TEST_F(Streamer_PrefetcherTest, QueueRequest_SessionCommand_CommandIsHandledAndCompleted)
+    {
+        using ::testing::_;
+
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(0);
+
+        PrefetchSessionCommand command;
+        command.m_action = PrefetchSessionCommand::Action::Begin;
+        command.m_name = SessionName;
+
+        IStreamerTypes::RequestStatus result = IStreamerTypes::RequestStatus::Pending;
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateCustom(AZStd::move(command));
+        request->SetCompletionCallback([&result](FileRequest& request)
+            {
+                result = request.GetStatus();
+            });
+        m_prefetcher->QueueRequest(request);
+        RunProcessLoop();
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, result);
+        EXPECT_TRUE(m_prefetcher->IsSessionActive());
+        m_prefetcher->EndSession();
+    }
+} // namespace AZ::IO
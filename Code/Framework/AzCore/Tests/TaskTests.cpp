@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Task/TaskCoroutine.h>
 #include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Memory/PoolAllocator.h>
@@ -547,6 +548,90 @@ namespace UnitTest
         ev.Wait();
     }
 
+    TEST_F(TaskGraphTestFixture, NestedSubgraph)
+    {
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph{ "NestedSubgraph" };
+        TaskGraph subgraph{ "InnerNestedSubgraph" };
+        auto e = subgraph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x ^= 0b1000;
+            });
+        auto f = subgraph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x ^= 0b10000;
+            });
+        auto g = subgraph.AddTask(
+            defaultTD,
+            [&]
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(5));
+                x += 0b1000;
+            });
+        e.Precedes(g);
+        f.Precedes(g);
+
+        graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x = 0b111;
+                // The outer event is not signaled before the nested graph completes, and no worker blocks
+                subgraph.SubmitNested();
+            });
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(0b111 | 0b100000, x);
+    }
+
+    TEST_F(TaskGraphTestFixture, ContinuationChain)
+    {
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph first{ "ContinuationFirst" };
+        TaskGraph second{ "ContinuationSecond" };
+        TaskGraph third{ "ContinuationThird" };
+        first.AddTask(
+            defaultTD,
+            [&]
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(5));
+                x = 1;
+            });
+        second.AddTask(
+            defaultTD,
+            [&]
+            {
+                x *= 3;
+            });
+        third.AddTask(
+            defaultTD,
+            [&]
+            {
+                x += 2;
+            });
+        first.SetContinuation(&second);
+        second.SetContinuation(&third);
+
+        for (int i = 0; i != 2; ++i)
+        {
+            x = 0;
+            TaskGraphEvent ev{ "ev" };
+            first.SubmitOnExecutor(*m_executor, &ev);
+            ev.Wait();
+
+            EXPECT_EQ(5, x);
+        }
+    }
+
     TEST_F(TaskGraphTestFixture, RetainedGraph)
     {
         AZStd::atomic<int> x = 0;
@@ -624,6 +709,107 @@ namespace UnitTest
 
         EXPECT_EQ(3 | 0b100000, x);
     }
+
+    TEST_F(TaskGraphTestFixture, FanOutExceedingInitialQueueCapacity)
+    {
+        // More root tasks than the 16 bit ring that each worker queue used to be limited to
+        constexpr int numTasks = 0x10000 + 1024;
+        AZStd::atomic_int32_t x = 0;
+
+        TaskGraph graph{ "FanOutExceedingInitialQueueCapacity" };
+        for (int i = 0; i != numTasks; ++i)
+        {
+            graph.AddTask(
+                defaultTD,
+                [&x]
+                {
+                    ++x;
+                });
+        }
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(numTasks, x);
+    }
+
+    TEST_F(TaskGraphTestFixture, WorkerStatisticsAccountForAllTasks)
+    {
+        constexpr int numTasks = 256;
+        AZStd::atomic_int32_t x = 0;
+
+        AZ::u64 executedBefore = 0;
+        for (uint32_t i = 0; i != m_executor->GetWorkerCount(); ++i)
+        {
+            executedBefore += m_executor->GetWorkerStatistics(i).m_tasksExecuted;
+        }
+
+        TaskGraph graph{ "WorkerStatisticsAccountForAllTasks" };
+        for (int i = 0; i != numTasks; ++i)
+        {
+            // Uneven task cost encourages idle workers to steal from their peers
+            graph.AddTask(
+                defaultTD,
+                [&x, i]
+                {
+                    if (i % 16 == 0)
+                    {
+                        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+                    }
+                    ++x;
+                });
+        }
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(numTasks, x);
+
+        AZ::u64 executedAfter = 0;
+        AZ::u64 stolen = 0;
+        for (uint32_t i = 0; i != m_executor->GetWorkerCount(); ++i)
+        {
+            const AZ::TaskWorkerStatistics statistics = m_executor->GetWorkerStatistics(i);
+            executedAfter += statistics.m_tasksExecuted;
+            stolen += statistics.m_tasksStolen;
+        }
+        EXPECT_EQ(numTasks, executedAfter - executedBefore);
+        EXPECT_LE(stolen, executedAfter);
+    }
+
+#if defined(AZ_TASK_COROUTINES_ENABLED)
+    static AZ::TaskCoroutine<int> MultiplyOnExecutor(TaskExecutor& executor, int value)
+    {
+        co_await AZ::ResumeOn(executor);
+        co_return value * 2;
+    }
+
+    static AZ::TaskCoroutine<> AccumulateOnExecutor(TaskExecutor& executor, AZStd::atomic<int>& result, AZStd::binary_semaphore& done)
+    {
+        co_await AZ::ResumeOn(executor);
+        EXPECT_EQ(&executor, TaskExecutor::GetCurrentExecutor());
+
+        int total = 0;
+        for (int i = 1; i <= 4; ++i)
+        {
+            total += co_await MultiplyOnExecutor(executor, i);
+        }
+        result = total;
+        done.release();
+    }
+
+    TEST_F(TaskGraphTestFixture, CoroutineResumesOnExecutor)
+    {
+        AZStd::atomic<int> result = 0;
+        AZStd::binary_semaphore done;
+        AccumulateOnExecutor(*m_executor, result, done).Launch(*m_executor);
+        done.acquire();
+
+        EXPECT_EQ(20, result);
+    }
+#endif // defined(AZ_TASK_COROUTINES_ENABLED)
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -6,8 +6,15 @@
  *
  */
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Component/TickBusDispatcher.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/sort.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 using namespace AZ;
@@ -65,3 +72,160 @@ TEST_F(OrderedTickBus, OnTick_HandlersFireInSortedOrder)
     // check the order they actually fired in
     EXPECT_EQ(actualTickOrder, sortedOrder);
 }
+
+// TickBus handler that declares the data it reads and writes, so it can be ticked in parallel.
+// When ticked it pushes its name into a list shared by all the handlers.
+struct ParallelTicker : public TickBus::Handler
+{
+    int m_order = TICK_DEFAULT; ///< Relative order on TickBus
+    bool m_declareAccess = true;
+    AZStd::vector<Crc32> m_reads;
+    AZStd::vector<Crc32> m_writes;
+    char m_name = ' ';
+    AZStd::mutex* m_targetMutex = nullptr;
+    AZStd::vector<char>* m_targetList = nullptr; ///< OnTick, push name into this list
+    AZStd::vector<ParallelTicker*> m_disconnectOnTick; ///< OnTick, disconnect these handlers
+
+    ///////////////////////////////////////////////////////////////////////////
+    // TickBus
+    int GetTickOrder() override { return m_order; }
+
+    bool GetTickDataAccess(TickDataAccess& access) override
+    {
+        access.m_reads = m_reads;
+        access.m_writes = m_writes;
+        return m_declareAccess;
+    }
+
+    void OnTick(float /*deltaTime*/, ScriptTimePoint /*time*/) override
+    {
+        {
+            AZStd::scoped_lock lock(*m_targetMutex);
+            m_targetList->push_back(m_name);
+        }
+        for (ParallelTicker* ticker : m_disconnectOnTick)
+        {
+            ticker->TickBus::Handler::BusDisconnect();
+        }
+    }
+    ///////////////////////////////////////////////////////////////////////////
+};
+
+class ParallelTickBus : public UnitTest::LeakDetectionFixture
+{
+public:
+    class TaskGraphActive : public TaskGraphActiveInterface
+    {
+    public:
+        bool IsTaskGraphActive() const override
+        {
+            return true;
+        }
+    };
+
+    void SetUp() override
+    {
+        m_executor = aznew TaskExecutor(4);
+        TaskExecutor::SetInstance(m_executor);
+        Interface<TaskGraphActiveInterface>::Register(&m_taskGraphActive);
+    }
+
+    void TearDown() override
+    {
+        m_tickers.clear();
+        Interface<TaskGraphActiveInterface>::Unregister(&m_taskGraphActive);
+        if (&TaskExecutor::Instance() == m_executor)
+        {
+            TaskExecutor::SetInstance(nullptr);
+        }
+        delete m_executor;
+    }
+
+    ParallelTicker& AddTicker(char name, int order, AZStd::vector<Crc32> reads, AZStd::vector<Crc32> writes)
+    {
+        ParallelTicker& ticker = m_tickers.emplace_back();
+        ticker.m_name = name;
+        ticker.m_order = order;
+        ticker.m_reads = AZStd::move(reads);
+        ticker.m_writes = AZStd::move(writes);
+        ticker.m_targetMutex = &m_tickMutex;
+        ticker.m_targetList = &m_tickNames;
+        ticker.TickBus::Handler::BusConnect();
+        return ticker;
+    }
+
+    size_t IndexOf(char name) const
+    {
+        return AZStd::find(m_tickNames.begin(), m_tickNames.end(), name) - m_tickNames.begin();
+    }
+
+    TaskGraphActive m_taskGraphActive;
+    TaskExecutor* m_executor = nullptr;
+    AZStd::list<ParallelTicker> m_tickers;
+    AZStd::mutex m_tickMutex;
+    AZStd::vector<char> m_tickNames;
+};
+
+TEST_F(ParallelTickBus, Dispatch_ConflictingHandlers_TickInTickBusOrder)
+{
+    AddTicker('a', TICK_GAME, {}, { AZ_CRC_CE("Position") });
+    AddTicker('b', TICK_GAME, { AZ_CRC_CE("Position") }, { AZ_CRC_CE("Velocity") });
+    AddTicker('c', TICK_GAME, { AZ_CRC_CE("Health") }, {});
+    AddTicker('d', TICK_GAME, { AZ_CRC_CE("Velocity") }, {});
+
+    TickBusDispatcher dispatcher;
+    dispatcher.Dispatch(0.f, ScriptTimePoint{});
+
+    ASSERT_EQ(4, m_tickNames.size());
+    EXPECT_LT(IndexOf('a'), IndexOf('b')); // b reads what a writes
+    EXPECT_LT(IndexOf('b'), IndexOf('d')); // d reads what b writes
+    EXPECT_LT(IndexOf('c'), m_tickNames.size());
+}
+
+TEST_F(ParallelTickBus, Dispatch_HandlersWithoutDataAccess_SplitParallelPhases)
+{
+    AddTicker('a', TICK_GAME, {}, {});
+    AddTicker('b', TICK_GAME, {}, {});
+    AddTicker('c', TICK_GAME, {}, {}).m_declareAccess = false;
+    AddTicker('d', TICK_GAME, {}, {});
+    AddTicker('e', TICK_UI, {}, {});
+
+    TickBusDispatcher dispatcher;
+    dispatcher.Dispatch(0.f, ScriptTimePoint{});
+
+    ASSERT_EQ(5, m_tickNames.size());
+    EXPECT_EQ(2, IndexOf('c'));
+    EXPECT_GT(IndexOf('e'), IndexOf('d'));
+}
+
+TEST_F(ParallelTickBus, Dispatch_HandlerDisconnectsLaterHandlersDuringFlush_DisconnectedHandlersAreSkipped)
+{
+    // a and b conflict, so a is ticked alone before b when c flushes the phase
+    ParallelTicker& a = AddTicker('a', TICK_GAME, {}, { AZ_CRC_CE("Position") });
+    ParallelTicker& b = AddTicker('b', TICK_GAME, { AZ_CRC_CE("Position") }, {});
+    ParallelTicker& c = AddTicker('c', TICK_GAME, {}, {});
+    c.m_declareAccess = false;
+    AddTicker('d', TICK_UI, {}, {});
+    a.m_disconnectOnTick = { &b, &c };
+
+    TickBusDispatcher dispatcher;
+    dispatcher.Dispatch(0.f, ScriptTimePoint{});
+
+    EXPECT_EQ((AZStd::vector<char>{ 'a', 'd' }), m_tickNames);
+}
+
+TEST_F(ParallelTickBus, Dispatch_TaskGraphInactive_TicksHandlersInOrder)
+{
+    Interface<TaskGraphActiveInterface>::Unregister(&m_taskGraphActive);
+
+    AddTicker('a', TICK_GAME, {}, {});
+    AddTicker('b', TICK_GAME, {}, {});
+    AddTicker('c', TICK_UI, {}, {});
+
+    TickBusDispatcher dispatcher;
+    dispatcher.Dispatch(0.f, ScriptTimePoint{});
+
+    EXPECT_EQ((AZStd::vector<char>{ 'a', 'b', 'c' }), m_tickNames);
+
+    Interface<TaskGraphActiveInterface>::Register(&m_taskGraphActive);
+}
@@ -75,6 +75,7 @@ set(FILES
     Console/LoggerSystemComponentTests.cpp
     Console/ConsoleTests.cpp
     Date/DateFormatTests.cpp
+    Debug/LockContentionProfilerTests.cpp
     Debug/PerformanceCollectorTests.cpp
     Debug/Trace.cpp
     Debug.cpp
@@ -123,6 +124,8 @@ set(FILES
     Math/IntersectionTestHelpers.cpp
     Math/IntersectionTestHelpers.h
     Math/IntersectionTests.cpp
+    Math/MathBatchPerformanceTests.cpp
+    Math/MathBatchTests.cpp
     Math/MathIntrinsicsTests.cpp
     Math/IntersectPointTest.cpp
     Math/MathStringsTests.cpp
@@ -164,7 +167,9 @@ set(FILES
     Math/VectorNTests.cpp
     Math/VectorNPerformanceTests.cpp
     Math/PackedVectorTest.cpp
+    Memory/AllocationSampler.cpp
     Memory/AllocatorBenchmarks.cpp
+    Memory/FrameArenaAllocator.cpp
     Memory/HphaAllocator.cpp
     Memory/HphaAllocatorErrorDetection.cpp
     Memory/LeakDetection.cpp
@@ -174,6 +179,7 @@ set(FILES
     Metrics/EventLoggerUtilsTests.cpp
     Metrics/JsonTraceEventLoggerTests.cpp
     Module.cpp
+    ModuleFilePrefetcher.cpp
     ModuleTestBus.h
     Name/NameJsonSerializerTests.cpp
     Name/NameBenchmarks.cpp
@@ -198,6 +204,7 @@ set(FILES
     Serialization/Json/ColorSerializerTests.cpp
     Serialization/Json/DoubleSerializerTests.cpp
     Serialization/Json/IntSerializerTests.cpp
+    Serialization/Json/JsonParallelArrayLoadBenchmarks.cpp
     Serialization/Json/JsonRegistrationContextTests.cpp
     Serialization/Json/JsonSerializationMetadataTests.cpp
     Serialization/Json/JsonSerializationResultTests.cpp
@@ -237,6 +244,7 @@ set(FILES
     Settings/ConfigurableStackTests.cpp
     Settings/SettingsRegistryTests.cpp
     Settings/SettingsRegistryConsoleUtilsTests.cpp
+    Settings/SettingsRegistryMergeCacheTests.cpp
     Settings/SettingsRegistryMergeUtilsTests.cpp
     Settings/SettingsRegistryOriginTrackerTests.cpp
     Settings/SettingsRegistryScriptUtilsTests.cpp
@@ -253,6 +261,8 @@ set(FILES
     Streamer/FullDecompressorTests.cpp
     Streamer/IStreamerMock.h
     Streamer/IStreamerTypesMock.h
+    Streamer/PersistentCacheTests.cpp
+    Streamer/PrefetcherTests.cpp
     Streamer/ReadSplitterTests.cpp
     Streamer/SchedulerTests.cpp
     Streamer/StreamStackEntryConformityTests.h
@@ -2002,6 +2002,25 @@ namespace AZ::IO
         return static_cast<EStreamSourceMediaType>(StreamMediaType::TypeHDD);
     }
 
+    AZ::IO::MappedFileView Archive::MapFileInPak(AZStd::string_view szName)
+    {
+        auto szFullPath = AZ::IO::FileIOBase::GetDirectInstance()->ResolvePath(szName);
+        if (!szFullPath)
+        {
+            AZ_Assert(false, "Unable to resolve path for filepath %.*s", aznumeric_cast<int>(szName.size()), szName.data());
+            return {};
+        }
+
+        ZipDir::CachePtr pZip;
+        uint32_t nArchiveFlags;
+        ZipDir::FileEntry* pFileEntry = FindPakFileEntry(szFullPath->Native(), nArchiveFlags, &pZip);
+        if (!pFileEntry)
+        {
+            return {};
+        }
+        return pZip->MapFile(pFileEntry);
+    }
+
     bool Archive::SetPacksAccessible(bool bAccessible, AZStd::string_view pWildcard)
     {
         auto filePath = AZ::IO::FileIOBase::GetDirectInstance()->ResolvePath(pWildcard);
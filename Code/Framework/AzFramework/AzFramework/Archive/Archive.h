@@ -259,6 +259,8 @@ namespace AZ::IO
 
         EStreamSourceMediaType GetFileMediaType(AZStd::string_view szName) const override;
 
+        AZ::IO::MappedFileView MapFileInPak(AZStd::string_view szName) override;
+
         // [LYN-2376] Remove once legacy slice support is removed
         auto GetLevelPackOpenEvent() -> LevelPackOpenEvent* override;
         auto GetLevelPackCloseEvent()->LevelPackCloseEvent* override;
@@ -11,6 +11,7 @@
 
 #include <AzCore/EBus/Event.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/MappedFile.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
@@ -239,6 +240,13 @@ namespace AZ::IO
         // Return media type for the file
         virtual EStreamSourceMediaType GetFileMediaType(AZStd::string_view szName) const = 0;
 
+        // Summary:
+        // Return a read-only memory mapped view of a file that's stored uncompressed in an archive, so it can be used in
+        // place without being copied into a separate buffer. The view keeps the archive mapped for as long as it's alive.
+        // An invalid view is returned if the file isn't in an archive, is compressed or can't be mapped, in which case the
+        // file should be read normally.
+        virtual AZ::IO::MappedFileView MapFileInPak(AZStd::string_view szName) = 0;
+
         // Event sent when a archive file is opened that contains a level.pak
         // @param const AZStd::vector<AZStd::string>& - Array of directories containing level.pak files
         using LevelPackOpenEvent = AZ::Event<const AZStd::vector<AZ::IO::Path>&>;
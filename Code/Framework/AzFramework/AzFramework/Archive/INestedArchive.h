@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <AzCore/IO/MappedFile.h>
 #include <AzCore/IO/Path/Path_fwd.h>
 #include <AzCore/Math/Crc.h>
 #include <AzCore/std/containers/vector.h>
@@ -156,6 +157,12 @@ namespace AZ::IO
         // Note:
         //    Must be at least the size returned by GetFileSize.
         virtual int ReadFile(Handle, void* pBuffer) = 0;
+        // Summary:
+        //   Maps the data of a stored (uncompressed) file so it can be used in place without being copied.
+        // Returns:
+        //   A view that keeps the archive mapped while it's alive, or an invalid view if the file is compressed,
+        //   encrypted or the archive can't be mapped. Use ReadFile in that case.
+        virtual AZ::IO::MappedFileView MapFile(Handle) = 0;
 
         // Summary:
         //   Get the full path to the archive file.
@@ -214,6 +214,12 @@ namespace AZ::IO
         return m_pCache->ReadFile(reinterpret_cast<ZipDir::FileEntry*>(fileHandle), nullptr, pBuffer);
     }
 
+    AZ::IO::MappedFileView NestedArchive::MapFile(Handle fileHandle)
+    {
+        AZ_Assert(m_pCache->IsOwnerOf(reinterpret_cast<ZipDir::FileEntry*>(fileHandle)), "File Handle is not owned by archive");
+        return m_pCache->MapFile(reinterpret_cast<ZipDir::FileEntry*>(fileHandle));
+    }
+
     AZ::IO::PathView NestedArchive::GetFullPath() const
     {
         return m_pCache->GetFilePath();
@@ -80,6 +80,9 @@ namespace AZ::IO
         // reads the file into the preallocated buffer (must be at least the size of GetFileSize())
         int ReadFile(Handle fileHandle, void* pBuffer) override;
 
+        // maps the data of a stored file, see INestedArchive::MapFile
+        AZ::IO::MappedFileView MapFile(Handle fileHandle) override;
+
         // returns the full path to the archive file
         AZ::IO::PathView GetFullPath() const override;
 
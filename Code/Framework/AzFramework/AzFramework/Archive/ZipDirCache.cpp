@@ -46,6 +46,44 @@ namespace AZ::IO::ZipDir
             return memoryBlock;
         }
 
+        // returns the number of characters needed to store the full paths of all files in the tree
+        static size_t CalculateIndexPathsSize(FileEntryTree& tree, size_t prefixSize)
+        {
+            size_t size = 0;
+            for (auto it = tree.GetFileBegin(); it != tree.GetFileEnd(); ++it)
+            {
+                size += prefixSize + tree.GetFileName(it).size();
+            }
+            for (auto it = tree.GetDirBegin(); it != tree.GetDirEnd(); ++it)
+            {
+                // the directory name is followed by a separator in the prefix of its files
+                size += CalculateIndexPathsSize(*tree.GetDirEntry(it), prefixSize + tree.GetDirName(it).size() + 1);
+            }
+            return size;
+        }
+
+        // appends the full paths of all files in the tree to the paths buffer and adds them to the index.
+        // the buffer has to be reserved up front as the index keys point into it
+        static void AddFilesToIndex(FileEntryTree& tree, AZ::IO::FixedMaxPathString& prefix, AZStd::string& paths,
+            AZStd::unordered_map<AZ::IO::PathView, FileEntry*>& index)
+        {
+            for (auto it = tree.GetFileBegin(); it != tree.GetFileEnd(); ++it)
+            {
+                const size_t pathStart = paths.size();
+                paths += AZStd::string_view(prefix);
+                paths += tree.GetFileName(it);
+                index.emplace(AZ::IO::PathView(AZStd::string_view(paths).substr(pathStart)), tree.GetFileEntry(it));
+            }
+            for (auto it = tree.GetDirBegin(); it != tree.GetDirEnd(); ++it)
+            {
+                const size_t prefixSize = prefix.size();
+                prefix += tree.GetDirName(it);
+                prefix += AZ::IO::PosixPathSeparator;
+                AddFilesToIndex(*tree.GetDirEntry(it), prefix, paths, index);
+                prefix.erase(prefixSize);
+            }
+        }
+
         // generates random file name
         static AZStd::fixed_string<8> GetRandomName(int nAttempt)
         {
@@ -150,7 +188,13 @@ namespace AZ::IO::ZipDir
                 m_fileHandle = AZ::IO::InvalidHandle;
             }
         }
+        m_fileIndex.clear();
+        m_fileIndexPaths.clear();
         m_treeDir.Clear();
+
+        // Views that are still in use keep their own reference to the mapping.
+        AZStd::scoped_lock lock(m_mappedFileMutex);
+        m_mappedFile.reset();
     }
 
     bool Cache::WriteCompressedData(uint8_t* data, size_t size, bool)
@@ -735,8 +779,20 @@ namespace AZ::IO::ZipDir
     {
         AZ::IO::PathView szPath{ szPathSrc };
 
-        ZipDir::FindFile fd(GetRoot());
-        FileEntry* fileEntry = fd.FindExact(szPath);
+        FileEntry* fileEntry = nullptr;
+        if (!m_fileIndex.empty())
+        {
+            if (auto it = m_fileIndex.find(szPath); it != m_fileIndex.end())
+            {
+                fileEntry = it->second;
+            }
+        }
+        else
+        {
+            ZipDir::FindFile fd(GetRoot());
+            fileEntry = fd.FindExact(szPath);
+        }
+
         if (!fileEntry)
         {
             if (az_archive_zip_directory_cache_verbosity)
@@ -748,6 +804,49 @@ namespace AZ::IO::ZipDir
         return fileEntry;
     }
 
+    void Cache::BuildFileIndex()
+    {
+        m_fileIndex.clear();
+        m_fileIndexPaths.clear();
+
+        const size_t pathsSize = ZipDirCacheInternal::CalculateIndexPathsSize(m_treeDir, 0);
+        m_fileIndexPaths.reserve(pathsSize);
+        m_fileIndex.reserve(m_treeDir.NumFilesTotal());
+
+        AZ::IO::FixedMaxPathString prefix;
+        ZipDirCacheInternal::AddFilesToIndex(m_treeDir, prefix, m_fileIndexPaths, m_fileIndex);
+        AZ_Assert(m_fileIndexPaths.size() == pathsSize,
+            "The paths of the file index took %zu characters instead of the reserved %zu. The keys of the index are no longer valid.",
+            m_fileIndexPaths.size(), pathsSize);
+    }
+
+    AZ::IO::MappedFileView Cache::MapFile(FileEntry* pFileEntry)
+    {
+        if (!pFileEntry || pFileEntry->nMethod != ZipFile::METHOD_STORE || pFileEntry->desc.lSizeUncompressed == 0 ||
+            !(m_nFlags & FLAGS_READ_ONLY) || m_strFilePath.empty())
+        {
+            return {};
+        }
+
+        AZStd::scoped_lock lock(m_mappedFileMutex);
+        if (Refresh(pFileEntry) != ZD_ERROR_SUCCESS)
+        {
+            return {};
+        }
+
+        if (!m_mappedFile && !m_mappingFailed)
+        {
+            AZ::IO::FixedMaxPath resolvedPath;
+            if (AZ::IO::FileIOBase::GetDirectInstance()->ResolvePath(resolvedPath, m_strFilePath))
+            {
+                m_mappedFile = AZ::IO::MappedFile::Open(resolvedPath.c_str());
+            }
+            // Only try once so archives that can't be mapped don't pay for repeated attempts.
+            m_mappingFailed = !m_mappedFile;
+        }
+        return AZ::IO::MappedFileView(m_mappedFile, pFileEntry->nFileDataOffset, pFileEntry->desc.lSizeUncompressed);
+    }
+
     // refreshes information about the given file entry into this file entry
     ErrorEnum Cache::Refresh(FileEntryBase* pFileEntry)
     {
@@ -16,9 +16,12 @@
 #pragma once
 
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/MappedFile.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzFramework/Archive/Codec.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
@@ -82,6 +85,12 @@ namespace AZ::IO::ZipDir
 
         ErrorEnum ReadFile(FileEntry* pFileEntry, void* pCompressed, void* pUncompressed);
 
+        // Returns a read-only view of the data of a stored (uncompressed) file entry in the memory mapped archive.
+        // The view keeps the archive mapped, even after the cache is closed. An invalid view is returned if the file is
+        // compressed or encrypted, the archive isn't opened read-only or it can't be mapped, for instance because it's
+        // nested in another archive. Callers should fall back to ReadFile in that case.
+        AZ::IO::MappedFileView MapFile(FileEntry* pFileEntry);
+
         void Free(void* ptr)
         {
             azfree(ptr);
@@ -115,6 +124,9 @@ namespace AZ::IO::ZipDir
         bool RelinkZip();
     protected:
         bool RelinkZip(AZ::IO::HandleType fTmp);
+        // builds the index of all files by their full path which FindFile uses instead of walking the directory tree.
+        // this is only done for read-only archives, as their tree doesn't change after the CDR has been read
+        void BuildFileIndex();
         // writes out the file data in the queue into the given file. Empties the queue
         bool WriteZipFiles(AZStd::vector<AZStd::intrusive_ptr<FileDataRecord>>& queFiles, AZ::IO::HandleType fTmp);
 
@@ -158,6 +170,16 @@ namespace AZ::IO::ZipDir
         // CDR buffer.
         AZStd::vector<uint8_t> m_CDR_buffer;
 
+        // Index of all files by their full relative path, built when a read-only archive is opened.
+        // The keys are views into m_fileIndexPaths, which holds all paths back to back.
+        AZStd::unordered_map<AZ::IO::PathView, FileEntry*> m_fileIndex;
+        AZStd::string m_fileIndexPaths;
+
+        // Memory mapping of the entire archive, created the first time a file is mapped.
+        AZStd::intrusive_ptr<AZ::IO::MappedFile> m_mappedFile;
+        AZStd::mutex m_mappedFileMutex;
+        bool m_mappingFailed = false;
+
         ZipFile::EHeaderEncryptionType m_encryptedHeaders = ZipFile::HEADERS_NOT_ENCRYPTED;
         ZipFile::EHeaderSignatureType m_signedHeaders;
 
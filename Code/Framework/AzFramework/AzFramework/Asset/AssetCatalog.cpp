@@ -13,6 +13,7 @@
 #include <AzCore/Asset/AssetTypeInfoBus.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Debug/StartupTimeline.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
@@ -26,6 +27,7 @@
 #include <AzFramework/API/ApplicationAPI.h>
 #include <AzFramework/Asset/AssetBundleManifest.h>
 #include <AzFramework/Asset/AssetRegistry.h>
+#include <AzFramework/Asset/MappedAssetRegistry.h>
 #include <AzFramework/Asset/AssetSystemBus.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 
@@ -185,6 +187,11 @@ namespace AzFramework
             return foundIter->second.m_relativePath;
         }
 
+        if (AZ::Data::AssetInfo assetInfo; FindMappedAssetInfo(id, assetInfo))
+        {
+            return AZStd::move(assetInfo.m_relativePath);
+        }
+
         return AZStd::string();
     }
 
@@ -214,9 +221,52 @@ namespace AzFramework
             return foundIter->second;
         }
 
+        if (AZ::Data::AssetInfo assetInfo; FindMappedAssetInfo(id, assetInfo))
+        {
+            return assetInfo;
+        }
+
         return AZ::Data::AssetInfo();
     }
 
+    //=========================================================================
+    // GetAssetIdByPathInternal
+    //=========================================================================
+    AZ::Data::AssetId AssetCatalog::GetAssetIdByPathInternal(const char* assetPath) const
+    {
+        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+
+        AZ::Data::AssetId foundId = m_registry->GetAssetIdByPath(assetPath);
+        if (!foundId.IsValid() && m_mappedRegistry && assetPath)
+        {
+            foundId = m_mappedRegistry->GetAssetIdByPath(assetPath);
+            // The path of a mapped entry is stale once the asset has been unregistered, or re-registered on top of the mapped
+            // base catalog. A re-registered asset that kept its path would have been found in m_registry above.
+            if (m_maskedMappedAssets.contains(foundId) || m_registry->m_assetIdToInfo.contains(foundId))
+            {
+                return AZ::Data::AssetId();
+            }
+        }
+        return foundId;
+    }
+
+    //=========================================================================
+    // FindMappedAssetInfo
+    //=========================================================================
+    bool AssetCatalog::FindMappedAssetInfo(const AZ::Data::AssetId& id, AZ::Data::AssetInfo& assetInfo) const
+    {
+        return m_mappedRegistry && !m_maskedMappedAssets.contains(id) && m_mappedRegistry->GetAssetInfo(id, assetInfo);
+    }
+
+    //=========================================================================
+    // FindMappedAssetDependencies
+    //=========================================================================
+    bool AssetCatalog::FindMappedAssetDependencies(
+        const AZ::Data::AssetId& id, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const
+    {
+        return m_mappedRegistry && !m_maskedMappedDependencies.contains(id) && m_mappedRegistry->GetAssetDependencies(id, dependencies);
+    }
+
     //=========================================================================
     // GetAssetIdByPath
     //=========================================================================
@@ -232,10 +282,10 @@ namespace AzFramework
         {
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
-            AZ::Data::AssetId foundId = m_registry->GetAssetIdByPath(m_pathBuffer.c_str());
+            AZ::Data::AssetId foundId = GetAssetIdByPathInternal(m_pathBuffer.c_str());
             if (foundId.IsValid())
             {
-                const AZ::Data::AssetInfo& assetInfo = m_registry->m_assetIdToInfo.find(foundId)->second;
+                const AZ::Data::AssetInfo assetInfo = GetAssetInfoByIdInternal(foundId);
 
                 // If the type is already registered, but with no valid type, allow it to be re-registered.
                 // Otherwise, return the Id.
@@ -290,6 +340,18 @@ namespace AzFramework
             registeredAssetPaths.emplace_back(assetIdToInfoPair.second.m_relativePath);
         }
 
+        if (m_mappedRegistry)
+        {
+            m_mappedRegistry->EnumerateAssets(
+                [this, &registeredAssetPaths](const AZ::Data::AssetId& id, const AZ::Data::AssetInfo& assetInfo)
+                {
+                    if (!m_maskedMappedAssets.contains(id) && !m_registry->m_assetIdToInfo.contains(id))
+                    {
+                        registeredAssetPaths.emplace_back(assetInfo.m_relativePath);
+                    }
+                });
+        }
+
         return registeredAssetPaths;
     }
 
@@ -300,6 +362,10 @@ namespace AzFramework
 
         if (itr == m_registry->m_assetDependencies.end())
         {
+            if (AZStd::vector<AZ::Data::ProductDependency> dependencies; FindMappedAssetDependencies(id, dependencies))
+            {
+                return AZ::Success(AZStd::move(dependencies));
+            }
             return AZ::Failure<AZStd::string>("Failed to find asset in dependency map");
         }
 
@@ -408,11 +474,20 @@ namespace AzFramework
         using namespace AZ::Data;
 
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
-        auto itr = m_registry->m_assetDependencies.find(searchAssetId);
+        const AZStd::vector<ProductDependency>* foundDependencyList = nullptr;
+        AZStd::vector<ProductDependency> mappedDependencyList;
+        if (auto itr = m_registry->m_assetDependencies.find(searchAssetId); itr != m_registry->m_assetDependencies.end())
+        {
+            foundDependencyList = &itr->second;
+        }
+        else if (FindMappedAssetDependencies(searchAssetId, mappedDependencyList))
+        {
+            foundDependencyList = &mappedDependencyList;
+        }
 
-        if (itr != m_registry->m_assetDependencies.end())
+        if (foundDependencyList)
         {
-            AZStd::vector<ProductDependency>& assetDependencyList = itr->second;
+            const AZStd::vector<ProductDependency>& assetDependencyList = *foundDependencyList;
 
             for (const ProductDependency& dependency : assetDependencyList)
             {
@@ -502,12 +577,27 @@ namespace AzFramework
             // and unlock the registryMutex before calling the callback.
             m_registryMutex.lock();
             auto assetIdToInfoCopy = m_registry->m_assetIdToInfo;
+            // The mapped registry is immutable, so only the set of assets hidden from it needs to be copied.
+            AZStd::shared_ptr<MappedAssetRegistry> mappedRegistry = m_mappedRegistry;
+            auto maskedMappedAssetsCopy = mappedRegistry ? m_maskedMappedAssets : AZStd::unordered_set<AZ::Data::AssetId>();
             m_registryMutex.unlock();
 
             for (auto& it : assetIdToInfoCopy)
             {
                 enumerateCB(it.first, it.second);
             }
+
+            if (mappedRegistry)
+            {
+                mappedRegistry->EnumerateAssets(
+                    [&](const AZ::Data::AssetId& id, const AZ::Data::AssetInfo& assetInfo)
+                    {
+                        if (!maskedMappedAssetsCopy.contains(id) && !assetIdToInfoCopy.contains(id))
+                        {
+                            enumerateCB(id, assetInfo);
+                        }
+                    });
+            }
         }
 
         if (endCB)
@@ -554,8 +644,16 @@ namespace AzFramework
 
             // even though this could be a chunk of memory to allocate and deallocate, this is many times faster and more efficient
             // in terms of memory AND fragmentation than allowing it to perform thousands of reads on physical media.
+            // A catalog in the mapped format is used in place, which avoids deserializing every entry when the catalog is loaded.
+            // Catalogs that can't be mapped directly, for instance because they're stored in an archive, are read into memory.
+            AZStd::unique_ptr<MappedAssetRegistry> mappedRegistry;
+            if (catalogRegistryFile)
+            {
+                mappedRegistry = MappedAssetRegistry::Open(catalogRegistryFile);
+            }
+
             AZStd::vector<char> bytes;
-            if (catalogRegistryFile && AZ::IO::FileIOBase::GetInstance())
+            if (!mappedRegistry && catalogRegistryFile && AZ::IO::FileIOBase::GetInstance())
             {
                 AZ::IO::HandleType handle = AZ::IO::InvalidHandle;
                 AZ::u64 size = 0;
@@ -577,7 +675,35 @@ namespace AzFramework
                 }
             }
 
-            if (!bytes.empty())
+            if (!mappedRegistry && MappedAssetRegistry::IsMappedAssetRegistry(AZStd::as_bytes(AZStd::span<const char>(bytes))))
+            {
+                mappedRegistry = MappedAssetRegistry::Create(AZStd::move(bytes));
+                bytes = {};
+            }
+
+            if (mappedRegistry)
+            {
+                AZStd::shared_ptr<AzFramework::AssetRegistry> prevRegistry;
+                if (!m_initialized)
+                {
+                    // First time initialization may have updates already processed which we want to apply
+                    prevRegistry = AZStd::move(m_registry);
+                    m_registry.reset(aznew AssetRegistry());
+                }
+                m_mappedRegistry = AZStd::move(mappedRegistry);
+                m_maskedMappedAssets.clear();
+                m_maskedMappedDependencies.clear();
+
+                AZ_TracePrintf("AssetCatalog", "Mapped registry containing %zu assets.\n", m_mappedRegistry->GetAssetCount());
+
+                if (!m_initialized)
+                {
+                    ApplyDeltaCatalog(prevRegistry);
+                    m_initialized = true;
+                }
+                shouldBroadcast = true;
+            }
+            else if (!bytes.empty())
             {
                 AZStd::shared_ptr<AzFramework::AssetRegistry> prevRegistry;
                 if (!m_initialized)
@@ -586,6 +712,9 @@ namespace AzFramework
                     prevRegistry = AZStd::move(m_registry);
                     m_registry.reset(aznew AssetRegistry());
                 }
+                m_mappedRegistry.reset();
+                m_maskedMappedAssets.clear();
+                m_maskedMappedDependencies.clear();
                 AZ::IO::MemoryStream catalogStream(bytes.data(), bytes.size());
 #if (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
                 ApplicationRequests::Bus::Broadcast(&ApplicationRequests::PumpSystemEventLoopWhileDoingWorkInNewThread,
@@ -686,6 +815,10 @@ namespace AzFramework
 
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
             m_registry->UnregisterAsset(assetId);
+            if (m_mappedRegistry && m_mappedRegistry->ContainsAsset(assetId))
+            {
+                m_maskedMappedAssets.insert(assetId);
+            }
         }
     }
 
@@ -816,8 +949,15 @@ namespace AzFramework
                     AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
                     // is it an add or a change?
-                    auto assetInfoPair = m_registry->m_assetIdToInfo.find(assetId);
-                    isNewAsset = (assetInfoPair == m_registry->m_assetIdToInfo.end());
+                    AZ::Data::AssetInfo existingInfo;
+                    if (auto assetInfoPair = m_registry->m_assetIdToInfo.find(assetId); assetInfoPair != m_registry->m_assetIdToInfo.end())
+                    {
+                        existingInfo = assetInfoPair->second;
+                    }
+                    else
+                    {
+                        isNewAsset = !FindMappedAssetInfo(assetId, existingInfo);
+                    }
 
                     if (!isNewAsset && isCatalogInitialize)
                     {
@@ -836,7 +976,7 @@ namespace AzFramework
                     }
 #endif
 
-                    const AZ::Data::AssetType& assetType = isNewAsset ? message.m_assetType : assetInfoPair->second.m_assetType;
+                    const AZ::Data::AssetType& assetType = isNewAsset ? message.m_assetType : existingInfo.m_assetType;
 
                     AZ::Data::AssetInfo newData;
                     newData.m_assetId = assetId;
@@ -965,6 +1105,8 @@ namespace AzFramework
     //=========================================================================
     bool AssetCatalog::LoadCatalog(const char* catalogRegistryFile)
     {
+        const AZ::Debug::StartupTimeline::Scope startupScope("AssetCatalog", catalogRegistryFile);
+
         // right before we load the catalog, make sure you are listening for update events, so that you don't miss any in the gap
         // that happens AFTER the catalog is saved but BEFORE you start monitoring them:
         StartMonitoringAssets();
@@ -996,6 +1138,9 @@ namespace AzFramework
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
         m_registry->Clear();
+        m_mappedRegistry.reset();
+        m_maskedMappedAssets.clear();
+        m_maskedMappedDependencies.clear();
         m_initialized = false;
     }
 
@@ -1102,6 +1247,17 @@ namespace AzFramework
     {
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
+        if (m_mappedRegistry)
+        {
+            // Entries of the delta replace those of the mapped base catalog, including their dependency lists.
+            for (const auto& [assetId, assetInfo] : deltaCatalog->m_assetIdToInfo)
+            {
+                if (m_mappedRegistry->ContainsAsset(assetId))
+                {
+                    m_maskedMappedDependencies.insert(assetId);
+                }
+            }
+        }
         m_registry->AddRegistry(deltaCatalog);
         return true;
     }
@@ -1166,7 +1322,24 @@ namespace AzFramework
     bool AssetCatalog::SaveCatalog(const char* catalogRegistryFile)
     {
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
-        return SaveCatalog(catalogRegistryFile, m_registry.get());
+        if (!m_mappedRegistry)
+        {
+            return SaveCatalog(catalogRegistryFile, m_registry.get());
+        }
+
+        // Merge the changes on top of the mapped base catalog so that the saved catalog is complete.
+        AssetRegistry mergedRegistry;
+        m_mappedRegistry->CopyToRegistry(mergedRegistry);
+        for (const AZ::Data::AssetId& assetId : m_maskedMappedAssets)
+        {
+            mergedRegistry.UnregisterAsset(assetId);
+        }
+        for (const AZ::Data::AssetId& assetId : m_maskedMappedDependencies)
+        {
+            mergedRegistry.m_assetDependencies.erase(assetId);
+        }
+        mergedRegistry.AddRegistry(AZStd::make_shared<AssetRegistry>(*m_registry));
+        return SaveCatalog(catalogRegistryFile, &mergedRegistry);
     }
 
     //=========================================================================
@@ -1245,7 +1418,7 @@ namespace AzFramework
         AZStd::vector<AZ::Data::AssetId> deltaPakAssetIds;
         for (const AZStd::string& file : files)
         {
-            AZ::Data::AssetId asset = m_registry->GetAssetIdByPath(file.c_str());
+            AZ::Data::AssetId asset = GetAssetIdByPathInternal(file.c_str());
             if (!asset.IsValid())
             {
                 // Asset is not listed in the registry, we can early out and fail as there should never be an asset that isn't in the registry.
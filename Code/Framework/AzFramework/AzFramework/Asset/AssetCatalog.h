@@ -12,6 +12,7 @@
 #include <AzCore/Asset/AssetManager.h>
 
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #include <AzFramework/Asset/NetworkAssetNotification_private.h>
@@ -21,6 +22,7 @@
 namespace AzFramework
 {
     class AssetRegistry;
+    class MappedAssetRegistry;
     class AssetBundleManifest;
 
     /*
@@ -128,6 +130,11 @@ namespace AzFramework
 
         AZStd::string GetAssetPathByIdInternal(const AZ::Data::AssetId& id) const;
         AZ::Data::AssetInfo GetAssetInfoByIdInternal(const AZ::Data::AssetId& id) const;
+        AZ::Data::AssetId GetAssetIdByPathInternal(const char* assetPath) const;
+        // Lookups in the mapped base catalog, which skip assets that have been unregistered or replaced by a delta catalog.
+        // Must be called with the registry mutex held.
+        bool FindMappedAssetInfo(const AZ::Data::AssetId& id, AZ::Data::AssetInfo& assetInfo) const;
+        bool FindMappedAssetDependencies(const AZ::Data::AssetId& id, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const;
         bool DoesAssetIdMatchWildcardPatternInternal(const AZ::Data::AssetId& assetId, const AZStd::string& wildcardPattern) const;
     private:
 
@@ -136,6 +143,12 @@ namespace AzFramework
         AZStd::unordered_set<AZStd::string> m_extensions;           ///< Valid asset extensions.
         mutable AZStd::recursive_mutex m_registryMutex;
         AZStd::unique_ptr<AssetRegistry> m_registry;
+        //! Base catalog used in place when it was saved in the mapped format. m_registry then only holds the changes on top of it.
+        AZStd::shared_ptr<MappedAssetRegistry> m_mappedRegistry;
+        //! Assets of the mapped base catalog which have been unregistered or replaced by a delta catalog.
+        AZStd::unordered_set<AZ::Data::AssetId> m_maskedMappedAssets;
+        //! Dependency lists of the mapped base catalog which have been replaced by a delta catalog.
+        AZStd::unordered_set<AZ::Data::AssetId> m_maskedMappedDependencies;
         AZStd::string m_pathBuffer;
         mutable AZStd::recursive_mutex m_baseCatalogNameMutex;
         AZStd::string m_baseCatalogName;
@@ -0,0 +1,633 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Asset/MappedAssetRegistry.h>
+#include <AzFramework/Asset/AssetRegistry.h>
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/sort.h>
+
+namespace AzFramework
+{
+    namespace MappedAssetRegistryInternal
+    {
+        inline constexpr AZ::u32 Magic = 0x47524d41; // "AMRG"
+        inline constexpr AZ::u32 Version = 1;
+
+        // Average number of keys per bucket of the perfect hash tables. Larger buckets make the tables smaller, but take
+        // longer to build.
+        inline constexpr AZ::u32 KeysPerBucket = 4;
+        // Upper bound for the seed search of a single bucket. It's only reached if the keys can't be told apart by the hash.
+        inline constexpr AZ::u32 MaxBucketSeed = 1 << 24;
+
+        struct AssetIdKey
+        {
+            AZStd::byte m_guid[16];
+            AZ::u32 m_subId;
+        };
+
+        struct PathKey
+        {
+            AZStd::byte m_data[16];
+        };
+
+        struct Header
+        {
+            AZ::u32 m_magic;
+            AZ::u32 m_version;
+            AZ::u32 m_assetCount;
+            AZ::u32 m_assetBucketCount;
+            AZ::u32 m_pathCount;
+            AZ::u32 m_pathBucketCount;
+            AZ::u32 m_dependencyCount;
+            AZ::u32 m_stringsSize;
+            AZ::u64 m_assetsOffset;
+            AZ::u64 m_assetBucketsOffset;
+            AZ::u64 m_pathsOffset;
+            AZ::u64 m_pathBucketsOffset;
+            AZ::u64 m_dependenciesOffset;
+            AZ::u64 m_stringsOffset;
+        };
+
+        enum AssetEntryFlags : AZ::u32
+        {
+            HasAssetInfo = 1 << 0,
+            HasDependencies = 1 << 1
+        };
+
+        struct AssetEntry
+        {
+            AssetIdKey m_id;
+            AZStd::byte m_assetType[16];
+            AZ::u32 m_flags;
+            AZ::u64 m_sizeBytes;
+            AZ::u32 m_pathOffset;
+            AZ::u32 m_pathSize;
+            AZ::u32 m_firstDependency;
+            AZ::u32 m_dependencyCount;
+        };
+
+        struct PathEntry
+        {
+            PathKey m_pathKey;
+            AssetIdKey m_id;
+        };
+
+        struct DependencyEntry
+        {
+            AssetIdKey m_id;
+            AZ::u32 m_padding;
+            AZ::u64 m_flags;
+        };
+
+        static_assert(sizeof(AssetIdKey) == 20);
+        static_assert(sizeof(Header) == 80);
+        static_assert(sizeof(AssetEntry) == 64);
+        static_assert(sizeof(PathEntry) == 36);
+        static_assert(sizeof(DependencyEntry) == 32);
+
+        AssetIdKey ToKey(const AZ::Data::AssetId& id)
+        {
+            AssetIdKey key{};
+            AZStd::copy(id.m_guid.begin(), id.m_guid.end(), key.m_guid);
+            key.m_subId = id.m_subId;
+            return key;
+        }
+
+        AZ::Uuid ToUuid(const AZStd::byte (&data)[16])
+        {
+            AZ::Uuid uuid;
+            AZStd::copy(AZStd::begin(data), AZStd::end(data), uuid.begin());
+            return uuid;
+        }
+
+        AZ::Data::AssetId ToAssetId(const AssetIdKey& key)
+        {
+            return AZ::Data::AssetId(ToUuid(key.m_guid), key.m_subId);
+        }
+
+        PathKey ToPathKey(const AZ::Uuid& pathUuid)
+        {
+            PathKey key{};
+            AZStd::copy(pathUuid.begin(), pathUuid.end(), key.m_data);
+            return key;
+        }
+
+        bool operator==(const AssetIdKey& lhs, const AssetIdKey& rhs)
+        {
+            return memcmp(lhs.m_guid, rhs.m_guid, sizeof(lhs.m_guid)) == 0 && lhs.m_subId == rhs.m_subId;
+        }
+
+        bool operator==(const PathKey& lhs, const PathKey& rhs)
+        {
+            return memcmp(lhs.m_data, rhs.m_data, sizeof(lhs.m_data)) == 0;
+        }
+
+        // The hash is part of the file format, so it can't depend on the platform's AZStd::hash implementation.
+        // FNV-1a from a seeded basis, followed by a 64-bit finalizer so that hashes with different seeds are independent.
+        AZ::u64 HashBytes(const void* data, size_t size, AZ::u64 seed)
+        {
+            AZ::u64 hash = 0xcbf29ce484222325ull ^ (seed * 0x9e3779b97f4a7c15ull);
+            const auto* bytes = reinterpret_cast<const AZ::u8*>(data);
+            for (size_t i = 0; i < size; ++i)
+            {
+                hash ^= bytes[i];
+                hash *= 0x100000001b3ull;
+            }
+            hash ^= hash >> 33;
+            hash *= 0xff51afd7ed558ccdull;
+            hash ^= hash >> 33;
+            hash *= 0xc4ceb9fe1a85ec53ull;
+            hash ^= hash >> 33;
+            return hash;
+        }
+
+        AZ::u64 HashKey(const AssetIdKey& key, AZ::u64 seed)
+        {
+            // Hash the fields individually so that padding never contributes to the hash.
+            AZStd::byte bytes[sizeof(key.m_guid) + sizeof(key.m_subId)];
+            memcpy(bytes, key.m_guid, sizeof(key.m_guid));
+            memcpy(bytes + sizeof(key.m_guid), &key.m_subId, sizeof(key.m_subId));
+            return HashBytes(bytes, sizeof(bytes), seed);
+        }
+
+        AZ::u64 HashKey(const PathKey& key, AZ::u64 seed)
+        {
+            return HashBytes(key.m_data, sizeof(key.m_data), seed);
+        }
+
+        AZ::u32 GetBucketCount(size_t keyCount)
+        {
+            return aznumeric_cast<AZ::u32>(AZStd::max<size_t>(1, (keyCount + KeysPerBucket - 1) / KeysPerBucket));
+        }
+
+        // Builds a minimal perfect hash using hash and displace: keys are grouped into buckets by a first hash, then for
+        // every bucket, from largest to smallest, a seed is searched for that moves all of its keys into free slots.
+        // Returns the slot of every key, or an empty vector if no seed could be found for a bucket.
+        // The seeds are stored per bucket, with 0 marking an empty bucket.
+        template<typename KeyType>
+        AZStd::vector<AZ::u32> BuildPerfectHash(const AZStd::vector<KeyType>& keys, AZStd::vector<AZ::u32>& bucketSeeds)
+        {
+            const size_t keyCount = keys.size();
+            const AZ::u32 bucketCount = GetBucketCount(keyCount);
+            bucketSeeds.assign(bucketCount, 0);
+
+            AZStd::vector<AZStd::vector<AZ::u32>> buckets(bucketCount);
+            for (AZ::u32 keyIndex = 0; keyIndex < keyCount; ++keyIndex)
+            {
+                buckets[HashKey(keys[keyIndex], 0) % bucketCount].push_back(keyIndex);
+            }
+
+            AZStd::vector<AZ::u32> bucketOrder(bucketCount);
+            for (AZ::u32 bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex)
+            {
+                bucketOrder[bucketIndex] = bucketIndex;
+            }
+            AZStd::sort(bucketOrder.begin(), bucketOrder.end(),
+                [&buckets](AZ::u32 lhs, AZ::u32 rhs)
+                {
+                    return buckets[lhs].size() > buckets[rhs].size();
+                });
+
+            constexpr AZ::u32 UnassignedSlot = AZStd::numeric_limits<AZ::u32>::max();
+            AZStd::vector<AZ::u32> keySlots(keyCount, UnassignedSlot);
+            AZStd::vector<bool> occupiedSlots(keyCount, false);
+            AZStd::vector<AZ::u32> bucketSlots;
+            for (AZ::u32 bucketIndex : bucketOrder)
+            {
+                const AZStd::vector<AZ::u32>& bucket = buckets[bucketIndex];
+                if (bucket.empty())
+                {
+                    // Buckets are sorted by size, so all remaining buckets are empty as well.
+                    break;
+                }
+
+                bool placed = false;
+                for (AZ::u32 seed = 1; seed < MaxBucketSeed && !placed; ++seed)
+                {
+                    bucketSlots.clear();
+                    placed = true;
+                    for (AZ::u32 keyIndex : bucket)
+                    {
+                        const auto slot = aznumeric_cast<AZ::u32>(HashKey(keys[keyIndex], seed) % keyCount);
+                        if (occupiedSlots[slot] || AZStd::find(bucketSlots.begin(), bucketSlots.end(), slot) != bucketSlots.end())
+                        {
+                            placed = false;
+                            break;
+                        }
+                        bucketSlots.push_back(slot);
+                    }
+
+                    if (placed)
+                    {
+                        bucketSeeds[bucketIndex] = seed;
+                        for (size_t i = 0; i < bucket.size(); ++i)
+                        {
+                            keySlots[bucket[i]] = bucketSlots[i];
+                            occupiedSlots[bucketSlots[i]] = true;
+                        }
+                    }
+                }
+
+                if (!placed)
+                {
+                    return {};
+                }
+            }
+            return keySlots;
+        }
+
+        template<typename KeyType>
+        AZ::u64 FindSlot(const KeyType& key, AZStd::span<const AZ::u32> bucketSeeds, size_t slotCount)
+        {
+            if (slotCount == 0 || bucketSeeds.empty())
+            {
+                return AZStd::numeric_limits<AZ::u64>::max();
+            }
+            const AZ::u32 seed = bucketSeeds[HashKey(key, 0) % bucketSeeds.size()];
+            if (seed == 0)
+            {
+                return AZStd::numeric_limits<AZ::u64>::max();
+            }
+            return HashKey(key, seed) % slotCount;
+        }
+
+        constexpr AZ::u64 AlignOffset(AZ::u64 offset)
+        {
+            return (offset + 7) & ~AZ::u64(7);
+        }
+
+        template<typename T>
+        void AppendSection(AZStd::vector<char>& buffer, AZ::u64& offset, const AZStd::vector<T>& elements)
+        {
+            offset = AlignOffset(buffer.size());
+            buffer.resize(offset + elements.size() * sizeof(T), 0);
+            if (!elements.empty())
+            {
+                memcpy(buffer.data() + offset, elements.data(), elements.size() * sizeof(T));
+            }
+        }
+
+        template<typename T>
+        bool GetSection(AZStd::span<const AZStd::byte> data, AZ::u64 offset, AZ::u64 count, AZStd::span<const T>& section)
+        {
+            if (offset % alignof(T) != 0 || offset > data.size() || count > (data.size() - offset) / sizeof(T))
+            {
+                return false;
+            }
+            section = AZStd::span<const T>(reinterpret_cast<const T*>(data.data() + offset), count);
+            return true;
+        }
+    } // namespace MappedAssetRegistryInternal
+
+    using namespace MappedAssetRegistryInternal;
+
+    bool MappedAssetRegistry::Save(const char* filePath, const AssetRegistry& registry)
+    {
+        AZ::IO::FileIOStream stream(filePath, AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary);
+        if (!stream.IsOpen())
+        {
+            AZ_Warning("MappedAssetRegistry", false, "Failed to open %s for writing", filePath);
+            return false;
+        }
+        return Write(stream, registry);
+    }
+
+    bool MappedAssetRegistry::Write(AZ::IO::GenericStream& stream, const AssetRegistry& registry)
+    {
+        // Every asset with either asset info or a dependency list gets an entry, so both can be found through one lookup.
+        AZStd::vector<AZ::Data::AssetId> assetIds;
+        assetIds.reserve(registry.m_assetIdToInfo.size());
+        for (const auto& [assetId, assetInfo] : registry.m_assetIdToInfo)
+        {
+            assetIds.push_back(assetId);
+        }
+        for (const auto& [assetId, dependencies] : registry.m_assetDependencies)
+        {
+            if (registry.m_assetIdToInfo.find(assetId) == registry.m_assetIdToInfo.end())
+            {
+                assetIds.push_back(assetId);
+            }
+        }
+
+        if (assetIds.size() > AZStd::numeric_limits<AZ::u32>::max() ||
+            registry.m_assetPathToId.size() > AZStd::numeric_limits<AZ::u32>::max())
+        {
+            AZ_Error("MappedAssetRegistry", false, "The asset registry is too large to be stored in the mapped format.");
+            return false;
+        }
+
+        AZStd::vector<AssetIdKey> assetKeys;
+        assetKeys.reserve(assetIds.size());
+        for (const AZ::Data::AssetId& assetId : assetIds)
+        {
+            assetKeys.push_back(ToKey(assetId));
+        }
+
+        AZStd::vector<AZ::u32> assetBuckets;
+        AZStd::vector<AZ::u32> assetSlots = BuildPerfectHash(assetKeys, assetBuckets);
+        if (assetSlots.size() != assetKeys.size())
+        {
+            AZ_Error("MappedAssetRegistry", false, "Failed to build the asset id lookup table.");
+            return false;
+        }
+
+        AZStd::vector<AssetEntry> assets(assetIds.size());
+        AZStd::vector<DependencyEntry> dependencies;
+        AZStd::string strings;
+        for (size_t assetIndex = 0; assetIndex < assetIds.size(); ++assetIndex)
+        {
+            const AZ::Data::AssetId& assetId = assetIds[assetIndex];
+            AssetEntry& entry = assets[assetSlots[assetIndex]];
+            entry = {};
+            entry.m_id = assetKeys[assetIndex];
+
+            if (auto infoIter = registry.m_assetIdToInfo.find(assetId); infoIter != registry.m_assetIdToInfo.end())
+            {
+                const AZ::Data::AssetInfo& assetInfo = infoIter->second;
+                entry.m_flags |= HasAssetInfo;
+                AZStd::copy(assetInfo.m_assetType.begin(), assetInfo.m_assetType.end(), entry.m_assetType);
+                entry.m_sizeBytes = assetInfo.m_sizeBytes;
+                entry.m_pathOffset = aznumeric_cast<AZ::u32>(strings.size());
+                entry.m_pathSize = aznumeric_cast<AZ::u32>(assetInfo.m_relativePath.size());
+                strings += assetInfo.m_relativePath;
+            }
+
+            if (auto dependencyIter = registry.m_assetDependencies.find(assetId); dependencyIter != registry.m_assetDependencies.end())
+            {
+                entry.m_flags |= HasDependencies;
+                entry.m_firstDependency = aznumeric_cast<AZ::u32>(dependencies.size());
+                entry.m_dependencyCount = aznumeric_cast<AZ::u32>(dependencyIter->second.size());
+                for (const AZ::Data::ProductDependency& dependency : dependencyIter->second)
+                {
+                    DependencyEntry& dependencyEntry = dependencies.emplace_back();
+                    dependencyEntry = {};
+                    dependencyEntry.m_id = ToKey(dependency.m_assetId);
+                    dependencyEntry.m_flags = dependency.m_flags.to_ullong();
+                }
+            }
+        }
+
+        if (strings.size() > AZStd::numeric_limits<AZ::u32>::max() || dependencies.size() > AZStd::numeric_limits<AZ::u32>::max())
+        {
+            AZ_Error("MappedAssetRegistry", false, "The asset registry is too large to be stored in the mapped format.");
+            return false;
+        }
+
+        AZStd::vector<PathKey> pathKeys;
+        AZStd::vector<AssetIdKey> pathAssetKeys;
+        pathKeys.reserve(registry.m_assetPathToId.size());
+        pathAssetKeys.reserve(registry.m_assetPathToId.size());
+        for (const auto& [pathUuid, assetId] : registry.m_assetPathToId)
+        {
+            pathKeys.push_back(ToPathKey(pathUuid));
+            pathAssetKeys.push_back(ToKey(assetId));
+        }
+
+        AZStd::vector<AZ::u32> pathBuckets;
+        AZStd::vector<AZ::u32> pathSlots = BuildPerfectHash(pathKeys, pathBuckets);
+        if (pathSlots.size() != pathKeys.size())
+        {
+            AZ_Error("MappedAssetRegistry", false, "Failed to build the asset path lookup table.");
+            return false;
+        }
+
+        AZStd::vector<PathEntry> paths(pathKeys.size());
+        for (size_t pathIndex = 0; pathIndex < pathKeys.size(); ++pathIndex)
+        {
+            PathEntry& entry = paths[pathSlots[pathIndex]];
+            entry.m_pathKey = pathKeys[pathIndex];
+            entry.m_id = pathAssetKeys[pathIndex];
+        }
+
+        Header header{};
+        header.m_magic = Magic;
+        header.m_version = Version;
+        header.m_assetCount = aznumeric_cast<AZ::u32>(assets.size());
+        header.m_assetBucketCount = aznumeric_cast<AZ::u32>(assetBuckets.size());
+        header.m_pathCount = aznumeric_cast<AZ::u32>(paths.size());
+        header.m_pathBucketCount = aznumeric_cast<AZ::u32>(pathBuckets.size());
+        header.m_dependencyCount = aznumeric_cast<AZ::u32>(dependencies.size());
+        header.m_stringsSize = aznumeric_cast<AZ::u32>(strings.size());
+
+        AZStd::vector<char> buffer(sizeof(Header), 0);
+        AppendSection(buffer, header.m_assetsOffset, assets);
+        AppendSection(buffer, header.m_assetBucketsOffset, assetBuckets);
+        AppendSection(buffer, header.m_pathsOffset, paths);
+        AppendSection(buffer, header.m_pathBucketsOffset, pathBuckets);
+        AppendSection(buffer, header.m_dependenciesOffset, dependencies);
+        header.m_stringsOffset = buffer.size();
+        buffer.insert(buffer.end(), strings.begin(), strings.end());
+        memcpy(buffer.data(), &header, sizeof(Header));
+
+        return stream.Write(buffer.size(), buffer.data()) == buffer.size();
+    }
+
+    bool MappedAssetRegistry::IsMappedAssetRegistry(AZStd::span<const AZStd::byte> data)
+    {
+        if (data.size() < sizeof(Header))
+        {
+            return false;
+        }
+        AZ::u32 magic;
+        memcpy(&magic, data.data(), sizeof(magic));
+        return magic == Magic;
+    }
+
+    AZStd::unique_ptr<MappedAssetRegistry> MappedAssetRegistry::Open(const char* filePath)
+    {
+        AZ::IO::FixedMaxPath resolvedPath(filePath);
+        if (AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetDirectInstance(); fileIo != nullptr)
+        {
+            fileIo->ResolvePath(resolvedPath, filePath);
+        }
+
+        AZStd::intrusive_ptr<AZ::IO::MappedFile> mappedFile = AZ::IO::MappedFile::Open(resolvedPath.c_str());
+        if (!mappedFile || !IsMappedAssetRegistry(mappedFile->GetData()))
+        {
+            return {};
+        }
+
+        AZStd::unique_ptr<MappedAssetRegistry> registry(aznew MappedAssetRegistry());
+        if (!registry->Initialize(mappedFile->GetData()))
+        {
+            AZ_Error("MappedAssetRegistry", false, "Mapped asset registry %s is corrupted or has an unsupported version.", filePath);
+            return {};
+        }
+        registry->m_mappedFile = AZStd::move(mappedFile);
+        return registry;
+    }
+
+    AZStd::unique_ptr<MappedAssetRegistry> MappedAssetRegistry::Create(AZStd::vector<char> data)
+    {
+        AZStd::unique_ptr<MappedAssetRegistry> registry(aznew MappedAssetRegistry());
+        registry->m_ownedData = AZStd::move(data);
+        if (!registry->Initialize(AZStd::as_bytes(AZStd::span<const char>(registry->m_ownedData))))
+        {
+            AZ_Error("MappedAssetRegistry", false, "Mapped asset registry data is corrupted or has an unsupported version.");
+            return {};
+        }
+        return registry;
+    }
+
+    bool MappedAssetRegistry::Initialize(AZStd::span<const AZStd::byte> data)
+    {
+        if (!IsMappedAssetRegistry(data) || reinterpret_cast<uintptr_t>(data.data()) % alignof(Header) != 0)
+        {
+            return false;
+        }
+
+        const auto* header = reinterpret_cast<const Header*>(data.data());
+        if (header->m_version != Version
+            || !GetSection(data, header->m_assetsOffset, header->m_assetCount, m_assets)
+            || !GetSection(data, header->m_assetBucketsOffset, header->m_assetBucketCount, m_assetBuckets)
+            || !GetSection(data, header->m_pathsOffset, header->m_pathCount, m_paths)
+            || !GetSection(data, header->m_pathBucketsOffset, header->m_pathBucketCount, m_pathBuckets)
+            || !GetSection(data, header->m_dependenciesOffset, header->m_dependencyCount, m_dependencies))
+        {
+            return false;
+        }
+
+        AZStd::span<const char> strings;
+        if (!GetSection(data, header->m_stringsOffset, header->m_stringsSize, strings))
+        {
+            return false;
+        }
+        m_strings = AZStd::string_view(strings.data(), strings.size());
+        m_header = header;
+        return true;
+    }
+
+    size_t MappedAssetRegistry::GetAssetCount() const
+    {
+        return m_assets.size();
+    }
+
+    const AssetEntry* MappedAssetRegistry::FindAssetEntry(const AZ::Data::AssetId& id) const
+    {
+        const AssetIdKey key = ToKey(id);
+        const AZ::u64 slot = FindSlot(key, m_assetBuckets, m_assets.size());
+        if (slot < m_assets.size() && m_assets[slot].m_id == key)
+        {
+            return &m_assets[slot];
+        }
+        return nullptr;
+    }
+
+    void MappedAssetRegistry::FillAssetInfo(const AssetEntry& entry, AZ::Data::AssetInfo& assetInfo) const
+    {
+        assetInfo.m_assetId = ToAssetId(entry.m_id);
+        assetInfo.m_assetType = ToUuid(entry.m_assetType);
+        assetInfo.m_sizeBytes = entry.m_sizeBytes;
+        // Ranges are checked on use rather than on open so that opening stays independent of the size of the registry.
+        if (entry.m_pathOffset <= m_strings.size() && entry.m_pathSize <= m_strings.size() - entry.m_pathOffset)
+        {
+            assetInfo.m_relativePath = m_strings.substr(entry.m_pathOffset, entry.m_pathSize);
+        }
+        else
+        {
+            assetInfo.m_relativePath.clear();
+        }
+    }
+
+    void MappedAssetRegistry::FillAssetDependencies(
+        const AssetEntry& entry, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const
+    {
+        dependencies.clear();
+        if (entry.m_firstDependency > m_dependencies.size() || entry.m_dependencyCount > m_dependencies.size() - entry.m_firstDependency)
+        {
+            return;
+        }
+
+        dependencies.reserve(entry.m_dependencyCount);
+        for (const DependencyEntry& dependency : m_dependencies.subspan(entry.m_firstDependency, entry.m_dependencyCount))
+        {
+            dependencies.emplace_back(ToAssetId(dependency.m_id), AZStd::bitset<64>(dependency.m_flags));
+        }
+    }
+
+    bool MappedAssetRegistry::ContainsAsset(const AZ::Data::AssetId& id) const
+    {
+        return FindAssetEntry(id) != nullptr;
+    }
+
+    bool MappedAssetRegistry::GetAssetInfo(const AZ::Data::AssetId& id, AZ::Data::AssetInfo& assetInfo) const
+    {
+        const AssetEntry* entry = FindAssetEntry(id);
+        if (!entry || (entry->m_flags & HasAssetInfo) == 0)
+        {
+            return false;
+        }
+        FillAssetInfo(*entry, assetInfo);
+        return true;
+    }
+
+    bool MappedAssetRegistry::GetAssetDependencies(const AZ::Data::AssetId& id, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const
+    {
+        const AssetEntry* entry = FindAssetEntry(id);
+        if (!entry || (entry->m_flags & HasDependencies) == 0)
+        {
+            return false;
+        }
+        FillAssetDependencies(*entry, dependencies);
+        return true;
+    }
+
+    AZ::Data::AssetId MappedAssetRegistry::GetAssetIdByPath(AZStd::string_view assetPath) const
+    {
+        if (assetPath.empty())
+        {
+            return AZ::Data::AssetId();
+        }
+
+        const PathKey key = ToPathKey(AssetRegistryInternal::CreateUUIDForName(assetPath));
+        const AZ::u64 slot = FindSlot(key, m_pathBuckets, m_paths.size());
+        if (slot < m_paths.size() && m_paths[slot].m_pathKey == key)
+        {
+            return ToAssetId(m_paths[slot].m_id);
+        }
+        return AZ::Data::AssetId();
+    }
+
+    void MappedAssetRegistry::EnumerateAssets(const AssetEnumerationCB& enumerateCB) const
+    {
+        AZ::Data::AssetInfo assetInfo;
+        for (const AssetEntry& entry : m_assets)
+        {
+            if (entry.m_flags & HasAssetInfo)
+            {
+                FillAssetInfo(entry, assetInfo);
+                enumerateCB(assetInfo.m_assetId, assetInfo);
+            }
+        }
+    }
+
+    void MappedAssetRegistry::CopyToRegistry(AssetRegistry& registry) const
+    {
+        for (const AssetEntry& entry : m_assets)
+        {
+            const AZ::Data::AssetId assetId = ToAssetId(entry.m_id);
+            if (entry.m_flags & HasAssetInfo)
+            {
+                FillAssetInfo(entry, registry.m_assetIdToInfo[assetId]);
+            }
+            if (entry.m_flags & HasDependencies)
+            {
+                FillAssetDependencies(entry, registry.m_assetDependencies[assetId]);
+            }
+        }
+
+        for (const PathEntry& entry : m_paths)
+        {
+            registry.m_assetPathToId[ToUuid(entry.m_pathKey.m_data)] = ToAssetId(entry.m_id);
+        }
+    }
+} // namespace AzFramework
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/IO/MappedFile.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ::IO
+{
+    class GenericStream;
+}
+
+namespace AzFramework
+{
+    class AssetRegistry;
+
+    namespace MappedAssetRegistryInternal
+    {
+        struct Header;
+        struct AssetEntry;
+        struct PathEntry;
+        struct DependencyEntry;
+    }
+
+    /**
+    * Read-only asset registry which is used in place from a memory-mapped file instead of being deserialized.
+    * Asset ids and asset paths are looked up through minimal perfect hash tables that are built when the file is written,
+    * so opening the registry only needs to validate its header, no matter how many assets it contains.
+    * The data is stored in native byte order.
+    */
+    class MappedAssetRegistry
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(MappedAssetRegistry, AZ::SystemAllocator);
+
+        //! Writes the contents of a registry to a file in the mapped format.
+        static bool Save(const char* filePath, const AssetRegistry& registry);
+        //! Writes the contents of a registry to a stream in the mapped format.
+        static bool Write(AZ::IO::GenericStream& stream, const AssetRegistry& registry);
+
+        //! Returns true if the data starts with the header of a mapped asset registry.
+        static bool IsMappedAssetRegistry(AZStd::span<const AZStd::byte> data);
+
+        //! Maps the file at the provided path. Returns null if the file can't be mapped or isn't a valid mapped asset registry.
+        static AZStd::unique_ptr<MappedAssetRegistry> Open(const char* filePath);
+        //! Uses registry data that has already been read into memory, for instance because the file is stored in an archive.
+        //! The registry takes ownership of the buffer. Returns null if the data isn't a valid mapped asset registry.
+        static AZStd::unique_ptr<MappedAssetRegistry> Create(AZStd::vector<char> data);
+
+        size_t GetAssetCount() const;
+
+        bool ContainsAsset(const AZ::Data::AssetId& id) const;
+        //! Returns false if the asset isn't in the registry, or if the registry only has dependencies recorded for it.
+        bool GetAssetInfo(const AZ::Data::AssetId& id, AZ::Data::AssetInfo& assetInfo) const;
+        //! Returns false if the registry has no dependency list for the asset.
+        bool GetAssetDependencies(const AZ::Data::AssetId& id, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const;
+
+        //! LEGACY - do not use in new code unless interfacing with legacy systems.
+        AZ::Data::AssetId GetAssetIdByPath(AZStd::string_view assetPath) const;
+
+        using AssetEnumerationCB = AZStd::function<void(const AZ::Data::AssetId& id, const AZ::Data::AssetInfo& assetInfo)>;
+        //! Calls the callback for every asset which has asset info in the registry.
+        void EnumerateAssets(const AssetEnumerationCB& enumerateCB) const;
+
+        //! Copies the contents into a regular registry so they can be merged with other registries or saved in the object stream format.
+        void CopyToRegistry(AssetRegistry& registry) const;
+
+    private:
+        MappedAssetRegistry() = default;
+
+        bool Initialize(AZStd::span<const AZStd::byte> data);
+
+        const MappedAssetRegistryInternal::AssetEntry* FindAssetEntry(const AZ::Data::AssetId& id) const;
+        void FillAssetInfo(const MappedAssetRegistryInternal::AssetEntry& entry, AZ::Data::AssetInfo& assetInfo) const;
+        void FillAssetDependencies(
+            const MappedAssetRegistryInternal::AssetEntry& entry, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const;
+
+        //! Keeps the file mapped for as long as the registry is alive, when it was opened from a file.
+        AZStd::intrusive_ptr<AZ::IO::MappedFile> m_mappedFile;
+        //! Owns the data when the registry was created from a buffer that was read into memory.
+        AZStd::vector<char> m_ownedData;
+
+        const MappedAssetRegistryInternal::Header* m_header{ nullptr };
+        AZStd::span<const MappedAssetRegistryInternal::AssetEntry> m_assets;
+        AZStd::span<const AZ::u32> m_assetBuckets;
+        AZStd::span<const MappedAssetRegistryInternal::PathEntry> m_paths;
+        AZStd::span<const AZ::u32> m_pathBuckets;
+        AZStd::span<const MappedAssetRegistryInternal::DependencyEntry> m_dependencies;
+        AZStd::string_view m_strings;
+    };
+} // namespace AzFramework
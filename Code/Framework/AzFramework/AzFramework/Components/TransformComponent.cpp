@@ -12,9 +12,16 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/Quaternion.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
 
 namespace AZ
 {
@@ -80,6 +87,89 @@ namespace AZ
 
 namespace AzFramework
 {
+    AZ_CVAR(bool, transform_batchHierarchyUpdates, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When enabled, the descendants of a moved entity and the transform listeners are updated once at the end of the tick, "
+        "instead of on every transform change.");
+
+    namespace
+    {
+        // Below this number of transforms the hierarchy is updated on the calling thread, the jobs would cost more than the math
+        constexpr size_t MinTransformsForParallelHierarchyUpdate = 1024;
+
+        //! The transforms changed since the last hierarchy update.
+        class TransformHierarchyUpdateQueue
+            : public AZ::TickBus::Handler
+        {
+        public:
+            void Add(TransformComponent* transform)
+            {
+                AZStd::scoped_lock lock(m_mutex);
+                if (m_queued.empty())
+                {
+                    AZ::TickBus::Handler::BusConnect();
+                }
+                m_queued.push_back(transform);
+            }
+
+            void Remove(TransformComponent* transform)
+            {
+                AZStd::scoped_lock lock(m_mutex);
+                if (auto queuedIter = AZStd::find(m_queued.begin(), m_queued.end(), transform); queuedIter != m_queued.end())
+                {
+                    m_queued.erase(queuedIter);
+                    if (m_queued.empty())
+                    {
+                        AZ::TickBus::Handler::BusDisconnect();
+                    }
+                }
+                // The transform can be deactivated by a listener while its update is notified
+                AZStd::replace(m_updating.begin(), m_updating.end(), transform, static_cast<TransformComponent*>(nullptr));
+            }
+
+            //! Moves the queued transforms to the returned list, the notifications are sent to the transforms left in it.
+            AZStd::vector<TransformComponent*>& BeginUpdate()
+            {
+                AZStd::scoped_lock lock(m_mutex);
+                AZ::TickBus::Handler::BusDisconnect();
+                m_updating.swap(m_queued);
+                return m_updating;
+            }
+
+            void EndUpdate()
+            {
+                AZStd::scoped_lock lock(m_mutex);
+                m_updating.clear();
+            }
+
+            bool IsUpdating() const
+            {
+                return !m_updating.empty();
+            }
+
+            // TickBus
+            void OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/) override
+            {
+                TransformComponent::FlushHierarchyUpdates();
+            }
+
+            int GetTickOrder() override
+            {
+                return AZ::TICK_LAST;
+            }
+
+        private:
+            AZStd::mutex m_mutex;
+            AZStd::vector<TransformComponent*> m_queued;
+            AZStd::vector<TransformComponent*> m_updating;
+        };
+
+        TransformHierarchyUpdateQueue& GetHierarchyUpdateQueue()
+        {
+            static TransformHierarchyUpdateQueue s_queue;
+            return s_queue;
+        }
+    } // namespace
+
     bool TransformComponentVersionConverter(AZ::SerializeContext& context, AZ::SerializeContext::DataElementNode& classElement)
     {
         if (classElement.GetVersion() < 3)
@@ -158,6 +248,8 @@ namespace AzFramework
 
     void TransformComponent::Deactivate()
     {
+        CancelHierarchyUpdate();
+
         AZ::TransformNotificationBus::Event(m_parentId, &AZ::TransformNotificationBus::Events::OnChildRemoved, GetEntityId());
         auto parentTransform = AZ::TransformBus::FindFirstHandler(m_parentId);
         if (parentTransform)
@@ -619,13 +711,29 @@ namespace AzFramework
     void TransformComponent::SetLocalTMImpl(const AZ::Transform& tm)
     {
         m_localTM = tm;
-        ComputeWorldTM();  // We can user dirty flags and compute it later on demand
+        if (IsHierarchyUpdateBatched())
+        {
+            UpdateWorldTM();
+            QueueHierarchyUpdate(false);
+        }
+        else
+        {
+            ComputeWorldTM();
+        }
     }
 
     void TransformComponent::SetWorldTMImpl(const AZ::Transform& tm)
     {
         m_worldTM = tm;
-        ComputeLocalTM(); // We can user dirty flags and compute it later on demand
+        if (IsHierarchyUpdateBatched())
+        {
+            UpdateLocalTM();
+            QueueHierarchyUpdate(true);
+        }
+        else
+        {
+            ComputeLocalTM();
+        }
     }
 
     void TransformComponent::OnTransformChangedImpl(const AZ::Transform& /*parentLocalTM*/, const AZ::Transform& parentWorldTM)
@@ -636,10 +744,23 @@ namespace AzFramework
         {
             if (m_onParentChangedBehavior == AZ::OnParentChangedBehavior::Update)
             {
+                if (m_hierarchyUpdatePending)
+                {
+                    // The world transform was already updated with the parent hierarchy, the notification follows
+                    return;
+                }
+
                 m_worldTM = parentWorldTM * m_localTM;
-                AZ::TransformNotificationBus::Event(
-                    m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
-                m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+                if (IsHierarchyUpdateBatched())
+                {
+                    QueueHierarchyUpdate(false);
+                }
+                else
+                {
+                    AZ::TransformNotificationBus::Event(
+                        m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
+                    m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+                }
             }
             else
             {
@@ -654,14 +775,7 @@ namespace AzFramework
 
     void TransformComponent::ComputeLocalTM()
     {
-        if (m_parentTM)
-        {
-            m_localTM = m_parentTM->GetWorldTM().GetInverse() * m_worldTM;
-        }
-        else if (!m_parentActive)
-        {
-            m_localTM = m_worldTM;
-        }
+        UpdateLocalTM();
 
         AZ::TransformNotificationBus::Event(
             m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
@@ -675,6 +789,27 @@ namespace AzFramework
     }
 
     void TransformComponent::ComputeWorldTM()
+    {
+        UpdateWorldTM();
+
+        AZ::TransformNotificationBus::Event(
+            m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
+        m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+    }
+
+    void TransformComponent::UpdateLocalTM()
+    {
+        if (m_parentTM)
+        {
+            m_localTM = m_parentTM->GetWorldTM().GetInverse() * m_worldTM;
+        }
+        else if (!m_parentActive)
+        {
+            m_localTM = m_worldTM;
+        }
+    }
+
+    void TransformComponent::UpdateWorldTM()
     {
         if (m_parentTM)
         {
@@ -684,10 +819,167 @@ namespace AzFramework
         {
             m_worldTM = m_localTM;
         }
+    }
+
+    bool TransformComponent::IsHierarchyUpdateBatched() const
+    {
+        // The transforms set while the entity activates are notified right away, like the ones of an inactive entity
+        return transform_batchHierarchyUpdates && m_entity && m_entity->GetState() == AZ::Entity::State::Active;
+    }
+
+    void TransformComponent::QueueHierarchyUpdate(bool updateBounds)
+    {
+        m_boundsUpdateQueued |= updateBounds;
+        if (!m_hierarchyUpdateQueued)
+        {
+            m_hierarchyUpdateQueued = true;
+            GetHierarchyUpdateQueue().Add(this);
+        }
+    }
+
+    void TransformComponent::CancelHierarchyUpdate()
+    {
+        if (m_hierarchyUpdateQueued || m_hierarchyUpdatePending)
+        {
+            GetHierarchyUpdateQueue().Remove(this);
+            m_hierarchyUpdateQueued = false;
+            m_boundsUpdateQueued = false;
+            m_hierarchyUpdatePending = false;
+        }
+    }
+
+    bool TransformComponent::IsUpdatedWithQueuedAncestor() const
+    {
+        const TransformComponent* transform = this;
+        while (transform->m_onParentChangedBehavior == AZ::OnParentChangedBehavior::Update)
+        {
+            const TransformComponent* parent = azrtti_cast<const TransformComponent*>(transform->m_parentTM);
+            if (!parent)
+            {
+                return false;
+            }
+            if (parent->m_hierarchyUpdateQueued)
+            {
+                return true;
+            }
+            transform = parent;
+        }
+        return false;
+    }
+
+    void TransformComponent::NotifyHierarchyUpdate()
+    {
+        m_hierarchyUpdatePending = false;
 
         AZ::TransformNotificationBus::Event(
             m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+
+        if (m_boundsUpdateQueued)
+        {
+            m_boundsUpdateQueued = false;
+            AzFramework::IEntityBoundsUnion* boundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
+            if (boundsUnion != nullptr)
+            {
+                boundsUnion->OnTransformUpdated(GetEntity());
+            }
+        }
+    }
+
+    void TransformComponent::FlushHierarchyUpdates()
+    {
+        TransformHierarchyUpdateQueue& queue = GetHierarchyUpdateQueue();
+        if (queue.IsUpdating())
+        {
+            // Flushed by a listener, the transforms it moved are updated at the end of the tick
+            return;
+        }
+
+        AZStd::vector<TransformComponent*>& transforms = queue.BeginUpdate();
+        if (transforms.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(AzFramework);
+
+        // The queued transforms below another queued transform are updated with its subtree. The subtrees of the other ones are
+        // gathered in hierarchy order, a parent always comes before its children.
+        AZStd::vector<TransformComponent*> roots;
+        for (TransformComponent* transform : transforms)
+        {
+            if (!transform->IsUpdatedWithQueuedAncestor())
+            {
+                roots.push_back(transform);
+            }
+        }
+        for (TransformComponent* transform : transforms)
+        {
+            transform->m_hierarchyUpdateQueued = false;
+        }
+        transforms.clear();
+
+        AZStd::vector<size_t> subtreeStarts;
+        subtreeStarts.reserve(roots.size() + 1);
+        AZStd::vector<AZ::EntityId> children;
+        for (TransformComponent* root : roots)
+        {
+            subtreeStarts.push_back(transforms.size());
+            transforms.push_back(root);
+            for (size_t index = transforms.size() - 1; index < transforms.size(); ++index)
+            {
+                TransformComponent* parent = transforms[index];
+                children.clear();
+                AZ::TransformHierarchyInformationBus::Event(
+                    parent->GetEntityId(), &AZ::TransformHierarchyInformationBus::Events::GatherChildren, children);
+                for (const AZ::EntityId& childId : children)
+                {
+                    // The children that don't follow their parent, or that are not TransformComponents, update themselves
+                    // when the parent is notified
+                    auto child = azrtti_cast<TransformComponent*>(AZ::TransformBus::FindFirstHandler(childId));
+                    if (child && child->m_parentTM == parent &&
+                        child->m_onParentChangedBehavior == AZ::OnParentChangedBehavior::Update && child->IsHierarchyUpdateBatched())
+                    {
+                        child->m_hierarchyUpdatePending = true;
+                        transforms.push_back(child);
+                    }
+                }
+            }
+        }
+        subtreeStarts.push_back(transforms.size());
+
+        // The subtrees don't share any transform, they are updated in parallel when they are large enough
+        auto updateSubtree = [&transforms, &subtreeStarts](int subtreeIndex)
+        {
+            // The root of the subtree is already up to date
+            for (size_t index = subtreeStarts[subtreeIndex] + 1; index < subtreeStarts[subtreeIndex + 1]; ++index)
+            {
+                TransformComponent* transform = transforms[index];
+                transform->m_worldTM = static_cast<TransformComponent*>(transform->m_parentTM)->m_worldTM * transform->m_localTM;
+            }
+        };
+        const int subtreeCount = static_cast<int>(roots.size());
+        if (subtreeCount > 1 && transforms.size() >= MinTransformsForParallelHierarchyUpdate && AZ::JobContext::GetGlobalContext())
+        {
+            AZ::parallel_for(0, subtreeCount, updateSubtree);
+        }
+        else
+        {
+            for (int subtreeIndex = 0; subtreeIndex < subtreeCount; ++subtreeIndex)
+            {
+                updateSubtree(subtreeIndex);
+            }
+        }
+
+        // The listeners are notified once per transform, in hierarchy order, with the final transforms
+        for (size_t index = 0; index < transforms.size(); ++index)
+        {
+            if (TransformComponent* transform = transforms[index])
+            {
+                transform->NotifyHierarchyUpdate();
+            }
+        }
+        queue.EndUpdate();
     }
 
     bool TransformComponent::AreMoveRequestsAllowed() const
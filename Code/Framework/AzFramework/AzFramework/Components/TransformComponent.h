@@ -8,7 +8,7 @@
 
 #pragma once
 
-#include <AzCore/Component/Component.h>
+#include <AzCore/Component/DenseComponentStorage.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/Component/TickBus.h>
@@ -38,7 +38,7 @@ namespace AzFramework
         , private AZ::TransformHierarchyInformationBus::Handler
     {
     public:
-        AZ_COMPONENT(TransformComponent, AZ::TransformComponentTypeId, AZ::TransformInterface);
+        AZ_DENSE_COMPONENT(TransformComponent, AZ::TransformComponentTypeId, AZ::TransformInterface);
 
         friend class AzToolsFramework::Components::TransformComponent;
 
@@ -74,6 +74,11 @@ namespace AzFramework
         //! This will use worldTM as a localTM and move the transform relative to the parent.
         void SetParentRelative(AZ::EntityId id) override;
 
+        //! When transform_batchHierarchyUpdates is enabled, a transform change of an active entity only updates its own
+        //! transforms right away, its descendants and the listeners are updated once, in hierarchy order, at the end of the tick.
+        //! Applies the queued updates now, e.g. to read the world transforms of the descendants before the end of the tick.
+        static void FlushHierarchyUpdates();
+
     protected:
 
         // Component
@@ -162,6 +167,22 @@ namespace AzFramework
         void ComputeWorldTM();
         //////////////////////////////////////////////////////////////////////////
 
+        //! Derive one transform from the other and the parent world transform, without notifying.
+        //! @{
+        void UpdateLocalTM();
+        void UpdateWorldTM();
+        //! @}
+
+        //! Hierarchy update batching, see FlushHierarchyUpdates.
+        //! @{
+        bool IsHierarchyUpdateBatched() const;
+        void QueueHierarchyUpdate(bool updateBounds);
+        void CancelHierarchyUpdate();
+        //! Returns true when an ancestor queued for update will update this transform with its descendants.
+        bool IsUpdatedWithQueuedAncestor() const;
+        void NotifyHierarchyUpdate();
+        //! @}
+
         //! Returns whether external calls are currently allowed to move the transform.
         bool AreMoveRequestsAllowed() const;
 
@@ -190,5 +211,8 @@ namespace AzFramework
         bool m_isStatic = false; ///< If true, the transform is static and doesn't move while entity is active.
         /// Behavior for this entity's transform when its parent's transform changes.
         AZ::OnParentChangedBehavior m_onParentChangedBehavior = AZ::OnParentChangedBehavior::Update;
+        bool m_hierarchyUpdateQueued = false; ///< The descendants and the listeners are updated at the end of the tick.
+        bool m_boundsUpdateQueued = false; ///< The entity bounds are updated at the end of the tick.
+        bool m_hierarchyUpdatePending = false; ///< The world transform was updated with the queued ancestor, the notification follows.
     };
 }   // namespace AZ
@@ -20,6 +20,27 @@ namespace AZ::DocumentPropertyEditor
     }
 
     void RowAggregateAdapter::AddAdapter(DocumentAdapterPtr sourceAdapter)
+    {
+        ConnectAdapter(sourceAdapter);
+        NotifyResetDocument();
+    }
+
+    void RowAggregateAdapter::AddAdapters(AZStd::span<const DocumentAdapterPtr> sourceAdapters)
+    {
+        if (sourceAdapters.empty())
+        {
+            return;
+        }
+
+        m_adapters.reserve(m_adapters.size() + sourceAdapters.size());
+        for (const DocumentAdapterPtr& sourceAdapter : sourceAdapters)
+        {
+            ConnectAdapter(sourceAdapter);
+        }
+        NotifyResetDocument();
+    }
+
+    void RowAggregateAdapter::ConnectAdapter(DocumentAdapterPtr sourceAdapter)
     {
         // capture the actual adapter, not just the index, as adding or removing adapters could change the index
         auto& newAdapterInfo = m_adapters.emplace_back(AZStd::make_unique<AdapterInfo>());
@@ -48,7 +69,6 @@ namespace AZ::DocumentPropertyEditor
 
         const auto adapterIndex = m_adapters.size() - 1;
         PopulateNodesForAdapter(adapterIndex);
-        NotifyResetDocument();
     }
 
     void RowAggregateAdapter::RemoveAdapter(DocumentAdapterPtr sourceAdapter)
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzFramework/DocumentPropertyEditor/AdapterBuilder.h>
 #include <AzFramework/DocumentPropertyEditor/DocumentAdapter.h>
@@ -23,6 +24,9 @@ namespace AZ::DocumentPropertyEditor
         virtual ~RowAggregateAdapter();
 
         void AddAdapter(DocumentAdapterPtr sourceAdapter);
+        //! adds several source adapters at once, the aggregate contents are regenerated once for the whole batch
+        //! instead of once per adapter, which matters when multi-editing a large selection
+        void AddAdapters(AZStd::span<const DocumentAdapterPtr> sourceAdapters);
         void RemoveAdapter(DocumentAdapterPtr sourceAdapter);
         void ClearAdapters();
 
@@ -87,6 +91,9 @@ namespace AZ::DocumentPropertyEditor
         virtual bool ValuesMatch(const Dom::Value& left, const Dom::Value& right) = 0;
 
         // message handlers for all owned adapters
+        //! connects to the source adapter and adds its rows to the aggregate nodes, without notifying the listeners
+        void ConnectAdapter(DocumentAdapterPtr sourceAdapter);
+
         void HandleAdapterReset(DocumentAdapterPtr adapter);
         void HandleDomChange(DocumentAdapterPtr adapter, const Dom::Patch& patch);
         void HandleDomMessage(DocumentAdapterPtr adapter, const AZ::DocumentPropertyEditor::AdapterMessage& message, Dom::Value& value);
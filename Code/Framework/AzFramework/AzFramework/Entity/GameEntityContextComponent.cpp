@@ -221,16 +221,13 @@ namespace AzFramework
                 ApplicationRequests::Bus::Broadcast(&ApplicationRequests::PumpSystemEventLoopUntilEmpty);
             }
         };
-    #endif // (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
 
         for (AZ::Entity* entity : entities)
         {
             if (entity->GetState() == AZ::Entity::State::Constructed)
             {
                 entity->Init();
-            #if (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
                 PumpSystemEventsIfNeeded();
-            #endif // (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
             }
         }
 
@@ -241,12 +238,24 @@ namespace AzFramework
                 if (entity->IsRuntimeActiveByDefault())
                 {
                     entity->Activate();
-                #if (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
                     PumpSystemEventsIfNeeded();
-                #endif // (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
                 }
             }
         }
+    #else
+        m_entityActivator.InitEntities(entities);
+
+        AZStd::vector<AZ::Entity*> activeEntities;
+        activeEntities.reserve(entities.size());
+        for (AZ::Entity* entity : entities)
+        {
+            if (entity->GetState() == AZ::Entity::State::Init && entity->IsRuntimeActiveByDefault())
+            {
+                activeEntities.push_back(entity);
+            }
+        }
+        m_entityActivator.ActivateEntities(activeEntities);
+    #endif // (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
     }
 
     //=========================================================================
@@ -101,6 +101,7 @@ namespace AzFramework
         using namespace AZ::IO;
 
         AZ_Assert(request, "QueueRequest was provided a null request.");
+        request->RecordTraceStage(m_name.c_str());
 
         AZStd::visit([this, request](auto&& args)
         {
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzFramework/Input/Channels/InputChannel.h>
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/std/containers/vector.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace AzFramework
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Snapshot of an input channel event, taken when the event was broadcast by the input channel
+    struct InputChannelEventSnapshot
+    {
+        InputChannelId m_channelId;                              //!< Id of the input channel
+        InputDeviceId m_deviceId{ "" };                          //!< Id of the channel's input device
+        InputChannel::State m_state = InputChannel::State::Idle; //!< State of the channel at the event
+        float m_value = 0.0f;                                    //!< Value of the channel at the event
+        float m_delta = 0.0f;                                    //!< Delta of the channel at the event
+
+        //! The input channel itself, valid for the duration of the batch notification. It reflects the
+        //! state of the channel after all the input devices were ticked, use it to access custom data.
+        const InputChannel* m_inputChannel = nullptr;
+    };
+    using InputChannelEventBatch = AZStd::vector<InputChannelEventSnapshot>;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    //! EBus interface used to receive all the input channel events of a frame in one notification,
+    //! sent by the input system after it ticked the input devices and before OnPostInputUpdate.
+    //! Systems handling many input events (high polling rate mice, motion sensors, XR controllers)
+    //! can process them together instead of through one InputChannelNotificationBus call per event.
+    //! The events are only recorded while this bus has handlers, and they are recorded in the order
+    //! they were broadcast, including the events consumed by InputChannelEventListener instances.
+    class InputChannelEventBatchNotifications : public AZ::EBusTraits
+    {
+    public:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! EBus Trait: input notifications are addressed to a single address
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! EBus Trait: input notifications can be handled by multiple listeners
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Default destructor
+        virtual ~InputChannelEventBatchNotifications() = default;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Override to be notified of all the input channel events broadcast during an input update
+        //! \param[in] eventBatch The input channel events, in the order they were broadcast
+        virtual void OnInputChannelEventBatch(const InputChannelEventBatch& /*eventBatch*/) {}
+    };
+    using InputChannelEventBatchNotificationBus = AZ::EBus<InputChannelEventBatchNotifications>;
+} // namespace AzFramework
@@ -9,6 +9,7 @@
 #include <AzFramework/Input/System/InputSystemComponent.h>
 
 #include <AzFramework/Input/Buses/Notifications/InputSystemNotificationBus.h>
+#include <AzFramework/Input/Events/InputChannelEventListener.h>
 
 #include <AzFramework/Input/Devices/Gamepad/InputDeviceGamepad.h>
 #include <AzFramework/Input/Devices/Keyboard/InputDeviceKeyboard.h>
@@ -246,6 +247,8 @@ namespace AzFramework
     {
         AZ::TickBus::Handler::BusDisconnect();
         InputSystemRequestBus::Handler::BusDisconnect();
+        InputChannelNotificationBus::Handler::BusDisconnect();
+        m_inputChannelEventBatch.clear();
 
         // Destroy all enabled input devices
         DestroyEnabledInputDevices();
@@ -266,10 +269,32 @@ namespace AzFramework
     ////////////////////////////////////////////////////////////////////////////////////////////////
     void InputSystemComponent::TickInput()
     {
+        // Only record the input channel events when a system listens for the batched events
+        const bool recordInputChannelEvents = InputChannelEventBatchNotificationBus::HasHandlers();
+        if (recordInputChannelEvents != InputChannelNotificationBus::Handler::BusIsConnected())
+        {
+            if (recordInputChannelEvents)
+            {
+                InputChannelNotificationBus::Handler::BusConnect();
+            }
+            else
+            {
+                InputChannelNotificationBus::Handler::BusDisconnect();
+            }
+        }
+
         InputSystemNotificationBus::Broadcast(&InputSystemNotifications::OnPreInputUpdate);
         m_currentlyUpdatingInputDevices = true;
         InputDeviceRequestBus::Broadcast(&InputDeviceRequests::TickInputDevice);
         m_currentlyUpdatingInputDevices = false;
+
+        if (!m_inputChannelEventBatch.empty())
+        {
+            InputChannelEventBatchNotificationBus::Broadcast(&InputChannelEventBatchNotifications::OnInputChannelEventBatch,
+                                                             m_inputChannelEventBatch);
+            m_inputChannelEventBatch.clear();
+        }
+
         InputSystemNotificationBus::Broadcast(&InputSystemNotifications::OnPostInputUpdate);
 
         if (m_recreateInputDevicesAfterUpdate)
@@ -279,6 +304,25 @@ namespace AzFramework
         }
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void InputSystemComponent::OnInputChannelEvent(const InputChannel& inputChannel, bool& /*o_hasBeenConsumed*/)
+    {
+        InputChannelEventSnapshot& snapshot = m_inputChannelEventBatch.emplace_back();
+        snapshot.m_channelId = inputChannel.GetInputChannelId();
+        snapshot.m_deviceId = inputChannel.GetInputDevice().GetInputDeviceId();
+        snapshot.m_state = inputChannel.GetState();
+        snapshot.m_value = inputChannel.GetValue();
+        snapshot.m_delta = inputChannel.GetDelta();
+        snapshot.m_inputChannel = &inputChannel;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    AZ::s32 InputSystemComponent::GetPriority() const
+    {
+        // Record the events before any listener can consume them
+        return InputChannelEventListener::GetPriorityFirst();
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     void InputSystemComponent::RecreateEnabledInputDevices()
     {
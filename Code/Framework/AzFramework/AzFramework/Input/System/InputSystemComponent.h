@@ -7,6 +7,8 @@
  */
 #pragma once
 
+#include <AzFramework/Input/Buses/Notifications/InputChannelEventBatchNotificationBus.h>
+#include <AzFramework/Input/Buses/Notifications/InputChannelNotificationBus.h>
 #include <AzFramework/Input/Buses/Requests/InputSystemRequestBus.h>
 #include <AzFramework/Input/Buses/Requests/InputSystemCursorRequestBus.h>
 
@@ -34,6 +36,7 @@ namespace AzFramework
     class InputSystemComponent : public AZ::Component
                                , public AZ::TickBus::Handler
                                , public InputSystemRequestBus::Handler
+                               , public InputChannelNotificationBus::Handler
     {
     public:
         ////////////////////////////////////////////////////////////////////////////////////////////
@@ -90,6 +93,15 @@ namespace AzFramework
         //! \ref AzFramework::InputSystemRequests::TickInput
         void TickInput() override;
 
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! \ref AzFramework::InputChannelNotifications::OnInputChannelEvent
+        //! Only connected while InputChannelEventBatchNotificationBus has handlers, records the event
+        void OnInputChannelEvent(const InputChannel& inputChannel, bool& o_hasBeenConsumed) override;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! \ref AzFramework::InputChannelNotifications::GetPriority
+        AZ::s32 GetPriority() const override;
+
         ////////////////////////////////////////////////////////////////////////////////////////////
         //! \ref AzFramework::InputSystemRequests::RecreateEnabledInputDevices
         void RecreateEnabledInputDevices() override;
@@ -131,5 +143,6 @@ namespace AzFramework
         bool m_currentlyUpdatingInputDevices;   //!< Are we currently updating input devices?
         bool m_recreateInputDevicesAfterUpdate; //!< Should we recreate devices after update?
         bool m_captureMouseCursor;              //!< Should we capture the mouse cursor?
+        InputChannelEventBatch m_inputChannelEventBatch; //!< Input channel events of the current update
     };
 } // namespace AzFramework
@@ -203,6 +203,9 @@ namespace AzFramework
 
     using EntitySpawnCallback = AZStd::function<void(EntitySpawnTicket::Id, SpawnableConstEntityContainerView)>;
     using EntityPreInsertionCallback = AZStd::function<void(EntitySpawnTicket::Id, SpawnableEntityContainerView)>;
+    //! Called after each slice of a spawn request that's spread over multiple frames with the number of prototype entities that
+    //! have been processed so far and the total number of prototype entities in the request.
+    using EntitySpawnProgressCallback = AZStd::function<void(EntitySpawnTicket::Id, uint32_t, uint32_t)>;
     using EntityDespawnCallback = AZStd::function<void(EntitySpawnTicket::Id)>;
     using RetrieveEntitySpawnTicketCallback = AZStd::function<void(EntitySpawnTicket&&)>;
     using ReloadSpawnableCallback = AZStd::function<void(EntitySpawnTicket::Id, SpawnableConstEntityContainerView)>;
@@ -220,10 +223,17 @@ namespace AzFramework
         //! Callback that's called when spawning entities has completed. This can be triggered from a different thread than the one that
         //!     made the function call to spawn. The returned list of entities contains all the newly created entities.
         EntitySpawnCallback m_completionCallback;
+        //! Callback that's called every time a slice of the entities has been cloned. Spawn requests are split into slices when the
+        //!     spawnable entities manager has a processing budget, in which case they complete over multiple frames.
+        EntitySpawnProgressCallback m_progressCallback;
         //! The Serialize Context used to clone entities with. If this is not provided the global Serialize Contetx will be used.
         AZ::SerializeContext* m_serializeContext { nullptr };
         //! The priority at which this call will be executed.
         SpawnablePriority m_priority { SpawnablePriority_Default };
+        //! When the spawn is spread over multiple frames, entities are added to the world by default only once all of them have been
+        //!     cloned. If this flag is set to "true", each slice of entities is added to the world as soon as it has been cloned instead.
+        //!     The pre-insertion callback will be called for every slice in that case.
+        bool m_activateIncrementally{ false };
     };
 
     struct SpawnEntitiesOptionalArgs final
@@ -234,10 +244,17 @@ namespace AzFramework
         //! Callback that's called when spawning entities has completed. This can be triggered from a different thread than the one that
         //!     made the function call to spawn. The returned list of entities contains all the newly created entities.
         EntitySpawnCallback m_completionCallback;
+        //! Callback that's called every time a slice of the entities has been cloned. Spawn requests are split into slices when the
+        //!     spawnable entities manager has a processing budget, in which case they complete over multiple frames.
+        EntitySpawnProgressCallback m_progressCallback;
         //! The Serialize Context used to clone entities with. If this is not provided the global Serialize Contetx will be used.
         AZ::SerializeContext* m_serializeContext{ nullptr };
         //! The priority at which this call will be executed.
         SpawnablePriority m_priority{ SpawnablePriority_Default };
+        //! When the spawn is spread over multiple frames, entities are added to the world by default only once all of them have been
+        //!     cloned. If this flag is set to "true", each slice of entities is added to the world as soon as it has been cloned instead.
+        //!     The pre-insertion callback will be called for every slice in that case.
+        bool m_activateIncrementally{ false };
         //! Entity references are resolved by referring to the most recent entity spawned from a template entity in the spawnable.
         //! If the entity referred to hasn't been spawned yet, the reference will be resolved to the first one that *will* be spawned.
         //! If this flag is set to "true", the id mappings will persist across SpawnEntites calls, and the entity references will resolve
@@ -13,6 +13,8 @@
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Spawnable/Spawnable.h>
@@ -44,6 +46,30 @@ namespace AzFramework
             AZ::u64 value = aznumeric_caster(m_highPriorityThreshold);
             settingsRegistry->Get(value, "/O3DE/AzFramework/Spawnables/HighPriorityThreshold");
             m_highPriorityThreshold = aznumeric_cast<SpawnablePriority>(AZStd::clamp(value, 0llu, 255llu));
+
+            auto loadBudget = [settingsRegistry](ProcessingBudget& budget, AZStd::string_view entityBudgetKey, AZStd::string_view timeBudgetKey)
+            {
+                AZ::u64 entityBudget = budget.m_maxEntities;
+                settingsRegistry->Get(entityBudget, entityBudgetKey);
+                budget.m_maxEntities = aznumeric_cast<uint32_t>(AZStd::min<AZ::u64>(entityBudget, AZStd::numeric_limits<uint32_t>::max()));
+
+                AZ::u64 timeBudget = budget.m_maxTime.count();
+                settingsRegistry->Get(timeBudget, timeBudgetKey);
+                budget.m_maxTime = AZStd::chrono::microseconds(timeBudget);
+            };
+            loadBudget(
+                m_highPriorityQueue.m_budget,
+                "/O3DE/AzFramework/Spawnables/HighPriorityEntityBudget",
+                "/O3DE/AzFramework/Spawnables/HighPriorityTimeBudgetUs");
+            loadBudget(
+                m_regularPriorityQueue.m_budget,
+                "/O3DE/AzFramework/Spawnables/RegularPriorityEntityBudget",
+                "/O3DE/AzFramework/Spawnables/RegularPriorityTimeBudgetUs");
+
+            AZ::u64 parallelCloneThreshold = m_parallelCloneThreshold;
+            settingsRegistry->Get(parallelCloneThreshold, "/O3DE/AzFramework/Spawnables/ParallelCloneThreshold");
+            m_parallelCloneThreshold =
+                aznumeric_cast<uint32_t>(AZStd::min<AZ::u64>(parallelCloneThreshold, AZStd::numeric_limits<uint32_t>::max()));
         }
     }
 
@@ -62,6 +88,8 @@ namespace AzFramework
             optionalArgs.m_serializeContext == nullptr ? m_defaultSerializeContext : optionalArgs.m_serializeContext;
         queueEntry.m_completionCallback = AZStd::move(optionalArgs.m_completionCallback);
         queueEntry.m_preInsertionCallback = AZStd::move(optionalArgs.m_preInsertionCallback);
+        queueEntry.m_progressCallback = AZStd::move(optionalArgs.m_progressCallback);
+        queueEntry.m_activateIncrementally = optionalArgs.m_activateIncrementally;
         QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
     }
 
@@ -77,7 +105,9 @@ namespace AzFramework
             optionalArgs.m_serializeContext == nullptr ? m_defaultSerializeContext : optionalArgs.m_serializeContext;
         queueEntry.m_completionCallback = AZStd::move(optionalArgs.m_completionCallback);
         queueEntry.m_preInsertionCallback = AZStd::move(optionalArgs.m_preInsertionCallback);
+        queueEntry.m_progressCallback = AZStd::move(optionalArgs.m_progressCallback);
         queueEntry.m_referencePreviouslySpawnedEntities = optionalArgs.m_referencePreviouslySpawnedEntities;
+        queueEntry.m_activateIncrementally = optionalArgs.m_activateIncrementally;
         QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
     }
 
@@ -230,8 +260,62 @@ namespace AzFramework
         return result;
     }
 
+    void SpawnableEntitiesManager::SetProcessingBudget(CommandQueuePriority priority, const ProcessingBudget& budget)
+    {
+        if ((priority & CommandQueuePriority::High) == CommandQueuePriority::High)
+        {
+            m_highPriorityQueue.m_budget = budget;
+        }
+        if ((priority & CommandQueuePriority::Regular) == CommandQueuePriority::Regular)
+        {
+            m_regularPriorityQueue.m_budget = budget;
+        }
+    }
+
+    auto SpawnableEntitiesManager::GetProcessingBudget(CommandQueuePriority priority) const -> const ProcessingBudget&
+    {
+        return (priority & CommandQueuePriority::High) == CommandQueuePriority::High ? m_highPriorityQueue.m_budget
+                                                                                      : m_regularPriorityQueue.m_budget;
+    }
+
+    void SpawnableEntitiesManager::SetParallelCloneThreshold(uint32_t threshold)
+    {
+        m_parallelCloneThreshold = threshold;
+    }
+
+    void SpawnableEntitiesManager::BeginProcessingBudget(const ProcessingBudget& budget)
+    {
+        m_activeBudget = budget;
+        m_budgetEntitiesProcessed = 0;
+        if (budget.m_maxTime.count() > 0)
+        {
+            m_budgetDeadline = AZStd::chrono::steady_clock::now() + budget.m_maxTime;
+        }
+    }
+
+    bool SpawnableEntitiesManager::IsProcessingBudgetExhausted() const
+    {
+        // Always allow at least one entity to be processed so spawning can't stall on a budget that's too small.
+        if (m_budgetEntitiesProcessed == 0)
+        {
+            return false;
+        }
+        if (m_activeBudget.m_maxEntities > 0 && m_budgetEntitiesProcessed >= m_activeBudget.m_maxEntities)
+        {
+            return true;
+        }
+        return m_activeBudget.m_maxTime.count() > 0 && AZStd::chrono::steady_clock::now() >= m_budgetDeadline;
+    }
+
+    void SpawnableEntitiesManager::ConsumeProcessingBudget(uint32_t entityCount)
+    {
+        m_budgetEntitiesProcessed += entityCount;
+    }
+
     auto SpawnableEntitiesManager::ProcessQueue(Queue& queue) -> CommandQueueStatus
     {
+        BeginProcessingBudget(queue.m_budget);
+
         // Process delayed requests first.
         // Only process the requests that are currently in this queue, not the ones that could be re-added if they still can't complete.
         size_t delayedSize = queue.m_delayed.size();
@@ -342,20 +426,74 @@ namespace AzFramework
         return reinterpret_cast<Ticket*>(ticket)->m_spawnable;
     }
 
-    AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(const AZ::Entity& entityPrototype,
-        EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
+    SpawnableEntitiesManager::TaskEntityIdMap::TaskEntityIdMap(const EntityIdMap& sharedMap)
+        : m_sharedMap(sharedMap)
+    {
+    }
+
+    AZ::EntityId SpawnableEntitiesManager::TaskEntityIdMap::MapId(
+        const AZ::EntityId& originalId, bool replaceId, const AZStd::function<AZ::EntityId()>& idGenerator)
+    {
+        // Mirrors the mapping done by AZ::IdUtils::Remapper::GenerateNewIdsAndFixRefs, without writing to the shared map.
+        if (auto sharedIt = m_sharedMap.find(originalId); sharedIt != m_sharedMap.end())
+        {
+            return (!replaceId || idGenerator) ? sharedIt->second : originalId;
+        }
+        if (replaceId)
+        {
+            return idGenerator ? m_localMap.emplace(originalId, idGenerator()).first->second : originalId;
+        }
+        auto localIt = m_localMap.find(originalId);
+        return localIt != m_localMap.end() ? localIt->second : originalId;
+    }
+
+    auto SpawnableEntitiesManager::TaskEntityIdMap::GetLocalMap() -> EntityIdMap&
+    {
+        return m_localMap;
+    }
+
+    template<typename T>
+    T* SpawnableEntitiesManager::CloneWithNewIds(const T& prototype, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
     {
         // If the same ID gets remapped more than once, preserve the original remapping instead of overwriting it.
         constexpr bool allowDuplicateIds = false;
 
         return AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::CloneObjectAndGenerateNewIdsAndFixRefs(
-            &entityPrototype, prototypeToCloneMap, &serializeContext);
+            &prototype, prototypeToCloneMap, &serializeContext);
     }
 
+    template<typename T>
+    T* SpawnableEntitiesManager::CloneWithNewIds(
+        const T& prototype, TaskEntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
+    {
+        using Remapper = AZ::IdUtils::Remapper<AZ::EntityId, false>;
+
+        T* clone = serializeContext.CloneObject(&prototype);
+        if (clone)
+        {
+            Remapper::ReplaceIdsAndIdRefs(
+                clone,
+                [&prototypeToCloneMap](const AZ::EntityId& originalId, bool replaceId, const Remapper::IdGenerator& idGenerator)
+                {
+                    return prototypeToCloneMap.MapId(originalId, replaceId, idGenerator);
+                },
+                &serializeContext);
+        }
+        return clone;
+    }
+
+    template<typename IdMap>
+    AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(const AZ::Entity& entityPrototype,
+        IdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
+    {
+        return CloneWithNewIds(entityPrototype, prototypeToCloneMap, serializeContext);
+    }
+
+    template<typename IdMap>
     AZ::Entity* SpawnableEntitiesManager::CloneSingleAliasedEntity(
         const AZ::Entity& entityPrototype,
         const Spawnable::EntityAlias& alias,
-        EntityIdMap& prototypeToCloneMap,
+        IdMap& prototypeToCloneMap,
         AZ::Entity* previouslySpawnedEntity,
         AZ::SerializeContext& serializeContext)
     {
@@ -392,19 +530,17 @@ namespace AzFramework
         }
     }
 
+    template<typename IdMap>
     void SpawnableEntitiesManager::AppendComponents(
         AZ::Entity& target,
         const AZ::Entity::ComponentArrayType& componentPrototypes,
-        EntityIdMap& prototypeToCloneMap,
+        IdMap& prototypeToCloneMap,
         AZ::SerializeContext& serializeContext)
     {
         // Only components are added and entities are looked up so no duplicate entity ids should be encountered.
-        constexpr bool allowDuplicateIds = false;
-
         for (const AZ::Component* component : componentPrototypes)
         {
-            AZ::Component* clone = AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::CloneObjectAndGenerateNewIdsAndFixRefs(
-                component, prototypeToCloneMap, &serializeContext);
+            AZ::Component* clone = CloneWithNewIds(*component, prototypeToCloneMap, serializeContext);
             AZ_Assert(clone, "Unable to clone component for entity '%s' (%zu).", target.GetName().c_str(), target.GetId());
             [[maybe_unused]] bool result = target.AddComponent(clone);
             AZ_Assert(result, "Unable to add cloned component to entity '%s' (%zu).", target.GetName().c_str(), target.GetId());
@@ -444,111 +580,272 @@ namespace AzFramework
         }
     }
 
+    template<typename IdMap>
+    void SpawnableEntitiesManager::CloneEntityAtIndex(
+        uint32_t index,
+        const Spawnable::EntityList& entitiesToSpawn,
+        const Spawnable::EntityAliasConstVisitor& aliases,
+        IdMap& prototypeToCloneMap,
+        AZ::SerializeContext& serializeContext,
+        AZStd::vector<AZ::Entity*>& spawnedEntities,
+        AZStd::vector<uint32_t>& spawnedEntityIndices)
+    {
+        auto aliasEnd = aliases.end();
+        auto aliasIt = AZStd::lower_bound(
+            aliases.begin(), aliasEnd, index,
+            [](const Spawnable::EntityAlias& lhs, uint32_t rhs)
+            {
+                return lhs.m_sourceIndex < rhs;
+            });
+
+        if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != index)
+        {
+            spawnedEntities.emplace_back(CloneSingleEntity(*entitiesToSpawn[index], prototypeToCloneMap, serializeContext));
+            spawnedEntityIndices.push_back(index);
+        }
+        else
+        {
+            // The list of entities has already been sorted and optimized (See SpawnableEntitiesAliasList:Optimize) so can
+            // be safely executed in order without risking an invalid state.
+            AZ::Entity* previousEntity = nullptr;
+            do
+            {
+                AZ::Entity* clone =
+                    CloneSingleAliasedEntity(*entitiesToSpawn[index], *aliasIt, prototypeToCloneMap, previousEntity, serializeContext);
+                previousEntity = clone;
+                if (clone)
+                {
+                    spawnedEntities.emplace_back(clone);
+                    spawnedEntityIndices.push_back(index);
+                }
+                ++aliasIt;
+            } while (aliasIt != aliasEnd && aliasIt->m_sourceIndex == index);
+        }
+    }
+
+    uint32_t SpawnableEntitiesManager::GetParallelCloneBatchSize(uint32_t entitiesLeft) const
+    {
+        if (m_parallelCloneThreshold == 0)
+        {
+            return 0;
+        }
+
+        uint32_t batchSize = entitiesLeft;
+        if (m_activeBudget.m_maxEntities > 0)
+        {
+            // Only called while the budget isn't exhausted, so there's always room for at least one more entity.
+            batchSize = AZStd::min(batchSize, m_activeBudget.m_maxEntities - m_budgetEntitiesProcessed);
+        }
+        if (m_activeBudget.m_maxTime.count() > 0)
+        {
+            // The time budget is only checked in between batches, so keep the batches small enough to stop close to the deadline.
+            batchSize = AZStd::min(batchSize, m_parallelCloneThreshold);
+        }
+        if (batchSize < m_parallelCloneThreshold)
+        {
+            return 0;
+        }
+
+        // Waiting for tasks from a task worker could deadlock the executor.
+        const AZ::TaskGraphActiveInterface* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (!taskGraphActive || !taskGraphActive->IsTaskGraphActive() || AZ::TaskExecutor::GetCurrentExecutor() != nullptr)
+        {
+            return 0;
+        }
+        return batchSize;
+    }
+
+    void SpawnableEntitiesManager::CloneEntitiesInParallel(
+        Ticket& ticket,
+        uint32_t begin,
+        uint32_t end,
+        const Spawnable::EntityList& entitiesToSpawn,
+        const Spawnable::EntityAliasConstVisitor& aliases,
+        AZ::SerializeContext& serializeContext)
+    {
+        // Id mappings are updated up front, so the ticket's map stays unchanged while the tasks read from it.
+        for (uint32_t index = begin; index < end; ++index)
+        {
+            RefreshEntityIdMapping(entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+        }
+
+        struct Batch
+        {
+            explicit Batch(const EntityIdMap& sharedMap)
+                : m_idMap(sharedMap)
+            {
+            }
+
+            TaskEntityIdMap m_idMap;
+            AZStd::vector<AZ::Entity*> m_entities;
+            AZStd::vector<uint32_t> m_entityIndices;
+            uint32_t m_begin{ 0 };
+            uint32_t m_end{ 0 };
+        };
+
+        constexpr uint32_t MinEntitiesPerBatch = 16;
+        const uint32_t entityCount = end - begin;
+        const uint32_t maxBatchCount = aznumeric_cast<uint32_t>(AZ::TaskExecutor::Instance().GetWorkerCount() * 4);
+        const uint32_t batchCount =
+            AZStd::clamp<uint32_t>((entityCount + MinEntitiesPerBatch - 1) / MinEntitiesPerBatch, 1, AZStd::max(maxBatchCount, 1u));
+        const uint32_t entitiesPerBatch = (entityCount + batchCount - 1) / batchCount;
+
+        AZStd::vector<Batch> batches;
+        batches.reserve(batchCount);
+        for (uint32_t batchIndex = 0; batchIndex < batchCount; ++batchIndex)
+        {
+            Batch& batch = batches.emplace_back(ticket.m_entityIdReferenceMap);
+            batch.m_begin = begin + batchIndex * entitiesPerBatch;
+            batch.m_end = AZStd::min(end, batch.m_begin + entitiesPerBatch);
+        }
+
+        static const AZ::TaskDescriptor cloneDescriptor{ "SpawnableEntitiesManager::CloneEntitiesInParallel", "Spawnable" };
+        AZ::TaskGraph graph{ "SpawnableEntityClone" };
+        for (Batch& batch : batches)
+        {
+            graph.AddTask(
+                cloneDescriptor,
+                [this, &batch, &entitiesToSpawn, &aliases, &serializeContext]()
+                {
+                    batch.m_entities.reserve(batch.m_end - batch.m_begin);
+                    batch.m_entityIndices.reserve(batch.m_end - batch.m_begin);
+                    for (uint32_t index = batch.m_begin; index < batch.m_end; ++index)
+                    {
+                        CloneEntityAtIndex(
+                            index, entitiesToSpawn, aliases, batch.m_idMap, serializeContext, batch.m_entities, batch.m_entityIndices);
+                    }
+                });
+        }
+        AZ::TaskGraphEvent finishedEvent{ "SpawnableEntityClone Wait" };
+        graph.Submit(&finishedEvent);
+        finishedEvent.Wait();
+
+        // Gather the results in prototype order, so the ticket ends up in the same state as when cloning one entity at a time.
+        for (Batch& batch : batches)
+        {
+            ticket.m_spawnedEntities.insert(ticket.m_spawnedEntities.end(), batch.m_entities.begin(), batch.m_entities.end());
+            ticket.m_spawnedEntityIndices.insert(
+                ticket.m_spawnedEntityIndices.end(), batch.m_entityIndices.begin(), batch.m_entityIndices.end());
+            for (auto& [originalId, newId] : batch.m_idMap.GetLocalMap())
+            {
+                ticket.m_entityIdReferenceMap.emplace(originalId, newId);
+            }
+        }
+    }
+
+    void SpawnableEntitiesManager::ActivateSpawnedEntities(
+        Ticket& ticket, EntitySpawnTicket::Id ticketId, const EntityPreInsertionCallback& preInsertionCallback, SpawnProgress& progress)
+    {
+        auto newEntitiesBegin = ticket.m_spawnedEntities.begin() + progress.m_activatedCount;
+        auto newEntitiesEnd = ticket.m_spawnedEntities.end();
+        if (newEntitiesBegin == newEntitiesEnd)
+        {
+            return;
+        }
+
+        // Let other systems know about newly spawned entities for any pre-processing before adding to the scene/game context.
+        if (preInsertionCallback)
+        {
+            preInsertionCallback(ticketId, SpawnableEntityContainerView(newEntitiesBegin, newEntitiesEnd));
+        }
+
+        // Add to the game context, now the entities are active
+        for (auto it = newEntitiesBegin; it != newEntitiesEnd; ++it)
+        {
+            AZ::Entity* clone = (*it);
+            clone->SetEntitySpawnTicketId(ticketId);
+            GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
+        }
+
+        progress.m_activatedCount = ticket.m_spawnedEntities.size();
+    }
+
     auto SpawnableEntitiesManager::ProcessRequest(SpawnAllEntitiesCommand& request) -> CommandResult
     {
         Ticket& ticket = *request.m_ticket;
-        if (ticket.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId)
+        if (ticket.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId && !IsProcessingBudgetExhausted())
         {
             if (Spawnable::EntityAliasConstVisitor aliases = ticket.m_spawnable->TryGetAliasesConst();
                 aliases.IsValid() && aliases.AreAllSpawnablesReady())
             {
-                AZStd::vector<AZ::Entity*>& spawnedEntities = ticket.m_spawnedEntities;
-                AZStd::vector<uint32_t>& spawnedEntityIndices = ticket.m_spawnedEntityIndices;
-
-                // Keep track how many entities there were in the array initially
-                size_t spawnedEntitiesInitialCount = spawnedEntities.size();
+                SpawnProgress& progress = request.m_progress;
 
                 // These are 'prototype' entities we'll be cloning from
                 const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
                 uint32_t entitiesToSpawnSize = aznumeric_caster(entitiesToSpawn.size());
 
-                // Reserve buffers
-                spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
-                spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
-
-                // Pre-generate the full set of entity-id-to-new-entity-id mappings, so that during the clone operation below,
-                // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
-                // We clear out and regenerate the set of IDs on every SpawnAllEntities call, because presumably every entity reference
-                // in every entity we're about to instantiate is intended to point to an entity in our newly-instantiated batch, regardless
-                // of spawn order.  If we didn't clear out the map, it would be possible for some entities here to have references to
-                // previously-spawned entities from a previous SpawnEntities or SpawnAllEntities call.
-                InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
-
-                auto aliasIt = aliases.begin();
-                auto aliasEnd = aliases.end();
-                if (aliasIt == aliasEnd)
+                if (!progress.m_isStarted)
                 {
-                    for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
-                    {
-                        // If this entity has previously been spawned, give it a new id in the reference map
-                        RefreshEntityIdMapping(
-                            entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                    // Keep track how many entities there were in the array initially
+                    progress.m_spawnedEntitiesInitialCount = ticket.m_spawnedEntities.size();
+                    progress.m_activatedCount = progress.m_spawnedEntitiesInitialCount;
+                    progress.m_isStarted = true;
 
-                        spawnedEntities.emplace_back(
-                            CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
-                        spawnedEntityIndices.push_back(i);
-                    }
+                    // Reserve buffers
+                    ticket.m_spawnedEntities.reserve(ticket.m_spawnedEntities.size() + entitiesToSpawnSize);
+                    ticket.m_spawnedEntityIndices.reserve(ticket.m_spawnedEntityIndices.size() + entitiesToSpawnSize);
+
+                    // Pre-generate the full set of entity-id-to-new-entity-id mappings, so that during the clone operation below,
+                    // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
+                    // We clear out and regenerate the set of IDs on every SpawnAllEntities call, because presumably every entity
+                    // reference in every entity we're about to instantiate is intended to point to an entity in our newly-instantiated
+                    // batch, regardless of spawn order.  If we didn't clear out the map, it would be possible for some entities here to
+                    // have references to previously-spawned entities from a previous SpawnEntities or SpawnAllEntities call.
+                    // The map is kept on the ticket, so it stays intact if cloning is spread over multiple calls.
+                    InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+
+                    // There were no initial entities then the ticket now holds exactly all entities. If there were already entities
+                    // then a new set are not added so it no longer holds exactly the number of entities.
+                    ticket.m_loadAll = progress.m_spawnedEntitiesInitialCount == 0;
                 }
-                else
+
+                uint32_t index = progress.m_nextIndex;
+                while (index < entitiesToSpawnSize && !IsProcessingBudgetExhausted())
                 {
-                    for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
+                    if (uint32_t batchSize = GetParallelCloneBatchSize(entitiesToSpawnSize - index); batchSize > 0)
+                    {
+                        CloneEntitiesInParallel(ticket, index, index + batchSize, entitiesToSpawn, aliases, *request.m_serializeContext);
+                        ConsumeProcessingBudget(batchSize);
+                        index += batchSize;
+                    }
+                    else
                     {
                         // If this entity has previously been spawned, give it a new id in the reference map
                         RefreshEntityIdMapping(
-                            entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
-
-                        if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != i)
-                        {
-                            spawnedEntities.emplace_back(
-                                CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
-                            spawnedEntityIndices.push_back(i);
-                        }
-                        else
-                        {
-                            // The list of entities has already been sorted and optimized (See SpawnableEntitiesAliasList:Optimize) so can
-                            // be safely executed in order without risking an invalid state.
-                            AZ::Entity* previousEntity = nullptr;
-                            do
-                            {
-                                AZ::Entity* clone = CloneSingleAliasedEntity(
-                                    *entitiesToSpawn[i], *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
-                                    *request.m_serializeContext);
-                                previousEntity = clone;
-                                if (clone)
-                                {
-                                    spawnedEntities.emplace_back(clone);
-                                    spawnedEntityIndices.push_back(i);
-                                }
-                                ++aliasIt;
-                            } while (aliasIt != aliasEnd && aliasIt->m_sourceIndex == i);
-                        }
+                            entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                        CloneEntityAtIndex(
+                            index, entitiesToSpawn, aliases, ticket.m_entityIdReferenceMap, *request.m_serializeContext,
+                            ticket.m_spawnedEntities, ticket.m_spawnedEntityIndices);
+                        ConsumeProcessingBudget();
+                        ++index;
                     }
                 }
+                progress.m_nextIndex = index;
+                bool isComplete = index == entitiesToSpawnSize;
 
-                // There were no initial entities then the ticket now holds exactly all entities. If there were already entities then
-                // a new set are not added so it no longer holds exactly the number of entities.
-                ticket.m_loadAll = spawnedEntitiesInitialCount == 0;
+                if (isComplete || request.m_activateIncrementally)
+                {
+                    ActivateSpawnedEntities(ticket, request.m_ticketId, request.m_preInsertionCallback, progress);
+                }
 
-                auto newEntitiesBegin = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount;
-                auto newEntitiesEnd = ticket.m_spawnedEntities.end();
-                // Let other systems know about newly spawned entities for any pre-processing before adding to the scene/game context.
-                if (request.m_preInsertionCallback)
+                if (request.m_progressCallback)
                 {
-                    request.m_preInsertionCallback(request.m_ticketId, SpawnableEntityContainerView(newEntitiesBegin, newEntitiesEnd));
+                    request.m_progressCallback(request.m_ticketId, index, entitiesToSpawnSize);
                 }
 
-                // Add to the game context, now the entities are active
-                for (auto it = newEntitiesBegin; it != newEntitiesEnd; ++it)
+                if (!isComplete)
                 {
-                    AZ::Entity* clone = (*it);
-                    clone->SetEntitySpawnTicketId(request.m_ticketId);
-                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
+                    // Resume on the next call. Later requests on this ticket wait on the request id so they see the final state.
+                    return CommandResult::Requeue;
                 }
 
                 // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
                 if (request.m_completionCallback)
                 {
-                    request.m_completionCallback(request.m_ticketId, SpawnableConstEntityContainerView(newEntitiesBegin, newEntitiesEnd));
+                    request.m_completionCallback(
+                        request.m_ticketId,
+                        SpawnableConstEntityContainerView(
+                            ticket.m_spawnedEntities.begin() + progress.m_spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
                 }
 
                 ticket.m_currentRequestId++;
@@ -561,121 +858,78 @@ namespace AzFramework
     auto SpawnableEntitiesManager::ProcessRequest(SpawnEntitiesCommand& request) -> CommandResult
     {
         Ticket& ticket = *request.m_ticket;
-        if (ticket.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId)
+        if (ticket.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId && !IsProcessingBudgetExhausted())
         {
             if (Spawnable::EntityAliasConstVisitor aliases = ticket.m_spawnable->TryGetAliasesConst();
                 aliases.IsValid() && aliases.AreAllSpawnablesReady())
             {
-                AZStd::vector<AZ::Entity*>& spawnedEntities = ticket.m_spawnedEntities;
-                AZStd::vector<uint32_t>& spawnedEntityIndices = ticket.m_spawnedEntityIndices;
                 AZ_Assert(
-                    spawnedEntities.size() == spawnedEntityIndices.size(),
+                    ticket.m_spawnedEntities.size() == ticket.m_spawnedEntityIndices.size(),
                     "The indices for the spawned entities has gone out of sync with the entities.");
 
-                // Keep track of how many entities there were in the array initially
-                size_t spawnedEntitiesInitialCount = spawnedEntities.size();
+                SpawnProgress& progress = request.m_progress;
 
                 // These are 'prototype' entities we'll be cloning from
                 const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
-                size_t entitiesToSpawnSize = request.m_entityIndices.size();
+                uint32_t entitiesToSpawnSize = aznumeric_caster(request.m_entityIndices.size());
 
-                if (ticket.m_entityIdReferenceMap.empty() || !request.m_referencePreviouslySpawnedEntities)
+                if (!progress.m_isStarted)
                 {
-                    // This map keeps track of ids from prototype (spawnable) to clone (instance) allowing patch ups of fields referring
-                    // to entityIds outside of a given entity.
-                    // We pre-generate the full set of entity id to new entity id mappings, so that during the clone operation below,
-                    // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
-                    // By default, we only initialize this map once because it needs to persist across multiple SpawnEntities calls, so
-                    // that reference fixups work even when the entity being referenced is spawned in a different SpawnEntities
-                    // (or SpawnAllEntities) call.
-                    // However, the caller can also choose to reset the map by passing in "m_referencePreviouslySpawnedEntities = false".
-                    InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
-                }
-
-                spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
-                spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
+                    // Keep track of how many entities there were in the array initially
+                    progress.m_spawnedEntitiesInitialCount = ticket.m_spawnedEntities.size();
+                    progress.m_activatedCount = progress.m_spawnedEntitiesInitialCount;
+                    progress.m_isStarted = true;
 
-                auto aliasBegin = aliases.begin();
-                auto aliasEnd = aliases.end();
-                if (aliasBegin == aliasEnd)
-                {
-                    for (uint32_t index : request.m_entityIndices)
+                    if (ticket.m_entityIdReferenceMap.empty() || !request.m_referencePreviouslySpawnedEntities)
                     {
-                        if (index < entitiesToSpawn.size())
-                        {
-                            // If this entity has previously been spawned, give it a new id in the reference map
-                            RefreshEntityIdMapping(
-                                entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
-
-                            spawnedEntities.push_back(
-                                CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
-                            spawnedEntityIndices.push_back(index);
-                        }
+                        // This map keeps track of ids from prototype (spawnable) to clone (instance) allowing patch ups of fields
+                        // referring to entityIds outside of a given entity.
+                        // We pre-generate the full set of entity id to new entity id mappings, so that during the clone operation below,
+                        // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
+                        // By default, we only initialize this map once because it needs to persist across multiple SpawnEntities calls,
+                        // so that reference fixups work even when the entity being referenced is spawned in a different SpawnEntities
+                        // (or SpawnAllEntities) call.
+                        // However, the caller can also choose to reset the map by passing in "m_referencePreviouslySpawnedEntities = false".
+                        InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
                     }
+
+                    ticket.m_spawnedEntities.reserve(ticket.m_spawnedEntities.size() + entitiesToSpawnSize);
+                    ticket.m_spawnedEntityIndices.reserve(ticket.m_spawnedEntityIndices.size() + entitiesToSpawnSize);
+                    ticket.m_loadAll = false;
                 }
-                else
+
+                uint32_t requestIndex = progress.m_nextIndex;
+                for (; requestIndex < entitiesToSpawnSize && !IsProcessingBudgetExhausted(); ++requestIndex)
                 {
-                    for (uint32_t index : request.m_entityIndices)
+                    uint32_t index = request.m_entityIndices[requestIndex];
+                    if (index < entitiesToSpawn.size())
                     {
-                        if (index < entitiesToSpawn.size())
-                        {
-                            // If this entity has previously been spawned, give it a new id in the reference map
-                            RefreshEntityIdMapping(
-                                entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
-
-                            auto aliasIt = AZStd::lower_bound(
-                                aliasBegin, aliasEnd, index,
-                                [](const Spawnable::EntityAlias& lhs, uint32_t rhs)
-                                {
-                                    return lhs.m_sourceIndex < rhs;
-                                });
-
-                            if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != index)
-                            {
-                                spawnedEntities.emplace_back(
-                                    CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
-                                spawnedEntityIndices.push_back(index);
-                            }
-                            else
-                            {
-                                // The list of entities has already been sorted and optimized (See SpawnableEntitiesAliasList:Optimize) so
-                                // can be safely executed in order without risking an invalid state.
-                                AZ::Entity* previousEntity = nullptr;
-                                do
-                                {
-                                    AZ::Entity* clone = CloneSingleAliasedEntity(
-                                        *entitiesToSpawn[index], *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
-                                        *request.m_serializeContext);
-                                    previousEntity = clone;
-                                    if (clone)
-                                    {
-                                        spawnedEntities.emplace_back(clone);
-                                        spawnedEntityIndices.push_back(index);
-                                    }
-
-                                    ++aliasIt;
-                                } while (aliasIt != aliasEnd && aliasIt->m_sourceIndex == index);
-                            }
-                        }
+                        // If this entity has previously been spawned, give it a new id in the reference map
+                        RefreshEntityIdMapping(
+                            entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                        CloneEntityAtIndex(
+                            index, entitiesToSpawn, aliases, ticket.m_entityIdReferenceMap, *request.m_serializeContext,
+                            ticket.m_spawnedEntities, ticket.m_spawnedEntityIndices);
+                        ConsumeProcessingBudget();
                     }
                 }
-                ticket.m_loadAll = false;
+                progress.m_nextIndex = requestIndex;
+                bool isComplete = requestIndex == entitiesToSpawnSize;
 
-                // Let other systems know about newly spawned entities for any pre-processing before adding to the scene/game context.
-                if (request.m_preInsertionCallback)
+                if (isComplete || request.m_activateIncrementally)
                 {
-                    request.m_preInsertionCallback(
-                        request.m_ticketId,
-                        SpawnableEntityContainerView(
-                            ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
+                    ActivateSpawnedEntities(ticket, request.m_ticketId, request.m_preInsertionCallback, progress);
                 }
 
-                // Add to the game context, now the entities are active
-                for (auto it = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount; it != ticket.m_spawnedEntities.end(); ++it)
+                if (request.m_progressCallback)
                 {
-                    AZ::Entity* clone = (*it);
-                    clone->SetEntitySpawnTicketId(request.m_ticketId);
-                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, *it);
+                    request.m_progressCallback(request.m_ticketId, requestIndex, entitiesToSpawnSize);
+                }
+
+                if (!isComplete)
+                {
+                    // Resume on the next call. Later requests on this ticket wait on the request id so they see the final state.
+                    return CommandResult::Requeue;
                 }
 
                 if (request.m_completionCallback)
@@ -683,7 +937,7 @@ namespace AzFramework
                     request.m_completionCallback(
                         request.m_ticketId,
                         SpawnableConstEntityContainerView(
-                            ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
+                            ticket.m_spawnedEntities.begin() + progress.m_spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
                 }
 
                 ticket.m_currentRequestId++;
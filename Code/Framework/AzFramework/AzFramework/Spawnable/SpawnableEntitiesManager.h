@@ -10,6 +10,7 @@
 
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/limits.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/variant.h>
@@ -47,6 +48,17 @@ namespace AzFramework
             Regular = 1 << 1
         };
 
+        //! Limits the amount of spawning work done per call to ProcessQueue. Spawn requests that don't fit in the budget are resumed
+        //! on the next call, so large spawnables are spread over multiple frames instead of causing a single long frame.
+        //! At least one entity is always cloned per call so spawning keeps making progress.
+        struct ProcessingBudget
+        {
+            //! The maximum number of prototype entities to clone per call. Zero means no limit.
+            uint32_t m_maxEntities{ 0 };
+            //! The maximum time to spend cloning entities per call. Zero means no limit.
+            AZStd::chrono::microseconds m_maxTime{ 0 };
+        };
+
         SpawnableEntitiesManager();
         ~SpawnableEntitiesManager() override;
 
@@ -88,6 +100,16 @@ namespace AzFramework
 
         CommandQueueStatus ProcessQueue(CommandQueuePriority priority);
 
+        //! Sets the processing budget for the queues matching the provided priority. The budget can also be configured through the
+        //! Settings Registry under "/O3DE/AzFramework/Spawnables/<High|Regular>PriorityEntityBudget" and
+        //! "/O3DE/AzFramework/Spawnables/<High|Regular>PriorityTimeBudgetUs".
+        void SetProcessingBudget(CommandQueuePriority priority, const ProcessingBudget& budget);
+        const ProcessingBudget& GetProcessingBudget(CommandQueuePriority priority) const;
+
+        //! Sets the minimum number of entities a SpawnAllEntities call needs to clone before they're cloned in parallel on the task
+        //! executor. Zero disables parallel cloning.
+        void SetParallelCloneThreshold(uint32_t threshold);
+
     protected:
         enum class CommandResult : bool
         {
@@ -126,25 +148,40 @@ namespace AzFramework
             bool m_loadAll{ true };
         };
 
+        //! Progress of a spawn request that may be spread over multiple calls to ProcessQueue.
+        struct SpawnProgress final
+        {
+            size_t m_spawnedEntitiesInitialCount{ 0 }; //!< Number of entities on the ticket before the request started.
+            size_t m_activatedCount{ 0 }; //!< Number of entities on the ticket that have been added to the game context.
+            uint32_t m_nextIndex{ 0 }; //!< The next prototype entity, or index into the requested indices, to clone.
+            bool m_isStarted{ false };
+        };
+
         struct SpawnAllEntitiesCommand final
         {
             EntitySpawnCallback m_completionCallback;
             EntityPreInsertionCallback m_preInsertionCallback;
+            EntitySpawnProgressCallback m_progressCallback;
             AZ::SerializeContext* m_serializeContext;
             Ticket* m_ticket;
+            SpawnProgress m_progress;
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
+            bool m_activateIncrementally;
         };
         struct SpawnEntitiesCommand final
         {
             AZStd::vector<uint32_t> m_entityIndices;
             EntitySpawnCallback m_completionCallback;
             EntityPreInsertionCallback m_preInsertionCallback;
+            EntitySpawnProgressCallback m_progressCallback;
             AZ::SerializeContext* m_serializeContext;
             Ticket* m_ticket;
+            SpawnProgress m_progress;
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
             bool m_referencePreviouslySpawnedEntities;
+            bool m_activateIncrementally;
         };
         struct DespawnAllEntitiesCommand final
         {
@@ -251,6 +288,7 @@ namespace AzFramework
             AZStd::deque<Requests> m_delayed; //!< Requests that were processed before, but couldn't be completed.
             AZStd::queue<Requests> m_pendingRequest; //!< Requests waiting to be processed for the first time.
             AZStd::mutex m_pendingRequestMutex;
+            ProcessingBudget m_budget;
         };
 
         template<typename T>
@@ -264,18 +302,66 @@ namespace AzFramework
         
         CommandQueueStatus ProcessQueue(Queue& queue);
 
-        AZ::Entity* CloneSingleEntity(
-            const AZ::Entity& entityPrototype, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
+        //! Entity id map used while cloning entities on the task executor. The ticket's map is only read while tasks are running.
+        //! Ids that aren't in the ticket's map are generated into a map that's local to the task, which is merged into the ticket's
+        //! map once all tasks have completed.
+        class TaskEntityIdMap final
+        {
+        public:
+            explicit TaskEntityIdMap(const EntityIdMap& sharedMap);
+
+            AZ::EntityId MapId(const AZ::EntityId& originalId, bool replaceId, const AZStd::function<AZ::EntityId()>& idGenerator);
+            EntityIdMap& GetLocalMap();
+
+        private:
+            const EntityIdMap& m_sharedMap;
+            EntityIdMap m_localMap;
+        };
+
+        template<typename T>
+        T* CloneWithNewIds(const T& prototype, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
+        template<typename T>
+        T* CloneWithNewIds(const T& prototype, TaskEntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
+
+        template<typename IdMap>
+        AZ::Entity* CloneSingleEntity(const AZ::Entity& entityPrototype, IdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
+        template<typename IdMap>
         AZ::Entity* CloneSingleAliasedEntity(
             const AZ::Entity& entityPrototype,
             const Spawnable::EntityAlias& alias,
-            EntityIdMap& prototypeToCloneMap,
+            IdMap& prototypeToCloneMap,
             AZ::Entity* previouslySpawnedEntity,
             AZ::SerializeContext& serializeContext);
+        //! Clones a single prototype entity, including any aliases for it, and appends the clones and their prototype index to the
+        //! provided lists.
+        template<typename IdMap>
+        void CloneEntityAtIndex(
+            uint32_t index,
+            const Spawnable::EntityList& entitiesToSpawn,
+            const Spawnable::EntityAliasConstVisitor& aliases,
+            IdMap& prototypeToCloneMap,
+            AZ::SerializeContext& serializeContext,
+            AZStd::vector<AZ::Entity*>& spawnedEntities,
+            AZStd::vector<uint32_t>& spawnedEntityIndices);
+        //! Adds the entities on the ticket that haven't been added to the game context yet.
+        void ActivateSpawnedEntities(
+            Ticket& ticket, EntitySpawnTicket::Id ticketId, const EntityPreInsertionCallback& preInsertionCallback, SpawnProgress& progress);
+        //! Clones the prototype entities in the range [begin, end) on the task executor and adds the clones to the ticket in the
+        //! same order as cloning them one at a time would.
+        void CloneEntitiesInParallel(
+            Ticket& ticket,
+            uint32_t begin,
+            uint32_t end,
+            const Spawnable::EntityList& entitiesToSpawn,
+            const Spawnable::EntityAliasConstVisitor& aliases,
+            AZ::SerializeContext& serializeContext);
+        //! Returns the number of entities to clone in parallel in the next batch, or zero if they should be cloned one at a time.
+        uint32_t GetParallelCloneBatchSize(uint32_t entitiesLeft) const;
+        template<typename IdMap>
         void AppendComponents(
             AZ::Entity& target,
             const AZ::Entity::ComponentArrayType& componentPrototypes,
-            EntityIdMap& prototypeToCloneMap,
+            IdMap& prototypeToCloneMap,
             AZ::SerializeContext& serializeContext);
         
         CommandResult ProcessRequest(SpawnAllEntitiesCommand& request);
@@ -293,6 +379,10 @@ namespace AzFramework
         CommandResult ProcessRequest(RegisterTicketCommand& request);
         CommandResult ProcessRequest(DestroyTicketCommand& request);
 
+        void BeginProcessingBudget(const ProcessingBudget& budget);
+        bool IsProcessingBudgetExhausted() const;
+        void ConsumeProcessingBudget(uint32_t entityCount = 1);
+
         //! Generate a base set of original-to-new entity ID mappings to use during spawning.
         //! Since Entity references get fixed up on an entity-by-entity basis while spawning, it's important to have the complete
         //! set of new IDs available right at the start.  This way, entities that refer to other entities that haven't spawned yet
@@ -305,12 +395,21 @@ namespace AzFramework
         Queue m_highPriorityQueue;
         Queue m_regularPriorityQueue;
 
+        //! The budget left for the queue that's currently being processed.
+        ProcessingBudget m_activeBudget;
+        AZStd::chrono::steady_clock::time_point m_budgetDeadline;
+        uint32_t m_budgetEntitiesProcessed{ 0 };
+
         AZ::SerializeContext* m_defaultSerializeContext { nullptr };
         //! The threshold used to determine if a request goes in the regular (if bigger than the value) or high priority queue (if smaller
         //! or equal to this value). The starting value of 64 is chosen as it's between default values SpawnablePriority_High and
         //! SpawnablePriority_Default which gives users a bit of room to fine tune the priorities as this value can be configured
         //! through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/HighPriorityThreshold".
         SpawnablePriority m_highPriorityThreshold { 64 };
+        //! The minimum number of entities a SpawnAllEntities call needs to clone before the entities are cloned in parallel on the
+        //! task executor. Zero disables parallel cloning. This value can be configured through the Settings Registry under the key
+        //! "/O3DE/AzFramework/Spawnables/ParallelCloneThreshold".
+        uint32_t m_parallelCloneThreshold{ 0 };
 
         AZStd::unordered_map<EntitySpawnTicket::Id, Ticket*> m_entitySpawnTicketMap;
         AZStd::atomic_int m_totalTickets{ 0 };
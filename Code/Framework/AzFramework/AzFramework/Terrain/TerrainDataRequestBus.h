@@ -314,6 +314,18 @@ namespace AzFramework
             //! Given a ray, return the closest intersection with terrain.
             virtual RenderGeometry::RayResult GetClosestIntersection(const RenderGeometry::RayRequest& ray) const = 0;
 
+            //! Given a list of rays, return the closest intersection with terrain for each of them.
+            //! The default implementation intersects the rays one at a time.
+            virtual void GetClosestIntersections(
+                AZStd::span<const RenderGeometry::RayRequest> rays, AZStd::span<RenderGeometry::RayResult> outResults) const
+            {
+                AZ_Assert(rays.size() == outResults.size(), "The sizes of the ray and result lists should match.");
+                for (size_t index = 0; index < rays.size(); ++index)
+                {
+                    outResults[index] = GetClosestIntersection(rays[index]);
+                }
+            }
+
             //! Asynchronous versions of the various 'Query*' API functions declared above.
             //! It's the responsibility of the caller to ensure all callbacks are thread-safe.
             virtual AZStd::shared_ptr<TerrainJobContext> QueryListAsync(
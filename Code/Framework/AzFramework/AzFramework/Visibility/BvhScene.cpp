@@ -0,0 +1,613 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Visibility/BvhScene.h>
+#include <AzFramework/Visibility/VisibilityFrustumBatch.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AzFramework
+{
+    AZ_CVAR(uint32_t, bg_bvhLeafMaxEntries,             16, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries in a bounding volume hierarchy leaf when the hierarchy is built");
+    AZ_CVAR(float,    bg_bvhRebuildRatio,            0.25f, nullptr, AZ::ConsoleFunctorFlags::Null, "Ratio of entries that have to be inserted, removed or moved out of their leaf before a bounding volume hierarchy is rebuilt");
+    AZ_CVAR(uint32_t, bg_bvhRebuildMinModifications,    64, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of modified entries before a bounding volume hierarchy is rebuilt");
+
+    static constexpr uint32_t SahBinCount = 12;
+
+    static float GetSurfaceArea(const AZ::Aabb& aabb)
+    {
+        if (!aabb.IsValid())
+        {
+            return 0.0f;
+        }
+        const AZ::Vector3 extents = aabb.GetExtents();
+        return 2.0f * (extents.GetX() * extents.GetY() + extents.GetY() * extents.GetZ() + extents.GetZ() * extents.GetX());
+    }
+
+    static float GetSurfaceAreaGrowth(const AZ::Aabb& aabb, const AZ::Aabb& added)
+    {
+        AZ::Aabb merged = aabb;
+        merged.AddAabb(added);
+        return GetSurfaceArea(merged) - GetSurfaceArea(aabb);
+    }
+
+    bool BvhNode::IsLeaf() const
+    {
+        return m_children[0] == InvalidIndex;
+    }
+
+    BvhScene::BvhScene(const AZ::Name& sceneName)
+        : m_sceneName(sceneName)
+    {
+        AZ_Assert(!sceneName.IsEmpty(), "sceneName must be a valid string");
+        m_nodes.emplace_back();
+    }
+
+    BvhScene::~BvhScene()
+    {
+        WaitForRebuild();
+    }
+
+    const AZ::Name& BvhScene::GetName() const
+    {
+        return m_sceneName;
+    }
+
+    void BvhScene::InsertOrUpdateEntry(VisibilityEntry& entry)
+    {
+        {
+            // Entries moving within the bounds of their leaf don't modify the hierarchy,
+            // so they only need a shared lock and don't serialize with other updates or queries
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+            if (entry.m_internalNode != nullptr && CanUpdateInPlace(entry))
+            {
+                return;
+            }
+        }
+
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        if (entry.m_internalNode != nullptr)
+        {
+            if (!CanUpdateInPlace(entry))
+            {
+                Refit(aznumeric_cast<uint32_t>(static_cast<BvhNode*>(entry.m_internalNode) - m_nodes.data()));
+                OnModified();
+            }
+        }
+        else
+        {
+            Insert(entry);
+            ++m_entryCount;
+            ++m_structureVersion;
+            OnModified();
+        }
+    }
+
+    void BvhScene::RemoveEntry(VisibilityEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        if (entry.m_internalNode != nullptr)
+        {
+            Remove(entry);
+            --m_entryCount;
+            ++m_structureVersion;
+            OnModified();
+        }
+    }
+
+    void BvhScene::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateHelper(aabb, callback);
+    }
+
+    void BvhScene::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateHelper(sphere, callback);
+    }
+
+    void BvhScene::Enumerate(const AZ::Hemisphere& hemisphere, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateHelper(hemisphere, callback);
+    }
+
+    void BvhScene::Enumerate(const AZ::Capsule& capsule, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateHelper(capsule, callback);
+    }
+
+    void BvhScene::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateHelper(frustum, callback);
+    }
+
+    void BvhScene::Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateNodes(0, [&includeFrustum, &excludeFrustum](const AZ::Aabb& bounds)
+            {
+                return AZ::ShapeIntersection::Overlaps(includeFrustum, bounds) && !AZ::ShapeIntersection::Contains(excludeFrustum, bounds);
+            }, callback);
+    }
+
+    void BvhScene::EnumerateFrustums(AZStd::span<const AZ::Frustum> frustums, const EnumerateFrustumsCallback& callback) const
+    {
+        AZ_Assert(frustums.size() <= MaxEnumerateFrustums, "EnumerateFrustums supports at most %u frustums", MaxEnumerateFrustums);
+        if (frustums.empty())
+        {
+            return;
+        }
+
+        const VisibilityFrustumBatch frustumBatch(frustums.first(AZStd::min<size_t>(frustums.size(), MaxEnumerateFrustums)));
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateFrustumsHelper(0, frustumBatch, frustumBatch.GetAllMask(), 0, callback);
+    }
+
+    void BvhScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateNodes(0, []([[maybe_unused]] const AZ::Aabb& bounds) { return true; }, callback);
+    }
+
+    uint32_t BvhScene::GetEntryCount() const
+    {
+        return m_entryCount;
+    }
+
+    void BvhScene::Rebuild()
+    {
+        WaitForRebuild();
+
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        BuildEntryList buildEntries;
+        GatherBuildEntries(buildEntries);
+        ApplyBuild(Build(buildEntries));
+    }
+
+    void BvhScene::WaitForRebuild()
+    {
+        if (m_rebuildEvent)
+        {
+            m_rebuildEvent->Wait();
+            m_rebuildEvent.reset();
+            m_rebuildGraph.reset();
+        }
+    }
+
+    uint32_t BvhScene::GetNodeCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_nodes.size());
+    }
+
+    uint32_t BvhScene::GetLeafCount() const
+    {
+        return aznumeric_cast<uint32_t>(AZStd::count_if(m_nodes.begin(), m_nodes.end(), [](const BvhNode& node) { return node.IsLeaf(); }));
+    }
+
+    uint32_t BvhScene::GetMaxDepth() const
+    {
+        return GetDepth(0);
+    }
+
+    void BvhScene::DumpStats()
+    {
+        AZ_TracePrintf("Console", "BvhScene[\"%s\"]::EntryCount = %u", GetName().GetCStr(), GetEntryCount());
+        AZ_TracePrintf("Console", "BvhScene[\"%s\"]::NodeCount = %u", GetName().GetCStr(), GetNodeCount());
+        AZ_TracePrintf("Console", "BvhScene[\"%s\"]::LeafCount = %u", GetName().GetCStr(), GetLeafCount());
+        AZ_TracePrintf("Console", "BvhScene[\"%s\"]::MaxDepth = %u", GetName().GetCStr(), GetMaxDepth());
+        AZ_TracePrintf("Console", "BvhScene[\"%s\"]::ModificationsSinceBuild = %u", GetName().GetCStr(), m_modificationsSinceBuild);
+    }
+
+    bool BvhScene::CanUpdateInPlace(const VisibilityEntry& entry) const
+    {
+        const BvhNode* leaf = static_cast<const BvhNode*>(entry.m_internalNode);
+        return AZ::ShapeIntersection::Contains(leaf->m_bounds, entry.m_boundingVolume);
+    }
+
+    void BvhScene::Insert(VisibilityEntry& entry)
+    {
+        AZ_Assert(entry.m_internalNode == nullptr, "Double-insertion: Insert invoked for an entry already bound to the BvhScene");
+
+        // Descend into the child that grows the least, growing the bounds of the nodes on the way down
+        const AZ::Aabb& boundingVolume = entry.m_boundingVolume;
+        uint32_t nodeIndex = 0;
+        while (!m_nodes[nodeIndex].IsLeaf())
+        {
+            BvhNode& node = m_nodes[nodeIndex];
+            node.m_bounds.AddAabb(boundingVolume);
+
+            const float leftGrowth = GetSurfaceAreaGrowth(m_nodes[node.m_children[0]].m_bounds, boundingVolume);
+            const float rightGrowth = GetSurfaceAreaGrowth(m_nodes[node.m_children[1]].m_bounds, boundingVolume);
+            nodeIndex = (leftGrowth <= rightGrowth) ? node.m_children[0] : node.m_children[1];
+        }
+
+        BvhNode& leaf = m_nodes[nodeIndex];
+        leaf.m_bounds.AddAabb(boundingVolume);
+        entry.m_internalNode = &leaf;
+        entry.m_internalNodeIndex = aznumeric_cast<uint32_t>(leaf.m_entries.size());
+        leaf.m_entries.push_back(&entry);
+    }
+
+    void BvhScene::Remove(VisibilityEntry& entry)
+    {
+        BvhNode& leaf = *static_cast<BvhNode*>(entry.m_internalNode);
+        AZ_Assert(leaf.m_entries[entry.m_internalNodeIndex] == &entry, "Visibility entry data is corrupt");
+
+        // Swap and pop the removed entry
+        const uint32_t removeIndex = entry.m_internalNodeIndex;
+        if (removeIndex < (leaf.m_entries.size() - 1))
+        {
+            AZStd::swap(leaf.m_entries[removeIndex], leaf.m_entries.back());
+            leaf.m_entries[removeIndex]->m_internalNodeIndex = removeIndex;
+        }
+        leaf.m_entries.pop_back();
+        entry.m_internalNode = nullptr;
+        entry.m_internalNodeIndex = 0;
+
+        Refit(aznumeric_cast<uint32_t>(&leaf - m_nodes.data()));
+    }
+
+    void BvhScene::Refit(uint32_t nodeIndex)
+    {
+        while (nodeIndex != BvhNode::InvalidIndex)
+        {
+            BvhNode& node = m_nodes[nodeIndex];
+            AZ::Aabb bounds = AZ::Aabb::CreateNull();
+            if (node.IsLeaf())
+            {
+                for (const VisibilityEntry* entry : node.m_entries)
+                {
+                    bounds.AddAabb(entry->m_boundingVolume);
+                }
+            }
+            else
+            {
+                bounds = m_nodes[node.m_children[0]].m_bounds;
+                bounds.AddAabb(m_nodes[node.m_children[1]].m_bounds);
+            }
+
+            if (bounds == node.m_bounds)
+            {
+                // The ancestors already have the right bounds
+                break;
+            }
+            node.m_bounds = bounds;
+            nodeIndex = node.m_parent;
+        }
+    }
+
+    void BvhScene::RefitAll()
+    {
+        // Children are always stored after their parents
+        for (size_t nodeIndex = m_nodes.size(); nodeIndex-- > 0;)
+        {
+            BvhNode& node = m_nodes[nodeIndex];
+            node.m_bounds = AZ::Aabb::CreateNull();
+            if (node.IsLeaf())
+            {
+                for (const VisibilityEntry* entry : node.m_entries)
+                {
+                    node.m_bounds.AddAabb(entry->m_boundingVolume);
+                }
+            }
+            else
+            {
+                node.m_bounds.AddAabb(m_nodes[node.m_children[0]].m_bounds);
+                node.m_bounds.AddAabb(m_nodes[node.m_children[1]].m_bounds);
+            }
+        }
+    }
+
+    void BvhScene::OnModified()
+    {
+        ++m_modificationsSinceBuild;
+        const uint32_t rebuildThreshold = AZStd::max(
+            static_cast<uint32_t>(bg_bvhRebuildMinModifications), aznumeric_cast<uint32_t>(m_entryCount * bg_bvhRebuildRatio));
+        if (m_modificationsSinceBuild >= rebuildThreshold)
+        {
+            StartRebuild();
+        }
+    }
+
+    void BvhScene::StartRebuild()
+    {
+        if (m_rebuildEvent)
+        {
+            if (!m_rebuildEvent->IsSignaled())
+            {
+                // A rebuild is already running
+                return;
+            }
+            m_rebuildEvent.reset();
+            m_rebuildGraph.reset();
+        }
+
+        const AZ::TaskGraphActiveInterface* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (!taskGraphActive || !taskGraphActive->IsTaskGraphActive())
+        {
+            // Without a task executor the hierarchy is rebuilt right away, the exclusive lock is already held by the caller
+            BuildEntryList buildEntries;
+            GatherBuildEntries(buildEntries);
+            ApplyBuild(Build(buildEntries));
+            return;
+        }
+
+        static const AZ::TaskDescriptor rebuildDescriptor{ "BvhScene::Rebuild", "Visibility" };
+        m_rebuildGraph = AZStd::make_unique<AZ::TaskGraph>("BvhSceneRebuild");
+        m_rebuildGraph->AddTask(
+            rebuildDescriptor,
+            [this]()
+            {
+                BuildEntryList buildEntries;
+                uint64_t structureVersion = 0;
+                {
+                    AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+                    structureVersion = m_structureVersion;
+                    GatherBuildEntries(buildEntries);
+                }
+
+                NodeList nodes = Build(buildEntries);
+
+                // Entries that moved during the build are handled by refitting the new hierarchy, but inserted or removed entries
+                // aren't part of it, in which case it's discarded and the next modification starts a new rebuild
+                AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+                if (structureVersion == m_structureVersion)
+                {
+                    ApplyBuild(AZStd::move(nodes));
+                }
+            });
+        m_rebuildEvent = AZStd::make_unique<AZ::TaskGraphEvent>("BvhSceneRebuild Wait");
+        m_rebuildGraph->Submit(m_rebuildEvent.get());
+    }
+
+    void BvhScene::GatherBuildEntries(BuildEntryList& buildEntries) const
+    {
+        buildEntries.reserve(m_entryCount);
+        for (const BvhNode& node : m_nodes)
+        {
+            for (VisibilityEntry* entry : node.m_entries)
+            {
+                buildEntries.push_back({ entry->m_boundingVolume, entry->m_boundingVolume.GetCenter(), entry });
+            }
+        }
+    }
+
+    BvhScene::NodeList BvhScene::Build(BuildEntryList& buildEntries)
+    {
+        NodeList nodes;
+        if (buildEntries.empty())
+        {
+            nodes.emplace_back();
+            return nodes;
+        }
+
+        nodes.reserve(2 * (buildEntries.size() / AZStd::max(static_cast<uint32_t>(bg_bvhLeafMaxEntries), 1u)) + 1);
+        BuildRecursive(nodes, buildEntries, 0, buildEntries.size(), BvhNode::InvalidIndex);
+        return nodes;
+    }
+
+    uint32_t BvhScene::BuildRecursive(NodeList& nodes, BuildEntryList& buildEntries, size_t begin, size_t end, uint32_t parent)
+    {
+        const uint32_t nodeIndex = aznumeric_cast<uint32_t>(nodes.size());
+        nodes.emplace_back().m_parent = parent;
+
+        AZ::Aabb bounds = AZ::Aabb::CreateNull();
+        AZ::Aabb centroidBounds = AZ::Aabb::CreateNull();
+        for (size_t i = begin; i < end; ++i)
+        {
+            bounds.AddAabb(buildEntries[i].m_bounds);
+            centroidBounds.AddPoint(buildEntries[i].m_centroid);
+        }
+        nodes[nodeIndex].m_bounds = bounds;
+
+        // Find the cheapest split according to the surface area heuristic, binning the entries by their centroid along each axis
+        const size_t count = end - begin;
+        float bestCost = AZStd::numeric_limits<float>::max();
+        int bestAxis = -1;
+        uint32_t bestSplit = 0;
+        if (count > 2)
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                const float centroidMin = centroidBounds.GetMin().GetElement(axis);
+                const float centroidExtent = centroidBounds.GetMax().GetElement(axis) - centroidMin;
+                if (centroidExtent <= 0.0f)
+                {
+                    continue;
+                }
+
+                AZ::Aabb binBounds[SahBinCount];
+                uint32_t binCounts[SahBinCount] = {};
+                for (uint32_t bin = 0; bin < SahBinCount; ++bin)
+                {
+                    binBounds[bin] = AZ::Aabb::CreateNull();
+                }
+
+                const float binScale = SahBinCount / centroidExtent;
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const uint32_t bin = AZStd::min(
+                        aznumeric_cast<uint32_t>((buildEntries[i].m_centroid.GetElement(axis) - centroidMin) * binScale), SahBinCount - 1);
+                    ++binCounts[bin];
+                    binBounds[bin].AddAabb(buildEntries[i].m_bounds);
+                }
+
+                float rightAreas[SahBinCount];
+                uint32_t rightCounts[SahBinCount];
+                AZ::Aabb accumulated = AZ::Aabb::CreateNull();
+                uint32_t accumulatedCount = 0;
+                for (uint32_t bin = SahBinCount - 1; bin > 0; --bin)
+                {
+                    accumulated.AddAabb(binBounds[bin]);
+                    accumulatedCount += binCounts[bin];
+                    rightAreas[bin] = GetSurfaceArea(accumulated);
+                    rightCounts[bin] = accumulatedCount;
+                }
+
+                accumulated = AZ::Aabb::CreateNull();
+                accumulatedCount = 0;
+                for (uint32_t bin = 0; bin < SahBinCount - 1; ++bin)
+                {
+                    accumulated.AddAabb(binBounds[bin]);
+                    accumulatedCount += binCounts[bin];
+                    if (accumulatedCount == 0 || rightCounts[bin + 1] == 0)
+                    {
+                        continue;
+                    }
+
+                    const float cost = GetSurfaceArea(accumulated) * accumulatedCount + rightAreas[bin + 1] * rightCounts[bin + 1];
+                    if (cost < bestCost)
+                    {
+                        bestCost = cost;
+                        bestAxis = axis;
+                        bestSplit = bin;
+                    }
+                }
+            }
+        }
+
+        const float leafCost = GetSurfaceArea(bounds) * count;
+        const bool makeLeaf = (bestAxis < 0) || (count <= bg_bvhLeafMaxEntries && bestCost >= leafCost);
+
+        size_t middle = begin;
+        if (!makeLeaf)
+        {
+            const float centroidMin = centroidBounds.GetMin().GetElement(bestAxis);
+            const float binScale = SahBinCount / (centroidBounds.GetMax().GetElement(bestAxis) - centroidMin);
+            // Partition the entries so that the ones in the bins left of the split come first
+            size_t last = end;
+            middle = begin;
+            while (middle < last)
+            {
+                const uint32_t bin = AZStd::min(
+                    aznumeric_cast<uint32_t>((buildEntries[middle].m_centroid.GetElement(bestAxis) - centroidMin) * binScale), SahBinCount - 1);
+                if (bin <= bestSplit)
+                {
+                    ++middle;
+                }
+                else
+                {
+                    AZStd::swap(buildEntries[middle], buildEntries[--last]);
+                }
+            }
+        }
+
+        if (makeLeaf || middle == begin || middle == end)
+        {
+            BvhNode& leaf = nodes[nodeIndex];
+            leaf.m_entries.reserve(count);
+            for (size_t i = begin; i < end; ++i)
+            {
+                leaf.m_entries.push_back(buildEntries[i].m_entry);
+            }
+            return nodeIndex;
+        }
+
+        // Children are built first, as building them may reallocate the node list
+        const uint32_t left = BuildRecursive(nodes, buildEntries, begin, middle, nodeIndex);
+        const uint32_t right = BuildRecursive(nodes, buildEntries, middle, end, nodeIndex);
+        nodes[nodeIndex].m_children[0] = left;
+        nodes[nodeIndex].m_children[1] = right;
+        return nodeIndex;
+    }
+
+    void BvhScene::ApplyBuild(NodeList&& nodes)
+    {
+        m_nodes = AZStd::move(nodes);
+        for (BvhNode& node : m_nodes)
+        {
+            for (uint32_t entryIndex = 0; entryIndex < node.m_entries.size(); ++entryIndex)
+            {
+                node.m_entries[entryIndex]->m_internalNode = &node;
+                node.m_entries[entryIndex]->m_internalNodeIndex = entryIndex;
+            }
+        }
+
+        // Entries may have moved since the build started
+        RefitAll();
+        m_modificationsSinceBuild = 0;
+    }
+
+    template<typename T>
+    void BvhScene::EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateNodes(0, [&boundingVolume](const AZ::Aabb& bounds)
+            {
+                return AZ::ShapeIntersection::Overlaps(boundingVolume, bounds);
+            }, callback);
+    }
+
+    template<typename OverlapFunction>
+    void BvhScene::EnumerateNodes(uint32_t nodeIndex, const OverlapFunction& overlaps, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        const BvhNode& node = m_nodes[nodeIndex];
+        if (!node.m_bounds.IsValid() || !overlaps(node.m_bounds))
+        {
+            return;
+        }
+
+        if (node.IsLeaf())
+        {
+            if (!node.m_entries.empty())
+            {
+                callback({ node.m_bounds, node.m_entries });
+            }
+        }
+        else
+        {
+            EnumerateNodes(node.m_children[0], overlaps, callback);
+            EnumerateNodes(node.m_children[1], overlaps, callback);
+        }
+    }
+
+    void BvhScene::EnumerateFrustumsHelper(
+        uint32_t nodeIndex,
+        const VisibilityFrustumBatch& frustums,
+        FrustumMask testMask,
+        FrustumMask containedMask,
+        const EnumerateFrustumsCallback& callback) const
+    {
+        const BvhNode& node = m_nodes[nodeIndex];
+        if (!node.m_bounds.IsValid())
+        {
+            return;
+        }
+
+        // Frustums containing the parent node contain all of its children, so they don't need to be tested again
+        const FrustumMask overlapMask = frustums.Intersect(node.m_bounds, testMask & ~containedMask, containedMask);
+        const FrustumMask visibleMask = overlapMask | containedMask;
+        if (visibleMask == 0)
+        {
+            return;
+        }
+
+        if (node.IsLeaf())
+        {
+            if (!node.m_entries.empty())
+            {
+                callback({ node.m_bounds, node.m_entries }, visibleMask);
+            }
+        }
+        else
+        {
+            EnumerateFrustumsHelper(node.m_children[0], frustums, visibleMask, containedMask, callback);
+            EnumerateFrustumsHelper(node.m_children[1], frustums, visibleMask, containedMask, callback);
+        }
+    }
+
+    uint32_t BvhScene::GetDepth(uint32_t nodeIndex) const
+    {
+        const BvhNode& node = m_nodes[nodeIndex];
+        if (node.IsLeaf())
+        {
+            return 1;
+        }
+        return 1 + AZStd::max(GetDepth(node.m_children[0]), GetDepth(node.m_children[1]));
+    }
+} // namespace AzFramework
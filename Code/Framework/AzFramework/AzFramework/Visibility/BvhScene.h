@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzFramework/Visibility/IVisibilitySystem.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    class TaskGraph;
+    class TaskGraphEvent;
+}
+
+namespace AzFramework
+{
+    class VisibilityFrustumBatch;
+
+    //! A node within the bounding volume hierarchy.
+    //! Internal nodes have exactly two children, only leaf nodes hold entries.
+    class BvhNode
+        : public VisibilityNode
+    {
+    public:
+        static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
+
+        //! Returns true if this is a leaf node.
+        bool IsLeaf() const;
+
+        AZ::Aabb m_bounds = AZ::Aabb::CreateNull();
+        uint32_t m_parent = InvalidIndex;
+        uint32_t m_children[2] = { InvalidIndex, InvalidIndex };
+        AZStd::vector<VisibilityEntry*> m_entries;
+    };
+
+    //! Implementation of the visibility scene interface using a bounding volume hierarchy.
+    //! The hierarchy is built with the surface area heuristic, so that it adapts to dense clusters of entries next to large empty regions.
+    //! Moving entries refit the bounds of their leaf and its ancestors instead of changing the hierarchy, and inserted entries are added to
+    //! the leaf that grows the least. Once enough entries have been modified to degrade the hierarchy, it's rebuilt on the task executor
+    //! while the scene remains usable, and swapped in if no entries were inserted or removed in the meantime.
+    class BvhScene
+        : public IVisibilityScene
+    {
+    public:
+        AZ_RTTI(BvhScene, "{3E9A4C6B-1D28-4F7E-B5A0-6C2D8E1F9B47}", IVisibilityScene);
+        AZ_CLASS_ALLOCATOR(BvhScene, AZ::SystemAllocator);
+        AZ_DISABLE_COPY_MOVE(BvhScene);
+
+        explicit BvhScene(const AZ::Name& sceneName);
+        virtual ~BvhScene();
+
+        //! IVisibilityScene overrides.
+        //! @{
+        const AZ::Name& GetName() const override;
+        void InsertOrUpdateEntry(VisibilityEntry& entry) override;
+        void RemoveEntry(VisibilityEntry& entry) override;
+        void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Hemisphere& hemisphere, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Capsule& capsule, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const override;
+        void EnumerateFrustums(AZStd::span<const AZ::Frustum> frustums, const EnumerateFrustumsCallback& callback) const override;
+        void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
+        uint32_t GetEntryCount() const override;
+        //! @}
+
+        //! Rebuilds the hierarchy from scratch on the calling thread.
+        //! Must not be called concurrently with InsertOrUpdateEntry or RemoveEntry.
+        void Rebuild();
+
+        //! Waits for a rebuild running on the task executor to complete.
+        //! Must not be called concurrently with InsertOrUpdateEntry or RemoveEntry.
+        void WaitForRebuild();
+
+        //! Stats
+        //! @{
+        uint32_t GetNodeCount() const;
+        uint32_t GetLeafCount() const;
+        uint32_t GetMaxDepth() const;
+        void DumpStats();
+        //! @}
+
+    private:
+        struct BuildEntry
+        {
+            AZ::Aabb m_bounds;
+            AZ::Vector3 m_centroid;
+            VisibilityEntry* m_entry = nullptr;
+        };
+        using BuildEntryList = AZStd::vector<BuildEntry>;
+        using NodeList = AZStd::vector<BvhNode>;
+
+        //! Returns true if the entry can stay in its leaf with its current bounding volume, without modifying the hierarchy.
+        bool CanUpdateInPlace(const VisibilityEntry& entry) const;
+
+        void Insert(VisibilityEntry& entry);
+        void Remove(VisibilityEntry& entry);
+
+        //! Recomputes the bounds of a node from its entries or children, and propagates the change to its ancestors.
+        void Refit(uint32_t nodeIndex);
+        void RefitAll();
+
+        //! Tracks modifications that degrade the hierarchy and starts a rebuild once there are enough of them.
+        void OnModified();
+        void StartRebuild();
+
+        void GatherBuildEntries(BuildEntryList& buildEntries) const;
+        static NodeList Build(BuildEntryList& buildEntries);
+        static uint32_t BuildRecursive(NodeList& nodes, BuildEntryList& buildEntries, size_t begin, size_t end, uint32_t parent);
+        void ApplyBuild(NodeList&& nodes);
+
+        template<typename T>
+        void EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const;
+        template<typename OverlapFunction>
+        void EnumerateNodes(uint32_t nodeIndex, const OverlapFunction& overlaps, const IVisibilityScene::EnumerateCallback& callback) const;
+        void EnumerateFrustumsHelper(
+            uint32_t nodeIndex,
+            const VisibilityFrustumBatch& frustums,
+            FrustumMask testMask,
+            FrustumMask containedMask,
+            const EnumerateFrustumsCallback& callback) const;
+
+        uint32_t GetDepth(uint32_t nodeIndex) const;
+
+        mutable AZStd::shared_mutex m_sharedMutex;
+
+        AZ::Name m_sceneName; //< The uniquely identifying name for the visibility scene.
+        NodeList m_nodes; //< All nodes of the hierarchy, the root is the first node and parents are stored before their children.
+
+        uint32_t m_entryCount = 0; //< Metric tracking the number of entries inserted into the scene.
+        uint32_t m_modificationsSinceBuild = 0; //< Inserted, removed and refitted entries since the hierarchy was last built.
+        uint64_t m_structureVersion = 0; //< Incremented whenever an entry is inserted or removed, used to discard outdated background builds.
+
+        AZStd::unique_ptr<AZ::TaskGraph> m_rebuildGraph;
+        AZStd::unique_ptr<AZ::TaskGraphEvent> m_rebuildEvent;
+    };
+} // namespace AzFramework
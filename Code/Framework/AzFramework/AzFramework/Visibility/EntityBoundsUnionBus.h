@@ -40,6 +40,7 @@ namespace AzFramework
         virtual void ProcessEntityBoundsUnionRequests() = 0;
 
         //! Notifies the EntityBoundsUnion system that an entities transform has been modified.
+        //! @note The visibility system is updated with the new transform the next time ProcessEntityBoundsUnionRequests is called.
         //! @param entity the entity whose transform has been modified.
         virtual void OnTransformUpdated(AZ::Entity* entity) = 0;
 
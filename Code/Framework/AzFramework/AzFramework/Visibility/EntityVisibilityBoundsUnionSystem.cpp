@@ -87,6 +87,9 @@ namespace AzFramework
                 m_entityVisibilityBoundsUnionInstanceMapping.erase(instanceIt);
             }
         }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_entityTransformsDirtyMutex);
+        m_entityTransformsDirty.erase(entity);
     }
 
     void EntityVisibilityBoundsUnionSystem::UpdateVisibilitySystem(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance)
@@ -153,6 +156,12 @@ namespace AzFramework
     {
         AZ_PROFILE_FUNCTION(AzFramework);
 
+        AZStd::unordered_set<AZ::Entity*> entityTransformsDirty;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_entityTransformsDirtyMutex);
+            entityTransformsDirty.swap(m_entityTransformsDirty);
+        }
+
         // iterate over all entities whose bounds changed and recalculate them
         for (const auto& entity : m_entityBoundsDirty)
         {
@@ -162,6 +171,19 @@ namespace AzFramework
                 instanceIt->second.m_localEntityBoundsUnion = CalculateEntityLocalBoundsUnion(entity);
                 UpdateVisibilitySystem(entity, instanceIt->second);
             }
+
+            // the update above already picked up the latest transform
+            entityTransformsDirty.erase(entity);
+        }
+
+        // update the world transform of the visibility bounds union of all entities that moved
+        for (const auto& entity : entityTransformsDirty)
+        {
+            if (auto instanceIt = m_entityVisibilityBoundsUnionInstanceMapping.find(entity);
+                instanceIt != m_entityVisibilityBoundsUnionInstanceMapping.end())
+            {
+                UpdateVisibilitySystem(entity, instanceIt->second);
+            }
         }
 
         // clear dirty entities once the visibility system has been updated
@@ -170,16 +192,20 @@ namespace AzFramework
 
     void EntityVisibilityBoundsUnionSystem::OnTransformUpdated(AZ::Entity* entity)
     {
-        // update the world transform of the visibility bounds union
-        if (auto instanceIt = m_entityVisibilityBoundsUnionInstanceMapping.find(entity);
-            instanceIt != m_entityVisibilityBoundsUnionInstanceMapping.end())
-        {
-            UpdateVisibilitySystem(entity, instanceIt->second);
-        }
+        // the visibility system is updated once per frame, however many times the entity moves
+        AZStd::lock_guard<AZStd::mutex> lock(m_entityTransformsDirtyMutex);
+        m_entityTransformsDirty.insert(entity);
     }
 
     void EntityVisibilityBoundsUnionSystem::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
         ProcessEntityBoundsUnionRequests();
     }
+
+    int EntityVisibilityBoundsUnionSystem::GetTickOrder()
+    {
+        // entities moved by any tick handler (gameplay, physics, animation, UI...) are in the visibility system by the
+        // end of the frame, before the frame is rendered
+        return AZ::TICK_LAST;
+    }
 } // namespace AzFramework
@@ -12,6 +12,8 @@
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzFramework/Visibility/EntityBoundsUnionBus.h>
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 
@@ -51,12 +53,19 @@ namespace AzFramework
 
         // TickBus overrides ...
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
 
         void UpdateVisibilitySystem(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance);
 
         EntityVisibilityBoundsUnionInstanceMapping m_entityVisibilityBoundsUnionInstanceMapping;
         UniqueEntities m_entityBoundsDirty;
 
+        //! Entities whose transform changed since the visibility system was last updated. Entities that move several times
+        //! in a frame (e.g. over multiple physics sub-steps) only update the visibility system once.
+        //! Transforms can be updated from multiple threads, so this has its own mutex.
+        AZStd::mutex m_entityTransformsDirtyMutex;
+        AZStd::unordered_set<AZ::Entity*> m_entityTransformsDirty;
+
         AZ::EntityActivatedEvent::Handler m_entityActivatedEventHandler;
         AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler;
     };
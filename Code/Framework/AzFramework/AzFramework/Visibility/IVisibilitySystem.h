@@ -19,6 +19,7 @@
 #include <AzCore/Math/Sphere.h>
 #include <AzCore/Name/Name.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 
 namespace AzFramework
@@ -63,6 +64,11 @@ namespace AzFramework
         };
         using EnumerateCallback = AZStd::function<void(const NodeData&)>;
 
+        //! Bitmask of frustums passed to EnumerateFrustums, bit N is set if the frustum at index N can see a node.
+        using FrustumMask = uint32_t;
+        static constexpr uint32_t MaxEnumerateFrustums = 32;
+        using EnumerateFrustumsCallback = AZStd::function<void(const NodeData&, FrustumMask)>;
+
         //! Get the unique scene name, used to look up the scene in the IVisibilitySystem. Duplicate names will assert on creation.
         virtual const AZ::Name& GetName() const = 0;
 
@@ -111,6 +117,13 @@ namespace AzFramework
         //! @param callback the callback to invoke when a node is visible
         virtual void Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const = 0;
 
+        //! Intersects multiple frustums against the visibility system in a single traversal.
+        //! This is cheaper than enumerating each frustum separately when the frustums are largely overlapping,
+        //! such as the main view, shadow cascades and stereo views of the same scene.
+        //! @param frustums the frustums to test against, up to MaxEnumerateFrustums
+        //! @param callback the callback to invoke when a node is visible to any of the frustums, with the mask of the frustums that can see it
+        virtual void EnumerateFrustums(AZStd::span<const AZ::Frustum> frustums, const EnumerateFrustumsCallback& callback) const = 0;
+
         //! Enumerate *all* OctreeNodes that have any entries in them (without any culling).
         //! @param callback the callback to invoke when a node is visible
         virtual void EnumerateNoCull(const EnumerateCallback& callback) const = 0;
@@ -119,6 +132,13 @@ namespace AzFramework
         virtual uint32_t GetEntryCount() const = 0;
     };
 
+    //! The spatial partitioning used by an IVisibilityScene.
+    enum class VisibilitySceneType : uint8_t
+    {
+        Octree, //!< Adaptive loose octree, cheap updates and good for evenly distributed content
+        Bvh     //!< Refitted bounding volume hierarchy, handles dense clusters next to empty space better
+    };
+
     //! @class IVisibilitySystem
     //! @brief This is an AZ::Interface<> useful for extremely fast, CPU only, proximity and visibility queries.
     class IVisibilitySystem
@@ -135,6 +155,9 @@ namespace AzFramework
         //! Create a new IVisibilityScene that is uniquely identified by the scene name.
         virtual IVisibilityScene* CreateVisibilityScene(const AZ::Name& sceneName) = 0;
 
+        //! Create a new IVisibilityScene that is uniquely identified by the scene name, using the requested spatial partitioning.
+        virtual IVisibilityScene* CreateVisibilityScene(const AZ::Name& sceneName, VisibilitySceneType sceneType) = 0;
+
         //! Destroy the visibility scene.
         //! This does not destroy the entities that are a part of the scene, only the visibility scene.
         //! This will set the visScene to nullptr
@@ -7,6 +7,8 @@
  */
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzFramework/Visibility/BvhScene.h>
+#include <AzFramework/Visibility/VisibilityFrustumBatch.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
@@ -16,6 +18,7 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,        64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,        32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(float,    bg_octreeLooseness,           1.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Scale applied to the bounds of octree nodes to compute the loose bounds containing their entries, applies to newly created scenes");
 
     static uint32_t GetChildNodeCount()
     {
@@ -24,14 +27,23 @@ namespace AzFramework
         return (bg_octreeUseQuadtree) ? QuadtreeNodeChildCount : OctreeNodeChildCount;
     }
 
+    static AZ::Aabb GetLooseBounds(const AZ::Aabb& bounds, float looseness)
+    {
+        const AZ::Vector3 center = bounds.GetCenter();
+        const AZ::Vector3 looseHalfExtents = bounds.GetExtents() * (0.5f * looseness);
+        return AZ::Aabb::CreateFromMinMax(center - looseHalfExtents, center + looseHalfExtents);
+    }
+
     OctreeNode::OctreeNode(const AZ::Aabb& bounds)
         : m_bounds(bounds)
+        , m_looseBounds(bounds)
     {
         ;
     }
 
     OctreeNode::OctreeNode(OctreeNode&& rhs)
         : m_bounds(rhs.m_bounds)
+        , m_looseBounds(rhs.m_looseBounds)
         , m_parent(rhs.m_parent)
         , m_children(rhs.m_children)
         , m_entries(AZStd::move(rhs.m_entries))
@@ -46,6 +58,7 @@ namespace AzFramework
     OctreeNode& OctreeNode::operator=(OctreeNode&& rhs)
     {
         m_bounds = rhs.m_bounds;
+        m_looseBounds = rhs.m_looseBounds;
         m_parent = rhs.m_parent;
         m_children = rhs.m_children;
         m_entries = AZStd::move(rhs.m_entries);
@@ -63,17 +76,23 @@ namespace AzFramework
     {
         AZ_Assert(entry->m_internalNode == nullptr, "Double-insertion: Insert invoked for an entry already bound to the OctreeScene");
 
-        // If this is not a leaf node, try to insert into the child nodes
+        // If this is not a leaf node, try to insert into the child node containing the center of the entry
+        // Loose bounds of neighbouring child nodes overlap, picking the child by center keeps entries in the tightest fitting node
         if (m_children != nullptr)
         {
             const AZ::Aabb boundingVolume = entry->m_boundingVolume;
-            const uint32_t childCount = GetChildNodeCount();
-            for (uint32_t child = 0; child < childCount; ++child)
+            const AZ::Vector3 entryCenter = boundingVolume.GetCenter();
+            const AZ::Vector3 nodeCenter = m_bounds.GetCenter();
+
+            // This matches the child offsets set up in Split
+            uint32_t child = 0;
+            child |= (entryCenter.GetX() >= nodeCenter.GetX()) ? 0x01 : 0;
+            child |= (entryCenter.GetY() >= nodeCenter.GetY()) ? 0x02 : 0;
+            child |= (GetChildNodeCount() > 4 && entryCenter.GetZ() >= nodeCenter.GetZ()) ? 0x04 : 0;
+
+            if (AZ::ShapeIntersection::Contains(m_children[child].m_looseBounds, boundingVolume))
             {
-                if (AZ::ShapeIntersection::Contains(m_children[child].m_bounds, boundingVolume))
-                {
-                    return m_children[child].Insert(octreeScene, entry);
-                }
+                return m_children[child].Insert(octreeScene, entry);
             }
         }
 
@@ -97,12 +116,8 @@ namespace AzFramework
     {
         AZ_Assert(entry->m_internalNode == this, "Update invoked for an entry bound to a different OctreeNode");
 
-        const AZ::Aabb boundingVolume = entry->m_boundingVolume;
-        if (IsLeaf() && AZ::ShapeIntersection::Contains(m_bounds, boundingVolume))
+        if (CanUpdateInPlace(entry))
         {
-            // Entry moved, but is still fully contained within the current node
-            // We can only do this for leaf nodes, otherwise entries can get 'stuck' in non-leaf nodes
-            // even when one of the child nodes would be an adequate fit, due to this early out check
             return;
         }
 
@@ -111,10 +126,11 @@ namespace AzFramework
 
         // Traverse up our ancestor nodes to find the first node that fully contains the entry
         // This strategy assumes an entry will typically move a small distance relative to the total world
+        const AZ::Aabb boundingVolume = entry->m_boundingVolume;
         OctreeNode* insertCheck = this;
         while (insertCheck != nullptr)
         {
-            if (AZ::ShapeIntersection::Contains(insertCheck->m_bounds, boundingVolume) || !insertCheck->m_parent)
+            if (AZ::ShapeIntersection::Contains(insertCheck->m_looseBounds, boundingVolume) || !insertCheck->m_parent)
             {
                 // Insert here if the entry is fully contained or if we've reached the root node
                 return insertCheck->Insert(octreeScene, entry);
@@ -123,6 +139,16 @@ namespace AzFramework
         }
     }
 
+    bool OctreeNode::CanUpdateInPlace(const VisibilityEntry* entry) const
+    {
+        AZ_Assert(entry->m_internalNode == this, "CanUpdateInPlace invoked for an entry bound to a different OctreeNode");
+
+        // Entry moved, but is still fully contained within the current node
+        // We can only do this for leaf nodes, otherwise entries can get 'stuck' in non-leaf nodes
+        // even when one of the child nodes would be an adequate fit, due to this early out check
+        return IsLeaf() && AZ::ShapeIntersection::Contains(m_looseBounds, entry->m_boundingVolume);
+    }
+
     void OctreeNode::Remove(OctreeScene& octreeScene, VisibilityEntry* entry)
     {
         AZ_Assert(entry->m_internalNode == this, "Remove invoked for an entry bound to a different OctreeNode");
@@ -147,7 +173,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(aabb, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(aabb, m_looseBounds))
         {
             EnumerateHelper(aabb, callback);
         }
@@ -155,7 +181,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(sphere, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(sphere, m_looseBounds))
         {
             EnumerateHelper(sphere, callback);
         }
@@ -163,7 +189,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Hemisphere& hemisphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(hemisphere, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(hemisphere, m_looseBounds))
         {
             EnumerateHelper(hemisphere, callback);
         }
@@ -171,7 +197,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Capsule& capsule, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(capsule, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(capsule, m_looseBounds))
         {
             EnumerateHelper(capsule, callback);
         }
@@ -179,7 +205,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(frustum, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(frustum, m_looseBounds))
         {
             EnumerateHelper(frustum, callback);
         }
@@ -187,12 +213,12 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(includeFrustum, m_bounds) && !AZ::ShapeIntersection::Contains(excludeFrustum, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(includeFrustum, m_looseBounds) && !AZ::ShapeIntersection::Contains(excludeFrustum, m_looseBounds))
         {
             // Invoke the callback for the current node
             if (!m_entries.empty())
             {
-                callback({ m_bounds, m_entries });
+                callback({ m_looseBounds, m_entries });
             }
 
             if (m_children != nullptr)
@@ -207,12 +233,43 @@ namespace AzFramework
         }
     }
 
+    void OctreeNode::EnumerateFrustums(
+        const VisibilityFrustumBatch& frustums,
+        IVisibilityScene::FrustumMask testMask,
+        IVisibilityScene::FrustumMask containedMask,
+        const IVisibilityScene::EnumerateFrustumsCallback& callback) const
+    {
+        // Frustums containing the parent node contain all of its children, so they don't need to be tested again
+        const IVisibilityScene::FrustumMask overlapMask = frustums.Intersect(m_looseBounds, testMask & ~containedMask, containedMask);
+        const IVisibilityScene::FrustumMask visibleMask = overlapMask | containedMask;
+        if (visibleMask == 0)
+        {
+            return;
+        }
+
+        // Invoke the callback for the current node
+        if (!m_entries.empty())
+        {
+            callback({ m_looseBounds, m_entries }, visibleMask);
+        }
+
+        if (m_children != nullptr)
+        {
+            // If this is not a leaf node, recurse into the children
+            const uint32_t childCount = GetChildNodeCount();
+            for (uint32_t child = 0; child < childCount; ++child)
+            {
+                m_children[child].EnumerateFrustums(frustums, visibleMask, containedMask, callback);
+            }
+        }
+    }
+
     void OctreeNode::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({ m_looseBounds, m_entries });
         }
 
         if (m_children != nullptr)
@@ -271,12 +328,12 @@ namespace AzFramework
     template <typename T>
     void OctreeNode::EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZ_Assert(AZ::ShapeIntersection::Overlaps(boundingVolume, m_bounds), "EnumerateHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
+        AZ_Assert(AZ::ShapeIntersection::Overlaps(boundingVolume, m_looseBounds), "EnumerateHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
 
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({ m_looseBounds, m_entries });
         }
 
         if (m_children != nullptr)
@@ -285,7 +342,7 @@ namespace AzFramework
             const uint32_t childCount = GetChildNodeCount();
             for (uint32_t child = 0; child < childCount; ++child)
             {
-                if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_bounds))
+                if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_looseBounds))
                 {
                     m_children[child].EnumerateHelper(boundingVolume, callback);
                 }
@@ -328,6 +385,7 @@ namespace AzFramework
                 }
 
                 m_children[child].m_bounds = childBound.GetTranslated(childOffset);
+                m_children[child].m_looseBounds = GetLooseBounds(m_children[child].m_bounds, octreeScene.GetLooseness());
                 m_children[child].m_parent = this;
             }
         }
@@ -365,7 +423,14 @@ namespace AzFramework
     }
 
     OctreeScene::OctreeScene(const AZ::Name& sceneName)
+        : OctreeScene(sceneName, bg_octreeLooseness)
+    {
+        ;
+    }
+
+    OctreeScene::OctreeScene(const AZ::Name& sceneName, float looseness)
         : m_sceneName(sceneName)
+        , m_looseness(AZ::GetMax(looseness, 1.0f))
         , m_root(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-bg_octreeMaxWorldExtents), AZ::Vector3(bg_octreeMaxWorldExtents)))
     {
         AZ_Assert(!sceneName.IsEmpty(), "sceneName must be a valid string");
@@ -388,7 +453,17 @@ namespace AzFramework
 
     void OctreeScene::InsertOrUpdateEntry(VisibilityEntry& entry)
     {
-        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        {
+            // Most updates keep the entry within the loose bounds of its node and don't modify the tree,
+            // so they only need a shared lock and don't serialize with other updates or queries
+            AZStd::shared_lock<decltype(m_sharedMutex)> lock(m_sharedMutex);
+            if (entry.m_internalNode != nullptr && static_cast<OctreeNode*>(entry.m_internalNode)->CanUpdateInPlace(&entry))
+            {
+                return;
+            }
+        }
+
+        AZStd::lock_guard<decltype(m_sharedMutex)> lock(m_sharedMutex);
         if (entry.m_internalNode != nullptr)
         {
             static_cast<OctreeNode*>(entry.m_internalNode)->Update(*this, &entry);
@@ -402,7 +477,7 @@ namespace AzFramework
 
     void OctreeScene::RemoveEntry(VisibilityEntry& entry)
     {
-        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::lock_guard<decltype(m_sharedMutex)> lock(m_sharedMutex);
         if (entry.m_internalNode)
         {
             static_cast<OctreeNode*>(entry.m_internalNode)->Remove(*this, &entry);
@@ -412,43 +487,56 @@ namespace AzFramework
 
     void OctreeScene::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::shared_lock<decltype(m_sharedMutex)> lock(m_sharedMutex);
         m_root.Enumerate(aabb, callback);
     }
 
     void OctreeScene::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::shared_lock<decltype(m_sharedMutex)> lock(m_sharedMutex);
         m_root.Enumerate(sphere, callback);
     }
 
     void OctreeScene::Enumerate(const AZ::Hemisphere& hemisphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::shared_lock<decltype(m_sharedMutex)> lock(m_sharedMutex);
         m_root.Enumerate(hemisphere, callback);
     }
 
     void OctreeScene::Enumerate(const AZ::Capsule & capsule, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::shared_lock<decltype(m_sharedMutex)> lock(m_sharedMutex);
         m_root.Enumerate(capsule, callback);
     }
 
     void OctreeScene::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::shared_lock<decltype(m_sharedMutex)> lock(m_sharedMutex);
         m_root.Enumerate(frustum, callback);
     }
 
     void OctreeScene::Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::shared_lock<decltype(m_sharedMutex)> lock(m_sharedMutex);
         m_root.Enumerate(includeFrustum, excludeFrustum, callback);
     }
 
+    void OctreeScene::EnumerateFrustums(AZStd::span<const AZ::Frustum> frustums, const EnumerateFrustumsCallback& callback) const
+    {
+        AZ_Assert(frustums.size() <= MaxEnumerateFrustums, "EnumerateFrustums supports at most %u frustums", MaxEnumerateFrustums);
+        if (frustums.empty())
+        {
+            return;
+        }
+
+        const VisibilityFrustumBatch frustumBatch(frustums.first(AZStd::min<size_t>(frustums.size(), MaxEnumerateFrustums)));
+        AZStd::shared_lock<decltype(m_sharedMutex)> lock(m_sharedMutex);
+        m_root.EnumerateFrustums(frustumBatch, frustumBatch.GetAllMask(), 0, callback);
+    }
+
     void OctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::shared_lock<decltype(m_sharedMutex)> lock(m_sharedMutex);
         m_root.EnumerateNoCull(callback);
     }
 
@@ -478,6 +566,11 @@ namespace AzFramework
         return AzFramework::GetChildNodeCount();
     }
 
+    float OctreeScene::GetLooseness() const
+    {
+        return m_looseness;
+    }
+
     void OctreeScene::DumpStats()
     {
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::EntryCount = %u", GetName().GetCStr(), GetEntryCount());
@@ -485,6 +578,7 @@ namespace AzFramework
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::FreeNodeCount = %u", GetName().GetCStr(), GetFreeNodeCount());
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::PageCount = %u", GetName().GetCStr(), GetPageCount());
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::ChildNodeCount = %u", GetName().GetCStr(), GetChildNodeCount());
+        AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::Looseness = %f", GetName().GetCStr(), GetLooseness());
     }
 
     static inline uint32_t CreateNodeIndex(uint32_t page, uint32_t offset)
@@ -609,9 +703,24 @@ namespace AzFramework
     }
 
     IVisibilityScene* OctreeSystemComponent::CreateVisibilityScene(const AZ::Name& sceneName)
+    {
+        return CreateVisibilityScene(sceneName, VisibilitySceneType::Octree);
+    }
+
+    IVisibilityScene* OctreeSystemComponent::CreateVisibilityScene(const AZ::Name& sceneName, VisibilitySceneType sceneType)
     {
         AZ_Assert(FindVisibilityScene(sceneName) == nullptr, "Scene with same name already created!");
-        OctreeScene* newScene = aznew OctreeScene(sceneName);
+        IVisibilityScene* newScene = nullptr;
+        switch (sceneType)
+        {
+        case VisibilitySceneType::Bvh:
+            newScene = aznew BvhScene(sceneName);
+            break;
+        case VisibilitySceneType::Octree:
+        default:
+            newScene = aznew OctreeScene(sceneName);
+            break;
+        }
         m_scenes.push_back(newScene);
         return newScene;
     }
@@ -632,7 +741,7 @@ namespace AzFramework
 
     IVisibilityScene* OctreeSystemComponent::FindVisibilityScene(const AZ::Name& sceneName)
     {
-        for (OctreeScene* scene : m_scenes)
+        for (IVisibilityScene* scene : m_scenes)
         {
             if(scene->GetName() == sceneName)
             {
@@ -644,10 +753,17 @@ namespace AzFramework
 
     void OctreeSystemComponent::DumpStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
     {
-        for (OctreeScene* scene : m_scenes)
+        for (IVisibilityScene* scene : m_scenes)
         {
             AZ_TracePrintf("Console", "============================================");
-            scene->DumpStats();
+            if (OctreeScene* octreeScene = azrtti_cast<OctreeScene*>(scene))
+            {
+                octreeScene->DumpStats();
+            }
+            else if (BvhScene* bvhScene = azrtti_cast<BvhScene*>(scene))
+            {
+                bvhScene->DumpStats();
+            }
         }
         AZ_TracePrintf("Console", "============================================");
     }
@@ -11,6 +11,7 @@
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzCore/Math/Plane.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/Debug/LockContentionProfiler.h>
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/fixed_vector.h>
@@ -20,9 +21,12 @@ namespace AzFramework
 {
     class OctreeSystemComponent;
     class OctreeScene;
+    class VisibilityFrustumBatch;
 
     //! An internal node within the tree.
     //! It contains all objects that are *fully contained* by the node, if an object spans multiple child nodes that object will be stored in the parent.
+    //! Containment is tested against the loose bounds of the node, which are the bounds of the node scaled by the looseness of the scene.
+    //! Loose bounds overlap the bounds of the neighbouring nodes, so moving entries change nodes less often and fewer entries get stuck in parent nodes.
     class OctreeNode
         : public VisibilityNode
     {
@@ -43,6 +47,9 @@ namespace AzFramework
         //! The provided entry must be bound to this node, but may no longer be bound to this node upon function exit.
         void Update(OctreeScene& octreeScene, VisibilityEntry* entry);
 
+        //! Returns true if the entry can stay bound to this node with its current bounding volume, in which case Update is a no-op.
+        bool CanUpdateInPlace(const VisibilityEntry* entry) const;
+
         //! Removes a VisibilityEntry from this OctreeNode.
         //! The provided entry must be bound to this node.
         void Remove(OctreeScene& octreeScene, VisibilityEntry* entry);
@@ -57,6 +64,17 @@ namespace AzFramework
         void Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const IVisibilityScene::EnumerateCallback& callback) const;
         //! @}
 
+        //! Recursively enumerates any OctreeNodes and their children that intersect any of the batched frustums.
+        //! @param frustums      the batched frustums to test against
+        //! @param testMask      the frustums that overlap the parent node and need to be tested against this node
+        //! @param containedMask the frustums that fully contain the parent node, and so contain this node without testing
+        //! @param callback      the callback to invoke with each visible node and the mask of the frustums that can see it
+        void EnumerateFrustums(
+            const VisibilityFrustumBatch& frustums,
+            IVisibilityScene::FrustumMask testMask,
+            IVisibilityScene::FrustumMask containedMask,
+            const IVisibilityScene::EnumerateFrustumsCallback& callback) const;
+
         //! Recursively enumerate *all* OctreeNodes that have any entries in them (without any culling).
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const;
 
@@ -83,14 +101,17 @@ namespace AzFramework
         // This gives us a maximum of 65,536 pages and 65,536 nodes per page, for a total of 2^32 - 1 total pages (-1 reserved for the invalid index)
         static constexpr uint32_t InvalidChildNodeIndex = 0xFFFFFFFF;
         uint32_t m_childNodeIndex = InvalidChildNodeIndex;
-        AZ::Aabb m_bounds;
+        AZ::Aabb m_bounds; //< The region of space partitioned by this node, used to compute the bounds of the child nodes
+        AZ::Aabb m_looseBounds; //< The bounds that entries bound to this node are contained by, used for all queries
         OctreeNode* m_parent = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
         OctreeNode* m_children = nullptr;
         AZStd::vector<VisibilityEntry*> m_entries;
     };
 
     //! Implementation of the visibility system interface.
-    //! This uses a simple adaptive octree to support partitioning an object set for a specific scene and efficiently running gathers and visibility queries.
+    //! This uses a simple adaptive loose octree to support partitioning an object set for a specific scene and efficiently running gathers and visibility queries.
+    //! Updates of entries that stay within the loose bounds of their leaf node only take a shared lock, so they can run concurrently with each other
+    //! and with queries, only updates that move entries to a different node serialize on the exclusive lock.
     class OctreeScene
         : public IVisibilityScene
     {
@@ -100,6 +121,10 @@ namespace AzFramework
         AZ_DISABLE_COPY_MOVE(OctreeScene);
 
         explicit OctreeScene(const AZ::Name& sceneName);
+
+        //! @param sceneName the uniquely identifying name for the visibility scene
+        //! @param looseness the scale applied to the bounds of the nodes to compute their loose bounds, 1 for a regular octree
+        OctreeScene(const AZ::Name& sceneName, float looseness);
         virtual ~OctreeScene();
 
         //! IVisibilityScene overrides.
@@ -113,6 +138,7 @@ namespace AzFramework
         void Enumerate(const AZ::Capsule& capsule, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const override;
+        void EnumerateFrustums(AZStd::span<const AZ::Frustum> frustums, const EnumerateFrustumsCallback& callback) const override;
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
         uint32_t GetEntryCount() const override;
         //! @}
@@ -123,6 +149,7 @@ namespace AzFramework
         uint32_t GetFreeNodeCount() const;
         uint32_t GetPageCount() const;
         uint32_t GetChildNodeCount() const;
+        float GetLooseness() const;
         void DumpStats();
         //! @}
 
@@ -131,9 +158,10 @@ namespace AzFramework
         void ReleaseChildNodes(uint32_t nodeIndex);
         OctreeNode* GetChildNodesAtIndex(uint32_t nodeIndex) const;
 
-        mutable AZStd::shared_mutex m_sharedMutex;
+        mutable AZ::Debug::ProfiledMutex<AZStd::shared_mutex> m_sharedMutex{ "OctreeScene::m_sharedMutex" };
 
         AZ::Name m_sceneName; //< The uniquely identifying name for the visibility scene.
+        float m_looseness = 1.0f; //< The scale applied to node bounds to compute their loose bounds.
         OctreeNode m_root; //< The root node for the octreeSystemComponent.
 
         uint32_t m_entryCount = 0; //< Metric tracking the number of entries inserted into the octreeSystemComponent.
@@ -150,7 +178,8 @@ namespace AzFramework
     };
 
     //! Implementation of the visibility system interface.
-    //! This manages creating, destroying, and finding the underlying octrees that are associated with specific scenes
+    //! This manages creating, destroying, and finding the underlying octrees that are associated with specific scenes,
+    //! scenes can also be created as bounding volume hierarchies (see BvhScene).
     class OctreeSystemComponent
         : public AZ::Component
         , public IVisibilitySystemRequestBus::Handler
@@ -178,6 +207,7 @@ namespace AzFramework
         //! @{
         IVisibilityScene* GetDefaultVisibilityScene() override;
         IVisibilityScene* CreateVisibilityScene(const AZ::Name& sceneName) override;
+        IVisibilityScene* CreateVisibilityScene(const AZ::Name& sceneName, VisibilitySceneType sceneType) override;
         void DestroyVisibilityScene(IVisibilityScene* visScene) override;
         IVisibilityScene* FindVisibilityScene(const AZ::Name& sceneName) override;
         void DumpStats(const AZ::ConsoleCommandContainer& arguments) override;
@@ -188,7 +218,7 @@ namespace AzFramework
         OctreeScene* m_defaultScene = nullptr;
 
         //! Other scenes (e.g. each rendering scene) are stored here and looked up by name.
-        AZStd::vector<OctreeScene*> m_scenes;   //using a vector<> here because we'll generally have a small number of scenes
+        AZStd::vector<IVisibilityScene*> m_scenes;   //using a vector<> here because we'll generally have a small number of scenes
         
     };
 }
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzFramework/Visibility/IVisibilitySystem.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/limits.h>
+
+namespace AzFramework
+{
+    //! The planes of a set of frustums in structure of arrays layout, so that a bounding box is tested against four frustums at once.
+    //! Used by the IVisibilityScene implementations for IVisibilityScene::EnumerateFrustums.
+    class VisibilityFrustumBatch
+    {
+    public:
+        using FrustumMask = IVisibilityScene::FrustumMask;
+
+        explicit VisibilityFrustumBatch(AZStd::span<const AZ::Frustum> frustums)
+        {
+            const uint32_t frustumCount = aznumeric_cast<uint32_t>(frustums.size());
+            m_groups.resize((frustumCount + LaneCount - 1) / LaneCount);
+            for (uint32_t planeId = AZ::Frustum::PlaneId::Near; planeId < AZ::Frustum::PlaneId::MAX; ++planeId)
+            {
+                for (uint32_t group = 0; group < m_groups.size(); ++group)
+                {
+                    // Unused lanes are left as zero planes, they're never part of the tested mask
+                    float coefficients[4][LaneCount] = {};
+                    for (uint32_t lane = 0; lane < LaneCount && group * LaneCount + lane < frustumCount; ++lane)
+                    {
+                        const AZ::Plane plane = frustums[group * LaneCount + lane].GetPlane(static_cast<AZ::Frustum::PlaneId>(planeId));
+                        coefficients[0][lane] = plane.GetNormal().GetX();
+                        coefficients[1][lane] = plane.GetNormal().GetY();
+                        coefficients[2][lane] = plane.GetNormal().GetZ();
+                        coefficients[3][lane] = plane.GetDistance();
+                    }
+
+                    PlaneGroup& planeGroup = m_groups[group][planeId];
+                    planeGroup.m_normalX = Vec4::LoadUnaligned(coefficients[0]);
+                    planeGroup.m_normalY = Vec4::LoadUnaligned(coefficients[1]);
+                    planeGroup.m_normalZ = Vec4::LoadUnaligned(coefficients[2]);
+                    planeGroup.m_distance = Vec4::LoadUnaligned(coefficients[3]);
+                    planeGroup.m_absNormalX = Vec4::Abs(planeGroup.m_normalX);
+                    planeGroup.m_absNormalY = Vec4::Abs(planeGroup.m_normalY);
+                    planeGroup.m_absNormalZ = Vec4::Abs(planeGroup.m_normalZ);
+                }
+            }
+            m_allMask = (frustumCount >= IVisibilityScene::MaxEnumerateFrustums) ? ~FrustumMask(0) : ((FrustumMask(1) << frustumCount) - 1);
+        }
+
+        FrustumMask GetAllMask() const
+        {
+            return m_allMask;
+        }
+
+        //! Intersects a bounding box against the frustums in testMask.
+        //! @return the mask of the frustums overlapping the bounding box, the frustums fully containing it are added to outContainedMask
+        FrustumMask Intersect(const AZ::Aabb& aabb, FrustumMask testMask, FrustumMask& outContainedMask) const
+        {
+            const AZ::Vector3 center = aabb.GetCenter();
+            const AZ::Vector3 halfExtents = aabb.GetExtents() * 0.5f;
+            const Vec4::FloatType centerX = Vec4::Splat(center.GetX());
+            const Vec4::FloatType centerY = Vec4::Splat(center.GetY());
+            const Vec4::FloatType centerZ = Vec4::Splat(center.GetZ());
+            const Vec4::FloatType halfExtentX = Vec4::Splat(halfExtents.GetX());
+            const Vec4::FloatType halfExtentY = Vec4::Splat(halfExtents.GetY());
+            const Vec4::FloatType halfExtentZ = Vec4::Splat(halfExtents.GetZ());
+
+            FrustumMask overlapMask = 0;
+            for (uint32_t group = 0; group < m_groups.size(); ++group)
+            {
+                const FrustumMask groupMask = (testMask >> (group * LaneCount)) & LaneMask;
+                if (groupMask == 0)
+                {
+                    continue;
+                }
+
+                // The box overlaps a frustum if it reaches the inner side of every plane, and is contained if it's entirely on the inner side
+                Vec4::FloatType minFarthest = Vec4::Splat(AZStd::numeric_limits<float>::max());
+                Vec4::FloatType minNearest = minFarthest;
+                for (const PlaneGroup& planeGroup : m_groups[group])
+                {
+                    const Vec4::FloatType centerDistance = Vec4::Madd(centerX, planeGroup.m_normalX,
+                        Vec4::Madd(centerY, planeGroup.m_normalY, Vec4::Madd(centerZ, planeGroup.m_normalZ, planeGroup.m_distance)));
+                    const Vec4::FloatType projectedRadius = Vec4::Madd(halfExtentX, planeGroup.m_absNormalX,
+                        Vec4::Madd(halfExtentY, planeGroup.m_absNormalY, Vec4::Mul(halfExtentZ, planeGroup.m_absNormalZ)));
+                    minFarthest = Vec4::Min(minFarthest, Vec4::Add(centerDistance, projectedRadius));
+                    minNearest = Vec4::Min(minNearest, Vec4::Sub(centerDistance, projectedRadius));
+                }
+
+                float farthest[LaneCount];
+                float nearest[LaneCount];
+                Vec4::StoreUnaligned(farthest, minFarthest);
+                Vec4::StoreUnaligned(nearest, minNearest);
+                for (uint32_t lane = 0; lane < LaneCount; ++lane)
+                {
+                    const FrustumMask frustumBit = FrustumMask(1) << (group * LaneCount + lane);
+                    if ((groupMask & (1 << lane)) != 0 && farthest[lane] >= 0.0f)
+                    {
+                        overlapMask |= frustumBit;
+                        if (nearest[lane] >= 0.0f)
+                        {
+                            outContainedMask |= frustumBit;
+                        }
+                    }
+                }
+            }
+            return overlapMask;
+        }
+
+    private:
+        using Vec4 = AZ::Simd::Vec4;
+        static constexpr uint32_t LaneCount = 4;
+        static constexpr FrustumMask LaneMask = (1 << LaneCount) - 1;
+
+        struct PlaneGroup
+        {
+            Vec4::FloatType m_normalX;
+            Vec4::FloatType m_normalY;
+            Vec4::FloatType m_normalZ;
+            Vec4::FloatType m_distance;
+            Vec4::FloatType m_absNormalX;
+            Vec4::FloatType m_absNormalY;
+            Vec4::FloatType m_absNormalZ;
+        };
+        using FrustumGroup = AZStd::array<PlaneGroup, AZ::Frustum::PlaneId::MAX>;
+
+        AZStd::fixed_vector<FrustumGroup, IVisibilityScene::MaxEnumerateFrustums / LaneCount> m_groups;
+        FrustumMask m_allMask = 0;
+    };
+} // namespace AzFramework
@@ -56,6 +56,8 @@ set(FILES
     Asset/AssetProcessorMessages.h
     Asset/AssetRegistry.h
     Asset/AssetRegistry.cpp
+    Asset/MappedAssetRegistry.h
+    Asset/MappedAssetRegistry.cpp
     Asset/AssetSeedList.cpp
     Asset/AssetSeedList.h
     Asset/AssetSystemComponent.cpp
@@ -386,6 +388,7 @@ set(FILES
     Windowing/WindowBus.h
     Windowing/NativeWindow.cpp
     Windowing/NativeWindow.h
+    Input/Buses/Notifications/InputChannelEventBatchNotificationBus.h
     Input/Buses/Notifications/InputChannelNotificationBus.h
     Input/Buses/Notifications/InputDeviceNotificationBus.h
     Input/Buses/Notifications/InputSystemNotificationBus.h
@@ -483,6 +486,8 @@ set(FILES
     Slice/SliceInstantiationTicket.cpp
     Visibility/BoundsBus.cpp
     Visibility/BoundsBus.h
+    Visibility/BvhScene.cpp
+    Visibility/BvhScene.h
     Visibility/EntityBoundsUnionBus.h
     Visibility/EntityVisibilityBoundsUnionSystem.cpp
     Visibility/EntityVisibilityBoundsUnionSystem.h
@@ -495,6 +500,7 @@ set(FILES
     Visibility/OctreeSystemComponent.h
     Visibility/VisibilityDebug.cpp
     Visibility/VisibilityDebug.h
+    Visibility/VisibilityFrustumBatch.h
     Visibility/VisibleGeometryBus.cpp
     Visibility/VisibleGeometryBus.h
 )
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Archive/ZipDirCache.h>
+#include <AzFramework/Archive/ZipDirCacheFactory.h>
+#include <AzFramework/Archive/ZipDirFind.h>
+#include <AzFramework/IO/LocalFileIO.h>
+#include <AzTest/Utils.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    class BM_ZipDirCache
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+        void internalSetUp(const benchmark::State& state)
+        {
+            m_previousDirectInstance = AZ::IO::FileIOBase::GetDirectInstance();
+            m_fileIo = AZStd::make_unique<AZ::IO::LocalFileIO>();
+            AZ::IO::FileIOBase::SetDirectInstance(m_fileIo.get());
+
+            m_tempDirectory = AZStd::make_unique<AZ::Test::ScopedAutoTempDirectory>();
+            m_archivePath = m_tempDirectory->GetDirectoryAsPath() / "benchmark.pak";
+
+            // Spread the files over a few levels of folders, similar to the layout of a product cache.
+            const auto fileCount = aznumeric_cast<uint32_t>(state.range(0));
+            m_filePaths.reserve(fileCount);
+            m_missingFilePaths.reserve(fileCount);
+            for (uint32_t i = 0; i < fileCount; ++i)
+            {
+                m_filePaths.emplace_back(AZStd::string::format("folder%u/subfolder%u/file%u.bin", i % 32, i % 256, i));
+                m_missingFilePaths.emplace_back(AZStd::string::format("folder%u/subfolder%u/missing%u.bin", i % 32, i % 256, i));
+            }
+
+            {
+                AZ::IO::ZipDir::CacheFactory factory(AZ::IO::ZipDir::InitMethod::Default, AZ::IO::ZipDir::CacheFactory::FLAGS_CREATE_NEW);
+                AZ::IO::ZipDir::CachePtr cache = factory.New(m_archivePath.c_str());
+                constexpr AZStd::string_view fileData = "data";
+                for (const AZ::IO::Path& filePath : m_filePaths)
+                {
+                    cache->UpdateFile(filePath.Native(), fileData.data(), fileData.size());
+                }
+            }
+
+            OpenArchive();
+        }
+
+        void internalTearDown()
+        {
+            m_cache.reset();
+            m_filePaths = {};
+            m_missingFilePaths = {};
+            m_tempDirectory.reset();
+
+            AZ::IO::FileIOBase::SetDirectInstance(m_previousDirectInstance);
+            m_fileIo.reset();
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void OpenArchive()
+        {
+            m_cache.reset();
+            AZ::IO::ZipDir::CacheFactory factory(AZ::IO::ZipDir::InitMethod::Default, AZ::IO::ZipDir::CacheFactory::FLAGS_READ_ONLY);
+            m_cache = factory.New(m_archivePath.c_str());
+        }
+
+        AZStd::unique_ptr<AZ::IO::LocalFileIO> m_fileIo;
+        AZ::IO::FileIOBase* m_previousDirectInstance = nullptr;
+        AZStd::unique_ptr<AZ::Test::ScopedAutoTempDirectory> m_tempDirectory;
+        AZ::IO::Path m_archivePath;
+        AZStd::vector<AZ::IO::Path> m_filePaths;
+        AZStd::vector<AZ::IO::Path> m_missingFilePaths;
+        AZ::IO::ZipDir::CachePtr m_cache;
+    };
+
+    BENCHMARK_DEFINE_F(BM_ZipDirCache, OpenReadOnly)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            OpenArchive();
+            benchmark::DoNotOptimize(m_cache.get());
+        }
+    }
+    BENCHMARK_REGISTER_F(BM_ZipDirCache, OpenReadOnly)->Arg(1000)->Arg(10000)->Arg(200000)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(BM_ZipDirCache, FindFile_ExistingFiles)(benchmark::State& state)
+    {
+        size_t index = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(m_cache->FindFile(m_filePaths[index].Native()));
+            index = (index + 1) % m_filePaths.size();
+        }
+    }
+    BENCHMARK_REGISTER_F(BM_ZipDirCache, FindFile_ExistingFiles)->Arg(1000)->Arg(10000)->Arg(200000);
+
+    BENCHMARK_DEFINE_F(BM_ZipDirCache, FindFile_MissingFiles)(benchmark::State& state)
+    {
+        size_t index = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(m_cache->FindFile(m_missingFilePaths[index].Native()));
+            index = (index + 1) % m_missingFilePaths.size();
+        }
+    }
+    BENCHMARK_REGISTER_F(BM_ZipDirCache, FindFile_MissingFiles)->Arg(1000)->Arg(10000)->Arg(200000);
+
+    // Walks the directory tree the way lookups were done before the file index, as a baseline for the benchmarks above.
+    BENCHMARK_DEFINE_F(BM_ZipDirCache, FindExact_DirectoryTree)(benchmark::State& state)
+    {
+        AZ::IO::ZipDir::FindFile findFile(m_cache);
+        size_t index = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(findFile.FindExact(m_filePaths[index]));
+            index = (index + 1) % m_filePaths.size();
+        }
+    }
+    BENCHMARK_REGISTER_F(BM_ZipDirCache, FindExact_DirectoryTree)->Arg(1000)->Arg(10000)->Arg(200000);
+} // namespace Benchmark
+
+#endif
@@ -279,6 +279,97 @@ namespace UnitTest
         TestFGetCachedFileData(fileInArchiveFile, dataString.size(), dataString.data());
     }
 
+    TEST_F(ArchiveTestFixture, MapFileInPak_StoredAndCompressedFiles_OnlyStoredFileIsMapped)
+    {
+        constexpr const char* storedFile = "levels\\mylevel\\stored.bin";
+        constexpr const char* compressedFile = "levels\\mylevel\\compressed.bin";
+        constexpr AZStd::string_view dataString = "HELLO WORLD";
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        constexpr const char* testArchivePath = "@usercache@/mapped.pak";
+        archive->ClosePack(testArchivePath);
+        fileIo->Remove(testArchivePath);
+
+        AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_EQ(0, pArchive->UpdateFile(storedFile, dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_STORE));
+        EXPECT_EQ(0, pArchive->UpdateFile(compressedFile, dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_COMPRESS,
+            AZ::IO::INestedArchive::LEVEL_FASTEST));
+        pArchive.reset();
+
+        ASSERT_TRUE(archive->OpenPack("@products@", testArchivePath));
+
+        AZ::IO::MappedFileView storedView = archive->MapFileInPak(storedFile);
+        ASSERT_TRUE(storedView.IsValid());
+        EXPECT_EQ(dataString, AZStd::string_view(reinterpret_cast<const char*>(storedView.GetData().data()), storedView.GetData().size()));
+
+        AZ::IO::MappedFileView compressedView = archive->MapFileInPak(compressedFile);
+        EXPECT_FALSE(compressedView.IsValid());
+        EXPECT_TRUE(compressedView.GetData().empty());
+
+        // The view keeps the archive mapped after the pack has been closed.
+        EXPECT_TRUE(archive->ClosePack(testArchivePath));
+        EXPECT_EQ(dataString, AZStd::string_view(reinterpret_cast<const char*>(storedView.GetData().data()), storedView.GetData().size()));
+        EXPECT_FALSE(archive->MapFileInPak(storedFile).IsValid());
+    }
+
+    TEST_F(ArchiveTestFixture, FindFile_ReadOnlyArchiveWithNestedFolders_FindsFilesThroughIndex)
+    {
+        constexpr AZStd::string_view dataString = "HELLO WORLD";
+        constexpr AZStd::string_view longerDataString = "HELLO WORLD AGAIN";
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        constexpr const char* testArchivePath = "@usercache@/indexed.pak";
+        archive->ClosePack(testArchivePath);
+        fileIo->Remove(testArchivePath);
+
+        AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_EQ(0, pArchive->UpdateFile("root.txt", dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_STORE));
+        EXPECT_EQ(0, pArchive->UpdateFile("levels\\mylevel\\level.txt", dataString.data(), dataString.size(),
+            AZ::IO::INestedArchive::METHOD_STORE));
+        EXPECT_EQ(0, pArchive->UpdateFile("levels\\otherlevel\\level.txt", longerDataString.data(), longerDataString.size(),
+            AZ::IO::INestedArchive::METHOD_STORE));
+        pArchive.reset();
+
+        pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_READ_ONLY);
+        ASSERT_NE(nullptr, pArchive);
+
+        AZ::IO::INestedArchive::Handle rootFile = pArchive->FindFile("root.txt");
+        ASSERT_NE(nullptr, rootFile);
+        EXPECT_EQ(dataString.size(), pArchive->GetFileSize(rootFile));
+
+        // Both separators refer to the same file.
+        AZ::IO::INestedArchive::Handle levelFile = pArchive->FindFile("levels/mylevel/level.txt");
+        ASSERT_NE(nullptr, levelFile);
+        EXPECT_EQ(levelFile, pArchive->FindFile("levels\\mylevel\\level.txt"));
+        EXPECT_EQ(dataString.size(), pArchive->GetFileSize(levelFile));
+
+        // Files with the same name in different folders are separate entries.
+        AZ::IO::INestedArchive::Handle otherLevelFile = pArchive->FindFile("levels/otherlevel/level.txt");
+        ASSERT_NE(nullptr, otherLevelFile);
+        EXPECT_NE(levelFile, otherLevelFile);
+        EXPECT_EQ(longerDataString.size(), pArchive->GetFileSize(otherLevelFile));
+
+        // Folders and partial paths aren't files.
+        EXPECT_EQ(nullptr, pArchive->FindFile("levels/mylevel"));
+        EXPECT_EQ(nullptr, pArchive->FindFile("level.txt"));
+        EXPECT_EQ(nullptr, pArchive->FindFile("levels/missing.txt"));
+
+        pArchive.reset();
+        fileIo->Remove(testArchivePath);
+    }
+
     TEST_F(ArchiveTestFixture, TestArchiveOpenPacks_FindsMultiplePaks_Works)
     {
         AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
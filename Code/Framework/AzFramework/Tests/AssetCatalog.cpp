@@ -28,6 +28,7 @@
 #include <AzFramework/Asset/AssetCatalog.h>
 #include <AzFramework/Asset/AssetProcessorMessages.h>
 #include <AzFramework/Asset/GenericAssetHandler.h>
+#include <AzFramework/Asset/MappedAssetRegistry.h>
 #include <AzFramework/Asset/NetworkAssetNotification_private.h>
 #include <AzFramework/Application/Application.h>
 
@@ -440,6 +441,26 @@ namespace UnitTest
             AZ::Data::AssetCatalogRequestBus::BroadcastResult(result, &AZ::Data::AssetCatalogRequestBus::Events::GetDirectProductDependencies, assetId);
             EXPECT_FALSE(result.IsSuccess());
         }
+
+        //! Replaces the catalog with sourcecatalog1 saved in the mapped format - asset1 path3, asset2 path2, asset4 path4
+        void LoadMappedSourceCatalog()
+        {
+            AZStd::shared_ptr<AzFramework::AssetRegistry> sourceCatalog = AzFramework::AssetCatalog::LoadCatalogFromFile(sourceCatalogPath1.c_str());
+            ASSERT_NE(sourceCatalog, nullptr);
+            const AZ::IO::Path mappedCatalogPath = m_tempDirectory.GetDirectoryAsPath() / "AssetCatalogMapped.bin";
+            ASSERT_TRUE(AzFramework::MappedAssetRegistry::Save(mappedCatalogPath.c_str(), *sourceCatalog));
+
+            AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::ClearCatalog);
+            AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::LoadCatalog, mappedCatalogPath.c_str());
+        }
+
+        AZ::Data::AssetId GetAssetIdByPath(const char* assetPath)
+        {
+            AZ::Data::AssetId foundId;
+            AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+                foundId, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetIdByPath, assetPath, AZ::Data::s_invalidAssetType, false);
+            return foundId;
+        }
     };
 
     TEST_F(AssetCatalogDeltaTest, LoadCatalog_AssetChangedCatalogLoaded_AssetStillKnown)
@@ -466,6 +487,120 @@ namespace UnitTest
         EXPECT_TRUE(assetInfo.m_assetId.IsValid());
     }
 
+    TEST_F(AssetCatalogDeltaTest, LoadCatalog_MappedCatalog_LayersChangesOnTopOfMappedEntries)
+    {
+        // sourcecatalog1 - asset1 path3 (depends on asset 2), asset2 path2, asset4 path4
+        AZStd::shared_ptr<AzFramework::AssetRegistry> sourceCatalog = AzFramework::AssetCatalog::LoadCatalogFromFile(sourceCatalogPath1.c_str());
+        ASSERT_NE(sourceCatalog, nullptr);
+        const AZ::IO::Path mappedCatalogPath = m_tempDirectory.GetDirectoryAsPath() / "AssetCatalogMapped.bin";
+        ASSERT_TRUE(AzFramework::MappedAssetRegistry::Save(mappedCatalogPath.c_str(), *sourceCatalog));
+
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::ClearCatalog);
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::LoadCatalog, mappedCatalogPath.c_str());
+
+        AZStd::string assetPath;
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetPath, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetPathById, asset1);
+        EXPECT_EQ(assetPath, path3);
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetPath, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetPathById, asset2);
+        EXPECT_EQ(assetPath, path2);
+        AZ::Data::AssetId foundId;
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+            foundId, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetIdByPath, path4, AZ::Data::s_invalidAssetType, false);
+        EXPECT_EQ(foundId, asset4);
+        CheckDirectDependencies(asset1, { asset2 });
+        CheckNoDependencies(asset2);
+
+        // Unregistering an asset hides the mapped entry.
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::UnregisterAsset, asset4);
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetPath, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetPathById, asset4);
+        EXPECT_EQ(assetPath, "");
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+            foundId, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetIdByPath, path4, AZ::Data::s_invalidAssetType, false);
+        EXPECT_FALSE(foundId.IsValid());
+
+        // deltacatalog3 - asset1 path6 asset5 path4 (depends on asset 2)
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::AddDeltaCatalog, deltaCatalog3);
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetPath, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetPathById, asset1);
+        EXPECT_EQ(assetPath, path6);
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetPath, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetPathById, asset5);
+        EXPECT_EQ(assetPath, path4);
+        CheckNoDependencies(asset1);
+        CheckDirectDependencies(asset5, { asset2 });
+
+        size_t enumeratedAssetCount = 0;
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::EnumerateAssets, nullptr,
+            [&enumeratedAssetCount](const AZ::Data::AssetId&, const AZ::Data::AssetInfo&)
+            {
+                ++enumeratedAssetCount;
+            },
+            nullptr);
+        // asset1, asset2 and asset5
+        EXPECT_EQ(enumeratedAssetCount, 3u);
+
+        // Saving the catalog writes the mapped entries together with the changes on top of them.
+        const AZ::IO::Path mergedCatalogPath = m_tempDirectory.GetDirectoryAsPath() / "AssetCatalogMerged.xml";
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::SaveCatalog, mergedCatalogPath.c_str());
+        AZStd::shared_ptr<AzFramework::AssetRegistry> mergedCatalog = AzFramework::AssetCatalog::LoadCatalogFromFile(mergedCatalogPath.c_str());
+        ASSERT_NE(mergedCatalog, nullptr);
+        EXPECT_EQ(mergedCatalog->m_assetIdToInfo.size(), 3u);
+        EXPECT_EQ(mergedCatalog->m_assetIdToInfo[asset1].m_relativePath, path6);
+        EXPECT_EQ(mergedCatalog->m_assetIdToInfo[asset2].m_relativePath, path2);
+        EXPECT_EQ(mergedCatalog->m_assetIdToInfo[asset5].m_relativePath, path4);
+        EXPECT_EQ(mergedCatalog->GetAssetIdByPath(path4), asset5);
+        EXPECT_TRUE(mergedCatalog->GetAssetDependencies(asset1).empty());
+    }
+
+    TEST_F(AssetCatalogDeltaTest, GetAssetIdByPath_MappedAssetRenamed_OldPathNotFound)
+    {
+        LoadMappedSourceCatalog();
+        ASSERT_EQ(GetAssetIdByPath(path2), asset2);
+
+        AZ::Data::AssetInfo renamedInfo;
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(renamedInfo, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetInfoById, asset2);
+        renamedInfo.m_relativePath = path5;
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::RegisterAsset, asset2, renamedInfo);
+
+        EXPECT_EQ(GetAssetIdByPath(path5), asset2);
+        EXPECT_FALSE(GetAssetIdByPath(path2).IsValid());
+        AZStd::string assetPath;
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetPath, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetPathById, asset2);
+        EXPECT_EQ(assetPath, path5);
+
+        // Re-registering the asset with its mapped path makes that path resolve again.
+        renamedInfo.m_relativePath = path2;
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::RegisterAsset, asset2, renamedInfo);
+        EXPECT_EQ(GetAssetIdByPath(path2), asset2);
+
+        // Other mapped entries are unaffected.
+        EXPECT_EQ(GetAssetIdByPath(path3), asset1);
+        EXPECT_EQ(GetAssetIdByPath(path4), asset4);
+    }
+
+    TEST_F(AssetCatalogDeltaTest, GetAssetIdByPath_MappedAssetUnregistered_PathNotFound)
+    {
+        LoadMappedSourceCatalog();
+        ASSERT_EQ(GetAssetIdByPath(path2), asset2);
+
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::UnregisterAsset, asset2);
+        EXPECT_FALSE(GetAssetIdByPath(path2).IsValid());
+
+        // A renamed mapped asset which is then unregistered can't be found by either path.
+        AZ::Data::AssetInfo renamedInfo;
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(renamedInfo, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetInfoById, asset1);
+        renamedInfo.m_relativePath = path5;
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::RegisterAsset, asset1, renamedInfo);
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::UnregisterAsset, asset1);
+        EXPECT_FALSE(GetAssetIdByPath(path3).IsValid());
+        EXPECT_FALSE(GetAssetIdByPath(path5).IsValid());
+
+        // The path of an unregistered mapped asset can be taken by another asset.
+        AZ::Data::AssetInfo newInfo;
+        newInfo.m_assetId = asset5;
+        newInfo.m_relativePath = path2;
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::RegisterAsset, asset5, newInfo);
+        EXPECT_EQ(GetAssetIdByPath(path2), asset5);
+    }
+
     TEST_F(AssetCatalogDeltaTest, DeltaCatalogTest)
     {
         AZStd::string assetPath;
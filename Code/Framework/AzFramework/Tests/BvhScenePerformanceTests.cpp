@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzFramework/Visibility/BvhScene.h>
+#include <AzFramework/Visibility/OctreeSystemComponent.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <random>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Compares the octree and BVH visibility scenes on clustered content, i.e. dense groups of small entries separated by
+    //! large empty regions, which is the distribution the BVH is meant for.
+    class BM_VisibilityScene
+        : public benchmark::Fixture
+    {
+        void internalSetUp()
+        {
+            if (!AZ::NameDictionary::IsReady())
+            {
+                AZ::NameDictionary::Create();
+            }
+            m_visibilitySystem = new AzFramework::OctreeSystemComponent;
+            m_octreeScene = m_visibilitySystem->CreateVisibilityScene(
+                AZ::Name("OctreeClusteredBenchmarkScene"), AzFramework::VisibilitySceneType::Octree);
+            m_bvhScene = m_visibilitySystem->CreateVisibilityScene(
+                AZ::Name("BvhClusteredBenchmarkScene"), AzFramework::VisibilitySceneType::Bvh);
+            m_dataArray.resize(100000);
+            m_queryDataArray.resize(1000);
+
+            const unsigned int seed = 1;
+            std::mt19937_64 rng(seed);
+            std::uniform_real_distribution<float> unif;
+
+            AZStd::vector<AZ::Vector3> clusterCenters(ClusterCount);
+            std::generate(clusterCenters.begin(), clusterCenters.end(), [&unif, &rng]()
+            {
+                return AZ::Vector3(unif(rng), unif(rng), unif(rng) * 0.1f) * 8000.0f;
+            });
+
+            uint32_t index = 0;
+            std::generate(m_dataArray.begin(), m_dataArray.end(), [&unif, &rng, &clusterCenters, &index]()
+            {
+                AzFramework::VisibilityEntry data;
+                AZ::Vector3 aabbMin = clusterCenters[index++ % ClusterCount] + AZ::Vector3(unif(rng), unif(rng), unif(rng)) * ClusterSize;
+                AZ::Vector3 aabbMax = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 2.0f + aabbMin;
+                data.m_boundingVolume = AZ::Aabb::CreateFromMinMax(aabbMin, aabbMax);
+                return data;
+            });
+
+            std::generate(m_queryDataArray.begin(), m_queryDataArray.end(), [&unif, &rng, &clusterCenters]()
+            {
+                // Half the queries look at a cluster, the other half mostly see empty space
+                QueryData data;
+                const AZ::Vector3 center = (unif(rng) < 0.5f)
+                    ? clusterCenters[static_cast<size_t>(unif(rng) * (ClusterCount - 1))]
+                    : AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 8000.0f;
+                data.aabb = AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(unif(rng) * 100.0f + 10.0f));
+                AZ::Quaternion quaternion = AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetNormalized(), unif(rng));
+                data.frustum = AZ::Frustum(AZ::ViewFrustumAttributes(
+                    AZ::Transform::CreateFromQuaternionAndTranslation(quaternion, center), 1.0f,
+                    2.0f * atanf(0.5f), 0.1f, unif(rng) * 1000.0f + 10.0f));
+                return data;
+            });
+        }
+
+        void internalTearDown()
+        {
+            m_visibilitySystem->DestroyVisibilityScene(m_octreeScene);
+            m_visibilitySystem->DestroyVisibilityScene(m_bvhScene);
+            delete m_visibilitySystem;
+            AZ::NameDictionary::Destroy();
+
+            m_dataArray.clear();
+            m_dataArray.shrink_to_fit();
+
+            m_queryDataArray.clear();
+            m_queryDataArray.shrink_to_fit();
+        }
+
+    public:
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void InsertEntries(AzFramework::IVisibilityScene& visScene)
+        {
+            for (AzFramework::VisibilityEntry& entry : m_dataArray)
+            {
+                visScene.InsertOrUpdateEntry(entry);
+            }
+
+            // Benchmark the BVH once its hierarchy has been built with the surface area heuristic
+            if (auto bvhScene = azrtti_cast<AzFramework::BvhScene*>(&visScene))
+            {
+                bvhScene->Rebuild();
+            }
+        }
+
+        void RemoveEntries(AzFramework::IVisibilityScene& visScene)
+        {
+            for (AzFramework::VisibilityEntry& entry : m_dataArray)
+            {
+                visScene.RemoveEntry(entry);
+            }
+        }
+
+        void EnumerateAabbs(benchmark::State& state, AzFramework::IVisibilityScene& visScene)
+        {
+            InsertEntries(visScene);
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (auto& queryData : m_queryDataArray)
+                {
+                    visScene.Enumerate(queryData.aabb, [](const AzFramework::IVisibilityScene::NodeData&) {});
+                }
+            }
+            RemoveEntries(visScene);
+        }
+
+        void EnumerateFrustums(benchmark::State& state, AzFramework::IVisibilityScene& visScene)
+        {
+            InsertEntries(visScene);
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (auto& queryData : m_queryDataArray)
+                {
+                    visScene.Enumerate(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
+                }
+            }
+            RemoveEntries(visScene);
+        }
+
+        void UpdateMovingEntries(benchmark::State& state, AzFramework::IVisibilityScene& visScene)
+        {
+            InsertEntries(visScene);
+            float distance = MoveDistance;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                // Entries jitter within their cluster, like dynamic objects moving every frame
+                for (AzFramework::VisibilityEntry& entry : m_dataArray)
+                {
+                    entry.m_boundingVolume.Translate(AZ::Vector3(distance, -distance, 0.0f));
+                    visScene.InsertOrUpdateEntry(entry);
+                }
+                distance = -distance;
+            }
+            if (auto bvhScene = azrtti_cast<AzFramework::BvhScene*>(&visScene))
+            {
+                bvhScene->WaitForRebuild();
+            }
+            RemoveEntries(visScene);
+        }
+
+        static constexpr uint32_t ClusterCount = 64;
+        static constexpr float ClusterSize = 40.0f;
+        static constexpr float MoveDistance = 0.5f;
+
+        struct QueryData
+        {
+            AZ::Aabb aabb;
+            AZ::Frustum frustum;
+        };
+
+        AZStd::vector<AzFramework::VisibilityEntry> m_dataArray;
+        AZStd::vector<QueryData> m_queryDataArray;
+        AzFramework::OctreeSystemComponent* m_visibilitySystem = nullptr;
+        AzFramework::IVisibilityScene* m_octreeScene = nullptr;
+        AzFramework::IVisibilityScene* m_bvhScene = nullptr;
+    };
+
+    BENCHMARK_F(BM_VisibilityScene, OctreeInsertDeleteClustered100000)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            InsertEntries(*m_octreeScene);
+            RemoveEntries(*m_octreeScene);
+        }
+    }
+
+    BENCHMARK_F(BM_VisibilityScene, BvhInsertDeleteClustered100000)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            InsertEntries(*m_bvhScene);
+            RemoveEntries(*m_bvhScene);
+        }
+    }
+
+    BENCHMARK_F(BM_VisibilityScene, OctreeEnumerateAabbClustered100000)(benchmark::State& state)
+    {
+        EnumerateAabbs(state, *m_octreeScene);
+    }
+
+    BENCHMARK_F(BM_VisibilityScene, BvhEnumerateAabbClustered100000)(benchmark::State& state)
+    {
+        EnumerateAabbs(state, *m_bvhScene);
+    }
+
+    BENCHMARK_F(BM_VisibilityScene, OctreeEnumerateFrustumClustered100000)(benchmark::State& state)
+    {
+        EnumerateFrustums(state, *m_octreeScene);
+    }
+
+    BENCHMARK_F(BM_VisibilityScene, BvhEnumerateFrustumClustered100000)(benchmark::State& state)
+    {
+        EnumerateFrustums(state, *m_bvhScene);
+    }
+
+    BENCHMARK_F(BM_VisibilityScene, OctreeUpdateMovingClustered100000)(benchmark::State& state)
+    {
+        UpdateMovingEntries(state, *m_octreeScene);
+    }
+
+    BENCHMARK_F(BM_VisibilityScene, BvhUpdateMovingClustered100000)(benchmark::State& state)
+    {
+        UpdateMovingEntries(state, *m_bvhScene);
+    }
+}
+
+#endif
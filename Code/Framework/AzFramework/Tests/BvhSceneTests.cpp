@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzFramework/Visibility/BvhScene.h>
+#include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzCore/std/sort.h>
+#include <random>
+
+using namespace AzFramework;
+
+namespace UnitTest
+{
+    class BvhSceneTests
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            if (!AZ::NameDictionary::IsReady())
+            {
+                AZ::NameDictionary::Create();
+            }
+            m_bvhScene = aznew BvhScene(AZ::Name("BvhUnitTestScene"));
+        }
+
+        void TearDown() override
+        {
+            delete m_bvhScene;
+            m_bvhScene = nullptr;
+            AZ::NameDictionary::Destroy();
+        }
+
+        //! Fills the entries with small boxes packed in a few dense clusters
+        void CreateClusteredEntries(AZStd::vector<VisibilityEntry>& entries, uint32_t entryCount)
+        {
+            std::mt19937 rng(1);
+            std::uniform_real_distribution<float> unif(0.0f, 1.0f);
+
+            const AZ::Vector3 clusterCenters[] = { AZ::Vector3(-500.0f, -500.0f, 0.0f), AZ::Vector3(200.0f, 300.0f, 10.0f), AZ::Vector3(900.0f, -100.0f, 50.0f) };
+            entries.resize(entryCount);
+            for (uint32_t i = 0; i < entryCount; ++i)
+            {
+                const AZ::Vector3 min = clusterCenters[i % AZ_ARRAY_SIZE(clusterCenters)] + AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 20.0f;
+                entries[i].m_boundingVolume = AZ::Aabb::CreateFromMinMax(min, min + AZ::Vector3(0.5f + unif(rng)));
+            }
+        }
+
+        static AZStd::vector<VisibilityEntry*> GatherEntries(const IVisibilityScene& visScene, const AZ::Aabb& aabb)
+        {
+            AZStd::vector<VisibilityEntry*> gatheredEntries;
+            visScene.Enumerate(aabb, [&gatheredEntries](const IVisibilityScene::NodeData& nodeData)
+            {
+                for (VisibilityEntry* entry : nodeData.m_entries)
+                {
+                    // Nodes are conservative, only keep the entries actually overlapping the query
+                    if (entry->m_boundingVolume.Overlaps(aabb))
+                    {
+                        gatheredEntries.push_back(entry);
+                    }
+                }
+            });
+            AZStd::sort(gatheredEntries.begin(), gatheredEntries.end());
+            return gatheredEntries;
+        }
+
+        static AZStd::vector<VisibilityEntry*> GatherEntriesBruteForce(AZStd::vector<VisibilityEntry>& entries, const AZ::Aabb& aabb)
+        {
+            AZStd::vector<VisibilityEntry*> gatheredEntries;
+            for (VisibilityEntry& entry : entries)
+            {
+                if (entry.m_boundingVolume.Overlaps(aabb))
+                {
+                    gatheredEntries.push_back(&entry);
+                }
+            }
+            AZStd::sort(gatheredEntries.begin(), gatheredEntries.end());
+            return gatheredEntries;
+        }
+
+        static uint32_t CountEntries(const IVisibilityScene& visScene)
+        {
+            uint32_t entryCount = 0;
+            visScene.EnumerateNoCull([&entryCount](const IVisibilityScene::NodeData& nodeData)
+            {
+                entryCount += aznumeric_cast<uint32_t>(nodeData.m_entries.size());
+            });
+            return entryCount;
+        }
+
+        BvhScene* m_bvhScene = nullptr;
+    };
+
+    TEST_F(BvhSceneTests, InsertDeleteSingleEntry)
+    {
+        VisibilityEntry visEntry;
+        visEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3::CreateZero(), AZ::Vector3::CreateOne());
+
+        m_bvhScene->InsertOrUpdateEntry(visEntry);
+        EXPECT_NE(visEntry.m_internalNode, nullptr);
+        EXPECT_EQ(m_bvhScene->GetEntryCount(), 1);
+        EXPECT_EQ(CountEntries(*m_bvhScene), 1);
+
+        m_bvhScene->RemoveEntry(visEntry);
+        EXPECT_EQ(visEntry.m_internalNode, nullptr);
+        EXPECT_EQ(m_bvhScene->GetEntryCount(), 0);
+        EXPECT_EQ(CountEntries(*m_bvhScene), 0);
+    }
+
+    TEST_F(BvhSceneTests, Rebuild_ClusteredEntries_EnumerateMatchesBruteForce)
+    {
+        AZStd::vector<VisibilityEntry> entries;
+        CreateClusteredEntries(entries, 3000);
+        for (VisibilityEntry& entry : entries)
+        {
+            m_bvhScene->InsertOrUpdateEntry(entry);
+        }
+        m_bvhScene->Rebuild();
+        EXPECT_EQ(CountEntries(*m_bvhScene), entries.size());
+        EXPECT_GT(m_bvhScene->GetLeafCount(), 1);
+
+        const AZ::Aabb queries[] = {
+            AZ::Aabb::CreateFromMinMax(AZ::Vector3(-495.0f, -495.0f, 0.0f), AZ::Vector3(-490.0f, -490.0f, 30.0f)),
+            AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1000.0f), AZ::Vector3(1000.0f)),
+            AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(100.0f)),
+        };
+        for (const AZ::Aabb& query : queries)
+        {
+            EXPECT_EQ(GatherEntries(*m_bvhScene, query), GatherEntriesBruteForce(entries, query));
+        }
+
+        for (VisibilityEntry& entry : entries)
+        {
+            m_bvhScene->RemoveEntry(entry);
+        }
+        EXPECT_EQ(CountEntries(*m_bvhScene), 0);
+    }
+
+    TEST_F(BvhSceneTests, UpdateMovingEntries_EnumerateMatchesBruteForce)
+    {
+        AZStd::vector<VisibilityEntry> entries;
+        CreateClusteredEntries(entries, 1000);
+        for (VisibilityEntry& entry : entries)
+        {
+            m_bvhScene->InsertOrUpdateEntry(entry);
+        }
+
+        // Move one cluster over to another, refitting and eventually rebuilding the hierarchy
+        for (uint32_t i = 0; i < entries.size(); i += 3)
+        {
+            entries[i].m_boundingVolume.Translate(AZ::Vector3(700.0f, 800.0f, 10.0f));
+            m_bvhScene->InsertOrUpdateEntry(entries[i]);
+        }
+        EXPECT_EQ(CountEntries(*m_bvhScene), entries.size());
+        EXPECT_EQ(m_bvhScene->GetEntryCount(), entries.size());
+
+        const AZ::Aabb query = AZ::Aabb::CreateFromMinMax(AZ::Vector3(190.0f, 290.0f, 0.0f), AZ::Vector3(230.0f, 330.0f, 40.0f));
+        const AZStd::vector<VisibilityEntry*> gatheredEntries = GatherEntries(*m_bvhScene, query);
+        EXPECT_EQ(gatheredEntries, GatherEntriesBruteForce(entries, query));
+        EXPECT_GT(gatheredEntries.size(), 0);
+
+        for (VisibilityEntry& entry : entries)
+        {
+            m_bvhScene->RemoveEntry(entry);
+        }
+    }
+
+    TEST_F(BvhSceneTests, EnumerateFrustums_MatchesEnumeratingEachFrustum)
+    {
+        AZStd::vector<VisibilityEntry> entries;
+        CreateClusteredEntries(entries, 1000);
+        for (VisibilityEntry& entry : entries)
+        {
+            m_bvhScene->InsertOrUpdateEntry(entry);
+        }
+        m_bvhScene->Rebuild();
+
+        AZStd::vector<AZ::Frustum> frustums;
+        for (uint32_t i = 0; i < 5; ++i)
+        {
+            const AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+                AZ::Quaternion::CreateRotationZ(0.5f * i), AZ::Vector3(0.0f, 0.0f, 20.0f));
+            frustums.emplace_back(AZ::ViewFrustumAttributes(transform, 1.0f, 1.0f, 1.0f, 1000.0f));
+        }
+
+        AZStd::vector<AZStd::vector<VisibilityEntry*>> batchedEntries(frustums.size());
+        m_bvhScene->EnumerateFrustums(frustums,
+            [&batchedEntries](const IVisibilityScene::NodeData& nodeData, IVisibilityScene::FrustumMask frustumMask)
+            {
+                for (uint32_t i = 0; i < batchedEntries.size(); ++i)
+                {
+                    if (frustumMask & (1 << i))
+                    {
+                        batchedEntries[i].insert(batchedEntries[i].end(), nodeData.m_entries.begin(), nodeData.m_entries.end());
+                    }
+                }
+            });
+
+        for (uint32_t i = 0; i < frustums.size(); ++i)
+        {
+            AZStd::vector<VisibilityEntry*> gatheredEntries;
+            m_bvhScene->Enumerate(frustums[i], [&gatheredEntries](const IVisibilityScene::NodeData& nodeData)
+            {
+                gatheredEntries.insert(gatheredEntries.end(), nodeData.m_entries.begin(), nodeData.m_entries.end());
+            });
+
+            AZStd::sort(gatheredEntries.begin(), gatheredEntries.end());
+            AZStd::sort(batchedEntries[i].begin(), batchedEntries[i].end());
+            EXPECT_EQ(gatheredEntries, batchedEntries[i]);
+        }
+
+        for (VisibilityEntry& entry : entries)
+        {
+            m_bvhScene->RemoveEntry(entry);
+        }
+    }
+
+    TEST_F(BvhSceneTests, CreateVisibilityScene_BvhSceneType_CreatesBvhScene)
+    {
+        OctreeSystemComponent visibilitySystem;
+        IVisibilityScene* bvhScene = visibilitySystem.CreateVisibilityScene(AZ::Name("BvhSystemScene"), VisibilitySceneType::Bvh);
+        IVisibilityScene* octreeScene = visibilitySystem.CreateVisibilityScene(AZ::Name("OctreeSystemScene"));
+        EXPECT_NE(azrtti_cast<BvhScene*>(bvhScene), nullptr);
+        EXPECT_NE(azrtti_cast<OctreeScene*>(octreeScene), nullptr);
+        EXPECT_EQ(visibilitySystem.FindVisibilityScene(AZ::Name("BvhSystemScene")), bvhScene);
+
+        visibilitySystem.DestroyVisibilityScene(bvhScene);
+        visibilitySystem.DestroyVisibilityScene(octreeScene);
+    }
+}
@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzFramework/Input/Buses/Notifications/InputChannelEventBatchNotificationBus.h>
 #include <AzFramework/Input/Contexts/InputContext.h>
 #include <AzFramework/Input/Mappings/InputMapping.h>
 #include <AzFramework/Input/Mappings/InputMappingAnd.h>
@@ -1136,4 +1137,59 @@ namespace InputUnitTests
         EXPECT_EQ(inputMapping->GetDelta(), -1.0f);
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    class InputChannelEventBatchRecorder : public InputChannelEventBatchNotificationBus::Handler
+    {
+    public:
+        InputChannelEventBatchRecorder() { InputChannelEventBatchNotificationBus::Handler::BusConnect(); }
+        ~InputChannelEventBatchRecorder() override { InputChannelEventBatchNotificationBus::Handler::BusDisconnect(); }
+
+        void OnInputChannelEventBatch(const InputChannelEventBatch& eventBatch) override
+        {
+            m_batches.push_back(eventBatch);
+        }
+
+        AZStd::vector<InputChannelEventBatch> m_batches;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    TEST_F(InputTest, InputChannelEventBatch_EventsDuringInputUpdate_BroadcastOncePerUpdate)
+    {
+        if (!m_gamepadSupported)
+        {
+        #if defined(GTEST_SKIP)
+            GTEST_SKIP() << "Skipping test InputChannelEventBatch_EventsDuringInputUpdate_BroadcastOncePerUpdate";
+        #else
+            SUCCEED() << "Skipping test InputChannelEventBatch_EventsDuringInputUpdate_BroadcastOncePerUpdate";
+        #endif
+            return;
+        }
+
+        InputChannelEventBatchRecorder recorder;
+
+        // The first update starts recording the events since the recorder is connected.
+        AzFramework::InputSystemRequestBus::Broadcast(&InputSystemRequests::TickInput);
+        EXPECT_TRUE(recorder.m_batches.empty());
+
+        // Simulate a button press and release, then validate both events are sent in a single batch on the next update.
+        AzFramework::InputChannelRequestBus::Event(InputDeviceGamepad::Button::A,
+                                                   &AzFramework::InputChannelRequests::SimulateRawInput,
+                                                   1.0f);
+        AzFramework::InputChannelRequestBus::Event(InputDeviceGamepad::Button::A,
+                                                   &AzFramework::InputChannelRequests::SimulateRawInput,
+                                                   0.0f);
+        EXPECT_TRUE(recorder.m_batches.empty());
+
+        AzFramework::InputSystemRequestBus::Broadcast(&InputSystemRequests::TickInput);
+        ASSERT_EQ(recorder.m_batches.size(), 1u);
+        const InputChannelEventBatch& eventBatch = recorder.m_batches.front();
+        ASSERT_GE(eventBatch.size(), 2u);
+        EXPECT_EQ(eventBatch[0].m_channelId, InputDeviceGamepad::Button::A);
+        EXPECT_EQ(eventBatch[0].m_state, InputChannel::State::Began);
+        EXPECT_EQ(eventBatch[0].m_value, 1.0f);
+        EXPECT_EQ(eventBatch[1].m_channelId, InputDeviceGamepad::Button::A);
+        EXPECT_EQ(eventBatch[1].m_state, InputChannel::State::Ended);
+        EXPECT_EQ(eventBatch[1].m_value, 0.0f);
+    }
+
 } // namespace UnitTest
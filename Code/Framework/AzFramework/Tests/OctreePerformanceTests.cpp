@@ -13,6 +13,7 @@
 #if defined(HAVE_BENCHMARK)
 
 #include <random>
+#include <AzCore/std/parallel/thread.h>
 #include <benchmark/benchmark.h>
 
 namespace Benchmark
@@ -112,6 +113,71 @@ namespace Benchmark
             }
         }
 
+        //! Moves entries in [begin, end) back and forth by a small distance, like dynamic objects moving every frame.
+        void MoveEntries(AzFramework::IVisibilityScene& visScene, uint32_t begin, uint32_t end, float distance)
+        {
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                m_dataArray[i].m_boundingVolume.Translate(AZ::Vector3(distance, -distance, 0.0f));
+                visScene.InsertOrUpdateEntry(m_dataArray[i]);
+            }
+        }
+
+        void UpdateMovingEntries(benchmark::State& state, AzFramework::IVisibilityScene& visScene, uint32_t entryCount)
+        {
+            for (uint32_t i = 0; i < entryCount; ++i)
+            {
+                visScene.InsertOrUpdateEntry(m_dataArray[i]);
+            }
+
+            float distance = MoveDistance;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                MoveEntries(visScene, 0, entryCount, distance);
+                distance = -distance;
+            }
+
+            for (uint32_t i = 0; i < entryCount; ++i)
+            {
+                visScene.RemoveEntry(m_dataArray[i]);
+            }
+        }
+
+        void UpdateMovingEntriesConcurrently(benchmark::State& state, AzFramework::IVisibilityScene& visScene, uint32_t entryCount, uint32_t threadCount)
+        {
+            for (uint32_t i = 0; i < entryCount; ++i)
+            {
+                visScene.InsertOrUpdateEntry(m_dataArray[i]);
+            }
+
+            float distance = MoveDistance;
+            const uint32_t entriesPerThread = entryCount / threadCount;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                AZStd::vector<AZStd::thread> threads;
+                for (uint32_t thread = 0; thread < threadCount; ++thread)
+                {
+                    threads.emplace_back([this, &visScene, thread, entriesPerThread, distance]()
+                    {
+                        MoveEntries(visScene, thread * entriesPerThread, (thread + 1) * entriesPerThread, distance);
+                    });
+                }
+                for (AZStd::thread& thread : threads)
+                {
+                    thread.join();
+                }
+                distance = -distance;
+            }
+
+            for (uint32_t i = 0; i < entryCount; ++i)
+            {
+                visScene.RemoveEntry(m_dataArray[i]);
+            }
+        }
+
+        static constexpr float MoveDistance = 2.0f;
+        static constexpr float Looseness = 1.5f;
+
         struct QueryData
         {
             AZ::Aabb aabb;
@@ -332,6 +398,77 @@ namespace Benchmark
         }
         RemoveEntries(EntryCount);
     }
+
+    BENCHMARK_F(BM_Octree, EnumerateSixFrustumsSeparately100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        constexpr uint32_t FrustumCount = 6;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (uint32_t query = 0; query + FrustumCount <= m_queryDataArray.size(); query += FrustumCount)
+            {
+                for (uint32_t frustum = 0; frustum < FrustumCount; ++frustum)
+                {
+                    m_visScene->Enumerate(m_queryDataArray[query + frustum].frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
+                }
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateSixFrustumsBatched100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        constexpr uint32_t FrustumCount = 6;
+        InsertEntries(EntryCount);
+        AZStd::vector<AZ::Frustum> frustums(FrustumCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (uint32_t query = 0; query + FrustumCount <= m_queryDataArray.size(); query += FrustumCount)
+            {
+                for (uint32_t frustum = 0; frustum < FrustumCount; ++frustum)
+                {
+                    frustums[frustum] = m_queryDataArray[query + frustum].frustum;
+                }
+                m_visScene->EnumerateFrustums(frustums, [](const AzFramework::IVisibilityScene::NodeData&, AzFramework::IVisibilityScene::FrustumMask) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, UpdateMoving10000)(benchmark::State& state)
+    {
+        UpdateMovingEntries(state, *m_visScene, 10000);
+    }
+
+    BENCHMARK_F(BM_Octree, UpdateMoving100000)(benchmark::State& state)
+    {
+        UpdateMovingEntries(state, *m_visScene, 100000);
+    }
+
+    BENCHMARK_F(BM_Octree, UpdateMovingLoose10000)(benchmark::State& state)
+    {
+        AzFramework::OctreeScene looseScene(AZ::Name("OctreeBenchmarkLooseVisibilityScene"), Looseness);
+        UpdateMovingEntries(state, looseScene, 10000);
+    }
+
+    BENCHMARK_F(BM_Octree, UpdateMovingLoose100000)(benchmark::State& state)
+    {
+        AzFramework::OctreeScene looseScene(AZ::Name("OctreeBenchmarkLooseVisibilityScene"), Looseness);
+        UpdateMovingEntries(state, looseScene, 100000);
+    }
+
+    BENCHMARK_F(BM_Octree, UpdateMovingConcurrent100000)(benchmark::State& state)
+    {
+        UpdateMovingEntriesConcurrently(state, *m_visScene, 100000, 4);
+    }
+
+    BENCHMARK_F(BM_Octree, UpdateMovingLooseConcurrent100000)(benchmark::State& state)
+    {
+        AzFramework::OctreeScene looseScene(AZ::Name("OctreeBenchmarkLooseVisibilityScene"), Looseness);
+        UpdateMovingEntriesConcurrently(state, looseScene, 100000, 4);
+    }
 }
 
 #endif
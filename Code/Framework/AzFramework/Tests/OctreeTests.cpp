@@ -13,6 +13,8 @@
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/MatrixUtils.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
 #include <random>
 
 using namespace AzFramework;
@@ -363,6 +365,63 @@ namespace UnitTest
         EnumerateMultipleEntriesHelper(m_octreeScene, bound1, bound2, bound3);
     }
 
+    TEST_F(OctreeTests, EnumerateFrustums_MatchesEnumeratingEachFrustum)
+    {
+        constexpr uint32_t EntryCount = 256;
+        constexpr uint32_t FrustumCount = 6;
+
+        std::mt19937 rng(1);
+        std::uniform_real_distribution<float> unif(-1.0f, 1.0f);
+
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(EntryCount);
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            const AZ::Vector3 min(unif(rng) * 0.9f, unif(rng) * 0.9f, unif(rng) * 0.9f);
+            entry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(min, min + AZ::Vector3(0.05f));
+            m_octreeScene->InsertOrUpdateEntry(entry);
+        }
+
+        AZStd::vector<AZ::Frustum> frustums;
+        for (uint32_t i = 0; i < FrustumCount; ++i)
+        {
+            const AZ::Vector3 origin(unif(rng), -2.0f, unif(rng));
+            const AZ::Quaternion rotation = AZ::Quaternion::CreateRotationZ(unif(rng) * 0.5f);
+            const AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(rotation, origin);
+            frustums.emplace_back(AZ::ViewFrustumAttributes(transform, 1.0f, 0.5f + 0.1f * i, 0.5f, 2.0f + 0.5f * i));
+        }
+
+        AZStd::vector<AZStd::vector<VisibilityEntry*>> batchedEntries(FrustumCount);
+        m_octreeScene->EnumerateFrustums(frustums,
+            [&batchedEntries](const AzFramework::IVisibilityScene::NodeData& nodeData, AzFramework::IVisibilityScene::FrustumMask frustumMask)
+            {
+                for (uint32_t i = 0; i < FrustumCount; ++i)
+                {
+                    if (frustumMask & (1 << i))
+                    {
+                        AppendEntries(batchedEntries[i], nodeData);
+                    }
+                }
+            });
+
+        for (uint32_t i = 0; i < FrustumCount; ++i)
+        {
+            AZStd::vector<VisibilityEntry*> gatheredEntries;
+            m_octreeScene->Enumerate(frustums[i], [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                AppendEntries(gatheredEntries, nodeData);
+            });
+
+            AZStd::sort(gatheredEntries.begin(), gatheredEntries.end());
+            AZStd::sort(batchedEntries[i].begin(), batchedEntries[i].end());
+            EXPECT_EQ(gatheredEntries, batchedEntries[i]);
+        }
+
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            m_octreeScene->RemoveEntry(entry);
+        }
+    }
+
     TEST_F(OctreeTests, InsertOrUpdateEntry_OverFillRootNodeWithLargeEntries_EntriesAreNotLost)
     {
         // Validate that the octree works if you exceed the max entry count with large entries,
@@ -407,6 +466,96 @@ namespace UnitTest
         ValidateEntryCountEqualsExpectedCount(m_octreeScene, static_cast<uint32_t>(visEntries.size()));
     }
 
+    TEST_F(OctreeTests, LooseOctree_UpdateWithinLooseBounds_EntryStaysInNode)
+    {
+        OctreeScene looseScene(AZ::Name("LooseOctreeUnitTestScene"), 2.0f);
+
+        AzFramework::VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        looseScene.InsertOrUpdateEntry(visEntry[0]);
+        looseScene.InsertOrUpdateEntry(visEntry[1]); // This should force a split of the root node
+        EXPECT_EQ(looseScene.GetNodeCount(), 1 + looseScene.GetChildNodeCount());
+        EXPECT_NE(visEntry[0].m_internalNode, visEntry[1].m_internalNode);
+
+        // The entry now straddles the center of the root, but is still within the loose bounds of its node
+        VisibilityNode* node = visEntry[1].m_internalNode;
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.2f), AZ::Vector3(0.3f));
+        looseScene.InsertOrUpdateEntry(visEntry[1]);
+        EXPECT_EQ(visEntry[1].m_internalNode, node);
+        ValidateEntryCountEqualsExpectedCount(&looseScene, 2);
+
+        // Queries use the loose bounds, so the entry is found where it extends past the bounds of its node
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+        looseScene.Enumerate(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.15f), AZ::Vector3(-0.1f)),
+            [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                AppendEntries(gatheredEntries, nodeData);
+            });
+        EXPECT_NE(AZStd::find(gatheredEntries.begin(), gatheredEntries.end(), &visEntry[1]), gatheredEntries.end());
+
+        // Moving out of the loose bounds moves the entry to a different node
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.6f), AZ::Vector3(0.3f));
+        looseScene.InsertOrUpdateEntry(visEntry[1]);
+        EXPECT_NE(visEntry[1].m_internalNode, node);
+        ValidateEntryCountEqualsExpectedCount(&looseScene, 2);
+
+        looseScene.RemoveEntry(visEntry[0]);
+        looseScene.RemoveEntry(visEntry[1]);
+        ValidateEntryCountEqualsExpectedCount(&looseScene, 0);
+    }
+
+    TEST_F(OctreeTests, ConcurrentUpdates_EntriesAreNotLost)
+    {
+        constexpr uint32_t ThreadCount = 4;
+        constexpr uint32_t EntriesPerThread = 64;
+        constexpr uint32_t UpdateCount = 32;
+
+        OctreeScene looseScene(AZ::Name("ConcurrentOctreeUnitTestScene"), 1.5f);
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(ThreadCount * EntriesPerThread);
+        for (uint32_t i = 0; i < visEntries.size(); ++i)
+        {
+            const AZ::Vector3 min(-0.95f + 1.8f * i / visEntries.size());
+            visEntries[i].m_boundingVolume = AZ::Aabb::CreateFromMinMax(min, min + AZ::Vector3(0.01f));
+            looseScene.InsertOrUpdateEntry(visEntries[i]);
+        }
+
+        // Each thread moves its own entries back and forth, while queries run on the main thread
+        AZStd::vector<AZStd::thread> threads;
+        for (uint32_t thread = 0; thread < ThreadCount; ++thread)
+        {
+            threads.emplace_back([&looseScene, &visEntries, thread]()
+            {
+                for (uint32_t update = 0; update < UpdateCount; ++update)
+                {
+                    const float offset = (update & 1) ? -0.02f : 0.02f;
+                    for (uint32_t i = thread * EntriesPerThread; i < (thread + 1) * EntriesPerThread; ++i)
+                    {
+                        visEntries[i].m_boundingVolume.Translate(AZ::Vector3(offset));
+                        looseScene.InsertOrUpdateEntry(visEntries[i]);
+                    }
+                }
+            });
+        }
+
+        for (uint32_t query = 0; query < UpdateCount; ++query)
+        {
+            looseScene.EnumerateNoCull([](const AzFramework::IVisibilityScene::NodeData&) {});
+        }
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        ValidateEntryCountEqualsExpectedCount(&looseScene, static_cast<uint32_t>(visEntries.size()));
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            looseScene.RemoveEntry(entry);
+        }
+        ValidateEntryCountEqualsExpectedCount(&looseScene, 0);
+    }
+
     TEST_F(OctreeTests, ExcludeFrustumTest)
     {
         // This test is made to be similar to EnumerateMultipleEntriesHelper, however needs to be
@@ -581,6 +581,35 @@ namespace UnitTest
         }
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_ParallelClone_EntityIdsAreMappedCorrectly)
+    {
+        // Cloning in parallel needs to produce the same entities in the same order as cloning one entity at a time.
+        m_manager->SetParallelCloneThreshold(8);
+        for (EntityReferenceScheme refScheme : {
+                EntityReferenceScheme::AllReferenceFirst, EntityReferenceScheme::AllReferenceLast,
+                EntityReferenceScheme::AllReferenceThemselves, EntityReferenceScheme::AllReferenceNextCircular,
+                EntityReferenceScheme::AllReferencePreviousCircular })
+        {
+            constexpr size_t NumEntities = 100;
+            FillSpawnable(NumEntities);
+            CreateEntityReferences(refScheme);
+
+            size_t spawnedEntitiesCount = 0;
+            auto callback = [this, refScheme, &spawnedEntitiesCount]
+                (AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+            {
+                spawnedEntitiesCount = entities.size();
+                ValidateEntityReferences(refScheme, NumEntities, entities);
+            };
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_completionCallback = AZStd::move(callback);
+            m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+            ProcessQueueTillEmtpy();
+            EXPECT_EQ(NumEntities, spawnedEntitiesCount);
+        }
+        m_manager->SetParallelCloneThreshold(0);
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_AllEntitiesReferenceOtherEntities_EntityIdsOnlyReferWithinASingleCall)
     {
         // This tests that entity id references get mapped correctly with multiple SpawnAllEntities calls.  Each call should only map
@@ -773,6 +802,131 @@ namespace UnitTest
         EXPECT_TRUE(allEntityIdsPatched);
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_EntityBudget_SpawnSpreadOverMultipleCalls)
+    {
+        using namespace AzFramework;
+        static constexpr size_t NumEntities = 10;
+        FillSpawnable(NumEntities);
+
+        SpawnableEntitiesManager::ProcessingBudget budget;
+        budget.m_maxEntities = 4;
+        m_manager->SetProcessingBudget(SpawnableEntitiesManager::CommandQueuePriority::Regular, budget);
+
+        size_t preInsertionCalls = 0;
+        size_t spawnedEntitiesCount = 0;
+        AZStd::vector<uint32_t> progress;
+        SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_preInsertionCallback = [&preInsertionCalls](EntitySpawnTicket::Id, SpawnableEntityContainerView entities)
+        {
+            preInsertionCalls++;
+            EXPECT_EQ(NumEntities, entities.size());
+        };
+        optionalArgs.m_completionCallback = [&spawnedEntitiesCount](EntitySpawnTicket::Id, SpawnableConstEntityContainerView entities)
+        {
+            spawnedEntitiesCount += entities.size();
+        };
+        optionalArgs.m_progressCallback = [&progress](EntitySpawnTicket::Id, uint32_t processed, uint32_t total)
+        {
+            EXPECT_EQ(NumEntities, total);
+            progress.push_back(processed);
+        };
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+
+        auto queues = SpawnableEntitiesManager::CommandQueuePriority::High | SpawnableEntitiesManager::CommandQueuePriority::Regular;
+        EXPECT_EQ(SpawnableEntitiesManager::CommandQueueStatus::HasCommandsLeft, m_manager->ProcessQueue(queues));
+        EXPECT_EQ(0, spawnedEntitiesCount);
+        EXPECT_EQ(0, preInsertionCalls);
+        EXPECT_EQ(SpawnableEntitiesManager::CommandQueueStatus::HasCommandsLeft, m_manager->ProcessQueue(queues));
+        EXPECT_EQ(SpawnableEntitiesManager::CommandQueueStatus::NoCommandsLeft, m_manager->ProcessQueue(queues));
+
+        EXPECT_EQ(NumEntities, spawnedEntitiesCount);
+        EXPECT_EQ(1, preInsertionCalls);
+        ASSERT_EQ(3, progress.size());
+        EXPECT_EQ(4, progress[0]);
+        EXPECT_EQ(8, progress[1]);
+        EXPECT_EQ(10, progress[2]);
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_EntityBudgetWithIncrementalActivation_EntitiesInsertedPerSlice)
+    {
+        using namespace AzFramework;
+        static constexpr size_t NumEntities = 10;
+        FillSpawnable(NumEntities);
+
+        SpawnableEntitiesManager::ProcessingBudget budget;
+        budget.m_maxEntities = 4;
+        m_manager->SetProcessingBudget(SpawnableEntitiesManager::CommandQueuePriority::Regular, budget);
+
+        AZStd::vector<size_t> insertedSlices;
+        size_t spawnedEntitiesCount = 0;
+        SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_activateIncrementally = true;
+        optionalArgs.m_preInsertionCallback = [&insertedSlices](EntitySpawnTicket::Id, SpawnableEntityContainerView entities)
+        {
+            insertedSlices.push_back(entities.size());
+        };
+        optionalArgs.m_completionCallback = [&spawnedEntitiesCount](EntitySpawnTicket::Id, SpawnableConstEntityContainerView entities)
+        {
+            spawnedEntitiesCount += entities.size();
+        };
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        ProcessQueueTillEmtpy();
+
+        EXPECT_EQ(NumEntities, spawnedEntitiesCount);
+        ASSERT_EQ(3, insertedSlices.size());
+        EXPECT_EQ(4, insertedSlices[0]);
+        EXPECT_EQ(4, insertedSlices[1]);
+        EXPECT_EQ(2, insertedSlices[2]);
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_EntityBudget_LaterRequestsWaitForSpawnToComplete)
+    {
+        using namespace AzFramework;
+        static constexpr size_t NumEntities = 10;
+        FillSpawnable(NumEntities);
+
+        SpawnableEntitiesManager::ProcessingBudget budget;
+        budget.m_maxEntities = 3;
+        m_manager->SetProcessingBudget(SpawnableEntitiesManager::CommandQueuePriority::Regular, budget);
+
+        size_t listedEntitiesCount = 0;
+        auto listCallback = [&listedEntitiesCount](EntitySpawnTicket::Id, SpawnableConstEntityContainerView entities)
+        {
+            listedEntitiesCount = entities.size();
+        };
+        m_manager->SpawnAllEntities(*m_ticket);
+        m_manager->ListEntities(*m_ticket, AZStd::move(listCallback));
+        ProcessQueueTillEmtpy();
+
+        EXPECT_EQ(NumEntities, listedEntitiesCount);
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnEntities_EntityBudget_SpawnSpreadOverMultipleCalls)
+    {
+        using namespace AzFramework;
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+
+        SpawnableEntitiesManager::ProcessingBudget budget;
+        budget.m_maxEntities = 2;
+        m_manager->SetProcessingBudget(SpawnableEntitiesManager::CommandQueuePriority::Regular, budget);
+
+        size_t spawnedEntitiesCount = 0;
+        SpawnEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = [&spawnedEntitiesCount](EntitySpawnTicket::Id, SpawnableConstEntityContainerView entities)
+        {
+            spawnedEntitiesCount += entities.size();
+        };
+        m_manager->SpawnEntities(*m_ticket, { 0, 2, 3, 1, 0 }, AZStd::move(optionalArgs));
+
+        auto queues = SpawnableEntitiesManager::CommandQueuePriority::High | SpawnableEntitiesManager::CommandQueuePriority::Regular;
+        EXPECT_EQ(SpawnableEntitiesManager::CommandQueueStatus::HasCommandsLeft, m_manager->ProcessQueue(queues));
+        EXPECT_EQ(SpawnableEntitiesManager::CommandQueueStatus::HasCommandsLeft, m_manager->ProcessQueue(queues));
+        EXPECT_EQ(0, spawnedEntitiesCount);
+        EXPECT_EQ(SpawnableEntitiesManager::CommandQueueStatus::NoCommandsLeft, m_manager->ProcessQueue(queues));
+        EXPECT_EQ(5, spawnedEntitiesCount);
+    }
+
     //
     // SpawnEntities
     //
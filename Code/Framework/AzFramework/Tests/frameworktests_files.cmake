@@ -13,6 +13,7 @@ set(FILES
     Spawnable/SpawnableScriptMediatorTests.cpp
     Spawnable/SpawnableTests.cpp
     ArchiveCompressionTests.cpp
+    ArchivePerformanceTests.cpp
     ArchiveTests.cpp
     BehaviorEntityTests.cpp
     BinToTextEncode.cpp
@@ -23,6 +24,8 @@ set(FILES
     FileIO.cpp
     FileTagTests.cpp
     GenAppDescriptors.cpp
+    BvhScenePerformanceTests.cpp
+    BvhSceneTests.cpp
     OctreePerformanceTests.cpp
     OctreeTests.cpp
     AssetCatalog.cpp
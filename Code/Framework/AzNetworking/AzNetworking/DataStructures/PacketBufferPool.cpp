@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/DataStructures/PacketBufferPool.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/Debug/Trace.h>
+
+namespace AzNetworking
+{
+    static_assert(PacketBufferPool::MaxBufferCapacity == MaxPacketSize, "The packet buffer pool should be able to hold any packet");
+
+    static uint32_t GetSizeClass(uint32_t size)
+    {
+        uint32_t sizeClass = 0;
+        uint32_t capacity = PacketBufferPool::MinBufferCapacity;
+        while (capacity < size)
+        {
+            capacity <<= 2;
+            ++sizeClass;
+        }
+        return sizeClass;
+    }
+
+    static uint32_t GetSizeClassCapacity(uint32_t sizeClass)
+    {
+        return PacketBufferPool::MinBufferCapacity << (2 * sizeClass);
+    }
+
+    PacketBuffer::PacketBuffer(PacketBufferPool& pool, uint32_t sizeClass, uint32_t capacity)
+        : m_pool(pool)
+        , m_sizeClass(sizeClass)
+    {
+        m_data.resize_no_construct(capacity);
+    }
+
+    uint32_t PacketBuffer::GetSize() const
+    {
+        return m_size;
+    }
+
+    uint32_t PacketBuffer::GetCapacity() const
+    {
+        return aznumeric_cast<uint32_t>(m_data.size());
+    }
+
+    const uint8_t* PacketBuffer::GetBuffer() const
+    {
+        return m_data.data();
+    }
+
+    uint8_t* PacketBuffer::GetBuffer()
+    {
+        return m_data.data();
+    }
+
+    bool PacketBuffer::CopyValues(const uint8_t* buffer, uint32_t bufferSize)
+    {
+        if (bufferSize > GetCapacity())
+        {
+            return false;
+        }
+        memcpy(m_data.data(), buffer, bufferSize);
+        m_size = bufferSize;
+        return true;
+    }
+
+    void PacketBuffer::add_ref()
+    {
+        ++m_refCount;
+    }
+
+    void PacketBuffer::release()
+    {
+        if (--m_refCount == 0)
+        {
+            m_pool.Release(this);
+        }
+    }
+
+    PacketBufferPool::~PacketBufferPool()
+    {
+        AZ_Assert(m_activeBufferCount == 0, "PacketBufferPool destroyed while %u buffers are still in use", m_activeBufferCount.load());
+        for (AZStd::vector<PacketBuffer*>& freeBuffers : m_freeBuffers)
+        {
+            for (PacketBuffer* buffer : freeBuffers)
+            {
+                delete buffer;
+            }
+        }
+    }
+
+    PacketBufferPtr PacketBufferPool::Acquire(uint32_t size)
+    {
+        if (size > MaxBufferCapacity)
+        {
+            return nullptr;
+        }
+
+        const uint32_t sizeClass = GetSizeClass(size);
+        PacketBuffer* buffer = nullptr;
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+            AZStd::vector<PacketBuffer*>& freeBuffers = m_freeBuffers[sizeClass];
+            if (!freeBuffers.empty())
+            {
+                buffer = freeBuffers.back();
+                freeBuffers.pop_back();
+            }
+        }
+
+        if (buffer != nullptr)
+        {
+            ++m_reusedBufferCount;
+        }
+        else
+        {
+            buffer = new PacketBuffer(*this, sizeClass, GetSizeClassCapacity(sizeClass));
+            ++m_allocatedBufferCount;
+        }
+
+        ++m_activeBufferCount;
+        buffer->m_size = size;
+        return PacketBufferPtr(buffer);
+    }
+
+    PacketBufferPtr PacketBufferPool::Acquire(const uint8_t* buffer, uint32_t bufferSize)
+    {
+        PacketBufferPtr result = Acquire(bufferSize);
+        if (result != nullptr)
+        {
+            result->CopyValues(buffer, bufferSize);
+        }
+        return result;
+    }
+
+    uint64_t PacketBufferPool::GetAllocatedBufferCount() const
+    {
+        return m_allocatedBufferCount;
+    }
+
+    uint64_t PacketBufferPool::GetReusedBufferCount() const
+    {
+        return m_reusedBufferCount;
+    }
+
+    uint32_t PacketBufferPool::GetActiveBufferCount() const
+    {
+        return m_activeBufferCount;
+    }
+
+    void PacketBufferPool::Release(PacketBuffer* buffer)
+    {
+        --m_activeBufferCount;
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+            AZStd::vector<PacketBuffer*>& freeBuffers = m_freeBuffers[buffer->m_sizeClass];
+            if (freeBuffers.size() < MaxFreeBuffersPerSizeClass)
+            {
+                freeBuffers.push_back(buffer);
+                return;
+            }
+        }
+        delete buffer;
+    }
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/intrusive_ptr.h>
+
+namespace AzNetworking
+{
+    class PacketBufferPool;
+
+    //! @class PacketBuffer
+    //! @brief A reference counted block of serialized packet data, which returns to the pool it came from once the last reference is released.
+    class PacketBuffer
+    {
+    public:
+
+        //! Returns the number of bytes of packet data in this buffer.
+        //! @return the number of bytes of packet data in this buffer
+        uint32_t GetSize() const;
+
+        //! Returns the maximum number of bytes this buffer can hold.
+        //! @return the maximum number of bytes this buffer can hold
+        uint32_t GetCapacity() const;
+
+        //! Const raw buffer access.
+        //! @return const pointer to the packet data
+        const uint8_t* GetBuffer() const;
+
+        //! Non-const raw buffer access.
+        //! @return non-const pointer to the packet data
+        uint8_t* GetBuffer();
+
+        //! Overwrites the data in this buffer with the data in the provided buffer.
+        //! @param buffer     pointer to the buffer data to copy
+        //! @param bufferSize the number of bytes in the buffer to copy
+        //! @return boolean true on success, false if the data doesn't fit
+        bool CopyValues(const uint8_t* buffer, uint32_t bufferSize);
+
+        //! Reference counting, for use through AZStd::intrusive_ptr.
+        //! @{
+        void add_ref();
+        void release();
+        //! @}
+
+    private:
+
+        PacketBuffer(PacketBufferPool& pool, uint32_t sizeClass, uint32_t capacity);
+
+        AZ_DISABLE_COPY_MOVE(PacketBuffer);
+
+        PacketBufferPool& m_pool;
+        AZStd::atomic<int32_t> m_refCount{ 0 };
+        uint32_t m_sizeClass = 0;
+        uint32_t m_size = 0;
+        AZStd::vector<uint8_t> m_data;
+
+        friend class PacketBufferPool;
+    };
+
+    using PacketBufferPtr = AZStd::intrusive_ptr<PacketBuffer>;
+
+    //! @class PacketBufferPool
+    //! @brief Hands out packet buffers from a small set of size classes and keeps released buffers around for reuse,
+    //! so the steady state of sending packets doesn't have to allocate.
+    //! Buffers can be acquired and released from any thread, and must all be released before the pool is destroyed.
+    class PacketBufferPool
+    {
+    public:
+
+        //! Smallest and largest buffer capacity handed out by the pool, each size class is four times the size of the previous one.
+        static constexpr uint32_t MinBufferCapacity = 64;
+        static constexpr uint32_t MaxBufferCapacity = 16384;
+        static constexpr uint32_t SizeClassCount = 5;
+        static_assert((MinBufferCapacity << (2 * (SizeClassCount - 1))) == MaxBufferCapacity, "Size classes don't cover the buffer capacity range");
+
+        //! The maximum number of released buffers kept for reuse in each size class.
+        static constexpr uint32_t MaxFreeBuffersPerSizeClass = 1024;
+
+        PacketBufferPool() = default;
+        ~PacketBufferPool();
+
+        //! Returns a buffer that can hold at least the requested number of bytes, with its size set to the requested number of bytes.
+        //! @param size the number of bytes needed
+        //! @return the buffer, or nullptr if the requested size is larger than MaxBufferCapacity
+        PacketBufferPtr Acquire(uint32_t size);
+
+        //! Returns a buffer holding a copy of the provided data.
+        //! @param buffer     pointer to the buffer data to copy
+        //! @param bufferSize the number of bytes in the buffer to copy
+        //! @return the buffer, or nullptr if the data is larger than MaxBufferCapacity
+        PacketBufferPtr Acquire(const uint8_t* buffer, uint32_t bufferSize);
+
+        //! Returns the total number of buffers the pool had to allocate.
+        //! @return the total number of buffers the pool had to allocate
+        uint64_t GetAllocatedBufferCount() const;
+
+        //! Returns the total number of times a released buffer was handed out again instead of allocating a new one.
+        //! @return the total number of times a released buffer was reused
+        uint64_t GetReusedBufferCount() const;
+
+        //! Returns the number of buffers that are currently in use.
+        //! @return the number of buffers that are currently in use
+        uint32_t GetActiveBufferCount() const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(PacketBufferPool);
+
+        void Release(PacketBuffer* buffer);
+
+        AZStd::mutex m_mutex;
+        AZStd::array<AZStd::vector<PacketBuffer*>, SizeClassCount> m_freeBuffers;
+        AZStd::atomic<uint64_t> m_allocatedBufferCount{ 0 };
+        AZStd::atomic<uint64_t> m_reusedBufferCount{ 0 };
+        AZStd::atomic<uint32_t> m_activeBufferCount{ 0 };
+
+        friend class PacketBuffer;
+    };
+}
@@ -47,6 +47,10 @@ namespace AzNetworking
         //! Unique identifier of a given compressor.
         virtual CompressorType GetType() const = 0;
 
+        //! Identifier of the dictionary this compressor was trained with, or 0 if it doesn't use one.
+        //! Both endpoints of a connection need to use the same dictionary, so this is checked while connecting.
+        virtual uint32_t GetDictionaryId() const { return 0; }
+
         //! Returns max possible size of uncompressed data chunk needed to fit compressed data in maxCompSize bytes.
         virtual AZStd::size_t GetMaxChunkSize(AZStd::size_t maxCompSize) const = 0;
 
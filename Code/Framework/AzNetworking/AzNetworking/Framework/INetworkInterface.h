@@ -74,6 +74,13 @@ namespace AzNetworking
         //! Updates the INetworkInterface.
         virtual void Update() = 0;
 
+        //! Defers the transmission of packets sent on this network interface until FlushSendBatch is called.
+        //! This allows the packets of every connection to be handed to the operating system together, calls may be nested.
+        virtual void BeginSendBatch() = 0;
+
+        //! Transmits all packets deferred since the matching call to BeginSendBatch.
+        virtual void FlushSendBatch() = 0;
+
         //! A helper function that transmits a packet on this connection reliably.
         //! Note that a packetId is not returned here, since retransmits may cause the packetId to change
         //! @param connectionId identifier of the connection to send to
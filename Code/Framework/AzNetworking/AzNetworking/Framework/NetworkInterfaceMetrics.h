@@ -36,6 +36,10 @@ namespace AzNetworking
         uint64_t m_sendBytesEncryptionInflation = 0;
         //! Returns the total number of packets that had to be resent on this network interface due to packet loss.
         uint64_t m_resentPackets = 0;
+        //! Returns the total number of packet buffers that had to be allocated to hold serialized packets.
+        uint64_t m_packetBufferAllocations = 0;
+        //! Returns the total number of times a pooled packet buffer was reused instead of allocating a new one.
+        uint64_t m_packetBufferReuses = 0;
         //! Returns the total number of milliseconds spent processing received data on this network interface.
         AZ::TimeMs m_recvTimeMs = AZ::Time::ZeroTimeMs;
         //! Returns the total number of packets received on this socket.
@@ -200,6 +200,8 @@ namespace AzNetworking
             AZLOG_INFO(" - Total sent compressed packets without benefit: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendCompressedPacketsNoGain));
             AZLOG_INFO(" - Total gain from packet compression: %lld", aznumeric_cast<AZ::s64>(metrics.m_sendBytesCompressedDelta));
             AZLOG_INFO(" - Total packets resent: %llu", aznumeric_cast<AZ::u64>(metrics.m_resentPackets));
+            AZLOG_INFO(" - Total packet buffers allocated: %llu", aznumeric_cast<AZ::u64>(metrics.m_packetBufferAllocations));
+            AZLOG_INFO(" - Total packet buffers reused: %llu", aznumeric_cast<AZ::u64>(metrics.m_packetBufferReuses));
             AZLOG_INFO(" - Total receive time in milliseconds: %lld", aznumeric_cast<AZ::s64>(metrics.m_recvTimeMs));
             AZLOG_INFO(" - Total received packets: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvPackets));
             AZLOG_INFO(" - Total received bytes after compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvBytes));
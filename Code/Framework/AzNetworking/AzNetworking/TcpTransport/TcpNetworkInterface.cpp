@@ -122,6 +122,17 @@ namespace AzNetworking
         GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
 
+    void TcpNetworkInterface::BeginSendBatch()
+    {
+        // Tcp sockets already coalesce outgoing data in the kernel, nothing to defer
+        ;
+    }
+
+    void TcpNetworkInterface::FlushSendBatch()
+    {
+        ;
+    }
+
     bool TcpNetworkInterface::SendReliablePacket(ConnectionId connectionId, const IPacket& packet)
     {
         IConnection* connection = m_connectionSet.GetConnection(connectionId);
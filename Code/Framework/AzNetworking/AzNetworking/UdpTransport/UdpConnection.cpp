@@ -19,6 +19,7 @@
 
 namespace AzNetworking
 {
+    AZ_CVAR(bool, net_UdpCoalescePackets, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether new Udp connections pack small packets sent during a send batch into shared datagrams, both endpoints must support it");
     AZ_CVAR(uint32_t, net_UdpMaxUnackedPacketCount, 10, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Maximum packets to receive before forcing a heartbeat packet for acking");
 
     // Track every 8th packet to determine Rtt
@@ -50,6 +51,7 @@ namespace AzNetworking
         , m_networkInterface(networkInterface)
         , m_lastSentPacketMs(AZ::GetElapsedTimeMs())
         , m_connectionRole(connectionRole)
+        , m_coalescePackets(net_UdpCoalescePackets)
     {
         ;
     }
@@ -154,6 +156,21 @@ namespace AzNetworking
         return m_connectionMtu;
     }
 
+    void UdpConnection::SetCoalescePackets(bool coalescePackets)
+    {
+        AZStd::lock_guard lock(m_sendPacketMutex);
+        m_coalescePackets = coalescePackets;
+        if (!m_coalescePackets)
+        {
+            m_networkInterface.FlushCoalescedPackets(*this);
+        }
+    }
+
+    bool UdpConnection::GetCoalescePackets() const
+    {
+        return m_coalescePackets;
+    }
+
     void UdpConnection::ProcessAcked(PacketId packetId, AZ::TimeMs currentTimeMs)
     {
         GetMetrics().LogPacketAcked();
@@ -166,7 +183,7 @@ namespace AzNetworking
         }
     }
 
-    void UdpConnection::ProcessSent(PacketId packetId, [[maybe_unused]] const IPacket& packet, 
+    void UdpConnection::ProcessSent(PacketId packetId, [[maybe_unused]] PacketType packetType, 
         uint32_t packetSize, [[maybe_unused]] ReliabilityType reliability)
     {
         const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
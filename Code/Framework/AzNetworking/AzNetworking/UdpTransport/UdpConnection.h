@@ -68,6 +68,15 @@ namespace AzNetworking
         uint32_t GetConnectionMtu() const override;
         // @}
 
+        //! Enables or disables packet coalescing, which packs small packets sent during a send batch into shared datagrams.
+        //! Both endpoints must support coalesced datagrams. Defaults to the value of net_UdpCoalescePackets.
+        //! @param coalescePackets whether to coalesce packets sent on this connection
+        void SetCoalescePackets(bool coalescePackets);
+
+        //! Returns whether small packets sent on this connection are coalesced into shared datagrams.
+        //! @return boolean true if packet coalescing is enabled
+        bool GetCoalescePackets() const;
+
         //! Returns a suitable encryption endpoint for this connection type.
         //! @return reference to the connections encryption endpoint
         DtlsEndpoint& GetDtlsEndpoint();
@@ -100,17 +109,19 @@ namespace AzNetworking
     protected:
 
         //! Prepare a reliable packet for transmission.
-        //! @param packetId identifier of the packet being sent
-        //! @param packet   reference to the packet being transmitted
+        //! @param packetId           identifier of the packet being sent
+        //! @param reliableSequenceId the reliable sequence identifier of the packet being sent
+        //! @param packetType         type of the packet being sent
+        //! @param payload            the serialized payload of the packet being sent
         //! @return boolean true on success, false on failure
-        bool PrepareReliablePacketForSend(PacketId packetId, SequenceId reliableSequenceId, const IPacket& packet);
+        bool PrepareReliablePacketForSend(PacketId packetId, SequenceId reliableSequenceId, PacketType packetType, const PacketBufferPtr& payload);
 
         //! Process a packet for sending.
         //! @param packetId   identifier of the packet being sent
-        //! @param packet     reference to the packet being transmitted
+        //! @param packetType type of the packet being sent
         //! @param packetSize packet size in bytes
         //! @param reliability whether or not to guarantee delivery
-        void ProcessSent(PacketId packetId, const IPacket& packet, uint32_t packetSize, ReliabilityType reliability);
+        void ProcessSent(PacketId packetId, PacketType packetType, uint32_t packetSize, ReliabilityType reliability);
 
         //! Process a timed out packet header.
         //! @param packetId    identifier of the packet that timed out
@@ -150,6 +161,10 @@ namespace AzNetworking
         TimeoutId m_timeoutId;
         uint32_t  m_timeoutCounter = 0;
 
+        using CoalescedPacketBuffer = ByteBuffer<MaxUdpTransmissionUnit>;
+        bool m_coalescePackets = false;
+        CoalescedPacketBuffer m_coalescedPackets; //!< Guarded by m_sendPacketMutex
+
         AZStd::mutex m_sendPacketMutex;
     };
 }
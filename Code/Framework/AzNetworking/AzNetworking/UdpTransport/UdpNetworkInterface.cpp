@@ -17,6 +17,8 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/MathUtils.h>
 
 namespace AzNetworking
@@ -38,6 +40,9 @@ namespace AzNetworking
     AZ_CVAR(float, net_RttFudgeScalar, 2.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Scalar value to multiply computed Rtt by to determine an optimal packet timeout threshold");
     AZ_CVAR(uint32_t, net_FragmentedHeaderOverhead, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "A fudge overhead value to take out of fragmented packet payloads");
     AZ_CVAR(bool, net_FragmentsAlwaysReliable, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether fragmented packets should be reliable by default or use their source packet's reliability type");
+    AZ_CVAR(uint32_t, net_UdpDecodeShardCount, 0, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The number of connection shards to decrypt and decompress received packets on in parallel, 0 or 1 decodes all packets on the main thread");
+    AZ_CVAR(uint32_t, net_UdpDecodeShardMinPackets, 64, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The minimum number of packets received in an update before decoding is spread across connection shards");
+    AZ_CVAR(uint32_t, net_UdpCoalesceMaxPacketSize, 256, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The largest encoded packet, in bytes, that is held back to share a datagram with other packets on connections that coalesce packets");
     AZ_CVAR(AZ::CVarFixedString, net_UdpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "UDP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
 
     static uint64_t ConstructTimeoutId(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability)
@@ -164,6 +169,7 @@ namespace AzNetworking
         // Signal the connection attempt
         CorePackets::InitiateConnectionPacket connectPacket = CorePackets::InitiateConnectionPacket();
         connectPacket.SetHandshakeBuffer(dtlsData);
+        connectPacket.SetCompressorDictionaryId(m_compressor ? m_compressor->GetDictionaryId() : 0);
         connection->SendReliablePacket(connectPacket);
 
         m_connectionListener.OnConnect(connection.get());
@@ -188,6 +194,11 @@ namespace AzNetworking
             return;
         }
 
+        // Acks, resends and heartbeats produced by this update go out together once it completes
+        BeginSendBatch();
+
+        const bool predecoded = PredecodePackets(*packets);
+
         for (uint32_t i = 0; i < packets->size(); ++i)
         {
             const UdpReaderThread::ReceivedPacket& packet = (*packets)[i];
@@ -222,112 +233,78 @@ namespace AzNetworking
                 continue;
             }
 
-            int32_t decodedPacketSize = 0;
-            m_decryptBuffer.Resize(m_decryptBuffer.GetCapacity());
-            const uint8_t* decodedPacketData = connection->GetDtlsEndpoint().DecodePacket(*connection, packet.m_buffer, packet.m_receivedBytes, m_decryptBuffer.GetBuffer(), decodedPacketSize);
-            m_decryptBuffer.Resize(decodedPacketSize);
-
-            if (decodedPacketSize == 0)
+            DecodedPacket decodedPacket;
+            DecodeResult decodeResult = DecodeResult::Consumed;
+            if (predecoded && (m_predecodedPackets[i].m_connection == connection))
             {
-                // OpenSSL may have consumed packets during handshake negotiation
-                continue;
+                decodedPacket = m_predecodedPackets[i].m_packet;
+                decodeResult = m_predecodedPackets[i].m_result;
+            }
+            else
+            {
+                decodeResult = DecodeReceivedPacket(*connection, packet, m_decryptBuffer, m_decompressBuffer, decodedPacket);
             }
-            else if (decodedPacketSize < 0)
+
+            if (decodeResult == DecodeResult::Consumed)
             {
-                // Late unencrypted handshake packets or just random garbage can show up, discard and continue
+                // OpenSSL may have consumed packets during handshake negotiation
+                // Late unencrypted handshake packets or just random garbage can show up too, discard and continue
                 continue;
             }
 
             connection->GetMetrics().LogPacketRecv(packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs);
 
-            // Decode the packet flag bitset first since it's always uncompressed
-            UdpPacketHeader header;
+            if (decodeResult == DecodeResult::InvalidFlags)
             {
-                NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
-                if (!header.SerializePacketFlags(flagSerializer))
-                {
-                    continue;
-                }
-                // Adjust decoded tracking to represent the payload now that we've grabbed the flags
-                decodedPacketData = flagSerializer.GetUnreadData();
-                decodedPacketSize = flagSerializer.GetUnreadSize();
-                GetMetrics().m_recvBytesUncompressed += flagSerializer.GetReadSize();
+                continue;
             }
+            GetMetrics().m_recvBytesUncompressed += decodedPacket.m_flagsSize;
 
-            if (m_compressor && header.IsPacketFlagSet(PacketFlag::Compressed))
+            if (decodeResult == DecodeResult::DecompressFailed)
             {
-                // Only the payload is compressed
-                if (!DecompressPacket(decodedPacketData, decodedPacketSize, m_decompressBuffer))
-                {
-                    AZLOG_WARN("Failed to decompress packet!");
-                    continue;
-                }
-                decodedPacketData = m_decompressBuffer.GetBuffer();
-                decodedPacketSize = static_cast<int32_t>(m_decompressBuffer.GetSize());
+                AZLOG_WARN("Failed to decompress packet!");
+                continue;
             }
-            GetMetrics().m_recvBytesUncompressed += decodedPacketSize;
 
-            TimeoutQueue::TimeoutItem* timeoutItem = m_connectionTimeoutQueue.RetrieveItem(connection->GetTimeoutId());
-            if (timeoutItem == nullptr)
+            if (!decodedPacket.m_header.IsPacketFlagSet(PacketFlag::Coalesced))
             {
-                connection->Disconnect(DisconnectReason::Unknown, TerminationEndpoint::Local);
+                GetMetrics().m_recvBytesUncompressed += decodedPacket.m_size;
+                ProcessDecodedPacket(*connection, decodedPacket, packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs, startTimeMs);
                 continue;
             }
-            else
-            {
-                // Deserialize the packet header
-                NetworkOutputSerializer packetSerializer(decodedPacketData, decodedPacketSize);
-                ISerializer& serializer = packetSerializer; // To get the default typeinfo parameters in ISerializer
-                if (!serializer.Serialize(header, "Header"))
-                {
-                    continue;
-                }
 
-                // Note that the serializer passed in here is unused for UDP
-                if (!connection->ProcessReceived(header, packetSerializer, packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs))
+            // Coalesced datagrams hold several encoded packets, each prefixed by its size
+            const uint8_t* coalescedData = decodedPacket.m_data;
+            uint32_t coalescedSize = aznumeric_cast<uint32_t>(decodedPacket.m_size);
+            while ((coalescedSize >= CoalescedPacketSizePrefix) && (connection->GetConnectionState() != ConnectionState::Disconnecting))
+            {
+                const uint32_t subPacketSize = (aznumeric_cast<uint32_t>(coalescedData[0]) << 8) | aznumeric_cast<uint32_t>(coalescedData[1]);
+                coalescedData += CoalescedPacketSizePrefix;
+                coalescedSize -= CoalescedPacketSizePrefix;
+                if (subPacketSize > coalescedSize)
                 {
-                    continue;
+                    AZLOG_WARN("Discarding truncated coalesced packet");
+                    break;
                 }
 
-                timeoutItem->UpdateTimeoutTime(startTimeMs);
-                connection->m_timeoutCounter = 0;
+                DecodedPacket subPacket;
+                const DecodeResult subPacketResult = DecodePacketPayload(coalescedData, aznumeric_cast<int32_t>(subPacketSize), m_decompressBuffer, subPacket);
+                coalescedData += subPacketSize;
+                coalescedSize -= subPacketSize;
 
-                PacketDispatchResult handledPacket = PacketDispatchResult::Failure;
-                if (header.GetPacketType() < aznumeric_cast<PacketType>(CorePackets::PacketType::MAX))
+                if ((subPacketResult == DecodeResult::InvalidFlags) || subPacket.m_header.IsPacketFlagSet(PacketFlag::Coalesced))
                 {
-                    handledPacket = connection->HandleCorePacket(m_connectionListener, header, packetSerializer);
-                }
-                else
-                {
-                    handledPacket = m_connectionListener.OnPacketReceived(connection, header, packetSerializer);
-                }
-
-                if (handledPacket == PacketDispatchResult::Success)
-                {
-                    connection->UpdateHeartbeat(currentTimeMs);
-                    if (connection->GetConnectionState() == ConnectionState::Connecting && !connection->GetDtlsEndpoint().IsConnecting())
-                    {
-                        // Connection is realized once a packet is received and socket handshake is verified complete
-                        connection->m_state = ConnectionState::Connected;
-                    }
-                }
-                else if (m_socket->IsEncrypted() && connection->GetDtlsEndpoint().IsConnecting() &&
-                    !IsHandshakePacket(connection->GetDtlsEndpoint(), header.GetPacketType()))
-                {
-                    // It's possible for one side to finish its half of the encryption handshake and start sending encrypted data
-                    // This will appear as a SerializationError due to the incomplete encryption handshake
-                    // If it's not an expected unencrypted type then skip it for now
                     continue;
                 }
-                else if (handledPacket == PacketDispatchResult::Skipped)
+                GetMetrics().m_recvBytesUncompressed += subPacket.m_flagsSize;
+
+                if (subPacketResult == DecodeResult::DecompressFailed)
                 {
-                    // If the result is marked as skipped then do so (i.e. if a handshake is not yet complete)
+                    AZLOG_WARN("Failed to decompress packet!");
                     continue;
                 }
-                else if (connection->GetConnectionState() != ConnectionState::Disconnecting)
-                {
-                    connection->Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
-                }
+                GetMetrics().m_recvBytesUncompressed += subPacket.m_size;
+                ProcessDecodedPacket(*connection, subPacket, subPacketSize + CoalescedPacketSizePrefix, currentTimeMs, startTimeMs);
             }
         }
         const AZ::TimeMs receiveTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
@@ -342,15 +319,24 @@ namespace AzNetworking
         for (RemovedConnection& removedConnection : m_removedConnections)
         {
             m_connectionListener.OnDisconnect(removedConnection.m_connection, removedConnection.m_reason, removedConnection.m_endpoint);
+            {
+                // Send anything still held back for coalescing, like the termination packet, before the connection goes away
+                AZStd::lock_guard lock(removedConnection.m_connection->m_sendPacketMutex);
+                FlushCoalescedPackets(*removedConnection.m_connection);
+            }
             m_connectionSet.DeleteConnection(removedConnection.m_connection->GetConnectionId()); // Will delete the connection
         }
         m_removedConnections.clear();
 
+        FlushSendBatch();
+
         // Update metrics
         GetMetrics().m_sendPackets = m_socket->GetSentPackets();
         GetMetrics().m_sendBytes = m_socket->GetSentBytes();
         GetMetrics().m_sendPacketsEncrypted = m_socket->GetSentPacketsEncrypted();
         GetMetrics().m_sendBytesEncryptionInflation = m_socket->GetSentBytesEncryptionInflation();
+        GetMetrics().m_packetBufferAllocations = m_packetBufferPool.GetAllocatedBufferCount();
+        GetMetrics().m_packetBufferReuses = m_packetBufferPool.GetReusedBufferCount();
         GetMetrics().m_recvTimeMs += receiveTimeMs;
         GetMetrics().m_recvPackets = m_socket->GetRecvPackets();
         GetMetrics().m_recvBytes = m_socket->GetRecvBytes();
@@ -358,6 +344,23 @@ namespace AzNetworking
         GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
 
+    void UdpNetworkInterface::BeginSendBatch()
+    {
+        m_socket->BeginSendBatch();
+    }
+
+    void UdpNetworkInterface::FlushSendBatch()
+    {
+        // Packets held back for coalescing have to go out with the rest of the batch
+        m_connectionSet.VisitConnections([this](IConnection& connection)
+        {
+            UdpConnection& udpConnection = static_cast<UdpConnection&>(connection);
+            AZStd::lock_guard lock(udpConnection.m_sendPacketMutex);
+            FlushCoalescedPackets(udpConnection);
+        });
+        m_socket->FlushSendBatch();
+    }
+
     bool UdpNetworkInterface::SendReliablePacket(ConnectionId connectionId, const IPacket& packet)
     {
         IConnection* connection = m_connectionSet.GetConnection(connectionId);
@@ -441,6 +444,271 @@ namespace AzNetworking
         m_packetTimeoutQueue.RegisterItem(ConstructTimeoutId(connectionId, packetId, reliability), packetTimeoutMs);
     }
 
+    void UdpNetworkInterface::ProcessDecodedPacket(UdpConnection& connection, DecodedPacket& decodedPacket, uint32_t packetSize, AZ::TimeMs currentTimeMs, AZ::TimeMs startTimeMs)
+    {
+        UdpPacketHeader& header = decodedPacket.m_header;
+
+        TimeoutQueue::TimeoutItem* timeoutItem = m_connectionTimeoutQueue.RetrieveItem(connection.GetTimeoutId());
+        if (timeoutItem == nullptr)
+        {
+            connection.Disconnect(DisconnectReason::Unknown, TerminationEndpoint::Local);
+            return;
+        }
+
+        // Deserialize the packet header
+        NetworkOutputSerializer packetSerializer(decodedPacket.m_data, decodedPacket.m_size);
+        ISerializer& serializer = packetSerializer; // To get the default typeinfo parameters in ISerializer
+        if (!serializer.Serialize(header, "Header"))
+        {
+            return;
+        }
+
+        // Note that the serializer passed in here is unused for UDP
+        if (!connection.ProcessReceived(header, packetSerializer, packetSize, currentTimeMs))
+        {
+            return;
+        }
+
+        timeoutItem->UpdateTimeoutTime(startTimeMs);
+        connection.m_timeoutCounter = 0;
+
+        PacketDispatchResult handledPacket = PacketDispatchResult::Failure;
+        if (header.GetPacketType() < aznumeric_cast<PacketType>(CorePackets::PacketType::MAX))
+        {
+            handledPacket = connection.HandleCorePacket(m_connectionListener, header, packetSerializer);
+        }
+        else
+        {
+            handledPacket = m_connectionListener.OnPacketReceived(&connection, header, packetSerializer);
+        }
+
+        if (handledPacket == PacketDispatchResult::Success)
+        {
+            connection.UpdateHeartbeat(currentTimeMs);
+            if (connection.GetConnectionState() == ConnectionState::Connecting && !connection.GetDtlsEndpoint().IsConnecting())
+            {
+                // Connection is realized once a packet is received and socket handshake is verified complete
+                connection.m_state = ConnectionState::Connected;
+            }
+        }
+        else if (m_socket->IsEncrypted() && connection.GetDtlsEndpoint().IsConnecting() &&
+            !IsHandshakePacket(connection.GetDtlsEndpoint(), header.GetPacketType()))
+        {
+            // It's possible for one side to finish its half of the encryption handshake and start sending encrypted data
+            // This will appear as a SerializationError due to the incomplete encryption handshake
+            // If it's not an expected unencrypted type then skip it for now
+            return;
+        }
+        else if (handledPacket == PacketDispatchResult::Skipped)
+        {
+            // If the result is marked as skipped then do so (i.e. if a handshake is not yet complete)
+            return;
+        }
+        else if (connection.GetConnectionState() != ConnectionState::Disconnecting)
+        {
+            connection.Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
+        }
+    }
+
+    UdpNetworkInterface::DecodeResult UdpNetworkInterface::DecodeReceivedPacket(UdpConnection& connection, const UdpReaderThread::ReceivedPacket& packet,
+        UdpPacketEncodingBuffer& decryptBuffer, UdpPacketEncodingBuffer& decompressBuffer, DecodedPacket& outPacket) const
+    {
+        int32_t decodedPacketSize = 0;
+        decryptBuffer.Resize(decryptBuffer.GetCapacity());
+        const uint8_t* decodedPacketData = connection.GetDtlsEndpoint().DecodePacket(connection, packet.m_buffer, packet.m_receivedBytes, decryptBuffer.GetBuffer(), decodedPacketSize);
+        decryptBuffer.Resize(AZStd::max(decodedPacketSize, 0));
+
+        if (decodedPacketSize <= 0)
+        {
+            return DecodeResult::Consumed;
+        }
+
+        return DecodePacketPayload(decodedPacketData, decodedPacketSize, decompressBuffer, outPacket);
+    }
+
+    UdpNetworkInterface::DecodeResult UdpNetworkInterface::DecodePacketPayload(const uint8_t* decodedPacketData, int32_t decodedPacketSize,
+        UdpPacketEncodingBuffer& decompressBuffer, DecodedPacket& outPacket) const
+    {
+        // Decode the packet flag bitset first since it's always uncompressed
+        {
+            NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
+            if (!outPacket.m_header.SerializePacketFlags(flagSerializer))
+            {
+                return DecodeResult::InvalidFlags;
+            }
+            // Adjust decoded tracking to represent the payload now that we've grabbed the flags
+            decodedPacketData = flagSerializer.GetUnreadData();
+            decodedPacketSize = flagSerializer.GetUnreadSize();
+            outPacket.m_flagsSize = flagSerializer.GetReadSize();
+        }
+
+        // The packets held by a coalesced datagram are compressed individually
+        if (m_compressor && outPacket.m_header.IsPacketFlagSet(PacketFlag::Compressed) && !outPacket.m_header.IsPacketFlagSet(PacketFlag::Coalesced))
+        {
+            // Only the payload is compressed
+            if (!DecompressPacket(decodedPacketData, decodedPacketSize, decompressBuffer))
+            {
+                return DecodeResult::DecompressFailed;
+            }
+            decodedPacketData = decompressBuffer.GetBuffer();
+            decodedPacketSize = static_cast<int32_t>(decompressBuffer.GetSize());
+        }
+
+        outPacket.m_data = decodedPacketData;
+        outPacket.m_size = decodedPacketSize;
+        return DecodeResult::Success;
+    }
+
+    bool UdpNetworkInterface::PredecodePackets(const UdpReaderThread::ReceivedPackets& packets)
+    {
+        const uint32_t shardCount = net_UdpDecodeShardCount;
+        if ((shardCount < 2) || (packets.size() < net_UdpDecodeShardMinPackets) || (AZ::JobContext::GetGlobalContext() == nullptr))
+        {
+            return false;
+        }
+
+        if (m_decodeShards.size() < shardCount)
+        {
+            m_decodeShards.reserve(shardCount);
+            while (m_decodeShards.size() < shardCount)
+            {
+                m_decodeShards.emplace_back(AZStd::make_unique<DecodeShard>());
+            }
+        }
+
+        for (AZStd::unique_ptr<DecodeShard>& shard : m_decodeShards)
+        {
+            shard->m_packetIndices.clear();
+            shard->m_payloads.clear();
+        }
+
+        // Only established connections are decoded ahead of time, anything that could still change the state of a connection
+        // during this update, like a handshake or a new connection, is left for the main processing loop
+        m_predecodedPackets.clear();
+        m_predecodedPackets.resize(packets.size());
+        for (uint32_t i = 0; i < packets.size(); ++i)
+        {
+            const UdpReaderThread::ReceivedPacket& packet = packets[i];
+            UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
+            if ((connection == nullptr) || (packet.m_receivedBytes <= 0) || (connection->GetConnectionState() != ConnectionState::Connected)
+                || connection->GetDtlsEndpoint().IsConnecting())
+            {
+                continue;
+            }
+
+            m_predecodedPackets[i].m_connection = connection;
+            const uint32_t shardIndex = aznumeric_cast<uint32_t>(connection->GetConnectionId()) % shardCount;
+            m_decodeShards[shardIndex]->m_packetIndices.push_back(i);
+        }
+
+        AZ::JobCompletion jobCompletion;
+        for (uint32_t shardIndex = 0; shardIndex < shardCount; ++shardIndex)
+        {
+            DecodeShard* shard = m_decodeShards[shardIndex].get();
+            if (shard->m_packetIndices.empty())
+            {
+                continue;
+            }
+
+            AZ::Job* job = AZ::CreateJobFunction([this, &packets, shard]()
+                {
+                    for (uint32_t packetIndex : shard->m_packetIndices)
+                    {
+                        PredecodedPacket& predecodedPacket = m_predecodedPackets[packetIndex];
+                        predecodedPacket.m_result = DecodeReceivedPacket(*predecodedPacket.m_connection, packets[packetIndex],
+                            shard->m_decryptBuffer, shard->m_decompressBuffer, predecodedPacket.m_packet);
+                        if (predecodedPacket.m_result == DecodeResult::Success)
+                        {
+                            // The scratch buffers are reused by the next packet, so keep a copy of the payload
+                            const uint8_t* payload = predecodedPacket.m_packet.m_data;
+                            predecodedPacket.m_payloadOffset = aznumeric_cast<uint32_t>(shard->m_payloads.size());
+                            shard->m_payloads.insert(shard->m_payloads.end(), payload, payload + predecodedPacket.m_packet.m_size);
+                        }
+                    }
+                }, true /*auto delete*/, nullptr);
+
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+
+        // The payload buffers have stopped growing, so the decoded packets can now point into them
+        for (uint32_t shardIndex = 0; shardIndex < shardCount; ++shardIndex)
+        {
+            DecodeShard* shard = m_decodeShards[shardIndex].get();
+            for (uint32_t packetIndex : shard->m_packetIndices)
+            {
+                PredecodedPacket& predecodedPacket = m_predecodedPackets[packetIndex];
+                if (predecodedPacket.m_result == DecodeResult::Success)
+                {
+                    predecodedPacket.m_packet.m_data = shard->m_payloads.data() + predecodedPacket.m_payloadOffset;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    bool UdpNetworkInterface::CoalescePacket(UdpConnection& connection, const uint8_t* packetData, uint32_t packetSize)
+    {
+        UdpConnection::CoalescedPacketBuffer& coalescedPackets = connection.m_coalescedPackets;
+        const uint32_t maxDatagramSize = AZStd::min<uint32_t>(connection.GetConnectionMtu() - net_SslInflationOverhead, aznumeric_cast<uint32_t>(coalescedPackets.GetCapacity()));
+        const uint32_t coalescedPacketSize = CoalescedPacketSizePrefix + packetSize;
+        if ((coalescedPacketSize > net_UdpCoalesceMaxPacketSize) || (CoalescedPacketFlagsSize + coalescedPacketSize > maxDatagramSize))
+        {
+            return false;
+        }
+
+        if (coalescedPackets.GetSize() + coalescedPacketSize > maxDatagramSize)
+        {
+            FlushCoalescedPackets(connection);
+        }
+
+        if (coalescedPackets.GetSize() == 0)
+        {
+            UdpPacketHeader header;
+            header.SetPacketFlag(PacketFlag::Coalesced, true);
+
+            coalescedPackets.Resize(coalescedPackets.GetCapacity());
+            NetworkInputSerializer flagSerializer(coalescedPackets.GetBuffer(), static_cast<uint32_t>(coalescedPackets.GetCapacity()));
+            if (!header.SerializePacketFlags(flagSerializer))
+            {
+                coalescedPackets.Resize(0);
+                return false;
+            }
+            AZ_Assert(flagSerializer.GetSize() == CoalescedPacketFlagsSize, "Flag bitfield should serialize to one byte");
+            coalescedPackets.Resize(flagSerializer.GetSize());
+        }
+
+        uint8_t* coalescedPacket = coalescedPackets.GetBufferEnd();
+        coalescedPackets.Resize(coalescedPackets.GetSize() + coalescedPacketSize);
+        coalescedPacket[0] = aznumeric_cast<uint8_t>(packetSize >> 8);
+        coalescedPacket[1] = aznumeric_cast<uint8_t>(packetSize & 0xFF);
+        memcpy(coalescedPacket + CoalescedPacketSizePrefix, packetData, packetSize);
+        return true;
+    }
+
+    void UdpNetworkInterface::FlushCoalescedPackets(UdpConnection& connection)
+    {
+        UdpConnection::CoalescedPacketBuffer& coalescedPackets = connection.m_coalescedPackets;
+        if (coalescedPackets.GetSize() == 0)
+        {
+            return;
+        }
+
+        // The packets have already been registered for timeouts, so a failed send is handled like any other lost packet
+        if (!m_socket->Send(connection.GetRemoteAddress(), coalescedPackets.GetBuffer(), aznumeric_cast<uint32_t>(coalescedPackets.GetSize()),
+            true, connection.GetDtlsEndpoint(), connection.GetConnectionQuality()))
+        {
+            AZLOG_ERROR("Coalesced packets failed to send on the socket");
+        }
+        else
+        {
+            GetMetrics().m_sendBytesUncompressed += CoalescedPacketFlagsSize + UdpPacketHeaderSize + DtlsPacketHeaderSize;
+        }
+        coalescedPackets.Resize(0);
+    }
+
     bool UdpNetworkInterface::DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const
     {
         if (!m_compressor) // should probably have some compression handshake than relying on existence of compressor
@@ -472,12 +740,22 @@ namespace AzNetworking
 
     PacketId UdpNetworkInterface::SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence)
     {
-        AZLOG(NET_DebugPacketSend, "Sending packet type %u to remote address %s", aznumeric_cast<uint32_t>(packet.GetPacketType()), connection.GetRemoteAddress().GetString().c_str());
+        return SendPacketInternal(connection, packet.GetPacketType(), &packet, nullptr, reliableSequence);
+    }
+
+    PacketId UdpNetworkInterface::ResendPacket(UdpConnection& connection, PacketType packetType, const PacketBufferPtr& payload, SequenceId reliableSequence)
+    {
+        return SendPacketInternal(connection, packetType, nullptr, payload, reliableSequence);
+    }
+
+    PacketId UdpNetworkInterface::SendPacketInternal(UdpConnection& connection, PacketType packetType, const IPacket* packet, PacketBufferPtr payload, SequenceId reliableSequence)
+    {
+        AZLOG(NET_DebugPacketSend, "Sending packet type %u to remote address %s", aznumeric_cast<uint32_t>(packetType), connection.GetRemoteAddress().GetString().c_str());
 
         // The ordering inside this function is incredibly important and fragile
         const IpAddress& address = connection.GetRemoteAddress();
         // We don't want to compress the initial InitiateConnectionPacket, ConnectionHandshakePackets or FragmentedPackets of those two
-        const bool shouldCompress = packet.GetPacketType() != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket);
+        const bool shouldCompress = packetType != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket);
 
         if (address.GetAddress(ByteOrder::Host) == 0)
         {
@@ -489,33 +767,11 @@ namespace AzNetworking
         // Check if we need to fragment this packet first
         // We don't ack aggregate packets that get fragmented, so we want to get this chunk out of the way before
         // we start throwing PacketId's and SequenceId's into our other tracking data structures below
-        UdpPacketHeader header(connection.GetPacketTracker(), packet.GetPacketType(), reliableSequence);
+        UdpPacketHeader header(connection.GetPacketTracker(), packetType, reliableSequence);
         const PacketId localPacketId = header.GetPacketId();
 
-        // If it's a reliable packet, make sure our reliable queue knows about it now because we might need to drop it if our connection is
-        // not set up
-        if (reliabilityType == ReliabilityType::Reliable)
-        {
-            if (!connection.PrepareReliablePacketForSend(localPacketId, reliableSequence, packet))
-            {
-                connection.Disconnect(DisconnectReason::ReliableQueueFull, TerminationEndpoint::Local);
-            }
-        }
-
-        // If we're still connecting, only transmit packets related to establishing connection and queue the rest for later
-        // This implicitly enforces that the only FragmentedPackets sent here are of ConnectionHandshakePacket
-        // Other large packets are simply queued before they are fragmented
-        if (connection.GetDtlsEndpoint().IsConnecting() && !IsHandshakePacket(connection.GetDtlsEndpoint(), packet.GetPacketType()))
-        {
-            // IMPORTANT that we register with the timeout queue here, otherwise we don't have the timer to pop for reliable packets
-            RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
-            AZLOG(
-                NET_DebugDtls, "Connection is still in handshake negotiation, blocking packet send for packet type %d",
-                (int)packet.GetPacketType());
-            return localPacketId;
-        }
-
         UdpPacketEncodingBuffer buffer;
+        uint32_t payloadOffset = 0;
         {
             buffer.Resize(buffer.GetCapacity());
 
@@ -533,15 +789,58 @@ namespace AzNetworking
                 AZLOG_ERROR("PacketId %u failed header serialization and will not be sent", aznumeric_cast<uint32_t>(localPacketId));
                 return InvalidPacketId;
             }
+            payloadOffset = serializer.GetSize();
 
-            if (!serializer.Serialize(const_cast<IPacket&>(packet), "Payload"))
+            if (packet != nullptr)
             {
-                AZLOG_ERROR("PacketId %u failed payload serialization and will not be sent", aznumeric_cast<uint32_t>(localPacketId));
-                return InvalidPacketId;
+                if (!serializer.Serialize(const_cast<IPacket&>(*packet), "Payload"))
+                {
+                    AZLOG_ERROR("PacketId %u failed payload serialization and will not be sent", aznumeric_cast<uint32_t>(localPacketId));
+                    return InvalidPacketId;
+                }
+                buffer.Resize(serializer.GetSize());
+            }
+            else
+            {
+                // Resent packets reuse the payload that was serialized when the packet was first sent
+                if (!buffer.Resize(payloadOffset + payload->GetSize()))
+                {
+                    AZLOG_ERROR("PacketId %u failed payload serialization and will not be sent", aznumeric_cast<uint32_t>(localPacketId));
+                    return InvalidPacketId;
+                }
+                memcpy(buffer.GetBuffer() + payloadOffset, payload->GetBuffer(), payload->GetSize());
+            }
+        }
+
+        // If it's a reliable packet, make sure our reliable queue knows about it now because we might need to drop it if our connection is
+        // not set up
+        if (reliabilityType == ReliabilityType::Reliable)
+        {
+            if (payload == nullptr)
+            {
+                // Keep the serialized payload around for resends instead of a copy of the packet
+                payload = m_packetBufferPool.Acquire(buffer.GetBuffer() + payloadOffset, aznumeric_cast<uint32_t>(buffer.GetSize()) - payloadOffset);
             }
 
-            buffer.Resize(serializer.GetSize());
+            if (!connection.PrepareReliablePacketForSend(localPacketId, reliableSequence, packetType, payload))
+            {
+                connection.Disconnect(DisconnectReason::ReliableQueueFull, TerminationEndpoint::Local);
+            }
+        }
+
+        // If we're still connecting, only transmit packets related to establishing connection and queue the rest for later
+        // This implicitly enforces that the only FragmentedPackets sent here are of ConnectionHandshakePacket
+        // Other large packets are simply queued before they are fragmented
+        if (connection.GetDtlsEndpoint().IsConnecting() && !IsHandshakePacket(connection.GetDtlsEndpoint(), packetType))
+        {
+            // IMPORTANT that we register with the timeout queue here, otherwise we don't have the timer to pop for reliable packets
+            RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
+            AZLOG(
+                NET_DebugDtls, "Connection is still in handshake negotiation, blocking packet send for packet type %d",
+                (int)packetType);
+            return localPacketId;
         }
+
         uint32_t packetSize = static_cast<uint32_t>(buffer.GetSize());
         uint8_t* packetData = buffer.GetBuffer();
 
@@ -620,13 +919,23 @@ namespace AzNetworking
             aznumeric_cast<uint32_t>(header.GetSequenceWindow())
         );
 
-        AZLOG(NET_DebugDtls, "Connection is sending packet type %d", aznumeric_cast<int32_t>(packet.GetPacketType()));
+        AZLOG(NET_DebugDtls, "Connection is sending packet type %d", aznumeric_cast<int32_t>(packetType));
         // If we're not connected then we're still handshaking and require packets to be unencrypted
-        const bool shouldEncrypt = !IsHandshakePacket(connection.GetDtlsEndpoint(), packet.GetPacketType());
+        const bool shouldEncrypt = !IsHandshakePacket(connection.GetDtlsEndpoint(), packetType);
+        if (shouldEncrypt && connection.m_coalescePackets && m_socket->IsSendBatchActive() && CoalescePacket(connection, packetData, packetSize))
+        {
+            RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
+            connection.ProcessSent(localPacketId, packetType, packetSize + CoalescedPacketSizePrefix, reliabilityType);
+            GetMetrics().m_sendBytesUncompressed += buffer.GetSize() + CoalescedPacketSizePrefix;
+            return localPacketId;
+        }
+
+        // Anything already coalesced for this connection has to go out first to preserve the send order
+        FlushCoalescedPackets(connection);
         if (m_socket->Send(address, packetData, packetSize, shouldEncrypt, connection.GetDtlsEndpoint(), connection.GetConnectionQuality()))
         {
             RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
-            connection.ProcessSent(localPacketId, packet, packetSize + UdpPacketHeaderSize, reliabilityType);
+            connection.ProcessSent(localPacketId, packetType, packetSize + UdpPacketHeaderSize, reliabilityType);
             GetMetrics().m_sendBytesUncompressed += buffer.GetSize() + UdpPacketHeaderSize + (shouldEncrypt ? DtlsPacketHeaderSize : 0);
             return localPacketId;
         }
@@ -677,6 +986,15 @@ namespace AzNetworking
                 }
             }
 
+            // Compressed packets can only be read if both endpoints compress with the same dictionary
+            const uint32_t dictionaryId = m_compressor ? m_compressor->GetDictionaryId() : 0;
+            if (packet.GetCompressorDictionaryId() != dictionaryId)
+            {
+                AZLOG_WARN("Rejecting connection from %s, compressor dictionary %08x does not match local dictionary %08x",
+                    connectPacket.m_address.GetString().c_str(), packet.GetCompressorDictionaryId(), dictionaryId);
+                return;
+            }
+
             // Retrieve the connection type, and run application layer connection filtering (state checks, CIDR address filtering, etc..)
             const ConnectResult connectResult = m_connectionListener.ValidateConnect(connectPacket.m_address, header, networkSerializer);
 
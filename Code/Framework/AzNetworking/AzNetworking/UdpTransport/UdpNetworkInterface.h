@@ -15,9 +15,11 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/ConnectionEnums.h>
 #include <AzNetworking/Framework/INetworkInterface.h>
+#include <AzNetworking/DataStructures/PacketBufferPool.h>
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzCore/Threading/ThreadSafeDeque.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace AzNetworking
 {
@@ -26,6 +28,8 @@ namespace AzNetworking
 
     static const uint32_t UdpPacketHeaderSize = 20 + 8; //!< 20 byte IPv4 header + 8 byte UDP header
     static const uint32_t DtlsPacketHeaderSize = 13; //!< DTLS1_RT_HEADER_LENGTH
+    static const uint32_t CoalescedPacketFlagsSize = 1; //!< The packet flags leading a coalesced datagram
+    static const uint32_t CoalescedPacketSizePrefix = 2; //!< The big endian size in front of each packet in a coalesced datagram
 
     //! @class UdpNetworkInterface
     //! @brief This class implements a UDP network interface.
@@ -79,12 +83,30 @@ namespace AzNetworking
     //! O3DE could potentially move from over MTU to under with compression, and the UDP interface doesn't check for this. Detecting a change
     //! that would reduce the number of fragmented packets would require pre-emptively compressing payloads to tell if that change happened,
     //! which could potentially lead to a lot of unnecessary calls to the compressor.
-    //! 
+    //!
+    //! Compressors that use a pre-trained dictionary report its id through ICompressor::GetDictionaryId. The connecting endpoint
+    //! sends its dictionary id in the uncompressed InitiateConnectionPacket, and the accepting endpoint rejects the connection
+    //! if it doesn't match its own, since neither side would be able to read the other's compressed packets.
+    //!
     //! ### Encryption
     //! 
     //! AzNetworking uses the [OpenSSL](https://www.openssl.org/) library to implement Datagram Layer Transport Security (DTLS) encryption
     //! on UDP traffic. Encryption operates as described in [O3DE Networking Encryption](http://o3de.org/docs/user-guide/networking/encryption)
     //! on the documentation website. Once both endpoints have completed their handshake, all traffic is expected to be fully encrypted.
+    //! 
+    //! ### Coalescing
+    //! 
+    //! Connections with packet coalescing enabled (see net_UdpCoalescePackets and UdpConnection::SetCoalescePackets) hold back small
+    //! encrypted packets sent while a send batch is active, and pack them into a single datagram flushed when the batch ends or
+    //! the datagram reaches the connection MTU. Every packet keeps its own header, so acks, reliability and timeouts are unaffected,
+    //! but the per-datagram IP, UDP and DTLS overhead is only paid once. Coalesced datagrams are marked by PacketFlag::Coalesced.
+    //! 
+    //! ### Parallel decoding
+    //! 
+    //! When net_UdpDecodeShardCount is greater than one and an update receives at least net_UdpDecodeShardMinPackets packets, the
+    //! decryption and decompression of packets on established connections are spread across job threads, with each connection
+    //! assigned to a single shard. Acks, fragment reassembly and packet dispatch still run on the thread calling Update, in the
+    //! order the packets were received. The compressor must support concurrent calls to Decompress for this to be enabled.
     class UdpNetworkInterface final
         : public INetworkInterface
     {
@@ -109,6 +131,8 @@ namespace AzNetworking
         bool Listen(uint16_t port) override;
         ConnectionId Connect(const IpAddress& remoteAddress, uint16_t localPort = 0) override;
         void Update() override;
+        void BeginSendBatch() override;
+        void FlushSendBatch() override;
         bool SendReliablePacket(ConnectionId connectionId, const IPacket& packet) override;
         PacketId SendUnreliablePacket(ConnectionId connectionId, const IPacket& packet) override;
         bool WasPacketAcked(ConnectionId connectionId, PacketId packetId) override;
@@ -138,6 +162,69 @@ namespace AzNetworking
         //! @return boolean true on success, false on failure
         bool DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const;
 
+        //! Result of decoding a received datagram.
+        enum class DecodeResult
+        {
+            Success,
+            Consumed,        //!< Data was consumed by the encryption handshake, or could not be decrypted
+            InvalidFlags,
+            DecompressFailed
+        };
+
+        //! A received datagram that has been decrypted, had its packet flags read and its payload decompressed.
+        struct DecodedPacket
+        {
+            UdpPacketHeader m_header; //!< Only the packet flags have been read at this point
+            const uint8_t* m_data = nullptr;
+            int32_t m_size = 0;
+            uint32_t m_flagsSize = 0;
+        };
+
+        //! Decrypts a received datagram, reads its packet flags and decompresses its payload.
+        //! @param connection       the connection the datagram was received on
+        //! @param packet           the received datagram
+        //! @param decryptBuffer    scratch buffer to decrypt into
+        //! @param decompressBuffer scratch buffer to decompress into
+        //! @param outPacket        the decoded packet, which may point into either of the scratch buffers
+        //! @return the result of decoding the datagram
+        DecodeResult DecodeReceivedPacket(UdpConnection& connection, const UdpReaderThread::ReceivedPacket& packet,
+            UdpPacketEncodingBuffer& decryptBuffer, UdpPacketEncodingBuffer& decompressBuffer, DecodedPacket& outPacket) const;
+
+        //! Reads the packet flags of a decrypted datagram and decompresses its payload.
+        //! @param decodedPacketData the decrypted datagram
+        //! @param decodedPacketSize the size of the decrypted datagram
+        //! @param decompressBuffer  scratch buffer to decompress into
+        //! @param outPacket         the decoded packet, which may point into the scratch buffer
+        //! @return the result of decoding the datagram
+        DecodeResult DecodePacketPayload(const uint8_t* decodedPacketData, int32_t decodedPacketSize,
+            UdpPacketEncodingBuffer& decompressBuffer, DecodedPacket& outPacket) const;
+
+        //! Deserializes the header of a decoded packet, processes its acks and dispatches it.
+        //! @param connection    the connection the packet was received on
+        //! @param decodedPacket the decoded packet
+        //! @param packetSize    the size of the packet on the wire in bytes
+        //! @param currentTimeMs current wall clock time in milliseconds
+        //! @param startTimeMs   the time the current update started processing received packets
+        void ProcessDecodedPacket(UdpConnection& connection, DecodedPacket& decodedPacket, uint32_t packetSize, AZ::TimeMs currentTimeMs, AZ::TimeMs startTimeMs);
+
+        //! Holds back an encoded packet to share a datagram with other small packets sent to the same connection.
+        //! @param connection the connection the packet is sent on
+        //! @param packetData the encoded packet
+        //! @param packetSize the size of the encoded packet
+        //! @return boolean true if the packet was coalesced, false if it is too large and must be sent on its own
+        bool CoalescePacket(UdpConnection& connection, const uint8_t* packetData, uint32_t packetSize);
+
+        //! Sends the packets held back for coalescing on a connection, the caller must hold the connection's send lock.
+        //! @param connection the connection to flush
+        void FlushCoalescedPackets(UdpConnection& connection);
+
+        //! Decodes the received packets of established connections on job threads ahead of the main processing loop.
+        //! Connections are split into net_UdpDecodeShardCount shards, and every packet of a connection is decoded in order by the
+        //! job of its shard, so the encryption state of a connection is only ever touched by one thread at a time.
+        //! @param packets the packets received by the reader thread for this update
+        //! @return boolean true if the packets were decoded, false if the update is too small to be worth spreading across threads
+        bool PredecodePackets(const UdpReaderThread::ReceivedPackets& packets);
+
         //! Sends a packet to the remote connection.
         //! @param connection         the UdpConnection instance to send the packet on
         //! @param packet             serializable object to transmit
@@ -145,6 +232,17 @@ namespace AzNetworking
         //! @return packet id for the transmitted packet
         PacketId SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence);
 
+        //! Resends a reliable packet to the remote connection from its previously serialized payload.
+        //! @param connection       the UdpConnection instance to send the packet on
+        //! @param packetType       type of the packet to resend
+        //! @param payload          the serialized payload of the packet
+        //! @param reliableSequence the reliable sequence number of the packet
+        //! @return packet id for the transmitted packet
+        PacketId ResendPacket(UdpConnection& connection, PacketType packetType, const PacketBufferPtr& payload, SequenceId reliableSequence);
+
+        //! Shared implementation of SendPacket and ResendPacket, which serializes the packet if provided and otherwise reuses the payload.
+        PacketId SendPacketInternal(UdpConnection& connection, PacketType packetType, const IPacket* packet, PacketBufferPtr payload, SequenceId reliableSequence);
+
         //! Accepts an incoming udp connection.
         //! @param connectPacket the initial connectPacket
         void AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket);
@@ -179,6 +277,7 @@ namespace AzNetworking
         bool m_allowIncomingConnections = false;
         AZ::TimeMs m_timeoutMs = AZ::Time::ZeroTimeMs;
         IConnectionListener& m_connectionListener;
+        PacketBufferPool m_packetBufferPool; // Declared ahead of the connections, as their reliable queues hold buffers from the pool
         UdpConnectionSet m_connectionSet;
         TimeoutQueue m_connectionTimeoutQueue;
         TimeoutQueue m_packetTimeoutQueue;
@@ -199,6 +298,24 @@ namespace AzNetworking
         UdpPacketEncodingBuffer m_decryptBuffer;
         UdpPacketEncodingBuffer m_decompressBuffer;
 
+        struct PredecodedPacket
+        {
+            UdpConnection* m_connection = nullptr; //!< Null if the packet was left for the main processing loop to decode
+            DecodedPacket m_packet;
+            DecodeResult m_result = DecodeResult::Consumed;
+            uint32_t m_payloadOffset = 0;
+        };
+        AZStd::vector<PredecodedPacket> m_predecodedPackets;
+
+        struct DecodeShard
+        {
+            AZStd::vector<uint32_t> m_packetIndices;
+            AZStd::vector<uint8_t> m_payloads; //!< Decoded payloads of the shard's packets, as the scratch buffers are reused
+            UdpPacketEncodingBuffer m_decryptBuffer;
+            UdpPacketEncodingBuffer m_decompressBuffer;
+        };
+        AZStd::vector<AZStd::unique_ptr<DecodeShard>> m_decodeShards;
+
         friend class UdpReliableQueue;
         friend class UdpConnection; // For access to private RequestDisconnect() method
     };
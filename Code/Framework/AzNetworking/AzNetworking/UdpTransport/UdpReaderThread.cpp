@@ -176,7 +176,6 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
                 const uint32_t bufferHead = static_cast<uint32_t>(receiveBuffer.GetSize());
                 if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
                 {
@@ -185,18 +184,43 @@ namespace AzNetworking
                     break;
                 }
 
+                // Read as many packets as fit into the remaining buffer space with a single batched receive
+                const uint32_t freeSlotCount = static_cast<uint32_t>(receiveBuffer.GetCapacity() - bufferHead - 1) / MaxUdpTransmissionUnit;
+                const uint32_t freePacketCount = aznumeric_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size());
+                const uint32_t batchSize = AZStd::min(AZStd::min(freeSlotCount, freePacketCount), UdpSocket::MaxBatchSize);
+                if (batchSize == 0)
+                {
+                    break;
+                }
+
                 uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                receiveBuffer.Resize(bufferHead + batchSize * MaxUdpTransmissionUnit);
+
+                UdpSocket::ReceivedDatagram datagrams[UdpSocket::MaxBatchSize];
+                const int32_t receivedCount = socket->ReceiveBatch(dstData, MaxUdpTransmissionUnit, batchSize, datagrams);
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                // Pack the received packets tightly so the remaining buffer space stays usable
+                uint32_t packedSize = bufferHead;
+                for (int32_t i = 0; i < receivedCount; ++i)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    if (datagrams[i].m_receivedBytes <= 0)
+                    {
+                        continue;
+                    }
+
+                    uint8_t* packedData = receiveBuffer.GetBuffer() + packedSize;
+                    if (packedData != datagrams[i].m_data)
+                    {
+                        memmove(packedData, datagrams[i].m_data, datagrams[i].m_receivedBytes);
+                    }
+                    receivedPackets.push_back(ReceivedPacket(datagrams[i].m_address, packedData, datagrams[i].m_receivedBytes));
+                    packedSize += static_cast<uint32_t>(datagrams[i].m_receivedBytes);
                 }
-                else
+                receiveBuffer.Resize(packedSize);
+
+                if (receivedCount < static_cast<int32_t>(batchSize))
                 {
-                    receiveBuffer.Resize(bufferHead);
+                    // The socket has been drained
                     break;
                 }
             }
@@ -34,7 +34,7 @@ namespace AzNetworking
         return static_cast<uint32_t>(m_packetWindow.size());
     }
 
-    bool UdpReliableQueue::PrepareForSend(PacketId packetId, SequenceId reliableSequenceId, const IPacket& packet)
+    bool UdpReliableQueue::PrepareForSend(PacketId packetId, SequenceId reliableSequenceId, PacketType packetType, const PacketBufferPtr& payload)
     {
         AZLOG(NET_ReliableQueueDebug, "Inserting packetId %u with reliable sequenceId %u", static_cast<uint32_t>(packetId), static_cast<uint32_t>(reliableSequenceId));
         if (m_packetWindow.size() > net_MaxReliablePacketsInWindow)
@@ -48,7 +48,7 @@ namespace AzNetworking
             AZ_Assert(false, "Attempted to reinsert an existing packetId into the reliable queue");
             return false;
         }
-        m_packetWindow[packetId] = { reliableSequenceId, packet.Clone() };
+        m_packetWindow[packetId] = { reliableSequenceId, packetType, payload };
         return true;
     }
 
@@ -104,14 +104,16 @@ namespace AzNetworking
         AZLOG(NET_ReliableQueueDebug, "Lost packetId %u", static_cast<uint32_t>(packetId));
 
         bool result = false;
-        AZStd::unique_ptr<IPacket> lostPacket;
+        PacketBufferPtr lostPayload;
+        PacketType lostPacketType = PacketType{};
         SequenceId lostReliableSequenceId = InvalidSequenceId;
 
         PendingPacketMap::iterator iter = m_packetWindow.find(packetId);
         if (iter != m_packetWindow.end())
         {
-            AZ_Assert(iter->second.m_packet != nullptr, "Timed out reliable packet was nullptr");
-            lostPacket = AZStd::move(iter->second.m_packet); // This transfers ownership out of the pending packet to this local scoped alloc
+            AZ_Assert(iter->second.m_payload != nullptr, "Timed out reliable packet was nullptr");
+            lostPayload = AZStd::move(iter->second.m_payload); // This transfers ownership out of the pending packet to this local scope
+            lostPacketType = iter->second.m_packetType;
             lostReliableSequenceId = iter->second.m_reliableSequenceId;
             m_packetWindow.erase(iter);
         }
@@ -125,8 +127,9 @@ namespace AzNetworking
             AZLOG(NET_ReliableQueue, "Resending reliable packetId %u due to loss", static_cast<uint32_t>(lostReliableSequenceId));
 
             // This punches down an abstraction layer purposefully to resend using the existing reliable SequenceId
+            // The payload was serialized when the packet was first sent and is reused as is
             // NOTE: This will call back into UdpReliableQueue::PrepareForSend!!
-            if (networkInterface.SendPacket(connection, *lostPacket, lostReliableSequenceId) == InvalidPacketId)
+            if (networkInterface.ResendPacket(connection, lostPacketType, lostPayload, lostReliableSequenceId) == InvalidPacketId)
             {
                 // Packet failed to retransmit, meaning no retry attempt was made
                 // Since we've lost a reliable packet, the appropriate response is to terminate the connection
@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzNetworking/AzNetworking_Traits_Platform.h>
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
@@ -96,6 +97,14 @@ namespace AzNetworking
 
     void UdpSocket::Close()
     {
+        if (m_sendBatch != nullptr)
+        {
+            // Make sure payloads queued before closing, such as disconnect notifications, still go out
+            AZStd::scoped_lock<AZStd::mutex> lock(m_sendBatch->m_mutex);
+            SendQueuedDatagrams();
+        }
+        m_sendBatchDepth = 0;
+
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
@@ -224,8 +233,123 @@ namespace AzNetworking
         return receivedBytes;
     }
 
+    int32_t UdpSocket::ReceiveBatch(uint8_t* outData, uint32_t size, uint32_t count, ReceivedDatagram* outDatagrams) const
+    {
+        AZ_Assert(size > 0, "Invalid data size for receive");
+        AZ_Assert(outData != nullptr, "NULL data pointer passed to receive");
+
+        if (!IsOpen())
+        {
+            return 0;
+        }
+
+        count = AZStd::min(count, MaxBatchSize);
+
+#if AZ_TRAIT_USE_SOCKET_MMSG
+        mmsghdr messages[MaxBatchSize];
+        iovec ioVectors[MaxBatchSize];
+        sockaddr_in fromAddresses[MaxBatchSize];
+        memset(messages, 0, sizeof(mmsghdr) * count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            ioVectors[i].iov_base = outData + i * size;
+            ioVectors[i].iov_len = size;
+            messages[i].msg_hdr.msg_name = &fromAddresses[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            messages[i].msg_hdr.msg_iov = &ioVectors[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        const int32_t receivedCount = static_cast<int32_t>(recvmmsg(static_cast<int32_t>(m_socketFd), messages, count, 0, nullptr));
+        if (receivedCount < 0)
+        {
+            const int32_t error = GetLastNetworkError();
+
+            if (ErrorIsWouldBlock(error)) // Filter would block messages
+            {
+                return 0;
+            }
+
+            AZLOG_WARN("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            return 0;
+        }
+
+        for (int32_t i = 0; i < receivedCount; ++i)
+        {
+            ReceivedDatagram& datagram = outDatagrams[i];
+            datagram.m_address = IpAddress(ByteOrder::Network, fromAddresses[i].sin_addr.s_addr, fromAddresses[i].sin_port);
+            datagram.m_data = outData + i * size;
+            datagram.m_receivedBytes = static_cast<int32_t>(messages[i].msg_len);
+            m_recvPackets++;
+            m_recvBytes += messages[i].msg_len;
+        }
+        return receivedCount;
+#else
+        int32_t receivedCount = 0;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            ReceivedDatagram& datagram = outDatagrams[receivedCount];
+            datagram.m_data = outData + i * size;
+            datagram.m_receivedBytes = Receive(datagram.m_address, datagram.m_data, size);
+            if (datagram.m_receivedBytes <= 0)
+            {
+                break;
+            }
+            ++receivedCount;
+        }
+        return receivedCount;
+#endif
+    }
+
+    void UdpSocket::BeginSendBatch()
+    {
+        if (m_sendBatch == nullptr)
+        {
+            m_sendBatch = AZStd::make_unique<SendBatch>();
+        }
+        ++m_sendBatchDepth;
+    }
+
+    bool UdpSocket::IsSendBatchActive() const
+    {
+        return m_sendBatchDepth > 0;
+    }
+
+    void UdpSocket::FlushSendBatch()
+    {
+        // Closing the socket ends any active batch, so an unmatched flush is not an error
+        if (m_sendBatchDepth <= 0 || --m_sendBatchDepth > 0)
+        {
+            return;
+        }
+
+        AZStd::scoped_lock<AZStd::mutex> lock(m_sendBatch->m_mutex);
+        SendQueuedDatagrams();
+    }
+
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
+    {
+        if (m_sendBatchDepth > 0 && size <= MaxUdpTransmissionUnit)
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_sendBatch->m_mutex);
+            if (m_sendBatch->m_datagrams.full())
+            {
+                SendQueuedDatagrams();
+            }
+
+            QueuedDatagram& datagram = m_sendBatch->m_datagrams.emplace_back();
+            datagram.m_address = address;
+            datagram.m_size = size;
+            memcpy(datagram.m_data, data, size);
+            // Failures are reported when the batch is flushed, the same as for would block errors on an immediate send
+            return static_cast<int32_t>(size);
+        }
+
+        return SendDatagram(address, data, size);
+    }
+
+    int32_t UdpSocket::SendDatagram(const IpAddress& address, const uint8_t* data, uint32_t size) const
     {
         sockaddr_in destAddr;
         memset(&destAddr, 0, sizeof(destAddr));
@@ -235,6 +359,71 @@ namespace AzNetworking
         return static_cast<int32_t>(sendto(static_cast<int32_t>(m_socketFd), reinterpret_cast<const char*>(data), size, 0, (sockaddr*)&destAddr, sizeof(destAddr)));
     }
 
+    void UdpSocket::SendQueuedDatagrams() const
+    {
+        auto& datagrams = m_sendBatch->m_datagrams;
+        if (datagrams.empty() || !IsOpen())
+        {
+            datagrams.clear();
+            return;
+        }
+
+#if AZ_TRAIT_USE_SOCKET_MMSG
+        const uint32_t count = aznumeric_cast<uint32_t>(datagrams.size());
+        mmsghdr messages[MaxBatchSize];
+        iovec ioVectors[MaxBatchSize];
+        sockaddr_in destAddresses[MaxBatchSize];
+        memset(messages, 0, sizeof(mmsghdr) * count);
+        memset(destAddresses, 0, sizeof(sockaddr_in) * count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            destAddresses[i].sin_family = AF_INET;
+            destAddresses[i].sin_addr.s_addr = datagrams[i].m_address.GetAddress(ByteOrder::Network);
+            destAddresses[i].sin_port = datagrams[i].m_address.GetPort(ByteOrder::Network);
+            ioVectors[i].iov_base = datagrams[i].m_data;
+            ioVectors[i].iov_len = datagrams[i].m_size;
+            messages[i].msg_hdr.msg_name = &destAddresses[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            messages[i].msg_hdr.msg_iov = &ioVectors[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        uint32_t sentCount = 0;
+        while (sentCount < count)
+        {
+            const int32_t result = static_cast<int32_t>(sendmmsg(static_cast<int32_t>(m_socketFd), messages + sentCount, count - sentCount, 0));
+            if (result < 0)
+            {
+                const int32_t error = GetLastNetworkError();
+                if (ErrorIsWouldBlock(error)) // Filter would block messages
+                {
+                    break;
+                }
+
+                // The error belongs to the first remaining payload, skip it so the others still go out
+                AZLOG_WARN("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                ++sentCount;
+                continue;
+            }
+            sentCount += static_cast<uint32_t>(result);
+        }
+#else
+        for (const QueuedDatagram& datagram : datagrams)
+        {
+            if (SendDatagram(datagram.m_address, datagram.m_data, datagram.m_size) < 0)
+            {
+                const int32_t error = GetLastNetworkError();
+                if (ErrorIsWouldBlock(error)) // Filter would block messages
+                {
+                    break;
+                }
+                AZLOG_WARN("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            }
+        }
+#endif
+        datagrams.clear();
+    }
+
 #ifdef ENABLE_LATENCY_DEBUG
     int32_t UdpSocket::SendInternalDeferred(const DeferredData& data) const
     {
@@ -14,6 +14,9 @@
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #ifndef _RELEASE
 #   define ENABLE_LATENCY_DEBUG 1
@@ -42,6 +45,17 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
+        //! Maximum number of payloads handed to the operating system by a single batched send or receive call.
+        static constexpr uint32_t MaxBatchSize = 64;
+
+        //! A payload received by ReceiveBatch.
+        struct ReceivedDatagram
+        {
+            IpAddress m_address;
+            uint8_t*  m_data = nullptr;
+            int32_t   m_receivedBytes = 0;
+        };
+
         UdpSocket() = default;
         virtual ~UdpSocket();
 
@@ -93,6 +107,25 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives multiple payloads from the UDP socket, using a single system call on platforms that support it.
+        //! @param outData      address to write the received data to, payload i is written at outData + i * size
+        //! @param size         maximum size of a single payload, outData must provide count * size bytes
+        //! @param count        maximum number of payloads to receive, capped to MaxBatchSize
+        //! @param outDatagrams on success, the address, data and size of each received payload
+        //! @return number of payloads received, < 0 on error
+        int32_t ReceiveBatch(uint8_t* outData, uint32_t size, uint32_t count, ReceivedDatagram* outDatagrams) const;
+
+        //! Defers all sends on this socket until FlushSendBatch is called, so that they can be handed to the operating system together.
+        //! Calls may be nested, sends are deferred until the outermost batch is flushed.
+        void BeginSendBatch();
+
+        //! Ends the current send batch, transmitting all deferred payloads once the outermost batch is flushed.
+        void FlushSendBatch();
+
+        //! Returns whether sends on this socket are currently being deferred by BeginSendBatch.
+        //! @return boolean true if a send batch is active
+        bool IsSendBatchActive() const;
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -130,6 +163,27 @@ namespace AzNetworking
 
     private:
 
+        struct QueuedDatagram
+        {
+            IpAddress m_address;
+            uint32_t  m_size = 0;
+            uint8_t   m_data[MaxUdpTransmissionUnit];
+        };
+
+        struct SendBatch
+        {
+            AZStd::mutex m_mutex;
+            AZStd::fixed_vector<QueuedDatagram, MaxBatchSize> m_datagrams;
+        };
+
+        int32_t SendDatagram(const IpAddress& address, const uint8_t* data, uint32_t size) const;
+        //! Transmits all queued payloads, must be called with the send batch mutex held.
+        void SendQueuedDatagrams() const;
+
+        //! Payloads waiting to be sent while a send batch is active. Sends may be issued from multiple threads.
+        AZStd::unique_ptr<SendBatch> m_sendBatch;
+        AZStd::atomic<int32_t> m_sendBatchDepth{ 0 };
+
         SocketFd m_socketFd = InvalidSocketFd;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
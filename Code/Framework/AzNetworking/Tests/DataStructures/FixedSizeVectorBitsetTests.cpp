@@ -11,4 +11,27 @@
 
 namespace UnitTest
 {
+    TEST(FixedSizeVectorBitsetTests, TestEquality)
+    {
+        AzNetworking::FixedSizeVectorBitset<32> lhs;
+        AzNetworking::FixedSizeVectorBitset<32> rhs;
+        lhs.Resize(20);
+        rhs.Resize(20);
+        EXPECT_TRUE(lhs == rhs);
+
+        lhs.SetBit(17, true);
+        EXPECT_TRUE(lhs != rhs);
+        rhs.SetBit(17, true);
+        EXPECT_TRUE(lhs == rhs);
+
+        // Bitsets of different sizes never compare equal
+        rhs.Resize(24);
+        EXPECT_TRUE(lhs != rhs);
+
+        // Bits dropped by shrinking don't affect comparisons
+        lhs.SetBit(19, true);
+        lhs.Resize(18);
+        rhs.Resize(18);
+        EXPECT_TRUE(lhs == rhs);
+    }
 }
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/DataStructures/PacketBufferPool.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    using PacketBufferPoolTests = LeakDetectionFixture;
+
+    TEST_F(PacketBufferPoolTests, AcquireRoundsUpToSizeClass)
+    {
+        PacketBufferPool pool;
+
+        PacketBufferPtr small = pool.Acquire(10);
+        ASSERT_NE(small, nullptr);
+        EXPECT_EQ(small->GetSize(), 10u);
+        EXPECT_EQ(small->GetCapacity(), PacketBufferPool::MinBufferCapacity);
+
+        PacketBufferPtr large = pool.Acquire(PacketBufferPool::MaxBufferCapacity);
+        ASSERT_NE(large, nullptr);
+        EXPECT_EQ(large->GetCapacity(), PacketBufferPool::MaxBufferCapacity);
+
+        EXPECT_EQ(pool.Acquire(PacketBufferPool::MaxBufferCapacity + 1), nullptr);
+        EXPECT_EQ(pool.GetActiveBufferCount(), 2u);
+    }
+
+    TEST_F(PacketBufferPoolTests, ReleasedBuffersAreReused)
+    {
+        PacketBufferPool pool;
+
+        const uint8_t data[] = { 1, 2, 3, 4, 5 };
+        PacketBufferPtr buffer = pool.Acquire(data, sizeof(data));
+        ASSERT_NE(buffer, nullptr);
+        EXPECT_EQ(memcmp(buffer->GetBuffer(), data, sizeof(data)), 0);
+        const PacketBuffer* firstBuffer = buffer.get();
+
+        // Sharing the buffer keeps it out of the pool until the last reference is gone
+        PacketBufferPtr sharedBuffer = buffer;
+        buffer = nullptr;
+        EXPECT_EQ(pool.GetActiveBufferCount(), 1u);
+        sharedBuffer = nullptr;
+        EXPECT_EQ(pool.GetActiveBufferCount(), 0u);
+
+        PacketBufferPtr reusedBuffer = pool.Acquire(sizeof(data));
+        EXPECT_EQ(reusedBuffer.get(), firstBuffer);
+        EXPECT_EQ(pool.GetAllocatedBufferCount(), 1u);
+        EXPECT_EQ(pool.GetReusedBufferCount(), 1u);
+    }
+}
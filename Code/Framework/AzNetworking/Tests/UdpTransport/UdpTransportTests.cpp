@@ -7,13 +7,19 @@
  */
 
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
+#include <AzNetworking/UdpTransport/UdpConnection.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Console/Console.h>
 #include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
 #include <AzCore/Time/TimeSystem.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/UnitTest/TestTypes.h>
@@ -255,6 +261,57 @@ namespace UnitTest
         EXPECT_EQ(ackState, PacketAckState::Nacked); // Testing that PacketId is not flagged as acked
     }
 
+    TEST_F(UdpTransportTests, SendBatch_DefersSendsUntilFlushed)
+    {
+        constexpr uint16_t ReceiverPort = 12346;
+        constexpr uint32_t PacketCount = UdpSocket::MaxBatchSize + 8; // Overflowing the batch sends the queued packets early
+
+        UdpSocket sender;
+        UdpSocket receiver;
+        ASSERT_TRUE(sender.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        ASSERT_TRUE(receiver.Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+
+        AZStd::vector<uint8_t> receiveBuffer(UdpSocket::MaxBatchSize * MaxUdpTransmissionUnit);
+        UdpSocket::ReceivedDatagram datagrams[UdpSocket::MaxBatchSize];
+
+        DtlsEndpoint dtlsEndpoint;
+        const IpAddress receiverAddress(127, 0, 0, 1, ReceiverPort);
+        sender.BeginSendBatch();
+        for (uint32_t i = 0; i < PacketCount; ++i)
+        {
+            const uint8_t payload[] = { static_cast<uint8_t>(i), 0xAB, 0xCD };
+            EXPECT_EQ(sender.Send(receiverAddress, payload, sizeof(payload), false, dtlsEndpoint, ConnectionQuality()), static_cast<int32_t>(sizeof(payload)));
+            if (i == 0)
+            {
+                // Nothing has been handed to the socket yet
+                EXPECT_EQ(receiver.ReceiveBatch(receiveBuffer.data(), MaxUdpTransmissionUnit, UdpSocket::MaxBatchSize, datagrams), 0);
+            }
+        }
+        sender.FlushSendBatch();
+        EXPECT_EQ(sender.GetSentPackets(), PacketCount);
+        uint32_t receivedCount = 0;
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while (receivedCount < PacketCount && (AZ::GetElapsedTimeMs() - startTimeMs) < AZ::TimeMs{ 5000 })
+        {
+            const int32_t batchCount = receiver.ReceiveBatch(receiveBuffer.data(), MaxUdpTransmissionUnit, UdpSocket::MaxBatchSize, datagrams);
+            for (int32_t i = 0; i < batchCount; ++i)
+            {
+                ASSERT_EQ(datagrams[i].m_receivedBytes, 3);
+                // Loopback preserves ordering, so packets arrive in the order they were queued
+                EXPECT_EQ(datagrams[i].m_data[0], static_cast<uint8_t>(receivedCount));
+                EXPECT_EQ(datagrams[i].m_address.GetAddress(ByteOrder::Host), receiverAddress.GetAddress(ByteOrder::Host));
+                ++receivedCount;
+            }
+            if (batchCount <= 0)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            }
+        }
+
+        EXPECT_EQ(receivedCount, PacketCount);
+        EXPECT_EQ(receiver.GetRecvPackets(), PacketCount);
+    }
+
     TEST_F(UdpTransportTests, TestSingleClient)
     {
         TestUdpServer testServer;
@@ -289,6 +346,58 @@ namespace UnitTest
         EXPECT_FALSE(dynamic_cast<UdpNetworkInterface*>(testServer.m_serverNetworkInterface)->IsOpen());
     }
 
+    TEST_F(UdpTransportTests, CoalescedPackets_AreAckedIndividually)
+    {
+        TestUdpServer testServer;
+        TestUdpClient testClient;
+
+        constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+        AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while ((testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount() != 1)
+            && (AZ::GetElapsedTimeMs() - startTimeMs < TotalIterationTimeMs))
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+            m_networkingSystemComponent->OnSystemTick();
+        }
+
+        UdpConnection* clientConnection = nullptr;
+        testClient.m_clientNetworkInterface->GetConnectionSet().VisitConnections([&clientConnection](IConnection& connection)
+        {
+            clientConnection = static_cast<UdpConnection*>(&connection);
+        });
+        ASSERT_NE(clientConnection, nullptr);
+        clientConnection->SetCoalescePackets(true);
+        EXPECT_TRUE(clientConnection->GetCoalescePackets());
+
+        // Heartbeat requests are small enough to share one datagram, and each one gets acked by the reply it triggers
+        constexpr uint32_t PacketCount = 8;
+        AZStd::vector<PacketId> packetIds;
+        testClient.m_clientNetworkInterface->BeginSendBatch();
+        for (uint32_t i = 0; i < PacketCount; ++i)
+        {
+            packetIds.push_back(clientConnection->SendUnreliablePacket(CorePackets::HeartbeatPacket(true)));
+        }
+        testClient.m_clientNetworkInterface->FlushSendBatch();
+
+        const auto allPacketsAcked = [clientConnection, &packetIds]()
+        {
+            return AZStd::all_of(packetIds.begin(), packetIds.end(), [clientConnection](PacketId packetId)
+            {
+                return clientConnection->WasPacketAcked(packetId);
+            });
+        };
+
+        startTimeMs = AZ::GetElapsedTimeMs();
+        while (!allPacketsAcked() && (AZ::GetElapsedTimeMs() - startTimeMs < TotalIterationTimeMs))
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+            m_networkingSystemComponent->OnSystemTick();
+        }
+
+        EXPECT_TRUE(allPacketsAcked());
+        EXPECT_EQ(testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
+    }
+
     TEST_F(UdpTransportTests, TestMultipleClients)
     {
         constexpr uint32_t NumTestClients = 50;
@@ -320,4 +429,57 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(UdpTransportTests, TestMultipleClients_ParallelDecode)
+    {
+        AZStd::unique_ptr<AZ::Console> console = AZStd::make_unique<AZ::Console>();
+        console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+        AZ::Interface<AZ::IConsole>::Register(console.get());
+        console->PerformCommand("net_UdpDecodeShardCount 4");
+        console->PerformCommand("net_UdpDecodeShardMinPackets 1");
+
+        AZ::JobManagerDesc jobManagerDesc;
+        jobManagerDesc.m_workerThreads.resize(2);
+        AZStd::unique_ptr<AZ::JobManager> jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+        AZStd::unique_ptr<AZ::JobContext> jobContext = AZStd::make_unique<AZ::JobContext>(*jobManager);
+        AZ::JobContext::SetGlobalContext(jobContext.get());
+
+        {
+            constexpr uint32_t NumTestClients = 8;
+
+            TestUdpServer testServer;
+            TestUdpClient testClient[NumTestClients];
+
+            // Keep sending heartbeats once connected, so established connections receive packets through the decode shards
+            constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 2000 };
+            const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+            while (AZ::GetElapsedTimeMs() - startTimeMs < TotalIterationTimeMs)
+            {
+                for (uint32_t i = 0; i < NumTestClients; ++i)
+                {
+                    testClient[i].m_clientNetworkInterface->GetConnectionSet().VisitConnections([](IConnection& connection)
+                    {
+                        connection.SendUnreliablePacket(CorePackets::HeartbeatPacket(false));
+                    });
+                }
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+                m_networkingSystemComponent->OnSystemTick();
+            }
+
+            uint32_t connectedCount = 0;
+            testServer.m_serverNetworkInterface->GetConnectionSet().VisitConnections([&connectedCount](IConnection& connection)
+            {
+                connectedCount += (connection.GetConnectionState() == ConnectionState::Connected) ? 1 : 0;
+            });
+            EXPECT_EQ(connectedCount, NumTestClients);
+        }
+
+        AZ::JobContext::SetGlobalContext(nullptr);
+        jobContext.reset();
+        jobManager.reset();
+
+        console->PerformCommand("net_UdpDecodeShardCount 0");
+        console->PerformCommand("net_UdpDecodeShardMinPackets 64");
+        AZ::Interface<AZ::IConsole>::Unregister(console.get());
+    }
 }
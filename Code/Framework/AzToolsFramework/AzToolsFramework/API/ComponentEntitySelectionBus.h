@@ -94,6 +94,12 @@ namespace AzToolsFramework
         {
         }
 
+        //! @brief Notifies listeners that the editor selection bounds of the entity changed for a reason other than
+        //! a transform or property change (e.g. an animated mesh), so cached bounds must be recalculated.
+        virtual void OnEditorSelectionBoundsChanged()
+        {
+        }
+
     protected:
         ~EditorComponentSelectionNotifications() = default;
     };
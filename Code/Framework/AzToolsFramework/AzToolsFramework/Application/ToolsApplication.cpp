@@ -9,6 +9,7 @@
 
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Asset/AssetSerializer.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/IO/FileIO.h>
@@ -105,6 +106,24 @@ AZ_POP_DISABLE_WARNING
 // For now we'll stick with the CRT new/delete in tools.
 //#include <AzCore/Memory/NewAndDelete.inl>
 
+static void OnUndoStackMaxSizeChanged(const AZ::u32& maxSize)
+{
+    AzToolsFramework::UndoSystem::UndoStack* undoStack = nullptr;
+    AzToolsFramework::ToolsApplicationRequestBus::BroadcastResult(undoStack, &AzToolsFramework::ToolsApplicationRequests::GetUndoStack);
+    if (undoStack)
+    {
+        undoStack->SetMaxSequencePointCount(maxSize);
+    }
+}
+
+AZ_CVAR(
+    AZ::u32,
+    ed_undoStackMaxSize,
+    1000,
+    OnUndoStackMaxSizeChanged,
+    AZ::ConsoleFunctorFlags::DontReplicate | AZ::ConsoleFunctorFlags::DontDuplicate,
+    "The maximum number of undo steps kept by the editor, the oldest ones are deleted past it. 0 keeps the whole history");
+
 namespace AzToolsFramework
 {
     namespace Internal
@@ -273,6 +292,7 @@ namespace AzToolsFramework
         Application::StartCommon(systemEntity);
 
         m_undoStack = new UndoSystem::UndoStack(10, nullptr);
+        m_undoStack->SetMaxSequencePointCount(ed_undoStackMaxSize);
     }
 
     void ToolsApplication::Stop()
@@ -28,6 +28,10 @@ AZ_POP_DISABLE_WARNING
 AZ_CVAR(
     bool, ed_useNewAssetBrowserListView, true, nullptr, AZ::ConsoleFunctorFlags::Null,
     "Use the new AssetBrowser ListView for searching assets.");
+AZ_CVAR(
+    bool, ed_assetBrowserCacheFilterResults, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Match the AssetBrowser filter against all the entries in one pass when it changes, instead of matching each row separately.");
+
 namespace AzToolsFramework
 {
     namespace AssetBrowser
@@ -72,6 +76,7 @@ namespace AzToolsFramework
 
             m_filter = filter;
             m_invalidateFilter = true;
+            InvalidateFilterResults();
 
             // asset browser entries are not guaranteed to have populated when the filter is set, delay filtering until they are
             bool isAssetBrowserComponentReady = false;
@@ -134,15 +139,44 @@ namespace AzToolsFramework
             return QSortFilterProxyModel::data(index, role);
         }
 
+        void AssetBrowserFilterModel::setSourceModel(QAbstractItemModel* newSourceModel)
+        {
+            if (QAbstractItemModel* oldSourceModel = sourceModel())
+            {
+                disconnect(oldSourceModel, &QAbstractItemModel::rowsInserted, this, &AssetBrowserFilterModel::OnSourceRowsInserted);
+                disconnect(
+                    oldSourceModel, &QAbstractItemModel::rowsAboutToBeRemoved, this,
+                    &AssetBrowserFilterModel::OnSourceRowsAboutToBeRemoved);
+                disconnect(oldSourceModel, &QAbstractItemModel::dataChanged, this, &AssetBrowserFilterModel::OnSourceDataChanged);
+                disconnect(oldSourceModel, &QAbstractItemModel::modelReset, this, &AssetBrowserFilterModel::InvalidateFilterResults);
+                disconnect(oldSourceModel, &QAbstractItemModel::layoutChanged, this, &AssetBrowserFilterModel::InvalidateFilterResults);
+            }
+
+            // connected before the base class so the cached results are updated before the proxy filters the changed rows
+            if (newSourceModel)
+            {
+                connect(newSourceModel, &QAbstractItemModel::rowsInserted, this, &AssetBrowserFilterModel::OnSourceRowsInserted);
+                connect(
+                    newSourceModel, &QAbstractItemModel::rowsAboutToBeRemoved, this,
+                    &AssetBrowserFilterModel::OnSourceRowsAboutToBeRemoved);
+                connect(newSourceModel, &QAbstractItemModel::dataChanged, this, &AssetBrowserFilterModel::OnSourceDataChanged);
+                connect(newSourceModel, &QAbstractItemModel::modelReset, this, &AssetBrowserFilterModel::InvalidateFilterResults);
+                connect(newSourceModel, &QAbstractItemModel::layoutChanged, this, &AssetBrowserFilterModel::InvalidateFilterResults);
+            }
+
+            InvalidateFilterResults();
+            QSortFilterProxyModel::setSourceModel(newSourceModel);
+        }
+
         void AssetBrowserFilterModel::SetSearchString(const QString& searchString)
         {
             m_searchString = searchString;
         }
 
-        bool AssetBrowserFilterModel::filterAcceptsRow(int source_row, const QModelIndex& source_parent) const
+        const AssetBrowserEntry* AssetBrowserFilterModel::GetSourceEntry(int sourceRow, const QModelIndex& sourceParent) const
         {
             //get the source idx, if invalid early out
-            QModelIndex idx = sourceModel()->index(source_row, 0, source_parent);
+            QModelIndex idx = sourceModel()->index(sourceRow, 0, sourceParent);
             if (m_isTableView && qobject_cast<AssetBrowserTreeToTableProxyModel*>(sourceModel()))
             {
                 idx = static_cast<AssetBrowserTreeToTableProxyModel*>(sourceModel())->mapToSource(idx);
@@ -150,11 +184,20 @@ namespace AzToolsFramework
 
             if (!idx.isValid())
             {
-                return false;
+                return nullptr;
             }
 
             //the entry is the internal pointer of the index
-            auto entry = static_cast<AssetBrowserEntry*>(idx.internalPointer());
+            return static_cast<const AssetBrowserEntry*>(idx.internalPointer());
+        }
+
+        bool AssetBrowserFilterModel::filterAcceptsRow(int source_row, const QModelIndex& source_parent) const
+        {
+            const AssetBrowserEntry* entry = GetSourceEntry(source_row, source_parent);
+            if (!entry)
+            {
+                return false;
+            }
 
             // root should return true even if its not displayed in the treeview
             if (entry->GetEntryType() == AssetBrowserEntry::AssetEntryType::Root)
@@ -162,7 +205,141 @@ namespace AzToolsFramework
                 return true;
             }
 
-            return !m_filter || m_filter->Match(entry);
+            if (!m_filter)
+            {
+                return true;
+            }
+
+            if (!CanCacheFilterResults())
+            {
+                return m_filter->Match(entry);
+            }
+
+            if (m_acceptedEntriesDirty)
+            {
+                AZ_PROFILE_SCOPE(AzToolsFramework, "AssetBrowserFilterModel - Cache filter results");
+
+                m_acceptedEntries.clear();
+                const AssetBrowserEntry* rootEntry = entry;
+                while (rootEntry->GetParent())
+                {
+                    rootEntry = rootEntry->GetParent();
+                }
+                CacheFilterResults(rootEntry);
+                m_acceptedEntriesDirty = false;
+            }
+
+            return m_acceptedEntries.contains(entry);
+        }
+
+        bool AssetBrowserFilterModel::CanCacheFilterResults() const
+        {
+            // with an upward propagation an entry matches when one of its ancestors matches, which isn't known while visiting it
+            return ed_assetBrowserCacheFilterResults && m_filter &&
+                (m_filter->GetFilterPropagation() == AssetBrowserEntryFilter::PropagateDirection::None ||
+                 m_filter->GetFilterPropagation() == AssetBrowserEntryFilter::PropagateDirection::Down);
+        }
+
+        void AssetBrowserFilterModel::InvalidateFilterResults()
+        {
+            m_acceptedEntries.clear();
+            m_acceptedEntriesDirty = true;
+        }
+
+        bool AssetBrowserFilterModel::CacheFilterResults(const AssetBrowserEntry* entry) const
+        {
+            // an entry propagating down is accepted when it or one of its descendants matches, so the children
+            // are visited first and each entry is matched once
+            bool accepted = m_filter->MatchWithoutPropagation(entry);
+            const bool propagateDown = m_filter->GetFilterPropagation() == AssetBrowserEntryFilter::PropagateDirection::Down;
+            for (int childIndex = 0, childCount = entry->GetChildCount(); childIndex < childCount; ++childIndex)
+            {
+                const bool childAccepted = CacheFilterResults(entry->GetChild(childIndex));
+                accepted = accepted || (propagateDown && childAccepted);
+            }
+
+            if (accepted)
+            {
+                m_acceptedEntries.insert(entry);
+            }
+            return accepted;
+        }
+
+        void AssetBrowserFilterModel::OnSourceRowsInserted(const QModelIndex& sourceParent, int first, int last)
+        {
+            if (m_acceptedEntriesDirty || !CanCacheFilterResults())
+            {
+                return;
+            }
+
+            const bool propagateDown = m_filter->GetFilterPropagation() == AssetBrowserEntryFilter::PropagateDirection::Down;
+            for (int row = first; row <= last; ++row)
+            {
+                if (const AssetBrowserEntry* entry = GetSourceEntry(row, sourceParent); entry && CacheFilterResults(entry) && propagateDown)
+                {
+                    for (const AssetBrowserEntry* parent = entry->GetParent(); parent; parent = parent->GetParent())
+                    {
+                        m_acceptedEntries.insert(parent);
+                    }
+                }
+            }
+        }
+
+        void AssetBrowserFilterModel::OnSourceRowsAboutToBeRemoved(const QModelIndex& sourceParent, int first, int last)
+        {
+            if (m_acceptedEntriesDirty)
+            {
+                return;
+            }
+
+            // the removed entries are deleted, their addresses may be reused by new entries
+            for (int row = first; row <= last; ++row)
+            {
+                if (const AssetBrowserEntry* entry = GetSourceEntry(row, sourceParent))
+                {
+                    entry->VisitDown(
+                        [this](const AssetBrowserEntry* removedEntry)
+                        {
+                            m_acceptedEntries.erase(removedEntry);
+                            return true;
+                        });
+                }
+            }
+        }
+
+        void AssetBrowserFilterModel::OnSourceDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight)
+        {
+            if (m_acceptedEntriesDirty || !CanCacheFilterResults() || !topLeft.isValid())
+            {
+                return;
+            }
+
+            // only the name of an entry changes its filter result, the ancestors are left as they are like the proxy does
+            const bool propagateDown = m_filter->GetFilterPropagation() == AssetBrowserEntryFilter::PropagateDirection::Down;
+            for (int row = topLeft.row(); row <= bottomRight.row(); ++row)
+            {
+                const AssetBrowserEntry* entry = GetSourceEntry(row, topLeft.parent());
+                if (!entry)
+                {
+                    continue;
+                }
+
+                bool accepted = m_filter->MatchWithoutPropagation(entry);
+                for (int childIndex = 0, childCount = entry->GetChildCount(); propagateDown && !accepted && childIndex < childCount;
+                     ++childIndex)
+                {
+                    accepted = m_acceptedEntries.contains(entry->GetChild(childIndex));
+                }
+
+                if (accepted)
+                {
+                    m_acceptedEntries.insert(entry);
+                }
+                else
+                {
+                    m_acceptedEntries.erase(entry);
+                }
+            }
         }
 
         bool AssetBrowserFilterModel::filterAcceptsColumn(int source_column, const QModelIndex&) const
@@ -235,6 +412,8 @@ namespace AzToolsFramework
                     }
                 }
             }
+            InvalidateFilterResults();
+
             // Note that because the data we are filtering over is massive (all assets) its way faster
             // to reset the model than it is to try to incrementally apply filters here, which can cause many more
             // messages like "row added / row removed" to be sent to the view.
@@ -246,6 +425,7 @@ namespace AzToolsFramework
 
         void AssetBrowserFilterModel::filterUpdatedSlot()
         {
+            InvalidateFilterResults();
             if (!m_alreadyRecomputingFilters)
             {
                 m_alreadyRecomputingFilters = true;
@@ -15,6 +15,7 @@
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/fixed_unordered_set.h>
+#include <AzCore/std/containers/flat_hash_set.h>
 
 AZ_PUSH_DISABLE_WARNING(4251, "-Wunknown-warning-option") // 4251: class '...' needs to have dll-interface to be used by clients of class '...'
 #include <QSortFilterProxyModel>
@@ -43,6 +44,7 @@ namespace AzToolsFramework
 
             // QSortFilterProxyModel
             QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+            void setSourceModel(QAbstractItemModel* sourceModel) override;
 
             //asset type filtering
             void SetFilter(FilterConstType filter);
@@ -75,6 +77,18 @@ namespace AzToolsFramework
         public Q_SLOTS:
             void filterUpdatedSlot();
 
+        private:
+            //! Returns the entry of a row of the source model.
+            const AssetBrowserEntry* GetSourceEntry(int sourceRow, const QModelIndex& sourceParent) const;
+            //! The filter results can be cached when they don't depend on the ancestors of the entries.
+            bool CanCacheFilterResults() const;
+            void InvalidateFilterResults();
+            //! Adds the accepted entries of the subtree of @entry to the cache, returns true if @entry is accepted.
+            bool CacheFilterResults(const AssetBrowserEntry* entry) const;
+            void OnSourceRowsInserted(const QModelIndex& sourceParent, int first, int last);
+            void OnSourceRowsAboutToBeRemoved(const QModelIndex& sourceParent, int first, int last);
+            void OnSourceDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight);
+
         protected:
             // Set for filtering columns
             // If the column is in the set the column is not filtered and is shown
@@ -93,6 +107,11 @@ namespace AzToolsFramework
             Qt::SortOrder m_sortOrder = Qt::DescendingOrder;
  
             QString m_searchString;
+
+            //! Entries accepted by the filter, calculated in one pass over the entries when the filter changes instead of
+            //! matching each row with its propagation (which visits the whole subtree of the rejected folders).
+            mutable AZStd::flat_hash_set<const AssetBrowserEntry*> m_acceptedEntries;
+            mutable bool m_acceptedEntriesDirty = true;
         };
     } // namespace AssetBrowser
 } // namespace AzToolsFramework
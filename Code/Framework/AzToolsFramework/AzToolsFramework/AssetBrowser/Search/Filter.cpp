@@ -124,6 +124,11 @@ namespace AzToolsFramework
             m_direction = direction;
         }
 
+        AssetBrowserEntryFilter::PropagateDirection AssetBrowserEntryFilter::GetFilterPropagation() const
+        {
+            return m_direction;
+        }
+
         bool AssetBrowserEntryFilter::MatchInternal(const AssetBrowserEntry* entry) const
         {
             return entry != nullptr;
@@ -77,6 +77,7 @@ namespace AzToolsFramework
             void SetTag(const QString& tag);
 
             void SetFilterPropagation(PropagateDirection direction);
+            PropagateDirection GetFilterPropagation() const;
 
         Q_SIGNALS:
             //! Emitted every time a filter is updated, in case of composite filter, the signal is propagated to the top level filter so
@@ -11,6 +11,7 @@
 
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Slice/SliceComponent.h>
 #include <AzCore/Slice/SliceMetadataInfoBus.h>
@@ -111,6 +112,10 @@ namespace
 
 namespace AzToolsFramework
 {
+    AZ_CVAR(AZ::u32, ed_entityModelBulkAddThreshold, 256, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of entities added to the editor entity model at once from which the observers, like the Entity Outliner, are reset "
+        "once instead of being notified of each entity and sort order change. 0 disables the bulk update.");
+
     EditorEntityModel::EditorEntityModel()
     {
         EntityCompositionNotificationBus::Handler::BusConnect();
@@ -307,6 +312,15 @@ namespace AzToolsFramework
             }
         }
 
+        // Notifying the observers of every added entity, and of the new order of all its siblings, is quadratic with the number
+        // of entities added under the same parent, a large batch resets the observers once instead.
+        const bool bulkUpdate = ed_entityModelBulkAddThreshold > 0 && sortedEntitiesToAdd.size() >= ed_entityModelBulkAddThreshold;
+        if (bulkUpdate)
+        {
+            m_bulkUpdateInProgress = true;
+            EditorEntityInfoNotificationBus::Broadcast(&EditorEntityInfoNotificationBus::Events::OnEntityInfoResetBegin);
+        }
+
         { // Add sorted entities
             AZ_PROFILE_SCOPE(AzToolsFramework, "EditorEntityModel::AddEntityBatch:Add");
             for (AZ::EntityId entityId : sortedEntitiesToAdd)
@@ -314,6 +328,21 @@ namespace AzToolsFramework
                 AddEntity(entityId);
             }
         }
+
+        if (bulkUpdate)
+        {
+            {
+                AZ_PROFILE_SCOPE(AzToolsFramework, "EditorEntityModel::AddEntityBatch:UpdateOrderInfo");
+                for (AZ::EntityId parentId : m_bulkUpdateReorderedParents)
+                {
+                    UpdateChildrenOrderInfo(parentId, false);
+                }
+                m_bulkUpdateReorderedParents.clear();
+            }
+
+            m_bulkUpdateInProgress = false;
+            EditorEntityInfoNotificationBus::Broadcast(&EditorEntityInfoNotificationBus::Events::OnEntityInfoResetEnd);
+        }
     }
 
     void EditorEntityModel::ClearQueuedEntityAdds()
@@ -430,11 +459,18 @@ namespace AzToolsFramework
 
         if (!parentInfo.HasChild(childId))
         {
-            EditorEntityInfoNotificationBus::Broadcast(&EditorEntityInfoNotificationBus::Events::OnEntityInfoUpdatedAddChildBegin, parentId, childId);
+            if (m_bulkUpdateInProgress)
+            {
+                parentInfo.AddChild(childId);
+            }
+            else
+            {
+                EditorEntityInfoNotificationBus::Broadcast(&EditorEntityInfoNotificationBus::Events::OnEntityInfoUpdatedAddChildBegin, parentId, childId);
 
-            parentInfo.AddChild(childId);
+                parentInfo.AddChild(childId);
 
-            EditorEntityInfoNotificationBus::Broadcast(&EditorEntityInfoNotificationBus::Events::OnEntityInfoUpdatedAddChildEnd, parentId, childId);
+                EditorEntityInfoNotificationBus::Broadcast(&EditorEntityInfoNotificationBus::Events::OnEntityInfoUpdatedAddChildEnd, parentId, childId);
+            }
         }
 
         AZStd::unordered_map<AZ::EntityId, AZStd::pair<AZ::EntityId, AZ::u64>>::const_iterator orderItr = m_savedOrderInfo.find(childId);
@@ -452,7 +488,7 @@ namespace AzToolsFramework
         }
 
         UpdateSliceInfoHierarchy(childInfo.GetId());
-        childInfo.UpdateOrderInfo(true);
+        childInfo.UpdateOrderInfo(!m_bulkUpdateInProgress);
     }
 
     void EditorEntityModel::RemoveChildFromParent(AZ::EntityId parentId, AZ::EntityId childId)
@@ -478,11 +514,18 @@ namespace AzToolsFramework
             //creating/pushing slices doesn't always destroy/de-register the original entity before adding the replacement
             if (parentInfo.HasChild(childId))
             {
-                EditorEntityInfoNotificationBus::Broadcast(&EditorEntityInfoNotificationBus::Events::OnEntityInfoUpdatedRemoveChildBegin, parentId, childId);
+                if (m_bulkUpdateInProgress)
+                {
+                    parentInfo.RemoveChild(childId);
+                }
+                else
+                {
+                    EditorEntityInfoNotificationBus::Broadcast(&EditorEntityInfoNotificationBus::Events::OnEntityInfoUpdatedRemoveChildBegin, parentId, childId);
 
-                parentInfo.RemoveChild(childId);
+                    parentInfo.RemoveChild(childId);
 
-                EditorEntityInfoNotificationBus::Broadcast(&EditorEntityInfoNotificationBus::Events::OnEntityInfoUpdatedRemoveChildEnd, parentId, childId);
+                    EditorEntityInfoNotificationBus::Broadcast(&EditorEntityInfoNotificationBus::Events::OnEntityInfoUpdatedRemoveChildEnd, parentId, childId);
+                }
             }
         }
 
@@ -636,17 +679,30 @@ namespace AzToolsFramework
             {
                 parentEntityId = AZ::EntityId();
             }
-            auto& entityInfo = GetInfo(parentEntityId);
-            for (auto childId : entityInfo.GetChildren())
+
+            if (m_bulkUpdateInProgress)
             {
-                auto& childInfo = GetInfo(childId);
-                childInfo.UpdateOrderInfo(true);
+                // The order of the children is updated once, at the end of the bulk update
+                m_bulkUpdateReorderedParents.insert(parentEntityId);
+                return;
             }
 
-            entityInfo.OnChildSortOrderChanged();
+            UpdateChildrenOrderInfo(parentEntityId, true);
         }
     }
 
+    void EditorEntityModel::UpdateChildrenOrderInfo(AZ::EntityId parentEntityId, bool notify)
+    {
+        auto& entityInfo = GetInfo(parentEntityId);
+        for (auto childId : entityInfo.GetChildren())
+        {
+            auto& childInfo = GetInfo(childId);
+            childInfo.UpdateOrderInfo(notify);
+        }
+
+        entityInfo.OnChildSortOrderChanged();
+    }
+
     void EditorEntityModel::OnPrepareForContextReset()
     {
         m_preparingForContextReset = true;
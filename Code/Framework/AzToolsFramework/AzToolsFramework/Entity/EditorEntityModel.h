@@ -147,6 +147,7 @@ namespace AzToolsFramework
         void RemoveChildFromParent(AZ::EntityId parentId, AZ::EntityId childId);
         void RemoveFromAncestorCyclicDependencyList(const AZ::EntityId& parentId, const AZ::EntityId& entityId);
         void ReparentChild(AZ::EntityId entityId, AZ::EntityId newParentId, AZ::EntityId oldParentId);
+        void UpdateChildrenOrderInfo(AZ::EntityId parentEntityId, bool notify);
 
         void UpdateSliceInfoHierarchy(AZ::EntityId entityId);
 
@@ -355,6 +356,11 @@ namespace AzToolsFramework
         AZStd::unordered_set<AZ::EntityId> m_queuedEntityAdds;
         AZStd::unordered_set<AZ::EntityId> m_queuedEntityAddsNotYetActivated;
 
+        // Set while a large batch of queued entities is added, the observers are reset once at the end instead of being
+        // notified of each change.
+        bool m_bulkUpdateInProgress = false;
+        AZStd::unordered_set<AZ::EntityId> m_bulkUpdateReorderedParents;
+
         AZ::EntityId m_postInstantiateBeforeEntity;
         AZ::EntityId m_postInstantiateSliceParent;
         bool m_gotInstantiateSliceDetails = false;
@@ -140,6 +140,12 @@ namespace AzToolsFramework
         }
     }
 
+    void FocusModeSystemComponent::OnEntityInfoResetEnd()
+    {
+        // The entities added in a bulk update of the entity model aren't notified one by one.
+        RefreshFocusedEntityIdList();
+    }
+
     void FocusModeSystemComponent::OnEntityInfoUpdatedAddChildEnd(AZ::EntityId parentId, AZ::EntityId childId)
     {
         // If the parent's entityId is in the list and the child isn't, add the child to the list.
@@ -51,6 +51,7 @@ namespace AzToolsFramework
         bool IsInFocusSubTree(AZ::EntityId entityId) const override;
 
         // EditorEntityInfoNotificationBus overrides ...
+        void OnEntityInfoResetEnd() override;
         void OnEntityInfoUpdatedAddChildEnd(AZ::EntityId parentId, AZ::EntityId childId) override;
         void OnEntityInfoUpdatedRemoveChildEnd(AZ::EntityId parentId, AZ::EntityId childId) override;
 
@@ -98,6 +98,8 @@ namespace AzToolsFramework
 
         void InstanceUpdateExecutor::AddTemplateInstancesToQueue(TemplateId instanceTemplateId, InstanceOptionalConstReference instanceToExclude)
         {
+            PrefabPublicNotificationBus::Broadcast(&PrefabPublicNotifications::OnPrefabTemplateChanged, instanceTemplateId);
+
             auto findInstancesResult =
                 m_templateInstanceMapperInterface->FindInstancesOwnedByTemplate(instanceTemplateId);
             if (!findInstancesResult.has_value())
@@ -175,6 +177,9 @@ namespace AzToolsFramework
                     EntityIdList selectedEntityIds;
                     ToolsApplicationRequestBus::BroadcastResult(selectedEntityIds, &ToolsApplicationRequests::GetSelectedEntities);
 
+                    // Instances reloaded in this batch. Reloading an instance also reloads its nested instances from the same DOM.
+                    AZStd::unordered_set<const Instance*> reloadedInstances;
+
                     // Process all instances in the queue, capped to the batch size.
                     // Even though we potentially initialized the batch size to the queue, it's possible for the queue size to shrink
                     // during instance processing if the instance gets deleted and it was queued multiple times.  To handle this, we
@@ -187,6 +192,14 @@ namespace AzToolsFramework
                         AZ_Assert(instanceToUpdate != nullptr, "Invalid instance on update queue.");
                         m_uniqueInstancesForPropagation.erase(instanceToUpdate);
 
+                        // Changes to several templates in the same frame often queue an instance together with one of its
+                        // ancestors. Coalesce them by only reloading the ancestor, which already applies the changes to the
+                        // nested instances.
+                        if (IsCoveredByAncestorUpdate(*instanceToUpdate, reloadedInstances))
+                        {
+                            continue;
+                        }
+
                         TemplateId instanceTemplateId = instanceToUpdate->GetTemplateId();
                         if (currentTemplateId != instanceTemplateId)
                         {
@@ -240,6 +253,8 @@ namespace AzToolsFramework
                         if (PrefabDomUtils::LoadInstanceFromPrefabDom(*instanceToUpdate, newEntities, instanceDom,
                             PrefabDomUtils::LoadFlags::UseSelectiveDeserialization))
                         {
+                            reloadedInstances.emplace(instanceToUpdate);
+
                             Template& currentTemplate = currentTemplateReference->get();
                             instanceToUpdate->GetNestedInstances([&](AZStd::unique_ptr<Instance>& nestedInstance) 
                             {
@@ -305,6 +320,22 @@ namespace AzToolsFramework
             return isUpdateSuccessful;
         }
 
+        bool InstanceUpdateExecutor::IsCoveredByAncestorUpdate(
+            const Instance& instance, const AZStd::unordered_set<const Instance*>& reloadedInstances) const
+        {
+            for (InstanceOptionalConstReference ancestor = instance.GetParentInstance(); ancestor.has_value();
+                 ancestor = ancestor->get().GetParentInstance())
+            {
+                const Instance* ancestorPtr = &(ancestor->get());
+                if (reloadedInstances.contains(ancestorPtr) ||
+                    m_uniqueInstancesForPropagation.contains(const_cast<Instance*>(ancestorPtr)))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
         void InstanceUpdateExecutor::QueueRootPrefabLoadedNotificationForNextPropagation()
         {
             m_isRootPrefabInstanceLoaded = false;
@@ -11,6 +11,7 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzFramework/Entity/EntityContext.h>
 #include <AzToolsFramework/Entity/PrefabEditorEntityOwnershipService.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceUpdateExecutorInterface.h>
@@ -54,6 +55,10 @@ namespace AzToolsFramework
 
             void AddInstanceToQueue(Instance* instance);
 
+            //! Returns true if an ancestor of the instance was reloaded in the current batch or is still waiting in the queue,
+            //! in which case reloading the instance itself is redundant.
+            bool IsCoveredByAncestorUpdate(const Instance& instance, const AZStd::unordered_set<const Instance*>& reloadedInstances) const;
+
             PrefabSystemComponentInterface* m_prefabSystemComponentInterface = nullptr;
             TemplateInstanceMapperInterface* m_templateInstanceMapperInterface = nullptr;
             InstanceDomGeneratorInterface* m_instanceDomGeneratorInterface = nullptr;
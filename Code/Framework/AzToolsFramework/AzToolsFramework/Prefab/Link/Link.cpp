@@ -137,9 +137,9 @@ namespace AzToolsFramework
             return areOverridesPresent;
         }
 
-        PrefabDomConstReference Link::GetOverridePatchAtExactPath(AZ::Dom::Path path) const
+        AZStd::optional<AZ::Dom::Value> Link::GetOverridePatchAtExactPath(AZ::Dom::Path path) const
         {
-            PrefabDomConstReference overridePatch = {};
+            AZStd::optional<AZ::Dom::Value> overridePatch = {};
             const PrefabOverrideMetadata* overrideData = m_linkPatchesTree.ValueAtPath(path, AZ::Dom::PrefixTreeMatch::ExactPath);
             if (overrideData)
             {
@@ -305,14 +305,11 @@ namespace AzToolsFramework
                 rapidjson::GenericArray patchesArray = patches.GetArray();
                 for (rapidjson::SizeType i = 0; i < patchesArray.Size(); i++)
                 {
-                    PrefabDom patchEntry;
-                    patchEntry.CopyFrom(patchesArray[i], patchEntry.GetAllocator());
-
-                    auto pathIter = patchEntry.FindMember("path");
-                    if (pathIter != patchEntry.MemberEnd())
+                    auto pathIter = patchesArray[i].FindMember("path");
+                    if (pathIter != patchesArray[i].MemberEnd())
                     {
                         AZ::Dom::Path domPath(pathIter->value.GetString());
-                        PrefabOverrideMetadata overrideMetadata(AZStd::move(patchEntry), m_patchIndexCounter++);
+                        PrefabOverrideMetadata overrideMetadata(PrefabDomUtils::ConvertToDomValue(patchesArray[i]), m_patchIndexCounter++);
                         m_linkPatchesTree.SetValue(domPath, AZStd::move(overrideMetadata));
                     }
                 }
@@ -336,14 +333,16 @@ namespace AzToolsFramework
                 return true;
             };
 
-            patchesDom.SetArray();
             m_linkPatchesTree.VisitPath(AZ::Dom::Path(), visitorFn, AZ::Dom::PrefixTreeTraversalFlags::ExcludeExactPath);
 
+            // Gather the patches in a single array, which only shares their contents, and convert it all at once.
+            AZ::Dom::Value patchesArray(AZ::Dom::Type::Array);
+            patchesArray.ArrayReserve(patchesSet.size());
             for (auto patchesSetIterator = patchesSet.begin(); patchesSetIterator != patchesSet.end(); ++patchesSetIterator)
             {
-                PrefabDomValue patch((*patchesSetIterator)->m_patch, allocator);
-                patchesDom.PushBack(patch.Move(), allocator);
+                patchesArray.ArrayPushBack((*patchesSetIterator)->m_patch);
             }
+            PrefabDomUtils::ConvertToPrefabDomValue(patchesArray, patchesDom, allocator);
         }
 
     } // namespace Prefab
@@ -10,6 +10,7 @@
 
 #include <AzCore/Debug/Budget.h>
 #include <AzCore/DOM/DomPrefixTree.h>
+#include <AzCore/DOM/DomValue.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzToolsFramework/Prefab/PrefabDomTypes.h>
@@ -41,7 +42,7 @@ namespace AzToolsFramework
                 AZ_RTTI(PrefabOverrideMetadata, "{03A2996F-8E93-4D78-B13B-A30AE5E778A4}");
                 virtual ~PrefabOverrideMetadata() = default;
 
-                PrefabOverrideMetadata(PrefabDom&& patch, AZ::u32 patchIndex) noexcept
+                PrefabOverrideMetadata(AZ::Dom::Value&& patch, AZ::u32 patchIndex) noexcept
                     : m_patch(AZStd::move(patch))
                     , m_patchIndex(patchIndex)
                 {
@@ -70,7 +71,9 @@ namespace AzToolsFramework
                 }
 
                 // An individual patch that can get applied to the target template of the link.
-                PrefabDom m_patch;
+                // Stored as an AZ::Dom::Value so that copies of the patch, like the ones captured for undo, share its contents
+                // instead of each holding a separate document.
+                AZ::Dom::Value m_patch;
 
                 // The patch index to associate with each individual patch. This is needed to maintain the order of patches within a link.
                 AZ::u32 m_patchIndex;
@@ -121,7 +124,7 @@ namespace AzToolsFramework
             //! Gets an override patch at the exact provided path
             //! @param path The path to get override for.
             //! @return an override patch if an override is present at the exact provided path.
-            PrefabDomConstReference GetOverridePatchAtExactPath(AZ::Dom::Path path) const;
+            AZStd::optional<AZ::Dom::Value> GetOverridePatchAtExactPath(AZ::Dom::Path path) const;
             
             //! Removes overrides at the provided path and all the nodes under it from the override tree
             //! @param path The path at which the overrides should be removed from
@@ -48,12 +48,12 @@
             if (link.has_value())
             {
                 // Look for an override at the exact provided path
-                if (PrefabDomConstReference overridePatch = link->get().GetOverridePatchAtExactPath(path); overridePatch.has_value())
+                if (AZStd::optional<AZ::Dom::Value> overridePatch = link->get().GetOverridePatchAtExactPath(path); overridePatch.has_value())
                 {
-                    PrefabDomValue::ConstMemberIterator patchEntryIterator = overridePatch->get().FindMember("op");
-                    if (patchEntryIterator != overridePatch->get().MemberEnd())
+                    auto patchEntryIterator = overridePatch->FindMember("op");
+                    if (patchEntryIterator != overridePatch->MemberEnd())
                     {
-                        AZStd::string opPath = patchEntryIterator->value.GetString();
+                        AZStd::string_view opPath = patchEntryIterator->second.GetString();
                         if (opPath == "remove")
                         {
                             patchType = PatchType::Remove;
@@ -139,9 +139,9 @@
                 [&undoBatch, &targetInstance, relativePath](
                     [[maybe_unused]] const AZ::Dom::Path& path, [[maybe_unused]] Link::PrefabOverrideMetadata& metaData) -> bool
                 {
-                    const auto& overridePath = metaData.m_patch.FindMember("path")->value;
-
-                    AZStd::string overridePathStr = overridePath.GetString();
+                    // Read through a const reference so that the shared patch contents aren't copied.
+                    const AZ::Dom::Value& patch = metaData.m_patch;
+                    AZStd::string overridePathStr = patch["path"].GetString();
                     if (overridePathStr.starts_with(relativePath))
                     {
                         overridePathStr = overridePathStr.substr(relativePath.length());
@@ -150,7 +150,9 @@
                     // Apply individual overrides to target prefab template.
                     PrefabUndoComponentPropertyEdit* state = aznew PrefabUndoComponentPropertyEdit("Apply Override");
                     state->SetParent(undoBatch.GetUndoBatch());
-                    state->Capture(targetInstance->get(), AZ::Dom::Path(overridePathStr).ToString(), metaData.m_patch.FindMember("value")->value);
+                    PrefabDom overrideValue;
+                    PrefabDomUtils::ConvertToPrefabDomValue(patch["value"], overrideValue, overrideValue.GetAllocator());
+                    state->Capture(targetInstance->get(), AZ::Dom::Path(overridePathStr).ToString(), overrideValue);
                     state->Redo();
 
                     return true;
@@ -216,21 +218,17 @@
                     // by simply removing the relative path from source to target link from the beginning of the path.
 
                     // Copy the patch so that subTree is untouched and can be used for undo/redo.
-                    PrefabDom newPatch;
-                    newPatch.CopyFrom(metaData.m_patch, newPatch.GetAllocator());
+                    // The copy shares its contents with the original patch, only the modified path is duplicated.
+                    AZ::Dom::Value newPatch = metaData.m_patch;
 
-                    auto& overridePath = newPatch.FindMember("path")->value;
-                    AZStd::string overridePathStr = overridePath.GetString();
+                    AZStd::string overridePathStr = metaData.m_patch.FindMember("path")->second.GetString();
                     if (overridePathStr.starts_with(relativePath))
                     {
                         overridePathStr = overridePathStr.substr(relativePath.length());
                     }
 
-                    overridePath.SetString(
-                        overridePathStr.c_str(),
-                        static_cast<rapidjson::SizeType>(overridePathStr.length()),
-                        newPatch.GetAllocator()
-                    );
+                    const bool copyString = true;
+                    newPatch["path"] = AZ::Dom::Value(overridePathStr, copyString);
 
                     // We copy the paths to newOverrides, which is what will be added to the target link.
                     newOverrides.SetValue<Link::PrefabOverrideMetadata>(
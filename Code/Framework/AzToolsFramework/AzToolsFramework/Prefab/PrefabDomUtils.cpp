@@ -8,6 +8,7 @@
 
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Asset/AssetJsonSerializer.h>
+#include <AzCore/DOM/Backends/JSON/JsonSerializationUtils.h>
 #include <AzCore/JSON/prettywriter.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Component/EntitySerializer.h>
@@ -545,6 +546,34 @@ namespace AzToolsFramework
                 return prefabBuffer.GetString();
             }
 
+            AZ::Dom::Value ConvertToDomValue(const PrefabDomValue& prefabDomValue)
+            {
+                AZ::Dom::Value domValue;
+                AZStd::unique_ptr<AZ::Dom::Visitor> domWriter = domValue.GetWriteHandler();
+                [[maybe_unused]] AZ::Dom::Visitor::Result result =
+                    AZ::Dom::Json::VisitRapidJsonValue(prefabDomValue, *domWriter, AZ::Dom::Lifetime::Temporary);
+                AZ_Assert(result.IsSuccess(), "PrefabDomUtils::ConvertToDomValue - Failed to convert prefab DOM value.");
+                return domValue;
+            }
+
+            void ConvertToPrefabDomValue(const AZ::Dom::Value& domValue, PrefabDomValue& prefabDomValue, PrefabDomAllocator& allocator)
+            {
+                // Keys are written as references to the name dictionary, so write to a scratch DOM first and then deep copy it,
+                // which makes the target allocator own all the strings.
+                PrefabDom scratchDom;
+                [[maybe_unused]] AZ::Dom::Visitor::Result result = AZ::Dom::Json::WriteToRapidJsonValue(
+                    scratchDom, scratchDom.GetAllocator(),
+                    [&domValue](AZ::Dom::Visitor& visitor)
+                    {
+                        const bool copyStrings = false;
+                        return domValue.Accept(visitor, copyStrings);
+                    });
+                AZ_Assert(result.IsSuccess(), "PrefabDomUtils::ConvertToPrefabDomValue - Failed to convert DOM value.");
+
+                const bool copyConstStrings = true;
+                prefabDomValue.CopyFrom(scratchDom, allocator, copyConstStrings);
+            }
+
             void AddNestedInstance(
                 PrefabDom& prefabDom,
                 const InstanceAlias& nestedInstanceAlias,
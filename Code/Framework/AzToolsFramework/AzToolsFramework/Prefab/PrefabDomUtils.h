@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/DOM/DomValue.h>
 #include <AzCore/Serialization/Json/JsonSerializationResult.h>
 #include <AzCore/std/optional.h>
 #include <AzCore/Asset/AssetCommon.h>
@@ -214,6 +215,19 @@ namespace AzToolsFramework
 
             AZStd::string PrefabDomValueToString(const PrefabDomValue& prefabDomValue);
 
+            //! Converts a prefab DOM value to an AZ::Dom::Value.
+            //! Copies of an AZ::Dom::Value share their contents until modified, so this is preferred for storing DOMs that get copied
+            //! around but rarely change, like override patches.
+            //! @param prefabDomValue The prefab DOM value to convert.
+            //! @return The converted value.
+            AZ::Dom::Value ConvertToDomValue(const PrefabDomValue& prefabDomValue);
+
+            //! Converts an AZ::Dom::Value to a prefab DOM value.
+            //! @param domValue The value to convert.
+            //! @param prefabDomValue The prefab DOM value to write to, its contents will be overridden.
+            //! @param allocator The allocator that owns prefabDomValue, all strings are copied into it.
+            void ConvertToPrefabDomValue(const AZ::Dom::Value& domValue, PrefabDomValue& prefabDomValue, PrefabDomAllocator& allocator);
+
             //! Adds a nested instance to the prefab DOM and optionally initialize its contents.
             //! @param prefabDom The prefab DOM to udpate.
             //! @param nestedInstanceAlias The alias of the nested instance to be added.
@@ -9,11 +9,15 @@
 #include <AzToolsFramework/Prefab/PrefabLoader.h>
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/StringFunc/StringFunc.h>
 #include <AzCore/Utils/Utils.h>
+#include <AzCore/std/optional.h>
 
 #include <AzFramework/Asset/AssetSystemBus.h>
 #include <AzToolsFramework/API/EditorAssetSystemAPI.h>
@@ -24,6 +28,14 @@
 #include <Prefab/ProceduralPrefabSystemComponentInterface.h>
 #include <AzToolsFramework/Entity/PrefabEditorEntityOwnershipInterface.h>
 
+AZ_CVAR(
+    bool,
+    ed_prefabPrefetchNestedFiles,
+    true,
+    nullptr,
+    AZ::ConsoleFunctorFlags::DontReplicate | AZ::ConsoleFunctorFlags::DontDuplicate,
+    "If set, the nested prefab files of a loaded prefab are read and parsed in parallel on the job threads before their templates are created");
+
 namespace AzToolsFramework
 {
     namespace Prefab
@@ -365,6 +377,12 @@ namespace AzToolsFramework
                 return InvalidTemplateId;
             }
 
+            // The file was already read and parsed if it was prefetched by the outermost load
+            if (!m_prefetchedPrefabDoms.empty() && m_prefetchedPrefabDoms.find(GenerateRelativePath(filePath)) != m_prefetchedPrefabDoms.end())
+            {
+                return LoadTemplateFromString({}, filePath, progressedFilePathsSet);
+            }
+
             auto readResult = AZ::Utils::ReadFile(GetFullPath(filePath).Native(), AZStd::numeric_limits<size_t>::max());
             if (!readResult.IsSuccess())
             {
@@ -428,8 +446,17 @@ namespace AzToolsFramework
                 return loadedTemplateId;
             }
 
-            // Read Template's prefab file from disk and parse Prefab DOM from file.
-            AZ::Outcome<PrefabDom, AZStd::string> readPrefabFileResult = AZ::JsonSerializationUtils::ReadJsonString(fileContent);
+            // Read Template's prefab file from disk and parse Prefab DOM from file, unless it was prefetched.
+            AZ::Outcome<PrefabDom, AZStd::string> readPrefabFileResult = AZ::Failure(AZStd::string());
+            if (auto prefetchedIterator = m_prefetchedPrefabDoms.find(relativePath); prefetchedIterator != m_prefetchedPrefabDoms.end())
+            {
+                readPrefabFileResult = AZ::Success(AZStd::move(prefetchedIterator->second));
+                m_prefetchedPrefabDoms.erase(prefetchedIterator);
+            }
+            else
+            {
+                readPrefabFileResult = AZ::JsonSerializationUtils::ReadJsonString(fileContent);
+            }
             if (!readPrefabFileResult.IsSuccess())
             {
                 AZ_Error(
@@ -479,6 +506,7 @@ namespace AzToolsFramework
             }
 
             // Mark the file as being in progress.
+            const bool isOutermostLoad = progressedFilePathsSet.empty();
             progressedFilePathsSet.emplace(relativePath);
 
             // Get 'Instances' value from Template.
@@ -488,6 +516,11 @@ namespace AzToolsFramework
             {
                 PrefabDomValue& instances = instancesReference->get();
 
+                if (isOutermostLoad && ed_prefabPrefetchNestedFiles)
+                {
+                    PrefetchNestedPrefabFiles(instances);
+                }
+
                 // For each instance value in 'instances', try to create source Templates for target Template's nested instance data.
                 // Also create Links between source/target Templates if source Template loaded successfully.
                 for (PrefabDomValue::MemberIterator instanceIterator = instances.MemberBegin(); instanceIterator != instances.MemberEnd();
@@ -514,10 +547,114 @@ namespace AzToolsFramework
             // Un-mark the file as being in progress.
             progressedFilePathsSet.erase(originPath);
 
+            if (isOutermostLoad)
+            {
+                // Drop the prefetched files that weren't used, e.g. the ones of a branch that failed to load
+                m_prefetchedPrefabDoms.clear();
+            }
+
             // Return target Template id.
             return newTemplateId;
         }
 
+        void PrefabLoader::PrefetchNestedPrefabFiles(const PrefabDomValue& instances)
+        {
+            AZStd::unordered_set<AZ::IO::Path> visitedPaths;
+            AZStd::vector<AZ::IO::Path> relativePaths;
+            AZStd::vector<AZ::IO::Path> fullPaths;
+
+            // The paths are resolved on this thread, they go through the asset system buses
+            auto collectNestedPrefabFiles = [this, &visitedPaths, &relativePaths, &fullPaths](const PrefabDomValue& nestedInstances)
+            {
+                if (!nestedInstances.IsObject())
+                {
+                    return;
+                }
+
+                for (auto instanceIterator = nestedInstances.MemberBegin(); instanceIterator != nestedInstances.MemberEnd(); ++instanceIterator)
+                {
+                    PrefabDomValueConstReference sourceReference =
+                        PrefabDomUtils::FindPrefabDomValue(instanceIterator->value, PrefabDomUtils::SourceName);
+                    if (!sourceReference.has_value() || !sourceReference->get().IsString() || sourceReference->get().GetStringLength() == 0)
+                    {
+                        // LoadNestedInstance reports the invalid instances
+                        continue;
+                    }
+
+                    AZStd::string_view sourcePath(sourceReference->get().GetString(), sourceReference->get().GetStringLength());
+                    if (!IsValidPrefabPath(sourcePath))
+                    {
+                        continue;
+                    }
+
+                    AZ::IO::Path relativePath = GenerateRelativePath(sourcePath);
+                    if (visitedPaths.contains(relativePath) ||
+                        m_prefabSystemComponentInterface->GetTemplateIdFromFilePath(relativePath) != InvalidTemplateId)
+                    {
+                        continue;
+                    }
+
+                    visitedPaths.emplace(relativePath);
+                    fullPaths.push_back(GetFullPath(sourcePath));
+                    relativePaths.push_back(AZStd::move(relativePath));
+                }
+            };
+
+            collectNestedPrefabFiles(instances);
+
+            // Each pass reads and parses the files of one nesting level, their own nested instances make the next pass
+            while (!relativePaths.empty())
+            {
+                AZStd::vector<AZ::IO::Path> passRelativePaths = AZStd::move(relativePaths);
+                AZStd::vector<AZ::IO::Path> passFullPaths = AZStd::move(fullPaths);
+                relativePaths.clear();
+                fullPaths.clear();
+
+                // Failures are left for the regular load to report
+                AZStd::vector<AZStd::optional<PrefabDom>> prefabDoms(passFullPaths.size());
+                auto readPrefabFile = [&passFullPaths, &prefabDoms](int fileIndex)
+                {
+                    auto readResult = AZ::Utils::ReadFile(passFullPaths[fileIndex].Native(), AZStd::numeric_limits<size_t>::max());
+                    if (readResult.IsSuccess())
+                    {
+                        AZ::Outcome<PrefabDom, AZStd::string> parseResult = AZ::JsonSerializationUtils::ReadJsonString(readResult.GetValue());
+                        if (parseResult.IsSuccess())
+                        {
+                            prefabDoms[fileIndex] = parseResult.TakeValue();
+                        }
+                    }
+                };
+
+                const int fileCount = static_cast<int>(passFullPaths.size());
+                if (fileCount > 1 && AZ::JobContext::GetGlobalContext())
+                {
+                    AZ::parallel_for(0, fileCount, readPrefabFile);
+                }
+                else
+                {
+                    for (int fileIndex = 0; fileIndex < fileCount; ++fileIndex)
+                    {
+                        readPrefabFile(fileIndex);
+                    }
+                }
+
+                for (int fileIndex = 0; fileIndex < fileCount; ++fileIndex)
+                {
+                    if (prefabDoms[fileIndex].has_value())
+                    {
+                        PrefabDom& prefabDom = prefabDoms[fileIndex].value();
+                        if (PrefabDomValueConstReference nestedInstances =
+                                PrefabDomUtils::FindPrefabDomValue(static_cast<const PrefabDomValue&>(prefabDom), PrefabDomUtils::InstancesName);
+                            nestedInstances.has_value())
+                        {
+                            collectNestedPrefabFiles(nestedInstances->get());
+                        }
+                        m_prefetchedPrefabDoms.emplace(AZStd::move(passRelativePaths[fileIndex]), AZStd::move(prefabDom));
+                    }
+                }
+            }
+        }
+
         bool PrefabLoader::LoadNestedInstance(
             PrefabDomValue::MemberIterator& instanceIterator, TemplateId targetTemplateId,
             AZStd::unordered_set<AZ::IO::Path>& progressedFilePathsSet)
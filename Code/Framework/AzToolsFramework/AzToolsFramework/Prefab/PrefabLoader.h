@@ -12,6 +12,7 @@
 
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/string/string.h>
 #include <AzToolsFramework/Prefab/PrefabDomTypes.h>
@@ -175,6 +176,14 @@ namespace AzToolsFramework
                 AZ::IO::PathView filePath,
                 AZStd::unordered_set<AZ::IO::Path>& progressedFilePathsSet);
 
+            /**
+             * Read and parse the prefab files of the nested instances that aren't loaded yet on the job threads, one nesting level
+             * at a time, and keep their Prefab DOMs for the Templates to be created from. The Templates and Links are still
+             * created in order by LoadNestedInstance.
+             * @param instances The 'Instances' value of the Template being loaded.
+             */
+            void PrefetchNestedPrefabFiles(const PrefabDomValue& instances);
+
             /**
              * Load nested instance given a nested instance value iterator and target Template with its id.
              * @param instanceIterator A nested instance value iterator.
@@ -208,6 +217,9 @@ namespace AzToolsFramework
             ScriptingPrefabLoader m_scriptingPrefabLoader;
             AZ::IO::Path m_projectPathWithOsSeparator;
             AZ::IO::Path m_projectPathWithSlashSeparator;
+
+            //! Prefab DOMs of the nested prefab files prefetched by the outermost load, by relative path.
+            AZStd::unordered_map<AZ::IO::Path, PrefabDom> m_prefetchedPrefabDoms;
         };
     } // namespace Prefab
 } // namespace AzToolsFramework
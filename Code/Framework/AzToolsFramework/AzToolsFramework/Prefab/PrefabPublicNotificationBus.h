@@ -28,6 +28,10 @@ namespace AzToolsFramework
             virtual void OnPrefabTemplateDirtyFlagUpdated(
                 [[maybe_unused]] TemplateId templateId, [[maybe_unused]] bool status) {}
 
+            // Sent when a template has changed and its instances are queued for an update.
+            // Templates that only changed because a template nested in them changed don't get this event themselves.
+            virtual void OnPrefabTemplateChanged([[maybe_unused]] TemplateId templateId) {}
+
             // Sent after a single template has been removed
             // Does not get sent when all templates are being removed at once.  Be sure to handle OnAllTemplatesRemoved as well.
             virtual void OnTemplateRemoved([[maybe_unused]] TemplateId templateId) {}
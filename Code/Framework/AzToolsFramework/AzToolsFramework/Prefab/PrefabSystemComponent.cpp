@@ -360,9 +360,16 @@ namespace AzToolsFramework
             TemplateId targetTemplateId = linkToUpdate.GetTargetTemplateId();
             PrefabDomValue& linkedInstanceDom = linkToUpdate.GetLinkedInstanceDom();
 
+            // Once one link has been found to modify the target template, the remaining links of the same target don't need to be
+            // compared, so skip copying their DOM. This matters for templates holding many instances of the same prefab.
+            bool isTemplateUpdated = targetTemplateIdToLinkIdMap[targetTemplateId].second;
+
             // create an empty Dom to hold the temp allocations so they are cleared when we leave this scope:
-            PrefabDom linkedDomBeforeUpdate; 
-            linkedDomBeforeUpdate.CopyFrom(linkedInstanceDom, linkedDomBeforeUpdate.GetAllocator());
+            PrefabDom linkedDomBeforeUpdate;
+            if (!isTemplateUpdated)
+            {
+                linkedDomBeforeUpdate.CopyFrom(linkedInstanceDom, linkedDomBeforeUpdate.GetAllocator());
+            }
 
             // the following call modifies the linkedInstanceDom to have the updated changes.
             // Most of the time, this modifies the actual linkedInstanceDom to have patches.
@@ -379,9 +386,11 @@ namespace AzToolsFramework
             // from before in targetTemplateIdToLinkIdMap[targetTemplateId].second.  This also means that if
             // targetTemplateIdToLinkIdMap[targetTemplateId].second is true, there is no need to compare it again, as it will have
             // already added its links to the queue.
-            
-            bool isTemplateUpdated = targetTemplateIdToLinkIdMap[targetTemplateId].second;
-            if (!isTemplateUpdated || AZ::JsonSerialization::Compare(linkedDomBeforeUpdate, linkedInstanceDom) != AZ::JsonSerializerCompareResult::Equal)
+            // The target template is only marked as updated when one of its links changed its linked instance DOM. A target
+            // template whose linked instances are all unchanged is not modified, so the propagation stops there: its own links
+            // are not queued and it is not garbage collected. Until one link is found to change the target, each link is compared.
+            if (!isTemplateUpdated &&
+                AZ::JsonSerialization::Compare(linkedDomBeforeUpdate, linkedInstanceDom) != AZ::JsonSerializerCompareResult::Equal)
             {
                 targetTemplateIdToLinkIdMap[targetTemplateId].second = true;
             }
@@ -44,8 +44,14 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         ~AssetPlatformComponentRemover() override = default;
 
         void Process(PrefabProcessorContext& prefabProcessorContext) override;
+        bool IsParallelSafe() const override;
+        void ProcessDocument(PrefabProcessorContext& prefabProcessorContext, PrefabDocument& prefab) override;
 
     private:
+        AZStd::set<AZ::Uuid> GetExcludedComponents(const AZ::PlatformTagSet& platformTags) const;
+        static void RemoveExcludedComponents(
+            PrefabProcessorContext& prefabProcessorContext, PrefabDocument& prefab, const AZStd::set<AZ::Uuid>& excludedComponents);
+
         AZStd::map<AZStd::string, AZStd::set<AZ::Uuid>> m_platformExcludedComponents;
     };
 } // namespace AzToolsFramework::Prefab::PrefabConversionUtils
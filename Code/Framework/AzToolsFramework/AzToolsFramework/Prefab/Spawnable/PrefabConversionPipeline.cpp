@@ -54,8 +54,21 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         for (auto&& [name, processor] : m_processors)
         {
             AZ_TraceContext("Processor", name);
-            processor->Process(context);
-        } 
+            if (processor->IsParallelSafe())
+            {
+                context.ListPrefabsInParallel(
+                    [&context, &processor = processor, &name = name](PrefabDocument& prefab)
+                    {
+                        // Trace contexts are per thread, so they need to be set up again on the task workers.
+                        AZ_TraceContext("Processor", name);
+                        processor->ProcessDocument(context, prefab);
+                    });
+            }
+            else
+            {
+                processor->Process(context);
+            }
+        }
         context.ResolveLinks();
     }
     size_t PrefabConversionPipeline::CalculateProcessorFingerprint(AZ::SerializeContext* context)
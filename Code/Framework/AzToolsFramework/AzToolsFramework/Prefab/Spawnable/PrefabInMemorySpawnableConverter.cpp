@@ -11,6 +11,9 @@
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Asset/AssetSerializer.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzToolsFramework/Prefab/Link/Link.h>
 #include <AzToolsFramework/Prefab/PrefabLoader.h>
 #include <AzToolsFramework/Prefab/PrefabSystemComponentInterface.h>
 #include <AzToolsFramework/Prefab/Spawnable/PrefabConverterStackProfileNames.h>
@@ -19,6 +22,15 @@
 #include <AzFramework/Spawnable/Spawnable.h>
 #include <AzFramework/Spawnable/SpawnableAssetBus.h>
 
+AZ_CVAR(
+    bool,
+    ed_incrementalInMemorySpawnables,
+    true,
+    nullptr,
+    AZ::ConsoleFunctorFlags::DontReplicate | AZ::ConsoleFunctorFlags::DontDuplicate,
+    "If set, in-memory spawnables such as the ones used for game mode in the editor are only converted again if their prefab "
+    "or one of its nested prefabs changed since the last conversion.");
+
 namespace AzToolsFramework::Prefab::PrefabConversionUtils
 {
     PrefabInMemorySpawnableConverter::~PrefabInMemorySpawnableConverter()
@@ -38,11 +50,14 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         AZ_Assert(m_loaderInterface, "PrefabInMemorySpawnableConverter - Could not retrieve instance of PrefabLoaderInterface");
 
         m_stackProfile = stackProfile;
+        PrefabPublicNotificationBus::Handler::BusConnect();
         return m_converter.LoadStackProfile(m_stackProfile);
     }
 
     void PrefabInMemorySpawnableConverter::Deactivate()
     {
+        PrefabPublicNotificationBus::Handler::BusDisconnect();
+        m_cachedConversions.clear();
         m_assetContainer.ClearAllInMemorySpawnableAssets();
         m_stackProfile = "";
         m_loaderInterface = nullptr;
@@ -78,31 +93,42 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
             return AZ::Failure(AZStd::string::format("Could not get Template DOM for given Template's id %llu .", templateId));
         }
 
-        // Use a random uuid as this is only a temporary source.
-        PrefabConversionUtils::PrefabProcessorContext context(AZ::Uuid::CreateRandom());
-        PrefabDocument document(spawnableName);
-        document.SetPrefabDom(templateReference->get().GetPrefabDom());
-        context.AddPrefab(AZStd::move(document));
-        m_converter.ProcessPrefab(context);
-
-        if (!context.HasCompletedSuccessfully() || context.GetProcessedObjects().empty())
+        AzFramework::InMemorySpawnableAssetContainer::AssetDataInfoContainer assetDataInfoContainer;
+        if (!ed_incrementalInMemorySpawnables || !LoadCachedConversion(templateId, spawnableName, assetDataInfoContainer))
         {
-            return AZ::Failure(AZStd::string::format(
-                "Failed to convert the prefab into assets. Please confirm that the '%.*s' prefab processor stack is capable of producing a usable product asset.",
-                AZ_STRING_ARG(PrefabConversionUtils::IntegrationTests)));
+            // Use a random uuid as this is only a temporary source.
+            PrefabConversionUtils::PrefabProcessorContext context(AZ::Uuid::CreateRandom());
+            PrefabDocument document(spawnableName);
+            document.SetPrefabDom(templateReference->get().GetPrefabDom());
+            context.AddPrefab(AZStd::move(document));
+            m_converter.ProcessPrefab(context);
+
+            if (!context.HasCompletedSuccessfully() || context.GetProcessedObjects().empty())
+            {
+                return AZ::Failure(AZStd::string::format(
+                    "Failed to convert the prefab into assets. Please confirm that the '%.*s' prefab processor stack is capable of producing a usable product asset.",
+                    AZ_STRING_ARG(PrefabConversionUtils::IntegrationTests)));
+            }
+
+            if (ed_incrementalInMemorySpawnables)
+            {
+                CacheConversion(templateId, spawnableName, context);
+            }
+
+            // Convert products to in-memory spawnable assets
+            for (auto& product : context.GetProcessedObjects())
+            {
+                AZ::Data::AssetInfo info;
+                info.m_assetId = product.GetAsset().GetId();
+                info.m_assetType = product.GetAssetType();
+                info.m_relativePath = product.GetId();
+                AZ::Data::AssetData* assetData = product.ReleaseAsset().release();
+                assetDataInfoContainer.emplace_back(AZStd::make_pair(assetData, info));
+            }
         }
 
-        // Convert products to in-memory spawnable assets
-        AzFramework::InMemorySpawnableAssetContainer::AssetDataInfoContainer assetDataInfoContainer;
-        for (auto& product : context.GetProcessedObjects())
+        for (auto& [assetData, info] : assetDataInfoContainer)
         {
-            AZ::Data::AssetInfo info;
-            info.m_assetId = product.GetAsset().GetId();
-            info.m_assetType = product.GetAssetType();
-            info.m_relativePath = product.GetId();
-            AZ::Data::AssetData* assetData = product.ReleaseAsset().release();
-            assetDataInfoContainer.emplace_back(AZStd::make_pair(assetData, info));
-
             if (info.m_assetType == azrtti_typeid<AzFramework::Spawnable>())
             {
                 auto spawnable = azrtti_cast<AzFramework::Spawnable*>(assetData);
@@ -137,4 +163,114 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
     {
         return m_assetContainer;
     }
+
+    void PrefabInMemorySpawnableConverter::OnPrefabTemplateChanged(TemplateId templateId)
+    {
+        InvalidateCachedConversions(templateId);
+    }
+
+    void PrefabInMemorySpawnableConverter::OnTemplateRemoved(TemplateId templateId)
+    {
+        InvalidateCachedConversions(templateId);
+    }
+
+    void PrefabInMemorySpawnableConverter::OnAllTemplatesRemoved()
+    {
+        m_cachedConversions.clear();
+    }
+
+    void PrefabInMemorySpawnableConverter::InvalidateCachedConversions(TemplateId templateId)
+    {
+        AZStd::erase_if(
+            m_cachedConversions,
+            [templateId](const auto& cachedConversion)
+            {
+                return cachedConversion.second.m_templateIds.contains(templateId);
+            });
+    }
+
+    void PrefabInMemorySpawnableConverter::GatherTemplateIds(TemplateId templateId, AZStd::unordered_set<TemplateId>& templateIds) const
+    {
+        if (!templateIds.insert(templateId).second)
+        {
+            return;
+        }
+
+        TemplateReference templateReference = m_prefabSystemComponentInterface->FindTemplate(templateId);
+        if (templateReference.has_value())
+        {
+            for (LinkId linkId : templateReference->get().GetLinks())
+            {
+                LinkReference link = m_prefabSystemComponentInterface->FindLink(linkId);
+                if (link.has_value())
+                {
+                    GatherTemplateIds(link->get().GetSourceTemplateId(), templateIds);
+                }
+            }
+        }
+    }
+
+    void PrefabInMemorySpawnableConverter::CacheConversion(
+        TemplateId templateId, AZStd::string_view spawnableName, const PrefabProcessorContext& context)
+    {
+        CachedConversion cachedConversion;
+        cachedConversion.m_templateId = templateId;
+        for (const ProcessedObjectStore& product : context.GetProcessedObjects())
+        {
+            // Only spawnables can be loaded back from their serialized form, so other products always need a full conversion.
+            CachedConversion::Product& cachedProduct = cachedConversion.m_products.emplace_back();
+            if (product.GetAssetType() != azrtti_typeid<AzFramework::Spawnable>() || !product.Serialize(cachedProduct.m_data))
+            {
+                return;
+            }
+            cachedProduct.m_info.m_assetId = product.GetAsset().GetId();
+            cachedProduct.m_info.m_assetType = product.GetAssetType();
+            cachedProduct.m_info.m_relativePath = product.GetId();
+        }
+        GatherTemplateIds(templateId, cachedConversion.m_templateIds);
+
+        m_cachedConversions.insert_or_assign(AZStd::string(spawnableName), AZStd::move(cachedConversion));
+    }
+
+    bool PrefabInMemorySpawnableConverter::LoadCachedConversion(
+        TemplateId templateId,
+        AZStd::string_view spawnableName,
+        AzFramework::InMemorySpawnableAssetContainer::AssetDataInfoContainer& assetDataInfoContainer) const
+    {
+        auto cachedConversion = m_cachedConversions.find(AZStd::string(spawnableName));
+        if (cachedConversion == m_cachedConversions.end() || cachedConversion->second.m_templateId != templateId)
+        {
+            return false;
+        }
+
+        // The loaded products keep the asset ids of the conversion they were cached from, so entity aliases between them stay valid.
+        // Those ids can only be reused once the assets from the previous conversion have been released.
+        for (const CachedConversion::Product& product : cachedConversion->second.m_products)
+        {
+            if (AZ::Data::AssetManager::Instance().FindAsset(product.m_info.m_assetId, AZ::Data::AssetLoadBehavior::Default))
+            {
+                return false;
+            }
+        }
+
+        AZ::ObjectStream::FilterDescriptor filter(&AZ::Data::AssetFilterNoAssetLoading);
+        for (const CachedConversion::Product& product : cachedConversion->second.m_products)
+        {
+            auto spawnable = aznew AzFramework::Spawnable(product.m_info.m_assetId, AZ::Data::AssetData::AssetStatus::Ready);
+            if (!AZ::Utils::LoadObjectFromBufferInPlace(product.m_data.data(), product.m_data.size(), *spawnable, nullptr, filter))
+            {
+                AZ_Warning("Prefab", false, "Failed to load cached spawnable '%s', converting the prefab again.",
+                    product.m_info.m_relativePath.c_str());
+                delete spawnable;
+                for (auto& loadedProduct : assetDataInfoContainer)
+                {
+                    delete loadedProduct.first;
+                }
+                assetDataInfoContainer.clear();
+                return false;
+            }
+            assetDataInfoContainer.emplace_back(spawnable, product.m_info);
+        }
+        return true;
+    }
 } // namespace AzToolsFramework::Prefab::PrefabConversionUtils
@@ -8,9 +8,14 @@
 
 #pragma once
 
+#include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
+#include <AzToolsFramework/Prefab/PrefabPublicNotificationBus.h>
 #include <AzToolsFramework/Prefab/Spawnable/PrefabConversionPipeline.h>
 #include <AzFramework/Spawnable/InMemorySpawnableAssetContainer.h>
 
@@ -22,7 +27,11 @@ namespace AzToolsFramework::Prefab
 
 namespace AzToolsFramework::Prefab::PrefabConversionUtils
 {
+    //! Converts prefabs into spawnables that only exist in memory, for instance to enter game mode in the editor.
+    //! The products of converting a template are kept in serialized form and reused for the next conversion of the same template,
+    //! until the template or one of the templates nested in it changes. This can be disabled with ed_incrementalInMemorySpawnables.
     class PrefabInMemorySpawnableConverter
+        : private PrefabPublicNotificationBus::Handler
     {
     public:
         AZ_CLASS_ALLOCATOR(PrefabInMemorySpawnableConverter, AZ::SystemAllocator);
@@ -47,6 +56,37 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         AzFramework::InMemorySpawnableAssetContainer& GetAssetContainer();
 
     private:
+        //! Products of a previous conversion, stored in serialized form so they can be loaded again as new assets.
+        struct CachedConversion
+        {
+            struct Product
+            {
+                AZ::Data::AssetInfo m_info;
+                AZStd::vector<uint8_t> m_data;
+            };
+
+            AZStd::vector<Product> m_products;
+            AZStd::unordered_set<TemplateId> m_templateIds; //!< The converted template and all templates nested in it.
+            TemplateId m_templateId = InvalidTemplateId;
+        };
+        using CachedConversions = AZStd::unordered_map<AZStd::string, CachedConversion>;
+
+        //! PrefabPublicNotificationBus overrides
+        //! @{
+        void OnPrefabTemplateChanged(TemplateId templateId) override;
+        void OnTemplateRemoved(TemplateId templateId) override;
+        void OnAllTemplatesRemoved() override;
+        //! @}
+
+        void InvalidateCachedConversions(TemplateId templateId);
+        void GatherTemplateIds(TemplateId templateId, AZStd::unordered_set<TemplateId>& templateIds) const;
+        void CacheConversion(TemplateId templateId, AZStd::string_view spawnableName, const PrefabProcessorContext& context);
+        bool LoadCachedConversion(
+            TemplateId templateId,
+            AZStd::string_view spawnableName,
+            AzFramework::InMemorySpawnableAssetContainer::AssetDataInfoContainer& assetDataInfoContainer) const;
+
+        CachedConversions m_cachedConversions;
         AzFramework::InMemorySpawnableAssetContainer m_assetContainer;
         PrefabConversionUtils::PrefabConversionPipeline m_converter;
         AZStd::string_view m_stackProfile;
@@ -23,5 +23,21 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         virtual ~PrefabProcessor() = default;
 
         virtual void Process(PrefabProcessorContext& context) = 0;
+
+        //! Returns true if the processor handles every PrefabDocument independently of the other documents in the context. In that case
+        //! the conversion pipeline calls ProcessDocument for several documents concurrently instead of calling Process. Parallel safe
+        //! processors may only modify the document they're given and can only use the thread safe functions of the context, which are
+        //! GetPlatformTags, GetSourceUuid, AddPrefab and ErrorEncountered.
+        virtual bool IsParallelSafe() const
+        {
+            return false;
+        }
+
+        //! Processes a single document. Only called if IsParallelSafe returns true.
+        virtual void ProcessDocument(
+            [[maybe_unused]] PrefabProcessorContext& context, [[maybe_unused]] PrefabDocument& prefab)
+        {
+            AZ_Assert(false, "Prefab processor '%s' is parallel safe but doesn't implement ProcessDocument.", RTTI_GetTypeName());
+        }
     };
 } // namespace AzToolsFramework::Prefab::PrefabConversionUtils
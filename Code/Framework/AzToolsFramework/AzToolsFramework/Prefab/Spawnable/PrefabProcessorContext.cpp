@@ -8,6 +8,8 @@
 
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Component/EntityUtils.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 #include <AzToolsFramework/Prefab/Spawnable/PrefabDocument.h>
 #include <AzToolsFramework/Prefab/Spawnable/PrefabProcessorContext.h>
@@ -41,6 +43,7 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
     bool PrefabProcessorContext::AddPrefab(PrefabDocument&& document)
     {
         AZStd::string name = document.GetName();
+        AZStd::scoped_lock lock(m_prefabAdditionMutex);
         if (!m_prefabNames.contains(name))
         {
             m_prefabNames.emplace(AZStd::move(name));
@@ -77,6 +80,41 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         }
     }
 
+    void PrefabProcessorContext::ListPrefabsInParallel(const AZStd::function<void(PrefabDocument&)>& callback)
+    {
+        // Waiting for tasks from a task worker could deadlock the executor, so in that case the prefabs are processed serially.
+        const AZ::TaskGraphActiveInterface* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (m_prefabs.size() < 2 || !taskGraphActive || !taskGraphActive->IsTaskGraphActive() ||
+            AZ::TaskExecutor::GetCurrentExecutor() != nullptr)
+        {
+            ListPrefabs(callback);
+            return;
+        }
+
+        m_isIterating = true;
+
+        static const AZ::TaskDescriptor processDescriptor{ "PrefabProcessorContext::ListPrefabsInParallel", "Prefab" };
+        AZ::TaskGraph graph{ "PrefabProcessing" };
+        for (PrefabDocument& document : m_prefabs)
+        {
+            graph.AddTask(
+                processDescriptor,
+                [&callback, &document]()
+                {
+                    callback(document);
+                });
+        }
+        AZ::TaskGraphEvent finishedEvent{ "PrefabProcessing Wait" };
+        graph.Submit(&finishedEvent);
+        finishedEvent.Wait();
+
+        m_isIterating = false;
+        m_prefabs.insert(
+            m_prefabs.end(), AZStd::make_move_iterator(m_pendingPrefabAdditions.begin()),
+            AZStd::make_move_iterator(m_pendingPrefabAdditions.end()));
+        m_pendingPrefabAdditions.clear();
+    }
+
     bool PrefabProcessorContext::HasPrefabs() const
     {
         return !m_prefabs.empty();
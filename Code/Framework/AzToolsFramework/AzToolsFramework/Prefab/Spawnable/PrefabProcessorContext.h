@@ -16,6 +16,8 @@
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzFramework/Spawnable/Spawnable.h>
@@ -51,6 +53,9 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         virtual bool AddPrefab(PrefabDocument&& document);
         virtual void ListPrefabs(const AZStd::function<void(PrefabDocument&)>& callback);
         virtual void ListPrefabs(const AZStd::function<void(const PrefabDocument&)>& callback) const;
+        //! Calls the callback for every prefab, processing several prefabs concurrently on the task executor if it's available.
+        //! Prefabs added from the callback are not visited, same as for ListPrefabs.
+        virtual void ListPrefabsInParallel(const AZStd::function<void(PrefabDocument&)>& callback);
         virtual bool HasPrefabs() const;
 
         virtual bool RegisterSpawnableProductAssetDependency(
@@ -107,7 +112,8 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
 
         AZ::PlatformTagSet m_platformTags;
         AZ::Uuid m_sourceUuid;
+        AZStd::mutex m_prefabAdditionMutex; //!< Guards adding prefabs while they're processed in parallel.
         bool m_isIterating{ false };
-        bool m_completedSuccessfully{ true };
+        AZStd::atomic_bool m_completedSuccessfully{ true };
     };
 } // namespace AzToolsFramework::Prefab::PrefabConversionUtils
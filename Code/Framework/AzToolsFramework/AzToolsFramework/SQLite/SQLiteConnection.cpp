@@ -111,6 +111,7 @@ namespace AzToolsFramework
                 FinalizeAll();
                 sqlite3_close(m_db);
                 m_db = NULL;
+                m_transactionDepth = 0;
             }
         }
 
@@ -221,7 +222,16 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+            if (m_transactionDepth == 0)
+            {
+                sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+            }
+            else
+            {
+                AZStd::string savepoint = AZStd::string::format("SAVEPOINT nested_%d;", m_transactionDepth);
+                sqlite3_exec(m_db, savepoint.c_str(), NULL, NULL, NULL);
+            }
+            ++m_transactionDepth;
         }
 
         void Connection::CommitTransaction()
@@ -231,7 +241,21 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+            AZ_Assert(m_transactionDepth > 0, "CommitTransaction:  No transaction is open!");
+            if (m_transactionDepth <= 0)
+            {
+                return;
+            }
+            --m_transactionDepth;
+            if (m_transactionDepth == 0)
+            {
+                sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+            }
+            else
+            {
+                AZStd::string release = AZStd::string::format("RELEASE nested_%d;", m_transactionDepth);
+                sqlite3_exec(m_db, release.c_str(), NULL, NULL, NULL);
+            }
         }
 
         void Connection::RollbackTransaction()
@@ -241,7 +265,22 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+            AZ_Assert(m_transactionDepth > 0, "RollbackTransaction:  No transaction is open!");
+            if (m_transactionDepth <= 0)
+            {
+                return;
+            }
+            --m_transactionDepth;
+            if (m_transactionDepth == 0)
+            {
+                sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+            }
+            else
+            {
+                // only undo the work of the inner transaction, the outer one stays open
+                AZStd::string rollback = AZStd::string::format("ROLLBACK TO nested_%d; RELEASE nested_%d;", m_transactionDepth, m_transactionDepth);
+                sqlite3_exec(m_db, rollback.c_str(), NULL, NULL, NULL);
+            }
         }
 
         void Connection::Vacuum()
@@ -54,6 +54,8 @@ namespace AzToolsFramework
             bool IsOpen() const;
 
             // ----- Transaction support -----
+            //! Transactions may be nested, inner transactions become savepoints of the outermost one
+            //! so callers can group many writes into a single commit without knowing what the callees do.
             void BeginTransaction();
             void CommitTransaction();
             void RollbackTransaction();
@@ -95,6 +97,7 @@ namespace AzToolsFramework
 
         private:
             sqlite3* m_db;
+            int m_transactionDepth = 0;
             typedef AZStd::unordered_map< AZStd::string, StatementPrototype* > StatementContainer;
             StatementContainer m_statementPrototypes;
         };
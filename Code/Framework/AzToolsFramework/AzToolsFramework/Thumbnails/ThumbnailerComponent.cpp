@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -19,6 +20,14 @@
 #include <QApplication>
 #include <QStyle>
 
+AZ_CVAR(
+    AZ::u32,
+    ed_thumbnailMaxConcurrentLoads,
+    8,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "Maximum number of thumbnails loaded at once, the other requests wait in a queue (0 for no limit)");
+
 namespace AzToolsFramework
 {
     namespace Thumbnailer
@@ -116,37 +125,13 @@ namespace AzToolsFramework
                         return m_loadingThumbnail;
                     }
 
-                    // If the thumbnail is not loaded then schedule it to be loaded using a job. Signals will be sent once the load is
+                    // If the thumbnail is not loaded then queue it to be loaded using a job. Signals will be sent once the load is
                     // complete to update the image.
                     if (thumbnail->GetState() == Thumbnail::State::Unloaded)
                     {
-                        // Connect thumbnailer component to the busy label repaint signal to notify the asset browser as it changes. 
-                        AzQtComponents::StyledBusyLabel* busyLabel = {};
-                        AssetBrowser::AssetBrowserComponentRequestBus::BroadcastResult(busyLabel, &AssetBrowser::AssetBrowserComponentRequests::GetStyledBusyLabel);
-                        QObject::connect(busyLabel, &AzQtComponents::StyledBusyLabel::repaintNeeded, m_placeholderObject.get(), [](){
-                            AssetBrowser::AssetBrowserViewRequestBus::Broadcast(&AssetBrowser::AssetBrowserViewRequests::Update);
-                        });
-
-                        // The ThumbnailUpdated signal should be sent whenever the thumbnail has loaded or failed. In both cases,
-                        // disconnect from all of the signals.
-                        QObject::connect(thumbnail.data(), &Thumbnail::ThumbnailUpdated, m_placeholderObject.get(), [this, key, thumbnail, busyLabel]()
-                            {
-                                QObject::disconnect(busyLabel, nullptr, m_placeholderObject.get(), nullptr);
-                                QObject::disconnect(thumbnail.data(), nullptr, key.data(), nullptr);
-
-                                QObject::connect(thumbnail.data(), &Thumbnail::ThumbnailUpdated, key.data(), &ThumbnailKey::ThumbnailUpdated);
-                                QObject::connect(key.data(), &ThumbnailKey::ThumbnailUpdateRequested, thumbnail.data(), &Thumbnail::Update);
-
-                                key->SetReady(true);
-                                m_thumbnailsBeingLoaded.erase(thumbnail);
-                                AssetBrowser::AssetBrowserViewRequestBus::Broadcast(&AssetBrowser::AssetBrowserViewRequests::Update);
-                            });
-
-                        // Add the thumbnail to the set of thumbnails in progress then queue the job to load it. The job will send the
-                        // ThumbnailUpdated signal from the main thread when complete.
                         m_thumbnailsBeingLoaded.insert(thumbnail);
-                        auto job = AZ::CreateJobFunction([thumbnail](){ thumbnail->Load(); }, true);
-                        job->Start();
+                        m_pendingThumbnailLoads.emplace_back(key, thumbnail);
+                        StartPendingThumbnailLoads();
                     }
 
                     return m_loadingThumbnail;
@@ -156,6 +141,60 @@ namespace AzToolsFramework
             return m_missingThumbnail;
         }
 
+        void ThumbnailerComponent::StartPendingThumbnailLoads()
+        {
+            // the most recent requests are loaded first, they are the thumbnails the views are currently showing
+            while (!m_pendingThumbnailLoads.empty() &&
+                   (ed_thumbnailMaxConcurrentLoads == 0 || m_runningThumbnailLoadCount < ed_thumbnailMaxConcurrentLoads))
+            {
+                auto [key, thumbnail] = AZStd::move(m_pendingThumbnailLoads.back());
+                m_pendingThumbnailLoads.pop_back();
+
+                // the thumbnail may have been loaded through another path while it was waiting
+                if (thumbnail->GetState() != Thumbnail::State::Unloaded)
+                {
+                    m_thumbnailsBeingLoaded.erase(thumbnail);
+                    continue;
+                }
+
+                StartThumbnailLoad(key, thumbnail);
+            }
+        }
+
+        void ThumbnailerComponent::StartThumbnailLoad(SharedThumbnailKey key, SharedThumbnail thumbnail)
+        {
+            // Connect thumbnailer component to the busy label repaint signal to notify the asset browser as it changes.
+            AzQtComponents::StyledBusyLabel* busyLabel = {};
+            AssetBrowser::AssetBrowserComponentRequestBus::BroadcastResult(busyLabel, &AssetBrowser::AssetBrowserComponentRequests::GetStyledBusyLabel);
+            QObject::connect(busyLabel, &AzQtComponents::StyledBusyLabel::repaintNeeded, m_placeholderObject.get(), [](){
+                AssetBrowser::AssetBrowserViewRequestBus::Broadcast(&AssetBrowser::AssetBrowserViewRequests::Update);
+            });
+
+            // The ThumbnailUpdated signal should be sent whenever the thumbnail has loaded or failed. In both cases,
+            // disconnect from all of the signals and start the next queued load.
+            QObject::connect(thumbnail.data(), &Thumbnail::ThumbnailUpdated, m_placeholderObject.get(), [this, key, thumbnail, busyLabel]()
+                {
+                    QObject::disconnect(busyLabel, nullptr, m_placeholderObject.get(), nullptr);
+                    QObject::disconnect(thumbnail.data(), nullptr, key.data(), nullptr);
+                    // later updates of the thumbnail must not be counted as another completed load
+                    QObject::disconnect(thumbnail.data(), &Thumbnail::ThumbnailUpdated, m_placeholderObject.get(), nullptr);
+
+                    QObject::connect(thumbnail.data(), &Thumbnail::ThumbnailUpdated, key.data(), &ThumbnailKey::ThumbnailUpdated);
+                    QObject::connect(key.data(), &ThumbnailKey::ThumbnailUpdateRequested, thumbnail.data(), &Thumbnail::Update);
+
+                    key->SetReady(true);
+                    m_thumbnailsBeingLoaded.erase(thumbnail);
+                    --m_runningThumbnailLoadCount;
+                    StartPendingThumbnailLoads();
+                    AssetBrowser::AssetBrowserViewRequestBus::Broadcast(&AssetBrowser::AssetBrowserViewRequests::Update);
+                });
+
+            // The job will send the ThumbnailUpdated signal from the main thread when complete.
+            ++m_runningThumbnailLoadCount;
+            auto job = AZ::CreateJobFunction([thumbnail](){ thumbnail->Load(); }, true);
+            job->Start();
+        }
+
         bool ThumbnailerComponent::IsLoading(SharedThumbnailKey key)
         {
             for (auto& provider : m_providers)
@@ -178,6 +217,8 @@ namespace AzToolsFramework
             m_loadingThumbnail.reset();
             m_placeholderObject.reset();
             m_thumbnailsBeingLoaded.clear();
+            m_pendingThumbnailLoads.clear();
+            m_runningThumbnailLoadCount = 0;
         }
     } // namespace Thumbnailer
 } // namespace AzToolsFramework
@@ -11,6 +11,7 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzToolsFramework/Thumbnails/Thumbnail.h>
 #include <AzToolsFramework/Thumbnails/ThumbnailerBus.h>
 
@@ -49,6 +50,9 @@ namespace AzToolsFramework
 
         private:
             void Cleanup();
+            //! Starts loading the queued thumbnails, up to the limit of concurrent loads.
+            void StartPendingThumbnailLoads();
+            void StartThumbnailLoad(SharedThumbnailKey key, SharedThumbnail thumbnail);
 
             struct ProviderCompare
             {
@@ -67,8 +71,12 @@ namespace AzToolsFramework
             SharedThumbnail m_loadingThumbnail;
             //! Using placeholder object rather than inheritance for connecting signals and slots
             AZStd::unique_ptr<QObject> m_placeholderObject;
-            //! Current number of jobs running.
+            //! Thumbnails that are loading or waiting in the queue to be loaded.
             AZStd::set<SharedThumbnail> m_thumbnailsBeingLoaded;
+            //! Thumbnails waiting for a load job, the most recent requests are at the back.
+            AZStd::vector<AZStd::pair<SharedThumbnailKey, SharedThumbnail>> m_pendingThumbnailLoads;
+            //! Current number of jobs running.
+            AZ::u32 m_runningThumbnailLoadCount = 0;
         };
     } // Thumbnailer
 } // namespace AssetBrowser
@@ -1177,6 +1177,17 @@ namespace AzToolsFramework
         m_entityChangeQueued = false;
         m_entityChangeQueue.clear();
         QueueEntityUpdate(AZ::EntityId());
+
+        // The reset cleared the selection of the view, e.g. when a large prefab instance was added in one bulk update
+        EntityIdList selectedEntityIds;
+        ToolsApplicationRequests::Bus::BroadcastResult(selectedEntityIds, &ToolsApplicationRequests::GetSelectedEntities);
+        for (const AZ::EntityId& entityId : selectedEntityIds)
+        {
+            m_entitySelectQueue.insert(entityId);
+            QueueEntityUpdate(entityId);
+        }
+        m_isFilterDirty = true;
+
         emit EnableSelectionUpdates(true);
     }
 
@@ -99,6 +99,14 @@ namespace AzToolsFramework
         AzQtComponents::StyledTreeView::rowsInserted(parent, start, end);
     }
 
+    void EntityOutlinerTreeView::reset()
+    {
+        AzQtComponents::StyledTreeView::reset();
+
+        // The model keeps the expanded state of the entities, restore it after the model was reset
+        RecursiveCheckExpandedStates(rootIndex());
+    }
+
     void EntityOutlinerTreeView::RecursiveCheckExpandedStates(const QModelIndex& current)
     {
         const int rowCount = model()->rowCount(current);
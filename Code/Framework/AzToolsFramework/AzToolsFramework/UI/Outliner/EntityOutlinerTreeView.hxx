@@ -55,6 +55,9 @@ namespace AzToolsFramework
         void dataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles = QVector<int>()) override;
         void rowsInserted(const QModelIndex &parent, int start, int end) override;
 
+    public Q_SLOTS:
+        void reset() override;
+
     protected:
         // Qt overrides
         void dragMoveEvent(QDragMoveEvent* event) override;
@@ -1137,6 +1137,23 @@ namespace AzToolsFramework
         m_gui->m_objectTree->update();
     }
 
+    void EntityOutlinerWidget::OnEntityInfoResetEnd()
+    {
+        // The entities added in a bulk update of the entity model aren't notified one by one, sort all the content
+        if (m_sortMode != EntityOutliner::DisplaySortMode::Manually)
+        {
+            QTimer::singleShot(queuedChangeDelay, this, [this]()
+            {
+                if (m_sortMode != EntityOutliner::DisplaySortMode::Manually)
+                {
+                    AZ_PROFILE_SCOPE(AzToolsFramework, "EntityOutlinerWidget::OnEntityInfoResetEnd:SortContent");
+                    auto comparer = AZStd::bind(&CompareEntitiesForSorting, AZStd::placeholders::_1, AZStd::placeholders::_2, m_sortMode);
+                    SortEntityChildrenRecursively(AZ::EntityId(), comparer);
+                }
+            });
+        }
+    }
+
     void EntityOutlinerWidget::OnEntityInfoUpdatedAddChildEnd(AZ::EntityId /*parentId*/, AZ::EntityId childId)
     {
         QueueContentUpdateSort(childId);
@@ -104,6 +104,7 @@ namespace AzToolsFramework
         void OnFocusInEntityOutliner(const EntityIdList& entityIdList) override;
 
         /// EditorEntityInfoNotificationBus implementation
+        void OnEntityInfoResetEnd() override;
         void OnEntityInfoUpdatedAddChildEnd(AZ::EntityId /*parentId*/, AZ::EntityId /*childId*/) override;
         void OnEntityInfoUpdatedName(AZ::EntityId entityId, const AZStd::string& /*name*/) override;
 
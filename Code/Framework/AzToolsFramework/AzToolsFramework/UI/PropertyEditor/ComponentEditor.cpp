@@ -230,11 +230,7 @@ namespace AzToolsFramework
                 // there's an aggregateInstance, so we're in multi-edit. Create the AggregateAdapter if it doesn't exist yet
                 if (!m_aggregateAdapter)
                 {
-                    m_aggregateAdapter = AZStd::make_shared<AZ::DocumentPropertyEditor::LabeledRowAggregateAdapter>();
-
-                    // for now, disable "values differ rows", since there are so many pointer and opaque types in the Inspector
-                    // and the output is noisy and unpleasant.
-                    m_aggregateAdapter->SetGenerateDiffRows(false);
+                    CreateAggregateAdapter();
 
                     // add the original adapter which was already set in a prior AddInstance with a null aggregateInstance
                     m_aggregateAdapter->AddAdapter(m_adapter);
@@ -269,6 +265,65 @@ namespace AzToolsFramework
         GetHeader()->setToolTip(BuildHeaderTooltip());
     }
 
+    void ComponentEditor::AddInstances(AZStd::span<AZ::Component* const> componentInstances)
+    {
+        if (componentInstances.empty())
+        {
+            return;
+        }
+
+        AZ::Component* firstInstance = componentInstances.front();
+        AddInstance(firstInstance, nullptr, nullptr);
+        if (!m_adapter || componentInstances.size() == 1 || !firstInstance)
+        {
+            for (AZ::Component* componentInstance : componentInstances.subspan(1))
+            {
+                AddInstance(componentInstance, firstInstance, nullptr);
+            }
+            return;
+        }
+
+        // gather the adapters of all the instances first, so the aggregate adapter only generates its contents once
+        AZStd::vector<AZ::DocumentPropertyEditor::DocumentAdapterPtr> newAdapters;
+        newAdapters.reserve(componentInstances.size());
+        const bool createAggregateAdapter = !m_aggregateAdapter;
+        if (createAggregateAdapter)
+        {
+            CreateAggregateAdapter();
+            newAdapters.push_back(m_adapter);
+        }
+
+        for (AZ::Component* componentInstance : componentInstances.subspan(1))
+        {
+            if (componentInstance)
+            {
+                m_components.push_back(componentInstance);
+
+                auto newAdapter = m_adapterFactory();
+                AZ_Assert(newAdapter, "m_adapterFactory should always return a valid ComponentAdapter in DPE mode!");
+                newAdapter->SetComponent(componentInstance);
+                newAdapters.push_back(newAdapter);
+            }
+        }
+        m_aggregateAdapter->AddAdapters(newAdapters);
+
+        if (createAggregateAdapter)
+        {
+            m_filterAdapter->SetSourceAdapter(m_aggregateAdapter);
+        }
+
+        GetHeader()->setToolTip(BuildHeaderTooltip());
+    }
+
+    void ComponentEditor::CreateAggregateAdapter()
+    {
+        m_aggregateAdapter = AZStd::make_shared<AZ::DocumentPropertyEditor::LabeledRowAggregateAdapter>();
+
+        // for now, disable "values differ rows", since there are so many pointer and opaque types in the Inspector
+        // and the output is noisy and unpleasant.
+        m_aggregateAdapter->SetGenerateDiffRows(false);
+    }
+
     void ComponentEditor::ClearInstances(bool invalidateImmediately)
     {
         GetPropertyEditor()->SetDynamicEditDataProvider(nullptr);
@@ -11,6 +11,7 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Math/Uuid.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzFramework/DocumentPropertyEditor/AggregateAdapter.h>
 #include <AzToolsFramework/API/EntityCompositionRequestBus.h>
@@ -74,6 +75,9 @@ namespace AzToolsFramework
         ~ComponentEditor();
 
         void AddInstance(AZ::Component* componentInstance, AZ::Component* aggregateInstance, AZ::Component* compareInstance);
+        /// Adds the instances of a component shared by several entities, the non-first instances are aggregated under the first one.
+        /// In DPE mode the multi-edit adapter is built once for all the instances instead of being updated for each of them.
+        void AddInstances(AZStd::span<AZ::Component* const> componentInstances);
         void ClearInstances(bool invalidateImmediately);
 
         void AddNotifications();
@@ -143,6 +147,9 @@ namespace AzToolsFramework
         /// Set up header for this component type.
         void SetComponentType(const AZ::Component& componentInstance);
 
+        /// Create the adapter aggregating the component adapters for multi-edit.
+        void CreateAggregateAdapter();
+
         /// Clear header of anything specific to component type.
         void InvalidateComponentType();
 
@@ -1764,15 +1764,9 @@ namespace AzToolsFramework
 
             auto componentEditor = CreateComponentEditor();
 
-            // Add instances to componentEditor
+            // Add instances to componentEditor, non-first instances are aggregated under the first instance
             auto& componentInstances = sharedComponentInfo.m_instances;
-            for (AZ::Component* componentInstance : componentInstances)
-            {
-                // non-first instances are aggregated under the first instance
-                AZ::Component* aggregateInstance = componentInstance != componentInstances.front() ? componentInstances.front() : nullptr;
-
-                componentEditor->AddInstance(componentInstance, aggregateInstance, nullptr);
-            }
+            componentEditor->AddInstances(componentInstances);
 
             // Set up other entity property editor customization
             if (ShouldUseDPE() && Prefab::IsInspectorOverrideManagementEnabled())
@@ -8,6 +8,8 @@
 
 #include "UndoSystem.h"
 
+#include <AzCore/std/algorithm.h>
+
 namespace AzToolsFramework
 {
     namespace UndoSystem
@@ -188,6 +190,7 @@ namespace AzToolsFramework
 
             m_SequencePointsBuffer.push_back(cmd);
             m_Cursor = int(m_SequencePointsBuffer.size()) - 1;
+            TrimToMaxSequencePointCount();
 #ifdef _DEBUG
             CleanCheck();
 #endif
@@ -346,6 +349,48 @@ namespace AzToolsFramework
             }
         }
 
+        void UndoStack::SetMaxSequencePointCount(size_t maxSequencePointCount)
+        {
+            m_maxSequencePointCount = maxSequencePointCount;
+
+            const size_t previousSize = m_SequencePointsBuffer.size();
+            TrimToMaxSequencePointCount();
+            if (m_SequencePointsBuffer.size() != previousSize && m_notify)
+            {
+                m_notify->OnUndoStackChanged();
+            }
+        }
+
+        size_t UndoStack::GetMaxSequencePointCount() const
+        {
+            return m_maxSequencePointCount;
+        }
+
+        void UndoStack::TrimToMaxSequencePointCount()
+        {
+            if (m_maxSequencePointCount == 0 || m_SequencePointsBuffer.size() <= m_maxSequencePointCount)
+            {
+                return;
+            }
+
+            // only the sequence points below the cursor are dropped, the redo history stays intact
+            const int trimCount = AZStd::min(int(m_SequencePointsBuffer.size() - m_maxSequencePointCount), m_Cursor + 1);
+            if (trimCount <= 0)
+            {
+                return;
+            }
+
+            for (int idx = 0; idx < trimCount; ++idx)
+            {
+                delete m_SequencePointsBuffer[idx];
+            }
+            m_SequencePointsBuffer.erase(m_SequencePointsBuffer.begin(), m_SequencePointsBuffer.begin() + trimCount);
+            m_Cursor -= trimCount;
+
+            // the clean point can't be reached anymore once the state it refers to is trimmed
+            m_CleanPoint = m_CleanPoint - trimCount >= -1 ? m_CleanPoint - trimCount : -2;
+        }
+
         URSequencePoint* UndoStack::Find(URCommandID id, const AZ::Uuid& typeOfCommand)
         {
             for (int idx = 0; idx < int(m_SequencePointsBuffer.size()); ++idx)
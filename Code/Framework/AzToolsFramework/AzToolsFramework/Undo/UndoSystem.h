@@ -178,6 +178,13 @@ namespace AzToolsFramework
 
             URSequencePoint* PopTop(); // by doing this, you take ownership of the memory.
 
+            /**
+            Usage: limits the number of sequence points kept in the stack, the oldest ones are deleted once it is exceeded
+            so a long editing session doesn't keep growing its memory. 0 keeps the whole history, which is the default.
+            */
+            void SetMaxSequencePointCount(size_t maxSequencePointCount);
+            size_t GetMaxSequencePointCount() const;
+
             /**
             Usage: slices off all commands above the current cursor
             example: undo followed by new commands should slice to remove redo commands no longer viable
@@ -188,6 +195,8 @@ namespace AzToolsFramework
 #ifdef _DEBUG
             void CleanCheck();
 #endif
+            // deletes the oldest sequence points that can be undone until the stack fits in m_maxSequencePointCount
+            void TrimToMaxSequencePointCount();
 
             int m_Cursor;
             int m_CleanPoint;
@@ -196,6 +205,7 @@ namespace AzToolsFramework
 
             SequencePointBuffer m_SequencePointsBuffer;
             IUndoNotify* m_notify;
+            size_t m_maxSequencePointCount = 0;
 
         private:
 
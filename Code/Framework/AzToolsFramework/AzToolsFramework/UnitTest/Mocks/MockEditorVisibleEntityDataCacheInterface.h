@@ -34,5 +34,6 @@ namespace UnitTest
         MOCK_CONST_METHOD1(IsVisibleEntityIndividuallySelectableInViewport, bool(size_t));
         MOCK_CONST_METHOD1(IsVisibleEntityInFocusSubTree, bool(size_t));
         MOCK_CONST_METHOD1(GetVisibleEntityIndexFromId, AZStd::optional<size_t>(AZ::EntityId entityId));
+        MOCK_CONST_METHOD2(GetVisibleEntitySelectionBounds, AZ::Aabb(size_t, const AzFramework::ViewportInfo&));
     };
 } // namespace UnitTest
@@ -189,6 +189,9 @@ namespace AzToolsFramework
         const int viewportId = mouseInteraction.m_mouseInteraction.m_interactionId.m_viewportId;
 
         const bool iconsVisible = IconsVisible(viewportId);
+        const auto viewportInfo = AzFramework::ViewportInfo{ viewportId };
+        const AZ::Vector3& rayOrigin = mouseInteraction.m_mouseInteraction.m_mousePick.m_rayOrigin;
+        const AZ::Vector3& rayDirection = mouseInteraction.m_mouseInteraction.m_mousePick.m_rayDirection;
 
         const AZ::Matrix3x4 cameraView = AzFramework::CameraView(cameraState);
         const AZ::Matrix4x4 cameraProjection = AzFramework::CameraProjection(cameraState);
@@ -239,8 +242,16 @@ namespace AzToolsFramework
                 }
             }
 
+            // cull with the cached selection bounds before querying the components of the entity
+            const AZ::Aabb selectionBounds = m_entityDataCache->GetVisibleEntitySelectionBounds(entityCacheIndex, viewportInfo);
+            if (float boundsDistance; !selectionBounds.IsValid() ||
+                !AabbIntersectRay(rayOrigin, rayDirection, selectionBounds, boundsDistance) || boundsDistance >= closestDistance)
+            {
+                continue;
+            }
+
             float closestBoundDifference;
-            if (PickEntity(entityId, mouseInteraction.m_mouseInteraction, closestBoundDifference, viewportId))
+            if (PickEntityComponents(entityId, rayOrigin, rayDirection, closestBoundDifference, viewportId))
             {
                 if (closestBoundDifference < closestDistance)
                 {
@@ -104,6 +104,17 @@ namespace AzToolsFramework
             return false;
         }
 
+        return PickEntityComponents(entityId, rayOrigin, rayDirection, closestDistance, viewportId);
+    }
+
+    bool PickEntityComponents(
+        AZ::EntityId entityId, const AZ::Vector3& rayOrigin, const AZ::Vector3& rayDirection, float& closestDistance, const int viewportId)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        closestDistance = AZStd::numeric_limits<float>::max();
+
+        const auto viewportInfo = AzFramework::ViewportInfo{ viewportId };
         bool entityPicked = false;
         EditorComponentSelectionRequestsBus::EnumerateHandlersId(
             entityId,
@@ -58,6 +58,12 @@ namespace AzToolsFramework
     bool PickEntity(
         AZ::EntityId entityId, const AZ::Vector3& rayOrigin, const AZ::Vector3& rayDirection, float& closestDistance, int viewportId);
 
+    //! Return if a pick ray did intersect one of the components of the tested EntityId.
+    //! @note Unlike PickEntity the entity selection bounds are not tested first, the caller is expected to have
+    //! culled the entity already (e.g. with the bounds cached by EditorVisibleEntityDataCache).
+    bool PickEntityComponents(
+        AZ::EntityId entityId, const AZ::Vector3& rayOrigin, const AZ::Vector3& rayDirection, float& closestDistance, int viewportId);
+
     //! Wrapper for EBus call to return the CameraState for a given viewport.
     AzFramework::CameraState GetCameraState(int viewportId);
 
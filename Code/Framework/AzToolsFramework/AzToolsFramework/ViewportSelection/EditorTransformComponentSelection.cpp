@@ -454,7 +454,10 @@ namespace AzToolsFramework
                 potentialSelectedEntityIds.clear();
             }
 
+            // calculate the camera matrices once for all the visible entities
             const AzFramework::CameraState cameraState = GetCameraState(viewportId);
+            const AZ::Matrix3x4 cameraView = AzFramework::CameraView(cameraState);
+            const AZ::Matrix4x4 cameraProjection = AzFramework::CameraProjection(cameraState);
             for (size_t entityCacheIndex = 0; entityCacheIndex < entityDataCache.VisibleEntityDataCount(); ++entityCacheIndex)
             {
                 if (!entityDataCache.IsVisibleEntityIndividuallySelectableInViewport(entityCacheIndex))
@@ -465,7 +468,8 @@ namespace AzToolsFramework
                 const AZ::EntityId entityId = entityDataCache.GetVisibleEntityId(entityCacheIndex);
                 const AZ::Vector3& entityPosition = entityDataCache.GetVisibleEntityPosition(entityCacheIndex);
 
-                const AzFramework::ScreenPoint screenPosition = AzFramework::WorldToScreen(entityPosition, cameraState);
+                const AzFramework::ScreenPoint screenPosition =
+                    AzFramework::WorldToScreen(entityPosition, cameraView, cameraProjection, cameraState.m_viewportSize);
 
                 if (currentKeyboardModifiers.Ctrl())
                 {
@@ -8,13 +8,25 @@
 
 #include "EditorVisibleEntityDataCache.h"
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/sort.h>
+#include <AzFramework/Entity/EntityDebugDisplayBus.h>
 #include <AzToolsFramework/ContainerEntity/ContainerEntityInterface.h>
 #include <AzToolsFramework/Entity/EditorEntityModel.h>
 #include <AzToolsFramework/FocusMode/FocusModeInterface.h>
 #include <AzToolsFramework/Viewport/ViewportMessages.h>
+#include <AzToolsFramework/ViewportSelection/EditorSelectionUtil.h>
 #include <Entity/EditorEntityHelpers.h>
 
+AZ_CVAR(
+    bool,
+    ed_cacheViewportSelectionBounds,
+    true,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "Cache the editor selection bounds of the visible entities used to cull viewport picking (recalculated when the entity transform, "
+    "its properties or the camera change)");
+
 namespace AzToolsFramework
 {
     //! Cached Entity data required by the selection.
@@ -42,6 +54,8 @@ namespace AzToolsFramework
         bool m_descendantOfClosedContainer = false;
         bool m_selected = false;
         bool m_iconHidden = false;
+        AZ::Aabb m_selectionBounds = AZ::Aabb::CreateNull(); //!< Cached editor selection bounds.
+        AZ::u32 m_selectionBoundsGeneration = 0; //!< The cached bounds are valid when this matches the cache generation.
     };
 
     using EntityDatas = AZStd::vector<EntityData>; //!< Alias for vector of EntityDatas.
@@ -61,8 +75,28 @@ namespace AzToolsFramework
         EntityIdList m_visibleEntityIds; //!< The EntityIds that are visible this frame.
         EntityIdList m_prevVisibleEntityIds; //!< The EntityIds that were visible the previous frame (unsorted).
         EntityDatas m_visibleEntityDatas; //!< Cached EntityData required by EditorTransformComponentSelection.
+        AzFramework::CameraState m_selectionBoundsCameraState; //!< Camera the cached selection bounds were calculated with.
+        AzFramework::ViewportId m_selectionBoundsViewportId = AzFramework::InvalidViewportId; //!< Viewport of the cached selection bounds.
+        AZ::u32 m_selectionBoundsGeneration = 1; //!< Incremented to invalidate all the cached selection bounds.
+
+        void InvalidateSelectionBounds()
+        {
+            // 0 is reserved for the entity data that was never calculated
+            if (++m_selectionBoundsGeneration == 0)
+            {
+                m_selectionBoundsGeneration = 1;
+            }
+        }
     };
 
+    // some components scale their selection bounds with the distance to the camera (e.g. joints, icons)
+    static bool SelectionBoundsCameraStatesMatch(const AzFramework::CameraState& lhs, const AzFramework::CameraState& rhs)
+    {
+        return lhs.m_position.IsClose(rhs.m_position) && lhs.m_forward.IsClose(rhs.m_forward) && lhs.m_up.IsClose(rhs.m_up) &&
+            AZ::IsClose(lhs.m_fovOrZoom, rhs.m_fovOrZoom) && lhs.m_viewportSize == rhs.m_viewportSize &&
+            lhs.m_orthographic == rhs.m_orthographic;
+    }
+
     // constructor for EntityData to support emplace_back in vector
     EntityData::EntityData(
         const AZ::EntityId entityId,
@@ -210,6 +244,15 @@ namespace AzToolsFramework
     {
         AZ_PROFILE_FUNCTION(AzToolsFramework);
 
+        if (const AzFramework::CameraState cameraState = GetCameraState(viewportInfo.m_viewportId);
+            viewportInfo.m_viewportId != m_impl->m_selectionBoundsViewportId ||
+            !SelectionBoundsCameraStatesMatch(cameraState, m_impl->m_selectionBoundsCameraState))
+        {
+            m_impl->m_selectionBoundsCameraState = cameraState;
+            m_impl->m_selectionBoundsViewportId = viewportInfo.m_viewportId;
+            m_impl->InvalidateSelectionBounds();
+        }
+
         // request list of visible entities from authoritative system
         EntityIdList nextVisibleEntityIds;
         ViewportInteraction::EditorEntityViewportInteractionRequestBus::Event(
@@ -333,6 +376,24 @@ namespace AzToolsFramework
         return {};
     }
 
+    AZ::Aabb EditorVisibleEntityDataCache::GetVisibleEntitySelectionBounds(
+        const size_t index, const AzFramework::ViewportInfo& viewportInfo) const
+    {
+        EntityData& entityData = m_impl->m_visibleEntityDatas[index];
+        if (!ed_cacheViewportSelectionBounds || viewportInfo.m_viewportId != m_impl->m_selectionBoundsViewportId)
+        {
+            return CalculateEditorEntitySelectionBounds(entityData.m_entityId, viewportInfo);
+        }
+
+        if (entityData.m_selectionBoundsGeneration != m_impl->m_selectionBoundsGeneration)
+        {
+            entityData.m_selectionBounds = CalculateEditorEntitySelectionBounds(entityData.m_entityId, viewportInfo);
+            entityData.m_selectionBoundsGeneration = m_impl->m_selectionBoundsGeneration;
+        }
+
+        return entityData.m_selectionBounds;
+    }
+
     void EditorVisibleEntityDataCache::AfterUndoRedo()
     {
         // ensure we refresh all EntityData after an undo/redo action as
@@ -343,6 +404,21 @@ namespace AzToolsFramework
         }
     }
 
+    void EditorVisibleEntityDataCache::InvalidatePropertyDisplay([[maybe_unused]] const PropertyModificationRefreshLevel level)
+    {
+        // a property change may resize the selection bounds (e.g. the dimensions of a shape)
+        m_impl->InvalidateSelectionBounds();
+    }
+
+    void EditorVisibleEntityDataCache::InvalidatePropertyDisplayForComponent(
+        const AZ::EntityComponentIdPair entityComponentIdPair, [[maybe_unused]] const PropertyModificationRefreshLevel level)
+    {
+        if (AZStd::optional<size_t> entityIndex = GetVisibleEntityIndexFromId(entityComponentIdPair.GetEntityId()))
+        {
+            m_impl->m_visibleEntityDatas[entityIndex.value()].m_selectionBoundsGeneration = 0;
+        }
+    }
+
     void EditorVisibleEntityDataCache::OnEntityVisibilityChanged(const bool visibility)
     {
         AZ_PROFILE_FUNCTION(AzToolsFramework);
@@ -374,6 +450,7 @@ namespace AzToolsFramework
         if (AZStd::optional<size_t> entityIndex = GetVisibleEntityIndexFromId(entityId))
         {
             m_impl->m_visibleEntityDatas[entityIndex.value()].m_worldFromLocal = world;
+            m_impl->m_visibleEntityDatas[entityIndex.value()].m_selectionBoundsGeneration = 0;
         }
     }
 
@@ -389,6 +466,16 @@ namespace AzToolsFramework
         }
     }
 
+    void EditorVisibleEntityDataCache::OnEditorSelectionBoundsChanged()
+    {
+        const AZ::EntityId entityId = *EditorComponentSelectionNotificationsBus::GetCurrentBusId();
+
+        if (AZStd::optional<size_t> entityIndex = GetVisibleEntityIndexFromId(entityId))
+        {
+            m_impl->m_visibleEntityDatas[entityIndex.value()].m_selectionBoundsGeneration = 0;
+        }
+    }
+
     void EditorVisibleEntityDataCache::OnSelected()
     {
         AZ_PROFILE_FUNCTION(AzToolsFramework);
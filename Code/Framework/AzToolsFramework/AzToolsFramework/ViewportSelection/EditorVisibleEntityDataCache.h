@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/Aabb.h>
 #include <AzCore/std/optional.h>
 #include <AzToolsFramework/API/ComponentEntitySelectionBus.h>
 #include <AzToolsFramework/ContainerEntity/ContainerEntityNotificationBus.h>
@@ -44,6 +45,10 @@ namespace AzToolsFramework
         virtual bool IsVisibleEntityIndividuallySelectableInViewport(size_t index) const = 0;
         virtual bool IsVisibleEntityInFocusSubTree(size_t index) const = 0;
         virtual AZStd::optional<size_t> GetVisibleEntityIndexFromId(AZ::EntityId entityId) const = 0;
+        //! Returns the union of the editor selection bounds of the entity (see CalculateEditorEntitySelectionBounds).
+        //! @note The bounds may be cached, they are recalculated when the entity transform, its properties or the
+        //! viewport camera change.
+        virtual AZ::Aabb GetVisibleEntitySelectionBounds(size_t index, const AzFramework::ViewportInfo& viewportInfo) const = 0;
     };
 
     //! A cache of packed EntityData that can be iterated over efficiently without
@@ -85,12 +90,15 @@ namespace AzToolsFramework
         bool IsVisibleEntityIndividuallySelectableInViewport(size_t index) const override;
         bool IsVisibleEntityInFocusSubTree(size_t index) const override;
         AZStd::optional<size_t> GetVisibleEntityIndexFromId(AZ::EntityId entityId) const override;
+        AZ::Aabb GetVisibleEntitySelectionBounds(size_t index, const AzFramework::ViewportInfo& viewportInfo) const override;
 
         void AddEntityIds(const EntityIdList& entityIds);
 
     private:
         // ToolsApplicationNotificationBus overrides ...
         void AfterUndoRedo() override;
+        void InvalidatePropertyDisplay(PropertyModificationRefreshLevel level) override;
+        void InvalidatePropertyDisplayForComponent(AZ::EntityComponentIdPair entityComponentIdPair, PropertyModificationRefreshLevel level) override;
 
         // EditorEntityVisibilityNotificationBus overrides ...
         void OnEntityVisibilityChanged(bool visibility) override;
@@ -103,6 +111,7 @@ namespace AzToolsFramework
 
         // EditorComponentSelectionNotificationsBus overrides ...
         void OnAccentTypeChanged(EntityAccentType accent) override;
+        void OnEditorSelectionBoundsChanged() override;
 
         // EntitySelectionEvents::Bus overrides ...
         void OnSelected() override;
@@ -1004,6 +1004,28 @@ namespace UnitTest
         EXPECT_THAT(entityIdUnderCursor.EntityIdUnderCursor(), Eq(boundlessEntityId));
     }
 
+    // the selection bounds cached to cull picking follow the entity when it moves
+    TEST_F(EditorTransformComponentSelectionViewportPickingManipulatorTestFixture, CachedSelectionBoundsAreUpdatedWhenEntityMoves)
+    {
+        AZ::TransformBus::Event(m_entityId1, &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3(0.0f, 5.0f, 0.0f));
+
+        AzToolsFramework::EditorVisibleEntityDataCache editorVisibleEntityDataCache;
+        const auto viewportInfo = AzFramework::ViewportInfo{ m_viewportManipulatorInteraction->GetViewportInteraction().GetViewportId() };
+        editorVisibleEntityDataCache.CalculateVisibleEntityDatas(viewportInfo);
+
+        const AZStd::optional<size_t> entityCacheIndex = editorVisibleEntityDataCache.GetVisibleEntityIndexFromId(m_entityId1);
+        ASSERT_TRUE(entityCacheIndex.has_value());
+
+        const AZ::Aabb initialBounds = editorVisibleEntityDataCache.GetVisibleEntitySelectionBounds(entityCacheIndex.value(), viewportInfo);
+        EXPECT_TRUE(initialBounds.IsClose(AzToolsFramework::CalculateEditorEntitySelectionBounds(m_entityId1, viewportInfo)));
+
+        AZ::TransformBus::Event(m_entityId1, &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3(0.0f, 10.0f, 0.0f));
+
+        const AZ::Aabb movedBounds = editorVisibleEntityDataCache.GetVisibleEntitySelectionBounds(entityCacheIndex.value(), viewportInfo);
+        EXPECT_TRUE(movedBounds.IsClose(AzToolsFramework::CalculateEditorEntitySelectionBounds(m_entityId1, viewportInfo)));
+        EXPECT_FALSE(movedBounds.IsClose(initialBounds));
+    }
+
     class EditorTransformComponentSelectionViewportPickingManipulatorTestFixtureParam
         : public EditorTransformComponentSelectionViewportPickingManipulatorTestFixture
         , public ::testing::WithParamInterface<bool>
@@ -282,6 +282,60 @@ namespace UnitTest
         }
     }
 
+    TEST_F(PrefabLoadTemplateTest, LoadTemplate_TemplatesSharingNestedTemplate_WithNoPatches)
+    {
+        // The nested prefab files are prefetched one nesting level at a time, the shared template must only be loaded once.
+        MockPrefabFileIOActionValidator mockIOActionValidator;
+
+        TemplateData sharedTemplateData;
+        sharedTemplateData.m_filePath = "path/to/shared/template";
+        mockIOActionValidator.ReadPrefabDom(sharedTemplateData.m_filePath, PrefabTestDomUtils::CreatePrefabDom());
+
+        TemplateData targetTemplateData;
+        targetTemplateData.m_filePath = "path/to/target/template";
+
+        const int numInstances = 2;
+        AZStd::vector<TemplateData> middleTemplatesData;
+        AZStd::vector<InstanceData> middleTemplateInstancesData;
+        AZStd::vector<InstanceData> targetTemplateInstancesData;
+        for (int i = 0; i < numInstances; i++)
+        {
+            TemplateData middleTemplateData;
+            middleTemplateData.m_filePath = AZStd::string::format("path/to/middle/%d/template", i);
+
+            InstanceData middleTemplateInstanceData =
+                PrefabTestDataUtils::CreateInstanceDataWithNoPatches("sharedTemplateInstance", sharedTemplateData.m_filePath);
+            middleTemplateData.m_instancesData[middleTemplateInstanceData.m_name] = middleTemplateInstanceData;
+            mockIOActionValidator.ReadPrefabDom(
+                middleTemplateData.m_filePath, PrefabTestDomUtils::CreatePrefabDom({ middleTemplateInstanceData }));
+
+            InstanceData targetTemplateInstanceData = PrefabTestDataUtils::CreateInstanceDataWithNoPatches(
+                AZStd::string::format("middle%dTemplateInstance", i), middleTemplateData.m_filePath);
+            targetTemplateData.m_instancesData[targetTemplateInstanceData.m_name] = targetTemplateInstanceData;
+
+            middleTemplatesData.emplace_back(middleTemplateData);
+            middleTemplateInstancesData.emplace_back(middleTemplateInstanceData);
+            targetTemplateInstancesData.emplace_back(targetTemplateInstanceData);
+        }
+        mockIOActionValidator.ReadPrefabDom(
+            targetTemplateData.m_filePath, PrefabTestDomUtils::CreatePrefabDom(targetTemplateInstancesData));
+
+        targetTemplateData.m_id = m_prefabLoaderInterface->LoadTemplateFromFile(targetTemplateData.m_filePath);
+        sharedTemplateData.m_id = m_prefabSystemComponent->GetTemplateIdFromFilePath(sharedTemplateData.m_filePath);
+        for (int i = 0; i < numInstances; i++)
+        {
+            middleTemplatesData[i].m_id = m_prefabSystemComponent->GetTemplateIdFromFilePath(middleTemplatesData[i].m_filePath);
+
+            LinkData linkFromMiddleData = PrefabTestDataUtils::CreateLinkData(
+                targetTemplateInstancesData[i], middleTemplatesData[i].m_id, targetTemplateData.m_id);
+            PrefabTestDataUtils::CheckIfTemplatesConnected(middleTemplatesData[i], targetTemplateData, linkFromMiddleData);
+
+            LinkData linkFromSharedData = PrefabTestDataUtils::CreateLinkData(
+                middleTemplateInstancesData[i], sharedTemplateData.m_id, middleTemplatesData[i].m_id);
+            PrefabTestDataUtils::CheckIfTemplatesConnected(sharedTemplateData, middleTemplatesData[i], linkFromSharedData);
+        }
+    }
+
     TEST_F(PrefabLoadTemplateTest, LoadTemplate_LoadCorruptedPrefabFileData_InvalidTemplateIdReturned)
     {
         const AZStd::string corruptedPrefabContent = "{ Corrupted PrefabDom";
@@ -205,6 +205,57 @@ namespace UnitTest
         );
     }
 
+    TEST_F(PrefabProcessingTestFixture, PrefabProcessorRemoveComponentPerPlatform_ProcessDocumentsInParallel)
+    {
+        using namespace AzToolsFramework::Prefab::PrefabConversionUtils;
+
+        PrefabProcessorContext prefabProcessorContext{ AZ::Uuid::CreateRandom() };
+        prefabProcessorContext.SetPlatformTags({ AZ::Crc32(PlatformTag) });
+
+        constexpr int DocumentCount = 4;
+        for (int i = 0; i < DocumentCount; ++i)
+        {
+            PrefabDocument document(AZStd::string::format("testPrefab%i", i));
+            AzToolsFramework::Prefab::PrefabDom prefabDom;
+            AZStd::vector<AZ::Entity*> entities;
+            entities.emplace_back(CreateSourceEntity(EntityName, { Uuid_RemoveThisComponent, Uuid_KeepThisComponent }));
+            ConvertEntitiesToPrefab(entities, prefabDom);
+
+            ASSERT_TRUE(document.SetPrefabDom(AZStd::move(prefabDom)));
+            prefabProcessorContext.AddPrefab(AZStd::move(document));
+        }
+
+        // Process the documents the same way the conversion pipeline does for parallel safe processors
+        ASSERT_TRUE(m_processor.IsParallelSafe());
+        prefabProcessorContext.ListPrefabsInParallel(
+            [this, &prefabProcessorContext](PrefabDocument& prefab)
+            {
+                m_processor.ProcessDocument(prefabProcessorContext, prefab);
+            });
+        ASSERT_TRUE(prefabProcessorContext.HasCompletedSuccessfully());
+
+        // Validate the component is removed from every document
+        int processedDocumentCount = 0;
+        prefabProcessorContext.ListPrefabs(
+            [&processedDocumentCount](PrefabDocument& prefab) -> void
+            {
+                ++processedDocumentCount;
+                prefab.GetInstance().GetAllEntitiesInHierarchy(
+                    [](AZStd::unique_ptr<AZ::Entity>& entity) -> bool
+                    {
+                        if (entity->GetName() == EntityName)
+                        {
+                            EXPECT_EQ(entity->FindComponent(Uuid_RemoveThisComponent), nullptr);
+                            EXPECT_NE(entity->FindComponent(Uuid_KeepThisComponent), nullptr);
+                        }
+                        return true;
+                    }
+                );
+            }
+        );
+        EXPECT_EQ(processedDocumentCount, DocumentCount);
+    }
+
     TEST_F(PrefabProcessingTestFixture, PrefabProcessorRemoveComponentPerPlatform_ComponentDependencyError)
     {
         using namespace AzToolsFramework::Prefab::PrefabConversionUtils;
@@ -444,4 +444,152 @@ namespace UnitTest
         PrefabTestDomUtils::ValidateInstances(newTemplateId, *entityComponents, entityComponentsPath);
     }
 
+    class PrefabUpdateNestedInstancesTest : public PrefabTestFixture
+    {
+    protected:
+        // Creates a nested Template with a single entity and an enclosing Template holding nestedInstanceCount Instances of it.
+        void CreateNestedTemplates(size_t nestedInstanceCount)
+        {
+            AZ::Entity* entity = CreateEntity("Entity");
+            AddRequiredEditorComponents({ entity->GetId() });
+            m_nestedTemplateInstance = m_prefabSystemComponent->CreatePrefab({ entity }, {}, NestedPrefabMockFilePath);
+            ASSERT_TRUE(m_nestedTemplateInstance);
+            m_nestedTemplateId = m_nestedTemplateInstance->GetTemplateId();
+            m_entityAlias = m_nestedTemplateInstance->GetEntityAliases().front();
+
+            AZStd::vector<AZStd::unique_ptr<Instance>> nestedInstances;
+            while (nestedInstances.size() < nestedInstanceCount)
+            {
+                nestedInstances.emplace_back(m_prefabSystemComponent->InstantiatePrefab(m_nestedTemplateId));
+            }
+
+            m_enclosingTemplateInstance = m_prefabSystemComponent->CreatePrefab({}, AZStd::move(nestedInstances), PrefabMockFilePath);
+            ASSERT_TRUE(m_enclosingTemplateInstance);
+            m_enclosingTemplateId = m_enclosingTemplateInstance->GetTemplateId();
+            m_nestedInstanceAliases = m_enclosingTemplateInstance->GetNestedInstanceAliases(m_nestedTemplateId);
+            ASSERT_EQ(m_nestedInstanceAliases.size(), nestedInstanceCount);
+        }
+
+        // Returns the path to the name of the entity of a nested Instance in the enclosing Template.
+        PrefabDomPath GetNestedEntityNamePath(const InstanceAlias& nestedInstanceAlias) const
+        {
+            return PrefabTestDomUtils::GetPrefabDomInstancePath(nestedInstanceAlias)
+                .Append(PrefabTestDomUtils::EntitiesValueName)
+                .Append(m_entityAlias.c_str(), static_cast<rapidjson::SizeType>(m_entityAlias.length()))
+                .Append(PrefabTestDomUtils::EntityNameValueName);
+        }
+
+        void ExpectNestedEntityNames(Instance& enclosingInstance, const char* expectedName)
+        {
+            size_t nestedInstanceCount = 0;
+            enclosingInstance.GetNestedInstances(
+                [&](AZStd::unique_ptr<Instance>& nestedInstance)
+                {
+                    ++nestedInstanceCount;
+                    EntityOptionalReference entity = nestedInstance->GetEntity(m_entityAlias);
+                    ASSERT_TRUE(entity.has_value());
+                    EXPECT_STREQ(entity->get().GetName().c_str(), expectedName);
+                });
+            EXPECT_EQ(nestedInstanceCount, m_nestedInstanceAliases.size());
+        }
+
+        AZStd::unique_ptr<Instance> m_nestedTemplateInstance;
+        AZStd::unique_ptr<Instance> m_enclosingTemplateInstance;
+        TemplateId m_nestedTemplateId = InvalidTemplateId;
+        TemplateId m_enclosingTemplateId = InvalidTemplateId;
+        EntityAlias m_entityAlias;
+        AZStd::vector<InstanceAlias> m_nestedInstanceAliases;
+    };
+
+    TEST_F(PrefabUpdateNestedInstancesTest, UpdatePrefabInstances_OnlyAncestorQueued_NestedInstancesUpdated)
+    {
+        CreateNestedTemplates(1);
+        AZStd::unique_ptr<Instance> enclosingInstance = m_prefabSystemComponent->InstantiatePrefab(m_enclosingTemplateId);
+        ASSERT_TRUE(enclosingInstance);
+        ExpectNestedEntityNames(*enclosingInstance, "Entity");
+
+        // Rename the entity of the nested Instance in the enclosing Template only, so only the enclosing Instances are queued.
+        // Reloading the enclosing Instance applies the change to its nested Instance.
+        PrefabDom& enclosingTemplateDom = m_prefabSystemComponent->FindTemplateDom(m_enclosingTemplateId);
+        GetNestedEntityNamePath(m_nestedInstanceAliases.front()).Set(enclosingTemplateDom, "Renamed Entity");
+
+        m_instanceUpdateExecutorInterface->AddTemplateInstancesToQueue(m_enclosingTemplateId);
+        EXPECT_TRUE(m_instanceUpdateExecutorInterface->UpdateTemplateInstancesInQueue());
+
+        ExpectNestedEntityNames(*enclosingInstance, "Renamed Entity");
+    }
+
+    TEST_F(PrefabUpdateNestedInstancesTest, UpdatePrefabInstances_OnlyDescendantQueued_NestedInstancesUpdated)
+    {
+        // Two nested Instances, so the enclosing Template is the target of two links
+        CreateNestedTemplates(2);
+        AZStd::unique_ptr<Instance> enclosingInstance = m_prefabSystemComponent->InstantiatePrefab(m_enclosingTemplateId);
+        ASSERT_TRUE(enclosingInstance);
+
+        // Rename the entity in the nested Template. Propagating it updates the enclosing Template through the links, and only
+        // queues the Instances of the nested Template, including the ones nested in the enclosing Instance.
+        PrefabDom& nestedTemplateDom = m_prefabSystemComponent->FindTemplateDom(m_nestedTemplateId);
+        PrefabTestDomUtils::GetPrefabDomEntityNamePath(m_entityAlias).Set(nestedTemplateDom, "Renamed Entity");
+        m_prefabSystemComponent->PropagateTemplateChanges(m_nestedTemplateId);
+
+        const PrefabDom& enclosingTemplateDom = m_prefabSystemComponent->FindTemplateDom(m_enclosingTemplateId);
+        for (const InstanceAlias& nestedInstanceAlias : m_nestedInstanceAliases)
+        {
+            const PrefabDomValue* nestedEntityName = GetNestedEntityNamePath(nestedInstanceAlias).Get(enclosingTemplateDom);
+            ASSERT_TRUE(nestedEntityName && nestedEntityName->IsString());
+            EXPECT_STREQ(nestedEntityName->GetString(), "Renamed Entity");
+        }
+
+        EXPECT_TRUE(m_instanceUpdateExecutorInterface->UpdateTemplateInstancesInQueue());
+
+        ExpectNestedEntityNames(*enclosingInstance, "Renamed Entity");
+    }
+
+    TEST_F(PrefabUpdateNestedInstancesTest, UpdatePrefabInstances_AncestorAndDescendantQueued_NestedInstancesUpdated)
+    {
+        CreateNestedTemplates(2);
+        AZStd::unique_ptr<Instance> enclosingInstance = m_prefabSystemComponent->InstantiatePrefab(m_enclosingTemplateId);
+        ASSERT_TRUE(enclosingInstance);
+
+        // Queue both the nested Instances and the enclosing Instances. The nested Instances are only reloaded through their
+        // enclosing Instance.
+        PrefabDom& nestedTemplateDom = m_prefabSystemComponent->FindTemplateDom(m_nestedTemplateId);
+        PrefabTestDomUtils::GetPrefabDomEntityNamePath(m_entityAlias).Set(nestedTemplateDom, "Renamed Entity");
+        m_prefabSystemComponent->PropagateTemplateChanges(m_nestedTemplateId);
+        m_instanceUpdateExecutorInterface->AddTemplateInstancesToQueue(m_enclosingTemplateId);
+
+        EXPECT_TRUE(m_instanceUpdateExecutorInterface->UpdateTemplateInstancesInQueue());
+
+        ExpectNestedEntityNames(*enclosingInstance, "Renamed Entity");
+    }
+
+    TEST_F(PrefabUpdateNestedInstancesTest, PropagateTemplateChanges_LinkedInstanceChanged_PropagatesToOuterTemplate)
+    {
+        CreateNestedTemplates(1);
+
+        // Nest the enclosing Template in an outer Template
+        AZStd::unique_ptr<Instance> outerInstance = m_prefabSystemComponent->CreatePrefab(
+            {}, MakeInstanceList(m_prefabSystemComponent->InstantiatePrefab(m_enclosingTemplateId)), CarPrefabMockFilePath);
+        ASSERT_TRUE(outerInstance);
+        const TemplateId outerTemplateId = outerInstance->GetTemplateId();
+        const AZStd::vector<InstanceAlias> enclosingInstanceAliases = outerInstance->GetNestedInstanceAliases(m_enclosingTemplateId);
+        ASSERT_EQ(enclosingInstanceAliases.size(), 1);
+
+        // Renaming the entity in the nested Template changes the enclosing Template, which must be propagated to the outer Template
+        PrefabDom& nestedTemplateDom = m_prefabSystemComponent->FindTemplateDom(m_nestedTemplateId);
+        PrefabTestDomUtils::GetPrefabDomEntityNamePath(m_entityAlias).Set(nestedTemplateDom, "Renamed Entity");
+        m_prefabSystemComponent->PropagateTemplateChanges(m_nestedTemplateId);
+
+        const PrefabDom& outerTemplateDom = m_prefabSystemComponent->FindTemplateDom(outerTemplateId);
+        const InstanceAlias& enclosingInstanceAlias = enclosingInstanceAliases.front();
+        PrefabDomPath outerEntityNamePath = PrefabTestDomUtils::GetPrefabDomInstancePath(enclosingInstanceAlias)
+            .Append(PrefabDomUtils::InstancesName)
+            .Append(m_nestedInstanceAliases.front().c_str(), static_cast<rapidjson::SizeType>(m_nestedInstanceAliases.front().length()))
+            .Append(PrefabTestDomUtils::EntitiesValueName)
+            .Append(m_entityAlias.c_str(), static_cast<rapidjson::SizeType>(m_entityAlias.length()))
+            .Append(PrefabTestDomUtils::EntityNameValueName);
+        const PrefabDomValue* outerEntityName = outerEntityNamePath.Get(outerTemplateDom);
+        ASSERT_TRUE(outerEntityName && outerEntityName->IsString());
+        EXPECT_STREQ(outerEntityName->GetString(), "Renamed Entity");
+    }
 }
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Prefab/PrefabTestFixture.h>
+
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzFramework/Spawnable/Spawnable.h>
+#include <AzToolsFramework/Prefab/Spawnable/PrefabInMemorySpawnableConverter.h>
+
+namespace UnitTest
+{
+    class PrefabInMemorySpawnableConverterTest
+        : public PrefabTestFixture
+    {
+    protected:
+        inline static constexpr const char* StackProfile = "InMemorySpawnableConverterTests";
+        inline static constexpr const char* SpawnableName = "InMemorySpawnableConverterTest";
+
+        void SetUpEditorFixtureImpl() override
+        {
+            PrefabTestFixture::SetUpEditorFixtureImpl();
+
+            constexpr AZStd::string_view stack = R"({ "Prefab catchment": { "$type": "AzToolsFramework::Prefab::PrefabConversionUtils::PrefabCatchmentProcessor" } })";
+            ASSERT_TRUE(m_settingsRegistryInterface->MergeSettings(
+                stack, AZ::SettingsRegistryInterface::Format::JsonMergePatch, "/Amazon/Tools/Prefab/Processing/Stack/InMemorySpawnableConverterTests"));
+            ASSERT_TRUE(m_converter.Activate(StackProfile));
+        }
+
+        void TearDownEditorFixtureImpl() override
+        {
+            m_converter.Deactivate();
+            PrefabTestFixture::TearDownEditorFixtureImpl();
+        }
+
+        //! Converts the template and releases the spawnable again, like leaving game mode does, so the next conversion can reuse it.
+        //! Conversions use a new random source id, so a spawnable with the same asset id as before was loaded from the cache.
+        AZ::Data::AssetId Convert(TemplateId templateId, size_t& entityCount)
+        {
+            auto result = m_converter.CreateInMemorySpawnableAsset(templateId, SpawnableName, false);
+            EXPECT_TRUE(result.IsSuccess());
+            if (!result.IsSuccess())
+            {
+                return {};
+            }
+
+            AZ::Data::Asset<AZ::Data::AssetData>& asset = result.GetValue().get();
+            const AZ::Data::AssetId assetId = asset.GetId();
+            auto spawnable = azrtti_cast<AzFramework::Spawnable*>(asset.GetData());
+            EXPECT_NE(spawnable, nullptr);
+            entityCount = spawnable ? spawnable->GetEntities().size() : 0;
+
+            EXPECT_TRUE(m_converter.GetAssetContainer().RemoveInMemorySpawnableAsset(SpawnableName).IsSuccess());
+            return assetId;
+        }
+
+        AZ::Data::AssetId Convert(TemplateId templateId)
+        {
+            size_t entityCount = 0;
+            return Convert(templateId, entityCount);
+        }
+
+        PrefabConversionUtils::PrefabInMemorySpawnableConverter m_converter;
+    };
+
+    TEST_F(PrefabInMemorySpawnableConverterTest, CreateInMemorySpawnableAsset_TemplateUnchanged_ReusesCachedSpawnable)
+    {
+        CreateEditorEntityUnderRoot("Entity");
+        const TemplateId rootTemplateId = m_prefabEditorEntityOwnershipInterface->GetRootPrefabTemplateId();
+
+        size_t firstEntityCount = 0;
+        const AZ::Data::AssetId firstAssetId = Convert(rootTemplateId, firstEntityCount);
+        ASSERT_TRUE(firstAssetId.IsValid());
+
+        size_t secondEntityCount = 0;
+        const AZ::Data::AssetId secondAssetId = Convert(rootTemplateId, secondEntityCount);
+        EXPECT_EQ(firstAssetId, secondAssetId);
+        EXPECT_EQ(firstEntityCount, secondEntityCount);
+    }
+
+    TEST_F(PrefabInMemorySpawnableConverterTest, CreateInMemorySpawnableAsset_SpawnableStillLoaded_ConvertsAgain)
+    {
+        CreateEditorEntityUnderRoot("Entity");
+        const TemplateId rootTemplateId = m_prefabEditorEntityOwnershipInterface->GetRootPrefabTemplateId();
+
+        auto result = m_converter.CreateInMemorySpawnableAsset(rootTemplateId, SpawnableName, false);
+        ASSERT_TRUE(result.IsSuccess());
+        AZ::Data::Asset<AZ::Data::AssetData> firstAsset = result.GetValue().get();
+        EXPECT_TRUE(m_converter.GetAssetContainer().RemoveInMemorySpawnableAsset(SpawnableName).IsSuccess());
+
+        // The cached asset ids can't be reused while an asset from the previous conversion is still around.
+        EXPECT_NE(Convert(rootTemplateId), firstAsset.GetId());
+    }
+
+    TEST_F(PrefabInMemorySpawnableConverterTest, CreateInMemorySpawnableAsset_TemplateChanged_ConvertsAgain)
+    {
+        CreateEditorEntityUnderRoot("Entity");
+        const TemplateId rootTemplateId = m_prefabEditorEntityOwnershipInterface->GetRootPrefabTemplateId();
+
+        size_t firstEntityCount = 0;
+        const AZ::Data::AssetId firstAssetId = Convert(rootTemplateId, firstEntityCount);
+        ASSERT_TRUE(firstAssetId.IsValid());
+
+        // Updating the template queues its instances, which reports the change to the converter.
+        CreateEditorEntityUnderRoot("AddedEntity");
+
+        size_t secondEntityCount = 0;
+        const AZ::Data::AssetId secondAssetId = Convert(rootTemplateId, secondEntityCount);
+        EXPECT_NE(firstAssetId, secondAssetId);
+        EXPECT_EQ(secondEntityCount, firstEntityCount + 1);
+
+        // The new conversion is cached in turn.
+        EXPECT_EQ(Convert(rootTemplateId), secondAssetId);
+    }
+
+    TEST_F(PrefabInMemorySpawnableConverterTest, CreateInMemorySpawnableAsset_NestedTemplateChanged_ConvertsAgain)
+    {
+        const AZ::EntityId entityId = CreateEditorEntityUnderRoot("Entity");
+        const AZ::EntityId containerId = CreateEditorPrefab("test/nested", { entityId });
+        InstanceOptionalReference nestedInstance = m_instanceEntityMapperInterface->FindOwningInstance(containerId);
+        ASSERT_TRUE(nestedInstance.has_value());
+        const TemplateId nestedTemplateId = nestedInstance->get().GetTemplateId();
+        const TemplateId rootTemplateId = m_prefabEditorEntityOwnershipInterface->GetRootPrefabTemplateId();
+        ASSERT_NE(nestedTemplateId, rootTemplateId);
+
+        const AZ::Data::AssetId firstAssetId = Convert(rootTemplateId);
+        ASSERT_TRUE(firstAssetId.IsValid());
+
+        // Only the nested template reports a change, the root template is updated through the link.
+        m_instanceUpdateExecutorInterface->AddTemplateInstancesToQueue(nestedTemplateId);
+        PropagateAllTemplateChanges();
+
+        EXPECT_NE(Convert(rootTemplateId), firstAssetId);
+    }
+
+    TEST_F(PrefabInMemorySpawnableConverterTest, CreateInMemorySpawnableAsset_UnrelatedTemplateChanged_ReusesCachedSpawnable)
+    {
+        CreateEditorEntityUnderRoot("Entity");
+        const TemplateId rootTemplateId = m_prefabEditorEntityOwnershipInterface->GetRootPrefabTemplateId();
+
+        AZStd::unique_ptr<Instance> unrelatedInstance(
+            m_prefabSystemComponent->CreatePrefab({ CreateEntity("UnrelatedEntity") }, {}, "test/unrelated"));
+        ASSERT_TRUE(unrelatedInstance);
+
+        const AZ::Data::AssetId firstAssetId = Convert(rootTemplateId);
+        ASSERT_TRUE(firstAssetId.IsValid());
+
+        m_instanceUpdateExecutorInterface->AddTemplateInstancesToQueue(unrelatedInstance->GetTemplateId());
+        PropagateAllTemplateChanges();
+
+        EXPECT_EQ(Convert(rootTemplateId), firstAssetId);
+    }
+} // namespace UnitTest
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Math/Uuid.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/IO/SystemFile.h>
@@ -126,4 +127,35 @@ namespace UnitTest
         }
     }
 
+    TEST_F(SQLiteTest, NestedTransaction_InnerRollback_KeepsOuterWrites)
+    {
+        ASSERT_TRUE(m_database->IsOpen());
+
+        m_database->AddStatement("CreateTable", "CREATE TABLE IF NOT EXISTS nested( value INTEGER NOT NULL);");
+        m_database->AddStatement("InsertOne", "INSERT INTO nested (value) VALUES (1);");
+        m_database->AddStatement("InsertTwo", "INSERT INTO nested (value) VALUES (2);");
+        EXPECT_TRUE(m_database->ExecuteOneOffStatement("CreateTable"));
+
+        {
+            SQLite::ScopedTransaction outer(m_database.get());
+            EXPECT_TRUE(m_database->ExecuteOneOffStatement("InsertOne"));
+            {
+                // never committed, so only its own insert is rolled back
+                SQLite::ScopedTransaction inner(m_database.get());
+                EXPECT_TRUE(m_database->ExecuteOneOffStatement("InsertTwo"));
+            }
+            outer.Commit();
+        }
+
+        AZStd::vector<int> values;
+        m_database->ExecuteRawSqlQuery("SELECT value FROM nested;",
+            [&values](sqlite3_stmt* statement)
+            {
+                values.push_back(SQLite::GetColumnInt(statement, 0));
+                return true;
+            }, nullptr);
+
+        ASSERT_EQ(values.size(), 1);
+        EXPECT_EQ(values[0], 1);
+    }
 }
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/Matrix3x3.h>
 #include <AzCore/Math/Random.h>
@@ -855,6 +856,89 @@ namespace UnitTest
         EXPECT_FALSE(previousWorldTM.IsClose(nextWorldTM));
     }
 
+    // Sets up a parent/child/grandchild hierarchy with transform_batchHierarchyUpdates enabled and counts the notifications.
+    class BatchedTransformHierarchy
+        : public TransformComponentApplication
+    {
+    protected:
+        void SetUp() override
+        {
+            TransformComponentApplication::SetUp();
+            AZ::Interface<AZ::IConsole>::Get()->PerformCommand("transform_batchHierarchyUpdates true");
+
+            for (size_t index = 0; index < EntityCount; ++index)
+            {
+                m_entities[index] = aznew Entity(AZStd::string::format("Entity%zu", index).c_str());
+                m_entities[index]->Init();
+                AZ::TransformConfig config{ AZ::Transform::CreateTranslation(AZ::Vector3(1.0f, 0.0f, 0.0f)) };
+                config.m_parentId = index > 0 ? m_entities[index - 1]->GetId() : AZ::EntityId();
+                m_entities[index]->CreateComponent<TransformComponent>()->SetConfiguration(config);
+                m_entities[index]->Activate();
+
+                m_transforms[index] = m_entities[index]->GetTransform();
+                m_changedHandlers[index] = AZ::TransformChangedEvent::Handler(
+                    [this, index](const AZ::Transform&, const AZ::Transform&)
+                    {
+                        ++m_changedCounts[index];
+                    });
+                m_transforms[index]->BindTransformChangedEventHandler(m_changedHandlers[index]);
+            }
+        }
+
+        void TearDown() override
+        {
+            for (size_t index = EntityCount; index > 0; --index)
+            {
+                m_changedHandlers[index - 1].Disconnect();
+                if (m_entities[index - 1]->GetState() == Entity::State::Active)
+                {
+                    m_entities[index - 1]->Deactivate();
+                }
+                delete m_entities[index - 1];
+            }
+            AZ::Interface<AZ::IConsole>::Get()->PerformCommand("transform_batchHierarchyUpdates false");
+            TransformComponentApplication::TearDown();
+        }
+
+        static constexpr size_t EntityCount = 3;
+        Entity* m_entities[EntityCount] = {};
+        TransformInterface* m_transforms[EntityCount] = {};
+        AZ::TransformChangedEvent::Handler m_changedHandlers[EntityCount];
+        int m_changedCounts[EntityCount] = {};
+    };
+
+    TEST_F(BatchedTransformHierarchy, SetLocalTM_DescendantsAndListenersUpdatedOnFlush)
+    {
+        m_transforms[0]->SetLocalTM(Transform::CreateTranslation(Vector3(2.0f, 0.0f, 0.0f)));
+        m_transforms[0]->SetLocalTM(Transform::CreateTranslation(Vector3(3.0f, 0.0f, 0.0f)));
+        m_transforms[1]->SetLocalTM(Transform::CreateTranslation(Vector3(0.0f, 1.0f, 0.0f)));
+
+        // The moved transforms are up to date, their descendants and the listeners wait for the flush
+        EXPECT_THAT(m_transforms[0]->GetWorldTM().GetTranslation(), IsClose(Vector3(3.0f, 0.0f, 0.0f)));
+        EXPECT_THAT(m_transforms[1]->GetWorldTM().GetTranslation(), IsClose(Vector3(3.0f, 1.0f, 0.0f)));
+        EXPECT_THAT(m_transforms[2]->GetWorldTM().GetTranslation(), IsClose(Vector3(3.0f, 0.0f, 0.0f)));
+        EXPECT_EQ(m_changedCounts[0], 0);
+
+        TransformComponent::FlushHierarchyUpdates();
+
+        EXPECT_THAT(m_transforms[2]->GetWorldTM().GetTranslation(), IsClose(Vector3(4.0f, 1.0f, 0.0f)));
+        for (size_t index = 0; index < EntityCount; ++index)
+        {
+            EXPECT_EQ(m_changedCounts[index], 1);
+        }
+    }
+
+    TEST_F(BatchedTransformHierarchy, DeactivateQueuedEntity_NotNotifiedOnFlush)
+    {
+        m_transforms[2]->SetWorldTM(Transform::CreateTranslation(Vector3(5.0f, 0.0f, 0.0f)));
+        EXPECT_THAT(m_transforms[2]->GetLocalTM().GetTranslation(), IsClose(Vector3(3.0f, 0.0f, 0.0f)));
+
+        m_entities[2]->Deactivate();
+        TransformComponent::FlushHierarchyUpdates();
+
+        EXPECT_EQ(m_changedCounts[2], 0);
+    }
+
     // Fixture that loads a TransformComponent from a buffer.
     // Useful for testing version converters.
     class TransformComponentVersionConverter
@@ -8,6 +8,7 @@
 
 #include <AzTest/AzTest.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/UnitTest/Mocks/MockFileIOBase.h>
 
 #include <AzToolsFramework/AssetBrowser/AssetBrowserBus.h>
@@ -488,6 +489,29 @@ namespace UnitTest
         EXPECT_EQ(tableViewRowcount, 3);
     }
 
+    TEST_F(AssetBrowserTest, CachedFilterResultsMatchUncachedFilterResults)
+    {
+        auto console = AZ::Interface<AZ::IConsole>::Get();
+        ASSERT_NE(console, nullptr);
+
+        for (const QString filterString : { QString("source_1"), QString("product_1"), QString("no_match"), QString() })
+        {
+            m_searchWidget->SetTextFilter(filterString);
+
+            console->PerformCommand("ed_assetBrowserCacheFilterResults true");
+            m_filterModel->FilterUpdatedSlotImmediate();
+            const int cachedRowCount = m_tableModel->rowCount();
+
+            console->PerformCommand("ed_assetBrowserCacheFilterResults false");
+            m_filterModel->FilterUpdatedSlotImmediate();
+            const int uncachedRowCount = m_tableModel->rowCount();
+
+            EXPECT_EQ(cachedRowCount, uncachedRowCount) << filterString.toUtf8().constData();
+        }
+
+        console->PerformCommand("ed_assetBrowserCacheFilterResults true");
+    }
+
     TEST_F(AssetBrowserTest, CheckScanFolderAddition)
     {
         EXPECT_EQ(m_assetBrowserModel->rowCount(), 1);
@@ -519,4 +519,53 @@ namespace UnitTest
         EXPECT_EQ(numUndos, counter);
         EXPECT_EQ(tracker, numUndos);
     }
+
+    TEST(UndoStack, UndoRedoMaxSequencePointCount)
+    {
+        UndoStack undoStack(nullptr);
+        undoStack.SetMaxSequencePointCount(3);
+
+        int tracker = 0;
+        undoStack.Post(aznew UndoIntSetter(&tracker, 1));
+        undoStack.SetClean();
+        for (int i = 1; i < 5; i++)
+        {
+            undoStack.Post(aznew UndoIntSetter(&tracker, i + 1));
+        }
+        EXPECT_EQ(tracker, 5);
+
+        // only the last 3 steps can be undone, and the clean state was trimmed
+        int counter = 0;
+        while (undoStack.CanUndo())
+        {
+            undoStack.Undo();
+            EXPECT_FALSE(undoStack.IsClean());
+            counter++;
+        }
+        EXPECT_EQ(counter, 3);
+        EXPECT_EQ(tracker, 2);
+
+        // trimming keeps the redo history
+        undoStack.SetMaxSequencePointCount(1);
+        EXPECT_TRUE(undoStack.CanRedo());
+
+        counter = 0;
+        while (undoStack.CanRedo())
+        {
+            undoStack.Redo();
+            counter++;
+        }
+        EXPECT_EQ(counter, 3);
+        EXPECT_EQ(tracker, 5);
+
+        undoStack.SetMaxSequencePointCount(1);
+        counter = 0;
+        while (undoStack.CanUndo())
+        {
+            undoStack.Undo();
+            counter++;
+        }
+        EXPECT_EQ(counter, 1);
+        EXPECT_EQ(tracker, 4);
+    }
 }
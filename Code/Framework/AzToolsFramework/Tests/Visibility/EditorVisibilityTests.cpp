@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzFramework/Viewport/CameraState.h>
 #include <AzFramework/Visibility/BoundsBus.h>
@@ -176,6 +177,86 @@ namespace UnitTest
         EXPECT_THAT(visibleEditorEntityIds, UnorderedElementsAreArray(expectedEditorEntities));
     }
 
+    // moves an entity from its OnTick, late in the tick order
+    class LateTickEntityMover : public AZ::TickBus::Handler
+    {
+    public:
+        LateTickEntityMover(const AZ::EntityId entityId, const AZ::Vector3& worldTranslation)
+            : m_entityId(entityId)
+            , m_worldTranslation(worldTranslation)
+        {
+            AZ::TickBus::Handler::BusConnect();
+        }
+
+        ~LateTickEntityMover() override
+        {
+            AZ::TickBus::Handler::BusDisconnect();
+        }
+
+        // TickBus overrides ...
+        void OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time) override
+        {
+            AZ::TransformBus::Event(m_entityId, &AZ::TransformBus::Events::SetWorldTranslation, m_worldTranslation);
+        }
+
+        int GetTickOrder() override
+        {
+            return AZ::TICK_UI;
+        }
+
+    private:
+        AZ::EntityId m_entityId;
+        AZ::Vector3 m_worldTranslation;
+    };
+
+    TEST_F(EditorVisibilityFixture, EntityTranslatedDuringTickIsUpdatedInVisibilitySystemInSameFrame)
+    {
+        using ::testing::UnorderedElementsAreArray;
+
+        constexpr size_t EditorEntityCount = 21;
+        constexpr size_t BeginVisibleEntityRangeOffset = 7;
+        constexpr size_t EndVisibleEntityRangeOffset = 14;
+
+        // setup row of editor entities
+        CreateEditorEntities(EditorEntityCount);
+        SetupRowOfEntities(AZ::Vector3::CreateAxisX(-20.0f), AZ::Vector3::CreateAxisX(2.0f));
+
+        // request the entity union bounds system to update
+        AzFramework::IEntityBoundsUnionRequestBus::Broadcast(
+            &AzFramework::IEntityBoundsUnionRequestBus::Events::ProcessEntityBoundsUnionRequests);
+
+        // move an entity out of view from a tick handler, then tick a single frame
+        const AZ::EntityId entityIdToMove = m_editorEntityIds[10];
+        {
+            LateTickEntityMover entityMover(entityIdToMove, AZ::Vector3::CreateAxisZ(100.0f));
+            AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.0f, AZ::ScriptTimePoint{});
+        }
+
+        // create default camera looking down the negative y-axis moved just back from the origin
+        AzFramework::CameraState cameraState = AzFramework::CreateDefaultCamera(
+            AZ::Transform::CreateTranslation(AZ::Vector3::CreateAxisY(-5.0f)), ScreenDimensions);
+
+        // perform a visibility query based on the state of the camera (no explicit update of the visibility system)
+        AzFramework::EntityVisibilityQuery entityVisibilityQuery;
+        entityVisibilityQuery.UpdateVisibility(cameraState);
+
+        // build a vector of visible entities
+        AZStd::vector<AZ::EntityId> visibleEditorEntityIds;
+        AZStd::copy(
+            entityVisibilityQuery.Begin(), entityVisibilityQuery.End(), AZStd::back_inserter(visibleEditorEntityIds));
+
+        // build the expected vector of entity ids, without the entity that was moved during the frame
+        AZStd::vector<AZ::EntityId> expectedEditorEntities;
+        AZStd::copy(
+            m_editorEntityIds.begin() + BeginVisibleEntityRangeOffset,
+            m_editorEntityIds.begin() + EndVisibleEntityRangeOffset, AZStd::back_inserter(expectedEditorEntities));
+        expectedEditorEntities.erase(
+            AZStd::remove(expectedEditorEntities.begin(), expectedEditorEntities.end(), entityIdToMove),
+            expectedEditorEntities.end());
+
+        EXPECT_THAT(visibleEditorEntityIds, UnorderedElementsAreArray(expectedEditorEntities));
+    }
+
     class TestBoundComponent
         : public AZ::Component
         , public AzFramework::BoundsRequestBus::Handler
@@ -149,6 +149,7 @@ set(FILES
     Prefab/PrefabUpdateTemplateTests.cpp
     Prefab/PrefabUpdateWithPatchesTests.cpp
     Prefab/Serialization/PrefabComponentAliasTests.cpp
+    Prefab/Spawnable/PrefabInMemorySpawnableConverterTests.cpp
     Prefab/Spawnable/SpawnableMetaDataTests.cpp
     Prefab/Spawnable/SpawnableTestFixture.h
     Prefab/Spawnable/SpawnableTestFixture.cpp
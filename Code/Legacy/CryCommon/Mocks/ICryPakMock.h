@@ -75,6 +75,7 @@ struct CryPakMock
     MOCK_CONST_METHOD0(GetPakPriority, AZ::IO::FileSearchPriority());
     MOCK_CONST_METHOD1(GetFileOffsetOnMedia, uint64_t(AZStd::string_view szName));
     MOCK_CONST_METHOD1(GetFileMediaType, EStreamSourceMediaType(AZStd::string_view szName));
+    MOCK_METHOD1(MapFileInPak, AZ::IO::MappedFileView(AZStd::string_view szName));
     MOCK_METHOD0(GetLevelPackOpenEvent, LevelPackOpenEvent*());
     MOCK_METHOD0(GetLevelPackCloseEvent, LevelPackCloseEvent*());
 
@@ -44,6 +44,10 @@ namespace AssetProcessor
             return false;// return false, we actually curate/write to this database.
         }
         void VacuumAndAnalyze();
+        //! Groups the writes that follow into a single transaction, which is committed by the matching CommitTransaction.
+        //! Use around loops that write a row per file, each write would otherwise be its own transaction.
+        void BeginTransaction();
+        void CommitTransaction();
 
     protected:
         void CreateStatements() override;
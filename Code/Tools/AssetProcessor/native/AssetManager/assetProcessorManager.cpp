@@ -3521,6 +3521,9 @@ namespace AssetProcessor
         m_totalScannerFilesToAssess = filePaths.size();
         m_scannerFilesAssessed = 0;
 
+        // unchanged files can each update their modtime, commit them together instead of one transaction per file
+        m_stateData->BeginTransaction();
+
         for (const AssetFileInfo& fileInfo : filePaths)
         {
             if (m_allowModtimeSkippingFeature)
@@ -3554,6 +3557,8 @@ namespace AssetProcessor
             ++processedFileCount;
         }
 
+        m_stateData->CommitTransaction();
+
         if (m_allowModtimeSkippingFeature)
         {
             AZ_TracePrintf(AssetProcessor::DebugChannel, "%d files reported from scanner.  %d unchanged files skipped, %d files processed\n", filePaths.size(), filePaths.size() - processedFileCount, processedFileCount);
@@ -10,6 +10,7 @@
 #include "native/utilities/PlatformConfiguration.h"
 #include <QDir>
 #include <QtConcurrent/QtConcurrentFilter>
+#include <QtConcurrent/QtConcurrentRun>
 
 using namespace AssetProcessor;
 
@@ -35,10 +36,29 @@ void AssetScannerWorker::StartScan()
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Started);
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::InProgress);
 
-    for (int idx = 0; idx < m_platformConfiguration->GetScanFolderCount(); idx++)
+    // Scan folders are independent trees (often on different drives), walk them concurrently and merge the results.
+    // Directory enumeration is dominated by file system latency, so this scales even beyond the number of cores.
+    const int scanFolderCount = m_platformConfiguration->GetScanFolderCount();
+    QVector<ScanFolderResult> results(scanFolderCount);
+    QVector<QFuture<void>> scans;
+    scans.reserve(scanFolderCount);
+    for (int idx = 0; idx < scanFolderCount; idx++)
     {
         const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
-        ScanForSourceFiles(scanFolderInfo, scanFolderInfo);
+        ScanFolderResult& result = results[idx];
+        scans.push_back(QtConcurrent::run([this, &scanFolderInfo, &result]()
+        {
+            ScanForSourceFiles(scanFolderInfo, scanFolderInfo, result);
+        }));
+    }
+
+    for (int idx = 0; idx < scanFolderCount; idx++)
+    {
+        scans[idx].waitForFinished();
+        m_fileList.unite(results[idx].m_fileList);
+        m_folderList.unite(results[idx].m_folderList);
+        m_excludedList.unite(results[idx].m_excludedList);
+        results[idx] = {};
     }
 
     // we want not to emit any signals until we're finished scanning
@@ -72,7 +92,7 @@ void AssetScannerWorker::StopScan()
     m_doScan = false;
 }
 
-void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder)
+void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder, ScanFolderResult& result)
 {
     if (!m_doScan)
     {
@@ -135,13 +155,13 @@ void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo
 
                 if (m_platformConfiguration->IsFileExcludedRelPath(relPath))
                 {
-                    m_excludedList.insert(AZStd::move(assetFileInfo));
+                    result.m_excludedList.insert(AZStd::move(assetFileInfo));
                     continue;
                 }
 
                 // Entry is a directory
                 // The AP needs to know about all directories so it knows when a delete occurs if the path refers to a folder or a file
-                m_folderList.insert(AZStd::move(assetFileInfo));
+                result.m_folderList.insert(AZStd::move(assetFileInfo));
 
                 // recurse into this folder.
                 // Since we only care about source files, we can skip cache folders that are not the Intermediate Assets Folder.
@@ -173,11 +193,11 @@ void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo
                 {
                     if (!m_platformConfiguration->IsFileExcludedRelPath(relPath))
                     {
-                        m_fileList.insert(AZStd::move(assetFileInfo));
+                        result.m_fileList.insert(AZStd::move(assetFileInfo));
                     }
                     else
                     {
-                        m_excludedList.insert(AZStd::move(assetFileInfo));
+                        result.m_excludedList.insert(AZStd::move(assetFileInfo));
                     }
                 }
             }
@@ -43,9 +43,18 @@ Q_SIGNALS:
         void StopScan();
 
     protected:
+        //! What was found under a single scan folder, each scan folder is walked by its own worker
+        struct ScanFolderResult
+        {
+            QSet<AssetFileInfo> m_fileList;
+            QSet<AssetFileInfo> m_folderList;
+            QSet<AssetFileInfo> m_excludedList;
+        };
+
         // scanFolderInfo - the folder we're currently scanning (this will sometimes be a fake scanfolder created when recursing through directories)
         // rootScanFolder - the actual scan folder we started with, which will either be the same as scanFolderInfo or a parent folder
-        void ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder);
+        // result - receives the files, folders and excluded entries found, it is only touched by the calling thread
+        void ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder, ScanFolderResult& result);
         void EmitFiles();
 
     private:
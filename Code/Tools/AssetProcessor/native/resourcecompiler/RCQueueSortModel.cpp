@@ -7,10 +7,37 @@
  */
 #include <native/resourcecompiler/RCQueueSortModel.h>
 #include <native/AssetDatabase/AssetDatabase.h>
+#include <AzCore/std/containers/stack.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/StringFunc/StringFunc.h>
 #include "rcjoblistmodel.h"
 
 namespace AssetProcessor
 {
+    namespace
+    {
+        // Jobs without history still count, so the depth of the dependency chain matters even on a first build
+        constexpr AZ::s64 DefaultJobDurationMs = 1;
+
+        // Recomputing the critical path resorts the whole queue, so while jobs are still being added do it at most this often
+        constexpr qint64 CriticalPathUpdateIntervalMs = 1000;
+
+        bool IsOrderJobDependency(const JobDependencyInternal& jobDependencyInternal)
+        {
+            return jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::Order ||
+                jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnce ||
+                jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnly;
+        }
+
+        QueueElementID GetDependencyElementID(const AssetBuilderSDK::JobDependency& jobDependency)
+        {
+            return QueueElementID(
+                SourceAssetReference(jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str()),
+                jobDependency.m_platformIdentifier.c_str(),
+                jobDependency.m_jobKey.c_str());
+        }
+    }
+
     RCQueueSortModel::RCQueueSortModel(QObject* parent)
         : QSortFilterProxyModel(parent)
     {
@@ -26,6 +53,8 @@ namespace AssetProcessor
             BusConnect();
             m_sourceModel = target;
 
+            LoadHistoricalJobDurations();
+
             setSourceModel(target);
             setSortRole(RCJobListModel::jobIndexRole);
             sort(0);
@@ -40,6 +69,14 @@ namespace AssetProcessor
 
     RCJob* RCQueueSortModel::GetNextPendingJob()
     {
+        if (m_criticalPathDirty && (!m_criticalPathTimer.isValid() || m_criticalPathTimer.elapsed() >= CriticalPathUpdateIntervalMs))
+        {
+            UpdateCriticalPathWeights();
+            m_criticalPathTimer.restart();
+            m_criticalPathDirty = false;
+            m_dirtyNeedsResort = true;
+        }
+
         if (m_dirtyNeedsResort)
         {
             setDynamicSortFilter(false);
@@ -93,19 +130,14 @@ namespace AssetProcessor
                 bool canProcessJob = true;
                 for (const JobDependencyInternal& jobDependencyInternal : actualJob->GetJobDependencies())
                 {
-                    if (jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::Order ||
-                        jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnce ||
-                        jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnly)
+                    if (IsOrderJobDependency(jobDependencyInternal))
                     {
                         const AssetBuilderSDK::JobDependency& jobDependency = jobDependencyInternal.m_jobDependency;
                         AZ_Assert(
                             AZ::IO::PathView(jobDependency.m_sourceFile.m_sourceFileDependencyPath).IsAbsolute(),
                             "Dependency path %s is not an absolute path",
                             jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str());
-                        QueueElementID elementId(
-                            SourceAssetReference(jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str()),
-                            jobDependency.m_platformIdentifier.c_str(),
-                            jobDependency.m_jobKey.c_str());
+                        QueueElementID elementId = GetDependencyElementID(jobDependency);
 
                         if (m_sourceModel->isInFlight(elementId) || m_sourceModel->isInQueue(elementId))
                         {
@@ -273,6 +305,15 @@ namespace AssetProcessor
             return priorityLeft > priorityRight;
         }
 
+        // the job heading the longest chain of remaining work goes first, so builders are not left idle at the end of a build
+        AZ::s64 criticalPathLeft = GetCriticalPathWeight(leftJob);
+        AZ::s64 criticalPathRight = GetCriticalPathWeight(rightJob);
+
+        if (criticalPathLeft != criticalPathRight)
+        {
+            return criticalPathLeft > criticalPathRight;
+        }
+
         if (leftJob->GetJobEntry().m_sourceAssetReference == rightJob->GetJobEntry().m_sourceAssetReference)
         {
             // If there are two jobs for the same source, then sort by job run key.
@@ -311,11 +352,156 @@ namespace AssetProcessor
     void RCQueueSortModel::AddJobIdEntry(AssetProcessor::RCJob* rcJob)
     {
         m_currentJobRunKeyToJobEntries[rcJob->GetJobEntry().m_jobRunKey] = rcJob;
+        m_criticalPathDirty = true;
     }
 
     void RCQueueSortModel::RemoveJobIdEntry(AssetProcessor::RCJob* rcJob)
     {
         m_currentJobRunKeyToJobEntries.erase(rcJob->GetJobEntry().m_jobRunKey);
+        m_criticalPathWeights.erase(rcJob->GetJobEntry().m_jobRunKey);
+    }
+
+    void RCQueueSortModel::LoadHistoricalJobDurations()
+    {
+        m_historicalJobDurations.clear();
+
+        AZStd::string databaseLocation;
+        AzToolsFramework::AssetDatabase::AssetDatabaseRequestsBus::Broadcast(
+            &AzToolsFramework::AssetDatabase::AssetDatabaseRequests::GetAssetDatabaseLocation, databaseLocation);
+        if (databaseLocation.empty())
+        {
+            return;
+        }
+
+        AssetProcessor::AssetDatabaseConnection assetDatabaseConnection;
+        if (!assetDatabaseConnection.OpenDatabase())
+        {
+            return;
+        }
+
+        // ProcessJob,scanFolder,sourceName,jobKey,platform,builderGuid
+        assetDatabaseConnection.QueryStatLikeStatName("ProcessJob,%",
+            [this](AzToolsFramework::AssetDatabase::StatDatabaseEntry entry)
+            {
+                static constexpr int numTokensExpected = 6;
+                AZStd::vector<AZStd::string> tokens;
+                AZ::StringFunc::Tokenize(entry.m_statName, tokens, ',');
+                if (tokens.size() == numTokensExpected)
+                {
+                    QueueElementID elementId;
+                    elementId.SetSourceAssetReference(SourceAssetReference(tokens[1].c_str(), tokens[2].c_str()));
+                    elementId.SetJobDescriptor(tokens[3].c_str());
+                    elementId.SetPlatform(tokens[4].c_str());
+                    m_historicalJobDurations[elementId] = entry.m_statValue;
+                }
+                return true;
+            });
+    }
+
+    void RCQueueSortModel::UpdateCriticalPathWeights()
+    {
+        m_criticalPathWeights.clear();
+
+        // index the pending jobs, and for each one the pending jobs that have to wait for it
+        AZStd::unordered_map<QueueElementID, RCJob*> pendingJobs;
+        for (const auto& [jobRunKey, job] : m_currentJobRunKeyToJobEntries)
+        {
+            if (job->GetState() == RCJob::pending)
+            {
+                pendingJobs[job->GetElementID()] = job;
+            }
+        }
+
+        AZStd::unordered_map<RCJob*, AZStd::vector<RCJob*>> dependentJobs;
+        for (const auto& [elementId, job] : pendingJobs)
+        {
+            for (const JobDependencyInternal& jobDependencyInternal : job->GetJobDependencies())
+            {
+                if (IsOrderJobDependency(jobDependencyInternal))
+                {
+                    auto dependency = pendingJobs.find(GetDependencyElementID(jobDependencyInternal.m_jobDependency));
+                    if (dependency != pendingJobs.end() && dependency->second != job)
+                    {
+                        dependentJobs[dependency->second].push_back(job);
+                    }
+                }
+            }
+        }
+
+        // weight = own duration + heaviest dependent weight, evaluated depth first without recursion.
+        // A job found on the stack again is part of a cycle and contributes only its own duration.
+        AZStd::unordered_map<RCJob*, AZ::s64> weights;
+        AZStd::unordered_set<RCJob*> visiting;
+        for (const auto& [elementId, rootJob] : pendingJobs)
+        {
+            if (weights.contains(rootJob))
+            {
+                continue;
+            }
+
+            AZStd::stack<RCJob*> jobsToVisit;
+            jobsToVisit.push(rootJob);
+            while (!jobsToVisit.empty())
+            {
+                RCJob* job = jobsToVisit.top();
+                bool hasUnvisitedDependents = false;
+                if (visiting.insert(job).second)
+                {
+                    auto dependents = dependentJobs.find(job);
+                    if (dependents != dependentJobs.end())
+                    {
+                        for (RCJob* dependent : dependents->second)
+                        {
+                            if (!weights.contains(dependent) && !visiting.contains(dependent))
+                            {
+                                jobsToVisit.push(dependent);
+                                hasUnvisitedDependents = true;
+                            }
+                        }
+                    }
+                }
+
+                if (hasUnvisitedDependents)
+                {
+                    continue;
+                }
+
+                jobsToVisit.pop();
+                if (weights.contains(job))
+                {
+                    continue;
+                }
+
+                AZ::s64 heaviestDependent = 0;
+                auto dependents = dependentJobs.find(job);
+                if (dependents != dependentJobs.end())
+                {
+                    for (RCJob* dependent : dependents->second)
+                    {
+                        auto dependentWeight = weights.find(dependent);
+                        if (dependentWeight != weights.end())
+                        {
+                            heaviestDependent = AZStd::max(heaviestDependent, dependentWeight->second);
+                        }
+                    }
+                }
+
+                auto duration = m_historicalJobDurations.find(job->GetElementID());
+                AZ::s64 ownDuration = duration != m_historicalJobDurations.end() ? AZStd::max(duration->second, DefaultJobDurationMs) : DefaultJobDurationMs;
+                weights[job] = ownDuration + heaviestDependent;
+            }
+        }
+
+        for (const auto& [job, weight] : weights)
+        {
+            m_criticalPathWeights[job->GetJobEntry().m_jobRunKey] = weight;
+        }
+    }
+
+    AZ::s64 RCQueueSortModel::GetCriticalPathWeight(const RCJob* job) const
+    {
+        auto weight = m_criticalPathWeights.find(job->GetJobEntry().m_jobRunKey);
+        return weight != m_criticalPathWeights.end() ? weight->second : 0;
     }
 
     void RCQueueSortModel::OnEscalateJobs(AssetProcessor::JobIdEscalationList jobIdEscalationList)
@@ -9,6 +9,7 @@
 #define ASSETPROCESSOR_RCQUEUESORTMODEL_H
 
 #if !defined(Q_MOC_RUN)
+#include <QElapsedTimer>
 #include <QSortFilterProxyModel>
 #include <QSet>
 #include <QString>
@@ -17,6 +18,7 @@
 #include "native/utilities/AssetUtilEBusHelper.h"
 #include <AzCore/std/containers/unordered_map.h>
 #include "native/assetprocessor.h"
+#include "native/resourcecompiler/RCCommon.h"
 #endif
 
 class RCcontrollerUnitTests;
@@ -34,6 +36,7 @@ namespace AssetProcessor
     //!  * Jobs in Sync Compile Requests for currently connected platforms (with most recent requests first)
     //!  * Jobs in Async Compile Lists for currently connected platforms
     //!  * Remaining jobs in currently connected platforms, in priority order
+    //!    then longest critical path first, so the jobs that unlock the most dependent work start early
     //!  (The same, repeated, for unconnected platforms).
     class RCQueueSortModel
         : public QSortFilterProxyModel
@@ -62,8 +65,19 @@ namespace AssetProcessor
 
         typedef AZStd::unordered_map<AZ::s64, AssetProcessor::RCJob*> JobRunKeyToRCJobMap;
 
+        //! Loads how long each job took the last time it was processed, from the ProcessJob stats in the asset database
+        void LoadHistoricalJobDurations();
+        //! Computes for every pending job the estimated duration of the longest chain of jobs waiting on it, including itself
+        void UpdateCriticalPathWeights();
+        AZ::s64 GetCriticalPathWeight(const RCJob* job) const;
+
         JobRunKeyToRCJobMap m_currentJobRunKeyToJobEntries;
 
+        AZStd::unordered_map<QueueElementID, AZ::s64> m_historicalJobDurations;
+        AZStd::unordered_map<AZ::s64, AZ::s64> m_criticalPathWeights; // keyed by job run key
+        bool m_criticalPathDirty = false;
+        QElapsedTimer m_criticalPathTimer;
+
         QSet<QString> m_currentlyConnectedPlatforms;
         bool m_dirtyNeedsResort = false; // instead of constantly resorting, we resort only when someone wants to pull an element from us
 
@@ -547,7 +547,35 @@ namespace AssetProcessor
                                  builderParams.m_processJobRequest.m_platformInfo.m_identifier.c_str())
                             .arg(builderParams.m_rcJob->GetOriginalFingerprint());
                         bool operationResult = false;
+                        bool jobClaimed = true;
                         if (assetServerMode == AssetServerMode::Server)
+                        {
+                            // when several build agents share the server, only the one that claims the job processes it
+                            AssetProcessor::AssetServerBus::BroadcastResult(jobClaimed, &AssetProcessor::AssetServerBusTraits::ClaimJob, builderParams);
+                            if (!jobClaimed)
+                            {
+                                AssetProcessor::AssetServerBus::BroadcastResult(operationResult, &AssetProcessor::AssetServerBusTraits::WaitForClaimedJobResult, builderParams);
+                                if (operationResult)
+                                {
+                                    operationResult = AfterRetrievingJobResult(builderParams, jobLogTraceListener, result);
+                                }
+
+                                if (operationResult)
+                                {
+                                    for (auto& product : result.m_outputProducts)
+                                    {
+                                        product.m_outputFlags |= AssetBuilderSDK::ProductOutputFlags::CachedAsset;
+                                    }
+                                    runProcessJob = false;
+                                }
+                                else
+                                {
+                                    result.m_outputProducts.clear();
+                                }
+                            }
+                        }
+
+                        if (assetServerMode == AssetServerMode::Server && runProcessJob)
                         {
                             // sending process job command to the builder
                             builderParams.m_assetBuilderDesc.m_processJobFunction(builderParams.m_processJobRequest, result);
@@ -578,6 +606,11 @@ namespace AssetProcessor
                                     }
                                 }
                             }
+
+                            if (jobClaimed)
+                            {
+                                AssetProcessor::AssetServerBus::Broadcast(&AssetProcessor::AssetServerBusTraits::ReleaseJobClaim, builderParams);
+                            }
                         }
                         else if (assetServerMode == AssetServerMode::Client)
                         {
@@ -56,6 +56,40 @@ namespace UnitTests
         ASSERT_EQ(bm.GetBuilderCreationCount(), NumberOfBuilders + 1);
     }
 
+    TEST_F(BuilderManagerTest, GetProcessJobBuilder_PrefersBuilderThatRanSameAssetBuilder)
+    {
+        ConnectionManager cm{nullptr};
+        TestBuilderManager bm(&cm);
+
+        const AZ::Uuid assetBuilderA = AZ::Uuid::CreateRandom();
+        const AZ::Uuid assetBuilderB = AZ::Uuid::CreateRandom();
+
+        AZ::Uuid builderUuidA;
+        AZ::Uuid builderUuidB;
+
+        {
+            auto builderA = bm.GetProcessJobBuilder(assetBuilderA);
+            auto builderB = bm.GetProcessJobBuilder(assetBuilderB);
+
+            ASSERT_TRUE(builderA);
+            ASSERT_TRUE(builderB);
+            ASSERT_NE(builderA->GetUuid(), builderB->GetUuid());
+
+            builderUuidA = builderA->GetUuid();
+            builderUuidB = builderB->GetUuid();
+        }
+
+        // Both builders are idle now, each asset builder should get the process that ran it last, in either request order
+        for (int i = 0; i < 4; ++i)
+        {
+            ASSERT_EQ(bm.GetProcessJobBuilder(assetBuilderB)->GetUuid(), builderUuidB);
+            ASSERT_EQ(bm.GetProcessJobBuilder(assetBuilderA)->GetUuid(), builderUuidA);
+        }
+
+        // No additional builders were started for the repeated requests
+        ASSERT_EQ(bm.GetBuilderCreationCount(), 3);
+    }
+
     AZ::Outcome<void, AZStd::string> TestBuilder::Start(AssetProcessor::BuilderPurpose /*purpose*/)
     {
         return AZ::Success();
@@ -1807,13 +1807,16 @@ void ApplicationManagerBase::RegisterBuilderInformation(const AssetBuilderSDK::A
 
         const bool debugOutput = m_assetProcessorManager->GetBuilderDebugFlag();
         // Also override the processJob function to run externally
+        const AZ::Uuid assetBuilderBusId = builderDesc.m_busId;
         modifiedBuilderDesc.m_processJobFunction =
-            [this, debugOutput](const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response)
+            [this, debugOutput, assetBuilderBusId](const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response)
         {
             AssetBuilderSDK::JobCancelListener jobCancelListener(request.m_jobId);
 
+            // Prefer a builder that already ran jobs for this asset builder, its modules are loaded and initialized
             AssetProcessor::BuilderRef builderRef;
-            AssetProcessor::BuilderManagerBus::BroadcastResult(builderRef, &AssetProcessor::BuilderManagerBusTraits::GetBuilder, AssetProcessor::BuilderPurpose::ProcessJob);
+            AssetProcessor::BuilderManagerBus::BroadcastResult(
+                builderRef, &AssetProcessor::BuilderManagerBusTraits::GetProcessJobBuilder, assetBuilderBusId);
 
             if (builderRef)
             {
@@ -11,7 +11,11 @@
 #include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzToolsFramework/Archive/ArchiveAPI.h>
 #include <AzCore/JSON/pointer.h>
+#include <AzCore/std/parallel/thread.h>
+#include <QCoreApplication>
+#include <QDateTime>
 #include <QDir>
+#include <QHostInfo>
 
 namespace AssetProcessor
 {
@@ -85,23 +89,77 @@ namespace AssetProcessor
         return {};
     }
 
-    QString AssetServerHandler::ComputeArchiveFilePath(const AssetProcessor::BuilderParams& builderParams)
+    AZStd::string CheckLocalCacheAddress()
+    {
+        auto settingsRegistry = AZ::SettingsRegistry::Get();
+        if (settingsRegistry)
+        {
+            AZStd::string address;
+            if (settingsRegistry->Get(address,
+                AZ::SettingsRegistryInterface::FixedValueString(AssetProcessor::AssetProcessorServerKey)
+                + "/"
+                + LocalCacheAddressKey))
+            {
+                AZ_TracePrintf(AssetProcessor::DebugChannel, "Local Cache Address: %s\n", address.c_str());
+                return AZStd::move(address);
+            }
+        }
+        return {};
+    }
+
+    bool CheckDistributedBuild()
     {
+        bool distributedBuild = false;
+        auto settingsRegistry = AZ::SettingsRegistry::Get();
+        if (settingsRegistry)
+        {
+            settingsRegistry->Get(distributedBuild,
+                AZ::SettingsRegistryInterface::FixedValueString(AssetProcessor::AssetProcessorServerKey)
+                + "/"
+                + DistributedBuildKey);
+        }
+        return distributedBuild;
+    }
+
+    // a claim that was not released after this long belongs to an agent that crashed or was stopped
+    constexpr qint64 StaleJobClaimSeconds = 60 * 60;
+    constexpr int JobClaimPollMilliseconds = 500;
+
+    QString ComputeClaimFilePath(const QString& archiveAbsFilePath)
+    {
+        return archiveAbsFilePath + ".claim";
+    }
+
+    bool IsJobClaimStale(const QString& claimFilePath)
+    {
+        QFileInfo claimInfo(claimFilePath);
+        return claimInfo.exists() && claimInfo.lastModified().secsTo(QDateTime::currentDateTime()) > StaleJobClaimSeconds;
+    }
+
+    QString ComputeArchiveFilePathInFolder(const AssetProcessor::BuilderParams& builderParams, const QString& rootFolder)
+    {
+        // the server key ends with the job fingerprint, which covers the builder version, the source contents and
+        // the fingerprints of its dependencies, so an archive is only ever reused for identical inputs
         QFileInfo fileInfo(builderParams.m_processJobRequest.m_sourceFile.c_str());
+        QString archiveFileName = builderParams.GetServerKey() + ".zip";
+        CleanupFilename(archiveFileName);
+        QDir archiveFolder = QDir(rootFolder).filePath(fileInfo.path());
+        QString archiveFilePath = archiveFolder.filePath(archiveFileName);
+
+        // create directories if does not exists
+        if (!archiveFolder.exists())
+        {
+            archiveFolder.mkdir(".");
+        }
+        return archiveFilePath;
+    }
+
+    QString AssetServerHandler::ComputeArchiveFilePath(const AssetProcessor::BuilderParams& builderParams)
+    {
         QString assetServerAddress = QDir::toNativeSeparators(QString{m_serverAddress.c_str()});
         if (!assetServerAddress.isEmpty())
         {
-            QString archiveFileName = builderParams.GetServerKey() + ".zip";
-            CleanupFilename(archiveFileName);
-            QDir archiveFolder = QDir(assetServerAddress).filePath(fileInfo.path());
-            QString archiveFilePath = archiveFolder.filePath(archiveFileName);
-
-            // create directories if does not exists
-            if (!archiveFolder.exists())
-            {
-                archiveFolder.mkdir(".");
-            }
-            return archiveFilePath;
+            return ComputeArchiveFilePathInFolder(builderParams, assetServerAddress);
         }
         else
         {
@@ -117,6 +175,40 @@ namespace AssetProcessor
         return QString();
     }
 
+    QString AssetServerHandler::ComputeLocalArchiveFilePath(const AssetProcessor::BuilderParams& builderParams)
+    {
+        QString localCacheAddress = QDir::toNativeSeparators(QString{ m_localCacheAddress.c_str() });
+        if (localCacheAddress.isEmpty())
+        {
+            return QString();
+        }
+        return ComputeArchiveFilePathInFolder(builderParams, localCacheAddress);
+    }
+
+    void AssetServerHandler::CopyArchiveToLocalCache(const QString& archiveAbsFilePath, const QString& localArchiveAbsFilePath)
+    {
+        if (localArchiveAbsFilePath.isEmpty() || localArchiveAbsFilePath == archiveAbsFilePath || QFile::exists(localArchiveAbsFilePath))
+        {
+            return;
+        }
+
+        QFileInfo fileInfo(localArchiveAbsFilePath);
+        if (!fileInfo.absoluteDir().exists() && !fileInfo.absoluteDir().mkpath("."))
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Could not make local cache folder %s", fileInfo.absoluteDir().absolutePath().toUtf8().data());
+            return;
+        }
+
+        // copy to a temporary name first so an interrupted copy is never picked up as a valid archive
+        QString partialFilePath = localArchiveAbsFilePath + ".partial";
+        QFile::remove(partialFilePath);
+        if (!QFile::copy(archiveAbsFilePath, partialFilePath) || !QFile::rename(partialFilePath, localArchiveAbsFilePath))
+        {
+            QFile::remove(partialFilePath);
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Failed to copy archive %s to the local cache", archiveAbsFilePath.toUtf8().data());
+        }
+    }
+
     const char* AssetServerHandler::GetAssetServerModeText(AssetServerMode mode)
     {
         switch (mode)
@@ -134,6 +226,8 @@ namespace AssetProcessor
     {
         SetRemoteCachingMode(CheckServerMode());
         SetServerAddress(CheckServerAddress());
+        SetLocalCacheAddress(CheckLocalCacheAddress());
+        SetDistributedBuild(CheckDistributedBuild());
         AssetServerBus::Handler::BusConnect();
     }
 
@@ -249,13 +343,129 @@ namespace AssetProcessor
         return true;
     }
 
-    bool AssetServerHandler::RetrieveJobResult(const AssetProcessor::BuilderParams& builderParams)
+    const AZStd::string& AssetServerHandler::GetLocalCacheAddress() const
+    {
+        return m_localCacheAddress;
+    }
+
+    bool AssetServerHandler::SetLocalCacheAddress(const AZStd::string& address)
+    {
+        if (!address.empty() && !QDir(address.c_str()).exists() && !QDir().mkpath(address.c_str()))
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Local cache address (%.*s) could not be created, the local cache is disabled",
+                AZ_STRING_ARG(address));
+            m_localCacheAddress.clear();
+            return false;
+        }
+        m_localCacheAddress = address;
+        return true;
+    }
+
+    bool AssetServerHandler::IsDistributedBuild() const
+    {
+        return m_distributedBuild;
+    }
+
+    void AssetServerHandler::SetDistributedBuild(bool distributedBuild)
+    {
+        m_distributedBuild = distributedBuild;
+    }
+
+    bool AssetServerHandler::ClaimJob(const AssetProcessor::BuilderParams& builderParams)
+    {
+        if (!m_distributedBuild || m_assetCachingMode != AssetServerMode::Server)
+        {
+            return true;
+        }
+
+        QString archiveAbsFilePath = ComputeArchiveFilePath(builderParams);
+        if (archiveAbsFilePath.isEmpty())
+        {
+            return true;
+        }
+
+        QString claimFilePath = ComputeClaimFilePath(archiveAbsFilePath);
+        if (IsJobClaimStale(claimFilePath))
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Removing stale job claim %s.\n", claimFilePath.toUtf8().data());
+            QFile::remove(claimFilePath);
+        }
+
+        // creating the file only succeeds if it does not exist yet, so only one agent can hold the claim
+        QFile claimFile(claimFilePath);
+        if (!claimFile.open(QIODevice::WriteOnly | QIODevice::NewOnly))
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Job (%s, %s, %s) is claimed by another build agent.\n",
+                builderParams.m_rcJob->GetJobEntry().m_sourceAssetReference.AbsolutePath().c_str(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
+                builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str());
+            return false;
+        }
+
+        claimFile.write(QString("%1 %2").arg(QHostInfo::localHostName()).arg(QCoreApplication::applicationPid()).toUtf8());
+        return true;
+    }
+
+    void AssetServerHandler::ReleaseJobClaim(const AssetProcessor::BuilderParams& builderParams)
+    {
+        if (!m_distributedBuild || m_assetCachingMode != AssetServerMode::Server)
+        {
+            return;
+        }
+
+        QString archiveAbsFilePath = ComputeArchiveFilePath(builderParams);
+        if (!archiveAbsFilePath.isEmpty())
+        {
+            QFile::remove(ComputeClaimFilePath(archiveAbsFilePath));
+        }
+    }
+
+    bool AssetServerHandler::WaitForClaimedJobResult(const AssetProcessor::BuilderParams& builderParams)
     {
         AssetBuilderSDK::JobCancelListener jobCancelListener(builderParams.m_rcJob->GetJobEntry().m_jobRunKey);
         AssetUtilities::QuitListener listener;
         listener.BusConnect();
 
         QString archiveAbsFilePath = ComputeArchiveFilePath(builderParams);
+        if (archiveAbsFilePath.isEmpty())
+        {
+            return false;
+        }
+
+        // the claiming agent writes the archive before it releases the claim, so a released claim without an archive means it failed
+        QString claimFilePath = ComputeClaimFilePath(archiveAbsFilePath);
+        while (!QFile::exists(archiveAbsFilePath))
+        {
+            if (!QFile::exists(claimFilePath) || IsJobClaimStale(claimFilePath))
+            {
+                AZ_TracePrintf(AssetProcessor::DebugChannel, "Claimed job has no result on the server, processing locally.\n");
+                return false;
+            }
+
+            if (listener.WasQuitRequested() || jobCancelListener.IsCancelled())
+            {
+                return false;
+            }
+
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(JobClaimPollMilliseconds));
+        }
+
+        return RetrieveJobResult(builderParams);
+    }
+
+    bool AssetServerHandler::RetrieveJobResult(const AssetProcessor::BuilderParams& builderParams)
+    {
+        AssetBuilderSDK::JobCancelListener jobCancelListener(builderParams.m_rcJob->GetJobEntry().m_jobRunKey);
+        AssetUtilities::QuitListener listener;
+        listener.BusConnect();
+
+        // the local cache is checked before the server, it holds every archive this machine already fetched or stored
+        QString localArchiveAbsFilePath = ComputeLocalArchiveFilePath(builderParams);
+        QString archiveAbsFilePath = localArchiveAbsFilePath;
+        if (archiveAbsFilePath.isEmpty() || !QFile::exists(archiveAbsFilePath))
+        {
+            archiveAbsFilePath = ComputeArchiveFilePath(builderParams);
+        }
+
         if (archiveAbsFilePath.isEmpty())
         {
             AZ_Error(AssetProcessor::DebugChannel, false, "Extracting archive operation failed. Archive Absolute Path is empty.");
@@ -269,6 +479,8 @@ namespace AssetProcessor
             return false;
         }
 
+        CopyArchiveToLocalCache(archiveAbsFilePath, localArchiveAbsFilePath);
+
         if (listener.WasQuitRequested() || jobCancelListener.IsCancelled())
         {
             AZ_TracePrintf(AssetProcessor::DebugChannel, "Extracting archive operation canceled. \n");
@@ -341,6 +553,11 @@ namespace AssetProcessor
             // If so add it to the archive
             AddSourceFilesToArchive(builderParams, archiveAbsFilePath, sourceFileList);
         }
+
+        if (success)
+        {
+            CopyArchiveToLocalCache(archiveAbsFilePath, ComputeLocalArchiveFilePath(builderParams));
+        }
         return success;
     }
 
@@ -15,6 +15,8 @@ namespace AssetProcessor
 {
     inline constexpr const char* AssetCacheServerModeKey{ "assetCacheServerMode" };
     inline constexpr const char* CacheServerAddressKey{ "cacheServerAddress" };
+    inline constexpr const char* LocalCacheAddressKey{ "localCacheAddress" };
+    inline constexpr const char* DistributedBuildKey{ "distributedBuild" };
 
     //! AssetServerHandler is implementing asset server using network share.
     class AssetServerHandler
@@ -34,6 +36,12 @@ namespace AssetProcessor
         bool StoreJobResult(const AssetProcessor::BuilderParams& builderParams, AZStd::vector<AZStd::string>& sourceFileList)  override;
         //! RetrieveJobResult will retrieve the zip file from the network share associated with the server key and unzip it to the temporary directory provided by AP.
         bool RetrieveJobResult(const AssetProcessor::BuilderParams& builderParams) override;
+        //! ClaimJob creates a claim file next to the job archive on the network share, the first agent to create it processes the job
+        bool ClaimJob(const AssetProcessor::BuilderParams& builderParams) override;
+        //! ReleaseJobClaim removes the claim file created by ClaimJob
+        void ReleaseJobClaim(const AssetProcessor::BuilderParams& builderParams) override;
+        //! WaitForClaimedJobResult polls the network share until the claiming agent stored the archive or released its claim
+        bool WaitForClaimedJobResult(const AssetProcessor::BuilderParams& builderParams) override;
         //! HandleRemoteConfiguration will attempt to set or get the remote configuration for the cache server
         void HandleRemoteConfiguration();
         //! Retrieve the current mode for shared caching
@@ -44,14 +52,27 @@ namespace AssetProcessor
         const AZStd::string& GetServerAddress() const override;
         //! Store the remote folder location for the shared cache 
         bool SetServerAddress(const AZStd::string& address) override;
+        //! Retrieve the local folder that mirrors the job archives used from the shared cache
+        const AZStd::string& GetLocalCacheAddress() const;
+        //! Store the local folder that mirrors the job archives used from the shared cache, an empty address disables it
+        bool SetLocalCacheAddress(const AZStd::string& address);
+        //! Returns true if server agents share jobs between them through claims on the network share
+        bool IsDistributedBuild() const;
+        void SetDistributedBuild(bool distributedBuild);
     protected:
         //! Source files intended to be copied into the cache don't go through out temp folder so they need
         //! to be added to the Archive in an additional step
         bool AddSourceFilesToArchive(const AssetProcessor::BuilderParams& builderParams, const QString& archivePath, AZStd::vector<AZStd::string>& sourceFileList);
         QString ComputeArchiveFilePath(const AssetProcessor::BuilderParams& builderParams);
+        //! Returns the path of the job archive in the local cache, or an empty string if there is no local cache
+        QString ComputeLocalArchiveFilePath(const AssetProcessor::BuilderParams& builderParams);
+        //! Copies a job archive into the local cache so the next request for the same job does not reach the server
+        void CopyArchiveToLocalCache(const QString& archiveAbsFilePath, const QString& localArchiveAbsFilePath);
         
     private:
         AssetServerMode m_assetCachingMode = AssetServerMode::Inactive;
         AZStd::string m_serverAddress;
+        AZStd::string m_localCacheAddress;
+        bool m_distributedBuild = false;
     };
 } //namespace AssetProcessor
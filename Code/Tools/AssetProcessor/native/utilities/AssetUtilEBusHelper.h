@@ -249,6 +249,14 @@ namespace AssetProcessor
         //! and put them in the temporary directory provided by the builderParam.
         //! This will return true if it was able to retrieve all the relevant job data from the server, otherwise return false.
         virtual bool RetrieveJobResult(const AssetProcessor::BuilderParams& builderParams) = 0;
+        //! When several build agents run as servers against the same cache, ClaimJob decides which one of them processes a job.
+        //! This will return true if this agent should process the job, false if another agent already claimed it.
+        virtual bool ClaimJob([[maybe_unused]] const AssetProcessor::BuilderParams& builderParams) { return true; }
+        //! ReleaseJobClaim should be called once a claimed job is finished, whether it succeeded or not
+        virtual void ReleaseJobClaim([[maybe_unused]] const AssetProcessor::BuilderParams& builderParams) {}
+        //! WaitForClaimedJobResult waits for the agent which claimed the job to store its result, then retrieves it like RetrieveJobResult.
+        //! This will return false if the other agent failed or did not finish in time, the job should then be processed locally.
+        virtual bool WaitForClaimedJobResult([[maybe_unused]] const AssetProcessor::BuilderParams& builderParams) { return false; }
         //! Retrieve the current mode for shared caching
         virtual AssetServerMode GetRemoteCachingMode() const = 0;
         //! Store the shared caching mode
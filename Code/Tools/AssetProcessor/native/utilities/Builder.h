@@ -121,6 +121,10 @@ namespace AssetProcessor
         //! Indicates if the builder is currently in use
         bool m_busy = false;
 
+        //! Bus id of the asset builder whose ProcessJob this builder ran last.  Its modules and any lazily initialized
+        //! SDK state are already warm, so jobs for the same asset builder prefer this process
+        AZ::Uuid m_lastAssetBuilderBusId = AZ::Uuid::CreateNull();
+
         AZStd::atomic<AZ::u32> m_connectionId = 0;
 
         //! Signals the exe has successfully established a connection
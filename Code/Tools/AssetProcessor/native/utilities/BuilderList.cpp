@@ -42,7 +42,7 @@ namespace AssetProcessor
         return itr != m_builders.end() ? itr->second : nullptr;
     }
 
-    BuilderRef BuilderList::GetFirst(BuilderPurpose purpose)
+    BuilderRef BuilderList::GetFirst(BuilderPurpose purpose, const AZ::Uuid& assetBuilderBusId)
     {
         if (purpose == BuilderPurpose::CreateJobs)
         {
@@ -72,6 +72,8 @@ namespace AssetProcessor
             return {};
         }
 
+        AZStd::shared_ptr<Builder> firstIdleBuilder;
+
         for (auto itr = m_builders.begin(); itr != m_builders.end();)
         {
             auto& builder = itr->second;
@@ -80,20 +82,38 @@ namespace AssetProcessor
             {
                 builder->PumpCommunicator();
 
-                if (builder->IsValid())
+                if (!builder->IsValid())
+                {
+                    itr = m_builders.erase(itr);
+                    continue;
+                }
+
+                if (assetBuilderBusId.IsNull())
                 {
                     return BuilderRef(builder);
                 }
 
-                itr = m_builders.erase(itr);
-            }
-            else
-            {
-                ++itr;
+                if (builder->m_lastAssetBuilderBusId == assetBuilderBusId)
+                {
+                    return BuilderRef(builder);
+                }
+
+                if (!firstIdleBuilder)
+                {
+                    firstIdleBuilder = builder;
+                }
             }
+
+            ++itr;
         }
 
-        return {};
+        // No warm builder for this asset builder, fall back to any idle one
+        if (firstIdleBuilder)
+        {
+            firstIdleBuilder->m_lastAssetBuilderBusId = assetBuilderBusId;
+        }
+
+        return BuilderRef(firstIdleBuilder);
     }
 
     AZStd::string BuilderList::RemoveByConnectionId(AZ::u32 connId)
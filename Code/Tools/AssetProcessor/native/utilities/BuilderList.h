@@ -21,7 +21,9 @@ namespace AssetProcessor
 
         void AddBuilder(AZStd::shared_ptr<Builder> builder, BuilderPurpose purpose);
         AZStd::shared_ptr<Builder> Find(AZ::Uuid uuid);
-        BuilderRef GetFirst(BuilderPurpose purpose);
+        //! Returns an idle builder for the given purpose.  When assetBuilderBusId is not null, an idle builder that last ran a job
+        //! for that asset builder is preferred over the others, and the returned builder is recorded as having run it
+        BuilderRef GetFirst(BuilderPurpose purpose, const AZ::Uuid& assetBuilderBusId = AZ::Uuid::CreateNull());
         AZStd::string RemoveByConnectionId(AZ::u32 connId);
         void RemoveByUuid(AZ::Uuid uuid);
         void PumpIdleBuilders();
@@ -154,6 +154,16 @@ namespace AssetProcessor
     }
 
     BuilderRef BuilderManager::GetBuilder(BuilderPurpose purpose)
+    {
+        return GetBuilder(purpose, AZ::Uuid::CreateNull());
+    }
+
+    BuilderRef BuilderManager::GetProcessJobBuilder(const AZ::Uuid& assetBuilderBusId)
+    {
+        return GetBuilder(BuilderPurpose::ProcessJob, assetBuilderBusId);
+    }
+
+    BuilderRef BuilderManager::GetBuilder(BuilderPurpose purpose, const AZ::Uuid& assetBuilderBusId)
     {
         AZStd::shared_ptr<Builder> newBuilder;
         BuilderRef builderRef;
@@ -169,7 +179,7 @@ namespace AssetProcessor
 
             if (purpose != BuilderPurpose::Registration)
             {
-                auto builder = m_builderList.GetFirst(purpose);
+                auto builder = m_builderList.GetFirst(purpose, assetBuilderBusId);
 
                 if (builder)
                 {
@@ -181,6 +191,7 @@ namespace AssetProcessor
 
             // None found, start up a new one
             newBuilder = AddNewBuilder(purpose);
+            newBuilder->m_lastAssetBuilderBusId = assetBuilderBusId;
 
             // Grab a reference so no one else can take it while we're outside the lock
             builderRef = BuilderRef(newBuilder);
@@ -38,6 +38,13 @@ namespace AssetProcessor
         //! Returns a builder for doing work
         virtual BuilderRef GetBuilder(BuilderPurpose purpose) = 0;
 
+        //! Returns a builder for running a ProcessJob of the given asset builder, preferring a builder process that already ran
+        //! jobs for it so module loading and lazy SDK initialization are not paid again
+        virtual BuilderRef GetProcessJobBuilder(const AZ::Uuid& /*assetBuilderBusId*/)
+        {
+            return GetBuilder(BuilderPurpose::ProcessJob);
+        }
+
         virtual void AddAssetToBuilderProcessedList(const AZ::Uuid& /*builderId*/, const AZStd::string& /*sourceAsset*/)
         {
         }
@@ -66,6 +73,7 @@ namespace AssetProcessor
 
         //BuilderManagerBus
         BuilderRef GetBuilder(BuilderPurpose purpose) override;
+        BuilderRef GetProcessJobBuilder(const AZ::Uuid& assetBuilderBusId) override;
         void AddAssetToBuilderProcessedList(const AZ::Uuid& builderId, const AZStd::string& sourceAsset) override;
 
     protected:
@@ -76,6 +84,8 @@ namespace AssetProcessor
         //! Handles incoming builder connections
         void IncomingBuilderPing(AZ::u32 connId, AZ::u32 type, AZ::u32 serial, QByteArray payload, QString platform);
 
+        BuilderRef GetBuilder(BuilderPurpose purpose, const AZ::Uuid& assetBuilderBusId);
+
         void PumpIdleBuilders();
 
         void PrintDebugOutput();
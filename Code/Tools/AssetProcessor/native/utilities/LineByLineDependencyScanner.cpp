@@ -71,6 +71,7 @@ namespace AssetProcessor
         const AZStd::regex& subIdRegex,
         const AZStd::regex& uuidRegex,
         const AZStd::regex& pathRegex,
+        const AZStd::regex& pathBlockRegex,
         PotentialDependencies& potentialDependencies)
     {
         SearchResult assetIdSearchResult = GlobalSearch(scanString, maxScanIteration, subIdRegex, [this, &potentialDependencies](const AZStd::smatch& assetIdMatchResult)
@@ -112,7 +113,7 @@ namespace AssetProcessor
         // We'll first break up the input string into blocks that *could* contain a path.  This is a faster and simpler regex test
         // For each block, we'll do a quick string check to see if it contains a path separator or a file extension (.)
         // Only if we find one will we do the more expensive path regex check
-        SearchResult pathSearchResult = GlobalSearch(scanString, maxScanIteration, AZStd::regex(R"~(([^:*?<>|" ]+))~"), [this, &maxScanIteration, &potentialDependencies, &pathRegex](const AZStd::smatch& matchResult)
+        SearchResult pathSearchResult = GlobalSearch(scanString, maxScanIteration, pathBlockRegex, [this, &maxScanIteration, &potentialDependencies, &pathRegex](const AZStd::smatch& matchResult)
         {
             AZStd::string stringSection = matchResult[1].str();
             if(stringSection.find('\\') != AZStd::string::npos || stringSection.find('/') != AZStd::string::npos || stringSection.find('.') != AZStd::string::npos)
@@ -192,6 +193,8 @@ namespace AssetProcessor
         // Don't use a greedy search, a given line may have multiple start/end quotes, find the smallest
         // thing that looks like a path. This search won't find things that look like paths without file extensions.
         AZStd::regex pathRegex(R"(([\w\\/-]*?\.[\w\d\.-]*))");
+        // Blocks of the line that could contain a path, compiled once per file rather than for every line.
+        AZStd::regex pathBlockRegex(R"~(([^:*?<>|" ]+))~");
         int currentLineIndex = 1; // Most file editing software starts at line 1, not 0.
         for (const AZStd::string& line : fileLines)
         {
@@ -201,6 +204,7 @@ namespace AssetProcessor
                 subIdRegex,
                 uuidRegex,
                 pathRegex,
+                pathBlockRegex,
                 potentialDependencies);
 
             switch (searchResult)
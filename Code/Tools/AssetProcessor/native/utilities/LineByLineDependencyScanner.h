@@ -39,6 +39,7 @@ namespace AssetProcessor
             const AZStd::regex& subIdRegex,
             const AZStd::regex& uuidRegex,
             const AZStd::regex& pathRegex,
+            const AZStd::regex& pathBlockRegex,
             PotentialDependencies& potentialDependencies);
     };
 }
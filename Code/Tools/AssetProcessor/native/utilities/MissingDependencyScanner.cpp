@@ -18,7 +18,10 @@ AZ_POP_DISABLE_WARNING
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/string/wildcard.h>
 #include <AzCore/Utils/Utils.h>
@@ -350,9 +353,6 @@ namespace AssetProcessor
         AzToolsFramework::AssetDatabase::SourceDatabaseEntry fileWithPotentialMissingDependencies;
         databaseConnection->GetSourceByProductID(productPK, fileWithPotentialMissingDependencies);
 
-        AZStd::map<AZ::Uuid, PotentialDependencyMetaData> uuids(potentialDependencies.m_uuids);
-        AZStd::map<AZ::Data::AssetId, PotentialDependencyMetaData> assetIds(potentialDependencies.m_assetIds);
-
         // Check if any products exist for the given job, and those products have a sub ID that matches
         // the expected sub ID.
         AzToolsFramework::AssetDatabase::ProductDatabaseEntry productWithPotentialMissingDependencies;
@@ -361,140 +361,124 @@ namespace AssetProcessor
         auto lastSeparatorIndex = scannedProductPath.lastIndexOf(AZ_CORRECT_DATABASE_SEPARATOR_STRING);
         scannedProductPath = scannedProductPath.remove(lastSeparatorIndex + 1, scannedProductPath.length());
 
-        // Check the existing product dependency list for the file that is being scanned, remove
-        // any potential UUIDs that match dependencies already being emitted.
+        // Index the existing product dependency list for the file that is being scanned once, rather than walking it
+        // for every potential dependency.
+        AZStd::unordered_set<AZ::Uuid> existingDependencySources;
+        AZStd::unordered_set<AZ::Data::AssetId> existingDependencyAssetIds;
         for (const AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry&
             existingDependency : dependencies)
         {
-            AZStd::map<AZ::Uuid, PotentialDependencyMetaData>::iterator matchingDependency =
-                uuids.find(existingDependency.m_dependencySourceGuid);
-            if (matchingDependency != uuids.end())
-            {
-                uuids.erase(matchingDependency);
-            }
+            existingDependencySources.insert(existingDependency.m_dependencySourceGuid);
+            existingDependencyAssetIds.insert(AZ::Data::AssetId(existingDependency.m_dependencySourceGuid, existingDependency.m_dependencySubID));
         }
 
-        // Remove all UUIDs that don't match an asset in the database.
-        for (AZStd::map<AZ::Uuid, PotentialDependencyMetaData>::iterator uuidIter = uuids.begin();
-            uuidIter != uuids.end();
-            ++uuidIter)
+        // A file usually references the same sources through several UUIDs, asset IDs and paths, so the products of each
+        // source are only looked up in the asset database once. Null means the source isn't in the database or has no jobs.
+        AZStd::unordered_map<AZ::Uuid, AZStd::unique_ptr<AzToolsFramework::AssetDatabase::ProductDatabaseEntryContainer>> productsBySource;
+        auto getProductsOfSource = [&databaseConnection, &productsBySource](const AZ::Uuid& sourceGuid)
+            -> const AzToolsFramework::AssetDatabase::ProductDatabaseEntryContainer*
         {
-            if (fileWithPotentialMissingDependencies.m_sourceGuid == uuidIter->first)
+            auto [productsIter, inserted] = productsBySource.try_emplace(sourceGuid);
+            if (!inserted)
             {
-                // This product references itself, or the source it comes from. Don't report it as a missing dependency.
-                continue;
+                return productsIter->second.get();
             }
 
             AzToolsFramework::AssetDatabase::SourceDatabaseEntry sourceEntry;
-            if (!databaseConnection->GetSourceBySourceGuid(uuidIter->first, sourceEntry))
+            if (!databaseConnection->GetSourceBySourceGuid(sourceGuid, sourceEntry))
             {
-                // The UUID isn't in the asset database, don't add it to the list of missing dependencies.
-                continue;
+                return nullptr;
             }
 
             AzToolsFramework::AssetDatabase::JobDatabaseEntryContainer jobs;
             if (!databaseConnection->GetJobsBySourceID(sourceEntry.m_sourceID, jobs))
             {
-                // No jobs existed for that source asset, so there are no products for this asset.
-                // With no products, there is no way there can be a missing product dependency.
-                continue;
+                return nullptr;
             }
 
-            // The dependency only referenced the source UUID, so add all products as missing dependencies.
+            auto sourceProducts = AZStd::make_unique<AzToolsFramework::AssetDatabase::ProductDatabaseEntryContainer>();
             for (const AzToolsFramework::AssetDatabase::JobDatabaseEntry& job : jobs)
             {
                 AzToolsFramework::AssetDatabase::ProductDatabaseEntryContainer products;
-                if (!databaseConnection->GetProductsByJobID(job.m_jobID, products))
+                if (databaseConnection->GetProductsByJobID(job.m_jobID, products))
                 {
-                    continue;
-                }
-                for (const AzToolsFramework::AssetDatabase::ProductDatabaseEntry& product : products)
-                {
-                    // This match was for a UUID with no product ID, so add all products as missing dependencies.
-                    MissingDependency missingDependency(
-                        AZ::Data::AssetId(uuidIter->first, product.m_subID),
-                        uuidIter->second);
-                    missingDependencies.insert(missingDependency);
+                    sourceProducts->insert(sourceProducts->end(), products.begin(), products.end());
                 }
             }
-        }
+            productsIter->second = AZStd::move(sourceProducts);
+            return productsIter->second.get();
+        };
 
-        // Validate the asset ID list, removing anything that is already a dependency, or does not exist in the asset database.
-        for (AZStd::map<AZ::Data::AssetId, PotentialDependencyMetaData>::iterator assetIdIter = assetIds.begin();
-            assetIdIter != assetIds.end();
-            ++assetIdIter)
+        // Remove all UUIDs that are already dependencies or don't match an asset in the database.
+        for (const auto& [uuid, metaData] : potentialDependencies.m_uuids)
         {
-            bool foundUUID = false;
-            // Strip out all existing, matching dependencies
-            for (const AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry&
-                existingDependency : dependencies)
+            if (existingDependencySources.contains(uuid))
             {
-                if (existingDependency.m_dependencySourceGuid == assetIdIter->first.m_guid &&
-                    existingDependency.m_dependencySubID == assetIdIter->first.m_subId)
-                {
-                    foundUUID = true;
-                    break;
-                }
+                continue;
             }
 
-            // There is already a dependency with this UUID, so it's not a missing dependency.
-            if (foundUUID)
+            if (fileWithPotentialMissingDependencies.m_sourceGuid == uuid)
             {
+                // This product references itself, or the source it comes from. Don't report it as a missing dependency.
                 continue;
             }
 
-            AzToolsFramework::AssetDatabase::SourceDatabaseEntry sourceEntry;
-            if (!databaseConnection->GetSourceBySourceGuid(assetIdIter->first.m_guid, sourceEntry))
+            // If the UUID isn't in the asset database or no jobs existed for that source asset, there are no products for this asset.
+            // With no products, there is no way there can be a missing product dependency.
+            const AzToolsFramework::AssetDatabase::ProductDatabaseEntryContainer* products = getProductsOfSource(uuid);
+            if (!products)
             {
-                // The UUID isn't in the asset database. Don't report it as a missing dependency
-                // because UUIDs are used for tracking many things that are not assets.
                 continue;
             }
 
-            AzToolsFramework::AssetDatabase::JobDatabaseEntryContainer jobs;
-            if (!databaseConnection->GetJobsBySourceID(sourceEntry.m_sourceID, jobs))
+            for (const AzToolsFramework::AssetDatabase::ProductDatabaseEntry& product : *products)
+            {
+                // This match was for a UUID with no product ID, so add all products as missing dependencies.
+                MissingDependency missingDependency(
+                    AZ::Data::AssetId(uuid, product.m_subID),
+                    metaData);
+                missingDependencies.insert(missingDependency);
+            }
+        }
+
+        // Validate the asset ID list, removing anything that is already a dependency, or does not exist in the asset database.
+        for (const auto& [assetId, metaData] : potentialDependencies.m_assetIds)
+        {
+            // There is already a dependency with this UUID, so it's not a missing dependency.
+            if (existingDependencyAssetIds.contains(assetId))
             {
-                // No jobs existed for that source asset, so there are no products for this asset.
-                // With no products, there is no way there can be a missing product dependency.
                 continue;
             }
 
+            // The UUID isn't in the asset database, or has no products. Don't report it as a missing dependency
+            // because UUIDs are used for tracking many things that are not assets.
+            const AzToolsFramework::AssetDatabase::ProductDatabaseEntryContainer* products = getProductsOfSource(assetId.m_guid);
+            if (!products)
+            {
+                continue;
+            }
 
-            bool isProductOfFileWithPotentialMissingDependencies = fileWithPotentialMissingDependencies.m_sourceGuid == assetIdIter->first.m_guid;
+            bool isProductOfFileWithPotentialMissingDependencies = fileWithPotentialMissingDependencies.m_sourceGuid == assetId.m_guid;
 
-            bool foundMatchingProduct = false;
-            for (const AzToolsFramework::AssetDatabase::JobDatabaseEntry& job : jobs)
+            for (const AzToolsFramework::AssetDatabase::ProductDatabaseEntry& product : *products)
             {
-                AzToolsFramework::AssetDatabase::ProductDatabaseEntryContainer products;
-                if (!databaseConnection->GetProductsByJobID(job.m_jobID, products))
+                if (product.m_subID == assetId.m_subId)
                 {
-                    continue;
-                }
-                for (const AzToolsFramework::AssetDatabase::ProductDatabaseEntry& product : products)
-                {
-                    if (product.m_subID == assetIdIter->first.m_subId)
+                    // This product references itself. Don't report it as a missing dependency.
+                    // If the product references a different product of the same source and that isn't
+                    // a dependency, then do report that.
+                    // We have to check against more than the productPK to catch identical products across multiple
+                    // platforms. 
+                    if (productPK == product.m_productID ||
+                        (isProductOfFileWithPotentialMissingDependencies && productWithPotentialMissingDependencies.m_subID == product.m_subID))
                     {
-                        // This product references itself. Don't report it as a missing dependency.
-                        // If the product references a different product of the same source and that isn't
-                        // a dependency, then do report that.
-                        // We have to check against more than the productPK to catch identical products across multiple
-                        // platforms. 
-                        if (productPK == product.m_productID ||
-                            (isProductOfFileWithPotentialMissingDependencies && productWithPotentialMissingDependencies.m_subID == product.m_subID))
-                        {
-                            continue;
-                        }
-
-                        MissingDependency missingDependency(
-                            assetIdIter->first,
-                            assetIdIter->second);
-                        missingDependencies.insert(missingDependency);
-                        foundMatchingProduct = true;
-                        break;
+                        continue;
                     }
-                }
-                if (foundMatchingProduct)
-                {
+
+                    MissingDependency missingDependency(
+                        assetId,
+                        metaData);
+                    missingDependencies.insert(missingDependency);
                     break;
                 }
             }
@@ -519,45 +503,24 @@ namespace AssetProcessor
                         continue;
                     }
 
-                    bool dependencyExistsForSource = false;
-                    for (const AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry&
-                        existingDependency : dependencies)
-                    {
-                        if (existingDependency.m_dependencySourceGuid == source.m_sourceGuid)
-                        {
-                            dependencyExistsForSource = true;
-                            break;
-                        }
-                    }
-
-                    if (dependencyExistsForSource)
+                    if (existingDependencySources.contains(source.m_sourceGuid))
                     {
                         continue;
                     }
 
-                    AzToolsFramework::AssetDatabase::JobDatabaseEntryContainer jobs;
-                    if (!databaseConnection->GetJobsBySourceID(source.m_sourceID, jobs))
+                    // No jobs or products exist for this source, which means there is no matching product dependency.
+                    const AzToolsFramework::AssetDatabase::ProductDatabaseEntryContainer* products = getProductsOfSource(source.m_sourceGuid);
+                    if (!products)
                     {
-                        // No jobs exist for this source, which means there is no matching product dependency.
                         continue;
                     }
 
-                    for (const AzToolsFramework::AssetDatabase::JobDatabaseEntry& job : jobs)
+                    for (const AzToolsFramework::AssetDatabase::ProductDatabaseEntry& product : *products)
                     {
-                        AzToolsFramework::AssetDatabase::ProductDatabaseEntryContainer products;
-                        if (!databaseConnection->GetProductsByJobID(job.m_jobID, products))
-                        {
-                            // No products, no product dependencies.
-                            continue;
-                        }
-
-                        for (const AzToolsFramework::AssetDatabase::ProductDatabaseEntry& product : products)
-                        {
-                            MissingDependency missingDependency(
-                                AZ::Data::AssetId(source.m_sourceGuid, product.m_subID),
-                                path);
-                            missingDependencies.insert(missingDependency);
-                        }
+                        MissingDependency missingDependency(
+                            AZ::Data::AssetId(source.m_sourceGuid, product.m_subID),
+                            path);
+                        missingDependencies.insert(missingDependency);
                     }
                 }
             }
@@ -625,18 +588,7 @@ namespace AssetProcessor
 
                     for (const AzToolsFramework::AssetDatabase::SourceDatabaseEntry& source : productSources)
                     {
-                        bool dependencyExistsForProduct = false;
-                        for (const AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry&
-                            existingDependency : dependencies)
-                        {
-                            if (existingDependency.m_dependencySourceGuid == source.m_sourceGuid &&
-                                existingDependency.m_dependencySubID == product.m_subID)
-                            {
-                                dependencyExistsForProduct = true;
-                                break;
-                            }
-                        }
-                        if (!dependencyExistsForProduct)
+                        if (!existingDependencyAssetIds.contains(AZ::Data::AssetId(source.m_sourceGuid, product.m_subID)))
                         {
                             AZ::Data::AssetId assetId(source.m_sourceGuid, product.m_subID);
                             MissingDependency missingDependency(
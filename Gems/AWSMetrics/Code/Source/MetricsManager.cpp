@@ -153,7 +153,7 @@ namespace AWSMetrics
                 MetricsQueue metricsEventsToProcess;
                 metricsQueue->PopBufferedEventsByServiceLimits(metricsEventsToProcess, AwsMetricsMaxRestApiPayloadSizeInMb * MbToBytes, AwsMetricsMaxKinesisBatchedRecordCount);
 
-                SendMetricsToServiceApiAsync(metricsEventsToProcess);
+                SendMetricsToServiceApiAsync(AZStd::move(metricsEventsToProcess));
             }
         }
     }
@@ -205,7 +205,7 @@ namespace AWSMetrics
         job->Start();
     }
 
-    void MetricsManager::SendMetricsToServiceApiAsync(const MetricsQueue& metricsQueue)
+    void MetricsManager::SendMetricsToServiceApiAsync(MetricsQueue&& metricsQueue)
     {
         int requestId = ++m_sendMetricsId;
 
@@ -345,16 +345,19 @@ namespace AWSMetrics
 
     void MetricsManager::FlushMetricsAsync()
     {
-        AZStd::lock_guard<AZStd::mutex> lock(m_metricsMutex);
-        if (m_metricsQueue.GetNumMetrics() == 0)
+        auto metricsToFlush = AZStd::make_shared<MetricsQueue>();
         {
-            return;
-        }
+            AZStd::lock_guard<AZStd::mutex> lock(m_metricsMutex);
+            if (m_metricsQueue.GetNumMetrics() == 0)
+            {
+                return;
+            }
 
-        auto metricsToFlush = AZStd::make_shared<MetricsQueue>();
-        metricsToFlush->AppendMetrics(m_metricsQueue);
-        m_metricsQueue.ClearMetrics();
+            metricsToFlush->AppendMetrics(m_metricsQueue);
+            m_metricsQueue.ClearMetrics();
+        }
 
+        // Split the metrics into requests and start the jobs without holding the lock, so threads submitting metrics don't wait on it
         SendMetricsAsync(metricsToFlush);
     }
 
@@ -114,8 +114,8 @@ namespace AWSMetrics
         void SendMetricsToLocalFileAsync(AZStd::shared_ptr<MetricsQueue> metricsQueue);
 
         //! Send the batched metrics events to the Service API asynchronously.
-        //! @param metricsQueue Metrics events to send.
-        void SendMetricsToServiceApiAsync(const MetricsQueue& metricsQueue);
+        //! @param metricsQueue Metrics events to send, moved into the request.
+        void SendMetricsToServiceApiAsync(MetricsQueue&& metricsQueue);
 
         //! Push metrics events to the front of the queue for retry.
         //! @param metricsEventsForRetry Metrics events for retry.
@@ -123,7 +123,12 @@ namespace AWSMetrics
 
         void SubmitLocalMetricsAsync();
 
-        AZStd::mutex m_metricsMutex; //!< Mutex to protect the metrics queue
+        //! Mutex to protect the metrics queue.
+        //! Submitting metrics only holds it to append an event that is already built and validated, and flushing only holds it
+        //! to move the buffered events out. There is no separate lock-free enqueue path: the size based flush needs the total
+        //! size of the queue when each event is added, and a fixed-size lock-free buffer would still need this locked path when
+        //! it is full.
+        AZStd::mutex m_metricsMutex;
         MetricsQueue m_metricsQueue; //!< Queue fo buffering the metrics events
 
         AZStd::mutex m_metricsFileMutex; //!< Mutex to protect the local metrics file
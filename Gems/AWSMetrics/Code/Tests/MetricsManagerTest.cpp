@@ -14,6 +14,7 @@
 #include <MetricsManager.h>
 
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
@@ -334,6 +335,61 @@ namespace AWSMetrics
         m_metricsManager->ShutdownMetrics();
     }
 
+    TEST_F(MetricsManagerTest, SubmitMetricsFromMultipleThreads_WhileFlushing_SendEachMetricsEventOnce)
+    {
+        constexpr int NumProducers = 4;
+        constexpr int NumMetricsEvents = NumProducers * MaxNumMetricsEvents;
+
+        // Only the explicit flushes send the buffered metrics.
+        ResetClientConfig(true, (double)TestMetricsEventSizeInBytes * (NumMetricsEvents + 1) / MbToBytes,
+            (TimeoutForProcessingInMs + 1), 0);
+
+        AZStd::atomic_bool producersDone{ false };
+        AZStd::thread flusher([&producersDone]()
+        {
+            while (!producersDone)
+            {
+                AWSMetricsRequestBus::Broadcast(&AWSMetricsRequests::FlushMetrics);
+                AZStd::this_thread::yield();
+            }
+        });
+
+        AZStd::vector<AZStd::thread> producers;
+        for (int producerIndex = 0; producerIndex < NumProducers; ++producerIndex)
+        {
+            producers.emplace_back(AZStd::thread([]()
+            {
+                for (int index = 0; index < MaxNumMetricsEvents; ++index)
+                {
+                    AZStd::vector<MetricsAttribute> metricsAttributes;
+                    metricsAttributes.emplace_back(AZStd::move(MetricsAttribute(AwsMetricsAttributeKeyEventName, AttrValue)));
+
+                    bool result = false;
+                    AWSMetricsRequestBus::BroadcastResult(result, &AWSMetricsRequests::SubmitMetrics, metricsAttributes, 0, "", true);
+                    ASSERT_TRUE(result);
+                }
+            }));
+        }
+
+        for (AZStd::thread& producer : producers)
+        {
+            producer.join();
+        }
+        producersDone = true;
+        flusher.join();
+
+        // Flush the metrics submitted after the last flush of the flusher thread
+        AWSMetricsRequestBus::Broadcast(&AWSMetricsRequests::FlushMetrics);
+
+        WaitForProcessing(NumMetricsEvents);
+        const GlobalStatistics& stats = m_metricsManager->GetGlobalStatistics();
+        EXPECT_EQ(stats.m_numEvents, NumMetricsEvents);
+        EXPECT_EQ(stats.m_numSuccesses, NumMetricsEvents);
+        EXPECT_EQ(stats.m_numDropped, 0);
+        EXPECT_EQ(stats.m_sendSizeInBytes, TestMetricsEventSizeInBytes * NumMetricsEvents);
+        EXPECT_EQ(m_metricsManager->GetNumBufferedMetrics(), 0);
+    }
+
     TEST_F(MetricsManagerTest, SubmitMetrics_NoMetircsAttributes_Fail)
     {
         bool result = false;
@@ -11,6 +11,7 @@
 #include <AzCore/base.h>
 
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/functional.h>
 
 #include <Archive/Clients/ArchiveBaseAPI.h>
@@ -119,6 +120,13 @@ namespace Archive
         const Compression::CompressionOptions* m_compressionOptions{};
     };
 
+    //! Pairs a view of the content of a file with the settings used to add it to an archive
+    //! It is used to add a batch of files to an archive in a single call
+    struct ArchiveWriterFileEntry
+    {
+        AZStd::span<const AZStd::byte> m_inputSpan;
+        ArchiveWriterFileSettings m_fileSettings;
+    };
 
     //! Returns result data around operation of adding a stream of content data
     //! to an archive file
@@ -262,6 +270,20 @@ namespace Archive
         virtual ArchiveAddFileResult AddFileToArchive(AZStd::span<const AZStd::byte> inputSpan,
             const ArchiveWriterFileSettings& fileSettings) = 0;
 
+        //! Adds the content of multiple files to the archive
+        //! The blocks of all the files are compressed in parallel on the task executor using up to
+        //! `ArchiveWriterSettings::m_maxCompressTasks` tasks at a time, so small files which fit within
+        //! a single block are compressed in parallel with each other
+        //! The files are written to the archive in the order they are supplied once compression completes,
+        //! therefore the archive layout is deterministic and matches calling AddFileToArchive for each entry in order
+        //! NOTE: The compressed data of every file in the batch is kept in memory until it is written,
+        //! so the number of files per call should be chosen with the total size of the batch in mind
+        //! @param fileEntries spans of file content data along with the settings to use to add each file
+        //! @return a vector containing the ArchiveAddFileResult for each file entry, in the same order as @fileEntries
+        //! A failure to add one file is stored in its result and doesn't prevent the other files from being added
+        using ArchiveAddFilesResult = AZStd::vector<ArchiveAddFileResult>;
+        virtual ArchiveAddFilesResult AddFilesToArchive(AZStd::span<const ArchiveWriterFileEntry> fileEntries) = 0;
+
         //! Searches for a relative path within the archive
         //! @param relativePath Relative path within archive to search for
         //! @return A token that identifies the Archive file if it exist
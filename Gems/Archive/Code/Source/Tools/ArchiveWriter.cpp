@@ -819,13 +819,75 @@ namespace Archive
     ArchiveAddFileResult ArchiveWriter::AddFileToArchive(AZStd::span<const AZStd::byte> inputSpan,
         const ArchiveWriterFileSettings& fileSettings)
     {
+        const ArchiveWriterFileEntry fileEntry{ inputSpan, fileSettings };
+        ArchiveAddFilesResult addFilesResult = AddFilesToArchive(AZStd::span<const ArchiveWriterFileEntry>(&fileEntry, 1));
+        return AZStd::move(addFilesResult.front());
+    }
+
+    auto ArchiveWriter::AddFilesToArchive(AZStd::span<const ArchiveWriterFileEntry> fileEntries) -> ArchiveAddFilesResult
+    {
+        // The results are sized up front, as the batch file path set references the paths stored in them
+        ArchiveAddFilesResult results(fileEntries.size());
+        AZStd::vector<PendingContentFile> pendingFiles(fileEntries.size());
+
+        // Validate each file and register its compression algorithm with the archive header
+        // This is done serially as it updates the archive header
+        AZStd::unordered_set<AZ::IO::PathView> batchFilePaths;
+        for (size_t fileIndex = 0; fileIndex < fileEntries.size(); ++fileIndex)
+        {
+            PendingContentFile& pendingFile = pendingFiles[fileIndex];
+            pendingFile.m_fileSettings = &fileEntries[fileIndex].m_fileSettings;
+            pendingFile.m_inputSpan = fileEntries[fileIndex].m_inputSpan;
+            pendingFile.m_shouldWrite = PrepareContentFile(results[fileIndex], pendingFile, batchFilePaths);
+        }
+
+        // Compress the blocks of every file in the batch in parallel
+        CompressContentFilesAsync(pendingFiles);
+
+        // Write the files to the archive stream in the order they were supplied
+        // so that the archive layout doesn't depend on the order compression tasks complete in
+        for (size_t fileIndex = 0; fileIndex < fileEntries.size(); ++fileIndex)
+        {
+            PendingContentFile& pendingFile = pendingFiles[fileIndex];
+            if (!pendingFile.m_shouldWrite)
+            {
+                continue;
+            }
+
+            ArchiveAddFileResult& result = results[fileIndex];
+            // Populate the compression algorithm used in the result structure
+            const AZ::u8 compressionAlgorithmIndex = pendingFile.m_contentFileBlocks.m_compressionAlgorithmIndex;
+            result.m_compressionAlgorithm = compressionAlgorithmIndex < m_archiveHeader.m_compressionAlgorithmsIds.size()
+                ? m_archiveHeader.m_compressionAlgorithmsIds[compressionAlgorithmIndex]
+                : Compression::Uncompressed;
+
+            // Update the archive stream
+            ContentFileData contentFileData;
+            contentFileData.m_relativeFilePath = result.m_relativeFilePath;
+            contentFileData.m_uncompressedSpan = pendingFile.m_inputSpan;
+            contentFileData.m_contentFileBlocks = AZStd::move(pendingFile.m_contentFileBlocks);
+
+            // Write the file content to the archive stream and store the archive file path token
+            // which is used to lookup the file for removal
+            result.m_filePathToken = WriteContentFileToArchive(*pendingFile.m_fileSettings, contentFileData);
+
+            // The compressed data has been written, so release it before moving on to the next file
+            pendingFile.m_compressionBuffer = {};
+        }
+
+        return results;
+    }
+
+    bool ArchiveWriter::PrepareContentFile(ArchiveAddFileResult& result, PendingContentFile& pendingFile,
+        AZStd::unordered_set<AZ::IO::PathView>& batchFilePaths)
+    {
+        const ArchiveWriterFileSettings& fileSettings = *pendingFile.m_fileSettings;
+        result.m_compressionAlgorithm = fileSettings.m_compressionAlgorithm;
         if (fileSettings.m_relativeFilePath.empty())
         {
-            ArchiveAddFileResult errorResult;
-            errorResult.m_compressionAlgorithm = fileSettings.m_compressionAlgorithm;
-            errorResult.m_resultOutcome = AZStd::unexpected(
+            result.m_resultOutcome = AZStd::unexpected(
                 ResultString(R"(The file path is empty. File will not be added to the archive.)"));
-            return errorResult;
+            return false;
         }
 
         // Update the file case based on the ArchiveFilePathCase enum
@@ -839,65 +901,27 @@ namespace Archive
             AZStd::to_upper(filePath.Native());
             break;
         }
+        // Supply the file path with the case changed
+        result.m_relativeFilePath = AZStd::move(filePath);
 
-        // Check if a file being added is already in the archive
+        // Check if a file being added is already in the archive or earlier in the same batch
         // If the ArchiveWriterFileMode is set to only add new files
         // return an ArchiveAddFileResult with an invalid file token
         if (fileSettings.m_fileMode == ArchiveWriterFileMode::AddNew
-            && ContainsFile(filePath))
+            && (ContainsFile(result.m_relativeFilePath) || batchFilePaths.contains(result.m_relativeFilePath)))
         {
-            ArchiveAddFileResult errorResult;
-            errorResult.m_relativeFilePath = AZStd::move(filePath);
-            errorResult.m_compressionAlgorithm = fileSettings.m_compressionAlgorithm;
-            errorResult.m_resultOutcome = AZStd::unexpected(
+            result.m_resultOutcome = AZStd::unexpected(
                 ResultString::format(R"(The file with relative path "%s" already exist in the archive.)"
                     " The FileMode::AddNew option was specified.",
-                    errorResult.m_relativeFilePath.c_str()));
-            return errorResult;
-        }
-
-        ArchiveAddFileResult result;
-        // Supply the file path with the case changed
-        result.m_relativeFilePath = AZStd::move(filePath);
-
-        // Storage buffer used to store the file data if it s compressed
-        // It's lifetime must outlive the CompressContentOutcome
-        AZStd::vector<AZStd::byte> compressionBuffer;
-
-        CompressContentOutcome compressOutcome = CompressContentFileAsync(compressionBuffer, fileSettings, inputSpan);
-        if (!compressOutcome)
-        {
-            result.m_compressionAlgorithm = fileSettings.m_compressionAlgorithm;
-            result.m_resultOutcome = AZStd::unexpected(AZStd::move(compressOutcome.error()));
-            return result;
-        }
-
-        // Populate the compression algorithm used in the result structure
-        if (compressOutcome->m_compressionAlgorithmIndex < m_archiveHeader.m_compressionAlgorithmsIds.size())
-        {
-            result.m_compressionAlgorithm = m_archiveHeader.m_compressionAlgorithmsIds[compressOutcome->m_compressionAlgorithmIndex];
+                    result.m_relativeFilePath.c_str()));
+            return false;
         }
-        // Update the archive stream
-        ContentFileData contentFileData;
-        contentFileData.m_relativeFilePath = result.m_relativeFilePath;
-        contentFileData.m_uncompressedSpan = inputSpan;
-        contentFileData.m_contentFileBlocks = AZStd::move(*compressOutcome);
-
-        // Write the file content to the archive stream and store the archive file path token
-        // which is used to lookup the file for removal
-        result.m_filePathToken = WriteContentFileToArchive(fileSettings, contentFileData);
-        return result;
-    }
-
 
-    auto ArchiveWriter::CompressContentFileAsync(AZStd::vector<AZStd::byte>& compressionDataBuffer,
-        const ArchiveWriterFileSettings& fileSettings,
-        AZStd::span<const AZStd::byte> inputDataSpan) -> CompressContentOutcome
-    {
         // If the file is empty, there is nothing to compress
-        if (inputDataSpan.empty())
+        if (pendingFile.m_inputSpan.empty())
         {
-            return ContentFileBlocks{};
+            batchFilePaths.emplace(result.m_relativeFilePath);
+            return true;
         }
 
         // Try to register the compression algorithm id with the Archive Header compression algorithm id array
@@ -912,62 +936,89 @@ namespace Archive
         // then an invalid file token is returned
         if (compressionAlgorithmIndex == InvalidAlgorithmIndex)
         {
-            AZStd::unexpected<ResultString> errorString = AZStd::unexpected(
+            result.m_resultOutcome = AZStd::unexpected(
                 ResultString::format(R"(Unable to locate compression algorithm registered with id %u in the archive.)",
                     static_cast<AZ::u32>(fileSettings.m_compressionAlgorithm)));
-            return errorString;
+            return false;
         }
 
-        ContentFileBlocks contentFileBlocks;
-        contentFileBlocks.m_writeSpan = inputDataSpan;
+        batchFilePaths.emplace(result.m_relativeFilePath);
 
-        if (compressionAlgorithmIndex >= UncompressedAlgorithmIndex)
+        if (compressionAlgorithmIndex < UncompressedAlgorithmIndex)
         {
-            contentFileBlocks.m_blockOffsetSizePairs = AZStd::vector<BlockOffsetSizePair>{ { 0, inputDataSpan.size() } };
-            return contentFileBlocks;
+            if (auto compressionRegistrar = Compression::CompressionRegistrar::Get(); compressionRegistrar != nullptr)
+            {
+                pendingFile.m_compressionInterface = compressionRegistrar->FindCompressionInterface(fileSettings.m_compressionAlgorithm);
+                pendingFile.m_compressionAlgorithmIndex = static_cast<AZ::u8>(compressionAlgorithmIndex);
+            }
         }
 
-        auto compressionRegistrar = Compression::CompressionRegistrar::Get();
-        if (compressionRegistrar == nullptr)
+        return true;
+    }
+
+    void ArchiveWriter::CompressContentFilesAsync(AZStd::span<PendingContentFile> pendingFiles)
+    {
+        // Stores the location of a 2 MiB block within the input data of a pending file
+        struct PendingBlock
         {
-            contentFileBlocks.m_blockOffsetSizePairs = AZStd::vector<BlockOffsetSizePair>{ { 0, inputDataSpan.size() } };
-            return contentFileBlocks;
-        }
-        Compression::ICompressionInterface* compressionInterface =
-            compressionRegistrar->FindCompressionInterface(fileSettings.m_compressionAlgorithm);
-        if (compressionInterface == nullptr)
+            PendingContentFile* m_pendingFile{};
+            size_t m_blockStartOffset{};
+        };
+
+        // Gather the blocks of every file to compress in file order and then block order
+        // As the compression results are processed in this order, the blocks of each file
+        // are appended to its compression buffer in sequence
+        AZStd::vector<PendingBlock> pendingBlocks;
+        for (PendingContentFile& pendingFile : pendingFiles)
         {
-            contentFileBlocks.m_blockOffsetSizePairs = AZStd::vector<BlockOffsetSizePair>{ { 0, inputDataSpan.size() } };
-            return contentFileBlocks;
-        }
+            ContentFileBlocks& contentFileBlocks = pendingFile.m_contentFileBlocks;
+            contentFileBlocks.m_writeSpan = pendingFile.m_inputSpan;
+            if (!pendingFile.m_shouldWrite || pendingFile.m_inputSpan.empty())
+            {
+                continue;
+            }
 
-        const Compression::CompressionOptions& compressionOptions = fileSettings.m_compressionOptions != nullptr
-            ? *fileSettings.m_compressionOptions
-            : Compression::CompressionOptions{};
+            if (pendingFile.m_compressionInterface == nullptr)
+            {
+                // The file is stored uncompressed, so a single block references the entire input buffer
+                contentFileBlocks.m_blockOffsetSizePairs.assign({ BlockOffsetSizePair{ 0, pendingFile.m_inputSpan.size() } });
+                contentFileBlocks.m_totalUnalignedSize = pendingFile.m_inputSpan.size();
+                continue;
+            }
 
-        // Due to check earlier validating that the inputDataSpan is not empty,
-        // the compressedBlockCount will be at least 1 due to rounding up to the nearest block
-        AZ::u32 compressedBlockCount = GetBlockCountIfCompressed(inputDataSpan.size());
+            // Due to empty files being skipped, the block count is at least 1 due to rounding up to the nearest block
+            const AZ::u32 compressedBlockCount = GetBlockCountIfCompressed(pendingFile.m_inputSpan.size());
+            for (AZ::u32 blockIndex = 0; blockIndex < compressedBlockCount; ++blockIndex)
+            {
+                pendingBlocks.push_back({ &pendingFile, blockIndex * ArchiveBlockSizeForCompression });
+            }
+        }
 
-        // Resize the compress block buffer to be be a multiple of ArchiveBlockSizeForCompression
-        // times the block count
-        AZStd::vector<AZStd::byte> compressBlocksBuffer;
-        compressBlocksBuffer.resize_no_construct(compressedBlockCount * ArchiveBlockSizeForCompression);
+        if (pendingBlocks.empty())
+        {
+            return;
+        }
 
         // Make sure there is at least one task that runs to make sure that progress
         // with compression is always being made
-        const AZ::u32 maxCompressTasks = AZStd::max(1U, m_settings.m_maxCompressTasks);
+        const size_t maxCompressTasks = AZStd::min<size_t>(AZStd::max(1U, m_settings.m_maxCompressTasks), pendingBlocks.size());
 
-        // Stores the compressed size for all blocks without alignment
-        size_t compressedBlockSizeForAllBlocks{};
+        // Scratch buffer which is segmented into 2 MiB slots, one for each compression task
+        // The compressed data is copied out of a slot into the compression buffer of the file after each iteration
+        AZStd::vector<AZStd::byte> compressBlocksBuffer;
+        compressBlocksBuffer.resize_no_construct(maxCompressTasks * ArchiveBlockSizeForCompression);
         // allocated slots for each blocks CompressionResultData
         AZStd::vector<Compression::CompressionResultData> compressedBlockResults(maxCompressTasks);
-        while (compressedBlockCount > 0)
+
+        // Options used for files which don't supply their own
+        // It must outlive the compression tasks, which reference the options
+        const Compression::CompressionOptions defaultCompressionOptions{};
+        const AZ::u32 compressionThresholdInBytes = m_archiveHeader.m_compressionThreshold;
+        for (size_t blockIndex = 0; blockIndex < pendingBlocks.size();)
         {
-            const AZ::u32 compressionThresholdInBytes = m_archiveHeader.m_compressionThreshold;
-            const AZ::u32 iterationTaskCount = AZStd::min(compressedBlockCount, maxCompressTasks);
-            // decrease the compressedBlockCount by the number of compressed tasks to be executed
-            compressedBlockCount -= iterationTaskCount;
+            const size_t iterationTaskCount = AZStd::min(pendingBlocks.size() - blockIndex, maxCompressTasks);
+            const AZStd::span<const PendingBlock> iterationBlocks(pendingBlocks.data() + blockIndex, iterationTaskCount);
+            blockIndex += iterationTaskCount;
 
             {
                 // Task graph event used to block when writing compressed blocks in parallel
@@ -977,28 +1028,28 @@ namespace Archive
 
                 for (size_t compressedTaskSlot = 0; compressedTaskSlot < iterationTaskCount; ++compressedTaskSlot)
                 {
-                    AZStd::span compressBlocksSpan(compressBlocksBuffer);
-                    const size_t blockStartOffset = compressedTaskSlot * ArchiveBlockSizeForCompression;
+                    const PendingBlock& pendingBlock = iterationBlocks[compressedTaskSlot];
+                    const PendingContentFile& pendingFile = *pendingBlock.m_pendingFile;
 
                     // Cap the input block span size to the minimum of the ArchiveBlockSizeForCompression(2 MiB) and the remaining size
                     // left in the input buffer via subspan
                     const size_t inputBlockSize = AZStd::min(
-                        inputDataSpan.size() - blockStartOffset,
+                        pendingFile.m_inputSpan.size() - pendingBlock.m_blockStartOffset,
                         static_cast<size_t>(ArchiveBlockSizeForCompression));
-                    auto inputBlockSpan = inputDataSpan.subspan(blockStartOffset,
-                        inputBlockSize);
+                    auto inputBlockSpan = pendingFile.m_inputSpan.subspan(pendingBlock.m_blockStartOffset, inputBlockSize);
 
-                    // Span that is segmented in up to ArchiveBlockSize(2MiB) blocks to store compressed data
-                    const size_t compressBlockSize = AZStd::min(
-                        compressBlocksSpan.size() - blockStartOffset,
-                        static_cast<size_t>(ArchiveBlockSizeForCompression));
-                    auto compressBlockSpan = compressBlocksSpan.subspan(blockStartOffset,
-                        compressBlockSize);
+                    // 2 MiB slot of the scratch buffer to store the compressed data of the block
+                    auto compressBlockSpan = AZStd::span(compressBlocksBuffer).subspan(
+                        compressedTaskSlot * ArchiveBlockSizeForCompression, ArchiveBlockSizeForCompression);
+
+                    const Compression::CompressionOptions& compressionOptions = pendingFile.m_fileSettings->m_compressionOptions != nullptr
+                        ? *pendingFile.m_fileSettings->m_compressionOptions
+                        : defaultCompressionOptions;
 
                     //! Compress Task to execute in task executor
                     auto compressTask = [
-                        compressionInterface, &compressionOptions, inputBlockSpan, compressBlockSpan,
-                        &compressedBlockResult = compressedBlockResults[compressedTaskSlot]]()
+                        compressionInterface = pendingFile.m_compressionInterface, &compressionOptions, inputBlockSpan,
+                        compressBlockSpan, &compressedBlockResult = compressedBlockResults[compressedTaskSlot]]()
                     {
                         // Run the input data through the compressor
                         compressedBlockResult = compressionInterface->CompressBlock(
@@ -1012,65 +1063,70 @@ namespace Archive
                 taskWriteGraphEvent->Wait();
             }
 
-            size_t alignedCompressedBlockSizeForAllBlocks{};
-
             for (size_t compressedTaskSlot = 0; compressedTaskSlot < iterationTaskCount; ++compressedTaskSlot)
             {
-                Compression::CompressionResultData& compressedBlockResult = compressedBlockResults[compressedTaskSlot];
-                if (!compressedBlockResult || compressedBlockResult.GetCompressedByteCount() > compressionThresholdInBytes)
+                PendingContentFile& pendingFile = *iterationBlocks[compressedTaskSlot].m_pendingFile;
+                if (pendingFile.m_compressionFailed)
                 {
-                    // If compression fails for a block or it is higher than the compression threshold
-                    // then return the contentFileData that has the compression algorithm set to uncompressed
-                    // and points to the input data span
-                    // The entire file is stored uncompressed in this scenario
-                    // Return a successful outcome with a single block offset size pair that references the entire
-                    // input buffer
-                    contentFileBlocks.m_blockOffsetSizePairs.assign({ BlockOffsetSizePair{0, inputDataSpan.size()} });
-                    contentFileBlocks.m_totalUnalignedSize = inputDataSpan.size();
-                    return contentFileBlocks;
+                    continue;
                 }
-                else
+
+                const Compression::CompressionResultData& compressedBlockResult = compressedBlockResults[compressedTaskSlot];
+                if (!compressedBlockResult || compressedBlockResult.GetCompressedByteCount() > compressionThresholdInBytes)
                 {
-                    AZ::u64 compressedBlockSize = compressedBlockResult.GetCompressedByteCount();
-                    compressedBlockSizeForAllBlocks += compressedBlockSize;
-                    alignedCompressedBlockSizeForAllBlocks += AZ_SIZE_ALIGN_UP(compressedBlockSize, ArchiveDefaultBlockAlignment);
+                    // If compression fails for a block or it is higher than the compression threshold
+                    // then the entire file is stored uncompressed
+                    // The remaining blocks of the file are skipped when processing the results
+                    pendingFile.m_compressionFailed = true;
+                    pendingFile.m_compressionBuffer = {};
+                    continue;
                 }
-            }
 
-            // Determine the amount of additional bytes to resize the compression data output buffer
-            // This takes into account the alignment of blocks as how it would be written on disk
-            compressionDataBuffer.reserve(compressionDataBuffer.size() + alignedCompressedBlockSizeForAllBlocks);
-            for (size_t compressedTaskSlot = 0; compressedTaskSlot < iterationTaskCount; ++compressedTaskSlot)
-            {
-                const Compression::CompressionResultData& compressedBlockResult = compressedBlockResults[compressedTaskSlot];
+                ContentFileBlocks& contentFileBlocks = pendingFile.m_contentFileBlocks;
+                AZStd::vector<AZStd::byte>& compressionDataBuffer = pendingFile.m_compressionBuffer;
 
                 // Calculated the number of additional bytes to store to pad the block to 512-byte alignment
-                const AZ::u64 alignmentBytes = AZ_SIZE_ALIGN_UP(compressedBlockResult.GetCompressedByteCount(), ArchiveDefaultBlockAlignment)
-                    - compressedBlockResult.GetCompressedByteCount();
+                const AZ::u64 compressedBlockSize = compressedBlockResult.GetCompressedByteCount();
+                const AZ::u64 alignmentBytes = AZ_SIZE_ALIGN_UP(compressedBlockSize, ArchiveDefaultBlockAlignment)
+                    - compressedBlockSize;
 
                 // Copy the bytes from block into the data buffer
-                auto insertIt = compressionDataBuffer.insert(compressionDataBuffer.end(), compressedBlockResult.m_compressedBuffer.begin(),
+                const size_t compressedBlockStartOffset = compressionDataBuffer.size();
+                compressionDataBuffer.insert(compressionDataBuffer.end(), compressedBlockResult.m_compressedBuffer.begin(),
                     compressedBlockResult.m_compressedBuffer.end());
-                auto compressedBlockStartOffset = size_t(AZStd::distance(compressionDataBuffer.begin(), insertIt));
                 // fill the buffer with padding bytes
                 compressionDataBuffer.insert(compressionDataBuffer.end(), alignmentBytes, AZStd::byte{});
 
                 // Populate the block offset pairs with the offset within compressionDataBuffer where the compressed block is written
                 // plus the size of the compressed data
-                contentFileBlocks.m_blockOffsetSizePairs.push_back({ compressedBlockStartOffset,
-                    compressedBlockResult.GetCompressedByteCount() });
+                contentFileBlocks.m_blockOffsetSizePairs.push_back({ compressedBlockStartOffset, compressedBlockSize });
+                contentFileBlocks.m_totalUnalignedSize += compressedBlockSize;
             }
         }
 
-        // Set the compression algorithm index once compression has completed successfully for all blocks of the file
-        contentFileBlocks.m_compressionAlgorithmIndex = static_cast<AZ::u8>(compressionAlgorithmIndex);
-        // The file has been successfully compressed, so store a span to the buffer
-        contentFileBlocks.m_writeSpan = compressionDataBuffer;
-        // Store the compressed size of each block without taking any alignment into account
-        // This is the exact total compressed size of the "file" as stored in blocks
-        contentFileBlocks.m_totalUnalignedSize = compressedBlockSizeForAllBlocks;
+        for (PendingContentFile& pendingFile : pendingFiles)
+        {
+            if (pendingFile.m_compressionInterface == nullptr || !pendingFile.m_shouldWrite || pendingFile.m_inputSpan.empty())
+            {
+                continue;
+            }
 
-        return contentFileBlocks;
+            ContentFileBlocks& contentFileBlocks = pendingFile.m_contentFileBlocks;
+            if (pendingFile.m_compressionFailed)
+            {
+                // Return a single block offset size pair that references the entire input buffer
+                contentFileBlocks.m_blockOffsetSizePairs.assign({ BlockOffsetSizePair{ 0, pendingFile.m_inputSpan.size() } });
+                contentFileBlocks.m_totalUnalignedSize = pendingFile.m_inputSpan.size();
+                contentFileBlocks.m_writeSpan = pendingFile.m_inputSpan;
+            }
+            else
+            {
+                // Set the compression algorithm index once compression has completed successfully for all blocks of the file
+                contentFileBlocks.m_compressionAlgorithmIndex = pendingFile.m_compressionAlgorithmIndex;
+                // The file has been successfully compressed, so store a span to the buffer
+                contentFileBlocks.m_writeSpan = pendingFile.m_compressionBuffer;
+            }
+        }
     }
 
     ArchiveFileToken ArchiveWriter::WriteContentFileToArchive(const ArchiveWriterFileSettings& fileSettings,
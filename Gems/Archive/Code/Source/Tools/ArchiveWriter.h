@@ -16,6 +16,7 @@
 #include <AzCore/Memory/Memory_fwd.h>
 #include <AzCore/RTTI/RTTIMacros.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/utility/to_underlying.h>
@@ -114,6 +115,13 @@ namespace Archive
         ArchiveAddFileResult AddFileToArchive(AZStd::span<const AZStd::byte> inputSpan,
             const ArchiveWriterFileSettings& fileSettings) override;
 
+        //! Adds the content of multiple files to the archive
+        //! The blocks of all the files are compressed in parallel and then each file is written
+        //! to the archive in the order supplied
+        //! @param fileEntries spans of file content data along with the settings to use to add each file
+        //! @return a vector containing the ArchiveAddFileResult for each file entry, in the same order as @fileEntries
+        ArchiveAddFilesResult AddFilesToArchive(AZStd::span<const ArchiveWriterFileEntry> fileEntries) override;
+
         //! Searches for a relative path within the archive
         //! @param relativePath Relative path within archive to search for
         //! @return A token that identifies the Archive file if it exist
@@ -177,18 +185,48 @@ namespace Archive
             AZ::u64 m_totalUnalignedSize{};
 
         };
-        using CompressContentOutcome = AZStd::expected<ContentFileBlocks, ResultString>;
-
-        //! Uses the AZ Task system to compress 2 MiB blocks of a content file in parallel
-        //! @param compressionBuffer output buffer to write compressed content
-        //! @oaram fileSettings settings controlling how to write the content data into the archive stream
-        //! @param contentFileData input buffer of file content to write to as a file using the file path
-        //!        specified in the fileSettings
-        //! @return an outcome that contains a span if the content fileData was successfully compressed
-        //!         otherwise a failure string containing the error that occurs when attempting to compressed
-        //!         the asynchronous content
-        CompressContentOutcome CompressContentFileAsync(AZStd::vector<AZStd::byte>& compressionBuffer,
-            const ArchiveWriterFileSettings& fileSettings, AZStd::span<const AZStd::byte> inputDataSpan);
+
+        //! Stores the state of a single file from a batch of files being added to the archive
+        //! while the blocks of the batch are compressed in parallel
+        struct PendingContentFile
+        {
+            //! Settings and content data supplied to @AddFilesToArchive for the file
+            const ArchiveWriterFileSettings* m_fileSettings{};
+            AZStd::span<const AZStd::byte> m_inputSpan;
+            //! Compression interface used to compress the blocks of the file
+            //! If it is nullptr, the file is stored uncompressed
+            Compression::ICompressionInterface* m_compressionInterface{};
+            //! Index into the TOC of compression algorithm the file is compressed with
+            AZ::u8 m_compressionAlgorithmIndex{ UncompressedAlgorithmIndex };
+            //! Set if the file has passed validation and will be written to the archive
+            bool m_shouldWrite{};
+            //! Set if compression of any block of the file fails or exceeds the compression threshold
+            //! The entire file is stored uncompressed in that case
+            bool m_compressionFailed{};
+            //! Storage for the compressed blocks of the file, each padded to 512-byte alignment
+            //! The ContentFileBlocks write span references this buffer when the file is compressed
+            AZStd::vector<AZStd::byte> m_compressionBuffer;
+            //! Block data about the file contents to write to the archive once compression completes
+            ContentFileBlocks m_contentFileBlocks;
+        };
+
+        //! Validates the file path and compression settings of a file being added to the archive
+        //! and updates the path in the result structure with the file case applied
+        //! @param result result structure for the file, which stores any validation error
+        //! @param pendingFile state of the file being added, which is updated with the compression interface to use
+        //! @param batchFilePaths paths of the files in the current batch that are new to the archive,
+        //!        which is used to reject adding the same new file twice
+        //! @return true if the file can be written to the archive
+        bool PrepareContentFile(ArchiveAddFileResult& result, PendingContentFile& pendingFile,
+            AZStd::unordered_set<AZ::IO::PathView>& batchFilePaths);
+
+        //! Uses the AZ Task system to compress 2 MiB blocks of all the content files in parallel
+        //! Up to `ArchiveWriterSettings::m_maxCompressTasks` blocks are compressed at a time,
+        //! regardless of which file they belong to
+        //! The block data of each pending file is populated with the compressed blocks,
+        //! or with a single block that references the input data if the file is stored uncompressed
+        //! @param pendingFiles files to compress
+        void CompressContentFilesAsync(AZStd::span<PendingContentFile> pendingFiles);
 
         //! In-memory structure which stores metadata about the file contents after being
         //! sent through any compression algorithm and path normalization
@@ -970,4 +970,80 @@ namespace Archive::Test
             EXPECT_TRUE(AZStd::ranges::equal(requestedFileData, expectedResultData));
         }
     }
+
+    TEST_F(ArchiveReaderFixture, ExtractFileFromArchive_ForFilesAddedInBatch_WithFewerCompressTasksThanBlocks_Succeeds)
+    {
+        using namespace Archive::literals;
+        // Generate a 7 MiB file which compresses into 4 blocks, along with several small files
+        // Only 2 compression tasks are allowed at a time, so the blocks of the batch
+        // are compressed over multiple iterations
+        AZStd::vector<AZStd::byte> largeFileBuffer;
+        largeFileBuffer.resize_no_construct(7_mib);
+        auto RepeatingByteSequenceGenerator = [currentValue = 0]() mutable
+        {
+            return static_cast<AZStd::byte>(currentValue++ % 251);
+        };
+        AZStd::generate(largeFileBuffer.begin(), largeFileBuffer.end(), RepeatingByteSequenceGenerator);
+
+        constexpr AZStd::string_view smallFileContents[] = { "Hello World", "Hello Archive", "Hello Batch" };
+        constexpr AZStd::string_view filePaths[] = { "first.txt", "large.bin", "second.txt", "third.txt" };
+
+        AZStd::vector<AZStd::byte> archiveBuffer;
+        AZ::IO::ByteContainerStream archiveStream(&archiveBuffer);
+
+        {
+            ArchiveWriterSettings writerSettings;
+            writerSettings.m_maxCompressTasks = 2;
+            IArchiveWriter::ArchiveStreamPtr archiveWriterStreamPtr(&archiveStream, { false });
+            auto createArchiveWriterResult = CreateArchiveWriter(AZStd::move(archiveWriterStreamPtr), writerSettings);
+            ASSERT_TRUE(createArchiveWriterResult);
+            AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+            AZStd::vector<ArchiveWriterFileEntry> fileEntries(AZStd::size(filePaths));
+            fileEntries[0].m_inputSpan = AZStd::as_bytes(AZStd::span(smallFileContents[0]));
+            fileEntries[1].m_inputSpan = largeFileBuffer;
+            fileEntries[2].m_inputSpan = AZStd::as_bytes(AZStd::span(smallFileContents[1]));
+            fileEntries[3].m_inputSpan = AZStd::as_bytes(AZStd::span(smallFileContents[2]));
+            for (size_t fileIndex = 0; fileIndex < fileEntries.size(); ++fileIndex)
+            {
+                fileEntries[fileIndex].m_fileSettings.m_relativeFilePath = filePaths[fileIndex];
+                fileEntries[fileIndex].m_fileSettings.m_compressionAlgorithm = CompressionLZ4::GetLZ4CompressionAlgorithmId();
+            }
+
+            IArchiveWriter::ArchiveAddFilesResult addFilesResult = archiveWriter->AddFilesToArchive(fileEntries);
+            ASSERT_EQ(fileEntries.size(), addFilesResult.size());
+            for (const ArchiveAddFileResult& addFileResult : addFilesResult)
+            {
+                EXPECT_TRUE(addFileResult);
+            }
+            EXPECT_EQ(CompressionLZ4::GetLZ4CompressionAlgorithmId(), addFilesResult[1].m_compressionAlgorithm);
+
+            IArchiveWriter::CommitResult commitResult = archiveWriter->Commit();
+            ASSERT_TRUE(commitResult);
+        }
+
+        IArchiveReader::ArchiveStreamPtr archiveReaderStreamPtr(&archiveStream, { false });
+        auto createArchiveReaderResult = CreateArchiveReader(AZStd::move(archiveReaderStreamPtr));
+        ASSERT_TRUE(createArchiveReaderResult);
+        AZStd::unique_ptr<IArchiveReader> archiveReader = AZStd::move(createArchiveReaderResult.value());
+        EXPECT_TRUE(archiveReader->IsMounted());
+
+        const AZStd::span<const AZStd::byte> expectedContents[] = { AZStd::as_bytes(AZStd::span(smallFileContents[0])),
+            largeFileBuffer, AZStd::as_bytes(AZStd::span(smallFileContents[1])), AZStd::as_bytes(AZStd::span(smallFileContents[2])) };
+        for (size_t fileIndex = 0; fileIndex < AZStd::size(filePaths); ++fileIndex)
+        {
+            const ArchiveListFileResult archiveListFileResult = archiveReader->ListFileInArchive(filePaths[fileIndex]);
+            ASSERT_TRUE(archiveListFileResult);
+
+            AZStd::vector<AZStd::byte> fileBuffer;
+            fileBuffer.resize_no_construct(archiveListFileResult.m_uncompressedSize);
+            ArchiveReaderFileSettings fileSettings;
+            fileSettings.m_filePathIdentifier = archiveListFileResult.m_filePathToken;
+
+            const ArchiveExtractFileResult archiveExtractFileResult = archiveReader->ExtractFileFromArchive(
+                fileBuffer, fileSettings);
+            ASSERT_TRUE(archiveExtractFileResult);
+            EXPECT_TRUE(AZStd::ranges::equal(archiveExtractFileResult.m_fileSpan, expectedContents[fileIndex]));
+        }
+    }
 }
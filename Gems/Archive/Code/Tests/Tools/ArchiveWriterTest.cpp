@@ -843,6 +843,66 @@ namespace Archive::Test
         EXPECT_EQ(CompressionLZ4::GetLZ4CompressionAlgorithmId(), archiveHeader->m_compressionAlgorithmsIds[0]);
     }
 
+    TEST_F(ArchiveWriterFixture, AddFilesToArchive_ProducesSameArchive_AsAddingFilesOneAtATime)
+    {
+        constexpr AZStd::string_view fileContents[] = { "Hello World", "Hello Archive", "Hello Batch", "Hello Again" };
+        constexpr AZStd::string_view filePaths[] = { "Sanity/first.txt", "second.txt", "Sanity/third.txt", "Sanity/first.txt" };
+        constexpr Compression::CompressionAlgorithmId uncompressed = Compression::Uncompressed;
+        const Compression::CompressionAlgorithmId compressionAlgorithms[] = { CompressionLZ4::GetLZ4CompressionAlgorithmId(),
+            uncompressed, CompressionLZ4::GetLZ4CompressionAlgorithmId(), CompressionLZ4::GetLZ4CompressionAlgorithmId() };
+
+        AZStd::vector<ArchiveWriterFileEntry> fileEntries(AZStd::size(filePaths));
+        for (size_t fileIndex = 0; fileIndex < fileEntries.size(); ++fileIndex)
+        {
+            fileEntries[fileIndex].m_inputSpan = StringToByteSpan(fileContents[fileIndex]);
+            fileEntries[fileIndex].m_fileSettings.m_relativeFilePath = filePaths[fileIndex];
+            fileEntries[fileIndex].m_fileSettings.m_compressionAlgorithm = compressionAlgorithms[fileIndex];
+        }
+
+        // Write the archive by adding the files one at a time
+        AZStd::vector<AZStd::byte> sequentialArchiveBuffer;
+        {
+            AZ::IO::ByteContainerStream archiveStream(&sequentialArchiveBuffer);
+            IArchiveWriter::ArchiveStreamPtr archiveStreamPtr(&archiveStream, { false });
+            auto createArchiveWriterResult = CreateArchiveWriter(AZStd::move(archiveStreamPtr));
+            ASSERT_TRUE(createArchiveWriterResult);
+            AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+            for (const ArchiveWriterFileEntry& fileEntry : fileEntries)
+            {
+                archiveWriter->AddFileToArchive(fileEntry.m_inputSpan, fileEntry.m_fileSettings);
+            }
+            ASSERT_TRUE(archiveWriter->Commit());
+        }
+
+        // Write the archive by adding all the files in a single batch
+        AZStd::vector<AZStd::byte> batchArchiveBuffer;
+        {
+            AZ::IO::ByteContainerStream archiveStream(&batchArchiveBuffer);
+            IArchiveWriter::ArchiveStreamPtr archiveStreamPtr(&archiveStream, { false });
+            auto createArchiveWriterResult = CreateArchiveWriter(AZStd::move(archiveStreamPtr));
+            ASSERT_TRUE(createArchiveWriterResult);
+            AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+            IArchiveWriter::ArchiveAddFilesResult addFilesResult = archiveWriter->AddFilesToArchive(fileEntries);
+            ASSERT_EQ(fileEntries.size(), addFilesResult.size());
+            EXPECT_TRUE(addFilesResult[0]);
+            EXPECT_EQ(CompressionLZ4::GetLZ4CompressionAlgorithmId(), addFilesResult[0].m_compressionAlgorithm);
+            EXPECT_TRUE(addFilesResult[1]);
+            EXPECT_EQ(Compression::Uncompressed, addFilesResult[1].m_compressionAlgorithm);
+            EXPECT_TRUE(addFilesResult[2]);
+            // The final file has the same path as the first file and the FileMode::AddNew option is used
+            // so it fails to be added, without affecting the other files
+            EXPECT_FALSE(addFilesResult[3]);
+            EXPECT_FALSE(addFilesResult[3].m_resultOutcome);
+            EXPECT_NE(addFilesResult[0].m_filePathToken, addFilesResult[2].m_filePathToken);
+            ASSERT_TRUE(archiveWriter->Commit());
+        }
+
+        // As the batch is written in order, the layout of both archives is identical
+        EXPECT_EQ(sequentialArchiveBuffer, batchArchiveBuffer);
+    }
+
     TEST_F(ArchiveWriterFixture, CanWriteCompressedTOC_AndReadCompressedBackIn_Succeeds)
     {
         AZStd::vector<AZStd::byte> archiveBuffer;
@@ -249,12 +249,6 @@ namespace ImageProcessingAtom
                         simulationJob->SetDependent(completionJob);
                         simulationJob->Start();
                     }
-
-                    astcenc_error error = astcenc_compress_image(context, &image, &swizzle, dstMem, dataSize, threadIdx);
-                    if (error != ASTCENC_SUCCESS)
-                    {
-                        status = error;
-                    }
                 }
                 
                 if (currentJob)
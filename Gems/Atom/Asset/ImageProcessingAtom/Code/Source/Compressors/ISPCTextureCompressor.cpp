@@ -7,7 +7,12 @@
  */
 
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/std/function/function_template.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <Atom/ImageProcessing/ImageObject.h>
 #include <Processing/ImageToProcess.h>
@@ -55,6 +60,72 @@ namespace ImageProcessingAtom
         AZStd::function<void(astc_enc_settings*, int block_width, int block_height)>   m_astcAlpha;
     };
 
+    // All the formats compressed by the ISPC compressor use 4x4 blocks of 16 bytes.
+    static constexpr int32_t BlockDimension = 4;
+    static constexpr int32_t BytesPerBlock = 16;
+
+    // Mips with fewer blocks than this are compressed on the calling thread, the jobs would cost more than they save.
+    static constexpr int32_t MinBlocksPerStrip = 256;
+
+    using CompressBlocksFunction = AZStd::function<void(const rgba_surface*, uint8_t*)>;
+
+    // Splits the surface in horizontal strips of whole block rows and compresses them in parallel on the job system.
+    // The blocks are independent of each other, so the output is identical to compressing the whole surface at once.
+    static void CompressSurfaceInStrips(const rgba_surface& surface, uint8_t* destination, const CompressBlocksFunction& compressBlocks)
+    {
+        const int32_t blocksPerRow = (surface.width + BlockDimension - 1) / BlockDimension;
+        const int32_t blockRows = (surface.height + BlockDimension - 1) / BlockDimension;
+        const int32_t maxStrips = AZStd::max(1, (blocksPerRow * blockRows) / MinBlocksPerStrip);
+        const int32_t stripCount =
+            AZStd::min(AZStd::min(static_cast<int32_t>(AZStd::thread::hardware_concurrency()), maxStrips), blockRows);
+
+        if (stripCount <= 1)
+        {
+            compressBlocks(&surface, destination);
+            return;
+        }
+
+        const int32_t blockRowsPerStrip = (blockRows + stripCount - 1) / stripCount;
+
+        AZ::Job* currentJob = AZ::JobContext::GetGlobalContext()->GetJobManager().GetCurrentJob();
+        AZ::JobCompletion completionJob;
+        for (int32_t firstBlockRow = 0; firstBlockRow < blockRows; firstBlockRow += blockRowsPerStrip)
+        {
+            const int32_t firstPixelRow = firstBlockRow * BlockDimension;
+
+            rgba_surface strip = surface;
+            strip.ptr = surface.ptr + static_cast<size_t>(firstPixelRow) * surface.stride;
+            strip.height = AZStd::min(blockRowsPerStrip * BlockDimension, surface.height - firstPixelRow);
+            uint8_t* stripDestination = destination + static_cast<size_t>(firstBlockRow) * blocksPerRow * BytesPerBlock;
+
+            AZ::Job* stripJob = AZ::CreateJobFunction([strip, stripDestination, &compressBlocks]()
+            {
+                compressBlocks(&strip, stripDestination);
+            }, true, nullptr); //auto-deletes
+
+            // adds this job as child to current job if there is a current job
+            // otherwise adds it as a dependent for the complete job
+            if (currentJob)
+            {
+                currentJob->StartAsChild(stripJob);
+            }
+            else
+            {
+                stripJob->SetDependent(&completionJob);
+                stripJob->Start();
+            }
+        }
+
+        if (currentJob)
+        {
+            currentJob->WaitForChildren();
+        }
+        else
+        {
+            completionJob.StartAndWaitForCompletion();
+        }
+    }
+
     bool ISPCCompressor::IsCompressedPixelFormatSupported(EPixelFormat fmt)
     {
         // Even though the ISPC compressor support ASTC formats. But it has restrictions
@@ -182,6 +253,56 @@ namespace ImageProcessingAtom
             }
         }
 
+        // Pick the compression function, depending on the destination format
+        CompressBlocksFunction compressBlocks;
+        switch (destinationFormat)
+        {
+        case ePixelFormat_BC3:
+            compressBlocks = [](const rgba_surface* source, uint8_t* destination)
+            {
+                CompressBlocksBC3(source, destination);
+            };
+            break;
+        case ePixelFormat_BC6UH:
+        {
+            // Get the profile setter
+            bc6h_enc_settings settings = {};
+            const auto setProfile = compressionProfile->GetBC6();
+            setProfile(&settings);
+
+            // Compress with BC6 half precision
+            compressBlocks = [settings](const rgba_surface* source, uint8_t* destination)
+            {
+                bc6h_enc_settings blockSettings = settings;
+                CompressBlocksBC6H(source, destination, &blockSettings);
+            };
+        }
+        break;
+        case ePixelFormat_BC7:
+        case ePixelFormat_BC7t:
+        {
+            // Get the profile setter
+            bc7_enc_settings settings = {};
+            const auto setProfile = compressionProfile->GetBC7(discardAlpha);
+            setProfile(&settings);
+
+            // Compress with BC7
+            compressBlocks = [settings](const rgba_surface* source, uint8_t* destination)
+            {
+                bc7_enc_settings blockSettings = settings;
+                CompressBlocksBC7(source, destination, &blockSettings);
+            };
+        }
+        break;
+        default:
+        {
+            // No valid pixel format
+            AZ_Assert(false, "Unhandled pixel format %d", destinationFormat);
+            return nullptr;
+        }
+        break;
+        }
+
         // Allocate the destination image
         IImageObjectPtr destinationImage(sourceImage->AllocateImage(destinationFormat));
 
@@ -206,43 +327,7 @@ namespace ImageProcessingAtom
             AZ::u8* destinationImageData = nullptr;
             destinationImage->GetImagePointer(mip, destinationImageData, destinationPitch);
 
-            // Compress with the correct function, depending on the destination format
-            switch (destinationFormat)
-            {
-            case ePixelFormat_BC3:
-                CompressBlocksBC3(&sourceSurface, destinationImageData);
-                break;
-            case ePixelFormat_BC6UH:
-            {
-                // Get the profile setter
-                bc6h_enc_settings settings = {};
-                const auto setProfile = compressionProfile->GetBC6();
-                setProfile(&settings);
-
-                // Compress with BC6 half precision
-                CompressBlocksBC6H(&sourceSurface, destinationImageData, &settings);
-            }
-            break;
-            case ePixelFormat_BC7:
-            case ePixelFormat_BC7t:
-            {
-                // Get the profile setter
-                bc7_enc_settings settings = {};
-                const auto setProfile = compressionProfile->GetBC7(discardAlpha);
-                setProfile(&settings);
-
-                // Compress with BC7
-                CompressBlocksBC7(&sourceSurface, destinationImageData, &settings);
-            }
-            break;
-            default:
-            {
-                // No valid pixel format
-                AZ_Assert(false, "Unhandled pixel format %d", destinationFormat);
-                return nullptr;
-            }
-            break;
-            }
+            CompressSurfaceInStrips(sourceSurface, destinationImageData, compressBlocks);
         }
 
         return destinationImage;
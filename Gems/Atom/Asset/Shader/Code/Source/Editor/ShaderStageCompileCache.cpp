@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ShaderStageCompileCache.h"
+
+#include <AssetBuilderSDK/AssetBuilderSDK.h>
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Sha1.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace ShaderBuilder
+    {
+        static constexpr char ShaderStageCompileCacheName[] = "ShaderStageCompileCache";
+
+        // Bump when the entry format or the way the keys are computed changes.
+        static constexpr AZ::u32 CacheEntryVersion = 1;
+        static constexpr AZ::u32 CacheEntryTag = 0x43435353; // "SSCC"
+
+        namespace
+        {
+            void HashString(AZ::Sha1& sha1, AZStd::string_view value)
+            {
+                // Length prefixed so that concatenations of different strings don't hash the same.
+                const AZ::u64 length = value.size();
+                sha1.ProcessBytes(reinterpret_cast<const AZStd::byte*>(&length), sizeof(length));
+                sha1.ProcessBytes(reinterpret_cast<const AZStd::byte*>(value.data()), value.size());
+            }
+
+            void HashStringList(AZ::Sha1& sha1, const AZStd::vector<AZStd::string>& values)
+            {
+                HashString(sha1, AZStd::string::format("%zu", values.size()));
+                for (const AZStd::string& value : values)
+                {
+                    HashString(sha1, value);
+                }
+            }
+
+            AZStd::string DigestToString(AZ::Sha1& sha1)
+            {
+                AZ::u32 digest[5];
+                sha1.GetDigest(digest);
+                return AZStd::string::format("%08x%08x%08x%08x%08x", digest[0], digest[1], digest[2], digest[3], digest[4]);
+            }
+
+            void WriteU32(AZStd::vector<AZStd::byte>& buffer, AZ::u32 value)
+            {
+                const AZStd::byte* bytes = reinterpret_cast<const AZStd::byte*>(&value);
+                buffer.insert(buffer.end(), bytes, bytes + sizeof(value));
+            }
+
+            void WriteBlob(AZStd::vector<AZStd::byte>& buffer, const void* data, size_t size)
+            {
+                WriteU32(buffer, aznumeric_cast<AZ::u32>(size));
+                const AZStd::byte* bytes = reinterpret_cast<const AZStd::byte*>(data);
+                buffer.insert(buffer.end(), bytes, bytes + size);
+            }
+
+            //! Reads back what WriteU32/WriteBlob wrote, failing instead of reading past the end of truncated entries.
+            class EntryReader
+            {
+            public:
+                explicit EntryReader(const AZStd::vector<AZStd::byte>& buffer)
+                    : m_buffer(buffer)
+                {
+                }
+
+                bool ReadU32(AZ::u32& value)
+                {
+                    if (m_offset + sizeof(value) > m_buffer.size())
+                    {
+                        return false;
+                    }
+                    memcpy(&value, m_buffer.data() + m_offset, sizeof(value));
+                    m_offset += sizeof(value);
+                    return true;
+                }
+
+                template<typename Container>
+                bool ReadBlob(Container& value)
+                {
+                    AZ::u32 size = 0;
+                    if (!ReadU32(size) || m_offset + size > m_buffer.size())
+                    {
+                        return false;
+                    }
+                    value.resize(size);
+                    memcpy(value.data(), m_buffer.data() + m_offset, size);
+                    m_offset += size;
+                    return true;
+                }
+
+                bool IsAtEnd() const
+                {
+                    return m_offset == m_buffer.size();
+                }
+
+            private:
+                const AZStd::vector<AZStd::byte>& m_buffer;
+                size_t m_offset = 0;
+            };
+        } // namespace
+
+        ShaderStageCompileCache::ShaderStageCompileCache()
+        {
+            AZStd::string cacheFolder;
+            if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+            {
+                settingsRegistry->Get(cacheFolder, CachePathRegistryKey);
+            }
+
+            if (cacheFolder.empty())
+            {
+                return;
+            }
+
+            AZ::IO::FixedMaxPath resolvedPath;
+            if (auto fileIO = AZ::IO::FileIOBase::GetInstance(); fileIO != nullptr && fileIO->ResolvePath(resolvedPath, cacheFolder.c_str()))
+            {
+                cacheFolder = resolvedPath.c_str();
+            }
+
+            if (!AZ::IO::SystemFile::IsDirectory(cacheFolder.c_str()) && !AZ::IO::SystemFile::CreateDir(cacheFolder.c_str()))
+            {
+                AZ_Warning(ShaderStageCompileCacheName, false, "Shader stage compile cache folder '%s' cannot be created, the cache is disabled.", cacheFolder.c_str());
+                return;
+            }
+
+            m_cacheFolder = cacheFolder;
+        }
+
+        bool ShaderStageCompileCache::IsEnabled() const
+        {
+            return !m_cacheFolder.empty();
+        }
+
+        AZStd::string ShaderStageCompileCache::ComputeSourceKey(
+            const AssetBuilderSDK::PlatformInfo& platformInfo,
+            const RHI::ShaderPlatformInterface& shaderPlatformInterface,
+            const RHI::ShaderBuildArguments& shaderBuildArguments,
+            const AZStd::string& hlslSourceContent,
+            bool useSpecializationConstants)
+        {
+            AZ::Sha1 sha1;
+            HashString(sha1, AZStd::string::format("%u", CacheEntryVersion));
+            HashString(sha1, platformInfo.m_identifier);
+            HashString(sha1, shaderPlatformInterface.GetAPIName().GetStringView());
+            HashString(sha1, shaderBuildArguments.m_generateDebugInfo ? "debug" : "nodebug");
+            HashString(sha1, useSpecializationConstants ? "specialization" : "nospecialization");
+            HashStringList(sha1, shaderBuildArguments.m_preprocessorArguments);
+            HashStringList(sha1, shaderBuildArguments.m_azslcArguments);
+            HashStringList(sha1, shaderBuildArguments.m_dxcArguments);
+            HashStringList(sha1, shaderBuildArguments.m_spirvCrossArguments);
+            HashStringList(sha1, shaderBuildArguments.m_metalAirArguments);
+            HashStringList(sha1, shaderBuildArguments.m_metalLibArguments);
+            HashString(sha1, hlslSourceContent);
+            return DigestToString(sha1);
+        }
+
+        AZStd::string ShaderStageCompileCache::ComputeStageKey(
+            const AZStd::string& sourceKey,
+            const AZStd::string& variantHlslPrefix,
+            const AZStd::string& entryFunctionName,
+            RHI::ShaderHardwareStage shaderStage)
+        {
+            AZ::Sha1 sha1;
+            HashString(sha1, sourceKey);
+            HashString(sha1, variantHlslPrefix);
+            HashString(sha1, entryFunctionName);
+            HashString(sha1, AZStd::string::format("%u", static_cast<AZ::u32>(shaderStage)));
+            return DigestToString(sha1);
+        }
+
+        AZ::IO::Path ShaderStageCompileCache::GetEntryPath(const AZStd::string& stageKey) const
+        {
+            // Spread the entries over subfolders so a single folder does not end up with hundreds of thousands of files.
+            return m_cacheFolder / stageKey.substr(0, 2) / (stageKey + ".stage");
+        }
+
+        bool ShaderStageCompileCache::Load(const AZStd::string& stageKey, RHI::ShaderPlatformInterface::StageDescriptor& outputDescriptor) const
+        {
+            if (!IsEnabled())
+            {
+                return false;
+            }
+
+            const AZ::IO::Path entryPath = GetEntryPath(stageKey);
+            if (!AZ::IO::SystemFile::Exists(entryPath.c_str()))
+            {
+                return false;
+            }
+
+            auto readOutcome = AZ::Utils::ReadFile<AZStd::vector<AZStd::byte>>(entryPath.Native());
+            if (!readOutcome.IsSuccess())
+            {
+                return false;
+            }
+
+            const AZStd::vector<AZStd::byte>& buffer = readOutcome.GetValue();
+            EntryReader reader(buffer);
+
+            AZ::u32 tag = 0;
+            AZ::u32 version = 0;
+            AZ::u32 stageType = 0;
+            AZ::u32 dynamicBranchCount = 0;
+            RHI::ShaderPlatformInterface::StageDescriptor descriptor;
+            if (!reader.ReadU32(tag) || tag != CacheEntryTag ||
+                !reader.ReadU32(version) || version != CacheEntryVersion ||
+                !reader.ReadU32(stageType) ||
+                !reader.ReadU32(dynamicBranchCount) ||
+                !reader.ReadBlob(descriptor.m_byteCode) ||
+                !reader.ReadBlob(descriptor.m_sourceCode) ||
+                !reader.ReadBlob(descriptor.m_entryFunctionName) ||
+                !reader.ReadBlob(descriptor.m_extraData) ||
+                !reader.IsAtEnd())
+            {
+                AZ_Warning(ShaderStageCompileCacheName, false, "Ignoring invalid shader stage compile cache entry '%s'.", entryPath.c_str());
+                return false;
+            }
+
+            descriptor.m_stageType = static_cast<RHI::ShaderHardwareStage>(stageType);
+            descriptor.m_byProducts.m_dynamicBranchCount = dynamicBranchCount;
+            outputDescriptor = AZStd::move(descriptor);
+            return true;
+        }
+
+        void ShaderStageCompileCache::Store(const AZStd::string& stageKey, const RHI::ShaderPlatformInterface::StageDescriptor& descriptor) const
+        {
+            if (!IsEnabled())
+            {
+                return;
+            }
+
+            AZStd::vector<AZStd::byte> buffer;
+            buffer.reserve(descriptor.m_byteCode.size() + descriptor.m_sourceCode.size() + descriptor.m_extraData.size() + 256);
+            WriteU32(buffer, CacheEntryTag);
+            WriteU32(buffer, CacheEntryVersion);
+            WriteU32(buffer, static_cast<AZ::u32>(descriptor.m_stageType));
+            WriteU32(buffer, descriptor.m_byProducts.m_dynamicBranchCount);
+            WriteBlob(buffer, descriptor.m_byteCode.data(), descriptor.m_byteCode.size());
+            WriteBlob(buffer, descriptor.m_sourceCode.data(), descriptor.m_sourceCode.size());
+            WriteBlob(buffer, descriptor.m_entryFunctionName.data(), descriptor.m_entryFunctionName.size());
+            WriteBlob(buffer, descriptor.m_extraData.data(), descriptor.m_extraData.size());
+
+            const AZ::IO::Path entryPath = GetEntryPath(stageKey);
+            const AZ::IO::Path entryFolder = entryPath.ParentPath();
+            if (!AZ::IO::SystemFile::IsDirectory(entryFolder.c_str()) && !AZ::IO::SystemFile::CreateDir(entryFolder.c_str()))
+            {
+                return;
+            }
+
+            // Write next to the final name and rename, so other builders never read a partially written entry.
+            const AZ::IO::Path partialPath(
+                entryPath.Native() + AZStd::string::format(".%s.partial", AZ::Uuid::CreateRandom().ToFixedString(false, false).c_str()));
+            if (!AZ::Utils::WriteFile(buffer, partialPath.Native()).IsSuccess())
+            {
+                AZ::IO::SystemFile::Delete(partialPath.c_str());
+                return;
+            }
+
+            if (!AZ::IO::SystemFile::Rename(partialPath.c_str(), entryPath.c_str(), true))
+            {
+                AZ::IO::SystemFile::Delete(partialPath.c_str());
+            }
+        }
+    } // namespace ShaderBuilder
+} // namespace AZ
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/string/string.h>
+
+#include <Atom/RHI.Edit/ShaderBuildArguments.h>
+#include <Atom/RHI.Edit/ShaderPlatformInterface.h>
+
+namespace AssetBuilderSDK
+{
+    struct PlatformInfo;
+}
+
+namespace AZ
+{
+    namespace ShaderBuilder
+    {
+        //! Folder based cache of compiled shader stages, keyed by a hash of the variant hlsl source and everything that
+        //! is passed to the platform compiler. Variants whose generated hlsl did not change are not compiled again when
+        //! their batch is rebuilt, e.g. after editing an include that only some shaders use, or when another machine
+        //! already built them. The folder is read from @CachePathRegistryKey and can be a network share used by several
+        //! machines. The cache is disabled when the key is not set. The compiler binaries are not part of the key, so the
+        //! folder has to be cleared when dxc, spirv-cross or the metal tools are updated.
+        class ShaderStageCompileCache final
+        {
+        public:
+            static constexpr char CachePathRegistryKey[] = "/O3DE/Atom/Shaders/Build/VariantCompileCachePath";
+
+            ShaderStageCompileCache();
+
+            bool IsEnabled() const;
+
+            //! Key for everything shared by the variants of a supervariant: the hlsl source, the build arguments and the target.
+            static AZStd::string ComputeSourceKey(
+                const AssetBuilderSDK::PlatformInfo& platformInfo,
+                const RHI::ShaderPlatformInterface& shaderPlatformInterface,
+                const RHI::ShaderBuildArguments& shaderBuildArguments,
+                const AZStd::string& hlslSourceContent,
+                bool useSpecializationConstants);
+
+            //! Key for a single stage compilation of a variant.
+            static AZStd::string ComputeStageKey(
+                const AZStd::string& sourceKey,
+                const AZStd::string& variantHlslPrefix,
+                const AZStd::string& entryFunctionName,
+                RHI::ShaderHardwareStage shaderStage);
+
+            //! Returns true and fills @outputDescriptor if the stage was found in the cache.
+            bool Load(const AZStd::string& stageKey, RHI::ShaderPlatformInterface::StageDescriptor& outputDescriptor) const;
+
+            //! Adds a compiled stage to the cache. Failing to write is not an error, the stage is simply compiled again next time.
+            void Store(const AZStd::string& stageKey, const RHI::ShaderPlatformInterface::StageDescriptor& descriptor) const;
+
+        private:
+            AZ::IO::Path GetEntryPath(const AZStd::string& stageKey) const;
+
+            AZ::IO::Path m_cacheFolder;
+        };
+    } // namespace ShaderBuilder
+} // namespace AZ
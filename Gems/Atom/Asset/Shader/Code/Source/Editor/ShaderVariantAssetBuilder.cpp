@@ -59,6 +59,7 @@
 #include <CommonFiles/Preprocessor.h>
 #include <ShaderPlatformInterfaceRequest.h>
 #include "ShaderBuildArgumentsManager.h"
+#include "ShaderStageCompileCache.h"
 
 
 namespace AZ
@@ -630,6 +631,9 @@ namespace AZ
             // set the input file for eventual error messages, but the compiler won't be called on it.
             AzslCompiler azslc(sources->m_azslSourceFullPath, request.m_tempDirPath);
 
+            // Compiled stages are shared through this cache by all variants of the batch, if it's enabled.
+            const ShaderStageCompileCache compileCache;
+
             // Request the list of valid shader platform interfaces for the target platform.
             AZStd::vector<RHI::ShaderPlatformInterface*> platformInterfaces =
                 ShaderBuilderUtility::DiscoverEnabledShaderPlatformInterfaces(request.m_platformInfo, shaderSourceDescriptor);
@@ -828,6 +832,18 @@ namespace AZ
                                                                                   hlslCode,
                                                                                   usesSpecializationConstants };
 
+                    // Debug builds need the intermediate files of the compiler, so they always compile.
+                    if (compileCache.IsEnabled() && !shaderVariantCreationContext.m_shaderBuildArguments.m_generateDebugInfo)
+                    {
+                        shaderVariantCreationContext.m_compileCache = &compileCache;
+                        shaderVariantCreationContext.m_compileCacheSourceKey = ShaderStageCompileCache::ComputeSourceKey(
+                            request.m_platformInfo,
+                            *shaderPlatformInterface,
+                            shaderVariantCreationContext.m_shaderBuildArguments,
+                            hlslCode,
+                            usesSpecializationConstants);
+                    }
+
                     // Preserve the Temp folder when shaders are compiled with debug symbols
                     // or because the ShaderSourceData has m_keepTempFolder set to true.
                     response.m_keepTempFolder |= shaderVariantCreationContext.m_shaderBuildArguments.m_generateDebugInfo ||
@@ -1036,18 +1052,39 @@ namespace AZ
 
                 auto assetBuilderShaderType = ShaderBuilderUtility::ToAssetBuilderShaderType(shaderStageType);
 
+                // Register analysis reads the compiler output from the temp folder, so those variants are always compiled.
+                const bool useCompileCache = creationContext.m_compileCache && !shaderVariantInfo.m_enableRegisterAnalysis;
+                AZStd::string stageCacheKey;
+                if (useCompileCache)
+                {
+                    stageCacheKey = ShaderStageCompileCache::ComputeStageKey(
+                        creationContext.m_compileCacheSourceKey, hlslCodeToPrependForVariant, shaderEntryName, assetBuilderShaderType);
+                }
+
                 // Compile HLSL to the platform specific shader.
                 RHI::ShaderPlatformInterface::StageDescriptor descriptor;
-                bool shaderWasCompiled = creationContext.m_shaderPlatformInterface.CompilePlatformInternal(
-                    creationContext.m_platformInfo, variantShaderSourcePath, shaderEntryName, assetBuilderShaderType,
-                    creationContext.m_tempDirPath,
-                    descriptor,
-                    creationContext.m_shaderBuildArguments,
-                    creationContext.m_useSpecializationConstants);
-
-                if (!shaderWasCompiled)
+                if (useCompileCache && creationContext.m_compileCache->Load(stageCacheKey, descriptor))
                 {
-                    return AZ::Failure(AZStd::string::format("Could not compile the shader function %s", shaderEntryName.c_str()));
+                    AZ_TracePrintf(ShaderVariantAssetBuilderName, "Using cached compilation of shader function \"%s\"", shaderEntryName.c_str());
+                }
+                else
+                {
+                    bool shaderWasCompiled = creationContext.m_shaderPlatformInterface.CompilePlatformInternal(
+                        creationContext.m_platformInfo, variantShaderSourcePath, shaderEntryName, assetBuilderShaderType,
+                        creationContext.m_tempDirPath,
+                        descriptor,
+                        creationContext.m_shaderBuildArguments,
+                        creationContext.m_useSpecializationConstants);
+
+                    if (!shaderWasCompiled)
+                    {
+                        return AZ::Failure(AZStd::string::format("Could not compile the shader function %s", shaderEntryName.c_str()));
+                    }
+
+                    if (useCompileCache)
+                    {
+                        creationContext.m_compileCache->Store(stageCacheKey, descriptor);
+                    }
                 }
                 // bubble up the byproducts to the caller by moving them to the context.
                 outputByproducts.emplace(AZStd::move(descriptor.m_byProducts));
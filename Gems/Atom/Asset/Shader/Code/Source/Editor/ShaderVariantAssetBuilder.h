@@ -18,6 +18,7 @@
 #include <Atom/RPI.Edit/Shader/ShaderVariantListSourceData.h>
 
 #include "ShaderBuilderUtility.h"
+#include "ShaderStageCompileCache.h"
 
 namespace AZ
 {
@@ -44,6 +45,9 @@ namespace AZ
             const AZStd::string& m_hlslSourcePath;
             const AZStd::string& m_hlslSourceContent;
             const bool m_useSpecializationConstants = false;
+            //! Optional cache of compiled stages, and the key of the hlsl source and build arguments shared by the variants.
+            const ShaderStageCompileCache* m_compileCache = nullptr;
+            AZStd::string m_compileCacheSourceKey;
         };
 
 
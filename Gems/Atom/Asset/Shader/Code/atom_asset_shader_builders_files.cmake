@@ -23,6 +23,8 @@ set(FILES
     Source/Editor/AzslCompiler.h
     Source/Editor/ShaderVariantAssetBuilder.cpp
     Source/Editor/ShaderVariantAssetBuilder.h
+    Source/Editor/ShaderStageCompileCache.cpp
+    Source/Editor/ShaderStageCompileCache.h
     Source/Editor/PrecompiledShaderBuilder.cpp
     Source/Editor/PrecompiledShaderBuilder.h
     Source/Editor/SrgLayoutUtility.cpp
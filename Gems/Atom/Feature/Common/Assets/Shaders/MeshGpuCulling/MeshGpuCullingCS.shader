@@ -0,0 +1,14 @@
+{
+    "Source": "MeshGpuCullingCS.azsl",
+
+    "ProgramSettings":
+    {
+      "EntryPoints":
+      [
+        {
+          "name": "MainCS",
+          "type": "Compute"
+        }
+      ]
+    }
+}
@@ -149,6 +149,7 @@ set(FILES
     Passes/LutGeneration.pass
     Passes/MainPipeline.pass
     Passes/MainPipelineRenderToTexture.pass
+    Passes/MeshGpuCulling.pass
     Passes/MeshMotionVector.pass
     Passes/ModulateTexture.pass
     Passes/MorphTarget.pass
@@ -240,6 +241,7 @@ set(FILES
     ShaderLib/Atom/Features/IndirectRendering.azsli
     ShaderLib/Atom/Features/InstancedTransforms.azsli
     ShaderLib/Atom/Features/MatrixUtility.azsli
+    ShaderLib/Atom/Features/ObjectInstanceParameters.azsli
     ShaderLib/Atom/Features/ParallaxMapping.azsli
     ShaderLib/Atom/Features/ShaderQualityOptions.azsli
     ShaderLib/Atom/Features/SphericalHarmonicsUtility.azsli
@@ -445,6 +447,8 @@ set(FILES
     Shaders/Materials/StandardPBR/StandardPBR_PixelGeometryEval.azsli
     Shaders/Materials/StandardPBR/StandardPBR_SurfaceData.azsli
     Shaders/Materials/StandardPBR/StandardPBR_SurfaceEval.azsli
+    Shaders/MeshGpuCulling/MeshGpuCullingCS.azsl
+    Shaders/MeshGpuCulling/MeshGpuCullingCS.shader
     Shaders/MorphTargets/MorphTargetCS.azsl
     Shaders/MorphTargets/MorphTargetCS.shader
     Shaders/MorphTargets/MorphTargetSRG.azsli
@@ -67,6 +67,15 @@ namespace AZ
             "Enable instanced draw calls in the MeshFeatureProcessor, but force one object per draw call. "
             "This is helpful for simulating the worst case scenario for instancing for profiling performance.");
 
+        AZ_CVAR(
+            bool,
+            r_meshGpuCullingEnabled,
+            false,
+            nullptr,
+            AZ::ConsoleFunctorFlags::Null,
+            "Cull instanced meshes on the GPU and draw them with indirect draw calls in the views of pipelines that contain a "
+            "MeshGpuCullingPass. Requires r_meshInstancingEnabled.");
+
         class ModelDataInstance;
 
         //! Mesh feature processor data types for customizing model materials
@@ -362,6 +362,10 @@ namespace AZ::Render
             // Flags indicating if the Blas objects in the sub-mesh list are already built
             RHI::MultiDevice::DeviceMask m_blasBuilt = RHI::MultiDevice::NoDevices;
             bool m_isSkinnedMesh = false;
+
+            // true if the BLAS fits in the build budget of the current frame, BLASes that aren't built and not scheduled
+            // are left out of the TLAS until a later frame
+            bool m_blasBuildScheduled = false;
         };
 
         using BlasInstanceMap = AZStd::unordered_map<AZ::Data::AssetId, MeshBlasInstance>;
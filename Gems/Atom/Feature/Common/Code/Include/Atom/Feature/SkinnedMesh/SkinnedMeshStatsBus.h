@@ -21,6 +21,8 @@ namespace AZ
             size_t dispatchItemCount = 0;
             size_t boneCount = 0;
             size_t vertexCount = 0;
+            //! Number of skinning dispatches skipped in the last frame by update throttling
+            size_t skippedDispatchItemCount = 0;
         };
 
         //! Ebus for getting stats about the usage of skinned meshes in the current scene
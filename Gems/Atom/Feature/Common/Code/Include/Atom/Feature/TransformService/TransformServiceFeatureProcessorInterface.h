@@ -8,8 +8,11 @@
 
 #pragma once
 
+#include <AzCore/Math/Color.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector2.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
 #include <Atom/RPI.Public/FeatureProcessor.h>
 
 namespace AZ
@@ -26,6 +29,16 @@ namespace AZ
 
             using ObjectId = RHI::Handle<uint32_t, TransformServiceFeatureProcessorInterface>;
 
+            //! Per-object shader parameters, stored next to the transforms and read by shaders with the object id.
+            //! Unlike material property overrides, objects that only differ by these parameters still share their material, so
+            //! their meshes can be drawn together by mesh instancing.
+            struct InstanceParameters
+            {
+                AZ::Color m_tint = AZ::Color::CreateOne();
+                AZ::Vector2 m_uvOffset = AZ::Vector2::CreateZero();
+                AZ::Vector4 m_custom = AZ::Vector4::CreateZero();
+            };
+
             //! Reserves an object ID that can later be sent transform updates
             virtual ObjectId ReserveObjectId() = 0;
             //! Releases an object ID to be used by others. The passed in handle is invalidated.
@@ -38,6 +51,11 @@ namespace AZ
             virtual AZ::Transform GetTransformForId(ObjectId) const = 0;
             //! Gets the non-uniform scale for a given id. Id must be one reserved earlier.
             virtual AZ::Vector3 GetNonUniformScaleForId(ObjectId id) const = 0;
+
+            //! Sets the shader parameters for a given id. Id must be one reserved earlier.
+            virtual void SetInstanceParametersForId(ObjectId id, const InstanceParameters& parameters) = 0;
+            //! Gets the shader parameters for a given id. Id must be one reserved earlier.
+            virtual InstanceParameters GetInstanceParametersForId(ObjectId id) const = 0;
         };
     }
 }
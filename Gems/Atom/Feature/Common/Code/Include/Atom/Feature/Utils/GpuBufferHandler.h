@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/std/limits.h>
 #include <AzCore/std/string/string.h>
 #include <Atom/RHI/DeviceBufferView.h>
 #include <Atom/RPI.Public/Buffer/Buffer.h>
@@ -42,6 +43,13 @@ namespace AZ
             bool UpdateBuffer(const AZStd::vector<T>& data);
             bool UpdateBuffer(const AZStd::unordered_map<int, const void*>& data, uint32_t elementCount);
 
+            // Marks an element as modified, so the next UpdateDirtyElements() call uploads it.
+            void MarkElementDirty(uint32_t elementIndex);
+            // Uploads only the elements marked dirty since the last upload, and updates the element count. The whole buffer
+            // is uploaded when it has to grow, since resizing discards its content. Does nothing if no element changed.
+            template <typename T>
+            bool UpdateDirtyElements(const AZStd::vector<T>& data);
+
             void UpdateSrg(RPI::ShaderResourceGroup* srg) const;
 
             bool IsValid() const;
@@ -53,12 +61,16 @@ namespace AZ
         private:
 
             bool UpdateBuffer(uint32_t elementCount, const void* data);
+            bool UpdateDirtyElements(uint32_t elementCount, const void* data);
 
             Data::Instance<RPI::Buffer> m_buffer;
             RHI::ShaderInputBufferIndex m_bufferIndex;
             RHI::ShaderInputConstantIndex m_elementCountIndex;
             uint32_t m_elementCount = 0;
             uint32_t m_elementSize = 0;
+            // Range of elements modified since the last upload, empty when m_dirtyBegin >= m_dirtyEnd.
+            uint32_t m_dirtyBegin = AZStd::numeric_limits<uint32_t>::max();
+            uint32_t m_dirtyEnd = 0;
         };
         template <typename T>
         bool GpuBufferHandler::UpdateBuffer(const T* data, uint32_t elementCount)
@@ -73,5 +85,12 @@ namespace AZ
             AZ_Assert(sizeof(T) == m_elementSize, "Size of templated type doesn't match the size this GpuBuffer was initialized with.");
             return UpdateBuffer(aznumeric_cast<uint32_t>(data.size()), data.data());
         }
+
+        template <typename T>
+        bool GpuBufferHandler::UpdateDirtyElements(const AZStd::vector<T>& data)
+        {
+            AZ_Assert(sizeof(T) == m_elementSize, "Size of templated type doesn't match the size this GpuBuffer was initialized with.");
+            return UpdateDirtyElements(aznumeric_cast<uint32_t>(data.size()), data.data());
+        }
     } // namespace Render
 } // namespace AZ
@@ -16,6 +16,7 @@
 #include <AzCore/Math/Matrix4x4.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
 
 namespace AZ
 {
@@ -33,6 +34,35 @@ namespace AZ
             {
                 return color.GetA8() == 0xFF;
             }
+
+            //! Threads are given consecutive recording indices the first time they draw a shape, so the recordings are
+            //! spread evenly instead of depending on how the thread ids hash.
+            size_t GetThreadRecordingIndex()
+            {
+                static AZStd::atomic<size_t> s_nextRecordingIndex{ 0 };
+                thread_local const size_t recordingIndex = s_nextRecordingIndex.fetch_add(1, AZStd::memory_order_relaxed);
+                return recordingIndex;
+            }
+
+            template<class Buffer>
+            void MergeRecordedBuffer(Buffer& destination, Buffer& recorded)
+            {
+                if (recorded.empty())
+                {
+                    return;
+                }
+
+                if (destination.empty())
+                {
+                    // swap so the recording keeps the capacity of the cleared buffer and nothing is reallocated in steady state
+                    destination.swap(recorded);
+                }
+                else
+                {
+                    destination.insert(destination.end(), recorded.begin(), recorded.end());
+                    recorded.clear();
+                }
+            }
         }
 
         const uint32_t VerticesPerPoint = 1;
@@ -758,6 +788,9 @@ namespace AZ
             // get a pointer to the buffer we have been filling
             AuxGeomBufferData* filledBufferData = &m_buffers[m_currentBufferIndex];
 
+            // gather the shapes and boxes the threads recorded since the last commit
+            MergeShapeRecordings(*filledBufferData);
+
             // switch the buffer for future requests to the other buffer
             m_currentBufferIndex = (m_currentBufferIndex + 1) % NumBuffers;
 
@@ -964,18 +997,17 @@ namespace AZ
         {
             AuxGeomDrawStyle drawStyle = ConvertRPIDrawStyle(style);
 
-            // grab a mutex lock for the rest of this function so that a commit cannot happen during it and
-            // other threads can't add geometry during it
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
-            AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
+            // only lock the recording of this thread, Commit locks it as well while merging it
+            ShapeRecording& recording = m_shapeRecordings[GetThreadRecordingIndex() % NumShapeRecordings];
+            AZStd::lock_guard<AZStd::mutex> lock(recording.m_lock);
 
             if (IsOpaque(shape.m_color))
             {
-                buffer.m_opaqueShapes[drawStyle].push_back(shape);
+                recording.m_opaqueShapes[drawStyle].push_back(shape);
             }
             else
             {
-                buffer.m_translucentShapes[drawStyle].push_back(shape);
+                recording.m_translucentShapes[drawStyle].push_back(shape);
             }
         }
 
@@ -983,18 +1015,34 @@ namespace AZ
         {
             AuxGeomDrawStyle drawStyle = ConvertRPIDrawStyle(style);
 
-            // grab a mutex lock for the rest of this function so that a commit cannot happen during it and
-            // other threads can't add geometry during it
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
-            AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
+            // only lock the recording of this thread, Commit locks it as well while merging it
+            ShapeRecording& recording = m_shapeRecordings[GetThreadRecordingIndex() % NumShapeRecordings];
+            AZStd::lock_guard<AZStd::mutex> lock(recording.m_lock);
 
             if (IsOpaque(box.m_color))
             {
-                buffer.m_opaqueBoxes[drawStyle].push_back(box);
+                recording.m_opaqueBoxes[drawStyle].push_back(box);
             }
             else
             {
-                buffer.m_translucentBoxes[drawStyle].push_back(box);
+                recording.m_translucentBoxes[drawStyle].push_back(box);
+            }
+        }
+
+        void AuxGeomDrawQueue::MergeShapeRecordings(AuxGeomBufferData& buffer)
+        {
+            AZ_PROFILE_SCOPE(AzRender, "AuxGeomDrawQueue: MergeShapeRecordings");
+            // no need for m_buffersWriteLock here, this function is only called from a function holding it
+            for (ShapeRecording& recording : m_shapeRecordings)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(recording.m_lock);
+                for (int drawStyle = 0; drawStyle < DrawStyle_Count; ++drawStyle)
+                {
+                    MergeRecordedBuffer(buffer.m_opaqueShapes[drawStyle], recording.m_opaqueShapes[drawStyle]);
+                    MergeRecordedBuffer(buffer.m_translucentShapes[drawStyle], recording.m_translucentShapes[drawStyle]);
+                    MergeRecordedBuffer(buffer.m_opaqueBoxes[drawStyle], recording.m_opaqueBoxes[drawStyle]);
+                    MergeRecordedBuffer(buffer.m_translucentBoxes[drawStyle], recording.m_translucentBoxes[drawStyle]);
+                }
             }
         }
 
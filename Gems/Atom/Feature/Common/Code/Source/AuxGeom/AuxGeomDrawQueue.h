@@ -12,6 +12,7 @@
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/parallel/mutex.h>
 
 #include <Atom/RPI.Public/Base.h>
 
@@ -125,6 +126,9 @@ namespace AZ
             void AddShape(DrawStyle style, const ShapeBufferEntry& shape);
             void AddBox(DrawStyle style, BoxBufferEntry& box);
 
+            //! Move the shapes and boxes recorded by all the threads into the given buffer
+            void MergeShapeRecordings(AuxGeomBufferData& buffer);
+
         private: // data
 
             // We just toggle back and forth between two buffers, one being filled while the other is being processed
@@ -135,6 +139,21 @@ namespace AZ
             float m_pointSize = 3.0f;
 
             AZStd::recursive_mutex m_buffersWriteLock;
+
+            //! The fixed shapes and boxes are by far the most common draws (e.g. physics or navigation debug draws) so they
+            //! aren't recorded under m_buffersWriteLock. Each thread records into its own ShapeRecording (threads share
+            //! one only past NumShapeRecordings threads), whose lock is uncontended except by Commit, which merges them.
+            struct ShapeRecording
+            {
+                AZStd::mutex m_lock;
+                ShapeBuffer m_opaqueShapes[DrawStyle_Count];
+                ShapeBuffer m_translucentShapes[DrawStyle_Count];
+                BoxBuffer m_opaqueBoxes[DrawStyle_Count];
+                BoxBuffer m_translucentBoxes[DrawStyle_Count];
+            };
+
+            static const size_t NumShapeRecordings = 16;
+            ShapeRecording m_shapeRecordings[NumShapeRecordings];
         };
 
     } // namespace Render
@@ -44,6 +44,7 @@
 #include <Debug/RayTracingDebugFeatureProcessor.h>
 #include <Debug/RenderDebugFeatureProcessor.h>
 #include <Mesh/MeshFeatureProcessor.h>
+#include <Mesh/MeshGpuCullingPass.h>
 #include <Silhouette/SilhouetteFeatureProcessor.h>
 #include <Silhouette/SilhouetteCompositePass.h>
 #include <PostProcess/PostProcessFeatureProcessor.h>
@@ -315,6 +316,9 @@ namespace AZ
             // Deferred Fog
             passSystem->AddPassCreator(Name("DeferredFogPass"), &DeferredFogPass::Create);
 
+            // Add mesh GPU culling pass
+            passSystem->AddPassCreator(Name("MeshGpuCullingPass"), &MeshGpuCullingPass::Create);
+
             // Add SilhouetteComposite pass
             passSystem->AddPassCreator(Name("SilhouetteCompositePass"), &SilhouetteCompositePass::Create);
 
@@ -8,6 +8,7 @@
 
 #include <Atom/RHI/DrawListTagRegistry.h>
 #include <Atom/RHI/RHISystemInterface.h>
+#include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
 #include <Atom/RPI.Reflect/Pass/RasterPassData.h>
 #include <CoreLights/CascadedShadowmapsPass.h>
@@ -96,6 +97,7 @@ namespace AZ
             if (rebuildPasses)
             {
                 m_flags.m_createChildren = true;
+                m_persistentShadowmapUninitialized = m_persistentShadowmapEnabled;
                 QueueForBuildAndInitialization();
             }
 
@@ -121,6 +123,58 @@ namespace AZ
             const uint32_t shadowmapWidth = static_cast<uint32_t>(m_atlas.GetBaseShadowmapSize());
             imageDescriptor.m_size = RHI::Size(shadowmapWidth, shadowmapWidth, 1);
             imageDescriptor.m_arraySize = m_atlas.GetArraySliceCount();
+
+            if (!m_persistentShadowmapEnabled)
+            {
+                m_persistentShadowmap = nullptr;
+                return;
+            }
+
+            if (!m_persistentShadowmap || m_persistentShadowmap->GetDescriptor().m_size != imageDescriptor.m_size ||
+                m_persistentShadowmap->GetDescriptor().m_arraySize != imageDescriptor.m_arraySize)
+            {
+                RHI::ImageDescriptor persistentDescriptor = imageDescriptor;
+                persistentDescriptor.m_bindFlags |= RHI::ImageBindFlags::Depth | RHI::ImageBindFlags::ShaderRead;
+                persistentDescriptor.m_sharedQueueMask = RHI::HardwareQueueClassMask::Graphics;
+
+                // The ImageViewDescriptor must be specified to make sure the frame graph compiler doesn't treat this as a transient image.
+                RHI::ImageViewDescriptor viewDescriptor = RHI::ImageViewDescriptor::Create(persistentDescriptor.m_format, 0, 0);
+                viewDescriptor.m_aspectFlags = RHI::ImageAspectFlags::Depth;
+
+                RPI::CreateAttachmentImageRequest createImageRequest;
+                createImageRequest.m_imagePool = RPI::ImageSystemInterface::Get()->GetSystemAttachmentPool().get();
+                createImageRequest.m_imageDescriptor = persistentDescriptor;
+                createImageRequest.m_imageName = AZStd::string::format("%s.PersistentShadowmap", GetPathName().GetCStr());
+                createImageRequest.m_imageViewDescriptor = &viewDescriptor;
+                m_persistentShadowmap = RPI::AttachmentImage::Create(createImageRequest);
+            }
+
+            if (m_persistentShadowmap)
+            {
+                attachment->m_lifetime = RHI::AttachmentLifetimeType::Imported;
+                attachment->m_path = m_persistentShadowmap->GetAttachmentId();
+                attachment->m_importedResource = m_persistentShadowmap;
+                binding.SetAttachment(attachment);
+            }
+        }
+
+        void CascadedShadowmapsPass::SetPersistentShadowmapEnabled(bool enabled)
+        {
+            if (m_persistentShadowmapEnabled != enabled)
+            {
+                m_persistentShadowmapEnabled = enabled;
+                m_persistentShadowmapUninitialized = enabled;
+                QueueForBuildAndInitialization();
+            }
+        }
+
+        void CascadedShadowmapsPass::SetCascadeUpdateMask(uint32_t cascadeMask)
+        {
+            m_persistentShadowmapUninitialized = false;
+            for (size_t childIndex = 0; childIndex < m_children.size(); ++childIndex)
+            {
+                m_children[childIndex]->SetEnabled((cascadeMask & (1u << childIndex)) != 0);
+            }
         }
 
         // View related ...
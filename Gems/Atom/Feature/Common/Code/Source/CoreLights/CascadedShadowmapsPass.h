@@ -8,6 +8,7 @@
 #pragma once
 
 #include <Atom/Feature/CoreLights/CoreLightsConstants.h>
+#include <Atom/RPI.Public/Image/AttachmentImage.h>
 #include <Atom/RPI.Public/Pass/ParentPass.h>
 #include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/fixed_vector.h>
@@ -44,6 +45,16 @@ namespace AZ
             //! This queues the image size and array size which will be updated in the beginning of the frame.
             void SetShadowmapSize(ShadowmapSize shadowmapSize, u16 numCascades);
 
+            //! Keeps the shadowmap in a persistent image instead of a transient one, so a cascade that isn't rendered in a frame
+            //! keeps its content from the last frame it was rendered.
+            void SetPersistentShadowmapEnabled(bool enabled);
+
+            //! Returns true when the persistent shadowmap will be recreated this frame, in which case every cascade needs to be rendered.
+            bool IsPersistentShadowmapUninitialized() const { return m_persistentShadowmapUninitialized; }
+
+            //! Only renders the cascades whose bit is set. Requires a persistent shadowmap for the other cascades to stay valid.
+            void SetCascadeUpdateMask(uint32_t cascadeMask);
+
         private:
             CascadedShadowmapsPass() = delete;
             explicit CascadedShadowmapsPass(const RPI::PassDescriptor& descriptor);
@@ -72,6 +83,10 @@ namespace AZ
 
             ShadowmapAtlas m_atlas;
             ShadowmapSize m_shadowmapSize = ShadowmapSize::None;
+
+            bool m_persistentShadowmapEnabled = false;
+            bool m_persistentShadowmapUninitialized = false;
+            Data::Instance<RPI::AttachmentImage> m_persistentShadowmap;
         };
     } // namespace Render
 } // namespace AZ
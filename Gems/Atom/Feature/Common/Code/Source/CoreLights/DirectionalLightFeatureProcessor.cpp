@@ -36,6 +36,32 @@ namespace AZ
         
         AZ_CVAR(int, r_directionalShadowFilteringMethod, -1, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Cvar to override directional shadow filtering mode. -1 = Default settings from Editor, 0 = None, 1 = Pcf, 2 = Esm, 3 = EsmPcf.");
         AZ_CVAR(int, r_directionalShadowFilteringSampleCountMode, -1, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Cvar to override directional shadow sample count mode. -1 = Default settings from Editor, 0 = PcfTap4, 1 = PcfTap9, 2 = PcfTap16");
+        AZ_CVAR(uint32_t, r_directionalShadowCascadeMaxUpdateInterval, 1, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+            "Maximum number of frames between two renders of a directional shadow cascade. Cascade N is rendered every 2^N frames up to "
+            "this interval, so 4 renders the cascades every 1, 2, 4 and 4 frames. 1 renders every cascade every frame. "
+            "Staggered cascades disable r_excludeItemsInSmallerShadowCascades, since neighbor cascades are no longer rendered together.");
+        AZ_CVAR(float, r_directionalShadowCascadeMotionTolerance, 0.05f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+            "Distance the bounds of a staggered directional shadow cascade can move, as a fraction of their size, before the cascade is "
+            "rendered ahead of its schedule.");
+
+        namespace
+        {
+            // Cascade 1 is rendered on even frames, and the less detailed cascades are spread over the odd frames.
+            uint32_t GetStaggeredCascadeMask(uint32_t frame, uint32_t cascadeCount, uint32_t maxUpdateInterval)
+            {
+                uint32_t cascadeMask = 0;
+                for (uint32_t cascadeIndex = 0; cascadeIndex < cascadeCount; ++cascadeIndex)
+                {
+                    const uint32_t updateInterval = AZStd::min(1u << cascadeIndex, maxUpdateInterval);
+                    const uint32_t frameOffset = cascadeIndex < 2 ? 0 : (cascadeIndex - 2) * 2 + 1;
+                    if (frame % updateInterval == frameOffset % updateInterval)
+                    {
+                        cascadeMask |= 1u << cascadeIndex;
+                    }
+                }
+                return cascadeMask;
+            }
+        }
 
         // --- Camera Configuration ---
 
@@ -268,12 +294,38 @@ namespace AZ
                     UpdateBorderDepthsForSegments(m_shadowingLightHandle);
                     property.m_borderDepthsForSegmentsNeedsUpdate = false;
                 }
-                if (property.m_shadowmapViewNeedsUpdate || m_previousExcludeCvarValue != r_excludeItemsInSmallerShadowCascades)
+
+                const uint32_t maxUpdateInterval = AZStd::max<uint32_t>(r_directionalShadowCascadeMaxUpdateInterval, 1);
+                const bool staggerCascades = maxUpdateInterval > 1 && cascadeCount > 1;
+                m_cascadeUpdateMask = staggerCascades ? GetStaggeredCascadeMask(m_cascadeUpdateFrame++, cascadeCount, maxUpdateInterval)
+                                                      : AZStd::numeric_limits<uint32_t>::max();
+                for (const auto& passIt : m_cascadedShadowmapsPasses)
+                {
+                    for (CascadedShadowmapsPass* pass : passIt.second)
+                    {
+                        pass->SetPersistentShadowmapEnabled(staggerCascades);
+                        if (pass->IsPersistentShadowmapUninitialized())
+                        {
+                            m_cascadeUpdateMask = AZStd::numeric_limits<uint32_t>::max();
+                        }
+                    }
+                }
+
+                const bool excludeItemsInSmallerCascades = r_excludeItemsInSmallerShadowCascades && !staggerCascades;
+                if (property.m_shadowmapViewNeedsUpdate || m_excludeItemsInSmallerCascades != excludeItemsInSmallerCascades)
                 {
-                    UpdateShadowmapViews(m_shadowingLightHandle);
+                    m_excludeItemsInSmallerCascades = excludeItemsInSmallerCascades;
+                    // Cascades that kept a stale view are updated on their next scheduled frame
+                    property.m_shadowmapViewNeedsUpdate = !UpdateShadowmapViews(m_shadowingLightHandle);
                     UpdateFilterParameters(m_shadowingLightHandle);
-                    property.m_shadowmapViewNeedsUpdate = false;
-                    m_previousExcludeCvarValue = r_excludeItemsInSmallerShadowCascades;
+                }
+
+                for (const auto& passIt : m_cascadedShadowmapsPasses)
+                {
+                    for (CascadedShadowmapsPass* pass : passIt.second)
+                    {
+                        pass->SetCascadeUpdateMask(m_cascadeUpdateMask);
+                    }
                 }
                 SetShadowParameterToShadowData(m_shadowingLightHandle);
             }
@@ -300,8 +352,15 @@ namespace AZ
                 const ShadowProperty& property = m_shadowProperties.GetData(m_shadowingLightHandle.GetIndex());
                 for (const auto& segmentIt : property.m_segments)
                 {
-                    for (const CascadeSegment& segment : segmentIt.second)
+                    for (uint16_t cascadeIndex = 0; cascadeIndex < segmentIt.second.size(); ++cascadeIndex)
                     {
+                        // The shadowmap passes of the other cascades are disabled this frame
+                        if ((m_cascadeUpdateMask & (1u << cascadeIndex)) == 0)
+                        {
+                            continue;
+                        }
+
+                        const CascadeSegment& segment = segmentIt.second[cascadeIndex];
                         RHI::DrawListMask drawListMask;
                         for (const RPI::RenderPipelineId& renderPipelineId : m_renderPipelineIdsForPersistentView.at(segmentIt.first))
                         {
@@ -1390,8 +1449,10 @@ namespace AZ
             orthoMax *= worldUnitsPerTexel;
         }
 
-        void DirectionalLightFeatureProcessor::UpdateShadowmapViews(LightHandle handle)
+        bool DirectionalLightFeatureProcessor::UpdateShadowmapViews(LightHandle handle)
         {
+            bool allViewsUpdated = true;
+            const float motionTolerance = r_directionalShadowCascadeMotionTolerance;
             ShadowProperty& property = m_shadowProperties.GetData(handle.GetIndex());
 
             const DirectionalLightData light = m_lightData.GetData(handle.GetIndex());
@@ -1422,17 +1483,35 @@ namespace AZ
 
                         SnapAabbToPixelIncrements(invShadowmapSize, snappedAabbMin, snappedAabbMax);
 
+                        CascadeSegment& segment = segmentIt.second[cascadeIndex];
+                        if ((m_cascadeUpdateMask & (1u << cascadeIndex)) == 0)
+                        {
+                            // Keep the view the cascade was last rendered with, unless it moved too far to cover the segment.
+                            const Vector3 tolerance = segment.m_viewAabb.GetExtents() * motionTolerance;
+                            const bool viewIsValid = segment.m_viewAabb.IsValid() && segment.m_viewLightDirection.IsClose(direction) &&
+                                (snappedAabbMin - segment.m_viewAabb.GetMin()).GetAbs().IsLessEqualThan(tolerance) &&
+                                (snappedAabbMax - segment.m_viewAabb.GetMax()).GetAbs().IsLessEqualThan(tolerance);
+                            if (viewIsValid)
+                            {
+                                // Items aren't excluded from staggered cascades, so the previous bounds aren't needed
+                                allViewsUpdated = false;
+                                continue;
+                            }
+                            m_cascadeUpdateMask |= 1u << cascadeIndex;
+                        }
+                        segment.m_viewAabb = Aabb::CreateFromMinMax(snappedAabbMin, snappedAabbMax);
+                        segment.m_viewLightDirection = direction;
+
                         Matrix4x4 viewToClipMatrix = Matrix4x4::CreateIdentity();
                         MakeOrthographicMatrixRH(
                             viewToClipMatrix, snappedAabbMin.GetElement(0), snappedAabbMax.GetElement(0), snappedAabbMin.GetElement(2),
                             snappedAabbMax.GetElement(2), cascadeNear, cascadeFar);
 
-                        CascadeSegment& segment = segmentIt.second[cascadeIndex];
                         segment.m_aabb = viewAabb;
                         segment.m_view->SetCameraTransform(lightTransform);
                         segment.m_view->SetViewToClipMatrix(viewToClipMatrix);
 
-                        if (cascadeIndex > 0 && r_excludeItemsInSmallerShadowCascades)
+                        if (cascadeIndex > 0 && m_excludeItemsInSmallerCascades)
                         {
                             // Build a matrix (which will be turned into a frustum during culling) to exclude items completely
                             // contained in the previous cascade.
@@ -1466,6 +1545,7 @@ namespace AZ
                     }
                 }
             }
+            return allViewsUpdated;
         }
 
         void DirectionalLightFeatureProcessor::UpdateViewsOfCascadeSegments()
@@ -19,6 +19,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/limits.h>
 
 namespace AZ
 {
@@ -136,6 +137,10 @@ namespace AZ
 
                 // Far depth of the segment, i.e., border to the next segment
                 float m_borderFarDepth;
+
+                // Snapped light space bounds and light direction the view was last set to
+                Aabb m_viewAabb = Aabb::CreateNull();
+                Vector3 m_viewLightDirection = Vector3::CreateZero();
             };
 
             struct ShadowProperty
@@ -320,8 +325,9 @@ namespace AZ
             //! This update the boundary of each segment.
             void UpdateBorderDepthsForSegments(LightHandle handle);
 
-            //! This updates the shadowmap view.
-            void UpdateShadowmapViews(LightHandle handle);
+            //! This updates the shadowmap views of the cascades in m_cascadeUpdateMask, and adds to the mask the cascades
+            //! whose previous view no longer covers their segment. Returns false if some cascades kept a stale view.
+            bool UpdateShadowmapViews(LightHandle handle);
 
             void UpdateViewsOfCascadeSegments();
             void SetFullscreenPassSettings();
@@ -404,7 +410,11 @@ namespace AZ
 
             bool m_lightBufferNeedsUpdate = false;
             bool m_shadowBufferNeedsUpdate = false;
-            bool m_previousExcludeCvarValue = false;
+            bool m_excludeItemsInSmallerCascades = false;
+
+            // Frame counter and cascades rendered this frame, see r_directionalShadowCascadeMaxUpdateInterval.
+            uint32_t m_cascadeUpdateFrame = 0;
+            uint32_t m_cascadeUpdateMask = AZStd::numeric_limits<uint32_t>::max();
             uint32_t m_shadowBufferNameIndex = 0;
             uint32_t m_shadowmapIndexTableBufferNameIndex = 0;
 
@@ -80,7 +80,7 @@ namespace AZ
             }
             else
             {
-                m_deviceBufferNeedsUpdate = true;
+                m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(id));
                 return LightHandle(id);
             }
         }
@@ -94,8 +94,10 @@ namespace AZ
                 {
                     m_shadowFeatureProcessor->ReleaseShadow(shadowId);
                 }
+                // The last light is moved into the slot of the removed one
+                const LightHandle::IndexType dataIndex = m_lightData.GetRawIndex(handle.GetIndex());
                 m_lightData.RemoveIndex(handle.GetIndex());
-                m_deviceBufferNeedsUpdate = true;
+                m_lightBufferHandler.MarkElementDirty(dataIndex);
                 handle.Reset();
                 return true;
             }
@@ -127,7 +129,7 @@ namespace AZ
                     m_shadowFeatureProcessor->SetShadowProperties(cloneShadow, originalDesc);
                 }
 
-                m_deviceBufferNeedsUpdate = true;
+                m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
             }
             return handle;
         }
@@ -137,11 +139,7 @@ namespace AZ
             AZ_PROFILE_SCOPE(RPI, "DiskLightFeatureProcessor: Simulate");
             AZ_UNUSED(packet);
 
-            if (m_deviceBufferNeedsUpdate)
-            {
-                m_lightBufferHandler.UpdateBuffer(m_lightData.GetDataVector<0>());
-                m_deviceBufferNeedsUpdate = false;
-            }
+            m_lightBufferHandler.UpdateDirtyElements(m_lightData.GetDataVector<0>());
 
             if (r_enablePerMeshShaderOptionFlags)
             {
@@ -192,7 +190,7 @@ namespace AZ
             rgbIntensity[1] = transformedColor.GetG();
             rgbIntensity[2] = transformedColor.GetB();
 
-            m_deviceBufferNeedsUpdate = true;
+            m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
         }
 
         void DiskLightFeatureProcessor::SetPosition(LightHandle handle, const AZ::Vector3& lightPosition)
@@ -205,7 +203,7 @@ namespace AZ
             UpdateBounds(handle);
             UpdateShadow(handle);
 
-            m_deviceBufferNeedsUpdate = true;
+            m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
         }
 
         void DiskLightFeatureProcessor::SetDirection(LightHandle handle, const AZ::Vector3& lightDirection)
@@ -218,7 +216,7 @@ namespace AZ
             UpdateBounds(handle);
             UpdateShadow(handle);
 
-            m_deviceBufferNeedsUpdate = true;
+            m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
         }
 
         void DiskLightFeatureProcessor::SetAttenuationRadius(LightHandle handle, float attenuationRadius)
@@ -239,7 +237,7 @@ namespace AZ
                     light.m_bulbPositionOffset, attenuationRadius + light.m_bulbPositionOffset);
             }
 
-            m_deviceBufferNeedsUpdate = true;
+            m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
 
         }
 
@@ -254,7 +252,7 @@ namespace AZ
             UpdateBounds(handle);
             UpdateShadow(handle);
 
-            m_deviceBufferNeedsUpdate = true;
+            m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
         }
 
         void DiskLightFeatureProcessor::SetConstrainToConeLight(LightHandle handle, bool useCone)
@@ -265,7 +263,7 @@ namespace AZ
             useCone ? flags |= DiskLightData::Flags::UseConeAngle : flags &= ~DiskLightData::Flags::UseConeAngle;
             UpdateShadow(handle);
 
-            m_deviceBufferNeedsUpdate = true;
+            m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
         }
         
         void DiskLightFeatureProcessor::SetConeAngles(LightHandle handle, float innerRadians, float outerRadians)
@@ -275,7 +273,7 @@ namespace AZ
             ValidateAndSetConeAngles(handle, innerRadians, outerRadians);
             UpdateShadow(handle);
 
-            m_deviceBufferNeedsUpdate = true;
+            m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
         }
         
         void DiskLightFeatureProcessor::ValidateAndSetConeAngles(LightHandle handle, float innerRadians, float outerRadians)
@@ -296,7 +294,7 @@ namespace AZ
             UpdateShadow(handle);
             UpdateBounds(handle);
 
-            m_deviceBufferNeedsUpdate = true;
+            m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
         }
 
         const DiskLightData&  DiskLightFeatureProcessor::GetDiskData(LightHandle handle) const
@@ -326,7 +324,7 @@ namespace AZ
                 m_shadowFeatureProcessor->ReleaseShadow(shadowId);
                 shadowId.Reset();
                 light.m_shadowIndex = shadowId.GetIndex();
-                m_deviceBufferNeedsUpdate = true;
+                m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
             }
             else if(shadowId.IsNull() && enabled == true)
             {
@@ -338,7 +336,7 @@ namespace AZ
                 ValidateAndSetConeAngles(handle, acosf(light.m_cosInnerConeAngle), acosf(light.m_cosOuterConeAngle));
 
                 UpdateShadow(handle);
-                m_deviceBufferNeedsUpdate = true;
+                m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
             }
         }
 
@@ -397,7 +395,7 @@ namespace AZ
             AZ_Assert(handle.IsValid(), "Invalid LightHandle passed to DiskLightFeatureProcessor::SetAffectsGI().");
 
             m_lightData.GetData<0>(handle.GetIndex()).m_affectsGI = affectsGI;
-            m_deviceBufferNeedsUpdate = true;
+            m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
         }
 
         void DiskLightFeatureProcessor::SetAffectsGIFactor(LightHandle handle, float affectsGIFactor)
@@ -405,7 +403,7 @@ namespace AZ
             AZ_Assert(handle.IsValid(), "Invalid LightHandle passed to DiskLightFeatureProcessor::SetAffectsGIFactor().");
 
             m_lightData.GetData<0>(handle.GetIndex()).m_affectsGIFactor = affectsGIFactor;
-            m_deviceBufferNeedsUpdate = true;
+            m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
         }
 
         void DiskLightFeatureProcessor::SetLightingChannelMask(LightHandle handle, uint32_t lightingChannelMask)
@@ -413,7 +411,7 @@ namespace AZ
             AZ_Assert(handle.IsValid(), "Invalid LightHandle passed to DiskLightFeatureProcessor::SetLightingChannelMask().");
 
             m_lightData.GetData<0>(handle.GetIndex()).m_lightingChannelMask = lightingChannelMask;
-            m_deviceBufferNeedsUpdate = true;
+            m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
         }
 
         void DiskLightFeatureProcessor::UpdateShadow(LightHandle handle)
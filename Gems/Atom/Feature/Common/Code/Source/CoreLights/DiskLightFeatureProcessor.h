@@ -92,8 +92,6 @@ namespace AZ
             GpuBufferHandler m_lightBufferHandler;
             RHI::Handle<uint32_t> m_lightMeshFlag;
             RHI::Handle<uint32_t> m_shadowMeshFlag;
-
-            bool m_deviceBufferNeedsUpdate = false;
         };
     } // namespace Render
 } // namespace AZ
@@ -85,7 +85,7 @@ namespace AZ
             }
             else
             {
-                m_deviceBufferNeedsUpdate = true;
+                m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(id));
                 return LightHandle(id);
             }
         }
@@ -103,8 +103,10 @@ namespace AZ
                     }
                 }
 
+                // The last light is moved into the slot of the removed one
+                const LightHandle::IndexType dataIndex = m_lightData.GetRawIndex(handle.GetIndex());
                 m_lightData.RemoveIndex(handle.GetIndex());
-                m_deviceBufferNeedsUpdate = true;
+                m_lightBufferHandler.MarkElementDirty(dataIndex);
                 handle.Reset();
                 return true;
             }
@@ -136,7 +138,7 @@ namespace AZ
                     }
                 }
 
-                m_deviceBufferNeedsUpdate = true;
+                m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
             }
             return handle;
         }
@@ -146,11 +148,7 @@ namespace AZ
             AZ_PROFILE_SCOPE(RPI, "PointLightFeatureProcessor: Simulate");
             AZ_UNUSED(packet);
 
-            if (m_deviceBufferNeedsUpdate)
-            {
-                m_lightBufferHandler.UpdateBuffer(m_lightData.GetDataVector<0>());
-                m_deviceBufferNeedsUpdate = false;
-            }
+            m_lightBufferHandler.UpdateDirtyElements(m_lightData.GetDataVector<0>());
 
             if (r_enablePerMeshShaderOptionFlags)
             {
@@ -195,7 +193,7 @@ namespace AZ
             rgbIntensity[1] = transformedColor.GetG();
             rgbIntensity[2] = transformedColor.GetB();
 
-            m_deviceBufferNeedsUpdate = true;
+            m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
         }
 
         void PointLightFeatureProcessor::SetPosition(LightHandle handle, const AZ::Vector3& lightPosition)
@@ -207,7 +205,7 @@ namespace AZ
 
             m_lightData.GetData<1>(handle.GetIndex()).SetCenter(lightPosition);
 
-            m_deviceBufferNeedsUpdate = true;
+            m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
             UpdateShadow(handle);
         }
 
@@ -219,7 +217,7 @@ namespace AZ
             m_lightData.GetData<0>(handle.GetIndex()).m_invAttenuationRadiusSquared = 1.0f / (attenuationRadius * attenuationRadius);
             m_lightData.GetData<1>(handle.GetIndex()).SetRadius(attenuationRadius);
 
-            m_deviceBufferNeedsUpdate = true;
+            m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
         }
 
         void PointLightFeatureProcessor::SetBulbRadius(LightHandle handle, float bulbRadius)
@@ -227,7 +225,7 @@ namespace AZ
             AZ_Assert(handle.IsValid(), "Invalid LightHandle passed to PointLightFeatureProcessor::SetBulbRadius().");
 
             m_lightData.GetData<0>(handle.GetIndex()).m_bulbRadius = bulbRadius;
-            m_deviceBufferNeedsUpdate = true;
+            m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
         }
 
         const Data::Instance<RPI::Buffer> PointLightFeatureProcessor::GetLightBuffer() const
@@ -252,7 +250,7 @@ namespace AZ
                     m_shadowFeatureProcessor->ReleaseShadow(shadowId);
                     shadowId.Reset();
                     light.m_shadowIndices[i] = shadowId.GetIndex();
-                    m_deviceBufferNeedsUpdate = true;
+                    m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
                 }
                 else if (shadowId.IsNull() && enabled)
                 {
@@ -260,7 +258,7 @@ namespace AZ
                     light.m_shadowIndices[i] = m_shadowFeatureProcessor->AcquireShadow().GetIndex();
 
                     UpdateShadow(handle);
-                    m_deviceBufferNeedsUpdate = true;
+                    m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
                 }
             }
         }
@@ -274,7 +272,7 @@ namespace AZ
             AZ::Vector3 position = AZ::Vector3::CreateFromFloat3(data.m_position.data());
             float radius = LightCommon::GetRadiusFromInvRadiusSquared(data.m_invAttenuationRadiusSquared);
             m_lightData.GetData<1>(handle.GetIndex()).Set(AZ::Sphere(position, radius));
-            m_deviceBufferNeedsUpdate = true;
+            m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
             UpdateShadow(handle);
         }
 
@@ -346,7 +344,7 @@ namespace AZ
             AZ_Assert(handle.IsValid(), "Invalid LightHandle passed to PointLightFeatureProcessor::SetAffectsGI().");
 
             m_lightData.GetData<0>(handle.GetIndex()).m_affectsGI = affectsGI;
-            m_deviceBufferNeedsUpdate = true;
+            m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
         }
 
         void PointLightFeatureProcessor::SetAffectsGIFactor(LightHandle handle, float affectsGIFactor)
@@ -354,7 +352,7 @@ namespace AZ
             AZ_Assert(handle.IsValid(), "Invalid LightHandle passed to PointLightFeatureProcessor::SetAffectsGIFactor().");
 
             m_lightData.GetData<0>(handle.GetIndex()).m_affectsGIFactor = affectsGIFactor;
-            m_deviceBufferNeedsUpdate = true;
+            m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
         }
 
         void PointLightFeatureProcessor::SetLightingChannelMask(LightHandle handle, uint32_t lightingChannelMask)
@@ -362,7 +360,7 @@ namespace AZ
             AZ_Assert(handle.IsValid(), "Invalid LightHandle passed to PointLightFeatureProcessor::SetLightingChannelMask().");
 
             m_lightData.GetData<0>(handle.GetIndex()).m_lightingChannelMask = lightingChannelMask;
-            m_deviceBufferNeedsUpdate = true;
+            m_lightBufferHandler.MarkElementDirty(m_lightData.GetRawIndex(handle.GetIndex()));
         }
 
         void PointLightFeatureProcessor::SetShadowmapMaxResolution(LightHandle handle, ShadowmapSize shadowmapSize)
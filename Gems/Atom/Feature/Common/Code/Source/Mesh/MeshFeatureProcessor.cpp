@@ -16,9 +16,12 @@
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RHI/RHIUtils.h>
 #include <Atom/RPI.Public/AssetQuality.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
 #include <Atom/RPI.Public/Culling.h>
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/Model/ModelTagSystemComponent.h>
+#include <Atom/RPI.Public/Pass/PassFilter.h>
+#include <Atom/RPI.Public/Pass/PassSystemInterface.h>
 #include <Atom/RPI.Public/RPIUtils.h>
 #include <Atom/RPI.Public/Scene.h>
 
@@ -114,6 +117,31 @@ namespace AZ
             }
         }
 
+        // Uploads the data read by the MeshGpuCullingPass, creating or growing the buffer as needed
+        static void UpdateGpuCullingBuffer(
+            Data::Instance<RPI::Buffer>& buffer, const char* bufferName, const void* data, uint32_t elementSize, uint32_t elementCount)
+        {
+            const uint32_t byteCount = RHI::NextPowerOfTwo(AZStd::max(elementCount, 1u) * elementSize);
+            if (!buffer)
+            {
+                RPI::CommonBufferDescriptor desc;
+                desc.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
+                desc.m_bufferName = bufferName;
+                desc.m_byteCount = byteCount;
+                desc.m_elementSize = elementSize;
+                buffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+            }
+            else if (buffer->GetBufferSize() < elementCount * elementSize)
+            {
+                buffer->Resize(byteCount);
+            }
+
+            if (buffer && elementCount > 0)
+            {
+                buffer->UpdateData(data, elementCount * elementSize, 0);
+            }
+        }
+
         void MeshFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -175,7 +203,15 @@ namespace AZ
                     AZStd::string::format(
                         "r_meshInstancingBucketSortScatterBatchSize %zu", meshInstancingBucketSortScatterBatchSize)
                         .c_str());
+
+                console->GetCvarValue("r_meshGpuCullingEnabled", m_enableMeshGpuCulling);
+
+                // push the cvars value so anything in this dll can access it directly.
+                console->PerformCommand(
+                    AZStd::string::format("r_meshGpuCullingEnabled %s", m_enableMeshGpuCulling ? "true" : "false").c_str());
             }
+
+            UpdateGpuCullingPasses();
         }
 
         void MeshFeatureProcessor::Deactivate()
@@ -193,6 +229,18 @@ namespace AZ
             m_reflectionProbeFeatureProcessor = nullptr;
             m_forceRebuildDrawPackets = false;
 
+            for (const RPI::Ptr<MeshGpuCullingPass>& gpuCullingPass : m_gpuCullingPasses)
+            {
+                gpuCullingPass->SetFeatureProcessor(nullptr);
+            }
+            m_gpuCullingPasses.clear();
+            m_gpuCullingInstanceGroups.clear();
+            m_gpuCullingGroupInstanceOffsets.clear();
+            m_gpuCullingInstanceBounds.clear();
+            m_gpuCullingInstanceBoundsBuffer = nullptr;
+            m_gpuCullingGroupInstanceOffsetsBuffer = nullptr;
+            m_gpuCullingDataDirty = true;
+
             GetParentScene()->GetViewTagBitRegistry().ReleaseTag(m_meshMovedFlag);
             RHI::RHISystemInterface::Get()->GetDrawListTagRegistry()->ReleaseTag(m_meshMotionDrawListTag);
             RHI::RHISystemInterface::Get()->GetDrawListTagRegistry()->ReleaseTag(m_transparentDrawListTag);
@@ -256,6 +304,14 @@ namespace AZ
                 }
                 m_enableMeshInstancing = r_meshInstancingEnabled;
                 m_enableMeshInstancingForTransparentObjects = r_meshInstancingEnabledForTransparentObjects;
+                m_gpuCullingDataDirty = true;
+            }
+
+            if (m_enableMeshGpuCulling != r_meshGpuCullingEnabled)
+            {
+                // The instance data isn't kept up to date while GPU culling is disabled
+                m_enableMeshGpuCulling = r_meshGpuCullingEnabled;
+                m_gpuCullingDataDirty = true;
             }
         }
 
@@ -386,11 +442,13 @@ namespace AZ
                         if (meshDataIter->m_flags.m_cullableNeedsRebuild)
                         {
                             meshDataIter->BuildCullable();
+                            m_gpuCullingDataDirty = true;
                         }
 
                         if (meshDataIter->m_flags.m_cullBoundsNeedsUpdate)
                         {
                             meshDataIter->UpdateCullBounds(this);
+                            m_gpuCullingDataDirty = true;
                         }
                     }
                 };
@@ -473,6 +531,18 @@ namespace AZ
                 // If necessary, allocate memory up front for the work that needs to be done this frame
                 ResizePerViewInstanceVectors(packet.m_views.size());
 
+                // Views that belong to a pipeline with a MeshGpuCullingPass draw the instance groups indirectly,
+                // so they skip the bucket sort and the instance buffer upload below
+                AZStd::vector<MeshGpuCullingPass*> gpuCullingPassesByView(packet.m_views.size(), nullptr);
+                if (IsMeshGpuCullingEnabled() && !m_gpuCullingPasses.empty())
+                {
+                    UpdateGpuCullingInstanceData();
+                    for (size_t viewIndex = 0; viewIndex < packet.m_views.size(); ++viewIndex)
+                    {
+                        gpuCullingPassesByView[viewIndex] = FindGpuCullingPass(packet.m_views[viewIndex]);
+                    }
+                }
+
                 {
                     // Iterate over all of the visible objects for each view, and perform the first stage of the bucket sort
                     // where each visible object is sorted into its bucket
@@ -481,7 +551,10 @@ namespace AZ
                     AZ::TaskGraph addVisibleObjectsToBucketsTG{ "AddVisibleObjectsToBuckets" };
                     for (size_t viewIndex = 0; viewIndex < packet.m_views.size(); ++viewIndex)
                     {
-                        AddVisibleObjectsToBuckets(addVisibleObjectsToBucketsTG, viewIndex, packet.m_views[viewIndex]);
+                        if (!gpuCullingPassesByView[viewIndex])
+                        {
+                            AddVisibleObjectsToBuckets(addVisibleObjectsToBucketsTG, viewIndex, packet.m_views[viewIndex]);
+                        }
                     }
 
                     addVisibleObjectsToBucketsTG.Submit(&addVisibleObjectsToBucketsTGEvent);
@@ -495,7 +568,10 @@ namespace AZ
                     AZ::TaskGraph sortInstanceBufferBucketsTG{ "SortInstanceBufferBuckets" };
                     for (size_t viewIndex = 0; viewIndex < packet.m_views.size(); ++viewIndex)
                     {
-                        SortInstanceBufferBuckets(sortInstanceBufferBucketsTG, viewIndex);
+                        if (!gpuCullingPassesByView[viewIndex])
+                        {
+                            SortInstanceBufferBuckets(sortInstanceBufferBucketsTG, viewIndex);
+                        }
                     }
 
                     // submit the tasks
@@ -511,7 +587,10 @@ namespace AZ
                     AZ::TaskGraph buildInstanceBufferTG{ "BuildInstanceBuffer" };
                     for (size_t viewIndex = 0; viewIndex < packet.m_views.size(); ++viewIndex)
                     {
-                        BuildInstanceBufferAndDrawCalls(buildInstanceBufferTG, viewIndex, packet.m_views[viewIndex]);
+                        if (!gpuCullingPassesByView[viewIndex])
+                        {
+                            BuildInstanceBufferAndDrawCalls(buildInstanceBufferTG, viewIndex, packet.m_views[viewIndex]);
+                        }
                     }
 
                     // submit the tasks
@@ -521,8 +600,16 @@ namespace AZ
 
                 for (size_t viewIndex = 0; viewIndex < packet.m_views.size(); ++viewIndex)
                 {
-                    // Now that the per-view instance buffers are up to date on the CPU, update them on the GPU
-                    UpdateGPUInstanceBufferForView(viewIndex, packet.m_views[viewIndex]);
+                    if (gpuCullingPassesByView[viewIndex])
+                    {
+                        // The culling pass fills the instance buffer of the view on the GPU
+                        gpuCullingPassesByView[viewIndex]->AddIndirectDrawPacketsToView(packet.m_views[viewIndex]);
+                    }
+                    else
+                    {
+                        // Now that the per-view instance buffers are up to date on the CPU, update them on the GPU
+                        UpdateGPUInstanceBufferForView(viewIndex, packet.m_views[viewIndex]);
+                    }
                 }
             }
         }
@@ -869,6 +956,143 @@ namespace AZ
             instanceDataBufferHandler.UpdateBuffer(perViewInstanceData.data(), static_cast<uint32_t>(perViewInstanceData.size()));
         }
 
+        void MeshFeatureProcessor::UpdateGpuCullingPasses()
+        {
+            for (const RPI::Ptr<MeshGpuCullingPass>& gpuCullingPass : m_gpuCullingPasses)
+            {
+                gpuCullingPass->SetFeatureProcessor(nullptr);
+            }
+            m_gpuCullingPasses.clear();
+
+            RPI::PassFilter passFilter =
+                RPI::PassFilter::CreateWithTemplateName(MeshGpuCullingPass::GetMeshGpuCullingTemplateName(), GetParentScene());
+            RPI::PassSystemInterface::Get()->ForEachPass(
+                passFilter,
+                [this](RPI::Pass* pass) -> RPI::PassFilterExecutionFlow
+                {
+                    MeshGpuCullingPass* gpuCullingPass = azrtti_cast<MeshGpuCullingPass*>(pass);
+                    if (gpuCullingPass)
+                    {
+                        gpuCullingPass->SetFeatureProcessor(this);
+                        m_gpuCullingPasses.emplace_back(gpuCullingPass);
+                    }
+                    return RPI::PassFilterExecutionFlow::ContinueVisitingPasses;
+                });
+        }
+
+        MeshGpuCullingPass* MeshFeatureProcessor::FindGpuCullingPass(const RPI::ViewPtr& view) const
+        {
+            for (const RPI::Ptr<MeshGpuCullingPass>& gpuCullingPass : m_gpuCullingPasses)
+            {
+                if (gpuCullingPass->IsEnabled() && gpuCullingPass->GetView() == view)
+                {
+                    return gpuCullingPass.get();
+                }
+            }
+            return nullptr;
+        }
+
+        void MeshFeatureProcessor::UpdateGpuCullingInstanceData()
+        {
+            if (!m_gpuCullingDataDirty.exchange(false))
+            {
+                return;
+            }
+
+            AZ_PROFILE_SCOPE(RPI, "MeshFeatureProcessor: UpdateGpuCullingInstanceData");
+
+            // Count the instances of each group. Only the first selectable lod of each mesh is culled on the GPU.
+            const auto instanceManagerRanges = m_meshInstanceManager.GetParallelRanges();
+            for (const auto& iteratorRange : instanceManagerRanges)
+            {
+                for (auto instanceGroupDataIter = iteratorRange.m_begin; instanceGroupDataIter != iteratorRange.m_end;
+                     ++instanceGroupDataIter)
+                {
+                    instanceGroupDataIter->m_gpuCullingInstanceCount = 0;
+                }
+            }
+
+            const auto modelDataRanges = m_modelData.GetParallelRanges();
+            for (const auto& iteratorRange : modelDataRanges)
+            {
+                for (auto meshDataIter = iteratorRange.m_begin; meshDataIter != iteratorRange.m_end; ++meshDataIter)
+                {
+                    if (!meshDataIter->m_flags.m_visible || meshDataIter->m_flags.m_needsInit ||
+                        meshDataIter->m_postCullingInstanceDataByLod.empty())
+                    {
+                        continue;
+                    }
+
+                    const size_t lodIndex = AZStd::min<size_t>(meshDataIter->m_lodBias, meshDataIter->m_postCullingInstanceDataByLod.size() - 1);
+                    for (const ModelDataInstance::PostCullingInstanceData& postCullingData :
+                         meshDataIter->m_postCullingInstanceDataByLod[lodIndex])
+                    {
+                        postCullingData.m_instanceGroupHandle->m_gpuCullingInstanceCount++;
+                    }
+                }
+            }
+
+            // Assign a dense index and an instance data offset to every group that has instances
+            m_gpuCullingInstanceGroups.clear();
+            m_gpuCullingGroupInstanceOffsets.clear();
+            uint32_t instanceCount = 0;
+            for (const auto& iteratorRange : instanceManagerRanges)
+            {
+                for (auto instanceGroupDataIter = iteratorRange.m_begin; instanceGroupDataIter != iteratorRange.m_end;
+                     ++instanceGroupDataIter)
+                {
+                    MeshInstanceGroupData& instanceGroup = *instanceGroupDataIter;
+                    if (instanceGroup.m_gpuCullingInstanceCount > 0)
+                    {
+                        instanceGroup.m_gpuCullingGroupIndex = aznumeric_cast<uint32_t>(m_gpuCullingInstanceGroups.size());
+                        m_gpuCullingInstanceGroups.push_back(&instanceGroup);
+                        m_gpuCullingGroupInstanceOffsets.push_back(instanceCount);
+                        instanceCount += instanceGroup.m_gpuCullingInstanceCount;
+                    }
+                }
+            }
+
+            // Fill the world space bounds of every instance
+            m_gpuCullingInstanceBounds.clear();
+            m_gpuCullingInstanceBounds.reserve(instanceCount);
+            for (const auto& iteratorRange : modelDataRanges)
+            {
+                for (auto meshDataIter = iteratorRange.m_begin; meshDataIter != iteratorRange.m_end; ++meshDataIter)
+                {
+                    if (!meshDataIter->m_flags.m_visible || meshDataIter->m_flags.m_needsInit ||
+                        meshDataIter->m_postCullingInstanceDataByLod.empty())
+                    {
+                        continue;
+                    }
+
+                    const Aabb& worldAabb = meshDataIter->m_cullable.m_cullData.m_visibilityEntry.m_boundingVolume;
+                    const Vector3 center = worldAabb.GetCenter();
+                    // Halve before subtracting so unbounded meshes don't overflow, as ShapeIntersection::Overlaps does
+                    const Vector3 extents = (0.5f * worldAabb.GetMax()) - (0.5f * worldAabb.GetMin());
+
+                    const size_t lodIndex = AZStd::min<size_t>(meshDataIter->m_lodBias, meshDataIter->m_postCullingInstanceDataByLod.size() - 1);
+                    for (const ModelDataInstance::PostCullingInstanceData& postCullingData :
+                         meshDataIter->m_postCullingInstanceDataByLod[lodIndex])
+                    {
+                        GpuCullingInstanceBounds& bounds = m_gpuCullingInstanceBounds.emplace_back();
+                        center.StoreToFloat3(bounds.m_center);
+                        extents.StoreToFloat3(bounds.m_extents);
+                        bounds.m_objectId = postCullingData.m_objectId.GetIndex();
+                        bounds.m_groupIndex = postCullingData.m_instanceGroupHandle->m_gpuCullingGroupIndex;
+                    }
+                }
+            }
+
+            UpdateGpuCullingBuffer(
+                m_gpuCullingInstanceBoundsBuffer, "MeshGpuCullingInstanceBounds", m_gpuCullingInstanceBounds.data(),
+                sizeof(GpuCullingInstanceBounds), aznumeric_cast<uint32_t>(m_gpuCullingInstanceBounds.size()));
+            UpdateGpuCullingBuffer(
+                m_gpuCullingGroupInstanceOffsetsBuffer, "MeshGpuCullingGroupInstanceOffsets", m_gpuCullingGroupInstanceOffsets.data(),
+                sizeof(uint32_t), aznumeric_cast<uint32_t>(m_gpuCullingGroupInstanceOffsets.size()));
+
+            ++m_gpuCullingGeneration;
+        }
+
         void MeshFeatureProcessor::OnBeginPrepareRender()
         {
             m_meshDataChecker.soft_lock();
@@ -983,6 +1207,11 @@ namespace AZ
                 m_reportShaderOptionFlags = false;
                 PrintShaderOptionFlags();
             }
+            if (m_reportMeshInstancingStatistics)
+            {
+                m_reportMeshInstancingStatistics = false;
+                PrintMeshInstancingStatistics();
+            }
             for (auto& model : m_modelData)
             {
                 model.m_cullable.m_prevShaderOptionFlags = model.m_cullable.m_shaderOptionFlags.exchange(0);
@@ -1028,6 +1257,7 @@ namespace AZ
 
                 AZStd::concurrency_check_scope scopeCheck(m_meshDataChecker);
                 m_modelData.erase(meshHandle);
+                m_gpuCullingDataDirty = true;
 
                 return true;
             }
@@ -1404,6 +1634,7 @@ namespace AZ
             if (meshHandle.IsValid())
             {
                 meshHandle->SetVisible(visible);
+                m_gpuCullingDataDirty = true;
 
                 if (m_rayTracingFeatureProcessor && meshHandle->m_descriptor.m_isRayTracingEnabled)
                 {
@@ -1463,6 +1694,7 @@ namespace AZ
             [[maybe_unused]] RPI::SceneNotification::RenderPipelineChangeType changeType)
         {
             m_forceRebuildDrawPackets = true;
+            UpdateGpuCullingPasses();
         }
 
         void MeshFeatureProcessor::UpdateMeshReflectionProbes()
@@ -1493,6 +1725,11 @@ namespace AZ
             m_reportShaderOptionFlags = true;
         }
 
+        void MeshFeatureProcessor::ReportMeshInstancingStatistics([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+        {
+            m_reportMeshInstancingStatistics = true;
+        }
+
         RayTracingFeatureProcessor* MeshFeatureProcessor::GetRayTracingFeatureProcessor() const
         {
             return m_rayTracingFeatureProcessor;
@@ -1523,6 +1760,41 @@ namespace AZ
             return m_enableMeshInstancing;
         }
 
+        bool MeshFeatureProcessor::IsMeshGpuCullingEnabled() const
+        {
+            return m_enableMeshInstancing && m_enableMeshGpuCulling;
+        }
+
+        const AZStd::vector<MeshInstanceGroupData*>& MeshFeatureProcessor::GetGpuCullingInstanceGroups() const
+        {
+            return m_gpuCullingInstanceGroups;
+        }
+
+        const AZStd::vector<uint32_t>& MeshFeatureProcessor::GetGpuCullingGroupInstanceOffsets() const
+        {
+            return m_gpuCullingGroupInstanceOffsets;
+        }
+
+        const Data::Instance<RPI::Buffer>& MeshFeatureProcessor::GetGpuCullingInstanceBoundsBuffer() const
+        {
+            return m_gpuCullingInstanceBoundsBuffer;
+        }
+
+        const Data::Instance<RPI::Buffer>& MeshFeatureProcessor::GetGpuCullingGroupInstanceOffsetsBuffer() const
+        {
+            return m_gpuCullingGroupInstanceOffsetsBuffer;
+        }
+
+        uint32_t MeshFeatureProcessor::GetGpuCullingInstanceCount() const
+        {
+            return aznumeric_cast<uint32_t>(m_gpuCullingInstanceBounds.size());
+        }
+
+        uint32_t MeshFeatureProcessor::GetGpuCullingGeneration() const
+        {
+            return m_gpuCullingGeneration;
+        }
+
         void MeshFeatureProcessor::PrintShaderOptionFlags()
         {
             AZStd::map<FlagRegistry::TagType, AZ::Name> tags;
@@ -1572,6 +1844,29 @@ namespace AZ
             }
         }
 
+        void MeshFeatureProcessor::PrintMeshInstancingStatistics()
+        {
+            if (!r_meshInstancingEnabled)
+            {
+                AZ_Printf("MeshFeatureProcessor", "Mesh instancing is disabled, set r_meshInstancingEnabled to report its statistics.");
+                return;
+            }
+
+            const MeshInstanceManager::Statistics statistics = m_meshInstanceManager.GetStatistics();
+            AZ_Printf(
+                "MeshFeatureProcessor",
+                "%u mesh instances in %u instance groups, %u of them with a single instance.",
+                statistics.m_instanceCount,
+                statistics.m_groupCount,
+                statistics.m_singleInstanceGroupCount);
+            AZ_Printf(
+                "MeshFeatureProcessor",
+                "Groups split by: unsupported shaders %u, different materials %u, different sort keys %u.",
+                statistics.m_forcedUniqueGroupCount,
+                statistics.m_materialSplitCount,
+                statistics.m_sortKeySplitCount);
+        }
+
         // ModelDataInstance::MeshLoader...
         ModelDataInstance::MeshLoader::MeshLoader(const Data::Asset<RPI::ModelAsset>& modelAsset, ModelDataInstance* parent)
             : m_modelAsset(modelAsset)
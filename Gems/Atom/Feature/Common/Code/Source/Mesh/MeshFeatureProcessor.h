@@ -19,6 +19,7 @@
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Console/Console.h>
 #include <AzFramework/Asset/AssetCatalogBus.h>
+#include <Mesh/MeshGpuCullingPass.h>
 #include <Mesh/MeshInstanceManager.h>
 #include <RayTracing/RayTracingFeatureProcessor.h>
 #include <TransformService/TransformServiceFeatureProcessor.h>
@@ -204,6 +205,8 @@ namespace AZ
             AZ_RTTI(AZ::Render::MeshFeatureProcessor, "{6E3DFA1D-22C7-4738-A3AE-1E10AB88B29B}", AZ::Render::MeshFeatureProcessorInterface);
 
             AZ_CONSOLEFUNC(MeshFeatureProcessor, ReportShaderOptionFlags, AZ::ConsoleFunctorFlags::Null, "Report currently used shader option flags.");
+            AZ_CONSOLEFUNC(MeshFeatureProcessor, ReportMeshInstancingStatistics, AZ::ConsoleFunctorFlags::Null,
+                "Report the number of mesh instance groups and why meshes of the same model were split into separate groups.");
 
             using FlagRegistry = RHI::TagBitRegistry<RPI::Cullable::FlagType>;
 
@@ -276,6 +279,7 @@ namespace AZ
             void UpdateMeshReflectionProbes();
 
             void ReportShaderOptionFlags(const AZ::ConsoleCommandContainer& arguments);
+            void ReportMeshInstancingStatistics(const AZ::ConsoleCommandContainer& arguments);
 
             // Quick functions to get other relevant feature processors that have already been cached by the MeshFeatureProcessor
             // without needing to go through the RPI's list of feature processors
@@ -287,6 +291,16 @@ namespace AZ
 
             MeshInstanceManager& GetMeshInstanceManager();
             bool IsMeshInstancingEnabled() const;
+
+            // Data of the instances culled on the GPU by the MeshGpuCullingPass, see r_meshGpuCullingEnabled
+            bool IsMeshGpuCullingEnabled() const;
+            const AZStd::vector<MeshInstanceGroupData*>& GetGpuCullingInstanceGroups() const;
+            const AZStd::vector<uint32_t>& GetGpuCullingGroupInstanceOffsets() const;
+            const Data::Instance<RPI::Buffer>& GetGpuCullingInstanceBoundsBuffer() const;
+            const Data::Instance<RPI::Buffer>& GetGpuCullingGroupInstanceOffsetsBuffer() const;
+            uint32_t GetGpuCullingInstanceCount() const;
+            //! Incremented whenever the list of instance groups culled on the GPU is rebuilt
+            uint32_t GetGpuCullingGeneration() const;
         private:
             MeshFeatureProcessor(const MeshFeatureProcessor&) = delete;
 
@@ -298,6 +312,7 @@ namespace AZ
             );
 
             void PrintShaderOptionFlags();
+            void PrintMeshInstancingStatistics();
 
             // RPI::SceneNotificationBus::Handler overrides...
             void OnRenderPipelineChanged(AZ::RPI::RenderPipeline* pipeline, RPI::SceneNotification::RenderPipelineChangeType changeType) override;
@@ -316,6 +331,10 @@ namespace AZ
             void BuildInstanceBufferAndDrawCalls(TaskGraph& taskGraph, size_t viewIndex, const RPI::ViewPtr& view);
             void UpdateGPUInstanceBufferForView(size_t viewIndex, const RPI::ViewPtr& view);
 
+            void UpdateGpuCullingPasses();
+            MeshGpuCullingPass* FindGpuCullingPass(const RPI::ViewPtr& view) const;
+            void UpdateGpuCullingInstanceData();
+
             AZStd::concurrency_checker m_meshDataChecker;
             StableDynamicArray<ModelDataInstance> m_modelData;
 
@@ -362,6 +381,25 @@ namespace AZ
             AZStd::vector<AZStd::vector<InstanceGroupBucket>> m_perViewInstanceGroupBuckets;
             AZStd::vector<AZStd::vector<TransformServiceFeatureProcessorInterface::ObjectId>> m_perViewInstanceData;
             AZStd::vector<GpuBufferHandler> m_perViewInstanceDataBufferHandlers;
+
+            // World space bounds of an instance culled on the GPU. Matches MeshGpuCullingInstanceBounds in MeshGpuCullingCS.azsl
+            struct GpuCullingInstanceBounds
+            {
+                float m_center[3];
+                uint32_t m_objectId;
+                float m_extents[3];
+                uint32_t m_groupIndex;
+            };
+
+            AZStd::vector<RPI::Ptr<MeshGpuCullingPass>> m_gpuCullingPasses;
+            AZStd::vector<MeshInstanceGroupData*> m_gpuCullingInstanceGroups;
+            AZStd::vector<uint32_t> m_gpuCullingGroupInstanceOffsets;
+            AZStd::vector<GpuCullingInstanceBounds> m_gpuCullingInstanceBounds;
+            // Persistent buffers, only re-uploaded when meshes are added, removed or moved
+            Data::Instance<RPI::Buffer> m_gpuCullingInstanceBoundsBuffer;
+            Data::Instance<RPI::Buffer> m_gpuCullingGroupInstanceOffsetsBuffer;
+            uint32_t m_gpuCullingGeneration = 0;
+            AZStd::atomic_bool m_gpuCullingDataDirty{ true };
             
             TransformServiceFeatureProcessor* m_transformService = nullptr;
             RayTracingFeatureProcessor* m_rayTracingFeatureProcessor = nullptr;
@@ -374,9 +412,11 @@ namespace AZ
             RHI::DrawListTag m_transparentDrawListTag;
             bool m_forceRebuildDrawPackets = false;
             bool m_reportShaderOptionFlags = false;
+            bool m_reportMeshInstancingStatistics = false;
             bool m_enablePerMeshShaderOptionFlags = false;
             bool m_enableMeshInstancing = false;
             bool m_enableMeshInstancingForTransparentObjects = false;
+            bool m_enableMeshGpuCulling = false;
         };
     } // namespace Render
 } // namespace AZ
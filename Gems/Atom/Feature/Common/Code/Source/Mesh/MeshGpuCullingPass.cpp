@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/MeshGpuCullingPass.h>
+#include <Mesh/MeshFeatureProcessor.h>
+
+#include <Atom/RHI/CommandList.h>
+#include <Atom/RHI/DrawPacketBuilder.h>
+#include <Atom/RHI/RHIUtils.h>
+#include <Atom/RHI.Reflect/IndirectBufferLayout.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        // Minimum number of instance groups and instances the output buffers are created for
+        static constexpr uint32_t MinGroupCapacity = 64;
+        static constexpr uint32_t MinInstanceCapacity = 1024;
+
+        RPI::Ptr<MeshGpuCullingPass> MeshGpuCullingPass::Create(const RPI::PassDescriptor& descriptor)
+        {
+            RPI::Ptr<MeshGpuCullingPass> pass = aznew MeshGpuCullingPass(descriptor);
+            return pass;
+        }
+
+        MeshGpuCullingPass::MeshGpuCullingPass(const RPI::PassDescriptor& descriptor)
+            : RPI::ComputePass(descriptor)
+        {
+        }
+
+        void MeshGpuCullingPass::SetFeatureProcessor(MeshFeatureProcessor* meshFeatureProcessor)
+        {
+            m_meshFeatureProcessor = meshFeatureProcessor;
+        }
+
+        bool MeshGpuCullingPass::IsEnabled() const
+        {
+            return ComputePass::IsEnabled() && m_meshFeatureProcessor && m_meshFeatureProcessor->IsMeshGpuCullingEnabled();
+        }
+
+        void MeshGpuCullingPass::BuildInternal()
+        {
+            if (!m_indirectBufferSignature)
+            {
+                InitIndirectBufferSignature();
+            }
+
+            if (m_indirectBufferSignature)
+            {
+                EnsureOutputBufferCapacity(m_groupCapacity, m_instanceCapacity);
+            }
+            AttachBufferToSlot("IndirectArguments", m_indirectArgumentsBuffer);
+            AttachBufferToSlot("CulledInstanceData", m_culledInstanceDataBuffer);
+
+            ComputePass::BuildInternal();
+        }
+
+        void MeshGpuCullingPass::InitIndirectBufferSignature()
+        {
+            RHI::IndirectBufferLayout indirectBufferLayout;
+            indirectBufferLayout.AddIndirectCommand(RHI::IndirectCommandDescriptor(RHI::IndirectCommandType::DrawIndexed));
+
+            if (!indirectBufferLayout.Finalize())
+            {
+                AZ_Assert(false, "[MeshGpuCullingPass '%s']: Failed to finalize Indirect Layout", GetPathName().GetCStr());
+                return;
+            }
+
+            m_indirectBufferSignature = aznew RHI::IndirectBufferSignature;
+            RHI::IndirectBufferSignatureDescriptor signatureDescriptor{};
+            signatureDescriptor.m_layout = indirectBufferLayout;
+            [[maybe_unused]] auto result = m_indirectBufferSignature->Init(RHI::MultiDevice::AllDevices, signatureDescriptor);
+
+            AZ_Assert(
+                result == RHI::ResultCode::Success,
+                "[MeshGpuCullingPass '%s']: Failed to initialize Indirect Buffer Signature",
+                GetPathName().GetCStr());
+
+            m_indirectArgumentsByteStride = m_indirectBufferSignature->GetByteStride();
+        }
+
+        bool MeshGpuCullingPass::EnsureOutputBufferCapacity(uint32_t groupCount, uint32_t instanceCount)
+        {
+            if (m_indirectArgumentsBuffer && groupCount <= m_groupCapacity && instanceCount <= m_instanceCapacity)
+            {
+                return false;
+            }
+
+            m_groupCapacity = RHI::NextPowerOfTwo(AZStd::max(groupCount, MinGroupCapacity));
+            m_instanceCapacity = RHI::NextPowerOfTwo(AZStd::max(instanceCount, MinInstanceCapacity));
+
+            // The draws refer to the indirect buffer view of the old buffer
+            m_indirectDraws.clear();
+            if (m_indirectBufferWriter)
+            {
+                m_indirectBufferWriter->Shutdown();
+                m_indirectBufferWriter = nullptr;
+            }
+
+            const uint32_t indirectArgumentsByteCount = m_groupCapacity * m_indirectArgumentsByteStride;
+
+            RPI::CommonBufferDescriptor desc;
+            desc.m_poolType = RPI::CommonBufferPoolType::Indirect;
+            desc.m_bufferName = AZStd::string::format("%s_IndirectArguments", GetPathName().GetCStr());
+            desc.m_elementSize = sizeof(uint32_t);
+            desc.m_byteCount = indirectArgumentsByteCount;
+            m_indirectArgumentsBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+
+            desc.m_poolType = RPI::CommonBufferPoolType::ReadWrite;
+            desc.m_bufferName = AZStd::string::format("%s_CulledInstanceData", GetPathName().GetCStr());
+            desc.m_byteCount = m_instanceCapacity * sizeof(uint32_t);
+            m_culledInstanceDataBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+
+            if (m_indirectArgumentsBuffer && m_indirectBufferSignature)
+            {
+                m_indirectBufferView = RHI::IndirectBufferView(
+                    *m_indirectArgumentsBuffer->GetRHIBuffer(),
+                    *m_indirectBufferSignature,
+                    0,
+                    indirectArgumentsByteCount,
+                    m_indirectArgumentsByteStride);
+
+                m_indirectBufferWriter = aznew RHI::IndirectBufferWriter;
+                [[maybe_unused]] auto result = m_indirectBufferWriter->Init(
+                    *m_indirectArgumentsBuffer->GetRHIBuffer(), 0, m_indirectArgumentsByteStride, m_groupCapacity, *m_indirectBufferSignature);
+
+                AZ_Assert(
+                    result == RHI::ResultCode::Success,
+                    "[MeshGpuCullingPass '%s']: Failed to initialize Indirect Buffer Writer",
+                    GetPathName().GetCStr());
+            }
+
+            return true;
+        }
+
+        void MeshGpuCullingPass::AddIndirectDrawPacketsToView(const RPI::ViewPtr& view)
+        {
+            AZ_PROFILE_SCOPE(RPI, "MeshGpuCullingPass: AddIndirectDrawPacketsToView");
+
+            if (!m_meshFeatureProcessor || !m_indirectBufferSignature)
+            {
+                return;
+            }
+
+            const AZStd::vector<MeshInstanceGroupData*>& instanceGroups = m_meshFeatureProcessor->GetGpuCullingInstanceGroups();
+            const AZStd::vector<uint32_t>& groupInstanceOffsets = m_meshFeatureProcessor->GetGpuCullingGroupInstanceOffsets();
+            const uint32_t groupCount = aznumeric_cast<uint32_t>(instanceGroups.size());
+
+            if (EnsureOutputBufferCapacity(groupCount, m_meshFeatureProcessor->GetGpuCullingInstanceCount()))
+            {
+                // Attach the new buffers to the output slots. The pass system builds queued passes before the frame graph is built.
+                QueueForBuildAndInitialization();
+            }
+
+            if (!m_indirectBufferWriter)
+            {
+                return;
+            }
+
+            if (m_indirectDrawsGeneration != m_meshFeatureProcessor->GetGpuCullingGeneration() || m_indirectDraws.size() != groupCount)
+            {
+                m_indirectDraws.clear();
+                m_indirectDraws.resize(groupCount);
+                m_indirectDrawsGeneration = m_meshFeatureProcessor->GetGpuCullingGeneration();
+            }
+
+            const Frustum frustum = Frustum::CreateFromMatrixColumnMajor(view->GetWorldToClipMatrix());
+            for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                m_frustumPlanes[planeId] = frustum.GetPlane(planeId).GetPlaneEquationCoefficients();
+            }
+
+            for (uint32_t groupIndex = 0; groupIndex < groupCount; ++groupIndex)
+            {
+                MeshInstanceGroupData& instanceGroup = *instanceGroups[groupIndex];
+
+                // Reset the instance count of the group, the culling shader increments it for every visible instance
+                const RHI::DrawArguments& meshDrawArguments = instanceGroup.m_drawPacket.GetMesh().GetDrawArguments();
+                const RHI::DrawIndexed drawIndexed =
+                    meshDrawArguments.m_type == RHI::DrawType::Indexed ? meshDrawArguments.m_indexed : RHI::DrawIndexed{};
+                m_indirectBufferWriter->Seek(groupIndex);
+                m_indirectBufferWriter->DrawIndexed(drawIndexed, RHI::DrawInstanceArguments(0, 0));
+
+                const RHI::DrawPacket* sourceDrawPacket = instanceGroup.m_drawPacket.GetRHIDrawPacket();
+                if (!sourceDrawPacket || drawIndexed.m_indexCount == 0)
+                {
+                    continue;
+                }
+
+                IndirectDraw& indirectDraw = m_indirectDraws[groupIndex];
+                if (indirectDraw.m_sourceDrawPacket != sourceDrawPacket)
+                {
+                    RHI::DrawPacketBuilder drawPacketBuilder{ RHI::MultiDevice::AllDevices };
+                    indirectDraw.m_drawPacket = drawPacketBuilder.Clone(sourceDrawPacket);
+                    indirectDraw.m_geometryView = instanceGroup.m_drawPacket.GetMesh();
+                    indirectDraw.m_geometryView.SetDrawArguments(
+                        RHI::DrawIndirect(1, m_indirectBufferView, groupIndex * m_indirectArgumentsByteStride));
+                    for (size_t drawItemIndex = 0; drawItemIndex < indirectDraw.m_drawPacket->GetDrawItemCount(); ++drawItemIndex)
+                    {
+                        indirectDraw.m_drawPacket->GetDrawItem(drawItemIndex)->SetGeometryView(&indirectDraw.m_geometryView);
+                    }
+                    indirectDraw.m_sourceDrawPacket = sourceDrawPacket;
+                }
+
+                // The visible instances of the group are compacted from the group offset on
+                uint32_t instanceDataOffset = groupInstanceOffsets[groupIndex];
+                AZStd::span<uint8_t> data{ reinterpret_cast<uint8_t*>(&instanceDataOffset), sizeof(uint32_t) };
+                indirectDraw.m_drawPacket->SetRootConstant(instanceGroup.m_drawRootConstantOffset, data);
+
+                view->AddDrawPacket(indirectDraw.m_drawPacket.get());
+            }
+
+            m_indirectBufferWriter->Flush();
+
+            view->GetShaderResourceGroup()->SetBufferView(m_viewInstanceDataIndex, m_culledInstanceDataBuffer->GetBufferView());
+        }
+
+        void MeshGpuCullingPass::CompileResources(const RHI::FrameGraphCompileContext& context)
+        {
+            if (m_shaderResourceGroup && m_meshFeatureProcessor)
+            {
+                const uint32_t instanceCount = m_meshFeatureProcessor->GetGpuCullingInstanceCount();
+                if (const Data::Instance<RPI::Buffer>& instanceBounds = m_meshFeatureProcessor->GetGpuCullingInstanceBoundsBuffer())
+                {
+                    m_shaderResourceGroup->SetBufferView(m_instanceBoundsIndex, instanceBounds->GetBufferView());
+                }
+                if (const Data::Instance<RPI::Buffer>& groupInstanceOffsets = m_meshFeatureProcessor->GetGpuCullingGroupInstanceOffsetsBuffer())
+                {
+                    m_shaderResourceGroup->SetBufferView(m_groupInstanceOffsetsIndex, groupInstanceOffsets->GetBufferView());
+                }
+                m_shaderResourceGroup->SetConstantArray(m_frustumPlanesIndex, m_frustumPlanes);
+                m_shaderResourceGroup->SetConstant(m_instanceCountIndex, instanceCount);
+                m_shaderResourceGroup->SetConstant(
+                    m_indirectArgumentsStrideIndex, aznumeric_cast<uint32_t>(m_indirectArgumentsByteStride / sizeof(uint32_t)));
+
+                SetTargetThreadCounts(instanceCount, 1, 1);
+            }
+
+            ComputePass::CompileResources(context);
+        }
+
+        void MeshGpuCullingPass::BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context)
+        {
+            if (!m_meshFeatureProcessor || m_meshFeatureProcessor->GetGpuCullingInstanceCount() == 0)
+            {
+                return;
+            }
+
+            ComputePass::BuildCommandListInternal(context);
+        }
+    }   // namespace Render
+}   // namespace AZ
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI/GeometryView.h>
+#include <Atom/RHI/IndirectBufferSignature.h>
+#include <Atom/RHI/IndirectBufferView.h>
+#include <Atom/RHI/IndirectBufferWriter.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Pass/ComputePass.h>
+#include <Atom/RPI.Public/View.h>
+#include <AzCore/Math/Frustum.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        class MeshFeatureProcessor;
+
+        //! Culls the instances of every mesh instance group against the frustum of the pass view on the GPU, and compacts the object ids
+        //! of the visible instances into the instance data buffer of the view. Each instance group is drawn with a single indirect draw
+        //! whose instance count is written by the culling shader.
+        //! The pass is opt-in (see r_meshGpuCullingEnabled). The pipeline has to connect the IndirectArguments and CulledInstanceData
+        //! outputs to the raster passes that draw the meshes, so the frame graph orders the draws after the culling dispatch.
+        class MeshGpuCullingPass final
+            : public RPI::ComputePass
+        {
+            AZ_RPI_PASS(MeshGpuCullingPass);
+
+        public:
+            AZ_RTTI(AZ::Render::MeshGpuCullingPass, "{5B0F3E76-4C1D-4B9B-A0E3-2E6B2F2C7D41}", RPI::ComputePass);
+            AZ_CLASS_ALLOCATOR(MeshGpuCullingPass, SystemAllocator);
+            virtual ~MeshGpuCullingPass() = default;
+
+            static RPI::Ptr<MeshGpuCullingPass> Create(const RPI::PassDescriptor& descriptor);
+
+            static Name GetMeshGpuCullingTemplateName()
+            {
+                return Name("MeshGpuCullingPassTemplate");
+            }
+
+            void SetFeatureProcessor(MeshFeatureProcessor* meshFeatureProcessor);
+
+            //! Resets the indirect draw arguments of every instance group the feature processor culls on the GPU, binds the culled
+            //! instance data to the view srg and adds one indirect draw packet per instance group to the view.
+            //! Called by the MeshFeatureProcessor after culling, for the view of this pass.
+            void AddIndirectDrawPacketsToView(const RPI::ViewPtr& view);
+
+            // Pass behavior overrides...
+            bool IsEnabled() const override;
+
+        private:
+            MeshGpuCullingPass(const RPI::PassDescriptor& descriptor);
+
+            // Pass behavior overrides...
+            void BuildInternal() override;
+
+            // RHI::ScopeProducer overrides...
+            void CompileResources(const RHI::FrameGraphCompileContext& context) override;
+            void BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context) override;
+
+            void InitIndirectBufferSignature();
+            //! Makes sure the output buffers can hold the arguments of groupCount draws and instanceCount object ids.
+            //! Returns true if the buffers were re-created, which invalidates the indirect draws created so far.
+            bool EnsureOutputBufferCapacity(uint32_t groupCount, uint32_t instanceCount);
+
+            // An indirect draw of one instance group. The draw packet is a clone of the instance group draw packet whose draw items
+            // use m_geometryView, a copy of the mesh geometry that draws with the arguments of the group in the indirect buffer.
+            struct IndirectDraw
+            {
+                const RHI::DrawPacket* m_sourceDrawPacket = nullptr;
+                RHI::Ptr<RHI::DrawPacket> m_drawPacket;
+                RHI::GeometryView m_geometryView;
+            };
+
+            MeshFeatureProcessor* m_meshFeatureProcessor = nullptr;
+
+            RHI::Ptr<RHI::IndirectBufferSignature> m_indirectBufferSignature;
+            RHI::Ptr<RHI::IndirectBufferWriter> m_indirectBufferWriter;
+            RHI::IndirectBufferView m_indirectBufferView;
+            uint32_t m_indirectArgumentsByteStride = 0;
+
+            Data::Instance<RPI::Buffer> m_indirectArgumentsBuffer;
+            Data::Instance<RPI::Buffer> m_culledInstanceDataBuffer;
+            uint32_t m_groupCapacity = 0;
+            uint32_t m_instanceCapacity = 0;
+
+            AZStd::vector<IndirectDraw> m_indirectDraws;
+            // The feature processor generation the indirect draws were created for
+            uint32_t m_indirectDrawsGeneration = 0;
+
+            AZStd::array<Vector4, Frustum::PlaneId::MAX> m_frustumPlanes;
+
+            RHI::ShaderInputNameIndex m_instanceBoundsIndex = "m_instanceBounds";
+            RHI::ShaderInputNameIndex m_groupInstanceOffsetsIndex = "m_groupInstanceOffsets";
+            RHI::ShaderInputNameIndex m_frustumPlanesIndex = "m_frustumPlanes";
+            RHI::ShaderInputNameIndex m_instanceCountIndex = "m_instanceCount";
+            RHI::ShaderInputNameIndex m_indirectArgumentsStrideIndex = "m_indirectArgumentsStride";
+            RHI::ShaderInputNameIndex m_viewInstanceDataIndex = "m_instanceData";
+        };
+    }   // namespace Render
+}   // namespace AZ
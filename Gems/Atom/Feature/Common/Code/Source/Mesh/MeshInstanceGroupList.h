@@ -40,6 +40,11 @@ namespace AZ::Render
         // The page that this instance group belongs to
         uint32_t m_pageIndex = 0;
 
+        // When GPU culling is enabled, the index of the group in the indirect draw arguments and the number of its instances
+        // that are culled on the GPU. Only the first selectable lod of each mesh is culled on the GPU.
+        uint32_t m_gpuCullingGroupIndex = 0;
+        uint32_t m_gpuCullingInstanceCount = 0;
+
         // We store a key with the data to make it faster to remove the instance without needing to recreate the key
         // or store it with the data for each individual instance
         MeshInstanceGroupKey m_key;
@@ -6,6 +6,7 @@
  *
  */
 #include <Mesh/MeshInstanceManager.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 
 namespace AZ
@@ -54,5 +55,52 @@ namespace AZ
         {
             return m_instanceData.GetParallelRanges();
         }
+
+        MeshInstanceManager::Statistics MeshInstanceManager::GetStatistics()
+        {
+            AZStd::scoped_lock lock(m_instanceDataMutex);
+
+            Statistics statistics;
+
+            // Keys with only the model, lod and mesh index, and with the material as well, of the groups visited so far
+            AZStd::unordered_set<MeshInstanceGroupKey> meshKeys;
+            AZStd::unordered_set<MeshInstanceGroupKey> meshMaterialKeys;
+
+            for (const auto& iteratorRange : m_instanceData.GetParallelRanges())
+            {
+                for (auto instanceGroupDataIter = iteratorRange.m_begin; instanceGroupDataIter != iteratorRange.m_end; ++instanceGroupDataIter)
+                {
+                    const MeshInstanceGroupData& instanceGroup = *instanceGroupDataIter;
+                    ++statistics.m_groupCount;
+                    statistics.m_instanceCount += instanceGroup.m_count;
+                    if (instanceGroup.m_count == 1)
+                    {
+                        ++statistics.m_singleInstanceGroupCount;
+                    }
+
+                    if (!instanceGroup.m_key.m_forceInstancingOff.IsNull())
+                    {
+                        ++statistics.m_forcedUniqueGroupCount;
+                        continue;
+                    }
+
+                    MeshInstanceGroupKey meshMaterialKey = instanceGroup.m_key;
+                    meshMaterialKey.m_sortKey = 0;
+                    MeshInstanceGroupKey meshKey = meshMaterialKey;
+                    meshKey.m_materialId = MeshInstanceGroupKey{}.m_materialId;
+
+                    if (!meshMaterialKeys.insert(meshMaterialKey).second)
+                    {
+                        ++statistics.m_sortKeySplitCount;
+                    }
+                    else if (!meshKeys.insert(meshKey).second)
+                    {
+                        ++statistics.m_materialSplitCount;
+                    }
+                }
+            }
+
+            return statistics;
+        }
     } // namespace Render
 } // namespace AZ
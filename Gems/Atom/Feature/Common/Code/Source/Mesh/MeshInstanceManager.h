@@ -22,6 +22,21 @@ namespace AZ::Render
         using InsertResult = MeshInstanceGroupList::InsertResult;
         using ParallelRanges = MeshInstanceGroupList::ParallelRanges;
 
+        //! Counts of instance groups, and of the reasons meshes of the same model, lod and mesh index ended up in separate groups.
+        struct Statistics
+        {
+            uint32_t m_groupCount = 0;
+            uint32_t m_instanceCount = 0;
+            //! Groups holding a single instance, which are drawn without any benefit from instancing
+            uint32_t m_singleInstanceGroupCount = 0;
+            //! Groups forced to be unique because their shaders don't support instancing
+            uint32_t m_forcedUniqueGroupCount = 0;
+            //! Additional groups of the same mesh caused by different material instances
+            uint32_t m_materialSplitCount = 0;
+            //! Additional groups of the same mesh and material caused by different sort keys
+            uint32_t m_sortKeySplitCount = 0;
+        };
+
         //! Increase the ref-count for an instance group if one already exists for the given key, or add a new instance group if it doesn't exist.
         //! Returns an InsertResult with a weak handle to the data and the ref-count for the instance group after adding this instance.
         InsertResult AddInstance(MeshInstanceGroupKey meshInstanceGroupData);
@@ -45,6 +60,9 @@ namespace AZ::Render
         //! Get begin and end iterators for each page in the MeshInstanceGroup, which can be processed in parallel
         ParallelRanges GetParallelRanges();
 
+        //! Iterates over all the instance groups to report how well meshes are batched.
+        Statistics GetStatistics();
+
     private:
 
         MeshInstanceGroupList m_instanceData;
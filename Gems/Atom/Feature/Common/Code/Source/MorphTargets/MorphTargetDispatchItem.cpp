@@ -18,12 +18,21 @@
 #include <Atom/RHI/Factory.h>
 #include <Atom/RHI/DeviceBufferView.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+
 #include <limits>
 
 namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(float, r_morphTargetMinDisplacement, 0.0001f, nullptr, ConsoleFunctorFlags::DontReplicate,
+            "Largest position offset in meters a weighted morph target needs to produce to be dispatched. "
+            "Morph targets with a smaller contribution are skipped, 0 only skips morph targets with no weight.");
+
         MorphTargetDispatchItem::MorphTargetDispatchItem(
             const AZStd::intrusive_ptr<MorphTargetInputBuffers> inputBuffers,
             const MorphTargetComputeMetaData& morphTargetComputeMetaData,
@@ -169,6 +178,11 @@ namespace AZ
             return m_rootConstantData.GetConstant<float>(m_weightIndex);
         }
 
+        bool MorphTargetDispatchItem::IsActive() const
+        {
+            return IsMorphTargetDisplacementVisible(GetWeight(), m_morphTargetComputeMetaData, r_morphTargetMinDisplacement);
+        }
+
         const RHI::DispatchItem& MorphTargetDispatchItem::GetRHIDispatchItem() const
         {
             return m_dispatchItem;
@@ -197,5 +211,16 @@ namespace AZ
                 AZ_Error("MorphTargetDispatchItem", false, "Failed to re-initialize after the shader variant was loaded.");
             }
         }
+
+        bool IsMorphTargetDisplacementVisible(float weight, const MorphTargetComputeMetaData& morphTargetMetaData, float minDisplacement)
+        {
+            if (weight <= AZ::Constants::FloatEpsilon)
+            {
+                return false;
+            }
+
+            const float maxDisplacement = weight * AZStd::max(AZStd::abs(morphTargetMetaData.m_minDelta), AZStd::abs(morphTargetMetaData.m_maxDelta));
+            return maxDisplacement > minDisplacement;
+        }
     } // namespace Render
 } // namespace AZ
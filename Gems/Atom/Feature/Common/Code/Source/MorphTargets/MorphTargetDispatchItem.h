@@ -62,6 +62,9 @@ namespace AZ
 
             void SetWeight(float weight);
             float GetWeight() const;
+
+            //! Returns false when the weight is too small for the morph target to visibly move any vertex, see r_morphTargetMinDisplacement.
+            bool IsActive() const;
         private:
             bool InitPerInstanceSRG();
             void InitRootConstants(const RHI::ConstantsLayout* rootConstantsLayout);
@@ -95,5 +98,9 @@ namespace AZ
             // Keep track of the constant index of m_weight since it is updated frequently
             RHI::ShaderInputConstantIndex m_weightIndex;
         };
+
+        //! The deltas of a morph target are quantized between its min and max delta, so the weight times the largest of them bounds how far the morph target moves any vertex.
+        //! Returns true when that bound exceeds minDisplacement, which means the morph target needs to be dispatched. A morph target without weight is never dispatched.
+        bool IsMorphTargetDisplacementVisible(float weight, const MorphTargetComputeMetaData& morphTargetMetaData, float minDisplacement);
     } // namespace Render
 } // namespace AZ
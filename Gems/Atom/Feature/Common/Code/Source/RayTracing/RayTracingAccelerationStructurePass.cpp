@@ -19,11 +19,16 @@
 #include <Mesh/MeshFeatureProcessor.h>
 #include <RayTracing/RayTracingAccelerationStructurePass.h>
 #include <RayTracing/RayTracingFeatureProcessor.h>
+#include <AzCore/Console/IConsole.h>
 
 namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(uint32_t, r_rayTracingSkinnedBlasRebuildInterval, 8, nullptr, ConsoleFunctorFlags::DontReplicate,
+            "Number of frames between full rebuilds of a skinned mesh BLAS, which is refit in the other frames. Rebuilds are spread "
+            "over the frames. 0 only refits skinned BLASes after their first build.");
+
         RPI::Ptr<RayTracingAccelerationStructurePass> RayTracingAccelerationStructurePass::Create(const RPI::PassDescriptor& descriptor)
         {
             RPI::Ptr<RayTracingAccelerationStructurePass> rayTracingAccelerationStructurePass = aznew RayTracingAccelerationStructurePass(descriptor);
@@ -222,6 +227,12 @@ namespace AZ
                 const bool isSkinnedMesh = blasInstance.second.m_isSkinnedMesh;
                 const bool buildBlas = (blasInstance.second.m_blasBuilt & RHI::MultiDevice::DeviceMask(1 << context.GetDeviceIndex())) ==
                     RHI::MultiDevice::NoDevices;
+                if (buildBlas && !blasInstance.second.m_blasBuildScheduled)
+                {
+                    // over the build budget of this frame, the BLAS is not in the TLAS yet
+                    continue;
+                }
+
                 if (buildBlas || isSkinnedMesh)
                 {
                     for (auto submeshIndex = 0; submeshIndex < blasInstance.second.m_subMeshes.size(); ++submeshIndex)
@@ -235,12 +246,14 @@ namespace AZ
                             continue;
                         }
 
-                        // Determine if a skinned mesh BLAS needs to be updated or completely rebuilt. For now, we want to rebuild a BLAS every
-                        // SKINNED_BLAS_REBUILD_FRAME_INTERVAL frames, while updating it all other frames. This is based on the assumption that
-                        // by adding together the asset ID hash, submesh index, and frame count, we get a value that allows us to uniformly
-                        // distribute rebuilding all skinned mesh BLASs over all frames.
+                        // Determine if a skinned mesh BLAS needs to be updated or completely rebuilt. We want to rebuild a BLAS every
+                        // r_rayTracingSkinnedBlasRebuildInterval frames, while refitting it all other frames, since refitting degrades
+                        // the quality of the BLAS as the mesh deforms. This is based on the assumption that by adding together the asset
+                        // ID hash, submesh index, and frame count, we get a value that allows us to uniformly distribute rebuilding all
+                        // skinned mesh BLASs over all frames.
+                        const uint32_t rebuildInterval = r_rayTracingSkinnedBlasRebuildInterval;
                         auto assetGuid = blasInstance.first.m_guid.GetHash();
-                        if (isSkinnedMesh && (assetGuid + submeshIndex + m_frameCount) % SKINNED_BLAS_REBUILD_FRAME_INTERVAL != 0)
+                        if (isSkinnedMesh && (rebuildInterval == 0 || (assetGuid + submeshIndex + m_frameCount) % rebuildInterval != 0))
                         {
                             // Skinned mesh that simply needs an update
                             context.GetCommandList()->UpdateBottomLevelAccelerationStructure(
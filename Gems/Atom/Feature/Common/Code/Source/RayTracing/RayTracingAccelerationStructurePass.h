@@ -83,9 +83,6 @@ namespace AZ
             // keeps track of the current frame to determine updates or rebuilds of the skinned BLASes
             uint64_t m_frameCount = 0;
 
-            // the bits of this constant are used to check if a skinned BLAS is going to be rebuilt in any given frame
-            static constexpr uint32_t SKINNED_BLAS_REBUILD_FRAME_INTERVAL = 8;
-
             // Readback results from the Timestamp queries
             AZ::RPI::TimestampResult m_timestampResult{};
 
@@ -23,11 +23,16 @@
 #include <CoreLights/CapsuleLightFeatureProcessor.h>
 #include <CoreLights/QuadLightFeatureProcessor.h>
 #include <ImageBasedLights/ImageBasedLightFeatureProcessor.h>
+#include <AzCore/Console/IConsole.h>
 
 namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(uint32_t, r_rayTracingBlasBuildBudget, 0, nullptr, ConsoleFunctorFlags::DontReplicate,
+            "Maximum number of sub-mesh BLASes built for the first time in a frame, 0 means no limit. Meshes over the budget are "
+            "added to the TLAS in a later frame.");
+
         void RayTracingFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -201,8 +206,15 @@ namespace AZ
 
             if (auto it = m_proceduralGeometryLookup.find(uuid); it != m_proceduralGeometryLookup.end())
             {
-                m_proceduralGeometry[it->second].m_transform = transform;
-                m_proceduralGeometry[it->second].m_nonUniformScale = nonUniformScale;
+                ProceduralGeometry& proceduralGeometry = m_proceduralGeometry[it->second];
+                if (proceduralGeometry.m_transform == transform && proceduralGeometry.m_nonUniformScale == nonUniformScale)
+                {
+                    // unchanged, avoid rebuilding the TLAS
+                    return;
+                }
+
+                proceduralGeometry.m_transform = transform;
+                proceduralGeometry.m_nonUniformScale = nonUniformScale;
             }
 
             m_revision++;
@@ -636,6 +648,12 @@ namespace AZ
             if (itMesh != m_meshes.end())
             {
                 Mesh& mesh = itMesh->second;
+                if (mesh.m_transform == transform && mesh.m_nonUniformScale == nonUniformScale)
+                {
+                    // unchanged, avoid rebuilding the TLAS and the mesh info buffer
+                    return;
+                }
+
                 mesh.m_transform = transform;
                 mesh.m_nonUniformScale = nonUniformScale;
                 m_revision++;
@@ -749,6 +767,41 @@ namespace AZ
 
         uint32_t RayTracingFeatureProcessor::BeginFrame()
         {
+            // schedule the BLASes which weren't built yet within the per-frame build budget
+            const RHI::MultiDevice::DeviceMask rayTracingDevices = RHI::RHISystemInterface::Get()->GetRayTracingSupport();
+            bool hasPendingBlas = false;
+            {
+                AZStd::lock_guard lock(m_blasBuiltMutex);
+
+                const uint32_t buildBudget = r_rayTracingBlasBuildBudget;
+                uint32_t scheduledBlasCount = 0;
+                for (auto& [assetId, blasInstance] : m_blasInstanceMap)
+                {
+                    blasInstance.m_blasBuildScheduled = false;
+                    if ((blasInstance.m_blasBuilt & rayTracingDevices) == rayTracingDevices)
+                    {
+                        continue;
+                    }
+
+                    if (buildBudget == 0 || scheduledBlasCount < buildBudget)
+                    {
+                        blasInstance.m_blasBuildScheduled = true;
+                        scheduledBlasCount += aznumeric_cast<uint32_t>(blasInstance.m_subMeshes.size());
+                    }
+                    else
+                    {
+                        hasPendingBlas = true;
+                    }
+                }
+            }
+
+            // the TLAS needs to be rebuilt to add the meshes whose BLAS is built this frame
+            if (hasPendingBlas || m_hasPendingBlas)
+            {
+                m_revision++;
+            }
+            m_hasPendingBlas = hasPendingBlas;
+
             if (m_tlasRevision != m_revision)
             {
                 m_tlasRevision = m_revision;
@@ -757,9 +810,24 @@ namespace AZ
                 RHI::RayTracingTlasDescriptor tlasDescriptor;
                 RHI::RayTracingTlasDescriptor* tlasDescriptorBuild = tlasDescriptor.Build();
 
+                // geometry over the BLAS build budget is skipped, the instance IDs still match the indices of the mesh infos
+                auto isBlasPending = [&](const Data::AssetId& assetId)
+                {
+                    auto blasInstanceIt = m_blasInstanceMap.find(assetId);
+                    return blasInstanceIt != m_blasInstanceMap.end() &&
+                        (blasInstanceIt->second.m_blasBuilt & rayTracingDevices) != rayTracingDevices &&
+                        !blasInstanceIt->second.m_blasBuildScheduled;
+                };
+
                 uint32_t instanceIndex = 0;
                 for (auto& subMesh : m_subMeshes)
                 {
+                    if (isBlasPending(subMesh.m_mesh->m_assetId))
+                    {
+                        instanceIndex++;
+                        continue;
+                    }
+
                     tlasDescriptorBuild->Instance()
                         ->InstanceID(instanceIndex)
                         ->InstanceMask(subMesh.m_mesh->m_instanceMask)
@@ -782,6 +850,12 @@ namespace AZ
 
                 for (const auto& proceduralGeometry : m_proceduralGeometry)
                 {
+                    if (isBlasPending(Data::AssetId(proceduralGeometry.m_uuid)))
+                    {
+                        instanceIndex++;
+                        continue;
+                    }
+
                     tlasDescriptorBuild->Instance()
                         ->InstanceID(instanceIndex)
                         ->InstanceMask(proceduralGeometry.m_instanceMask)
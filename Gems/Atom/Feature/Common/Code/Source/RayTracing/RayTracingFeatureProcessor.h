@@ -148,6 +148,9 @@ namespace AZ
             // latest tlas revision number
             uint32_t m_tlasRevision = 0;
 
+            // true if some BLASes didn't fit in the build budget of the previous frame
+            bool m_hasPendingBlas = false;
+
             uint32_t m_proceduralGeometryTypeRevision = 0;
 
             // total number of ray tracing sub-meshes
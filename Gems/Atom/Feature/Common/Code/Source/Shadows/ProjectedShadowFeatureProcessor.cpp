@@ -10,6 +10,7 @@
 
 #include <AzCore/Math/MatrixUtils.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/math.h>
 #include <Math/GaussianMathFilter.h>
 #include <Atom/RHI/DrawPacketBuilder.h>
 #include <Atom/RHI/RHISystemInterface.h>
@@ -38,6 +39,37 @@ namespace AZ::Render
             AZ::ConsoleFunctorFlags::DontReplicate | AZ::ConsoleFunctorFlags::DontDuplicate,
             "If set, enables filtering of shadow maps that are outside of the view frustum.");
 
+        AZ_CVAR(
+            float,
+            r_projectedShadowmapDownscaleDistance,
+            0.0f,
+            nullptr,
+            AZ::ConsoleFunctorFlags::DontReplicate | AZ::ConsoleFunctorFlags::DontDuplicate,
+            "Distance to the camera, in multiples of the light's attenuation radius, beyond which a projected shadow map uses half of "
+            "its max resolution in the atlas. Each further doubling of the distance halves it again, down to 256. 0 disables it.");
+
+        // Relative change of the distance needed to switch to another resolution, so lights near a threshold don't rebuild the atlas every frame.
+        constexpr float ShadowmapDownscaleHysteresis = 1.1f;
+        constexpr uint32_t MaxShadowmapDownscaleLevel = 8;
+
+        uint32_t GetShadowmapDownscaleLevel(float distance, float downscaleDistance)
+        {
+            uint32_t level = 0;
+            while (distance > downscaleDistance && level < MaxShadowmapDownscaleLevel)
+            {
+                downscaleDistance *= 2.0f;
+                ++level;
+            }
+            return level;
+        }
+
+        ShadowmapSize GetDownscaledShadowmapSize(ShadowmapSize maxSize, uint32_t downscaleLevel)
+        {
+            const uint32_t maxSizeValue = static_cast<uint32_t>(maxSize);
+            const uint32_t minSizeValue = AZStd::min(static_cast<uint32_t>(MinShadowmapImageSize), maxSizeValue);
+            return static_cast<ShadowmapSize>(AZStd::max(maxSizeValue >> downscaleLevel, minSizeValue));
+        }
+
         bool IsShadowmapCullingEnabled()
         {
             bool cullShadowmapOutsideViewFrustum = true;
@@ -206,8 +238,11 @@ namespace AZ::Render
         AZ_Assert(id.IsValid(), "Invalid ShadowId passed to ProjectedShadowFeatureProcessor::SetShadowmapMaxResolution().");
         AZ_Assert(size != ShadowmapSize::None, "Shadowmap size cannot be set to None, remove the shadow instead.");
         
+        ShadowProperty& shadowProperty = GetShadowPropertyFromShadowId(id);
+        shadowProperty.m_maxShadowmapSize = size;
+
         FilterParameter& esmData = m_shadowData.GetElement<FilterParamIndex>(id.GetIndex());
-        esmData.m_shadowmapSize = aznumeric_cast<uint32_t>(size);
+        esmData.m_shadowmapSize = aznumeric_cast<uint32_t>(GetDownscaledShadowmapSize(size, shadowProperty.m_downscaleLevel));
         
         m_deviceBufferNeedsUpdate = true;
         m_shadowmapPassNeedsUpdate = true;
@@ -681,12 +716,15 @@ namespace AZ::Render
             if (renderPipeline)
             {
                 AZStd::vector<AZ::Frustum> mainViewFrustums;
+                AZStd::vector<AZ::Vector3> mainViewPositions;
                 for (const auto& [view, viewTag] : prepareViewsPacket.m_persistentViews)
                 {
                     AZ::Frustum viewFrustum = AZ::Frustum::CreateFromMatrixColumnMajor(view->GetWorldToClipMatrix());
                     mainViewFrustums.push_back(viewFrustum);
+                    mainViewPositions.push_back(view->GetViewToWorldMatrix().GetTranslation());
                 }
                 bool cullShadowmapOutsideViewFrustum = IsShadowmapCullingEnabled();
+                const float downscaleDistance = r_projectedShadowmapDownscaleDistance;
 
                 auto& shadowProperties = m_shadowProperties.GetDataVector();
                 for (ShadowProperty& shadowProperty : shadowProperties)
@@ -698,6 +736,11 @@ namespace AZ::Render
                         continue;
                     }
                     auto lightPosition = shadowProperty.m_desc.m_transform.GetTranslation();
+                    if (downscaleDistance > 0.0f && !mainViewPositions.empty())
+                    {
+                        UpdateShadowmapDownscaleLevel(shadowProperty, mainViewPositions, downscaleDistance * shadowProperty.m_desc.m_farPlaneDistance);
+                    }
+
                     if (cullShadowmapOutsideViewFrustum &&
                         !IsLightInsideAnyViewFrustum(mainViewFrustums, lightPosition, shadowProperty.m_desc.m_farPlaneDistance))
                     {
@@ -718,6 +761,44 @@ namespace AZ::Render
         }
     }
     
+    void ProjectedShadowFeatureProcessor::UpdateShadowmapDownscaleLevel(
+        ShadowProperty& shadowProperty, AZStd::span<const AZ::Vector3> viewPositions, float downscaleDistance)
+    {
+        if (shadowProperty.m_maxShadowmapSize == ShadowmapSize::None)
+        {
+            return;
+        }
+
+        const AZ::Vector3 lightPosition = shadowProperty.m_desc.m_transform.GetTranslation();
+        float distanceSq = AZStd::numeric_limits<float>::max();
+        for (const AZ::Vector3& viewPosition : viewPositions)
+        {
+            distanceSq = AZStd::min(distanceSq, viewPosition.GetDistanceSq(lightPosition));
+        }
+        const float distance = AZStd::sqrt(distanceSq);
+
+        // Only move to another level once the distance is well inside of it
+        uint32_t downscaleLevel = shadowProperty.m_downscaleLevel;
+        downscaleLevel = AZStd::max(downscaleLevel, GetShadowmapDownscaleLevel(distance / ShadowmapDownscaleHysteresis, downscaleDistance));
+        downscaleLevel = AZStd::min(downscaleLevel, GetShadowmapDownscaleLevel(distance * ShadowmapDownscaleHysteresis, downscaleDistance));
+        if (downscaleLevel == shadowProperty.m_downscaleLevel)
+        {
+            return;
+        }
+
+        shadowProperty.m_downscaleLevel = downscaleLevel;
+        const uint32_t shadowmapSize = static_cast<uint32_t>(GetDownscaledShadowmapSize(shadowProperty.m_maxShadowmapSize, downscaleLevel));
+        FilterParameter& filterData = m_shadowData.GetElement<FilterParamIndex>(shadowProperty.m_shadowId.GetIndex());
+        if (filterData.m_shadowmapSize != shadowmapSize)
+        {
+            // The atlas is rebuilt on the next Simulate()
+            filterData.m_shadowmapSize = shadowmapSize;
+            m_deviceBufferNeedsUpdate = true;
+            m_shadowmapPassNeedsUpdate = true;
+            m_filterParameterNeedsUpdate = true;
+        }
+    }
+
     void ProjectedShadowFeatureProcessor::Render(const FeatureProcessor::RenderPacket& packet)
     {
         AZ_PROFILE_SCOPE(RPI, "ProjectedShadowFeatureProcessor: Render");
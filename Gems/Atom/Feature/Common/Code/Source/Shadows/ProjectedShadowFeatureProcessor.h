@@ -9,6 +9,7 @@
 #pragma once
 
 #include <Atom/RHI/GeometryView.h>
+#include <AzCore/std/containers/span.h>
 
 #include <Atom/Feature/Shadows/ProjectedShadowFeatureProcessorInterface.h>
 #include <Atom/Feature/Utils/GpuBufferHandler.h>
@@ -89,6 +90,9 @@ namespace AZ::Render
             float m_bias = 0.1f;
             ShadowId m_shadowId;
             bool m_useCachedShadows = false;
+            // Resolution requested for the shadow, the atlas uses it divided by 2^m_downscaleLevel.
+            ShadowmapSize m_maxShadowmapSize = ShadowmapSize::None;
+            uint32_t m_downscaleLevel = 0;
         };
 
         using FilterParameter = EsmShadowmapsPass::FilterParameter;
@@ -100,6 +104,8 @@ namespace AZ::Render
         // Shadow specific functions
         void UpdateShadowView(ShadowProperty& shadowProperty);
         void InitializeShadow(ShadowId shadowId);
+        //! Lowers the atlas resolution of shadows far from every view, see r_projectedShadowmapDownscaleDistance.
+        void UpdateShadowmapDownscaleLevel(ShadowProperty& shadowProperty, AZStd::span<const AZ::Vector3> viewPositions, float downscaleDistance);
             
         // Functions for caching the ProjectedShadowmapsPass and EsmShadowmapsPass.
         void CheckRemovePrimaryPasses(RPI::RenderPipeline* renderPipeline);
@@ -19,12 +19,18 @@
 #include <Atom/RHI/Factory.h>
 #include <Atom/RHI/DeviceBufferView.h>
 
+#include <AzCore/Console/IConsole.h>
+
 #include <limits>
 
 namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(uint32_t, r_skinnedMeshLodInfluenceCount, 0, nullptr, ConsoleFunctorFlags::DontReplicate,
+            "Maximum number of bone influences evaluated per vertex for skinned mesh lods other than lod 0, 0 means all of them. "
+            "The remaining weights are renormalized. Rounded up to an even number, read when the skinned mesh is created.");
+
         SkinnedMeshDispatchItem::SkinnedMeshDispatchItem(
             AZStd::intrusive_ptr<SkinnedMeshInputBuffers> inputBuffers,
             const SkinnedMeshOutputVertexOffsets& outputBufferOffsetsInBytes,
@@ -37,6 +43,7 @@ namespace AZ
             MorphTargetInstanceMetaData morphTargetInstanceMetaData,
             float morphTargetDeltaIntegerEncoding)
             : m_dispatchItem(RHI::MultiDevice::AllDevices)
+            , m_positionHistoryCopyDispatchItem(RHI::MultiDevice::AllDevices)
             , m_inputBuffers(inputBuffers)
             , m_outputBufferOffsetsInBytes(outputBufferOffsetsInBytes)
             , m_positionHistoryBufferOffsetInBytes(positionHistoryOutputBufferOffsetInBytes)
@@ -101,6 +108,17 @@ namespace AZ
 
             m_inputBuffers->SetBufferViewsOnShaderResourceGroup(m_lodIndex, m_meshIndex, m_instanceSrg);
 
+            // Distant lods can evaluate fewer influences per vertex, in pairs since the shader reads two at a time
+            const uint32_t influenceCount = m_inputBuffers->GetInfluenceCountPerVertex(m_lodIndex, m_meshIndex);
+            uint32_t evaluatedInfluenceCount = influenceCount;
+            if (m_lodIndex > 0 && r_skinnedMeshLodInfluenceCount > 0)
+            {
+                evaluatedInfluenceCount = AZStd::min(influenceCount, AZ::RoundUpToMultiple(static_cast<uint32_t>(r_skinnedMeshLodInfluenceCount), 2u));
+            }
+            RHI::ShaderInputConstantIndex evaluatedInfluenceCountIndex = m_instanceSrg->FindShaderInputConstantIndex(Name{ "m_numEvaluatedInfluencesPerVertex" });
+            AZ_Error("SkinnedMeshDispatchItem", evaluatedInfluenceCountIndex.IsValid(), "Failed to find shader input index for m_numEvaluatedInfluencesPerVertex in the skinning compute shader per-instance SRG.");
+            m_instanceSrg->SetConstant(evaluatedInfluenceCountIndex, evaluatedInfluenceCount);
+
             // Set the SRG indices
             RHI::ShaderInputBufferIndex actorInstanceBoneTransformsIndex;
             if (m_shaderOptions.m_skinningMethod == SkinningMethod::LinearSkinning)
@@ -220,6 +238,23 @@ namespace AZ
 
             m_dispatchItem.SetArguments(arguments);
 
+            // The position history copy uses the same inputs, with the flag to only copy the positions
+            m_positionHistoryCopySrg = RPI::ShaderResourceGroup::Create(m_skinningShader->GetAsset(), m_skinningShader->GetSupervariantIndex(), perInstanceSrgLayout->GetName());
+            if (!m_positionHistoryCopySrg)
+            {
+                AZ_Error("SkinnedMeshDispatchItem", false, "Failed to create the position history copy shader resource group for skinned mesh");
+                return false;
+            }
+            m_positionHistoryCopySrg->CopyShaderResourceGroupData(*m_instanceSrg);
+            RHI::ShaderInputConstantIndex copyPositionHistoryOnlyIndex = m_positionHistoryCopySrg->FindShaderInputConstantIndex(Name{ "m_copyPositionHistoryOnly" });
+            AZ_Error("SkinnedMeshDispatchItem", copyPositionHistoryOnlyIndex.IsValid(), "Failed to find shader input index for m_copyPositionHistoryOnly in the skinning compute shader per-instance SRG.");
+            m_positionHistoryCopySrg->SetConstant(copyPositionHistoryOnlyIndex, 1u);
+            m_positionHistoryCopySrg->Compile();
+
+            m_positionHistoryCopyDispatchItem.SetUniqueShaderResourceGroup(m_positionHistoryCopySrg->GetRHIShaderResourceGroup());
+            m_positionHistoryCopyDispatchItem.SetPipelineState(m_skinningShader->AcquirePipelineState(pipelineStateDescriptor));
+            m_positionHistoryCopyDispatchItem.SetArguments(arguments);
+
             return true;
         }
 
@@ -228,6 +263,11 @@ namespace AZ
             return m_dispatchItem;
         }
 
+        const RHI::DispatchItem& SkinnedMeshDispatchItem::GetPositionHistoryCopyRHIDispatchItem() const
+        {
+            return m_positionHistoryCopyDispatchItem;
+        }
+
         Data::Instance<RPI::Buffer> SkinnedMeshDispatchItem::GetBoneTransforms() const
         {
             return m_boneTransforms;
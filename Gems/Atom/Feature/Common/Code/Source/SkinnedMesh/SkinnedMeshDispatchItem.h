@@ -66,6 +66,10 @@ namespace AZ
 
             const RHI::DispatchItem& GetRHIDispatchItem() const;
 
+            //! Returns a dispatch item which only copies the current positions to the position history, used instead of the
+            //! skinning dispatch on frames where the skinning update is skipped.
+            const RHI::DispatchItem& GetPositionHistoryCopyRHIDispatchItem() const;
+
             Data::Instance<RPI::Buffer> GetBoneTransforms() const;
             uint32_t GetVertexCount() const;
             void Enable();
@@ -76,6 +80,7 @@ namespace AZ
             void OnShaderReinitialized(const CachedSkinnedMeshShaderOptions* cachedShaderOptions) override;
 
             RHI::DispatchItem m_dispatchItem;
+            RHI::DispatchItem m_positionHistoryCopyDispatchItem;
 
             // The skinning shader used for this instance
             Data::Instance<RPI::Shader> m_skinningShader;
@@ -98,6 +103,9 @@ namespace AZ
             // The per-object shader resource group
             Data::Instance<RPI::ShaderResourceGroup> m_instanceSrg;
 
+            // A copy of the per-object shader resource group with m_copyPositionHistoryOnly set
+            Data::Instance<RPI::ShaderResourceGroup> m_positionHistoryCopySrg;
+
             // Buffer with the bone transforms
             Data::Instance<RPI::Buffer> m_boneTransforms;
 
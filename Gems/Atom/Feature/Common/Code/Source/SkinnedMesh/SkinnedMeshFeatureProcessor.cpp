@@ -25,15 +25,25 @@
 
 #include <Atom/RHI/CommandList.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/RTTI/TypeInfo.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/math.h>
 
 namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(float, r_skinnedMeshThrottleScreenCoverage, 0.0f, nullptr, ConsoleFunctorFlags::DontReplicate,
+            "Screen coverage below which skinned meshes are skinned every few frames instead of every frame, 0 disables it. "
+            "A mesh at half this coverage is updated every other frame, at a third every third frame, and so on.");
+
+        AZ_CVAR(uint32_t, r_skinnedMeshMaxUpdateInterval, 4, nullptr, ConsoleFunctorFlags::DontReplicate,
+            "Maximum number of frames between two skinning updates of a throttled skinned mesh.");
+
         const char* SkinnedMeshFeatureProcessor::s_featureProcessorName = "SkinnedMeshFeatureProcessor";
 
         void SkinnedMeshFeatureProcessor::Reflect(ReflectContext* context)
@@ -161,7 +171,7 @@ namespace AZ
                                             for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy->m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
                                             {
                                                 const MorphTargetDispatchItem* dispatchItem = renderProxy->m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                                                if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
+                                                if (dispatchItem && dispatchItem->IsActive())
                                                 {
                                                     m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
                                                 }
@@ -180,6 +190,10 @@ namespace AZ
                 }
             }
 #else  //[GFX_TODO][ATOM-13564] This is a temporary implementation that submits all of the skinning compute shaders without any culling:
+            const float throttleScreenCoverage = r_skinnedMeshThrottleScreenCoverage;
+            const uint32_t maxUpdateInterval = AZStd::max(static_cast<uint32_t>(r_skinnedMeshMaxUpdateInterval), 1u);
+            size_t skippedDispatchCount = 0;
+
             for (SkinnedMeshRenderProxy& renderProxy : m_renderProxies)
             {
                 if (renderProxy.m_inputBuffers->GetModel()->IsUploadPending())
@@ -195,6 +209,9 @@ namespace AZ
                 ModelDataInstance& modelDataInstance = **renderProxy.m_meshHandle;
                 const RPI::Cullable& cullable = modelDataInstance.GetCullable();
 
+                // Gather the lods used by any view, and the largest screen coverage of the mesh, which drives its update rate
+                uint32_t lodMask = 0;
+                float maxScreenCoverage = 0.0f;
                 for (const RPI::ViewPtr& viewPtr : packet.m_views)
                 {
                     RPI::View* view = viewPtr.get();
@@ -214,26 +231,9 @@ namespace AZ
                     {
                     case RPI::Cullable::LodType::SpecificLod:
                     {
-                        AZStd::lock_guard lock(m_dispatchItemMutex);
-                        auto lodIndex = cullable.m_lodData.m_lodConfiguration.m_lodOverride;
-                        
-                        for (const AZStd::unique_ptr<SkinnedMeshDispatchItem>& skinnedMeshDispatchItem : renderProxy.m_dispatchItemsByLod[lodIndex])
-                        {
-                            // Add one skinning dispatch item for each mesh in the lod
-                            if (skinnedMeshDispatchItem->IsEnabled())
-                            {
-                                m_skinningDispatches.insert(&skinnedMeshDispatchItem->GetRHIDispatchItem());
-                            }
-                        }
-                        
-                        for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy.m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
-                        {
-                            const MorphTargetDispatchItem* dispatchItem = renderProxy.m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                            if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
-                            {
-                                m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
-                            }
-                        }
+                        lodMask |= 1u << cullable.m_lodData.m_lodConfiguration.m_lodOverride;
+                        // a specific lod is not throttled
+                        maxScreenCoverage = AZStd::numeric_limits<float>::max();
                     }
                     break;
                     case RPI::Cullable::LodType::ScreenCoverage:
@@ -248,6 +248,7 @@ namespace AZ
 
                         const float approxScreenPercentage = RPI::ModelLodUtils::ApproxScreenPercentage(
                             pos, cullable.m_lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
+                        maxScreenCoverage = AZStd::max(maxScreenCoverage, approxScreenPercentage);
 
                         for (size_t lodIndex = 0; lodIndex < cullable.m_lodData.m_lods.size(); ++lodIndex)
                         {
@@ -256,30 +257,94 @@ namespace AZ
                             //Note that this supports overlapping lod ranges (to support cross-fading lods, for example)
                             if (approxScreenPercentage >= lod.m_screenCoverageMin && approxScreenPercentage <= lod.m_screenCoverageMax)
                             {
-                                AZStd::lock_guard lock(m_dispatchItemMutex);
-                                for (const AZStd::unique_ptr<SkinnedMeshDispatchItem>& skinnedMeshDispatchItem : renderProxy.m_dispatchItemsByLod[lodIndex])
-                                {
-                                    // Add one skinning dispatch item for each mesh in the lod
-                                    if (skinnedMeshDispatchItem->IsEnabled())
-                                    {
-                                        m_skinningDispatches.insert(&skinnedMeshDispatchItem->GetRHIDispatchItem());
-                                    }
-                                }
-
-                                for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy.m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
-                                {
-                                    const MorphTargetDispatchItem* dispatchItem = renderProxy.m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                                    if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
-                                    {
-                                        m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
-                                    }
-                                }
+                                lodMask |= 1u << lodIndex;
                             }
                         }
                         break;
                     }
                 }
+
+                if (lodMask == 0)
+                {
+                    continue;
+                }
+
+                // Small meshes are skinned every few frames, and keep the output of their last update in between. The update
+                // interval grows as the screen coverage decreases, a mesh at half the throttle coverage is updated every other frame.
+                uint32_t updateInterval = 1;
+                if (throttleScreenCoverage > 0.0f && maxScreenCoverage < throttleScreenCoverage)
+                {
+                    const float coverageRatio = throttleScreenCoverage / AZStd::max(maxScreenCoverage, AZ::Constants::FloatEpsilon);
+                    updateInterval = aznumeric_cast<uint32_t>(AZStd::min(AZStd::ceil(coverageRatio), static_cast<float>(maxUpdateInterval)));
+                }
+
+                // The skinning output of a lod is only valid if it was updated the last time, so always update when the lods change
+                const bool updateSkinning = lodMask != renderProxy.m_lastSkinnedLodMask ||
+                    renderProxy.m_framesSinceSkinningUpdate + 1 >= updateInterval;
+
+                const bool copyPositionHistory = !updateSkinning && renderProxy.m_positionHistoryCopyPending;
+                if (updateSkinning)
+                {
+                    renderProxy.m_framesSinceSkinningUpdate = 0;
+                    renderProxy.m_lastSkinnedLodMask = lodMask;
+                    renderProxy.m_positionHistoryCopyPending = true;
+                }
+                else
+                {
+                    renderProxy.m_framesSinceSkinningUpdate++;
+                    renderProxy.m_positionHistoryCopyPending = false;
+                }
+
+                AZStd::lock_guard lock(m_dispatchItemMutex);
+                for (uint32_t lodIndex = 0; lodIndex < renderProxy.m_dispatchItemsByLod.size(); ++lodIndex)
+                {
+                    if ((lodMask & (1u << lodIndex)) == 0)
+                    {
+                        continue;
+                    }
+
+                    for (const AZStd::unique_ptr<SkinnedMeshDispatchItem>& skinnedMeshDispatchItem : renderProxy.m_dispatchItemsByLod[lodIndex])
+                    {
+                        // Add one skinning dispatch item for each mesh in the lod
+                        if (!skinnedMeshDispatchItem->IsEnabled())
+                        {
+                            continue;
+                        }
+
+                        if (updateSkinning)
+                        {
+                            m_skinningDispatches.insert(&skinnedMeshDispatchItem->GetRHIDispatchItem());
+                        }
+                        else
+                        {
+                            // The first skipped frame copies the positions to the position history, so the motion vectors of
+                            // the mesh are zero while it keeps the output of its last update
+                            if (copyPositionHistory)
+                            {
+                                m_skinningDispatches.insert(&skinnedMeshDispatchItem->GetPositionHistoryCopyRHIDispatchItem());
+                            }
+                            ++skippedDispatchCount;
+                        }
+                    }
+
+                    // Morph target deltas are accumulated until the next skinning dispatch consumes them
+                    if (!updateSkinning)
+                    {
+                        continue;
+                    }
+
+                    for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy.m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
+                    {
+                        const MorphTargetDispatchItem* dispatchItem = renderProxy.m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
+                        if (dispatchItem && dispatchItem->IsActive())
+                        {
+                            m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
+                        }
+                    }
+                }
             }
+
+            m_skippedSkinningDispatchCount = skippedDispatchCount;
 #endif
         }
 
@@ -98,6 +98,9 @@ namespace AZ
 
             AZStd::mutex m_dispatchItemMutex;
 
+            // Number of skinning dispatches skipped by update throttling in the last frame
+            size_t m_skippedSkinningDispatchCount = 0;
+
         };
     } // namespace Render
 } // namespace AZ
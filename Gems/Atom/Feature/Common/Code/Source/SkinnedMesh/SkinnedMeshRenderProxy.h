@@ -63,6 +63,13 @@ namespace AZ
             Data::Instance<RPI::Buffer> m_boneTransforms;
 
             SkinnedMeshFeatureProcessor* m_featureProcessor = nullptr;
+
+            // Skinning update throttling state, see r_skinnedMeshThrottleScreenCoverage
+            uint32_t m_framesSinceSkinningUpdate = 0;
+            // The lods skinned by the last update
+            uint32_t m_lastSkinnedLodMask = 0;
+            // True until the first frame after an update copies the positions to the position history
+            bool m_positionHistoryCopyPending = false;
         };
     } // namespace Render
 } // namespace AZ
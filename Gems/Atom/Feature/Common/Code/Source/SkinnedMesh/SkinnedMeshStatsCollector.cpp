@@ -27,6 +27,7 @@ namespace AZ
         SkinnedMeshSceneStats SkinnedMeshStatsCollector::GetSceneStats()
         {
             m_sceneStats.skinnedMeshRenderProxyCount = m_featureProcessor->m_renderProxies.size();
+            m_sceneStats.skippedDispatchItemCount = m_featureProcessor->m_skippedSkinningDispatchCount;
 
             for (const SkinnedMeshRenderProxy& renderProxy : m_featureProcessor->m_renderProxies)
             {
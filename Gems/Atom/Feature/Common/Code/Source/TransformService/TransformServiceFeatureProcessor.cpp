@@ -14,14 +14,23 @@
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/Utils/Utils.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/sort.h>
+
 #include <cinttypes>
 
+AZ_CVAR(uint32_t, r_transformServiceMaxUploadRanges, 256, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+    "Maximum number of separate ranges of modified transforms to upload in a frame before uploading the whole transform buffers instead.");
+
 namespace AZ
 {
     namespace Render
     {
         constexpr size_t BufferReserveCount = 1024;
 
+        // Modified transforms separated by fewer unmodified ones than this are uploaded as a single range.
+        constexpr uint32_t DirtyRangeMergeDistance = 16;
+
         void TransformServiceFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -38,8 +47,11 @@ namespace AZ
             GetParentScene()->ConnectEvent(m_updateSceneSrgHandler);
 
             m_deviceBufferNeedsUpdate = true;
+            m_deviceBufferNeedsFullUpdate = true;
             m_objectToWorldTransforms.reserve(BufferReserveCount);
             m_objectToWorldInverseTransposeTransforms.reserve(BufferReserveCount);            
+            m_instanceParameters.reserve(BufferReserveCount);
+            m_instanceParametersNeedUpdate = true;
 
             m_isWriteable = true;
 
@@ -50,16 +62,24 @@ namespace AZ
         {
             m_objectToWorldTransforms = {};
             m_objectToWorldInverseTransposeTransforms = {};
+            m_objectToWorldHistoryTransforms = {};
+            m_instanceParameters = {};
+            m_dirtyTransformIndices = {};
+            m_historyDirtyRanges = {};
+            m_historyBufferNeedsUpdate = false;
 
             m_objectToWorldBuffer = nullptr;
             m_objectToWorldInverseTransposeBuffer = nullptr;
             m_objectToWorldHistoryBuffer = nullptr;
+            m_instanceParametersBuffer = nullptr;
+            m_instanceParametersNeedUpdate = false;
 
             m_firstAvailableTransformIndex = NoAvailableTransformIndices;
 
             m_objectToWorldBufferIndex.Reset();
             m_objectToWorldInverseTransposeBufferIndex.Reset();
             m_objectToWorldHistoryBufferIndex.Reset();
+            m_objectInstanceParametersBufferIndex.Reset();
 
             m_isWriteable = false;
 
@@ -67,10 +87,12 @@ namespace AZ
             m_updateSceneSrgHandler.Disconnect();
         }
         
-        void TransformServiceFeatureProcessor::PrepareBuffers()
+        bool TransformServiceFeatureProcessor::PrepareBuffers()
         {
             AZ_Assert(!m_isWriteable, "Must be called between OnBeginPrepareRender() and OnEndPrepareRender()");
 
+            bool buffersRecreated = false;
+
             RHI::BufferDescriptor desc;
             desc.m_bindFlags = RHI::BufferBindFlags::ShaderRead;
 
@@ -93,6 +115,7 @@ namespace AZ
 
                     desc2.m_bufferName = "m_objectToWorldHistoryBuffer";
                     m_objectToWorldHistoryBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc2);
+                    buffersRecreated = true;
                 }
                 else
                 {
@@ -100,6 +123,7 @@ namespace AZ
                     {
                         m_objectToWorldBuffer->Resize(byteCount);
                         m_objectToWorldHistoryBuffer->Resize(byteCount);
+                        buffersRecreated = true;
                     }
                 }
             }
@@ -120,15 +144,114 @@ namespace AZ
                     desc2.m_elementSize = elementSize;
 
                     m_objectToWorldInverseTransposeBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc2);
+                    buffersRecreated = true;
                 }
                 else
                 {
                     if (byteCount > m_objectToWorldInverseTransposeBuffer->GetBufferSize())
                     {
                         m_objectToWorldInverseTransposeBuffer->Resize(byteCount);
+                        buffersRecreated = true;
                     }
                 }
             }
+
+            return buffersRecreated;
+        }
+
+        void TransformServiceFeatureProcessor::MarkTransformDirty(uint32_t index)
+        {
+            m_deviceBufferNeedsUpdate = true;
+            if (m_deviceBufferNeedsFullUpdate)
+            {
+                return;
+            }
+
+            // Once a large part of the transforms is modified, stop tracking them and upload everything
+            if (m_dirtyTransformIndices.size() >= m_objectToWorldTransforms.size() / 2)
+            {
+                m_deviceBufferNeedsFullUpdate = true;
+                m_dirtyTransformIndices.clear();
+                return;
+            }
+
+            m_dirtyTransformIndices.push_back(index);
+        }
+
+        bool TransformServiceFeatureProcessor::BuildDirtyRanges(TransformRangeList& ranges)
+        {
+            ranges.clear();
+            if (m_deviceBufferNeedsFullUpdate)
+            {
+                return false;
+            }
+
+            AZStd::sort(m_dirtyTransformIndices.begin(), m_dirtyTransformIndices.end());
+            for (uint32_t index : m_dirtyTransformIndices)
+            {
+                if (!ranges.empty() && index <= ranges.back().m_end + DirtyRangeMergeDistance)
+                {
+                    ranges.back().m_end = AZStd::max(ranges.back().m_end, index + 1);
+                }
+                else
+                {
+                    if (ranges.size() == r_transformServiceMaxUploadRanges)
+                    {
+                        ranges.clear();
+                        return false;
+                    }
+                    ranges.push_back({ index, index + 1 });
+                }
+            }
+            return true;
+        }
+
+        void TransformServiceFeatureProcessor::UploadTransforms(
+            RPI::Buffer& buffer, const AZStd::vector<Float4x3>& transforms, const TransformRangeList& ranges, bool fullUpload)
+        {
+            static const size_t ValueSize = sizeof(Float4x3);
+            if (fullUpload)
+            {
+                buffer.UpdateData(transforms.data(), transforms.size() * ValueSize);
+                return;
+            }
+
+            for (const TransformRange& range : ranges)
+            {
+                buffer.UpdateData(transforms.data() + range.m_begin, (range.m_end - range.m_begin) * ValueSize, range.m_begin * ValueSize);
+            }
+        }
+
+        void TransformServiceFeatureProcessor::UploadInstanceParameters()
+        {
+            if (!m_instanceParametersNeedUpdate)
+            {
+                return;
+            }
+
+            static const uint32_t ValueSize = sizeof(InstanceParametersData);
+            const uint32_t elementCount = RHI::NextPowerOfTwo(GetMax<uint32_t>(1, static_cast<uint32_t>(m_instanceParameters.size())));
+            const uint32_t byteCount = elementCount * ValueSize;
+
+            if (!m_instanceParametersBuffer)
+            {
+                RPI::CommonBufferDescriptor desc;
+                desc.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
+                desc.m_bufferName = "m_objectInstanceParametersBuffer";
+                desc.m_byteCount = byteCount;
+                desc.m_elementSize = ValueSize;
+                m_instanceParametersBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+            }
+            else if (byteCount > m_instanceParametersBuffer->GetBufferSize())
+            {
+                m_instanceParametersBuffer->Resize(byteCount);
+            }
+
+            if (!m_instanceParameters.empty())
+            {
+                m_instanceParametersBuffer->UpdateData(m_instanceParameters.data(), m_instanceParameters.size() * ValueSize);
+            }
+            m_instanceParametersNeedUpdate = false;
         }
 
         void TransformServiceFeatureProcessor::UpdateSceneSrg(RPI::ShaderResourceGroup *sceneSrg)
@@ -142,30 +265,66 @@ namespace AZ
             sceneSrg->SetBufferView(
                 m_objectToWorldHistoryBufferIndex,
                 m_objectToWorldHistoryBuffer->GetBufferView());
+            sceneSrg->SetBufferView(
+                m_objectInstanceParametersBufferIndex,
+                m_instanceParametersBuffer->GetBufferView());
         }
 
         void TransformServiceFeatureProcessor::OnBeginPrepareRender()
         {
             m_isWriteable = false;
 
+            UploadInstanceParameters();
+
             if (m_historyBufferNeedsUpdate || m_deviceBufferNeedsUpdate)
             {
-                PrepareBuffers();
+                if (PrepareBuffers())
+                {
+                    // The previous contents of the buffers are gone, so they need to be uploaded entirely
+                    m_deviceBufferNeedsUpdate = true;
+                    m_deviceBufferNeedsFullUpdate = true;
+                    m_historyBufferNeedsUpdate = true;
+                    m_historyBufferNeedsFullUpdate = true;
+                }
+
                 if (m_historyBufferNeedsUpdate)
                 {
-                    m_objectToWorldHistoryBuffer->UpdateData(m_objectToWorldHistoryTransforms.data(), m_objectToWorldHistoryTransforms.size() * TransformValueSize);
+                    // The history buffer only differs from the transforms uploaded last frame in the ranges modified then
+                    UploadTransforms(
+                        *m_objectToWorldHistoryBuffer, m_objectToWorldHistoryTransforms, m_historyDirtyRanges, m_historyBufferNeedsFullUpdate);
                     m_historyBufferNeedsUpdate = false;
+                    m_historyBufferNeedsFullUpdate = false;
                 }
 
                 if (m_deviceBufferNeedsUpdate)
                 {
-                    // copy data to the buffers
-                    m_objectToWorldBuffer->UpdateData(m_objectToWorldTransforms.data(), m_objectToWorldTransforms.size() * TransformValueSize);
-                    m_objectToWorldInverseTransposeBuffer->UpdateData(m_objectToWorldInverseTransposeTransforms.data(), m_objectToWorldInverseTransposeTransforms.size() * NormalValueSize);
+                    // copy data to the buffers, only the modified ranges when there are few enough of them
+                    TransformRangeList dirtyRanges;
+                    const bool fullUpdate = !BuildDirtyRanges(dirtyRanges);
+                    UploadTransforms(*m_objectToWorldBuffer, m_objectToWorldTransforms, dirtyRanges, fullUpdate);
+                    UploadTransforms(*m_objectToWorldInverseTransposeBuffer, m_objectToWorldInverseTransposeTransforms, dirtyRanges, fullUpdate);
 
-                    m_objectToWorldHistoryTransforms = m_objectToWorldTransforms;
+                    if (fullUpdate)
+                    {
+                        m_objectToWorldHistoryTransforms = m_objectToWorldTransforms;
+                    }
+                    else
+                    {
+                        for (const TransformRange& range : dirtyRanges)
+                        {
+                            AZStd::copy(
+                                m_objectToWorldTransforms.begin() + range.m_begin,
+                                m_objectToWorldTransforms.begin() + range.m_end,
+                                m_objectToWorldHistoryTransforms.begin() + range.m_begin);
+                        }
+                    }
+
+                    m_historyDirtyRanges = AZStd::move(dirtyRanges);
+                    m_historyBufferNeedsFullUpdate = fullUpdate;
+                    m_dirtyTransformIndices.clear();
 
                     m_deviceBufferNeedsUpdate = false;
+                    m_deviceBufferNeedsFullUpdate = false;
                     m_historyBufferNeedsUpdate = true;
                 }
             }
@@ -184,6 +343,9 @@ namespace AZ
             {
                 modelIndex = m_firstAvailableTransformIndex;
                 m_firstAvailableTransformIndex = m_objectToWorldTransforms.at(m_firstAvailableTransformIndex).m_nextFreeSlot;
+
+                // Don't let the new object inherit the parameters of the previous one
+                m_instanceParameters.at(modelIndex) = {};
             }
             else
             {
@@ -191,7 +353,9 @@ namespace AZ
                 m_objectToWorldTransforms.emplace_back();
                 m_objectToWorldInverseTransposeTransforms.emplace_back();
                 m_objectToWorldHistoryTransforms.emplace_back();
+                m_instanceParameters.emplace_back();
             }
+            m_instanceParametersNeedUpdate = true;
             return ObjectId(modelIndex);
         }
 
@@ -219,7 +383,7 @@ namespace AZ
 
                 // Inverse transpose to take the non-uniform scale out of the transform for usage with normals.
                 matrix3x4.GetInverseFull().GetTranspose3x3().StoreToRowMajorFloat12(m_objectToWorldInverseTransposeTransforms.at(id.GetIndex()).m_transform);
-                m_deviceBufferNeedsUpdate = true;
+                MarkTransformDirty(id.GetIndex());
             }
         }
 
@@ -238,5 +402,30 @@ namespace AZ
             AZ::Matrix3x4 matrix3x4 = AZ::Matrix3x4::CreateFromRowMajorFloat12(m_objectToWorldTransforms.at(id.GetIndex()).m_transform);
             return matrix3x4.RetrieveScale();
         }
+
+        void TransformServiceFeatureProcessor::SetInstanceParametersForId(ObjectId id, const InstanceParameters& parameters)
+        {
+            AZ_Error("TransformServiceFeatureProcessor", m_isWriteable, "Transform data cannot be written to during this phase");
+            AZ_Error("TransformServiceFeatureProcessor", id.IsValid(), "Attempting to set the instance parameters for an invalid handle.");
+            if (id.IsValid())
+            {
+                InstanceParametersData& data = m_instanceParameters.at(id.GetIndex());
+                parameters.m_tint.StoreToFloat4(data.m_tint);
+                parameters.m_uvOffset.StoreToFloat2(data.m_uvOffset);
+                parameters.m_custom.StoreToFloat4(data.m_custom);
+                m_instanceParametersNeedUpdate = true;
+            }
+        }
+
+        TransformServiceFeatureProcessor::InstanceParameters TransformServiceFeatureProcessor::GetInstanceParametersForId(ObjectId id) const
+        {
+            AZ_Error("TransformServiceFeatureProcessor", id.IsValid(), "Attempting to get the instance parameters for an invalid handle.");
+            const InstanceParametersData& data = m_instanceParameters.at(id.GetIndex());
+            InstanceParameters parameters;
+            parameters.m_tint = AZ::Color::CreateFromFloat4(data.m_tint);
+            parameters.m_uvOffset = AZ::Vector2::CreateFromFloat2(data.m_uvOffset);
+            parameters.m_custom = AZ::Vector4::CreateFromFloat4(data.m_custom);
+            return parameters;
+        }
     }
 }
@@ -48,6 +48,8 @@ namespace AZ
                 const AZ::Vector3& nonUniformScale = AZ::Vector3::CreateOne()) override;
             AZ::Transform GetTransformForId(ObjectId id) const override;
             AZ::Vector3 GetNonUniformScaleForId(ObjectId id) const override;
+            void SetInstanceParametersForId(ObjectId id, const InstanceParameters& parameters) override;
+            InstanceParameters GetInstanceParametersForId(ObjectId id) const override;
 
         private:
 
@@ -61,11 +63,41 @@ namespace AZ
             // Flag value for when the buffers have no empty spaces.
             static const uint32_t NoAvailableTransformIndices = std::numeric_limits<uint32_t>::max();
 
+            // Range of transform indices [m_begin, m_end) to upload to the GPU buffers.
+            struct TransformRange
+            {
+                uint32_t m_begin;
+                uint32_t m_end;
+            };
+            using TransformRangeList = AZStd::vector<TransformRange>;
+
+            // GPU layout of InstanceParameters, the uv offset is padded to a float4.
+            struct InstanceParametersData
+            {
+                float m_tint[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+                float m_uvOffset[4] = { 0.0f };
+                float m_custom[4] = { 0.0f };
+            };
+
             TransformServiceFeatureProcessor(const TransformServiceFeatureProcessor&) = delete;
 
             // Prepare GPU buffers for object transformation matrices
             // Create the buffers if they don't exist. Otherwise, resize them if they are not large enough for the matrices
-            void PrepareBuffers();
+            // Returns true if any buffer was created or resized, in which case its previous contents are lost.
+            bool PrepareBuffers();
+
+            // Records a modified transform so that only the modified ranges get uploaded.
+            void MarkTransformDirty(uint32_t index);
+
+            // Sorts and merges the modified transforms into ranges. Returns false if uploading the whole buffer is cheaper.
+            bool BuildDirtyRanges(TransformRangeList& ranges);
+
+            // Uploads the given ranges of transforms to the buffer, or all of them if fullUpload is true.
+            static void UploadTransforms(
+                RPI::Buffer& buffer, const AZStd::vector<Float4x3>& transforms, const TransformRangeList& ranges, bool fullUpload);
+
+            // Creates or resizes the instance parameters buffer and uploads all the parameters, if any was modified.
+            void UploadInstanceParameters();
 
             void UpdateSceneSrg(RPI::ShaderResourceGroup *sceneSrg);
 
@@ -73,6 +105,7 @@ namespace AZ
             RHI::ShaderInputNameIndex m_objectToWorldBufferIndex = "m_objectToWorldBuffer";
             RHI::ShaderInputNameIndex m_objectToWorldInverseTransposeBufferIndex = "m_objectToWorldInverseTransposeBuffer";
             RHI::ShaderInputNameIndex m_objectToWorldHistoryBufferIndex = "m_objectToWorldHistoryBuffer";
+            RHI::ShaderInputNameIndex m_objectInstanceParametersBufferIndex = "m_objectInstanceParametersBuffer";
 
             // Stores transforms that are uploaded to a GPU buffer. Used slots have float12(matrix3x4) values, empty slots
             // have a uint32_t that points to the next empty slot like a linked list. m_firstAvailableMeshTransformIndex stores the first
@@ -89,9 +122,22 @@ namespace AZ
             Data::Instance<RPI::Buffer> m_objectToWorldInverseTransposeBuffer;
             Data::Instance<RPI::Buffer> m_objectToWorldHistoryBuffer;
 
+            // Instance parameters of each object, in the same slots as the transforms. They rarely change, so the whole buffer is
+            // uploaded when any of them is modified.
+            AZStd::vector<InstanceParametersData> m_instanceParameters;
+            Data::Instance<RPI::Buffer> m_instanceParametersBuffer;
+            bool m_instanceParametersNeedUpdate = false;
+
+            // Transforms modified since the last upload, and the ranges the history buffer still needs to catch up with.
+            // When too many transforms are modified, the whole buffers are uploaded instead.
+            AZStd::vector<uint32_t> m_dirtyTransformIndices;
+            TransformRangeList m_historyDirtyRanges;
+
             uint32_t m_firstAvailableTransformIndex = NoAvailableTransformIndices;
             bool m_deviceBufferNeedsUpdate = false;
+            bool m_deviceBufferNeedsFullUpdate = false;
             bool m_historyBufferNeedsUpdate = false;
+            bool m_historyBufferNeedsFullUpdate = false;
             bool m_isWriteable = true;     //prevents write access during certain parts of the frame (for threadsafety)
         };
     }
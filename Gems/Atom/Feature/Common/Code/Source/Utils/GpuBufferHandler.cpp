@@ -81,6 +81,9 @@ namespace AZ
                 m_buffer->Resize(byteCount);
             }
 
+            m_dirtyBegin = AZStd::numeric_limits<uint32_t>::max();
+            m_dirtyEnd = 0;
+
             if (dataSize > 0)
             {
                 return m_buffer->UpdateData(data, dataSize, 0);
@@ -88,6 +91,44 @@ namespace AZ
             return true;
         }
 
+        void GpuBufferHandler::MarkElementDirty(uint32_t elementIndex)
+        {
+            m_dirtyBegin = GetMin(m_dirtyBegin, elementIndex);
+            m_dirtyEnd = GetMax(m_dirtyEnd, elementIndex + 1);
+        }
+
+        bool GpuBufferHandler::UpdateDirtyElements(uint32_t elementCount, const void* data)
+        {
+            if (!IsValid())
+            {
+                return false;
+            }
+
+            const uint32_t dirtyEnd = GetMin(m_dirtyEnd, elementCount);
+            if (elementCount == m_elementCount && m_dirtyBegin >= dirtyEnd)
+            {
+                return true;
+            }
+
+            if (elementCount * m_elementSize > m_buffer->GetBufferSize())
+            {
+                return UpdateBuffer(elementCount, data);
+            }
+
+            m_elementCount = elementCount;
+            const uint32_t dirtyBegin = m_dirtyBegin;
+            m_dirtyBegin = AZStd::numeric_limits<uint32_t>::max();
+            m_dirtyEnd = 0;
+
+            if (dirtyBegin < dirtyEnd)
+            {
+                const uint32_t byteOffset = dirtyBegin * m_elementSize;
+                return m_buffer->UpdateData(
+                    static_cast<const uint8_t*>(data) + byteOffset, (dirtyEnd - dirtyBegin) * m_elementSize, byteOffset);
+            }
+            return true;
+        }
+
         bool GpuBufferHandler::UpdateBuffer(const AZStd::unordered_map<int, const void*>& data, uint32_t elementCount)
         {
             if (!IsValid())
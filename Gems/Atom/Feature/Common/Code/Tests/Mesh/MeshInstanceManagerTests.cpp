@@ -143,4 +143,32 @@ namespace UnitTest
         AZ_TEST_STOP_TRACE_SUPPRESSION(1);
     }
 
+    TEST_F(MeshInstanceManagerTestFixture, Statistics)
+    {
+        // Same mesh and material as the first key with a different sort key, plus a mesh that can't be instanced
+        const MeshInstanceGroupKey sortKeySplitKey{ modelIdA, testLodIndex, testMeshIndex, materialIdA, Uuid::CreateNull(), 1 };
+        const MeshInstanceGroupKey forcedUniqueKey{ modelIdB, testLodIndex, testMeshIndex, materialIdA, Uuid::CreateRandom(), testSortKey };
+        m_meshInstanceManager.AddInstance(sortKeySplitKey);
+        m_meshInstanceManager.AddInstance(forcedUniqueKey);
+        m_meshInstanceManager.AddInstance(m_uniqueKeys[0]);
+
+        const MeshInstanceManager::Statistics statistics = m_meshInstanceManager.GetStatistics();
+        EXPECT_EQ(statistics.m_groupCount, 6);
+        EXPECT_EQ(statistics.m_instanceCount, 7);
+        EXPECT_EQ(statistics.m_singleInstanceGroupCount, 5);
+        EXPECT_EQ(statistics.m_forcedUniqueGroupCount, 1);
+        // Each model uses two materials
+        EXPECT_EQ(statistics.m_materialSplitCount, 2);
+        EXPECT_EQ(statistics.m_sortKeySplitCount, 1);
+
+        m_meshInstanceManager.RemoveInstance(sortKeySplitKey);
+        m_meshInstanceManager.RemoveInstance(forcedUniqueKey);
+        m_meshInstanceManager.RemoveInstance(m_uniqueKeys[0]);
+        for (size_t i = 0; i < m_uniqueKeys.size(); ++i)
+        {
+            m_meshInstanceManager.RemoveInstance(m_uniqueKeys[i]);
+        }
+        EXPECT_EQ(m_meshInstanceManager.GetInstanceGroupCount(), 0);
+    }
+
 } // namespace UnitTest
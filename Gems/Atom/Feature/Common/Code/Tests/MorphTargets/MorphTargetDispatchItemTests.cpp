@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <MorphTargets/MorphTargetDispatchItem.h>
+
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/UnitTest.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    static constexpr float MinDisplacement = 0.0001f;
+
+    static MorphTargetComputeMetaData CreateMetaData(float minDelta, float maxDelta)
+    {
+        MorphTargetComputeMetaData metaData{};
+        metaData.m_minWeight = 0.0f;
+        metaData.m_maxWeight = 1.0f;
+        metaData.m_minDelta = minDelta;
+        metaData.m_maxDelta = maxDelta;
+        metaData.m_vertexCount = 1;
+        metaData.m_meshIndex = 0;
+        return metaData;
+    }
+
+    TEST(MorphTargetDispatchItemTest, IsMorphTargetDisplacementVisible_NoWeight_NotDispatched)
+    {
+        const MorphTargetComputeMetaData metaData = CreateMetaData(-1.0f, 1.0f);
+        EXPECT_FALSE(IsMorphTargetDisplacementVisible(0.0f, metaData, MinDisplacement));
+        EXPECT_FALSE(IsMorphTargetDisplacementVisible(-0.5f, metaData, MinDisplacement));
+
+        // Without a minimum displacement, any weight is dispatched
+        EXPECT_FALSE(IsMorphTargetDisplacementVisible(0.0f, metaData, 0.0f));
+        EXPECT_TRUE(IsMorphTargetDisplacementVisible(0.001f, metaData, 0.0f));
+    }
+
+    TEST(MorphTargetDispatchItemTest, IsMorphTargetDisplacementVisible_ResidualWeight_NotDispatched)
+    {
+        // A facial rig target moving vertices up to 2cm, left at a residual weight of 0.1%: 0.02mm at most
+        const MorphTargetComputeMetaData metaData = CreateMetaData(-0.01f, 0.02f);
+        EXPECT_FALSE(IsMorphTargetDisplacementVisible(0.001f, metaData, MinDisplacement));
+
+        // 1% moves vertices up to 0.2mm
+        EXPECT_TRUE(IsMorphTargetDisplacementVisible(0.01f, metaData, MinDisplacement));
+        EXPECT_TRUE(IsMorphTargetDisplacementVisible(1.0f, metaData, MinDisplacement));
+    }
+
+    TEST(MorphTargetDispatchItemTest, IsMorphTargetDisplacementVisible_LargestDeltaNegative_UsesItsMagnitude)
+    {
+        // Only the negative delta is large enough for the weighted displacement to be visible
+        const MorphTargetComputeMetaData metaData = CreateMetaData(-0.5f, 0.001f);
+        EXPECT_TRUE(IsMorphTargetDisplacementVisible(0.01f, metaData, MinDisplacement));
+
+        const MorphTargetComputeMetaData smallMetaData = CreateMetaData(-0.001f, 0.001f);
+        EXPECT_FALSE(IsMorphTargetDisplacementVisible(0.01f, smallMetaData, MinDisplacement));
+    }
+
+    TEST(MorphTargetDispatchItemTest, IsMorphTargetDisplacementVisible_NoDeltas_NotDispatched)
+    {
+        const MorphTargetComputeMetaData metaData = CreateMetaData(0.0f, 0.0f);
+        EXPECT_FALSE(IsMorphTargetDisplacementVisible(1.0f, metaData, MinDisplacement));
+    }
+} // namespace UnitTest
@@ -135,6 +135,8 @@ set(FILES
     Source/Mesh/MeshInstanceManager.h
     Source/Mesh/MeshFeatureProcessor.cpp
     Source/Mesh/MeshFeatureProcessor.h
+    Source/Mesh/MeshGpuCullingPass.cpp
+    Source/Mesh/MeshGpuCullingPass.h
     Source/Mesh/ModelReloader.cpp
     Source/Mesh/ModelReloader.h
     Source/Mesh/ModelReloaderSystem.cpp
@@ -12,6 +12,7 @@ set(FILES
     Tests/CoreLights/ShadowmapAtlasTest.cpp
     Tests/IndexedDataVectorTests.cpp
     Tests/Mesh/MeshInstanceManagerTests.cpp
+    Tests/MorphTargets/MorphTargetDispatchItemTests.cpp
     Tests/MultiIndexedDataVectorTests.cpp
     Tests/IndexableListTests.cpp
     Tests/SparseVectorTests.cpp
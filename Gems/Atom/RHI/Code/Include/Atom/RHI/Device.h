@@ -25,6 +25,7 @@
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/time.h>
 
 namespace AZ::RHI
 {
@@ -128,6 +129,16 @@ namespace AZ::RHI
         //! Converts a GPU timestamp to microseconds
         virtual AZStd::chrono::microseconds GpuTimestampToMicroseconds(uint64_t gpuTimestamp, HardwareQueueClass queueClass) const = 0;
 
+        //! Samples the GPU timestamp counter of a queue and the CPU clock (AZStd::GetTimeNowTicks) at the same moment, so GPU
+        //! timestamps can be placed on the CPU timeline. Returns false if the platform can't calibrate the clocks.
+        virtual bool GetCalibratedTimestamps(
+            [[maybe_unused]] HardwareQueueClass queueClass,
+            [[maybe_unused]] uint64_t& gpuTimestamp,
+            [[maybe_unused]] AZStd::sys_time_t& cpuTimestamp) const
+        {
+            return false;
+        }
+
         //! Called before the device is going to be shutdown. This lets the device release any resources
         //! that also hold on to a Ptr to Device.
         virtual void PreShutdown() = 0;
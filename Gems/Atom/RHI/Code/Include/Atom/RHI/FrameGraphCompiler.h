@@ -8,6 +8,7 @@
 #pragma once
 
 #include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
+#include <Atom/RHI.Reflect/TransientAttachmentStatistics.h>
 #include <Atom/RHI/Object.h>
 #include <Atom/RHI/ObjectCache.h>
 #include <Atom/RHI/Image.h>
@@ -105,6 +106,9 @@ namespace AZ::RHI
 
         /// Flags controlling statistics of the pools.
         FrameSchedulerStatisticsFlags m_statisticsFlags = FrameSchedulerStatisticsFlags::None;
+
+        /// Controls whether the platform scope compilation is allowed to use jobs.
+        JobPolicy m_jobPolicy = JobPolicy::Serial;
     };
 
     //! FrameGraphCompiler controls compilation of FrameGraph each frame. FrameScheduler owns
@@ -112,8 +116,10 @@ namespace AZ::RHI
     //! Platform implementations, on the other hand, are required to override this class in order to perform
     //! platform-specific scope construction.
     //!
-    //! The compiler is designed to be invoked every frame; the graph is simply rebuilt each time. The compile
-    //! operation is also done on a single thread; so overhead should be kept to a minimum.
+    //! The compiler is designed to be invoked every frame; the graph is simply rebuilt each time. Since the topology
+    //! of the graph rarely changes between frames, the compiler hashes the scopes, their attachments and the transient
+    //! attachment descriptors, and reuses the results of the previous compilation that only depend on them (queue-centric
+    //! graph edges, transient attachment lifetimes and aliasing commands, memory hints) while the hash is unchanged.
     //!
     //! The RHI base class performs platform-independent compilation before passing control down to the derived
     //! platform implementation. The provided FrameGraph instance is compiled in-place according to the
@@ -206,7 +212,8 @@ namespace AZ::RHI
 
         void CompileQueueCentricScopeGraph(
             FrameGraph& frameGraph,
-            FrameSchedulerCompileFlags compileFlags);
+            FrameSchedulerCompileFlags compileFlags,
+            bool reuseCompiledGraph);
 
         void ExtendTransientAttachmentAsyncQueueLifetimes(
             FrameGraph& frameGraph,
@@ -237,10 +244,24 @@ namespace AZ::RHI
             FrameGraph& frameGraph,
             AZ::RHI::TransientAttachmentPool& transientAttachmentPool,
             FrameSchedulerCompileFlags compileFlags,
-            FrameSchedulerStatisticsFlags statisticsFlags);
+            FrameSchedulerStatisticsFlags statisticsFlags,
+            bool reuseCompiledGraph);
 
         void CompileResourceViews(const FrameGraphAttachmentDatabase& attachmentDatabase);
 
+        //! Compiles the platform-specific data of each scope, in parallel if the job policy allows it.
+        void CompileScopes(FrameGraph& frameGraph, JobPolicy jobPolicy);
+
+        //! Returns a hash of everything the cached compilation results depend on.
+        HashValue64 ComputeTopologyHash(const FrameGraph& frameGraph, FrameSchedulerCompileFlags compileFlags) const;
+
+        //! Records the lifetimes of the transient attachments, or applies the recorded ones when reusing the cached compilation.
+        template<class T>
+        void RecordTransientAttachmentLifetimes(const AZStd::vector<T*>& frameAttachments, AZStd::vector<uint32_t>& lifetimes);
+        template<class T>
+        void ApplyTransientAttachmentLifetimes(
+            const AZStd::vector<Scope*>& scopes, const AZStd::vector<T*>& frameAttachments, const AZStd::vector<uint32_t>& lifetimes);
+
         //! Remove the entry related to the provided ReverseLookupObjectType from the appropriate cache as it is probably stale now
         template<typename ReverseLookupObjectType, typename ObjectCacheType>
         void RemoveFromCache(ReverseLookupObjectType objectToRemove,
@@ -260,5 +281,30 @@ namespace AZ::RHI
         // once they have been replaced with a new view instance. 
         AZStd::unordered_map<ImageResourceViewData, HashValue64> m_imageReverseLookupHash;
         AZStd::unordered_map<BufferResourceViewData, HashValue64> m_bufferReverseLookupHash;
+
+        //! Results of the previous compilation that only depend on the graph topology.
+        struct CompiledGraphCache
+        {
+            static constexpr uint32_t InvalidScopeIndex = static_cast<uint32_t>(-1);
+
+            HashValue64 m_topologyHash = HashValue64{ 0 };
+            bool m_isValid = false;
+
+            //! Producer and consumer scope indices linked by the queue-centric scope graph compilation.
+            AZStd::vector<AZStd::pair<uint32_t, uint32_t>> m_queueLinks;
+
+            //! First and last scope index of each transient attachment on each device, after the lifetimes were extended.
+            AZStd::vector<uint32_t> m_transientBufferLifetimes;
+            AZStd::vector<uint32_t> m_transientImageLifetimes;
+
+            //! The sorted activation and deactivation commands of the transient attachments.
+            AZStd::vector<uint32_t> m_transientCommands;
+            AZStd::vector<AZStd::pair<int, uint32_t>> m_removedTransientBuffers;
+            AZStd::vector<AZStd::pair<int, uint32_t>> m_removedTransientImages;
+
+            //! Memory usage gathered by the statistics pass of pools using the memory hint heap strategy, per device.
+            AZStd::unordered_map<int, TransientAttachmentStatistics::MemoryUsage> m_memoryHints;
+        };
+        CompiledGraphCache m_compiledGraphCache;
     };
 }
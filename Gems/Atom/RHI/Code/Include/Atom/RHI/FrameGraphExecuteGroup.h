@@ -12,6 +12,7 @@
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/time.h>
 
 namespace AZ::RHI
 {
@@ -54,6 +55,10 @@ namespace AZ::RHI
         //! If parallel, they may be called independently from any thread.
         JobPolicy GetJobPolicy() const;
 
+        //! Returns the CPU time spent recording the context at index \param contextIndex, in ticks.
+        //! Only valid once the context has ended.
+        AZStd::sys_time_t GetContextRecordTime(uint32_t contextIndex) const;
+
     protected:
         FrameGraphExecuteGroup() = default;
 
@@ -133,6 +138,8 @@ namespace AZ::RHI
 
         JobPolicy m_jobPolicy = JobPolicy::Serial;
         AZStd::vector<FrameGraphExecuteContext> m_contexts;
+        //! Time each context began recording, replaced by the record duration when the context ends.
+        AZStd::vector<AZStd::sys_time_t> m_contextRecordTimes;
         AZStd::atomic_int m_contextCountActive = { 0 };
         AZStd::atomic_int m_contextCountCompleted = { 0 };
         AZStd::atomic_bool m_isSubmittable = { false };
@@ -11,11 +11,25 @@
 #include <Atom/RHI/FrameGraphExecuteGroup.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <Atom/RHI.Reflect/PlatformLimitsDescriptor.h>
+#include <AzCore/std/containers/unordered_map.h>
 
 namespace AZ::RHI
 {
     class FrameGraph;
 
+    //! CPU cost of recording a scope, measured over the previous frames.
+    struct ScopeRecordStatistics
+    {
+        //! Average time spent recording the scope each frame, in microseconds, summed over all its command lists.
+        float m_recordTimeUs = 0.0f;
+
+        //! Average number of items submitted by the scope each frame.
+        float m_itemCount = 0.0f;
+
+        //! Number of command lists the scope was recorded with in the last frame it was executed.
+        uint32_t m_commandListCount = 0;
+    };
+
     //! Fill this descriptor when initializing a FrameScheduler instance.
     struct FrameGraphExecuterDescriptor
     {
@@ -103,6 +117,9 @@ namespace AZ::RHI
         //! resets all state held by the executer.
         void End();
 
+        //! Returns the record cost measured for the scope in previous frames, or null if the scope wasn't recorded yet.
+        const ScopeRecordStatistics* GetScopeRecordStatistics(const ScopeId& scopeId) const;
+
     protected:
         FrameGraphExecuter() = default;
 
@@ -120,6 +137,20 @@ namespace AZ::RHI
         //! Returns a list of the registered execute groups.
         AZStd::span<const AZStd::unique_ptr<FrameGraphExecuteGroup>> GetGroups() const;
 
+        //! Returns the time in microseconds the scope is expected to take to record the given number of items,
+        //! based on the cost measured in previous frames. Returns a negative value if the scope wasn't measured yet
+        //! or auto balancing is disabled (r_frameGraphExecuterAutoBalance).
+        float GetPredictedRecordTime(const ScopeId& scopeId, uint32_t itemCount) const;
+
+        //! Returns the record time in microseconds a single command list should take, so that the record work
+        //! of the previous frame would have been evenly spread over the job worker threads.
+        float GetCommandListRecordTimeTarget() const;
+
+        //! Returns the number of command lists to record the scope with, balanced from the record cost measured in
+        //! previous frames. Returns @param fallbackCommandListCount if the scope wasn't measured yet.
+        uint32_t GetBalancedCommandListCount(
+            const ScopeId& scopeId, uint32_t itemCount, uint32_t fallbackCommandListCount, uint32_t commandListCountMax) const;
+
     private:
         //////////////////////////////////////////////////////////////////////////
         // Platform API
@@ -151,6 +182,13 @@ namespace AZ::RHI
 
         FrameGraphExecuterDescriptor m_descriptor;
 
+        //! Record cost of each scope accumulated over the frame being executed, guarded by m_pendingContextGroupLock.
+        AZStd::unordered_map<ScopeId, ScopeRecordStatistics> m_frameRecordStatistics;
+
+        //! Record cost of each scope averaged over previous frames.
+        AZStd::unordered_map<ScopeId, ScopeRecordStatistics> m_recordStatistics;
+
+        float m_commandListRecordTimeTarget = 0.0f;
     };
 
     template <typename FrameGraphExecuteGroupType>
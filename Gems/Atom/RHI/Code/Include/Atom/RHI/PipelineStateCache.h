@@ -10,9 +10,12 @@
 #include <Atom/RHI/PipelineState.h>
 #include <Atom/RHI/PipelineLibrary.h>
 #include <Atom/RHI/ThreadLocalContext.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/containers/bitset.h>
 #include <AzCore/Utils/TypeHash.h>
 
+AZ_CVAR_EXTERNED(bool, r_asyncPipelineStateCompilation);
+
 namespace UnitTest
 {
     class PipelineStateTests;
@@ -120,6 +123,13 @@ namespace AZ::RHI
     //!      This is the fast-path case where multiple threads are now able to resolve pipeline states with very
     //!      little performance overhead.
     //!
+    //!  4. A thread requests an un-cached pipeline state with AcquirePipelineStateAsync:
+    //!
+    //!      The pipeline state is allocated into a global set of compiling pipeline states, and compiled by a job
+    //!      using the thread-local PipelineLibrary of the worker thread. Null is returned until the job completes and
+    //!      moves the pipeline state into the pending cache, so the caller can render with a fallback in the meantime.
+    //!      The number of compilations in flight is limited by r_maxConcurrentPipelineStateCompiles.
+    //!
     //! Example Usage:
     //! @code{.cpp}
     //!      // Create library instance.
@@ -178,6 +188,13 @@ namespace AZ::RHI
         const PipelineState* AcquirePipelineState(
             PipelineLibraryHandle library, const PipelineStateDescriptor& descriptor, const AZ::Name& name = AZ::Name());
 
+        //! Acquires a pipeline state like AcquirePipelineState, but compiles it on a worker thread if it isn't cached yet.
+        //! Returns null while the pipeline state is compiling, or when too many pipeline states are already compiling. The
+        //! caller is expected to use a fallback (i.e. the root shader variant) and acquire the pipeline state again on a later frame.
+        //! Behaves like AcquirePipelineState when r_asyncPipelineStateCompilation is disabled or the job system isn't available.
+        const PipelineState* AcquirePipelineStateAsync(
+            PipelineLibraryHandle library, const PipelineStateDescriptor& descriptor, const AZ::Name& name = AZ::Name());
+
         //! This method merges the global pending cache into the global read-only cache and clears all thread-local caches.
         //! This reduces the total memory footprint of the caches and optimizes subsequent fetches. This method should be called
         //! once per frame.
@@ -200,6 +217,10 @@ namespace AZ::RHI
             // Tracks the number of pipeline states actively being compiled across all threads.
             AZStd::atomic_uint32_t m_pendingCompileCount = {0};
 
+            // Pipeline states compiling on worker threads. They are moved to the pending cache once compiled.
+            // Guarded by m_pendingCacheMutex.
+            PipelineStateSet m_asyncCompileCache;
+
             // Contains the initial serialized data (Used to prime the thread libraries)
             // or the file name that contains the serialized data
             PipelineLibraryDescriptor m_pipelineLibraryDescriptor;
@@ -239,6 +260,17 @@ namespace AZ::RHI
             PipelineStateHash pipelineStateHash,
             const AZ::Name& name);
 
+        //! Compiles a pipeline state requested by AcquirePipelineStateAsync. Runs on a worker thread.
+        void CompilePipelineStateAsync(
+            PipelineLibraryHandle handle,
+            Ptr<PipelineState> pipelineState,
+            const PipelineStateEntry::PipelineStateDescriptorVariant& descriptorVariant,
+            PipelineStateHash pipelineStateHash,
+            const AZ::Name& name);
+
+        //! Lazily initializes the thread-local pipeline library on first access.
+        void InitThreadLibrary(const GlobalLibraryEntry& globalLibraryEntry, ThreadLibraryEntry& threadLibraryEntry) const;
+
         //! Resets the library without validating the handle or taking a lock.
         void ResetLibraryImpl(PipelineLibraryHandle handle);
 
@@ -251,6 +283,13 @@ namespace AZ::RHI
         /// This mutex guards library creation / reset / deletion.
         mutable AZStd::shared_mutex m_mutex;
 
+        /// Held shared by the pipeline states compiling on worker threads, and exclusively (before m_mutex) when
+        /// resetting or merging libraries, so thread libraries aren't modified while they are compiling.
+        mutable AZStd::shared_mutex m_asyncCompileMutex;
+
+        /// Number of pipeline states compiling on worker threads across all libraries.
+        AZStd::atomic_uint32_t m_asyncCompileCount = { 0 };
+
         /// The set of library entries. The RHI::PipelineLibraryHandle maps into this array.
         GlobalLibrarySet m_globalLibrarySet;
 
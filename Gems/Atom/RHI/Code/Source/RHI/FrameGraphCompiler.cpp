@@ -17,12 +17,22 @@
 #include <Atom/RHI/Scope.h>
 #include <Atom/RHI/SwapChainFrameAttachment.h>
 #include <Atom/RHI/TransientAttachmentPool.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/optional.h>
+#include <AzCore/Utils/TypeHash.h>
 
 namespace AZ::RHI
 {
+    AZ_CVAR(bool, r_frameGraphCompilerReuseCompiledGraph, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Reuse the topology dependent results of the previous frame graph compilation while the topology doesn't change");
+    AZ_CVAR(uint32_t, r_frameGraphCompilerScopesPerJob, 16, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Controls the number of scopes compiled by each job when the frame graph compilation is allowed to use jobs");
+
     ResultCode FrameGraphCompiler::Init()
     {
         const ResultCode resultCode = InitInternal();
@@ -46,6 +56,7 @@ namespace AZ::RHI
         m_bufferViewCache.Clear();
         m_imageReverseLookupHash.clear();
         m_bufferReverseLookupHash.clear();
+        m_compiledGraphCache = {};
 
         ShutdownInternal();
     }
@@ -78,6 +89,9 @@ namespace AZ::RHI
 
     // The entry point for FrameGraph compilation. Frame Graph compilation is broken into several phases:
     //
+    // The results of phases 1 and 2 that only depend on the graph topology are cached, and reused by the next compilation
+    // if its topology hash matches.
+    //
     //      1) Queue-Centric Scope Graph Compilation:
     //
     //          This phase takes the scope graph and compiles a queue-centric scope graph. The former is a simple
@@ -111,36 +125,87 @@ namespace AZ::RHI
 
         FrameGraph& frameGraph = *request.m_frameGraph;
 
+        const HashValue64 topologyHash = ComputeTopologyHash(frameGraph, request.m_compileFlags);
+        const bool reuseCompiledGraph =
+            r_frameGraphCompilerReuseCompiledGraph && m_compiledGraphCache.m_isValid && m_compiledGraphCache.m_topologyHash == topologyHash;
+        if (!reuseCompiledGraph)
+        {
+            m_compiledGraphCache = {};
+            m_compiledGraphCache.m_topologyHash = topologyHash;
+        }
+
         /// [Phase 1] Compiles the cross-queue scope graph.
-        CompileQueueCentricScopeGraph(frameGraph, request.m_compileFlags);
+        CompileQueueCentricScopeGraph(frameGraph, request.m_compileFlags, reuseCompiledGraph);
 
         /// [Phase 2] Compile transient attachments across all scopes.
         CompileTransientAttachments(
             frameGraph,
             *request.m_transientAttachmentPool,
             request.m_compileFlags,
-            request.m_statisticsFlags);
+            request.m_statisticsFlags,
+            reuseCompiledGraph);
+
+        m_compiledGraphCache.m_isValid = true;
 
         /// [Phase 3] Compiles buffer / image views and assigns them to scope attachments.
         CompileResourceViews(frameGraph.GetAttachmentDatabase());
 
         /// [Phase 4] Compile platform-specific scope data after all attachments and views have been compiled.
+        CompileScopes(frameGraph, request.m_jobPolicy);
+
+        /// Perform platform-specific compilation.
+        return CompileInternal(request);
+    }
+
+    HashValue64 FrameGraphCompiler::ComputeTopologyHash(const FrameGraph& frameGraph, FrameSchedulerCompileFlags compileFlags) const
+    {
+        AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: ComputeTopologyHash");
+
+        HashValue64 hash = TypeHash64(compileFlags);
+        hash = TypeHash64(RHISystemInterface::Get()->GetDeviceCount(), hash);
+
+        for (const Scope* scope : frameGraph.GetScopes())
         {
-            AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: Scope Compile");
+            const uint32_t scopeData[] = { scope->GetId().GetHash(),
+                                           static_cast<uint32_t>(scope->GetHardwareQueueClass()),
+                                           static_cast<uint32_t>(scope->GetDeviceIndex()),
+                                           scope->GetFrameGraphGroupId().GetIndex() };
+            hash = TypeHash64(scopeData, hash);
 
-            for (Scope* scope : frameGraph.GetScopes())
+            for (const ScopeAttachment* scopeAttachment : scope->GetAttachments())
             {
-                scope->Compile();
+                const uint32_t attachmentData[] = { scopeAttachment->GetFrameAttachment().GetId().GetHash(),
+                                                    static_cast<uint32_t>(scopeAttachment->GetUsage()),
+                                                    static_cast<uint32_t>(scopeAttachment->GetAccess()) };
+                hash = TypeHash64(attachmentData, hash);
+            }
+
+            // Consumers also include the dependencies that aren't declared through attachments
+            for (const Scope* consumer : frameGraph.GetConsumers(*scope))
+            {
+                hash = TypeHash64(consumer->GetIndex(), hash);
             }
         }
 
-        /// Perform platform-specific compilation.
-        return CompileInternal(request);
+        const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+        for (const BufferFrameAttachment* transientBuffer : attachmentDatabase.GetTransientBufferAttachments())
+        {
+            hash = TypeHash64(transientBuffer->GetId().GetHash(), hash);
+            hash = transientBuffer->GetBufferDescriptor().GetHash(hash);
+        }
+        for (const ImageFrameAttachment* transientImage : attachmentDatabase.GetTransientImageAttachments())
+        {
+            hash = TypeHash64(transientImage->GetId().GetHash(), hash);
+            hash = TypeHash64(transientImage->GetSupportedQueueMask(), hash);
+            hash = transientImage->GetImageDescriptor().GetHash(hash);
+        }
+        return hash;
     }
 
     void FrameGraphCompiler::CompileQueueCentricScopeGraph(
         FrameGraph& frameGraph,
-        FrameSchedulerCompileFlags compileFlags)
+        FrameSchedulerCompileFlags compileFlags,
+        bool reuseCompiledGraph)
     {
         AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: CompileQueueCentricScopeGraph");
 
@@ -153,6 +218,23 @@ namespace AZ::RHI
             }
         }
 
+        const auto& scopes = frameGraph.GetScopes();
+        if (reuseCompiledGraph)
+        {
+            for (const auto& [producerIndex, consumerIndex] : m_compiledGraphCache.m_queueLinks)
+            {
+                Scope::LinkProducerConsumerByQueues(scopes[producerIndex], scopes[consumerIndex]);
+            }
+            return;
+        }
+
+        // Links the scopes and records the link for the next compilations of the same graph
+        auto linkProducerConsumerByQueues = [this](Scope* producer, Scope* consumer)
+        {
+            Scope::LinkProducerConsumerByQueues(producer, consumer);
+            m_compiledGraphCache.m_queueLinks.emplace_back(producer->GetIndex(), consumer->GetIndex());
+        };
+
         // Build the per-queue graph by first linking scopes on the same queue
         // with their neighbors. This is because the queue is going to execute serially.
         {
@@ -164,7 +246,7 @@ namespace AZ::RHI
                 {
                     if (producer[hardwareQueueClassIdx]->GetDeviceIndex() == consumer->GetDeviceIndex())
                     {
-                        Scope::LinkProducerConsumerByQueues(producer[hardwareQueueClassIdx], consumer);
+                        linkProducerConsumerByQueues(producer[hardwareQueueClassIdx], consumer);
                     }
                 }
                 producer[hardwareQueueClassIdx] = consumer;
@@ -216,7 +298,7 @@ namespace AZ::RHI
                     {
                         if (producerScopeLast->GetDeviceIndex() == currentScope->GetDeviceIndex())
                         {
-                            Scope::LinkProducerConsumerByQueues(producerScopeLast, currentScope);
+                            linkProducerConsumerByQueues(producerScopeLast, currentScope);
                         }
                     }
                 }
@@ -537,11 +619,53 @@ namespace AZ::RHI
         }
     }
 
+    template<class T>
+    void FrameGraphCompiler::RecordTransientAttachmentLifetimes(const AZStd::vector<T*>& frameAttachments, AZStd::vector<uint32_t>& lifetimes)
+    {
+        const int deviceCount = RHISystemInterface::Get()->GetDeviceCount();
+        lifetimes.clear();
+        lifetimes.reserve(frameAttachments.size() * deviceCount * 2);
+        for (T* transientResource : frameAttachments)
+        {
+            for (int deviceIndex{ 0 }; deviceIndex < deviceCount; ++deviceIndex)
+            {
+                const Scope* firstScope = transientResource->GetFirstScope(deviceIndex);
+                const Scope* lastScope = transientResource->GetLastScope(deviceIndex);
+                lifetimes.push_back(firstScope ? firstScope->GetIndex() : CompiledGraphCache::InvalidScopeIndex);
+                lifetimes.push_back(lastScope ? lastScope->GetIndex() : CompiledGraphCache::InvalidScopeIndex);
+            }
+        }
+    }
+
+    template<class T>
+    void FrameGraphCompiler::ApplyTransientAttachmentLifetimes(
+        const AZStd::vector<Scope*>& scopes, const AZStd::vector<T*>& frameAttachments, const AZStd::vector<uint32_t>& lifetimes)
+    {
+        const int deviceCount = RHISystemInterface::Get()->GetDeviceCount();
+        AZ_Assert(lifetimes.size() == frameAttachments.size() * deviceCount * 2, "Cached transient attachment lifetimes don't match the graph");
+        const uint32_t* lifetime = lifetimes.data();
+        for (T* transientResource : frameAttachments)
+        {
+            for (int deviceIndex{ 0 }; deviceIndex < deviceCount; ++deviceIndex, lifetime += 2)
+            {
+                if (lifetime[0] != CompiledGraphCache::InvalidScopeIndex)
+                {
+                    transientResource->m_scopeInfos[deviceIndex].m_firstScope = scopes[lifetime[0]];
+                }
+                if (lifetime[1] != CompiledGraphCache::InvalidScopeIndex)
+                {
+                    transientResource->m_scopeInfos[deviceIndex].m_lastScope = scopes[lifetime[1]];
+                }
+            }
+        }
+    }
+
     void FrameGraphCompiler::CompileTransientAttachments(
         FrameGraph& frameGraph,
         TransientAttachmentPool& transientAttachmentPool,
         FrameSchedulerCompileFlags compileFlags,
-        FrameSchedulerStatisticsFlags statisticsFlags)
+        FrameSchedulerStatisticsFlags statisticsFlags,
+        bool reuseCompiledGraph)
     {
         const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
         if (attachmentDatabase.GetTransientBufferAttachments().empty() && attachmentDatabase.GetTransientImageAttachments().empty())
@@ -551,9 +675,25 @@ namespace AZ::RHI
 
         AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: CompileTransientAttachments");
 
-        ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
-        ExtendTransientAttachmentGroupLifetimes(frameGraph, compileFlags);
+        if (reuseCompiledGraph)
+        {
+            ApplyTransientAttachmentLifetimes(
+                frameGraph.GetScopes(), attachmentDatabase.GetTransientBufferAttachments(), m_compiledGraphCache.m_transientBufferLifetimes);
+            ApplyTransientAttachmentLifetimes(
+                frameGraph.GetScopes(), attachmentDatabase.GetTransientImageAttachments(), m_compiledGraphCache.m_transientImageLifetimes);
+        }
+        else
+        {
+            ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
+            ExtendTransientAttachmentGroupLifetimes(frameGraph, compileFlags);
+
+            RecordTransientAttachmentLifetimes(
+                attachmentDatabase.GetTransientBufferAttachments(), m_compiledGraphCache.m_transientBufferLifetimes);
+            RecordTransientAttachmentLifetimes(
+                attachmentDatabase.GetTransientImageAttachments(), m_compiledGraphCache.m_transientImageLifetimes);
+        }
 
+        // The scope attachments are recreated every frame, so their load / store actions are always optimized
         OptimizeTransientLoadStoreActions(frameGraph, compileFlags);
 
         // Builds a sortable key. It iterates each scope and performs deactivations
@@ -617,11 +757,19 @@ namespace AZ::RHI
         AZStd::vector<Buffer*> transientBuffers(transientBufferGraphAttachments.size());
         AZStd::vector<Image*> transientImages(transientImageGraphAttachments.size());
         AZStd::vector<Command> commands;
-        commands.reserve((transientBufferGraphAttachments.size() + transientImageGraphAttachments.size()) * 2);
-        AZStd::vector<AZStd::pair<int, uint32_t>> removeBuffers;
-        AZStd::vector<AZStd::pair<int, uint32_t>> removeImages;
+        AZStd::vector<AZStd::pair<int, uint32_t>>& removeBuffers = m_compiledGraphCache.m_removedTransientBuffers;
+        AZStd::vector<AZStd::pair<int, uint32_t>>& removeImages = m_compiledGraphCache.m_removedTransientImages;
 
-        if (CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing))
+        if (reuseCompiledGraph)
+        {
+            commands.reserve(m_compiledGraphCache.m_transientCommands.size());
+            for (uint32_t commandBits : m_compiledGraphCache.m_transientCommands)
+            {
+                Command& command = commands.emplace_back(0, Action::ActivateImage, 0);
+                command.m_command = commandBits;
+            }
+        }
+        else if (CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing))
         {
             const uint32_t ScopeIndexFirst = 0;
             const uint32_t ScopeIndexLast = static_cast<uint32_t>(scopes.size() - 1);
@@ -686,7 +834,16 @@ namespace AZ::RHI
             }
         }
 
-        AZStd::sort(commands.begin(), commands.end());
+        if (!reuseCompiledGraph)
+        {
+            AZStd::sort(commands.begin(), commands.end());
+
+            m_compiledGraphCache.m_transientCommands.reserve(commands.size());
+            for (Command command : commands)
+            {
+                m_compiledGraphCache.m_transientCommands.push_back(command.m_command);
+            }
+        }
 
         auto processCommands = [&](int deviceIndex,
                                    TransientAttachmentPoolCompileFlags compileFlags,
@@ -831,12 +988,22 @@ namespace AZ::RHI
             // Check if we need to do two passes (one for calculating the size and the second one for allocating the resources)
             if (descriptor.m_heapParameters.m_type == HeapAllocationStrategy::MemoryHint)
             {
-                // First pass to calculate size needed.
-                processCommands(
-                    deviceIndex,
-                    TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
-                auto statistics = transientAttachmentPool.GetDeviceTransientAttachmentPool(deviceIndex)->GetStatistics();
-                memoryUsage = statistics.m_reservedMemory;
+                // The size only depends on the graph topology, so it's only calculated again when the topology changes
+                auto memoryHintIt = m_compiledGraphCache.m_memoryHints.find(deviceIndex);
+                if (memoryHintIt != m_compiledGraphCache.m_memoryHints.end())
+                {
+                    memoryUsage = memoryHintIt->second;
+                }
+                else
+                {
+                    // First pass to calculate size needed.
+                    processCommands(
+                        deviceIndex,
+                        TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
+                    auto statistics = transientAttachmentPool.GetDeviceTransientAttachmentPool(deviceIndex)->GetStatistics();
+                    memoryUsage = statistics.m_reservedMemory;
+                    m_compiledGraphCache.m_memoryHints.emplace(deviceIndex, statistics.m_reservedMemory);
+                }
             }
 
             // Second pass uses the information about memory usage
@@ -873,6 +1040,64 @@ namespace AZ::RHI
         }
     }
 
+    void FrameGraphCompiler::CompileScopes(FrameGraph& frameGraph, JobPolicy jobPolicy)
+    {
+        AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: Scope Compile");
+
+        // Scopes only compile their own data, so they can be compiled independently of each other
+        const auto& scopes = frameGraph.GetScopes();
+        const uint32_t scopeCount = static_cast<uint32_t>(scopes.size());
+        const uint32_t scopesPerJob = AZStd::max(static_cast<uint32_t>(r_frameGraphCompilerScopesPerJob), 1u);
+        if (jobPolicy == JobPolicy::Serial || scopeCount <= scopesPerJob)
+        {
+            for (Scope* scope : scopes)
+            {
+                scope->Compile();
+            }
+            return;
+        }
+
+        const auto compileScopeInterval = [&scopes, scopeCount](uint32_t begin, uint32_t scopesToCompile)
+        {
+            const uint32_t end = AZStd::min(begin + scopesToCompile, scopeCount);
+            for (uint32_t scopeIndex = begin; scopeIndex < end; ++scopeIndex)
+            {
+                scopes[scopeIndex]->Compile();
+            }
+        };
+
+        auto* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (taskGraphActive && taskGraphActive->IsTaskGraphActive())
+        {
+            static const AZ::TaskDescriptor scopeCompileDescriptor{ "RHI::FrameGraphCompiler::CompileScopes", "Graphics" };
+            AZ::TaskGraph taskGraph{ "Scope Compilation" };
+            for (uint32_t begin = 0; begin < scopeCount; begin += scopesPerJob)
+            {
+                taskGraph.AddTask(scopeCompileDescriptor, [&compileScopeInterval, begin, scopesPerJob]()
+                {
+                    compileScopeInterval(begin, scopesPerJob);
+                });
+            }
+            AZ::TaskGraphEvent finishedEvent{ "Scope Compile Wait" };
+            taskGraph.Submit(&finishedEvent);
+            finishedEvent.Wait();
+        }
+        else
+        {
+            AZ::JobCompletion jobCompletion;
+            for (uint32_t begin = 0; begin < scopeCount; begin += scopesPerJob)
+            {
+                AZ::Job* job = AZ::CreateJobFunction([&compileScopeInterval, begin, scopesPerJob]()
+                {
+                    compileScopeInterval(begin, scopesPerJob);
+                }, true, nullptr);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+    }
+
     ImageView* FrameGraphCompiler::GetImageViewFromLocalCache(Image* image, const ImageViewDescriptor& imageViewDescriptor)
     {
         const size_t baseHash = AZStd::hash<Image*>()(image);
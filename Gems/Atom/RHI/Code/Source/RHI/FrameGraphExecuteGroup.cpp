@@ -29,6 +29,7 @@ namespace AZ::RHI
             descriptor.m_submitRange = { 0, request.m_scopeEntries[i].m_submitCount };
             m_contexts.emplace_back(descriptor);
         }
+        m_contextRecordTimes.resize(m_contexts.size(), 0);
     }
 
     void FrameGraphExecuteGroup::Init(const InitRequest& request)
@@ -53,6 +54,7 @@ namespace AZ::RHI
             descriptor.m_submitRange = { (i * submitCount) / commandListCount, ((i + 1) * submitCount) / commandListCount };
             m_contexts.emplace_back(descriptor);
         }
+        m_contextRecordTimes.resize(m_contexts.size(), 0);
     }
 
     uint32_t FrameGraphExecuteGroup::GetContextCount() const
@@ -69,6 +71,7 @@ namespace AZ::RHI
                 m_jobPolicy == JobPolicy::Parallel,
                 "Multiple FrameSchedulerExecuteContexts in this batch are being recorded simultaneously, but the job policy forbids it.");
         }
+        m_contextRecordTimes[contextIndex] = AZStd::GetTimeNowTicks();
         BeginContextInternal(m_contexts[contextIndex], contextIndex);
         return &m_contexts[contextIndex];
     }
@@ -76,6 +79,7 @@ namespace AZ::RHI
     void FrameGraphExecuteGroup::EndContext(uint32_t contextIndex)
     {
         EndContextInternal(m_contexts[contextIndex], contextIndex);
+        m_contextRecordTimes[contextIndex] = AZStd::GetTimeNowTicks() - m_contextRecordTimes[contextIndex];
 
         [[maybe_unused]] const int32_t activeCount = --m_contextCountActive;
         AZ_Assert(activeCount >= 0, "Asymmetric calls to FrameSchedulerExecuteContext:: Begin / End.");
@@ -87,6 +91,11 @@ namespace AZ::RHI
         return m_jobPolicy;
     }
 
+    AZStd::sys_time_t FrameGraphExecuteGroup::GetContextRecordTime(uint32_t contextIndex) const
+    {
+        return m_contextRecordTimes[contextIndex];
+    }
+
     bool FrameGraphExecuteGroup::IsComplete() const
     {
         return m_contextCountCompleted == static_cast<int32_t>(m_contexts.size());
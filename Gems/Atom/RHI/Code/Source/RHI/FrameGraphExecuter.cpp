@@ -10,9 +10,22 @@
 #include <Atom/RHI/FrameGraphExecuter.h>
 #include <Atom/RHI/FrameGraph.h>
 #include <Atom/RHI/DeviceImage.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/math.h>
 
 namespace AZ::RHI
 {
+    AZ_CVAR(bool, r_frameGraphExecuterAutoBalance, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Balance the number of command lists each scope is recorded with using the record cost measured in previous frames.");
+    AZ_CVAR(float, r_frameGraphExecuterMinCommandListRecordTime, 100.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Lowest record time in microseconds a command list is balanced to, to keep the cost of extra command lists in check.");
+    AZ_CVAR(float, r_frameGraphExecuterRecordTimeSmoothing, 0.1f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Weight of the last frame in the averaged record cost of each scope, between 0 and 1.");
+
     void FrameGraphExecuter::SetJobPolicy(JobPolicy jobPolicy)
     {
         m_jobPolicy = jobPolicy;
@@ -59,6 +72,74 @@ namespace AZ::RHI
         AZ_Assert(m_pendingGroups.empty(), "Pending contexts in queue.");
         m_groups.clear();
         EndInternal();
+
+        // Fold the record cost measured this frame into the averages used to balance the next frames
+        const float smoothing = AZStd::clamp(static_cast<float>(r_frameGraphExecuterRecordTimeSmoothing), 0.0f, 1.0f);
+        float frameRecordTime = 0.0f;
+        for (const auto& [scopeId, frameStatistics] : m_frameRecordStatistics)
+        {
+            auto [it, inserted] = m_recordStatistics.emplace(scopeId, frameStatistics);
+            ScopeRecordStatistics& statistics = it->second;
+            if (!inserted)
+            {
+                statistics.m_recordTimeUs = AZ::Lerp(statistics.m_recordTimeUs, frameStatistics.m_recordTimeUs, smoothing);
+                statistics.m_itemCount = AZ::Lerp(statistics.m_itemCount, frameStatistics.m_itemCount, smoothing);
+                statistics.m_commandListCount = frameStatistics.m_commandListCount;
+            }
+            frameRecordTime += frameStatistics.m_recordTimeUs;
+        }
+        m_frameRecordStatistics.clear();
+
+        uint32_t workerThreadCount = 1;
+        if (AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext())
+        {
+            workerThreadCount = AZStd::max(jobContext->GetJobManager().GetNumWorkerThreads(), 1u);
+        }
+        m_commandListRecordTimeTarget = frameRecordTime / workerThreadCount;
+
+        AZ_PROFILE_DATAPOINT(RHI, frameRecordTime, L"RHI: Command list record time (us)");
+        AZ_PROFILE_DATAPOINT(RHI, m_commandListRecordTimeTarget, L"RHI: Command list record time target (us)");
+    }
+
+    const ScopeRecordStatistics* FrameGraphExecuter::GetScopeRecordStatistics(const ScopeId& scopeId) const
+    {
+        auto findIt = m_recordStatistics.find(scopeId);
+        return findIt != m_recordStatistics.end() ? &findIt->second : nullptr;
+    }
+
+    float FrameGraphExecuter::GetPredictedRecordTime(const ScopeId& scopeId, uint32_t itemCount) const
+    {
+        const ScopeRecordStatistics* statistics = r_frameGraphExecuterAutoBalance ? GetScopeRecordStatistics(scopeId) : nullptr;
+        if (!statistics)
+        {
+            return -1.0f;
+        }
+
+        // Scale the measured time by the change in item count, scopes without items are assumed to have a fixed cost
+        if (statistics->m_itemCount < 1.0f)
+        {
+            return statistics->m_recordTimeUs;
+        }
+        return statistics->m_recordTimeUs * (static_cast<float>(itemCount) / statistics->m_itemCount);
+    }
+
+    float FrameGraphExecuter::GetCommandListRecordTimeTarget() const
+    {
+        return AZStd::max(m_commandListRecordTimeTarget, static_cast<float>(r_frameGraphExecuterMinCommandListRecordTime));
+    }
+
+    uint32_t FrameGraphExecuter::GetBalancedCommandListCount(
+        const ScopeId& scopeId, uint32_t itemCount, uint32_t fallbackCommandListCount, uint32_t commandListCountMax) const
+    {
+        const float predictedRecordTime = GetPredictedRecordTime(scopeId, itemCount);
+        if (predictedRecordTime < 0.0f)
+        {
+            return fallbackCommandListCount;
+        }
+
+        // Each command list needs at least one item to record
+        const uint32_t balancedCount = static_cast<uint32_t>(AZStd::ceil(predictedRecordTime / GetCommandListRecordTimeTarget()));
+        return AZStd::clamp(balancedCount, 1u, AZStd::max(AZStd::min(commandListCountMax, itemCount), 1u));
     }
 
     FrameGraphExecuteGroup* FrameGraphExecuter::BeginGroup(uint32_t groupIndex)
@@ -77,6 +158,17 @@ namespace AZ::RHI
         group.m_isSubmittable = true;
 
         AZStd::lock_guard<AZStd::mutex> lock(m_pendingContextGroupLock);
+
+        const float ticksToMicroseconds = 1000000.0f / static_cast<float>(AZStd::GetTimeTicksPerSecond());
+        for (uint32_t contextIndex = 0; contextIndex < group.GetContextCount(); ++contextIndex)
+        {
+            const FrameGraphExecuteContext& context = group.m_contexts[contextIndex];
+            ScopeRecordStatistics& statistics = m_frameRecordStatistics[context.GetScopeId()];
+            statistics.m_recordTimeUs += static_cast<float>(group.GetContextRecordTime(contextIndex)) * ticksToMicroseconds;
+            statistics.m_itemCount += static_cast<float>(context.GetSubmitRange().GetCount());
+            statistics.m_commandListCount = context.GetCommandListCount();
+        }
+
         while (m_pendingGroups.size() && m_pendingGroups.front()->IsSubmittable())
         {
             ExecuteGroupInternal(*m_pendingGroups.front());
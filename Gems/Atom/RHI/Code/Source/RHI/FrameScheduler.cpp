@@ -218,6 +218,7 @@ namespace AZ::RHI
         frameGraphCompileRequest.m_logVerbosity = compileRequest.m_logVerbosity;
         frameGraphCompileRequest.m_compileFlags = compileRequest.m_compileFlags;
         frameGraphCompileRequest.m_statisticsFlags = compileRequest.m_statisticsFlags;
+        frameGraphCompileRequest.m_jobPolicy = compileRequest.m_jobPolicy;
 
         const MessageOutcome outcome = m_frameGraphCompiler->Compile(frameGraphCompileRequest);
         if (outcome.IsSuccess())
@@ -10,9 +10,17 @@
 #include <Atom/RHI/Factory.h>
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/exponential_backoff.h>
 
+AZ_CVAR(bool, r_asyncPipelineStateCompilation, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Compiles the pipeline states acquired with AcquirePipelineStateAsync on worker threads. Callers use a fallback until they are compiled.");
+
+AZ_CVAR(uint32_t, r_maxConcurrentPipelineStateCompiles, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Maximum number of pipeline states compiling on worker threads at the same time.");
+
 namespace AZ::RHI
 {
     Ptr<PipelineStateCache> PipelineStateCache::Create(MultiDevice::DeviceMask deviceMask)
@@ -69,6 +77,7 @@ namespace AZ::RHI
 
     void PipelineStateCache::Reset()
     {
+        AZStd::unique_lock<AZStd::shared_mutex> asyncCompileLock(m_asyncCompileMutex);
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
 
         for (size_t i = 0; i < m_globalLibrarySet.size(); ++i)
@@ -121,6 +130,7 @@ namespace AZ::RHI
     {
         if (handle.IsValid())
         {
+            AZStd::unique_lock<AZStd::shared_mutex> asyncCompileLock(m_asyncCompileMutex);
             AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
             AZ_Assert(m_globalLibraryActiveBits[handle.GetIndex()], "Releasing a library that is no longer valid.");
 
@@ -139,6 +149,7 @@ namespace AZ::RHI
     {
         if (handle.IsValid())
         {
+            AZStd::unique_lock<AZStd::shared_mutex> asyncCompileLock(m_asyncCompileMutex);
             AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
             ResetLibraryImpl(handle);
         }
@@ -160,6 +171,8 @@ namespace AZ::RHI
         libraryEntry.m_readOnlyCache.clear();
         libraryEntry.m_pendingCacheMutex.lock();
         libraryEntry.m_pendingCache.clear();
+        // Compilations that haven't started yet are dropped when they don't find their pipeline state anymore.
+        libraryEntry.m_asyncCompileCache.clear();
         libraryEntry.m_pendingCacheMutex.unlock();
     }
 
@@ -170,6 +183,7 @@ namespace AZ::RHI
             return nullptr;
         }
 
+        AZStd::unique_lock<AZStd::shared_mutex> asyncCompileLock(m_asyncCompileMutex);
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
         const GlobalLibraryEntry& entry = m_globalLibrarySet[handle.GetIndex()];
 
@@ -322,23 +336,7 @@ namespace AZ::RHI
             // No entry in the thread-local set. Request a pipeline state from the pending cache and add
             // it to the thread-local cache to reduce contention on the pending cache.
             {
-                // Lazy-init the library on first access.
-                if (!threadLibraryEntry.m_library)
-                {
-                    Ptr<PipelineLibrary> pipelineLibrary = aznew PipelineLibrary;
-                    RHI::ResultCode resultCode = pipelineLibrary->Init(m_deviceMask, globalLibraryEntry.m_pipelineLibraryDescriptor);
-                    if (resultCode != RHI::ResultCode::Success)
-                    {
-                        AZ_Warning(
-                            "PipelineStateCache",
-                            false,
-                            "Failed to initialize pipeline library. PipelineLibrary usage is disabled.");
-                    }
-
-                    // We store a valid pointer even if initialization failed, to avoid attempting
-                    // to re-create it with every access.
-                    threadLibraryEntry.m_library = AZStd::move(pipelineLibrary);
-                }
+                InitThreadLibrary(globalLibraryEntry, threadLibraryEntry);
 
                 ConstPtr<PipelineState> pipelineState =
                     CompilePipelineState(globalLibraryEntry, threadLibraryEntry, descriptor, pipelineStateHash, name);
@@ -352,6 +350,164 @@ namespace AZ::RHI
         }
     }
 
+    const PipelineState* PipelineStateCache::AcquirePipelineStateAsync(
+        PipelineLibraryHandle handle, const PipelineStateDescriptor& descriptor, const AZ::Name& name /*= AZ::Name()*/)
+    {
+        if (!r_asyncPipelineStateCompilation || !JobContext::GetGlobalContext())
+        {
+            return AcquirePipelineState(handle, descriptor, name);
+        }
+
+        if (handle.IsNull())
+        {
+            return nullptr;
+        }
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+
+        GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
+        PipelineStateHash pipelineStateHash = descriptor.GetHash();
+
+        if (const PipelineState* pipelineState = FindPipelineState(globalLibraryEntry.m_readOnlyCache, descriptor))
+        {
+            return pipelineState;
+        }
+
+        // The thread-local cache only has pipeline states acquired synchronously by this thread.
+        ThreadLibrarySet& threadLibrarySet = m_threadLibrarySet.GetStorage();
+        if (const PipelineState* pipelineState = FindPipelineState(threadLibrarySet[handle.GetIndex()].m_threadLocalCache, descriptor))
+        {
+            return pipelineState;
+        }
+
+        Ptr<PipelineState> pipelineState;
+        PipelineStateEntry::PipelineStateDescriptorVariant descriptorVariant;
+        {
+            AZStd::lock_guard<AZStd::mutex> pendingLock(globalLibraryEntry.m_pendingCacheMutex);
+
+            if (const PipelineState* pendingPipelineState = FindPipelineState(globalLibraryEntry.m_pendingCache, descriptor))
+            {
+                return pendingPipelineState;
+            }
+
+            if (FindPipelineState(globalLibraryEntry.m_asyncCompileCache, descriptor))
+            {
+                return nullptr;
+            }
+
+            // Over budget, the caller tries again on a later frame.
+            if (m_asyncCompileCount.fetch_add(1) >= r_maxConcurrentPipelineStateCompiles)
+            {
+                --m_asyncCompileCount;
+                return nullptr;
+            }
+
+            pipelineState = aznew PipelineState;
+            pipelineState->PreInitialize(m_deviceMask);
+
+            PipelineStateEntry pipelineStateEntry(pipelineStateHash, pipelineState, descriptor);
+            descriptorVariant = pipelineStateEntry.m_pipelineStateDescriptorVariant;
+            InsertPipelineState(globalLibraryEntry.m_asyncCompileCache, AZStd::move(pipelineStateEntry));
+        }
+
+        // The job holds a reference to the cache, so it stays valid until the compilation completes.
+        Ptr<PipelineStateCache> pipelineStateCache = this;
+        const auto compileJobLambda = [pipelineStateCache, handle, pipelineState, descriptorVariant, pipelineStateHash, name]()
+        {
+            pipelineStateCache->CompilePipelineStateAsync(handle, pipelineState, descriptorVariant, pipelineStateHash, name);
+        };
+        Job* compileJob = CreateJobFunction(compileJobLambda, true, nullptr);
+        compileJob->Start();
+
+        return nullptr;
+    }
+
+    void PipelineStateCache::CompilePipelineStateAsync(
+        PipelineLibraryHandle handle,
+        Ptr<PipelineState> pipelineState,
+        const PipelineStateEntry::PipelineStateDescriptorVariant& descriptorVariant,
+        PipelineStateHash pipelineStateHash,
+        const AZ::Name& name)
+    {
+        AZ_PROFILE_SCOPE(RHI, "PipelineStateCache: CompilePipelineStateAsync");
+
+        const PipelineStateDescriptor& descriptor = AZStd::visit(
+            [](const auto& descriptorAlternative) -> const PipelineStateDescriptor&
+            {
+                return descriptorAlternative;
+            },
+            descriptorVariant);
+
+        // Libraries aren't reset or merged until the compilation completes.
+        AZStd::shared_lock<AZStd::shared_mutex> asyncCompileLock(m_asyncCompileMutex);
+
+        PipelineLibrary* pipelineLibrary = nullptr;
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+            GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
+
+            {
+                // The library was reset or released since the compilation was requested.
+                AZStd::lock_guard<AZStd::mutex> pendingLock(globalLibraryEntry.m_pendingCacheMutex);
+                if (FindPipelineState(globalLibraryEntry.m_asyncCompileCache, descriptor) != pipelineState.get())
+                {
+                    --m_asyncCompileCount;
+                    return;
+                }
+            }
+
+            ThreadLibrarySet& threadLibrarySet = m_threadLibrarySet.GetStorage();
+            ThreadLibraryEntry& threadLibraryEntry = threadLibrarySet[handle.GetIndex()];
+            InitThreadLibrary(globalLibraryEntry, threadLibraryEntry);
+            if (threadLibraryEntry.m_library->IsInitialized())
+            {
+                pipelineLibrary = threadLibraryEntry.m_library.get();
+            }
+        }
+
+        // Compile without holding m_mutex, so the cache can still be compacted every frame.
+        [[maybe_unused]] ResultCode resultCode = pipelineState->Init(m_deviceMask, descriptor, pipelineLibrary);
+        pipelineState->SetName(name);
+
+        AZ_Error(
+            "PipelineStateCache",
+            resultCode == ResultCode::Success,
+            "Failed to compile pipeline state. It will remain in an initialized state.");
+
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+            GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
+
+            AZStd::lock_guard<AZStd::mutex> pendingLock(globalLibraryEntry.m_pendingCacheMutex);
+            globalLibraryEntry.m_asyncCompileCache.erase(PipelineStateEntry(pipelineStateHash, nullptr, descriptor));
+
+            // A synchronous acquire may have compiled the same pipeline state in the meantime, in which case that one is kept.
+            InsertPipelineState(globalLibraryEntry.m_pendingCache, PipelineStateEntry(pipelineStateHash, pipelineState, descriptor));
+        }
+
+        --m_asyncCompileCount;
+    }
+
+    void PipelineStateCache::InitThreadLibrary(const GlobalLibraryEntry& globalLibraryEntry, ThreadLibraryEntry& threadLibraryEntry) const
+    {
+        if (!threadLibraryEntry.m_library)
+        {
+            Ptr<PipelineLibrary> pipelineLibrary = aznew PipelineLibrary;
+            RHI::ResultCode resultCode = pipelineLibrary->Init(m_deviceMask, globalLibraryEntry.m_pipelineLibraryDescriptor);
+            if (resultCode != RHI::ResultCode::Success)
+            {
+                AZ_Warning(
+                    "PipelineStateCache",
+                    false,
+                    "Failed to initialize pipeline library. PipelineLibrary usage is disabled.");
+            }
+
+            // We store a valid pointer even if initialization failed, to avoid attempting
+            // to re-create it with every access.
+            threadLibraryEntry.m_library = AZStd::move(pipelineLibrary);
+        }
+    }
+
     ConstPtr<PipelineState> PipelineStateCache::CompilePipelineState(
         GlobalLibraryEntry& globalLibraryEntry,
         ThreadLibraryEntry& threadLibraryEntry,
@@ -250,7 +250,13 @@ namespace AZ::RHI
     void RHISystem::Shutdown()
     {
         m_frameScheduler.Shutdown();
-        m_pipelineStateCache = nullptr;
+
+        // Waits for the pipeline states compiling on worker threads before the devices are released.
+        if (m_pipelineStateCache)
+        {
+            m_pipelineStateCache->Reset();
+            m_pipelineStateCache = nullptr;
+        }
 
         while (!m_devices.empty())
         {
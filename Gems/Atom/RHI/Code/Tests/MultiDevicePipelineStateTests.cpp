@@ -16,7 +16,11 @@
 #include <Atom/RHI/PipelineState.h>
 #include <Atom/RHI/PipelineStateCache.h>
 
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace UnitTest
 {
@@ -363,4 +367,45 @@ namespace UnitTest
             }
         }
     }
+
+    TEST_F(MultiDevicePipelineStateTests, PipelineStateCache_AcquireAsync_CompilesOnWorkerThread)
+    {
+        AZ::JobManagerDesc jobManagerDesc;
+        jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+        AZStd::unique_ptr<AZ::JobManager> jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+        AZStd::unique_ptr<AZ::JobContext> jobContext = AZStd::make_unique<AZ::JobContext>(*jobManager);
+        AZ::JobContext::SetGlobalContext(jobContext.get());
+        r_asyncPipelineStateCompilation = true;
+
+        {
+            RHI::Ptr<RHI::PipelineStateCache> pipelineStateCache = RHI::PipelineStateCache::Create(DeviceMask);
+            RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary({}, {});
+            RHI::PipelineStateDescriptorForDraw descriptor = CreatePipelineStateDescriptor(0);
+
+            // Null is returned until the worker thread has compiled the pipeline state.
+            const RHI::PipelineState* pipelineState = nullptr;
+            for (size_t i = 0; i < 1000 && !pipelineState; ++i)
+            {
+                pipelineState = pipelineStateCache->AcquirePipelineStateAsync(libraryHandle, descriptor);
+                if (!pipelineState)
+                {
+                    AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+                }
+            }
+            ASSERT_NE(pipelineState, nullptr);
+            EXPECT_TRUE(pipelineState->IsInitialized());
+            EXPECT_EQ(pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor), pipelineState);
+
+            pipelineStateCache->Compact();
+            ValidateCacheIntegrity(pipelineStateCache);
+            EXPECT_EQ(pipelineStateCache->AcquirePipelineStateAsync(libraryHandle, descriptor), pipelineState);
+
+            pipelineStateCache->ReleaseLibrary(libraryHandle);
+        }
+
+        r_asyncPipelineStateCompilation = false;
+        AZ::JobContext::SetGlobalContext(nullptr);
+        jobContext.reset();
+        jobManager.reset();
+    }
 } // namespace UnitTest
@@ -177,6 +177,8 @@ namespace AZ
                         commandList.SetParentQueue(this);
                     }
                     AZ_Assert(executeCount <= CommandListCountMax, "exceeded maximum number of command lists allowed");
+                    // Submission marker, lines up with the gpu work of the queue on the profiler timeline
+                    AZ_PROFILE_SCOPE(RHI, "ExecuteCommandLists");
                     dx12CommandQueue->ExecuteCommandLists(executeCount, executeLists);
                 }
 
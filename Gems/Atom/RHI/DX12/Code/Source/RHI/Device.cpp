@@ -368,6 +368,25 @@ namespace AZ
             return AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(durationInSeconds);
         }
 
+        bool Device::GetCalibratedTimestamps(RHI::HardwareQueueClass queueClass, uint64_t& gpuTimestamp, AZStd::sys_time_t& cpuTimestamp) const
+        {
+            // The copy queue doesn't support timestamps. The cpu timestamp is a QueryPerformanceCounter value, which is what
+            // AZStd::GetTimeNowTicks uses on Windows.
+            if (queueClass == RHI::HardwareQueueClass::Copy)
+            {
+                return false;
+            }
+
+            uint64_t cpuTicks = 0;
+            if (FAILED(m_commandQueueContext.GetCommandQueue(queueClass).GetPlatformQueue()->GetClockCalibration(&gpuTimestamp, &cpuTicks)))
+            {
+                return false;
+            }
+
+            cpuTimestamp = static_cast<AZStd::sys_time_t>(cpuTicks);
+            return true;
+        }
+
         void Device::FillFormatsCapabilitiesInternal(FormatCapabilitiesList& formatsCapabilities)
         {
             for (uint32_t i = 0; i < formatsCapabilities.size(); ++i)
@@ -79,6 +79,7 @@ namespace AZ
                 auto& device = static_cast<Device&>(GetDevice());
                 device.GetContext().ResetDescriptorPool(device.GetNativeDevice(), m_nativeDescriptorPool, 0);
             }
+            m_linearAllocationCount = 0;
         }
 
         RHI::ResultCode DescriptorPool::BuildNativeDescriptorPool()
@@ -87,7 +88,7 @@ namespace AZ
             VkDescriptorPoolCreateInfo createInfo{};
             createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
             createInfo.pNext = nullptr;
-            createInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+            createInfo.flags = m_descriptor.m_linearAllocation ? 0 : VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
             createInfo.maxSets = m_descriptor.m_maxSets;
             createInfo.poolSizeCount = static_cast<uint32_t>(m_descriptor.m_descriptorPoolSizes.size());
             createInfo.pPoolSizes = m_descriptor.m_descriptorPoolSizes.empty() ? nullptr : m_descriptor.m_descriptorPoolSizes.data();
@@ -112,7 +113,7 @@ namespace AZ
 
         size_t DescriptorPool::GetTotalObjectCount() const
         {
-            return m_objects.size() + m_collector.GetObjectCount();
+            return m_objects.size() + m_collector.GetObjectCount() + m_linearAllocationCount;
         }
 
         VkDescriptorPool DescriptorPool::GetNativeDescriptorPool() const
@@ -133,10 +134,38 @@ namespace AZ
                 return AZStd::make_pair(vkResult, nullptr);
             }
             
-            m_objects.insert(descriptorSets);
+            // Descriptor sets of linear pools aren't owned by the pool, their native descriptor sets are allocated on demand
+            if (!m_descriptor.m_linearAllocation)
+            {
+                m_objects.insert(descriptorSets);
+            }
             return AZStd::make_pair(vkResult, descriptorSets);
         }
 
+        VkResult DescriptorPool::AllocateLinear(DescriptorSet& descriptorSet)
+        {
+            AZ_Assert(m_descriptor.m_linearAllocation, "Descriptor pool doesn't use linear allocation");
+
+            VkDescriptorSetLayout nativeLayout = descriptorSet.m_descriptor.m_descriptorSetLayout->GetNativeDescriptorSetLayout();
+            VkDescriptorSetAllocateInfo allocInfo{};
+            allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+            allocInfo.descriptorPool = m_nativeDescriptorPool;
+            allocInfo.descriptorSetCount = 1;
+            allocInfo.pSetLayouts = &nativeLayout;
+
+            auto& device = static_cast<Device&>(GetDevice());
+            VkDescriptorSet nativeDescriptorSet = VK_NULL_HANDLE;
+            const VkResult result =
+                device.GetContext().AllocateDescriptorSets(device.GetNativeDevice(), &allocInfo, &nativeDescriptorSet);
+            if (result == VK_SUCCESS)
+            {
+                descriptorSet.m_nativeDescriptorSet = nativeDescriptorSet;
+                descriptorSet.m_descriptor.m_descriptorPool = this;
+                ++m_linearAllocationCount;
+            }
+            return result;
+        }
+
         void DescriptorPool::DeAllocate(RHI::Ptr<ObjectType> object)
         {
             m_collector.QueueForCollect(object);
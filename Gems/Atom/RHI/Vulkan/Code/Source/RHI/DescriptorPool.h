@@ -53,6 +53,8 @@ namespace AZ
                 uint32_t m_collectLatency = 0;
                 BufferPool* m_constantDataPool = nullptr;
                 bool m_updateAfterBind = false;
+                //! Descriptor sets are never freed individually, the whole pool is reset instead.
+                bool m_linearAllocation = false;
             };
 
             ~DescriptorPool();
@@ -60,6 +62,10 @@ namespace AZ
             using AllocResult = AZStd::pair<VkResult, RHI::Ptr<ObjectType>>;
 
             AllocResult Allocate(const DescriptorSetLayout& descriptorSetLayout);
+
+            //! Allocates a new native descriptor set for an existing descriptor set from a linear pool.
+            //! The previous native descriptor set isn't freed, it's reclaimed when the pool is reset.
+            VkResult AllocateLinear(DescriptorSet& descriptorSet);
             void DeAllocate(RHI::Ptr<ObjectType> object);
             const Descriptor& GetDescriptor() const;
             VkDescriptorPool GetNativeDescriptorPool() const;
@@ -91,6 +97,8 @@ namespace AZ
             VkDescriptorPool m_nativeDescriptorPool = VK_NULL_HANDLE;
             ReleaseQueue m_collector;
             AZStd::unordered_set<RHI::Ptr<ObjectType>> m_objects;
+            //! Number of native descriptor sets allocated since the last reset when using linear allocation.
+            uint32_t m_linearAllocationCount = 0;
         };
     }
 }
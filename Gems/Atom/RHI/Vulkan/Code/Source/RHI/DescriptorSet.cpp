@@ -224,8 +224,10 @@ namespace AZ
             Base::Init(*descriptor.m_device);
 
             // if this descriptor set contains an unbounded array we need to defer allocation until UpdateNativeDescriptorSet(),
-            // since we do not know the number of views in the unbounded array
-            if (!descriptor.m_descriptorSetLayout->GetHasUnboundedArray())
+            // since we do not know the number of views in the unbounded array.
+            // Descriptor sets of linear pools get a new native descriptor set every time they are compiled.
+            m_isLinearAllocation = descriptor.m_descriptorPool->GetDescriptor().m_linearAllocation;
+            if (!descriptor.m_descriptorSetLayout->GetHasUnboundedArray() && !m_isLinearAllocation)
             {
                 VkDescriptorSetLayout nativeLayout = descriptor.m_descriptorSetLayout->GetNativeDescriptorSetLayout();
                 VkDescriptorSetAllocateInfo allocInfo{};
@@ -290,14 +292,15 @@ namespace AZ
 
         void DescriptorSet::Shutdown()
         {
-            if (m_nativeDescriptorSet != VK_NULL_HANDLE)
+            // Native descriptor sets of linear pools are reclaimed when the pool is reset
+            if (m_nativeDescriptorSet != VK_NULL_HANDLE && !m_isLinearAllocation)
             {
                 AZ_Assert(m_descriptor.m_descriptorPool, "Descriptor pool is null.");
                 auto& device = static_cast<Device&>(GetDevice());
                 AssertSuccess(device.GetContext().FreeDescriptorSets(
                     device.GetNativeDevice(), m_descriptor.m_descriptorPool->GetNativeDescriptorPool(), 1, &m_nativeDescriptorSet));
-                m_nativeDescriptorSet = VK_NULL_HANDLE;
             }
+            m_nativeDescriptorSet = VK_NULL_HANDLE;
             m_constantDataBufferView = nullptr;
             m_constantDataBuffer = nullptr;
             Base::Shutdown();
@@ -107,6 +107,7 @@ namespace AZ
             RHI::Ptr<BufferView> m_constantDataBufferView;
             bool m_nullDescriptorSupported = false;
             uint32_t m_currentUnboundedArrayAllocation = 0;
+            bool m_isLinearAllocation = false;
         };
 
         template<typename T>
@@ -69,6 +69,15 @@ namespace AZ
 
             RHI::Ptr<DescriptorSetSubAllocator::ObjectType> DescriptorSetSubAllocator::Allocate(DescriptorSetLayout& layout)
             {
+                // Linear descriptor sets are only created here, their native descriptor sets are allocated by AllocateLinear
+                if (m_poolDescriptor.m_linearAllocation)
+                {
+                    DescriptorPool* pool = AcquireLinearPool();
+                    auto result = pool->Allocate(layout);
+                    AZ_Assert(result.first == VK_SUCCESS, "Failed to Allocate descriptor set");
+                    return result.second;
+                }
+
                 // Look for a pool that can allocate the descriptor set
                 for (DescriptorPool* pool : m_pools)
                 {
@@ -104,8 +113,41 @@ namespace AZ
                 return result.second;
             }
 
+            VkResult DescriptorSetSubAllocator::AllocateLinear(ObjectType& descriptorSet)
+            {
+                DescriptorPool* pool = AcquireLinearPool();
+                if (pool->GetTotalObjectCount() + 1 <= m_poolDescriptor.m_maxSets)
+                {
+                    VkResult vkResult = pool->AllocateLinear(descriptorSet);
+                    if (vkResult != VK_ERROR_FRAGMENTED_POOL && vkResult != VK_ERROR_OUT_OF_POOL_MEMORY)
+                    {
+                        return vkResult;
+                    }
+                }
+
+                // The current pool is full, continue in a new one
+                DescriptorPool* newPool = m_descriptorPoolAllocator->Allocate(m_poolDescriptor);
+                m_pools.push_front(newPool);
+                return newPool->AllocateLinear(descriptorSet);
+            }
+
+            DescriptorPool* DescriptorSetSubAllocator::AcquireLinearPool()
+            {
+                if (m_pools.empty())
+                {
+                    m_pools.push_front(m_descriptorPoolAllocator->Allocate(m_poolDescriptor));
+                }
+                return m_pools.front();
+            }
+
             void DescriptorSetSubAllocator::DeAllocate(RHI::Ptr<ObjectType> descriptorSet)
             {
+                if (m_poolDescriptor.m_linearAllocation)
+                {
+                    // Released with the pools of the frame
+                    return;
+                }
+
                 DescriptorPool* descriptorPool = const_cast<DescriptorPool*>(descriptorSet->GetDescriptor().m_descriptorPool);
                 descriptorPool->DeAllocate(descriptorSet);
             }
@@ -122,6 +164,17 @@ namespace AZ
 
             void DescriptorSetSubAllocator::Collect()
             {
+                if (m_poolDescriptor.m_linearAllocation)
+                {
+                    // Hand the pools used this frame back to the pool allocator, which resets them after the collect latency
+                    for (DescriptorPool* pool : m_pools)
+                    {
+                        m_descriptorPoolAllocator->DeAllocate(pool);
+                    }
+                    m_pools.clear();
+                    return;
+                }
+
                 auto it = m_pools.begin();
                 while (it != m_pools.end())
                 {
@@ -156,6 +209,7 @@ namespace AZ
             poolDescriptor.m_maxSets = m_descriptor.m_poolSize;
             poolDescriptor.m_constantDataPool = m_descriptor.m_constantDataPool;
             poolDescriptor.m_collectLatency = descriptor.m_frameCountMax;
+            poolDescriptor.m_linearAllocation = descriptor.m_linearAllocation;
             AZStd::unordered_map<VkDescriptorType, VkDescriptorPoolSize> sizesByType;
             for (const auto& layoutBinding : descriptor.m_layout->GetNativeLayoutBindings())
             {
@@ -179,6 +233,13 @@ namespace AZ
             return m_subAllocator.Allocate(layout);
         }
 
+        VkResult DescriptorSetAllocator::AllocateLinear(ObjectType& descriptorSet)
+        {
+            AZ_Assert(m_descriptor.m_linearAllocation, "DescriptorSetAllocator doesn't use linear allocation");
+            AZStd::lock_guard<AZStd::mutex> lock(m_subAllocatorMutex);
+            return m_subAllocator.AllocateLinear(descriptorSet);
+        }
+
         void DescriptorSetAllocator::DeAllocate(RHI::Ptr<ObjectType> descriptorSet)
         {
             AZStd::lock_guard<AZStd::mutex> lock(m_subAllocatorMutex);
@@ -67,11 +67,14 @@ namespace AZ
                 void Init(DescriptorPoolAllocator& descriptorPoolAllocator, Device& device, const DescriptorPool::Descriptor& poolDescriptor);
 
                 RHI::Ptr<ObjectType> Allocate(DescriptorSetLayout& layout);
+                VkResult AllocateLinear(ObjectType& descriptorSet);
                 void DeAllocate(RHI::Ptr<ObjectType> descriptorSet);
                 void Reset();
                 void Collect();
 
             private:
+                DescriptorPool* AcquireLinearPool();
+
                 Device* m_device;
                 DescriptorPoolAllocator* m_descriptorPoolAllocator = nullptr;
                 DescriptorPool::Descriptor m_poolDescriptor;
@@ -85,6 +88,10 @@ namespace AZ
         * When the pool can't allocate more descriptor sets we create a new pool.
         * We use the return value from Vulkan to check if the pool ran out of memory and we need to create
         * a new one. A DescriptorSetAllocator is used to generate new descriptor set pools when needed.
+        *
+        * With linear allocation, descriptor sets only get a native descriptor set when AllocateLinear is called,
+        * which sub-allocates it from the pools of the current frame. Native descriptor sets are never freed
+        * individually: the pools of a frame are returned on Collect and reset once the GPU is done with them.
         */
         class DescriptorSetAllocator final
             : public RHI::DeviceObject
@@ -102,6 +109,7 @@ namespace AZ
                 uint32_t m_poolSize = 0;
                 const DescriptorSetLayout* m_layout = nullptr;
                 BufferPool* m_constantDataPool = nullptr;
+                bool m_linearAllocation = false;
             };
 
             DescriptorSetAllocator() = default;
@@ -109,6 +117,9 @@ namespace AZ
 
             RHI::ResultCode Init(const Descriptor& descriptor);
             RHI::Ptr<ObjectType> Allocate(DescriptorSetLayout& layout);
+            //! Allocates a new native descriptor set for the descriptor set, valid until the end of the current frame.
+            //! Only available with linear allocation.
+            VkResult AllocateLinear(ObjectType& descriptorSet);
             void DeAllocate(RHI::Ptr<ObjectType> descriptor);
             void Collect();
             void Shutdown() override;
@@ -118,10 +118,18 @@ namespace AZ
                     * Computes a cost heuristic based on the number of items and number of attachments in
                     * the scope. This cost is used to partition command list generation.
                     */
-                const uint32_t totalScopeCost =
+                uint32_t totalScopeCost =
                     estimatedItemCount * m_frameGraphExecuterData[scope.GetDeviceIndex()].m_itemCost +
                     static_cast<uint32_t>(scope.GetAttachments().size()) * m_frameGraphExecuterData[scope.GetDeviceIndex()].m_attachmentCost;
 
+                // Once the scope was recorded, its cost is the record time measured in previous frames, relative to the
+                // time a single command list should take so that record jobs are spread evenly over the worker threads.
+                const float predictedRecordTime = GetPredictedRecordTime(scope.GetId(), estimatedItemCount);
+                if (predictedRecordTime >= 0.0f)
+                {
+                    totalScopeCost = static_cast<uint32_t>(CommandListCostThreshold * (predictedRecordTime / GetCommandListRecordTimeTarget()));
+                }
+
                 // Check if we are in a middle of a framegraph group.
                 const bool subpassGroup =
                     (scopeNext && scopeNext->GetFrameGraphGroupId() == scope.GetFrameGraphGroupId()) ||
@@ -173,7 +181,11 @@ namespace AZ
                 else
                 {
                     // And then create a new group for the current scope with dedicated [1, N] secondary command lists
-                    const uint32_t commandListCount = AZStd::max(AZ::DivideAndRoundUp(totalScopeCost, CommandListCostThreshold), 1u);
+                    const uint32_t commandListCount = GetBalancedCommandListCount(
+                        scope.GetId(),
+                        estimatedItemCount,
+                        AZStd::max(AZ::DivideAndRoundUp(totalScopeCost, CommandListCostThreshold), 1u),
+                        m_frameGraphExecuterData[scope.GetDeviceIndex()].m_commandListsPerScopeMax);
                     FrameGraphExecuteGroupSecondary* scopeContextGroup = AddGroup<FrameGraphExecuteGroupSecondary>();
                     scopeContextGroup->Init(static_cast<Device&>(scope.GetDevice()), scope, commandListCount, GetJobPolicy());
                 }
@@ -51,15 +51,27 @@ namespace AZ
             // Reducing the initial allowed descriptor sets (i.e SRGs) with unbounded arrays per pool to 5 
             // instead of 20. This significantly helps reduce descriptor waste as we allocate 900k descriptors 
             // per an unbounded array entry.
-            if (layout.GetGroupSizeForBufferUnboundedArrays() > 0 || layout.GetGroupSizeForImageUnboundedArrays() > 0)
+            const bool hasUnboundedArrays =
+                layout.GetGroupSizeForBufferUnboundedArrays() > 0 || layout.GetGroupSizeForImageUnboundedArrays() > 0;
+            if (hasUnboundedArrays)
             {
                 descriptorSetsPerPool = 5;
             }
+
+            // Transient groups are recompiled every frame they are used, so their descriptor sets are sub-allocated from
+            // linear pools that are reset as a whole instead of being allocated and freed one by one.
+            // Unbounded arrays size their descriptor sets when compiled, so they keep using the regular pools.
+            m_linearDescriptorAllocation = descriptor.m_usage == RHI::ShaderResourceGroupUsage::Transient && !hasUnboundedArrays;
+            if (m_linearDescriptorAllocation)
+            {
+                descriptorSetsPerPool = 256;
+            }
             DescriptorSetAllocator::Descriptor allocatorDescriptor;
             allocatorDescriptor.m_device = &device;
             allocatorDescriptor.m_layout = m_descriptorSetLayout.get();
             allocatorDescriptor.m_poolSize = m_descriptorSetCount * descriptorSetsPerPool;
             allocatorDescriptor.m_constantDataPool = m_constantBufferPool.get();
+            allocatorDescriptor.m_linearAllocation = m_linearDescriptorAllocation;
 
             result = m_descriptorSetAllocator->Init(allocatorDescriptor);
             if (result != RHI::ResultCode::Success)
@@ -108,6 +120,11 @@ namespace AZ
 
             group.UpdateCompiledDataIndex(m_currentIteration);
             DescriptorSet& descriptorSet = *group.m_compiledData[group.GetCompileDataIndex()];
+            if (m_linearDescriptorAllocation && m_descriptorSetAllocator->AllocateLinear(descriptorSet) != VK_SUCCESS)
+            {
+                AZ_Assert(false, "Failed to allocate a linear descriptor set");
+                return RHI::ResultCode::OutOfMemory;
+            }
 
             const RHI::ShaderResourceGroupLayout* layout = groupData.GetLayout();
 
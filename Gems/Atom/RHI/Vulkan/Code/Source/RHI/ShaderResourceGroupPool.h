@@ -51,6 +51,8 @@ namespace AZ
             RHI::Ptr<DescriptorSetAllocator> m_descriptorSetAllocator;
             RHI::Ptr<DescriptorSetLayout> m_descriptorSetLayout;
             uint64_t m_currentIteration = 0;
+            //! Transient groups get new descriptor sets from per frame linear pools every time they are compiled.
+            bool m_linearDescriptorAllocation = false;
         };
     }
 }
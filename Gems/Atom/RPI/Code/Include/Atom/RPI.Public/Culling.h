@@ -128,6 +128,10 @@ namespace AZ
             //! something that shouldn't be rendered, regardless of its actual position relative to the camera
             bool m_isHidden = false;
 
+            //! Index of the cullable in the flat storage of the CullingScene it's registered with, managed by the CullingScene.
+            static constexpr uint32_t InvalidStorageIndex = AZStd::numeric_limits<uint32_t>::max();
+            uint32_t m_storageIndex = InvalidStorageIndex;
+
             void SetDebugName([[maybe_unused]] const AZ::Name& debugName)
             {
 #ifdef AZ_CULL_DEBUG_ENABLED
@@ -189,6 +193,7 @@ namespace AZ
                     m_numJobs = 0;
                     m_numVisibleCullables = 0;
                     m_numVisibleDrawPackets = 0;
+                    m_numOccludedCullables = 0;
                 }
 
                 AZ::Name m_name;
@@ -196,6 +201,7 @@ namespace AZ
                 AZStd::atomic_uint32_t m_numJobs = 0;
                 AZStd::atomic_uint32_t m_numVisibleCullables = 0;
                 AZStd::atomic_uint32_t m_numVisibleDrawPackets = 0;
+                AZStd::atomic_uint32_t m_numOccludedCullables = 0;
             };
 
             CullingDebugContext() = default;
@@ -298,6 +304,24 @@ namespace AZ
             //! Returns the visibility scene
             const AzFramework::IVisibilityScene* GetVisibilityScene() const;
 
+            //! Structure of arrays copy of the bounding spheres of the registered cullables, kept up to date by RegisterOrUpdateCullable.
+            //! It lets culling test the cullables against the frustum in batches without walking the visibility scene or dereferencing
+            //! each cullable. The arrays are padded to a multiple of BatchSize so a batch can always be loaded whole.
+            struct CullableStorage
+            {
+                static constexpr uint32_t BatchSize = 8;
+
+                void AddOrUpdate(Cullable& cullable);
+                void Remove(Cullable& cullable);
+
+                uint32_t m_count = 0;
+                AZStd::vector<float> m_centerX;
+                AZStd::vector<float> m_centerY;
+                AZStd::vector<float> m_centerZ;
+                AZStd::vector<float> m_radius;
+                AZStd::vector<Cullable*> m_cullables;
+            };
+
         protected:
             size_t CountObjectsInScene();
 
@@ -310,6 +334,8 @@ namespace AZ
             AzFramework::IVisibilityScene* m_visScene = nullptr;
             CullingDebugContext m_debugCtx;
             AZStd::concurrency_checker m_cullDataConcurrencyCheck;
+            CullableStorage m_cullableStorage;
+            AZStd::mutex m_cullableStorageMutex;
             OcclusionPlaneVector m_occlusionPlanes;
             AZ::TaskGraphActiveInterface* m_taskGraphActive = nullptr;
         };
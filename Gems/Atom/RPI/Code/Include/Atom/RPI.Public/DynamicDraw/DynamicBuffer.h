@@ -67,6 +67,10 @@ namespace AZ
             AZStd::unordered_map<int, void*> m_address;
             uint32_t m_size;
 
+            // The offset of this buffer in the page of the allocator it was allocated from
+            uint32_t m_offset = 0;
+            uint32_t m_pageIndex = 0;
+
             // The allocator which allocated this DyanmicBuffer. 
             DynamicBufferAllocator* m_allocator;
         };
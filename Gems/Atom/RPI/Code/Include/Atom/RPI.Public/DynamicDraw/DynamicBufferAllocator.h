@@ -10,7 +10,13 @@
 
 #include <Atom/RHI/IndexBufferView.h>
 #include <Atom/RHI/StreamBufferView.h>
-#include <Atom/RPI.Public/Buffer/RingBuffer.h>
+#include <Atom/RHI.Reflect/FrameCountMaxRingBuffer.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace AZ
 {
@@ -18,17 +24,32 @@ namespace AZ
     {
         class DynamicBuffer;
 
-        //! DynamicBufferAllocator allocates DynamicBuffers within a big pre-allocated buffer by using ring buffer allocation
-        //! The addresses of allocated DynamicBuffers would be available after AZ::RHI::Limits::Device::FrameCountMax frames.
-        //! Since the allocations are sub-allocations they almost have zero cost with both cpu and gpu.
-        //! Limitation: the allocation may fail if the request buffer size is larger than the ring buffer size or
-        //!     there isn't enough unused memory available within the ring buffer. User may increase the input of Init(ringBufferSize)
-        //!     to increase the ring buffer's size.
+        //! DynamicBufferAllocator allocates DynamicBuffers within big pre-allocated buffers by using ring buffer allocation
+        //! There is one set of buffers for each of the AZ::RHI::Limits::Device::FrameCountMax frames in flight. They are mapped once
+        //! and stay mapped, and the allocations of a frame are only reused after FrameCountMax frames.
+        //! Since the allocations are sub-allocations they almost have zero cost with both cpu and gpu. Allocate is lock-free except
+        //! when the frame needs a new page, so it can be called from several threads recording draws at the same time.
+        //! When the buffer of a frame is full, another page is chained to it instead of failing the allocation, until the total size
+        //! of the frame reaches r_dynamicBufferMaxSize. The pages of a frame are merged into a single buffer the next time the frame
+        //! is reused, so the chain only exists for the frame where the usage spiked.
+        //! Limitation: the allocation may fail if the frame already uses r_dynamicBufferMaxSize bytes. User may increase the input of
+        //!     Init(ringBufferSize) to avoid growing, or r_dynamicBufferMaxSize to allow growing further.
         class DynamicBufferAllocator
         {
         public:
             AZ_RTTI(AZ::RPI::DynamicBufferAllocator, "{82B047B3-C845-4F77-9852-747E39C53081}");
 
+            //! Usage of the allocator, in bytes.
+            struct Statistics
+            {
+                //! Bytes allocated during the last completed frame.
+                uint32_t m_lastFrameSize = 0;
+                //! Highest number of bytes allocated in a single frame since Init.
+                uint32_t m_highWatermarkSize = 0;
+                //! Total size of the buffers of the current frame.
+                uint32_t m_capacity = 0;
+            };
+
             DynamicBufferAllocator() = default;
             virtual ~DynamicBufferAllocator() = default;
 
@@ -39,8 +60,7 @@ namespace AZ
             void Shutdown();
 
             //! Allocate a dynamic buffer with specified size and alignment
-            //! It may return nullptr if the input size is larger than ring buffer size or there isn't enough unused memory available within
-            //! the ring buffer
+            //! It may return nullptr if the frame can't grow to fit the input size. This function is thread safe.
             RHI::Ptr<DynamicBuffer> Allocate(uint32_t size, uint32_t alignment);
 
             //! Get an IndexBufferView for a DynamicBuffer used as an index buffer
@@ -55,23 +75,60 @@ namespace AZ
             //! Enable/disable buffer allocation warning if allocation fails
             void SetEnableAllocationWarning(bool enable);
 
+            Statistics GetStatistics() const;
+
         private:
-            // Get buffer's offset;
-            uint32_t GetBufferAddressOffset(RHI::Ptr<DynamicBuffer> dynamicBuffer);
+            //! Highest number of buffers chained in a single frame.
+            static constexpr uint32_t MaxPageCount = 8;
+
+            //! A mapped buffer of a frame.
+            struct Page
+            {
+                Data::Instance<Buffer> m_buffer;
+                AZStd::unordered_map<int, void*> m_addresses;
+                uint32_t m_size = 0;
+            };
+
+            //! The buffers of a frame. Only the first m_pageCount pages are valid.
+            struct FrameBuffers
+            {
+                AZStd::array<Page, MaxPageCount> m_pages;
+                AZStd::atomic_uint32_t m_pageCount{ 0 };
+            };
+
+            // The allocation position is packed as the page index in the high 32 bits and the offset within the page in the low bits,
+            // so both are updated together with a single compare and swap.
+            static uint64_t PackPosition(uint32_t pageIndex, uint32_t offset);
+            static uint32_t GetPageIndex(uint64_t position);
+            static uint32_t GetOffset(uint64_t position);
+
+            // Creates or resizes a page of the current frame and maps it.
+            bool MapPage(Page& page, uint32_t size);
+            void UnmapPage(Page& page);
+
+            // Chains a page able to hold the input size after the page at the input index. Returns false if the frame can't grow.
+            bool AddPage(uint32_t currentPageIndex, uint32_t size);
+
+            // Merges the pages of the current frame into a single page, so it doesn't need to chain pages again.
+            void MergePages();
+
+            const Page& GetPage(const DynamicBuffer& dynamicBuffer) const;
 
             // The position where the buffer is available.
-            uint32_t m_currentPosition = 0;
+            AZStd::atomic_uint64_t m_currentPosition{ 0 };
 
-            // The size of the buffer per frame
+            // The initial size of the buffer per frame
             uint32_t m_ringBufferSize = 0;
 
             bool m_enableAllocationWarning = false;
 
-            // The resident buffer data per frame
-            RingBuffer m_bufferData{ "DynamicBufferAllocator", CommonBufferPoolType::DynamicInputAssembly, 1 };
+            // The mapped buffers per frame
+            RHI::FrameCountMaxRingBuffer<FrameBuffers> m_frameBuffers;
+
+            // Serializes the creation of pages
+            AZStd::mutex m_pageMutex;
 
-            // The CPU address of the mapped buffer per frame
-            RHI::FrameCountMaxRingBuffer<AZStd::unordered_map<int, void*>> m_bufferStartAddresses;
+            Statistics m_statistics;
         };
     } // namespace RPI
 } // namespace AZ
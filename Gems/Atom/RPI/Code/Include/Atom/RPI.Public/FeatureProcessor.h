@@ -108,6 +108,13 @@ namespace AZ
             virtual void PrepareViews(
                 const PrepareViewsPacket& /*prepareViewPacket*/, AZStd::vector<AZStd::pair<PipelineViewTag, ViewPtr>>& /*outViews*/) {}
 
+            //! Allows the feature processor to declare the feature processors whose Simulate() and Render() must be finished
+            //! before its own start, e.g. a skinning feature processor reading the transforms of another feature processor.
+            //! The types can be interfaces, a dependency matches the first enabled feature processor of that type and is
+            //! ignored when there is none in the scene. Every other pair of feature processors may still run in parallel.
+            //! This is called on the main thread when the feature processors of the scene change.
+            virtual void GetDependencies(AZStd::vector<TypeId>& /*outDependencies*/) const {}
+
             //! The feature processor should perform any internal simulation at this point - For 
             //! instance, updating a particle system or animation. Not every feature processor
             //! will need to implement this.
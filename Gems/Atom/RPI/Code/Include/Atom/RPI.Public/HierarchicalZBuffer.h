@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! A CPU-side hierarchical depth buffer (Hi-Z pyramid) used for occlusion culling.
+        //! It's built from a depth buffer of a previous frame, typically read back from the GPU at a low resolution, and each mip
+        //! stores the farthest depth of the texels it covers. Bounding boxes are projected with the world to clip matrix the depth was
+        //! rendered with, and are occluded if their nearest point is behind the farthest depth of every texel they overlap.
+        class HierarchicalZBuffer
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(HierarchicalZBuffer, AZ::SystemAllocator);
+
+            //! Builds the pyramid from a row-major depth buffer.
+            //! @param depths The depth values in [0, 1], with the first row at the top of the screen.
+            //! @param worldToClip The world to clip matrix the depth buffer was rendered with.
+            //! @param reverseDepth Whether the depth buffer uses reversed depth, where 1 is the near plane.
+            void Build(AZStd::span<const float> depths, uint32_t width, uint32_t height, const Matrix4x4& worldToClip, bool reverseDepth);
+
+            //! Returns true if the bounding box is entirely hidden behind the depth buffer.
+            //! @param depthBias Distance in normalized depth the box needs to be behind the occluders to be considered occluded.
+            bool IsOccluded(const Aabb& aabb, float depthBias) const;
+
+            bool IsValid() const;
+            uint32_t GetWidth() const;
+            uint32_t GetHeight() const;
+            uint32_t GetMipCount() const;
+
+        private:
+            struct Mip
+            {
+                uint32_t m_width = 0;
+                uint32_t m_height = 0;
+                //! Farthest depth of the texels covered by each texel, normalized so that larger values are farther away.
+                AZStd::vector<float> m_farthestDepths;
+            };
+
+            //! Highest number of texels tested along each axis, the mip is selected so that the projected box fits in them.
+            static constexpr uint32_t MaxTestedTexelsPerAxis = 4;
+
+            AZStd::vector<Mip> m_mips;
+            Matrix4x4 m_worldToClip = Matrix4x4::CreateIdentity();
+            bool m_reverseDepth = true;
+        };
+    } // namespace RPI
+} // namespace AZ
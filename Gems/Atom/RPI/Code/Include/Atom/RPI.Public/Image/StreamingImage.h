@@ -74,6 +74,10 @@ namespace AZ
             //! Requests the image mips be made available.
             //! A value of 0 is the most detailed mip level. The value is clamped to the last mip in the chain.
             void SetTargetMip(uint16_t targetMipLevel);
+
+            //! Reports the most detailed mip level the GPU sampled from the image, for instance read back from a min-mip buffer
+            //! written by shaders. When r_streamingImageFeedback is enabled, it replaces the target mip of the image.
+            void OnSampledMipFeedback(uint16_t sampledMipLevel);
             
             const Data::Instance<StreamingImagePool>& GetPool() const;
 
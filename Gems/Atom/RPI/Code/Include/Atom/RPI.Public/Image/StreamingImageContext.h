@@ -12,6 +12,7 @@
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/intrusive_list.h>
+#include <AzCore/std/limits.h>
 
 #include <Atom/RHI.Reflect/Limits.h>
 
@@ -54,6 +55,14 @@ namespace AZ
             //! Returns the timestamp of last access.
             size_t GetLastAccessTimestamp() const;
 
+            //! Returns the most detailed mip level the GPU sampled from the image, or InvalidMip if no feedback was received.
+            uint16_t GetFeedbackMip() const;
+
+            //! Returns the timestamp of the last sampler feedback received for the image.
+            size_t GetLastFeedbackTimestamp() const;
+
+            static constexpr uint16_t InvalidMip = AZStd::numeric_limits<uint16_t>::max();
+
             //! Calculate some mip stats which are used for determinate their expansion or eviction orders
             //! The stats include: m_mipLevelTargetAdjusted, m_residentMip, m_evictableMips, m_missingMips, m_residentMipSize
             //! This function need to be called every time after a mip is expanded or evicted or when the global mip bias is changed
@@ -73,6 +82,16 @@ namespace AZ
 
             // Tracks the last timestamp the image was requested.
             AZStd::atomic_size_t m_lastAccessTimestamp = {0};
+
+            // Tracks the most detailed mip level sampled by the GPU, reported through StreamingImage::OnSampledMipFeedback()
+            AZStd::atomic_uint16_t m_feedbackMip = {InvalidMip};
+
+            // Tracks the last timestamp sampler feedback was received for the image.
+            AZStd::atomic_size_t m_lastFeedbackTimestamp = {0};
+
+            // Whether no feedback was received for longer than r_streamingImageFeedbackTimeout, in which case the image is
+            // considered unused.
+            bool m_feedbackExpired = false;
                         
             // The target mip level which applied global mip bias
             uint16_t m_mipLevelTargetAdjusted = 0;
@@ -60,6 +60,7 @@ namespace AZ
             //! Called by the streaming image when events occur.
             void OnSetTargetMip(StreamingImage* image, uint16_t targetMipLevel);
             void OnMipChainAssetReady(StreamingImage* image);
+            void OnSampledMipFeedback(StreamingImage* image, uint16_t sampledMipLevel);
 
             //! Returns the number of images which are expanding their mipmaps
             uint32_t GetExpandingImageCount() const;
@@ -91,6 +92,16 @@ namespace AZ
             // Stream in one mip chain for the streaming image with highest priority
             bool ExpandOneMipChain();
 
+            // Evict one mip chain for the image with lowest priority among the images which aren't sampled anymore
+            bool EvictOneUnusedMipChain();
+
+            // Evict mip chains of unused images until the pool's device memory usage is same or less than the input number
+            // Return false if the memory usage is still higher
+            bool EvictUnusedImages(size_t targetMemoryUsage);
+
+            // Mark the images which didn't receive sampler feedback for longer than the feedback timeout as unused
+            void UpdateFeedbackExpiration();
+
             // Evict mipmaps for specific image
             // Return true if any mipmaps were evicted
             bool EvictUnusedMips(StreamingImage* image);
@@ -171,6 +182,9 @@ namespace AZ
 
             // a global option to add a bias to all the streaming images' target mip level
             int16_t m_globalMipBias = 0;
+
+            // Whether the sampler feedback of images drives their target mip level. Cached from r_streamingImageFeedback on creation.
+            bool m_feedbackEnabled = false;
         };
     }
 }
@@ -206,6 +206,14 @@ namespace AZ
             //! The RHI shader resource group owned by m_shaderResourceGroup. Held locally to avoid an indirection.
             const RHI::ShaderResourceGroup* m_rhiShaderResourceGroup = nullptr;
 
+            //! Slot of the material in the MaterialParameterBuffer, when bindless material parameters are enabled.
+            uint32_t m_parameterBufferIndex = static_cast<uint32_t>(-1);
+
+            //! Whether the material SRG reads its parameters from the MaterialParameterBuffer, in which case it only needs to be
+            //! compiled once and further changes are written to the buffer.
+            bool m_usesParameterBuffer = false;
+            bool m_isShaderResourceGroupCompiled = false;
+
             //! These the main material properties, exposed in the Material Editor, and configured directly by users.
             MaterialPropertyCollection m_materialProperties;
 
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RHI/MultiDeviceObject.h>
+#include <Atom/RPI.Public/Buffer/RingBuffer.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        class ShaderResourceGroupData;
+    }
+
+    namespace RPI
+    {
+        AZ_CVAR_EXTERNED(bool, r_bindlessMaterialParameters);
+
+        //! Stores the parameters of every material in a single structured buffer, so shaders can fetch them with a material index
+        //! instead of binding a material SRG per draw item.
+        //! Each material owns a fixed size slot, filled with the constant data of its material SRG followed by the bindless read
+        //! indices of its images, in the order of the SRG layout. Slots are written on the CPU when materials compile and the
+        //! buffer is uploaded once per frame when any slot changed.
+        //! The buffer is bound to the scene SRG as "m_materialParameters", and materials whose SRG has a
+        //! "m_materialParameterIndex" constant receive the index of their slot.
+        class MaterialParameterBuffer final
+        {
+        public:
+            AZ_RTTI(MaterialParameterBuffer, "{6E0F3B52-5C1D-4F27-9A8E-2B3D7C41E9A6}");
+            AZ_CLASS_ALLOCATOR(MaterialParameterBuffer, AZ::SystemAllocator);
+            AZ_DISABLE_COPY_MOVE(MaterialParameterBuffer);
+
+            static constexpr uint32_t InvalidIndex = static_cast<uint32_t>(-1);
+
+            //! Returns the buffer, or null when bindless material parameters are disabled.
+            static MaterialParameterBuffer* Get();
+
+            MaterialParameterBuffer();
+            ~MaterialParameterBuffer() = default;
+
+            void Init();
+            void Shutdown();
+
+            //! Reserves a slot for a material.
+            uint32_t AcquireIndex();
+
+            //! Returns the slot to the free list. The data of the slot is left as is until it's reused.
+            void ReleaseIndex(uint32_t index);
+
+            //! Writes the constant data and image bindless indices of the material SRG data into the slot of the material.
+            //! Returns false if the data doesn't fit in a slot, in which case the material needs to keep using its SRG.
+            bool UpdateParameters(uint32_t index, const RHI::ShaderResourceGroupData& srgData, RHI::MultiDevice::DeviceMask deviceMask);
+
+            //! Uploads the slots to the GPU if any changed since the previous upload.
+            void Upload();
+
+            //! Returns the view of the buffer uploaded last, or null if nothing was uploaded yet.
+            const RHI::BufferView* GetBufferView() const;
+
+            //! Size of a slot in bytes.
+            uint32_t GetSlotSize() const;
+
+        private:
+            //! CPU copy of the slots for each device, since bindless indices are device specific.
+            AZStd::unordered_map<int, AZStd::vector<uint32_t>> m_deviceSlotData;
+            AZStd::vector<uint32_t> m_freeIndices;
+            uint32_t m_slotCount = 0;
+            uint32_t m_slotSize = 0;
+            bool m_isDirty = false;
+
+            RingBuffer m_buffer;
+            mutable AZStd::mutex m_mutex;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -7,7 +7,13 @@
  */
 #pragma once
 
+#include <Atom/RPI.Public/Material/Material.h>
+#include <Atom/RPI.Public/Material/MaterialParameterBuffer.h>
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace AZ
 {
@@ -19,11 +25,43 @@ namespace AZ
         class MaterialSystem
         {
         public:
+            AZ_RTTI(MaterialSystem, "{0F5E2A7C-3B8D-4C61-9E24-7A1D5B9C3E80}");
+
+            static MaterialSystem* Get();
+
             static void Reflect(AZ::ReflectContext* context);
             static void GetAssetHandlers(AssetHandlerPtrList& assetHandlers);
 
+            virtual ~MaterialSystem() = default;
+
             void Init();
             void Shutdown();
+
+            //! Queues a property change, applied with all the other queued changes in the next FrameUpdate, which then compiles each
+            //! changed material once. Queuing the same property of a material again replaces the queued value.
+            //! This is meant for animating properties of many materials at once, where calling Material::SetPropertyValue and
+            //! Material::Compile on each material would compile them one at a time. This function is thread safe.
+            void QueuePropertyValue(const Data::Instance<Material>& material, MaterialPropertyIndex index, const MaterialPropertyValue& value);
+
+            //! Applies the queued property changes and compiles the changed materials, then uploads the material parameter buffer
+            //! when bindless material parameters are enabled.
+            void FrameUpdate();
+
+        private:
+            struct QueuedPropertyValues
+            {
+                Data::Instance<Material> m_material;
+                AZStd::vector<AZStd::pair<MaterialPropertyIndex, MaterialPropertyValue>> m_values;
+            };
+
+            //! Applies the queued property changes. Materials are compiled in parallel jobs, except the ones with Lua functors since
+            //! they share a script context. Materials that can't compile this frame stay queued.
+            void ApplyQueuedPropertyValues();
+
+            MaterialParameterBuffer m_parameterBuffer;
+
+            AZStd::mutex m_queuedPropertyValuesMutex;
+            AZStd::unordered_map<Material*, QueuedPropertyValues> m_queuedPropertyValues;
         };
 
     } // namespace RPI
@@ -142,6 +142,10 @@ namespace AZ
             //! A flag to indicate if the DrawPacket need to be rebuild when updating
             bool m_needUpdate = true;
 
+            //! A flag to indicate that some draw items use the root variant's pipeline state while theirs is compiling,
+            //! so the DrawPacket is rebuilt on every update until they are ready
+            bool m_hasPendingPipelineStates = false;
+
 #ifdef DEBUG_MESH_SHADERVARIANTS
             // For debug shader variants
             // The list of shader variant asset names used by the DrawPackets
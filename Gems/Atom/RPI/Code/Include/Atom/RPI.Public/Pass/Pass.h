@@ -543,6 +543,10 @@ namespace AZ
 
                         // Whether the pass was enabled last frame
                         uint64_t m_lastFrameEnabled : 1;
+
+                        // Whether the outputs of the pass aren't consumed by any rendering pass, in which case it's skipped.
+                        // Only set on leaf passes when r_cullUnconsumedPasses is enabled, see RenderPipeline::UpdatePassCulling
+                        uint64_t m_culled : 1;
                     };
                     uint64_t m_allFlags = 0;
                 };
@@ -639,6 +643,9 @@ namespace AZ
             // This sets the binding's attachment pointer to the connected binding's attachment
             void UpdateConnectedBinding(PassAttachmentBinding& binding);
 
+            // Makes the render pipeline re-evaluate which passes are culled, e.g. when an attachment of this pass is read back
+            void InvalidatePipelinePassCulling();
+
             // Process a PassFallbackConnection to connect an output to an input to act as a short-circuit for when Pass is disabled 
             void ProcessFallbackConnection(const PassFallbackConnection& connection);
 
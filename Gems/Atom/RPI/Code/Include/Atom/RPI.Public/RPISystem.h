@@ -30,6 +30,7 @@
 #include <AzCore/Debug/TraceMessageBus.h>
 #include <AzCore/Math/Uuid.h>
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/vector.h>
 
 namespace UnitTest
@@ -112,6 +113,9 @@ namespace AZ
             // Initializes XR resources (session, device, swapchain, etc).
             void InitXRSystem();
 
+            // Adds the latest gpu timestamps of the passes to the profiler timeline when r_gpuTimeline is enabled.
+            void UpdateGpuTimeline();
+
             // The set of core asset handlers registered by the system.
             AZStd::vector<AZStd::unique_ptr<Data::AssetHandler>> m_assetHandlers;
 
@@ -149,6 +153,12 @@ namespace AZ
 
             uint64_t m_renderTick = 0;
 
+            // Whether UpdateGpuTimeline enabled the timestamp queries of the passes
+            bool m_gpuTimelineEnabled = false;
+            // Per queue, the end of the newest gpu timestamp added to the timeline, so results that were not updated
+            // since the previous frame are not added again
+            AZStd::array<uint64_t, RHI::HardwareQueueClassCount> m_gpuTimelineEmittedTimestamps = {};
+
             // Application multisample state
             RHI::MultisampleState m_multisampleState;
 
@@ -288,6 +288,10 @@ namespace AZ
             // Called by Pass System at the start of rendering the frame
             void PassSystemFrameBegin(Pass::FramePrepareParams params);
 
+            // Flags the leaf passes whose outputs aren't consumed by any other pass, an imported attachment or a readback
+            // as culled so they skip FrameBegin. The result is kept until the passes change, see m_passCullingDirty.
+            void UpdatePassCulling();
+
             // Called by Pass System at the end of rendering the frame
             void PassSystemFrameEnd();
 
@@ -380,6 +384,12 @@ namespace AZ
 
             // Supports merging of passes as subpasses.
             bool m_allowSubpassMerging = false;
+
+            // Whether the culled passes need to be re-evaluated, set when the pass tree changes or a pass attachment is read back
+            bool m_passCullingDirty = true;
+
+            // The value of r_cullUnconsumedPasses the culled passes were last evaluated with
+            bool m_passCullingEnabled = false;
         };
 
     } // namespace RPI
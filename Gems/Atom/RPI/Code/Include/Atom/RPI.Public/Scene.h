@@ -243,9 +243,29 @@ namespace AZ
             void FinalizeDrawListsTaskGraph();
             void FinalizeDrawListsJobs();
 
+            // Rebuild the feature processor dependency data below from FeatureProcessor::GetDependencies() if the feature processors changed
+            void UpdateFeatureProcessorDependencies();
+
+            // Add a task calling function(FeatureProcessor&) for each feature processor, ordered by the feature processor dependencies
+            template<class Function>
+            void AddFeatureProcessorTasks(AZ::TaskGraph& taskGraph, const AZ::TaskDescriptor& descriptor, const Function& function);
+
+            // Start jobs calling function(FeatureProcessor&, AZ::Job&) for each feature processor, the feature processors with
+            // dependencies run in order on a single job since a job can only have one dependent
+            template<class Function>
+            void StartFeatureProcessorJobs(AZ::JobCompletion* completion, const Function& function);
+
             // List of feature processors that are active for this scene
             AZStd::vector<FeatureProcessorPtr> m_featureProcessors;
 
+            // For each feature processor of m_featureProcessors, the indices of the feature processors it depends on
+            AZStd::vector<AZStd::vector<size_t>> m_featureProcessorPrerequisites;
+            // The indices of the feature processors that depend on or are depended on by others, in dependency order
+            AZStd::vector<size_t> m_orderedFeatureProcessors;
+            // The indices of the feature processors without any dependency
+            AZStd::vector<size_t> m_independentFeatureProcessors;
+            bool m_featureProcessorDependenciesDirty = true;
+
             // List of pipelines of this scene. Each pipeline has an unique pipeline Id.
             AZStd::vector<RenderPipelinePtr> m_pipelines;
 
@@ -297,6 +317,7 @@ namespace AZ
             float m_simulationTime = 0.0;
             RHI::ShaderInputNameIndex m_prevTimeInputIndex = "m_prevTime";
             float m_prevSimulationTime = 0.0;
+            RHI::ShaderInputNameIndex m_materialParametersInputIndex = "m_materialParameters";
             uint16_t m_numActiveRenderPipelines = 0;
         };
 
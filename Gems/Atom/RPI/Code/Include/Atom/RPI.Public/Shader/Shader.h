@@ -21,6 +21,7 @@
 #include <AtomCore/Instance/InstanceData.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_set.h>
 
 namespace AZ
 {
@@ -125,6 +126,10 @@ namespace AZ
             //! Acquires a pipeline state directly from a descriptor.
             const RHI::PipelineState* AcquirePipelineState(const RHI::PipelineStateDescriptor& descriptor) const;
 
+            //! Acquires a pipeline state directly from a descriptor, compiling it on a worker thread if it isn't cached yet.
+            //! Returns null until the pipeline state is compiled, see RHI::PipelineStateCache::AcquirePipelineStateAsync.
+            const RHI::PipelineState* AcquirePipelineStateAsync(const RHI::PipelineStateDescriptor& descriptor) const;
+
             //! Finds and returns the shader resource group asset with the requested name. Returns an empty handle if no matching group was found.
             const RHI::Ptr<RHI::ShaderResourceGroupLayout>& FindShaderResourceGroupLayout(const Name& shaderResourceGroupName) const;
 
@@ -171,6 +176,15 @@ namespace AZ
 
             AZStd::unordered_map<int, ConstPtr<RHI::PipelineLibraryData>> LoadPipelineLibrary() const;
             void SavePipelineLibrary() const;
+
+            //! Loads the variants recorded in a previous session and precompiles their pipeline states where possible,
+            //! so they aren't compiled the first time they are used.
+            void WarmUpPipelineStates();
+            void SaveUsedVariants();
+
+            //! Precompiles the dispatch pipeline state of a compute shader variant. Draw pipeline states also depend on
+            //! the stream and attachment layouts of the pass and mesh, so they can only be compiled when used.
+            void WarmUpPipelineState(const ShaderVariant& shaderVariant) const;
             
             const ShaderVariant& GetVariantInternal(ShaderVariantStableId shaderVariantStableId);
 
@@ -212,6 +226,17 @@ namespace AZ
 
             //! PipelineLibrary file name
             AZStd::unordered_map<int, AZStd::string> m_pipelineLibraryPaths;
+
+            //! File listing the stable ids of the variants used by this shader, saved next to the pipeline library.
+            AZStd::string m_usedVariantsPath;
+
+            //! Stable ids of the variants used during this session, or loaded from the previous ones.
+            //! Guarded by m_variantCacheMutex.
+            AZStd::unordered_set<uint32_t> m_usedVariantStableIds;
+
+            //! Stable ids of the variants that are still loading and need their pipeline state precompiled once ready.
+            //! Guarded by m_variantCacheMutex.
+            AZStd::unordered_set<uint32_t> m_pendingWarmUpStableIds;
         };
     }
 }
@@ -90,6 +90,9 @@ namespace AZ
             /// Returns the underlying RHI shader resource group.
             RHI::ShaderResourceGroup* GetRHIShaderResourceGroup();
 
+            /// Returns the data set on the group, including changes that haven't been compiled yet.
+            const RHI::ShaderResourceGroupData& GetData() const;
+
             //////////////////////////////////////////////////////////////////////////
             // Methods for assignment / access of RPI Image types.
 
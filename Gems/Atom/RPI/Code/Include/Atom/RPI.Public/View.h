@@ -19,6 +19,8 @@
 #include <AzCore/Math/Matrix4x4.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/Name/Name.h>
 
 class MaskedOcclusionCulling;
@@ -36,6 +38,8 @@ namespace AZ
 
     namespace RPI
     {
+        class HierarchicalZBuffer;
+
         //! Represents a view into a scene, and is the primary interface for adding DrawPackets to the draw queues.
         //! It encapsulates the world<->view<->clip transforms and the per-view shader constants.
         //! Use View::CreateView() to make new vew Objects to ensure that you have a shared ViewPtr to pass around the code.
@@ -193,6 +197,11 @@ namespace AZ
             void SetMaskedOcclusionCullingDirty(bool dirty);
             bool GetMaskedOcclusionCullingDirty() const;
 
+            //! Sets the hierarchical depth buffer used to occlusion cull this view, built from the depth of a previous frame.
+            //! Can be called from any thread, for instance from the callback of a depth readback. Set to nullptr to disable it.
+            void SetHierarchicalZBuffer(AZStd::shared_ptr<const HierarchicalZBuffer> hierarchicalZBuffer);
+            AZStd::shared_ptr<const HierarchicalZBuffer> GetHierarchicalZBuffer() const;
+
             //! This is called by RenderPipeline when this view is added to the pipeline.
             void OnAddToRenderPipeline();
 
@@ -286,6 +295,10 @@ namespace AZ
             MaskedOcclusionCulling* m_maskedOcclusionCulling = nullptr;
             AZStd::atomic_bool m_maskedOcclusionCullingDirty = true;
 
+            // Depth of a previous frame used for occlusion culling
+            AZStd::shared_ptr<const HierarchicalZBuffer> m_hierarchicalZBuffer;
+            mutable AZStd::mutex m_hierarchicalZBufferMutex;
+
             AZStd::atomic_uint32_t m_andFlags{ 0xFFFFFFFF };
             AZStd::atomic_uint32_t m_orFlags { 0x00000000 };
 
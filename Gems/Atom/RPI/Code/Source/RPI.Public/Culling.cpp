@@ -9,6 +9,7 @@
 #include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
 #include <Atom/RPI.Public/AuxGeom/AuxGeomFeatureProcessorInterface.h>
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/HierarchicalZBuffer.h>
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
@@ -53,10 +54,18 @@ namespace AZ
         // Node work lists using node count
         AZ_CVAR(uint32_t, r_numNodesPerCullingJob, 25, nullptr, AZ::ConsoleFunctorFlags::Null, "Controls amount of nodes to collect for jobs when not using the entry count");
 
+        // Flat cullable storage
+        AZ_CVAR(bool, r_useFlatCullableStorage, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Frustum cull the flat array of cullable bounding spheres in batches instead of walking the visibility scene");
+        AZ_CVAR(uint32_t, r_numCullablesPerFlatCullingJob, 4096, nullptr, AZ::ConsoleFunctorFlags::Null, "Controls amount of cullables tested by each job when using the flat cullable storage");
+
         // This value dictates the amount to extrude the octree node OBB when doing a frustum intersection test against the camera frustum to help cut draw calls for shadow cascade passes.
         // Default is set to -1 as this is optimization needs to be triggered by the content developer by setting a reasonable non-negative value applicable for their content. 
         AZ_CVAR(int, r_shadowCascadeExtrusionAmount, -1, nullptr, AZ::ConsoleFunctorFlags::Null, "The amount of meters to extrude the Obb towards light direction when doing frustum overlap test against camera frustum");
 
+        // Occlusion culling against the hierarchical depth buffer of a previous frame, for views that were given one
+        AZ_CVAR(bool, r_hiZOcclusionCulling, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Occlusion cull against the hierarchical depth buffer of views that have one");
+        AZ_CVAR(float, r_hiZOcclusionDepthBias, 0.0001f, nullptr, AZ::ConsoleFunctorFlags::Null, "Normalized depth a bounding box needs to be behind the hierarchical depth buffer to be occluded");
+
 
 #ifdef AZ_CULL_DEBUG_ENABLED
         void DebugDrawWorldCoordinateAxes(AuxGeomDraw* auxGeom)
@@ -133,6 +142,10 @@ namespace AZ
             // the culling system starts Enumerating, so use soft_lock_shared here
             m_cullDataConcurrencyCheck.soft_lock_shared();
             m_visScene->InsertOrUpdateEntry(cullable.m_cullData.m_visibilityEntry);
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_cullableStorageMutex);
+                m_cullableStorage.AddOrUpdate(cullable);
+            }
             m_cullDataConcurrencyCheck.soft_unlock_shared();
         }
 
@@ -145,9 +158,71 @@ namespace AZ
             // the culling system starts Enumerating, so use soft_lock_shared here
             m_cullDataConcurrencyCheck.soft_lock_shared();
             m_visScene->RemoveEntry(cullable.m_cullData.m_visibilityEntry);
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_cullableStorageMutex);
+                m_cullableStorage.Remove(cullable);
+            }
             m_cullDataConcurrencyCheck.soft_unlock_shared();
         }
 
+        void CullingScene::CullableStorage::AddOrUpdate(Cullable& cullable)
+        {
+            if (cullable.m_storageIndex == Cullable::InvalidStorageIndex)
+            {
+                cullable.m_storageIndex = m_count++;
+                const size_t paddedCount = AZ::RoundUpToMultiple(static_cast<size_t>(m_count), static_cast<size_t>(BatchSize));
+                if (paddedCount != m_radius.size())
+                {
+                    // Padding entries are never read back, they only keep the batches whole
+                    m_centerX.resize(paddedCount, 0.0f);
+                    m_centerY.resize(paddedCount, 0.0f);
+                    m_centerZ.resize(paddedCount, 0.0f);
+                    m_radius.resize(paddedCount, 0.0f);
+                    m_cullables.resize(paddedCount, nullptr);
+                }
+                m_cullables[cullable.m_storageIndex] = &cullable;
+            }
+
+            const uint32_t index = cullable.m_storageIndex;
+            AZ_Assert(index < m_count && m_cullables[index] == &cullable, "Cullable is registered with another CullingScene");
+            const Sphere& boundingSphere = cullable.m_cullData.m_boundingSphere;
+            m_centerX[index] = boundingSphere.GetCenter().GetX();
+            m_centerY[index] = boundingSphere.GetCenter().GetY();
+            m_centerZ[index] = boundingSphere.GetCenter().GetZ();
+            m_radius[index] = boundingSphere.GetRadius();
+        }
+
+        void CullingScene::CullableStorage::Remove(Cullable& cullable)
+        {
+            const uint32_t index = cullable.m_storageIndex;
+            if (index == Cullable::InvalidStorageIndex)
+            {
+                return;
+            }
+            AZ_Assert(index < m_count && m_cullables[index] == &cullable, "Cullable is registered with another CullingScene");
+
+            // Move the last cullable in the freed slot to keep the arrays packed
+            const uint32_t lastIndex = --m_count;
+            if (index != lastIndex)
+            {
+                m_centerX[index] = m_centerX[lastIndex];
+                m_centerY[index] = m_centerY[lastIndex];
+                m_centerZ[index] = m_centerZ[lastIndex];
+                m_radius[index] = m_radius[lastIndex];
+                m_cullables[index] = m_cullables[lastIndex];
+                m_cullables[index]->m_storageIndex = index;
+            }
+            m_cullables[lastIndex] = nullptr;
+            cullable.m_storageIndex = Cullable::InvalidStorageIndex;
+
+            const size_t paddedCount = AZ::RoundUpToMultiple(static_cast<size_t>(m_count), static_cast<size_t>(BatchSize));
+            m_centerX.resize(paddedCount);
+            m_centerY.resize(paddedCount);
+            m_centerZ.resize(paddedCount);
+            m_radius.resize(paddedCount);
+            m_cullables.resize(paddedCount);
+        }
+
         uint32_t CullingScene::GetNumCullables() const
         {
             return m_visScene->GetEntryCount();
@@ -216,6 +291,7 @@ namespace AZ
             AZ::TaskGraphEvent* m_taskGraphEvent = nullptr;
             bool m_hasExcludeFrustum = false;
             bool m_applyCameraFrustumIntersectionTest = false;
+            AZStd::shared_ptr<const HierarchicalZBuffer> m_hierarchicalZBuffer;
 #ifdef AZ_CULL_DEBUG_ENABLED
 
             AuxGeomDrawPtr GetAuxGeomPtr()
@@ -242,6 +318,10 @@ namespace AZ
             worklistData->m_scene = &scene;
             worklistData->m_sceneEntityContextId = GetEntityContextIdForOcclusion(&scene);
             worklistData->m_view = &view;
+            if (r_hiZOcclusionCulling)
+            {
+                worklistData->m_hierarchicalZBuffer = view.GetHierarchicalZBuffer();
+            }
             worklistData->m_frustum = frustum;
             worklistData->m_parentJob = parentJob;
             worklistData->m_taskGraphEvent = taskGraphEvent;
@@ -282,6 +362,7 @@ namespace AZ
             // These variable are only used for the gathering of debug information.
             uint32_t numDrawPackets = 0;
             uint32_t numVisibleCullables = 0;
+            uint32_t numOccludedCullables = 0;
 #endif
             endIdx = (endIdx == -1) ? s32(entries.size()) : endIdx;
 
@@ -333,6 +414,12 @@ namespace AZ
                         numDrawPackets += drawPacketCount;
 #endif
                     }
+#ifdef AZ_CULL_DEBUG_ENABLED
+                    else
+                    {
+                        ++numOccludedCullables;
+                    }
+#endif
                 }
             }
 
@@ -378,6 +465,7 @@ namespace AZ
                 //no need for mutex here since these are all atomics
                 cullStats.m_numVisibleDrawPackets += numDrawPackets;
                 cullStats.m_numVisibleCullables += numVisibleCullables;
+                cullStats.m_numOccludedCullables += numOccludedCullables;
                 ++cullStats.m_numJobs;
             }
 #endif
@@ -467,6 +555,105 @@ namespace AZ
             }
         }
 
+        // Frustum culls a range of the flat cullable storage, a batch of bounding spheres at a time, and hands the cullables in the
+        // frustum to ProcessEntrylist for the remaining per-cullable tests and the lod selection.
+        static void ProcessCullableStorageRange(
+            const AZStd::shared_ptr<WorklistData>& worklistData, const CullingScene::CullableStorage& storage, uint32_t begin, uint32_t end)
+        {
+            AZ_PROFILE_SCOPE(RPI, "Culling: ProcessCullableStorageRange");
+
+            constexpr uint32_t BatchSize = CullingScene::CullableStorage::BatchSize;
+            AZ_Assert(begin % BatchSize == 0, "Cullable storage ranges must start at a batch boundary");
+
+            const Frustum& frustum = worklistData->m_frustum;
+            float planes[Frustum::PlaneId::MAX][4];
+            for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                frustum.GetPlane(planeId).GetPlaneEquationCoefficients().StoreToFloat4(planes[planeId]);
+            }
+            const bool frustumCulling = worklistData->m_debugCtx->m_enableFrustumCulling;
+
+            AZStd::vector<AzFramework::VisibilityEntry*> entries;
+            entries.reserve(end - begin);
+            for (uint32_t batchBegin = begin; batchBegin < end; batchBegin += BatchSize)
+            {
+                const float* centerX = storage.m_centerX.data() + batchBegin;
+                const float* centerY = storage.m_centerY.data() + batchBegin;
+                const float* centerZ = storage.m_centerZ.data() + batchBegin;
+                const float* radius = storage.m_radius.data() + batchBegin;
+
+                // Same classification as Frustum::IntersectSphere, for a whole batch at once
+                bool exterior[BatchSize] = {};
+                bool intersects[BatchSize] = {};
+                if (frustumCulling)
+                {
+                    for (const float* plane : planes)
+                    {
+                        for (uint32_t lane = 0; lane < BatchSize; ++lane)
+                        {
+                            const float distance = plane[0] * centerX[lane] + plane[1] * centerY[lane] + plane[2] * centerZ[lane] + plane[3];
+                            exterior[lane] |= distance < -radius[lane];
+                            intersects[lane] |= fabsf(distance) < radius[lane];
+                        }
+                    }
+                }
+
+                const uint32_t laneCount = AZStd::min(BatchSize, end - batchBegin);
+                for (uint32_t lane = 0; lane < laneCount; ++lane)
+                {
+                    if (exterior[lane])
+                    {
+                        continue;
+                    }
+
+                    Cullable* cullable = storage.m_cullables[batchBegin + lane];
+                    if (intersects[lane] && !ShapeIntersection::Overlaps(frustum, cullable->m_cullData.m_boundingObb))
+                    {
+                        continue;
+                    }
+                    entries.push_back(&cullable->m_cullData.m_visibilityEntry);
+                }
+            }
+
+            if (!entries.empty())
+            {
+                ProcessEntrylist(worklistData, entries, true);
+            }
+        }
+
+        // Splits the flat cullable storage into ranges processed by jobs or tasks.
+        static void ProcessCullableStorage(
+            const AZStd::shared_ptr<WorklistData>& worklistData,
+            const CullingScene::CullableStorage& storage,
+            AZ::Job* parentJob,
+            AZ::TaskGraph* taskGraph)
+        {
+            static const AZ::TaskDescriptor descriptor{ "AZ::RPI::ProcessCullableStorageRange", "Graphics" };
+
+            // Ranges start at a batch boundary so every batch is loaded from the same aligned offsets
+            const uint32_t rangeSize = AZ::RoundUpToMultiple(
+                AZStd::max(static_cast<uint32_t>(r_numCullablesPerFlatCullingJob), 1u), CullingScene::CullableStorage::BatchSize);
+            for (uint32_t begin = 0; begin < storage.m_count; begin += rangeSize)
+            {
+                const uint32_t end = AZStd::min(begin + rangeSize, storage.m_count);
+                auto processRange = [worklistData, &storage, begin, end]()
+                {
+                    ProcessCullableStorageRange(worklistData, storage, begin, end);
+                };
+
+                if (taskGraph != nullptr)
+                {
+                    taskGraph->AddTask(descriptor, AZStd::move(processRange));
+                }
+                else
+                {
+                    AZ::Job* job = AZ::CreateJobFunction(AZStd::move(processRange), true);
+                    parentJob->SetContinuation(job);
+                    job->Start();
+                }
+            }
+        }
+
         static bool TestOcclusionCulling(
             const AZStd::shared_ptr<WorklistData>& worklistData, const AzFramework::VisibilityEntry* visibleEntry)
         {
@@ -516,6 +703,12 @@ namespace AZ
                 return state != AzFramework::OcclusionState::Hidden;
             }
 
+            if (worklistData->m_hierarchicalZBuffer &&
+                worklistData->m_hierarchicalZBuffer->IsOccluded(visibleEntry->m_boundingVolume, r_hiZOcclusionDepthBias))
+            {
+                return false;
+            }
+
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
             MaskedOcclusionCulling* maskedOcclusionCulling = worklistData->m_view->GetMaskedOcclusionCulling();
             if (!maskedOcclusionCulling || !worklistData->m_view->GetMaskedOcclusionCullingDirty())
@@ -712,6 +905,12 @@ namespace AZ
                     worklistData->m_applyCameraFrustumIntersectionTest = true;
                 }
             }
+
+            if (r_useFlatCullableStorage)
+            {
+                ProcessCullableStorage(worklistData, m_cullableStorage, parentJob, taskGraph);
+                return;
+            }
             
             auto nodeVisitorLambda = [worklistData, taskGraph, parentJob, &worklist](const AzFramework::IVisibilityScene::NodeData& nodeData) -> void
             {
@@ -8,14 +8,38 @@
 
 #include <Atom/RPI.Public/DynamicDraw/DynamicBuffer.h>
 #include <Atom/RPI.Public/DynamicDraw/DynamicBufferAllocator.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(uint32_t, r_dynamicBufferMaxSize, 128 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+            "Highest number of bytes the dynamic buffer allocator can allocate in a single frame. When the initial buffer of a frame is "
+            "full, more buffers are chained to it until this size is reached. Allocations that don't fit fail and their draws are dropped.");
+
+        uint64_t DynamicBufferAllocator::PackPosition(uint32_t pageIndex, uint32_t offset)
+        {
+            return (static_cast<uint64_t>(pageIndex) << 32) | offset;
+        }
+
+        uint32_t DynamicBufferAllocator::GetPageIndex(uint64_t position)
+        {
+            return static_cast<uint32_t>(position >> 32);
+        }
+
+        uint32_t DynamicBufferAllocator::GetOffset(uint64_t position)
+        {
+            return static_cast<uint32_t>(position);
+        }
+
         void DynamicBufferAllocator::Init(uint32_t ringBufferSize)
         {
-            if (m_bufferData.IsCurrentBufferValid())
+            if (m_frameBuffers.GetCurrentElement().m_pageCount > 0)
             {
                 AZ_Assert(false, "DynamicBufferAllocator was already initialized");
                 return;
@@ -23,84 +47,218 @@ namespace AZ
 
             m_ringBufferSize = ringBufferSize;
 
-            for (unsigned i{ 0 }; i < m_bufferData.GetElementCount(); i++)
+            for (unsigned i{ 0 }; i < m_frameBuffers.GetElementCount(); i++)
             {
-                m_bufferData.CreateOrResizeCurrentBuffer(m_ringBufferSize);
-                m_bufferStartAddresses.GetCurrentElement() = m_bufferData.GetCurrentElement()->Map(m_ringBufferSize, 0);
-                m_bufferData.AdvanceCurrentElement();
-                m_bufferStartAddresses.AdvanceCurrentElement();
+                FrameBuffers& frameBuffers = m_frameBuffers.AdvanceCurrentElement();
+                if (MapPage(frameBuffers.m_pages[0], m_ringBufferSize))
+                {
+                    frameBuffers.m_pageCount = 1;
+                }
             }
+
+            m_currentPosition = PackPosition(0, 0);
+            m_statistics = {};
+            m_statistics.m_capacity = m_ringBufferSize;
         }
 
         void DynamicBufferAllocator::Shutdown()
         {
-            for (unsigned i{ 0 }; i < m_bufferData.GetElementCount(); i++)
+            for (unsigned i{ 0 }; i < m_frameBuffers.GetElementCount(); i++)
+            {
+                FrameBuffers& frameBuffers = m_frameBuffers.AdvanceCurrentElement();
+                for (Page& page : frameBuffers.m_pages)
+                {
+                    UnmapPage(page);
+                    page.m_buffer = nullptr;
+                    page.m_size = 0;
+                }
+                frameBuffers.m_pageCount = 0;
+            }
+        }
+
+        bool DynamicBufferAllocator::MapPage(Page& page, uint32_t size)
+        {
+            UnmapPage(page);
+
+            if (!page.m_buffer)
+            {
+                CommonBufferDescriptor desc;
+                desc.m_bufferName = "DynamicBufferAllocator";
+                desc.m_poolType = CommonBufferPoolType::DynamicInputAssembly;
+                desc.m_elementSize = 1;
+                desc.m_byteCount = size;
+                page.m_buffer = BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+            }
+            else if (page.m_buffer->GetBufferSize() < size)
+            {
+                page.m_buffer->Resize(size);
+            }
+
+            if (!page.m_buffer)
+            {
+                return false;
+            }
+
+            page.m_size = static_cast<uint32_t>(page.m_buffer->GetBufferSize());
+            page.m_addresses = page.m_buffer->Map(page.m_size, 0);
+            return true;
+        }
+
+        void DynamicBufferAllocator::UnmapPage(Page& page)
+        {
+            if (!page.m_addresses.empty())
+            {
+                page.m_buffer->Unmap();
+                page.m_addresses.clear();
+            }
+        }
+
+        bool DynamicBufferAllocator::AddPage(uint32_t currentPageIndex, uint32_t size)
+        {
+            AZ_PROFILE_SCOPE(RPI, "DynamicBufferAllocator: AddPage");
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_pageMutex);
+
+            // Another thread already moved to a new page
+            if (GetPageIndex(m_currentPosition.load()) != currentPageIndex)
+            {
+                return true;
+            }
+
+            FrameBuffers& frameBuffers = m_frameBuffers.GetCurrentElement();
+            const uint32_t pageIndex = currentPageIndex + 1;
+            uint64_t frameSize = 0;
+            for (uint32_t i = 0; i < pageIndex; ++i)
+            {
+                frameSize += frameBuffers.m_pages[i].m_size;
+            }
+
+            const uint32_t pageSize = AZStd::max(m_ringBufferSize, size);
+            if (pageIndex >= MaxPageCount || frameSize + pageSize > r_dynamicBufferMaxSize)
+            {
+                return false;
+            }
+
+            if (!MapPage(frameBuffers.m_pages[pageIndex], pageSize))
+            {
+                return false;
+            }
+
+            frameBuffers.m_pageCount.store(AZStd::max(frameBuffers.m_pageCount.load(), pageIndex + 1));
+            m_statistics.m_capacity = aznumeric_cast<uint32_t>(frameSize + frameBuffers.m_pages[pageIndex].m_size);
+
+            // Nothing can be allocated in the previous page anymore, so its remaining space is counted as used
+            m_currentPosition.store(PackPosition(pageIndex, 0));
+            return true;
+        }
+
+        void DynamicBufferAllocator::MergePages()
+        {
+            FrameBuffers& frameBuffers = m_frameBuffers.GetCurrentElement();
+            const uint32_t pageCount = frameBuffers.m_pageCount;
+            if (pageCount <= 1)
+            {
+                return;
+            }
+
+            AZ_PROFILE_SCOPE(RPI, "DynamicBufferAllocator: MergePages");
+
+            // The frame was last used FrameCountMax frames ago, so the gpu is done with its buffers
+            uint32_t frameSize = 0;
+            for (uint32_t i = 0; i < pageCount; ++i)
             {
-                m_bufferData.AdvanceCurrentElement()->Unmap();
-                m_bufferStartAddresses.AdvanceCurrentElement().clear();
+                Page& page = frameBuffers.m_pages[i];
+                frameSize += page.m_size;
+                if (i > 0)
+                {
+                    UnmapPage(page);
+                    page.m_buffer = nullptr;
+                    page.m_size = 0;
+                }
             }
+
+            frameBuffers.m_pageCount = MapPage(frameBuffers.m_pages[0], frameSize) ? 1 : 0;
         }
 
         // [GFX TODO][ATOM-13182] Add unit tests for DynamicBufferAllocator's Allocate function
         RHI::Ptr<DynamicBuffer> DynamicBufferAllocator::Allocate(uint32_t size, uint32_t alignment)
         {
-            // m_bufferData can be invalid for Null back end
-            if (m_bufferStartAddresses.GetCurrentElement().empty() || !m_bufferStartAddresses.GetCurrentElement().begin()->second)
+            const FrameBuffers& frameBuffers = m_frameBuffers.GetCurrentElement();
+
+            // The buffers can be invalid for Null back end
+            if (frameBuffers.m_pageCount == 0 || frameBuffers.m_pages[0].m_addresses.empty() ||
+                !frameBuffers.m_pages[0].m_addresses.begin()->second)
             {
                 return nullptr;
             }
 
-            m_currentPosition = RHI::AlignUp(m_currentPosition, alignment);
-
-            if (size > m_ringBufferSize)
+            if (size > r_dynamicBufferMaxSize)
             {
                 AZ_WarningOnce(
                     "RPI",
                     !m_enableAllocationWarning,
-                    "DynamicBufferAllocator::Allocate: try to allocate buffer which size is larger than the ring buffer size");
+                    "DynamicBufferAllocator::Allocate: try to allocate buffer which size is larger than r_dynamicBufferMaxSize");
                 return nullptr;
             }
 
-            // Return if the allocation of current frame has reached limit
-            if (m_currentPosition + size > m_ringBufferSize)
+            uint64_t position = m_currentPosition.load();
+            uint32_t pageIndex;
+            uint32_t offset;
+            while (true)
             {
-                AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: no more buffer space is available");
-                return nullptr;
+                pageIndex = GetPageIndex(position);
+                offset = RHI::AlignUp(GetOffset(position), alignment);
+
+                if (static_cast<uint64_t>(offset) + size <= frameBuffers.m_pages[pageIndex].m_size)
+                {
+                    if (m_currentPosition.compare_exchange_weak(position, PackPosition(pageIndex, offset + size)))
+                    {
+                        break;
+                    }
+                    continue;
+                }
+
+                // The page is full, chain a new one
+                if (!AddPage(pageIndex, size + alignment))
+                {
+                    AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: no more buffer space is available");
+                    return nullptr;
+                }
+                position = m_currentPosition.load();
             }
 
+            const Page& page = frameBuffers.m_pages[pageIndex];
             RHI::Ptr<DynamicBuffer> allocatedBuffer = aznew DynamicBuffer();
-            for(auto [deviceIndex, address] : m_bufferStartAddresses.GetCurrentElement())
+            for (auto [deviceIndex, address] : page.m_addresses)
             {
-                allocatedBuffer->m_address[deviceIndex] = (uint8_t*)address + m_currentPosition;
+                allocatedBuffer->m_address[deviceIndex] = (uint8_t*)address + offset;
             }
             allocatedBuffer->m_size = size;
+            allocatedBuffer->m_offset = offset;
+            allocatedBuffer->m_pageIndex = pageIndex;
             allocatedBuffer->m_allocator = this;
 
-            m_currentPosition += size;
-
             return allocatedBuffer;
         }
 
         RHI::IndexBufferView DynamicBufferAllocator::GetIndexBufferView(RHI::Ptr<DynamicBuffer> dynamicBuffer, RHI::IndexFormat format)
         {
             return RHI::IndexBufferView(
-                *m_bufferData.GetCurrentElement()->GetRHIBuffer(), GetBufferAddressOffset(dynamicBuffer), dynamicBuffer->m_size, format);
+                *GetPage(*dynamicBuffer).m_buffer->GetRHIBuffer(), dynamicBuffer->m_offset, dynamicBuffer->m_size, format);
         }
 
         RHI::StreamBufferView DynamicBufferAllocator::GetStreamBufferView(RHI::Ptr<DynamicBuffer> dynamicBuffer, uint32_t strideByteCount)
         {
             return RHI::StreamBufferView(
-                *m_bufferData.GetCurrentElement()->GetRHIBuffer(),
-                GetBufferAddressOffset(dynamicBuffer),
+                *GetPage(*dynamicBuffer).m_buffer->GetRHIBuffer(),
+                dynamicBuffer->m_offset,
                 dynamicBuffer->m_size,
                 strideByteCount);
         }
 
-        uint32_t DynamicBufferAllocator::GetBufferAddressOffset(RHI::Ptr<DynamicBuffer> dynamicBuffer)
+        const DynamicBufferAllocator::Page& DynamicBufferAllocator::GetPage(const DynamicBuffer& dynamicBuffer) const
         {
-            auto it = m_bufferStartAddresses.GetCurrentElement().begin();
-
-            return aznumeric_cast<uint32_t>((uint8_t*)dynamicBuffer->m_address[it->first] - (uint8_t*)it->second);
+            return m_frameBuffers.GetCurrentElement().m_pages[dynamicBuffer.m_pageIndex];
         }
 
         void DynamicBufferAllocator::SetEnableAllocationWarning(bool enable)
@@ -108,11 +266,28 @@ namespace AZ
             m_enableAllocationWarning = enable;
         }
 
+        DynamicBufferAllocator::Statistics DynamicBufferAllocator::GetStatistics() const
+        {
+            return m_statistics;
+        }
+
         void DynamicBufferAllocator::FrameEnd()
         {
-            m_bufferData.AdvanceCurrentElement();
-            m_bufferStartAddresses.AdvanceCurrentElement();
-            m_currentPosition = 0;
+            const FrameBuffers& frameBuffers = m_frameBuffers.GetCurrentElement();
+            const uint64_t position = m_currentPosition.load();
+            uint32_t frameSize = GetOffset(position);
+            for (uint32_t i = 0; i < GetPageIndex(position); ++i)
+            {
+                frameSize += frameBuffers.m_pages[i].m_size;
+            }
+            m_statistics.m_lastFrameSize = frameSize;
+            m_statistics.m_highWatermarkSize = AZStd::max(m_statistics.m_highWatermarkSize, frameSize);
+
+            m_frameBuffers.AdvanceCurrentElement();
+            MergePages();
+
+            m_statistics.m_capacity = m_frameBuffers.GetCurrentElement().m_pages[0].m_size;
+            m_currentPosition = PackPosition(0, 0);
         }
     } // namespace RPI
 } // namespace AZ
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/HierarchicalZBuffer.h>
+#include <Atom/RPI.Reflect/Base.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        void HierarchicalZBuffer::Build(
+            AZStd::span<const float> depths, uint32_t width, uint32_t height, const Matrix4x4& worldToClip, bool reverseDepth)
+        {
+            AZ_PROFILE_SCOPE(RPI, "HierarchicalZBuffer: Build");
+
+            m_mips.clear();
+            m_worldToClip = worldToClip;
+            m_reverseDepth = reverseDepth;
+
+            if (width == 0 || height == 0 || depths.size() < static_cast<size_t>(width) * height)
+            {
+                AZ_Error("HierarchicalZBuffer", width == 0 || height == 0, "Depth buffer is smaller than %ux%u", width, height);
+                return;
+            }
+
+            Mip& baseMip = m_mips.emplace_back();
+            baseMip.m_width = width;
+            baseMip.m_height = height;
+            baseMip.m_farthestDepths.resize_no_construct(static_cast<size_t>(width) * height);
+            for (size_t i = 0; i < baseMip.m_farthestDepths.size(); ++i)
+            {
+                baseMip.m_farthestDepths[i] = reverseDepth ? 1.0f - depths[i] : depths[i];
+            }
+
+            // Each mip is half the size of the previous one rounded up, so the last texel of an odd sized mip covers a single column or row.
+            while (m_mips.back().m_width > 1 || m_mips.back().m_height > 1)
+            {
+                const uint32_t sourceIndex = static_cast<uint32_t>(m_mips.size() - 1);
+                Mip& mip = m_mips.emplace_back();
+                const Mip& source = m_mips[sourceIndex];
+                mip.m_width = (source.m_width + 1) / 2;
+                mip.m_height = (source.m_height + 1) / 2;
+                mip.m_farthestDepths.resize_no_construct(static_cast<size_t>(mip.m_width) * mip.m_height);
+
+                for (uint32_t y = 0; y < mip.m_height; ++y)
+                {
+                    const uint32_t sourceY0 = y * 2;
+                    const uint32_t sourceY1 = AZStd::min(sourceY0 + 1, source.m_height - 1);
+                    for (uint32_t x = 0; x < mip.m_width; ++x)
+                    {
+                        const uint32_t sourceX0 = x * 2;
+                        const uint32_t sourceX1 = AZStd::min(sourceX0 + 1, source.m_width - 1);
+                        mip.m_farthestDepths[y * mip.m_width + x] = AZStd::max(
+                            AZStd::max(source.m_farthestDepths[sourceY0 * source.m_width + sourceX0], source.m_farthestDepths[sourceY0 * source.m_width + sourceX1]),
+                            AZStd::max(source.m_farthestDepths[sourceY1 * source.m_width + sourceX0], source.m_farthestDepths[sourceY1 * source.m_width + sourceX1]));
+                    }
+                }
+            }
+        }
+
+        bool HierarchicalZBuffer::IsOccluded(const Aabb& aabb, float depthBias) const
+        {
+            if (m_mips.empty())
+            {
+                return false;
+            }
+
+            const Vector3& minBound = aabb.GetMin();
+            const Vector3& maxBound = aabb.GetMax();
+
+            float nearestDepth = FLT_MAX;
+            float ndcMinX = FLT_MAX;
+            float ndcMinY = FLT_MAX;
+            float ndcMaxX = -FLT_MAX;
+            float ndcMaxY = -FLT_MAX;
+            for (uint32_t index = 0; index < 8; ++index)
+            {
+                const Vector4 corner = m_worldToClip *
+                    Vector4((index & 1) ? maxBound.GetX() : minBound.GetX(),
+                            (index & 2) ? maxBound.GetY() : minBound.GetY(),
+                            (index & 4) ? maxBound.GetZ() : minBound.GetZ(),
+                            1.0f);
+
+                // The box crosses the near plane, it can't be occluded
+                if (corner.GetW() < 0.00000001f)
+                {
+                    return false;
+                }
+
+                const float invW = 1.0f / corner.GetW();
+                const float depth = corner.GetZ() * invW;
+                nearestDepth = AZStd::min(nearestDepth, m_reverseDepth ? 1.0f - depth : depth);
+                ndcMinX = AZStd::min(ndcMinX, corner.GetX() * invW);
+                ndcMinY = AZStd::min(ndcMinY, corner.GetY() * invW);
+                ndcMaxX = AZStd::max(ndcMaxX, corner.GetX() * invW);
+                ndcMaxY = AZStd::max(ndcMaxY, corner.GetY() * invW);
+            }
+
+            // Boxes outside of the screen are left to frustum culling
+            if (ndcMaxX < -1.0f || ndcMinX > 1.0f || ndcMaxY < -1.0f || ndcMinY > 1.0f)
+            {
+                return false;
+            }
+
+            // Convert to texels of the base mip, with the first row at the top of the screen
+            const Mip& baseMip = m_mips.front();
+            auto toTexel = [](float ndc, uint32_t size)
+            {
+                const float texel = (AZStd::clamp(ndc, -1.0f, 1.0f) * 0.5f + 0.5f) * size;
+                return AZStd::min(static_cast<uint32_t>(texel), size - 1);
+            };
+            const uint32_t texelMinX = toTexel(ndcMinX, baseMip.m_width);
+            const uint32_t texelMaxX = toTexel(ndcMaxX, baseMip.m_width);
+            const uint32_t texelMinY = toTexel(-ndcMaxY, baseMip.m_height);
+            const uint32_t texelMaxY = toTexel(-ndcMinY, baseMip.m_height);
+
+            // Select the first mip where the box covers few enough texels
+            uint32_t mipIndex = 0;
+            while (mipIndex + 1 < m_mips.size() &&
+                   (((texelMaxX >> mipIndex) - (texelMinX >> mipIndex) + 1) > MaxTestedTexelsPerAxis ||
+                    ((texelMaxY >> mipIndex) - (texelMinY >> mipIndex) + 1) > MaxTestedTexelsPerAxis))
+            {
+                ++mipIndex;
+            }
+
+            const Mip& mip = m_mips[mipIndex];
+            const float occludedDepth = nearestDepth - depthBias;
+            for (uint32_t y = texelMinY >> mipIndex; y <= (texelMaxY >> mipIndex); ++y)
+            {
+                for (uint32_t x = texelMinX >> mipIndex; x <= (texelMaxX >> mipIndex); ++x)
+                {
+                    if (mip.m_farthestDepths[y * mip.m_width + x] >= occludedDepth)
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        bool HierarchicalZBuffer::IsValid() const
+        {
+            return !m_mips.empty();
+        }
+
+        uint32_t HierarchicalZBuffer::GetWidth() const
+        {
+            return m_mips.empty() ? 0 : m_mips.front().m_width;
+        }
+
+        uint32_t HierarchicalZBuffer::GetHeight() const
+        {
+            return m_mips.empty() ? 0 : m_mips.front().m_height;
+        }
+
+        uint32_t HierarchicalZBuffer::GetMipCount() const
+        {
+            return static_cast<uint32_t>(m_mips.size());
+        }
+    } // namespace RPI
+} // namespace AZ
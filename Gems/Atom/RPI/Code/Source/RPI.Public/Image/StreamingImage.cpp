@@ -251,6 +251,18 @@ namespace AZ
             }
         }
         
+        void StreamingImage::OnSampledMipFeedback(uint16_t sampledMipLevel)
+        {
+            if (m_streamingController)
+            {
+                // feedback is written by shaders, which may report mips past the end of the chain
+                const uint16_t lastMipLevel = aznumeric_cast<uint16_t>(m_imageAsset->GetImageDescriptor().m_mipLevels - 1);
+                size_t mipChainIndex = m_imageAsset->GetMipChainIndex(AZStd::min(sampledMipLevel, lastMipLevel));
+                size_t clampedMipLevel = m_imageAsset->GetMipLevel(mipChainIndex);
+                m_streamingController->OnSampledMipFeedback(this, aznumeric_cast<uint16_t>(clampedMipLevel));
+            }
+        }
+
         uint16_t StreamingImage::GetResidentMipLevel()
         {
             return static_cast<uint16_t>(m_image->GetResidentMipLevel());
@@ -28,6 +28,16 @@ namespace AZ
             return m_lastAccessTimestamp;
         }
 
+        uint16_t StreamingImageContext::GetFeedbackMip() const
+        {
+            return m_feedbackMip;
+        }
+
+        size_t StreamingImageContext::GetLastFeedbackTimestamp() const
+        {
+            return m_lastFeedbackTimestamp;
+        }
+
         void StreamingImageContext::UpdateMipStats()
         {
             m_mipLevelTargetAdjusted = m_streamingImage->m_streamingController->GetImageTargetMip(m_streamingImage);
@@ -10,6 +10,7 @@
 #include <Atom/RPI.Public/Image/StreamingImageContext.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/Time/ITime.h>
 
@@ -21,6 +22,18 @@ namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(bool, r_streamingImageFeedback, false, nullptr, ConsoleFunctorFlags::DontReplicate,
+            "Use the most detailed mip sampled by the GPU, reported with StreamingImage::OnSampledMipFeedback, as the streaming target "
+            "of the images which receive feedback. Read when a streaming image pool is created.");
+
+        AZ_CVAR(uint32_t, r_streamingImageFeedbackTimeout, 60, nullptr, ConsoleFunctorFlags::DontReplicate,
+            "Number of streaming updates without sampler feedback after which an image is considered unused. Unused images stream "
+            "out to their least detailed mip chain and are evicted first when the pool is over budget.");
+
+        AZ_CVAR(float, r_streamingImagePoolEvictionThreshold, 0.9f, nullptr, ConsoleFunctorFlags::DontReplicate,
+            "Fraction of the streaming image pool budget above which mip chains of unused images are evicted and mip expansion "
+            "stops. A value of 1 or more only evicts when the pool runs out of memory.");
+
 #if ENABLE_STREAMING_DEBUG_TRACE
         #define StreamingDebugOutput(window, ...) AZ_TracePrintf(window, __VA_ARGS__);
 #else
@@ -31,6 +44,7 @@ namespace AZ
         {
             AZStd::unique_ptr<StreamingImageController> controller = AZStd::make_unique<StreamingImageController>();
             controller->m_pool = &pool;
+            controller->m_feedbackEnabled = r_streamingImageFeedback;
             controller->m_pool->SetLowMemoryCallback(AZStd::bind(&StreamingImageController::ReleaseMemory, controller.get(), AZStd::placeholders::_1));
             return controller;
         }
@@ -190,10 +204,25 @@ namespace AZ
             {
                 m_lastLowMemory = 0;
             }
-            
+
+            if (m_feedbackEnabled)
+            {
+                UpdateFeedbackExpiration();
+            }
+
+            // Keep the memory usage under the eviction threshold of the budget by evicting images which aren't used anymore.
+            // If that's not enough, stop expanding instead of waiting for the pool to run out of memory.
+            bool isOverBudget = false;
+            const size_t budget = m_pool->GetHeapMemoryUsage(RHI::HeapMemoryLevel::Device).m_budgetInBytes;
+            if (budget > 0 && r_streamingImagePoolEvictionThreshold < 1.0f)
+            {
+                const float threshold = AZStd::max(static_cast<float>(r_streamingImagePoolEvictionThreshold), 0.0f);
+                isOverBudget = !EvictUnusedImages(static_cast<size_t>(budget * threshold));
+            }
+
             // Try to expand if it's not in low memory state
             jobCount = 0;
-            while (jobCount < c_jobCount && m_lastLowMemory == 0)
+            while (jobCount < c_jobCount && m_lastLowMemory == 0 && !isOverBudget)
             {
                 if (ExpandOneMipChain())
                 {
@@ -230,6 +259,59 @@ namespace AZ
             ReinsertImageToLists(image);
         }
 
+        void StreamingImageController::OnSampledMipFeedback(StreamingImage* image, uint16_t sampledMipLevel)
+        {
+            StreamingImageContext* context = image->m_streamingContext.get();
+
+            const uint16_t previousMipLevel = context->m_feedbackMip.exchange(sampledMipLevel);
+            context->m_lastFeedbackTimestamp = m_timestamp;
+
+            if (!m_feedbackEnabled)
+            {
+                return;
+            }
+
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_imageListAccessMutex);
+            const bool wasExpired = context->m_feedbackExpired;
+            context->m_feedbackExpired = false;
+
+            // Feedback is usually reported every frame, only update the image when its target changes
+            if (previousMipLevel != sampledMipLevel || wasExpired)
+            {
+                if (!context->m_queuedForMipExpand)
+                {
+                    EvictUnusedMips(image);
+                }
+                ReinsertImageToLists(image);
+            }
+        }
+
+        void StreamingImageController::UpdateFeedbackExpiration()
+        {
+            AZ_PROFILE_SCOPE(RPI, "StreamingImageController: UpdateFeedbackExpiration");
+
+            const size_t timeout = r_streamingImageFeedbackTimeout;
+
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_imageListAccessMutex);
+            for (StreamingImage* image : m_streamableImages)
+            {
+                StreamingImageContext* context = image->m_streamingContext.get();
+                if (context->m_feedbackExpired || context->GetFeedbackMip() == StreamingImageContext::InvalidMip ||
+                    m_timestamp - context->GetLastFeedbackTimestamp() <= timeout)
+                {
+                    continue;
+                }
+
+                // The target mip of the image changes to its least detailed mip, trim it unless it's expanding
+                context->m_feedbackExpired = true;
+                if (!image->IsExpanding())
+                {
+                    EvictUnusedMips(image);
+                    ReinsertImageToLists(image);
+                }
+            }
+        }
+
         bool StreamingImageController::ExpandPriorityComparator::operator()(const StreamingImage* lhs, const StreamingImage* rhs) const
         {
             // use the resident mip size and missing mip count to decide the expand priority
@@ -388,6 +470,46 @@ namespace AZ
             return false;
         }
 
+        bool StreamingImageController::EvictOneUnusedMipChain()
+        {
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_imageListAccessMutex);
+            for (StreamingImage* image : m_evictableImages)
+            {
+                if (!image->m_streamingContext->m_feedbackExpired)
+                {
+                    continue;
+                }
+
+                if (image->TrimOneMipChain() == RHI::ResultCode::Success)
+                {
+                    ReinsertImageToLists(image);
+
+                    StreamingDebugOutput(
+                        "StreamingImageController",
+                        "Unused image [%s] has one mipchain released; Current resident mip: %d\n",
+                        image->GetRHIImage()->GetName().GetCStr(),
+                        image->GetRHIImage()->GetResidentMipLevel());
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        bool StreamingImageController::EvictUnusedImages(size_t targetMemoryUsage)
+        {
+            size_t currentResident = GetPoolMemoryUsage();
+            while (currentResident > targetMemoryUsage)
+            {
+                if (!EvictOneUnusedMipChain())
+                {
+                    return false;
+                }
+                currentResident = GetPoolMemoryUsage();
+            }
+            return true;
+        }
+
         bool StreamingImageController::NeedExpand(const StreamingImage* image) const
         {
             uint16_t targetMip = GetImageTargetMip(image);
@@ -417,8 +539,19 @@ namespace AZ
 
         uint16_t StreamingImageController::GetImageTargetMip(const StreamingImage* image) const
         {
-            int16_t targetMip = image->m_streamingContext->GetTargetMip() + m_globalMipBias;
-            targetMip = AZStd::clamp(targetMip, (int16_t)0,  aznumeric_cast<int16_t>(image->GetRHIImage()->GetDescriptor().m_mipLevels-1));
+            const StreamingImageContext* context = image->m_streamingContext.get();
+            const int16_t lowestMip = aznumeric_cast<int16_t>(image->GetRHIImage()->GetDescriptor().m_mipLevels - 1);
+
+            // With sampler feedback, the mip sampled by the GPU replaces the requested target, and unused images only keep their
+            // least detailed mips
+            int16_t baseMip = aznumeric_cast<int16_t>(context->GetTargetMip());
+            if (m_feedbackEnabled && context->GetFeedbackMip() != StreamingImageContext::InvalidMip)
+            {
+                baseMip = context->m_feedbackExpired ? lowestMip : aznumeric_cast<int16_t>(context->GetFeedbackMip());
+            }
+
+            int16_t targetMip = baseMip + m_globalMipBias;
+            targetMip = AZStd::clamp(targetMip, (int16_t)0, lowestMip);
             return aznumeric_cast<uint16_t>(targetMip);
         }
 
@@ -451,8 +584,8 @@ namespace AZ
 
             while (currentResident > targetMemoryUsage)
             {
-                // Evict some mips
-                bool evicted = EvictOneMipChain();
+                // Evict some mips, starting with the images which aren't used anymore
+                bool evicted = EvictOneUnusedMipChain() || EvictOneMipChain();
                 if (!evicted)
                 {
                     // nothing to be evicted anymore
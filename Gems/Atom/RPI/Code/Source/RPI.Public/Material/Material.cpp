@@ -8,6 +8,7 @@
 
 #include <Atom/RPI.Public/ColorManagement/TransformColor.h>
 #include <Atom/RPI.Public/Material/Material.h>
+#include <Atom/RPI.Public/Material/MaterialParameterBuffer.h>
 #include <Atom/RPI.Reflect/Image/AttachmentImageAsset.h>
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
@@ -60,6 +61,8 @@ namespace AZ
             // All of these members must be reset if the material can be reinitialized because of the shader reload notification bus
             m_shaderResourceGroup = {};
             m_rhiShaderResourceGroup = {};
+            m_usesParameterBuffer = false;
+            m_isShaderResourceGroupCompiled = false;
             m_materialProperties = {};
             m_generalShaderCollection = {};
             m_materialPipelineData = {};
@@ -89,6 +92,20 @@ namespace AZ
                 if (m_shaderResourceGroup)
                 {
                     m_rhiShaderResourceGroup = m_shaderResourceGroup->GetRHIShaderResourceGroup();
+
+                    // Shaders opt in to the bindless material parameters by declaring the index constant in the material SRG
+                    const RHI::ShaderInputConstantIndex parameterIndexInput =
+                        m_shaderResourceGroup->FindShaderInputConstantIndex(Name("m_materialParameterIndex"));
+                    MaterialParameterBuffer* parameterBuffer = MaterialParameterBuffer::Get();
+                    if (parameterBuffer && parameterIndexInput.IsValid())
+                    {
+                        if (m_parameterBufferIndex == MaterialParameterBuffer::InvalidIndex)
+                        {
+                            m_parameterBufferIndex = parameterBuffer->AcquireIndex();
+                        }
+                        m_shaderResourceGroup->SetConstant(parameterIndexInput, m_parameterBufferIndex);
+                        m_usesParameterBuffer = true;
+                    }
                 }
                 else
                 {
@@ -142,6 +159,11 @@ namespace AZ
         Material::~Material()
         {
             ShaderReloadNotificationBus::MultiHandler::BusDisconnect();
+
+            if (MaterialParameterBuffer* parameterBuffer = MaterialParameterBuffer::Get())
+            {
+                parameterBuffer->ReleaseIndex(m_parameterBufferIndex);
+            }
         }
 
         const ShaderCollection& Material::GetGeneralShaderCollection() const
@@ -647,7 +669,25 @@ namespace AZ
 
                 if (m_shaderResourceGroup)
                 {
-                    m_shaderResourceGroup->Compile();
+                    // Materials reading from the parameter buffer only compile their SRG once, unless the parameters don't fit
+                    bool needsSrgCompile = !m_isShaderResourceGroupCompiled;
+                    if (m_usesParameterBuffer)
+                    {
+                        MaterialParameterBuffer* parameterBuffer = MaterialParameterBuffer::Get();
+                        needsSrgCompile |= !parameterBuffer ||
+                            !parameterBuffer->UpdateParameters(
+                                m_parameterBufferIndex, m_shaderResourceGroup->GetData(), m_rhiShaderResourceGroup->GetDeviceMask());
+                    }
+                    else
+                    {
+                        needsSrgCompile = true;
+                    }
+
+                    if (needsSrgCompile)
+                    {
+                        m_shaderResourceGroup->Compile();
+                        m_isShaderResourceGroupCompiled = true;
+                    }
                 }
 
                 m_compiledChangeId = m_currentChangeId;
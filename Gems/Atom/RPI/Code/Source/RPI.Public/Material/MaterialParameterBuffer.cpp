@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Material/MaterialParameterBuffer.h>
+
+#include <Atom/RHI/DeviceImageView.h>
+#include <Atom/RHI/RHISystemInterface.h>
+#include <Atom/RHI/ShaderResourceGroupData.h>
+#include <Atom/RPI.Reflect/Base.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        AZ_CVAR(bool, r_bindlessMaterialParameters, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Write material parameters into a single buffer indexed by material, instead of compiling the material SRG on every "
+            "change. Only materials whose SRG has a m_materialParameterIndex constant use it. Read at startup.");
+
+        AZ_CVAR(uint32_t, r_materialParameterSlotSize, 256, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Size in bytes of the parameters of a single material in the material parameter buffer. Read at startup.");
+
+        MaterialParameterBuffer* MaterialParameterBuffer::Get()
+        {
+            return Interface<MaterialParameterBuffer>::Get();
+        }
+
+        MaterialParameterBuffer::MaterialParameterBuffer()
+            : m_buffer("MaterialParameterBuffer", CommonBufferPoolType::ReadOnly, static_cast<uint32_t>(sizeof(uint32_t)))
+        {
+        }
+
+        void MaterialParameterBuffer::Init()
+        {
+            if (!r_bindlessMaterialParameters)
+            {
+                return;
+            }
+
+            m_slotSize = AZ::SizeAlignUp(AZStd::max(static_cast<uint32_t>(r_materialParameterSlotSize), 16u), 16u);
+
+            const int deviceCount = RHI::RHISystemInterface::Get()->GetDeviceCount();
+            for (int deviceIndex = 0; deviceIndex < deviceCount; ++deviceIndex)
+            {
+                m_deviceSlotData[deviceIndex];
+            }
+
+            Interface<MaterialParameterBuffer>::Register(this);
+        }
+
+        void MaterialParameterBuffer::Shutdown()
+        {
+            if (Interface<MaterialParameterBuffer>::Get() == this)
+            {
+                Interface<MaterialParameterBuffer>::Unregister(this);
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_deviceSlotData.clear();
+            m_freeIndices.clear();
+            m_slotCount = 0;
+            m_isDirty = false;
+            m_buffer = RingBuffer("MaterialParameterBuffer", CommonBufferPoolType::ReadOnly, static_cast<uint32_t>(sizeof(uint32_t)));
+        }
+
+        uint32_t MaterialParameterBuffer::AcquireIndex()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            if (!m_freeIndices.empty())
+            {
+                const uint32_t index = m_freeIndices.back();
+                m_freeIndices.pop_back();
+                return index;
+            }
+
+            const uint32_t index = m_slotCount++;
+            const size_t slotElementCount = m_slotSize / sizeof(uint32_t);
+            for (auto& [deviceIndex, slotData] : m_deviceSlotData)
+            {
+                slotData.resize(m_slotCount * slotElementCount, 0);
+            }
+            return index;
+        }
+
+        void MaterialParameterBuffer::ReleaseIndex(uint32_t index)
+        {
+            if (index == InvalidIndex)
+            {
+                return;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            AZ_Assert(index < m_slotCount, "Material parameter index %u is out of range", index);
+            m_freeIndices.push_back(index);
+        }
+
+        bool MaterialParameterBuffer::UpdateParameters(
+            uint32_t index, const RHI::ShaderResourceGroupData& srgData, RHI::MultiDevice::DeviceMask deviceMask)
+        {
+            AZ_PROFILE_SCOPE(RPI, "MaterialParameterBuffer: UpdateParameters");
+
+            const size_t slotElementCount = m_slotSize / sizeof(uint32_t);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            AZ_Assert(index < m_slotCount, "Material parameter index %u is out of range", index);
+
+            bool fits = true;
+            RHI::MultiDeviceObject::IterateDevices(
+                deviceMask,
+                [&](int deviceIndex)
+                {
+                    auto slotDataIt = m_deviceSlotData.find(deviceIndex);
+                    if (slotDataIt == m_deviceSlotData.end())
+                    {
+                        return true;
+                    }
+
+                    const RHI::DeviceShaderResourceGroupData& deviceData = srgData.GetDeviceShaderResourceGroupData(deviceIndex);
+                    const AZStd::span<const uint8_t> constantData = deviceData.GetConstantData();
+                    const AZStd::span<const RHI::ConstPtr<RHI::DeviceImageView>> imageViews = deviceData.GetImageGroup();
+
+                    const size_t constantElementCount = AZ::DivideAndRoundUp(constantData.size(), sizeof(uint32_t));
+                    if (constantElementCount + imageViews.size() > slotElementCount)
+                    {
+                        fits = false;
+                        return false;
+                    }
+
+                    uint32_t* slot = slotDataIt->second.data() + index * slotElementCount;
+                    memset(slot, 0, m_slotSize);
+                    if (!constantData.empty())
+                    {
+                        memcpy(slot, constantData.data(), constantData.size());
+                    }
+
+                    // Images follow the constants, in the order of the SRG layout
+                    uint32_t* imageIndices = slot + constantElementCount;
+                    for (const RHI::ConstPtr<RHI::DeviceImageView>& imageView : imageViews)
+                    {
+                        *imageIndices++ = imageView ? imageView->GetBindlessReadIndex() : RHI::DeviceImageView::InvalidBindlessIndex;
+                    }
+                    return true;
+                });
+
+            AZ_Warning(
+                "MaterialParameterBuffer", fits,
+                "Material parameters don't fit in %u bytes, the material will use its SRG. Increase r_materialParameterSlotSize.",
+                m_slotSize);
+
+            m_isDirty |= fits;
+            return fits;
+        }
+
+        void MaterialParameterBuffer::Upload()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            if (!m_isDirty || m_slotCount == 0)
+            {
+                return;
+            }
+
+            AZ_PROFILE_SCOPE(RPI, "MaterialParameterBuffer: Upload");
+
+            AZStd::unordered_map<int, const void*> deviceData;
+            for (const auto& [deviceIndex, slotData] : m_deviceSlotData)
+            {
+                deviceData[deviceIndex] = slotData.data();
+            }
+            m_buffer.AdvanceCurrentBufferAndUpdateData(deviceData, static_cast<u64>(m_slotCount) * m_slotSize);
+            m_isDirty = false;
+        }
+
+        const RHI::BufferView* MaterialParameterBuffer::GetBufferView() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            return m_buffer.IsCurrentBufferValid() ? m_buffer.GetCurrentBufferView() : nullptr;
+        }
+
+        uint32_t MaterialParameterBuffer::GetSlotSize() const
+        {
+            return m_slotSize;
+        }
+    } // namespace RPI
+} // namespace AZ
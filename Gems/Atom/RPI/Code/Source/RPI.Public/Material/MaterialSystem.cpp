@@ -16,10 +16,52 @@
 
 #include <AtomCore/Instance/InstanceDatabase.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/algorithm.h>
+
 namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(uint32_t, r_materialCompileJobBatchSize, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+            "Number of materials compiled by each job when applying queued material property changes. 0 compiles them on the "
+            "calling thread.");
+
+        namespace
+        {
+            // Lua functors run in the default script context, which can't be used from several threads
+            bool HasLuaFunctors(const MaterialAsset& materialAsset)
+            {
+                auto isLuaFunctor = [](const Ptr<MaterialFunctor>& functor)
+                {
+                    return azrtti_istypeof<LuaMaterialFunctor>(functor.get());
+                };
+
+                if (AZStd::any_of(materialAsset.GetMaterialFunctors().begin(), materialAsset.GetMaterialFunctors().end(), isLuaFunctor))
+                {
+                    return true;
+                }
+
+                for (const auto& [materialPipelineName, materialPipeline] : materialAsset.GetMaterialPipelinePayloads())
+                {
+                    if (AZStd::any_of(materialPipeline.m_materialFunctors.begin(), materialPipeline.m_materialFunctors.end(), isLuaFunctor))
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+        } // namespace
+
+        MaterialSystem* MaterialSystem::Get()
+        {
+            return Interface<MaterialSystem>::Get();
+        }
+
         void MaterialSystem::Reflect(AZ::ReflectContext* context)
         {
             MaterialPropertyValue::Reflect(context);
@@ -46,11 +88,149 @@ namespace AZ
                 return Material::CreateInternal(*(azrtti_cast<MaterialAsset*>(materialAsset)));
             };
             Data::InstanceDatabase<Material>::Create(azrtti_typeid<MaterialAsset>(), handler);
+
+            m_parameterBuffer.Init();
+
+            Interface<MaterialSystem>::Register(this);
         }
 
         void MaterialSystem::Shutdown()
         {
+            Interface<MaterialSystem>::Unregister(this);
+
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_queuedPropertyValuesMutex);
+                m_queuedPropertyValues.clear();
+            }
+
             Data::InstanceDatabase<Material>::Destroy();
+
+            m_parameterBuffer.Shutdown();
+        }
+
+        void MaterialSystem::QueuePropertyValue(
+            const Data::Instance<Material>& material, MaterialPropertyIndex index, const MaterialPropertyValue& value)
+        {
+            if (!material || !index.IsValid())
+            {
+                return;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_queuedPropertyValuesMutex);
+
+            QueuedPropertyValues& queued = m_queuedPropertyValues[material.get()];
+            queued.m_material = material;
+
+            auto it = AZStd::find_if(
+                queued.m_values.begin(),
+                queued.m_values.end(),
+                [index](const auto& queuedValue)
+                {
+                    return queuedValue.first == index;
+                });
+            if (it != queued.m_values.end())
+            {
+                it->second = value;
+            }
+            else
+            {
+                queued.m_values.emplace_back(index, value);
+            }
+        }
+
+        void MaterialSystem::ApplyQueuedPropertyValues()
+        {
+            AZStd::vector<QueuedPropertyValues> queuedPropertyValues;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_queuedPropertyValuesMutex);
+                if (m_queuedPropertyValues.empty())
+                {
+                    return;
+                }
+
+                queuedPropertyValues.reserve(m_queuedPropertyValues.size());
+                for (auto& [material, queued] : m_queuedPropertyValues)
+                {
+                    queuedPropertyValues.emplace_back(AZStd::move(queued));
+                }
+                m_queuedPropertyValues.clear();
+            }
+
+            AZ_PROFILE_SCOPE(RPI, "MaterialSystem: ApplyQueuedPropertyValues");
+
+            // Materials that can't be compiled yet keep their changes applied and are compiled on a later frame
+            AZStd::vector<uint8_t> compiled(queuedPropertyValues.size(), 0);
+            auto applyAndCompile = [&queuedPropertyValues, &compiled](size_t i)
+            {
+                QueuedPropertyValues& queued = queuedPropertyValues[i];
+                for (const auto& [index, value] : queued.m_values)
+                {
+                    queued.m_material->SetPropertyValue(index, value);
+                }
+                queued.m_values.clear();
+                compiled[i] = queued.m_material->Compile();
+            };
+
+            // Materials with Lua functors are compiled on this thread
+            AZStd::vector<size_t> parallelIndices;
+            AZStd::vector<size_t> serialIndices;
+            parallelIndices.reserve(queuedPropertyValues.size());
+            for (size_t i = 0; i < queuedPropertyValues.size(); ++i)
+            {
+                (HasLuaFunctors(*queuedPropertyValues[i].m_material->GetAsset()) ? serialIndices : parallelIndices).push_back(i);
+            }
+
+            const size_t batchSize = r_materialCompileJobBatchSize;
+            if (batchSize > 0 && parallelIndices.size() > batchSize)
+            {
+                AZ::JobCompletion jobCompletion;
+                for (size_t begin = 0; begin < parallelIndices.size(); begin += batchSize)
+                {
+                    const size_t end = AZStd::min(begin + batchSize, parallelIndices.size());
+                    auto jobLambda = [&applyAndCompile, &parallelIndices, begin, end]()
+                    {
+                        AZ_PROFILE_SCOPE(RPI, "MaterialSystem: Compile Job");
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            applyAndCompile(parallelIndices[i]);
+                        }
+                    };
+                    AZ::Job* job = AZ::CreateJobFunction(AZStd::move(jobLambda), true, nullptr); // Auto-deletes
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
+                }
+                jobCompletion.StartAndWaitForCompletion();
+            }
+            else
+            {
+                serialIndices.insert(serialIndices.end(), parallelIndices.begin(), parallelIndices.end());
+            }
+
+            for (size_t i : serialIndices)
+            {
+                applyAndCompile(i);
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_queuedPropertyValuesMutex);
+            for (size_t i = 0; i < queuedPropertyValues.size(); ++i)
+            {
+                if (!compiled[i])
+                {
+                    // Changes queued during this update are kept, they are applied on top of the ones already set
+                    QueuedPropertyValues& queued = m_queuedPropertyValues[queuedPropertyValues[i].m_material.get()];
+                    queued.m_material = AZStd::move(queuedPropertyValues[i].m_material);
+                }
+            }
+        }
+
+        void MaterialSystem::FrameUpdate()
+        {
+            ApplyQueuedPropertyValues();
+
+            if (MaterialParameterBuffer::Get())
+            {
+                m_parameterBuffer.Upload();
+            }
         }
 
     } // namespace RPI
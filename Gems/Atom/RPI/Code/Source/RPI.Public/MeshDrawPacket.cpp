@@ -211,7 +211,7 @@ namespace AZ
             //      - The mesh continues rendering with only the "foo" change applied, indefinitely.
 
             if (forceUpdate || (!m_material->NeedsCompile() && m_materialChangeId != m_material->GetCurrentChangeId())
-                || m_needUpdate)
+                || m_needUpdate || m_hasPendingPipelineStates)
             {
                 DoUpdate(parentScene);
                 m_materialChangeId = m_material->GetCurrentChangeId();
@@ -276,6 +276,7 @@ namespace AZ
             bool isFirstShaderItem = true;
 
             m_perDrawSrgs.clear();
+            bool hasPendingPipelineStates = false;
 
 #ifdef DEBUG_MESH_SHADERVARIANTS
             m_shaderVariantNames.clear();
@@ -368,13 +369,17 @@ namespace AZ
                 m_shaderVariantNames.push_back(variant.GetShaderVariantAsset().GetHint());
 #endif
 
-                RHI::PipelineStateDescriptorForDraw pipelineStateDescriptor;
-                variant.ConfigurePipelineState(pipelineStateDescriptor, shaderOptions);
-
                 // Render states need to merge the runtime variation.
                 // This allows materials to customize the render states that the shader uses.
                 const RHI::RenderStates& renderStatesOverlay = *shaderItem.GetRenderStatesOverlay();
-                RHI::MergeStateInto(renderStatesOverlay, pipelineStateDescriptor.m_renderStates);
+                const auto configurePipelineState = [&](const ShaderVariant& shaderVariant, RHI::PipelineStateDescriptorForDraw& descriptor)
+                {
+                    shaderVariant.ConfigurePipelineState(descriptor, shaderOptions);
+                    RHI::MergeStateInto(renderStatesOverlay, descriptor.m_renderStates);
+                };
+
+                RHI::PipelineStateDescriptorForDraw pipelineStateDescriptor;
+                configurePipelineState(variant, pipelineStateDescriptor);
 
                 UvStreamTangentBitmask uvStreamTangentBitmask;
                 RHI::StreamBufferIndices streamIndices;
@@ -409,7 +414,25 @@ namespace AZ
 
                 parentScene.ConfigurePipelineState(drawListTag, pipelineStateDescriptor);
 
-                const RHI::PipelineState* pipelineState = shader->AcquirePipelineState(pipelineStateDescriptor);
+                const RHI::PipelineState* pipelineState = nullptr;
+                if (variant.IsRootVariant())
+                {
+                    pipelineState = shader->AcquirePipelineState(pipelineStateDescriptor);
+                }
+                else
+                {
+                    // Like a shader variant that is still loading, a pipeline state that is still compiling is replaced by the
+                    // root variant's one, and the draw packet is rebuilt on the next update until it's ready.
+                    pipelineState = shader->AcquirePipelineStateAsync(pipelineStateDescriptor);
+                    if (!pipelineState)
+                    {
+                        hasPendingPipelineStates = true;
+                        configurePipelineState(shader->GetRootVariant(), pipelineStateDescriptor);
+                        parentScene.ConfigurePipelineState(drawListTag, pipelineStateDescriptor);
+                        pipelineState = shader->AcquirePipelineState(pipelineStateDescriptor);
+                    }
+                }
+
                 if (!pipelineState)
                 {
                     AZ_Error("MeshDrawPacket", false, "Shader '%s'. Failed to acquire default pipeline state", shaderItem.GetShaderAsset()->GetName().GetCStr());
@@ -497,6 +520,7 @@ namespace AZ
                 });
 
             m_drawPacket = drawPacketBuilder.End();
+            m_hasPendingPipelineStates = hasPendingPipelineStates;
 
             if (m_drawPacket)
             {
@@ -1148,6 +1148,14 @@ namespace AZ
             binding.UpdateConnection(useFallback);
         }
 
+        void Pass::InvalidatePipelinePassCulling()
+        {
+            if (m_pipeline)
+            {
+                m_pipeline->m_passCullingDirty = true;
+            }
+        }
+
         void Pass::UpdateConnectedBindings()
         {
             // Depending on whether a pass is enabled or not, it may switch it's bindings to become a pass-through
@@ -1464,7 +1472,8 @@ namespace AZ
             AZ_RPI_BREAK_ON_TARGET_PASS;
 
             bool isEnabled = IsEnabled();
-            bool earlyOut = !isEnabled;
+            // A culled pass keeps its enabled state, nothing consumes its outputs so it doesn't need to render this frame
+            bool earlyOut = !isEnabled || m_flags.m_culled;
             // Since IsEnabled can be virtual and we need to detect HierarchyChange, we can't use the m_flags.m_enabled flag
             if (isEnabled != m_flags.m_lastFrameEnabled)
             {
@@ -1674,6 +1683,7 @@ namespace AZ
                                 m_readbackOption = option;
                             }
                             m_attachmentReadback = readback;
+                            InvalidatePipelinePassCulling();
                             return true;
                         }
                         return false;
@@ -153,6 +153,7 @@ namespace AZ
             else if (pass->GetRenderPipeline())
             {
                 pass->GetRenderPipeline()->m_passTree.m_buildPassList.push_back(pass);
+                pass->GetRenderPipeline()->m_passCullingDirty = true;
             }
             else
             {
@@ -170,6 +171,7 @@ namespace AZ
             else if (pass->GetRenderPipeline())
             {
                 pass->GetRenderPipeline()->m_passTree.m_removePassList.push_back(pass);
+                pass->GetRenderPipeline()->m_passCullingDirty = true;
             }
             else
             {
@@ -187,6 +189,7 @@ namespace AZ
             else if (pass->GetRenderPipeline())
             {
                 pass->GetRenderPipeline()->m_passTree.m_initializePassList.push_back(pass);
+                pass->GetRenderPipeline()->m_passCullingDirty = true;
             }
             else
             {
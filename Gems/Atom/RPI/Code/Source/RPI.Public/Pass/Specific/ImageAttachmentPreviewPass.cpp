@@ -160,6 +160,7 @@ namespace AZ
                     m_attachmentCopy->SetImageAttachment(attachmentId, AZ::Name(readbackName));
 
                     pass->m_attachmentCopy = m_attachmentCopy;
+                    pass->InvalidatePipelinePassCulling();
                     break;
                 }
                 bindingIndex++;
@@ -33,8 +33,11 @@
 #include <Atom/RHI/RHIUtils.h>
 #include <Atom/RHI/XRRenderingInterface.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/ProfilerBus.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Time/ITime.h>
+#include <AzCore/std/string/fixed_string.h>
 
 #include <AzFramework/Asset/AssetSystemBus.h>
 
@@ -49,6 +52,9 @@ namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(bool, r_gpuTimeline, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Adds the gpu timestamps of the passes, converted to the cpu clock, to the profiler timeline next to the cpu regions that submitted them");
+
         RPISystemInterface* RPISystemInterface::Get()
         {
             return Interface<RPISystemInterface>::Get();
@@ -329,6 +335,9 @@ namespace AZ
             // Query system update is to increment the frame count
             m_querySystem.Update();
 
+            // Upload the parameters of the materials compiled since the previous frame before the scene SRGs bind them
+            m_materialSystem.FrameUpdate();
+
             // Collect draw packets for each scene and prepare RPI system SRGs
             // [GFX TODO] We may parallel scenes' prepare render.
             for (auto& scenePtr : m_scenes)
@@ -369,9 +378,97 @@ namespace AZ
                 }
             }
 
+            UpdateGpuTimeline();
+
             m_renderTick++;
         }
 
+        void RPISystem::UpdateGpuTimeline()
+        {
+            const Ptr<ParentPass>& rootPass = m_passSystem.GetRootPass();
+            AZ::Debug::ProfilerRequests* profiler = AZ::Debug::ProfilerSystemInterface::Get();
+            if (!r_gpuTimeline || !rootPass || !profiler)
+            {
+                if (m_gpuTimelineEnabled && rootPass)
+                {
+                    rootPass->SetTimestampQueryEnabled(false);
+                }
+                m_gpuTimelineEnabled = false;
+                return;
+            }
+
+            AZ_PROFILE_SCOPE(RPI, "RPISystem: UpdateGpuTimeline");
+
+            // Set every frame so passes added since the previous frame are timed as well
+            rootPass->SetTimestampQueryEnabled(true);
+            m_gpuTimelineEnabled = true;
+
+            // Calibrated every frame, the gpu and cpu clocks drift apart over time
+            struct ClockCalibration
+            {
+                bool m_valid = false;
+                uint64_t m_gpuTimestamp = 0;
+                AZStd::sys_time_t m_cpuTimestamp = 0;
+                AZStd::fixed_string<32> m_trackName;
+            };
+            const RHI::Ptr<RHI::Device> device = RHI::GetRHIDevice();
+            AZStd::array<ClockCalibration, RHI::HardwareQueueClassCount> calibrations;
+            for (uint32_t queueIndex = 0; queueIndex < RHI::HardwareQueueClassCount; ++queueIndex)
+            {
+                const RHI::HardwareQueueClass queueClass = static_cast<RHI::HardwareQueueClass>(queueIndex);
+                ClockCalibration& calibration = calibrations[queueIndex];
+                calibration.m_valid = device->GetCalibratedTimestamps(queueClass, calibration.m_gpuTimestamp, calibration.m_cpuTimestamp);
+                calibration.m_trackName = AZStd::fixed_string<32>::format("GPU %s", RHI::ToString(queueClass));
+            }
+
+            const double cpuTicksPerMicrosecond = static_cast<double>(AZStd::GetTimeTicksPerSecond()) / 1000000.0;
+            auto toCpuTimestamp = [&device, cpuTicksPerMicrosecond](const ClockCalibration& calibration, uint64_t gpuTimestamp, RHI::HardwareQueueClass queueClass)
+            {
+                const bool beforeCalibration = gpuTimestamp < calibration.m_gpuTimestamp;
+                const uint64_t gpuDelta = beforeCalibration ? calibration.m_gpuTimestamp - gpuTimestamp : gpuTimestamp - calibration.m_gpuTimestamp;
+                const AZStd::sys_time_t cpuDelta = static_cast<AZStd::sys_time_t>(
+                    static_cast<double>(device->GpuTimestampToMicroseconds(gpuDelta, queueClass).count()) * cpuTicksPerMicrosecond);
+                return beforeCalibration ? calibration.m_cpuTimestamp - cpuDelta : calibration.m_cpuTimestamp + cpuDelta;
+            };
+
+            AZStd::array<uint64_t, RHI::HardwareQueueClassCount> newestEmittedTimestamps = m_gpuTimelineEmittedTimestamps;
+            AZStd::vector<const Pass*> passStack = { rootPass.get() };
+            while (!passStack.empty())
+            {
+                const Pass* pass = passStack.back();
+                passStack.pop_back();
+
+                // Parent passes only report the extent of their children
+                if (const ParentPass* parentPass = pass->AsParent())
+                {
+                    for (const Ptr<Pass>& child : parentPass->GetChildren())
+                    {
+                        passStack.push_back(child.get());
+                    }
+                    continue;
+                }
+
+                const TimestampResult timestampResult = pass->GetLatestTimestampResult();
+                const RHI::HardwareQueueClass queueClass = timestampResult.GetHardwareQueueClass();
+                const uint32_t queueIndex = static_cast<uint32_t>(queueClass);
+                const uint64_t beginTimestamp = timestampResult.GetTimestampBeginInTicks();
+                const uint64_t endTimestamp = beginTimestamp + timestampResult.GetDurationInTicks();
+                if (timestampResult.GetDurationInTicks() == 0 || !calibrations[queueIndex].m_valid ||
+                    beginTimestamp < m_gpuTimelineEmittedTimestamps[queueIndex])
+                {
+                    continue;
+                }
+
+                profiler->AddTimelineRegion(
+                    calibrations[queueIndex].m_trackName,
+                    pass->GetName().GetStringView(),
+                    toCpuTimestamp(calibrations[queueIndex], beginTimestamp, queueClass),
+                    toCpuTimestamp(calibrations[queueIndex], endTimestamp, queueClass));
+                newestEmittedTimestamps[queueIndex] = AZStd::max(newestEmittedTimestamps[queueIndex], endTimestamp);
+            }
+            m_gpuTimelineEmittedTimestamps = newestEmittedTimestamps;
+        }
+
         void RPISystem::SetSimulationJobPolicy(RHI::JobPolicy jobPolicy)
         {
             m_simulationJobPolicy = jobPolicy;
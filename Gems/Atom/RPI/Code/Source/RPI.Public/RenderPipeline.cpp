@@ -22,11 +22,18 @@
 
 #include <Atom/RPI.Reflect/System/AnyAsset.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+
 
 namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(bool, r_cullUnconsumedPasses, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Skip the passes of the render pipelines whose outputs aren't consumed by any other pass, imported attachment or readback");
+
         RenderPipelinePtr RenderPipeline::CreateRenderPipeline(const RenderPipelineDescriptor& desc)
         {
             PassSystemInterface* passSystem = PassSystemInterface::Get();
@@ -730,10 +737,108 @@ namespace AZ
                 params.m_viewportState = m_viewport;
                 params.m_scissorState = m_scissor;
                 m_passTree.m_rootPass->UpdateConnectedBindings();
+                UpdatePassCulling();
                 m_passTree.m_rootPass->FrameBegin(params);
             }
         }
 
+        void RenderPipeline::UpdatePassCulling()
+        {
+            const bool cullingEnabled = r_cullUnconsumedPasses;
+            if (!m_passCullingDirty && cullingEnabled == m_passCullingEnabled)
+            {
+                return;
+            }
+            AZ_PROFILE_SCOPE(RPI, "RenderPipeline: UpdatePassCulling");
+            m_passCullingDirty = false;
+            m_passCullingEnabled = cullingEnabled;
+
+            // Gather the leaf passes, they are the ones adding scopes to the frame graph
+            AZStd::vector<Pass*> leafPasses;
+            AZStd::vector<Pass*> passesToVisit{ m_passTree.m_rootPass.get() };
+            while (!passesToVisit.empty())
+            {
+                Pass* pass = passesToVisit.back();
+                passesToVisit.pop_back();
+                pass->m_flags.m_culled = false;
+                if (ParentPass* parentPass = pass->AsParent())
+                {
+                    for (const Ptr<Pass>& child : parentPass->GetChildren())
+                    {
+                        passesToVisit.push_back(child.get());
+                    }
+                }
+                else
+                {
+                    leafPasses.push_back(pass);
+                }
+            }
+
+            if (!cullingEnabled)
+            {
+                return;
+            }
+
+            // The passes writing each attachment, and the passes that must render regardless of their consumers: the ones
+            // writing imported attachments (e.g. the swap chain or persistent history images), the ones without outputs which
+            // only have side effects, the ones being read back and the subpasses which can't be split from their render pass
+            AZStd::unordered_map<const PassAttachment*, AZStd::vector<Pass*>> writingPasses;
+            AZStd::unordered_set<const Pass*> neededPasses;
+            for (Pass* pass : leafPasses)
+            {
+                bool isNeeded = pass->m_attachmentReadback != nullptr || !pass->m_attachmentCopy.expired() ||
+                    (pass->GetParent() && pass->GetParent()->m_flags.m_mergeChildrenAsSubpasses);
+                bool hasOutputs = false;
+                for (const PassAttachmentBinding& binding : pass->m_attachmentBindings)
+                {
+                    const PassAttachment* attachment = binding.GetAttachment().get();
+                    if (attachment && binding.m_slotType != PassSlotType::Input)
+                    {
+                        hasOutputs = true;
+                        writingPasses[attachment].push_back(pass);
+                        isNeeded = isNeeded || attachment->m_lifetime == RHI::AttachmentLifetimeType::Imported;
+                    }
+                }
+
+                if (isNeeded || !hasOutputs)
+                {
+                    neededPasses.insert(pass);
+                    passesToVisit.push_back(pass);
+                }
+            }
+
+            // Walk back from the needed passes, the passes writing what a needed pass reads are needed as well
+            while (!passesToVisit.empty())
+            {
+                Pass* pass = passesToVisit.back();
+                passesToVisit.pop_back();
+                for (const PassAttachmentBinding& binding : pass->m_attachmentBindings)
+                {
+                    if (binding.m_slotType == PassSlotType::Output || !binding.GetAttachment())
+                    {
+                        continue;
+                    }
+
+                    auto writingPassesIt = writingPasses.find(binding.GetAttachment().get());
+                    if (writingPassesIt != writingPasses.end())
+                    {
+                        for (Pass* writingPass : writingPassesIt->second)
+                        {
+                            if (neededPasses.insert(writingPass).second)
+                            {
+                                passesToVisit.push_back(writingPass);
+                            }
+                        }
+                    }
+                }
+            }
+
+            for (Pass* pass : leafPasses)
+            {
+                pass->m_flags.m_culled = !neededPasses.contains(pass);
+            }
+        }
+
         void RenderPipeline::PassSystemFrameEnd()
         {
             AZ_PROFILE_FUNCTION(RPI);
@@ -817,6 +922,7 @@ namespace AZ
         void RenderPipeline::MarkPipelinePassChanges(u32 passChangeFlags)
         {
             m_pipelinePassChanges |= passChangeFlags;
+            m_passCullingDirty = true;
         }
 
         Scene* RenderPipeline::GetScene() const
@@ -10,6 +10,7 @@
 #include <Atom/RPI.Public/DynamicDraw/DynamicDrawSystem.h>
 #include <Atom/RPI.Public/FeatureProcessorFactory.h>
 #include <Atom/RPI.Public/FeatureProcessor.h>
+#include <Atom/RPI.Public/Material/MaterialParameterBuffer.h>
 #include <Atom/RPI.Public/Pass/FullscreenTrianglePass.h>
 #include <Atom/RPI.Public/Pass/RasterPass.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
@@ -242,6 +243,7 @@ namespace AZ
             }
 
             m_featureProcessors.emplace_back(AZStd::move(fp));
+            m_featureProcessorDependenciesDirty = true;
         }
 
         void Scene::EnableAllFeatureProcessors()
@@ -266,6 +268,7 @@ namespace AZ
                 }
 
                 m_featureProcessors.erase(foundFeatureProcessor);
+                m_featureProcessorDependenciesDirty = true;
             }
             else
             {
@@ -280,6 +283,7 @@ namespace AZ
                 fp->Deactivate();
             }
             m_featureProcessors.clear();
+            m_featureProcessorDependenciesDirty = true;
         }
 
         void Scene::VisitFeatureProcessor(FeatureProcessorVisitCallback callback) const
@@ -437,23 +441,170 @@ namespace AZ
             return nullptr;
         }
 
-        void Scene::SimulateTaskGraph()
+        void Scene::UpdateFeatureProcessorDependencies()
         {
-            static const AZ::TaskDescriptor simulationTGDesc{"RPI::Scene::Simulate", "Graphics"};
-            AZ::TaskGraph simulationTG{ "RPI::Scene::Simulate" };
+            if (!m_featureProcessorDependenciesDirty)
+            {
+                return;
+            }
+            m_featureProcessorDependenciesDirty = false;
+
+            const size_t featureProcessorCount = m_featureProcessors.size();
+            m_featureProcessorPrerequisites.clear();
+            m_featureProcessorPrerequisites.resize(featureProcessorCount);
+            m_orderedFeatureProcessors.clear();
+            m_independentFeatureProcessors.clear();
+
+            AZStd::vector<AZStd::vector<size_t>> dependents(featureProcessorCount);
+            AZStd::vector<TypeId> dependencies;
+            for (size_t index = 0; index < featureProcessorCount; ++index)
+            {
+                dependencies.clear();
+                m_featureProcessors[index]->GetDependencies(dependencies);
+                for (const TypeId& dependency : dependencies)
+                {
+                    // same lookup as GetFeatureProcessor(TypeId), a dependency on a feature processor that isn't enabled is ignored
+                    for (size_t prerequisite = 0; prerequisite < featureProcessorCount; ++prerequisite)
+                    {
+                        if (m_featureProcessors[prerequisite]->RTTI_IsTypeOf(dependency))
+                        {
+                            if (prerequisite != index)
+                            {
+                                m_featureProcessorPrerequisites[index].push_back(prerequisite);
+                                dependents[prerequisite].push_back(index);
+                            }
+                            break;
+                        }
+                    }
+                }
+            }
+
+            // Sort the feature processors so each one comes after its prerequisites
+            AZStd::vector<size_t> sortedFeatureProcessors;
+            sortedFeatureProcessors.reserve(featureProcessorCount);
+            AZStd::vector<size_t> pendingPrerequisiteCounts(featureProcessorCount);
+            for (size_t index = 0; index < featureProcessorCount; ++index)
+            {
+                pendingPrerequisiteCounts[index] = m_featureProcessorPrerequisites[index].size();
+                if (pendingPrerequisiteCounts[index] == 0)
+                {
+                    sortedFeatureProcessors.push_back(index);
+                }
+            }
+            for (size_t sortedIndex = 0; sortedIndex < sortedFeatureProcessors.size(); ++sortedIndex)
+            {
+                for (size_t dependent : dependents[sortedFeatureProcessors[sortedIndex]])
+                {
+                    if (--pendingPrerequisiteCounts[dependent] == 0)
+                    {
+                        sortedFeatureProcessors.push_back(dependent);
+                    }
+                }
+            }
+
+            if (sortedFeatureProcessors.size() != featureProcessorCount)
+            {
+                // A cycle would deadlock the task graph, run the feature processors as if they had no dependencies instead
+                AZ_Error("Scene", false, "The dependencies of the feature processors of scene '%s' are cyclic, they are ignored.", m_name.GetCStr());
+                for (size_t index = 0; index < featureProcessorCount; ++index)
+                {
+                    m_featureProcessorPrerequisites[index].clear();
+                    m_independentFeatureProcessors.push_back(index);
+                }
+                return;
+            }
 
+            for (size_t index : sortedFeatureProcessors)
+            {
+                if (m_featureProcessorPrerequisites[index].empty() && dependents[index].empty())
+                {
+                    m_independentFeatureProcessors.push_back(index);
+                }
+                else
+                {
+                    m_orderedFeatureProcessors.push_back(index);
+                }
+            }
+        }
+
+        template<class Function>
+        void Scene::AddFeatureProcessorTasks(AZ::TaskGraph& taskGraph, const AZ::TaskDescriptor& descriptor, const Function& function)
+        {
+            AZStd::vector<AZ::TaskToken> tokens;
+            tokens.reserve(m_featureProcessors.size());
             for (FeatureProcessorPtr& fp : m_featureProcessors)
             {
                 FeatureProcessor* featureProcessor = fp.get();
-                simulationTG.AddTask(
-                    simulationTGDesc,
-                    [this, featureProcessor]()
+                tokens.push_back(taskGraph.AddTask(
+                    descriptor,
+                    [featureProcessor, function]()
                     {
-                        FeatureProcessor::SimulatePacket jobPacket = m_simulatePacket;
-                        jobPacket.m_parentJob = nullptr;
-                        featureProcessor->Simulate(jobPacket);
-                    });
+                        function(*featureProcessor);
+                    }));
             }
+
+            for (size_t index : m_orderedFeatureProcessors)
+            {
+                for (size_t prerequisite : m_featureProcessorPrerequisites[index])
+                {
+                    tokens[prerequisite].Precedes(tokens[index]);
+                }
+            }
+        }
+
+        template<class Function>
+        void Scene::StartFeatureProcessorJobs(AZ::JobCompletion* completion, const Function& function)
+        {
+            for (size_t index : m_independentFeatureProcessors)
+            {
+                FeatureProcessor* featureProcessor = m_featureProcessors[index].get();
+                const auto jobLambda = [featureProcessor, function](AZ::Job& owner)
+                {
+                    function(*featureProcessor, owner);
+                };
+
+                AZ::Job* job = AZ::CreateJobFunction(AZStd::move(jobLambda), true, nullptr);  //auto-deletes
+                job->SetDependent(completion);
+                job->Start();
+            }
+
+            if (!m_orderedFeatureProcessors.empty())
+            {
+                AZStd::vector<FeatureProcessor*> orderedFeatureProcessors;
+                orderedFeatureProcessors.reserve(m_orderedFeatureProcessors.size());
+                for (size_t index : m_orderedFeatureProcessors)
+                {
+                    orderedFeatureProcessors.push_back(m_featureProcessors[index].get());
+                }
+
+                const auto jobLambda = [orderedFeatureProcessors = AZStd::move(orderedFeatureProcessors), function](AZ::Job& owner)
+                {
+                    for (FeatureProcessor* featureProcessor : orderedFeatureProcessors)
+                    {
+                        function(*featureProcessor, owner);
+                    }
+                };
+
+                AZ::Job* job = AZ::CreateJobFunction(AZStd::move(jobLambda), true, nullptr);  //auto-deletes
+                job->SetDependent(completion);
+                job->Start();
+            }
+        }
+
+        void Scene::SimulateTaskGraph()
+        {
+            static const AZ::TaskDescriptor simulationTGDesc{"RPI::Scene::Simulate", "Graphics"};
+            AZ::TaskGraph simulationTG{ "RPI::Scene::Simulate" };
+
+            AddFeatureProcessorTasks(
+                simulationTG,
+                simulationTGDesc,
+                [this](FeatureProcessor& featureProcessor)
+                {
+                    FeatureProcessor::SimulatePacket jobPacket = m_simulatePacket;
+                    jobPacket.m_parentJob = nullptr;
+                    featureProcessor.Simulate(jobPacket);
+                });
             simulationTG.Detach();
             m_simulationFinishedTGEvent = AZStd::make_unique<TaskGraphEvent>("RPI::Scene::Simulate Wait");
             simulationTG.Submit(m_simulationFinishedTGEvent.get());
@@ -464,20 +615,14 @@ namespace AZ
             // Create a new job to track completion.
             m_simulationCompletion = aznew AZ::JobCompletion();
 
-            for (FeatureProcessorPtr& fp : m_featureProcessors)
-            {
-                FeatureProcessor* featureProcessor = fp.get();
-                const auto jobLambda = [this, featureProcessor](AZ::Job& owner)
+            StartFeatureProcessorJobs(
+                m_simulationCompletion,
+                [this](FeatureProcessor& featureProcessor, AZ::Job& owner)
                 {
                     FeatureProcessor::SimulatePacket jobPacket = m_simulatePacket;
                     jobPacket.m_parentJob = &owner;
-                    featureProcessor->Simulate(jobPacket);
-                };
-
-                AZ::Job* simulationJob = AZ::CreateJobFunction(AZStd::move(jobLambda), true, nullptr);  //auto-deletes
-                simulationJob->SetDependent(m_simulationCompletion);
-                simulationJob->Start();
-            }
+                    featureProcessor.Simulate(jobPacket);
+                });
             //[GFX TODO]: the completion job should start here
         }
 
@@ -506,11 +651,17 @@ namespace AZ
             auto taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
             m_taskGraphActive = taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
 
+            UpdateFeatureProcessorDependencies();
+
             if (jobPolicy == RHI::JobPolicy::Serial)
             {
-                for (auto& fp : m_featureProcessors)
+                for (size_t index : m_independentFeatureProcessors)
                 {
-                    fp->Simulate(m_simulatePacket);
+                    m_featureProcessors[index]->Simulate(m_simulatePacket);
+                }
+                for (size_t index : m_orderedFeatureProcessors)
+                {
+                    m_featureProcessors[index]->Simulate(m_simulatePacket);
                 }
             }
             else
@@ -560,6 +711,15 @@ namespace AZ
                 m_srg->SetConstant(m_timeInputIndex, m_simulationTime);
                 m_srg->SetConstant(m_prevTimeInputIndex, m_prevSimulationTime);
 
+                if (MaterialParameterBuffer* materialParameterBuffer = MaterialParameterBuffer::Get();
+                    materialParameterBuffer && m_materialParametersInputIndex.ValidateOrFindBufferIndex(m_srg->GetLayout()))
+                {
+                    if (const RHI::BufferView* bufferView = materialParameterBuffer->GetBufferView())
+                    {
+                        m_srg->SetBufferView(m_materialParametersInputIndex, bufferView);
+                    }
+                }
+
                 // signal any handlers to update values for their partial scene srg
                 m_prepareSrgEvent.Signal(m_srg.get());
 
@@ -575,16 +735,13 @@ namespace AZ
             AZ::TaskGraph collectDrawPacketsTG{ "CollectDrawPackets" };
 
             // Launch FeatureProcessor::Render() taskgraphs
-            for (auto& fp : m_featureProcessors)
-            {
-                collectDrawPacketsTG.AddTask( 
-                    collectDrawPacketsTGDesc,
-                    [this, &fp]()
-                    {
-                        fp->Render(m_renderPacket);
-                    });
-
-            }
+            AddFeatureProcessorTasks(
+                collectDrawPacketsTG,
+                collectDrawPacketsTGDesc,
+                [this](FeatureProcessor& featureProcessor)
+                {
+                    featureProcessor.Render(m_renderPacket);
+                });
             collectDrawPacketsTG.Submit(&collectDrawPacketsTGEvent);
 
             // Launch CullingSystem::ProcessCullables() jobs (will run concurrently with FeatureProcessor::Render() jobs if m_parallelOctreeTraversal)
@@ -635,17 +792,12 @@ namespace AZ
             AZ::JobCompletion* collectDrawPacketsCompletion = aznew AZ::JobCompletion();
 
             // Launch FeatureProcessor::Render() jobs
-            for (auto& fp : m_featureProcessors)
-            {
-                const auto renderLambda = [this, &fp]()
+            StartFeatureProcessorJobs(
+                collectDrawPacketsCompletion,
+                [this](FeatureProcessor& featureProcessor, [[maybe_unused]] AZ::Job& owner)
                 {
-                    fp->Render(m_renderPacket);
-                };
-
-                AZ::Job* renderJob = AZ::CreateJobFunction(AZStd::move(renderLambda), true, nullptr);    //auto-deletes
-                renderJob->SetDependent(collectDrawPacketsCompletion);
-                renderJob->Start();
-            }
+                    featureProcessor.Render(m_renderPacket);
+                });
 
             // Launch CullingSystem::ProcessCullables() jobs (will run concurrently with FeatureProcessor::Render() jobs)
             const bool parallelOctreeTraversal = m_cullingScene->GetDebugContext().m_parallelOctreeTraversal;
@@ -725,6 +877,8 @@ namespace AZ
                 WaitAndCleanCompletionJob(m_simulationCompletion);
             }
 
+            UpdateFeatureProcessorDependencies();
+
             {
                 AZ_PROFILE_SCOPE(RPI, "Scene: OnBeginPrepareRender");
                 SceneNotificationBus::Event(GetId(), &SceneNotification::OnBeginPrepareRender);
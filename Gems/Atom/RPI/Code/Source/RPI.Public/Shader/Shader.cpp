@@ -14,13 +14,20 @@
 #include <Atom/RPI.Public/Shader/ShaderReloadDebugTracker.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+#include <Atom/RPI.Reflect/Base.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Utils/Utils.h>
 #include <AzCore/std/time.h>
 
 #include <AzCore/Component/TickBus.h>
 
 #define PSOCacheVersion 0 // Bump this if you want to reset PSO cache for everyone
 
+AZ_CVAR(bool, r_enablePsoWarmUp, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Precompiles the pipeline states of the shader variants used in previous sessions when a shader is created. Requires r_enablePsoCaching.");
+
 namespace AZ
 {
     namespace RPI
@@ -147,6 +154,11 @@ namespace AZ
             m_pipelineStateType = shaderAsset.GetPipelineStateType();
 
             GetPipelineLibraryPaths(m_pipelineLibraryPaths, AZ_MAX_PATH_LEN, *m_asset);
+            if (!m_pipelineLibraryPaths.empty())
+            {
+                // The variants are the same on every device, so they are only listed once next to the first device's library
+                m_usedVariantsPath = m_pipelineLibraryPaths.at(0) + "_Variants.txt";
+            }
 
             {
                 AZStd::unique_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
@@ -155,7 +167,8 @@ namespace AZ
             auto rootShaderVariantAsset = shaderAsset.GetRootVariantAsset(m_supervariantIndex);
             m_rootVariant.Init(m_asset, rootShaderVariantAsset, m_supervariantIndex);
 
-            if (m_pipelineLibraryHandle.IsNull())
+            const bool isFirstInit = m_pipelineLibraryHandle.IsNull();
+            if (isFirstInit)
             {
                 // We set up a pipeline library only once for the lifetime of the Shader instance.
                 // This should allow the Shader to be reloaded at runtime many times, and cache and reuse PipelineState objects rather than rebuild them.
@@ -190,6 +203,11 @@ namespace AZ
             ShaderVariantFinderNotificationBus::Handler::BusConnect(m_asset.GetId());
             Data::AssetBus::Handler::BusConnect(m_asset.GetId());
 
+            if (isFirstInit)
+            {
+                WarmUpPipelineStates();
+            }
+
             return RHI::ResultCode::Success;
         }
 
@@ -203,6 +221,7 @@ namespace AZ
                 if (r_enablePsoCaching)
                 {
                     SavePipelineLibrary();
+                    SaveUsedVariants();
                 }
                 
                 m_pipelineStateCache->ReleaseLibrary(m_pipelineLibraryHandle);
@@ -261,6 +280,7 @@ namespace AZ
             // we will merge ShaderReloadNotificationBus messages into one. For now, we just indicate the error by passing an empty ShaderVariant,
             // all our call sites don't use this data anyway.
             ShaderVariant updatedVariant;
+            bool warmUpPipelineState = false;
 
             if (isError)
             {
@@ -300,6 +320,13 @@ namespace AZ
                     updatedVariant.Init(m_asset, shaderVariantAsset, m_supervariantIndex);
                     m_shaderVariants.emplace(stableId, updatedVariant);
                 }
+
+                warmUpPipelineState = m_pendingWarmUpStableIds.erase(stableId.GetIndex()) > 0 && updatedVariant.GetShaderVariantAsset();
+            }
+
+            if (warmUpPipelineState)
+            {
+                WarmUpPipelineState(updatedVariant);
             }
 
             // [GFX TODO] It might make more sense to call OnShaderReinitialized here
@@ -358,6 +385,109 @@ namespace AZ
             }
         }
         
+        void Shader::WarmUpPipelineStates()
+        {
+            if (!r_enablePsoCaching || !r_enablePsoWarmUp || m_usedVariantsPath.empty())
+            {
+                return;
+            }
+
+            auto readResult = AZ::Utils::ReadFile(m_usedVariantsPath);
+            if (!readResult.IsSuccess())
+            {
+                // Nothing was recorded for this shader yet
+                return;
+            }
+
+            AZ_PROFILE_SCOPE(RPI, "Shader: WarmUpPipelineStates");
+
+            AZStd::vector<uint32_t> stableIds;
+            const AZStd::string& usedVariants = readResult.GetValue();
+            for (const char* cursor = usedVariants.c_str(); *cursor != '\0';)
+            {
+                char* next = nullptr;
+                const unsigned long stableId = strtoul(cursor, &next, 10);
+                if (next == cursor)
+                {
+                    break;
+                }
+                stableIds.push_back(static_cast<uint32_t>(stableId));
+                cursor = next;
+            }
+
+            {
+                AZStd::unique_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+                m_usedVariantStableIds.insert(stableIds.begin(), stableIds.end());
+                m_pendingWarmUpStableIds.insert(stableIds.begin(), stableIds.end());
+            }
+
+            WarmUpPipelineState(m_rootVariant);
+
+            for (uint32_t stableId : stableIds)
+            {
+                // Variants that aren't loaded yet are queued, and warmed up in OnShaderVariantAssetReady
+                const ShaderVariant& shaderVariant = GetVariantInternal(ShaderVariantStableId{ stableId });
+                if (shaderVariant.IsRootVariant() || shaderVariant.GetStableId().GetIndex() != stableId)
+                {
+                    continue;
+                }
+
+                bool isPending = false;
+                {
+                    AZStd::unique_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+                    isPending = m_pendingWarmUpStableIds.erase(stableId) > 0;
+                }
+                if (isPending)
+                {
+                    WarmUpPipelineState(shaderVariant);
+                }
+            }
+        }
+
+        void Shader::WarmUpPipelineState(const ShaderVariant& shaderVariant) const
+        {
+            if (m_pipelineStateType != RHI::PipelineStateType::Dispatch)
+            {
+                return;
+            }
+
+            // Configured the same way as the compute passes, so the pipeline state is found in the cache when they use it
+            RHI::PipelineStateDescriptorForDispatch pipelineStateDescriptor;
+            if (shaderVariant.IsRootVariant())
+            {
+                shaderVariant.ConfigurePipelineState(pipelineStateDescriptor, GetDefaultShaderOptions());
+            }
+            else
+            {
+                shaderVariant.ConfigurePipelineState(pipelineStateDescriptor, shaderVariant.GetShaderVariantId());
+            }
+            AcquirePipelineState(pipelineStateDescriptor);
+        }
+
+        void Shader::SaveUsedVariants()
+        {
+            if (m_usedVariantsPath.empty())
+            {
+                return;
+            }
+
+            AZStd::string usedVariants;
+            {
+                AZStd::shared_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+                for (uint32_t stableId : m_usedVariantStableIds)
+                {
+                    usedVariants += AZStd::string::format("%u\n", stableId);
+                }
+            }
+
+            if (!usedVariants.empty())
+            {
+                [[maybe_unused]] auto writeResult = AZ::Utils::WriteFile(usedVariants, m_usedVariantsPath);
+                AZ_Error("Shader", writeResult.IsSuccess(), "Used variants of %s were not saved: %s",
+                    m_asset.GetHint().c_str(), writeResult.IsSuccess() ? "" : writeResult.GetError().c_str());
+            }
+        }
+
         ShaderOptionGroup Shader::CreateShaderOptionGroup() const
         {
             return ShaderOptionGroup(m_asset->GetShaderOptionGroupLayout());
@@ -450,6 +580,7 @@ namespace AZ
             ShaderVariant newVariant;
             newVariant.Init(m_asset, shaderVariantAsset, m_supervariantIndex);
             m_shaderVariants.emplace(shaderVariantStableId, newVariant);
+            m_usedVariantStableIds.insert(shaderVariantStableId.GetIndex());
 
             return m_shaderVariants.at(shaderVariantStableId);
         }
@@ -474,6 +605,11 @@ namespace AZ
             return m_pipelineStateCache->AcquirePipelineState(m_pipelineLibraryHandle, descriptor, m_asset->GetName());
         }
 
+        const RHI::PipelineState* Shader::AcquirePipelineStateAsync(const RHI::PipelineStateDescriptor& descriptor) const
+        {
+            return m_pipelineStateCache->AcquirePipelineStateAsync(m_pipelineLibraryHandle, descriptor, m_asset->GetName());
+        }
+
         const RHI::Ptr<RHI::ShaderResourceGroupLayout>& Shader::FindShaderResourceGroupLayout(const Name& shaderResourceGroupName) const
         {
             return m_asset->FindShaderResourceGroupLayout(shaderResourceGroupName, m_supervariantIndex);
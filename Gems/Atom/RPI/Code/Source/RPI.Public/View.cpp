@@ -11,6 +11,7 @@
 #include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/HierarchicalZBuffer.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
 #include <Atom/RPI.Public/Pass/Specific/SwapChainPass.h>
 #include <Atom/RHI/DrawListTagRegistry.h>
@@ -733,6 +734,18 @@ namespace AZ
             return m_maskedOcclusionCullingDirty;
         }
 
+        void View::SetHierarchicalZBuffer(AZStd::shared_ptr<const HierarchicalZBuffer> hierarchicalZBuffer)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_hierarchicalZBufferMutex);
+            m_hierarchicalZBuffer = AZStd::move(hierarchicalZBuffer);
+        }
+
+        AZStd::shared_ptr<const HierarchicalZBuffer> View::GetHierarchicalZBuffer() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_hierarchicalZBufferMutex);
+            return m_hierarchicalZBuffer;
+        }
+
         void View::TryCreateShaderResourceGroup()
         {
             if (!m_shaderResourceGroup)
@@ -18,13 +18,20 @@
 #include <Atom/RPI.Public/Pass/PassFilter.h>
 #include <Atom/RPI.Public/Pass/PassSystem.h>
 #include <Atom/RPI.Public/Pass/RasterPass.h>
+#include <Atom/RPI.Public/Pass/Specific/ImageAttachmentPreviewPass.h>
 
 #include <Atom/RPI.Public/RenderPipeline.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <Common/RPITestFixture.h>
 
+namespace AZ::RPI
+{
+    AZ_CVAR_EXTERNED(bool, r_cullUnconsumedPasses);
+}
+
 namespace UnitTest
 {
     using namespace AZ;
@@ -718,6 +725,149 @@ namespace UnitTest
             // only the ParentPass in the render pipeline was found
             EXPECT_TRUE(count == 1);
         }
+
+        // Pass culling helpers...
+
+        RenderPipelinePtr CreateCullingTestPipeline()
+        {
+            RenderPipelineDescriptor desc;
+            desc.m_mainViewTagName = "viewTag1";
+            desc.m_name = "CullingTestPipeline";
+            return RenderPipeline::CreateRenderPipeline(desc);
+        }
+
+        Ptr<PassAttachment> CreateCullingTestAttachment(const char* name)
+        {
+            PassBufferAttachmentDesc desc;
+            desc.m_name = name;
+            desc.m_lifetime = RHI::AttachmentLifetimeType::Transient;
+            Ptr<PassAttachment> attachment = aznew PassAttachment(desc);
+            attachment->ComputePathName(Name("CullingTestPipeline"));
+            return attachment;
+        }
+
+        // Adds a leaf pass to the root of the pipeline which reads the inputs and writes the outputs
+        Ptr<Pass> AddCullingTestPass(
+            RenderPipeline* pipeline,
+            const char* name,
+            AZStd::initializer_list<Ptr<PassAttachment>> inputs,
+            AZStd::initializer_list<Ptr<PassAttachment>> outputs)
+        {
+            Ptr<Pass> pass = m_passSystem->CreatePassFromClass(Name("Pass"), Name(name));
+            auto addBinding = [&pass](const Ptr<PassAttachment>& attachment, PassSlotType slotType)
+            {
+                PassAttachmentBinding binding;
+                binding.m_name = attachment->m_name;
+                binding.m_slotType = slotType;
+                binding.m_scopeAttachmentUsage = RHI::ScopeAttachmentUsage::Shader;
+                binding.SetAttachment(attachment);
+                pass->AddAttachmentBinding(binding);
+            };
+            for (const Ptr<PassAttachment>& input : inputs)
+            {
+                addBinding(input, PassSlotType::Input);
+            }
+            for (const Ptr<PassAttachment>& output : outputs)
+            {
+                addBinding(output, PassSlotType::Output);
+            }
+
+            // Set Building to avoid state check errors when adding passes
+            pipeline->GetRootPass()->m_state = PassState::Building;
+            pipeline->GetRootPass()->AddChild(pass);
+            pipeline->GetRootPass()->m_state = PassState::Idle;
+            return pass;
+        }
+
+        void TestPassCulling_UnconsumedOutput_Culled()
+        {
+            RenderPipelinePtr pipeline = CreateCullingTestPipeline();
+            Ptr<PassAttachment> lightList = CreateCullingTestAttachment("LightList");
+            Ptr<PassAttachment> debugBuffer = CreateCullingTestAttachment("DebugBuffer");
+            Ptr<PassAttachment> swapChain = CreateCullingTestAttachment("SwapChain");
+
+            Ptr<Pass> lightCullPass = AddCullingTestPass(pipeline.get(), "LightCullPass", {}, { lightList });
+            Ptr<Pass> forwardPass = AddCullingTestPass(pipeline.get(), "ForwardPass", { lightList }, { swapChain });
+            Ptr<Pass> debugPass = AddCullingTestPass(pipeline.get(), "DebugPass", { lightList }, { debugBuffer });
+
+            // Binding an imported attachment requires an imported resource, so it's only flagged as imported once bound
+            swapChain->m_lifetime = RHI::AttachmentLifetimeType::Imported;
+
+            // Nothing is culled while the cvar is disabled
+            pipeline->UpdatePassCulling();
+            EXPECT_FALSE(lightCullPass->m_flags.m_culled);
+            EXPECT_FALSE(forwardPass->m_flags.m_culled);
+            EXPECT_FALSE(debugPass->m_flags.m_culled);
+
+            // Only the debug pass output isn't read by anything, the light list is still consumed by the forward pass
+            r_cullUnconsumedPasses = true;
+            pipeline->UpdatePassCulling();
+            EXPECT_FALSE(lightCullPass->m_flags.m_culled);
+            EXPECT_FALSE(forwardPass->m_flags.m_culled);
+            EXPECT_TRUE(debugPass->m_flags.m_culled);
+
+            // The culled pass keeps its enabled state
+            EXPECT_TRUE(debugPass->IsEnabled());
+
+            r_cullUnconsumedPasses = false;
+            pipeline->UpdatePassCulling();
+            EXPECT_FALSE(debugPass->m_flags.m_culled);
+        }
+
+        void TestPassCulling_ImportedAttachmentWriter_NotCulled()
+        {
+            RenderPipelinePtr pipeline = CreateCullingTestPipeline();
+            Ptr<PassAttachment> depthBuffer = CreateCullingTestAttachment("DepthBuffer");
+            Ptr<PassAttachment> history = CreateCullingTestAttachment("History");
+            Ptr<PassAttachment> lightingBuffer = CreateCullingTestAttachment("LightingBuffer");
+
+            Ptr<Pass> depthPass = AddCullingTestPass(pipeline.get(), "DepthPass", {}, { depthBuffer });
+            Ptr<Pass> historyPass = AddCullingTestPass(pipeline.get(), "HistoryPass", { depthBuffer }, { history });
+            Ptr<Pass> historyReaderPass = AddCullingTestPass(pipeline.get(), "HistoryReaderPass", { history }, { lightingBuffer });
+
+            // Binding an imported attachment requires an imported resource, so it's only flagged as imported once bound
+            history->m_lifetime = RHI::AttachmentLifetimeType::Imported;
+
+            // The history pass renders even though nothing reads its output this frame, and so does the pass it reads from.
+            // Reading an imported attachment doesn't keep a pass whose own outputs aren't consumed.
+            r_cullUnconsumedPasses = true;
+            pipeline->UpdatePassCulling();
+            EXPECT_FALSE(depthPass->m_flags.m_culled);
+            EXPECT_FALSE(historyPass->m_flags.m_culled);
+            EXPECT_TRUE(historyReaderPass->m_flags.m_culled);
+            r_cullUnconsumedPasses = false;
+        }
+
+        void TestPassCulling_ReadbackTarget_NotCulled()
+        {
+            RenderPipelinePtr pipeline = CreateCullingTestPipeline();
+            Ptr<PassAttachment> depthBuffer = CreateCullingTestAttachment("DepthBuffer");
+            Ptr<PassAttachment> lightingBuffer = CreateCullingTestAttachment("LightingBuffer");
+
+            Ptr<Pass> depthPass = AddCullingTestPass(pipeline.get(), "DepthPass", {}, { depthBuffer });
+            Ptr<Pass> lightingPass = AddCullingTestPass(pipeline.get(), "LightingPass", { depthBuffer }, { lightingBuffer });
+
+            r_cullUnconsumedPasses = true;
+            pipeline->UpdatePassCulling();
+            EXPECT_TRUE(depthPass->m_flags.m_culled);
+            EXPECT_TRUE(lightingPass->m_flags.m_culled);
+
+            // Previewing an attachment reads it back like ImageAttachmentPreviewPass does, which re-evaluates the culled passes
+            AZStd::shared_ptr<ImageAttachmentCopy> attachmentCopy = AZStd::make_shared<ImageAttachmentCopy>();
+            lightingPass->m_attachmentCopy = attachmentCopy;
+            lightingPass->InvalidatePipelinePassCulling();
+            pipeline->UpdatePassCulling();
+            EXPECT_FALSE(depthPass->m_flags.m_culled);
+            EXPECT_FALSE(lightingPass->m_flags.m_culled);
+
+            // Once the readback is released the passes are culled again on the next evaluation
+            attachmentCopy.reset();
+            lightingPass->InvalidatePipelinePassCulling();
+            pipeline->UpdatePassCulling();
+            EXPECT_TRUE(depthPass->m_flags.m_culled);
+            EXPECT_TRUE(lightingPass->m_flags.m_culled);
+            r_cullUnconsumedPasses = false;
+        }
     };
 
     TEST_F(PassTests, ConstructionAndValidation)
@@ -794,4 +944,19 @@ namespace UnitTest
     {
         TestForEachPass_PassTemplateFilter_Success();
     }
+
+    TEST_F(PassTests, PassCulling_UnconsumedOutput_Culled)
+    {
+        TestPassCulling_UnconsumedOutput_Culled();
+    }
+
+    TEST_F(PassTests, PassCulling_ImportedAttachmentWriter_NotCulled)
+    {
+        TestPassCulling_ImportedAttachmentWriter_NotCulled();
+    }
+
+    TEST_F(PassTests, PassCulling_ReadbackTarget_NotCulled)
+    {
+        TestPassCulling_ReadbackTarget_NotCulled();
+    }
 }
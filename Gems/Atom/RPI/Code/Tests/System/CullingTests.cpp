@@ -13,10 +13,16 @@
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/HierarchicalZBuffer.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/View.h>
 #include <Common/RPITestFixture.h>
 
+namespace AZ::RPI
+{
+    AZ_CVAR_EXTERNED(bool, r_useFlatCullableStorage);
+}
+
 namespace UnitTest
 {
     using namespace AZ;
@@ -255,4 +261,108 @@ namespace UnitTest
             m_cullingScene->UnregisterCullable(object);
         }
     }
+
+    TEST_F(CullingTests, VisibleObjectListTest_FlatCullableStorage)
+    {
+        r_useFlatCullableStorage = true;
+        for (Cullable& object : m_testObjects)
+        {
+            m_cullingScene->RegisterOrUpdateCullable(object);
+        }
+
+        // Unregister an object from the middle of the storage, so the last one is moved into its slot
+        m_cullingScene->UnregisterCullable(m_testObjects[1]);
+        EXPECT_EQ(m_testObjects[1].m_storageIndex, Cullable::InvalidStorageIndex);
+
+        Cull(m_views);
+
+        EXPECT_EQ(m_views[YPositive]->GetVisibleObjectList().size(), 3);
+        EXPECT_EQ(m_views[XNegative]->GetVisibleObjectList().size(), 3);
+        EXPECT_EQ(m_views[YNegative]->GetVisibleObjectList().size(), 2);
+        EXPECT_EQ(m_views[XPositive]->GetVisibleObjectList().size(), 1);
+
+        for (Cullable& object : m_testObjects)
+        {
+            m_cullingScene->UnregisterCullable(object);
+        }
+        r_useFlatCullableStorage = false;
+    }
+
+    class HierarchicalZBufferTests : public LeakDetectionFixture
+    {
+    protected:
+        static constexpr uint32_t DepthWidth = 64;
+        static constexpr uint32_t DepthHeight = 32;
+
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            MakePerspectiveFovMatrixRH(m_worldToClip, DegToRad(90.0f), 2.0f, 0.1f, 100.0f, true);
+        }
+
+        // Returns the reversed depth of a point at the given distance in front of the camera
+        float GetDepthAtDistance(float distance) const
+        {
+            const Vector4 clip = m_worldToClip * Vector4(0.0f, 0.0f, -distance, 1.0f);
+            return clip.GetZ() / clip.GetW();
+        }
+
+        // Fills the left half of the screen with a wall at the given distance, the right half is empty
+        AZStd::vector<float> CreateHalfWallDepth(float distance) const
+        {
+            AZStd::vector<float> depths(DepthWidth * DepthHeight, 0.0f);
+            const float wallDepth = GetDepthAtDistance(distance);
+            for (uint32_t y = 0; y < DepthHeight; ++y)
+            {
+                for (uint32_t x = 0; x < DepthWidth / 2; ++x)
+                {
+                    depths[y * DepthWidth + x] = wallDepth;
+                }
+            }
+            return depths;
+        }
+
+        Matrix4x4 m_worldToClip;
+    };
+
+    TEST_F(HierarchicalZBufferTests, Build_OddSize_CreatesMipsDownToOneTexel)
+    {
+        AZStd::vector<float> depths(5 * 3, 0.5f);
+        HierarchicalZBuffer hiZBuffer;
+        EXPECT_FALSE(hiZBuffer.IsValid());
+
+        hiZBuffer.Build(depths, 5, 3, m_worldToClip, true);
+        EXPECT_TRUE(hiZBuffer.IsValid());
+        EXPECT_EQ(hiZBuffer.GetWidth(), 5);
+        EXPECT_EQ(hiZBuffer.GetHeight(), 3);
+        EXPECT_EQ(hiZBuffer.GetMipCount(), 4); // 5x3, 3x2, 2x1, 1x1
+    }
+
+    TEST_F(HierarchicalZBufferTests, IsOccluded_BoxBehindWall_Occluded)
+    {
+        HierarchicalZBuffer hiZBuffer;
+        hiZBuffer.Build(CreateHalfWallDepth(5.0f), DepthWidth, DepthHeight, m_worldToClip, true);
+
+        // Behind the wall on the left half of the screen
+        EXPECT_TRUE(hiZBuffer.IsOccluded(Aabb::CreateFromMinMax(Vector3(-12.0f, -1.0f, -12.0f), Vector3(-10.0f, 1.0f, -10.0f)), 0.0f));
+        // Large enough to be tested against a coarse mip
+        EXPECT_TRUE(hiZBuffer.IsOccluded(Aabb::CreateFromMinMax(Vector3(-40.0f, -8.0f, -50.0f), Vector3(-30.0f, 8.0f, -40.0f)), 0.0f));
+    }
+
+    TEST_F(HierarchicalZBufferTests, IsOccluded_BoxNotFullyBehindWall_NotOccluded)
+    {
+        HierarchicalZBuffer hiZBuffer;
+        hiZBuffer.Build(CreateHalfWallDepth(5.0f), DepthWidth, DepthHeight, m_worldToClip, true);
+
+        // In front of the wall
+        EXPECT_FALSE(hiZBuffer.IsOccluded(Aabb::CreateFromMinMax(Vector3(-2.0f, -0.5f, -3.0f), Vector3(-1.0f, 0.5f, -2.0f)), 0.0f));
+        // On the empty half of the screen
+        EXPECT_FALSE(hiZBuffer.IsOccluded(Aabb::CreateFromMinMax(Vector3(10.0f, -1.0f, -12.0f), Vector3(12.0f, 1.0f, -10.0f)), 0.0f));
+        // Straddling the edge of the wall
+        EXPECT_FALSE(hiZBuffer.IsOccluded(Aabb::CreateFromMinMax(Vector3(-1.0f, -1.0f, -12.0f), Vector3(1.0f, 1.0f, -10.0f)), 0.0f));
+        // Crossing the near plane
+        EXPECT_FALSE(hiZBuffer.IsOccluded(Aabb::CreateFromMinMax(Vector3(-12.0f, -1.0f, -12.0f), Vector3(-10.0f, 1.0f, 1.0f)), 0.0f));
+        // Behind the wall, but closer than the depth bias
+        EXPECT_FALSE(hiZBuffer.IsOccluded(Aabb::CreateFromMinMax(Vector3(-12.0f, -1.0f, -12.0f), Vector3(-10.0f, 1.0f, -10.0f)), 1.0f));
+    }
 }
@@ -15,6 +15,7 @@ set(FILES
     Include/Atom/RPI.Public/Culling.h
     Include/Atom/RPI.Public/FeatureProcessor.h
     Include/Atom/RPI.Public/FeatureProcessorFactory.h
+    Include/Atom/RPI.Public/HierarchicalZBuffer.h
     Include/Atom/RPI.Public/MeshDrawPacket.h
     Include/Atom/RPI.Public/PipelinePassChanges.h
     Include/Atom/RPI.Public/PipelineState.h
@@ -56,6 +57,7 @@ set(FILES
     Include/Atom/RPI.Public/Image/StreamingImageController.h
     Include/Atom/RPI.Public/Image/StreamingImagePool.h
     Include/Atom/RPI.Public/Material/Material.h
+    Include/Atom/RPI.Public/Material/MaterialParameterBuffer.h
     Include/Atom/RPI.Public/Material/MaterialSystem.h
     Include/Atom/RPI.Public/Model/Model.h
     Include/Atom/RPI.Public/Model/ModelLod.h
@@ -113,6 +115,7 @@ set(FILES
     Source/RPI.Public/DllMain.cpp
     Source/RPI.Public/FeatureProcessor.cpp
     Source/RPI.Public/FeatureProcessorFactory.cpp
+    Source/RPI.Public/HierarchicalZBuffer.cpp
     Source/RPI.Public/MeshDrawPacket.cpp
     Source/RPI.Public/PipelinePassChanges.cpp
     Source/RPI.Public/PipelineState.cpp
@@ -144,6 +147,7 @@ set(FILES
     Source/RPI.Public/Image/StreamingImageController.cpp
     Source/RPI.Public/Image/StreamingImagePool.cpp
     Source/RPI.Public/Material/Material.cpp
+    Source/RPI.Public/Material/MaterialParameterBuffer.cpp
     Source/RPI.Public/Material/MaterialSystem.cpp
     Source/RPI.Public/Model/Model.cpp
     Source/RPI.Public/Model/ModelLod.cpp
@@ -83,11 +83,12 @@ namespace AZ
                 for (CullStatsType* cullStats : cullStatsSorted)
                 {
                     // create formatted display strings
-                    itemStrings.push_back(AZStd::string::format("%s - %d/%d CullPackets visible, %d drawPackets visible, %d cull jobs",
+                    itemStrings.push_back(AZStd::string::format("%s - %d/%d CullPackets visible, %d drawPackets visible, %d occluded, %d cull jobs",
                         cullStats->m_name.GetCStr(),
                         static_cast<uint32_t>(cullStats->m_numVisibleCullables),
                         static_cast<uint32_t>(debugCtx.m_numCullablesInScene),
                         static_cast<uint32_t>(cullStats->m_numVisibleDrawPackets),
+                        static_cast<uint32_t>(cullStats->m_numOccludedCullables),
                         static_cast<uint32_t>(cullStats->m_numJobs)
                     ));
 
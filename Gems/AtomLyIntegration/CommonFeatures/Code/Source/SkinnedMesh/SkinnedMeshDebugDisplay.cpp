@@ -87,8 +87,10 @@ namespace AZ
                     "  SkinnedMeshRenderProxy count: %zu\n"
                     "  DispatchItem count: %zu\n"
                     "  Bone count: %zu\n"
-                    "  Vertex count: %zu\n",
-                    stats.skinnedMeshRenderProxyCount, stats.dispatchItemCount, stats.boneCount, stats.vertexCount
+                    "  Vertex count: %zu\n"
+                    "  Skipped DispatchItem count: %zu\n",
+                    stats.skinnedMeshRenderProxyCount, stats.dispatchItemCount, stats.boneCount, stats.vertexCount,
+                    stats.skippedDispatchItemCount
                 );
 
                 debugDisplay.Draw2dTextLabel(x, y, size, debugString.c_str(), center);
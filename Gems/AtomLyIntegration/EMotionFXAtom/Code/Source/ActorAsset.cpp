@@ -26,6 +26,7 @@
 #include <Atom/RPI.Reflect/Model/ModelAssetHelpers.h>
 #include <Atom/RPI.Reflect/Model/ModelAssetCreator.h>
 #include <Atom/RPI.Reflect/Model/ModelLodAssetCreator.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
 #include <Atom/RPI.Public/Model/Model.h>
 
 #include <AzCore/Asset/AssetManager.h>
@@ -317,7 +318,25 @@ namespace AZ
             return skinnedMeshInputBuffers;
         }
 
-        void GetBoneTransformsFromActorInstance(const EMotionFX::ActorInstance* actorInstance, AZStd::vector<float>& boneTransforms, EMotionFX::Integration::SkinningMethod skinningMethod)
+        static uint32_t GetNumFloatsPerBone(EMotionFX::Integration::SkinningMethod skinningMethod)
+        {
+            switch (skinningMethod)
+            {
+            case EMotionFX::Integration::SkinningMethod::Linear:
+                return LinearSkinningFloatsPerBone;
+            case EMotionFX::Integration::SkinningMethod::DualQuat:
+                return DualQuaternionSkinningFloatsPerBone;
+            default:
+                return 0;
+            }
+        }
+
+        size_t CalcBoneTransformsSizeInBytes(const EMotionFX::ActorInstance* actorInstance, EMotionFX::Integration::SkinningMethod skinningMethod)
+        {
+            return actorInstance->GetTransformData()->GetNumTransforms() * GetNumFloatsPerBone(skinningMethod) * sizeof(float);
+        }
+
+        void StoreBoneTransformsFromActorInstance(const EMotionFX::ActorInstance* actorInstance, float* outBoneTransforms, EMotionFX::Integration::SkinningMethod skinningMethod)
         {
             const EMotionFX::TransformData* transforms = actorInstance->GetTransformData();
             const AZ::Matrix3x4* skinningMatrices = transforms->GetSkinningMatrices();
@@ -327,22 +346,69 @@ namespace AZ
 
             if (skinningMethod == EMotionFX::Integration::SkinningMethod::Linear)
             {
-                boneTransforms.resize_no_construct(numBoneTransforms * LinearSkinningFloatsPerBone);
                 for (size_t i = 0; i < numBoneTransforms; ++i)
                 {
-                    skinningMatrices[i].StoreToRowMajorFloat12(&boneTransforms[i * LinearSkinningFloatsPerBone]);
+                    skinningMatrices[i].StoreToRowMajorFloat12(&outBoneTransforms[i * LinearSkinningFloatsPerBone]);
                 }
             }
             else if(skinningMethod == EMotionFX::Integration::SkinningMethod::DualQuat)
             {
-                boneTransforms.resize_no_construct(numBoneTransforms * DualQuaternionSkinningFloatsPerBone);
                 for (size_t i = 0; i < numBoneTransforms; ++i)
                 {
                     MCore::DualQuaternion dualQuat = MCore::DualQuaternion::ConvertFromTransform(AZ::Transform::CreateFromMatrix3x4(skinningMatrices[i]));
-                    dualQuat.m_real.StoreToFloat4(&boneTransforms[i * DualQuaternionSkinningFloatsPerBone]);
-                    dualQuat.m_dual.StoreToFloat4(&boneTransforms[i * DualQuaternionSkinningFloatsPerBone + 4]);
+                    dualQuat.m_real.StoreToFloat4(&outBoneTransforms[i * DualQuaternionSkinningFloatsPerBone]);
+                    dualQuat.m_dual.StoreToFloat4(&outBoneTransforms[i * DualQuaternionSkinningFloatsPerBone + 4]);
+                }
+            }
+        }
+
+        void GetBoneTransformsFromActorInstance(const EMotionFX::ActorInstance* actorInstance, AZStd::vector<float>& boneTransforms, EMotionFX::Integration::SkinningMethod skinningMethod)
+        {
+            boneTransforms.resize_no_construct(CalcBoneTransformsSizeInBytes(actorInstance, skinningMethod) / sizeof(float));
+            StoreBoneTransformsFromActorInstance(actorInstance, boneTransforms.data(), skinningMethod);
+        }
+
+        bool UpdateBoneTransformBufferFromActorInstance(const EMotionFX::ActorInstance* actorInstance, RPI::Buffer& boneTransformBuffer, EMotionFX::Integration::SkinningMethod skinningMethod)
+        {
+            const size_t sizeInBytes = CalcBoneTransformsSizeInBytes(actorInstance, skinningMethod);
+            if (sizeInBytes == 0 || sizeInBytes > boneTransformBuffer.GetBufferSize())
+            {
+                return false;
+            }
+
+            AZStd::unordered_map<int, void*> mappedData = boneTransformBuffer.Map(sizeInBytes, 0);
+            if (mappedData.empty())
+            {
+                return false;
+            }
+
+            // Convert the skinning matrices once, into the memory of the first device, and copy them over to the other devices.
+            const float* boneTransforms = nullptr;
+            for (auto& [deviceIndex, deviceData] : mappedData)
+            {
+                if (!deviceData)
+                {
+                    continue;
+                }
+
+                if (!boneTransforms)
+                {
+                    StoreBoneTransformsFromActorInstance(actorInstance, static_cast<float*>(deviceData), skinningMethod);
+                    boneTransforms = static_cast<const float*>(deviceData);
+                }
+                else
+                {
+                    memcpy(deviceData, boneTransforms, sizeInBytes);
                 }
             }
+
+            if (!boneTransforms)
+            {
+                return false;
+            }
+
+            boneTransformBuffer.Unmap();
+            return true;
         }
 
         Data::Instance<RPI::Buffer> CreateBoneTransformBufferFromActorInstance(const EMotionFX::ActorInstance* actorInstance, EMotionFX::Integration::SkinningMethod skinningMethod)
@@ -39,6 +39,16 @@ namespace AZ
         //! Get the bone transforms from the actor instance and adjust them to be in the format needed by the renderer
         void GetBoneTransformsFromActorInstance(const EMotionFX::ActorInstance* actorInstance, AZStd::vector<float>& boneTransforms, EMotionFX::Integration::SkinningMethod skinningMethod);
 
+        //! Get the size of the bone transforms of the actor instance in the format needed by the renderer
+        size_t CalcBoneTransformsSizeInBytes(const EMotionFX::ActorInstance* actorInstance, EMotionFX::Integration::SkinningMethod skinningMethod);
+
+        //! Store the bone transforms from the actor instance in the format needed by the renderer, into memory of at least CalcBoneTransformsSizeInBytes()
+        void StoreBoneTransformsFromActorInstance(const EMotionFX::ActorInstance* actorInstance, float* outBoneTransforms, EMotionFX::Integration::SkinningMethod skinningMethod);
+
+        //! Write the bone transforms from the actor instance straight into the mapped memory of the bone transform buffer, without an intermediate copy
+        //! Returns false in case the buffer is too small or cannot be mapped
+        bool UpdateBoneTransformBufferFromActorInstance(const EMotionFX::ActorInstance* actorInstance, RPI::Buffer& boneTransformBuffer, EMotionFX::Integration::SkinningMethod skinningMethod);
+
         //! Create a buffer for bone transforms that can be used as input to the skinning shader
         Data::Instance<RPI::Buffer> CreateBoneTransformBufferFromActorInstance(const EMotionFX::ActorInstance* actorInstance, EMotionFX::Integration::SkinningMethod skinningMethod);
 
@@ -552,10 +552,15 @@ namespace AZ::Render
     {
         if (m_skinnedMeshHandle.IsValid())
         {
-            AZStd::vector<float> boneTransforms;
-            GetBoneTransformsFromActorInstance(m_actorInstance, boneTransforms, GetSkinningMethod());
+            // The skinned mesh shares the bone transform buffer with us, so write the skinning matrices straight into its memory.
+            // Only fall back to the intermediate copy in case the buffer cannot be written directly.
+            if (!m_boneTransforms || !UpdateBoneTransformBufferFromActorInstance(m_actorInstance, *m_boneTransforms, GetSkinningMethod()))
+            {
+                AZStd::vector<float> boneTransforms;
+                GetBoneTransformsFromActorInstance(m_actorInstance, boneTransforms, GetSkinningMethod());
 
-            m_skinnedMeshFeatureProcessor->SetSkinningMatrices(m_skinnedMeshHandle, boneTransforms);
+                m_skinnedMeshFeatureProcessor->SetSkinningMatrices(m_skinnedMeshHandle, boneTransforms);
+            }
 
             // Update the morph weights for every lod. This does not mean they will all be dispatched, but they will all have up to date weights
             // TODO: once culling is hooked up such that EMotionFX and Atom are always in sync about which lod to update, only update the currently visible lods [ATOM-13564]
@@ -341,13 +341,20 @@ namespace Audio
                     else if (audioObject->HasPosition())
                     {
                         auto const positionalObject = static_cast<CATLAudioObject*>(audioObject);
-                        AudioSystemImplementationRequestBus::BroadcastResult(
-                            result, &AudioSystemImplementationRequestBus::Events::SetPosition, positionalObject->GetImplDataPtr(),
-                            request.m_position);
+                        positionalObject->SetPosition(request.m_position);
 
-                        if (result == EAudioRequestStatus::Success)
+                        if (positionalObject->IsBeyondVirtualizationDistance(m_oSharedData.m_oActiveListenerPosition))
+                        {
+                            // Inaudible, the implementation receives the position when the object is audible again
+                            positionalObject->SetImplPositionPending(true);
+                            result = EAudioRequestStatus::Success;
+                        }
+                        else
                         {
-                            positionalObject->SetPosition(request.m_position);
+                            AudioSystemImplementationRequestBus::BroadcastResult(
+                                result, &AudioSystemImplementationRequestBus::Events::SetPosition, positionalObject->GetImplDataPtr(),
+                                request.m_position);
+                            positionalObject->SetImplPositionPending(result != EAudioRequestStatus::Success);
                         }
                     }
                     else
@@ -942,6 +949,9 @@ namespace Audio
             // If the AudioObject uses Obstruction/Occlusion then set the values before activating the trigger.
             auto const pPositionedAudioObject = static_cast<CATLAudioObject*>(pAudioObject);
 
+            // The implementation must know where the object is, even if it was virtual until now
+            pPositionedAudioObject->FlushPendingImplPosition();
+
             if (pPositionedAudioObject->CanRunRaycasts() && !pPositionedAudioObject->HasActiveEvents())
             {
                 pPositionedAudioObject->RunRaycasts(m_oSharedData.m_oActiveListenerPosition);
@@ -17,6 +17,7 @@
 
 #include <SoundCVars.h>
 #include <ATLUtils.h>
+#include <IAudioSystemImplementation.h>
 
 #if !defined(AUDIO_RELEASE)
     // Debug Draw
@@ -230,6 +231,7 @@ namespace Audio
     {
         CATLAudioObjectBase::Clear();
         m_oPosition = SATLWorldPosition();
+        m_isImplPositionPending = false;
         m_raycastProcessor.Reset();
     }
 
@@ -251,6 +253,30 @@ namespace Audio
         m_oPosition = oNewPosition;
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    bool CATLAudioObject::IsBeyondVirtualizationDistance(const SATLWorldPosition& listenerPosition) const
+    {
+        const float virtualizationDistance = static_cast<float>(Audio::CVars::s_AudioObjectVirtualizationDistance);
+        if (virtualizationDistance <= 0.f)
+        {
+            return false;
+        }
+
+        return m_oPosition.GetPositionVec().GetDistanceSq(listenerPosition.GetPositionVec()) > virtualizationDistance * virtualizationDistance;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CATLAudioObject::FlushPendingImplPosition()
+    {
+        if (m_isImplPositionPending)
+        {
+            EAudioRequestStatus result = EAudioRequestStatus::Failure;
+            AudioSystemImplementationRequestBus::BroadcastResult(
+                result, &AudioSystemImplementationRequestBus::Events::SetPosition, GetImplDataPtr(), m_oPosition);
+            m_isImplPositionPending = (result != EAudioRequestStatus::Success);
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CATLAudioObject::SetVelocityTracking(const bool bTrackingOn)
     {
@@ -353,6 +353,27 @@ namespace Audio
         // ~CATLAudioObjectBase
 
         void SetPosition(const SATLWorldPosition& oNewPosition);
+        const SATLWorldPosition& GetPosition() const
+        {
+            return m_oPosition;
+        }
+
+        //! An object further than s_AudioObjectVirtualizationDistance from the listener is virtual, it is inaudible
+        //! so its position updates are not passed to the implementation, and the per frame update skips it
+        bool IsBeyondVirtualizationDistance(const SATLWorldPosition& listenerPosition) const;
+
+        //! Set when the implementation has not received the latest position because the object was virtual
+        void SetImplPositionPending(const bool isPending)
+        {
+            m_isImplPositionPending = isPending;
+        }
+        bool IsImplPositionPending() const
+        {
+            return m_isImplPositionPending;
+        }
+
+        //! Passes the latest position to the implementation if it was kept from it while the object was virtual
+        void FlushPendingImplPosition();
 
         void SetRaycastCalcType(const ObstructionType type);
         void RunRaycasts(const SATLWorldPosition& listenerPos);
@@ -374,6 +395,7 @@ namespace Audio
         float m_fPreviousVelocity;
         SATLWorldPosition m_oPosition;
         SATLWorldPosition m_oPreviousPosition;
+        bool m_isImplPositionPending = false;
 
         RaycastProcessor m_raycastProcessor;
 
@@ -383,10 +405,6 @@ namespace Audio
             AzFramework::DebugDisplayRequests& debugDisplay,
             const AZ::Vector3& listenerPos,
             const CATLDebugNameStore* const debugNameStore) const;
-        const SATLWorldPosition& GetPosition() const
-        {
-            return m_oPosition;
-        }
 #endif // !AUDIO_RELEASE
     };
 
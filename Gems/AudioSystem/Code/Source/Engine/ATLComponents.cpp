@@ -300,8 +300,16 @@ namespace Audio
 
             if (pObject->HasActiveEvents())
             {
+                // Virtual objects are inaudible, skip them until they come back within range of the listener
+                if (pObject->IsBeyondVirtualizationDistance(rListenerPosition))
+                {
+                    continue;
+                }
+
                 AZ_PROFILE_SCOPE(Audio, "Inner Per-Object CAudioObjectManager::Update");
 
+                pObject->FlushPendingImplPosition();
+
                 pObject->Update(fUpdateIntervalMS, rListenerPosition);
 
                 if (pObject->CanRunRaycasts())
@@ -104,7 +104,7 @@ namespace Audio
     void CAudioSystem::PushRequest(AudioRequestVariant&& request)
     {
         AZStd::scoped_lock lock(m_pendingRequestsMutex);
-        m_pendingRequestsQueue.push_back(AZStd::move(request));
+        QueuePendingRequest(AZStd::move(request));
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -113,8 +113,34 @@ namespace Audio
         AZStd::scoped_lock lock(m_pendingRequestsMutex);
         for (auto& request : requests)
         {
-            m_pendingRequestsQueue.push_back(AZStd::move(request));
+            QueuePendingRequest(AZStd::move(request));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CAudioSystem::QueuePendingRequest(AudioRequestVariant&& request)
+    {
+        // m_pendingRequestsMutex must be held by the caller.
+        // Objects that move every frame push a SetPosition per frame, only the latest one matters to the audio thread.
+        auto* setPosition = AZStd::get_if<Audio::ObjectRequest::SetPosition>(&request);
+        if (setPosition && setPosition->m_audioObjectId != INVALID_AUDIO_OBJECT_ID && !setPosition->m_callback)
+        {
+            auto iter = m_pendingPositionRequests.find(setPosition->m_audioObjectId);
+            if (iter != m_pendingPositionRequests.end())
+            {
+                auto* queuedPosition = AZStd::get_if<Audio::ObjectRequest::SetPosition>(&m_pendingRequestsQueue[iter->second]);
+                if (queuedPosition && queuedPosition->m_audioObjectId == setPosition->m_audioObjectId
+                    && queuedPosition->m_flags == setPosition->m_flags)
+                {
+                    queuedPosition->m_position = setPosition->m_position;
+                    return;
+                }
+            }
+
+            m_pendingPositionRequests[setPosition->m_audioObjectId] = m_pendingRequestsQueue.size();
         }
+
+        m_pendingRequestsQueue.push_back(AZStd::move(request));
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -224,6 +250,8 @@ namespace Audio
             {
                 AZStd::scoped_lock lock(m_pendingRequestsMutex);
                 requestsToProcess = AZStd::move(m_pendingRequestsQueue);
+                m_pendingRequestsQueue.clear();
+                m_pendingPositionRequests.clear();
             }
 
             while (!requestsToProcess.empty())
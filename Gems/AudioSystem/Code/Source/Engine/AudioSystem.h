@@ -14,6 +14,7 @@
 
 #include <AzCore/Debug/Budget.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 
 #include <AzCore/std/parallel/binary_semaphore.h>
@@ -104,6 +105,7 @@ namespace Audio
         using TAudioProxies = AZStd::vector<CAudioProxy*, Audio::AudioSystemStdAllocator>;
 
         void InternalUpdate();
+        void QueuePendingRequest(AudioRequestVariant&& request);
 
         bool m_bSystemInitialized;
 
@@ -117,6 +119,9 @@ namespace Audio
         AudioRequestsQueue m_blockingRequestsQueue;
         AudioRequestsQueue m_pendingRequestsQueue;
         AudioRequestsQueue m_pendingCallbacksQueue;
+        // Index into m_pendingRequestsQueue of the queued SetPosition request of each audio object,
+        // later positions for the same object overwrite it instead of growing the queue.
+        AZStd::unordered_map<TAudioObjectID, size_t> m_pendingPositionRequests;
         AZStd::mutex m_blockingRequestsMutex;
         AZStd::mutex m_pendingRequestsMutex;
         AZStd::mutex m_pendingCallbacksMutex;
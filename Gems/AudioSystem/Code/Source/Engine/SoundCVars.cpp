@@ -136,6 +136,13 @@ namespace Audio::CVars
         "An audio object needs to move by this distance in order to issue a position update to the audio system.\n"
         "Usage: s_PositionUpdateThreshold=5.0\n");
 
+    AZ_CVAR(float, s_AudioObjectVirtualizationDistance, 0.f,
+        nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Audio objects further than this distance from the listener are virtual: their position updates are kept by the ATL\n"
+        "but not passed to the audio system implementation, and they are skipped by the per frame object update, until they\n"
+        "come within this distance or a trigger is executed on them. Set it beyond the longest attenuation range. 0 disables it.\n"
+        "Usage: s_AudioObjectVirtualizationDistance=200.0\n");
+
     AZ_CVAR(float, s_VelocityTrackingThreshold, 0.1f,
         nullptr, AZ::ConsoleFunctorFlags::Null,
         "An audio object needs to have its velocity changed by this amount in order to issue an 'object_speed' Rtpc update to the audio system.\n"
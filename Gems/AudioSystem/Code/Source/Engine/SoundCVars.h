@@ -28,6 +28,7 @@ namespace Audio::CVars
     AZ_CVAR_EXTERNED(float, s_RaycastSmoothFactor);
 
     AZ_CVAR_EXTERNED(float, s_PositionUpdateThreshold);
+    AZ_CVAR_EXTERNED(float, s_AudioObjectVirtualizationDistance);
     AZ_CVAR_EXTERNED(float, s_VelocityTrackingThreshold);
     AZ_CVAR_EXTERNED(AZ::u32, s_AudioProxiesInitType);
 
@@ -105,6 +105,7 @@ namespace Compression
     void DecompressorRegistrarEntry::QueueRequest(AZ::IO::FileRequest* request)
     {
         AZ_Assert(request, "QueueRequest was provided a null request.");
+        request->RecordTraceStage(m_name.c_str());
 
         auto QueueCommand = [this, request](auto&& args)
         {
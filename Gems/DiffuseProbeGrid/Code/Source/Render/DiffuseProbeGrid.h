@@ -208,9 +208,19 @@ namespace AZ
             bool GetEdgeBlendIbl() const { return m_edgeBlendIbl; }
             void SetEdgeBlendIbl(bool edgeBlendIbl);
 
-            uint32_t GetFrameUpdateCount() const { return m_frameUpdateCount; }
+            // the effective frame update count is the larger of the configured count and the count required by the ray budget
+            uint32_t GetFrameUpdateCount() const { return AZStd::max(m_frameUpdateCount, m_budgetFrameUpdateCount); }
             void SetFrameUpdateCount(uint32_t frameUpdateCount) { m_frameUpdateCount = frameUpdateCount; }
 
+            // sets the frame update count required to stay within the per-frame ray budget, 1 when the grid is not limited
+            void SetBudgetFrameUpdateCount(uint32_t budgetFrameUpdateCount);
+
+            // largest frame update count supported by the grid, each frame updates at least one column of the probe textures
+            uint32_t GetMaxFrameUpdateCount() const;
+
+            // number of rays traced when updating all of the probes in the grid
+            uint64_t GetTotalRayCount() const;
+
             uint32_t GetFrameUpdateIndex() const { return m_frameUpdateIndex; }
 
             DiffuseProbeGridTransparencyMode GetTransparencyMode() const { return m_transparencyMode; }
@@ -372,6 +382,9 @@ namespace AZ
             uint32_t m_frameUpdateCount = 1;
             uint32_t m_frameUpdateIndex = 0;
 
+            // frame count required by the ray budget, overrides m_frameUpdateCount when larger
+            uint32_t m_budgetFrameUpdateCount = 1;
+
             // rotation transform applied to probe rays
             AZ::Quaternion m_probeRayRotation;
             AZ::SimpleLcgRandom m_random;
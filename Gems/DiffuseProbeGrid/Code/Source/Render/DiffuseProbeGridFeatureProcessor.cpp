@@ -6,7 +6,10 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/sort.h>
 #include <Atom/RPI.Edit/Common/AssetUtils.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
 #include <Atom/RPI.Public/RPIUtils.h>
@@ -29,6 +32,10 @@ namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(uint32_t, r_diffuseProbeGridRayBudget, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Maximum number of probe rays traced per frame by the visible real-time DiffuseProbeGrids, 0 for no limit. "
+            "Grids closer to the camera keep their frame update count, the others spread their probe updates over more frames.");
+
         void DiffuseProbeGridFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -355,6 +362,77 @@ namespace AZ
                     m_visibleDiffuseProbeGrids.push_back(diffuseProbeGrid);
                 }
             }
+
+            ApplyRayBudget();
+        }
+
+        void DiffuseProbeGridFeatureProcessor::ApplyRayBudget()
+        {
+            for (auto& diffuseProbeGrid : m_realTimeDiffuseProbeGrids)
+            {
+                diffuseProbeGrid->SetBudgetFrameUpdateCount(1);
+            }
+
+            const uint64_t rayBudget = static_cast<uint32_t>(r_diffuseProbeGridRayBudget);
+            if (rayBudget == 0 || m_visibleRealTimeDiffuseProbeGrids.empty())
+            {
+                return;
+            }
+
+            AZ_PROFILE_SCOPE(AzRender, "DiffuseProbeGridFeatureProcessor: ApplyRayBudget");
+
+            struct BudgetEntry
+            {
+                DiffuseProbeGrid* m_diffuseProbeGrid = nullptr;
+                float m_distance = 0.0f;
+                uint64_t m_minRayCount = 0;
+            };
+
+            // prioritize the grids by distance from the camera of the default view, the camera is at distance 0 of the grids containing it
+            AZStd::optional<AZ::Vector3> cameraPosition;
+            if (RPI::RenderPipelinePtr renderPipeline = GetParentScene()->GetDefaultRenderPipeline())
+            {
+                if (RPI::ViewPtr view = renderPipeline->GetDefaultView())
+                {
+                    cameraPosition = view->GetCameraTransform().GetTranslation();
+                }
+            }
+
+            // every grid is granted the rays for updating its probes over its maximum frame update count so it keeps converging
+            uint64_t reservedRayCount = 0;
+            AZStd::vector<BudgetEntry> budgetEntries;
+            budgetEntries.reserve(m_visibleRealTimeDiffuseProbeGrids.size());
+            for (auto& diffuseProbeGrid : m_visibleRealTimeDiffuseProbeGrids)
+            {
+                BudgetEntry& budgetEntry = budgetEntries.emplace_back();
+                budgetEntry.m_diffuseProbeGrid = diffuseProbeGrid.get();
+                budgetEntry.m_distance = cameraPosition ? diffuseProbeGrid->GetObbWs().GetDistance(*cameraPosition) : 0.0f;
+                budgetEntry.m_minRayCount = AZ::DivideAndRoundUp(diffuseProbeGrid->GetTotalRayCount(), aznumeric_cast<uint64_t>(diffuseProbeGrid->GetMaxFrameUpdateCount()));
+                reservedRayCount += budgetEntry.m_minRayCount;
+            }
+
+            AZStd::stable_sort(budgetEntries.begin(), budgetEntries.end(), [](const BudgetEntry& entry1, const BudgetEntry& entry2)
+            {
+                return entry1.m_distance < entry2.m_distance;
+            });
+
+            // the closest grids are updated at their configured rate while the budget allows it
+            uint64_t remainingRayCount = rayBudget;
+            for (const BudgetEntry& budgetEntry : budgetEntries)
+            {
+                DiffuseProbeGrid* diffuseProbeGrid = budgetEntry.m_diffuseProbeGrid;
+                reservedRayCount -= budgetEntry.m_minRayCount;
+
+                const uint64_t totalRayCount = diffuseProbeGrid->GetTotalRayCount();
+                const uint64_t availableRayCount = remainingRayCount > reservedRayCount ? remainingRayCount - reservedRayCount : 0;
+                const uint64_t grantedRayCount = AZStd::max(availableRayCount, budgetEntry.m_minRayCount);
+
+                const uint64_t frameUpdateCount = AZ::DivideAndRoundUp(totalRayCount, AZStd::max(grantedRayCount, uint64_t{ 1 }));
+                diffuseProbeGrid->SetBudgetFrameUpdateCount(aznumeric_cast<uint32_t>(AZStd::min(frameUpdateCount, uint64_t{ UINT32_MAX })));
+
+                const uint64_t frameRayCount = AZ::DivideAndRoundUp(totalRayCount, aznumeric_cast<uint64_t>(diffuseProbeGrid->GetFrameUpdateCount()));
+                remainingRayCount -= AZStd::min(remainingRayCount, frameRayCount);
+            }
         }
 
         DiffuseProbeGridHandle DiffuseProbeGridFeatureProcessor::AddProbeGrid(const AZ::Transform& transform, const AZ::Vector3& extents, const AZ::Vector3& probeSpacing)
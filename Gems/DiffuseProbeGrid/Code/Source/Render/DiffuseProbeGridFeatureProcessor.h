@@ -160,6 +160,9 @@ namespace AZ
             // loads the probe visualization model and creates the BLAS
             void OnVisualizationModelAssetReady(Data::Asset<Data::AssetData> asset);
 
+            // spreads the probe updates of the visible real-time grids over more frames when they exceed the per-frame ray budget
+            void ApplyRayBudget();
+
             // list of all diffuse probe grids
             const size_t InitialProbeGridAllocationSize = 64;
             DiffuseProbeGridVector m_diffuseProbeGrids;
@@ -33,6 +33,7 @@
 #include <EMotionFX/Source/ActorInstanceBus.h>
 #include <EMotionFX/Source/DebugDraw.h>
 #include <EMotionFX/Source/RagdollInstance.h>
+#include <EMotionFX/Source/RagdollPhysicsSync.h>
 
 #include <numeric>
 
@@ -176,6 +177,7 @@ namespace EMotionFX
         }
 
         GetDebugDraw().UnregisterActorInstance(this);
+        GetRagdollPhysicsSync().UnregisterActorInstance(this);
 
         // delete all attachments
         // actor instances that are attached will be detached, and not deleted from memory
@@ -313,6 +315,11 @@ namespace EMotionFX
                 return;
             }
 
+            if (m_sampledPoseInterpolationEnabled)
+            {
+                UpdateSampledPoseInterpolation(timePassedInSeconds, sampleMotions);
+            }
+
             m_transformData->GetCurrentPose()->ApplyMorphWeightsToActorInstance();
             ApplyMorphSetup();
 
@@ -944,6 +951,9 @@ namespace EMotionFX
 
     void ActorInstance::SetRagdoll(Physics::Ragdoll* ragdoll)
     {
+        // The previous ragdoll instance is about to be destroyed, stop syncing it.
+        GetRagdollPhysicsSync().UnregisterActorInstance(this);
+
         if (ragdoll && ragdoll->GetNumNodes() > 0)
         {
             m_ragdollInstance = AZStd::make_unique<RagdollInstance>(ragdoll, this);
@@ -1705,6 +1715,62 @@ namespace EMotionFX
         return m_motionSamplingRate;
     }
 
+    void ActorInstance::SetSampledPoseInterpolationEnabled(bool enabled)
+    {
+        if (enabled && !m_sampledPoseInterpolationEnabled)
+        {
+            // Start over from the next sampled pose, the stored ones might be outdated.
+            m_hasSampledPoses = false;
+        }
+
+        m_sampledPoseInterpolationEnabled = enabled;
+    }
+
+    bool ActorInstance::GetSampledPoseInterpolationEnabled() const
+    {
+        return m_sampledPoseInterpolationEnabled;
+    }
+
+    void ActorInstance::UpdateSampledPoseInterpolation(float timePassedInSeconds, bool sampleMotions)
+    {
+        Pose* currentPose = m_transformData->GetCurrentPose();
+        m_timeSinceSampledPose += timePassedInSeconds;
+
+        if (sampleMotions)
+        {
+            if (!m_lastSampledPose)
+            {
+                m_previousSampledPose = AZStd::make_unique<Pose>();
+                m_lastSampledPose = AZStd::make_unique<Pose>();
+                m_previousSampledPose->LinkToActorInstance(this);
+                m_lastSampledPose->LinkToActorInstance(this);
+            }
+
+            if (!m_hasSampledPoses)
+            {
+                // Nothing to interpolate from yet, use the freshly sampled pose as is.
+                m_lastSampledPose->InitFromPose(currentPose);
+                m_hasSampledPoses = true;
+            }
+
+            AZStd::swap(m_previousSampledPose, m_lastSampledPose);
+            m_lastSampledPose->InitFromPose(currentPose);
+            m_sampledPoseInterval = m_timeSinceSampledPose;
+            m_timeSinceSampledPose = 0.0f;
+        }
+
+        if (!m_hasSampledPoses)
+        {
+            return;
+        }
+
+        // The displayed pose lags one sampling interval behind, so it reaches the last sampled pose right when the next one gets sampled.
+        const float weight = m_sampledPoseInterval > 0.0f ? AZ::GetMin(m_timeSinceSampledPose / m_sampledPoseInterval, 1.0f) : 1.0f;
+        currentPose->InitFromPose(m_previousSampledPose.get());
+        currentPose->Blend(m_lastSampledPose.get(), weight);
+        currentPose->InvalidateAllModelSpaceTransforms();
+    }
+
     void ActorInstance::IncreaseNumAttachmentRefs(uint8 numToIncreaseWith)
     {
         m_numAttachmentRefs += numToIncreaseWith;
@@ -37,6 +37,7 @@ namespace EMotionFX
     class AnimGraphInstance;
     class MorphSetupInstance;
     class RagdollInstance;
+    class Pose;
 
 
     /**
@@ -863,6 +864,15 @@ namespace EMotionFX
         float GetMotionSamplingTimer() const;
         float GetMotionSamplingRate() const;
 
+        /**
+         * Enable or disable interpolation between the last two sampled poses on the frames where motions are not sampled.
+         * When enabled, the displayed pose lags one sampling interval behind and moves smoothly towards the last sampled pose,
+         * instead of holding the last sampled pose until motions get sampled again.
+         * @param enabled Set to true to interpolate between sampled poses.
+         */
+        void SetSampledPoseInterpolationEnabled(bool enabled);
+        bool GetSampledPoseInterpolationEnabled() const;
+
         MCORE_INLINE size_t GetNumNodes() const         { return m_actor->GetSkeleton()->GetNumNodes(); }
 
         void UpdateVisualizeScale();                    // not automatically called on creation for performance reasons (this method relatively is slow as it updates all meshes)
@@ -900,6 +910,12 @@ namespace EMotionFX
         float                   m_boundsUpdatePassedTime;/**< The time passed since the last bounds update. */
         float                   m_motionSamplingRate;    /**< The motion sampling rate in seconds, where 0.1 would mean to update 10 times per second. A value of 0 or lower means to update every frame. */
         float                   m_motionSamplingTimer;   /**< The time passed since the last time we sampled motions/anim graphs. */
+        AZStd::unique_ptr<Pose> m_previousSampledPose;   /**< The pose sampled before the last one, used when interpolating between sampled poses. */
+        AZStd::unique_ptr<Pose> m_lastSampledPose;       /**< The last sampled pose, used when interpolating between sampled poses. */
+        float                   m_sampledPoseInterval = 0.0f;   /**< The time between the last two sampled poses. */
+        float                   m_timeSinceSampledPose = 0.0f;  /**< The time passed since the last sampled pose. */
+        bool                    m_sampledPoseInterpolationEnabled = false; /**< Interpolate between the last two sampled poses on frames where motions are not sampled? */
+        bool                    m_hasSampledPoses = false;      /**< Are the sampled poses initialized since interpolation got enabled? */
         float                   m_visualizeScale;        /**< Some visualization scale factor when rendering for example normals, to be at a nice size, relative to the character. */
         size_t                  m_lodLevel;              /**< The current LOD level, where 0 is the highest detail. */
         size_t                  m_requestedLODLevel;    /**< Requested LOD level. The actual LOD level will be updated as soon as all transforms for the requested LOD level are ready. */
@@ -1021,5 +1037,11 @@ namespace EMotionFX
          * newly enabled joints (the ones that were not present and thus also not updated in the lower LOD level)will contain incorrect data.
          */
         void UpdateLODLevel();
+
+        /*
+         * Store the current pose when motions got sampled, or replace it by the interpolation between the last two sampled poses otherwise.
+         * This function should only be called from within UpdateTransformations(), after the motions or the anim graph got updated.
+         */
+        void UpdateSampledPoseInterpolation(float timePassedInSeconds, bool sampleMotions);
     };
 }   // namespace EMotionFX
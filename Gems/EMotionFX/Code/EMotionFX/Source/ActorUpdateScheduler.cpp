@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// include the required headers
+#include "ActorUpdateScheduler.h"
+#include "ActorInstance.h"
+
+
+namespace EMotionFX
+{
+    ActorUpdateScheduler::EUpdateLod ActorUpdateScheduler::CalcUpdateLod(const ActorInstance* actorInstance) const
+    {
+        if (!actorInstance->GetIsVisible())
+        {
+            return UPDATELOD_ROOTMOTIONONLY;
+        }
+
+        if (!m_updateLodSettings.m_enabled)
+        {
+            return UPDATELOD_FULL;
+        }
+
+        const float distanceSq = actorInstance->GetWorldSpaceTransform().m_position.GetDistanceSq(m_updateLodSettings.m_viewPosition);
+        if (distanceSq >= m_updateLodSettings.m_lowDistance * m_updateLodSettings.m_lowDistance)
+        {
+            return UPDATELOD_LOW;
+        }
+
+        if (distanceSq >= m_updateLodSettings.m_reducedDistance * m_updateLodSettings.m_reducedDistance)
+        {
+            return UPDATELOD_REDUCED;
+        }
+
+        return UPDATELOD_FULL;
+    }
+
+
+    void ActorUpdateScheduler::ResetStats()
+    {
+        m_numUpdated.SetValue(0);
+        m_numVisible.SetValue(0);
+        m_numSampled.SetValue(0);
+        for (MCore::AtomicSizeT& numInUpdateLod : m_numInUpdateLod)
+        {
+            numInUpdateLod.SetValue(0);
+        }
+    }
+
+
+    void ActorUpdateScheduler::UpdateActorInstance(ActorInstance* actorInstance, float timePassedInSeconds)
+    {
+        const bool isVisible = actorInstance->GetIsVisible();
+        if (isVisible)
+        {
+            m_numVisible.Increment();
+        }
+
+        const EUpdateLod updateLod = CalcUpdateLod(actorInstance);
+        m_numInUpdateLod[updateLod].Increment();
+
+        // the reduced update LOD levels never sample more often than the actor instance itself asks for
+        float samplingRate = actorInstance->GetMotionSamplingRate();
+        if (updateLod == UPDATELOD_REDUCED)
+        {
+            samplingRate = AZ::GetMax(samplingRate, m_updateLodSettings.m_reducedSamplingRate);
+        }
+        else if (updateLod == UPDATELOD_LOW)
+        {
+            samplingRate = AZ::GetMax(samplingRate, m_updateLodSettings.m_lowSamplingRate);
+        }
+
+        // check if we want to sample motions
+        bool sampleMotions = false;
+        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
+        if (actorInstance->GetMotionSamplingTimer() >= samplingRate)
+        {
+            sampleMotions = true;
+            actorInstance->SetMotionSamplingTimer(0.0f);
+
+            if (isVisible)
+            {
+                m_numSampled.Increment();
+            }
+        }
+
+        // only interpolate while motions don't get sampled every frame, to not add the latency of one interval otherwise
+        const bool interpolatePoses = m_updateLodSettings.m_enabled && m_updateLodSettings.m_interpolatePoses &&
+            (updateLod == UPDATELOD_REDUCED || updateLod == UPDATELOD_LOW);
+        actorInstance->SetSampledPoseInterpolationEnabled(interpolatePoses);
+
+        // invisible actor instances only update their motion timers and root motion, without calculating any joint transforms
+        actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+    }
+}   // namespace EMotionFX
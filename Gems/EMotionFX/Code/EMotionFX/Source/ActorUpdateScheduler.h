@@ -11,6 +11,7 @@
 // include the required headers
 #include "EMotionFXConfig.h"
 #include "MCore/Source/RefCounted.h"
+#include <AzCore/Math/Vector3.h>
 
 
 namespace EMotionFX
@@ -29,6 +30,33 @@ namespace EMotionFX
 
     {
     public:
+        /**
+         * The update LOD levels, from the most to the least expensive update.
+         */
+        enum EUpdateLod : uint8
+        {
+            UPDATELOD_FULL              = 0,    /**< Motions get sampled at the actor instance motion sampling rate. */
+            UPDATELOD_REDUCED           = 1,    /**< Motions get sampled at the reduced sampling rate, interpolating poses in between. */
+            UPDATELOD_LOW               = 2,    /**< Motions get sampled at the low sampling rate, interpolating poses in between. */
+            UPDATELOD_ROOTMOTIONONLY    = 3,    /**< Off-screen, only the motion timers and the root motion get updated, no joint transforms. */
+            UPDATELOD_NUM               = 4
+        };
+
+        /**
+         * The distance and visibility based update LOD settings.
+         * When disabled, all actor instances get updated using their own motion sampling rate, and invisible ones only get their root motion updated.
+         */
+        struct EMFX_API UpdateLodSettings
+        {
+            AZ::Vector3 m_viewPosition = AZ::Vector3::CreateZero();     /**< The world space position of the viewer the distances are measured from. */
+            float       m_reducedDistance = 15.0f;                      /**< The distance from which actor instances use UPDATELOD_REDUCED. */
+            float       m_lowDistance = 40.0f;                          /**< The distance from which actor instances use UPDATELOD_LOW. */
+            float       m_reducedSamplingRate = 1.0f / 20.0f;           /**< The motion sampling rate in seconds used in UPDATELOD_REDUCED. */
+            float       m_lowSamplingRate = 1.0f / 8.0f;                /**< The motion sampling rate in seconds used in UPDATELOD_LOW. */
+            bool        m_enabled = false;                              /**< Use distance based update LOD levels for visible actor instances? */
+            bool        m_interpolatePoses = true;                      /**< Interpolate between sampled poses in the reduced and low update LOD levels? */
+        };
+
         /**
          * Get the name of this class, or a description.
          * @result The string containing the name of the scheduler.
@@ -84,11 +112,42 @@ namespace EMotionFX
         size_t GetNumUpdatedActorInstances() const                  { return m_numUpdated.GetValue(); }
         size_t GetNumVisibleActorInstances() const                  { return m_numVisible.GetValue(); }
         size_t GetNumSampledActorInstances() const                  { return m_numSampled.GetValue(); }
+        size_t GetNumActorInstancesInUpdateLod(EUpdateLod updateLod) const  { return m_numInUpdateLod[updateLod].GetValue(); }
+
+        /**
+         * Set the distance and visibility based update LOD settings.
+         * The view position usually has to be updated every frame, before executing the schedule.
+         * @param settings The new update LOD settings.
+         */
+        void SetUpdateLodSettings(const UpdateLodSettings& settings)        { m_updateLodSettings = settings; }
+        const UpdateLodSettings& GetUpdateLodSettings() const               { return m_updateLodSettings; }
+
+        /**
+         * Calculate the update LOD level of an actor instance, based on its visibility and its distance to the view position.
+         * @param actorInstance The actor instance to calculate the update LOD level for.
+         * @result The update LOD level to use for the actor instance.
+         */
+        EUpdateLod CalcUpdateLod(const ActorInstance* actorInstance) const;
 
     protected:
         MCore::AtomicSizeT m_numUpdated;
         MCore::AtomicSizeT m_numVisible;
         MCore::AtomicSizeT m_numSampled;
+        MCore::AtomicSizeT m_numInUpdateLod[UPDATELOD_NUM];
+        UpdateLodSettings m_updateLodSettings;
+
+        /**
+         * Reset the update statistics, to be called before updating the actor instances.
+         */
+        void ResetStats();
+
+        /**
+         * Update the transformations of a single actor instance, sampling its motions when needed for its update LOD level.
+         * This is safe to call from multiple threads at the same time for different actor instances.
+         * @param actorInstance The actor instance to update.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void UpdateActorInstance(ActorInstance* actorInstance, float timePassedInSeconds);
 
         /**
          * The constructor.
@@ -48,6 +48,7 @@ namespace EMotionFX
         m_visualizeScale         = 1.0f;
         m_autoReleaseAllPoses   = true;
         m_autoReleaseAllRefDatas= true;
+        m_outputCacheEnabled     = false;
 
 #if defined(EMFX_DEVELOPMENT_BUILD)
         m_isOwnedByRuntime       = false;
@@ -232,17 +233,37 @@ namespace EMotionFX
         // calculate the anim graph output
         AnimGraphNode* rootNode = GetRootNode();
 
-        // calculate the output of the state machine
-        rootNode->PerformOutput(this);
-
-        // update the output pose
-        if (outputPose)
+        // Copy the output of another instance in the same state, when one calculated it already this frame.
+        // Sub graphs and networked instances always calculate their output, as their parent graph or the snapshot use the node poses.
+        const bool useOutputCache = m_outputCacheEnabled && outputPose && !m_parentAnimGraphInstance && !m_snapshot;
+        AnimGraphOutputCache* outputCache = useOutputCache ? &GetAnimGraphManager().GetOutputCache() : nullptr;
+        AnimGraphOutputCache::Key outputCacheKey;
+        bool outputCached = false;
+        if (outputCache)
         {
-            *outputPose = rootNode->GetMainOutputPose(this)->GetPose();
+            outputCacheKey = outputCache->CreateKey(this, m_outputCacheNodes);
+            outputCached = outputCache->Find(outputCacheKey, outputPose);
         }
 
-        // decrease pose ref count for the root
-        rootNode->DecreaseRef(this);
+        if (!outputCached)
+        {
+            // calculate the output of the state machine
+            rootNode->PerformOutput(this);
+
+            // update the output pose
+            if (outputPose)
+            {
+                *outputPose = rootNode->GetMainOutputPose(this)->GetPose();
+            }
+
+            // decrease pose ref count for the root
+            rootNode->DecreaseRef(this);
+
+            if (outputCache)
+            {
+                outputCache->Store(outputCacheKey, *outputPose);
+            }
+        }
 
         //MCore::LogInfo("------poses   used = %d/%d (max=%d)----------", GetEMotionFX().GetThreadData(0)->GetPosePool().GetNumUsedPoses(), GetEMotionFX().GetThreadData(0)->GetPosePool().GetNumPoses(), GetEMotionFX().GetThreadData(0)->GetPosePool().GetNumMaxUsedPoses());
         //MCore::LogInfo("------refData used = %d/%d (max=%d)----------", GetEMotionFX().GetThreadData(0)->GetRefCountedDataPool().GetNumUsedItems(), GetEMotionFX().GetThreadData(0)->GetRefCountedDataPool().GetNumItems(), GetEMotionFX().GetThreadData(0)->GetRefCountedDataPool().GetNumMaxUsedItems());
@@ -1264,6 +1285,16 @@ namespace EMotionFX
         m_autoReleaseAllPoses = automaticallyFreePoses;
     }
 
+    void AnimGraphInstance::SetOutputCacheEnabled(bool enabled)
+    {
+        m_outputCacheEnabled = enabled;
+    }
+
+    bool AnimGraphInstance::GetOutputCacheEnabled() const
+    {
+        return m_outputCacheEnabled;
+    }
+
     void AnimGraphInstance::ReleaseRefDatas()
     {
         const uint32 threadIndex = m_actorInstance->GetThreadIndex();
@@ -297,6 +297,14 @@ namespace EMotionFX
         void ReleaseRefDatas();
         void ReleasePoses();
 
+        /**
+         * Enable or disable sharing the output pose with other anim graph instances in the same state, using the output cache of the anim graph manager.
+         * This is disabled by default. Only root anim graph instances without network snapshots use the cache.
+         * @param enabled Set to true to look up the output pose in the cache before calculating it.
+         */
+        void SetOutputCacheEnabled(bool enabled);
+        bool GetOutputCacheEnabled() const;
+
     private:
         AnimGraph*                                          m_animGraph;
         ActorInstance*                                      m_actorInstance;
@@ -319,6 +327,8 @@ namespace EMotionFX
 
         bool                                                m_autoReleaseAllPoses;
         bool                                                m_autoReleaseAllRefDatas;
+        bool                                                m_outputCacheEnabled;    /**< Share the output pose with other instances in the same state? */
+        AZStd::vector<AnimGraphNode*>                       m_outputCacheNodes;      /**< Temporary storage for the active nodes when building the output cache key. */
         
         AZStd::vector<AnimGraphInstance*>                   m_followerGraphs;
         AZStd::vector<AnimGraphInstance*>                   m_leaderGraphs;
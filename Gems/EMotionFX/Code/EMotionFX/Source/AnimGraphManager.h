@@ -13,6 +13,7 @@
 #include <MCore/Source/RefCounted.h>
 #include <AzCore/std/containers/vector.h>
 #include "AnimGraphObject.h"
+#include "AnimGraphOutputCache.h"
 #include <MCore/Source/MultiThreadManager.h>
 
 
@@ -41,6 +42,7 @@ namespace EMotionFX
         void Init();
 
         MCORE_INLINE BlendSpaceManager* GetBlendSpaceManager() const { return m_blendSpaceManager; }
+        MCORE_INLINE AnimGraphOutputCache& GetOutputCache() { return m_outputCache; }
 
         // anim graph helper functions
         void AddAnimGraph(AnimGraph* setup);
@@ -77,6 +79,7 @@ namespace EMotionFX
         AZStd::vector<AnimGraph*>           m_animGraphs;
         AZStd::vector<AnimGraphInstance*>   m_animGraphInstances;
         BlendSpaceManager*                  m_blendSpaceManager;
+        AnimGraphOutputCache                m_outputCache;          /**< The output poses shared by anim graph instances in the same state, within the current frame. */
         mutable MCore::MutexRecursive       m_animGraphLock;
         mutable MCore::MutexRecursive       m_animGraphInstanceLock;
 
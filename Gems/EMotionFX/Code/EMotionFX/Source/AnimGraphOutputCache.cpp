@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "AnimGraphOutputCache.h"
+#include "ActorInstance.h"
+#include "AnimGraph.h"
+#include "AnimGraphInstance.h"
+#include "AnimGraphNode.h"
+#include "AnimGraphNodeData.h"
+#include "Pose.h"
+#include <AzCore/std/hash.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/parallel/lock.h>
+#include <MCore/Source/AttributeBool.h>
+#include <MCore/Source/AttributeColor.h>
+#include <MCore/Source/AttributeFloat.h>
+#include <MCore/Source/AttributeInt32.h>
+#include <MCore/Source/AttributeQuaternion.h>
+#include <MCore/Source/AttributeString.h>
+#include <MCore/Source/AttributeVector2.h>
+#include <MCore/Source/AttributeVector3.h>
+#include <MCore/Source/AttributeVector4.h>
+
+
+namespace EMotionFX
+{
+    AZ_CLASS_ALLOCATOR_IMPL(AnimGraphOutputCache, AnimGraphAllocator)
+
+    namespace
+    {
+        void HashFloats(size_t& seed, const float* values, size_t numValues)
+        {
+            for (size_t i = 0; i < numValues; ++i)
+            {
+                AZStd::hash_combine(seed, values[i]);
+            }
+        }
+
+        void HashAttribute(size_t& seed, const MCore::Attribute* attribute)
+        {
+            AZStd::hash_combine(seed, attribute->GetType());
+            switch (attribute->GetType())
+            {
+            case MCore::AttributeFloat::TYPE_ID:
+                AZStd::hash_combine(seed, static_cast<const MCore::AttributeFloat*>(attribute)->GetValue());
+                break;
+            case MCore::AttributeBool::TYPE_ID:
+                AZStd::hash_combine(seed, static_cast<const MCore::AttributeBool*>(attribute)->GetValue());
+                break;
+            case MCore::AttributeInt32::TYPE_ID:
+                AZStd::hash_combine(seed, static_cast<const MCore::AttributeInt32*>(attribute)->GetValue());
+                break;
+            case MCore::AttributeString::TYPE_ID:
+                AZStd::hash_combine(seed, static_cast<const MCore::AttributeString*>(attribute)->GetValue());
+                break;
+            case MCore::AttributeVector2::TYPE_ID:
+            {
+                const AZ::Vector2& value = static_cast<const MCore::AttributeVector2*>(attribute)->GetValue();
+                const float values[2] = { value.GetX(), value.GetY() };
+                HashFloats(seed, values, 2);
+                break;
+            }
+            case MCore::AttributeVector3::TYPE_ID:
+            {
+                const AZ::Vector3& value = static_cast<const MCore::AttributeVector3*>(attribute)->GetValue();
+                const float values[3] = { value.GetX(), value.GetY(), value.GetZ() };
+                HashFloats(seed, values, 3);
+                break;
+            }
+            case MCore::AttributeVector4::TYPE_ID:
+            {
+                const AZ::Vector4& value = static_cast<const MCore::AttributeVector4*>(attribute)->GetValue();
+                const float values[4] = { value.GetX(), value.GetY(), value.GetZ(), value.GetW() };
+                HashFloats(seed, values, 4);
+                break;
+            }
+            case MCore::AttributeQuaternion::TYPE_ID:
+            {
+                const AZ::Quaternion& value = static_cast<const MCore::AttributeQuaternion*>(attribute)->GetValue();
+                const float values[4] = { value.GetX(), value.GetY(), value.GetZ(), value.GetW() };
+                HashFloats(seed, values, 4);
+                break;
+            }
+            case MCore::AttributeColor::TYPE_ID:
+            {
+                const AZ::Color& value = static_cast<const MCore::AttributeColor*>(attribute)->GetValue();
+                const float values[4] = { value.GetR(), value.GetG(), value.GetB(), value.GetA() };
+                HashFloats(seed, values, 4);
+                break;
+            }
+            default:
+            {
+                // Less common attribute types, like the ones of custom parameters, get hashed by their string representation.
+                AZStd::string valueString;
+                attribute->ConvertToString(valueString);
+                AZStd::hash_combine(seed, valueString);
+                break;
+            }
+            }
+        }
+    } // namespace
+
+
+    bool AnimGraphOutputCache::Key::operator==(const Key& other) const
+    {
+        return m_animGraph == other.m_animGraph &&
+            m_actor == other.m_actor &&
+            m_motionSet == other.m_motionSet &&
+            m_lodLevel == other.m_lodLevel &&
+            m_stateHash == other.m_stateHash;
+    }
+
+
+    size_t AnimGraphOutputCache::KeyHasher::operator()(const Key& key) const
+    {
+        size_t seed = key.m_stateHash;
+        AZStd::hash_combine(seed, key.m_animGraph, key.m_actor, key.m_motionSet, key.m_lodLevel);
+        return seed;
+    }
+
+
+    AnimGraphOutputCache::AnimGraphOutputCache() = default;
+
+
+    AnimGraphOutputCache::~AnimGraphOutputCache() = default;
+
+
+    AnimGraphOutputCache::Key AnimGraphOutputCache::CreateKey(AnimGraphInstance* animGraphInstance, AZStd::vector<AnimGraphNode*>& activeNodes) const
+    {
+        const ActorInstance* actorInstance = animGraphInstance->GetActorInstance();
+
+        Key key;
+        key.m_animGraph = animGraphInstance->GetAnimGraph();
+        key.m_actor = actorInstance->GetActor();
+        key.m_motionSet = animGraphInstance->GetMotionSet();
+        key.m_lodLevel = actorInstance->GetLODLevel();
+
+        size_t stateHash = 0;
+        const size_t numParameters = key.m_animGraph->GetNumValueParameters();
+        for (size_t i = 0; i < numParameters; ++i)
+        {
+            HashAttribute(stateHash, animGraphInstance->GetParameterValue(i));
+        }
+
+        // The active nodes and their play times and weights cover the states, transitions and blends the graph is in.
+        animGraphInstance->CollectActiveAnimGraphNodes(&activeNodes);
+        for (const AnimGraphNode* node : activeNodes)
+        {
+            const AnimGraphNodeData* uniqueData = node->FindOrCreateUniqueNodeData(animGraphInstance);
+            const float playTime = uniqueData->GetCurrentPlayTime();
+            AZStd::hash_combine(stateHash, static_cast<AZ::u64>(node->GetId()));
+            if (m_timeQuantization > 0.0f)
+            {
+                AZStd::hash_combine(stateHash, static_cast<AZ::s64>(AZStd::floor(playTime / m_timeQuantization + 0.5f)));
+            }
+            else
+            {
+                AZStd::hash_combine(stateHash, playTime);
+            }
+            AZStd::hash_combine(stateHash, static_cast<AZ::s32>(uniqueData->GetGlobalWeight() * 1024.0f + 0.5f));
+        }
+
+        key.m_stateHash = stateHash;
+        return key;
+    }
+
+
+    bool AnimGraphOutputCache::Find(const Key& key, Pose* outputPose)
+    {
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+            const auto iterator = m_poseIndices.find(key);
+            if (iterator != m_poseIndices.end())
+            {
+                *outputPose = *m_poses[iterator->second];
+                m_numHits.Increment();
+                return true;
+            }
+        }
+
+        m_numMisses.Increment();
+        return false;
+    }
+
+
+    void AnimGraphOutputCache::Store(const Key& key, const Pose& pose)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        if (m_poseIndices.find(key) != m_poseIndices.end())
+        {
+            return;
+        }
+
+        if (m_numUsedPoses == m_poses.size())
+        {
+            m_poses.emplace_back(new Pose());
+        }
+
+        Pose* cachedPose = m_poses[m_numUsedPoses].get();
+        if (cachedPose->GetActor() != key.m_actor)
+        {
+            cachedPose->LinkToActor(key.m_actor);
+        }
+        *cachedPose = pose;
+
+        m_poseIndices.emplace(key, m_numUsedPoses);
+        m_numUsedPoses++;
+    }
+
+
+    void AnimGraphOutputCache::Clear()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        m_poseIndices.clear();
+        m_numUsedPoses = 0;
+    }
+
+
+    void AnimGraphOutputCache::SetTimeQuantization(float timeStep)
+    {
+        m_timeQuantization = timeStep;
+    }
+
+
+    float AnimGraphOutputCache::GetTimeQuantization() const
+    {
+        return m_timeQuantization;
+    }
+
+
+    size_t AnimGraphOutputCache::GetNumCachedPoses() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return m_numUsedPoses;
+    }
+
+
+    size_t AnimGraphOutputCache::GetNumHits() const
+    {
+        return m_numHits.GetValue();
+    }
+
+
+    size_t AnimGraphOutputCache::GetNumMisses() const
+    {
+        return m_numMisses.GetValue();
+    }
+
+
+    void AnimGraphOutputCache::ResetStats()
+    {
+        m_numHits.SetValue(0);
+        m_numMisses.SetValue(0);
+    }
+} // namespace EMotionFX
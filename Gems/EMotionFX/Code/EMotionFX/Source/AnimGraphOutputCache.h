@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include "EMotionFXConfig.h"
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <MCore/Source/MultiThreadManager.h>
+
+
+namespace EMotionFX
+{
+    // forward declarations
+    class Actor;
+    class AnimGraph;
+    class AnimGraphInstance;
+    class AnimGraphNode;
+    class MotionSet;
+    class Pose;
+
+    /**
+     * Shares the output poses of anim graph instances that are in the same state within one frame.
+     * Crowds often run the same anim graph with the same parameters in sync, where every instance would evaluate the very same pose.
+     * Anim graph instances that enabled the cache look up their state in here before calculating their output, and copy the pose
+     * of the first instance that calculated it instead. The state consists of the anim graph, actor, motion set and LOD level,
+     * the parameter values, and the active nodes with their quantized play times and global weights.
+     * The cache gets cleared at the start of every EMotionFXManager::Update().
+     * Only enable it for instances whose output doesn't depend on anything else, like the world transform of the actor instance for IK nodes.
+     */
+    class EMFX_API AnimGraphOutputCache
+    {
+    public:
+        AZ_CLASS_ALLOCATOR_DECL
+
+        AnimGraphOutputCache();
+        ~AnimGraphOutputCache();
+
+        /**
+         * The key of the state of an anim graph instance.
+         */
+        struct EMFX_API Key
+        {
+            const AnimGraph*    m_animGraph = nullptr;
+            const Actor*        m_actor = nullptr;
+            const MotionSet*    m_motionSet = nullptr;
+            size_t              m_lodLevel = 0;
+            size_t              m_stateHash = 0;
+
+            bool operator==(const Key& other) const;
+        };
+
+        /**
+         * Build the key of the current state of the given anim graph instance, after it got updated.
+         * @param animGraphInstance The anim graph instance to build the key for.
+         * @param activeNodes Temporary storage for the active nodes, to prevent allocations.
+         * @result The key of the state of the anim graph instance.
+         */
+        Key CreateKey(AnimGraphInstance* animGraphInstance, AZStd::vector<AnimGraphNode*>& activeNodes) const;
+
+        /**
+         * Copy the cached pose of the given state into the output pose.
+         * @param key The state to find the pose for.
+         * @param outputPose The pose to copy the cached pose into.
+         * @result True when the pose got found and copied, false when no instance calculated the pose for this state yet.
+         */
+        bool Find(const Key& key, Pose* outputPose);
+
+        /**
+         * Store the pose of the given state, so that other instances in the same state can use it.
+         * Does nothing when another instance already stored the pose of this state.
+         * @param key The state the pose belongs to.
+         * @param pose The output pose of the anim graph instance.
+         */
+        void Store(const Key& key, const Pose& pose);
+
+        /**
+         * Remove all cached poses. The poses get reused afterwards, so that filling the cache doesn't allocate each frame.
+         */
+        void Clear();
+
+        /**
+         * Set the time step the play times of the active nodes get quantized to before they get hashed.
+         * Larger steps let more instances share their poses, at the cost of snapping their animations to the steps.
+         * @param timeStep The time step in seconds, which defaults to 1/60th of a second. Values of zero or less disable the quantization.
+         */
+        void SetTimeQuantization(float timeStep);
+        float GetTimeQuantization() const;
+
+        size_t GetNumCachedPoses() const;
+        size_t GetNumHits() const;
+        size_t GetNumMisses() const;
+        void ResetStats();
+
+    private:
+        struct KeyHasher
+        {
+            size_t operator()(const Key& key) const;
+        };
+
+        AZStd::unordered_map<Key, size_t, KeyHasher>    m_poseIndices;      /**< The index into the poses for each cached state. */
+        AZStd::vector<AZStd::unique_ptr<Pose>>          m_poses;            /**< The pose pool, where the first m_numUsedPoses are used. */
+        size_t                                          m_numUsedPoses = 0;
+        float                                           m_timeQuantization = 1.0f / 60.0f;
+        MCore::AtomicSizeT                              m_numHits;
+        MCore::AtomicSizeT                              m_numMisses;
+        mutable AZStd::shared_mutex                     m_mutex;
+    };
+} // namespace EMotionFX
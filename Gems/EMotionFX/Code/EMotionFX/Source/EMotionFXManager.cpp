@@ -24,11 +24,15 @@
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Jobs/Job.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzFramework/API/ApplicationAPI.h>
 #include <EMotionFX/Source/Allocators.h>
 #include <EMotionFX/Source/DebugDraw.h>
 #include <EMotionFX/Source/MotionData/MotionDataFactory.h>
 #include <EMotionFX/Source/PoseDataFactory.h>
+#include <EMotionFX/Source/RagdollPhysicsSync.h>
 #include <Integration/Rendering/RenderActorSettings.h>
 
 namespace EMotionFX
@@ -74,10 +78,16 @@ namespace EMotionFX
         gEMFX.Get()->SetMotionInstancePool    (MotionInstancePool::Create());
         gEMFX.Get()->SetDebugDraw             (aznew DebugDraw());
         gEMFX.Get()->SetPoseDataFactory       (aznew PoseDataFactory());
+        gEMFX.Get()->SetRagdollPhysicsSync    (aznew RagdollPhysicsSync());
         gEMFX.Get()->SetGlobalSimulationSpeed (1.0f);
 
-        // set the number of threads
-        const AZ::u32 numThreads = AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
+        // set the number of threads, enough for both the job manager and the task executor workers the scheduler can run on
+        AZ::u32 numThreads = AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
+        const AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive())
+        {
+            numThreads = AZ::GetMax(numThreads, AZ::TaskExecutor::Instance().GetWorkerCount());
+        }
         AZ_Assert(numThreads > 0, "The number of threads is expected to be bigger than 0.");
         gEMFX.Get()->SetNumThreads(numThreads);
 
@@ -121,6 +131,7 @@ namespace EMotionFX
         m_motionInstancePool     = nullptr;
         m_debugDraw              = nullptr;
         m_poseDataFactory        = nullptr;
+        m_ragdollPhysicsSync     = nullptr;
         m_unitType               = MCore::Distance::UNITTYPE_METERS;
         m_globalSimulationSpeed  = 1.0f;
         m_isInEditorMode        = false;
@@ -170,6 +181,9 @@ namespace EMotionFX
         delete m_poseDataFactory;
         m_poseDataFactory = nullptr;
 
+        delete m_ragdollPhysicsSync;
+        m_ragdollPhysicsSync = nullptr;
+
         m_renderActorSettings.reset();
 
         m_eventManager->Destroy();
@@ -197,6 +211,7 @@ namespace EMotionFX
         AZ_PROFILE_SCOPE(Animation, "EMotionFXManager::Update");
 
         m_debugDraw->Clear();
+        m_animGraphManager->GetOutputCache().Clear();
         m_recorder->UpdatePlayMode(timePassedInSeconds);
         m_actorManager->UpdateActorInstances(timePassedInSeconds);
         m_eventManager->OnSimulatePhysics(timePassedInSeconds);
@@ -38,6 +38,7 @@ namespace EMotionFX
     class EventDataFactory;
     class DebugDraw;
     class PoseDataFactory;
+    class RagdollPhysicsSync;
 
     // versions
 #define EMFX_HIGHVERSION 4
@@ -191,6 +192,12 @@ namespace EMotionFX
 
         MCORE_INLINE PoseDataFactory* GetPoseDataFactory() const                    { return m_poseDataFactory; }
 
+        /**
+         * Get the system that syncs the ragdolls of the actor instances after each physics simulation step.
+         * @result A pointer to the ragdoll physics sync.
+         */
+        MCORE_INLINE RagdollPhysicsSync* GetRagdollPhysicsSync() const              { return m_ragdollPhysicsSync; }
+
         /**
          * Get the render actor settings
          * @result A pointer to global render actor settings.
@@ -364,6 +371,7 @@ namespace EMotionFX
         Recorder*                   m_recorder;              /**< The recorder. */
         MotionInstancePool*         m_motionInstancePool;    /**< The motion instance pool. */        
         DebugDraw*                  m_debugDraw;             /**< The debug drawing system. */
+        RagdollPhysicsSync*         m_ragdollPhysicsSync;    /**< Syncs the ragdolls of all actor instances after the physics simulation. */
         AZStd::unique_ptr<AZ::Render::RenderActorSettings> m_renderActorSettings;   /**< The global render actor settings. */
 
         AZStd::vector<ThreadData*>   m_threadDatas;           /**< The per thread data. */
@@ -439,6 +447,8 @@ namespace EMotionFX
 
         void SetPoseDataFactory(PoseDataFactory* poseDataFactory) { m_poseDataFactory = poseDataFactory; }
 
+        void SetRagdollPhysicsSync(RagdollPhysicsSync* ragdollPhysicsSync) { m_ragdollPhysicsSync = ragdollPhysicsSync; }
+
         /**
          * Set the number of threads to use.
          * @param numThreads The number of threads to use internally. This must be a value of 1 or above.
@@ -527,5 +537,6 @@ namespace EMotionFX
     MCORE_INLINE MotionInstancePool&        GetMotionInstancePool()     { return *GetEMotionFX().GetMotionInstancePool(); } /**< Get the motion instance pool. */
     MCORE_INLINE DebugDraw&                 GetDebugDraw()              { return *GetEMotionFX().GetDebugDraw(); }          /**< Get the debug drawing. */
     MCORE_INLINE PoseDataFactory&           GetPoseDataFactory()        { return *GetEMotionFX().GetPoseDataFactory(); }
+    MCORE_INLINE RagdollPhysicsSync&        GetRagdollPhysicsSync()     { return *GetEMotionFX().GetRagdollPhysicsSync(); } /**< Get the ragdoll physics sync. */
     MCORE_INLINE AZ::Render::RenderActorSettings& GetRenderActorSettings() { return *GetEMotionFX().GetRenderActorSettings(); }/**< Get the render actor settings. */
 }   // namespace EMotionFX
@@ -0,0 +1,1382 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/MorphSetup.h>
+#include <EMotionFX/Source/MorphSetupInstance.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/TransformData.h>
+
+#include <EMotionFX/Source/Importer/SharedFileFormatStructs.h>
+#include <EMotionFX/Exporters/ExporterLib/Exporter/Exporter.h>
+#include <MCore/Source/CompressedQuaternion.h>
+#include <MCore/Source/LogManager.h>
+#include <MCore/Source/Stream.h>
+
+namespace EMotionFX
+{
+    namespace
+    {
+        // The bit rates Optimize() tries, from small to large, before falling back to the uncompressed floats.
+        constexpr AZ::u8 s_bitRates[] = { 4, 6, 8, 10, 12, 14, 16, 18, 20, 24 };
+
+        AZ::u32 Quantize(float value, float min, float scale, AZ::u8 bitRate)
+        {
+            if (bitRate == CompressedMotionData::s_rawBitRate)
+            {
+                AZ::u32 bits;
+                memcpy(&bits, &value, sizeof(AZ::u32));
+                return bits;
+            }
+
+            if (scale <= 0.0f)
+            {
+                return 0;
+            }
+
+            const float maxValue = static_cast<float>((1u << bitRate) - 1);
+            return static_cast<AZ::u32>(AZ::GetClamp(AZStd::round((value - min) / scale), 0.0f, maxValue));
+        }
+
+        float Dequantize(AZ::u32 bits, float min, float scale, AZ::u8 bitRate)
+        {
+            if (bitRate == CompressedMotionData::s_rawBitRate)
+            {
+                float value;
+                memcpy(&value, &bits, sizeof(float));
+                return value;
+            }
+
+            return static_cast<float>(bits) * scale + min;
+        }
+    } // namespace
+
+    CompressedMotionData::~CompressedMotionData()
+    {
+        ClearAllData();
+    }
+
+    MotionData* CompressedMotionData::CreateNew() const
+    {
+        return aznew CompressedMotionData();
+    }
+
+    const char* CompressedMotionData::GetSceneSettingsName() const
+    {
+        return "Compressed Keyframes (smallest, slower)";
+    }
+
+    void CompressedMotionData::InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate, float newSampleRate, [[maybe_unused]] bool updateDuration)
+    {
+        AZ_Assert(newSampleRate > 0.0f, "Expected the sample rate to be larger than zero.");
+        float sampleRate = keepSameSampleRate ? motionData->GetSampleRate() : newSampleRate;
+
+        // Calculate the sample spacing and number of samples required.
+        float sampleSpacing = 0.0f;
+        size_t numSamples = 0;
+        MotionData::CalculateSampleInformation(motionData->GetDuration(), sampleRate, numSamples, sampleSpacing);
+
+        Clear();
+        CopyBaseMotionData(motionData);
+        m_numSamples = numSamples;
+        SetSampleRate(sampleRate);
+        UpdateDuration();
+
+        // Resample all animated channels, still uncompressed, until Optimize() picks the bit rates.
+        AZStd::vector<ChannelSamples> channels;
+        const auto addChannel = [&channels, numSamples](ChannelType type, size_t dataIndex, AZ::u8 numComponents) -> ChannelSamples&
+        {
+            ChannelSamples& channel = channels.emplace_back();
+            channel.m_type = type;
+            channel.m_dataIndex = static_cast<AZ::u32>(dataIndex);
+            channel.m_numComponents = numComponents;
+            channel.m_values.resize(numSamples, AZ::Vector4::CreateZero());
+            return channel;
+        };
+
+        // Joints.
+        const size_t numJoints = motionData->GetNumJoints();
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            if (!motionData->IsJointAnimated(i))
+            {
+                continue;
+            }
+
+            if (motionData->IsJointPositionAnimated(i))
+            {
+                ChannelSamples& channel = addChannel(CHANNEL_POSITION, i, 3);
+                for (size_t s = 0; s < numSamples; ++s)
+                {
+                    channel.m_values[s] = AZ::Vector4::CreateFromVector3(motionData->SampleJointPosition(s * sampleSpacing, i));
+                    channel.m_values[s].SetW(0.0f);
+                }
+            }
+
+            if (motionData->IsJointRotationAnimated(i))
+            {
+                // Keep all rotations in the hemisphere of the previous sample, so that the components interpolate linearly.
+                ChannelSamples& channel = addChannel(CHANNEL_ROTATION, i, 4);
+                AZ::Quaternion previous = AZ::Quaternion::CreateIdentity();
+                for (size_t s = 0; s < numSamples; ++s)
+                {
+                    AZ::Quaternion rotation = motionData->SampleJointRotation(s * sampleSpacing, i).GetNormalized();
+                    if (s > 0 && previous.Dot(rotation) < 0.0f)
+                    {
+                        rotation = -rotation;
+                    }
+                    channel.m_values[s] = AZ::Vector4(rotation.GetX(), rotation.GetY(), rotation.GetZ(), rotation.GetW());
+                    previous = rotation;
+                }
+            }
+
+            EMFX_SCALECODE
+            (
+                if (motionData->IsJointScaleAnimated(i))
+                {
+                    ChannelSamples& channel = addChannel(CHANNEL_SCALE, i, 3);
+                    for (size_t s = 0; s < numSamples; ++s)
+                    {
+                        channel.m_values[s] = AZ::Vector4::CreateFromVector3(motionData->SampleJointScale(s * sampleSpacing, i));
+                        channel.m_values[s].SetW(0.0f);
+                    }
+                }
+            )
+        }
+
+        // Morphs.
+        const size_t numMorphs = motionData->GetNumMorphs();
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            if (motionData->IsMorphAnimated(i))
+            {
+                ChannelSamples& channel = addChannel(CHANNEL_MORPH, i, 1);
+                for (size_t s = 0; s < numSamples; ++s)
+                {
+                    channel.m_values[s].SetX(motionData->SampleMorph(s * sampleSpacing, i));
+                }
+            }
+        }
+
+        // Floats.
+        const size_t numFloats = motionData->GetNumFloats();
+        for (size_t i = 0; i < numFloats; ++i)
+        {
+            if (motionData->IsFloatAnimated(i))
+            {
+                ChannelSamples& channel = addChannel(CHANNEL_FLOAT, i, 1);
+                for (size_t s = 0; s < numSamples; ++s)
+                {
+                    channel.m_values[s].SetX(motionData->SampleFloat(s * sampleSpacing, i));
+                }
+            }
+        }
+
+        Build(channels);
+    }
+
+    void CompressedMotionData::Optimize(const OptimizeSettings& settings)
+    {
+        AZStd::vector<ChannelSamples> channels = DecompressChannels();
+        for (auto it = channels.begin(); it != channels.end();)
+        {
+            ChannelSamples& channel = *it;
+
+            float maxError = 0.0f;
+            const AZStd::vector<size_t>* ignoreList = nullptr;
+            switch (channel.m_type)
+            {
+            case CHANNEL_POSITION:
+                maxError = settings.m_maxPosError;
+                ignoreList = &settings.m_jointIgnoreList;
+                break;
+            case CHANNEL_ROTATION:
+                maxError = settings.m_maxRotError;
+                ignoreList = &settings.m_jointIgnoreList;
+                break;
+            case CHANNEL_SCALE:
+                maxError = settings.m_maxScaleError;
+                ignoreList = &settings.m_jointIgnoreList;
+                break;
+            case CHANNEL_MORPH:
+                maxError = settings.m_maxMorphError;
+                ignoreList = &settings.m_morphIgnoreList;
+                break;
+            case CHANNEL_FLOAT:
+                maxError = settings.m_maxFloatError;
+                ignoreList = &settings.m_floatIgnoreList;
+                break;
+            }
+
+            // Keep ignored channels uncompressed.
+            if (AZStd::find(ignoreList->begin(), ignoreList->end(), channel.m_dataIndex) != ignoreList->end())
+            {
+                channel.m_bitRate = s_rawBitRate;
+                ++it;
+                continue;
+            }
+
+            // Turn channels that don't change more than the error limit into static values.
+            const AZ::Vector4& firstValue = channel.m_values.front();
+            const bool isConstant = AZStd::all_of(channel.m_values.begin(), channel.m_values.end(),
+                [&channel, &firstValue, maxError](const AZ::Vector4& value)
+                {
+                    return CalcError(channel.m_type, firstValue, value) <= maxError;
+                });
+            if (isConstant)
+            {
+                switch (channel.m_type)
+                {
+                case CHANNEL_POSITION:
+                    m_staticJointData[channel.m_dataIndex].m_staticTransform.m_position = firstValue.GetAsVector3();
+                    break;
+                case CHANNEL_ROTATION:
+                    m_staticJointData[channel.m_dataIndex].m_staticTransform.m_rotation = AZ::Quaternion(firstValue.GetSimdValue()).GetNormalized();
+                    break;
+                case CHANNEL_SCALE:
+                    EMFX_SCALECODE
+                    (
+                        m_staticJointData[channel.m_dataIndex].m_staticTransform.m_scale = firstValue.GetAsVector3();
+                    )
+                    break;
+                case CHANNEL_MORPH:
+                    m_staticMorphData[channel.m_dataIndex].m_staticValue = firstValue.GetX();
+                    break;
+                case CHANNEL_FLOAT:
+                    m_staticFloatData[channel.m_dataIndex].m_staticValue = firstValue.GetX();
+                    break;
+                }
+
+                it = channels.erase(it);
+                continue;
+            }
+
+            // Pick the smallest bit rate that stays within the error limit.
+            channel.m_bitRate = s_rawBitRate;
+            for (const AZ::u8 bitRate : s_bitRates)
+            {
+                if (CalcMaxError(channel, bitRate) <= maxError)
+                {
+                    channel.m_bitRate = bitRate;
+                    break;
+                }
+            }
+
+            ++it;
+        }
+
+        Build(channels);
+    }
+
+    void CompressedMotionData::CalcQuantizationRange(const ChannelSamples& channel, AZ::u8 bitRate, AZ::Vector4& outMin, AZ::Vector4& outScale)
+    {
+        if (bitRate == s_rawBitRate || channel.m_values.empty())
+        {
+            outMin = AZ::Vector4::CreateZero();
+            outScale = AZ::Vector4::CreateOne();
+            return;
+        }
+
+        AZ::Vector4 minValue = channel.m_values.front();
+        AZ::Vector4 maxValue = channel.m_values.front();
+        for (const AZ::Vector4& value : channel.m_values)
+        {
+            minValue = minValue.GetMin(value);
+            maxValue = maxValue.GetMax(value);
+        }
+
+        outMin = minValue;
+        outScale = (maxValue - minValue) / static_cast<float>((1u << bitRate) - 1);
+    }
+
+    float CompressedMotionData::CalcError(ChannelType type, const AZ::Vector4& value, const AZ::Vector4& reference)
+    {
+        switch (type)
+        {
+        case CHANNEL_ROTATION:
+            {
+                // The angle between both rotations, in degrees.
+                const AZ::Quaternion rotation = AZ::Quaternion(value.GetSimdValue()).GetNormalized();
+                const AZ::Quaternion referenceRotation = AZ::Quaternion(reference.GetSimdValue()).GetNormalized();
+                const float dot = AZ::GetClamp(AZ::GetAbs(rotation.Dot(referenceRotation)), 0.0f, 1.0f);
+                return AZ::RadToDeg(2.0f * AZ::Acos(dot));
+            }
+
+        case CHANNEL_MORPH:
+        case CHANNEL_FLOAT:
+            return AZ::GetAbs(value.GetX() - reference.GetX());
+
+        default:
+            return (value - reference).GetLength();
+        }
+    }
+
+    float CompressedMotionData::CalcMaxError(const ChannelSamples& channel, AZ::u8 bitRate)
+    {
+        AZ::Vector4 min;
+        AZ::Vector4 scale;
+        CalcQuantizationRange(channel, bitRate, min, scale);
+
+        float maxError = 0.0f;
+        for (const AZ::Vector4& value : channel.m_values)
+        {
+            AZ::Vector4 decoded = AZ::Vector4::CreateZero();
+            for (int c = 0; c < channel.m_numComponents; ++c)
+            {
+                const AZ::u32 bits = Quantize(value.GetElement(c), min.GetElement(c), scale.GetElement(c), bitRate);
+                decoded.SetElement(c, Dequantize(bits, min.GetElement(c), scale.GetElement(c), bitRate));
+            }
+
+            maxError = AZ::GetMax(maxError, CalcError(channel.m_type, decoded, value));
+        }
+
+        return maxError;
+    }
+
+    AZ::u32& CompressedMotionData::GetChannelIndex(ChannelType type, size_t dataIndex)
+    {
+        switch (type)
+        {
+        case CHANNEL_POSITION:
+            return m_jointChannels[dataIndex].m_position;
+        case CHANNEL_ROTATION:
+            return m_jointChannels[dataIndex].m_rotation;
+        case CHANNEL_SCALE:
+            return m_jointChannels[dataIndex].m_scale;
+        case CHANNEL_MORPH:
+            return m_morphChannels[dataIndex];
+        default:
+            return m_floatChannels[dataIndex];
+        }
+    }
+
+    void CompressedMotionData::Build(const AZStd::vector<ChannelSamples>& channels)
+    {
+        AZStd::fill(m_jointChannels.begin(), m_jointChannels.end(), JointChannels());
+        AZStd::fill(m_morphChannels.begin(), m_morphChannels.end(), InvalidIndex32);
+        AZStd::fill(m_floatChannels.begin(), m_floatChannels.end(), InvalidIndex32);
+
+        // Lay out the channels inside a frame, in the order they are given.
+        m_channels.clear();
+        m_channels.reserve(channels.size());
+        m_numBitsPerFrame = 0;
+        for (const ChannelSamples& samples : channels)
+        {
+            AZ_Assert(samples.m_values.size() == m_numSamples, "Expected %zu samples in the channel, while there are %zu.", m_numSamples, samples.m_values.size());
+
+            Channel& channel = m_channels.emplace_back();
+            channel.m_dataIndex = samples.m_dataIndex;
+            channel.m_type = samples.m_type;
+            channel.m_numComponents = samples.m_numComponents;
+            channel.m_bitRate = samples.m_bitRate;
+            channel.m_bitOffset = static_cast<AZ::u32>(m_numBitsPerFrame);
+            CalcQuantizationRange(samples, samples.m_bitRate, channel.m_min, channel.m_scale);
+
+            m_numBitsPerFrame += samples.m_numComponents * samples.m_bitRate;
+            GetChannelIndex(channel.m_type, channel.m_dataIndex) = static_cast<AZ::u32>(m_channels.size() - 1);
+        }
+
+        // Pad the bit stream, so that reading the last component never reads past the end.
+        m_bitStream.clear();
+        m_bitStream.resize(GetBitStreamSizeInBytes() + sizeof(AZ::u64), 0);
+        m_bitStream.shrink_to_fit();
+
+        for (size_t i = 0; i < m_channels.size(); ++i)
+        {
+            const Channel& channel = m_channels[i];
+            const AZStd::vector<AZ::Vector4>& values = channels[i].m_values;
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                size_t bitOffset = s * m_numBitsPerFrame + channel.m_bitOffset;
+                for (int c = 0; c < channel.m_numComponents; ++c)
+                {
+                    WriteBits(bitOffset, channel.m_bitRate, Quantize(values[s].GetElement(c), channel.m_min.GetElement(c), channel.m_scale.GetElement(c), channel.m_bitRate));
+                    bitOffset += channel.m_bitRate;
+                }
+            }
+        }
+    }
+
+    CompressedMotionData::ChannelSamples CompressedMotionData::DecompressChannel(const Channel& channel) const
+    {
+        ChannelSamples samples;
+        samples.m_dataIndex = channel.m_dataIndex;
+        samples.m_type = channel.m_type;
+        samples.m_numComponents = channel.m_numComponents;
+        samples.m_bitRate = channel.m_bitRate;
+        samples.m_values.resize(m_numSamples);
+        for (size_t s = 0; s < m_numSamples; ++s)
+        {
+            samples.m_values[s] = DecodeChannel(channel, s);
+        }
+        return samples;
+    }
+
+    AZStd::vector<CompressedMotionData::ChannelSamples> CompressedMotionData::DecompressChannels() const
+    {
+        AZStd::vector<ChannelSamples> channels;
+        channels.reserve(m_channels.size());
+        for (const Channel& channel : m_channels)
+        {
+            channels.emplace_back(DecompressChannel(channel));
+        }
+        return channels;
+    }
+
+    void CompressedMotionData::RemoveChannels(const AZStd::function<bool(const Channel&)>& predicate)
+    {
+        if (AZStd::none_of(m_channels.begin(), m_channels.end(), predicate))
+        {
+            return;
+        }
+
+        AZStd::vector<ChannelSamples> channels;
+        for (const Channel& channel : m_channels)
+        {
+            if (!predicate(channel))
+            {
+                channels.emplace_back(DecompressChannel(channel));
+            }
+        }
+        Build(channels);
+    }
+
+    AZ::u32 CompressedMotionData::ReadBits(size_t bitOffset, AZ::u8 numBits) const
+    {
+        // The components are packed with their least significant bit first, in little endian byte order.
+        AZ::u64 word;
+        memcpy(&word, m_bitStream.data() + (bitOffset >> 3), sizeof(AZ::u64));
+        return static_cast<AZ::u32>((word >> (bitOffset & 7)) & ((static_cast<AZ::u64>(1) << numBits) - 1));
+    }
+
+    void CompressedMotionData::WriteBits(size_t bitOffset, [[maybe_unused]] AZ::u8 numBits, AZ::u32 value)
+    {
+        AZ_Assert(numBits == 32 || value < (1u << numBits), "The value %u doesn't fit in %d bits.", value, numBits);
+        AZ::u64 word;
+        memcpy(&word, m_bitStream.data() + (bitOffset >> 3), sizeof(AZ::u64));
+        word |= static_cast<AZ::u64>(value) << (bitOffset & 7);
+        memcpy(m_bitStream.data() + (bitOffset >> 3), &word, sizeof(AZ::u64));
+    }
+
+    AZ::Vector4 CompressedMotionData::DecodeChannel(const Channel& channel, size_t sampleIndex) const
+    {
+        float quantized[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        size_t bitOffset = sampleIndex * m_numBitsPerFrame + channel.m_bitOffset;
+        if (channel.m_bitRate == s_rawBitRate)
+        {
+            for (AZ::u8 c = 0; c < channel.m_numComponents; ++c)
+            {
+                const AZ::u32 bits = ReadBits(bitOffset, channel.m_bitRate);
+                memcpy(&quantized[c], &bits, sizeof(float));
+                bitOffset += channel.m_bitRate;
+            }
+        }
+        else
+        {
+            for (AZ::u8 c = 0; c < channel.m_numComponents; ++c)
+            {
+                quantized[c] = static_cast<float>(ReadBits(bitOffset, channel.m_bitRate));
+                bitOffset += channel.m_bitRate;
+            }
+        }
+
+        // Dequantize all components at once.
+        return AZ::Vector4::CreateFromFloat4(quantized) * channel.m_scale + channel.m_min;
+    }
+
+    AZ::Vector4 CompressedMotionData::SampleChannel(AZ::u32 channelIndex, size_t indexA, size_t indexB, float t) const
+    {
+        const Channel& channel = m_channels[channelIndex];
+        return DecodeChannel(channel, indexA).Lerp(DecodeChannel(channel, indexB), t);
+    }
+
+    Transform CompressedMotionData::SampleJoint(size_t jointDataIndex, size_t indexA, size_t indexB, float t) const
+    {
+        const JointChannels& jointChannels = m_jointChannels[jointDataIndex];
+        Transform result = m_staticJointData[jointDataIndex].m_staticTransform;
+        if (jointChannels.m_position != InvalidIndex32)
+        {
+            result.m_position = SampleChannel(jointChannels.m_position, indexA, indexB, t).GetAsVector3();
+        }
+
+        // The rotations are stored in the same hemisphere as the previous sample, so a normalized lerp doesn't need to flip them.
+        if (jointChannels.m_rotation != InvalidIndex32)
+        {
+            result.m_rotation = AZ::Quaternion(SampleChannel(jointChannels.m_rotation, indexA, indexB, t).GetSimdValue()).GetNormalized();
+        }
+
+#ifndef EMFX_SCALE_DISABLED
+        if (jointChannels.m_scale != InvalidIndex32)
+        {
+            result.m_scale = SampleChannel(jointChannels.m_scale, indexA, indexB, t).GetAsVector3();
+        }
+#endif
+
+        return result;
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const
+    {
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        const size_t jointDataIndex = motionLinkData->GetJointDataLinks()[jointSkeletonIndex];
+        if (m_additive && jointDataIndex == InvalidIndex)
+        {
+            return Transform::CreateIdentity();
+        }
+
+        // Calculate the sample indices to interpolate between, and the interpolation fraction.
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(settings.m_sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const bool inPlace = (settings.m_inPlace && jointSkeletonIndex == actor->GetMotionExtractionNodeIndex());
+
+        // Sample the interpolated data.
+        Transform result;
+        if (jointDataIndex != InvalidIndex && !inPlace)
+        {
+            result = SampleJoint(jointDataIndex, indexA, indexB, t);
+        }
+        else
+        {
+            if (settings.m_inputPose && !inPlace)
+            {
+                result = settings.m_inputPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+            else
+            {
+                result = settings.m_actorInstance->GetTransformData()->GetBindPose()->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+        }
+
+        // Apply retargeting.
+        if (settings.m_retarget)
+        {
+            BasicRetarget(settings.m_actorInstance, motionLinkData, jointSkeletonIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            const Pose* bindPose = settings.m_actorInstance->GetTransformData()->GetBindPose();
+            const Actor::NodeMirrorInfo& mirrorInfo = actor->GetNodeMirrorInfo(jointSkeletonIndex);
+            Transform mirrored = bindPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            AZ::Vector3 mirrorAxis = AZ::Vector3::CreateZero();
+            mirrorAxis.SetElement(mirrorInfo.m_axis, 1.0f);
+            const AZ::u16 motionSource = actor->GetNodeMirrorInfo(jointSkeletonIndex).m_sourceNode;
+            mirrored.ApplyDeltaMirrored(bindPose->GetLocalSpaceTransform(motionSource), result, mirrorAxis, mirrorInfo.m_flags);
+            result = mirrored;
+        }
+
+        return result;
+    }
+
+    void CompressedMotionData::SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const
+    {
+        AZ_Assert(settings.m_actorInstance, "Expecting a valid actor instance.");
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        // Calculate the sample indices to interpolate between, and the interpolation fraction.
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(settings.m_sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const AZStd::vector<size_t>& jointLinks = motionLinkData->GetJointDataLinks();
+        const ActorInstance* actorInstance = settings.m_actorInstance;
+        const Pose* bindPose = actorInstance->GetTransformData()->GetBindPose();
+        const size_t numNodes = actorInstance->GetNumEnabledNodes();
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            const size_t skeletonJointIndex = actorInstance->GetEnabledNode(i);
+            const bool inPlace = (settings.m_inPlace && skeletonJointIndex == actor->GetMotionExtractionNodeIndex());
+
+            // Sample the interpolated data.
+            Transform result;
+            const size_t jointDataIndex = jointLinks[skeletonJointIndex];
+            if (jointDataIndex != InvalidIndex && !inPlace)
+            {
+                result = SampleJoint(jointDataIndex, indexA, indexB, t);
+            }
+            else
+            {
+                if (m_additive && jointDataIndex == InvalidIndex)
+                {
+                    result = Transform::CreateIdentity();
+                }
+                else
+                {
+                    if (settings.m_inputPose && !inPlace)
+                    {
+                        result = settings.m_inputPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                    else
+                    {
+                        result = bindPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                }
+            }
+
+            // Apply retargeting.
+            if (settings.m_retarget)
+            {
+                BasicRetarget(settings.m_actorInstance, motionLinkData, skeletonJointIndex, result);
+            }
+
+            outputPose->SetLocalSpaceTransformDirect(skeletonJointIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            outputPose->Mirror(motionLinkData);
+        }
+
+        // Output morph target weights.
+        const MorphSetupInstance* morphSetup = actorInstance->GetMorphSetupInstance();
+        const size_t numMorphTargets = morphSetup->GetNumMorphTargets();
+        for (size_t i = 0; i < numMorphTargets; ++i)
+        {
+            const AZ::u32 morphTargetId = morphSetup->GetMorphTarget(i)->GetID();
+            const AZ::Outcome<size_t> morphIndex = FindMorphIndexByNameId(morphTargetId);
+            if (morphIndex.IsSuccess())
+            {
+                const size_t realIndex = morphIndex.GetValue();
+                const AZ::u32 channelIndex = m_morphChannels[realIndex];
+                if (channelIndex != InvalidIndex32)
+                {
+                    outputPose->SetMorphWeight(i, SampleChannel(channelIndex, indexA, indexB, t).GetX());
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, m_staticMorphData[realIndex].m_staticValue);
+                }
+            }
+            else
+            {
+                if (settings.m_inputPose)
+                {
+                    outputPose->SetMorphWeight(i, settings.m_inputPose->GetMorphWeight(i));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, bindPose->GetMorphWeight(i));
+                }
+            }
+        }
+
+        // Since we used the SetLocalTransformDirect, make sure we manually invalidate all model space transforms.
+        outputPose->InvalidateAllModelSpaceTransforms();
+    }
+
+    float CompressedMotionData::SampleMorph(float sampleTime, size_t morphDataIndex) const
+    {
+        const AZ::u32 channelIndex = m_morphChannels[morphDataIndex];
+        if (channelIndex == InvalidIndex32)
+        {
+            return m_staticMorphData[morphDataIndex].m_staticValue;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return SampleChannel(channelIndex, indexA, indexB, t).GetX();
+    }
+
+    float CompressedMotionData::SampleFloat(float sampleTime, size_t floatDataIndex) const
+    {
+        const AZ::u32 channelIndex = m_floatChannels[floatDataIndex];
+        if (channelIndex == InvalidIndex32)
+        {
+            return m_staticFloatData[floatDataIndex].m_staticValue;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return SampleChannel(channelIndex, indexA, indexB, t).GetX();
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(float sampleTime, size_t jointDataIndex) const
+    {
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return SampleJoint(jointDataIndex, indexA, indexB, t);
+    }
+
+    AZ::Vector3 CompressedMotionData::SampleJointPosition(float sampleTime, size_t jointDataIndex) const
+    {
+        const AZ::u32 channelIndex = m_jointChannels[jointDataIndex].m_position;
+        if (channelIndex == InvalidIndex32)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.m_position;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return SampleChannel(channelIndex, indexA, indexB, t).GetAsVector3();
+    }
+
+    AZ::Quaternion CompressedMotionData::SampleJointRotation(float sampleTime, size_t jointDataIndex) const
+    {
+        const AZ::u32 channelIndex = m_jointChannels[jointDataIndex].m_rotation;
+        if (channelIndex == InvalidIndex32)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.m_rotation;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return AZ::Quaternion(SampleChannel(channelIndex, indexA, indexB, t).GetSimdValue()).GetNormalized();
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    AZ::Vector3 CompressedMotionData::SampleJointScale(float sampleTime, size_t jointDataIndex) const
+    {
+        const AZ::u32 channelIndex = m_jointChannels[jointDataIndex].m_scale;
+        if (channelIndex == InvalidIndex32)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.m_scale;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return SampleChannel(channelIndex, indexA, indexB, t).GetAsVector3();
+    }
+
+    void CompressedMotionData::ClearJointScaleSamples(size_t jointDataIndex)
+    {
+        RemoveChannels([jointDataIndex](const Channel& channel)
+        {
+            return channel.m_type == CHANNEL_SCALE && channel.m_dataIndex == jointDataIndex;
+        });
+    }
+
+    bool CompressedMotionData::IsJointScaleAnimated(size_t jointDataIndex) const
+    {
+        return m_jointChannels[jointDataIndex].m_scale != InvalidIndex32;
+    }
+#endif
+
+    void CompressedMotionData::ClearAllJointTransformSamples()
+    {
+        RemoveChannels([](const Channel& channel)
+        {
+            return channel.m_type <= CHANNEL_SCALE;
+        });
+    }
+
+    void CompressedMotionData::ClearAllMorphSamples()
+    {
+        RemoveChannels([](const Channel& channel)
+        {
+            return channel.m_type == CHANNEL_MORPH;
+        });
+    }
+
+    void CompressedMotionData::ClearAllFloatSamples()
+    {
+        RemoveChannels([](const Channel& channel)
+        {
+            return channel.m_type == CHANNEL_FLOAT;
+        });
+    }
+
+    void CompressedMotionData::ClearJointPositionSamples(size_t jointDataIndex)
+    {
+        RemoveChannels([jointDataIndex](const Channel& channel)
+        {
+            return channel.m_type == CHANNEL_POSITION && channel.m_dataIndex == jointDataIndex;
+        });
+    }
+
+    void CompressedMotionData::ClearJointRotationSamples(size_t jointDataIndex)
+    {
+        RemoveChannels([jointDataIndex](const Channel& channel)
+        {
+            return channel.m_type == CHANNEL_ROTATION && channel.m_dataIndex == jointDataIndex;
+        });
+    }
+
+    void CompressedMotionData::ClearJointTransformSamples(size_t jointDataIndex)
+    {
+        RemoveChannels([jointDataIndex](const Channel& channel)
+        {
+            return channel.m_type <= CHANNEL_SCALE && channel.m_dataIndex == jointDataIndex;
+        });
+    }
+
+    void CompressedMotionData::ClearMorphSamples(size_t morphDataIndex)
+    {
+        RemoveChannels([morphDataIndex](const Channel& channel)
+        {
+            return channel.m_type == CHANNEL_MORPH && channel.m_dataIndex == morphDataIndex;
+        });
+    }
+
+    void CompressedMotionData::ClearFloatSamples(size_t floatDataIndex)
+    {
+        RemoveChannels([floatDataIndex](const Channel& channel)
+        {
+            return channel.m_type == CHANNEL_FLOAT && channel.m_dataIndex == floatDataIndex;
+        });
+    }
+
+    bool CompressedMotionData::IsJointPositionAnimated(size_t jointDataIndex) const
+    {
+        return m_jointChannels[jointDataIndex].m_position != InvalidIndex32;
+    }
+
+    bool CompressedMotionData::IsJointRotationAnimated(size_t jointDataIndex) const
+    {
+        return m_jointChannels[jointDataIndex].m_rotation != InvalidIndex32;
+    }
+
+    bool CompressedMotionData::IsJointAnimated(size_t jointDataIndex) const
+    {
+        const JointChannels& jointChannels = m_jointChannels[jointDataIndex];
+        return (jointChannels.m_position != InvalidIndex32 || jointChannels.m_rotation != InvalidIndex32 || jointChannels.m_scale != InvalidIndex32);
+    }
+
+    bool CompressedMotionData::IsMorphAnimated(size_t morphDataIndex) const
+    {
+        return m_morphChannels[morphDataIndex] != InvalidIndex32;
+    }
+
+    bool CompressedMotionData::IsFloatAnimated(size_t floatDataIndex) const
+    {
+        return m_floatChannels[floatDataIndex] != InvalidIndex32;
+    }
+
+    size_t CompressedMotionData::GetNumSamples() const
+    {
+        return m_numSamples;
+    }
+
+    float CompressedMotionData::GetSampleSpacing() const
+    {
+        return m_sampleSpacing;
+    }
+
+    size_t CompressedMotionData::GetNumChannels() const
+    {
+        return m_channels.size();
+    }
+
+    size_t CompressedMotionData::GetNumBitsPerFrame() const
+    {
+        return m_numBitsPerFrame;
+    }
+
+    size_t CompressedMotionData::GetBitStreamSizeInBytes() const
+    {
+        return (m_numBitsPerFrame * m_numSamples + 7) / 8;
+    }
+
+    void CompressedMotionData::UpdateSampleSpacing()
+    {
+        if (m_sampleRate > AZ::Constants::FloatEpsilon)
+        {
+            m_sampleSpacing = 1.0f / m_sampleRate;
+        }
+        else
+        {
+            m_sampleSpacing = 0.0f;
+        }
+    }
+
+    void CompressedMotionData::SetSampleRate(float sampleRate)
+    {
+        MotionData::SetSampleRate(sampleRate);
+        UpdateSampleSpacing();
+    }
+
+    void CompressedMotionData::UpdateDuration()
+    {
+        m_duration = (m_numSamples > 0) ? (m_numSamples - 1) * m_sampleSpacing : 0.0f;
+    }
+
+    void CompressedMotionData::ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats)
+    {
+        RemoveChannels([numJoints, numMorphs, numFloats](const Channel& channel)
+        {
+            switch (channel.m_type)
+            {
+            case CHANNEL_MORPH:
+                return channel.m_dataIndex >= numMorphs;
+            case CHANNEL_FLOAT:
+                return channel.m_dataIndex >= numFloats;
+            default:
+                return channel.m_dataIndex >= numJoints;
+            }
+        });
+
+        m_jointChannels.resize(numJoints);
+        m_morphChannels.resize(numMorphs, InvalidIndex32);
+        m_floatChannels.resize(numFloats, InvalidIndex32);
+    }
+
+    void CompressedMotionData::AddJointSampleData([[maybe_unused]] size_t jointDataIndex)
+    {
+        AZ_Assert(jointDataIndex == m_jointChannels.size(), "Expected the size of the joint channels vector to be a different size. Is it in sync with the m_staticJointData vector?");
+        m_jointChannels.emplace_back();
+    }
+
+    void CompressedMotionData::AddMorphSampleData([[maybe_unused]] size_t morphDataIndex)
+    {
+        AZ_Assert(morphDataIndex == m_morphChannels.size(), "Expected the size of the morph channels vector to be a different size. Is it in sync with the m_staticMorphData vector?");
+        m_morphChannels.emplace_back(InvalidIndex32);
+    }
+
+    void CompressedMotionData::AddFloatSampleData([[maybe_unused]] size_t floatDataIndex)
+    {
+        AZ_Assert(floatDataIndex == m_floatChannels.size(), "Expected the size of the float channels vector to be a different size. Is it in sync with the m_staticFloatData vector?");
+        m_floatChannels.emplace_back(InvalidIndex32);
+    }
+
+    void CompressedMotionData::RemoveJointSampleData(size_t jointDataIndex)
+    {
+        ClearJointTransformSamples(jointDataIndex);
+        for (Channel& channel : m_channels)
+        {
+            if (channel.m_type <= CHANNEL_SCALE && channel.m_dataIndex > jointDataIndex)
+            {
+                channel.m_dataIndex--;
+            }
+        }
+        m_jointChannels.erase(m_jointChannels.begin() + jointDataIndex);
+    }
+
+    void CompressedMotionData::RemoveMorphSampleData(size_t morphDataIndex)
+    {
+        ClearMorphSamples(morphDataIndex);
+        for (Channel& channel : m_channels)
+        {
+            if (channel.m_type == CHANNEL_MORPH && channel.m_dataIndex > morphDataIndex)
+            {
+                channel.m_dataIndex--;
+            }
+        }
+        m_morphChannels.erase(m_morphChannels.begin() + morphDataIndex);
+    }
+
+    void CompressedMotionData::RemoveFloatSampleData(size_t floatDataIndex)
+    {
+        ClearFloatSamples(floatDataIndex);
+        for (Channel& channel : m_channels)
+        {
+            if (channel.m_type == CHANNEL_FLOAT && channel.m_dataIndex > floatDataIndex)
+            {
+                channel.m_dataIndex--;
+            }
+        }
+        m_floatChannels.erase(m_floatChannels.begin() + floatDataIndex);
+    }
+
+    void CompressedMotionData::ClearAllData()
+    {
+        m_channels.clear();
+        m_channels.shrink_to_fit();
+        m_jointChannels.clear();
+        m_jointChannels.shrink_to_fit();
+        m_morphChannels.clear();
+        m_morphChannels.shrink_to_fit();
+        m_floatChannels.clear();
+        m_floatChannels.shrink_to_fit();
+        m_bitStream.clear();
+        m_bitStream.shrink_to_fit();
+
+        m_numBitsPerFrame = 0;
+        m_numSamples = 0;
+    }
+
+    void CompressedMotionData::ScaleData(float scaleFactor)
+    {
+        // Scaling the dequantization range scales the positions, without touching the bit stream.
+        for (Channel& channel : m_channels)
+        {
+            if (channel.m_type == CHANNEL_POSITION)
+            {
+                channel.m_min *= scaleFactor;
+                channel.m_scale *= scaleFactor;
+            }
+        }
+    }
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SERIALIZATION
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct File_CompressedMotionData_Info
+    {
+        AZ::u32 m_numJoints = 0;
+        AZ::u32 m_numMorphs = 0;
+        AZ::u32 m_numFloats = 0;
+        AZ::u32 m_numSamples = 0;
+        AZ::u32 m_numChannels = 0;
+        float m_sampleRate = 30.0f;
+
+        // Followed by:
+        // File_CompressedMotionData_Joint[m_numJoints]
+        // File_CompressedMotionData_Float[m_numMorphs]
+        // File_CompressedMotionData_Float[m_numFloats]
+        // File_CompressedMotionData_Channel[m_numChannels]
+        // AZ::u8[(m_numSamples * bits per frame + 7) / 8] : The bit stream, where the bits per frame is the sum of the number of components times the bit rate of all channels.
+    };
+
+    struct File_CompressedMotionData_Joint
+    {
+        FileFormat::File16BitQuaternion m_staticRot { 0, 0, 0, (1 << 15) - 1 };  // First frames rotation.
+        FileFormat::File16BitQuaternion m_bindPoseRot { 0, 0, 0, (1 << 15) - 1 };// Bind pose rotation.
+        FileFormat::FileVector3         m_staticPos { 0.0f, 0.0f, 0.0f };        // First frame position.
+        FileFormat::FileVector3         m_staticScale { 1.0f, 1.0f, 1.0f };      // First frame scale.
+        FileFormat::FileVector3         m_bindPosePos { 0.0f, 0.0f, 0.0f };      // Bind pose position.
+        FileFormat::FileVector3         m_bindPoseScale { 1.0f, 1.0f, 1.0f };    // Bind pose scale.
+
+        // Followed by:
+        // string : The name of the joint.
+    };
+
+    struct File_CompressedMotionData_Float
+    {
+        float m_staticValue = 0.0f; // The static (first frame) value.
+
+        // Followed by:
+        // String: The name of the channel.
+    };
+
+    struct File_CompressedMotionData_Channel
+    {
+        float m_min[4] = { 0.0f, 0.0f, 0.0f, 0.0f };   // The dequantization offset of each component.
+        float m_scale[4] = { 1.0f, 1.0f, 1.0f, 1.0f }; // The dequantization scale of each component.
+        AZ::u32 m_dataIndex = 0;    // The joint, morph or float data index.
+        AZ::u8 m_type = 0;          // 0=position, 1=rotation, 2=scale, 3=morph, 4=float.
+        AZ::u8 m_numComponents = 0;
+        AZ::u8 m_bitRate = 0;       // The number of bits per component, where 32 means uncompressed floats.
+    };
+    //---------------------------------------------------------------------------------------
+
+    size_t CompressedMotionData::CalcStreamSaveSizeInBytes([[maybe_unused]] const SaveSettings& saveSettings) const
+    {
+        size_t numBytes = sizeof(File_CompressedMotionData_Info);
+
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Joint);
+            numBytes += ExporterLib::GetStringChunkSize(GetJointName(i));
+        }
+
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetMorphName(i));
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetFloatName(i));
+        }
+
+        numBytes += m_channels.size() * sizeof(File_CompressedMotionData_Channel);
+        numBytes += GetBitStreamSizeInBytes();
+        return numBytes;
+    }
+
+    AZ::u32 CompressedMotionData::GetStreamSaveVersion() const
+    {
+        return 1;
+    }
+
+    bool CompressedMotionData::Save(MCore::Stream* stream, const SaveSettings& saveSettings) const
+    {
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+
+        // Write the info chunk.
+        File_CompressedMotionData_Info info;
+        info.m_numJoints = static_cast<AZ::u32>(GetNumJoints());
+        info.m_numMorphs = static_cast<AZ::u32>(GetNumMorphs());
+        info.m_numFloats = static_cast<AZ::u32>(GetNumFloats());
+        info.m_numSamples = static_cast<AZ::u32>(GetNumSamples());
+        info.m_numChannels = static_cast<AZ::u32>(GetNumChannels());
+        info.m_sampleRate = GetSampleRate();
+        ExporterLib::ConvertUnsignedInt(&info.m_numJoints, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numMorphs, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numFloats, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numSamples, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numChannels, targetEndianType);
+        ExporterLib::ConvertFloat(&info.m_sampleRate, targetEndianType);
+        if (stream->Write(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+
+        // Write the static joint data.
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            File_CompressedMotionData_Joint jointChunk;
+            ExporterLib::CopyVector(jointChunk.m_staticPos, AZ::PackedVector3f(GetJointStaticPosition(i)));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_staticRot, GetJointStaticRotation(i));
+            ExporterLib::CopyVector(jointChunk.m_bindPosePos, AZ::PackedVector3f(GetJointBindPosePosition(i)));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_bindPoseRot, GetJointBindPoseRotation(i));
+            EMFX_SCALECODE
+            (
+                ExporterLib::CopyVector(jointChunk.m_staticScale, AZ::PackedVector3f(GetJointStaticScale(i)));
+                ExporterLib::CopyVector(jointChunk.m_bindPoseScale, AZ::PackedVector3f(GetJointBindPoseScale(i)));
+            )
+
+            if (saveSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("- Motion Joint: %s", GetJointName(i).c_str());
+                MCore::LogDetailedInfo("   + Position Animated:     %s", IsJointPositionAnimated(i) ? "Yes" : "No");
+                MCore::LogDetailedInfo("   + Rotation Animated:     %s", IsJointRotationAnimated(i) ? "Yes" : "No");
+            }
+
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticPos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_staticRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticScale, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPosePos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_bindPoseRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPoseScale, targetEndianType);
+            if (stream->Write(&jointChunk, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(GetJointName(i), stream, targetEndianType);
+        }
+
+        // Write the static morph and float data.
+        const auto saveFloat = [stream, targetEndianType](const AZStd::string& name, float staticValue)
+        {
+            File_CompressedMotionData_Float floatChunk;
+            floatChunk.m_staticValue = staticValue;
+            ExporterLib::ConvertFloat(&floatChunk.m_staticValue, targetEndianType);
+            if (stream->Write(&floatChunk, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(name, stream, targetEndianType);
+            return true;
+        };
+
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            if (!saveFloat(GetMorphName(i), GetMorphStaticValue(i)))
+            {
+                return false;
+            }
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            if (!saveFloat(GetFloatName(i), GetFloatStaticValue(i)))
+            {
+                return false;
+            }
+        }
+
+        // Write the channels.
+        for (const Channel& channel : m_channels)
+        {
+            File_CompressedMotionData_Channel channelChunk;
+            channel.m_min.StoreToFloat4(channelChunk.m_min);
+            channel.m_scale.StoreToFloat4(channelChunk.m_scale);
+            channelChunk.m_dataIndex = channel.m_dataIndex;
+            channelChunk.m_type = static_cast<AZ::u8>(channel.m_type);
+            channelChunk.m_numComponents = channel.m_numComponents;
+            channelChunk.m_bitRate = channel.m_bitRate;
+
+            if (saveSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("- Channel: type=%d index=%d bitRate=%d", channelChunk.m_type, channelChunk.m_dataIndex, channelChunk.m_bitRate);
+            }
+
+            for (int c = 0; c < 4; ++c)
+            {
+                ExporterLib::ConvertFloat(&channelChunk.m_min[c], targetEndianType);
+                ExporterLib::ConvertFloat(&channelChunk.m_scale[c], targetEndianType);
+            }
+            ExporterLib::ConvertUnsignedInt(&channelChunk.m_dataIndex, targetEndianType);
+            if (stream->Write(&channelChunk, sizeof(File_CompressedMotionData_Channel)) == 0)
+            {
+                return false;
+            }
+        }
+
+        // Write the bit stream, which is already stored per byte.
+        const size_t numBitStreamBytes = GetBitStreamSizeInBytes();
+        if (numBitStreamBytes > 0 && stream->Write(m_bitStream.data(), numBitStreamBytes) == 0)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::Read(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        if (readSettings.m_version != 1)
+        {
+            AZ_Error("EMotionFX", false, "Unsupported CompressedMotionData version (version=%d), cannot load motion data.", readSettings.m_version);
+            return false;
+        }
+
+        // Read the info header.
+        File_CompressedMotionData_Info info;
+        if (stream->Read(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+        const MCore::Endian::EEndianType sourceEndianType = readSettings.m_sourceEndianType;
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numJoints, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numMorphs, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numFloats, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numSamples, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numChannels, sourceEndianType);
+        MCore::Endian::ConvertFloat(&info.m_sampleRate, sourceEndianType);
+
+        if (readSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- CompressedMotionData:");
+            MCore::LogDetailedInfo("  + NumJoints   = %d", info.m_numJoints);
+            MCore::LogDetailedInfo("  + NumMorphs   = %d", info.m_numMorphs);
+            MCore::LogDetailedInfo("  + NumFloats   = %d", info.m_numFloats);
+            MCore::LogDetailedInfo("  + NumChannels = %d", info.m_numChannels);
+            MCore::LogDetailedInfo("  + SampleRate  = %f", info.m_sampleRate);
+        }
+
+        Clear();
+        Resize(info.m_numJoints, info.m_numMorphs, info.m_numFloats);
+        m_numSamples = info.m_numSamples;
+        SetSampleRate(info.m_sampleRate);
+        UpdateDuration();
+
+        // Read the static joint data.
+        for (size_t i = 0; i < info.m_numJoints; ++i)
+        {
+            File_CompressedMotionData_Joint jointInfo;
+            if (stream->Read(&jointInfo, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+
+            AZ::Vector3 staticPos(jointInfo.m_staticPos.m_x, jointInfo.m_staticPos.m_y, jointInfo.m_staticPos.m_z);
+            AZ::Vector3 staticScale(jointInfo.m_staticScale.m_x, jointInfo.m_staticScale.m_y, jointInfo.m_staticScale.m_z);
+            MCore::Compressed16BitQuaternion staticRot(jointInfo.m_staticRot.m_x, jointInfo.m_staticRot.m_y, jointInfo.m_staticRot.m_z, jointInfo.m_staticRot.m_w);
+            AZ::Vector3 bindPosePos(jointInfo.m_bindPosePos.m_x, jointInfo.m_bindPosePos.m_y, jointInfo.m_bindPosePos.m_z);
+            AZ::Vector3 bindPoseScale(jointInfo.m_bindPoseScale.m_x, jointInfo.m_bindPoseScale.m_y, jointInfo.m_bindPoseScale.m_z);
+            MCore::Compressed16BitQuaternion bindPoseRot(jointInfo.m_bindPoseRot.m_x, jointInfo.m_bindPoseRot.m_y, jointInfo.m_bindPoseRot.m_z, jointInfo.m_bindPoseRot.m_w);
+            MCore::Endian::ConvertVector3(&staticPos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&staticRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&staticScale, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPosePos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&bindPoseRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPoseScale, sourceEndianType);
+
+            SetJointStaticPosition(i, staticPos);
+            SetJointStaticRotation(i, staticRot.ToQuaternion().GetNormalized());
+            SetJointBindPosePosition(i, bindPosePos);
+            SetJointBindPoseRotation(i, bindPoseRot.ToQuaternion().GetNormalized());
+            EMFX_SCALECODE
+            (
+                SetJointStaticScale(i, staticScale);
+                SetJointBindPoseScale(i, bindPoseScale);
+            )
+            SetJointName(i, MotionData::ReadStringFromStream(stream, sourceEndianType));
+        }
+
+        // Read the static morph and float data.
+        for (size_t i = 0; i < info.m_numMorphs + info.m_numFloats; ++i)
+        {
+            File_CompressedMotionData_Float floatInfo;
+            if (stream->Read(&floatInfo, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(&floatInfo.m_staticValue, sourceEndianType);
+            const AZStd::string name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+
+            if (i < info.m_numMorphs)
+            {
+                SetMorphName(i, name);
+                SetMorphStaticValue(i, floatInfo.m_staticValue);
+            }
+            else
+            {
+                SetFloatName(i - info.m_numMorphs, name);
+                SetFloatStaticValue(i - info.m_numMorphs, floatInfo.m_staticValue);
+            }
+        }
+
+        // Read the channels.
+        m_channels.reserve(info.m_numChannels);
+        for (size_t i = 0; i < info.m_numChannels; ++i)
+        {
+            File_CompressedMotionData_Channel channelInfo;
+            if (stream->Read(&channelInfo, sizeof(File_CompressedMotionData_Channel)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(channelInfo.m_min, sourceEndianType, 4);
+            MCore::Endian::ConvertFloat(channelInfo.m_scale, sourceEndianType, 4);
+            MCore::Endian::ConvertUnsignedInt32(&channelInfo.m_dataIndex, sourceEndianType);
+
+            const size_t numDataIndices = (channelInfo.m_type == CHANNEL_MORPH) ? info.m_numMorphs : (channelInfo.m_type == CHANNEL_FLOAT) ? info.m_numFloats : info.m_numJoints;
+            if (channelInfo.m_type > CHANNEL_FLOAT || channelInfo.m_dataIndex >= numDataIndices ||
+                channelInfo.m_numComponents == 0 || channelInfo.m_numComponents > 4 ||
+                channelInfo.m_bitRate == 0 || channelInfo.m_bitRate > s_rawBitRate)
+            {
+                AZ_Error("EMotionFX", false, "Invalid channel %zu in the compressed motion data.", i);
+                return false;
+            }
+
+            Channel& channel = m_channels.emplace_back();
+            channel.m_min = AZ::Vector4::CreateFromFloat4(channelInfo.m_min);
+            channel.m_scale = AZ::Vector4::CreateFromFloat4(channelInfo.m_scale);
+            channel.m_dataIndex = channelInfo.m_dataIndex;
+            channel.m_type = static_cast<ChannelType>(channelInfo.m_type);
+            channel.m_numComponents = channelInfo.m_numComponents;
+            channel.m_bitRate = channelInfo.m_bitRate;
+            channel.m_bitOffset = static_cast<AZ::u32>(m_numBitsPerFrame);
+            m_numBitsPerFrame += channel.m_numComponents * channel.m_bitRate;
+            GetChannelIndex(channel.m_type, channel.m_dataIndex) = static_cast<AZ::u32>(i);
+        }
+
+        // Read the bit stream, padded like Build() does.
+        const size_t numBitStreamBytes = GetBitStreamSizeInBytes();
+        m_bitStream.resize(numBitStreamBytes + sizeof(AZ::u64), 0);
+        if (numBitStreamBytes > 0 && stream->Read(m_bitStream.data(), numBitStreamBytes) == 0)
+        {
+            return false;
+        }
+
+        return true;
+    }
+} // namespace EMotionFX
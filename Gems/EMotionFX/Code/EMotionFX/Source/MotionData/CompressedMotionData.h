@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/MotionData/MotionData.h>
+#include <EMotionFX/Source/Transform.h>
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+
+namespace EMotionFX
+{
+    class Pose;
+
+    // Uniformly sampled motion data where every animated channel (a joint position, rotation or scale, a morph or a float) is quantized
+    // to its own bit rate inside the value range of the channel. The bit rates get picked by Optimize(), as the smallest ones that keep
+    // the error of every sample within the error limits of the optimize settings, so that the motion exporter controls the quality.
+    // All channels of one sample are packed together in one bit stream, so sampling a pose reads two consecutive frames of memory.
+    class EMFX_API CompressedMotionData
+        : public MotionData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompressedMotionData, MotionAllocator)
+        AZ_RTTI(CompressedMotionData, "{3A4F8E0B-6C2D-4B9E-8F71-D25C0A9E6B13}", MotionData)
+
+        // The bit rate of channels that store the uncompressed floats, which is used until Optimize() picks the bit rates.
+        static constexpr AZ::u8 s_rawBitRate = 32;
+
+        CompressedMotionData() = default;
+        ~CompressedMotionData() override;
+
+        void InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate=true, float newSampleRate=30.0f, bool updateDuration=false) override;
+        void Optimize(const OptimizeSettings& settings) override;
+        bool Read(MCore::Stream* stream, const ReadSettings& readSettings) override;
+        bool Save(MCore::Stream* stream, const SaveSettings& saveSettings) const override;
+        size_t CalcStreamSaveSizeInBytes(const SaveSettings& saveSettings) const override;
+        AZ::u32 GetStreamSaveVersion() const override;
+        const char* GetSceneSettingsName() const override;
+
+        // Overloaded.
+        Transform SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const override;
+        void SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const override;
+        float SampleMorph(float sampleTime, size_t morphDataIndex) const override;
+        float SampleFloat(float sampleTime, size_t floatDataIndex) const override;
+        Transform SampleJointTransform(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointPosition(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Quaternion SampleJointRotation(float sampleTime, size_t jointDataIndex) const override;
+
+        void ClearAllJointTransformSamples() override;
+        void ClearAllMorphSamples() override;
+        void ClearAllFloatSamples() override;
+        void ClearJointPositionSamples(size_t jointDataIndex) override;
+        void ClearJointRotationSamples(size_t jointDataIndex) override;
+        void ClearJointTransformSamples(size_t jointDataIndex) override;
+        void ClearMorphSamples(size_t morphDataIndex) override;
+        void ClearFloatSamples(size_t floatDataIndex) override;
+
+        bool IsJointPositionAnimated(size_t jointDataIndex) const override;
+        bool IsJointRotationAnimated(size_t jointDataIndex) const override;
+        bool IsJointAnimated(size_t jointDataIndex) const override;
+        bool IsMorphAnimated(size_t morphDataIndex) const override;
+        bool IsFloatAnimated(size_t floatDataIndex) const override;
+
+#ifndef EMFX_SCALE_DISABLED
+        AZ::Vector3 SampleJointScale(float sampleTime, size_t jointDataIndex) const override;
+        void ClearJointScaleSamples(size_t jointDataIndex) override;
+        bool IsJointScaleAnimated(size_t jointDataIndex) const override;
+#endif
+
+        size_t GetNumSamples() const;
+        float GetSampleSpacing() const;
+        void SetSampleRate(float sampleRate) override;
+        void UpdateDuration() override;
+
+        // Statistics about the compression.
+        size_t GetNumChannels() const;
+        size_t GetNumBitsPerFrame() const;
+        size_t GetBitStreamSizeInBytes() const;
+
+    private:
+        enum ChannelType : AZ::u8
+        {
+            CHANNEL_POSITION = 0,
+            CHANNEL_ROTATION = 1,
+            CHANNEL_SCALE = 2,
+            CHANNEL_MORPH = 3,
+            CHANNEL_FLOAT = 4
+        };
+
+        // An animated channel inside the bit stream. Every component gets dequantized as (quantized * m_scale + m_min).
+        struct EMFX_API Channel
+        {
+            AZ::Vector4 m_min = AZ::Vector4::CreateZero();
+            AZ::Vector4 m_scale = AZ::Vector4::CreateOne();
+            AZ::u32 m_dataIndex = 0;    // The joint, morph or float data index.
+            AZ::u32 m_bitOffset = 0;    // The offset of the first component inside a frame, in bits.
+            ChannelType m_type = CHANNEL_POSITION;
+            AZ::u8 m_numComponents = 0;
+            AZ::u8 m_bitRate = s_rawBitRate; // The number of bits per component.
+        };
+
+        // The uncompressed samples of a channel, used while (re)building the bit stream.
+        struct EMFX_API ChannelSamples
+        {
+            AZStd::vector<AZ::Vector4> m_values;
+            AZ::u32 m_dataIndex = 0;
+            ChannelType m_type = CHANNEL_POSITION;
+            AZ::u8 m_numComponents = 0;
+            AZ::u8 m_bitRate = s_rawBitRate;
+        };
+
+        // The channel indices of a joint, or InvalidIndex32 when that part of the joint isn't animated.
+        struct EMFX_API JointChannels
+        {
+            AZ::u32 m_position = InvalidIndex32;
+            AZ::u32 m_rotation = InvalidIndex32;
+            AZ::u32 m_scale = InvalidIndex32;
+        };
+
+        MotionData* CreateNew() const override;
+        void ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats) override;
+        void ClearAllData() override;
+        void AddJointSampleData(size_t jointDataIndex) override;
+        void AddMorphSampleData(size_t morphDataIndex) override;
+        void AddFloatSampleData(size_t floatDataIndex) override;
+        void RemoveJointSampleData(size_t jointDataIndex) override;
+        void RemoveMorphSampleData(size_t morphDataIndex) override;
+        void RemoveFloatSampleData(size_t floatDataIndex) override;
+        void ScaleData(float scaleFactor) override;
+
+        void UpdateSampleSpacing();
+
+        AZ::Vector4 DecodeChannel(const Channel& channel, size_t sampleIndex) const;
+        AZ::Vector4 SampleChannel(AZ::u32 channelIndex, size_t indexA, size_t indexB, float t) const;
+        Transform SampleJoint(size_t jointDataIndex, size_t indexA, size_t indexB, float t) const;
+        AZ::u32 ReadBits(size_t bitOffset, AZ::u8 numBits) const;
+        void WriteBits(size_t bitOffset, AZ::u8 numBits, AZ::u32 value);
+
+        // Rebuild the bit stream and the channel lookup tables from uncompressed samples.
+        void Build(const AZStd::vector<ChannelSamples>& channels);
+        ChannelSamples DecompressChannel(const Channel& channel) const;
+        AZStd::vector<ChannelSamples> DecompressChannels() const;
+        void RemoveChannels(const AZStd::function<bool(const Channel&)>& predicate);
+        AZ::u32& GetChannelIndex(ChannelType type, size_t dataIndex);
+
+        static void CalcQuantizationRange(const ChannelSamples& channel, AZ::u8 bitRate, AZ::Vector4& outMin, AZ::Vector4& outScale);
+        static float CalcMaxError(const ChannelSamples& channel, AZ::u8 bitRate);
+        static float CalcError(ChannelType type, const AZ::Vector4& value, const AZ::Vector4& reference);
+
+        AZStd::vector<Channel> m_channels;
+        AZStd::vector<JointChannels> m_jointChannels;
+        AZStd::vector<AZ::u32> m_morphChannels;
+        AZStd::vector<AZ::u32> m_floatChannels;
+        AZStd::vector<AZ::u8> m_bitStream;
+        size_t m_numBitsPerFrame = 0;
+        size_t m_numSamples = 0;
+        float m_sampleSpacing = 1.0f / 30.0f;
+    };
+} // namespace EMotionFX
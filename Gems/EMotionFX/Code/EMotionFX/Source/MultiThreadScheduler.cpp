@@ -20,6 +20,12 @@
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
 
 
 namespace EMotionFX
@@ -141,67 +147,191 @@ namespace EMotionFX
             rootInstance->RecursiveSetIsVisible(rootInstance->GetIsVisible());
         }
 
-        // reset stats
-        m_numUpdated.SetValue(0);
-        m_numVisible.SetValue(0);
-        m_numSampled.SetValue(0);
+        ResetStats();
 
-        for (const ScheduleStep& currentStep : m_steps)
+        // run the batches on the task executor when it's active and there is a thread data for each of its workers
+        const AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        const bool useTaskGraph = taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive() &&
+            AZ::TaskExecutor::Instance().GetWorkerCount() <= GetEMotionFX().GetNumThreads();
+        const size_t numWorkers = useTaskGraph
+            ? AZ::TaskExecutor::Instance().GetWorkerCount()
+            : AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
+
+        BuildBatches(numWorkers);
+        if (m_batches.empty())
+        {
+            return;
+        }
+
+        m_updateTime.store(0);
+        if (useTaskGraph)
+        {
+            ExecuteBatchesAsTasks(timePassedInSeconds);
+        }
+        else
+        {
+            ExecuteBatchesAsJobs(timePassedInSeconds);
+        }
+
+        // adapt the batch sizes of the next execution to the measured cost
+        const float updateCost = static_cast<float>(m_updateTime.load()) / 1000.0f / static_cast<float>(m_batchActorInstances.size());
+        m_averageUpdateCost = AZ::Lerp(m_averageUpdateCost, updateCost, 0.1f);
+    }
+
+
+    void MultiThreadScheduler::BuildBatches(size_t numWorkers)
+    {
+        m_batches.clear();
+        m_batchActorInstances.clear();
+
+        const size_t numBatchWorkers = AZ::GetMax<size_t>(numWorkers, 1);
+        const size_t costBatchSize = m_averageUpdateCost > 0.0f
+            ? static_cast<size_t>(m_targetBatchDuration / m_averageUpdateCost)
+            : AZStd::numeric_limits<size_t>::max();
+
+        const size_t numSteps = m_steps.size();
+        for (size_t s = 0; s < numSteps; ++s)
         {
-            if (currentStep.m_actorInstances.empty())
+            const size_t stepBegin = m_batchActorInstances.size();
+            for (ActorInstance* actorInstance : m_steps[s].m_actorInstances)
+            {
+                if (actorInstance->GetIsEnabled())
+                {
+                    m_batchActorInstances.emplace_back(actorInstance);
+                }
+            }
+
+            const size_t stepEnd = m_batchActorInstances.size();
+            const size_t numStepActorInstances = stepEnd - stepBegin;
+            if (numStepActorInstances == 0)
             {
                 continue;
             }
 
-            // process the actor instances in the current step in parallel
-            AZ::JobCompletion jobCompletion;
-            for (ActorInstance* actorInstance : currentStep.m_actorInstances)
+            m_numUpdated.SetValue(m_numUpdated.GetValue() + numStepActorInstances);
+
+            // never make the batches so large that some of the workers would be left without any
+            const size_t maxBatchSize = (numStepActorInstances + numBatchWorkers - 1) / numBatchWorkers;
+            const size_t batchSize = AZ::GetClamp<size_t>(costBatchSize, 1, maxBatchSize);
+            for (size_t begin = stepBegin; begin < stepEnd; begin += batchSize)
+            {
+                m_batches.push_back({ s, begin, AZ::GetMin(begin + batchSize, stepEnd) });
+            }
+        }
+    }
+
+
+    void MultiThreadScheduler::ExecuteBatch(const Batch& batch, float timePassedInSeconds, uint32 threadIndex)
+    {
+        AZ_PROFILE_SCOPE(Animation, "MultiThreadScheduler::ExecuteBatch");
+
+        const AZStd::chrono::steady_clock::time_point startTime = AZStd::chrono::steady_clock::now();
+        for (size_t i = batch.m_begin; i < batch.m_end; ++i)
+        {
+            ActorInstance* actorInstance = m_batchActorInstances[i];
+            actorInstance->SetThreadIndex(threadIndex);
+            UpdateActorInstance(actorInstance, timePassedInSeconds);
+        }
+
+        const AZStd::chrono::nanoseconds duration = AZStd::chrono::steady_clock::now() - startTime;
+        m_updateTime.fetch_add(static_cast<AZ::u64>(duration.count()));
+    }
+
+
+    void MultiThreadScheduler::ExecuteBatchesAsTasks(float timePassedInSeconds)
+    {
+        // each running task takes a thread data that no other running task uses
+        const uint32 numThreads = aznumeric_cast<uint32>(GetEMotionFX().GetNumThreads());
+        m_freeThreadIndices.resize(numThreads);
+        for (uint32 i = 0; i < numThreads; ++i)
+        {
+            m_freeThreadIndices[i] = i;
+        }
+
+        m_taskGraph.Reset();
+        m_batchIndexByActorInstance.clear();
+
+        AZStd::vector<AZ::TaskToken> batchTokens;
+        batchTokens.reserve(m_batches.size());
+        AZStd::vector<size_t> parentBatchIndices;
+
+        const size_t numBatches = m_batches.size();
+        for (size_t batchIndex = 0; batchIndex < numBatches; ++batchIndex)
+        {
+            const Batch& batch = m_batches[batchIndex];
+            batchTokens.push_back(m_taskGraph.AddTask(m_batchTaskDescriptor, [this, &batch, timePassedInSeconds]()
             {
-                if (actorInstance->GetIsEnabled() == false)
+                uint32 threadIndex;
                 {
-                    continue;
+                    AZStd::scoped_lock lock(m_threadIndexMutex);
+                    AZ_Assert(!m_freeThreadIndices.empty(), "Expected a thread data for each task executor worker.");
+                    threadIndex = m_freeThreadIndices.back();
+                    m_freeThreadIndices.pop_back();
                 }
 
-                AZ::JobContext* jobContext = nullptr;
-                AZ::Job* job = AZ::CreateJobFunction([this, timePassedInSeconds, actorInstance]()
-                {
-                    AZ_PROFILE_SCOPE(Animation, "MultiThreadScheduler::Execute::ActorInstanceUpdateJob");
+                ExecuteBatch(batch, timePassedInSeconds, threadIndex);
+
+                AZStd::scoped_lock lock(m_threadIndexMutex);
+                m_freeThreadIndices.emplace_back(threadIndex);
+            }));
 
-                    const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();                    
-                    actorInstance->SetThreadIndex(threadIndex);
+            // attachments wait for the batches holding the actor instances they are attached to, instead of the whole previous step
+            parentBatchIndices.clear();
+            for (size_t i = batch.m_begin; i < batch.m_end; ++i)
+            {
+                const ActorInstance* actorInstance = m_batchActorInstances[i];
+                m_batchIndexByActorInstance[actorInstance] = batchIndex;
 
-                    const bool isVisible = actorInstance->GetIsVisible();
-                    if (isVisible)
+                const ActorInstance* attachedTo = actorInstance->GetAttachedTo();
+                if (attachedTo)
+                {
+                    const auto parentBatch = m_batchIndexByActorInstance.find(attachedTo);
+                    if (parentBatch != m_batchIndexByActorInstance.end())
                     {
-                        m_numVisible.Increment();
+                        parentBatchIndices.emplace_back(parentBatch->second);
                     }
+                }
+            }
 
-                    // check if we want to sample motions
-                    bool sampleMotions = false;
-                    actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
-                    if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
-                    {
-                        sampleMotions = true;
-                        actorInstance->SetMotionSamplingTimer(0.0f);
+            AZStd::sort(parentBatchIndices.begin(), parentBatchIndices.end());
+            parentBatchIndices.erase(AZStd::unique(parentBatchIndices.begin(), parentBatchIndices.end()), parentBatchIndices.end());
+            for (const size_t parentBatchIndex : parentBatchIndices)
+            {
+                batchTokens[parentBatchIndex].Precedes(batchTokens.back());
+            }
+        }
+
+        AZ::TaskGraphEvent finishedEvent{ "EMotionFX Actor Update Wait" };
+        m_taskGraph.Submit(&finishedEvent);
+        finishedEvent.Wait();
+    }
 
-                        if (isVisible)
-                        {
-                            m_numSampled.Increment();
-                        }
-                    }
 
-                    // update the actor instance
-                    actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+    void MultiThreadScheduler::ExecuteBatchesAsJobs(float timePassedInSeconds)
+    {
+        const size_t numBatches = m_batches.size();
+        size_t batchIndex = 0;
+        while (batchIndex < numBatches)
+        {
+            // process the batches of the current step in parallel
+            const size_t step = m_batches[batchIndex].m_step;
+            AZ::JobCompletion jobCompletion;
+            for (; batchIndex < numBatches && m_batches[batchIndex].m_step == step; ++batchIndex)
+            {
+                const Batch& batch = m_batches[batchIndex];
+                AZ::JobContext* jobContext = nullptr;
+                AZ::Job* job = AZ::CreateJobFunction([this, &batch, timePassedInSeconds]()
+                {
+                    const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();
+                    ExecuteBatch(batch, timePassedInSeconds, threadIndex);
                 }, true, jobContext);
 
-                job->SetDependent(&jobCompletion);               
+                job->SetDependent(&jobCompletion);
                 job->Start();
-
-                m_numUpdated.Increment();
             }
 
             jobCompletion.StartAndWaitForCompletion();
-        } // for all steps
+        }
     }
 
 
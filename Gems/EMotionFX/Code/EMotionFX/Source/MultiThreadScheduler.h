@@ -13,6 +13,11 @@
 #include "ActorUpdateScheduler.h"
 #include "Actor.h"
 #include <MCore/Source/MultiThreadManager.h>
+#include <AzCore/Task/TaskDescriptor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace EMotionFX
 {
@@ -28,6 +33,9 @@ namespace EMotionFX
      * If however you wish to let EMotion FX only use one single CPU, or if the target system ahs only one CPU, it is recommended
      * to use the SingleThreadScheduler class instead, as that will be faster in that specific case.
      * Significant performance gains can be achieved by using this scheduler on multi-processor or multi-core systems though.
+     * The actor instances are updated in batches, sized based on the measured update cost per actor instance. When the task graph
+     * is active, the batches run on the task executor, where attachments only wait for the batches of the actor instances they are
+     * attached to. Otherwise they run as jobs, one schedule step after the other.
      */
     class EMFX_API MultiThreadScheduler
         : public ActorUpdateScheduler
@@ -122,11 +130,53 @@ namespace EMotionFX
         const ScheduleStep& GetScheduleStep(size_t index) const { return m_steps[index]; }
         size_t GetNumScheduleSteps() const { return m_steps.size(); }
 
+        /**
+         * Set the time a batch of actor instance updates should roughly take.
+         * Longer batches reduce the per task overhead, shorter ones balance the work better over the worker threads.
+         * @param microseconds The target batch duration, in microseconds.
+         */
+        void SetTargetBatchDuration(float microseconds)         { m_targetBatchDuration = microseconds; }
+        float GetTargetBatchDuration() const                    { return m_targetBatchDuration; }
+
+        /**
+         * Get the moving average of the time it takes to update a single actor instance, in microseconds.
+         * This is what the batch sizes are based on.
+         * @result The average update cost of an actor instance, in microseconds.
+         */
+        float GetAverageUpdateCost() const                      { return m_averageUpdateCost; }
+
+        /**
+         * Get the number of batches the actor instances got updated in during the last execution of the schedule.
+         * @result The number of batches.
+         */
+        size_t GetNumBatches() const                            { return m_batches.size(); }
+
     protected:
+        /**
+         * A range of actor instances of the same schedule step, updated one after the other by a single task or job.
+         */
+        struct Batch
+        {
+            size_t m_step;      /**< The schedule step the actor instances belong to. */
+            size_t m_begin;     /**< The index of the first actor instance in m_batchActorInstances. */
+            size_t m_end;       /**< The index after the last actor instance in m_batchActorInstances. */
+        };
+
         AZStd::vector< ScheduleStep >    m_steps;         /**< An array of update steps, that together form the schedule. */
         float                           m_cleanTimer;    /**< The time passed since the last automatic call to the Optimize method. */
         MCore::MutexRecursive           m_mutex;
 
+        AZStd::vector<ActorInstance*>   m_batchActorInstances;  /**< The enabled actor instances of all steps, in step order, as referenced by the batches. */
+        AZStd::vector<Batch>            m_batches;              /**< The batches of the last execution of the schedule. */
+        AZStd::unordered_map<const ActorInstance*, size_t> m_batchIndexByActorInstance; /**< The batch each actor instance is in, to find the batches attachments depend on. */
+        AZStd::vector<uint32>           m_freeThreadIndices;    /**< The thread data indices not in use by a running task. */
+        AZStd::mutex                    m_threadIndexMutex;     /**< Protects m_freeThreadIndices. */
+        AZStd::atomic<AZ::u64>          m_updateTime{ 0 };      /**< The total time spent updating actor instances during the last execution, in nanoseconds. */
+        float                           m_averageUpdateCost = 50.0f;    /**< Moving average of the update time per actor instance, in microseconds. */
+        float                           m_targetBatchDuration = 500.0f; /**< The time a batch should roughly take, in microseconds. */
+        AZ::TaskGraph                   m_taskGraph{ "EMotionFX Actor Update" };
+        AZ::TaskDescriptor              m_batchTaskDescriptor{ "Update Actor Instance Batch", "Animation" };
+
         bool HasActorInstanceInSteps(const ActorInstance* actorInstance) const;
 
         /**
@@ -166,5 +216,31 @@ namespace EMotionFX
          * @param outStep The scheduler step to add the dependencies to.
          */
         void AddDependenciesToStep(ActorInstance* instance, ScheduleStep* outStep);
+
+        /**
+         * Split the enabled actor instances of each step into batches, based on the average update cost.
+         * @param numWorkers The number of worker threads the batches will be spread over.
+         */
+        void BuildBatches(size_t numWorkers);
+
+        /**
+         * Update the actor instances of a batch, one after the other.
+         * @param batch The batch to update.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         * @param threadIndex The index of the thread data the actor instances use while updating.
+         */
+        void ExecuteBatch(const Batch& batch, float timePassedInSeconds, uint32 threadIndex);
+
+        /**
+         * Run the batches on the task executor, where each batch only waits for the batches holding the actor instances it is attached to.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void ExecuteBatchesAsTasks(float timePassedInSeconds);
+
+        /**
+         * Run the batches as jobs, waiting for all batches of a schedule step to complete before starting the next step.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void ExecuteBatchesAsJobs(float timePassedInSeconds);
     };
 }   // namespace EMotionFX
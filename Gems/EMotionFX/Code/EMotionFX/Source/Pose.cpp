@@ -13,6 +13,7 @@
 #include <EMotionFX/Source/MorphSetup.h>
 #include <EMotionFX/Source/Node.h>
 #include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/PoseBlendKernels.h>
 #include <EMotionFX/Source/PoseDataFactory.h>
 #include <EMotionFX/Source/TransformData.h>
 
@@ -440,6 +441,24 @@ namespace EMotionFX
     }
 
 
+    void Pose::UpdateLocalSpaceTransforms(const uint16* nodeIndices, size_t numNodes) const
+    {
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            UpdateLocalSpaceTransform(nodeIndices ? nodeIndices[i] : i);
+        }
+    }
+
+
+    void Pose::SetLocalSpaceTransformsReady(const uint16* nodeIndices, size_t numNodes)
+    {
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            m_flags[nodeIndices[i]] |= FLAG_LOCALTRANSFORMREADY;
+        }
+    }
+
+
     void Pose::UpdateAllLocalSpaceTranforms()
     {
         Skeleton* skeleton = m_actor->GetSkeleton();
@@ -490,14 +509,12 @@ namespace EMotionFX
             {
                 if (weight > 0.0f)
                 {
-                    const size_t numNodes = actorInstance->GetNumEnabledNodes();
-                    for (size_t i = 0; i < numNodes; ++i)
-                    {
-                        const uint16 nodeNr = actorInstance->GetEnabledNode(i);
-                        Transform transform = GetLocalSpaceTransform(nodeNr);
-                        transform.Blend(destPose->GetLocalSpaceTransform(nodeNr), weight);
-                        outPose->SetLocalSpaceTransform(nodeNr, transform, false);
-                    }
+                    const AZStd::vector<uint16>& enabledNodes = actorInstance->GetEnabledNodes();
+                    UpdateLocalSpaceTransforms(enabledNodes.data(), enabledNodes.size());
+                    destPose->UpdateLocalSpaceTransforms(enabledNodes.data(), enabledNodes.size());
+                    PoseBlendKernels::Blend(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), outPose->m_localSpaceTransforms.data(),
+                        enabledNodes.data(), enabledNodes.size(), weight);
+                    outPose->SetLocalSpaceTransformsReady(enabledNodes.data(), enabledNodes.size());
                     outPose->InvalidateAllModelSpaceTransforms();
                 }
                 else // if the weight is 0, so the source
@@ -522,15 +539,13 @@ namespace EMotionFX
         {
             TransformData* transformData = instance->GetActorInstance()->GetTransformData();
             const Pose* bindPose = transformData->GetBindPose();
-            Transform result;
-            const size_t numNodes = actorInstance->GetNumEnabledNodes();
-            for (size_t i = 0; i < numNodes; ++i)
-            {
-                const uint16 nodeNr = actorInstance->GetEnabledNode(i);
-                const Transform& base = bindPose->GetLocalSpaceTransform(nodeNr);
-                BlendTransformAdditiveUsingBindPose(base, GetLocalSpaceTransform(nodeNr), destPose->GetLocalSpaceTransform(nodeNr), weight, &result);
-                outPose->SetLocalSpaceTransform(nodeNr, result, false);
-            }
+            const AZStd::vector<uint16>& enabledNodes = actorInstance->GetEnabledNodes();
+            UpdateLocalSpaceTransforms(enabledNodes.data(), enabledNodes.size());
+            destPose->UpdateLocalSpaceTransforms(enabledNodes.data(), enabledNodes.size());
+            bindPose->UpdateLocalSpaceTransforms(enabledNodes.data(), enabledNodes.size());
+            PoseBlendKernels::BlendAdditive(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), bindPose->m_localSpaceTransforms.data(),
+                outPose->m_localSpaceTransforms.data(), enabledNodes.data(), enabledNodes.size(), weight);
+            outPose->SetLocalSpaceTransformsReady(enabledNodes.data(), enabledNodes.size());
             outPose->InvalidateAllModelSpaceTransforms();
 
             // blend the morph weights
@@ -833,13 +848,11 @@ namespace EMotionFX
     {
         if (m_actorInstance)
         {
-            const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
-            for (size_t i = 0; i < numNodes; ++i)
-            {
-                const uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(nodeNr), weight);
-            }
+            const AZStd::vector<uint16>& enabledNodes = m_actorInstance->GetEnabledNodes();
+            UpdateLocalSpaceTransforms(enabledNodes.data(), enabledNodes.size());
+            destPose->UpdateLocalSpaceTransforms(enabledNodes.data(), enabledNodes.size());
+            PoseBlendKernels::Blend(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), m_localSpaceTransforms.data(),
+                enabledNodes.data(), enabledNodes.size(), weight);
 
             // blend the morph weights
             const size_t numMorphs = m_morphWeights.size();
@@ -859,11 +872,10 @@ namespace EMotionFX
         else
         {
             const size_t numNodes = m_actor->GetSkeleton()->GetNumNodes();
-            for (size_t i = 0; i < numNodes; ++i)
-            {
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(i));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(i), weight);
-            }
+            UpdateLocalSpaceTransforms(nullptr, numNodes);
+            destPose->UpdateLocalSpaceTransforms(nullptr, numNodes);
+            PoseBlendKernels::Blend(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), m_localSpaceTransforms.data(),
+                nullptr, numNodes, weight);
 
             // blend the morph weights
             const size_t numMorphs = m_morphWeights.size();
@@ -1090,16 +1102,14 @@ namespace EMotionFX
         if (m_actorInstance)
         {
             const TransformData* transformData = m_actorInstance->GetTransformData();
-            Pose* bindPose = transformData->GetBindPose();
-            Transform result;
+            const Pose* bindPose = transformData->GetBindPose();
 
-            const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
-            for (size_t i = 0; i < numNodes; ++i)
-            {
-                const uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
-                BlendTransformAdditiveUsingBindPose(bindPose->GetLocalSpaceTransform(nodeNr), GetLocalSpaceTransform(nodeNr), destPose->GetLocalSpaceTransform(nodeNr), weight, &result);
-                SetLocalSpaceTransform(nodeNr, result, false);
-            }
+            const AZStd::vector<uint16>& enabledNodes = m_actorInstance->GetEnabledNodes();
+            UpdateLocalSpaceTransforms(enabledNodes.data(), enabledNodes.size());
+            destPose->UpdateLocalSpaceTransforms(enabledNodes.data(), enabledNodes.size());
+            bindPose->UpdateLocalSpaceTransforms(enabledNodes.data(), enabledNodes.size());
+            PoseBlendKernels::BlendAdditive(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), bindPose->m_localSpaceTransforms.data(),
+                m_localSpaceTransforms.data(), enabledNodes.data(), enabledNodes.size(), weight);
 
             // blend the morph weights
             const size_t numMorphs = m_morphWeights.size();
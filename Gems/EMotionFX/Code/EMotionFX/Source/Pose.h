@@ -208,6 +208,20 @@ namespace EMotionFX
 
         void RecursiveInvalidateModelSpaceTransforms(const Actor* actor, size_t nodeIndex);
 
+        /**
+         * Make sure the local space transforms of the given nodes are up to date, so the blend kernels can process them directly.
+         * @param nodeIndices The indices of the nodes to update, or nullptr to update the nodes 0 to numNodes - 1.
+         * @param numNodes The number of nodes to update.
+         */
+        void UpdateLocalSpaceTransforms(const uint16* nodeIndices, size_t numNodes) const;
+
+        /**
+         * Flag the local space transforms of the given nodes as up to date, after the blend kernels wrote them.
+         * @param nodeIndices The indices of the nodes to flag.
+         * @param numNodes The number of nodes to flag.
+         */
+        void SetLocalSpaceTransformsReady(const uint16* nodeIndices, size_t numNodes);
+
         /**
          * Perform a non-mixed blend into the specified destination pose.
          * @param destPose The destination pose to blend into.
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "PoseBlendKernels.h"
+#include "Transform.h"
+#include <AzCore/Math/SimdMath.h>
+
+
+namespace EMotionFX
+{
+    namespace PoseBlendKernels
+    {
+        namespace
+        {
+            using AZ::Simd::Vec4;
+
+            constexpr size_t NumLanes = 4;
+
+            AZ_FORCE_INLINE size_t GetJointIndex(const uint16* jointIndices, size_t i)
+            {
+                return jointIndices ? jointIndices[i] : i;
+            }
+
+            // Normalized lerp of four quaternions at once, with the components transposed into x, y, z and w registers.
+            // Matches MCore::NLerp(), which takes the shortest path by negating the destination weight for quaternions in opposite hemispheres.
+            AZ_FORCE_INLINE void NLerp4(const Vec4::FloatType* from, const Vec4::FloatType* to, Vec4::FloatArgType weight, Vec4::FloatType* out)
+            {
+                const Vec4::FloatType dot = Vec4::Madd(from[0], to[0], Vec4::Madd(from[1], to[1], Vec4::Madd(from[2], to[2], Vec4::Mul(from[3], to[3]))));
+                const Vec4::FloatType signMask = Vec4::And(Vec4::CmpLt(dot, Vec4::ZeroFloat()), Vec4::Splat(-0.0f));
+                const Vec4::FloatType toWeight = Vec4::Xor(weight, signMask);
+                const Vec4::FloatType fromWeight = Vec4::Sub(Vec4::Splat(1.0f), weight);
+
+                Vec4::FloatType result[NumLanes];
+                for (size_t c = 0; c < NumLanes; ++c)
+                {
+                    result[c] = Vec4::Madd(to[c], toWeight, Vec4::Mul(from[c], fromWeight));
+                }
+
+                const Vec4::FloatType lengthSq = Vec4::Madd(result[0], result[0], Vec4::Madd(result[1], result[1],
+                    Vec4::Madd(result[2], result[2], Vec4::Mul(result[3], result[3]))));
+                const Vec4::FloatType invLength = Vec4::SqrtInv(lengthSq);
+                for (size_t c = 0; c < NumLanes; ++c)
+                {
+                    out[c] = Vec4::Mul(result[c], invLength);
+                }
+            }
+
+            // Gather the rotations of four joints and lerp them, returning one quaternion per joint again.
+            AZ_FORCE_INLINE void NLerpRotations4(const Transform* from, const Transform* to, const size_t* joints, Vec4::FloatArgType weight, AZ::Quaternion* out)
+            {
+                Vec4::FloatType fromRows[NumLanes];
+                Vec4::FloatType toRows[NumLanes];
+                for (size_t lane = 0; lane < NumLanes; ++lane)
+                {
+                    fromRows[lane] = from[joints[lane]].m_rotation.GetSimdValue();
+                    toRows[lane] = to[joints[lane]].m_rotation.GetSimdValue();
+                }
+
+                Vec4::FloatType fromColumns[NumLanes];
+                Vec4::FloatType toColumns[NumLanes];
+                Vec4::Mat4x4Transpose(fromRows, fromColumns);
+                Vec4::Mat4x4Transpose(toRows, toColumns);
+
+                Vec4::FloatType resultColumns[NumLanes];
+                Vec4::FloatType resultRows[NumLanes];
+                NLerp4(fromColumns, toColumns, weight, resultColumns);
+                Vec4::Mat4x4Transpose(resultColumns, resultRows);
+
+                for (size_t lane = 0; lane < NumLanes; ++lane)
+                {
+                    out[lane] = AZ::Quaternion(resultRows[lane]);
+                }
+            }
+        } // namespace
+
+        void Blend(const Transform* source, const Transform* dest, Transform* out, const uint16* jointIndices, size_t numJoints, float weight)
+        {
+            const Vec4::FloatType weights = Vec4::Splat(weight);
+
+            size_t i = 0;
+            for (; i + NumLanes <= numJoints; i += NumLanes)
+            {
+                size_t joints[NumLanes];
+                for (size_t lane = 0; lane < NumLanes; ++lane)
+                {
+                    joints[lane] = GetJointIndex(jointIndices, i + lane);
+                }
+
+                AZ::Quaternion rotations[NumLanes];
+                NLerpRotations4(source, dest, joints, weights, rotations);
+
+                for (size_t lane = 0; lane < NumLanes; ++lane)
+                {
+                    const size_t joint = joints[lane];
+                    out[joint].m_rotation = rotations[lane];
+                    out[joint].m_position = source[joint].m_position.Lerp(dest[joint].m_position, weight);
+
+                    EMFX_SCALECODE
+                    (
+                        out[joint].m_scale = source[joint].m_scale.Lerp(dest[joint].m_scale, weight);
+                    )
+                }
+            }
+
+            // the remaining joints that don't fill all lanes
+            for (; i < numJoints; ++i)
+            {
+                const size_t joint = GetJointIndex(jointIndices, i);
+                out[joint] = source[joint];
+                out[joint].Blend(dest[joint], weight);
+            }
+        }
+
+        void BlendAdditive(const Transform* source, const Transform* dest, const Transform* base, Transform* out, const uint16* jointIndices, size_t numJoints, float weight)
+        {
+            const Vec4::FloatType weights = Vec4::Splat(weight);
+
+            size_t i = 0;
+            for (; i + NumLanes <= numJoints; i += NumLanes)
+            {
+                size_t joints[NumLanes];
+                for (size_t lane = 0; lane < NumLanes; ++lane)
+                {
+                    joints[lane] = GetJointIndex(jointIndices, i + lane);
+                }
+
+                AZ::Quaternion rotations[NumLanes];
+                NLerpRotations4(base, dest, joints, weights, rotations);
+
+                for (size_t lane = 0; lane < NumLanes; ++lane)
+                {
+                    const size_t joint = joints[lane];
+                    const Transform& baseTransform = base[joint];
+                    out[joint].m_rotation = (source[joint].m_rotation * (baseTransform.m_rotation.GetConjugate() * rotations[lane])).GetNormalized();
+                    out[joint].m_position = source[joint].m_position + (dest[joint].m_position - baseTransform.m_position) * weight;
+
+                    EMFX_SCALECODE
+                    (
+                        out[joint].m_scale = source[joint].m_scale + (dest[joint].m_scale - baseTransform.m_scale) * weight;
+                    )
+                }
+            }
+
+            // the remaining joints that don't fill all lanes
+            for (; i < numJoints; ++i)
+            {
+                const size_t joint = GetJointIndex(jointIndices, i);
+                out[joint] = source[joint];
+                out[joint].BlendAdditive(dest[joint], base[joint], weight);
+            }
+        }
+    } // namespace PoseBlendKernels
+}   // namespace EMotionFX
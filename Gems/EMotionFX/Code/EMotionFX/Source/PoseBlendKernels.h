@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include "EMotionFXConfig.h"
+
+
+namespace EMotionFX
+{
+    class Transform;
+
+    /**
+     * Blend kernels working on arrays of local space transforms.
+     * The rotations of four joints at a time get transposed into separate x, y, z and w registers, so that the
+     * normalized lerp of four joints runs in parallel, instead of one horizontal dot product and one branch per joint.
+     * The results match Transform::Blend() and Transform::BlendAdditive().
+     * When jointIndices is nullptr, the joints 0 to numJoints - 1 get processed. The output array may be the source array.
+     */
+    namespace PoseBlendKernels
+    {
+        /**
+         * Blend the source towards the destination transforms, like Transform::Blend() does.
+         * @param source The source transforms.
+         * @param dest The destination transforms.
+         * @param out The output transforms, which can be the source transforms.
+         * @param jointIndices The indices of the joints to blend, or nullptr to blend all joints up to numJoints.
+         * @param numJoints The number of joints to blend.
+         * @param weight The blend weight, where 0 results in the source and 1 in the destination transforms.
+         */
+        void EMFX_API Blend(const Transform* source, const Transform* dest, Transform* out, const uint16* jointIndices, size_t numJoints, float weight);
+
+        /**
+         * Add the difference between the destination and the base transforms on top of the source transforms, like Transform::BlendAdditive() does.
+         * @param source The source transforms.
+         * @param dest The destination transforms.
+         * @param base The transforms the destination transforms are relative to, usually the bind pose.
+         * @param out The output transforms, which can be the source transforms.
+         * @param jointIndices The indices of the joints to blend, or nullptr to blend all joints up to numJoints.
+         * @param numJoints The number of joints to blend.
+         * @param weight The blend weight of the additive transforms.
+         */
+        void EMFX_API BlendAdditive(const Transform* source, const Transform* dest, const Transform* base, Transform* out, const uint16* jointIndices, size_t numJoints, float weight);
+    } // namespace PoseBlendKernels
+}   // namespace EMotionFX
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+#include <AzFramework/Physics/PhysicsScene.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/RagdollInstance.h>
+#include <EMotionFX/Source/RagdollPhysicsSync.h>
+
+namespace EMotionFX
+{
+    AZ_CLASS_ALLOCATOR_IMPL(RagdollPhysicsSync, Integration::EMotionFXAllocator)
+
+    RagdollPhysicsSync::~RagdollPhysicsSync()
+    {
+        for (AZStd::unique_ptr<SceneSync>& sceneSync : m_sceneSyncs)
+        {
+            sceneSync->m_sceneFinishSimHandler.Disconnect();
+        }
+        m_sceneSyncs.clear();
+    }
+
+    RagdollPhysicsSync::SceneSync* RagdollPhysicsSync::FindSceneSync(AzPhysics::SceneHandle sceneHandle) const
+    {
+        for (const AZStd::unique_ptr<SceneSync>& sceneSync : m_sceneSyncs)
+        {
+            if (sceneSync->m_sceneHandle == sceneHandle)
+            {
+                return sceneSync.get();
+            }
+        }
+        return nullptr;
+    }
+
+    RagdollPhysicsSync::SceneSync* RagdollPhysicsSync::FindSceneSync(const ActorInstance* actorInstance) const
+    {
+        for (const AZStd::unique_ptr<SceneSync>& sceneSync : m_sceneSyncs)
+        {
+            if (AZStd::find(sceneSync->m_actorInstances.begin(), sceneSync->m_actorInstances.end(), actorInstance) != sceneSync->m_actorInstances.end())
+            {
+                return sceneSync.get();
+            }
+        }
+        return nullptr;
+    }
+
+    void RagdollPhysicsSync::RegisterActorInstance(ActorInstance* actorInstance)
+    {
+        const RagdollInstance* ragdollInstance = actorInstance->GetRagdollInstance();
+        if (!ragdollInstance)
+        {
+            AZ_Assert(false, "Cannot sync the ragdoll of an actor instance without a ragdoll instance.");
+            return;
+        }
+
+        // The ragdoll could have moved to another scene since the actor instance got registered.
+        UnregisterActorInstance(actorInstance);
+
+        const AzPhysics::SceneHandle sceneHandle = ragdollInstance->GetRagdollSceneHandle();
+        SceneSync* sceneSync = FindSceneSync(sceneHandle);
+        if (!sceneSync)
+        {
+            m_sceneSyncs.emplace_back(AZStd::make_unique<SceneSync>());
+            sceneSync = m_sceneSyncs.back().get();
+            sceneSync->m_sceneHandle = sceneHandle;
+            sceneSync->m_sceneFinishSimHandler = AzPhysics::SceneEvents::OnSceneSimulationFinishHandler(
+                [sceneSync]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, float fixedDeltaTime)
+                {
+                    PostPhysicsUpdate(sceneSync->m_actorInstances, fixedDeltaTime);
+                }, aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Animation));
+        }
+
+        sceneSync->m_actorInstances.emplace_back(actorInstance);
+
+        if (!sceneSync->m_sceneFinishSimHandler.IsConnected())
+        {
+            if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
+            {
+                sceneInterface->RegisterSceneSimulationFinishHandler(sceneHandle, sceneSync->m_sceneFinishSimHandler);
+            }
+        }
+    }
+
+    void RagdollPhysicsSync::UnregisterActorInstance(ActorInstance* actorInstance)
+    {
+        SceneSync* sceneSync = FindSceneSync(actorInstance);
+        if (!sceneSync)
+        {
+            return;
+        }
+
+        AZStd::vector<ActorInstance*>& actorInstances = sceneSync->m_actorInstances;
+        actorInstances.erase(AZStd::remove(actorInstances.begin(), actorInstances.end(), actorInstance), actorInstances.end());
+
+        // Stop listening to the scene once no ragdoll needs syncing anymore.
+        if (actorInstances.empty())
+        {
+            sceneSync->m_sceneFinishSimHandler.Disconnect();
+            m_sceneSyncs.erase(AZStd::find_if(m_sceneSyncs.begin(), m_sceneSyncs.end(),
+                [sceneSync](const AZStd::unique_ptr<SceneSync>& item)
+                {
+                    return item.get() == sceneSync;
+                }));
+        }
+    }
+
+    bool RagdollPhysicsSync::IsActorInstanceRegistered(const ActorInstance* actorInstance) const
+    {
+        const SceneSync* sceneSync = FindSceneSync(actorInstance);
+        return sceneSync && sceneSync->m_sceneFinishSimHandler.IsConnected();
+    }
+
+    size_t RagdollPhysicsSync::GetNumActorInstances(AzPhysics::SceneHandle sceneHandle) const
+    {
+        const SceneSync* sceneSync = FindSceneSync(sceneHandle);
+        return sceneSync ? sceneSync->m_actorInstances.size() : 0;
+    }
+
+    void RagdollPhysicsSync::PostPhysicsUpdate(const AZStd::vector<ActorInstance*>& actorInstances, float timeDelta)
+    {
+        AZ_PROFILE_SCOPE(Animation, "RagdollPhysicsSync::PostPhysicsUpdate");
+
+        const size_t numActorInstances = actorInstances.size();
+        const size_t numBatches = (numActorInstances + s_numActorInstancesPerBatch - 1) / s_numActorInstancesPerBatch;
+        const auto syncBatch = [&actorInstances, numActorInstances, timeDelta](size_t batchIndex)
+        {
+            const size_t start = batchIndex * s_numActorInstancesPerBatch;
+            const size_t end = AZ::GetMin(start + s_numActorInstancesPerBatch, numActorInstances);
+            for (size_t i = start; i < end; ++i)
+            {
+                actorInstances[i]->PostPhysicsUpdate(timeDelta);
+            }
+        };
+
+        // Not worth the overhead of scheduling tasks for a few ragdolls.
+        if (numBatches <= 1)
+        {
+            for (size_t batchIndex = 0; batchIndex < numBatches; ++batchIndex)
+            {
+                syncBatch(batchIndex);
+            }
+            return;
+        }
+
+        // Each ragdoll only reads its own physics bodies and writes its own ragdoll instance, so the batches can run in any order.
+        const AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive())
+        {
+            AZ::TaskGraph taskGraph{ "EMotionFX Ragdoll Sync" };
+            const AZ::TaskDescriptor taskDescriptor{ "RagdollSync", "Animation" };
+            for (size_t batchIndex = 0; batchIndex < numBatches; ++batchIndex)
+            {
+                taskGraph.AddTask(taskDescriptor, [&syncBatch, batchIndex]()
+                {
+                    syncBatch(batchIndex);
+                });
+            }
+
+            AZ::TaskGraphEvent finishedEvent{ "EMotionFX Ragdoll Sync Wait" };
+            taskGraph.Submit(&finishedEvent);
+            finishedEvent.Wait();
+        }
+        else
+        {
+            AZ::JobCompletion jobCompletion;
+            for (size_t batchIndex = 0; batchIndex < numBatches; ++batchIndex)
+            {
+                AZ::JobContext* jobContext = nullptr;
+                AZ::Job* job = AZ::CreateJobFunction([&syncBatch, batchIndex]()
+                {
+                    syncBatch(batchIndex);
+                }, true, jobContext);
+
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+
+            jobCompletion.StartAndWaitForCompletion();
+        }
+    }
+} // namespace EMotionFX
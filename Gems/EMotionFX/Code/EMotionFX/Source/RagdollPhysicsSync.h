@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
+#include <AzFramework/Physics/Common/PhysicsTypes.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+namespace EMotionFX
+{
+    class ActorInstance;
+
+    /**
+     * Syncs the ragdolls of all registered actor instances back to the animation system after each physics simulation step.
+     * Rather than each actor instance listening to the simulation finish event of its physics scene and reading its ragdoll on its own,
+     * there is a single handler per scene. It reads the ragdoll states of all actor instances in that scene in one pass over a
+     * contiguous array, split into batches that run in parallel on the task graph or the job system.
+     * Registering and unregistering is expected to happen on the main thread, the same thread the physics events get signaled on.
+     */
+    class EMFX_API RagdollPhysicsSync
+    {
+    public:
+        AZ_CLASS_ALLOCATOR_DECL
+
+        RagdollPhysicsSync() = default;
+        ~RagdollPhysicsSync();
+
+        /**
+         * Register the actor instance with the scene of its ragdoll.
+         * @param actorInstance The actor instance, which needs to have a ragdoll instance.
+         */
+        void RegisterActorInstance(ActorInstance* actorInstance);
+
+        /**
+         * Unregister the actor instance from the scene it got registered with. Does nothing in case it is not registered.
+         * @param actorInstance The actor instance to unregister.
+         */
+        void UnregisterActorInstance(ActorInstance* actorInstance);
+
+        /**
+         * Check if the actor instance is registered and the handler for the scene it is registered with is connected.
+         * @param actorInstance The actor instance to check.
+         * @result True in case the ragdoll of the actor instance gets synced after each simulation step.
+         */
+        bool IsActorInstanceRegistered(const ActorInstance* actorInstance) const;
+
+        size_t GetNumActorInstances(AzPhysics::SceneHandle sceneHandle) const;
+
+        /**
+         * Read back the ragdoll states of the given actor instances, in parallel batches in case there are enough of them.
+         * @param actorInstances The actor instances to sync.
+         * @param timeDelta The time step of the physics simulation.
+         */
+        static void PostPhysicsUpdate(const AZStd::vector<ActorInstance*>& actorInstances, float timeDelta);
+
+        static constexpr size_t s_numActorInstancesPerBatch = 8; /**< The number of ragdolls synced within a single task. */
+
+    private:
+        struct SceneSync
+        {
+            AzPhysics::SceneHandle m_sceneHandle = AzPhysics::InvalidSceneHandle;
+            AZStd::vector<ActorInstance*> m_actorInstances;
+            AzPhysics::SceneEvents::OnSceneSimulationFinishHandler m_sceneFinishSimHandler;
+        };
+
+        SceneSync* FindSceneSync(AzPhysics::SceneHandle sceneHandle) const;
+        SceneSync* FindSceneSync(const ActorInstance* actorInstance) const;
+
+        AZStd::vector<AZStd::unique_ptr<SceneSync>> m_sceneSyncs;
+    };
+} // namespace EMotionFX
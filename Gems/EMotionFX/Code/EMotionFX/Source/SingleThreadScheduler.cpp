@@ -44,10 +44,7 @@ namespace EMotionFX
     {
         const ActorManager& actorManager = GetActorManager();
 
-        // reset stats
-        m_numUpdated.SetValue(0);
-        m_numVisible.SetValue(0);
-        m_numSampled.SetValue(0);
+        ResetStats();
 
         // propagate root actor instance visibility to their attachments
         const size_t numRootActorInstances = GetActorManager().GetNumRootActorInstances();
@@ -83,29 +80,7 @@ namespace EMotionFX
 
         m_numUpdated.Increment();
 
-        const bool isVisible = actorInstance->GetIsVisible();
-
-        // check if we want to sample motions
-        bool sampleMotions = false;
-        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
-        if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
-        {
-            sampleMotions = true;
-            actorInstance->SetMotionSamplingTimer(0.0f);
-
-            if (isVisible)
-            {
-                m_numSampled.Increment();
-            }
-        }
-
-        if (isVisible)
-        {
-            m_numVisible.Increment();
-        }
-
-        // update the transformations
-        actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+        UpdateActorInstance(actorInstance, timePassedInSeconds);
 
         // recursively process the attachments
         const size_t numAttachments = actorInstance->GetNumAttachments();
@@ -15,6 +15,7 @@ set(FILES
     Source/ActorInstanceBus.h
     Source/ActorManager.cpp
     Source/ActorManager.h
+    Source/ActorUpdateScheduler.cpp
     Source/ActorUpdateScheduler.h
     Source/Algorithms.h
     Source/Allocators.cpp
@@ -95,6 +96,8 @@ set(FILES
     Source/PhysicsSetup.h
     Source/Pose.cpp
     Source/Pose.h
+    Source/PoseBlendKernels.cpp
+    Source/PoseBlendKernels.h
     Source/PoseData.cpp
     Source/PoseData.h
     Source/PoseDataFactory.cpp
@@ -103,6 +106,8 @@ set(FILES
     Source/PoseDataRagdoll.h
     Source/RagdollInstance.cpp
     Source/RagdollInstance.h
+    Source/RagdollPhysicsSync.cpp
+    Source/RagdollPhysicsSync.h
     Source/RagdollVelocityEvaluators.cpp
     Source/RagdollVelocityEvaluators.h
     Source/Recorder.cpp
@@ -179,6 +184,8 @@ set(FILES
     Source/AnimGraphObjectFactory.cpp
     Source/AnimGraphObjectFactory.h
     Source/AnimGraphObjectIds.h
+    Source/AnimGraphOutputCache.cpp
+    Source/AnimGraphOutputCache.h
     Source/AnimGraphPose.cpp
     Source/AnimGraphPose.h
     Source/AnimGraphPosePool.cpp
@@ -343,6 +350,8 @@ set(FILES
     Source/EventInfo.h
     Source/EventManager.cpp
     Source/EventManager.h
+    Source/MotionData/CompressedMotionData.cpp
+    Source/MotionData/CompressedMotionData.h
     Source/MotionData/MotionData.cpp
     Source/MotionData/MotionData.h
     Source/MotionData/MotionDataFactory.cpp
@@ -26,6 +26,8 @@
 
 #include <EMotionFX/Source/Transform.h>
 #include <EMotionFX/Source/RagdollInstance.h>
+#include <EMotionFX/Source/RagdollPhysicsSync.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
 #include <EMotionFX/Source/DebugDraw.h>
 #include <EMotionFX/Source/AttachmentSkin.h>
 #include <EMotionFX/Source/Node.h>
@@ -230,14 +232,6 @@ namespace EMotionFX
 
         //////////////////////////////////////////////////////////////////////////
         ActorComponent::ActorComponent(const Configuration* configuration)
-            : m_sceneFinishSimHandler([this]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle,
-                float fixedDeltatime)
-                {
-                    if (m_actorInstance)
-                    {
-                        m_actorInstance->PostPhysicsUpdate(fixedDeltatime);
-                    }
-                }, aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Animation))
         {
             if (configuration)
             {
@@ -285,7 +279,10 @@ namespace EMotionFX
             AzFramework::EntityDebugDisplayEventBus::Handler::BusDisconnect();
             AzFramework::RagdollPhysicsNotificationBus::Handler::BusDisconnect();
             AzFramework::CharacterPhysicsDataRequestBus::Handler::BusDisconnect();
-            m_sceneFinishSimHandler.Disconnect();
+            if (m_actorInstance)
+            {
+                GetRagdollPhysicsSync().UnregisterActorInstance(m_actorInstance.get());
+            }
             ActorComponentRequestBus::Handler::BusDisconnect();
             AZ::TickBus::Handler::BusDisconnect();
             ActorComponentNotificationBus::Handler::BusDisconnect();
@@ -412,7 +409,7 @@ namespace EMotionFX
 
         bool ActorComponent::IsPhysicsSceneSimulationFinishEventConnected() const
         {
-            return m_sceneFinishSimHandler.IsConnected();
+            return m_actorInstance && GetRagdollPhysicsSync().IsActorInstanceRegistered(m_actorInstance.get());
         }
 
         void ActorComponent::SetRenderFlag(ActorRenderFlags renderFlags)
@@ -737,12 +734,10 @@ namespace EMotionFX
             {
                 m_actorInstance->SetRagdoll(ragdoll);
 
-                RagdollInstance* ragdollInstance = m_actorInstance->GetRagdollInstance();
-                AZ_Assert(ragdollInstance, "As the ragdoll passed in ActorInstance::SetRagdoll() is valid, a valid ragdoll instance is expected to exist.");
-                if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
-                {
-                    sceneInterface->RegisterSceneSimulationFinishHandler(ragdollInstance->GetRagdollSceneHandle(), m_sceneFinishSimHandler);
-                }
+                AZ_Assert(m_actorInstance->GetRagdollInstance(), "As the ragdoll passed in ActorInstance::SetRagdoll() is valid, a valid ragdoll instance is expected to exist.");
+
+                // The ragdolls of all actor instances in the scene get synced together after each simulation step.
+                GetRagdollPhysicsSync().RegisterActorInstance(m_actorInstance.get());
             }
         }
 
@@ -750,7 +745,6 @@ namespace EMotionFX
         {
             if (m_actorInstance)
             {
-                m_sceneFinishSimHandler.Disconnect();
                 m_actorInstance->SetRagdoll(nullptr);
             }
         }
@@ -210,7 +210,6 @@ namespace EMotionFX
 
             AZStd::unique_ptr<RenderActorInstance>          m_renderActorInstance;
 
-            AzPhysics::SceneEvents::OnSceneSimulationFinishHandler m_sceneFinishSimHandler;
             bool m_processLoadedAsset = false;
         };
     } //namespace Integration
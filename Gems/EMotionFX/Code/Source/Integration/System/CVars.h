@@ -16,5 +16,11 @@ namespace EMotionFX::Integration
         static inline int emfx_updateEnabled = 1;
         static inline int emfx_ragdollManipulatorsEnabled = 1;
         static inline int emfx_actorRenderEnabled = 1;
+        static inline int emfx_updateLodEnabled = 0;
+        static inline int emfx_updateLodInterpolatePoses = 1;
+        static inline float emfx_updateLodReducedDistance = 15.0f;
+        static inline float emfx_updateLodLowDistance = 40.0f;
+        static inline float emfx_updateLodReducedRate = 20.0f;
+        static inline float emfx_updateLodLowRate = 8.0f;
     };
 };
@@ -17,6 +17,9 @@
 #include <AzFramework/Physics/CharacterBus.h>
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
 
+#include <Atom/RPI.Public/ViewportContext.h>
+#include <Atom/RPI.Public/ViewportContextBus.h>
+
 #include <EMotionFX/Source/Allocators.h>
 #include <EMotionFX/Source/SingleThreadScheduler.h>
 #include <EMotionFX/Source/EMotionFXManager.h>
@@ -36,6 +39,7 @@
 #include <EMotionFX/Source/AnimGraphSyncTrack.h>
 #include <EMotionFX/Source/AnimGraph.h>
 #include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/ActorUpdateScheduler.h>
 #include <EMotionFX/Source/ObjectId.h>
 
 #include <EMotionFX/Source/PhysicsSetup.h>
@@ -588,6 +592,24 @@ namespace EMotionFX
             REGISTER_CVAR2(
                 "emfx_ragdollManipulatorsEnabled", &CVars::emfx_ragdollManipulatorsEnabled, 1, VF_DEV_ONLY,
                 "Feature flag for in development ragdoll manipulators");
+            REGISTER_CVAR2(
+                "emfx_updateLodEnabled", &CVars::emfx_updateLodEnabled, 0, VF_NULL,
+                "Update visible actor instances at a lower rate the further away they are from the camera");
+            REGISTER_CVAR2(
+                "emfx_updateLodInterpolatePoses", &CVars::emfx_updateLodInterpolatePoses, 1, VF_NULL,
+                "Interpolate between sampled poses of actor instances that are updated at a lower rate");
+            REGISTER_CVAR2(
+                "emfx_updateLodReducedDistance", &CVars::emfx_updateLodReducedDistance, 15.0f, VF_NULL,
+                "Camera distance from which actor instances are updated at the reduced rate");
+            REGISTER_CVAR2(
+                "emfx_updateLodLowDistance", &CVars::emfx_updateLodLowDistance, 40.0f, VF_NULL,
+                "Camera distance from which actor instances are updated at the low rate");
+            REGISTER_CVAR2(
+                "emfx_updateLodReducedRate", &CVars::emfx_updateLodReducedRate, 20.0f, VF_NULL,
+                "Number of times per second motions are sampled for actor instances at the reduced update rate");
+            REGISTER_CVAR2(
+                "emfx_updateLodLowRate", &CVars::emfx_updateLodLowRate, 8.0f, VF_NULL,
+                "Number of times per second motions are sampled for actor instances at the low update rate");
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -595,12 +617,52 @@ namespace EMotionFX
         {
             gEnv->pConsole->UnregisterVariable("emfx_updateEnabled");
             gEnv->pConsole->UnregisterVariable("emfx_ragdollManipulatorsEnabled");
+            gEnv->pConsole->UnregisterVariable("emfx_updateLodEnabled");
+            gEnv->pConsole->UnregisterVariable("emfx_updateLodInterpolatePoses");
+            gEnv->pConsole->UnregisterVariable("emfx_updateLodReducedDistance");
+            gEnv->pConsole->UnregisterVariable("emfx_updateLodLowDistance");
+            gEnv->pConsole->UnregisterVariable("emfx_updateLodReducedRate");
+            gEnv->pConsole->UnregisterVariable("emfx_updateLodLowRate");
 
 #if !defined(AZ_MONOLITHIC_BUILD)
             gEnv = nullptr;
 #endif
         }
 
+        //////////////////////////////////////////////////////////////////////////
+        void SystemComponent::UpdateSchedulerLodSettings()
+        {
+            ActorUpdateScheduler* scheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+            if (!scheduler)
+            {
+                return;
+            }
+
+            ActorUpdateScheduler::UpdateLodSettings settings = scheduler->GetUpdateLodSettings();
+            settings.m_enabled = CVars::emfx_updateLodEnabled != 0;
+            settings.m_interpolatePoses = CVars::emfx_updateLodInterpolatePoses != 0;
+            settings.m_reducedDistance = CVars::emfx_updateLodReducedDistance;
+            settings.m_lowDistance = AZ::GetMax(CVars::emfx_updateLodLowDistance, CVars::emfx_updateLodReducedDistance);
+            settings.m_reducedSamplingRate = CVars::emfx_updateLodReducedRate > 0.0f ? 1.0f / CVars::emfx_updateLodReducedRate : 0.0f;
+            settings.m_lowSamplingRate = CVars::emfx_updateLodLowRate > 0.0f ? 1.0f / CVars::emfx_updateLodLowRate : 0.0f;
+
+            if (settings.m_enabled)
+            {
+                // Measure the distances from the camera of the default viewport, same as the simple LOD component does.
+                if (auto viewportContextManager = AZ::Interface<AZ::RPI::ViewportContextRequestsInterface>::Get())
+                {
+                    AZ::RPI::ViewportContextPtr defaultViewportContext =
+                        viewportContextManager->GetViewportContextByName(viewportContextManager->GetDefaultViewportContextName());
+                    if (defaultViewportContext)
+                    {
+                        settings.m_viewPosition = defaultViewportContext->GetCameraTransform().GetTranslation();
+                    }
+                }
+            }
+
+            scheduler->SetUpdateLodSettings(settings);
+        }
+
         //////////////////////////////////////////////////////////////////////////
         void SystemComponent::OnTick(float delta, [[maybe_unused]]AZ::ScriptTimePoint timePoint)
         {
@@ -609,6 +671,8 @@ namespace EMotionFX
 
             if (CVars::emfx_updateEnabled)
             {
+                UpdateSchedulerLodSettings();
+
                 // Main EMotionFX runtime update.
                 GetEMotionFX().Update(delta);
 
@@ -143,6 +143,9 @@ namespace EMotionFX
             //! velocity will be applied to it to move it towards the actor instance.
             void ApplyMotionExtraction(const ActorInstance* actorInstance, float timeDelta);
 
+            //! Pass the update LOD cvars and the camera position of the default viewport to the actor update scheduler.
+            void UpdateSchedulerLodSettings();
+
             AZStd::vector<AZStd::unique_ptr<AZ::Data::AssetHandler> > m_assetHandlers;
             AZStd::unique_ptr<EMotionFXEventHandler> m_eventHandler;
             AZStd::unique_ptr<RenderBackendManager> m_renderBackendManager;
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/AnimGraphBindPoseNode.h>
+#include <EMotionFX/Source/AnimGraphInstance.h>
+#include <EMotionFX/Source/AnimGraphManager.h>
+#include <EMotionFX/Source/AnimGraphOutputCache.h>
+#include <EMotionFX/Source/AnimGraphStateMachine.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/Parameter/FloatSliderParameter.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <MCore/Source/AttributeFloat.h>
+#include <Tests/AnimGraphFixture.h>
+#include <Tests/Matchers.h>
+
+namespace EMotionFX
+{
+    class AnimGraphOutputCacheFixture
+        : public AnimGraphFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AnimGraphFixture::SetUp();
+            AddValueParameter(azrtti_typeid<FloatSliderParameter>(), "floatParam");
+
+            // A second character running the same anim graph.
+            m_otherActorInstance = ActorInstance::Create(m_actor.get());
+            m_otherAnimGraphInstance = AnimGraphInstance::Create(m_animGraph.get(), m_otherActorInstance, m_motionSet);
+            m_otherActorInstance->SetAnimGraphInstance(m_otherAnimGraphInstance);
+
+            m_animGraphInstance->SetOutputCacheEnabled(true);
+            m_otherAnimGraphInstance->SetOutputCacheEnabled(true);
+
+            GetOutputCache().Clear();
+            GetOutputCache().ResetStats();
+        }
+
+        void TearDown() override
+        {
+            GetOutputCache().Clear();
+            m_otherActorInstance->Destroy();
+            AnimGraphFixture::TearDown();
+        }
+
+        void ConstructGraph() override
+        {
+            AnimGraphFixture::ConstructGraph();
+            AnimGraphBindPoseNode* bindPoseNode = aznew AnimGraphBindPoseNode();
+            m_rootStateMachine->AddChildNode(bindPoseNode);
+            m_rootStateMachine->SetEntryState(bindPoseNode);
+        }
+
+        void UpdateBoth()
+        {
+            GetOutputCache().Clear();
+            m_actorInstance->UpdateTransformations(0.0f);
+            m_otherActorInstance->UpdateTransformations(0.0f);
+        }
+
+        AnimGraphOutputCache& GetOutputCache()
+        {
+            return GetAnimGraphManager().GetOutputCache();
+        }
+
+    protected:
+        ActorInstance* m_otherActorInstance = nullptr;
+        AnimGraphInstance* m_otherAnimGraphInstance = nullptr;
+    };
+
+    TEST_F(AnimGraphOutputCacheFixture, IdenticalInstancesShareOutput)
+    {
+        UpdateBoth();
+
+        // The first instance calculates the pose, the second one copies it.
+        EXPECT_EQ(GetOutputCache().GetNumMisses(), 1);
+        EXPECT_EQ(GetOutputCache().GetNumHits(), 1);
+        EXPECT_EQ(GetOutputCache().GetNumCachedPoses(), 1);
+
+        const Pose* pose = m_actorInstance->GetTransformData()->GetCurrentPose();
+        const Pose* otherPose = m_otherActorInstance->GetTransformData()->GetCurrentPose();
+        ASSERT_EQ(pose->GetNumTransforms(), otherPose->GetNumTransforms());
+        for (size_t i = 0; i < pose->GetNumTransforms(); ++i)
+        {
+            EXPECT_THAT(otherPose->GetLocalSpaceTransform(i), IsClose(pose->GetLocalSpaceTransform(i)));
+        }
+    }
+
+    TEST_F(AnimGraphOutputCacheFixture, DifferentParametersDontShareOutput)
+    {
+        static_cast<MCore::AttributeFloat*>(m_otherAnimGraphInstance->GetParameterValue(0))->SetValue(0.5f);
+        UpdateBoth();
+
+        EXPECT_EQ(GetOutputCache().GetNumMisses(), 2);
+        EXPECT_EQ(GetOutputCache().GetNumHits(), 0);
+        EXPECT_EQ(GetOutputCache().GetNumCachedPoses(), 2);
+    }
+
+    TEST_F(AnimGraphOutputCacheFixture, DisabledInstancesDontUseCache)
+    {
+        m_otherAnimGraphInstance->SetOutputCacheEnabled(false);
+        UpdateBoth();
+
+        EXPECT_EQ(GetOutputCache().GetNumMisses(), 1);
+        EXPECT_EQ(GetOutputCache().GetNumHits(), 0);
+    }
+} // namespace EMotionFX
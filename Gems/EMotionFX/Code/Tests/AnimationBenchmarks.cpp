@@ -0,0 +1,395 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/optional.h>
+#include <AzTest/Utils.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/AnimGraphInstance.h>
+#include <EMotionFX/Source/AnimGraphMotionNode.h>
+#include <EMotionFX/Source/BlendTree.h>
+#include <EMotionFX/Source/BlendTreeBlend2Node.h>
+#include <EMotionFX/Source/BlendTreeFinalNode.h>
+#include <EMotionFX/Source/BlendTreeFloatConstantNode.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/Motion.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <EMotionFX/Source/MotionSet.h>
+#include <EMotionFX/Source/MultiThreadScheduler.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/SingleThreadScheduler.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/AnimGraphFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+namespace EMotionFX
+{
+    using AnimationBenchmarkApp = ComponentFixtureApp<
+        AZ::AssetManagerComponent,
+        AZ::JobManagerComponent,
+        AZ::StreamerComponent,
+        Physics::MaterialSystemComponent,
+        EMotionFX::Integration::SystemComponent
+    >;
+
+    /**
+     * Base fixture for the animation benchmarks. Starts the same minimal application the SystemComponentFixture uses for the unit tests,
+     * so that the EMotionFX runtime is available, and provides helpers to build actors, motions and blend trees of a given size.
+     * The application is started in SetUp and not in the constructor, as google benchmark constructs all fixtures at static init time.
+     */
+    class AnimationBenchmarkFixture
+        : public benchmark::Fixture
+    {
+    public:
+        static constexpr size_t s_numMotionSamples = 301; /**< Ten seconds at 30 fps. */
+        static constexpr float s_timeDelta = 1.0f / 60.0f;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+
+        void SetUp(benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+
+        void TearDown(benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+
+    protected:
+        virtual void InternalSetUp([[maybe_unused]] const benchmark::State& state)
+        {
+            m_app.emplace();
+
+            AZ::ComponentApplication::StartupParameters startupParameters;
+            startupParameters.m_loadAssetCatalog = false;
+            startupParameters.m_loadSettingsRegistry = false;
+            if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+            {
+                AZ::Test::AddActiveGem("EMotionFX", *settingsRegistry);
+            }
+            m_app->Start(AZ::ComponentApplication::Descriptor{}, startupParameters);
+            AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::DisableSaveOnFinalize);
+
+            AZ::SerializeContext* serializeContext = nullptr;
+            AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
+            AnimGraphFactory::ReflectTestTypes(serializeContext);
+
+            m_motionSet = aznew MotionSet("benchmarkMotionSet");
+        }
+
+        virtual void InternalTearDown([[maybe_unused]] const benchmark::State& state)
+        {
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                if (AnimGraphInstance* animGraphInstance = actorInstance->GetAnimGraphInstance())
+                {
+                    animGraphInstance->Destroy();
+                }
+                actorInstance->Destroy();
+            }
+            m_actorInstances.clear();
+
+            delete m_motionSet;
+            m_motionSet = nullptr;
+            m_animGraph.reset();
+            m_actor.reset();
+
+            EMotionFX::Integration::ActorNotificationBus::ClearQueuedEvents();
+            m_app->Stop();
+            m_app.reset();
+        }
+
+        void CreateActor(size_t numJoints)
+        {
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(numJoints);
+        }
+
+        ActorInstance* CreateActorInstance()
+        {
+            ActorInstance* actorInstance = ActorInstance::Create(m_actor.get());
+            actorInstance->SetIsVisible(true);
+            m_actorInstances.emplace_back(actorInstance);
+            return actorInstance;
+        }
+
+        /**
+         * Add a uniformly sampled motion that animates the rotations and positions of all joints of the actor.
+         * The joint names match the ones of the actor, so that all joints get sampled.
+         */
+        Motion* AddMotion(const char* motionId)
+        {
+            const Skeleton* skeleton = m_actor->GetSkeleton();
+            const size_t numJoints = skeleton->GetNumNodes();
+
+            UniformMotionData* motionData = aznew UniformMotionData();
+            UniformMotionData::InitSettings settings;
+            settings.m_numJoints = numJoints;
+            settings.m_numSamples = s_numMotionSamples;
+            settings.m_sampleRate = 30.0f;
+            motionData->Init(settings);
+
+            AZ::SimpleLcgRandom random(1234);
+            for (size_t jointIndex = 0; jointIndex < numJoints; ++jointIndex)
+            {
+                motionData->SetJointName(jointIndex, skeleton->GetNode(jointIndex)->GetNameString());
+                const Transform& bindTransform = m_actor->GetBindPose()->GetLocalSpaceTransform(jointIndex);
+                for (size_t sampleIndex = 0; sampleIndex < s_numMotionSamples; ++sampleIndex)
+                {
+                    const AZ::Vector3 axis = AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat() + 0.1f).GetNormalized();
+                    motionData->SetJointRotationSample(jointIndex, sampleIndex, AZ::Quaternion::CreateFromAxisAngle(axis, random.GetRandomFloat()));
+                    motionData->SetJointPositionSample(jointIndex, sampleIndex, bindTransform.m_position + AZ::Vector3(random.GetRandomFloat() * 0.1f));
+                }
+            }
+
+            Motion* motion = aznew Motion(motionId);
+            motion->SetMotionData(motionData);
+            m_motionSet->AddMotionEntry(aznew MotionSet::MotionEntry(motion->GetName(), motion->GetName(), motion));
+            return motion;
+        }
+
+        /**
+         * Build a blend tree with a chain of the given number of blend 2 nodes, each blending the result of the previous one with another motion.
+         * All blend weights are connected to a constant of 0.5, so that both inputs of every blend node get evaluated.
+         */
+        void CreateBlendTreeAnimGraph(size_t numBlendNodes, const char* motionId)
+        {
+            m_animGraph = AnimGraphFactory::Create<OneBlendTreeNodeAnimGraph>();
+            BlendTree* blendTree = m_animGraph->GetBlendTreeNode();
+
+            BlendTreeFloatConstantNode* weightNode = aznew BlendTreeFloatConstantNode();
+            weightNode->SetValue(0.5f);
+            blendTree->AddChildNode(weightNode);
+
+            const auto addMotionNode = [blendTree, motionId]()
+            {
+                AnimGraphMotionNode* motionNode = aznew AnimGraphMotionNode();
+                motionNode->AddMotionId(motionId);
+                blendTree->AddChildNode(motionNode);
+                return motionNode;
+            };
+
+            AnimGraphNode* lastNode = addMotionNode();
+            for (size_t i = 0; i < numBlendNodes; ++i)
+            {
+                BlendTreeBlend2Node* blendNode = aznew BlendTreeBlend2Node();
+                blendTree->AddChildNode(blendNode);
+                blendNode->AddConnection(lastNode, AnimGraphMotionNode::PORTID_OUTPUT_POSE, BlendTreeBlend2Node::PORTID_INPUT_POSE_A);
+                blendNode->AddConnection(addMotionNode(), AnimGraphMotionNode::PORTID_OUTPUT_POSE, BlendTreeBlend2Node::PORTID_INPUT_POSE_B);
+                blendNode->AddConnection(weightNode, BlendTreeFloatConstantNode::PORTID_OUTPUT_RESULT, BlendTreeBlend2Node::PORTID_INPUT_WEIGHT);
+                lastNode = blendNode;
+            }
+
+            BlendTreeFinalNode* finalNode = aznew BlendTreeFinalNode();
+            blendTree->AddChildNode(finalNode);
+            finalNode->AddConnection(lastNode, BlendTreeBlend2Node::PORTID_OUTPUT_POSE, BlendTreeFinalNode::PORTID_INPUT_POSE);
+
+            m_animGraph->InitAfterLoading();
+        }
+
+        AZStd::optional<AnimationBenchmarkApp> m_app;
+        AZStd::unique_ptr<Actor> m_actor;
+        AZStd::unique_ptr<OneBlendTreeNodeAnimGraph> m_animGraph;
+        AZStd::vector<ActorInstance*> m_actorInstances;
+        MotionSet* m_motionSet = nullptr;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    // Evaluates a blend tree with a chain of range(0) blend nodes on a 64 joint actor.
+    BENCHMARK_DEFINE_F(AnimationBenchmarkFixture, AnimGraphEvaluation)(benchmark::State& state)
+    {
+        const size_t numBlendNodes = aznumeric_cast<size_t>(state.range(0));
+        CreateActor(64);
+        AddMotion("benchmarkMotion");
+        CreateBlendTreeAnimGraph(numBlendNodes, "benchmarkMotion");
+
+        ActorInstance* actorInstance = CreateActorInstance();
+        m_animGraph->GetAnimGraphInstance(actorInstance, m_motionSet);
+        actorInstance->UpdateTransformations(0.0f);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            actorInstance->UpdateTransformations(s_timeDelta);
+        }
+
+        state.counters["Nodes"] = aznumeric_cast<double>(m_animGraph->RecursiveCalcNumNodes());
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(AnimationBenchmarkFixture, AnimGraphEvaluation)
+        ->RangeMultiplier(4)
+        ->Range(1, 256)
+        ->Unit(benchmark::kMicrosecond);
+
+    // Blends two poses of an actor with range(0) joints.
+    BENCHMARK_DEFINE_F(AnimationBenchmarkFixture, PoseBlend)(benchmark::State& state)
+    {
+        const size_t numJoints = aznumeric_cast<size_t>(state.range(0));
+        CreateActor(numJoints);
+        ActorInstance* actorInstance = CreateActorInstance();
+
+        Pose sourcePose;
+        Pose targetPose;
+        sourcePose.InitFromBindPose(actorInstance);
+        targetPose.InitFromBindPose(actorInstance);
+
+        AZ::SimpleLcgRandom random(5678);
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            Transform transform = targetPose.GetLocalSpaceTransform(i);
+            transform.m_rotation = AZ::Quaternion::CreateRotationZ(random.GetRandomFloat());
+            transform.m_position += AZ::Vector3(random.GetRandomFloat());
+            targetPose.SetLocalSpaceTransform(i, transform);
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            sourcePose.Blend(&targetPose, 0.5f);
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(AnimationBenchmarkFixture, PoseBlend)
+        ->RangeMultiplier(4)
+        ->Range(16, 1024)
+        ->Unit(benchmark::kMicrosecond);
+
+    // Samples a uniformly sampled motion for all range(0) joints of an actor at varying times.
+    BENCHMARK_DEFINE_F(AnimationBenchmarkFixture, MotionSampling)(benchmark::State& state)
+    {
+        const size_t numJoints = aznumeric_cast<size_t>(state.range(0));
+        CreateActor(numJoints);
+        Motion* motion = AddMotion("benchmarkMotion");
+        ActorInstance* actorInstance = CreateActorInstance();
+
+        Pose outputPose;
+        outputPose.InitFromBindPose(actorInstance);
+
+        MotionDataSampleSettings sampleSettings;
+        sampleSettings.m_actorInstance = actorInstance;
+        sampleSettings.m_inputPose = actorInstance->GetTransformData()->GetBindPose();
+
+        const float duration = motion->GetMotionData()->GetDuration();
+        float sampleTime = 0.0f;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            sampleSettings.m_sampleTime = sampleTime;
+            motion->SamplePose(&outputPose, sampleSettings);
+            benchmark::ClobberMemory();
+
+            sampleTime += s_timeDelta;
+            if (sampleTime > duration)
+            {
+                sampleTime -= duration;
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(AnimationBenchmarkFixture, MotionSampling)
+        ->RangeMultiplier(4)
+        ->Range(16, 1024)
+        ->Unit(benchmark::kMicrosecond);
+
+    // Calculates the skinning matrices of an actor with range(0) joints.
+    BENCHMARK_DEFINE_F(AnimationBenchmarkFixture, SkinningMatrices)(benchmark::State& state)
+    {
+        CreateActor(aznumeric_cast<size_t>(state.range(0)));
+        ActorInstance* actorInstance = CreateActorInstance();
+        actorInstance->UpdateTransformations(0.0f);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            actorInstance->UpdateSkinningMatrices();
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(AnimationBenchmarkFixture, SkinningMatrices)
+        ->RangeMultiplier(4)
+        ->Range(16, 1024)
+        ->Unit(benchmark::kMicrosecond);
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    /**
+     * Updates range(0) actor instances through the actor manager using the single threaded scheduler (range(1) = 0)
+     * or the multi threaded scheduler (range(1) = 1). Each actor instance evaluates its own instance of a shared blend tree.
+     */
+    class SchedulerBenchmarkFixture
+        : public AnimationBenchmarkFixture
+    {
+    protected:
+        void InternalSetUp(const benchmark::State& state) override
+        {
+            AnimationBenchmarkFixture::InternalSetUp(state);
+
+            // The scheduler has to be set before creating the actor instances, as they get inserted into the scheduler on creation.
+            const bool multiThreaded = state.range(1) != 0;
+            if (multiThreaded)
+            {
+                GetActorManager().SetScheduler(MultiThreadScheduler::Create());
+            }
+            else
+            {
+                GetActorManager().SetScheduler(SingleThreadScheduler::Create());
+            }
+
+            CreateActor(64);
+            AddMotion("benchmarkMotion");
+            CreateBlendTreeAnimGraph(4, "benchmarkMotion");
+
+            const size_t numActorInstances = aznumeric_cast<size_t>(state.range(0));
+            for (size_t i = 0; i < numActorInstances; ++i)
+            {
+                ActorInstance* actorInstance = CreateActorInstance();
+                m_animGraph->GetAnimGraphInstance(actorInstance, m_motionSet);
+            }
+
+            GetEMotionFX().Update(0.0f);
+        }
+    };
+
+    BENCHMARK_DEFINE_F(SchedulerBenchmarkFixture, ActorManagerUpdate)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            GetEMotionFX().Update(s_timeDelta);
+        }
+
+        state.SetLabel(state.range(1) != 0 ? "MultiThreadScheduler" : "SingleThreadScheduler");
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SchedulerBenchmarkFixture, ActorManagerUpdate)
+        ->ArgNames({ "ActorInstances", "MultiThreaded" })
+        ->Args({ 1, 0 })->Args({ 1, 1 })
+        ->Args({ 16, 0 })->Args({ 16, 1 })
+        ->Args({ 64, 0 })->Args({ 64, 1 })
+        ->Args({ 256, 0 })->Args({ 256, 1 })
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+} // namespace EMotionFX
+
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/UnitTest/UnitTest.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <MCore/Source/MemoryFile.h>
+#include <Tests/Matchers.h>
+#include <Tests/SystemComponentFixture.h>
+
+namespace EMotionFX
+{
+    class CompressedMotionDataTests
+        : public SystemComponentFixture
+    {
+    public:
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+            m_sourceData = AZStd::make_unique<NonUniformMotionData>();
+
+            // One second of motion with an animated joint, a joint that doesn't move and an animated morph.
+            m_sourceData->AddJoint("animated", Transform::CreateIdentity(), Transform::CreateIdentity());
+            m_sourceData->AddJoint("constant", Transform::CreateIdentity(), Transform::CreateIdentity());
+            m_sourceData->AddMorph("morph", 0.0f);
+
+            const size_t numSamples = 31;
+            m_sourceData->AllocateJointPositionSamples(0, numSamples);
+            m_sourceData->AllocateJointRotationSamples(0, numSamples);
+            m_sourceData->AllocateJointPositionSamples(1, numSamples);
+            m_sourceData->AllocateMorphSamples(0, numSamples);
+            for (size_t s = 0; s < numSamples; ++s)
+            {
+                const float time = s / 30.0f;
+                const AZ::Vector3 position(AZ::Sin(time * AZ::Constants::TwoPi), time * 2.0f, AZ::Cos(time * 3.0f) * 0.5f);
+                const AZ::Quaternion rotation = AZ::Quaternion::CreateRotationZ(time * AZ::Constants::TwoPi) * AZ::Quaternion::CreateRotationX(time);
+                m_sourceData->SetJointPositionSample(0, s, { time, position });
+                m_sourceData->SetJointRotationSample(0, s, { time, rotation });
+                m_sourceData->SetJointPositionSample(1, s, { time, AZ::Vector3(1.0f, 2.0f, 3.0f) });
+                m_sourceData->SetMorphSample(0, s, { time, time });
+            }
+            m_sourceData->UpdateDuration();
+        }
+
+        void TearDown() override
+        {
+            m_sourceData.reset();
+            SystemComponentFixture::TearDown();
+        }
+
+        void ExpectSameAsSource(const CompressedMotionData& motionData, float maxPosError, float maxRotError, float maxMorphError) const
+        {
+            for (size_t s = 0; s < motionData.GetNumSamples(); ++s)
+            {
+                const float time = s * motionData.GetSampleSpacing();
+                for (size_t joint = 0; joint < m_sourceData->GetNumJoints(); ++joint)
+                {
+                    const Transform expected = m_sourceData->SampleJointTransform(time, joint);
+                    const Transform sampled = motionData.SampleJointTransform(time, joint);
+                    EXPECT_LE(sampled.m_position.GetDistance(expected.m_position), maxPosError);
+                    const float angle = AZ::RadToDeg(2.0f * AZ::Acos(AZ::GetMin(AZ::GetAbs(sampled.m_rotation.Dot(expected.m_rotation)), 1.0f)));
+                    EXPECT_LE(angle, maxRotError);
+                }
+                EXPECT_NEAR(motionData.SampleMorph(time, 0), m_sourceData->SampleMorph(time, 0), maxMorphError);
+            }
+        }
+
+    protected:
+        AZStd::unique_ptr<NonUniformMotionData> m_sourceData;
+    };
+
+    TEST_F(CompressedMotionDataTests, InitFromNonUniformData)
+    {
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(m_sourceData.get(), /*keepSameSampleRate=*/false, /*newSampleRate=*/30.0f);
+        EXPECT_EQ(motionData.GetNumSamples(), 31);
+        EXPECT_FLOAT_EQ(motionData.GetDuration(), 1.0f);
+        EXPECT_TRUE(motionData.IsJointPositionAnimated(0));
+        EXPECT_TRUE(motionData.IsJointRotationAnimated(0));
+        EXPECT_TRUE(motionData.IsJointPositionAnimated(1));
+        EXPECT_TRUE(motionData.IsMorphAnimated(0));
+
+        // Until the data gets optimized, all channels are stored as uncompressed floats.
+        EXPECT_EQ(motionData.GetNumBitsPerFrame(), (3 + 4 + 3 + 1) * CompressedMotionData::s_rawBitRate);
+        ExpectSameAsSource(motionData, 0.0001f, 0.01f, 0.0001f);
+    }
+
+    TEST_F(CompressedMotionDataTests, OptimizeWithinErrorLimits)
+    {
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(m_sourceData.get(), /*keepSameSampleRate=*/false, /*newSampleRate=*/30.0f);
+        const size_t rawSize = motionData.GetBitStreamSizeInBytes();
+
+        MotionData::OptimizeSettings settings;
+        settings.m_maxPosError = 0.001f;
+        settings.m_maxRotError = 0.05f;
+        settings.m_maxMorphError = 0.001f;
+        motionData.Optimize(settings);
+
+        // The joint that doesn't move only has a static position left.
+        EXPECT_FALSE(motionData.IsJointAnimated(1));
+        EXPECT_THAT(motionData.GetJointStaticPosition(1), IsClose(AZ::Vector3(1.0f, 2.0f, 3.0f)));
+        EXPECT_EQ(motionData.GetNumChannels(), 3);
+        EXPECT_LT(motionData.GetBitStreamSizeInBytes() * 3, rawSize);
+        ExpectSameAsSource(motionData, settings.m_maxPosError, settings.m_maxRotError, settings.m_maxMorphError);
+    }
+
+    TEST_F(CompressedMotionDataTests, SaveAndRead)
+    {
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(m_sourceData.get(), /*keepSameSampleRate=*/false, /*newSampleRate=*/30.0f);
+        MotionData::OptimizeSettings optimizeSettings;
+        motionData.Optimize(optimizeSettings);
+
+        MCore::MemoryFile file;
+        file.Open();
+        MotionData::SaveSettings saveSettings;
+        ASSERT_TRUE(motionData.Save(&file, saveSettings));
+        EXPECT_EQ(file.GetFileSize(), motionData.CalcStreamSaveSizeInBytes(saveSettings));
+
+        CompressedMotionData loadedData;
+        file.Seek(0);
+        MotionData::ReadSettings readSettings;
+        ASSERT_TRUE(loadedData.Read(&file, readSettings));
+        EXPECT_EQ(loadedData.GetNumSamples(), motionData.GetNumSamples());
+        EXPECT_EQ(loadedData.GetNumChannels(), motionData.GetNumChannels());
+        EXPECT_EQ(loadedData.GetNumBitsPerFrame(), motionData.GetNumBitsPerFrame());
+        EXPECT_EQ(loadedData.GetJointName(0), "animated");
+        EXPECT_EQ(loadedData.GetMorphName(0), "morph");
+
+        for (size_t s = 0; s < motionData.GetNumSamples(); ++s)
+        {
+            const float time = s * motionData.GetSampleSpacing() * 0.5f;
+            EXPECT_THAT(loadedData.SampleJointTransform(time, 0), IsClose(motionData.SampleJointTransform(time, 0)));
+            EXPECT_FLOAT_EQ(loadedData.SampleMorph(time, 0), motionData.SampleMorph(time, 0));
+        }
+    }
+} // namespace EMotionFX
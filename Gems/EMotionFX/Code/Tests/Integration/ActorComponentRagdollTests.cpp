@@ -10,7 +10,10 @@
 #include <AzFramework/Components/TransformComponent.h>
 #include <Integration/Components/ActorComponent.h>
 #include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
 #include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/RagdollPhysicsSync.h>
 #include <Tests/Integration/EntityComponentFixture.h>
 #include <Tests/TestAssetCode/JackActor.h>
 #include <Tests/TestAssetCode/TestActorAssets.h>
@@ -118,4 +121,55 @@ namespace EMotionFX
         EXPECT_FALSE(actorComponent->IsPhysicsSceneSimulationFinishEventConnected())
             << "Scene Finish Simulation handler should not be connected anymore after deactivating the entire entity.";
     }
+
+    TEST_F(EntityComponentFixture, RagdollPhysicsSync_SharesSceneHandler)
+    {
+        AzPhysics::SceneEvents::OnSceneSimulationFinishEvent sceneFinishSimEvent;
+
+        Physics::MockPhysicsSceneInterface mockSceneInterface;
+        EXPECT_CALL(mockSceneInterface, RegisterSceneSimulationFinishHandler)
+            .Times(1)
+            .WillRepeatedly([&sceneFinishSimEvent](
+                [[maybe_unused]] AzPhysics::SceneHandle sceneHandle,
+                AzPhysics::SceneEvents::OnSceneSimulationFinishHandler& handler)
+                {
+                    handler.Connect(sceneFinishSimEvent);
+                });
+
+        AZStd::unique_ptr<Actor> actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        RagdollPhysicsSync& ragdollPhysicsSync = GetRagdollPhysicsSync();
+
+        constexpr size_t numActorInstances = 3;
+        AZStd::vector<AZStd::unique_ptr<TestRagdoll>> ragdolls;
+        AZStd::vector<ActorInstance*> actorInstances;
+        for (size_t i = 0; i < numActorInstances; ++i)
+        {
+            ragdolls.emplace_back(AZStd::make_unique<TestRagdoll>());
+            TestRagdoll* ragdoll = ragdolls.back().get();
+            EXPECT_CALL(*ragdoll, GetNumNodes()).WillRepeatedly(::testing::Return(1));
+            EXPECT_CALL(*ragdoll, IsSimulated()).WillRepeatedly(::testing::Return(true));
+            EXPECT_CALL(*ragdoll, GetPosition()).WillRepeatedly(::testing::Return(AZ::Vector3::CreateZero()));
+            EXPECT_CALL(*ragdoll, GetOrientation()).WillRepeatedly(::testing::Return(AZ::Quaternion::CreateIdentity()));
+
+            // Read once when creating the ragdoll instance and once by the sync after the simulation step.
+            EXPECT_CALL(*ragdoll, GetState(::testing::_)).Times(2);
+
+            ActorInstance* actorInstance = ActorInstance::Create(actor.get());
+            actorInstance->SetRagdoll(ragdoll);
+            ragdollPhysicsSync.RegisterActorInstance(actorInstance);
+            actorInstances.emplace_back(actorInstance);
+        }
+
+        EXPECT_EQ(ragdollPhysicsSync.GetNumActorInstances(AzPhysics::InvalidSceneHandle), numActorInstances);
+        sceneFinishSimEvent.Signal(AzPhysics::InvalidSceneHandle, 1.0f / 60.0f);
+
+        for (ActorInstance* actorInstance : actorInstances)
+        {
+            EXPECT_TRUE(ragdollPhysicsSync.IsActorInstanceRegistered(actorInstance));
+            actorInstance->Destroy();
+        }
+
+        EXPECT_EQ(ragdollPhysicsSync.GetNumActorInstances(AzPhysics::InvalidSceneHandle), 0);
+        EXPECT_FALSE(sceneFinishSimEvent.HasHandlerConnected());
+    }
 }
@@ -44,4 +44,91 @@ namespace EMotionFX
 
         actorInstance->Destroy();
     }
+
+    TEST_F(SystemComponentFixture, UpdateLodByDistanceAndVisibility)
+    {
+        ActorUpdateScheduler* scheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+        AZStd::unique_ptr<JackNoMeshesActor> actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        ActorInstance* actorInstance = ActorInstance::Create(actor.get());
+
+        // Without update LOD, visible actor instances always get the full update.
+        ActorUpdateScheduler::UpdateLodSettings settings;
+        settings.m_viewPosition = AZ::Vector3(100.0f, 0.0f, 0.0f);
+        scheduler->SetUpdateLodSettings(settings);
+        scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->CalcUpdateLod(actorInstance), ActorUpdateScheduler::UPDATELOD_FULL);
+        EXPECT_EQ(scheduler->GetNumActorInstancesInUpdateLod(ActorUpdateScheduler::UPDATELOD_FULL), 1);
+        EXPECT_FALSE(actorInstance->GetSampledPoseInterpolationEnabled());
+
+        settings.m_enabled = true;
+        settings.m_viewPosition = AZ::Vector3(settings.m_reducedDistance + 1.0f, 0.0f, 0.0f);
+        scheduler->SetUpdateLodSettings(settings);
+        scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetNumActorInstancesInUpdateLod(ActorUpdateScheduler::UPDATELOD_FULL), 0);
+        EXPECT_EQ(scheduler->GetNumActorInstancesInUpdateLod(ActorUpdateScheduler::UPDATELOD_REDUCED), 1);
+        EXPECT_TRUE(actorInstance->GetSampledPoseInterpolationEnabled());
+
+        settings.m_viewPosition = AZ::Vector3(settings.m_lowDistance + 1.0f, 0.0f, 0.0f);
+        scheduler->SetUpdateLodSettings(settings);
+        scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetNumActorInstancesInUpdateLod(ActorUpdateScheduler::UPDATELOD_LOW), 1);
+
+        // Motions are sampled at the low rate only, the frames in between interpolate the sampled poses.
+        size_t numSampled = 0;
+        for (size_t i = 0; i < 60; ++i)
+        {
+            scheduler->Execute(1.0f / 60.0f);
+            numSampled += scheduler->GetNumSampledActorInstances();
+        }
+        EXPECT_LE(numSampled, static_cast<size_t>(1.0f / settings.m_lowSamplingRate) + 1);
+        EXPECT_GE(numSampled, static_cast<size_t>(1.0f / settings.m_lowSamplingRate) - 1);
+
+        // Off-screen actor instances only update their root motion, whatever their distance.
+        actorInstance->SetIsVisible(false);
+        scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetNumActorInstancesInUpdateLod(ActorUpdateScheduler::UPDATELOD_LOW), 0);
+        EXPECT_EQ(scheduler->GetNumActorInstancesInUpdateLod(ActorUpdateScheduler::UPDATELOD_ROOTMOTIONONLY), 1);
+        EXPECT_EQ(scheduler->GetNumVisibleActorInstances(), 0);
+
+        scheduler->SetUpdateLodSettings(ActorUpdateScheduler::UpdateLodSettings());
+        actorInstance->Destroy();
+    }
+
+    TEST_F(SystemComponentFixture, BatchesActorInstanceUpdates)
+    {
+        ActorUpdateScheduler* baseScheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+        ASSERT_EQ(baseScheduler->GetType(), MultiThreadScheduler::TYPE_ID) << "Expected multi thread scheduler.";
+        MultiThreadScheduler* scheduler = static_cast<MultiThreadScheduler*>(baseScheduler);
+
+        AZStd::unique_ptr<JackNoMeshesActor> actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        constexpr size_t numActorInstances = 64;
+        AZStd::vector<ActorInstance*> actorInstances;
+        for (size_t i = 0; i < numActorInstances; ++i)
+        {
+            actorInstances.emplace_back(ActorInstance::Create(actor.get()));
+        }
+
+        // A disabled actor instance isn't part of any batch.
+        actorInstances[0]->SetIsEnabled(false);
+
+        // With a target batch duration this long compared to the update cost, the batches are only limited by the number of workers.
+        scheduler->SetTargetBatchDuration(1000000.0f);
+        scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetNumUpdatedActorInstances(), numActorInstances - 1);
+        EXPECT_GE(scheduler->GetNumBatches(), 1);
+        EXPECT_LE(scheduler->GetNumBatches(), numActorInstances - 1);
+        EXPECT_GT(scheduler->GetAverageUpdateCost(), 0.0f);
+
+        // Without any time budget, each actor instance gets its own batch.
+        scheduler->SetTargetBatchDuration(0.0f);
+        scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetNumUpdatedActorInstances(), numActorInstances - 1);
+        EXPECT_EQ(scheduler->GetNumBatches(), numActorInstances - 1);
+
+        scheduler->SetTargetBatchDuration(500.0f);
+        for (ActorInstance* actorInstance : actorInstances)
+        {
+            actorInstance->Destroy();
+        }
+    }
 } // namespace EMotionFX
@@ -18,6 +18,7 @@
 #include <EMotionFX/Source/MorphSetupInstance.h>
 #include <EMotionFX/Source/MorphTargetStandard.h>
 #include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/PoseBlendKernels.h>
 #include <EMotionFX/Source/PoseData.h>
 #include <EMotionFX/Source/PoseDataFactory.h>
 #include <EMotionFX/Source/PoseDataRagdoll.h>
@@ -889,6 +890,55 @@ namespace EMotionFX
         }
     }
 
+    TEST_P(PoseTestsBlendWeightParam, BlendKernelsMatchTransformBlend)
+    {
+        // Enough joints to fill several SIMD lanes plus a remainder, with rotations in opposite hemispheres to cover the shortest path.
+        const float blendWeight = GetParam();
+        constexpr size_t numJoints = 19;
+        AZ::SimpleLcgRandom random;
+        AZStd::vector<Transform> source(numJoints);
+        AZStd::vector<Transform> dest(numJoints);
+        AZStd::vector<Transform> base(numJoints);
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            const float floatI = static_cast<float>(i);
+            source[i] = Transform(AZ::Vector3(floatI, 1.0f, 0.0f), CreateRandomUnnormalizedQuaternion(random).GetNormalized());
+            dest[i] = Transform(AZ::Vector3(0.0f, -floatI, 2.0f), CreateRandomUnnormalizedQuaternion(random).GetNormalized());
+            base[i] = Transform(AZ::Vector3(0.5f, 0.0f, floatI), CreateRandomUnnormalizedQuaternion(random).GetNormalized());
+            if (i % 2)
+            {
+                dest[i].m_rotation = -dest[i].m_rotation;
+            }
+        }
+
+        // Blend every other joint through the index list and all joints directly.
+        AZStd::vector<uint16> jointIndices;
+        for (uint16 i = 0; i < numJoints; i += 2)
+        {
+            jointIndices.emplace_back(i);
+        }
+
+        AZStd::vector<Transform> blended(source);
+        PoseBlendKernels::Blend(source.data(), dest.data(), blended.data(), jointIndices.data(), jointIndices.size(), blendWeight);
+        AZStd::vector<Transform> additive(source);
+        PoseBlendKernels::BlendAdditive(source.data(), dest.data(), base.data(), additive.data(), nullptr, numJoints, blendWeight);
+
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            Transform expectedBlend = source[i];
+            if (i % 2 == 0)
+            {
+                expectedBlend.Blend(dest[i], blendWeight);
+            }
+            EXPECT_THAT(blended[i], IsClose(expectedBlend));
+
+            Transform expectedAdditive = source[i];
+            expectedAdditive.BlendAdditive(dest[i], base[i], blendWeight);
+            EXPECT_THAT(additive[i], IsClose(expectedAdditive));
+            CheckIfRotationIsNormalized(additive[i].m_rotation);
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
 
     enum PoseTestsMultiplyFunction
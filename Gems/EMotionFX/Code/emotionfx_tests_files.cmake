@@ -13,6 +13,7 @@ set(FILES
     Tests/ActorFixture.h
     Tests/ActorInstanceCommandTests.cpp
     Tests/AdditiveMotionSamplingTests.cpp
+    Tests/AnimationBenchmarks.cpp
     Tests/AnimAudioComponentTests.cpp
     Tests/AnimGraphActionTests.cpp
     Tests/AnimGraphCommandTests.cpp
@@ -35,6 +36,7 @@ set(FILES
     Tests/AnimGraphNodeEventFilterTests.cpp
     Tests/AnimGraphNodeGroupTests.cpp
     Tests/AnimGraphNodeProcessingTests.cpp
+    Tests/AnimGraphOutputCacheTests.cpp
     Tests/AnimGraphParameterActionTests.cpp
     Tests/AnimGraphParameterActionTests.cpp
     Tests/AnimGraphParameterConditionCommandTests.cpp
@@ -78,6 +80,7 @@ set(FILES
     Tests/BlendTreeTwoLinkIKNodeTests.cpp
     Tests/BoolLogicNodeTests.cpp
     Tests/ColliderCommandTests.cpp
+    Tests/CompressedMotionDataTests.cpp
     Tests/EMotionFXTest.cpp
     Tests/EmotionFXMathLibTests.cpp
     Tests/EventManagerTests.cpp
@@ -15,6 +15,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/vector.h>
 #include <LmbrCentral/Dependency/DependencyNotificationBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
 
@@ -215,26 +216,54 @@ namespace GradientSignal
             return;
         }
 
+        AZStd::shared_lock lock(m_queryMutex);
+
+        if (!m_perlinImprovedNoise)
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        // Transform all the positions first, so that the noise for the accepted ones can be generated in SIMD batches.
+        AZStd::vector<AZ::Vector3> uvws;
+        AZStd::vector<size_t> acceptedIndices;
+        uvws.reserve(positions.size());
+        acceptedIndices.reserve(positions.size());
+
         AZ::Vector3 uvw;
         bool wasPointRejected = false;
 
-        AZStd::shared_lock lock(m_queryMutex);
-
         for (size_t index = 0; index < positions.size(); index++)
         {
             m_gradientTransform.TransformPositionToUVW(positions[index], uvw, wasPointRejected);
 
             if (!wasPointRejected)
             {
-                outValues[index] = m_perlinImprovedNoise->GenerateOctaveNoise(
-                    uvw.GetX(), uvw.GetY(), uvw.GetZ(), m_configuration.m_octave, m_configuration.m_amplitude,
-                    m_configuration.m_frequency);
+                uvws.emplace_back(uvw);
+                acceptedIndices.emplace_back(index);
             }
             else
             {
                 outValues[index] = 0.0f;
             }
         }
+
+        if (acceptedIndices.size() == positions.size())
+        {
+            // Every point was accepted, so the noise can be written directly to the output.
+            m_perlinImprovedNoise->GenerateOctaveNoise(
+                uvws, outValues, m_configuration.m_octave, m_configuration.m_amplitude, m_configuration.m_frequency);
+            return;
+        }
+
+        AZStd::vector<float> noiseValues(uvws.size());
+        m_perlinImprovedNoise->GenerateOctaveNoise(
+            uvws, noiseValues, m_configuration.m_octave, m_configuration.m_amplitude, m_configuration.m_frequency);
+
+        for (size_t acceptedIndex = 0; acceptedIndex < acceptedIndices.size(); acceptedIndex++)
+        {
+            outValues[acceptedIndices[acceptedIndex]] = noiseValues[acceptedIndex];
+        }
     }
 
     int PerlinGradientComponent::GetRandomSeed() const
@@ -9,6 +9,8 @@
 
 #include <GradientSignal/PerlinImprovedNoise.h>
 
+#include <AzCore/std/containers/vector.h>
+
 #include <numeric>
 #include <random> // std::mt19937 std::random_device
 
@@ -60,6 +62,43 @@ namespace GradientSignal
         {
             return a + x * (b - a);
         }
+
+        // SIMD versions of the functions above, operating on four values at a time.
+        // They use the same operations in the same order as the scalar versions so that both produce the same results.
+        using Vec4 = AZ::Simd::Vec4;
+
+        AZ_FORCE_INLINE Vec4::FloatType Gradient(Vec4::Int32ArgType hash, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+        {
+            // Branchless version of the switch statement above:
+            // the first term is x for hashes 0-7 and y for hashes 8-15,
+            // the second term is y for hashes 0-3, x for hashes 12 and 14, and z for the others,
+            // and the bits 0 and 1 of the hash negate the first and second terms.
+            const Vec4::Int32Type h = Vec4::And(hash, Vec4::Splat(0xF));
+            const Vec4::FloatType firstTerm = Vec4::Select(x, y, Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(8))));
+            const Vec4::Int32Type useX = Vec4::Or(Vec4::CmpEq(h, Vec4::Splat(12)), Vec4::CmpEq(h, Vec4::Splat(14)));
+            const Vec4::FloatType secondTerm = Vec4::Select(
+                y, Vec4::Select(x, z, Vec4::CastToFloat(useX)), Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(4))));
+
+            const Vec4::Int32Type signBit = Vec4::Splat(static_cast<int32_t>(0x80000000));
+            const Vec4::Int32Type firstSign = Vec4::And(Vec4::CmpEq(Vec4::And(h, Vec4::Splat(1)), Vec4::Splat(1)), signBit);
+            const Vec4::Int32Type secondSign = Vec4::And(Vec4::CmpEq(Vec4::And(h, Vec4::Splat(2)), Vec4::Splat(2)), signBit);
+
+            return Vec4::Add(
+                Vec4::Xor(firstTerm, Vec4::CastToFloat(firstSign)),
+                Vec4::Xor(secondTerm, Vec4::CastToFloat(secondSign)));
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Fade(Vec4::FloatArgType t)
+        {
+            const Vec4::FloatType t3 = Vec4::Mul(Vec4::Mul(t, t), t);
+            const Vec4::FloatType inner = Vec4::Sub(Vec4::Mul(t, Vec4::Splat(6.0f)), Vec4::Splat(15.0f));
+            return Vec4::Mul(t3, Vec4::Add(Vec4::Mul(t, inner), Vec4::Splat(10.0f)));
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Lerp(Vec4::FloatArgType a, Vec4::FloatArgType b, Vec4::FloatArgType x)
+        {
+            return Vec4::Add(a, Vec4::Mul(x, Vec4::Sub(b, a)));
+        }
     }
 
     PerlinImprovedNoise::PerlinImprovedNoise(int seed)
@@ -92,6 +131,131 @@ namespace GradientSignal
         return total / maxValue;
     }
 
+    void PerlinImprovedNoise::GenerateOctaveNoise(
+        AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues, int octaves, float persistence,
+        float initialFrequency) const
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        AZ_Assert(positions.size() == outValues.size(), "input and output lists are different sizes (%zu vs %zu).",
+            positions.size(), outValues.size());
+
+        // The amplitudes and frequencies are the same for every position, so precompute them once.
+        AZStd::vector<AZStd::pair<float, float>> octaveScales;
+        octaveScales.reserve(static_cast<size_t>(AZStd::max(octaves, 0)));
+        float frequency = initialFrequency;
+        float amplitude = 1.0f;
+        float maxValue = 0.0f;
+        for (int i = 0; i < octaves; ++i)
+        {
+            octaveScales.emplace_back(frequency, amplitude);
+            maxValue += amplitude;
+            amplitude *= persistence;
+            frequency *= 2.0f;
+        }
+
+        if (maxValue <= 0.0f)
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        const Vec4::FloatType maxValues = Vec4::Splat(maxValue);
+        alignas(16) float xs[4];
+        alignas(16) float ys[4];
+        alignas(16) float zs[4];
+        alignas(16) float results[4];
+
+        for (size_t start = 0; start < positions.size(); start += 4)
+        {
+            // Pad the last batch by repeating its last position.
+            const size_t count = AZStd::min<size_t>(4, positions.size() - start);
+            for (size_t lane = 0; lane < 4; ++lane)
+            {
+                const AZ::Vector3& position = positions[start + AZStd::min(lane, count - 1)];
+                xs[lane] = position.GetX();
+                ys[lane] = position.GetY();
+                zs[lane] = position.GetZ();
+            }
+
+            const Vec4::FloatType x = Vec4::LoadAligned(xs);
+            const Vec4::FloatType y = Vec4::LoadAligned(ys);
+            const Vec4::FloatType z = Vec4::LoadAligned(zs);
+
+            Vec4::FloatType total = Vec4::ZeroFloat();
+            for (const auto& [octaveFrequency, octaveAmplitude] : octaveScales)
+            {
+                const Vec4::FloatType scale = Vec4::Splat(octaveFrequency);
+                const Vec4::FloatType noise = GenerateNoise(Vec4::Mul(x, scale), Vec4::Mul(y, scale), Vec4::Mul(z, scale));
+                total = Vec4::Add(total, Vec4::Mul(noise, Vec4::Splat(octaveAmplitude)));
+            }
+
+            Vec4::StoreAligned(results, Vec4::Div(total, maxValues));
+            for (size_t lane = 0; lane < count; ++lane)
+            {
+                outValues[start + lane] = results[lane];
+            }
+        }
+    }
+
+    AZ::Simd::Vec4::FloatType PerlinImprovedNoise::GenerateNoise(
+        AZ::Simd::Vec4::FloatArgType x, AZ::Simd::Vec4::FloatArgType y, AZ::Simd::Vec4::FloatArgType z) const
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        using namespace PerlinImprovedNoiseDetails;
+
+        const Vec4::FloatType floorX = Vec4::Floor(x);
+        const Vec4::FloatType floorY = Vec4::Floor(y);
+        const Vec4::FloatType floorZ = Vec4::Floor(z);
+        const Vec4::FloatType xf = Vec4::Sub(x, floorX);
+        const Vec4::FloatType yf = Vec4::Sub(y, floorY);
+        const Vec4::FloatType zf = Vec4::Sub(z, floorZ);
+        const Vec4::FloatType u = Fade(xf);
+        const Vec4::FloatType v = Fade(yf);
+        const Vec4::FloatType w = Fade(zf);
+
+        // The permutation table lookups can't be vectorized, so compute the hashes of the cube corners one lane at a time.
+        const Vec4::Int32Type byteMask = Vec4::Splat(255);
+        alignas(16) int32_t xi0[4];
+        alignas(16) int32_t yi0[4];
+        alignas(16) int32_t zi0[4];
+        Vec4::StoreAligned(xi0, Vec4::And(Vec4::ConvertToInt(floorX), byteMask));
+        Vec4::StoreAligned(yi0, Vec4::And(Vec4::ConvertToInt(floorY), byteMask));
+        Vec4::StoreAligned(zi0, Vec4::And(Vec4::ConvertToInt(floorZ), byteMask));
+
+        const AZStd::array<int, 512>& p = m_permutationTable;
+        alignas(16) int32_t hashes[8][4];
+        for (size_t lane = 0; lane < 4; ++lane)
+        {
+            const int x0 = xi0[lane];
+            const int y0 = yi0[lane];
+            const int z0 = zi0[lane];
+            hashes[0][lane] = p[p[p[x0] + y0] + z0];                // aaa
+            hashes[1][lane] = p[p[p[x0 + 1] + y0] + z0];            // baa
+            hashes[2][lane] = p[p[p[x0] + y0 + 1] + z0];            // aba
+            hashes[3][lane] = p[p[p[x0 + 1] + y0 + 1] + z0];        // bba
+            hashes[4][lane] = p[p[p[x0] + y0] + z0 + 1];            // aab
+            hashes[5][lane] = p[p[p[x0 + 1] + y0] + z0 + 1];        // bab
+            hashes[6][lane] = p[p[p[x0] + y0 + 1] + z0 + 1];        // abb
+            hashes[7][lane] = p[p[p[x0 + 1] + y0 + 1] + z0 + 1];    // bbb
+        }
+
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType xf1 = Vec4::Sub(xf, one);
+        const Vec4::FloatType yf1 = Vec4::Sub(yf, one);
+        const Vec4::FloatType zf1 = Vec4::Sub(zf, one);
+
+        Vec4::FloatType x1 = Lerp(Gradient(Vec4::LoadAligned(hashes[0]), xf, yf, zf), Gradient(Vec4::LoadAligned(hashes[1]), xf1, yf, zf), u);
+        Vec4::FloatType x2 = Lerp(Gradient(Vec4::LoadAligned(hashes[2]), xf, yf1, zf), Gradient(Vec4::LoadAligned(hashes[3]), xf1, yf1, zf), u);
+        const Vec4::FloatType y1 = Lerp(x1, x2, v);
+        x1 = Lerp(Gradient(Vec4::LoadAligned(hashes[4]), xf, yf, zf1), Gradient(Vec4::LoadAligned(hashes[5]), xf1, yf, zf1), u);
+        x2 = Lerp(Gradient(Vec4::LoadAligned(hashes[6]), xf, yf1, zf1), Gradient(Vec4::LoadAligned(hashes[7]), xf1, yf1, zf1), u);
+        const Vec4::FloatType y2 = Lerp(x1, x2, v);
+
+        // For convenience we bound it to 0 - 1 (theoretical min/max before is -1 - 1)
+        return Vec4::Mul(Vec4::Add(Lerp(y1, y2, w), one), Vec4::Splat(0.5f));
+    }
+
     float PerlinImprovedNoise::GenerateNoise(float x, float y, float z)
     {
         const int fx = (int)std::floor(x);
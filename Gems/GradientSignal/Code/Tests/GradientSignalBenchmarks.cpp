@@ -20,6 +20,7 @@
 #include <AzFramework/Components/TransformComponent.h>
 #include <GradientSignal/Components/ConstantGradientComponent.h>
 #include <GradientSignal/Components/GradientSurfaceDataComponent.h>
+#include <GradientSignal/PerlinImprovedNoise.h>
 #include <LmbrCentral/Shape/BoxShapeComponentBus.h>
 #include <LmbrCentral/Shape/SphereShapeComponentBus.h>
 #include <SurfaceData/Components/SurfaceDataShapeComponent.h>
@@ -168,6 +169,72 @@ namespace UnitTest
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_SurfaceMaskGradient);
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_SurfaceSlopeGradient);
 
+    // --------------------------------------------------------------------------------------
+    // Noise Kernels
+
+    class PerlinNoise : public GradientSignalBenchmarkFixture
+    {
+    public:
+        // Generates a grid of positions with a non-integer spacing, so that every position lands at a different spot in its noise cell.
+        AZStd::vector<AZ::Vector3> GeneratePositions(int64_t size)
+        {
+            AZStd::vector<AZ::Vector3> positions;
+            positions.reserve(size * size);
+            for (int64_t y = 0; y < size; ++y)
+            {
+                for (int64_t x = 0; x < size; ++x)
+                {
+                    positions.emplace_back(x * 0.37f, y * 0.37f, 0.0f);
+                }
+            }
+            return positions;
+        }
+
+        static constexpr int Octaves = 4;
+        static constexpr float Persistence = 0.5f;
+        static constexpr float Frequency = 1.13f;
+    };
+
+    BENCHMARK_DEFINE_F(PerlinNoise, BM_GenerateOctaveNoisePerPosition)(benchmark::State& state)
+    {
+        GradientSignal::PerlinImprovedNoise noise(7878);
+        const AZStd::vector<AZ::Vector3> positions = GeneratePositions(state.range(0));
+        AZStd::vector<float> results(positions.size());
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                results[index] = noise.GenerateOctaveNoise(
+                    positions[index].GetX(), positions[index].GetY(), positions[index].GetZ(), Octaves, Persistence, Frequency);
+            }
+            benchmark::DoNotOptimize(results.data());
+        }
+    }
+
+    BENCHMARK_DEFINE_F(PerlinNoise, BM_GenerateOctaveNoiseBatch)(benchmark::State& state)
+    {
+        GradientSignal::PerlinImprovedNoise noise(7878);
+        const AZStd::vector<AZ::Vector3> positions = GeneratePositions(state.range(0));
+        AZStd::vector<float> results(positions.size());
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            noise.GenerateOctaveNoise(positions, results, Octaves, Persistence, Frequency);
+            benchmark::DoNotOptimize(results.data());
+        }
+    }
+
+    BENCHMARK_REGISTER_F(PerlinNoise, BM_GenerateOctaveNoisePerPosition)
+        ->Arg(1024)
+        ->Arg(2048)
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(PerlinNoise, BM_GenerateOctaveNoiseBatch)
+        ->Arg(1024)
+        ->Arg(2048)
+        ->Unit(::benchmark::kMillisecond);
+
     // --------------------------------------------------------------------------------------
     // Gradient Surface Data
 
@@ -219,6 +219,33 @@ namespace UnitTest
         TestFixedDataSampler(expectedOutput, dataSize, entity->GetId());
     }
 
+    TEST_F(GradientSignalTestGeneratorFixture, PerlinImprovedNoise_BatchMatchesPerPositionNoise)
+    {
+        // The SIMD batch version of the noise needs to produce the same values as the per-position version.
+        // Use a count that isn't a multiple of 4 and negative positions to exercise the padding and the cell lookups.
+        GradientSignal::PerlinImprovedNoise noise(1234);
+
+        AZStd::vector<AZ::Vector3> positions;
+        for (int index = 0; index < 103; ++index)
+        {
+            positions.emplace_back(index * 0.731f - 37.0f, index * -1.37f + 11.0f, index * 0.113f);
+        }
+
+        constexpr int octaves = 5;
+        constexpr float persistence = 0.6f;
+        constexpr float frequency = 1.13f;
+
+        AZStd::vector<float> batchValues(positions.size());
+        noise.GenerateOctaveNoise(positions, batchValues, octaves, persistence, frequency);
+
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            const float value = noise.GenerateOctaveNoise(
+                positions[index].GetX(), positions[index].GetY(), positions[index].GetZ(), octaves, persistence, frequency);
+            EXPECT_NEAR(value, batchValues[index], 0.000001f);
+        }
+    }
+
     TEST_F(GradientSignalTestGeneratorFixture, RandomGradientComponent_GoldenTest)
     {
         // Make sure RandomGradientComponent returns back a "golden" set
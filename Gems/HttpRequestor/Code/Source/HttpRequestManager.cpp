@@ -22,6 +22,7 @@ AZ_PUSH_DISABLE_WARNING(4251 4996, "-Wunknown-warning-option")
 AZ_POP_DISABLE_WARNING
 
 #include <AWSNativeSDKInit/AWSNativeSDKInit.h>
+#include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/string/conversions.h>
 #include "HttpRequestManager.h"
 
@@ -43,23 +44,40 @@ namespace HttpRequestor
         {
             AWSNativeSDKInit::InitializationManager::InitAwsApi();
         }
+
+        AZ::u64 workerThreadCount = 1;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+        {
+            settingsRegistry->Get(workerThreadCount, WorkerThreadCountKey);
+        }
+        workerThreadCount = AZStd::max<AZ::u64>(workerThreadCount, 1);
+
         auto function = [this]
         {
             ThreadFunction();
         };
-        m_thread = AZStd::thread(desc, function);
+        for (AZ::u64 threadIndex = 0; threadIndex < workerThreadCount; ++threadIndex)
+        {
+            m_threads.emplace_back(desc, function);
+        }
     }
 
     Manager::~Manager()
     {
         m_runThread = false;
         m_requestConditionVar.notify_all();
-        if (m_thread.joinable())
+        for (AZStd::thread& thread : m_threads)
         {
-            m_thread.join();
+            if (thread.joinable())
+            {
+                thread.join();
+            }
         }
 
-        // Shutdown after background thread has closed.
+        // Release the pooled connections before the native layer shuts down.
+        m_httpClients.clear();
+
+        // Shutdown after the background threads have closed.
         if (m_ownsAwsNativeInitialization)
         {
             AWSNativeSDKInit::InitializationManager::Shutdown();
@@ -94,11 +112,11 @@ namespace HttpRequestor
         // Run the thread as long as directed
         while (m_runThread)
         {
-            HandleRequestBatch();
+            HandleNextRequest();
         }
     }
 
-    void Manager::HandleRequestBatch()
+    void Manager::HandleNextRequest()
     {
         // Lock mutex and wait for work to be signaled via the condition variable
         AZStd::unique_lock<AZStd::mutex> lock(m_requestMutex);
@@ -109,35 +127,57 @@ namespace HttpRequestor
                 return !m_runThread || !m_requestsToHandle.empty() || !m_textRequestsToHandle.empty();
             });
 
-        // Swap queues
-        AZStd::queue<Parameters> requestsToHandle;
-        requestsToHandle.swap(m_requestsToHandle);
-
-        AZStd::queue<TextParameters> textRequestsToHandle;
-        textRequestsToHandle.swap(m_textRequestsToHandle);
-
-        // Release lock
-        lock.unlock();
+        // Take a single request so the other worker threads can handle the next ones in parallel
+        if (!m_requestsToHandle.empty())
+        {
+            Parameters requestToHandle = AZStd::move(m_requestsToHandle.front());
+            m_requestsToHandle.pop();
+            lock.unlock();
 
-        // Handle requests
-        while (!requestsToHandle.empty())
+            HandleRequest(requestToHandle);
+        }
+        else if (!m_textRequestsToHandle.empty())
         {
-            HandleRequest(requestsToHandle.front());
-            requestsToHandle.pop();
+            TextParameters textRequestToHandle = AZStd::move(m_textRequestsToHandle.front());
+            m_textRequestsToHandle.pop();
+            lock.unlock();
+
+            HandleTextRequest(textRequestToHandle);
         }
+    }
 
-        while (!textRequestsToHandle.empty())
+    std::shared_ptr<Aws::Http::HttpClient> Manager::GetHttpClient(const Aws::String& uri, const Aws::Client::ClientConfiguration& clientConfiguration)
+    {
+        // Key the clients by host and by the settings of the configuration that change how the connections are made
+        const Aws::Http::URI parsedUri(uri.c_str());
+        const AZStd::string clientKey = AZStd::string::format("%s:%u|%d|%s:%u|%d|%s|%s|%ld|%ld|%u|%d|%s",
+            parsedUri.GetAuthority().c_str(), static_cast<unsigned int>(parsedUri.GetPort()),
+            static_cast<int>(clientConfiguration.scheme),
+            clientConfiguration.proxyHost.c_str(), static_cast<unsigned int>(clientConfiguration.proxyPort),
+            clientConfiguration.verifySSL ? 1 : 0,
+            clientConfiguration.caPath.c_str(),
+            clientConfiguration.caFile.c_str(),
+            static_cast<long>(clientConfiguration.connectTimeoutMs),
+            static_cast<long>(clientConfiguration.requestTimeoutMs),
+            static_cast<unsigned int>(clientConfiguration.maxConnections),
+            static_cast<int>(clientConfiguration.followRedirects),
+            clientConfiguration.userAgent.c_str());
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_httpClientMutex);
+        std::shared_ptr<Aws::Http::HttpClient>& httpClient = m_httpClients[clientKey];
+        if (!httpClient)
         {
-            HandleTextRequest(textRequestsToHandle.front());
-            textRequestsToHandle.pop();
+            Aws::Client::ClientConfiguration config = clientConfiguration;
+            config.enableTcpKeepAlive = AZ_TRAIT_AZFRAMEWORK_AWS_ENABLE_TCP_KEEP_ALIVE_SUPPORTED;
+            httpClient = Aws::Http::CreateHttpClient(config);
         }
+        return httpClient;
     }
 
     void Manager::HandleRequest(const Parameters& httpRequestParameters)
     {
-        Aws::Client::ClientConfiguration config = httpRequestParameters.GetClientConfiguration();
-        config.enableTcpKeepAlive = AZ_TRAIT_AZFRAMEWORK_AWS_ENABLE_TCP_KEEP_ALIVE_SUPPORTED;
-        std::shared_ptr<Aws::Http::HttpClient> httpClient = Aws::Http::CreateHttpClient(config);
+        std::shared_ptr<Aws::Http::HttpClient> httpClient =
+            GetHttpClient(httpRequestParameters.GetURI(), httpRequestParameters.GetClientConfiguration());
 
         auto httpRequest = Aws::Http::CreateHttpRequest(
             httpRequestParameters.GetURI(), httpRequestParameters.GetMethod(), Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
@@ -186,9 +226,8 @@ namespace HttpRequestor
 
     void Manager::HandleTextRequest(const TextParameters& httpRequestParameters)
     {
-        Aws::Client::ClientConfiguration config = httpRequestParameters.GetClientConfiguration();
-        config.enableTcpKeepAlive = AZ_TRAIT_AZFRAMEWORK_AWS_ENABLE_TCP_KEEP_ALIVE_SUPPORTED;
-        std::shared_ptr<Aws::Http::HttpClient> httpClient = Aws::Http::CreateHttpClient(config);
+        std::shared_ptr<Aws::Http::HttpClient> httpClient =
+            GetHttpClient(httpRequestParameters.GetURI(), httpRequestParameters.GetClientConfiguration());
 
         auto httpRequest = Aws::Http::CreateHttpRequest(
             httpRequestParameters.GetURI(), httpRequestParameters.GetMethod(), Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
@@ -9,6 +9,8 @@
 #pragma once
 
 #include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
@@ -18,11 +20,19 @@
 #include <HttpRequestor/HttpRequestParameters.h>
 #include <HttpRequestor/HttpTextRequestParameters.h>
 
+namespace Aws::Http
+{
+    class HttpClient;
+}
+
 namespace HttpRequestor
 {
     class Manager
     {
     public:
+        // Settings registry key for the number of worker threads making the requests, defaults to 1 which handles the requests in order
+        static constexpr const char* WorkerThreadCountKey = "/O3DE/HttpRequestor/WorkerThreadCount";
+
         Manager();
         virtual ~Manager();
 
@@ -39,8 +49,12 @@ namespace HttpRequestor
         // RequestManager thread loop.
         void ThreadFunction();
 
-        // Called by ThreadFunction. Waits for timeout or until notified and processes any requests queued up.
-        void HandleRequestBatch();
+        // Called by ThreadFunction. Waits until notified and processes the next queued request.
+        void HandleNextRequest();
+
+        // Returns the HTTP client shared by the requests to the same host with the same client configuration,
+        // so the connections it opened are kept alive and reused instead of doing a new TCP/TLS handshake per request.
+        std::shared_ptr<Aws::Http::HttpClient> GetHttpClient(const Aws::String& uri, const Aws::Client::ClientConfiguration& clientConfiguration);
 
         // Perform an HTTP request, block until a response is received, then give the returned JSON to the callback to parse. Returns the HTTPResponseCode to the callback to handle any errors.
         void HandleRequest(const Parameters & httpRequestParameters);
@@ -54,7 +68,9 @@ namespace HttpRequestor
         AZStd::mutex                            m_requestMutex;                     // Member variables for synchronization
         AZStd::condition_variable               m_requestConditionVar;
         AZStd::atomic<bool>                     m_runThread;                        // Run flag used to signal the worker thread
-        AZStd::thread                           m_thread;                           // This is the thread that will be used for all async operations
+        AZStd::vector<AZStd::thread>            m_threads;                          // These are the threads that will be used for all async operations
+        AZStd::unordered_map<AZStd::string, std::shared_ptr<Aws::Http::HttpClient>> m_httpClients; // HTTP clients by host and client configuration
+        AZStd::mutex                            m_httpClientMutex;                  // Protects m_httpClients
         static const char*                      s_loggingName;                      // Name to use for log messages etc...
         bool                                    m_ownsAwsNativeInitialization = false; // Whether or not this module initialized the native layer
         AZStd::atomic<AZStd::chrono::milliseconds> m_lastRoundTripTime; // The last round trip time taken to make the http request and get a response.
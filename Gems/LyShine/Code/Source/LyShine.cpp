@@ -155,6 +155,7 @@ CLyShine::CLyShine()
     LyShineDebug::Initialize();
     UiElementComponent::Initialize();
     UiCanvasComponent::Initialize();
+    UiTextComponent::Initialize();
 
     AzFramework::InputChannelEventListener::Connect();
     AzFramework::InputTextEventListener::Connect();
@@ -249,6 +250,7 @@ CLyShine::~CLyShine()
     UiCanvasComponent::Shutdown();
 
     // must be done after UiCanvasComponent::Shutdown
+    UiTextComponent::Shutdown();
     CSprite::Shutdown();
 }
 
@@ -11,8 +11,12 @@
 
 #include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RHI/RHISystemInterface.h>
+#include <Atom/RHI/DeviceImageView.h>
+#include <Atom/RHI.Reflect/Limits.h>
 
 #include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
 
 #ifndef _RELEASE
 #include <AzCore/Asset/AssetManagerBus.h>
@@ -37,45 +41,52 @@ namespace LyShine
         AlphaOp_ModulateAlphaAndColor = 3   // reusing shader flag value, FixedPipelineEmu shader uses 3 to mean eCO_DECAL
     };
 
+#if LYSHINE_BINDLESS_TEXTURES
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    static uint32_t GetBindlessReadIndex(const AZ::Data::Instance<AZ::RPI::Image>& image)
+    {
+        const auto imageView = image->GetImageView();
+        return imageView ? imageView->GetDeviceImageView(AZ::RHI::MultiDevice::DefaultDeviceIndex)->GetBindlessReadIndex()
+            : AZ::RHI::DeviceImageView::InvalidBindlessIndex;
+    }
+#endif
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     PrimitiveListRenderNode::PrimitiveListRenderNode(const AZ::Data::Instance<AZ::RPI::Image>& texture,
-        bool isClampTextureMode, bool isTextureSRGB, bool preMultiplyAlpha, const AZ::RHI::TargetBlendState& blendModeState)
+        bool isClampTextureMode, bool isTextureSRGB, bool preMultiplyAlpha, const AZ::RHI::TargetBlendState& blendModeState,
+        PrimitiveListBuffers&& buffers)
         : RenderNode(RenderNodeType::PrimitiveList)
-        , m_numTextures(1)
         , m_isTextureSRGB(isTextureSRGB)
         , m_preMultiplyAlpha(preMultiplyAlpha)
         , m_alphaMaskType(AlphaMaskType::None)
         , m_blendModeState(blendModeState)
         , m_totalNumVertices(0)
         , m_totalNumIndices(0)
+        , m_combinedBuffers(AZStd::move(buffers))
     {
-        m_textures[0].m_texture = texture;
-        m_textures[0].m_isClampTextureMode = isClampTextureMode;
+        InitializeCombinedBuffers();
 
-        m_combinedVertices.reserve(1024);
-        m_combinedIndices.reserve(1024);
+        m_combinedBuffers.m_textures.push_back({ texture, isClampTextureMode });
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     PrimitiveListRenderNode::PrimitiveListRenderNode(const AZ::Data::Instance<AZ::RPI::Image>& texture,
         const AZ::Data::Instance<AZ::RPI::Image>& maskTexture, bool isClampTextureMode, bool isTextureSRGB,
-        bool preMultiplyAlpha, AlphaMaskType alphaMaskType, const AZ::RHI::TargetBlendState& blendModeState)
+        bool preMultiplyAlpha, AlphaMaskType alphaMaskType, const AZ::RHI::TargetBlendState& blendModeState,
+        PrimitiveListBuffers&& buffers)
         : RenderNode(RenderNodeType::PrimitiveList)
-        , m_numTextures(2)
         , m_isTextureSRGB(isTextureSRGB)
         , m_preMultiplyAlpha(preMultiplyAlpha)
         , m_alphaMaskType(alphaMaskType)
         , m_blendModeState(blendModeState)
         , m_totalNumVertices(0)
         , m_totalNumIndices(0)
+        , m_combinedBuffers(AZStd::move(buffers))
     {
-        m_textures[0].m_texture = texture;
-        m_textures[0].m_isClampTextureMode = isClampTextureMode;
-        m_textures[1].m_texture = maskTexture;
-        m_textures[1].m_isClampTextureMode = isClampTextureMode;
+        InitializeCombinedBuffers();
 
-        m_combinedVertices.reserve(1024);
-        m_combinedIndices.reserve(1024);
+        m_combinedBuffers.m_textures.push_back({ texture, isClampTextureMode });
+        m_combinedBuffers.m_textures.push_back({ maskTexture, isClampTextureMode });
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -83,8 +94,9 @@ namespace LyShine
     {
         m_primitives.clear();
 
-        m_combinedVertices.clear();
-        m_combinedIndices.clear();
+        m_combinedBuffers.m_vertices.clear();
+        m_combinedBuffers.m_indices.clear();
+        m_combinedBuffers.m_textures.clear();
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -128,19 +140,46 @@ namespace LyShine
         // Set up per draw SRG
         AZ::Data::Instance<AZ::RPI::ShaderResourceGroup> drawSrg = dynamicDraw->NewDrawSrg();
 
+        const AZStd::vector<PrimitiveListTextureUsage>& textures = m_combinedBuffers.m_textures;
+
+#if LYSHINE_BINDLESS_TEXTURES
+        // Set the table of bindless texture indices, the top bit of an entry selects the clamp sampler
+        static const uint32_t isClampTextureModeBit = 0x80000000;
+        AZStd::array<uint32_t, MaxTextures> bindlessTextures;
+        for (size_t i = 0; i < textures.size(); ++i)
+        {
+            const AZ::Data::Instance<AZ::RPI::Image>& whiteImage = AZ::RPI::ImageSystemInterface::Get()->GetSystemImage(AZ::RPI::SystemImage::White);
+
+            // Default to white texture, also used if the texture has no bindless index
+            const AZ::Data::Instance<AZ::RPI::Image>& image = textures[i].m_texture ? textures[i].m_texture : whiteImage;
+            uint32_t bindlessIndex = GetBindlessReadIndex(image);
+            if (bindlessIndex == AZ::RHI::DeviceImageView::InvalidBindlessIndex)
+            {
+                bindlessIndex = GetBindlessReadIndex(whiteImage);
+            }
+
+            bindlessTextures[i] = bindlessIndex | (textures[i].m_isClampTextureMode ? isClampTextureModeBit : 0);
+#ifndef _RELEASE
+            uiRenderer->DebugUseTexture(image);
+#endif
+        }
+
+        drawSrg->SetConstantRaw(uiShaderData.m_bindlessTexturesInputIndex, bindlessTextures.data(), 0,
+            static_cast<uint32_t>(textures.size() * sizeof(uint32_t)));
+#else
         // Set textures
         uint32_t isClampTextureMode = 0;
-        for (int i = 0; i < m_numTextures; ++i)
+        for (size_t i = 0; i < textures.size(); ++i)
         {
             // Default to white texture
-            const AZ::Data::Instance<AZ::RPI::Image>& image = m_textures[i].m_texture ? m_textures[i].m_texture
+            const AZ::Data::Instance<AZ::RPI::Image>& image = textures[i].m_texture ? textures[i].m_texture
                 : AZ::RPI::ImageSystemInterface::Get()->GetSystemImage(AZ::RPI::SystemImage::White);
             const auto imageView = image->GetImageView();
 
             if (imageView)
             {
-                drawSrg->SetImageView(uiShaderData.m_imageInputIndex, imageView, i);
-                if (m_textures[i].m_isClampTextureMode)
+                drawSrg->SetImageView(uiShaderData.m_imageInputIndex, imageView, static_cast<uint32_t>(i));
+                if (textures[i].m_isClampTextureMode)
                 {
                     isClampTextureMode |= (1 << i);
                 }
@@ -152,6 +191,7 @@ namespace LyShine
 
         // Set sampler state per texture
         drawSrg->SetConstant(uiShaderData.m_isClampInputIndex, isClampTextureMode);
+#endif
 
         // Set projection matrix
         drawSrg->SetConstant(uiShaderData.m_viewProjInputIndex, modelViewProjMat);
@@ -162,7 +202,8 @@ namespace LyShine
         // TODO (GHI 17444): Vertex data for primitives is currently merged within AddPrimitive and then passed to 
         // DynamicDrawContext. This can probably be further optimized whereby we dont waste extra memory and 
         // provide the primitives directly to DynamicDrawContext to be added to its Ring buffer memory. 
-        dynamicDraw->DrawIndexed(&m_combinedVertices[0], (uint32_t)m_combinedVertices.size(), &m_combinedIndices[0],  (uint32_t)m_combinedIndices.size(), AZ::RHI::IndexFormat::Uint16, drawSrg);
+        dynamicDraw->DrawIndexed(&m_combinedBuffers.m_vertices[0], (uint32_t)m_combinedBuffers.m_vertices.size(),
+            &m_combinedBuffers.m_indices[0],  (uint32_t)m_combinedBuffers.m_indices.size(), AZ::RHI::IndexFormat::Uint16, drawSrg);
 
         uiRenderer->SetBaseState(prevBaseState);
     }
@@ -174,16 +215,19 @@ namespace LyShine
         primitive->m_next = nullptr;
         m_primitives.push_back(*primitive);
 
-        uint16 vertex_start = aznumeric_caster(m_combinedVertices.size());
-        uint16 index_start = aznumeric_caster(m_combinedIndices.size());
+        AZStd::vector<UiPrimitiveVertex>& combinedVertices = m_combinedBuffers.m_vertices;
+        AZStd::vector<uint16>& combinedIndices = m_combinedBuffers.m_indices;
+
+        uint16 vertex_start = aznumeric_caster(combinedVertices.size());
+        uint16 index_start = aznumeric_caster(combinedIndices.size());
 
         // Add the vertices at the end of the combined buffer.  We need to update the vertex indices with their new offset separately.
-        m_combinedVertices.insert(m_combinedVertices.end(), primitive->m_vertices, primitive->m_vertices + primitive->m_numVertices);
-        m_combinedIndices.resize_no_construct(m_combinedIndices.size() + primitive->m_numIndices);
+        combinedVertices.insert(combinedVertices.end(), primitive->m_vertices, primitive->m_vertices + primitive->m_numVertices);
+        combinedIndices.resize_no_construct(combinedIndices.size() + primitive->m_numIndices);
 
         for (int i = 0; i < primitive->m_numIndices; i++)
         {
-            m_combinedIndices[index_start + i] = vertex_start + primitive->m_indices[i];
+            combinedIndices[index_start + i] = vertex_start + primitive->m_indices[i];
         }
 
         m_totalNumVertices += primitive->m_numVertices;
@@ -203,12 +247,10 @@ namespace LyShine
         int texUnit = FindTexture(texture, isClampTextureMode);
 
         // render node is not already using this texture, if there is space to add a texture do so
-        if (texUnit == -1 && m_numTextures < PrimitiveListRenderNode::MaxTextures)
+        if (texUnit == -1 && GetNumTextures() < PrimitiveListRenderNode::MaxTextures)
         {
-            texUnit = m_numTextures;
-            m_textures[texUnit].m_texture = texture;
-            m_textures[texUnit].m_isClampTextureMode = isClampTextureMode;
-            m_numTextures++;
+            texUnit = GetNumTextures();
+            m_combinedBuffers.m_textures.push_back({ texture, isClampTextureMode });
         }
 
         return texUnit;
@@ -220,12 +262,36 @@ namespace LyShine
         return primitive->m_numVertices + m_totalNumVertices < std::numeric_limits<uint16>::max();
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    PrimitiveListBuffers PrimitiveListRenderNode::TakeBuffers()
+    {
+        PrimitiveListBuffers buffers = AZStd::move(m_combinedBuffers);
+
+        // don't keep the textures alive until the buffers are reused
+        buffers.m_textures.clear();
+        return buffers;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void PrimitiveListRenderNode::InitializeCombinedBuffers()
+    {
+        // recycled buffers keep their capacity, which is what makes reusing them worthwhile
+        m_combinedBuffers.m_vertices.clear();
+        m_combinedBuffers.m_indices.clear();
+        m_combinedBuffers.m_textures.clear();
+
+        m_combinedBuffers.m_vertices.reserve(1024);
+        m_combinedBuffers.m_indices.reserve(1024);
+        m_combinedBuffers.m_textures.reserve(MaxTextures);
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     int PrimitiveListRenderNode::FindTexture(const AZ::Data::Instance<AZ::RPI::Image>& texture, bool isClampTextureMode) const
     {
-        for (int i = 0; i < m_numTextures; ++i)
+        const AZStd::vector<PrimitiveListTextureUsage>& textures = m_combinedBuffers.m_textures;
+        for (int i = 0; i < GetNumTextures(); ++i)
         {
-            if (m_textures[i].m_texture == texture && m_textures[i].m_isClampTextureMode == isClampTextureMode)
+            if (textures[i].m_texture == texture && textures[i].m_isClampTextureMode == isClampTextureMode)
             {
                 return i;    // texture is already in the list
             }
@@ -256,9 +322,9 @@ namespace LyShine
             }
         }
 
-        if (m_numTextures != highestTexUnit+1)
+        if (GetNumTextures() != highestTexUnit+1)
         {
-            AZ_Error("UI", false, "m_numTextures (%d) is not highestTexUnit+1 (%d)", m_numTextures, highestTexUnit+1)
+            AZ_Error("UI", false, "GetNumTextures (%d) is not highestTexUnit+1 (%d)", GetNumTextures(), highestTexUnit+1)
         }
 
         if (numPrims > 0 && lastPrim != &*m_primitives.last())
@@ -603,6 +669,17 @@ namespace LyShine
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::ResetGraph()
     {
+        // The graph is usually rebuilt into a similar graph, so keep the buffers of the primitive list nodes for the new nodes
+        m_recycledBuffers.clear();
+        for (RenderTargetRenderNode* renderTargetRenderNode : m_renderTargetRenderNodes)
+        {
+            RecycleBuffers(renderTargetRenderNode->GetChildRenderNodeList());
+        }
+        RecycleBuffers(m_renderNodes);
+
+        // new nodes take buffers from the back, reverse so a rebuilt node tends to get the buffer it had before
+        AZStd::reverse(m_recycledBuffers.begin(), m_recycledBuffers.end());
+
         // clear and delete the list of render target nodes
         for (RenderNode* renderNode : m_renderTargetRenderNodes)
         {
@@ -768,7 +845,8 @@ namespace LyShine
             {
                 // We can't add this primitive to the existing render node, we need to create a new render node
                 // this uses a pool allocator for fast allocation
-                renderNodeToAddTo = new PrimitiveListRenderNode(texture, isClampTextureMode, isTextureSRGB, isPreMultiplyAlpha, blendModeState);
+                renderNodeToAddTo = new PrimitiveListRenderNode(texture, isClampTextureMode, isTextureSRGB, isPreMultiplyAlpha, blendModeState,
+                    GetRecycledBuffers());
 
                 renderNodeList->push_back(renderNodeToAddTo);
                 texUnit = 0;
@@ -850,7 +928,7 @@ namespace LyShine
                 // We can't add this primitive to the existing render node, we need to create a new render node
                 // this uses a pool allocator for fast allocation
                 renderNodeToAddTo = new PrimitiveListRenderNode(contentAttachmentImage, maskAttachmentImage,
-                    isClampTextureMode, isTextureSRGB, isPreMultiplyAlpha, alphaMaskType, blendModeState);
+                    isClampTextureMode, isTextureSRGB, isPreMultiplyAlpha, alphaMaskType, blendModeState, GetRecycledBuffers());
 
                 renderNodeList->push_back(renderNodeToAddTo);
                 texUnit0 = 0;
@@ -1512,4 +1590,39 @@ namespace LyShine
             }
         }
     }
+
+    void RenderGraph::RecycleBuffers(const AZStd::vector<RenderNode*>& renderNodeList)
+    {
+        for (RenderNode* renderNode : renderNodeList)
+        {
+            switch (renderNode->GetType())
+            {
+            case RenderNodeType::PrimitiveList:
+                m_recycledBuffers.push_back(static_cast<PrimitiveListRenderNode*>(renderNode)->TakeBuffers());
+                break;
+            case RenderNodeType::Mask:
+            {
+                MaskRenderNode* maskRenderNode = static_cast<MaskRenderNode*>(renderNode);
+                RecycleBuffers(maskRenderNode->GetMaskRenderNodeList());
+                RecycleBuffers(maskRenderNode->GetContentRenderNodeList());
+                break;
+            }
+            case RenderNodeType::RenderTarget:
+                RecycleBuffers(static_cast<RenderTargetRenderNode*>(renderNode)->GetChildRenderNodeList());
+                break;
+            }
+        }
+    }
+
+    PrimitiveListBuffers RenderGraph::GetRecycledBuffers()
+    {
+        if (m_recycledBuffers.empty())
+        {
+            return {};
+        }
+
+        PrimitiveListBuffers buffers = AZStd::move(m_recycledBuffers.back());
+        m_recycledBuffers.pop_back();
+        return buffers;
+    }
 }
@@ -73,6 +73,23 @@ namespace LyShine
         AZ_RTTI(LyShinePoolAllocator, "{0FFA2FE4-498A-4FF6-A58A-F49F0E8575EE}", AZ::PoolAllocator);
     };
 
+    //! A texture used by a primitive list render node, and the sampler it is used with
+    struct PrimitiveListTextureUsage
+    {
+        AZ::Data::Instance<AZ::RPI::Image>  m_texture;
+        bool                                m_isClampTextureMode;
+    };
+
+    //! The combined vertex and index buffers of a primitive list render node, and the textures it uses. The render graph
+    //! keeps them between rebuilds so that rebuilding a graph reuses their memory rather than reallocating it.
+    //! The textures are kept out of the node itself since the node is allocated from a pool with a small maximum size.
+    struct PrimitiveListBuffers
+    {
+        AZStd::vector<UiPrimitiveVertex> m_vertices;
+        AZStd::vector<uint16> m_indices;
+        AZStd::vector<PrimitiveListTextureUsage> m_textures;
+    };
+
     // As we build the render graph we allocate a render node for each change in render state
     class PrimitiveListRenderNode : public RenderNode
     {
@@ -80,9 +97,11 @@ namespace LyShine
         // We use a pool allocator to keep these allocations fast.
         AZ_CLASS_ALLOCATOR(PrimitiveListRenderNode, LyShinePoolAllocator);
 
-        PrimitiveListRenderNode(const AZ::Data::Instance<AZ::RPI::Image>& texture, bool isClampTextureMode, bool isTextureSRGB, bool preMultiplyAlpha, const AZ::RHI::TargetBlendState& blendModeState);
+        PrimitiveListRenderNode(const AZ::Data::Instance<AZ::RPI::Image>& texture, bool isClampTextureMode, bool isTextureSRGB, bool preMultiplyAlpha, const AZ::RHI::TargetBlendState& blendModeState,
+            PrimitiveListBuffers&& buffers = {});
         PrimitiveListRenderNode(const AZ::Data::Instance<AZ::RPI::Image>& texture, const AZ::Data::Instance<AZ::RPI::Image>& maskTexture,
-            bool isClampTextureMode, bool isTextureSRGB, bool preMultiplyAlpha, AlphaMaskType alphaMaskType, const AZ::RHI::TargetBlendState& blendModeState);
+            bool isClampTextureMode, bool isTextureSRGB, bool preMultiplyAlpha, AlphaMaskType alphaMaskType, const AZ::RHI::TargetBlendState& blendModeState,
+            PrimitiveListBuffers&& buffers = {});
         ~PrimitiveListRenderNode() override;
         void Render(UiRenderer* uiRenderer
             , const AZ::Matrix4x4& modelViewProjMat
@@ -92,9 +111,9 @@ namespace LyShine
         LyShine::UiPrimitiveList& GetPrimitives() const;
 
         int GetOrAddTexture(const AZ::Data::Instance<AZ::RPI::Image>& texture, bool isClampTextureMode);
-        int GetNumTextures() const { return m_numTextures; }
-        const AZ::Data::Instance<AZ::RPI::Image> GetTexture(int texIndex) const { return m_textures[texIndex].m_texture; }
-        bool GetTextureIsClampMode(int texIndex) const { return m_textures[texIndex].m_isClampTextureMode; }
+        int GetNumTextures() const { return static_cast<int>(m_combinedBuffers.m_textures.size()); }
+        const AZ::Data::Instance<AZ::RPI::Image> GetTexture(int texIndex) const { return m_combinedBuffers.m_textures[texIndex].m_texture; }
+        bool GetTextureIsClampMode(int texIndex) const { return m_combinedBuffers.m_textures[texIndex].m_isClampTextureMode; }
 
         bool GetIsTextureSRGB() const { return m_isTextureSRGB; }
         AZ::RHI::TargetBlendState GetBlendModeState() const { return m_blendModeState; }
@@ -103,6 +122,9 @@ namespace LyShine
 
         bool HasSpaceToAddPrimitive(LyShine::UiPrimitive* primitive) const;
 
+        //! Moves the combined buffers out of this node so they can be reused by a node of the next graph
+        PrimitiveListBuffers TakeBuffers();
+
         // Search to see if this texture is already used by this texture unit, returns -1 if not used
         int FindTexture(const AZ::Data::Instance<AZ::RPI::Image>& texture, bool isClampTextureMode) const;
 
@@ -112,18 +134,14 @@ namespace LyShine
 #endif
 
     public: // data
+#if LYSHINE_BINDLESS_TEXTURES
+        // Textures are read through the bindless SRG, this is only limited by the size of the table in the draw SRG
+        static const int MaxTextures = 64;
+#else
         static const int MaxTextures = 16;
-
-    private: // types
-        struct TextureUsage
-        {
-            AZ::Data::Instance<AZ::RPI::Image>  m_texture;
-            bool                                m_isClampTextureMode;
-        };
+#endif
 
     private: // data
-        TextureUsage    m_textures[MaxTextures];
-        int             m_numTextures;
         bool            m_isTextureSRGB;
         bool            m_preMultiplyAlpha;
         AlphaMaskType   m_alphaMaskType;
@@ -133,9 +151,11 @@ namespace LyShine
 
         LyShine::UiPrimitiveList   m_primitives;
 
-        // Per-frame combined vertex and index buffers
-        AZStd::vector<UiPrimitiveVertex> m_combinedVertices;
-        AZStd::vector<uint16> m_combinedIndices;
+        // Combined vertex and index buffers, built as primitives are added, and the textures used by the primitives
+        PrimitiveListBuffers m_combinedBuffers;
+
+    private: // functions
+        void InitializeCombinedBuffers();
     };
 
     // A mask render node handles using one set of render nodes to mask another set of render nodes
@@ -351,10 +371,17 @@ namespace LyShine
 
         void SetRttPassesEnabled(UiRenderer* uiRenderer, bool enabled);
 
+        //! Keep the combined buffers of the primitive list nodes in the list (and its sub lists) for the next rebuild
+        void RecycleBuffers(const AZStd::vector<RenderNode*>& renderNodeList);
+
+        //! Get the buffers for a new primitive list node, reusing those of the previous graph if there are any
+        PrimitiveListBuffers GetRecycledBuffers();
+
     protected:  // data
 
         AZStd::vector<RenderNode*>  m_renderNodes;
         AZStd::vector<DynamicQuad*> m_dynamicQuads; // used for drawing quads not cached in components
+        AZStd::vector<PrimitiveListBuffers> m_recycledBuffers; // buffers of the previous graph, reused when the graph is rebuilt
 
         MaskRenderNode*             m_currentMask = nullptr;
         RenderTargetRenderNode*     m_currentRenderTarget = nullptr;
@@ -11,6 +11,8 @@
 #include <LyShine/Bus/UiElementBus.h>
 #include <LyShine/Bus/UiLayoutControllerBus.h>
 
+#include <AzCore/std/sort.h>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // PUBLIC MEMBER FUNCTIONS
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -74,18 +76,27 @@ void UiLayoutManager::MarkToRecomputeLayoutsAffectedByLayoutCellChange(AZ::Entit
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiLayoutManager::UnmarkAllLayouts()
 {
-    m_elementsToRecomputeLayout.clear();
+    m_markedElements.clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiLayoutManager::RecomputeMarkedLayouts()
 {
-    for (auto element : m_elementsToRecomputeLayout)
+    // Applying a layout can mark other layouts. Those that were not already covered by this recompute
+    // are recomputed in a further pass, the others are dropped since they are now up to date
+    while (!m_markedElements.empty())
     {
-        ComputeLayoutForElementAndDescendants(element);
+        AZStd::vector<AZ::EntityId> elements = GetTopMostMarkedElements();
+        UnmarkAllLayouts();
+
+        for (auto element : elements)
+        {
+            ComputeLayoutForElementAndDescendants(element);
+            m_recomputedElements.insert(element);
+        }
     }
 
-    UnmarkAllLayouts();
+    m_recomputedElements.clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -120,67 +131,62 @@ void UiLayoutManager::ComputeLayoutForElementAndDescendants(AZ::EntityId entityI
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiLayoutManager::AddToRecomputeLayoutList(AZ::EntityId entityId)
 {
-    // Check if element is already in the list
-    auto iter = AZStd::find(m_elementsToRecomputeLayout.begin(), m_elementsToRecomputeLayout.end(), entityId);
-    if (iter == m_elementsToRecomputeLayout.end())
+    // Ancestors and descendants are resolved once, when the layouts are recomputed, rather than on every mark
+    m_markedElements.insert(entityId);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+AZStd::vector<AZ::EntityId> UiLayoutManager::GetTopMostMarkedElements() const
+{
+    AZStd::vector<AZStd::pair<int, AZ::EntityId>> elementsByDepth;
+    elementsByDepth.reserve(m_markedElements.size());
+
+    for (auto element : m_markedElements)
     {
-        // Check if element's parent is already in the list
-        for (iter = m_elementsToRecomputeLayout.begin(); iter != m_elementsToRecomputeLayout.end(); ++iter)
+        if (m_recomputedElements.count(element))
         {
-            if (IsParentOfElement(*iter, entityId))
-            {
-                // Don't need to add this element
-                return;
-            }
+            continue;
         }
 
-        // Remove element's children from the list
-        LyShine::EntityArray descendants;
-        UiElementBus::Event(
-            entityId,
-            &UiElementBus::Events::FindDescendantElements,
-            []([[maybe_unused]] const AZ::Entity* entity)
-            {
-                return true;
-            },
-            descendants);
-
-        m_elementsToRecomputeLayout.remove_if(
-            [descendants](const AZ::EntityId& e)
+        // Walk up the ancestors, skipping the element if any of them will recompute it
+        bool isCovered = false;
+        int depth = 0;
+        AZ::EntityId parent;
+        UiElementBus::EventResult(parent, element, &UiElementBus::Events::GetParentEntityId);
+        while (parent.IsValid())
+        {
+            if (m_markedElements.count(parent) || m_recomputedElements.count(parent))
             {
-                for (auto descendant : descendants)
-                {
-                    if (descendant->GetId() == e)
-                    {
-                        return true;
-                    }
-                }
-                return false;
+                isCovered = true;
+                break;
             }
-            );
 
-        // Add element to list
-        m_elementsToRecomputeLayout.push_back(entityId);
-    }
-}
+            ++depth;
+            AZ::EntityId newParent = parent;
+            parent.SetInvalid();
+            UiElementBus::EventResult(parent, newParent, &UiElementBus::Events::GetParentEntityId);
+        }
 
-////////////////////////////////////////////////////////////////////////////////////////////////////
-bool UiLayoutManager::IsParentOfElement(AZ::EntityId checkParentEntity, AZ::EntityId checkChildEntity)
-{
-    AZ::EntityId parent;
-    UiElementBus::EventResult(parent, checkChildEntity, &UiElementBus::Events::GetParentEntityId);
-    while (parent.IsValid())
-    {
-        if (parent == checkParentEntity)
+        if (!isCovered)
         {
-            return true;
+            elementsByDepth.emplace_back(depth, element);
         }
+    }
 
-        AZ::EntityId newParent = parent;
-        parent.SetInvalid();
-        UiElementBus::EventResult(parent, newParent, &UiElementBus::Events::GetParentEntityId);
+    // Order parents ahead of their children
+    AZStd::sort(elementsByDepth.begin(), elementsByDepth.end(),
+        [](const AZStd::pair<int, AZ::EntityId>& lhs, const AZStd::pair<int, AZ::EntityId>& rhs)
+        {
+            return lhs.first < rhs.first;
+        });
+
+    AZStd::vector<AZ::EntityId> elements;
+    elements.reserve(elementsByDepth.size());
+    for (const auto& elementByDepth : elementsByDepth)
+    {
+        elements.push_back(elementByDepth.second);
     }
 
-    return false;
+    return elements;
 }
 
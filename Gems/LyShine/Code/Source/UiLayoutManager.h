@@ -8,6 +8,8 @@
 #pragma once
 
 #include <LyShine/Bus/UiLayoutManagerBus.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class UiLayoutManager
@@ -26,17 +28,24 @@ public: // member functions
     void ComputeLayoutForElementAndDescendants(AZ::EntityId entityId) override;
     // ~UiLayoutManagerBus
 
-    bool HasMarkedLayouts() const { return !m_elementsToRecomputeLayout.empty(); }
+    bool HasMarkedLayouts() const { return !m_markedElements.empty(); }
 
 private: // member functions
 
     AZ_DISABLE_COPY_MOVE(UiLayoutManager);
 
     void AddToRecomputeLayoutList(AZ::EntityId entityId);
-    bool IsParentOfElement(AZ::EntityId checkParentEntity, AZ::EntityId checkChildEntity);
+
+    //! Get the marked elements that don't have a marked or already recomputed ancestor, parents ahead of their children
+    AZStd::vector<AZ::EntityId> GetTopMostMarkedElements() const;
 
 private: // data
 
-    //! Elements that need to recompute their layouts. Parents should be ahead of their children
-    AZStd::list<AZ::EntityId> m_elementsToRecomputeLayout;
+    //! Elements that need to recompute their layouts. An element whose ancestor is also marked is skipped
+    //! when the layouts are recomputed, since recomputing the ancestor recomputes its descendants
+    AZStd::unordered_set<AZ::EntityId> m_markedElements;
+
+    //! Elements whose layouts (and their descendants' layouts) have been recomputed by the current call
+    //! to RecomputeMarkedLayouts, so an element is laid out at most once per recompute
+    AZStd::unordered_set<AZ::EntityId> m_recomputedElements;
 };
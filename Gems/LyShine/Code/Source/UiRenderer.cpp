@@ -171,20 +171,27 @@ AZStd::shared_ptr<AZ::RPI::ViewportContext> UiRenderer::GetViewportContext()
 void UiRenderer::CacheShaderData(const AZ::RHI::Ptr<AZ::RPI::DynamicDrawContext>& dynamicDraw)
 {
     // Cache draw srg input indices
-    static const char textureIndexName[] = "m_texture";
     static const char worldToProjIndexName[] = "m_worldToProj";
-    static const char isClampIndexName[] = "m_isClamp";
     AZ::Data::Instance<AZ::RPI::ShaderResourceGroup> drawSrg = dynamicDraw->NewDrawSrg();
     const AZ::RHI::ShaderResourceGroupLayout* layout = drawSrg->GetLayout();
+#if LYSHINE_BINDLESS_TEXTURES
+    static const char bindlessTexturesIndexName[] = "m_bindlessTextures";
+    m_uiShaderData.m_bindlessTexturesInputIndex = layout->FindShaderInputConstantIndex(AZ::Name(bindlessTexturesIndexName));
+    AZ_Error(LogName, m_uiShaderData.m_bindlessTexturesInputIndex.IsValid(), "Failed to find shader input constant %s.",
+        bindlessTexturesIndexName);
+#else
+    static const char textureIndexName[] = "m_texture";
+    static const char isClampIndexName[] = "m_isClamp";
     m_uiShaderData.m_imageInputIndex = layout->FindShaderInputImageIndex(AZ::Name(textureIndexName));
     AZ_Error(LogName, m_uiShaderData.m_imageInputIndex.IsValid(), "Failed to find shader input constant %s.",
         textureIndexName);
-    m_uiShaderData.m_viewProjInputIndex = layout->FindShaderInputConstantIndex(AZ::Name(worldToProjIndexName));
-    AZ_Error(LogName, m_uiShaderData.m_viewProjInputIndex.IsValid(), "Failed to find shader input constant %s.",
-        worldToProjIndexName);
     m_uiShaderData.m_isClampInputIndex = layout->FindShaderInputConstantIndex(AZ::Name(isClampIndexName));
     AZ_Error(LogName, m_uiShaderData.m_isClampInputIndex.IsValid(), "Failed to find shader input constant %s.",
         isClampIndexName);
+#endif
+    m_uiShaderData.m_viewProjInputIndex = layout->FindShaderInputConstantIndex(AZ::Name(worldToProjIndexName));
+    AZ_Error(LogName, m_uiShaderData.m_viewProjInputIndex.IsValid(), "Failed to find shader input constant %s.",
+        worldToProjIndexName);
 
     // Cache shader variants that will be used
     AZ::RPI::ShaderOptionList shaderOptionsTextureLinear;
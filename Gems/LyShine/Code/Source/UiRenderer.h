@@ -17,6 +17,11 @@
 #include <AzCore/std/containers/unordered_set.h>
 #endif
 
+// When set, the LyShine UI shader reads its textures through the bindless SRG rather than through an array of textures bound
+// to each draw, so many more textures can share a draw and changes of texture break far fewer batches.
+// Note: LyShineUI.azsl has a corresponding LYSHINE_BINDLESS_TEXTURES define that must match the setting of this one.
+#define LYSHINE_BINDLESS_TEXTURES 1
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 //! UI render interface
 //
@@ -31,6 +36,7 @@ public: // types
         AZ::RHI::ShaderInputImageIndex m_imageInputIndex;
         AZ::RHI::ShaderInputConstantIndex m_viewProjInputIndex;
         AZ::RHI::ShaderInputConstantIndex m_isClampInputIndex;
+        AZ::RHI::ShaderInputConstantIndex m_bindlessTexturesInputIndex; //!< only used with LYSHINE_BINDLESS_TEXTURES
 
         AZ::RPI::ShaderVariantId m_shaderVariantTextureLinear;
         AZ::RPI::ShaderVariantId m_shaderVariantTextureSrgb;
@@ -14,6 +14,9 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/std/string/regex.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/hash.h>
 
 #include <AzFramework/API/ApplicationAPI.h>
 
@@ -1589,6 +1592,124 @@ bool UiTextComponent::DrawBatchLine::CheckAndSplitLine(const STextDrawContext& c
     return lineSplit;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UiTextComponent::TextLayoutCache
+{
+public: // types
+
+    //! Everything that CalculateDrawBatchLines depends on
+    struct Key
+    {
+        AZStd::string m_text;               //!< The localized text
+        AZStd::string m_displayedText;      //!< The localized text after the displayed text function (e.g. password masking)
+        const FontFamily* m_fontFamily = nullptr;
+        const FontFamily* m_overrideFontFamily = nullptr;
+        unsigned int m_fontEffectIndex = 0;
+        int m_requestFontSize = 0;
+        float m_fontSize = 0.0f;
+        float m_fontSizeScaleX = 1.0f;
+        float m_fontSizeScaleY = 1.0f;
+        float m_charSpacing = 0.0f;
+        float m_availableWidth = 0.0f;
+        bool m_isPixelAligned = false;
+        bool m_isMarkupEnabled = false;
+        bool m_wrapText = false;
+        bool m_excludeTrailingSpaceWidth = false;
+
+        bool operator==(const Key& rhs) const
+        {
+            return m_fontFamily == rhs.m_fontFamily
+                && m_overrideFontFamily == rhs.m_overrideFontFamily
+                && m_fontEffectIndex == rhs.m_fontEffectIndex
+                && m_requestFontSize == rhs.m_requestFontSize
+                && m_fontSize == rhs.m_fontSize
+                && m_fontSizeScaleX == rhs.m_fontSizeScaleX
+                && m_fontSizeScaleY == rhs.m_fontSizeScaleY
+                && m_charSpacing == rhs.m_charSpacing
+                && m_availableWidth == rhs.m_availableWidth
+                && m_isPixelAligned == rhs.m_isPixelAligned
+                && m_isMarkupEnabled == rhs.m_isMarkupEnabled
+                && m_wrapText == rhs.m_wrapText
+                && m_excludeTrailingSpaceWidth == rhs.m_excludeTrailingSpaceWidth
+                && m_text == rhs.m_text
+                && m_displayedText == rhs.m_displayedText;
+        }
+    };
+
+public: // member functions
+
+    //! Returns the cached draw batch lines for the key, or nullptr if they are not cached
+    const DrawBatchLines* Find(const Key& key)
+    {
+        auto iter = m_entriesByKey.find(key);
+        if (iter == m_entriesByKey.end())
+        {
+            return nullptr;
+        }
+
+        // Move the entry to the front as it is now the most recently used
+        m_entries.splice(m_entries.begin(), m_entries, iter->second);
+        return &iter->second->m_drawBatchLines;
+    }
+
+    //! Adds a copy of the draw batch lines. Draw batch lines with inline images are not cached, since the images
+    //! are owned by the draw batch lines they were created for
+    void Add(const Key& key, const FontFamilyPtr& fontFamily, const FontFamilyPtr& overrideFontFamily, const DrawBatchLines& drawBatchLines)
+    {
+        if (!drawBatchLines.inlineImages.empty() || m_entriesByKey.find(key) != m_entriesByKey.end())
+        {
+            return;
+        }
+
+        if (m_entries.size() >= MaxEntries)
+        {
+            m_entriesByKey.erase(m_entries.back().m_key);
+            m_entries.pop_back();
+        }
+
+        m_entries.emplace_front();
+        Entry& entry = m_entries.front();
+        entry.m_key = key;
+        entry.m_fontFamily = fontFamily;
+        entry.m_overrideFontFamily = overrideFontFamily;
+        entry.m_drawBatchLines = drawBatchLines;
+        m_entriesByKey[key] = m_entries.begin();
+    }
+
+private: // types
+
+    struct KeyHasher
+    {
+        size_t operator()(const Key& key) const
+        {
+            size_t seed = 0;
+            AZStd::hash_combine(seed, key.m_text, key.m_displayedText, key.m_fontFamily, key.m_overrideFontFamily,
+                key.m_requestFontSize, key.m_fontSize, key.m_availableWidth, key.m_wrapText);
+            return seed;
+        }
+    };
+
+    struct Entry
+    {
+        Key m_key;
+        // Strong references keep the fonts used by the draw batches alive, and the fonts in the key from being reused
+        FontFamilyPtr m_fontFamily;
+        FontFamilyPtr m_overrideFontFamily;
+        DrawBatchLines m_drawBatchLines;
+    };
+
+    using EntryList = AZStd::list<Entry>;
+
+private: // data
+
+    static constexpr size_t MaxEntries = 512;
+
+    EntryList m_entries;    //!< Most recently used first
+    AZStd::unordered_map<Key, EntryList::iterator, KeyHasher> m_entriesByKey;
+};
+
+UiTextComponent::TextLayoutCache* UiTextComponent::s_textLayoutCache = nullptr;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 UiTextComponent::DrawBatchLines::~DrawBatchLines()
 {
@@ -2825,6 +2946,7 @@ void UiTextComponent::OnTransformToViewportChanged()
     // Request size is correlated with transformation scale, so it must be
     // updated when the scale changes.
     m_isRequestFontSizeDirty = true;
+    m_targetWidthCache.m_isValid = false;
 
     MarkRenderCacheDirty();
 }
@@ -2844,6 +2966,11 @@ float UiTextComponent::GetMinHeight()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 float UiTextComponent::GetTargetWidth(float maxWidth)
 {
+    if (m_targetWidthCache.m_isValid && m_targetWidthCache.m_maxWidth == maxWidth)
+    {
+        return m_targetWidthCache.m_targetWidth;
+    }
+
     // Calculate draw batch lines based on max width. If unlimited, don't wrap text
     bool forceNoWrap = !LyShine::IsUiLayoutCellSizeSpecified(maxWidth);
 
@@ -2878,6 +3005,10 @@ float UiTextComponent::GetTargetWidth(float maxWidth)
         textWidth += epsilon;
     }
 
+    m_targetWidthCache.m_maxWidth = maxWidth;
+    m_targetWidthCache.m_targetWidth = textWidth;
+    m_targetWidthCache.m_isValid = true;
+
     return textWidth;
 }
 
@@ -3054,6 +3185,19 @@ public:
 // PUBLIC STATIC MEMBER FUNCTIONS
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void UiTextComponent::Initialize()
+{
+    s_textLayoutCache = new TextLayoutCache;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiTextComponent::Shutdown()
+{
+    delete s_textLayoutCache;
+    s_textLayoutCache = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiTextComponent::Reflect(AZ::ReflectContext* context)
 {
     AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context);
@@ -3743,6 +3887,9 @@ void UiTextComponent::MarkDrawBatchLinesDirty(bool invalidateLayout)
     m_areDrawBatchLinesDirty = true;
     m_drawBatchLines.Clear();
 
+    // Anything that invalidates the draw batch lines also invalidates the text measurement
+    m_targetWidthCache.m_isValid = false;
+
     // Setting this saves Render() from having to check multiple flags.
     MarkRenderCacheDirty();
 
@@ -3826,6 +3973,41 @@ void UiTextComponent::CalculateDrawBatchLines(
 
     SanitizeUserEnteredNewlineChar(m_locText);
 
+    // Reuse the draw batch lines if identical text has already been laid out by any text component
+    TextLayoutCache::Key layoutKey;
+    if (s_textLayoutCache)
+    {
+        layoutKey.m_text = m_locText;
+        layoutKey.m_displayedText = m_displayedTextFunction(m_locText);
+        layoutKey.m_fontFamily = m_fontFamily.get();
+        layoutKey.m_overrideFontFamily = m_overrideFontFamily.get();
+        layoutKey.m_fontEffectIndex = m_overrideFontEffectIndex;
+        layoutKey.m_requestFontSize = requestFontSize;
+        layoutKey.m_fontSize = m_fontSize;
+        layoutKey.m_fontSizeScaleX = drawBatchLinesOut.fontSizeScale.GetX();
+        layoutKey.m_fontSizeScaleY = drawBatchLinesOut.fontSizeScale.GetY();
+        layoutKey.m_charSpacing = m_charSpacing;
+        layoutKey.m_availableWidth = wrapText ? availableWidth : 0.0f;
+        layoutKey.m_isPixelAligned = fontContext.m_pixelAligned;
+        layoutKey.m_isMarkupEnabled = m_isMarkupEnabled;
+        layoutKey.m_wrapText = wrapText;
+        layoutKey.m_excludeTrailingSpaceWidth = excludeTrailingSpaceWidth;
+
+        const DrawBatchLines* cachedDrawBatchLines = s_textLayoutCache->Find(layoutKey);
+        if (cachedDrawBatchLines)
+        {
+            for (auto image : prevInlineImages)
+            {
+                delete image;
+            }
+            TextureAtlasNamespace::TextureAtlasNotificationBus::Handler::BusDisconnect();
+
+            drawBatchLinesOut = *cachedDrawBatchLines;
+            m_textNeedsXmlValidation = false;
+            return;
+        }
+    }
+
     // Only attempt to parse the string for XML markup if the markup enabled flag is set (it is expensive)
     bool suppressXmlWarnings = !m_textNeedsXmlValidation;
     m_textNeedsXmlValidation = false;
@@ -3941,6 +4123,11 @@ void UiTextComponent::CalculateDrawBatchLines(
         CreateBatchLines(drawBatchLinesOut, drawBatches, m_fontFamily.get());
         AssignLineSizes(drawBatchLinesOut, m_fontFamily.get(), fontContext, excludeTrailingSpaceWidth);
     }
+
+    if (s_textLayoutCache)
+    {
+        s_textLayoutCache->Add(layoutKey, m_fontFamily, m_overrideFontFamily, drawBatchLinesOut);
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -4284,6 +4471,8 @@ STextDrawContext UiTextComponent::GetTextDrawContextPrototype(int requestFontSiz
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiTextComponent::OnTextWidthPropertyChanged()
 {
+    m_targetWidthCache.m_isValid = false;
+
     if (m_wrapTextSetting == UiTextInterface::WrapTextSetting::NoWrap &&
         m_overflowMode != OverflowMode::Ellipsis &&
         m_shrinkToFit == ShrinkToFit::None &&
@@ -341,6 +341,12 @@ public: // member functions
 
 public:  // static member functions
 
+    //! Create the text layout cache that is shared by all text components
+    static void Initialize();
+
+    //! Destroy the text layout cache
+    static void Shutdown();
+
     static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
     {
         provided.push_back(AZ_CRC_CE("UiVisualService"));
@@ -557,6 +563,10 @@ protected: // member functions
     //! This assumes the given rect points are axis-aligned.
     AZ::Vector2 CalculateAlignedPositionWithYOffset(const UiTransformInterface::RectPoints& points);
 
+private: // static data
+
+    static TextLayoutCache* s_textLayoutCache;
+
 private: // static member functions
 
     static bool VersionConverter(AZ::SerializeContext& context,
@@ -601,6 +611,11 @@ private: // member functions
 
 private: // types
 
+    //! An LRU cache of draw batch lines, keyed on everything that affects how a string is measured and wrapped.
+    //! It is shared by all text components, so text that is often set to strings it already had (or that
+    //! another text component has), such as chat and scoreboards, is not measured and wrapped again
+    class TextLayoutCache;
+
     struct RenderCacheBatch
     {
         AZ::Vector2         m_position;
@@ -698,5 +713,15 @@ private: // data
     bool m_areDrawBatchLinesDirty = true;           //!< Indicates whether m_drawBatchLines needs regenerating before next use
     bool m_isRequestFontSizeDirty = true;           //!< Indicates whether m_requestFontSize needs calculating before next use
 
+    //! Result of the last text measurement in GetTargetWidth. Layouts ask for the target width of an element several
+    //! times per layout recompute, and measuring the text means building draw batch lines from the text string.
+    struct TargetWidthCache
+    {
+        float m_maxWidth = 0.0f;
+        float m_targetWidth = 0.0f;
+        bool m_isValid = false;
+    };
+    TargetWidthCache m_targetWidthCache;
+
     bool m_textNeedsXmlValidation = true;           //!< Indicates whether any XML parsing warnings should be displayed when next parsed
 };
@@ -20,6 +20,7 @@
 #include <Maestro/Types/AssetBlends.h>
 
 #include "CharacterTrack.h"
+#include "Movie.h"
 #include "MathConversion.h"
 
 CAnimComponentNode::CAnimComponentNode(int id)
@@ -46,15 +47,19 @@ CAnimComponentNode::~CAnimComponentNode()
 
 void CAnimComponentNode::OnStart()
 {
+    m_lastAnimatedTrackValues.Clear();
 }
 
 void CAnimComponentNode::OnResume()
 {
+    m_lastAnimatedTrackValues.Clear();
 }
 
 //////////////////////////////////////////////////////////////////////////
 void CAnimComponentNode::OnReset()
 {
+    m_lastAnimatedTrackValues.Clear();
+
     // OnReset is called when sequences are loaded
     if (m_characterTrackAnimator)
     {
@@ -523,6 +528,8 @@ Vec3 CAnimComponentNode::GetScale()
 
 void CAnimComponentNode::Activate(bool bActivate)
 {
+    m_lastAnimatedTrackValues.Clear();
+
     // Connect to EditorSequenceAgentComponentNotificationBus. The Sequence Agent Component
     // is always added to the Entity that is being animated aka the entity at GetParentAzEntityId().
     if (bActivate)
@@ -579,6 +586,8 @@ IAnimTrack* CAnimComponentNode::CreateTrack(const CAnimParamType& paramType)
 //////////////////////////////////////////////////////////////////////////
 bool CAnimComponentNode::RemoveTrack(IAnimTrack* pTrack)
 {
+    m_lastAnimatedTrackValues.Remove(pTrack);
+
     if (pTrack && pTrack->GetParameterType().GetType() == AnimParamType::Animation && m_characterTrackAnimator)
     {
         delete m_characterTrackAnimator;
@@ -822,6 +831,12 @@ void CAnimComponentNode::Animate(SAnimContext& ac)
         return;
     }
 
+    // With mov_skipUnchangedTrackValues, a track that evaluates to the value it animated on the previous frame is skipped, so a
+    // property changed by something else than the sequence is not restored. Otherwise, and always while editing, the properties
+    // are compared and set every frame, so the changes made to them are reverted to the track values.
+    const bool isEditing = gEnv->IsEditor() && !gEnv->IsEditorSimulationMode() && !gEnv->IsEditorGameMode();
+    m_lastAnimatedTrackValues.SetEnabled(CMovieSystem::m_mov_skipUnchangedTrackValues != 0 && !isEditing);
+
     // Evaluate all tracks
 
     // indices used for character animation (SimpleAnimationComponent)
@@ -886,6 +901,11 @@ void CAnimComponentNode::Animate(SAnimContext& ac)
                             {
                                 float floatValue = .0f;
                                 pTrack->GetValue(ac.time, floatValue, /*applyMultiplier= */ true);
+                                if (m_lastAnimatedTrackValues.IsUnchanged(pTrack, AZ::Vector4(floatValue, 0.0f, 0.0f, 0.0f)))
+                                {
+                                    break;
+                                }
+
                                 Maestro::SequenceComponentRequests::AnimatedFloatValue value(floatValue);
 
                                 Maestro::SequenceComponentRequests::AnimatedFloatValue prevValue(floatValue);
@@ -912,6 +932,11 @@ void CAnimComponentNode::Animate(SAnimContext& ac)
                                 tolerance = (1.0f - AZ::Constants::FloatEpsilon) / 255.0f;
                             }
 
+                            if (m_lastAnimatedTrackValues.IsUnchanged(pTrack, AZ::Vector4::CreateFromVector3(vec)))
+                            {
+                                break;
+                            }
+
                             Maestro::SequenceComponentRequests::AnimatedVector3Value value(vec);
                             Maestro::SequenceComponentRequests::AnimatedVector3Value prevValue(vec);
                             Maestro::SequenceComponentRequestBus::Event(m_pSequence->GetSequenceEntityId(), &Maestro::SequenceComponentRequestBus::Events::GetAnimatedPropertyValue, prevValue, GetParentAzEntityId(), animatableAddress);
@@ -939,6 +964,11 @@ void CAnimComponentNode::Animate(SAnimContext& ac)
 
                                 AZ::Quaternion quaternionValue(AZ::Quaternion::CreateIdentity());
                                 pTrack->GetValue(ac.time, quaternionValue);
+                                if (m_lastAnimatedTrackValues.IsUnchanged(pTrack, AZ::Vector4(quaternionValue.GetX(), quaternionValue.GetY(), quaternionValue.GetZ(), quaternionValue.GetW())))
+                                {
+                                    break;
+                                }
+
                                 Maestro::SequenceComponentRequests::AnimatedQuaternionValue value(quaternionValue);
                                 Maestro::SequenceComponentRequests::AnimatedQuaternionValue prevValue(quaternionValue);
                                 Maestro::SequenceComponentRequestBus::Event(m_pSequence->GetSequenceEntityId(), &Maestro::SequenceComponentRequestBus::Events::GetAnimatedPropertyValue, prevValue, GetParentAzEntityId(), animatableAddress);
@@ -959,6 +989,11 @@ void CAnimComponentNode::Animate(SAnimContext& ac)
                             {
                                 bool boolValue = true;
                                 pTrack->GetValue(ac.time, boolValue);
+                                if (m_lastAnimatedTrackValues.IsUnchanged(pTrack, AZ::Vector4(boolValue ? 1.0f : 0.0f, 0.0f, 0.0f, 0.0f)))
+                                {
+                                    break;
+                                }
+
                                 Maestro::SequenceComponentRequests::AnimatedBoolValue value(boolValue);
 
                                 Maestro::SequenceComponentRequests::AnimatedBoolValue prevValue(boolValue);
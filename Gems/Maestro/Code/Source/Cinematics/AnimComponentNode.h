@@ -14,6 +14,7 @@
 
 #include "AnimNode.h"
 #include "CharacterTrackAnimator.h"
+#include "AnimatedTrackValueCache.h"
 #include <Maestro/Bus/EditorSequenceAgentComponentBus.h>
 
 /**
@@ -179,6 +180,9 @@ private:
     // a mapping of CAnimParmTypes to SBehaviorPropertyInfo structs for each virtual property
     AZStd::unordered_map<CAnimParamType, BehaviorPropertyInfo>   m_paramTypeToBehaviorPropertyInfoMap;
 
+    // the last value animated by each track when mov_skipUnchangedTrackValues is set, cleared when the sequence starts, resumes or resets
+    AnimatedTrackValueCache m_lastAnimatedTrackValues;
+
     // helper class responsible for animating Character Tracks (aka 'Animation' tracks in the TrackView UI)
     CCharacterTrackAnimator*   m_characterTrackAnimator = nullptr;
 
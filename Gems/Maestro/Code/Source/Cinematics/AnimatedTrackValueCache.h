@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/std/containers/unordered_map.h>
+
+struct IAnimTrack;
+
+/**
+ * Remembers the value each track animated on the previous frame, so a track that evaluates to the same value again can skip
+ * reading and setting its animated property.
+ * The cache only knows the values it animated: a property changed by something else than the sequence is not restored while
+ * its track value doesn't change. That's why the cache is disabled by default (see mov_skipUnchangedTrackValues).
+ * Values of all types are packed in a Vector4.
+ */
+class AnimatedTrackValueCache
+{
+public:
+    //! Disabling the cache forgets the values, so the next frame after it's enabled again animates every track.
+    void SetEnabled(bool enabled)
+    {
+        if (!enabled)
+        {
+            m_values.clear();
+        }
+        m_enabled = enabled;
+    }
+
+    bool IsEnabled() const
+    {
+        return m_enabled;
+    }
+
+    //! Returns true when the track animated this value the previous time it was checked, otherwise remembers the value.
+    //! Always returns false when the cache is disabled.
+    bool IsUnchanged(const IAnimTrack* track, const AZ::Vector4& value)
+    {
+        if (!m_enabled)
+        {
+            return false;
+        }
+
+        auto [valueIter, inserted] = m_values.emplace(track, value);
+        if (inserted)
+        {
+            return false;
+        }
+
+        if (valueIter->second == value)
+        {
+            return true;
+        }
+
+        valueIter->second = value;
+        return false;
+    }
+
+    void Remove(const IAnimTrack* track)
+    {
+        m_values.erase(track);
+    }
+
+    void Clear()
+    {
+        m_values.clear();
+    }
+
+private:
+    bool m_enabled = false;
+    AZStd::unordered_map<const IAnimTrack*, AZ::Vector4> m_values;
+};
@@ -40,6 +40,7 @@
 
 int CMovieSystem::m_mov_NoCutscenes = 0;
 float CMovieSystem::m_mov_cameraPrecacheTime = 1.f;
+int CMovieSystem::m_mov_skipUnchangedTrackValues = 0;
 #if !defined(_RELEASE)
 int CMovieSystem::m_mov_DebugEvents = 0;
 int CMovieSystem::m_mov_debugCamShake = 0;
@@ -225,6 +226,9 @@ CMovieSystem::CMovieSystem(ISystem* pSystem)
 
     REGISTER_CVAR2("mov_NoCutscenes", &m_mov_NoCutscenes, 0, 0, "Disable playing of Cut-Scenes");
     REGISTER_CVAR2("mov_cameraPrecacheTime", &m_mov_cameraPrecacheTime, 1.f, VF_NULL, "");
+    REGISTER_CVAR2("mov_skipUnchangedTrackValues", &m_mov_skipUnchangedTrackValues, 0, VF_NULL,
+        "Skip reading and setting the component properties whose track value didn't change since the previous frame.\n"
+        "Only enable when the animated properties aren't changed by anything else than the sequences, those changes are not reverted.");
     m_mov_overrideCam = REGISTER_STRING("mov_overrideCam", "", VF_NULL, "Set the camera used for the sequence which overrides the camera track info in the sequence.\nUse the Camera Name for Object Entity Cameras (Legacy) or the Entity ID for Component Entity Cameras.");
 
     DoNodeStaticInitialisation();
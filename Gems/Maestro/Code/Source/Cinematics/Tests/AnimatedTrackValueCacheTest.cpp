@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Cinematics/AnimatedTrackValueCache.h>
+#include <Cinematics/BoolTrack.h>
+
+#include <AzTest/AzTest.h>
+
+namespace AnimatedTrackValueCacheTest
+{
+    const AZ::Vector4 VALUE_A = AZ::Vector4(1.0f, 2.0f, 3.0f, 0.0f);
+    const AZ::Vector4 VALUE_B = AZ::Vector4(4.0f, 5.0f, 6.0f, 0.0f);
+
+    class AnimatedTrackValueCacheTest : public ::testing::Test
+    {
+    public:
+        AnimatedTrackValueCache m_cache;
+        CBoolTrack m_track1;
+        CBoolTrack m_track2;
+    };
+
+    TEST_F(AnimatedTrackValueCacheTest, IsUnchanged_Disabled_NeverSkipsSoExternalChangesAreReverted)
+    {
+        // Disabled by default: every frame the property is read and compared, so a change made to it by something else
+        // than the sequence is reverted to the track value
+        EXPECT_FALSE(m_cache.IsEnabled());
+        EXPECT_FALSE(m_cache.IsUnchanged(&m_track1, VALUE_A));
+        EXPECT_FALSE(m_cache.IsUnchanged(&m_track1, VALUE_A));
+    }
+
+    TEST_F(AnimatedTrackValueCacheTest, IsUnchanged_EnabledSameValue_SkipsFromSecondFrame)
+    {
+        m_cache.SetEnabled(true);
+        EXPECT_FALSE(m_cache.IsUnchanged(&m_track1, VALUE_A));
+        EXPECT_TRUE(m_cache.IsUnchanged(&m_track1, VALUE_A));
+        EXPECT_TRUE(m_cache.IsUnchanged(&m_track1, VALUE_A));
+    }
+
+    TEST_F(AnimatedTrackValueCacheTest, IsUnchanged_EnabledValueChanged_NotSkipped)
+    {
+        m_cache.SetEnabled(true);
+        EXPECT_FALSE(m_cache.IsUnchanged(&m_track1, VALUE_A));
+        EXPECT_FALSE(m_cache.IsUnchanged(&m_track1, VALUE_B));
+        EXPECT_TRUE(m_cache.IsUnchanged(&m_track1, VALUE_B));
+        EXPECT_FALSE(m_cache.IsUnchanged(&m_track1, VALUE_A));
+    }
+
+    TEST_F(AnimatedTrackValueCacheTest, IsUnchanged_EnabledTracksWithSameValue_AreIndependent)
+    {
+        m_cache.SetEnabled(true);
+        EXPECT_FALSE(m_cache.IsUnchanged(&m_track1, VALUE_A));
+        EXPECT_FALSE(m_cache.IsUnchanged(&m_track2, VALUE_A));
+        EXPECT_TRUE(m_cache.IsUnchanged(&m_track2, VALUE_A));
+    }
+
+    TEST_F(AnimatedTrackValueCacheTest, SetEnabled_DisabledThenEnabled_ForgetsValues)
+    {
+        m_cache.SetEnabled(true);
+        EXPECT_FALSE(m_cache.IsUnchanged(&m_track1, VALUE_A));
+
+        // e.g. while editing, the properties are set every frame again
+        m_cache.SetEnabled(false);
+        EXPECT_FALSE(m_cache.IsUnchanged(&m_track1, VALUE_A));
+
+        m_cache.SetEnabled(true);
+        EXPECT_FALSE(m_cache.IsUnchanged(&m_track1, VALUE_A));
+        EXPECT_TRUE(m_cache.IsUnchanged(&m_track1, VALUE_A));
+    }
+
+    TEST_F(AnimatedTrackValueCacheTest, ClearAndRemove_ForgetValues)
+    {
+        m_cache.SetEnabled(true);
+        EXPECT_FALSE(m_cache.IsUnchanged(&m_track1, VALUE_A));
+        EXPECT_FALSE(m_cache.IsUnchanged(&m_track2, VALUE_A));
+
+        // a removed track is animated again
+        m_cache.Remove(&m_track1);
+        EXPECT_FALSE(m_cache.IsUnchanged(&m_track1, VALUE_A));
+        EXPECT_TRUE(m_cache.IsUnchanged(&m_track2, VALUE_A));
+
+        // the sequence started, resumed or was reset
+        m_cache.Clear();
+        EXPECT_FALSE(m_cache.IsUnchanged(&m_track1, VALUE_A));
+        EXPECT_FALSE(m_cache.IsUnchanged(&m_track2, VALUE_A));
+    }
+} // namespace AnimatedTrackValueCacheTest
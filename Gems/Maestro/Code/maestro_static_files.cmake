@@ -74,6 +74,7 @@ set(FILES
     Source/Cinematics/AnimScreenFaderNode.h
     Source/Cinematics/CommentNode.h
     Source/Cinematics/AnimComponentNode.h
+    Source/Cinematics/AnimatedTrackValueCache.h
     Source/Cinematics/CVarNode.h
     Source/Cinematics/EventNode.h
     Source/Cinematics/LayerNode.h
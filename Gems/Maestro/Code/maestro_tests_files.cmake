@@ -7,6 +7,7 @@
 #
 
 set(FILES
+    Source/Cinematics/Tests/AnimatedTrackValueCacheTest.cpp
     Source/Cinematics/Tests/AssetBlendTrackTest.cpp
     Source/Cinematics/Tests/EntityNodeTest.cpp
     Tests/MaestroTest.cpp
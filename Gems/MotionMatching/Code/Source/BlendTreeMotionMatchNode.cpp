@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -26,6 +27,8 @@
 
 namespace EMotionFX::MotionMatching
 {
+    AZ_CVAR_EXTERNED(bool, mm_cacheFeatureDatabase);
+
     AZ_CLASS_ALLOCATOR_IMPL(BlendTreeMotionMatchNode, AnimGraphAllocator)
     AZ_CLASS_ALLOCATOR_IMPL(BlendTreeMotionMatchNode::UniqueData, AnimGraphObjectUniqueDataAllocator)
 
@@ -139,6 +142,10 @@ namespace EMotionFX::MotionMatching
         settings.m_featureTansformerSettings.m_featureMin = animGraphNode->m_featureMin;
         settings.m_featureTansformerSettings.m_featureMax = animGraphNode->m_featureMax;
         settings.m_featureTansformerSettings.m_clip = animGraphNode->m_clipFeatures;
+        if (mm_cacheFeatureDatabase)
+        {
+            settings.m_featureDatabaseCacheFolder = "@user@/MotionMatching/FeatureDatabase";
+        }
 
         for (const AZStd::string& id : animGraphNode->m_motionIds)
         {
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+
+#include <Allocators.h>
+#include <BruteForceSearch.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZ_CLASS_ALLOCATOR_IMPL(BruteForceSearch, MotionMatchAllocator);
+
+    bool BruteForceSearch::Init(const FeatureMatrix& featureMatrix, const AZStd::vector<Feature*>& features, size_t numNearestFrames)
+    {
+        AZ_PROFILE_SCOPE(Animation, "BruteForceSearch::Init");
+
+        Clear();
+
+        if (numNearestFrames == 0)
+        {
+            AZ_Error("Motion Matching", false, "The number of nearest frames of the brute-force search cannot be zero.");
+            return false;
+        }
+
+        // Map the dimensions of the search to the feature matrix columns.
+        AZStd::vector<size_t> columns;
+        for (const Feature* feature : features)
+        {
+            for (size_t i = 0; i < feature->GetNumDimensions(); ++i)
+            {
+                columns.emplace_back(feature->GetColumnOffset() + i);
+            }
+        }
+
+        if (columns.empty())
+        {
+            AZ_Error("Motion Matching", false, "Cannot initialize the brute-force search without any feature dimensions.");
+            return false;
+        }
+
+        m_numFrames = featureMatrix.rows();
+        m_numDimensions = columns.size();
+        m_numNearestFrames = numNearestFrames;
+
+        // Interleave the values of four frames per dimension. The frames that pad the last block stay zero and get ignored by the search.
+        const size_t numBlocks = (m_numFrames + s_numLanes - 1) / s_numLanes;
+        m_values.resize(numBlocks * m_numDimensions * s_numLanes, 0.0f);
+        for (size_t frame = 0; frame < m_numFrames; ++frame)
+        {
+            float* blockValues = &m_values[(frame / s_numLanes) * m_numDimensions * s_numLanes];
+            const size_t lane = frame % s_numLanes;
+            for (size_t dimension = 0; dimension < m_numDimensions; ++dimension)
+            {
+                blockValues[dimension * s_numLanes + lane] = featureMatrix(frame, columns[dimension]);
+            }
+        }
+
+        return true;
+    }
+
+    void BruteForceSearch::Clear()
+    {
+        m_values.clear();
+        m_values.shrink_to_fit();
+        m_numFrames = 0;
+        m_numDimensions = 0;
+    }
+
+    size_t BruteForceSearch::GetNumFrames() const
+    {
+        return m_numFrames;
+    }
+
+    size_t BruteForceSearch::GetNumDimensions() const
+    {
+        return m_numDimensions;
+    }
+
+    size_t BruteForceSearch::GetNumNearestFrames() const
+    {
+        return m_numNearestFrames;
+    }
+
+    size_t BruteForceSearch::CalcMemoryUsageInBytes() const
+    {
+        return sizeof(BruteForceSearch) + m_values.capacity() * sizeof(float);
+    }
+
+    bool BruteForceSearch::IsInitialized() const
+    {
+        return (m_numDimensions != 0);
+    }
+
+    void BruteForceSearch::CalcDistances(const float* query, size_t startBlock, size_t endBlock, float* outDistances) const
+    {
+        using AZ::Simd::Vec4;
+
+        for (size_t block = startBlock; block < endBlock; ++block)
+        {
+            const float* blockValues = &m_values[block * m_numDimensions * s_numLanes];
+            Vec4::FloatType distances = Vec4::ZeroFloat();
+            for (size_t dimension = 0; dimension < m_numDimensions; ++dimension)
+            {
+                const Vec4::FloatType difference = Vec4::Sub(Vec4::LoadUnaligned(blockValues + dimension * s_numLanes), Vec4::Splat(query[dimension]));
+                distances = Vec4::Madd(difference, difference, distances);
+            }
+            Vec4::StoreUnaligned(outDistances + (block - startBlock) * s_numLanes, distances);
+        }
+    }
+
+    void BruteForceSearch::SelectNearestFrames(const AZStd::vector<float>& distances, AZStd::vector<size_t>& resultFrameIndices) const
+    {
+        resultFrameIndices.resize(m_numFrames);
+        for (size_t frame = 0; frame < m_numFrames; ++frame)
+        {
+            resultFrameIndices[frame] = frame;
+        }
+
+        if (m_numNearestFrames < m_numFrames)
+        {
+            const auto nthIterator = resultFrameIndices.begin() + m_numNearestFrames;
+            AZStd::nth_element(resultFrameIndices.begin(), nthIterator, resultFrameIndices.end(),
+                [&distances](size_t frameA, size_t frameB)
+                {
+                    return distances[frameA] < distances[frameB];
+                });
+            resultFrameIndices.resize(m_numNearestFrames);
+        }
+    }
+
+    void BruteForceSearch::FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const
+    {
+        AZ_PROFILE_SCOPE(Animation, "BruteForceSearch::FindNearestNeighbors");
+        AZ_Assert(IsInitialized(), "Expecting an initialized brute-force search. Did you forget to call BruteForceSearch::Init()?");
+        AZ_Assert(frameFloats.size() == m_numDimensions, "The query has %zu values while the search expects %zu.", frameFloats.size(), m_numDimensions);
+
+        const size_t numBlocks = (m_numFrames + s_numLanes - 1) / s_numLanes;
+        AZStd::vector<float> distances(numBlocks * s_numLanes);
+        CalcDistances(frameFloats.data(), 0, numBlocks, distances.data());
+        SelectNearestFrames(distances, resultFrameIndices);
+    }
+
+    void BruteForceSearch::FindNearestNeighbors(const AZStd::vector<const AZStd::vector<float>*>& queries, AZStd::vector<AZStd::vector<size_t>>& results) const
+    {
+        AZ_PROFILE_SCOPE(Animation, "BruteForceSearch::FindNearestNeighborsBatched");
+        AZ_Assert(IsInitialized(), "Expecting an initialized brute-force search. Did you forget to call BruteForceSearch::Init()?");
+        AZ_Assert(queries.size() == results.size(), "Expected a result for each of the queries.");
+
+        const size_t numQueries = queries.size();
+        const size_t numBlocks = (m_numFrames + s_numLanes - 1) / s_numLanes;
+        const size_t numPaddedFrames = numBlocks * s_numLanes;
+        AZStd::vector<AZStd::vector<float>> distances(numQueries);
+        for (size_t query = 0; query < numQueries; ++query)
+        {
+            AZ_Assert(queries[query]->size() == m_numDimensions, "The query has %zu values while the search expects %zu.", queries[query]->size(), m_numDimensions);
+            distances[query].resize(numPaddedFrames);
+        }
+
+        // Compare a small range of frames against all queries, before moving on to the next range, so that the frames are still in the cache.
+        for (size_t startBlock = 0; startBlock < numBlocks; startBlock += s_numBlocksPerBatch)
+        {
+            const size_t endBlock = AZ::GetMin(startBlock + s_numBlocksPerBatch, numBlocks);
+            for (size_t query = 0; query < numQueries; ++query)
+            {
+                CalcDistances(queries[query]->data(), startBlock, endBlock, &distances[query][startBlock * s_numLanes]);
+            }
+        }
+
+        for (size_t query = 0; query < numQueries; ++query)
+        {
+            SelectNearestFrames(distances[query], results[query]);
+        }
+    }
+} // namespace EMotionFX::MotionMatching
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+#include <Feature.h>
+#include <FeatureMatrix.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Broad-phase search that scans all frames of the feature matrix with SIMD instructions, as an alternative to the KD-tree.
+    //! The values of the features are copied into a separate buffer where four frames are interleaved, so that the distances
+    //! of four frames to the query get calculated at once, without any horizontal adds or branches.
+    //! Different from the KD-tree, which returns all frames in the leaf node the query ends up in, this returns the frames with the
+    //! smallest squared euclidean distance to the query, which gives the narrow-phase better candidates at the cost of visiting every frame.
+    //! The search functions are const and can be called from multiple threads at the same time.
+    class EMFX_API BruteForceSearch
+    {
+    public:
+        AZ_RTTI(BruteForceSearch, "{5D5C7E0A-93B1-4F5B-A1E6-2E4C9B0F7D38}");
+        AZ_CLASS_ALLOCATOR_DECL;
+
+        BruteForceSearch() = default;
+        virtual ~BruteForceSearch() = default;
+
+        //! Copy the values of the given features for all frames in the feature matrix.
+        //! @param featureMatrix The feature matrix holding the values of all frames.
+        //! @param features The features to search, which are the same as the ones in the KD-tree, so that both use the same query values.
+        //! @param numNearestFrames The number of frames returned by the search.
+        bool Init(const FeatureMatrix& featureMatrix, const AZStd::vector<Feature*>& features, size_t numNearestFrames = 1000);
+
+        void Clear();
+
+        size_t GetNumFrames() const;
+        size_t GetNumDimensions() const;
+        size_t GetNumNearestFrames() const;
+        size_t CalcMemoryUsageInBytes() const;
+        bool IsInitialized() const;
+
+        //! Find the frames closest to the query.
+        //! @param frameFloats The query values, in the same order as the features passed to Init().
+        //! @param resultFrameIndices The indices of the nearest frames, in no particular order.
+        void FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const;
+
+        //! Find the frames closest to each of the queries, for example the queries of all motion matching instances in a frame.
+        //! The queries get compared against a small range of frames at a time, so that the frame data gets loaded into the cache only once for all queries.
+        //! @param queries The query values for each search.
+        //! @param results The indices of the nearest frames for each search. Needs to have the same size as the queries.
+        void FindNearestNeighbors(const AZStd::vector<const AZStd::vector<float>*>& queries, AZStd::vector<AZStd::vector<size_t>>& results) const;
+
+    private:
+        //! Calculate the squared distances of a range of four-frame blocks to the query.
+        void CalcDistances(const float* query, size_t startBlock, size_t endBlock, float* outDistances) const;
+        void SelectNearestFrames(const AZStd::vector<float>& distances, AZStd::vector<size_t>& resultFrameIndices) const;
+
+        static constexpr size_t s_numLanes = 4;
+        static constexpr size_t s_numBlocksPerBatch = 64; //!< The number of four-frame blocks compared to all queries at once in batched searches.
+
+        AZStd::vector<float> m_values; //!< The feature values of four frames interleaved, for each block of four frames and dimension.
+        size_t m_numFrames = 0;
+        size_t m_numDimensions = 0;
+        size_t m_numNearestFrames = 1000;
+    };
+} // namespace EMotionFX::MotionMatching
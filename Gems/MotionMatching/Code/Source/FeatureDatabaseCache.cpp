@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Timer.h>
+#include <AzCore/IO/FileIO.h>
+
+#include <FeatureDatabaseCache.h>
+#include <FeatureMatrixTransformer.h>
+#include <KdTree.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZStd::string FeatureDatabaseCache::GetFilePath(const AZStd::string& folder, AZ::u64 key)
+    {
+        return AZStd::string::format("%s/%016llx.mmfd", folder.c_str(), static_cast<unsigned long long>(key));
+    }
+
+    bool FeatureDatabaseCache::Save(const char* filePath, AZ::u64 key, const FeatureMatrix& featureMatrix, const FeatureMatrixTransformer* transformer, const KdTree& kdTree)
+    {
+        AZ_PROFILE_SCOPE(Animation, "FeatureDatabaseCache::Save");
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        if (!fileIo)
+        {
+            return false;
+        }
+
+        AZStd::string folder = filePath;
+        const size_t lastSeparator = folder.find_last_of("/\\");
+        if (lastSeparator != AZStd::string::npos)
+        {
+            folder.resize(lastSeparator);
+            fileIo->CreatePath(folder.c_str());
+        }
+
+        AZ::IO::FileIOStream stream(filePath, AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary);
+        if (!stream.IsOpen())
+        {
+            AZ_Warning("Motion Matching", false, "Cannot open feature database cache file '%s' for writing.", filePath);
+            return false;
+        }
+
+        const AZ::u64 numRows = featureMatrix.rows();
+        const AZ::u64 numColumns = featureMatrix.cols();
+        const AZ::IO::SizeType numMatrixBytes = numRows * numColumns * sizeof(float);
+        const AZ::u8 hasTransformer = transformer ? 1 : 0;
+
+        bool success = WriteValue(stream, s_magic) &&
+            WriteValue(stream, s_version) &&
+            WriteValue(stream, key) &&
+            WriteValue(stream, numRows) &&
+            WriteValue(stream, numColumns) &&
+            (numMatrixBytes == 0 || stream.Write(numMatrixBytes, featureMatrix.data()) == numMatrixBytes) &&
+            WriteValue(stream, hasTransformer) &&
+            (!transformer || transformer->Save(stream)) &&
+            kdTree.Save(stream);
+        stream.Close();
+
+        if (!success)
+        {
+            // Don't leave a partially written file behind, it would fail to load every time.
+            fileIo->Remove(filePath);
+            AZ_Warning("Motion Matching", false, "Failed to write feature database cache file '%s'.", filePath);
+        }
+
+        return success;
+    }
+
+    bool FeatureDatabaseCache::Load(const char* filePath, AZ::u64 key, FeatureMatrix& outFeatureMatrix, FeatureMatrixTransformer* outTransformer, KdTree& outKdTree)
+    {
+        AZ_PROFILE_SCOPE(Animation, "FeatureDatabaseCache::Load");
+        AZ::Debug::Timer timer;
+        timer.Stamp();
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        if (!fileIo || !fileIo->Exists(filePath))
+        {
+            return false;
+        }
+
+        AZ::IO::FileIOStream stream(filePath, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+        if (!stream.IsOpen())
+        {
+            return false;
+        }
+
+        AZ::u32 magic = 0;
+        AZ::u32 version = 0;
+        AZ::u64 fileKey = 0;
+        if (!ReadValue(stream, magic) || !ReadValue(stream, version) || !ReadValue(stream, fileKey) ||
+            magic != s_magic || version != s_version || fileKey != key)
+        {
+            return false;
+        }
+
+        AZ::u64 numRows = 0;
+        AZ::u64 numColumns = 0;
+        if (!ReadValue(stream, numRows) || !ReadValue(stream, numColumns))
+        {
+            return false;
+        }
+
+        const AZ::IO::SizeType numMatrixBytes = numRows * numColumns * sizeof(float);
+        if (numMatrixBytes > stream.GetLength() - stream.GetCurPos())
+        {
+            return false;
+        }
+
+        outFeatureMatrix.resize(numRows, numColumns);
+        AZ::u8 hasTransformer = 0;
+        const bool success = (numMatrixBytes == 0 || stream.Read(numMatrixBytes, outFeatureMatrix.data()) == numMatrixBytes) &&
+            ReadValue(stream, hasTransformer) &&
+            (hasTransformer != 0) == (outTransformer != nullptr) &&
+            (!outTransformer || outTransformer->Load(stream)) &&
+            outKdTree.Load(stream);
+
+        if (!success)
+        {
+            AZ_Warning("Motion Matching", false, "Feature database cache file '%s' is corrupt and will be rebuilt.", filePath);
+            outFeatureMatrix.Clear();
+            outKdTree.Clear();
+            return false;
+        }
+
+        const float loadTime = timer.GetDeltaTimeInSeconds();
+        AZ_Printf("Motion Matching", "Loaded the feature database (%zu, %zu) from '%s' in %.2f ms.", outFeatureMatrix.rows(), outFeatureMatrix.cols(), filePath, loadTime * 1000.0f);
+        return true;
+    }
+} // namespace EMotionFX::MotionMatching
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/typetraits/is_trivially_copyable.h>
+
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+#include <FeatureMatrix.h>
+
+namespace EMotionFX::MotionMatching
+{
+    class FeatureMatrixTransformer;
+    class KdTree;
+
+    //! Binary cache for the precomputed parts of the motion matching data: the feature matrix, the fitted feature transformer and the KD-tree.
+    //! Extracting the features and building the KD-tree for large motion databases takes seconds per character type, while loading the
+    //! cached results is a couple of bulk reads. Each cache file is identified by a key that is calculated from everything the precomputed
+    //! data depends on (motions, frame import settings, feature schema and acceleration structure settings), so that a change to any of
+    //! these results in a new file rather than stale data.
+    class EMFX_API FeatureDatabaseCache
+    {
+    public:
+        static constexpr AZ::u32 s_magic = 0x44464D4D; //!< "MMFD" in little endian.
+        static constexpr AZ::u32 s_version = 1; //!< Increase this when the file layout or the way any of the cached data is calculated changes.
+
+        //! Construct the path of the cache file for the given key inside the given folder.
+        static AZStd::string GetFilePath(const AZStd::string& folder, AZ::u64 key);
+
+        //! Write the precomputed data to the given file. The transformer may be nullptr in case the data is not normalized.
+        static bool Save(const char* filePath, AZ::u64 key, const FeatureMatrix& featureMatrix, const FeatureMatrixTransformer* transformer, const KdTree& kdTree);
+
+        //! Read the precomputed data from the given file.
+        //! Returns false without logging an error in case the file does not exist or has been written for a different key or version.
+        //! @param outTransformer Receives the transformer, which is expected to be of the same type that was saved. Can be nullptr in case the data is not normalized.
+        static bool Load(const char* filePath, AZ::u64 key, FeatureMatrix& outFeatureMatrix, FeatureMatrixTransformer* outTransformer, KdTree& outKdTree);
+
+        template<typename T>
+        static bool WriteValue(AZ::IO::GenericStream& stream, const T& value)
+        {
+            static_assert(AZStd::is_trivially_copyable_v<T>, "Only trivially copyable values can be written as raw bytes.");
+            return stream.Write(sizeof(T), &value) == sizeof(T);
+        }
+
+        template<typename T>
+        static bool ReadValue(AZ::IO::GenericStream& stream, T& outValue)
+        {
+            static_assert(AZStd::is_trivially_copyable_v<T>, "Only trivially copyable values can be read as raw bytes.");
+            return stream.Read(sizeof(T), &outValue) == sizeof(T);
+        }
+
+        //! Write the number of elements followed by the raw elements.
+        template<typename T>
+        static bool WriteVector(AZ::IO::GenericStream& stream, const AZStd::vector<T>& values)
+        {
+            const AZ::u64 numValues = values.size();
+            if (!WriteValue(stream, numValues))
+            {
+                return false;
+            }
+            const AZ::IO::SizeType numBytes = numValues * sizeof(T);
+            return numBytes == 0 || stream.Write(numBytes, values.data()) == numBytes;
+        }
+
+        template<typename T>
+        static bool ReadVector(AZ::IO::GenericStream& stream, AZStd::vector<T>& outValues)
+        {
+            AZ::u64 numValues = 0;
+            if (!ReadValue(stream, numValues) || numValues * sizeof(T) > stream.GetLength() - stream.GetCurPos())
+            {
+                return false;
+            }
+            outValues.resize(numValues);
+            const AZ::IO::SizeType numBytes = numValues * sizeof(T);
+            return numBytes == 0 || stream.Read(numBytes, outValues.data()) == numBytes;
+        }
+    };
+} // namespace EMotionFX::MotionMatching
@@ -80,6 +80,16 @@ namespace EMotionFX::MotionMatching
             return m_data[row * m_columnCount + column];
         }
 
+        float* data()
+        {
+            return m_data.data();
+        }
+
+        const float* data() const
+        {
+            return m_data.data();
+        }
+
     private:
         AZStd::vector<float> m_data;
         size_t m_rowCount = 0;
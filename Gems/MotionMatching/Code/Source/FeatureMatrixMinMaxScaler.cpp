@@ -11,6 +11,7 @@
 #include <AzCore/IO/SystemFile.h>
 #include <Allocators.h>
 #include <AzCore/std/limits.h>
+#include <FeatureDatabaseCache.h>
 #include <FeatureMatrixMinMaxScaler.h>
 
 namespace EMotionFX::MotionMatching
@@ -162,6 +163,30 @@ namespace EMotionFX::MotionMatching
         return normalizedValue * m_dataRange[column] + m_dataMin[column];
     }
 
+    bool MinMaxScaler::Save(AZ::IO::GenericStream& stream) const
+    {
+        return FeatureDatabaseCache::WriteVector(stream, m_dataMin) &&
+            FeatureDatabaseCache::WriteVector(stream, m_dataMax) &&
+            FeatureDatabaseCache::WriteVector(stream, m_dataRange) &&
+            FeatureDatabaseCache::WriteValue(stream, m_clip) &&
+            FeatureDatabaseCache::WriteValue(stream, m_featureMin) &&
+            FeatureDatabaseCache::WriteValue(stream, m_featureMax) &&
+            FeatureDatabaseCache::WriteValue(stream, m_featureRange);
+    }
+
+    bool MinMaxScaler::Load(AZ::IO::GenericStream& stream)
+    {
+        return FeatureDatabaseCache::ReadVector(stream, m_dataMin) &&
+            FeatureDatabaseCache::ReadVector(stream, m_dataMax) &&
+            FeatureDatabaseCache::ReadVector(stream, m_dataRange) &&
+            FeatureDatabaseCache::ReadValue(stream, m_clip) &&
+            FeatureDatabaseCache::ReadValue(stream, m_featureMin) &&
+            FeatureDatabaseCache::ReadValue(stream, m_featureMax) &&
+            FeatureDatabaseCache::ReadValue(stream, m_featureRange) &&
+            m_dataMin.size() == m_dataMax.size() &&
+            m_dataMin.size() == m_dataRange.size();
+    }
+
     void MinMaxScaler::SaveMinMaxAsCsv(const char* filename, const AZStd::vector<AZStd::string>& columnNames)
     {
         AZStd::string data;
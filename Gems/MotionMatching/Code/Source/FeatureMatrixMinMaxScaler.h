@@ -38,6 +38,9 @@ namespace EMotionFX::MotionMatching
         AZ::Vector3 InverseTransform(const AZ::Vector3& value, FeatureMatrix::Index column) const override;
         float InverseTransform(float value, FeatureMatrix::Index column) const override;
 
+        bool Save(AZ::IO::GenericStream& stream) const override;
+        bool Load(AZ::IO::GenericStream& stream) override;
+
         const AZStd::vector<float>& GetMin() const { return m_dataMin; }
         const AZStd::vector<float>& GetMax() const { return m_dataMax; }
 
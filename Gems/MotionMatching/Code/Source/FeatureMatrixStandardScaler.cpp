@@ -10,6 +10,7 @@
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/std/string/conversions.h>
+#include <FeatureDatabaseCache.h>
 #include <FeatureMatrixStandardScaler.h>
 
 namespace EMotionFX::MotionMatching
@@ -150,6 +151,19 @@ namespace EMotionFX::MotionMatching
         return value * standardDeviation + m_means[column];
     }
 
+    bool StandardScaler::Save(AZ::IO::GenericStream& stream) const
+    {
+        return FeatureDatabaseCache::WriteVector(stream, m_means) &&
+            FeatureDatabaseCache::WriteVector(stream, m_standardDeviations);
+    }
+
+    bool StandardScaler::Load(AZ::IO::GenericStream& stream)
+    {
+        return FeatureDatabaseCache::ReadVector(stream, m_means) &&
+            FeatureDatabaseCache::ReadVector(stream, m_standardDeviations) &&
+            m_means.size() == m_standardDeviations.size();
+    }
+
     void StandardScaler::SaveAsCsv(const char* filename, const AZStd::vector<AZStd::string>& columnNames)
     {
         AZStd::string data;
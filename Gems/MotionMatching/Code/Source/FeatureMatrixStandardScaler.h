@@ -43,6 +43,9 @@ namespace EMotionFX::MotionMatching
         AZ::Vector3 InverseTransform(const AZ::Vector3& value, FeatureMatrix::Index column) const override;
         float InverseTransform(float value, FeatureMatrix::Index column) const override;
 
+        bool Save(AZ::IO::GenericStream& stream) const override;
+        bool Load(AZ::IO::GenericStream& stream) override;
+
         const AZStd::vector<float>& GetMeans() const
         {
             return m_means;
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/IO/GenericStreams.h>
 #include <AzCore/std/containers/span.h>
 #include <Allocators.h>
 #include <FeatureMatrix.h>
@@ -51,5 +52,9 @@ namespace EMotionFX::MotionMatching
         virtual AZ::Vector2 InverseTransform(const AZ::Vector2& value, FeatureMatrix::Index column) const = 0;
         virtual AZ::Vector3 InverseTransform(const AZ::Vector3& value, FeatureMatrix::Index column) const = 0;
         virtual FeatureMatrix InverseTransform(const FeatureMatrix& in) const = 0;
+
+        //! Write or read the fitted state in binary form, so that a transformer can be restored without fitting it again.
+        virtual bool Save(AZ::IO::GenericStream& stream) const = 0;
+        virtual bool Load(AZ::IO::GenericStream& stream) = 0;
     };
 } // namespace EMotionFX::MotionMatching
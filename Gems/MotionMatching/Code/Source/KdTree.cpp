@@ -7,10 +7,12 @@
  */
 
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/Debug/Timer.h>
 
 #include <KdTree.h>
 #include <Feature.h>
+#include <FeatureDatabaseCache.h>
 #include <Allocators.h>
 
 namespace EMotionFX::MotionMatching
@@ -160,6 +162,116 @@ namespace EMotionFX::MotionMatching
         return (m_numDimensions != 0);
     }
 
+    bool KdTree::Save(AZ::IO::GenericStream& stream) const
+    {
+        constexpr AZ::u32 invalidIndex = ~0u;
+        AZStd::unordered_map<const Node*, AZ::u32> nodeIndices;
+        for (size_t i = 0; i < m_nodes.size(); ++i)
+        {
+            nodeIndices[m_nodes[i]] = aznumeric_cast<AZ::u32>(i);
+        }
+        const auto toIndex = [&nodeIndices](const Node* node)
+        {
+            return node ? nodeIndices[node] : invalidIndex;
+        };
+
+        if (!FeatureDatabaseCache::WriteValue(stream, aznumeric_cast<AZ::u64>(m_numDimensions)) ||
+            !FeatureDatabaseCache::WriteValue(stream, aznumeric_cast<AZ::u64>(m_maxDepth)) ||
+            !FeatureDatabaseCache::WriteValue(stream, aznumeric_cast<AZ::u64>(m_minFramesPerLeaf)) ||
+            !FeatureDatabaseCache::WriteValue(stream, aznumeric_cast<AZ::u64>(m_nodes.size())))
+        {
+            return false;
+        }
+
+        for (const Node* node : m_nodes)
+        {
+            if (!FeatureDatabaseCache::WriteValue(stream, toIndex(node->m_leftNode)) ||
+                !FeatureDatabaseCache::WriteValue(stream, toIndex(node->m_rightNode)) ||
+                !FeatureDatabaseCache::WriteValue(stream, toIndex(node->m_parent)) ||
+                !FeatureDatabaseCache::WriteValue(stream, node->m_median) ||
+                !FeatureDatabaseCache::WriteValue(stream, aznumeric_cast<AZ::u64>(node->m_dimension)) ||
+                !FeatureDatabaseCache::WriteVector(stream, node->m_frames))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool KdTree::Load(AZ::IO::GenericStream& stream)
+    {
+        Clear();
+
+        AZ::u64 numDimensions = 0;
+        AZ::u64 maxDepth = 0;
+        AZ::u64 minFramesPerLeaf = 0;
+        AZ::u64 numNodes = 0;
+        if (!FeatureDatabaseCache::ReadValue(stream, numDimensions) ||
+            !FeatureDatabaseCache::ReadValue(stream, maxDepth) ||
+            !FeatureDatabaseCache::ReadValue(stream, minFramesPerLeaf) ||
+            !FeatureDatabaseCache::ReadValue(stream, numNodes))
+        {
+            return false;
+        }
+
+        m_nodes.resize(numNodes);
+        for (Node*& node : m_nodes)
+        {
+            node = aznew Node();
+        }
+
+        constexpr AZ::u32 invalidIndex = ~0u;
+        bool success = true;
+        const auto toNode = [this, &success](AZ::u32 index) -> Node*
+        {
+            if (index == invalidIndex)
+            {
+                return nullptr;
+            }
+            if (index >= m_nodes.size())
+            {
+                success = false;
+                return nullptr;
+            }
+            return m_nodes[index];
+        };
+
+        for (Node* node : m_nodes)
+        {
+            AZ::u32 leftIndex = invalidIndex;
+            AZ::u32 rightIndex = invalidIndex;
+            AZ::u32 parentIndex = invalidIndex;
+            AZ::u64 dimension = 0;
+            if (!FeatureDatabaseCache::ReadValue(stream, leftIndex) ||
+                !FeatureDatabaseCache::ReadValue(stream, rightIndex) ||
+                !FeatureDatabaseCache::ReadValue(stream, parentIndex) ||
+                !FeatureDatabaseCache::ReadValue(stream, node->m_median) ||
+                !FeatureDatabaseCache::ReadValue(stream, dimension) ||
+                !FeatureDatabaseCache::ReadVector(stream, node->m_frames))
+            {
+                success = false;
+                break;
+            }
+
+            node->m_leftNode = toNode(leftIndex);
+            node->m_rightNode = toNode(rightIndex);
+            node->m_parent = toNode(parentIndex);
+            node->m_dimension = dimension;
+        }
+
+        if (!success)
+        {
+            Clear();
+            return false;
+        }
+
+        m_numDimensions = numDimensions;
+        m_maxDepth = maxDepth;
+        m_minFramesPerLeaf = minFramesPerLeaf;
+        return true;
+    }
+
     size_t KdTree::GetNumNodes() const
     {
         return m_nodes.size();
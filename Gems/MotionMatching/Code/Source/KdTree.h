@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/IO/GenericStreams.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/std/containers/vector.h>
 
@@ -50,6 +51,11 @@ namespace EMotionFX::MotionMatching
 
         void FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const;
 
+        //! Write or read the built tree in binary form, so that it can be restored without building it again.
+        //! The nodes link to each other by index in the stored data.
+        bool Save(AZ::IO::GenericStream& stream) const;
+        bool Load(AZ::IO::GenericStream& stream);
+
     private:
         struct Node
         {
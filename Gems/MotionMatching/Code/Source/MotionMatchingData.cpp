@@ -9,18 +9,23 @@
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Timer.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
 #include <AzCore/Task/TaskGraph.h>
 
+#include <EMotionFX/Source/Actor.h>
 #include <EMotionFX/Source/ActorInstance.h>
 #include <EMotionFX/Source/AnimGraphPose.h>
 #include <EMotionFX/Source/Motion.h>
 
 #include <Allocators.h>
+#include <BruteForceSearch.h>
 #include <Feature.h>
+#include <FeatureDatabaseCache.h>
 #include <FeatureMatrixMinMaxScaler.h>
 #include <FeatureMatrixStandardScaler.h>
 #include <FeatureSchemaDefault.h>
@@ -39,6 +44,7 @@ namespace EMotionFX::MotionMatching
         : m_featureSchema(featureSchema)
     {
         m_kdTree = AZStd::make_unique<KdTree>();
+        m_bruteForceSearch = AZStd::make_unique<BruteForceSearch>();
     }
 
     MotionMatchingData::~MotionMatchingData()
@@ -60,17 +66,9 @@ namespace EMotionFX::MotionMatching
 
         // Initialize all features before we process each frame.
         FeatureMatrix::Index featureComponentCount = 0;
-        for (Feature* feature : m_featureSchema.GetFeatures())
+        if (!InitFeatures(actorInstance, featureComponentCount))
         {
-            Feature::InitSettings frameSettings;
-            frameSettings.m_actorInstance = actorInstance;
-            if (!feature->Init(frameSettings))
-            {
-                return false;
-            }
-
-            feature->SetColumnOffset(featureComponentCount);
-            featureComponentCount += feature->GetNumDimensions();
+            return false;
         }
 
         // Allocate memory for the feature matrix
@@ -140,6 +138,102 @@ namespace EMotionFX::MotionMatching
         return true;
     }
 
+    bool MotionMatchingData::InitFeatures(ActorInstance* actorInstance, FeatureMatrix::Index& outNumColumns)
+    {
+        outNumColumns = 0;
+        for (Feature* feature : m_featureSchema.GetFeatures())
+        {
+            Feature::InitSettings frameSettings;
+            frameSettings.m_actorInstance = actorInstance;
+            if (!feature->Init(frameSettings))
+            {
+                return false;
+            }
+
+            feature->SetColumnOffset(outNumColumns);
+            outNumColumns += feature->GetNumDimensions();
+        }
+
+        return true;
+    }
+
+    AZ::u64 MotionMatchingData::CalcFeatureDatabaseKey(const InitSettings& settings) const
+    {
+        size_t key = 0;
+        AZStd::hash_combine(key,
+            FeatureDatabaseCache::s_version,
+            m_frameDatabase.GetNumFrames(),
+            settings.m_frameImportSettings.m_sampleRate,
+            settings.m_importMirrored,
+            settings.m_maxKdTreeDepth,
+            settings.m_minFramesPerKdTreeNode,
+            settings.m_normalizeData,
+            static_cast<int>(settings.m_featureScalerType),
+            settings.m_featureTansformerSettings.m_featureMin,
+            settings.m_featureTansformerSettings.m_featureMax,
+            settings.m_featureTansformerSettings.m_clip);
+
+        // The skeleton the features get extracted for.
+        if (settings.m_actorInstance)
+        {
+            const Actor* actor = settings.m_actorInstance->GetActor();
+            AZStd::hash_combine(key, actor->GetNameString(), actor->GetNumNodes());
+        }
+
+        // The source motions.
+        for (const Motion* motion : settings.m_motionList)
+        {
+            AZStd::hash_combine(key, motion->GetNameString(), motion->GetFileNameString(), motion->GetDuration());
+        }
+
+        // The features including all their settings, as they are stored in the anim graph.
+        AZ::SerializeContext* serializeContext = nullptr;
+        AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
+        AZStd::vector<char> schemaBuffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> schemaStream(&schemaBuffer);
+        if (serializeContext && AZ::Utils::SaveObjectToStream(schemaStream, AZ::ObjectStream::ST_BINARY, &m_featureSchema, serializeContext))
+        {
+            AZStd::hash_range(key, schemaBuffer.begin(), schemaBuffer.end());
+        }
+        else
+        {
+            for (const Feature* feature : m_featureSchema.GetFeatures())
+            {
+                AZStd::hash_combine(key, feature->RTTI_GetType(), feature->GetId(), feature->GetNumDimensions());
+            }
+        }
+
+        return key;
+    }
+
+    void MotionMatchingData::CreateFeatureTransformer(const InitSettings& settings)
+    {
+        if (!settings.m_normalizeData)
+        {
+            m_featureTransformer.reset();
+            return;
+        }
+
+        switch (settings.m_featureScalerType)
+        {
+        case FeatureScalerType::StandardScalerType:
+            {
+                m_featureTransformer.reset(aznew StandardScaler());
+                break;
+            }
+        case FeatureScalerType::MinMaxScalerType:
+            {
+                m_featureTransformer.reset(aznew MinMaxScaler());
+                break;
+            }
+        default:
+            {
+                m_featureTransformer.reset();
+                AZ_Error("Motion Matching", false, "Unknown feature scaler type.")
+            }
+        }
+    }
+
     void MotionMatchingData::ExtractFeatureValuesRange(ActorInstance* actorInstance, FrameDatabase& frameDatabase, const FeatureSchema& featureSchema, FeatureMatrix& featureMatrix, size_t startFrame, size_t endFrame)
     {
         // Iterate over all frames and extract the data for this frame.
@@ -211,71 +305,93 @@ namespace EMotionFX::MotionMatching
                 (totalNumFramesImported / (float)settings.m_frameImportSettings.m_sampleRate) / 60.0f);
         }
 
-        ///////////////////////////////////////////////////////////////////////
-        // 2. Extract feature data and place the values into the feature matrix.
-
-        if (!ExtractFeatures(settings.m_actorInstance, &m_frameDatabase))
+        // Use all features other than the trajectory for the broad-phase search using the KD-Tree.
+        for (Feature* feature : m_featureSchema.GetFeatures())
         {
-            AZ_Error("Motion Matching", false, "Failed to extract features from motion database.");
-            return false;
+            if (feature->RTTI_GetType() != azrtti_typeid<FeatureTrajectory>())
+            {
+                m_featuresInKdTree.push_back(feature);
+            }
         }
 
-        ///////////////////////////////////////////////////////////////////////
-        // 3. Transform feature data / -matrix
-        // Note: Do this before initializing the KD-tree as the query vector will contain pre-transformed data as well.
-        if (settings.m_normalizeData)
+        // Try to load the precomputed feature matrix, transformer and KD-tree from the cache, which replaces steps 2 to 4.
+        bool loadedFromCache = false;
+        AZ::u64 cacheKey = 0;
+        AZStd::string cacheFilePath;
+        const bool useCache = !settings.m_featureDatabaseCacheFolder.empty() && m_frameDatabase.GetNumFrames() > 0;
+        if (useCache)
         {
-            AZ_PROFILE_SCOPE(Animation, "MotionMatchingData::TransformFeatures");
-            AZ::Debug::Timer transformFeatureTimer;
-            transformFeatureTimer.Stamp();
+            cacheKey = CalcFeatureDatabaseKey(settings);
+            cacheFilePath = FeatureDatabaseCache::GetFilePath(settings.m_featureDatabaseCacheFolder, cacheKey);
 
-            switch (settings.m_featureScalerType)
+            // The features still need to know their columns and the joints they are extracting the values for.
+            FeatureMatrix::Index numColumns = 0;
+            if (!InitFeatures(settings.m_actorInstance, numColumns))
             {
-            case FeatureScalerType::StandardScalerType:
-                {
-                    m_featureTransformer.reset(aznew StandardScaler());
-                    break;
-                }
-            case FeatureScalerType::MinMaxScalerType:
-                {
-                    m_featureTransformer.reset(aznew MinMaxScaler());
-                    break;
-                }
-            default:
-                {
-                    m_featureTransformer.reset();
-                    AZ_Error("Motion Matching", false, "Unknown feature scaler type.")
-                }
+                AZ_Error("Motion Matching", false, "Failed to initialize the features.");
+                return false;
             }
 
-            m_featureTransformer->Fit(m_featureMatrix, settings.m_featureTansformerSettings);
-            m_featureMatrix = m_featureTransformer->Transform(m_featureMatrix);
-
-            const float transformFeatureTime = transformFeatureTimer.GetDeltaTimeInSeconds();
-            AZ_Printf("Motion Matching", "Transforming/normalizing features took %.2f ms.", transformFeatureTime * 1000.0f);
-        }
-        else
-        {
-            m_featureTransformer.reset();
+            CreateFeatureTransformer(settings);
+            loadedFromCache = FeatureDatabaseCache::Load(cacheFilePath.c_str(), cacheKey, m_featureMatrix, m_featureTransformer.get(), *m_kdTree) &&
+                m_featureMatrix.rows() == m_frameDatabase.GetNumFrames() &&
+                m_featureMatrix.cols() == numColumns;
+            if (!loadedFromCache)
+            {
+                m_featureMatrix.Clear();
+                m_kdTree->Clear();
+            }
         }
 
-        ///////////////////////////////////////////////////////////////////////
-        // 4. Initialize the kd-tree used to accelerate the searches
+        if (!loadedFromCache)
         {
-            // Use all features other than the trajectory for the broad-phase search using the KD-Tree.
-            for (Feature* feature : m_featureSchema.GetFeatures())
+            ///////////////////////////////////////////////////////////////////////
+            // 2. Extract feature data and place the values into the feature matrix.
+
+            if (!ExtractFeatures(settings.m_actorInstance, &m_frameDatabase))
             {
-                if (feature->RTTI_GetType() != azrtti_typeid<FeatureTrajectory>())
-                {
-                    m_featuresInKdTree.push_back(feature);
-                }
+                AZ_Error("Motion Matching", false, "Failed to extract features from motion database.");
+                return false;
             }
 
+            ///////////////////////////////////////////////////////////////////////
+            // 3. Transform feature data / -matrix
+            // Note: Do this before initializing the KD-tree as the query vector will contain pre-transformed data as well.
+            CreateFeatureTransformer(settings);
+            if (m_featureTransformer)
+            {
+                AZ_PROFILE_SCOPE(Animation, "MotionMatchingData::TransformFeatures");
+                AZ::Debug::Timer transformFeatureTimer;
+                transformFeatureTimer.Stamp();
+
+                m_featureTransformer->Fit(m_featureMatrix, settings.m_featureTansformerSettings);
+                m_featureMatrix = m_featureTransformer->Transform(m_featureMatrix);
+
+                const float transformFeatureTime = transformFeatureTimer.GetDeltaTimeInSeconds();
+                AZ_Printf("Motion Matching", "Transforming/normalizing features took %.2f ms.", transformFeatureTime * 1000.0f);
+            }
+
+            ///////////////////////////////////////////////////////////////////////
+            // 4. Initialize the kd-tree used to accelerate the searches
             if (!m_kdTree->Init(m_frameDatabase, m_featureMatrix, m_featuresInKdTree, settings.m_maxKdTreeDepth, settings.m_minFramesPerKdTreeNode)) // Internally automatically clears any existing contents.
             {
                 AZ_Error("EMotionFX", false, "Failed to initialize KdTree acceleration structure.");
                 return false;
             }
+
+            if (useCache)
+            {
+                FeatureDatabaseCache::Save(cacheFilePath.c_str(), cacheKey, m_featureMatrix, m_featureTransformer.get(), *m_kdTree);
+            }
+        }
+
+        // The brute-force search uses the same features, so that both broad-phase searches share the query vector.
+        // It is a plain re-layout of the feature matrix, so it is cheaper to rebuild it than to cache it.
+        if (m_frameDatabase.GetNumFrames() > 0 &&
+            !m_bruteForceSearch->Init(m_featureMatrix, m_featuresInKdTree, settings.m_numBruteForceNearestFrames))
+        {
+            AZ_Error("EMotionFX", false, "Failed to initialize the brute-force search.");
+            return false;
         }
 
         const float initTime = initTimer.GetDeltaTimeInSeconds();
@@ -293,6 +409,7 @@ namespace EMotionFX::MotionMatching
         m_frameDatabase.Clear();
         m_featureMatrix.Clear();
         m_kdTree->Clear();
+        m_bruteForceSearch->Clear();
         m_featuresInKdTree.clear();
     }
 } // namespace EMotionFX::MotionMatching
@@ -11,9 +11,11 @@
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
 
 #include <EMotionFX/Source/EMotionFXConfig.h>
 
+#include <BruteForceSearch.h>
 #include <Feature.h>
 #include <FeatureSchema.h>
 #include <FrameDatabase.h>
@@ -54,11 +56,16 @@ namespace EMotionFX::MotionMatching
             FrameDatabase::FrameImportSettings m_frameImportSettings;
             size_t m_maxKdTreeDepth = 20;
             size_t m_minFramesPerKdTreeNode = 1000;
+            size_t m_numBruteForceNearestFrames = 1000; //< The number of frames the brute-force broad-phase search passes on to the narrow-phase.
             bool m_importMirrored = false;
 
             bool m_normalizeData = false;
             FeatureScalerType m_featureScalerType = StandardScalerType;
             FeatureMatrixTransformer::Settings m_featureTansformerSettings = {};
+
+            //! Folder to cache the extracted feature matrix, the fitted transformer and the KD-tree in, keyed by the motions and settings they were built from.
+            //! Instances and runs using the same data load the cached results rather than extracting the features again. Empty disables the cache.
+            AZStd::string m_featureDatabaseCacheFolder;
         };
         bool Init(const InitSettings& settings);
 
@@ -70,12 +77,22 @@ namespace EMotionFX::MotionMatching
         const FeatureMatrix& GetFeatureMatrix() const { return m_featureMatrix; }
         FeatureMatrixTransformer* GetFeatureTransformer() { return m_featureTransformer.get(); }
         const KdTree& GetKdTree() const { return *m_kdTree.get(); }
+        const BruteForceSearch& GetBruteForceSearch() const { return *m_bruteForceSearch.get(); }
         const AZStd::vector<Feature*>& GetFeaturesInKdTree() const { return m_featuresInKdTree; }
 
     protected:
         //! Extract features from the motion database (multi-threaded).
         bool ExtractFeatures(ActorInstance* actorInstance, FrameDatabase* frameDatabase);
 
+        //! Initialize the features and assign their columns in the feature matrix, without extracting any values yet.
+        bool InitFeatures(ActorInstance* actorInstance, FeatureMatrix::Index& outNumColumns);
+
+        //! Calculate the key identifying the feature database cache file for the imported frames and the given settings.
+        AZ::u64 CalcFeatureDatabaseKey(const InitSettings& settings) const;
+
+        //! Create the feature transformer for the given settings, or reset it in case the data is not normalized.
+        void CreateFeatureTransformer(const InitSettings& settings);
+
         //! Extract features for a given range of frames and store the values in the feature matrix.
         static void ExtractFeatureValuesRange(ActorInstance* actorInstance, FrameDatabase& frameDatabase, const FeatureSchema& featureSchema, FeatureMatrix& featureMatrix, size_t startFrame, size_t endFrame);
 
@@ -88,6 +105,7 @@ namespace EMotionFX::MotionMatching
         AZStd::unique_ptr<FeatureMatrixTransformer> m_featureTransformer;
 
         AZStd::unique_ptr<KdTree> m_kdTree; //< The acceleration structure to speed up the search for lowest cost frames.
+        AZStd::unique_ptr<BruteForceSearch> m_bruteForceSearch; //< Vectorized scan over the KD-tree features of all frames, as alternative broad-phase.
         AZStd::vector<Feature*> m_featuresInKdTree;
     };
 } // namespace EMotionFX::MotionMatching
@@ -39,6 +39,7 @@ namespace EMotionFX::MotionMatching
     AZ_CVAR_EXTERNED(bool, mm_debugDrawQueryPose);
     AZ_CVAR_EXTERNED(bool, mm_debugDrawQueryVelocities);
     AZ_CVAR_EXTERNED(bool, mm_useKdTree);
+    AZ_CVAR_EXTERNED(bool, mm_useBruteForceSearch);
 
     AZ_CLASS_ALLOCATOR_IMPL(MotionMatchingInstance, MotionMatchAllocator)
 
@@ -507,10 +508,12 @@ namespace EMotionFX::MotionMatching
             }
         }
 
-        // 2. Broad-phase search using KD-tree
-        if (mm_useKdTree)
+        // 2. Broad-phase search using KD-tree or the brute-force scan
+        const bool useBruteForceSearch = mm_useBruteForceSearch && m_data->GetBruteForceSearch().IsInitialized();
+        const bool useBroadPhase = mm_useKdTree || useBruteForceSearch;
+        if (useBroadPhase)
         {
-            AZ_PROFILE_SCOPE(Animation, "MM::BroadPhaseKDTree");
+            AZ_PROFILE_SCOPE(Animation, "MM::BroadPhase");
 
             AZStd::vector<float>& kdTreeQueryVector = m_kdTreeQueryVector.GetData();
             const AZStd::vector<float>& queryVectorData = m_queryVector.GetData();
@@ -525,7 +528,14 @@ namespace EMotionFX::MotionMatching
             AZ_Assert(startOffset == kdTreeQueryVector.size(), "Frame float vector is not the expected size.");
 
             // Find our nearest frames.
-            m_data->GetKdTree().FindNearestNeighbors(kdTreeQueryVector, m_nearestFrames);
+            if (useBruteForceSearch)
+            {
+                m_data->GetBruteForceSearch().FindNearestNeighbors(kdTreeQueryVector, m_nearestFrames);
+            }
+            else
+            {
+                m_data->GetKdTree().FindNearestNeighbors(kdTreeQueryVector, m_nearestFrames);
+            }
         }
 
         // 2. Narrow-phase, brute force find the actual best matching frame (frame with the minimal cost).
@@ -537,10 +547,10 @@ namespace EMotionFX::MotionMatching
         float minTrajectoryFutureCost = 0.0f;
 
         // Iterate through the frames filtered by the broad-phase search.
-        const size_t numFrames = mm_useKdTree ? m_nearestFrames.size() : frameDatabase.GetNumFrames();
+        const size_t numFrames = useBroadPhase ? m_nearestFrames.size() : frameDatabase.GetNumFrames();
         for (size_t i = 0; i < numFrames; ++i)
         {
-            const size_t frameIndex = mm_useKdTree ? m_nearestFrames[i] : i;
+            const size_t frameIndex = useBroadPhase ? m_nearestFrames[i] : i;
             const Frame& frame = frameDatabase.GetFrame(frameIndex);
 
             // TODO: This shouldn't be there, we should be discarding the frames when extracting the features and not at runtime when checking the cost.
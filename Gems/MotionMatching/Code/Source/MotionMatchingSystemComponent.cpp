@@ -45,9 +45,17 @@ namespace EMotionFX::MotionMatching
         "Use Kd-Tree to accelerate the motion matching search for the best next matching frame. "
         "Disabling it will heavily slow down performance and should only be done for debugging purposes");
 
+    AZ_CVAR(bool, mm_useBruteForceSearch, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Use the vectorized brute-force scan over all frames instead of the Kd-Tree for the broad-phase of the motion matching search. "
+        "It visits every frame, but passes the nearest frames rather than a whole Kd-Tree leaf on to the narrow-phase.");
+
     AZ_CVAR(bool, mm_multiThreadedInitialization, true, nullptr, AZ::ConsoleFunctorFlags::Null,
         "Use multi-threading to initialize motion matching.");
 
+    AZ_CVAR(bool, mm_cacheFeatureDatabase, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Cache the extracted feature matrix, feature transformer and Kd-Tree in the user folder and load them instead of initializing "
+        "motion matching from scratch when the same motions and settings are used again.");
+
     void MotionMatchingSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
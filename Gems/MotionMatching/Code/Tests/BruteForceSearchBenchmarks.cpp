@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <BruteForceSearch.h>
+#include <FeaturePosition.h>
+#include <FrameDatabase.h>
+#include <KdTree.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Compares the KD-tree with the brute-force scan as broad-phase, for the given number of frames (range 0) in the motion database.
+    class BroadPhaseSearchBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t s_numFeatures = 5;
+        static constexpr size_t s_numQueries = 50;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp(state);
+        }
+
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            InternalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void TearDown(benchmark::State& state) override
+        {
+            InternalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void InternalSetUp(const benchmark::State& state)
+        {
+            const size_t numFrames = aznumeric_cast<size_t>(state.range(0));
+
+            m_frameDatabase = AZStd::make_unique<FrameDatabase>();
+            m_featureMatrix = AZStd::make_unique<FeatureMatrix>();
+            m_kdTree = AZStd::make_unique<KdTree>();
+            m_bruteForceSearch = AZStd::make_unique<BruteForceSearch>();
+
+            for (size_t i = 0; i < s_numFeatures; ++i)
+            {
+                m_features.emplace_back(aznew FeaturePosition());
+                m_features.back()->SetColumnOffset(i * 3);
+            }
+            const size_t numDimensions = s_numFeatures * 3;
+
+            AZ::SimpleLcgRandom random(5678);
+            m_featureMatrix->resize(numFrames, numDimensions);
+            for (size_t frame = 0; frame < numFrames; ++frame)
+            {
+                m_frameDatabase->GetFrames().emplace_back(frame, nullptr, 0.0f, false);
+                for (size_t column = 0; column < numDimensions; ++column)
+                {
+                    (*m_featureMatrix)(frame, column) = random.GetRandomFloat();
+                }
+            }
+
+            m_kdTree->Init(*m_frameDatabase, *m_featureMatrix, m_features);
+            m_bruteForceSearch->Init(*m_featureMatrix, m_features);
+
+            m_queries.resize(s_numQueries);
+            for (AZStd::vector<float>& query : m_queries)
+            {
+                query.resize(numDimensions);
+                for (float& value : query)
+                {
+                    value = random.GetRandomFloat();
+                }
+                m_queryPointers.emplace_back(&query);
+            }
+            m_results.resize(s_numQueries);
+        }
+
+        void InternalTearDown()
+        {
+            for (Feature* feature : m_features)
+            {
+                delete feature;
+            }
+            m_features = {};
+            m_queries = {};
+            m_queryPointers = {};
+            m_results = {};
+            m_bruteForceSearch.reset();
+            m_kdTree.reset();
+            m_featureMatrix.reset();
+            m_frameDatabase.reset();
+        }
+
+        AZStd::unique_ptr<FrameDatabase> m_frameDatabase;
+        AZStd::unique_ptr<FeatureMatrix> m_featureMatrix;
+        AZStd::unique_ptr<KdTree> m_kdTree;
+        AZStd::unique_ptr<BruteForceSearch> m_bruteForceSearch;
+        AZStd::vector<Feature*> m_features;
+        AZStd::vector<AZStd::vector<float>> m_queries;
+        AZStd::vector<const AZStd::vector<float>*> m_queryPointers;
+        AZStd::vector<AZStd::vector<size_t>> m_results;
+    };
+
+    // Each iteration searches the nearest frames for all queries, like the searches of 50 characters within a frame.
+    BENCHMARK_DEFINE_F(BroadPhaseSearchBenchmarkFixture, BM_KdTree)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < s_numQueries; ++i)
+            {
+                m_kdTree->FindNearestNeighbors(m_queries[i], m_results[i]);
+            }
+            benchmark::DoNotOptimize(m_results.data());
+        }
+    }
+
+    BENCHMARK_DEFINE_F(BroadPhaseSearchBenchmarkFixture, BM_BruteForce)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < s_numQueries; ++i)
+            {
+                m_bruteForceSearch->FindNearestNeighbors(m_queries[i], m_results[i]);
+            }
+            benchmark::DoNotOptimize(m_results.data());
+        }
+    }
+
+    BENCHMARK_DEFINE_F(BroadPhaseSearchBenchmarkFixture, BM_BruteForceBatched)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_bruteForceSearch->FindNearestNeighbors(m_queryPointers, m_results);
+            benchmark::DoNotOptimize(m_results.data());
+        }
+    }
+
+    BENCHMARK_REGISTER_F(BroadPhaseSearchBenchmarkFixture, BM_KdTree)
+        ->Arg(5000)->Arg(20000)->Arg(100000)
+        ->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(BroadPhaseSearchBenchmarkFixture, BM_BruteForce)
+        ->Arg(5000)->Arg(20000)->Arg(100000)
+        ->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(BroadPhaseSearchBenchmarkFixture, BM_BruteForceBatched)
+        ->Arg(5000)->Arg(20000)->Arg(100000)
+        ->Unit(::benchmark::kMicrosecond);
+} // namespace EMotionFX::MotionMatching
+
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/algorithm.h>
+#include <BruteForceSearch.h>
+#include <FeaturePosition.h>
+#include <Fixture.h>
+
+namespace EMotionFX::MotionMatching
+{
+    class BruteForceSearchFixture
+        : public Fixture
+    {
+    public:
+        void SetUp() override
+        {
+            Fixture::SetUp();
+
+            // Two position features, with an unused column in between them and one at the end.
+            m_features.emplace_back(aznew FeaturePosition());
+            m_features[0]->SetColumnOffset(0);
+            m_features.emplace_back(aznew FeaturePosition());
+            m_features[1]->SetColumnOffset(4);
+
+            // A number of frames that doesn't fill all blocks of four.
+            AZ::SimpleLcgRandom random(1234);
+            m_featureMatrix.resize(1003, 8);
+            for (size_t row = 0; row < m_featureMatrix.rows(); ++row)
+            {
+                for (size_t column = 0; column < m_featureMatrix.cols(); ++column)
+                {
+                    m_featureMatrix(row, column) = random.GetRandomFloat() * 2.0f - 1.0f;
+                }
+            }
+
+            m_query = { 0.1f, -0.2f, 0.3f, 0.5f, 0.0f, -0.4f };
+        }
+
+        void TearDown() override
+        {
+            for (Feature* feature : m_features)
+            {
+                delete feature;
+            }
+            m_features.clear();
+            m_featureMatrix.Clear();
+            Fixture::TearDown();
+        }
+
+        AZStd::vector<size_t> FindNearestFramesReference(const AZStd::vector<float>& query, size_t numNearestFrames) const
+        {
+            const size_t columns[] = { 0, 1, 2, 4, 5, 6 };
+            AZStd::vector<AZStd::pair<float, size_t>> distances;
+            for (size_t row = 0; row < m_featureMatrix.rows(); ++row)
+            {
+                float distance = 0.0f;
+                for (size_t i = 0; i < query.size(); ++i)
+                {
+                    const float difference = m_featureMatrix(row, columns[i]) - query[i];
+                    distance += difference * difference;
+                }
+                distances.emplace_back(distance, row);
+            }
+            AZStd::sort(distances.begin(), distances.end());
+
+            AZStd::vector<size_t> result;
+            for (size_t i = 0; i < AZ::GetMin(numNearestFrames, distances.size()); ++i)
+            {
+                result.emplace_back(distances[i].second);
+            }
+            AZStd::sort(result.begin(), result.end());
+            return result;
+        }
+
+        FeatureMatrix m_featureMatrix;
+        AZStd::vector<Feature*> m_features;
+        AZStd::vector<float> m_query;
+    };
+
+    TEST_F(BruteForceSearchFixture, Init)
+    {
+        BruteForceSearch search;
+        EXPECT_FALSE(search.IsInitialized());
+        ASSERT_TRUE(search.Init(m_featureMatrix, m_features, 10));
+        EXPECT_TRUE(search.IsInitialized());
+        EXPECT_EQ(search.GetNumFrames(), 1003);
+        EXPECT_EQ(search.GetNumDimensions(), 6);
+        EXPECT_EQ(search.GetNumNearestFrames(), 10);
+
+        search.Clear();
+        EXPECT_FALSE(search.IsInitialized());
+    }
+
+    TEST_F(BruteForceSearchFixture, FindNearestNeighbors)
+    {
+        BruteForceSearch search;
+        ASSERT_TRUE(search.Init(m_featureMatrix, m_features, 10));
+
+        AZStd::vector<size_t> result;
+        search.FindNearestNeighbors(m_query, result);
+        AZStd::sort(result.begin(), result.end());
+        EXPECT_EQ(result, FindNearestFramesReference(m_query, 10));
+    }
+
+    TEST_F(BruteForceSearchFixture, FindNearestNeighborsReturnsAllFrames)
+    {
+        BruteForceSearch search;
+        ASSERT_TRUE(search.Init(m_featureMatrix, m_features, 5000));
+
+        AZStd::vector<size_t> result;
+        search.FindNearestNeighbors(m_query, result);
+        EXPECT_EQ(result.size(), 1003);
+    }
+
+    TEST_F(BruteForceSearchFixture, FindNearestNeighborsBatched)
+    {
+        BruteForceSearch search;
+        ASSERT_TRUE(search.Init(m_featureMatrix, m_features, 25));
+
+        const AZStd::vector<float> otherQuery = { -0.7f, 0.2f, 0.0f, 0.9f, -0.1f, 0.4f };
+        const AZStd::vector<const AZStd::vector<float>*> queries = { &m_query, &otherQuery };
+        AZStd::vector<AZStd::vector<size_t>> results(queries.size());
+        search.FindNearestNeighbors(queries, results);
+
+        for (size_t i = 0; i < queries.size(); ++i)
+        {
+            AZStd::sort(results[i].begin(), results[i].end());
+            EXPECT_EQ(results[i], FindNearestFramesReference(*queries[i], 25));
+        }
+    }
+} // namespace EMotionFX::MotionMatching
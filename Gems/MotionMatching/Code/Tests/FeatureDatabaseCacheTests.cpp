@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/algorithm.h>
+#include <FeatureDatabaseCache.h>
+#include <FeatureMatrixMinMaxScaler.h>
+#include <FeatureMatrixStandardScaler.h>
+#include <FeaturePosition.h>
+#include <Fixture.h>
+#include <FrameDatabase.h>
+#include <KdTree.h>
+
+namespace EMotionFX::MotionMatching
+{
+    class FeatureDatabaseCacheFixture
+        : public Fixture
+    {
+    public:
+        void SetUp() override
+        {
+            Fixture::SetUp();
+
+            m_features.emplace_back(aznew FeaturePosition());
+            m_features[0]->SetColumnOffset(0);
+
+            AZ::SimpleLcgRandom random(4321);
+            m_featureMatrix.resize(500, 3);
+            for (size_t row = 0; row < m_featureMatrix.rows(); ++row)
+            {
+                m_frameDatabase.GetFrames().emplace_back(row, nullptr, 0.0f, false);
+                for (size_t column = 0; column < m_featureMatrix.cols(); ++column)
+                {
+                    m_featureMatrix(row, column) = random.GetRandomFloat() * 2.0f - 1.0f;
+                }
+            }
+        }
+
+        void TearDown() override
+        {
+            for (Feature* feature : m_features)
+            {
+                delete feature;
+            }
+            m_features.clear();
+            m_featureMatrix.Clear();
+            m_frameDatabase.Clear();
+            Fixture::TearDown();
+        }
+
+        void ExpectSameTransform(const FeatureMatrixTransformer& expected, const FeatureMatrixTransformer& actual)
+        {
+            const FeatureMatrix expectedMatrix = expected.Transform(m_featureMatrix);
+            const FeatureMatrix actualMatrix = actual.Transform(m_featureMatrix);
+            for (size_t row = 0; row < m_featureMatrix.rows(); ++row)
+            {
+                for (size_t column = 0; column < m_featureMatrix.cols(); ++column)
+                {
+                    EXPECT_FLOAT_EQ(actualMatrix(row, column), expectedMatrix(row, column));
+                }
+            }
+        }
+
+        FrameDatabase m_frameDatabase;
+        FeatureMatrix m_featureMatrix;
+        AZStd::vector<Feature*> m_features;
+    };
+
+    TEST_F(FeatureDatabaseCacheFixture, StandardScalerRoundtrip)
+    {
+        StandardScaler scaler;
+        scaler.Fit(m_featureMatrix);
+
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        ASSERT_TRUE(scaler.Save(stream));
+
+        stream.Seek(0, AZ::IO::GenericStream::ST_SEEK_BEGIN);
+        StandardScaler loadedScaler;
+        ASSERT_TRUE(loadedScaler.Load(stream));
+        EXPECT_EQ(loadedScaler.GetMeans(), scaler.GetMeans());
+        EXPECT_EQ(loadedScaler.GetStandardDeviations(), scaler.GetStandardDeviations());
+        ExpectSameTransform(scaler, loadedScaler);
+    }
+
+    TEST_F(FeatureDatabaseCacheFixture, MinMaxScalerRoundtrip)
+    {
+        MinMaxScaler scaler;
+        FeatureMatrixTransformer::Settings settings;
+        settings.m_featureMin = -2.0f;
+        settings.m_featureMax = 3.0f;
+        settings.m_clip = true;
+        scaler.Fit(m_featureMatrix, settings);
+
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        ASSERT_TRUE(scaler.Save(stream));
+
+        stream.Seek(0, AZ::IO::GenericStream::ST_SEEK_BEGIN);
+        MinMaxScaler loadedScaler;
+        ASSERT_TRUE(loadedScaler.Load(stream));
+        EXPECT_EQ(loadedScaler.GetMin(), scaler.GetMin());
+        EXPECT_EQ(loadedScaler.GetMax(), scaler.GetMax());
+        ExpectSameTransform(scaler, loadedScaler);
+    }
+
+    TEST_F(FeatureDatabaseCacheFixture, KdTreeRoundtrip)
+    {
+        KdTree kdTree;
+        ASSERT_TRUE(kdTree.Init(m_frameDatabase, m_featureMatrix, m_features, /*maxDepth=*/10, /*minFramesPerLeaf=*/10));
+
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        ASSERT_TRUE(kdTree.Save(stream));
+
+        stream.Seek(0, AZ::IO::GenericStream::ST_SEEK_BEGIN);
+        KdTree loadedKdTree;
+        ASSERT_TRUE(loadedKdTree.Load(stream));
+        EXPECT_TRUE(loadedKdTree.IsInitialized());
+        EXPECT_EQ(loadedKdTree.GetNumNodes(), kdTree.GetNumNodes());
+        EXPECT_EQ(loadedKdTree.GetNumDimensions(), kdTree.GetNumDimensions());
+
+        const AZStd::vector<AZStd::vector<float>> queries = { { 0.0f, 0.0f, 0.0f }, { 0.5f, -0.5f, 0.25f }, { -0.9f, 0.8f, -0.1f } };
+        for (const AZStd::vector<float>& query : queries)
+        {
+            AZStd::vector<size_t> expected;
+            AZStd::vector<size_t> actual;
+            kdTree.FindNearestNeighbors(query, expected);
+            loadedKdTree.FindNearestNeighbors(query, actual);
+            EXPECT_EQ(actual, expected);
+        }
+    }
+
+    TEST_F(FeatureDatabaseCacheFixture, KdTreeLoadFailsOnTruncatedData)
+    {
+        KdTree kdTree;
+        ASSERT_TRUE(kdTree.Init(m_frameDatabase, m_featureMatrix, m_features, /*maxDepth=*/10, /*minFramesPerLeaf=*/10));
+
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        ASSERT_TRUE(kdTree.Save(stream));
+
+        buffer.resize(buffer.size() / 2);
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> truncatedStream(&buffer);
+        KdTree loadedKdTree;
+        EXPECT_FALSE(loadedKdTree.Load(truncatedStream));
+        EXPECT_FALSE(loadedKdTree.IsInitialized());
+        EXPECT_EQ(loadedKdTree.GetNumNodes(), 0);
+    }
+} // namespace EMotionFX::MotionMatching
@@ -14,6 +14,8 @@ set(FILES
     Source/Allocators.h
     Source/BlendTreeMotionMatchNode.cpp
     Source/BlendTreeMotionMatchNode.h
+    Source/BruteForceSearch.cpp
+    Source/BruteForceSearch.h
     Source/CsvSerializers.cpp
     Source/CsvSerializers.h
     Source/EventData.cpp
@@ -22,6 +24,8 @@ set(FILES
     Source/Frame.h
     Source/Feature.cpp
     Source/Feature.h
+    Source/FeatureDatabaseCache.cpp
+    Source/FeatureDatabaseCache.h
     Source/FeatureMatrix.cpp
     Source/FeatureMatrix.h
     Source/FeatureMatrixMinMaxScaler.cpp
@@ -8,6 +8,9 @@
 
 set(FILES
     Tests/Fixture.h
+    Tests/BruteForceSearchBenchmarks.cpp
+    Tests/BruteForceSearchTests.cpp
+    Tests/FeatureDatabaseCacheTests.cpp
     Tests/FeatureMatrixTests.cpp
     Tests/FeatureSchemaTests.cpp
     Tests/MinMaxScalerTests.cpp
@@ -117,9 +117,15 @@ namespace Multiplayer
         uint32_t currSerializerSize,
         NetComponentId componentId,
         PropertyIndex propertyIndex,
-        MultiplayerStats& stats
+        MultiplayerStats& stats,
+        AZStd::sys_time_t serializeStartTicks = 0
     )
     {
+        if (serializeStartTicks != 0)
+        {
+            stats.RecordPropertySerializeTime(modifyRecord, componentId, propertyIndex, AZStd::GetTimeNowTicks() - serializeStartTicks);
+        }
+
         const uint32_t updateSize = (currSerializerSize - prevSerializerSize);
         if (updateSize > 0)
         {
@@ -149,6 +155,7 @@ namespace Multiplayer
     {
         if (bitset.GetBit(bitIndex))
         {
+            const AZStd::sys_time_t serializeStartTicks = stats.m_recordReplicationCost ? AZStd::GetTimeNowTicks() : 0;
             const bool modifyRecord = serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject;
             const uint32_t prevUpdateSize = serializer.GetSize();
             serializer.ClearTrackedChangesFlag();
@@ -159,7 +166,7 @@ namespace Multiplayer
                 bitset.SetBit(bitIndex, false);
             }
             const uint32_t postUpdateSize = serializer.GetSize();
-            UpdateComponentMetrics(modifyRecord, prevUpdateSize, postUpdateSize, componentId, propertyIndex, stats);
+            UpdateComponentMetrics(modifyRecord, prevUpdateSize, postUpdateSize, componentId, propertyIndex, stats, serializeStartTicks);
         }
     }
 
@@ -174,6 +181,7 @@ namespace Multiplayer
         MultiplayerStats& stats
     )
     {
+        const AZStd::sys_time_t serializeStartTicks = stats.m_recordReplicationCost ? AZStd::GetTimeNowTicks() : 0;
         const bool modifyRecord = serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject;
         const uint32_t prevUpdateSize = serializer.GetSize();
         for (uint32_t i = 0; i < SIZE; ++i)
@@ -189,7 +197,7 @@ namespace Multiplayer
             }
         }
         const uint32_t postUpdateSize = serializer.GetSize();
-        UpdateComponentMetrics(modifyRecord, prevUpdateSize, postUpdateSize, componentId, propertyIndex, stats);
+        UpdateComponentMetrics(modifyRecord, prevUpdateSize, postUpdateSize, componentId, propertyIndex, stats, serializeStartTicks);
     }
 
     template <typename TYPE, AZStd::size_t SIZE>
@@ -203,6 +211,7 @@ namespace Multiplayer
         MultiplayerStats& stats
     )
     {
+        const AZStd::sys_time_t serializeStartTicks = stats.m_recordReplicationCost ? AZStd::GetTimeNowTicks() : 0;
         const bool modifyRecord = serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject;
         const uint32_t prevUpdateSize = serializer.GetSize();
         if (bitset.GetBit(SIZE))
@@ -231,6 +240,6 @@ namespace Multiplayer
             }
         }
         const uint32_t postUpdateSize = serializer.GetSize();
-        UpdateComponentMetrics(modifyRecord, prevUpdateSize, postUpdateSize, componentId, propertyIndex, stats);
+        UpdateComponentMetrics(modifyRecord, prevUpdateSize, postUpdateSize, componentId, propertyIndex, stats, serializeStartTicks);
     }
 }
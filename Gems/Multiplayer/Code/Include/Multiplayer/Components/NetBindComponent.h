@@ -14,6 +14,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
@@ -201,6 +202,19 @@ namespace Multiplayer
         void FillReplicationRecord(ReplicationRecord& replicationRecord) const;
         void FillTotalReplicationRecord(ReplicationRecord& replicationRecord) const;
 
+        //! Retrieves a serialized replication record and state delta previously cached for the same record.
+        //! Connections whose replicators need the same changes share a single serialization of the entity, the cache is
+        //! invalidated whenever a network property of the entity changes. Safe to call from multiple threads.
+        //! @param replicationRecord the record of the properties to serialize
+        //! @param outData           buffer to copy the cached serialization into
+        //! @return boolean true if a cached serialization was found
+        bool GetCachedStateDelta(const ReplicationRecord& replicationRecord, AzNetworking::PacketEncodingBuffer& outData) const;
+
+        //! Caches the serialization of a replication record and its state delta for other connections to reuse.
+        //! @param replicationRecord the record of the properties that were serialized
+        //! @param data              the serialized record and state delta
+        void CacheStateDelta(const ReplicationRecord& replicationRecord, const AzNetworking::PacketEncodingBuffer& data);
+
     private:
         void PreInit(AZ::Entity* entity, const PrefabEntityId& prefabEntityId, NetEntityId netEntityId, NetEntityRole netEntityRole);
 
@@ -258,6 +272,18 @@ namespace Multiplayer
         AZ::Event<>::Handler  m_handleNotifyChanges;
         AZ::Entity::EntityStateEvent::Handler m_handleEntityStateEvent;
 
+        // Serialized state deltas shared between connections, only valid while m_stateVersion doesn't change
+        struct StateDeltaCacheEntry
+        {
+            ReplicationRecord m_record;
+            uint32_t m_stateVersion = 0;
+            AZStd::vector<uint8_t> m_data;
+        };
+        mutable AZStd::mutex m_stateDeltaCacheMutex;
+        AZStd::vector<StateDeltaCacheEntry> m_stateDeltaCache;
+        uint32_t m_stateDeltaCacheNextEntry = 0;
+        uint32_t m_stateVersion = 0; // Incremented whenever the serialized state of the entity may have changed
+
         NetworkEntityHandle   m_netEntityHandle;
         NetEntityRole         m_netEntityRole   = NetEntityRole::InvalidRole;
         NetEntityId           m_netEntityId     = InvalidNetEntityId;
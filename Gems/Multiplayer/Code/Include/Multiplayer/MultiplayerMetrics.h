@@ -40,5 +40,12 @@ namespace Multiplayer
 
         // Other systems
         MultiplayerStat_PhysicsFrameTimeUs,
+
+        // Server load stats, sampled with the transport metrics
+        MultiplayerStat_FrameTimeP50Us,             // Median multiplayer tick cost over the transport metrics period
+        MultiplayerStat_FrameTimeP95Us,             // 95th percentile multiplayer tick cost over the transport metrics period
+        MultiplayerStat_FrameTimeP99Us,             // 99th percentile multiplayer tick cost over the transport metrics period
+        MultiplayerStat_SentBytesPerClientPerSecond, // Bytes sent to each client connection per second (applicable to a server)
+        MultiplayerStat_SystemAllocatedBytes,       // Bytes allocated from the system allocator
     };
 }
@@ -10,6 +10,7 @@
 
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/time.h>
 #include <AzCore/Time/ITime.h>
 #include <Multiplayer/MultiplayerTypes.h>
 
@@ -29,6 +30,13 @@ namespace Multiplayer
         uint64_t m_recordMetricIndex = 0;
         AZ::TimeMs m_totalHistoryTimeMs = AZ::Time::ZeroTimeMs;
 
+        //! Whether the CPU cost of the replication is measured, set from the net_RecordReplicationCost cvar on every TickStats().
+        bool m_recordReplicationCost = false;
+
+        //! Number of times the entity replicators checked their entity for changes to send, and the ticks it took.
+        uint64_t m_changeDetectionCalls = 0;
+        uint64_t m_changeDetectionTicks = 0;
+
         static const uint32_t RingbufferSamples = 32;
         using MetricRingbuffer = AZStd::array<uint64_t, RingbufferSamples>;
         struct Metric
@@ -36,6 +44,8 @@ namespace Multiplayer
             Metric();
             uint64_t m_totalCalls = 0;
             uint64_t m_totalBytes = 0;
+            //! Ticks of AZStd::GetTimeNowTicks() spent serializing, only recorded while m_recordReplicationCost is set.
+            uint64_t m_totalSerializeTicks = 0;
             MetricRingbuffer m_callHistory;
             MetricRingbuffer m_byteHistory;
         };
@@ -46,6 +56,9 @@ namespace Multiplayer
             AZStd::vector<Metric> m_propertyUpdatesRecv;
             AZStd::vector<Metric> m_rpcsSent;
             AZStd::vector<Metric> m_rpcsRecv;
+            //! Ticks spent serializing the whole component, including the replication record overhead of its properties.
+            uint64_t m_serializeTicksSent = 0;
+            uint64_t m_serializeTicksRecv = 0;
         };
         AZStd::vector<ComponentStats> m_componentStats;
 
@@ -57,6 +70,9 @@ namespace Multiplayer
         void RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
         void RecordRpcSent(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordRpcReceived(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
+        void RecordPropertySerializeTime(bool received, NetComponentId netComponentId, PropertyIndex propertyId, AZStd::sys_time_t ticks);
+        void RecordComponentSerializeTime(AzNetworking::SerializerMode mode, NetComponentId netComponentId, AZStd::sys_time_t ticks);
+        void RecordChangeDetectionTime(AZStd::sys_time_t ticks);
         void RecordFrameTime(AZ::TimeUs networkFrameTime);
         void TickStats(AZ::TimeMs metricFrameTimeMs);
 
@@ -10,6 +10,7 @@
 
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicator.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/ReplicationBudget.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/EntityDomains/IEntityDomain.h>
 #include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
@@ -191,6 +192,13 @@ namespace Multiplayer
         NetEntityIdSet m_replicatorsPendingSend;
         NetEntityIdSet m_replicatorsPendingReset;
 
+        ReplicationBudget m_replicationBudget;
+        ReplicationBudget::CandidateList m_proxySendCandidates;
+        AZ::TimeMs m_lastBudgetRefillTimeMs = AZ::Time::ZeroTimeMs;
+
+        //! Holds the data of the entity update being handled after it's decoded against its baseline
+        AzNetworking::PacketEncodingBuffer m_baselineDecodeBuffer;
+
         // Deferred RPC Sends
         RpcMessages m_deferredRpcMessagesReliable;
         RpcMessages m_deferredRpcMessagesUnreliable;
@@ -92,6 +92,10 @@ namespace Multiplayer
         bool HandlePropertyChangeMessage(AzNetworking::PacketId packetId, AzNetworking::ISerializer* serializer, bool notifyChanges);
         bool IsPacketIdValid(AzNetworking::PacketId packetId) const;
         AzNetworking::PacketId GetLastReceivedPacketId() const;
+        //! Keeps the data of a received update so later updates can be encoded against it.
+        void StoreReceivedBaseline(AzNetworking::PacketId packetId, const AzNetworking::PacketEncodingBuffer& data);
+        //! Returns the data of a previously received update, or nullptr if it's no longer available.
+        const AZStd::vector<uint8_t>* GetReceivedBaseline(AzNetworking::PacketId packetId) const;
 
         AZ::TimeMs GetResendTimeoutTimeMs() const;
 
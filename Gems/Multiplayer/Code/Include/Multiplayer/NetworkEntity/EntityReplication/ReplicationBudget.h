@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    class EntityReplicator;
+
+    //! @class ReplicationBudget
+    //! @brief Schedules proxy entity updates for a connection against a byte budget.
+    //! The budget is a token bucket refilled at the rate provided by the replication window. Candidates that get skipped
+    //! accumulate their priority, so entities that keep losing out to higher priority entities are eventually sent.
+    class ReplicationBudget
+    {
+    public:
+
+        //! The number of bytes assumed for an entity update until the entity has been sent at least once.
+        static constexpr uint32_t DefaultEstimatedUpdateSize = 64;
+
+        struct Candidate
+        {
+            EntityReplicator* m_replicator = nullptr;
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            float m_priority = 0.0f;
+            float m_accumulatedPriority = 0.0f;
+        };
+        using CandidateList = AZStd::vector<Candidate>;
+
+        //! Adds the bytes that became available since the previous refill.
+        //! @param bytesPerSecond the rate to refill at, 0 disables the budget
+        //! @param elapsedMs      time elapsed since the previous refill
+        //! @param burstMs        the amount of time worth of bytes the budget is allowed to save up
+        void Refill(uint32_t bytesPerSecond, AZ::TimeMs elapsedMs, AZ::TimeMs burstMs);
+
+        //! Returns true if updates are limited by the byte budget.
+        //! @return boolean true if the budget is enabled
+        bool IsLimited() const;
+
+        //! Returns the number of bytes currently available, this may be negative after sending a large update.
+        //! @return the number of bytes available to send
+        float GetAvailableBytes() const;
+
+        //! Greedily selects the highest accumulated priority candidates that fit into the available budget.
+        //! The candidates are reordered so the selected candidates come first, sorted by accumulated priority.
+        //! Selected candidates have their accumulated priority reset, skipped candidates accumulate their priority.
+        //! @param candidates the candidates with changes to send
+        //! @param maxCount   the maximum number of candidates to select
+        //! @return the number of selected candidates
+        uint32_t Schedule(CandidateList& candidates, uint32_t maxCount);
+
+        //! Records the bytes that were sent for an entity update.
+        //! @param netEntityId the entity the update was sent for
+        //! @param byteCount   the serialized size of the update
+        void Consume(NetEntityId netEntityId, uint32_t byteCount);
+
+        //! Clears the accumulated priority of an entity that has nothing left to send.
+        //! @param netEntityId the entity to clear
+        void ClearPriority(NetEntityId netEntityId);
+
+        //! Stops tracking an entity.
+        //! @param netEntityId the entity to remove
+        void Remove(NetEntityId netEntityId);
+
+    private:
+
+        struct EntityEntry
+        {
+            float m_accumulatedPriority = 0.0f;
+            uint32_t m_estimatedUpdateSize = DefaultEstimatedUpdateSize;
+        };
+
+        AZStd::unordered_map<NetEntityId, EntityEntry> m_entityEntries;
+        float m_availableBytes = 0.0f;
+        float m_capacityBytes = 0.0f;
+        uint32_t m_bytesPerSecond = 0;
+    };
+}
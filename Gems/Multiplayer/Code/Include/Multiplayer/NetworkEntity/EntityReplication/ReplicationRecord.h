@@ -54,6 +54,8 @@ namespace Multiplayer
         void Append(const ReplicationRecord &rhs);
         void Subtract(const ReplicationRecord &rhs);
         bool HasChanges() const;
+        //! Returns true if both records are for the same remote role and have the same bits set, ignoring consumed bits and packet ids.
+        bool HasSameChanges(const ReplicationRecord& rhs) const;
 
         bool Serialize(AzNetworking::ISerializer& serializer);
 
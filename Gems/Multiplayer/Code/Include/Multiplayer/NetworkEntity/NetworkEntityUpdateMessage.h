@@ -73,6 +73,18 @@ namespace Multiplayer
         //! @return the current value of PrefabEntityId
         const PrefabEntityId& GetPrefabEntityId() const;
 
+        //! Marks the data as a baseline delta, encoded against the data of an earlier update for the same entity.
+        //! @param baselinePacketId the id of the packet the baseline update was sent in
+        void SetBaselinePacketId(AzNetworking::PacketId baselinePacketId);
+
+        //! Returns true if the data is encoded against the data of an earlier update.
+        //! @return true if the data is a baseline delta
+        bool GetHasBaseline() const;
+
+        //! Gets the id of the packet the baseline update was sent in, only valid if GetHasBaseline returns true.
+        //! @return the baseline packet id
+        AzNetworking::PacketId GetBaselinePacketId() const;
+
         //! Sets the current value for Data
         //! @param value the value to set Data to
         void SetData(const AzNetworking::PacketEncodingBuffer& value);
@@ -97,7 +109,9 @@ namespace Multiplayer
         bool           m_isDelete = false;
         bool           m_wasMigrated = false;
         bool           m_hasValidPrefabId = false;
+        bool           m_hasBaseline = false;
         PrefabEntityId m_prefabEntityId;
+        AzNetworking::PacketId m_baselinePacketId = AzNetworking::InvalidPacketId;
 
         // Only allocated if we actually have data
         // This is to prevent blowing out stack memory if we declare an array of these EntityUpdateMessages
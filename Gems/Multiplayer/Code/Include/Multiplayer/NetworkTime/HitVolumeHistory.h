@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+
+namespace Multiplayer
+{
+    //! Shapes supported by lag compensated hit volume queries.
+    enum class HitVolumeShapeType : uint8_t
+    {
+        Sphere,
+        Capsule,
+        Box
+    };
+
+    //! Describes the shape of a hit volume, centered on the hit volume transform.
+    struct HitVolumeShape
+    {
+        HitVolumeShapeType m_type = HitVolumeShapeType::Sphere;
+        float m_radius = 0.0f;                                   //!< Sphere and capsule radius
+        float m_height = 0.0f;                                   //!< Total capsule height including the caps, oriented along the z-axis
+        AZ::Vector3 m_halfExtents = AZ::Vector3::CreateZero();   //!< Box half extents
+    };
+
+    //! A single hit volume found by a rewound query.
+    struct HitVolumeQueryResult
+    {
+        NetEntityId m_netEntityId = InvalidNetEntityId;
+        uint32_t m_hitVolumeIndex = 0;
+        float m_distance = 0.0f; //!< Distance along the ray to the hit, 0 for overlap queries
+    };
+    using HitVolumeQueryResults = AZStd::vector<HitVolumeQueryResult>;
+
+    using HitVolumeHandle = uint32_t;
+    static constexpr HitVolumeHandle InvalidHitVolumeHandle = AZStd::numeric_limits<HitVolumeHandle>::max();
+
+    //! @class HitVolumeHistory
+    //! @brief Keeps the world transforms of all registered hit volumes for the last RewindHistorySize host frames.
+    //! The history is a ring of frames, each frame stores every hit volume transform in structure of arrays layout, so that
+    //! lag compensated queries test all hit volumes of a past frame in a single vectorized pass over their bounding spheres,
+    //! instead of rewinding entities one at a time. Only the candidates that pass the bounding sphere test are tested against
+    //! their exact shape.
+    class HitVolumeHistory
+    {
+    public:
+        AZ_RTTI(HitVolumeHistory, "{4B6C1F0E-2D7A-4E5B-9C38-71A0D5E2B964}");
+
+        HitVolumeHistory();
+        virtual ~HitVolumeHistory() = default;
+
+        //! Starts recording a new host frame, hit volumes keep their previous transforms until they are updated.
+        //! @param frameId the host frame being recorded
+        void BeginFrame(HostFrameId frameId);
+
+        //! Registers a hit volume, it can't be hit in frames recorded before it was added.
+        //! @param netEntityId    the entity owning the hit volume
+        //! @param hitVolumeIndex the index of the hit volume within its entity
+        //! @param shape          the shape of the hit volume
+        //! @return the handle of the new hit volume
+        HitVolumeHandle AddHitVolume(NetEntityId netEntityId, uint32_t hitVolumeIndex, const HitVolumeShape& shape);
+
+        //! Unregisters a hit volume, it can still be hit in frames recorded before it was removed.
+        //! @param handle the handle of the hit volume to remove
+        void RemoveHitVolume(HitVolumeHandle handle);
+
+        //! Records the world transform of a hit volume for the frame being recorded.
+        //! @param handle         the handle of the hit volume
+        //! @param worldTransform the world transform of the hit volume, only uniform scale is supported
+        void SetTransform(HitVolumeHandle handle, const AZ::Transform& worldTransform);
+
+        //! Returns true if the frame is still within the recorded history.
+        //! @param frameId the host frame to check
+        //! @return boolean true if the frame can be queried
+        bool IsFrameRecorded(HostFrameId frameId) const;
+
+        //! Casts a ray against the hit volumes as they were at a past host frame.
+        //! @param frameId     the host frame to query
+        //! @param blendFactor the factor used to blend between the previous and the requested frame, as passed to INetworkTime::AlterTime
+        //! @param start       the start of the ray
+        //! @param direction   the normalized direction of the ray
+        //! @param maxDistance the length of the ray
+        //! @param outResults  receives all hit volumes hit by the ray, sorted by distance
+        //! @return boolean true if the frame was recorded and the query ran
+        bool Raycast(HostFrameId frameId, float blendFactor, const AZ::Vector3& start, const AZ::Vector3& direction, float maxDistance, HitVolumeQueryResults& outResults) const;
+
+        //! Finds the hit volumes overlapping a sphere as they were at a past host frame.
+        //! @param frameId     the host frame to query
+        //! @param blendFactor the factor used to blend between the previous and the requested frame, as passed to INetworkTime::AlterTime
+        //! @param center      the center of the sphere
+        //! @param radius      the radius of the sphere
+        //! @param outResults  receives all hit volumes overlapping the sphere
+        //! @return boolean true if the frame was recorded and the query ran
+        bool OverlapSphere(HostFrameId frameId, float blendFactor, const AZ::Vector3& center, float radius, HitVolumeQueryResults& outResults) const;
+
+        //! Returns the number of registered hit volumes.
+        //! @return the number of registered hit volumes
+        uint32_t GetHitVolumeCount() const;
+
+    private:
+
+        enum Stream : uint32_t
+        {
+            PositionX,
+            PositionY,
+            PositionZ,
+            RotationX,
+            RotationY,
+            RotationZ,
+            RotationW,
+            Scale,
+            BoundingRadius, // Negative for hit volumes that don't exist in the frame
+            StreamCount
+        };
+
+        struct HitVolume
+        {
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            uint32_t m_hitVolumeIndex = 0;
+            HitVolumeShape m_shape;
+            float m_boundingRadius = 0.0f;
+            HostFrameId m_releasedFrameId = InvalidHostFrameId;
+            bool m_isActive = false;
+        };
+
+        // The blended state of a single hit volume at the queried frame
+        struct RewoundHitVolume
+        {
+            AZ::Transform m_transform;
+            const HitVolume* m_hitVolume = nullptr;
+        };
+
+        using CandidateList = AZStd::vector<uint32_t>;
+
+        float* GetStream(uint32_t frameIndex, Stream stream);
+        const float* GetStream(uint32_t frameIndex, Stream stream) const;
+        uint32_t GetFrameIndex(HostFrameId frameId) const;
+        void Grow();
+
+        //! Resolves the frames to blend between, returns false if the frame isn't recorded.
+        bool GetQueryFrames(HostFrameId frameId, float blendFactor, uint32_t& outFrameIndex, uint32_t& outPreviousFrameIndex, float& outBlendFactor) const;
+        RewoundHitVolume GetRewoundHitVolume(uint32_t slot, uint32_t frameIndex, uint32_t previousFrameIndex, float blendFactor) const;
+
+        //! Vectorized bounding sphere pass, appends the slots of all hit volumes passing the test to outCandidates.
+        void GatherRaycastCandidates(uint32_t frameIndex, uint32_t previousFrameIndex, float blendFactor, const AZ::Vector3& start, const AZ::Vector3& direction, float maxDistance, CandidateList& outCandidates) const;
+        void GatherOverlapCandidates(uint32_t frameIndex, uint32_t previousFrameIndex, float blendFactor, const AZ::Vector3& center, float radius, CandidateList& outCandidates) const;
+
+        AZStd::vector<HitVolume> m_hitVolumes;
+        AZStd::vector<uint32_t> m_freeSlots;
+        AZStd::vector<float> m_frames; // [frame][stream][slot]
+        HostFrameId m_frameIds[RewindHistorySize];
+        HostFrameId m_currentFrameId = HostFrameId{ 0 };
+        uint32_t m_currentFrameIndex = 0;
+        uint32_t m_capacity = 0;
+        uint32_t m_hitVolumeCount = 0;
+    };
+
+    inline HitVolumeHistory* GetHitVolumeHistory()
+    {
+        return AZ::Interface<HitVolumeHistory>::Get();
+    }
+}
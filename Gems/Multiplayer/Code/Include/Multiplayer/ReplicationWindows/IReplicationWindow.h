@@ -45,6 +45,10 @@ namespace Multiplayer
         //! @return the max number of entities we can send updates for in one frame
         virtual uint32_t GetMaxProxyEntityReplicatorSendCount() const = 0;
 
+        //! Max number of bytes per second we can send entity updates at, proxy entity updates are prioritized to fit within this rate.
+        //! @return the max number of bytes per second to send entity updates at, 0 if entity updates are not limited by bandwidth
+        virtual uint32_t GetMaxEntityReplicatorSendRate() const = 0;
+
         //! Returns true if the provided network entity is within this replication window.
         //! @param entityPtr the handle of the entity to test for inclusion
         //! @param outNetworkRole output containing the network role of the requested entity if found
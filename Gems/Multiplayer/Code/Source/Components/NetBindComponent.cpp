@@ -25,6 +25,9 @@
 
 namespace Multiplayer
 {
+    AZ_CVAR(uint32_t, net_EntityStateDeltaCacheSize, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The number of serialized state deltas each entity keeps for sharing between connections, 0 disables sharing");
+
     void NetBindComponent::Reflect(AZ::ReflectContext* context)
     {
         PrefabEntityId::Reflect(context);
@@ -538,6 +541,10 @@ namespace Multiplayer
         }
         // This will modify the replicationRecord and clear out bits that have not changed from the local state, this prevents us from notifying that something has changed multiple times
         SerializeStateDeltaMessage(replicationRecord, serializer);
+        if (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject)
+        {
+            ++m_stateVersion;
+        }
 
         if (serializer.IsValid())
         {
@@ -584,6 +591,7 @@ namespace Multiplayer
 
     void NetBindComponent::MarkDirty()
     {
+        ++m_stateVersion;
         if (!m_handleMarkedDirty.IsConnected())
         {
             GetNetworkEntityManager()->AddEntityMarkedDirtyHandler(m_handleMarkedDirty);
@@ -599,6 +607,8 @@ namespace Multiplayer
 
     void NetBindComponent::NotifySyncRewindState()
     {
+        // Rewinding changes the values of rewindable properties without marking them dirty
+        ++m_stateVersion;
         m_syncRewindEvent.Signal();
     }
 
@@ -662,6 +672,7 @@ namespace Multiplayer
         const bool success = SerializeStateDeltaMessage(tmpRecord, serializer);
         if (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject)
         {
+            ++m_stateVersion;
             tmpRecord.ResetConsumedBits();
             NotifyStateDeltaChanges(tmpRecord);
         }
@@ -677,7 +688,13 @@ namespace Multiplayer
         serializer.BeginObject(GetEntity()->GetName().c_str());
         for (auto iter = m_multiplayerSerializationComponentVector.begin(); iter != m_multiplayerSerializationComponentVector.end(); ++iter)
         {
+            const AZStd::sys_time_t serializeStartTicks = stats.m_recordReplicationCost ? AZStd::GetTimeNowTicks() : 0;
             success &= (*iter)->SerializeStateDeltaMessage(replicationRecord, serializer);
+            if (serializeStartTicks != 0)
+            {
+                stats.RecordComponentSerializeTime(
+                    serializer.GetSerializerMode(), (*iter)->GetNetComponentId(), AZStd::GetTimeNowTicks() - serializeStartTicks);
+            }
             stats.RecordComponentSerializeEnd(serializer.GetSerializerMode(), (*iter)->GetNetComponentId());
         }
         serializer.EndObject(GetEntity()->GetName().c_str());
@@ -712,6 +729,60 @@ namespace Multiplayer
         }
     }
 
+    bool NetBindComponent::GetCachedStateDelta(const ReplicationRecord& replicationRecord, AzNetworking::PacketEncodingBuffer& outData) const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_stateDeltaCacheMutex);
+        for (const StateDeltaCacheEntry& entry : m_stateDeltaCache)
+        {
+            if ((entry.m_stateVersion == m_stateVersion) && entry.m_record.HasSameChanges(replicationRecord))
+            {
+                return outData.CopyValues(entry.m_data.data(), entry.m_data.size());
+            }
+        }
+        return false;
+    }
+
+    void NetBindComponent::CacheStateDelta(const ReplicationRecord& replicationRecord, const AzNetworking::PacketEncodingBuffer& data)
+    {
+        const uint32_t cacheSize = net_EntityStateDeltaCacheSize;
+        if (cacheSize == 0)
+        {
+            return;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_stateDeltaCacheMutex);
+        StateDeltaCacheEntry* cacheEntry = nullptr;
+        for (StateDeltaCacheEntry& entry : m_stateDeltaCache)
+        {
+            if (entry.m_stateVersion != m_stateVersion)
+            {
+                // Prefer replacing entries that are already stale
+                cacheEntry = &entry;
+            }
+            else if (entry.m_record.HasSameChanges(replicationRecord))
+            {
+                // Another connection cached the same record while we were serializing it
+                return;
+            }
+        }
+
+        if (cacheEntry == nullptr)
+        {
+            if (m_stateDeltaCache.size() < cacheSize)
+            {
+                cacheEntry = &m_stateDeltaCache.emplace_back();
+            }
+            else
+            {
+                cacheEntry = &m_stateDeltaCache[m_stateDeltaCacheNextEntry++ % m_stateDeltaCache.size()];
+            }
+        }
+
+        cacheEntry->m_record = replicationRecord;
+        cacheEntry->m_stateVersion = m_stateVersion;
+        cacheEntry->m_data.assign(data.GetBuffer(), data.GetBuffer() + data.GetSize());
+    }
+
     void NetBindComponent::PreInit(AZ::Entity* entity, const PrefabEntityId& prefabEntityId, NetEntityId netEntityId, NetEntityRole netEntityRole)
     {
         AZ_Assert(entity != nullptr, "AZ::Entity is null");
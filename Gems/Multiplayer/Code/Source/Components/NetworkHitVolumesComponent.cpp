@@ -23,6 +23,30 @@ namespace Multiplayer
     AZ_CVAR(float, bg_RewindPositionTolerance, 0.0001f, nullptr, AZ::ConsoleFunctorFlags::Null, "Don't sync the physx entity if the square of delta position is less than this value");
     AZ_CVAR(float, bg_RewindOrientationTolerance, 0.001f, nullptr, AZ::ConsoleFunctorFlags::Null, "Don't sync the physx entity if the square of delta orientation is less than this value");
 
+    static bool GetHitVolumeShape(const Physics::ShapeConfiguration* shapeConfig, HitVolumeShape& outShape)
+    {
+        if (const Physics::SphereShapeConfiguration* sphereConfig = azrtti_cast<const Physics::SphereShapeConfiguration*>(shapeConfig))
+        {
+            outShape.m_type = HitVolumeShapeType::Sphere;
+            outShape.m_radius = sphereConfig->m_radius * sphereConfig->m_scale.GetMaxElement();
+            return true;
+        }
+        else if (const Physics::CapsuleShapeConfiguration* capsuleConfig = azrtti_cast<const Physics::CapsuleShapeConfiguration*>(shapeConfig))
+        {
+            outShape.m_type = HitVolumeShapeType::Capsule;
+            outShape.m_radius = capsuleConfig->m_radius * AZStd::max(capsuleConfig->m_scale.GetX(), capsuleConfig->m_scale.GetY());
+            outShape.m_height = capsuleConfig->m_height * capsuleConfig->m_scale.GetZ();
+            return true;
+        }
+        else if (const Physics::BoxShapeConfiguration* boxConfig = azrtti_cast<const Physics::BoxShapeConfiguration*>(shapeConfig))
+        {
+            outShape.m_type = HitVolumeShapeType::Box;
+            outShape.m_halfExtents = boxConfig->m_dimensions * boxConfig->m_scale * 0.5f;
+            return true;
+        }
+        return false;
+    }
+
     NetworkHitVolumesComponent::AnimatedHitVolume::AnimatedHitVolume
     (
         AzNetworking::ConnectionId connectionId,
@@ -162,12 +186,20 @@ namespace Multiplayer
             CreateHitVolumes();
         }
 
+        HitVolumeHistory* hitVolumeHistory = GetHitVolumeHistory();
+        const AZ::Transform& worldTransform = GetEntity()->GetTransform()->GetWorldTM();
+
         AZ::Vector3 position, scale;
         AZ::Quaternion rotation;
         for (AnimatedHitVolume& hitVolume : m_animatedHitVolumes)
         {
             m_actorComponent->GetJointTransformComponents(hitVolume.m_jointIndex, EMotionFX::Integration::Space::ModelSpace, position, rotation, scale);
             hitVolume.UpdateTransform(AZ::Transform::CreateFromQuaternionAndTranslation(rotation, position) * hitVolume.m_colliderOffSetTransform);
+
+            if (hitVolumeHistory != nullptr && hitVolume.m_historyHandle != InvalidHitVolumeHandle)
+            {
+                hitVolumeHistory->SetTransform(hitVolume.m_historyHandle, worldTransform * hitVolume.m_transform.Get());
+            }
         }
 
         if (bg_DrawArticulatedHitVolumes)
@@ -227,10 +259,36 @@ namespace Multiplayer
                 m_animatedHitVolumes.emplace_back(owningConnectionId, m_physicsCharacter, nodeConfig.m_name.c_str(), colliderConfig, shapeConfig, aznumeric_cast<uint32_t>(jointIndex));
             }
         }
+
+        // Only the authority answers lag compensated queries, so only the authority records its hit volumes
+        HitVolumeHistory* hitVolumeHistory = GetHitVolumeHistory();
+        if (hitVolumeHistory != nullptr && GetNetBindComponent()->IsNetEntityRoleAuthority())
+        {
+            const NetEntityId netEntityId = GetNetEntityId();
+            for (uint32_t hitVolumeIndex = 0; hitVolumeIndex < m_animatedHitVolumes.size(); ++hitVolumeIndex)
+            {
+                AnimatedHitVolume& hitVolume = m_animatedHitVolumes[hitVolumeIndex];
+                HitVolumeShape shape;
+                if (GetHitVolumeShape(hitVolume.m_shapeConfig, shape))
+                {
+                    hitVolume.m_historyHandle = hitVolumeHistory->AddHitVolume(netEntityId, hitVolumeIndex, shape);
+                }
+            }
+        }
     }
 
     void NetworkHitVolumesComponent::DestroyHitVolumes()
     {
+        if (HitVolumeHistory* hitVolumeHistory = GetHitVolumeHistory())
+        {
+            for (const AnimatedHitVolume& hitVolume : m_animatedHitVolumes)
+            {
+                if (hitVolume.m_historyHandle != InvalidHitVolumeHandle)
+                {
+                    hitVolumeHistory->RemoveHitVolume(hitVolume.m_historyHandle);
+                }
+            }
+        }
         m_animatedHitVolumes.clear();
     }
 
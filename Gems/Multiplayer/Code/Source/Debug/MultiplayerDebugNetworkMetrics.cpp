@@ -109,6 +109,14 @@ namespace Multiplayer
                     ImGui::TableNextColumn();
                     ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_resentPackets));
                     ImGui::TableNextRow(); ImGui::TableNextColumn();
+                    ImGui::Text("Total packet buffers allocated");
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_packetBufferAllocations));
+                    ImGui::TableNextRow(); ImGui::TableNextColumn();
+                    ImGui::Text("Total packet buffers reused");
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_packetBufferReuses));
+                    ImGui::TableNextRow(); ImGui::TableNextColumn();
                     ImGui::Text("Total receive time (ms)");
                     ImGui::TableNextColumn();
                     ImGui::Text("%lld", aznumeric_cast<AZ::s64>(metrics.m_recvTimeMs));
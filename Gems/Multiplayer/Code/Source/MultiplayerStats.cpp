@@ -9,9 +9,14 @@
 #include <Multiplayer/MultiplayerMetrics.h>
 #include <Multiplayer/MultiplayerPerformanceStats.h>
 #include <Multiplayer/MultiplayerStats.h>
+#include <AzCore/Console/IConsole.h>
 
 namespace Multiplayer
 {
+    AZ_CVAR(bool, net_RecordReplicationCost, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Measures the CPU time spent serializing every network component and property, and checking entities for changes. "
+        "Use DumpReplicationCost to export the results as CSV.");
+
     MultiplayerStats::Metric::Metric()
     {
         AZStd::uninitialized_fill_n(m_callHistory.data(), RingbufferSamples, 0);
@@ -127,8 +132,41 @@ namespace Multiplayer
         m_events.m_rpcReceived.Signal(entityId, entityName, netComponentId, rpcId, totalBytes);
     }
 
+    void MultiplayerStats::RecordPropertySerializeTime(bool received, NetComponentId netComponentId, PropertyIndex propertyId, AZStd::sys_time_t ticks)
+    {
+        const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
+        const uint16_t propertyIndex = aznumeric_cast<uint16_t>(propertyId);
+        AZStd::vector<Metric>& metrics = received
+            ? m_componentStats[netComponentIndex].m_propertyUpdatesRecv
+            : m_componentStats[netComponentIndex].m_propertyUpdatesSent;
+        if (metrics.size() > propertyIndex)
+        {
+            metrics[propertyIndex].m_totalSerializeTicks += aznumeric_cast<uint64_t>(ticks);
+        }
+    }
+
+    void MultiplayerStats::RecordComponentSerializeTime(AzNetworking::SerializerMode mode, NetComponentId netComponentId, AZStd::sys_time_t ticks)
+    {
+        const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
+        if (m_componentStats.size() > netComponentIndex)
+        {
+            uint64_t& serializeTicks = mode == AzNetworking::SerializerMode::WriteToObject
+                ? m_componentStats[netComponentIndex].m_serializeTicksRecv
+                : m_componentStats[netComponentIndex].m_serializeTicksSent;
+            serializeTicks += aznumeric_cast<uint64_t>(ticks);
+        }
+    }
+
+    void MultiplayerStats::RecordChangeDetectionTime(AZStd::sys_time_t ticks)
+    {
+        ++m_changeDetectionCalls;
+        m_changeDetectionTicks += aznumeric_cast<uint64_t>(ticks);
+    }
+
     void MultiplayerStats::TickStats(AZ::TimeMs metricFrameTimeMs)
     {
+        m_recordReplicationCost = net_RecordReplicationCost;
+
         SET_PERFORMANCE_STAT(MultiplayerStat_EntityCount, m_entityCount);
         SET_PERFORMANCE_STAT(MultiplayerStat_ClientConnectionCount, m_clientConnectionCount);
 
@@ -163,6 +201,7 @@ namespace Multiplayer
     {
         outArg1.m_totalCalls += arg2.m_totalCalls;
         outArg1.m_totalBytes += arg2.m_totalBytes;
+        outArg1.m_totalSerializeTicks += arg2.m_totalSerializeTicks;
         for (uint32_t index = 0; index < MultiplayerStats::RingbufferSamples; ++index)
         {
             outArg1.m_callHistory[index] += arg2.m_callHistory[index];
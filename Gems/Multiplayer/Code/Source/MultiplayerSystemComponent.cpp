@@ -27,6 +27,8 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Metrics/IEventLoggerFactory.h>
 #include <AzCore/Component/ComponentApplicationLifecycle.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/IConsole.h>
@@ -86,6 +88,13 @@ namespace Multiplayer
 {
     using namespace AzNetworking;
 
+    //! Returns the value at the given percentile (0-100) of a sorted, non-empty set of frame times.
+    static AZ::s64 GetSortedPercentile(const AZStd::vector<AZ::TimeUs>& sortedFrameTimes, size_t percentile)
+    {
+        const size_t index = (sortedFrameTimes.size() - 1) * percentile / 100;
+        return static_cast<AZ::s64>(sortedFrameTimes[index]);
+    }
+
     AZ_CVAR(uint16_t, cl_clientport, 0, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "The port to bind to for game traffic when connecting to a remote host, a value of 0 will select any available port");
     AZ_CVAR(AZ::CVarFixedString, cl_serveraddr, AZ::CVarFixedString(LocalHost), nullptr, AZ::ConsoleFunctorFlags::DontReplicate, 
@@ -128,10 +137,20 @@ namespace Multiplayer
     AZ_CVAR(AZ::TimeMs, bg_captureTransportPeriod, AZ::TimeMs{1000}, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "How often in milliseconds to record transport metrics.");
 
+    AZ_CVAR(AZ::TimeMs, sv_benchmarkDuration, AZ::Time::ZeroTimeMs, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If nonzero, a dedicated server measures its load for this many milliseconds once sv_benchmarkClientCount clients are connected, "
+        "writes a BenchmarkSummary event to the server metrics file and exits. Use it with scripted client launchers to benchmark a level.");
+    AZ_CVAR(uint32_t, sv_benchmarkClientCount, 1, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The number of connected clients a dedicated server waits for before starting the sv_benchmarkDuration measurement.");
+
     AZ_CVAR(bool, sv_multithreadedConnectionUpdates, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "If true, the server will send updates to clients on different threads, which improves performance with large number of clients");
     AZ_CVAR(bool, bg_parallelNotifyPreRender, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "If true, OnPreRender events will be sent in parallel from job threads. Please make sure the handlers of the event are thread safe.");
+    AZ_CVAR(bool, sv_InterestGridEnabled, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, server to client replication windows gather relevant entities from an incrementally updated interest grid instead of querying the visibility system");
+    AZ_CVAR(float, sv_InterestGridCellSize, 64.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The size in meters of the interest grid cells, takes effect the next time the grid is created");
     
 
     void MultiplayerSystemComponent::Reflect(AZ::ReflectContext* context)
@@ -359,6 +378,12 @@ namespace Multiplayer
         DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_TotalPacketsDiscardedDueToLoad, "TotalPacketsDiscardedDueToLoad");
 
         DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_PhysicsFrameTimeUs, "PhysicsFrameTimeUs");        
+
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_FrameTimeP50Us, "FrameTimeP50Us");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_FrameTimeP95Us, "FrameTimeP95Us");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_FrameTimeP99Us, "FrameTimeP99Us");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_SentBytesPerClientPerSecond, "SentBytesPerClientPerSecond");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_SystemAllocatedBytes, "SystemAllocatedBytes");
     }
 
     void MultiplayerSystemComponent::Deactivate()
@@ -372,6 +397,7 @@ namespace Multiplayer
         m_consoleCommandHandler.Disconnect();
         const AZ::Name interfaceName = AZ::Name(MpNetworkInterfaceName);
         AZ::Interface<INetworking>::Get()->DestroyNetworkInterface(interfaceName);
+        m_interestGrid.reset();
         AzFramework::LevelLoadBlockerBus::Handler::BusDisconnect();
         SessionNotificationBus::Handler::BusDisconnect();
         AZ::TickBus::Handler::BusDisconnect();
@@ -601,6 +627,12 @@ namespace Multiplayer
         // Metrics calculation, as update calls are threaded.
         UpdatedMetricsConnectionCount();
 
+        // Bring the interest grid up to date before the replication windows gather from it
+        if (m_interestGrid != nullptr)
+        {
+            m_interestGrid->Update(*GetNetworkEntityTracker());
+        }
+
         // Send out the game state update to all connections
         UpdateConnections();
 
@@ -635,7 +667,14 @@ namespace Multiplayer
 
         const auto duration =
             AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - startMultiplayerTickTime);
-        stats.RecordFrameTime(AZ::TimeUs{ duration.count() });
+        const AZ::TimeUs frameTime = AZ::TimeUs{ duration.count() };
+        stats.RecordFrameTime(frameTime);
+
+        if (m_metricsEvent.IsScheduled())
+        {
+            m_metricsFrameTimes.push_back(frameTime);
+        }
+        UpdateBenchmark(frameTime);
     }
 
     void MultiplayerSystemComponent::UpdatedMetricsConnectionCount()
@@ -661,6 +700,9 @@ namespace Multiplayer
 
     void MultiplayerSystemComponent::UpdateConnections()
     {
+        // Hand the updates for every connection to the socket in batches rather than one packet at a time
+        m_networkInterface->BeginSendBatch();
+
         if (sv_multithreadedConnectionUpdates && (GetAgentType() == MultiplayerAgentType::ClientServer ||
                                                   GetAgentType() == MultiplayerAgentType::DedicatedServer))
         {
@@ -702,6 +744,8 @@ namespace Multiplayer
 
             m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
         }
+
+        m_networkInterface->FlushSendBatch();
     }
 
     int MultiplayerSystemComponent::GetTickOrder()
@@ -1565,6 +1609,79 @@ namespace Multiplayer
         AZLOG_INFO("Total RPCs received bytes: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalBytes));
     }
 
+    void MultiplayerSystemComponent::DumpReplicationCost(const AZ::ConsoleCommandContainer& arguments)
+    {
+        const MultiplayerStats& stats = GetStats();
+        const MultiplayerComponentRegistry* componentRegistry = GetMultiplayerComponentRegistry();
+        const double ticksPerMicrosecond = static_cast<double>(AZStd::GetTimeTicksPerSecond()) / 1000000.0;
+
+        AZStd::string csv = "Component,Member,Type,Calls,Bytes,SerializeUs\n";
+        auto appendRow = [&csv, ticksPerMicrosecond](const char* componentName, const char* memberName, const char* type,
+            uint64_t calls, uint64_t bytes, uint64_t serializeTicks)
+        {
+            csv += AZStd::string::format("\"%s\",\"%s\",%s,%llu,%llu,%.3f\n", componentName, memberName, type, aznumeric_cast<AZ::u64>(calls),
+                aznumeric_cast<AZ::u64>(bytes), static_cast<double>(serializeTicks) / ticksPerMicrosecond);
+        };
+        auto appendMetrics = [&appendRow](const char* componentName, const AZStd::vector<MultiplayerStats::Metric>& metrics, const char* type,
+            const auto& getMemberName)
+        {
+            for (AZStd::size_t index = 0; index < metrics.size(); ++index)
+            {
+                const MultiplayerStats::Metric& metric = metrics[index];
+                if (metric.m_totalCalls > 0 || metric.m_totalSerializeTicks > 0)
+                {
+                    appendRow(componentName, getMemberName(index), type, metric.m_totalCalls, metric.m_totalBytes, metric.m_totalSerializeTicks);
+                }
+            }
+        };
+
+        for (AZStd::size_t index = 0; index < stats.m_componentStats.size(); ++index)
+        {
+            const NetComponentId netComponentId = aznumeric_cast<NetComponentId>(index);
+            const MultiplayerStats::ComponentStats& componentStats = stats.m_componentStats[index];
+            const char* componentName = componentRegistry->GetComponentName(netComponentId);
+            auto getPropertyName = [componentRegistry, netComponentId](AZStd::size_t propertyIndex)
+            {
+                return componentRegistry->GetComponentPropertyName(netComponentId, aznumeric_cast<PropertyIndex>(propertyIndex));
+            };
+            auto getRpcName = [componentRegistry, netComponentId](AZStd::size_t rpcIndex)
+            {
+                return componentRegistry->GetComponentRpcName(netComponentId, aznumeric_cast<RpcIndex>(rpcIndex));
+            };
+
+            // The component rows hold the time of the whole component serialization, the record overhead included
+            const MultiplayerStats::Metric propertyUpdatesSent = stats.CalculateComponentPropertyUpdateSentMetrics(netComponentId);
+            const MultiplayerStats::Metric propertyUpdatesRecv = stats.CalculateComponentPropertyUpdateRecvMetrics(netComponentId);
+            if (propertyUpdatesSent.m_totalCalls > 0 || componentStats.m_serializeTicksSent > 0)
+            {
+                appendRow(componentName, "", "ComponentSent", propertyUpdatesSent.m_totalCalls, propertyUpdatesSent.m_totalBytes,
+                    componentStats.m_serializeTicksSent);
+            }
+            if (propertyUpdatesRecv.m_totalCalls > 0 || componentStats.m_serializeTicksRecv > 0)
+            {
+                appendRow(componentName, "", "ComponentRecv", propertyUpdatesRecv.m_totalCalls, propertyUpdatesRecv.m_totalBytes,
+                    componentStats.m_serializeTicksRecv);
+            }
+            appendMetrics(componentName, componentStats.m_propertyUpdatesSent, "PropertySent", getPropertyName);
+            appendMetrics(componentName, componentStats.m_propertyUpdatesRecv, "PropertyRecv", getPropertyName);
+            appendMetrics(componentName, componentStats.m_rpcsSent, "RpcSent", getRpcName);
+            appendMetrics(componentName, componentStats.m_rpcsRecv, "RpcRecv", getRpcName);
+        }
+        appendRow("", "", "ChangeDetection", stats.m_changeDetectionCalls, 0, stats.m_changeDetectionTicks);
+
+        const AZStd::string outputPath = !arguments.empty()
+            ? AZStd::string(arguments.front())
+            : AZStd::string::format("@user@/Multiplayer/replication_cost_%lld.csv", static_cast<long long>(AZStd::GetTimeNowSecond()));
+        if (auto writeOutcome = AZ::Utils::WriteFile(csv, outputPath); writeOutcome.IsSuccess())
+        {
+            AZLOG_INFO("Replication cost written to %s", outputPath.c_str());
+        }
+        else
+        {
+            AZLOG_WARN("Failed to write the replication cost to %s: %s", outputPath.c_str(), writeOutcome.GetError().c_str());
+        }
+    }
+
     void MultiplayerSystemComponent::TickVisibleNetworkEntities(float deltaTime, float serverRateSeconds)
     {
         AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: TickVisibleNetworkEntities");
@@ -1853,7 +1970,13 @@ namespace Multiplayer
     {
         if (auto connectionData = reinterpret_cast<ServerToClientConnectionData*>(connection->GetUserData()))
         {
-            AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection);
+            if (sv_InterestGridEnabled && m_interestGrid == nullptr)
+            {
+                m_interestGrid = AZStd::make_unique<InterestGrid>(sv_InterestGridCellSize);
+            }
+            InterestGrid* interestGrid = sv_InterestGridEnabled ? m_interestGrid.get() : nullptr;
+
+            AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection, interestGrid);
             connectionData->GetReplicationManager().SetReplicationWindow(AZStd::move(window));
             connectionData->SetControlledEntity(controlledEntity);
 
@@ -1893,8 +2016,114 @@ namespace Multiplayer
             SET_PERFORMANCE_STAT(MultiplayerStat_TotalReceivedBytesBeforeCompression, metrics.m_recvBytesUncompressed);
             SET_PERFORMANCE_STAT(MultiplayerStat_TotalPacketsDiscardedDueToLoad, metrics.m_discardedPackets);
 
+            const AZ::u64 clientCount = GetStats().m_clientConnectionCount;
+            const double periodSeconds = AZ::TimeMsToSecondsDouble(static_cast<AZ::TimeMs>(bg_captureTransportPeriod));
+            if (clientCount > 0 && periodSeconds > 0.0 && metrics.m_sendBytes >= m_metricsLastSentBytes)
+            {
+                const double sentBytes = static_cast<double>(metrics.m_sendBytes - m_metricsLastSentBytes);
+                SET_PERFORMANCE_STAT(MultiplayerStat_SentBytesPerClientPerSecond, sentBytes / static_cast<double>(clientCount) / periodSeconds);
+            }
+            m_metricsLastSentBytes = metrics.m_sendBytes;
+
             break; // Assuming there is only one network interface for communicating with clients
         }
+
+        if (!m_metricsFrameTimes.empty())
+        {
+            AZStd::sort(m_metricsFrameTimes.begin(), m_metricsFrameTimes.end());
+            SET_PERFORMANCE_STAT(MultiplayerStat_FrameTimeP50Us, GetSortedPercentile(m_metricsFrameTimes, 50));
+            SET_PERFORMANCE_STAT(MultiplayerStat_FrameTimeP95Us, GetSortedPercentile(m_metricsFrameTimes, 95));
+            SET_PERFORMANCE_STAT(MultiplayerStat_FrameTimeP99Us, GetSortedPercentile(m_metricsFrameTimes, 99));
+            m_metricsFrameTimes.clear();
+        }
+
+        const size_t allocatedBytes = AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes();
+        SET_PERFORMANCE_STAT(MultiplayerStat_SystemAllocatedBytes, allocatedBytes);
+        m_benchmarkPeakAllocatedBytes = AZStd::max(m_benchmarkPeakAllocatedBytes, allocatedBytes);
+    }
+
+    void MultiplayerSystemComponent::UpdateBenchmark(AZ::TimeUs frameTime)
+    {
+        const AZ::TimeMs benchmarkDuration = sv_benchmarkDuration;
+        if (benchmarkDuration <= AZ::Time::ZeroTimeMs || m_benchmarkComplete || GetAgentType() != MultiplayerAgentType::DedicatedServer)
+        {
+            return;
+        }
+
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+        if (m_benchmarkFrameTimes.empty())
+        {
+            if (GetStats().m_clientConnectionCount < sv_benchmarkClientCount)
+            {
+                return;
+            }
+
+            AZLOG_INFO("Starting a %lld ms server benchmark with %llu connected clients.",
+                static_cast<long long>(benchmarkDuration), static_cast<unsigned long long>(GetStats().m_clientConnectionCount));
+            m_benchmarkStartTimeMs = currentTimeMs;
+            m_benchmarkStartSentBytes = m_networkInterface->GetMetrics().m_sendBytes;
+            m_benchmarkPeakAllocatedBytes = AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes();
+        }
+
+        m_benchmarkFrameTimes.push_back(frameTime);
+        if (currentTimeMs - m_benchmarkStartTimeMs < benchmarkDuration)
+        {
+            return;
+        }
+
+        m_benchmarkComplete = true;
+        RecordBenchmarkSummary(currentTimeMs - m_benchmarkStartTimeMs);
+        AZLOG_INFO("Server exiting after completing the benchmark (sv_benchmarkDuration=%lld)", static_cast<long long>(benchmarkDuration));
+        Terminate(DisconnectReason::TerminatedByServer);
+        AzFramework::ApplicationRequests::Bus::Broadcast(&AzFramework::ApplicationRequests::ExitMainLoop);
+    }
+
+    void MultiplayerSystemComponent::RecordBenchmarkSummary(AZ::TimeMs benchmarkDuration)
+    {
+        AZStd::sort(m_benchmarkFrameTimes.begin(), m_benchmarkFrameTimes.end());
+        const AZ::u64 clientCount = AZStd::max<AZ::u64>(GetStats().m_clientConnectionCount, 1);
+        const AZ::u64 entityCount = GetStats().m_entityCount;
+        const uint64_t sentBytes = m_networkInterface->GetMetrics().m_sendBytes - m_benchmarkStartSentBytes;
+        const double durationSeconds = AZStd::max(AZ::TimeMsToSecondsDouble(benchmarkDuration), 0.001);
+
+        const AZ::s64 frameTimeP50Us = GetSortedPercentile(m_benchmarkFrameTimes, 50);
+        const AZ::s64 frameTimeP95Us = GetSortedPercentile(m_benchmarkFrameTimes, 95);
+        const AZ::s64 frameTimeP99Us = GetSortedPercentile(m_benchmarkFrameTimes, 99);
+        const AZ::s64 frameTimeMaxUs = static_cast<AZ::s64>(m_benchmarkFrameTimes.back());
+        const double sentBytesPerClientPerSecond = static_cast<double>(sentBytes) / static_cast<double>(clientCount) / durationSeconds;
+
+        AZLOG_INFO("Server benchmark: %llu clients, %llu entities, %zu ticks, tick time p50 %lld us, p95 %lld us, p99 %lld us, max %lld us, "
+            "%.0f bytes sent per client per second, %zu peak system allocated bytes.",
+            static_cast<unsigned long long>(clientCount), static_cast<unsigned long long>(entityCount), m_benchmarkFrameTimes.size(),
+            static_cast<long long>(frameTimeP50Us), static_cast<long long>(frameTimeP95Us), static_cast<long long>(frameTimeP99Us),
+            static_cast<long long>(frameTimeMaxUs), sentBytesPerClientPerSecond, m_benchmarkPeakAllocatedBytes);
+
+        if (const auto* eventLoggerFactory = AZ::Interface<AZ::Metrics::IEventLoggerFactory>::Get())
+        {
+            if (auto* eventLogger = eventLoggerFactory->FindEventLogger(NetworkingMetricsId))
+            {
+                AZ::Metrics::EventField argsContainer[] = {
+                    { "DurationMs", static_cast<AZ::s64>(benchmarkDuration) },
+                    { "ClientConnections", clientCount },
+                    { "NumEntities", entityCount },
+                    { "Ticks", static_cast<AZ::u64>(m_benchmarkFrameTimes.size()) },
+                    { "FrameTimeP50Us", frameTimeP50Us },
+                    { "FrameTimeP95Us", frameTimeP95Us },
+                    { "FrameTimeP99Us", frameTimeP99Us },
+                    { "FrameTimeMaxUs", frameTimeMaxUs },
+                    { "SentBytesPerClientPerSecond", sentBytesPerClientPerSecond },
+                    { "PeakSystemAllocatedBytes", static_cast<AZ::u64>(m_benchmarkPeakAllocatedBytes) },
+                };
+
+                AZ::Metrics::CounterArgs counterArgs;
+                counterArgs.m_name = "BenchmarkSummary";
+                counterArgs.m_cat = "Networking";
+                counterArgs.m_args = argsContainer;
+
+                eventLogger->RecordCounterEvent(counterArgs);
+                eventLogger->Flush();
+            }
+        }
     }
 
     void MultiplayerSystemComponent::OnPhysicsPreSimulate([[maybe_unused]] float dt)
@@ -14,6 +14,7 @@
 #include <Editor/MultiplayerEditorConnection.h>
 #include <NetworkTime/NetworkTime.h>
 #include <NetworkEntity/NetworkEntityManager.h>
+#include <ReplicationWindows/InterestGrid.h>
 #include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
 
 #include <AzCore/Component/Component.h>
@@ -161,6 +162,7 @@ namespace Multiplayer
         //! Console commands.
         //! @{
         void DumpStats(const AZ::ConsoleCommandContainer& arguments);
+        void DumpReplicationCost(const AZ::ConsoleCommandContainer& arguments);
         //! @}
 
         //! AzFramework::RootSpawnableNotificationBus::Handler
@@ -187,6 +189,9 @@ namespace Multiplayer
         static void StartServerToClientReplication(uint64_t userId, NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection);
 
         AZ_CONSOLEFUNC(MultiplayerSystemComponent, DumpStats, AZ::ConsoleFunctorFlags::Null, "Dumps stats for the current multiplayer session");
+        AZ_CONSOLEFUNC(MultiplayerSystemComponent, DumpReplicationCost, AZ::ConsoleFunctorFlags::Null,
+            "Writes the bytes and the CPU time spent per network component, property and RPC in the current session to a CSV file. "
+            "Takes an optional file path, the CPU time is only measured while net_RecordReplicationCost is on");
         void HostConsoleCommand(const AZ::ConsoleCommandContainer& arguments);
         void ConnectConsoleCommand(const AZ::ConsoleCommandContainer& arguments);
 
@@ -199,6 +204,7 @@ namespace Multiplayer
         AZ::ThreadSafeDeque<AZStd::string> m_cvarCommands;
 
         NetworkEntityManager m_networkEntityManager;
+        AZStd::unique_ptr<InterestGrid> m_interestGrid; // Created on first use while sv_InterestGridEnabled is set
         NetworkTime m_networkTime;
         MultiplayerAgentType m_agentType = MultiplayerAgentType::Uninitialized;
         
@@ -258,6 +264,19 @@ namespace Multiplayer
             MetricsEvent();
         }, AZ::Name("MultiplayerSystemComponent Metrics") };
 
+        //! Multiplayer tick times recorded since the last MetricsEvent, reported as percentiles.
+        AZStd::vector<AZ::TimeUs> m_metricsFrameTimes;
+        uint64_t m_metricsLastSentBytes = 0;
+
+        //! Measures the dedicated server load over sv_benchmarkDuration and exits once it's complete.
+        void UpdateBenchmark(AZ::TimeUs frameTime);
+        void RecordBenchmarkSummary(AZ::TimeMs benchmarkDuration);
+        AZStd::vector<AZ::TimeUs> m_benchmarkFrameTimes;
+        AZ::TimeMs m_benchmarkStartTimeMs = AZ::Time::ZeroTimeMs;
+        uint64_t m_benchmarkStartSentBytes = 0;
+        size_t m_benchmarkPeakAllocatedBytes = 0;
+        bool m_benchmarkComplete = false;
+
         void UpdatedMetricsConnectionCount();
 
         void UpdateConnections();
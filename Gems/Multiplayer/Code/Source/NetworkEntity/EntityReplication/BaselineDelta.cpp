@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/BaselineDelta.h>
+
+namespace Multiplayer
+{
+    namespace
+    {
+        // A literal run is only broken up by zero runs long enough to pay for the two run lengths that follow
+        constexpr uint32_t MinZeroRunLength = 3;
+
+        uint8_t GetBaselineByte(const uint8_t* baseline, uint32_t baselineSize, uint32_t index)
+        {
+            return (index < baselineSize) ? baseline[index] : 0;
+        }
+
+        bool WriteVariableLengthInteger(uint32_t value, uint8_t* buffer, uint32_t capacity, uint32_t& size)
+        {
+            do
+            {
+                if (size >= capacity)
+                {
+                    return false;
+                }
+                const uint8_t byte = static_cast<uint8_t>(value & 0x7F);
+                value >>= 7;
+                buffer[size++] = (value != 0) ? (byte | 0x80) : byte;
+            } while (value != 0);
+            return true;
+        }
+
+        bool ReadVariableLengthInteger(const uint8_t* buffer, uint32_t size, uint32_t& offset, uint32_t& outValue)
+        {
+            outValue = 0;
+            for (uint32_t shift = 0; shift < 32; shift += 7)
+            {
+                if (offset >= size)
+                {
+                    return false;
+                }
+                const uint8_t byte = buffer[offset++];
+                outValue |= static_cast<uint32_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    }
+
+    bool EncodeBaselineDelta(const uint8_t* baseline, uint32_t baselineSize, const uint8_t* data, uint32_t dataSize, AzNetworking::PacketEncodingBuffer& outDelta)
+    {
+        // Only worth sending if it ends up smaller than the data itself
+        const uint32_t capacity = AZStd::min<uint32_t>(dataSize, static_cast<uint32_t>(outDelta.GetCapacity()));
+        uint8_t* buffer = outDelta.GetBuffer();
+        uint32_t size = 0;
+
+        if (!WriteVariableLengthInteger(dataSize, buffer, capacity, size))
+        {
+            return false;
+        }
+
+        uint32_t index = 0;
+        while (index < dataSize)
+        {
+            const uint32_t zeroRunStart = index;
+            while ((index < dataSize) && (data[index] == GetBaselineByte(baseline, baselineSize, index)))
+            {
+                ++index;
+            }
+            const uint32_t zeroRunLength = index - zeroRunStart;
+
+            // Extend the literal run until the next zero run that is long enough to be worth splitting on
+            const uint32_t literalRunStart = index;
+            uint32_t zeroCount = 0;
+            while ((index < dataSize) && (zeroCount < MinZeroRunLength))
+            {
+                zeroCount = (data[index] == GetBaselineByte(baseline, baselineSize, index)) ? zeroCount + 1 : 0;
+                ++index;
+            }
+            if (zeroCount > 0)
+            {
+                index -= zeroCount;
+            }
+            const uint32_t literalRunLength = index - literalRunStart;
+
+            if (!WriteVariableLengthInteger(zeroRunLength, buffer, capacity, size)
+             || !WriteVariableLengthInteger(literalRunLength, buffer, capacity, size)
+             || (size + literalRunLength > capacity))
+            {
+                return false;
+            }
+
+            for (uint32_t literalIndex = literalRunStart; literalIndex < index; ++literalIndex)
+            {
+                buffer[size++] = data[literalIndex] ^ GetBaselineByte(baseline, baselineSize, literalIndex);
+            }
+        }
+
+        if (size >= dataSize)
+        {
+            return false;
+        }
+        outDelta.Resize(size);
+        return true;
+    }
+
+    bool DecodeBaselineDelta(const uint8_t* baseline, uint32_t baselineSize, const uint8_t* delta, uint32_t deltaSize, AzNetworking::PacketEncodingBuffer& outData)
+    {
+        uint32_t offset = 0;
+        uint32_t dataSize = 0;
+        if (!ReadVariableLengthInteger(delta, deltaSize, offset, dataSize) || (dataSize > outData.GetCapacity()))
+        {
+            return false;
+        }
+
+        uint8_t* buffer = outData.GetBuffer();
+        uint32_t index = 0;
+        while (index < dataSize)
+        {
+            uint32_t zeroRunLength = 0;
+            uint32_t literalRunLength = 0;
+            if (!ReadVariableLengthInteger(delta, deltaSize, offset, zeroRunLength)
+             || !ReadVariableLengthInteger(delta, deltaSize, offset, literalRunLength)
+             || (zeroRunLength + literalRunLength == 0)
+             || (zeroRunLength > dataSize - index)
+             || (literalRunLength > dataSize - index - zeroRunLength)
+             || (literalRunLength > deltaSize - offset))
+            {
+                return false;
+            }
+
+            for (const uint32_t zeroRunEnd = index + zeroRunLength; index < zeroRunEnd; ++index)
+            {
+                buffer[index] = GetBaselineByte(baseline, baselineSize, index);
+            }
+            for (const uint32_t literalRunEnd = index + literalRunLength; index < literalRunEnd; ++index)
+            {
+                buffer[index] = delta[offset++] ^ GetBaselineByte(baseline, baselineSize, index);
+            }
+        }
+
+        outData.Resize(dataSize);
+        return offset == deltaSize;
+    }
+}
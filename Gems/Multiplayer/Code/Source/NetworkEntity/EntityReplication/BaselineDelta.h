@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+
+namespace Multiplayer
+{
+    //! The number of most recently sent updates per entity a publisher picks baselines from.
+    static constexpr uint32_t SentBaselineCount = 8;
+    //! The number of most recently received updates per entity a subscriber keeps as baselines.
+    //! A subscriber receives at most as many updates as are sent, so keeping more than SentBaselineCount guarantees that
+    //! every baseline a publisher picks is still available, with room to spare for updates that arrive out of order.
+    static constexpr uint32_t ReceivedBaselineCount = SentBaselineCount * 2;
+
+    //! Encodes entity update data against the data of an earlier update the remote endpoint has acknowledged.
+    //! The data is xor'd against the baseline and stored as alternating runs of zero and literal bytes, with the run lengths written
+    //! as variable length integers. Properties that didn't change, and the unchanged high bytes of values that changed only a little,
+    //! reduce to zero runs. Any data can be encoded against any baseline, so decoding only requires the exact baseline bytes.
+    //! @param baseline     the baseline data
+    //! @param baselineSize the size of the baseline data
+    //! @param data         the data to encode
+    //! @param dataSize     the size of the data to encode
+    //! @param outDelta     buffer to write the encoded delta to
+    //! @return boolean true if the delta was encoded and is smaller than the data, false if the data should be sent as is
+    bool EncodeBaselineDelta(const uint8_t* baseline, uint32_t baselineSize, const uint8_t* data, uint32_t dataSize, AzNetworking::PacketEncodingBuffer& outDelta);
+
+    //! Reconstructs data encoded by EncodeBaselineDelta.
+    //! @param baseline     the baseline data the delta was encoded against
+    //! @param baselineSize the size of the baseline data
+    //! @param delta        the encoded delta
+    //! @param deltaSize    the size of the encoded delta
+    //! @param outData      buffer to write the reconstructed data to
+    //! @return boolean true if the delta was well formed and decoded
+    bool DecodeBaselineDelta(const uint8_t* baseline, uint32_t baselineSize, const uint8_t* delta, uint32_t deltaSize, AzNetworking::PacketEncodingBuffer& outData);
+}
@@ -15,6 +15,7 @@
 #include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityRpcMessage.h>
 #include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+#include <Source/NetworkEntity/EntityReplication/BaselineDelta.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/PacketLayer/IPacketHeader.h>
@@ -35,6 +36,7 @@ namespace Multiplayer
 
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
     AZ_CVAR(AZ::TimeMs, sv_ReplicationWindowUpdateMs, AZ::TimeMs{ 300 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Rate for replication window updates.");
+    AZ_CVAR(AZ::TimeMs, sv_ReplicationBudgetBurstMs, AZ::TimeMs{ 100 }, nullptr, AZ::ConsoleFunctorFlags::Null, "The amount of time worth of unused entity update bandwidth a connection may save up and send in a burst.");
     
     EntityReplicationManager::EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode updateMode)
         : m_updateMode(updateMode)
@@ -181,10 +183,15 @@ namespace Multiplayer
 
         AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: GenerateEntityUpdateList");
 
+        const AZ::TimeMs elapsedMs = m_frameTimeMs - m_lastBudgetRefillTimeMs;
+        m_lastBudgetRefillTimeMs = m_frameTimeMs;
+        m_replicationBudget.Refill(m_replicationWindow->GetMaxEntityReplicatorSendRate(), elapsedMs, sv_ReplicationBudgetBurstMs);
+
         // Generate a list of all our entities that need updates
         EntityReplicatorList toSendList;
 
-        uint32_t proxySendCount = 0;
+        const ReplicationSet& replicationSet = m_replicationWindow->GetReplicationSet();
+        m_proxySendCandidates.clear();
         for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end();)
         {
             bool clearPendingSend = true;
@@ -222,10 +229,12 @@ namespace Multiplayer
                         {
                             toSendList.push_back(replicator);
                         }
-                        else if (proxySendCount < m_replicationWindow->GetMaxProxyEntityReplicatorSendCount())
+                        else
                         {
-                            toSendList.push_back(replicator);
-                            ++proxySendCount;
+                            // Entities that left the window still need to send their deletes
+                            auto setIter = replicationSet.find(replicator->GetEntityHandle());
+                            const float priority = (setIter != replicationSet.end()) ? setIter->second.m_priority : 1.0f;
+                            m_proxySendCandidates.push_back(ReplicationBudget::Candidate{ replicator, entityId, priority });
                         }
                     }
                 }
@@ -234,6 +243,7 @@ namespace Multiplayer
             if (clearPendingSend)
             {
                 m_remoteEntitiesPendingCreation.erase(*iter);
+                m_replicationBudget.ClearPriority(*iter);
                 iter = m_replicatorsPendingSend.erase(iter);
             }
             else
@@ -242,6 +252,13 @@ namespace Multiplayer
             }
         }
 
+        // Send the highest priority proxy updates that fit into our budget, the rest accumulate priority for the next frame
+        const uint32_t proxySendCount = m_replicationBudget.Schedule(m_proxySendCandidates, m_replicationWindow->GetMaxProxyEntityReplicatorSendCount());
+        for (uint32_t index = 0; index < proxySendCount; ++index)
+        {
+            toSendList.push_back(m_proxySendCandidates[index].m_replicator);
+        }
+
         return toSendList;
     }
 
@@ -268,6 +285,7 @@ namespace Multiplayer
             }
 
             pendingPacketSize += nextMessageSize;
+            m_replicationBudget.Consume(replicator->GetEntityHandle().GetNetEntityId(), nextMessageSize);
             entityUpdates.push_back(updateMessage);
             replicatorUpdatedList.push_back(replicator);
             replicatorList.pop_front();
@@ -377,6 +395,7 @@ namespace Multiplayer
         }
 
         m_entityReplicatorMap.clear();
+        m_replicationBudget = ReplicationBudget();
     }
 
     bool EntityReplicationManager::SetEntityRebasing(NetworkEntityHandle& entityHandle)
@@ -900,6 +919,28 @@ namespace Multiplayer
 
         // May still be nullptr
         EntityReplicator* entityReplicator = GetEntityReplicator(updateMessage.GetEntityId());
+
+        // Decode before validating, updates dropped for arriving out of order may still be used as baselines by the remote endpoint
+        const AzNetworking::PacketEncodingBuffer* updateData = updateMessage.GetData();
+        bool decoded = true;
+        if (updateMessage.GetHasBaseline())
+        {
+            const AZStd::vector<uint8_t>* baseline = (entityReplicator != nullptr)
+                ? entityReplicator->GetReceivedBaseline(updateMessage.GetBaselinePacketId())
+                : nullptr;
+            decoded = (baseline != nullptr) && DecodeBaselineDelta(
+                baseline->data(), static_cast<uint32_t>(baseline->size()),
+                updateData->GetBuffer(), static_cast<uint32_t>(updateData->GetSize()),
+                m_baselineDecodeBuffer);
+            updateData = &m_baselineDecodeBuffer;
+        }
+
+        const bool storeBaseline = decoded && !updateMessage.GetIsDelete() && (updateData->GetSize() != 0);
+        if (storeBaseline && (entityReplicator != nullptr))
+        {
+            entityReplicator->StoreReceivedBaseline(packetHeader.GetPacketId(), *updateData);
+        }
+
         UpdateValidationResult result = ValidateUpdate(updateMessage, packetHeader.GetPacketId(), entityReplicator);
         switch (result)
         {
@@ -913,7 +954,16 @@ namespace Multiplayer
             AZ_Assert(false, "Unhandled case");
         }
 
-        OutputSerializer outputSerializer(updateMessage.GetData()->GetBuffer(), static_cast<uint32_t>(updateMessage.GetData()->GetSize()));
+        if (!decoded)
+        {
+            // Without the baseline the update can't be applied, have the remote endpoint start over with a full update
+            AZLOG_WARN("Unable to decode NetworkEntityUpdateMessage for entity %llu against its baseline, resetting the replicator",
+                aznumeric_cast<AZ::u64>(updateMessage.GetEntityId()));
+            m_replicatorsPendingReset.emplace(updateMessage.GetEntityId());
+            return true;
+        }
+
+        OutputSerializer outputSerializer(updateData->GetBuffer(), static_cast<uint32_t>(updateData->GetSize()));
 
         PrefabEntityId prefabEntityId;
         if (updateMessage.GetHasValidPrefabId())
@@ -941,7 +991,7 @@ namespace Multiplayer
         bool handled = true;
 
         // This may implicitly create a replicator for us
-        if (updateMessage.GetData()->GetSize() != 0)
+        if (updateData->GetSize() != 0)
         {
             handled = HandlePropertyChangeMessage(
                           invokingConnection,
@@ -954,6 +1004,13 @@ namespace Multiplayer
                           updateMessage.GetIsDelete()) &&
                 handled;
             AZ_Assert(handled, "Failed to handle NetworkEntityUpdateMessage message");
+
+            // The replicator may have been created or recreated while handling the update
+            EntityReplicator* updatedReplicator = GetEntityReplicator(updateMessage.GetEntityId());
+            if (storeBaseline && (updatedReplicator != nullptr))
+            {
+                updatedReplicator->StoreReceivedBaseline(packetHeader.GetPacketId(), *updateData);
+            }
         }
         else
         {
@@ -1448,6 +1505,7 @@ namespace Multiplayer
                         static_cast<AZ::u64>(replicator->GetEntityHandle().GetNetEntityId()),
                         GetRemoteHostId().GetString().c_str());
                     m_remoteEntitiesPendingCreation.erase(replicator->GetEntityHandle().GetNetEntityId());
+                    m_replicationBudget.Remove(*iter);
                     m_entityReplicatorMap.erase(*iter);
                     iter = m_replicatorsPendingRemoval.erase(iter);
                 }
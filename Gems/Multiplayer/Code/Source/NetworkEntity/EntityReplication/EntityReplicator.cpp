@@ -597,6 +597,19 @@ namespace Multiplayer
         return m_propertySubscriber ? m_propertySubscriber->GetLastReceivedPacketId() : AzNetworking::InvalidPacketId;
     }
 
+    void EntityReplicator::StoreReceivedBaseline(AzNetworking::PacketId packetId, const AzNetworking::PacketEncodingBuffer& data)
+    {
+        if (m_propertySubscriber)
+        {
+            m_propertySubscriber->StoreBaseline(packetId, data);
+        }
+    }
+
+    const AZStd::vector<uint8_t>* EntityReplicator::GetReceivedBaseline(AzNetworking::PacketId packetId) const
+    {
+        return m_propertySubscriber ? m_propertySubscriber->GetBaseline(packetId) : nullptr;
+    }
+
     bool EntityReplicator::HandlePropertyChangeMessage(
         AzNetworking::PacketId packetId, AzNetworking::ISerializer* serializer, bool notifyChanges)
     {
@@ -611,8 +624,15 @@ namespace Multiplayer
         // Otherwise, let the property publisher determine if any data should be sent.
         if (m_propertyPublisher)
         {
+            MultiplayerStats& stats = GetMultiplayer()->GetStats();
+            const AZStd::sys_time_t startTicks = stats.m_recordReplicationCost ? AZStd::GetTimeNowTicks() : 0;
             m_propertyPublisher->UpdatePendingRecord(m_netBindComponent);
-            return m_propertyPublisher->PrepareSerialization(m_netBindComponent);
+            const bool hasChanges = m_propertyPublisher->PrepareSerialization(m_netBindComponent);
+            if (startTicks != 0)
+            {
+                stats.RecordChangeDetectionTime(AZStd::GetTimeNowTicks() - startTicks);
+            }
+            return hasChanges;
         }
 
         return false;
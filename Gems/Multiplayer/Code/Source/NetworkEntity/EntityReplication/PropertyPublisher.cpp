@@ -7,6 +7,7 @@
  */
 
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
+#include <Source/NetworkEntity/EntityReplication/BaselineDelta.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
@@ -15,12 +16,15 @@
 namespace Multiplayer
 {
     AZ_CVAR(uint32_t, net_EntityReplicatorRecordsMax, 45, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of allowed outstanding entity records");
+    AZ_CVAR(bool, net_EntityBaselineDeltas, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, entity updates are encoded against the last update the remote endpoint acknowledged when that makes them smaller");
 
     PropertyPublisher::PropertyPublisher(NetEntityRole remoteNetworkRole, OwnsLifetime ownsLifetime, AzNetworking::IConnection& connection)
         : m_ownsLifetime(ownsLifetime)
         , m_connection(connection)
         , m_pendingRecord(remoteNetworkRole)
         , m_sentRecords(net_EntityReplicatorRecordsMax)
+        , m_sentBaselines(SentBaselineCount)
     {
         if ( ownsLifetime == OwnsLifetime::False )
         {
@@ -372,14 +376,62 @@ namespace Multiplayer
             updateMessage.SetPrefabEntityId(netBindComponent->GetPrefabEntityId());
         }
 
-        InputSerializer inputSerializer(
-            updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()));
-        SerializeEntityRecord(inputSerializer, netBindComponent);
-        updateMessage.ModifyData().Resize(inputSerializer.GetSize());
+        // Other connections that need the same set of changes from this entity this frame share a single serialization
+        AzNetworking::PacketEncodingBuffer& updateData = updateMessage.ModifyData();
+        if (!netBindComponent->GetCachedStateDelta(m_pendingRecord, updateData))
+        {
+            InputSerializer inputSerializer(updateData.GetBuffer(), static_cast<uint32_t>(updateData.GetCapacity()));
+            const bool serialized = SerializeEntityRecord(inputSerializer, netBindComponent);
+            updateData.Resize(inputSerializer.GetSize());
+            if (serialized)
+            {
+                netBindComponent->CacheStateDelta(m_pendingRecord, updateData);
+            }
+        }
+
+        // Deletes are cached and sent until acknowledged, so they are always sent as is
+        m_hasPendingBaseline = !isDeleted;
+        if (m_hasPendingBaseline)
+        {
+            m_pendingBaselineData.assign(updateData.GetBuffer(), updateData.GetBuffer() + updateData.GetSize());
+            if (net_EntityBaselineDeltas)
+            {
+                EncodeAgainstBaseline(updateMessage);
+            }
+        }
 
         return updateMessage;
     }
 
+    void PropertyPublisher::EncodeAgainstBaseline(NetworkEntityUpdateMessage& updateMessage)
+    {
+        // Only acknowledged updates are guaranteed to be available to the remote endpoint
+        const SentBaseline* baseline = nullptr;
+        for (const SentBaseline& sentBaseline : m_sentBaselines)
+        {
+            if (m_connection.WasPacketAcked(sentBaseline.m_packetId))
+            {
+                baseline = &sentBaseline;
+                break;
+            }
+        }
+
+        if (baseline == nullptr)
+        {
+            return;
+        }
+
+        AzNetworking::PacketEncodingBuffer& updateData = updateMessage.ModifyData();
+        if (EncodeBaselineDelta(
+            baseline->m_data.data(), static_cast<uint32_t>(baseline->m_data.size()),
+            updateData.GetBuffer(), static_cast<uint32_t>(updateData.GetSize()),
+            m_baselineDeltaBuffer))
+        {
+            updateData.CopyValues(m_baselineDeltaBuffer.GetBuffer(), m_baselineDeltaBuffer.GetSize());
+            updateMessage.SetBaselinePacketId(baseline->m_packetId);
+        }
+    }
+
     EntityMigrationMessage PropertyPublisher::GenerateMigrationPacket(NetBindComponent* netBindComponent)
     {
         AZ_Assert(netBindComponent, "Trying to migrate when NetBindComponent is null.");
@@ -431,6 +483,14 @@ namespace Multiplayer
             AZ_Assert(false, "EntityReplicator: Unexpected state");
             break;
         }
+        if (m_hasPendingBaseline && (sentId != AzNetworking::InvalidPacketId))
+        {
+            // Replaces the oldest baseline once full
+            m_sentBaselines.push_front(SentBaseline{ sentId, AZStd::move(m_pendingBaselineData) });
+            m_pendingBaselineData.clear();
+        }
+        m_hasPendingBaseline = false;
+
         // Reset our state for the next frame
         m_serializationPhase = PropertyPublisher::EntityReplicatorSerializationPhase::Ready;
     }
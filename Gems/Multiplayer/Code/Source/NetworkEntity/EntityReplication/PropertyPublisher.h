@@ -10,6 +10,7 @@
 
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <AzCore/std/containers/ring_buffer.h>
+#include <AzCore/std/containers/vector.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
 
 namespace AzNetworking
@@ -121,6 +122,9 @@ namespace Multiplayer
         void FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId);
         void FinalizeDeleteEntityRecord(AzNetworking::PacketId packetId);
 
+        //! Encodes the update data against the most recent acknowledged update, if that makes it smaller.
+        void EncodeAgainstBaseline(NetworkEntityUpdateMessage& updateMessage);
+
         //! The current state of entity replication - add / rebase / update / delete
         EntityReplicatorState m_replicatorState = EntityReplicatorState::Creating;
         //! Tracks whether the record needs to be prepared, serialized, or finalized.
@@ -145,5 +149,17 @@ namespace Multiplayer
         // and then keep it around until it's requested. By the time the message is requested, the entity
         // is likely already deleted, so the data to serialize from it would no longer be available.
         NetworkEntityUpdateMessage m_cachedDeleteMessage;
+
+        // The data of the most recently sent updates, most recent first, used as baselines once they've been acknowledged
+        struct SentBaseline
+        {
+            AzNetworking::PacketId m_packetId = AzNetworking::InvalidPacketId;
+            AZStd::vector<uint8_t> m_data;
+        };
+        AZStd::ring_buffer<SentBaseline> m_sentBaselines;
+        // The data of the last generated update, which becomes a baseline once it's sent
+        AZStd::vector<uint8_t> m_pendingBaselineData;
+        bool m_hasPendingBaseline = false;
+        AzNetworking::PacketEncodingBuffer m_baselineDeltaBuffer;
     };
 }
@@ -7,6 +7,7 @@
  */
 
 #include <Source/NetworkEntity/EntityReplication/PropertySubscriber.h>
+#include <Source/NetworkEntity/EntityReplication/BaselineDelta.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicationManager.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 
@@ -15,6 +16,7 @@ namespace Multiplayer
     PropertySubscriber::PropertySubscriber(EntityReplicationManager& replicationManager, NetBindComponent* netBindComponent)
         : m_replicationManager(replicationManager)
         , m_netBindComponent(netBindComponent)
+        , m_receivedBaselines(ReceivedBaselineCount)
     {
         ;
     }
@@ -50,4 +52,27 @@ namespace Multiplayer
         m_lastReceivedPacketId = packetId;
         return m_netBindComponent->HandlePropertyChangeMessage(*serializer, notifyChanges);
     }
+
+    void PropertySubscriber::StoreBaseline(AzNetworking::PacketId packetId, const AzNetworking::PacketEncodingBuffer& data)
+    {
+        if (GetBaseline(packetId) != nullptr)
+        {
+            return;
+        }
+
+        // Replaces the oldest baseline once full
+        m_receivedBaselines.push_front(ReceivedBaseline{ packetId, AZStd::vector<uint8_t>(data.GetBuffer(), data.GetBuffer() + data.GetSize()) });
+    }
+
+    const AZStd::vector<uint8_t>* PropertySubscriber::GetBaseline(AzNetworking::PacketId packetId) const
+    {
+        for (const ReceivedBaseline& baseline : m_receivedBaselines)
+        {
+            if (baseline.m_packetId == packetId)
+            {
+                return &baseline.m_data;
+            }
+        }
+        return nullptr;
+    }
 }
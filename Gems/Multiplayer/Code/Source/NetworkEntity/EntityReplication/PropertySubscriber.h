@@ -8,7 +8,10 @@
 
 #pragma once
 
+#include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/std/containers/ring_buffer.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AzNetworking
 {
@@ -36,12 +39,31 @@ namespace Multiplayer
 
         bool HandlePropertyChangeMessage(AzNetworking::PacketId packetId, AzNetworking::ISerializer* serializer, bool notifyChanges = true);
 
+        //! Keeps the data of a received update so that later updates can be encoded against it.
+        //! @param packetId the id of the packet the update was received in
+        //! @param data     the decoded update data
+        void StoreBaseline(AzNetworking::PacketId packetId, const AzNetworking::PacketEncodingBuffer& data);
+
+        //! Returns the data of an update received in the provided packet, or nullptr if it is no longer available.
+        //! @param packetId the id of the packet the update was received in
+        //! @return the update data, or nullptr
+        const AZStd::vector<uint8_t>* GetBaseline(AzNetworking::PacketId packetId) const;
+
     private:
+        struct ReceivedBaseline
+        {
+            AzNetworking::PacketId m_packetId = AzNetworking::InvalidPacketId;
+            AZStd::vector<uint8_t> m_data;
+        };
+
         EntityReplicationManager& m_replicationManager;
         NetBindComponent* m_netBindComponent;
 
         // The last packet to have been received about this entity
         AzNetworking::PacketId m_lastReceivedPacketId = AzNetworking::InvalidPacketId;
         AZ::TimeMs m_markForRemovalTimeMs = AZ::Time::ZeroTimeMs;
+
+        // The most recently received updates, most recent first
+        AZStd::ring_buffer<ReceivedBaseline> m_receivedBaselines;
     };
 }
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/ReplicationBudget.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    void ReplicationBudget::Refill(uint32_t bytesPerSecond, AZ::TimeMs elapsedMs, AZ::TimeMs burstMs)
+    {
+        m_bytesPerSecond = bytesPerSecond;
+        if (m_bytesPerSecond == 0)
+        {
+            m_availableBytes = 0.0f;
+            m_capacityBytes = 0.0f;
+            return;
+        }
+
+        const float bytesPerMs = static_cast<float>(m_bytesPerSecond) / 1000.0f;
+        m_capacityBytes = bytesPerMs * static_cast<float>(AZStd::max(burstMs, AZ::TimeMs{ 1 }));
+        const float refillBytes = bytesPerMs * static_cast<float>(AZStd::max(elapsedMs, AZ::Time::ZeroTimeMs));
+        m_availableBytes = AZStd::min(m_availableBytes + refillBytes, m_capacityBytes);
+    }
+
+    bool ReplicationBudget::IsLimited() const
+    {
+        return m_bytesPerSecond > 0;
+    }
+
+    float ReplicationBudget::GetAvailableBytes() const
+    {
+        return m_availableBytes;
+    }
+
+    uint32_t ReplicationBudget::Schedule(CandidateList& candidates, uint32_t maxCount)
+    {
+        for (Candidate& candidate : candidates)
+        {
+            candidate.m_accumulatedPriority = m_entityEntries[candidate.m_netEntityId].m_accumulatedPriority + candidate.m_priority;
+        }
+
+        AZStd::sort(candidates.begin(), candidates.end(),
+            [](const Candidate& lhs, const Candidate& rhs)
+            {
+                return lhs.m_accumulatedPriority > rhs.m_accumulatedPriority;
+            });
+
+        // Greedily fill the budget, candidates that don't fit are skipped in favour of smaller lower priority candidates
+        // A full budget always admits the first candidate, so updates larger than the budget capacity can't starve
+        float remainingBytes = m_availableBytes;
+        const bool isBudgetFull = (m_availableBytes >= m_capacityBytes);
+        uint32_t selectedCount = 0;
+        for (Candidate& candidate : candidates)
+        {
+            EntityEntry& entry = m_entityEntries[candidate.m_netEntityId];
+            bool isSelected = (selectedCount < maxCount);
+            if (isSelected && IsLimited())
+            {
+                const float estimatedSize = static_cast<float>(entry.m_estimatedUpdateSize);
+                isSelected = (estimatedSize <= remainingBytes) || (selectedCount == 0 && isBudgetFull);
+                if (isSelected)
+                {
+                    remainingBytes -= estimatedSize;
+                }
+            }
+
+            if (isSelected)
+            {
+                entry.m_accumulatedPriority = 0.0f;
+                // Keep the selected candidates in priority order at the front of the list
+                AZStd::swap(candidates[selectedCount], candidate);
+                ++selectedCount;
+            }
+            else
+            {
+                entry.m_accumulatedPriority = candidate.m_accumulatedPriority;
+            }
+        }
+
+        return selectedCount;
+    }
+
+    void ReplicationBudget::Consume(NetEntityId netEntityId, uint32_t byteCount)
+    {
+        if (IsLimited())
+        {
+            // Allow the budget to go into debt by at most its capacity, so a single large update can't stall sending for long
+            m_availableBytes = AZStd::max(m_availableBytes - static_cast<float>(byteCount), -m_capacityBytes);
+        }
+
+        auto iter = m_entityEntries.find(netEntityId);
+        if (iter != m_entityEntries.end())
+        {
+            // Smooth the estimate so a single large update (an entity creation for example) doesn't dominate it
+            EntityEntry& entry = iter->second;
+            entry.m_estimatedUpdateSize = (entry.m_estimatedUpdateSize * 3 + byteCount + 3) / 4;
+        }
+    }
+
+    void ReplicationBudget::ClearPriority(NetEntityId netEntityId)
+    {
+        auto iter = m_entityEntries.find(netEntityId);
+        if (iter != m_entityEntries.end())
+        {
+            iter->second.m_accumulatedPriority = 0.0f;
+        }
+    }
+
+    void ReplicationBudget::Remove(NetEntityId netEntityId)
+    {
+        m_entityEntries.erase(netEntityId);
+    }
+}
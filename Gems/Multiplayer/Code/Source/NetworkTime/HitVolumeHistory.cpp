@@ -0,0 +1,611 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkTime/HitVolumeHistory.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    namespace
+    {
+        using Simd = AZ::Simd::Vec4;
+        constexpr uint32_t SimdWidth = static_cast<uint32_t>(Simd::ElementCount);
+        constexpr float ParallelEpsilon = 1e-8f;
+
+        // Appends the slots of all lanes set in mask, starting at baseSlot
+        void AppendMaskedSlots(Simd::FloatArgType mask, uint32_t baseSlot, AZStd::vector<uint32_t>& outSlots)
+        {
+            alignas(16) int32_t lanes[SimdWidth];
+            Simd::StoreAligned(lanes, Simd::CastToInt(mask));
+            for (uint32_t lane = 0; lane < SimdWidth; ++lane)
+            {
+                if (lanes[lane] != 0)
+                {
+                    outSlots.push_back(baseSlot + lane);
+                }
+            }
+        }
+
+        // Blends the stream values of the previous frame towards the values of the current frame
+        Simd::FloatType LoadBlended(const float* previous, const float* current, Simd::FloatArgType blendFactor)
+        {
+            const Simd::FloatType previousValue = Simd::LoadUnaligned(previous);
+            const Simd::FloatType currentValue = Simd::LoadUnaligned(current);
+            return Simd::Madd(Simd::Sub(currentValue, previousValue), blendFactor, previousValue);
+        }
+
+        // The shape tests below work in the local space of the hit volume, the ray direction must be normalized
+        bool RaySphere(const AZ::Vector3& origin, const AZ::Vector3& direction, const AZ::Vector3& center, float radius, float& outDistance)
+        {
+            const AZ::Vector3 offset = origin - center;
+            const float b = offset.Dot(direction);
+            const float c = offset.Dot(offset) - radius * radius;
+            if (c <= 0.0f)
+            {
+                // Ray starts inside the sphere
+                outDistance = 0.0f;
+                return true;
+            }
+
+            const float discriminant = b * b - c;
+            if (b > 0.0f || discriminant < 0.0f)
+            {
+                return false;
+            }
+
+            outDistance = -b - AZStd::sqrt(discriminant);
+            return true;
+        }
+
+        bool RayCapsule(const AZ::Vector3& origin, const AZ::Vector3& direction, float radius, float halfHeight, float& outDistance)
+        {
+            const float a = direction.GetX() * direction.GetX() + direction.GetY() * direction.GetY();
+            const float b = origin.GetX() * direction.GetX() + origin.GetY() * direction.GetY();
+            const float c = origin.GetX() * origin.GetX() + origin.GetY() * origin.GetY() - radius * radius;
+            if (c <= 0.0f && AZStd::abs(origin.GetZ()) <= halfHeight)
+            {
+                // Ray starts inside the cylinder part of the capsule
+                outDistance = 0.0f;
+                return true;
+            }
+
+            bool isHit = false;
+            outDistance = AZStd::numeric_limits<float>::max();
+            if (a > ParallelEpsilon)
+            {
+                const float discriminant = b * b - a * c;
+                if (discriminant >= 0.0f)
+                {
+                    const float distance = (-b - AZStd::sqrt(discriminant)) / a;
+                    if (distance >= 0.0f && AZStd::abs(origin.GetZ() + distance * direction.GetZ()) <= halfHeight)
+                    {
+                        outDistance = distance;
+                        isHit = true;
+                    }
+                }
+            }
+
+            const float capHeights[] = { -halfHeight, halfHeight };
+            for (float capHeight : capHeights)
+            {
+                float distance = 0.0f;
+                if (RaySphere(origin, direction, AZ::Vector3(0.0f, 0.0f, capHeight), radius, distance) && distance < outDistance)
+                {
+                    outDistance = distance;
+                    isHit = true;
+                }
+            }
+            return isHit;
+        }
+
+        bool RayBox(const AZ::Vector3& origin, const AZ::Vector3& direction, const AZ::Vector3& halfExtents, float& outDistance)
+        {
+            float nearDistance = 0.0f;
+            float farDistance = AZStd::numeric_limits<float>::max();
+            for (int32_t axis = 0; axis < 3; ++axis)
+            {
+                const float axisOrigin = origin.GetElement(axis);
+                const float axisDirection = direction.GetElement(axis);
+                const float axisExtent = halfExtents.GetElement(axis);
+                if (AZStd::abs(axisDirection) < ParallelEpsilon)
+                {
+                    if (AZStd::abs(axisOrigin) > axisExtent)
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+
+                const float inverseDirection = 1.0f / axisDirection;
+                float slabNear = (-axisExtent - axisOrigin) * inverseDirection;
+                float slabFar = (axisExtent - axisOrigin) * inverseDirection;
+                if (slabNear > slabFar)
+                {
+                    AZStd::swap(slabNear, slabFar);
+                }
+                nearDistance = AZStd::max(nearDistance, slabNear);
+                farDistance = AZStd::min(farDistance, slabFar);
+                if (nearDistance > farDistance)
+                {
+                    return false;
+                }
+            }
+
+            outDistance = nearDistance;
+            return true;
+        }
+
+        float GetBoundingRadius(const HitVolumeShape& shape)
+        {
+            switch (shape.m_type)
+            {
+            case HitVolumeShapeType::Sphere:
+                return shape.m_radius;
+            case HitVolumeShapeType::Capsule:
+                return AZStd::max(shape.m_radius, shape.m_height * 0.5f);
+            case HitVolumeShapeType::Box:
+                return shape.m_halfExtents.GetLength();
+            }
+            return 0.0f;
+        }
+
+        float GetCapsuleHalfHeight(const HitVolumeShape& shape)
+        {
+            // The height includes the caps, the segment between the cap centers is shorter by the radius on each side
+            return AZStd::max(shape.m_height * 0.5f - shape.m_radius, 0.0f);
+        }
+    }
+
+    HitVolumeHistory::HitVolumeHistory()
+    {
+        for (HostFrameId& frameId : m_frameIds)
+        {
+            frameId = InvalidHostFrameId;
+        }
+    }
+
+    void HitVolumeHistory::BeginFrame(HostFrameId frameId)
+    {
+        if (frameId == m_currentFrameId && m_frameIds[m_currentFrameIndex] == frameId)
+        {
+            return;
+        }
+
+        const uint32_t previousFrameIndex = m_currentFrameIndex;
+        const bool isContinuous = (m_frameIds[previousFrameIndex] != InvalidHostFrameId)
+            && (static_cast<uint32_t>(frameId) == static_cast<uint32_t>(m_currentFrameId) + 1);
+
+        m_currentFrameId = frameId;
+        m_currentFrameIndex = GetFrameIndex(frameId);
+        if (!isContinuous)
+        {
+            // Time jumped, none of the recorded frames are reachable through frame ids anymore
+            for (HostFrameId& recordedFrameId : m_frameIds)
+            {
+                recordedFrameId = InvalidHostFrameId;
+            }
+        }
+        m_frameIds[m_currentFrameIndex] = frameId;
+
+        if (m_capacity > 0 && previousFrameIndex != m_currentFrameIndex)
+        {
+            // Carry every hit volume over from the previous frame, the streams of a frame are contiguous so this is a single copy
+            const uint32_t frameSize = m_capacity * StreamCount;
+            AZStd::copy(
+                m_frames.begin() + previousFrameIndex * frameSize,
+                m_frames.begin() + (previousFrameIndex + 1) * frameSize,
+                m_frames.begin() + m_currentFrameIndex * frameSize);
+        }
+    }
+
+    HitVolumeHandle HitVolumeHistory::AddHitVolume(NetEntityId netEntityId, uint32_t hitVolumeIndex, const HitVolumeShape& shape)
+    {
+        // Slots are only reused once the frames of their previous hit volume have left the history
+        HitVolumeHandle handle = InvalidHitVolumeHandle;
+        for (auto iter = m_freeSlots.begin(); iter != m_freeSlots.end(); ++iter)
+        {
+            const HostFrameId releasedFrameId = m_hitVolumes[*iter].m_releasedFrameId;
+            if (static_cast<uint32_t>(m_currentFrameId - releasedFrameId) >= RewindHistorySize)
+            {
+                handle = *iter;
+                m_freeSlots.erase(iter);
+                break;
+            }
+        }
+
+        if (handle == InvalidHitVolumeHandle)
+        {
+            handle = static_cast<HitVolumeHandle>(m_hitVolumes.size());
+            m_hitVolumes.emplace_back();
+            if (m_hitVolumes.size() > m_capacity)
+            {
+                Grow();
+            }
+        }
+
+        HitVolume& hitVolume = m_hitVolumes[handle];
+        hitVolume.m_netEntityId = netEntityId;
+        hitVolume.m_hitVolumeIndex = hitVolumeIndex;
+        hitVolume.m_shape = shape;
+        hitVolume.m_boundingRadius = GetBoundingRadius(shape);
+        hitVolume.m_releasedFrameId = InvalidHostFrameId;
+        hitVolume.m_isActive = true;
+        ++m_hitVolumeCount;
+
+        // Not hittable until the owner provides a transform
+        GetStream(m_currentFrameIndex, BoundingRadius)[handle] = -1.0f;
+        return handle;
+    }
+
+    void HitVolumeHistory::RemoveHitVolume(HitVolumeHandle handle)
+    {
+        if (handle >= m_hitVolumes.size() || !m_hitVolumes[handle].m_isActive)
+        {
+            return;
+        }
+
+        HitVolume& hitVolume = m_hitVolumes[handle];
+        hitVolume.m_isActive = false;
+        hitVolume.m_releasedFrameId = m_currentFrameId;
+        GetStream(m_currentFrameIndex, BoundingRadius)[handle] = -1.0f;
+        m_freeSlots.push_back(handle);
+        --m_hitVolumeCount;
+    }
+
+    void HitVolumeHistory::SetTransform(HitVolumeHandle handle, const AZ::Transform& worldTransform)
+    {
+        AZ_Assert(handle < m_hitVolumes.size() && m_hitVolumes[handle].m_isActive, "Invalid hit volume handle");
+
+        const AZ::Vector3& position = worldTransform.GetTranslation();
+        const AZ::Quaternion& rotation = worldTransform.GetRotation();
+        const float scale = worldTransform.GetUniformScale();
+        GetStream(m_currentFrameIndex, PositionX)[handle] = position.GetX();
+        GetStream(m_currentFrameIndex, PositionY)[handle] = position.GetY();
+        GetStream(m_currentFrameIndex, PositionZ)[handle] = position.GetZ();
+        GetStream(m_currentFrameIndex, RotationX)[handle] = rotation.GetX();
+        GetStream(m_currentFrameIndex, RotationY)[handle] = rotation.GetY();
+        GetStream(m_currentFrameIndex, RotationZ)[handle] = rotation.GetZ();
+        GetStream(m_currentFrameIndex, RotationW)[handle] = rotation.GetW();
+        GetStream(m_currentFrameIndex, Scale)[handle] = scale;
+        GetStream(m_currentFrameIndex, BoundingRadius)[handle] = m_hitVolumes[handle].m_boundingRadius * scale;
+    }
+
+    bool HitVolumeHistory::IsFrameRecorded(HostFrameId frameId) const
+    {
+        return (frameId != InvalidHostFrameId) && (m_frameIds[GetFrameIndex(frameId)] == frameId);
+    }
+
+    bool HitVolumeHistory::Raycast
+    (
+        HostFrameId frameId,
+        float blendFactor,
+        const AZ::Vector3& start,
+        const AZ::Vector3& direction,
+        float maxDistance,
+        HitVolumeQueryResults& outResults
+    ) const
+    {
+        outResults.clear();
+
+        uint32_t frameIndex = 0;
+        uint32_t previousFrameIndex = 0;
+        if (!GetQueryFrames(frameId, blendFactor, frameIndex, previousFrameIndex, blendFactor))
+        {
+            return false;
+        }
+
+        CandidateList candidates;
+        GatherRaycastCandidates(frameIndex, previousFrameIndex, blendFactor, start, direction, maxDistance, candidates);
+
+        for (uint32_t slot : candidates)
+        {
+            const RewoundHitVolume rewound = GetRewoundHitVolume(slot, frameIndex, previousFrameIndex, blendFactor);
+            const HitVolumeShape& shape = rewound.m_hitVolume->m_shape;
+            const float scale = rewound.m_transform.GetUniformScale();
+            const AZ::Quaternion inverseRotation = rewound.m_transform.GetRotation().GetConjugate();
+            const AZ::Vector3 localStart = inverseRotation.TransformVector(start - rewound.m_transform.GetTranslation()) / scale;
+            const AZ::Vector3 localDirection = inverseRotation.TransformVector(direction);
+
+            bool isHit = false;
+            float localDistance = 0.0f;
+            switch (shape.m_type)
+            {
+            case HitVolumeShapeType::Sphere:
+                isHit = RaySphere(localStart, localDirection, AZ::Vector3::CreateZero(), shape.m_radius, localDistance);
+                break;
+            case HitVolumeShapeType::Capsule:
+                isHit = RayCapsule(localStart, localDirection, shape.m_radius, GetCapsuleHalfHeight(shape), localDistance);
+                break;
+            case HitVolumeShapeType::Box:
+                isHit = RayBox(localStart, localDirection, shape.m_halfExtents, localDistance);
+                break;
+            }
+
+            const float distance = localDistance * scale;
+            if (isHit && distance <= maxDistance)
+            {
+                outResults.push_back(HitVolumeQueryResult{ rewound.m_hitVolume->m_netEntityId, rewound.m_hitVolume->m_hitVolumeIndex, distance });
+            }
+        }
+
+        AZStd::sort(outResults.begin(), outResults.end(),
+            [](const HitVolumeQueryResult& lhs, const HitVolumeQueryResult& rhs)
+            {
+                return lhs.m_distance < rhs.m_distance;
+            });
+        return true;
+    }
+
+    bool HitVolumeHistory::OverlapSphere
+    (
+        HostFrameId frameId,
+        float blendFactor,
+        const AZ::Vector3& center,
+        float radius,
+        HitVolumeQueryResults& outResults
+    ) const
+    {
+        outResults.clear();
+
+        uint32_t frameIndex = 0;
+        uint32_t previousFrameIndex = 0;
+        if (!GetQueryFrames(frameId, blendFactor, frameIndex, previousFrameIndex, blendFactor))
+        {
+            return false;
+        }
+
+        CandidateList candidates;
+        GatherOverlapCandidates(frameIndex, previousFrameIndex, blendFactor, center, radius, candidates);
+
+        for (uint32_t slot : candidates)
+        {
+            const RewoundHitVolume rewound = GetRewoundHitVolume(slot, frameIndex, previousFrameIndex, blendFactor);
+            const HitVolumeShape& shape = rewound.m_hitVolume->m_shape;
+            const float scale = rewound.m_transform.GetUniformScale();
+            const AZ::Quaternion inverseRotation = rewound.m_transform.GetRotation().GetConjugate();
+            const AZ::Vector3 localCenter = inverseRotation.TransformVector(center - rewound.m_transform.GetTranslation()) / scale;
+            const float localRadius = radius / scale;
+
+            AZ::Vector3 closestPoint = AZ::Vector3::CreateZero();
+            float shapeRadius = 0.0f;
+            switch (shape.m_type)
+            {
+            case HitVolumeShapeType::Sphere:
+                shapeRadius = shape.m_radius;
+                break;
+            case HitVolumeShapeType::Capsule:
+            {
+                const float halfHeight = GetCapsuleHalfHeight(shape);
+                closestPoint.SetZ(AZStd::clamp(localCenter.GetZ(), -halfHeight, halfHeight));
+                shapeRadius = shape.m_radius;
+                break;
+            }
+            case HitVolumeShapeType::Box:
+                closestPoint = localCenter.GetClamp(-shape.m_halfExtents, shape.m_halfExtents);
+                break;
+            }
+
+            const float overlapRadius = localRadius + shapeRadius;
+            if (localCenter.GetDistanceSq(closestPoint) <= overlapRadius * overlapRadius)
+            {
+                outResults.push_back(HitVolumeQueryResult{ rewound.m_hitVolume->m_netEntityId, rewound.m_hitVolume->m_hitVolumeIndex, 0.0f });
+            }
+        }
+        return true;
+    }
+
+    uint32_t HitVolumeHistory::GetHitVolumeCount() const
+    {
+        return m_hitVolumeCount;
+    }
+
+    float* HitVolumeHistory::GetStream(uint32_t frameIndex, Stream stream)
+    {
+        return m_frames.data() + (frameIndex * StreamCount + stream) * m_capacity;
+    }
+
+    const float* HitVolumeHistory::GetStream(uint32_t frameIndex, Stream stream) const
+    {
+        return m_frames.data() + (frameIndex * StreamCount + stream) * m_capacity;
+    }
+
+    uint32_t HitVolumeHistory::GetFrameIndex(HostFrameId frameId) const
+    {
+        return static_cast<uint32_t>(frameId) % RewindHistorySize;
+    }
+
+    void HitVolumeHistory::Grow()
+    {
+        // Keep the capacity a multiple of the simd width so the queries never need a scalar tail
+        const uint32_t newCapacity = AZStd::max(m_capacity * 2, SimdWidth * 16);
+        AZStd::vector<float> newFrames(static_cast<size_t>(newCapacity) * StreamCount * RewindHistorySize, 0.0f);
+        for (uint32_t frameIndex = 0; frameIndex < RewindHistorySize; ++frameIndex)
+        {
+            for (uint32_t stream = 0; stream < StreamCount; ++stream)
+            {
+                float* newStream = newFrames.data() + (frameIndex * StreamCount + stream) * newCapacity;
+                if (m_capacity > 0)
+                {
+                    const float* oldStream = GetStream(frameIndex, static_cast<Stream>(stream));
+                    AZStd::copy(oldStream, oldStream + m_capacity, newStream);
+                }
+
+                if (stream == BoundingRadius)
+                {
+                    AZStd::fill(newStream + m_capacity, newStream + newCapacity, -1.0f);
+                }
+                else if (stream == RotationW || stream == Scale)
+                {
+                    // Keep unused slots a valid identity transform
+                    AZStd::fill(newStream + m_capacity, newStream + newCapacity, 1.0f);
+                }
+            }
+        }
+        m_frames.swap(newFrames);
+        m_capacity = newCapacity;
+    }
+
+    bool HitVolumeHistory::GetQueryFrames
+    (
+        HostFrameId frameId,
+        float blendFactor,
+        uint32_t& outFrameIndex,
+        uint32_t& outPreviousFrameIndex,
+        float& outBlendFactor
+    ) const
+    {
+        if (!IsFrameRecorded(frameId) || m_capacity == 0)
+        {
+            return false;
+        }
+
+        outFrameIndex = GetFrameIndex(frameId);
+        outPreviousFrameIndex = outFrameIndex;
+        outBlendFactor = 1.0f;
+
+        const HostFrameId previousFrameId = HostFrameId{ static_cast<uint32_t>(frameId) - 1 };
+        if (blendFactor < 1.0f && IsFrameRecorded(previousFrameId))
+        {
+            outPreviousFrameIndex = GetFrameIndex(previousFrameId);
+            outBlendFactor = AZStd::max(blendFactor, 0.0f);
+        }
+        return true;
+    }
+
+    HitVolumeHistory::RewoundHitVolume HitVolumeHistory::GetRewoundHitVolume(uint32_t slot, uint32_t frameIndex, uint32_t previousFrameIndex, float blendFactor) const
+    {
+        auto getTransform = [this, slot](uint32_t index)
+        {
+            const AZ::Vector3 position(GetStream(index, PositionX)[slot], GetStream(index, PositionY)[slot], GetStream(index, PositionZ)[slot]);
+            const AZ::Quaternion rotation(GetStream(index, RotationX)[slot], GetStream(index, RotationY)[slot], GetStream(index, RotationZ)[slot], GetStream(index, RotationW)[slot]);
+            return AZ::Transform(position, rotation, GetStream(index, Scale)[slot]);
+        };
+
+        RewoundHitVolume result;
+        result.m_hitVolume = &m_hitVolumes[slot];
+        result.m_transform = getTransform(frameIndex);
+
+        // A hit volume added in the requested frame has no previous transform to blend from
+        if (previousFrameIndex != frameIndex && GetStream(previousFrameIndex, BoundingRadius)[slot] >= 0.0f)
+        {
+            const AZ::Transform previousTransform = getTransform(previousFrameIndex);
+            result.m_transform.SetRotation(previousTransform.GetRotation().Slerp(result.m_transform.GetRotation(), blendFactor));
+            result.m_transform.SetTranslation(previousTransform.GetTranslation().Lerp(result.m_transform.GetTranslation(), blendFactor));
+            result.m_transform.SetUniformScale(AZ::Lerp(previousTransform.GetUniformScale(), result.m_transform.GetUniformScale(), blendFactor));
+        }
+        return result;
+    }
+
+    void HitVolumeHistory::GatherRaycastCandidates
+    (
+        uint32_t frameIndex,
+        uint32_t previousFrameIndex,
+        float blendFactor,
+        const AZ::Vector3& start,
+        const AZ::Vector3& direction,
+        float maxDistance,
+        CandidateList& outCandidates
+    ) const
+    {
+        const float* positionX = GetStream(frameIndex, PositionX);
+        const float* positionY = GetStream(frameIndex, PositionY);
+        const float* positionZ = GetStream(frameIndex, PositionZ);
+        const float* previousX = GetStream(previousFrameIndex, PositionX);
+        const float* previousY = GetStream(previousFrameIndex, PositionY);
+        const float* previousZ = GetStream(previousFrameIndex, PositionZ);
+        const float* boundingRadius = GetStream(frameIndex, BoundingRadius);
+        const float* previousBoundingRadius = GetStream(previousFrameIndex, BoundingRadius);
+
+        const Simd::FloatType startX = Simd::Splat(start.GetX());
+        const Simd::FloatType startY = Simd::Splat(start.GetY());
+        const Simd::FloatType startZ = Simd::Splat(start.GetZ());
+        const Simd::FloatType directionX = Simd::Splat(direction.GetX());
+        const Simd::FloatType directionY = Simd::Splat(direction.GetY());
+        const Simd::FloatType directionZ = Simd::Splat(direction.GetZ());
+        const Simd::FloatType rayLength = Simd::Splat(maxDistance);
+        const Simd::FloatType blend = Simd::Splat(blendFactor);
+        const Simd::FloatType zero = Simd::ZeroFloat();
+        const Simd::FloatType one = Simd::Splat(1.0f);
+
+        for (uint32_t slot = 0; slot < m_capacity; slot += SimdWidth)
+        {
+            // Hit volumes that didn't exist in the previous frame use their current position
+            const Simd::FloatType slotBlend = Simd::Select(blend, one, Simd::CmpGtEq(Simd::LoadUnaligned(previousBoundingRadius + slot), zero));
+            // Offset from the ray start to the blended bounding sphere center
+            const Simd::FloatType offsetX = Simd::Sub(LoadBlended(previousX + slot, positionX + slot, slotBlend), startX);
+            const Simd::FloatType offsetY = Simd::Sub(LoadBlended(previousY + slot, positionY + slot, slotBlend), startY);
+            const Simd::FloatType offsetZ = Simd::Sub(LoadBlended(previousZ + slot, positionZ + slot, slotBlend), startZ);
+
+            // Closest point on the ray segment to the center
+            Simd::FloatType distance = Simd::Mul(offsetX, directionX);
+            distance = Simd::Madd(offsetY, directionY, distance);
+            distance = Simd::Madd(offsetZ, directionZ, distance);
+            distance = Simd::Min(Simd::Max(distance, zero), rayLength);
+
+            const Simd::FloatType deltaX = Simd::Sub(offsetX, Simd::Mul(directionX, distance));
+            const Simd::FloatType deltaY = Simd::Sub(offsetY, Simd::Mul(directionY, distance));
+            const Simd::FloatType deltaZ = Simd::Sub(offsetZ, Simd::Mul(directionZ, distance));
+            Simd::FloatType distanceSq = Simd::Mul(deltaX, deltaX);
+            distanceSq = Simd::Madd(deltaY, deltaY, distanceSq);
+            distanceSq = Simd::Madd(deltaZ, deltaZ, distanceSq);
+
+            const Simd::FloatType radius = Simd::LoadUnaligned(boundingRadius + slot);
+            const Simd::FloatType mask = Simd::And(Simd::CmpLtEq(distanceSq, Simd::Mul(radius, radius)), Simd::CmpGtEq(radius, zero));
+            AppendMaskedSlots(mask, slot, outCandidates);
+        }
+    }
+
+    void HitVolumeHistory::GatherOverlapCandidates
+    (
+        uint32_t frameIndex,
+        uint32_t previousFrameIndex,
+        float blendFactor,
+        const AZ::Vector3& center,
+        float radius,
+        CandidateList& outCandidates
+    ) const
+    {
+        const float* positionX = GetStream(frameIndex, PositionX);
+        const float* positionY = GetStream(frameIndex, PositionY);
+        const float* positionZ = GetStream(frameIndex, PositionZ);
+        const float* previousX = GetStream(previousFrameIndex, PositionX);
+        const float* previousY = GetStream(previousFrameIndex, PositionY);
+        const float* previousZ = GetStream(previousFrameIndex, PositionZ);
+        const float* boundingRadius = GetStream(frameIndex, BoundingRadius);
+        const float* previousBoundingRadius = GetStream(previousFrameIndex, BoundingRadius);
+
+        const Simd::FloatType centerX = Simd::Splat(center.GetX());
+        const Simd::FloatType centerY = Simd::Splat(center.GetY());
+        const Simd::FloatType centerZ = Simd::Splat(center.GetZ());
+        const Simd::FloatType queryRadius = Simd::Splat(radius);
+        const Simd::FloatType blend = Simd::Splat(blendFactor);
+        const Simd::FloatType zero = Simd::ZeroFloat();
+        const Simd::FloatType one = Simd::Splat(1.0f);
+
+        for (uint32_t slot = 0; slot < m_capacity; slot += SimdWidth)
+        {
+            // Hit volumes that didn't exist in the previous frame use their current position
+            const Simd::FloatType slotBlend = Simd::Select(blend, one, Simd::CmpGtEq(Simd::LoadUnaligned(previousBoundingRadius + slot), zero));
+            const Simd::FloatType deltaX = Simd::Sub(LoadBlended(previousX + slot, positionX + slot, slotBlend), centerX);
+            const Simd::FloatType deltaY = Simd::Sub(LoadBlended(previousY + slot, positionY + slot, slotBlend), centerY);
+            const Simd::FloatType deltaZ = Simd::Sub(LoadBlended(previousZ + slot, positionZ + slot, slotBlend), centerZ);
+            Simd::FloatType distanceSq = Simd::Mul(deltaX, deltaX);
+            distanceSq = Simd::Madd(deltaY, deltaY, distanceSq);
+            distanceSq = Simd::Madd(deltaZ, deltaZ, distanceSq);
+
+            const Simd::FloatType volumeRadius = Simd::LoadUnaligned(boundingRadius + slot);
+            const Simd::FloatType overlapRadius = Simd::Add(volumeRadius, queryRadius);
+            const Simd::FloatType mask = Simd::And(Simd::CmpLtEq(distanceSq, Simd::Mul(overlapRadius, overlapRadius)), Simd::CmpGtEq(volumeRadius, zero));
+            AppendMaskedSlots(mask, slot, outCandidates);
+        }
+    }
+}
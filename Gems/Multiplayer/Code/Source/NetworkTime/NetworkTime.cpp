@@ -38,12 +38,14 @@ namespace Multiplayer
     NetworkTime::NetworkTime()
     {
         AZ::Interface<INetworkTime>::Register(this);
+        AZ::Interface<HitVolumeHistory>::Register(&m_hitVolumeHistory);
         INetworkTimeRequestBus::Handler::BusConnect();
     }
 
     NetworkTime::~NetworkTime()
     {
         INetworkTimeRequestBus::Handler::BusDisconnect();
+        AZ::Interface<HitVolumeHistory>::Unregister(&m_hitVolumeHistory);
         AZ::Interface<INetworkTime>::Unregister(this);
     }
 
@@ -68,6 +70,7 @@ namespace Multiplayer
         ++m_unalteredFrameId;
         m_hostFrameId = m_unalteredFrameId;
         m_hostTimeMs = AZ::GetElapsedTimeMs();
+        m_hitVolumeHistory.BeginFrame(m_unalteredFrameId);
     }
 
     AZ::TimeMs NetworkTime::GetHostTimeMs() const
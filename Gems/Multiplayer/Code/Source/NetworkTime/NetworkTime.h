@@ -9,6 +9,7 @@
 #pragma once
 
 #include <Multiplayer/NetworkTime/INetworkTime.h>
+#include <Multiplayer/NetworkTime/HitVolumeHistory.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Console/IConsole.h>
@@ -43,6 +44,7 @@ namespace Multiplayer
     private:
 
         AZStd::vector<NetworkEntityHandle> m_rewoundEntities;
+        HitVolumeHistory m_hitVolumeHistory;
 
         HostFrameId m_hostFrameId = HostFrameId{ 0 };
         HostFrameId m_unalteredFrameId = HostFrameId{ 0 };
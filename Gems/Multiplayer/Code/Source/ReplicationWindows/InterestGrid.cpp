@@ -0,0 +1,368 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/InterestGrid.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+
+AZ_DECLARE_BUDGET(MULTIPLAYER);
+
+namespace Multiplayer
+{
+    AZ_CVAR(uint32_t, sv_InterestGridUpdateFrames, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The number of server ticks the interest grid spreads entity position updates and replication window refreshes over");
+    AZ_CVAR(bool, sv_InterestGridParallelUpdates, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, replication windows refresh their interest areas and candidate priorities in parallel on job threads");
+
+    // Keeps cell coordinates well away from InvalidCell and inside the range a float can represent exactly
+    static constexpr float MaxCellCoordinate = static_cast<float>(1 << 30);
+
+    static constexpr InterestGrid::CellBounds EmptyCellBounds = { InterestGrid::InvalidCell, InterestGrid::InvalidCell };
+
+    bool InterestGrid::CellBounds::Contains(const Cell& cell) const
+    {
+        return cell.m_x >= m_min.m_x && cell.m_x <= m_max.m_x
+            && cell.m_y >= m_min.m_y && cell.m_y <= m_max.m_y;
+    }
+
+    InterestGrid::InterestGrid(float cellSize)
+        : m_cellSize(AZStd::max(cellSize, 1.0f))
+        , m_inverseCellSize(1.0f / m_cellSize)
+    {
+        ;
+    }
+
+    void InterestGrid::SetEntityPosition(NetEntityId netEntityId, const AZ::Vector3& position)
+    {
+        const Cell cell = GetCell(position);
+        auto entityIter = m_entities.find(netEntityId);
+        if (entityIter == m_entities.end())
+        {
+            m_entities.emplace(netEntityId, Entry{ position, cell });
+            AddToCell(netEntityId, cell);
+            m_moves.push_back(Move{ m_version, netEntityId, InvalidCell, cell });
+            return;
+        }
+
+        Entry& entry = entityIter->second;
+        entry.m_position = position;
+        if (entry.m_cell != cell)
+        {
+            RemoveFromCell(netEntityId, entry.m_cell);
+            AddToCell(netEntityId, cell);
+            m_moves.push_back(Move{ m_version, netEntityId, entry.m_cell, cell });
+            entry.m_cell = cell;
+        }
+    }
+
+    void InterestGrid::RemoveEntity(NetEntityId netEntityId)
+    {
+        auto entityIter = m_entities.find(netEntityId);
+        if (entityIter != m_entities.end())
+        {
+            RemoveFromCell(netEntityId, entityIter->second.m_cell);
+            m_moves.push_back(Move{ m_version, netEntityId, entityIter->second.m_cell, InvalidCell });
+            m_entities.erase(entityIter);
+        }
+    }
+
+    void InterestGrid::Commit()
+    {
+        ++m_version;
+        while (!m_moves.empty() && (m_moves.front().m_version + HistoryLength < m_version))
+        {
+            m_moves.pop_front();
+        }
+    }
+
+    void InterestGrid::Update(const NetworkEntityTracker& networkEntityTracker)
+    {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "InterestGrid: Update");
+
+        const uint32_t sliceCount = AZStd::max<uint32_t>(sv_InterestGridUpdateFrames, 1);
+        const uint32_t slice = m_updateCount++ % sliceCount;
+
+        for (const auto& [netEntityId, entity] : networkEntityTracker)
+        {
+            if (static_cast<uint64_t>(netEntityId) % sliceCount != slice)
+            {
+                continue;
+            }
+
+            AZ::TransformInterface* transform = (entity != nullptr) ? entity->GetTransform() : nullptr;
+            if (transform != nullptr)
+            {
+                SetEntityPosition(netEntityId, transform->GetWorldTranslation());
+            }
+            else
+            {
+                RemoveEntity(netEntityId);
+            }
+        }
+
+        // Drop the entities in this slice that are no longer tracked
+        AZStd::vector<NetEntityId> removedEntities;
+        for (const auto& [netEntityId, entry] : m_entities)
+        {
+            if ((static_cast<uint64_t>(netEntityId) % sliceCount == slice) && !networkEntityTracker.Exists(netEntityId))
+            {
+                removedEntities.push_back(netEntityId);
+            }
+        }
+        for (NetEntityId netEntityId : removedEntities)
+        {
+            RemoveEntity(netEntityId);
+        }
+
+        Commit();
+
+        AZStd::vector<Subscriber*> updatingSubscribers;
+        for (size_t index = slice; index < m_subscribers.size(); index += sliceCount)
+        {
+            if (m_subscribers[index]->PrepareInterestUpdate())
+            {
+                updatingSubscribers.push_back(m_subscribers[index]);
+            }
+        }
+
+        if (sv_InterestGridParallelUpdates && updatingSubscribers.size() > 1)
+        {
+            AZ::JobCompletion jobCompletion;
+            for (Subscriber* subscriber : updatingSubscribers)
+            {
+                AZ::Job* job = AZ::CreateJobFunction([this, subscriber]()
+                    {
+                        subscriber->UpdateInterest(*this);
+                    }, true /*auto delete*/, nullptr);
+
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            for (Subscriber* subscriber : updatingSubscribers)
+            {
+                subscriber->UpdateInterest(*this);
+            }
+        }
+    }
+
+    void InterestGrid::AddSubscriber(Subscriber* subscriber)
+    {
+        m_subscribers.push_back(subscriber);
+    }
+
+    void InterestGrid::RemoveSubscriber(Subscriber* subscriber)
+    {
+        auto subscriberIter = AZStd::find(m_subscribers.begin(), m_subscribers.end(), subscriber);
+        if (subscriberIter != m_subscribers.end())
+        {
+            m_subscribers.erase(subscriberIter);
+        }
+    }
+
+    const AZ::Vector3* InterestGrid::GetEntityPosition(NetEntityId netEntityId) const
+    {
+        auto entityIter = m_entities.find(netEntityId);
+        return (entityIter != m_entities.end()) ? &entityIter->second.m_position : nullptr;
+    }
+
+    const AZStd::vector<NetEntityId>* InterestGrid::GetCellEntities(const Cell& cell) const
+    {
+        auto cellIter = m_cells.find(GetCellKey(cell));
+        return (cellIter != m_cells.end()) ? &cellIter->second : nullptr;
+    }
+
+    InterestGrid::CellBounds InterestGrid::GetCellBounds(const AZ::Vector3& center, float radius) const
+    {
+        return CellBounds
+        {
+            Cell{ GetCellCoordinate(center.GetX() - radius), GetCellCoordinate(center.GetY() - radius) },
+            Cell{ GetCellCoordinate(center.GetX() + radius), GetCellCoordinate(center.GetY() + radius) }
+        };
+    }
+
+    InterestGrid::Cell InterestGrid::GetCell(const AZ::Vector3& position) const
+    {
+        return Cell{ GetCellCoordinate(position.GetX()), GetCellCoordinate(position.GetY()) };
+    }
+
+    uint64_t InterestGrid::GetVersion() const
+    {
+        return m_version;
+    }
+
+    size_t InterestGrid::GetEntityCount() const
+    {
+        return m_entities.size();
+    }
+
+    bool InterestGrid::GetMovesSince(uint64_t version, AZStd::deque<Move>::const_iterator& begin, AZStd::deque<Move>::const_iterator& end) const
+    {
+        if (version + HistoryLength < m_version)
+        {
+            return false;
+        }
+
+        begin = AZStd::lower_bound(m_moves.begin(), m_moves.end(), version,
+            [](const Move& move, uint64_t value)
+            {
+                return move.m_version < value;
+            });
+        end = m_moves.end();
+        return true;
+    }
+
+    uint64_t InterestGrid::GetCellKey(const Cell& cell)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(cell.m_x)) << 32) | static_cast<uint32_t>(cell.m_y);
+    }
+
+    int32_t InterestGrid::GetCellCoordinate(float value) const
+    {
+        const float coordinate = AZStd::floor(value * m_inverseCellSize);
+        return static_cast<int32_t>(AZStd::clamp(coordinate, -MaxCellCoordinate, MaxCellCoordinate));
+    }
+
+    void InterestGrid::AddToCell(NetEntityId netEntityId, const Cell& cell)
+    {
+        m_cells[GetCellKey(cell)].push_back(netEntityId);
+    }
+
+    void InterestGrid::RemoveFromCell(NetEntityId netEntityId, const Cell& cell)
+    {
+        auto cellIter = m_cells.find(GetCellKey(cell));
+        if (cellIter == m_cells.end())
+        {
+            return;
+        }
+
+        AZStd::vector<NetEntityId>& cellEntities = cellIter->second;
+        auto entityIter = AZStd::find(cellEntities.begin(), cellEntities.end(), netEntityId);
+        if (entityIter != cellEntities.end())
+        {
+            *entityIter = cellEntities.back();
+            cellEntities.pop_back();
+        }
+
+        if (cellEntities.empty())
+        {
+            m_cells.erase(cellIter);
+        }
+    }
+
+    void InterestArea::Refresh(const InterestGrid& grid, const AZ::Vector3& center, float radius)
+    {
+        const InterestGrid::CellBounds bounds = grid.GetCellBounds(center, radius);
+
+        AZStd::deque<InterestGrid::Move>::const_iterator movesBegin;
+        AZStd::deque<InterestGrid::Move>::const_iterator movesEnd;
+        m_wasRebuilt = !m_initialized || !grid.GetMovesSince(m_version, movesBegin, movesEnd);
+        if (m_wasRebuilt)
+        {
+            Rebuild(grid, bounds);
+        }
+        else
+        {
+            // Apply the entities that moved across the border of the area since the last refresh,
+            // moves that were already applied by the last refresh have no effect when applied again
+            for (auto moveIter = movesBegin; moveIter != movesEnd; ++moveIter)
+            {
+                const bool wasInside = m_bounds.Contains(moveIter->m_from);
+                const bool isInside = m_bounds.Contains(moveIter->m_to);
+                if (wasInside && !isInside)
+                {
+                    m_entities.erase(moveIter->m_netEntityId);
+                }
+                else if (!wasInside && isInside)
+                {
+                    m_entities.insert(moveIter->m_netEntityId);
+                }
+            }
+
+            // Then the cells the area left or entered
+            if (bounds != m_bounds)
+            {
+                RemoveCells(grid, m_bounds, bounds);
+                AddCells(grid, bounds, m_bounds);
+            }
+        }
+
+        m_bounds = bounds;
+        m_version = grid.GetVersion();
+        m_initialized = true;
+    }
+
+    const AZStd::unordered_set<NetEntityId>& InterestArea::GetEntities() const
+    {
+        return m_entities;
+    }
+
+    bool InterestArea::WasRebuilt() const
+    {
+        return m_wasRebuilt;
+    }
+
+    void InterestArea::Rebuild(const InterestGrid& grid, const InterestGrid::CellBounds& bounds)
+    {
+        m_entities.clear();
+        AddCells(grid, bounds, EmptyCellBounds);
+    }
+
+    void InterestArea::AddCells(const InterestGrid& grid, const InterestGrid::CellBounds& bounds, const InterestGrid::CellBounds& excludedBounds)
+    {
+        for (int32_t x = bounds.m_min.m_x; x <= bounds.m_max.m_x; ++x)
+        {
+            for (int32_t y = bounds.m_min.m_y; y <= bounds.m_max.m_y; ++y)
+            {
+                const InterestGrid::Cell cell{ x, y };
+                if (excludedBounds.Contains(cell))
+                {
+                    continue;
+                }
+
+                if (const AZStd::vector<NetEntityId>* cellEntities = grid.GetCellEntities(cell))
+                {
+                    m_entities.insert(cellEntities->begin(), cellEntities->end());
+                }
+            }
+        }
+    }
+
+    void InterestArea::RemoveCells(const InterestGrid& grid, const InterestGrid::CellBounds& bounds, const InterestGrid::CellBounds& excludedBounds)
+    {
+        for (int32_t x = bounds.m_min.m_x; x <= bounds.m_max.m_x; ++x)
+        {
+            for (int32_t y = bounds.m_min.m_y; y <= bounds.m_max.m_y; ++y)
+            {
+                const InterestGrid::Cell cell{ x, y };
+                if (excludedBounds.Contains(cell))
+                {
+                    continue;
+                }
+
+                if (const AZStd::vector<NetEntityId>* cellEntities = grid.GetCellEntities(cell))
+                {
+                    for (NetEntityId netEntityId : *cellEntities)
+                    {
+                        m_entities.erase(netEntityId);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+
+namespace Multiplayer
+{
+    class NetworkEntityTracker;
+
+    //! @class InterestGrid
+    //! @brief Uniform grid over the XY plane that buckets network entities by position for server to client interest management.
+    //! Every entity move between cells is recorded in a short history, so an InterestArea that follows a client only has to apply
+    //! the cells it entered or left and the entities that crossed its border instead of querying the scene again.
+    class InterestGrid
+    {
+    public:
+        //! The number of grid versions that moves are remembered for, areas refreshed less often than this are rebuilt.
+        static constexpr uint64_t HistoryLength = 64;
+
+        struct Cell
+        {
+            int32_t m_x;
+            int32_t m_y;
+            bool operator==(const Cell& rhs) const { return m_x == rhs.m_x && m_y == rhs.m_y; }
+            bool operator!=(const Cell& rhs) const { return !(*this == rhs); }
+        };
+        //! Cell used for entities entering or leaving the grid, no area ever contains it.
+        static constexpr Cell InvalidCell = { AZStd::numeric_limits<int32_t>::min(), AZStd::numeric_limits<int32_t>::min() };
+
+        //! Inclusive range of cells.
+        struct CellBounds
+        {
+            Cell m_min;
+            Cell m_max;
+            bool Contains(const Cell& cell) const;
+            bool operator==(const CellBounds& rhs) const { return m_min == rhs.m_min && m_max == rhs.m_max; }
+            bool operator!=(const CellBounds& rhs) const { return !(*this == rhs); }
+        };
+
+        //! Interface for the owners of InterestAreas which the grid refreshes as part of Update.
+        class Subscriber
+        {
+        public:
+            virtual ~Subscriber() = default;
+            //! Called on the main thread, returns false if the subscriber has nothing to refresh.
+            virtual bool PrepareInterestUpdate() = 0;
+            //! Called after PrepareInterestUpdate returned true, potentially from a job thread in parallel with other subscribers.
+            virtual void UpdateInterest(const InterestGrid& grid) = 0;
+        };
+
+        explicit InterestGrid(float cellSize);
+
+        //! Moves an entity to the cell containing the provided position, adding it to the grid if it isn't in it yet.
+        void SetEntityPosition(NetEntityId netEntityId, const AZ::Vector3& position);
+        //! Removes an entity from the grid.
+        void RemoveEntity(NetEntityId netEntityId);
+        //! Completes the current version of the grid, moves made after this are seen by areas as part of the next version.
+        void Commit();
+
+        //! Updates a slice of the tracked network entities from their transforms, then refreshes a slice of the subscribers.
+        //! Each slice is 1/sv_InterestGridUpdateFrames of the total, so the cost is spread over that many calls.
+        void Update(const NetworkEntityTracker& networkEntityTracker);
+
+        void AddSubscriber(Subscriber* subscriber);
+        void RemoveSubscriber(Subscriber* subscriber);
+
+        //! Returns the last known position of an entity, or nullptr if it isn't in the grid.
+        const AZ::Vector3* GetEntityPosition(NetEntityId netEntityId) const;
+        //! Returns the entities in a cell, or nullptr if the cell is empty.
+        const AZStd::vector<NetEntityId>* GetCellEntities(const Cell& cell) const;
+        //! Returns the cells overlapping a circle on the XY plane.
+        CellBounds GetCellBounds(const AZ::Vector3& center, float radius) const;
+        Cell GetCell(const AZ::Vector3& position) const;
+        uint64_t GetVersion() const;
+        size_t GetEntityCount() const;
+
+        struct Move
+        {
+            uint64_t m_version = 0;
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            Cell m_from = InvalidCell;
+            Cell m_to = InvalidCell;
+        };
+        //! Returns true and the moves made since the provided version, or false if the history no longer goes back that far.
+        bool GetMovesSince(uint64_t version, AZStd::deque<Move>::const_iterator& begin, AZStd::deque<Move>::const_iterator& end) const;
+
+    private:
+        static uint64_t GetCellKey(const Cell& cell);
+        int32_t GetCellCoordinate(float value) const;
+        void AddToCell(NetEntityId netEntityId, const Cell& cell);
+        void RemoveFromCell(NetEntityId netEntityId, const Cell& cell);
+
+        struct Entry
+        {
+            AZ::Vector3 m_position;
+            Cell m_cell;
+        };
+
+        float m_cellSize = 1.0f;
+        float m_inverseCellSize = 1.0f;
+        uint64_t m_version = 0;
+        uint32_t m_updateCount = 0;
+        AZStd::unordered_map<NetEntityId, Entry> m_entities;
+        AZStd::unordered_map<uint64_t, AZStd::vector<NetEntityId>> m_cells;
+        AZStd::deque<Move> m_moves;
+        AZStd::vector<Subscriber*> m_subscribers;
+    };
+
+    //! @class InterestArea
+    //! @brief The set of entities in the grid cells overlapping a circle, kept up to date incrementally as the circle and the entities move.
+    class InterestArea
+    {
+    public:
+        //! Brings the area up to date with the grid for the provided center and radius.
+        //! Only reads from the grid, so different areas can be refreshed in parallel.
+        void Refresh(const InterestGrid& grid, const AZ::Vector3& center, float radius);
+
+        //! Entities in the cells covered by the area, this includes entities slightly outside of the radius.
+        const AZStd::unordered_set<NetEntityId>& GetEntities() const;
+
+        //! Returns true if the last refresh had to gather all entities again instead of applying changes.
+        bool WasRebuilt() const;
+
+    private:
+        void Rebuild(const InterestGrid& grid, const InterestGrid::CellBounds& bounds);
+        void AddCells(const InterestGrid& grid, const InterestGrid::CellBounds& bounds, const InterestGrid::CellBounds& excludedBounds);
+        void RemoveCells(const InterestGrid& grid, const InterestGrid::CellBounds& bounds, const InterestGrid::CellBounds& excludedBounds);
+
+        AZStd::unordered_set<NetEntityId> m_entities;
+        InterestGrid::CellBounds m_bounds = { InterestGrid::InvalidCell, InterestGrid::InvalidCell };
+        uint64_t m_version = 0;
+        bool m_initialized = false;
+        bool m_wasRebuilt = false;
+    };
+}
@@ -32,6 +32,11 @@ namespace Multiplayer
         return 0;
     }
 
+    uint32_t NullReplicationWindow::GetMaxEntityReplicatorSendRate() const
+    {
+        return 0;
+    }
+
     bool NullReplicationWindow::IsInWindow([[maybe_unused]] const ConstNetworkEntityHandle& entityHandle, NetEntityRole& outNetworkRole) const
     {
         outNetworkRole = NetEntityRole::InvalidRole;
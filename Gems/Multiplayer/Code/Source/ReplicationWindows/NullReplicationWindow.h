@@ -24,6 +24,7 @@ namespace Multiplayer
         bool ReplicationSetUpdateReady() override;
         const ReplicationSet& GetReplicationSet() const override;
         uint32_t GetMaxProxyEntityReplicatorSendCount() const override;
+        uint32_t GetMaxEntityReplicatorSendRate() const override;
         bool IsInWindow(const ConstNetworkEntityHandle& entityPtr, NetEntityRole& outNetworkRole) const override;
         bool AddEntity(AZ::Entity* entity) override;
         void RemoveEntity(AZ::Entity* entity) override;
@@ -13,6 +13,7 @@
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/sort.h>
 
 namespace Multiplayer
@@ -23,6 +24,9 @@ namespace Multiplayer
     AZ_CVAR(uint32_t, sv_MaxEntitiesToReplicate, 256, nullptr, AZ::ConsoleFunctorFlags::Null, "The default max number of entities to replicate to a client connection");
     AZ_CVAR(uint32_t, sv_PacketsToIntegrateQos, 1000, nullptr, AZ::ConsoleFunctorFlags::Null, "The number of packets to accumulate before updating connection quality of service metrics");
     AZ_CVAR(float, sv_BadConnectionThreshold, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null, "The loss percentage beyond which we consider our network bad");
+    AZ_CVAR(uint32_t, sv_MaxReplicationBytesPerSecond, 0, nullptr, AZ::ConsoleFunctorFlags::Null, "The max rate in bytes per second to send entity updates to a client connection at, 0 disables the bandwidth budget");
+    AZ_CVAR(uint32_t, sv_MinReplicationBytesPerSecond, 8192, nullptr, AZ::ConsoleFunctorFlags::Null, "The rate in bytes per second the entity update budget is reduced to on a lossy or congested client connection");
+    AZ_CVAR(float, sv_ReplicationBudgetRttThresholdMs, 150.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The round trip time in milliseconds beyond which the entity update budget is reduced proportionally");
     AZ_CVAR(float, sv_ClientAwarenessRadius, 500.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum distance entities can be from the client and still be relevant");
 
     const char* GetConnectionStateString(bool isPoor)
@@ -51,9 +55,10 @@ namespace Multiplayer
         return m_priority < rhs.m_priority;
     }
 
-    ServerToClientReplicationWindow::ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection)
+    ServerToClientReplicationWindow::ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection, InterestGrid* interestGrid)
         : m_controlledEntity(controlledEntity)
         , m_connection(connection)
+        , m_interestGrid(interestGrid)
         , m_lastCheckedSentPackets(connection->GetMetrics().m_packetsSent)
         , m_lastCheckedLostPackets(connection->GetMetrics().m_packetsLost)
     {
@@ -61,6 +66,19 @@ namespace Multiplayer
         AZ_Assert(entity, "Invalid controlled entity provided to replication window");
         m_controlledEntityTransform = entity ? entity->GetTransform() : nullptr;
         AZ_Assert(m_controlledEntityTransform, "Controlled player entity must have a transform");
+
+        if (m_interestGrid != nullptr)
+        {
+            m_interestGrid->AddSubscriber(this);
+        }
+    }
+
+    ServerToClientReplicationWindow::~ServerToClientReplicationWindow()
+    {
+        if (m_interestGrid != nullptr)
+        {
+            m_interestGrid->RemoveSubscriber(this);
+        }
     }
 
     bool ServerToClientReplicationWindow::ReplicationSetUpdateReady()
@@ -83,6 +101,11 @@ namespace Multiplayer
         return m_isPoorConnection ? sv_MinEntitiesToReplicate : sv_MaxEntitiesToReplicate;
     }
 
+    uint32_t ServerToClientReplicationWindow::GetMaxEntityReplicatorSendRate() const
+    {
+        return m_sendRate;
+    }
+
     bool ServerToClientReplicationWindow::IsInWindow([[maybe_unused]] const ConstNetworkEntityHandle& entityHandle, NetEntityRole& outNetworkRole) const
     {
         AZ_Assert(false, "IsInWindow should not be called on the ServerToClientReplicationWindow");
@@ -112,6 +135,39 @@ namespace Multiplayer
         AZ::TransformInterface* transformInterface = m_controlledEntity.GetEntity()->GetTransform();
         const AZ::Vector3 controlledEntityPosition = transformInterface->GetWorldTranslation();
 
+        if (m_interestGrid != nullptr)
+        {
+            GatherInterestGridCandidates(controlledEntityPosition);
+        }
+        else
+        {
+            GatherVisibilityCandidates(controlledEntityPosition);
+        }
+
+        // Add in all entities that have forced relevancy
+        const Multiplayer::NetEntityHandleSet& alwaysRelevantToClients = GetNetworkEntityManager()->GetAlwaysRelevantToClientsSet();
+        for (const ConstNetworkEntityHandle& entityHandle : alwaysRelevantToClients)
+        {
+            if (entityHandle.Exists())
+            {
+                AZ_Assert(entityHandle.GetNetBindComponent()->IsNetEntityRoleAuthority(), "Encountered forced relevant entity that is not in an authority role");
+                m_replicationSet[entityHandle] = { NetEntityRole::Client, 1.0f }; // Always replicate entities with forced relevancy
+            }
+        }
+
+        // Add in Autonomous Entities
+        // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
+        m_replicationSet[m_controlledEntity] = { NetEntityRole::Autonomous, 1.0f }; // Always replicate autonomous entities
+
+        auto* hierarchyComponent = m_controlledEntity.FindComponent<NetworkHierarchyRootComponent>();
+        if (hierarchyComponent != nullptr)
+        {
+            UpdateHierarchyReplicationSet(m_replicationSet, *hierarchyComponent);
+        }
+    }
+
+    void ServerToClientReplicationWindow::GatherVisibilityCandidates(const AZ::Vector3& controlledEntityPosition)
+    {
         AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
         AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
         AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
@@ -159,27 +215,87 @@ namespace Multiplayer
                 
             AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
         }
+    }
 
-        // Add in all entities that have forced relevancy
-        const Multiplayer::NetEntityHandleSet& alwaysRelevantToClients = GetNetworkEntityManager()->GetAlwaysRelevantToClientsSet();
-        for (const ConstNetworkEntityHandle& entityHandle : alwaysRelevantToClients)
+    void ServerToClientReplicationWindow::GatherInterestGridCandidates(const AZ::Vector3& controlledEntityPosition)
+    {
+        if (!m_hasInterestCandidates)
         {
-            if (entityHandle.Exists())
+            // The grid hasn't refreshed this window yet
+            m_interestPosition = controlledEntityPosition;
+            UpdateInterest(*m_interestGrid);
+        }
+
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
+
+        for (const InterestCandidate& candidate : m_interestCandidates)
+        {
+            if (m_candidateQueue.size() >= sv_MaxEntitiesToTrackReplication)
             {
-                AZ_Assert(entityHandle.GetNetBindComponent()->IsNetEntityRoleAuthority(), "Encountered forced relevant entity that is not in an authority role");
-                m_replicationSet[entityHandle] = { NetEntityRole::Client, 1.0f }; // Always replicate entities with forced relevancy
+                // Candidates are sorted by priority, so everything after this would be dropped again
+                break;
+            }
+
+            NetworkEntityHandle entityHandle = networkEntityTracker->Get(candidate.m_netEntityId);
+            if (!entityHandle.Exists() || entityHandle.GetNetBindComponent() == nullptr)
+            {
+                continue;
+            }
+
+            if (filterEntityManager && filterEntityManager->IsEntityFiltered(entityHandle.GetEntity(), m_controlledEntity, m_connection->GetConnectionId()))
+            {
+                continue;
             }
+
+            AddEntityToReplicationSet(entityHandle, candidate.m_priority, candidate.m_distanceSquared);
         }
+    }
 
-        // Add in Autonomous Entities
-        // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
-        m_replicationSet[m_controlledEntity] = { NetEntityRole::Autonomous, 1.0f }; // Always replicate autonomous entities
+    bool ServerToClientReplicationWindow::PrepareInterestUpdate()
+    {
+        NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
+        if (!netBindComponent || !netBindComponent->HasController())
+        {
+            return false;
+        }
 
-        auto* hierarchyComponent = m_controlledEntity.FindComponent<NetworkHierarchyRootComponent>();
-        if (hierarchyComponent != nullptr)
+        // Read on the main thread, UpdateInterest may run on a job thread
+        m_interestPosition = m_controlledEntity.GetEntity()->GetTransform()->GetWorldTranslation();
+        return true;
+    }
+
+    void ServerToClientReplicationWindow::UpdateInterest(const InterestGrid& grid)
+    {
+        const float awarenessRadius = sv_ClientAwarenessRadius;
+        m_interestArea.Refresh(grid, m_interestPosition, awarenessRadius);
+
+        // The area covers whole cells, so trim it down to the awareness radius while computing priorities
+        const float awarenessRadiusSquared = awarenessRadius * awarenessRadius;
+        m_interestCandidates.clear();
+        m_interestCandidates.reserve(m_interestArea.GetEntities().size());
+        for (NetEntityId netEntityId : m_interestArea.GetEntities())
         {
-            UpdateHierarchyReplicationSet(m_replicationSet, *hierarchyComponent);
+            const AZ::Vector3* position = grid.GetEntityPosition(netEntityId);
+            if (position == nullptr)
+            {
+                continue;
+            }
+
+            const float distanceSquared = m_interestPosition.GetDistanceSq(*position);
+            if (distanceSquared < awarenessRadiusSquared)
+            {
+                const float priority = (distanceSquared > 0.0f) ? 1.0f / distanceSquared : 0.0f;
+                m_interestCandidates.push_back(InterestCandidate{ netEntityId, priority, distanceSquared });
+            }
         }
+
+        AZStd::sort(m_interestCandidates.begin(), m_interestCandidates.end(),
+            [](const InterestCandidate& lhs, const InterestCandidate& rhs)
+            {
+                return lhs.m_priority > rhs.m_priority;
+            });
+        m_hasInterestCandidates = true;
     }
 
     AzNetworking::PacketId ServerToClientReplicationWindow::SendEntityUpdateMessages(NetworkEntityUpdateVector& entityUpdateVector)
@@ -312,6 +428,33 @@ namespace Multiplayer
             m_lastCheckedSentPackets = newPacketsSent;
             m_lastCheckedLostPackets = newPacketsLost;
         }
+
+        UpdateSendRate();
+    }
+
+    void ServerToClientReplicationWindow::UpdateSendRate()
+    {
+        const uint32_t maxSendRate = sv_MaxReplicationBytesPerSecond;
+        if (maxSendRate == 0)
+        {
+            m_sendRate = 0;
+            return;
+        }
+
+        // Back off linearly as loss approaches the bad connection threshold, and proportionally once latency rises past the
+        // rtt threshold since that usually means packets are queueing up somewhere along the route
+        const AzNetworking::ConnectionMetrics& metrics = m_connection->GetMetrics();
+        const float badConnectionThreshold = sv_BadConnectionThreshold;
+        const float lossRate = metrics.m_sendDatarate.GetLossRatePercent();
+        const float lossScale = (badConnectionThreshold > 0.0f) ? AZStd::clamp(1.0f - lossRate / badConnectionThreshold, 0.0f, 1.0f) : 1.0f;
+
+        const float rttMs = metrics.m_connectionRtt.GetRoundTripTimeSeconds() * 1000.0f;
+        const float rttThresholdMs = sv_ReplicationBudgetRttThresholdMs;
+        const float rttScale = (rttMs > rttThresholdMs && rttThresholdMs > 0.0f) ? rttThresholdMs / rttMs : 1.0f;
+
+        const float minSendRate = static_cast<float>(AZStd::min<uint32_t>(sv_MinReplicationBytesPerSecond, maxSendRate));
+        const float sendRate = minSendRate + (static_cast<float>(maxSendRate) - minSendRate) * lossScale * rttScale;
+        m_sendRate = static_cast<uint32_t>(sendRate);
     }
 
     void ServerToClientReplicationWindow::AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, [[maybe_unused]] float distanceSquared)
@@ -11,6 +11,7 @@
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+#include <Source/ReplicationWindows/InterestGrid.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/EBus/ScheduledEvent.h>
@@ -24,6 +25,7 @@ namespace Multiplayer
 
     class ServerToClientReplicationWindow
         : public IReplicationWindow
+        , public InterestGrid::Subscriber
     {
     public:
 
@@ -39,13 +41,16 @@ namespace Multiplayer
         // we sort lowest priority first, so that we can easily keep the biggest N priorities
         using ReplicationCandidateQueue = AZStd::priority_queue<PrioritizedReplicationCandidate>;
 
-        ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection);
+        //! @param interestGrid if provided, relevant entities are gathered from the grid instead of querying the visibility system
+        ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection, InterestGrid* interestGrid = nullptr);
+        ~ServerToClientReplicationWindow() override;
 
         //! IReplicationWindow interface
         //! @{
         bool ReplicationSetUpdateReady() override;
         const ReplicationSet& GetReplicationSet() const override;
         uint32_t GetMaxProxyEntityReplicatorSendCount() const override;
+        uint32_t GetMaxEntityReplicatorSendRate() const override;
         bool IsInWindow(const ConstNetworkEntityHandle& entityPtr, NetEntityRole& outNetworkRole) const override;
         bool AddEntity(AZ::Entity* entity) override;
         void RemoveEntity(AZ::Entity* entity) override;
@@ -56,11 +61,21 @@ namespace Multiplayer
         void DebugDraw() const override;
         //! @}
 
+        //! InterestGrid::Subscriber interface
+        //! @{
+        bool PrepareInterestUpdate() override;
+        void UpdateInterest(const InterestGrid& grid) override;
+        //! @}
+
     private:
 
         void UpdateHierarchyReplicationSet(ReplicationSet& replicationSet, NetworkHierarchyRootComponent& hierarchyComponent);
 
+        void GatherVisibilityCandidates(const AZ::Vector3& controlledEntityPosition);
+        void GatherInterestGridCandidates(const AZ::Vector3& controlledEntityPosition);
+
         void EvaluateConnection();
+        void UpdateSendRate();
         void AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, float distanceSquared);
 
         ServerToClientReplicationWindow& operator=(const ServerToClientReplicationWindow&) = delete;
@@ -77,9 +92,25 @@ namespace Multiplayer
 
         AzNetworking::IConnection* m_connection = nullptr;
 
+        // Interest grid state, the candidates are refreshed by the grid and sorted highest priority first
+        struct InterestCandidate
+        {
+            NetEntityId m_netEntityId;
+            float m_priority;
+            float m_distanceSquared;
+        };
+        InterestGrid* m_interestGrid = nullptr;
+        InterestArea m_interestArea;
+        AZ::Vector3 m_interestPosition = AZ::Vector3::CreateZero();
+        AZStd::vector<InterestCandidate> m_interestCandidates;
+        bool m_hasInterestCandidates = false;
+
         // Cached values to detect a poor network connection
         uint32_t m_lastCheckedSentPackets = 0;
         uint32_t m_lastCheckedLostPackets = 0;
         bool     m_isPoorConnection = true;
+
+        // Entity update budget in bytes per second derived from the connection metrics, 0 if unlimited
+        uint32_t m_sendRate = 0;
     };
 }
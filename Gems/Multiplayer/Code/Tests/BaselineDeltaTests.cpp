@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/BaselineDelta.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class BaselineDeltaTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static AZStd::vector<uint8_t> MakeData(uint32_t size, uint8_t seed)
+        {
+            AZStd::vector<uint8_t> data(size);
+            for (uint32_t i = 0; i < size; ++i)
+            {
+                data[i] = static_cast<uint8_t>(i * 31 + seed);
+            }
+            return data;
+        }
+    };
+
+    TEST_F(BaselineDeltaTests, SmallChangesRoundTrip)
+    {
+        const AZStd::vector<uint8_t> baseline = MakeData(200, 7);
+        AZStd::vector<uint8_t> data = baseline;
+        data[3] ^= 0x01;
+        data[100] = 0xFF;
+        data[101] = 0x00;
+        data.push_back(0x42);
+
+        AzNetworking::PacketEncodingBuffer delta;
+        EXPECT_TRUE(EncodeBaselineDelta(baseline.data(), static_cast<uint32_t>(baseline.size()), data.data(), static_cast<uint32_t>(data.size()), delta));
+        EXPECT_LT(delta.GetSize(), data.size());
+
+        AzNetworking::PacketEncodingBuffer decoded;
+        EXPECT_TRUE(DecodeBaselineDelta(baseline.data(), static_cast<uint32_t>(baseline.size()), delta.GetBuffer(), static_cast<uint32_t>(delta.GetSize()), decoded));
+        ASSERT_EQ(decoded.GetSize(), data.size());
+        EXPECT_EQ(memcmp(decoded.GetBuffer(), data.data(), data.size()), 0);
+    }
+
+    TEST_F(BaselineDeltaTests, ShorterDataRoundTrips)
+    {
+        const AZStd::vector<uint8_t> baseline = MakeData(200, 7);
+        const AZStd::vector<uint8_t> data(baseline.begin(), baseline.begin() + 150);
+
+        AzNetworking::PacketEncodingBuffer delta;
+        EXPECT_TRUE(EncodeBaselineDelta(baseline.data(), static_cast<uint32_t>(baseline.size()), data.data(), static_cast<uint32_t>(data.size()), delta));
+
+        AzNetworking::PacketEncodingBuffer decoded;
+        EXPECT_TRUE(DecodeBaselineDelta(baseline.data(), static_cast<uint32_t>(baseline.size()), delta.GetBuffer(), static_cast<uint32_t>(delta.GetSize()), decoded));
+        ASSERT_EQ(decoded.GetSize(), data.size());
+        EXPECT_EQ(memcmp(decoded.GetBuffer(), data.data(), data.size()), 0);
+    }
+
+    TEST_F(BaselineDeltaTests, UnrelatedDataIsNotEncoded)
+    {
+        const AZStd::vector<uint8_t> baseline = MakeData(64, 7);
+        const AZStd::vector<uint8_t> data = MakeData(64, 100);
+
+        AzNetworking::PacketEncodingBuffer delta;
+        EXPECT_FALSE(EncodeBaselineDelta(baseline.data(), static_cast<uint32_t>(baseline.size()), data.data(), static_cast<uint32_t>(data.size()), delta));
+    }
+
+    TEST_F(BaselineDeltaTests, MalformedDeltaIsRejected)
+    {
+        const AZStd::vector<uint8_t> baseline = MakeData(200, 7);
+        AZStd::vector<uint8_t> data = baseline;
+        data[50] = 0;
+
+        AzNetworking::PacketEncodingBuffer delta;
+        EXPECT_TRUE(EncodeBaselineDelta(baseline.data(), static_cast<uint32_t>(baseline.size()), data.data(), static_cast<uint32_t>(data.size()), delta));
+
+        // Truncated deltas and deltas with trailing bytes both fail to decode
+        AzNetworking::PacketEncodingBuffer decoded;
+        EXPECT_FALSE(DecodeBaselineDelta(baseline.data(), static_cast<uint32_t>(baseline.size()), delta.GetBuffer(), static_cast<uint32_t>(delta.GetSize() - 1), decoded));
+
+        AzNetworking::PacketEncodingBuffer padded;
+        padded.CopyValues(delta.GetBuffer(), delta.GetSize());
+        padded.Resize(delta.GetSize() + 1);
+        padded.GetBuffer()[delta.GetSize()] = 0;
+        EXPECT_FALSE(DecodeBaselineDelta(baseline.data(), static_cast<uint32_t>(baseline.size()), padded.GetBuffer(), static_cast<uint32_t>(padded.GetSize()), decoded));
+    }
+}
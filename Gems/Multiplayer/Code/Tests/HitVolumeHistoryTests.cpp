@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkTime/HitVolumeHistory.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class HitVolumeHistoryTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static HitVolumeShape MakeCapsule()
+        {
+            HitVolumeShape shape;
+            shape.m_type = HitVolumeShapeType::Capsule;
+            shape.m_radius = 0.5f;
+            shape.m_height = 2.0f;
+            return shape;
+        }
+
+        static HitVolumeShape MakeBox()
+        {
+            HitVolumeShape shape;
+            shape.m_type = HitVolumeShapeType::Box;
+            shape.m_halfExtents = AZ::Vector3(1.0f);
+            return shape;
+        }
+    };
+
+    TEST_F(HitVolumeHistoryTests, RaycastPastFrame)
+    {
+        HitVolumeHistory history;
+        history.BeginFrame(HostFrameId{ 10 });
+        const HitVolumeHandle capsule = history.AddHitVolume(NetEntityId{ 1 }, 0, MakeCapsule());
+        const HitVolumeHandle box = history.AddHitVolume(NetEntityId{ 2 }, 3, MakeBox());
+        history.SetTransform(capsule, AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 10.0f, 0.0f)));
+        history.SetTransform(box, AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 20.0f, 0.0f)));
+
+        // The capsule moves out of the way, the box keeps its transform from the previous frame
+        history.BeginFrame(HostFrameId{ 11 });
+        history.SetTransform(capsule, AZ::Transform::CreateTranslation(AZ::Vector3(5.0f, 10.0f, 0.0f)));
+
+        HitVolumeQueryResults results;
+        EXPECT_TRUE(history.Raycast(HostFrameId{ 10 }, 1.0f, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisY(), 100.0f, results));
+        ASSERT_EQ(results.size(), 2);
+        EXPECT_EQ(results[0].m_netEntityId, NetEntityId{ 1 });
+        EXPECT_NEAR(results[0].m_distance, 9.5f, 0.001f);
+        EXPECT_EQ(results[1].m_netEntityId, NetEntityId{ 2 });
+        EXPECT_EQ(results[1].m_hitVolumeIndex, 3);
+        EXPECT_NEAR(results[1].m_distance, 19.0f, 0.001f);
+
+        EXPECT_TRUE(history.Raycast(HostFrameId{ 11 }, 1.0f, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisY(), 100.0f, results));
+        ASSERT_EQ(results.size(), 1);
+        EXPECT_EQ(results[0].m_netEntityId, NetEntityId{ 2 });
+
+        // Rays shorter than the distance to the volume don't hit it
+        EXPECT_TRUE(history.Raycast(HostFrameId{ 11 }, 1.0f, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisY(), 15.0f, results));
+        EXPECT_TRUE(results.empty());
+    }
+
+    TEST_F(HitVolumeHistoryTests, RaycastBlendsFrames)
+    {
+        HitVolumeHistory history;
+        history.BeginFrame(HostFrameId{ 10 });
+        const HitVolumeHandle capsule = history.AddHitVolume(NetEntityId{ 1 }, 0, MakeCapsule());
+        history.SetTransform(capsule, AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 10.0f, 0.0f)));
+        history.BeginFrame(HostFrameId{ 11 });
+        history.SetTransform(capsule, AZ::Transform::CreateTranslation(AZ::Vector3(5.0f, 10.0f, 0.0f)));
+
+        HitVolumeQueryResults results;
+        EXPECT_TRUE(history.Raycast(HostFrameId{ 11 }, 0.5f, AZ::Vector3(2.5f, 0.0f, 0.0f), AZ::Vector3::CreateAxisY(), 100.0f, results));
+        EXPECT_EQ(results.size(), 1);
+        EXPECT_TRUE(history.Raycast(HostFrameId{ 11 }, 1.0f, AZ::Vector3(2.5f, 0.0f, 0.0f), AZ::Vector3::CreateAxisY(), 100.0f, results));
+        EXPECT_TRUE(results.empty());
+    }
+
+    TEST_F(HitVolumeHistoryTests, OverlapSphere)
+    {
+        HitVolumeHistory history;
+        history.BeginFrame(HostFrameId{ 10 });
+        const HitVolumeHandle box = history.AddHitVolume(NetEntityId{ 2 }, 0, MakeBox());
+        history.SetTransform(box, AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 20.0f, 0.0f)));
+
+        HitVolumeQueryResults results;
+        EXPECT_TRUE(history.OverlapSphere(HostFrameId{ 10 }, 1.0f, AZ::Vector3(0.0f, 22.0f, 0.0f), 1.1f, results));
+        EXPECT_EQ(results.size(), 1);
+
+        // Inside the bounding sphere of the box, but outside the box itself
+        EXPECT_TRUE(history.OverlapSphere(HostFrameId{ 10 }, 1.0f, AZ::Vector3(1.5f, 21.5f, 0.0f), 0.2f, results));
+        EXPECT_TRUE(results.empty());
+    }
+
+    TEST_F(HitVolumeHistoryTests, FramesOutsideHistory)
+    {
+        HitVolumeHistory history;
+        history.BeginFrame(HostFrameId{ 10 });
+        const HitVolumeHandle capsule = history.AddHitVolume(NetEntityId{ 1 }, 0, MakeCapsule());
+        history.SetTransform(capsule, AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 10.0f, 0.0f)));
+
+        HitVolumeQueryResults results;
+        EXPECT_FALSE(history.Raycast(HostFrameId{ 9 }, 1.0f, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisY(), 100.0f, results));
+
+        for (uint32_t frame = 11; frame <= 10 + RewindHistorySize; ++frame)
+        {
+            history.BeginFrame(HostFrameId{ frame });
+        }
+        EXPECT_FALSE(history.IsFrameRecorded(HostFrameId{ 10 }));
+        EXPECT_TRUE(history.IsFrameRecorded(HostFrameId{ 11 }));
+        EXPECT_TRUE(history.Raycast(HostFrameId{ 11 }, 1.0f, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisY(), 100.0f, results));
+        EXPECT_EQ(results.size(), 1);
+    }
+
+    TEST_F(HitVolumeHistoryTests, RemovedHitVolumesRemainInPastFrames)
+    {
+        HitVolumeHistory history;
+        history.BeginFrame(HostFrameId{ 10 });
+        const HitVolumeHandle capsule = history.AddHitVolume(NetEntityId{ 1 }, 0, MakeCapsule());
+        history.SetTransform(capsule, AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 10.0f, 0.0f)));
+        history.BeginFrame(HostFrameId{ 11 });
+        history.RemoveHitVolume(capsule);
+        EXPECT_EQ(history.GetHitVolumeCount(), 0);
+
+        // The slot isn't reused while the removed hit volume is still in the history
+        EXPECT_NE(history.AddHitVolume(NetEntityId{ 2 }, 0, MakeBox()), capsule);
+
+        HitVolumeQueryResults results;
+        EXPECT_TRUE(history.Raycast(HostFrameId{ 10 }, 1.0f, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisY(), 100.0f, results));
+        ASSERT_EQ(results.size(), 1);
+        EXPECT_EQ(results[0].m_netEntityId, NetEntityId{ 1 });
+        EXPECT_TRUE(history.Raycast(HostFrameId{ 11 }, 1.0f, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisY(), 100.0f, results));
+        EXPECT_TRUE(results.empty());
+    }
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/InterestGrid.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class InterestGridTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static constexpr float CellSize = 10.0f;
+        static constexpr float Radius = 15.0f;
+    };
+
+    TEST_F(InterestGridTests, AreaGathersEntitiesInCoveredCells)
+    {
+        InterestGrid grid(CellSize);
+        grid.SetEntityPosition(NetEntityId{ 1 }, AZ::Vector3(5.0f, 5.0f, 0.0f));
+        grid.SetEntityPosition(NetEntityId{ 2 }, AZ::Vector3(-12.0f, 3.0f, 100.0f));
+        grid.SetEntityPosition(NetEntityId{ 3 }, AZ::Vector3(200.0f, 0.0f, 0.0f));
+        grid.Commit();
+
+        InterestArea area;
+        area.Refresh(grid, AZ::Vector3::CreateZero(), Radius);
+        EXPECT_TRUE(area.WasRebuilt());
+        EXPECT_EQ(area.GetEntities().size(), 2);
+        EXPECT_EQ(area.GetEntities().count(NetEntityId{ 1 }), 1);
+        EXPECT_EQ(area.GetEntities().count(NetEntityId{ 2 }), 1);
+        EXPECT_EQ(area.GetEntities().count(NetEntityId{ 3 }), 0);
+    }
+
+    TEST_F(InterestGridTests, AreaTracksEntitiesCrossingItsBorder)
+    {
+        InterestGrid grid(CellSize);
+        grid.SetEntityPosition(NetEntityId{ 1 }, AZ::Vector3(5.0f, 5.0f, 0.0f));
+        grid.SetEntityPosition(NetEntityId{ 2 }, AZ::Vector3(200.0f, 0.0f, 0.0f));
+        grid.Commit();
+
+        InterestArea area;
+        area.Refresh(grid, AZ::Vector3::CreateZero(), Radius);
+        EXPECT_EQ(area.GetEntities().size(), 1);
+
+        // Entity 1 leaves, entity 2 enters, and a new entity appears inside the area
+        grid.SetEntityPosition(NetEntityId{ 1 }, AZ::Vector3(-200.0f, 0.0f, 0.0f));
+        grid.SetEntityPosition(NetEntityId{ 2 }, AZ::Vector3(1.0f, -1.0f, 0.0f));
+        grid.SetEntityPosition(NetEntityId{ 3 }, AZ::Vector3(-1.0f, 1.0f, 0.0f));
+        grid.Commit();
+
+        area.Refresh(grid, AZ::Vector3::CreateZero(), Radius);
+        EXPECT_FALSE(area.WasRebuilt());
+        EXPECT_EQ(area.GetEntities().size(), 2);
+        EXPECT_EQ(area.GetEntities().count(NetEntityId{ 2 }), 1);
+        EXPECT_EQ(area.GetEntities().count(NetEntityId{ 3 }), 1);
+
+        // Moving within the area doesn't change the set
+        grid.SetEntityPosition(NetEntityId{ 2 }, AZ::Vector3(12.0f, 12.0f, 0.0f));
+        grid.Commit();
+        area.Refresh(grid, AZ::Vector3::CreateZero(), Radius);
+        EXPECT_EQ(area.GetEntities().size(), 2);
+    }
+
+    TEST_F(InterestGridTests, MovingAreaAddsAndRemovesCells)
+    {
+        InterestGrid grid(CellSize);
+        grid.SetEntityPosition(NetEntityId{ 1 }, AZ::Vector3(0.0f, 0.0f, 0.0f));
+        grid.SetEntityPosition(NetEntityId{ 2 }, AZ::Vector3(100.0f, 0.0f, 0.0f));
+        grid.Commit();
+
+        InterestArea area;
+        AZ::Vector3 center = AZ::Vector3::CreateZero();
+        area.Refresh(grid, center, Radius);
+        EXPECT_EQ(area.GetEntities().count(NetEntityId{ 1 }), 1);
+        EXPECT_EQ(area.GetEntities().count(NetEntityId{ 2 }), 0);
+
+        // Walk the area over to entity 2 one step at a time, while entity 2 also moves a little each step
+        for (uint32_t step = 1; step <= 10; ++step)
+        {
+            center = AZ::Vector3(static_cast<float>(step) * 10.0f, 0.0f, 0.0f);
+            grid.SetEntityPosition(NetEntityId{ 2 }, AZ::Vector3(100.0f, static_cast<float>(step % 2) * 5.0f, 0.0f));
+            grid.Commit();
+            area.Refresh(grid, center, Radius);
+            EXPECT_FALSE(area.WasRebuilt());
+        }
+
+        EXPECT_EQ(area.GetEntities().size(), 1);
+        EXPECT_EQ(area.GetEntities().count(NetEntityId{ 2 }), 1);
+    }
+
+    TEST_F(InterestGridTests, AreaRebuildsOnceHistoryIsLost)
+    {
+        InterestGrid grid(CellSize);
+        grid.SetEntityPosition(NetEntityId{ 1 }, AZ::Vector3(200.0f, 0.0f, 0.0f));
+        grid.Commit();
+
+        InterestArea area;
+        area.Refresh(grid, AZ::Vector3::CreateZero(), Radius);
+        EXPECT_TRUE(area.GetEntities().empty());
+
+        grid.SetEntityPosition(NetEntityId{ 1 }, AZ::Vector3(1.0f, 1.0f, 0.0f));
+        for (uint64_t version = 0; version <= InterestGrid::HistoryLength; ++version)
+        {
+            grid.Commit();
+        }
+
+        AZStd::deque<InterestGrid::Move>::const_iterator begin;
+        AZStd::deque<InterestGrid::Move>::const_iterator end;
+        EXPECT_FALSE(grid.GetMovesSince(1, begin, end));
+
+        area.Refresh(grid, AZ::Vector3::CreateZero(), Radius);
+        EXPECT_TRUE(area.WasRebuilt());
+        EXPECT_EQ(area.GetEntities().count(NetEntityId{ 1 }), 1);
+    }
+
+    TEST_F(InterestGridTests, RemovedEntitiesLeaveAreas)
+    {
+        InterestGrid grid(CellSize);
+        grid.SetEntityPosition(NetEntityId{ 1 }, AZ::Vector3(1.0f, 1.0f, 0.0f));
+        grid.SetEntityPosition(NetEntityId{ 2 }, AZ::Vector3(2.0f, 2.0f, 0.0f));
+        grid.Commit();
+
+        InterestArea area;
+        area.Refresh(grid, AZ::Vector3::CreateZero(), Radius);
+        EXPECT_EQ(area.GetEntities().size(), 2);
+
+        grid.RemoveEntity(NetEntityId{ 1 });
+        grid.Commit();
+        EXPECT_EQ(grid.GetEntityCount(), 1);
+        EXPECT_EQ(grid.GetEntityPosition(NetEntityId{ 1 }), nullptr);
+
+        area.Refresh(grid, AZ::Vector3::CreateZero(), Radius);
+        EXPECT_EQ(area.GetEntities().size(), 1);
+        EXPECT_EQ(area.GetEntities().count(NetEntityId{ 2 }), 1);
+    }
+}
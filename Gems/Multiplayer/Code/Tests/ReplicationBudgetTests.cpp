@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/ReplicationBudget.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class ReplicationBudgetTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static ReplicationBudget::CandidateList MakeCandidates()
+        {
+            ReplicationBudget::CandidateList candidates;
+            candidates.push_back(ReplicationBudget::Candidate{ nullptr, NetEntityId{ 1 }, 1.0f });
+            candidates.push_back(ReplicationBudget::Candidate{ nullptr, NetEntityId{ 2 }, 4.0f });
+            candidates.push_back(ReplicationBudget::Candidate{ nullptr, NetEntityId{ 3 }, 2.0f });
+            return candidates;
+        }
+    };
+
+    TEST_F(ReplicationBudgetTests, UnlimitedBudgetSelectsByPriority)
+    {
+        ReplicationBudget budget;
+        budget.Refill(0, AZ::TimeMs{ 100 }, AZ::TimeMs{ 100 });
+        EXPECT_FALSE(budget.IsLimited());
+
+        ReplicationBudget::CandidateList candidates = MakeCandidates();
+        EXPECT_EQ(budget.Schedule(candidates, 2), 2);
+        EXPECT_EQ(candidates[0].m_netEntityId, NetEntityId{ 2 });
+        EXPECT_EQ(candidates[1].m_netEntityId, NetEntityId{ 3 });
+    }
+
+    TEST_F(ReplicationBudgetTests, SkippedCandidatesAccumulatePriority)
+    {
+        ReplicationBudget budget;
+
+        // Only one candidate fits each frame, the lowest priority candidate must still get a turn
+        bool sentLowestPriority = false;
+        for (uint32_t frame = 0; frame < 8 && !sentLowestPriority; ++frame)
+        {
+            ReplicationBudget::CandidateList candidates = MakeCandidates();
+            ASSERT_EQ(budget.Schedule(candidates, 1), 1);
+            sentLowestPriority = (candidates[0].m_netEntityId == NetEntityId{ 1 });
+        }
+        EXPECT_TRUE(sentLowestPriority);
+    }
+
+    TEST_F(ReplicationBudgetTests, LimitedBudgetFillsGreedily)
+    {
+        ReplicationBudget budget;
+        ReplicationBudget::CandidateList candidates = MakeCandidates();
+        budget.Schedule(candidates, 3);
+        budget.Consume(NetEntityId{ 2 }, 1000);
+
+        // 200 bytes available, entity 2 is estimated above that and is skipped in favour of the smaller entities
+        budget.Refill(2000, AZ::TimeMs{ 100 }, AZ::TimeMs{ 200 });
+        EXPECT_TRUE(budget.IsLimited());
+        EXPECT_FLOAT_EQ(budget.GetAvailableBytes(), 200.0f);
+
+        candidates = MakeCandidates();
+        EXPECT_EQ(budget.Schedule(candidates, 3), 2);
+        EXPECT_EQ(candidates[0].m_netEntityId, NetEntityId{ 3 });
+        EXPECT_EQ(candidates[1].m_netEntityId, NetEntityId{ 1 });
+    }
+
+    TEST_F(ReplicationBudgetTests, ConsumeLimitsDebt)
+    {
+        ReplicationBudget budget;
+        budget.Refill(1000, AZ::TimeMs{ 100 }, AZ::TimeMs{ 100 });
+        budget.Consume(NetEntityId{ 1 }, 1000);
+        EXPECT_FLOAT_EQ(budget.GetAvailableBytes(), -100.0f);
+
+        // A full budget always admits one candidate, even when its estimate exceeds the capacity
+        budget.Refill(1000, AZ::TimeMs{ 1000 }, AZ::TimeMs{ 100 });
+        EXPECT_FLOAT_EQ(budget.GetAvailableBytes(), 100.0f);
+
+        ReplicationBudget::CandidateList candidates = MakeCandidates();
+        budget.Schedule(candidates, 3);
+        budget.Consume(NetEntityId{ 2 }, 1000);
+        budget.Refill(1000, AZ::TimeMs{ 1000 }, AZ::TimeMs{ 100 });
+        candidates.resize(1);
+        candidates[0].m_netEntityId = NetEntityId{ 2 };
+        EXPECT_EQ(budget.Schedule(candidates, 3), 1);
+    }
+}
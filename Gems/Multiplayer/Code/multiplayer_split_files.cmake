@@ -24,6 +24,7 @@ set(FILES
     Include/Multiplayer/NetworkEntity/EntityReplication/EntityReplicationManager.h
     Include/Multiplayer/NetworkEntity/EntityReplication/EntityReplicator.h
     Include/Multiplayer/NetworkEntity/EntityReplication/EntityReplicator.inl
+    Include/Multiplayer/NetworkEntity/EntityReplication/ReplicationBudget.h
     Source/AutoGen/LocalPredictionPlayerInputComponent.AutoComponent.xml
     Source/AutoGen/NetworkCharacterComponent.AutoComponent.xml
     Source/AutoGen/NetworkDebugPlayerIdComponent.AutoComponent.xml
@@ -58,14 +59,20 @@ set(FILES
     Source/NetworkEntity/NetworkSpawnableLibrary.h
     Source/NetworkEntity/EntityReplication/EntityReplicationManager.cpp
     Source/NetworkEntity/EntityReplication/EntityReplicator.cpp
+    Source/NetworkEntity/EntityReplication/BaselineDelta.cpp
+    Source/NetworkEntity/EntityReplication/BaselineDelta.h
     Source/NetworkEntity/EntityReplication/PropertyPublisher.cpp
     Source/NetworkEntity/EntityReplication/PropertyPublisher.h
     Source/NetworkEntity/EntityReplication/PropertySubscriber.cpp
     Source/NetworkEntity/EntityReplication/PropertySubscriber.h
+    Source/NetworkEntity/EntityReplication/ReplicationBudget.cpp
+    Source/NetworkTime/HitVolumeHistory.cpp
     Source/NetworkTime/NetworkTime.cpp
     Source/NetworkTime/NetworkTime.h
     Source/ReplicationWindows/NullReplicationWindow.cpp
     Source/ReplicationWindows/NullReplicationWindow.h
+    Source/ReplicationWindows/InterestGrid.cpp
+    Source/ReplicationWindows/InterestGrid.h
     Source/ReplicationWindows/ServerToClientReplicationWindow.cpp
     Source/ReplicationWindows/ServerToClientReplicationWindow.h
 )
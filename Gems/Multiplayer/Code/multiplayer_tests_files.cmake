@@ -13,7 +13,9 @@ set(FILES
     Include/Multiplayer/AutoGen/AutoComponent_Header.jinja
     Include/Multiplayer/AutoGen/AutoComponent_Source.jinja
     Tests/AutoGen/TestMultiplayerComponent.AutoComponent.xml
+    Tests/BaselineDeltaTests.cpp
     Tests/ClientHierarchyTests.cpp
+    Tests/HitVolumeHistoryTests.cpp
     Tests/ServerHierarchyBenchmarks.cpp
     Tests/CommonHierarchySetup.h
     Tests/CommonNetworkEntitySetup.h
@@ -32,6 +34,8 @@ set(FILES
     Tests/NetworkTransformTests.cpp
     Tests/RewindableContainerTests.cpp
     Tests/RewindableObjectTests.cpp
+    Tests/ReplicationBudgetTests.cpp
+    Tests/InterestGridTests.cpp
     Tests/ServerHierarchyTests.cpp
     Tests/SimplePlayerSpawnerTests.cpp
     Tests/TestMultiplayerComponent.h
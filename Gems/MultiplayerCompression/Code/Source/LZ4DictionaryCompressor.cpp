@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "LZ4DictionaryCompressor.h"
+#include "LZ4DictionaryTrainer.h"
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <lz4.h>
+// LZ4_resetStreamHC_fast and LZ4_attach_HC_dictionary are only exposed for static linking
+#define LZ4_HC_STATIC_LINKING_ONLY
+#include <lz4hc.h>
+
+namespace MultiplayerCompression
+{
+    AZ_CVAR(bool, mp_compressionCaptureSamples, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Records the payloads passed to the dictionary compressor so they can be saved with mp_compressionSaveSamples");
+    AZ_CVAR(uint32_t, mp_compressionCaptureMaxSamples, 100000, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The maximum number of payloads recorded while mp_compressionCaptureSamples is enabled");
+
+    namespace
+    {
+        AZStd::mutex s_capturedSamplesMutex;
+        AZStd::vector<CompressionSample> s_capturedSamples;
+
+        void CaptureSample(const void* data, size_t size)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(s_capturedSamplesMutex);
+            if (s_capturedSamples.size() < mp_compressionCaptureMaxSamples)
+            {
+                const uint8_t* sampleData = reinterpret_cast<const uint8_t*>(data);
+                s_capturedSamples.emplace_back(sampleData, sampleData + size);
+            }
+        }
+    }
+
+    void mp_compressionSaveSamples(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 1)
+        {
+            AZLOG_ERROR("Usage: mp_compressionSaveSamples <sampleFile>");
+            return;
+        }
+
+        AZStd::vector<CompressionSample> samples;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(s_capturedSamplesMutex);
+            samples.swap(s_capturedSamples);
+        }
+
+        const AZ::CVarFixedString sampleFile(arguments[0]);
+        if (WriteCompressionSamples(sampleFile.c_str(), samples))
+        {
+            AZLOG_INFO("Saved %zu compression samples to %s", samples.size(), sampleFile.c_str());
+        }
+    }
+    AZ_CONSOLEFREEFUNC(mp_compressionSaveSamples, AZ::ConsoleFunctorFlags::DontReplicate, "Writes the payloads recorded while mp_compressionCaptureSamples is enabled to a file and clears them: <sampleFile>");
+
+    LZ4DictionaryCompressor::~LZ4DictionaryCompressor()
+    {
+        ReleaseStreams();
+    }
+
+    void LZ4DictionaryCompressor::SetDictionary(AZStd::vector<uint8_t> dictionary)
+    {
+        ReleaseStreams();
+
+        if (dictionary.size() > MaxDictionarySize)
+        {
+            dictionary.erase(dictionary.begin(), dictionary.end() - MaxDictionarySize);
+        }
+        m_dictionary = AZStd::move(dictionary);
+        m_dictionaryId = 0;
+
+        if (!m_dictionary.empty())
+        {
+            m_dictionaryId = AZ::Crc32(m_dictionary.data(), m_dictionary.size());
+            m_dictionaryStream = LZ4_createStreamHC();
+            LZ4_loadDictHC(m_dictionaryStream, reinterpret_cast<const char*>(m_dictionary.data()), static_cast<int>(m_dictionary.size()));
+        }
+    }
+
+    bool LZ4DictionaryCompressor::LoadDictionary(const char* filePath)
+    {
+        auto result = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(filePath);
+        if (!result.IsSuccess())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to load compression dictionary: %s", result.GetError().c_str());
+            return false;
+        }
+
+        SetDictionary(result.TakeValue());
+        return true;
+    }
+
+    size_t LZ4DictionaryCompressor::GetMaxChunkSize(size_t maxCompSize) const
+    {
+        return maxCompSize;
+    }
+
+    size_t LZ4DictionaryCompressor::GetMaxCompressedBufferSize(size_t uncompSize) const
+    {
+        return LZ4_compressBound(static_cast<int>(uncompSize));
+    }
+
+    AzNetworking::CompressorError LZ4DictionaryCompressor::Compress
+    (
+        const void* uncompData,
+        size_t uncompSize,
+        void* compData,
+        size_t compDataSize,
+        size_t& compSize
+    )
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        const int compWorstCaseSize = LZ4_compressBound(static_cast<int>(uncompSize));
+        if (compWorstCaseSize == 0)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input size (%lu) passed to Compress() is greater than max allowed (%lu)", uncompSize, LZ4_MAX_INPUT_SIZE);
+            return AzNetworking::CompressorError::InsufficientBuffer;
+        }
+
+        if (mp_compressionCaptureSamples)
+        {
+            CaptureSample(uncompData, uncompSize);
+        }
+
+        LZ4_streamHC_t* stream = nullptr;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_streamMutex);
+            if (!m_freeStreams.empty())
+            {
+                stream = m_freeStreams.back();
+                m_freeStreams.pop_back();
+            }
+        }
+        if (stream == nullptr)
+        {
+            stream = LZ4_createStreamHC();
+        }
+
+        // Each packet is compressed on its own against the dictionary, since packets can be lost or arrive out of order
+        LZ4_resetStreamHC_fast(stream, LZ4HC_CLEVEL_DEFAULT);
+        LZ4_attach_HC_dictionary(stream, m_dictionaryStream);
+        compSize = LZ4_compress_HC_continue(
+            stream,
+            reinterpret_cast<const char*>(uncompData),
+            reinterpret_cast<char*>(compData),
+            static_cast<int>(uncompSize),
+            static_cast<int>(compDataSize));
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_streamMutex);
+            m_freeStreams.push_back(stream);
+        }
+
+        if (compSize == 0)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compression failed for uncompSize:(%lu B) compDataSize:(%lu B) compSize:(%lu B)", uncompSize, compDataSize, compSize);
+            return AzNetworking::CompressorError::CorruptData;
+        }
+
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError LZ4DictionaryCompressor::Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSizeOut, size_t& uncompSizeOut)
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        const int uncompSize = LZ4_decompress_safe_usingDict(
+            reinterpret_cast<const char*>(compData),
+            reinterpret_cast<char*>(uncompData),
+            static_cast<int>(compDataSize),
+            static_cast<int>(uncompDataSize),
+            reinterpret_cast<const char*>(m_dictionary.data()),
+            static_cast<int>(m_dictionary.size()));
+        consumedSizeOut = compDataSize;
+
+        if (uncompSize < 0)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Decompression failed for compDataSize:(%lu B) uncompDataSize:(%lu B) uncompSize:(%d B)", compDataSize, uncompDataSize, uncompSize);
+            return AzNetworking::CompressorError::CorruptData;
+        }
+        uncompSizeOut = uncompSize;
+
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    void LZ4DictionaryCompressor::ReleaseStreams()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_streamMutex);
+        for (LZ4_streamHC_t* stream : m_freeStreams)
+        {
+            LZ4_freeStreamHC(stream);
+        }
+        m_freeStreams.clear();
+
+        if (m_dictionaryStream != nullptr)
+        {
+            LZ4_freeStreamHC(m_dictionaryStream);
+            m_dictionaryStream = nullptr;
+        }
+    }
+}
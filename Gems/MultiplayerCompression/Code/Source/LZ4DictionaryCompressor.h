@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzNetworking/Framework/ICompressor.h>
+#include <AzCore/Casting/numeric_cast.h>
+
+union LZ4_streamHC_u;
+
+namespace MultiplayerCompression
+{
+    static const char* DictionaryCompressorName = "LZ4Dictionary";
+    static const AzNetworking::CompressorType DictionaryCompressorType = aznumeric_cast<AzNetworking::CompressorType>(static_cast<AZ::u32>(AZ::Crc32(DictionaryCompressorName)));
+
+    //! LZ4 only references the last 64KB of a dictionary.
+    static constexpr size_t MaxDictionarySize = 64 * 1024;
+
+    /**
+    * Implements an LZ4 Compressor which primes every packet with a dictionary trained offline from captured packets.
+    * Replication packets are small and repetitive, so matching against the dictionary gives a much better ratio than
+    * compressing each packet on its own. Without a dictionary this produces the same output as LZ4Compressor.
+    * Compress and Decompress can be called concurrently from multiple threads.
+    */
+    class LZ4DictionaryCompressor
+        : public AzNetworking::ICompressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(LZ4DictionaryCompressor, AZ::SystemAllocator);
+
+        LZ4DictionaryCompressor() = default;
+        ~LZ4DictionaryCompressor() override;
+
+        //! Replaces the dictionary, must be called before the compressor is used.
+        //! @param dictionary the dictionary data, only the last MaxDictionarySize bytes are used
+        void SetDictionary(AZStd::vector<uint8_t> dictionary);
+
+        //! Loads the dictionary from a file, typically one written by mp_compressionTrainDictionary.
+        //! @param filePath path of the dictionary file
+        //! @return boolean true if the dictionary was loaded
+        bool LoadDictionary(const char* filePath);
+
+        const char* GetName() const { return DictionaryCompressorName; }
+        AzNetworking::CompressorType GetType() const override { return DictionaryCompressorType; };
+        uint32_t GetDictionaryId() const override { return m_dictionaryId; }
+
+        bool Init() override { return true; }
+        size_t GetMaxChunkSize(size_t maxCompSize) const override;
+        size_t GetMaxCompressedBufferSize(size_t uncompSize) const override;
+
+        AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize) override;
+        AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize) override;
+
+    private:
+        void ReleaseStreams();
+
+        AZStd::vector<uint8_t> m_dictionary;
+        uint32_t m_dictionaryId = 0;
+
+        //! The dictionary indexed once, attached to a working stream for each packet instead of indexing it again.
+        LZ4_streamHC_u* m_dictionaryStream = nullptr;
+
+        //! Working streams are large, so they're kept around for reuse, one per thread compressing at the same time.
+        AZStd::mutex m_streamMutex;
+        AZStd::vector<LZ4_streamHC_u*> m_freeStreams;
+    };
+}
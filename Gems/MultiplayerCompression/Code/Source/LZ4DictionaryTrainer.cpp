@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "LZ4DictionaryTrainer.h"
+#include "LZ4Compressor.h"
+#include "LZ4DictionaryCompressor.h"
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/Utils/Utils.h>
+
+namespace MultiplayerCompression
+{
+    namespace
+    {
+        //! Segments are the pieces of samples added to the dictionary, dmers are the substrings whose frequencies score a segment.
+        constexpr size_t SegmentSize = 64;
+        constexpr size_t DmerSize = 6;
+        constexpr size_t SegmentDmerCount = SegmentSize - DmerSize + 1;
+        constexpr uint32_t HashBits = 20;
+        constexpr size_t HashSize = size_t(1) << HashBits;
+
+        constexpr size_t DefaultDictionarySize = 16 * 1024;
+
+        uint32_t HashDmer(const uint8_t* data)
+        {
+            uint64_t value = 0;
+            for (size_t i = 0; i < DmerSize; ++i)
+            {
+                value = (value << 8) | data[i];
+            }
+            return static_cast<uint32_t>((value * 0x9E3779B97F4A7C15ull) >> (64 - HashBits));
+        }
+
+        struct Segment
+        {
+            size_t m_sample = 0;
+            size_t m_begin = 0;
+            size_t m_end = 0;
+            uint64_t m_score = 0;
+        };
+
+        Segment FindBestSegment(
+            const AZStd::vector<CompressionSample>& samples,
+            size_t firstSample,
+            size_t lastSample,
+            const AZStd::vector<uint32_t>& frequencies,
+            AZStd::vector<uint16_t>& windowCounts)
+        {
+            Segment best;
+            for (size_t sampleIndex = firstSample; sampleIndex < lastSample; ++sampleIndex)
+            {
+                const CompressionSample& sample = samples[sampleIndex];
+                if (sample.size() < DmerSize)
+                {
+                    continue;
+                }
+
+                // Slide a window over the dmers of the sample, each distinct dmer in the window adds its frequency to the score once
+                const size_t dmerCount = sample.size() - DmerSize + 1;
+                uint64_t score = 0;
+                for (size_t i = 0; i < dmerCount; ++i)
+                {
+                    const uint32_t hash = HashDmer(sample.data() + i);
+                    if (windowCounts[hash]++ == 0)
+                    {
+                        score += frequencies[hash];
+                    }
+
+                    if (i >= SegmentDmerCount)
+                    {
+                        const uint32_t oldHash = HashDmer(sample.data() + i - SegmentDmerCount);
+                        if (--windowCounts[oldHash] == 0)
+                        {
+                            score -= frequencies[oldHash];
+                        }
+                    }
+
+                    if (score > best.m_score)
+                    {
+                        const size_t begin = (i + 1 >= SegmentDmerCount) ? i + 1 - SegmentDmerCount : 0;
+                        best = Segment{ sampleIndex, begin, i + DmerSize, score };
+                    }
+                }
+
+                // Empty the window before moving on to the next sample
+                for (size_t i = (dmerCount > SegmentDmerCount) ? dmerCount - SegmentDmerCount : 0; i < dmerCount; ++i)
+                {
+                    --windowCounts[HashDmer(sample.data() + i)];
+                }
+            }
+            return best;
+        }
+
+        size_t GetCompressedSize(AzNetworking::ICompressor& compressor, const AZStd::vector<CompressionSample>& samples)
+        {
+            size_t compressedTotal = 0;
+            AZStd::vector<uint8_t> compressed;
+            for (const CompressionSample& sample : samples)
+            {
+                compressed.resize(compressor.GetMaxCompressedBufferSize(sample.size()));
+                size_t compressedSize = 0;
+                if (compressor.Compress(sample.data(), sample.size(), compressed.data(), compressed.size(), compressedSize) != AzNetworking::CompressorError::Ok)
+                {
+                    compressedSize = sample.size();
+                }
+                // The network interface sends packets uncompressed when compression doesn't help
+                compressedTotal += AZStd::min(compressedSize, sample.size());
+            }
+            return compressedTotal;
+        }
+    }
+
+    bool WriteCompressionSamples(const char* filePath, const AZStd::vector<CompressionSample>& samples)
+    {
+        AZStd::vector<AZStd::byte> data;
+        for (const CompressionSample& sample : samples)
+        {
+            const size_t size = AZStd::min<size_t>(sample.size(), AZStd::numeric_limits<uint16_t>::max());
+            data.push_back(static_cast<AZStd::byte>(size & 0xFF));
+            data.push_back(static_cast<AZStd::byte>(size >> 8));
+            const AZStd::byte* sampleData = reinterpret_cast<const AZStd::byte*>(sample.data());
+            data.insert(data.end(), sampleData, sampleData + size);
+        }
+
+        auto result = AZ::Utils::WriteFile(AZStd::span<const AZStd::byte>(data.data(), data.size()), filePath);
+        if (!result.IsSuccess())
+        {
+            AZLOG_ERROR("Failed to write compression samples to %s: %s", filePath, result.GetError().c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool ReadCompressionSamples(const char* filePath, AZStd::vector<CompressionSample>& samples)
+    {
+        auto result = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(filePath);
+        if (!result.IsSuccess())
+        {
+            AZLOG_ERROR("Failed to read compression samples from %s: %s", filePath, result.GetError().c_str());
+            return false;
+        }
+
+        const AZStd::vector<uint8_t>& data = result.GetValue();
+        size_t offset = 0;
+        while (offset + 2 <= data.size())
+        {
+            const size_t size = data[offset] | (data[offset + 1] << 8);
+            offset += 2;
+            if (offset + size > data.size())
+            {
+                break;
+            }
+            samples.emplace_back(data.begin() + offset, data.begin() + offset + size);
+            offset += size;
+        }
+
+        if (offset != data.size())
+        {
+            AZLOG_ERROR("Compression sample file %s is truncated", filePath);
+            return false;
+        }
+        return true;
+    }
+
+    AZStd::vector<uint8_t> TrainDictionary(const AZStd::vector<CompressionSample>& samples, size_t dictionarySize)
+    {
+        dictionarySize = AZStd::min(dictionarySize, MaxDictionarySize);
+
+        // Count the number of samples each dmer appears in, repeats within a single packet are already handled without a dictionary
+        AZStd::vector<uint32_t> frequencies(HashSize, 0);
+        {
+            AZStd::vector<size_t> lastSeenSample(HashSize, 0);
+            for (size_t sampleIndex = 0; sampleIndex < samples.size(); ++sampleIndex)
+            {
+                const CompressionSample& sample = samples[sampleIndex];
+                for (size_t i = 0; i + DmerSize <= sample.size(); ++i)
+                {
+                    const uint32_t hash = HashDmer(sample.data() + i);
+                    if (lastSeenSample[hash] != sampleIndex + 1)
+                    {
+                        lastSeenSample[hash] = sampleIndex + 1;
+                        ++frequencies[hash];
+                    }
+                }
+            }
+        }
+
+        // Content that only shows up in a single sample is never worth adding
+        for (uint32_t& frequency : frequencies)
+        {
+            frequency = (frequency > 1) ? frequency : 0;
+        }
+
+        // The dictionary is filled from the back, so the segments picked first end up closest to the packet data
+        AZStd::vector<uint8_t> dictionary(dictionarySize);
+        size_t dictionaryBegin = dictionarySize;
+
+        const size_t epochCount = AZStd::max<size_t>(1, AZStd::min(samples.size(), dictionarySize / SegmentSize));
+        const size_t epochSampleCount = (samples.size() + epochCount - 1) / epochCount;
+
+        AZStd::vector<uint16_t> windowCounts(HashSize, 0);
+        bool addedSegment = true;
+        while (dictionaryBegin > 0 && addedSegment)
+        {
+            addedSegment = false;
+            for (size_t epoch = 0; epoch < epochCount && dictionaryBegin > 0; ++epoch)
+            {
+                const size_t firstSample = AZStd::min(samples.size(), epoch * epochSampleCount);
+                const size_t lastSample = AZStd::min(samples.size(), firstSample + epochSampleCount);
+                const Segment best = FindBestSegment(samples, firstSample, lastSample, frequencies, windowCounts);
+                if (best.m_score == 0)
+                {
+                    continue;
+                }
+
+                const CompressionSample& sample = samples[best.m_sample];
+                const size_t segmentSize = AZStd::min(best.m_end - best.m_begin, dictionaryBegin);
+                dictionaryBegin -= segmentSize;
+                memcpy(dictionary.data() + dictionaryBegin, sample.data() + best.m_begin, segmentSize);
+
+                // Once a segment is in the dictionary its content doesn't need to be added again
+                for (size_t i = best.m_begin; i + DmerSize <= best.m_end; ++i)
+                {
+                    frequencies[HashDmer(sample.data() + i)] = 0;
+                }
+                addedSegment = true;
+            }
+        }
+
+        dictionary.erase(dictionary.begin(), dictionary.begin() + dictionaryBegin);
+        return dictionary;
+    }
+
+    void mp_compressionTrainDictionary(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 2)
+        {
+            AZLOG_ERROR("Usage: mp_compressionTrainDictionary <sampleFile> <dictionaryFile> [dictionarySize]");
+            return;
+        }
+
+        const AZ::CVarFixedString sampleFile(arguments[0]);
+        const AZ::CVarFixedString dictionaryFile(arguments[1]);
+        size_t dictionarySize = DefaultDictionarySize;
+        if (arguments.size() > 2)
+        {
+            const AZ::CVarFixedString dictionarySizeString(arguments[2]);
+            dictionarySize = static_cast<size_t>(strtoull(dictionarySizeString.c_str(), nullptr, 10));
+        }
+
+        AZStd::vector<CompressionSample> samples;
+        if (!ReadCompressionSamples(sampleFile.c_str(), samples))
+        {
+            return;
+        }
+
+        AZStd::vector<uint8_t> dictionary = TrainDictionary(samples, dictionarySize);
+        auto result = AZ::Utils::WriteFile(AZStd::span<const AZStd::byte>(reinterpret_cast<const AZStd::byte*>(dictionary.data()), dictionary.size()), dictionaryFile.c_str());
+        if (!result.IsSuccess())
+        {
+            AZLOG_ERROR("Failed to write compression dictionary to %s: %s", dictionaryFile.c_str(), result.GetError().c_str());
+            return;
+        }
+
+        // Report how much the dictionary helps on the samples it was trained on
+        size_t uncompressedSize = 0;
+        for (const CompressionSample& sample : samples)
+        {
+            uncompressedSize += sample.size();
+        }
+        LZ4Compressor compressor;
+        LZ4DictionaryCompressor dictionaryCompressor;
+        const size_t dictionaryBytes = dictionary.size();
+        dictionaryCompressor.SetDictionary(AZStd::move(dictionary));
+
+        AZLOG_INFO("Trained a %zu byte compression dictionary (id %08x) from %zu samples, %zu bytes compress to %zu bytes without it and %zu bytes with it",
+            dictionaryBytes, dictionaryCompressor.GetDictionaryId(), samples.size(), uncompressedSize,
+            GetCompressedSize(compressor, samples), GetCompressedSize(dictionaryCompressor, samples));
+    }
+    AZ_CONSOLEFREEFUNC(mp_compressionTrainDictionary, AZ::ConsoleFunctorFlags::DontReplicate, "Trains a compression dictionary from a file written by mp_compressionSaveSamples: <sampleFile> <dictionaryFile> [dictionarySize]");
+}
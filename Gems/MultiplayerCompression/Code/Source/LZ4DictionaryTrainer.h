@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+
+namespace MultiplayerCompression
+{
+    //! A single captured packet payload used to train a dictionary.
+    using CompressionSample = AZStd::vector<uint8_t>;
+
+    //! Writes samples to a file, each one prefixed by its size as a 16 bit little endian value.
+    //! @param filePath path of the file to write
+    //! @param samples  the samples to write, samples over 64KB are truncated
+    //! @return boolean true if the file was written
+    bool WriteCompressionSamples(const char* filePath, const AZStd::vector<CompressionSample>& samples);
+
+    //! Reads samples from a file written by WriteCompressionSamples, appending them to the provided samples.
+    //! @param filePath path of the file to read
+    //! @param samples  samples to append to
+    //! @return boolean true if the file was read and all of its samples were complete
+    bool ReadCompressionSamples(const char* filePath, AZStd::vector<CompressionSample>& samples);
+
+    //! Builds an LZ4 dictionary out of the short segments that occur in the most samples.
+    //! The samples are split into one epoch per segment that fits in the dictionary, and the best scoring segment of each epoch
+    //! is added, so that LZ4 can match the content that repeats across packets without it having to repeat within a packet.
+    //! @param samples        the samples to train on, typically captured with mp_compressionCaptureSamples
+    //! @param dictionarySize the maximum size of the dictionary
+    //! @return the dictionary, which is smaller than dictionarySize if the samples don't have enough repeated content
+    AZStd::vector<uint8_t> TrainDictionary(const AZStd::vector<CompressionSample>& samples, size_t dictionarySize);
+}
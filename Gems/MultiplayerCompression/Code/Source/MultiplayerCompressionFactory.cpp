@@ -8,11 +8,16 @@
 
 #include "MultiplayerCompressionFactory.h"
 #include "LZ4Compressor.h"
+#include "LZ4DictionaryCompressor.h"
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace MultiplayerCompression
 {
+    AZ_CVAR(AZ::CVarFixedString, mp_compressionDictionary, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Dictionary file used by the MultiplayerDictionaryCompressor, both endpoints of a connection must use the same dictionary"); // WARN: like net_UdpCompressor this needs to be set before creating the network interface
+
     AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerCompressionFactory::Create()
     {
         return AZStd::make_unique<LZ4Compressor>();
@@ -22,4 +27,20 @@ namespace MultiplayerCompression
     {
         return s_compressorName;
     }
+
+    AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerDictionaryCompressionFactory::Create()
+    {
+        AZStd::unique_ptr<LZ4DictionaryCompressor> compressor = AZStd::make_unique<LZ4DictionaryCompressor>();
+        const AZ::CVarFixedString dictionaryFile = static_cast<AZ::CVarFixedString>(mp_compressionDictionary);
+        if (!dictionaryFile.empty())
+        {
+            compressor->LoadDictionary(dictionaryFile.c_str());
+        }
+        return compressor;
+    }
+
+    const AZStd::string_view MultiplayerDictionaryCompressionFactory::GetFactoryName() const
+    {
+        return s_compressorName;
+    }
 }
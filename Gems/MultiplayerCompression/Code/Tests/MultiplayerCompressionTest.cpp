@@ -10,6 +10,8 @@
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <LZ4Compressor.h>
+#include <LZ4DictionaryCompressor.h>
+#include <LZ4DictionaryTrainer.h>
 
 #include <AzCore/Compression/Compression.h>
 #include <AzCore/std/chrono/chrono.h>
@@ -115,4 +117,95 @@ TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_NullTest)
     EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::Uninitialized);
 }
 
+// Builds samples that look like replication packets, a couple of fixed blocks that are only repeated across packets with a few changing bytes in between
+static AZStd::vector<MultiplayerCompression::CompressionSample> CreateReplicationSamples(uint32_t sampleCount)
+{
+    uint32_t seed = 12345;
+    auto nextByte = [&seed]()
+    {
+        seed = seed * 1103515245 + 12345;
+        return static_cast<uint8_t>(seed >> 16);
+    };
+
+    AZStd::vector<uint8_t> headerBlock(48);
+    AZStd::vector<uint8_t> componentBlock(64);
+    for (uint8_t& value : headerBlock)
+    {
+        value = nextByte();
+    }
+    for (uint8_t& value : componentBlock)
+    {
+        value = nextByte();
+    }
+
+    AZStd::vector<MultiplayerCompression::CompressionSample> samples;
+    for (uint32_t i = 0; i < sampleCount; ++i)
+    {
+        MultiplayerCompression::CompressionSample sample(headerBlock.begin(), headerBlock.end());
+        for (uint32_t j = 0; j < 4; ++j)
+        {
+            sample.push_back(nextByte());
+        }
+        sample.insert(sample.end(), componentBlock.begin(), componentBlock.end());
+        samples.push_back(AZStd::move(sample));
+    }
+    return samples;
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_DictionaryTest)
+{
+    const AZStd::vector<MultiplayerCompression::CompressionSample> samples = CreateReplicationSamples(256);
+    AZStd::vector<uint8_t> dictionary = MultiplayerCompression::TrainDictionary(samples, 1024);
+    EXPECT_FALSE(dictionary.empty());
+    EXPECT_LE(dictionary.size(), 1024);
+
+    MultiplayerCompression::LZ4Compressor lz4Compressor;
+    MultiplayerCompression::LZ4DictionaryCompressor dictionaryCompressor;
+    EXPECT_EQ(dictionaryCompressor.GetDictionaryId(), 0);
+    dictionaryCompressor.SetDictionary(AZStd::move(dictionary));
+    EXPECT_NE(dictionaryCompressor.GetDictionaryId(), 0);
+
+    const MultiplayerCompression::CompressionSample packet = CreateReplicationSamples(257).back();
+    char compressedBuffer[256];
+    char decompressedBuffer[256];
+    size_t compressedSize = 0;
+    size_t dictionaryCompressedSize = 0;
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+
+    EXPECT_EQ(lz4Compressor.Compress(packet.data(), packet.size(), compressedBuffer, sizeof(compressedBuffer), compressedSize), AzNetworking::CompressorError::Ok);
+    ASSERT_EQ(dictionaryCompressor.Compress(packet.data(), packet.size(), compressedBuffer, sizeof(compressedBuffer), dictionaryCompressedSize), AzNetworking::CompressorError::Ok);
+
+    // Without the dictionary the packet has nothing to match against
+    EXPECT_LT(dictionaryCompressedSize * 2, compressedSize);
+
+    ASSERT_EQ(dictionaryCompressor.Decompress(compressedBuffer, dictionaryCompressedSize, decompressedBuffer, sizeof(decompressedBuffer), consumedSize, uncompressedSize), AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(consumedSize, dictionaryCompressedSize);
+    ASSERT_EQ(uncompressedSize, packet.size());
+    EXPECT_EQ(memcmp(decompressedBuffer, packet.data(), packet.size()), 0);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_NoDictionaryMatchesLZ4Test)
+{
+    const MultiplayerCompression::CompressionSample packet = CreateReplicationSamples(1).back();
+    char compressedBuffer[256];
+    char decompressedBuffer[256];
+    size_t compressedSize = 0;
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+
+    MultiplayerCompression::LZ4Compressor lz4Compressor;
+    MultiplayerCompression::LZ4DictionaryCompressor dictionaryCompressor;
+    ASSERT_EQ(dictionaryCompressor.Compress(packet.data(), packet.size(), compressedBuffer, sizeof(compressedBuffer), compressedSize), AzNetworking::CompressorError::Ok);
+    ASSERT_EQ(lz4Compressor.Decompress(compressedBuffer, compressedSize, decompressedBuffer, sizeof(decompressedBuffer), consumedSize, uncompressedSize), AzNetworking::CompressorError::Ok);
+    ASSERT_EQ(uncompressedSize, packet.size());
+    EXPECT_EQ(memcmp(decompressedBuffer, packet.data(), packet.size()), 0);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_TrainWithoutRepeatsTest)
+{
+    EXPECT_TRUE(MultiplayerCompression::TrainDictionary({}, 1024).empty());
+    EXPECT_TRUE(MultiplayerCompression::TrainDictionary(CreateReplicationSamples(1), 1024).empty());
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -9,6 +9,10 @@
 set(FILES
     Source/LZ4Compressor.cpp
     Source/LZ4Compressor.h
+    Source/LZ4DictionaryCompressor.cpp
+    Source/LZ4DictionaryCompressor.h
+    Source/LZ4DictionaryTrainer.cpp
+    Source/LZ4DictionaryTrainer.h
     Source/MultiplayerCompressionFactory.cpp
     Source/MultiplayerCompressionFactory.h
     Source/MultiplayerCompressionSystemComponent.cpp
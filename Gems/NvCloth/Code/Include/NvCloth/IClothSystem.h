@@ -19,6 +19,29 @@ namespace NvCloth
     class ICloth;
     class IClothTangentSpace;
 
+    //! Amount of cloth simulated by the cloth system in a frame, compared with the budget
+    //! set by cloth_ParticleBudget.
+    struct ClothFrameBudget
+    {
+        //! Number of cloths simulated during the frame.
+        AZ::u32 m_simulatedCloths = 0;
+
+        //! Number of particles simulated during the frame.
+        AZ::u32 m_simulatedParticles = 0;
+
+        //! Number of cloths not added to any solver, which are not simulated.
+        AZ::u32 m_sleepingCloths = 0;
+
+        //! Maximum number of particles to simulate per frame. Zero means there is no limit.
+        AZ::u32 m_particleBudget = 0;
+
+        //! Returns whether more particles were simulated during the frame than the budget allows.
+        bool IsOverBudget() const
+        {
+            return m_particleBudget > 0 && m_simulatedParticles > m_particleBudget;
+        }
+    };
+
     //! Interface to the cloth system that allows to create/destroy cloths and solvers.
     //!
     //! A default solver is always present in the system.
@@ -93,5 +116,8 @@ namespace NvCloth
         //!
         //! @param cloth The cloth instance to remove from the solver.
         virtual void RemoveCloth(ICloth* cloth) = 0;
+
+        //! Returns the amount of cloth simulated by the system during the last frame.
+        virtual const ClothFrameBudget& GetLastFrameBudget() const = 0;
     };
 } // namespace NvCloth
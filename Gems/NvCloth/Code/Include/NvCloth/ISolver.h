@@ -65,6 +65,14 @@ namespace NvCloth
         //! Note: This is a blocking call that will wait for the simulation jobs to complete.
         virtual void FinishSimulation() = 0;
 
+        //! Sets how many times StartSimulation has to be called before the solver runs a simulation pass.
+        //! The delta times of the calls skipped are accumulated and simulated in the next pass.
+        //! Default value is 1, which simulates every time.
+        virtual void SetSimulationInterval(AZ::u32 interval) = 0;
+
+        //! Returns how many times StartSimulation has to be called before the solver runs a simulation pass.
+        virtual AZ::u32 GetSimulationInterval() const = 0;
+
         //! Specifies the distance (meters) that cloths' particles need to be separated from each other.
         //! Inter-collision refers to collisions between different cloth instances in the solver,
         //! do not confuse with self-collision, which is available per cloth through IClothConfigurator.
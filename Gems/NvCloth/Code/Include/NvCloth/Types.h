@@ -79,6 +79,10 @@ namespace NvCloth
     //! Name of the default solver that cloth system always creates.
     static const char* const DefaultSolverName = "DefaultClothSolver";
 
+    //! Name of the solver that cloth system always creates for cloths simulated at a lower level of detail.
+    //! It runs the simulation once every few frames (see cloth_LodSimulationInterval).
+    static const char* const LodSolverName = "LodClothSolver";
+
     //! Structure with all the data of a fabric.
     //!
     //! The fabric is a template from which cloths are created from, it contains all the necessary
@@ -8,6 +8,9 @@
 
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/PackedVector3.h>
 #include <AzCore/Math/PackedVector4.h>
 
@@ -16,6 +19,7 @@
 #include <Atom/RHI/RHIUtils.h>
 
 #include <NvCloth/IClothSystem.h>
+#include <NvCloth/ISolver.h>
 #include <NvCloth/IFabricCooker.h>
 #include <NvCloth/IClothConfigurator.h>
 #include <NvCloth/ITangentSpaceHelper.h>
@@ -26,6 +30,7 @@
 #include <Components/ClothComponentMesh/ClothDebugDisplay.h>
 #include <Components/ClothComponentMesh/ClothComponentMesh.h>
 
+#include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/WindBus.h>
 #include <AzFramework/Physics/Common/PhysicsTypes.h>
@@ -41,6 +46,27 @@ namespace NvCloth
     AZ_CVAR(float, cloth_SecondsToDelaySimulationOnActorSpawned, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null,
         "The amount of time in seconds the cloth simulation will be delayed to avoid sudden impulses when actors are spawned.");
 
+    AZ_CVAR(bool, cloth_LodEnabled, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When enabled the cloth simulation level of detail is reduced based on the distance to the active camera, the size of the cloth on screen and its visibility.");
+
+    AZ_CVAR(float, cloth_LodReducedDistance, 10.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Distance in meters from the active camera at which cloth is simulated with a reduced solver frequency.");
+
+    AZ_CVAR(float, cloth_LodLowDistance, 25.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Distance in meters from the active camera at which cloth is simulated once every few frames (see cloth_LodSimulationInterval).");
+
+    AZ_CVAR(float, cloth_LodSleepDistance, 60.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Distance in meters from the active camera at which cloth stops being simulated.");
+
+    AZ_CVAR(float, cloth_LodSleepScreenSize, 0.02f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Size of the cloth on screen, relative to half the screen height, below which cloth stops being simulated.");
+
+    AZ_CVAR(bool, cloth_LodSleepWhenNotVisible, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When enabled cloth stops being simulated while it's outside the active camera's view or its actor is not visible.");
+
+    AZ_CVAR(float, cloth_LodSolverFrequencyScale, 0.5f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Scale applied to the solver frequency of cloth simulated at a reduced level of detail.");
+
     // Helper class to map an RPI buffer from a buffer asset view.
     template<typename T>
     class MappedBuffer
@@ -200,6 +226,14 @@ namespace NvCloth
             m_cloth->GetParticles().size(),
             m_meshRemappedVertices);
         m_timeClothSkinningUpdates = 0.0f;
+        if (m_actorClothSkinning)
+        {
+            m_actorClothSkinning->UpdateActorVisibility();
+        }
+
+        // Cloth starts simulating in the default solver at full level of detail.
+        m_simulationLod = SimulationLod::Full;
+        m_framesSinceSimulation = 0;
 
         // Turn off GPU skinning for any sub-meshes simulated by the cloth component
         DisableSkinning();
@@ -259,6 +293,7 @@ namespace NvCloth
         m_motionConstraints.clear();
         m_separationConstraints.clear();
         m_clothDebugDisplay.reset();
+        m_interpolatedParticles.clear();
     }
 
     void ClothComponentMesh::OnPreSimulation(
@@ -286,6 +321,7 @@ namespace NvCloth
 
         // Next buffer index of the render data
         m_renderDataBufferIndex = (m_renderDataBufferIndex + 1) % RenderDataBufferSize;
+        m_framesSinceSimulation = 0;
 
         UpdateRenderData(updatedParticles);
     }
@@ -308,7 +344,15 @@ namespace NvCloth
 
     void ClothComponentMesh::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
-        CopyRenderDataToModel();
+        SetSimulationLod(CalculateSimulationLod());
+
+        // While sleeping the render data doesn't change, so it only needs to be copied once.
+        if (m_simulationLod != SimulationLod::Sleeping || m_framesSinceSimulation == 0)
+        {
+            CopyRenderDataToModel();
+        }
+
+        ++m_framesSinceSimulation;
     }
 
     int ClothComponentMesh::GetTickOrder()
@@ -337,6 +381,11 @@ namespace NvCloth
         return m_renderDataBuffer[m_renderDataBufferIndex];
     }
 
+    ClothComponentMesh::SimulationLod ClothComponentMesh::GetSimulationLod() const
+    {
+        return m_simulationLod;
+    }
+
     void ClothComponentMesh::UpdateSimulationCollisions()
     {
         if (m_actorClothColliders)
@@ -420,14 +469,23 @@ namespace NvCloth
 
         auto& renderData = GetRenderData();
 
+        // The skinning of the non-simulated part of the mesh doesn't depend on the simulation results,
+        // so it runs in parallel with the normals calculation of the simulated part. Both write to
+        // different vertices of the render data.
+        AZ::JobCompletion skinningCompletion;
         if (m_actorClothSkinning)
         {
-            // Apply skinning to the non-simulated part of the mesh.
-            m_actorClothSkinning->ApplySkinningOnNonSimulatedVertices(m_meshClothInfo, renderData);
+            AZ::Job* skinningJob = AZ::CreateJobFunction([this, &renderData]()
+                {
+                    // Apply skinning to the non-simulated part of the mesh.
+                    m_actorClothSkinning->ApplySkinningOnNonSimulatedVertices(m_meshClothInfo, renderData);
+                }, true /*isAutoDelete*/);
+            skinningJob->SetDependent(&skinningCompletion);
+            skinningJob->Start();
         }
 
         // Calculate normals of the cloth particles (simplified mesh).
-        AZStd::vector<AZ::Vector3> normals;
+        AZStd::vector<AZ::Vector3>& normals = m_simulatedNormals;
         [[maybe_unused]] bool normalsCalculated =
             AZ::Interface<ITangentSpaceHelper>::Get()->CalculateNormals(particles, m_cloth->GetInitialIndices(), normals);
         AZ_Assert(normalsCalculated, "Cloth component mesh failed to calculate normals.");
@@ -453,6 +511,9 @@ namespace NvCloth
             }
         }
 
+        // The full mesh needs to be skinned before calculating its tangents and bitangents.
+        skinningCompletion.StartAndWaitForCompletion();
+
         // Calculate tangents and bitangents for the full mesh.
         [[maybe_unused]] bool tangentsAndBitangentsCalculated =
             AZ::Interface<ITangentSpaceHelper>::Get()->CalculateTangentsAndBitagents(
@@ -476,7 +537,10 @@ namespace NvCloth
             ? m_renderDataBuffer[previousBufferIndex]
             : m_renderDataBuffer[m_renderDataBufferIndex];
 
-        const auto& renderParticles = renderData.m_particles;
+        // Cloths not simulated every frame interpolate between their last two simulation passes.
+        const auto& renderParticles = (isDebugDrawEnabled)
+            ? renderData.m_particles
+            : InterpolateRenderParticles(m_renderDataBuffer[previousBufferIndex], renderData);
         const auto& renderNormals = renderData.m_normals;
         const auto& renderTangents = renderData.m_tangents;
         const auto& renderBitangents = renderData.m_bitangents;
@@ -671,6 +735,13 @@ namespace NvCloth
             return false;
         }
 
+        // Radius around the entity's position that contains the cloth, used to choose the simulation level of detail.
+        m_localBoundingRadius = 0.0f;
+        for (const SimParticleFormat& particle : meshSimplifiedParticles)
+        {
+            m_localBoundingRadius = AZ::GetMax(m_localBoundingRadius, particle.GetAsVector3().GetLength());
+        }
+
         // Set initial Position and Rotation
         AZ::Transform transform = AZ::Transform::CreateIdentity();
         AZ::TransformBus::EventResult(transform, m_entityId, &AZ::TransformInterface::GetWorldTM);
@@ -756,7 +827,7 @@ namespace NvCloth
         clothConfig->SetTetherConstraintScale(m_config.m_tetherConstraintScale);
 
         // Quality parameters
-        clothConfig->SetSolverFrequency(m_config.m_solverFrequency);
+        clothConfig->SetSolverFrequency(GetSolverFrequency());
         clothConfig->SetAcceleationFilterWidth(m_config.m_accelerationFilterIterations);
 
         // Fabric Phases
@@ -785,6 +856,7 @@ namespace NvCloth
     void ClothComponentMesh::MoveCloth(const AZ::Transform& worldTransform)
     {
         m_worldPosition = worldTransform.GetTranslation();
+        m_worldBoundingRadius = m_localBoundingRadius * worldTransform.GetUniformScale();
 
         m_cloth->GetClothConfigurator()->SetTransform(worldTransform);
 
@@ -803,6 +875,151 @@ namespace NvCloth
         m_cloth->GetClothConfigurator()->ClearInertia();
     }
 
+    ClothComponentMesh::SimulationLod ClothComponentMesh::CalculateSimulationLod()
+    {
+        if (!cloth_LodEnabled || !Camera::ActiveCameraRequestBus::HasHandlers())
+        {
+            return SimulationLod::Full;
+        }
+
+        if (cloth_LodSleepWhenNotVisible && m_actorClothSkinning)
+        {
+            // Actor visibility is updated before every simulation pass,
+            // while sleeping there are no simulation passes so it's updated here.
+            if (m_simulationLod == SimulationLod::Sleeping)
+            {
+                m_actorClothSkinning->UpdateActorVisibility();
+            }
+            if (!m_actorClothSkinning->IsActorVisible())
+            {
+                return SimulationLod::Sleeping;
+            }
+        }
+
+        AZ::Transform cameraTransform = AZ::Transform::CreateIdentity();
+        Camera::ActiveCameraRequestBus::BroadcastResult(cameraTransform, &Camera::ActiveCameraRequestBus::Events::GetActiveCameraTransform);
+        Camera::Configuration cameraConfiguration;
+        Camera::ActiveCameraRequestBus::BroadcastResult(cameraConfiguration, &Camera::ActiveCameraRequestBus::Events::GetActiveCameraConfiguration);
+
+        const AZ::Vector3 cameraToCloth = m_worldPosition - cameraTransform.GetTranslation();
+        const float distance = cameraToCloth.GetLength();
+        if (distance >= cloth_LodSleepDistance)
+        {
+            return SimulationLod::Sleeping;
+        }
+
+        // Screen size and visibility are only known when the camera has a field of view and the camera is outside the cloth.
+        if (cameraConfiguration.m_fovRadians > 0.0f && distance > m_worldBoundingRadius)
+        {
+            const float tanHalfFov = AZStd::tan(cameraConfiguration.m_fovRadians * 0.5f);
+
+            const float screenSize = m_worldBoundingRadius / (distance * tanHalfFov);
+            if (screenSize < cloth_LodSleepScreenSize)
+            {
+                return SimulationLod::Sleeping;
+            }
+
+            if (cloth_LodSleepWhenNotVisible)
+            {
+                // Conservative test of the cloth's bounding sphere against the cone that contains the camera frustum.
+                const float aspectRatio = (cameraConfiguration.m_frustumHeight > 0.0f)
+                    ? cameraConfiguration.m_frustumWidth / cameraConfiguration.m_frustumHeight
+                    : 1.0f;
+                const float tanHalfConeAngle = tanHalfFov * AZStd::sqrt(1.0f + aspectRatio * aspectRatio);
+                const float cosHalfConeAngle = 1.0f / AZStd::sqrt(1.0f + tanHalfConeAngle * tanHalfConeAngle);
+                const float sinHalfConeAngle = tanHalfConeAngle * cosHalfConeAngle;
+
+                const float depth = cameraToCloth.Dot(cameraTransform.GetBasisY());
+                const float lateralDistance = AZStd::sqrt(AZ::GetMax(distance * distance - depth * depth, 0.0f));
+                if (lateralDistance * cosHalfConeAngle - depth * sinHalfConeAngle > m_worldBoundingRadius)
+                {
+                    return SimulationLod::Sleeping;
+                }
+            }
+        }
+
+        if (distance >= cloth_LodLowDistance)
+        {
+            return SimulationLod::Low;
+        }
+        if (distance >= cloth_LodReducedDistance)
+        {
+            return SimulationLod::Reduced;
+        }
+        return SimulationLod::Full;
+    }
+
+    void ClothComponentMesh::SetSimulationLod(SimulationLod simulationLod)
+    {
+        if (m_simulationLod == simulationLod)
+        {
+            return;
+        }
+
+        const SimulationLod previousSimulationLod = m_simulationLod;
+        m_simulationLod = simulationLod;
+        m_framesSinceSimulation = 0;
+
+        if (m_simulationLod == SimulationLod::Sleeping)
+        {
+            AZ::Interface<IClothSystem>::Get()->RemoveCloth(m_cloth);
+            return;
+        }
+
+        m_cloth->GetClothConfigurator()->SetSolverFrequency(GetSolverFrequency());
+
+        // Adding the cloth to a solver removes it from the previous one.
+        AZ::Interface<IClothSystem>::Get()->AddCloth(m_cloth,
+            (m_simulationLod == SimulationLod::Low) ? LodSolverName : DefaultSolverName);
+
+        if (previousSimulationLod == SimulationLod::Sleeping)
+        {
+            // The entity and its actor might have moved considerably while the cloth was sleeping,
+            // teleport the cloth and override its simulation with skinning for a short amount of time
+            // to avoid sudden impulses.
+            AZ::Transform transform = AZ::Transform::CreateIdentity();
+            AZ::TransformBus::EventResult(transform, m_entityId, &AZ::TransformInterface::GetWorldTM);
+            TeleportCloth(transform);
+
+            m_timeClothSkinningUpdates = 0.0f;
+        }
+    }
+
+    float ClothComponentMesh::GetSolverFrequency() const
+    {
+        return (m_simulationLod == SimulationLod::Full)
+            ? m_config.m_solverFrequency
+            : m_config.m_solverFrequency * cloth_LodSolverFrequencyScale;
+    }
+
+    const AZStd::vector<SimParticleFormat>& ClothComponentMesh::InterpolateRenderParticles(
+        const RenderData& previousRenderData, const RenderData& renderData)
+    {
+        if (m_simulationLod != SimulationLod::Low)
+        {
+            return renderData.m_particles;
+        }
+
+        const ISolver* lodSolver = AZ::Interface<IClothSystem>::Get()->GetSolver(LodSolverName);
+        const AZ::u32 simulationInterval = lodSolver ? lodSolver->GetSimulationInterval() : 1;
+        if (m_framesSinceSimulation + 1 >= simulationInterval ||
+            previousRenderData.m_particles.size() != renderData.m_particles.size())
+        {
+            return renderData.m_particles;
+        }
+
+        // Rendering is one simulation pass behind, so it moves from the previous simulation pass
+        // to the last one by the time the next one is done.
+        const float t = aznumeric_cast<float>(m_framesSinceSimulation + 1) / aznumeric_cast<float>(simulationInterval);
+
+        m_interpolatedParticles.resize(renderData.m_particles.size());
+        for (size_t index = 0; index < renderData.m_particles.size(); ++index)
+        {
+            m_interpolatedParticles[index] = previousRenderData.m_particles[index].Lerp(renderData.m_particles[index], t);
+        }
+        return m_interpolatedParticles;
+    }
+
     AZ::Vector3 ClothComponentMesh::GetWindBusVelocity()
     {
         const Physics::WindRequests* windRequests = AZ::Interface<Physics::WindRequests>::Get();
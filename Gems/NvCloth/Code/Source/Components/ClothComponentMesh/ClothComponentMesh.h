@@ -52,9 +52,22 @@ namespace NvCloth
             AZStd::vector<AZ::Vector3> m_normals;
         };
 
+        // Level of detail of the cloth simulation.
+        // It's chosen every frame from the distance to the active camera,
+        // the size of the cloth on screen and its visibility.
+        enum class SimulationLod
+        {
+            Full,       // Simulated every frame at the configured solver frequency.
+            Reduced,    // Simulated every frame at a reduced solver frequency.
+            Low,        // Simulated once every few frames at a reduced solver frequency, rendering is interpolated in between.
+            Sleeping    // Not simulated.
+        };
+
         const RenderData& GetRenderData() const;
         RenderData& GetRenderData();
 
+        SimulationLod GetSimulationLod() const;
+
         void UpdateConfiguration(AZ::EntityId entityId, const ClothConfiguration& config);
 
         void CopyRenderDataToModel();
@@ -85,6 +98,12 @@ namespace NvCloth
         void UpdateSimulationConstraints();
         void UpdateRenderData(const AZStd::vector<SimParticleFormat>& particles);
 
+        SimulationLod CalculateSimulationLod();
+        void SetSimulationLod(SimulationLod simulationLod);
+        float GetSolverFrequency() const;
+        const AZStd::vector<SimParticleFormat>& InterpolateRenderParticles(
+            const RenderData& previousRenderData, const RenderData& renderData);
+
         bool CreateCloth();
         void ApplyConfigurationToCloth();
         void MoveCloth(const AZ::Transform& worldTransform);
@@ -101,6 +120,10 @@ namespace NvCloth
         // Current position in world space
         AZ::Vector3 m_worldPosition;
 
+        // Radius of the sphere around the entity's position that contains the cloth, in local and world space.
+        float m_localBoundingRadius = 0.0f;
+        float m_worldBoundingRadius = 0.0f;
+
         // Configuration parameters for cloth simulation
         ClothConfiguration m_config;
 
@@ -117,6 +140,19 @@ namespace NvCloth
         AZ::u32 m_renderDataBufferIndex = 0;
         AZStd::array<RenderData, RenderDataBufferSize> m_renderDataBuffer;
 
+        // Normals of the simulated particles, kept to avoid allocating them every simulation pass.
+        AZStd::vector<AZ::Vector3> m_simulatedNormals;
+
+        // Current level of detail of the simulation.
+        SimulationLod m_simulationLod = SimulationLod::Full;
+
+        // Frames rendered since the last simulation pass or change of level of detail.
+        AZ::u32 m_framesSinceSimulation = 0;
+
+        // Particles interpolated between the last two simulation passes,
+        // used to render cloths that are not simulated every frame.
+        AZStd::vector<SimParticleFormat> m_interpolatedParticles;
+
         // Vertex mapping between full mesh and simplified mesh used in cloth simulation.
         // Negative elements means the vertex has been removed.
         AZStd::vector<int> m_meshRemappedVertices;
@@ -10,6 +10,7 @@
 #include <System/Cloth.h>
 
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/MathUtils.h>
 
 // NvCloth library includes
 #include <NvCloth/Solver.h>
@@ -76,6 +77,21 @@ namespace NvCloth
         return m_cloths.size();
     }
 
+    size_t Solver::GetNumParticles() const
+    {
+        size_t numParticles = 0;
+        for (const Cloth* cloth : m_cloths)
+        {
+            numParticles += cloth->GetParticles().size();
+        }
+        return numParticles;
+    }
+
+    bool Solver::IsSimulating() const
+    {
+        return m_isSimulating;
+    }
+
     const AZStd::string& Solver::GetName() const
     {
         return m_name;
@@ -110,12 +126,21 @@ namespace NvCloth
 
         AZ_Assert(!m_isSimulating, "Please make sure the ongoing simulation is finished before attempting to start a new one");
 
+        // Accumulate the delta time until it's time for the next simulation pass.
+        m_skippedDeltaTime += deltaTime;
+        if (++m_skippedSimulations < m_simulationInterval)
+        {
+            return;
+        }
+
         AZ_PROFILE_FUNCTION(Cloth);
 
-        m_deltaTime = deltaTime;
+        m_deltaTime = m_skippedDeltaTime;
+        m_skippedDeltaTime = 0.0f;
+        m_skippedSimulations = 0;
         m_simulationCompletion.Reset(true /*isClearDependent*/);
 
-        m_preSimulationEvent.Signal(m_name, deltaTime);
+        m_preSimulationEvent.Signal(m_name, m_deltaTime);
 
         // Set isSimulating flag after the pre-simulation event is sent in case if there are handlers adding/removing cloth from the solver.
         m_isSimulating = true;
@@ -156,6 +181,16 @@ namespace NvCloth
         m_postSimulationEvent.Signal(m_name, m_deltaTime);
     }
 
+    void Solver::SetSimulationInterval(AZ::u32 interval)
+    {
+        m_simulationInterval = AZ::GetMax(interval, 1u);
+    }
+
+    AZ::u32 Solver::GetSimulationInterval() const
+    {
+        return m_simulationInterval;
+    }
+
     void Solver::SetInterCollisionDistance(float distance)
     {
         m_nvSolver->setInterCollisionDistance(distance);
@@ -37,6 +37,10 @@ namespace NvCloth
         void AddCloth(Cloth* cloth);
         void RemoveCloth(Cloth* cloth);
         size_t GetNumCloths() const;
+        size_t GetNumParticles() const;
+
+        //! Returns true between the StartSimulation and FinishSimulation calls of a simulation pass.
+        bool IsSimulating() const;
 
         // ISolver overrides ...
         const AZStd::string& GetName() const override;
@@ -46,6 +50,8 @@ namespace NvCloth
         bool IsUserSimulated() const override;
         void StartSimulation(float deltaTime) override;
         void FinishSimulation() override;
+        void SetSimulationInterval(AZ::u32 interval) override;
+        AZ::u32 GetSimulationInterval() const override;
         void SetInterCollisionDistance(float distance) override;
         void SetInterCollisionStiffness(float stiffness) override;
         void SetInterCollisionIterations(AZ::u32 iterations) override;
@@ -139,6 +145,13 @@ namespace NvCloth
         // Stored delta time during the simulation.
         float m_deltaTime = 0.0f;
 
+        // Number of StartSimulation calls per simulation pass.
+        AZ::u32 m_simulationInterval = 1;
+
+        // StartSimulation calls skipped since the last simulation pass and their accumulated delta time.
+        AZ::u32 m_skippedSimulations = 0;
+        float m_skippedDeltaTime = 0.0f;
+
         // Flag indicating if the simulation jobs are currently running.
         bool m_isSimulating = false;
 
@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -22,6 +23,12 @@
 
 namespace NvCloth
 {
+    AZ_CVAR(AZ::u32, cloth_ParticleBudget, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Maximum number of cloth particles to simulate per frame, used to report when the cloth simulation is over budget. 0 means there is no limit.");
+
+    AZ_CVAR(AZ::u32, cloth_LodSimulationInterval, 3, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of frames between simulation passes of the cloths simulated at a lower level of detail.");
+
     namespace
     {
         // Implementation of the memory allocation callback interface using nvcloth allocator.
@@ -394,20 +401,55 @@ namespace NvCloth
         }
     }
 
+    const ClothFrameBudget& SystemComponent::GetLastFrameBudget() const
+    {
+        return m_lastFrameBudget;
+    }
+
     void SystemComponent::OnTick(
         float deltaTime,
         [[maybe_unused]] AZ::ScriptTimePoint time)
     {
         AZ_PROFILE_FUNCTION(Cloth);
 
+        ClothFrameBudget frameBudget;
+        frameBudget.m_particleBudget = cloth_ParticleBudget;
+
         for (auto& solverIt : m_solvers)
         {
+            if (solverIt->GetName() == LodSolverName)
+            {
+                solverIt->SetSimulationInterval(cloth_LodSimulationInterval);
+            }
+
             if (!solverIt->IsUserSimulated())
             {
                 solverIt->StartSimulation(deltaTime);
+
+                // The solver doesn't simulate when it's disabled, empty or waiting for its next simulation interval.
+                if (solverIt->IsSimulating())
+                {
+                    frameBudget.m_simulatedCloths += aznumeric_cast<AZ::u32>(solverIt->GetNumCloths());
+                    frameBudget.m_simulatedParticles += aznumeric_cast<AZ::u32>(solverIt->GetNumParticles());
+                }
+
                 solverIt->FinishSimulation();
             }
         }
+
+        for (const auto& clothIt : m_cloths)
+        {
+            if (!clothIt.second->GetSolver())
+            {
+                ++frameBudget.m_sleepingCloths;
+            }
+        }
+
+        m_lastFrameBudget = frameBudget;
+
+        AZ_WarningOnce("Cloth", !m_lastFrameBudget.IsOverBudget(),
+            "Cloth simulation is over budget: %u particles simulated in a frame, budget is %u (cloth_ParticleBudget).",
+            m_lastFrameBudget.m_simulatedParticles, m_lastFrameBudget.m_particleBudget);
     }
 
     int SystemComponent::GetTickOrder()
@@ -425,6 +467,10 @@ namespace NvCloth
         [[maybe_unused]] ISolver* solver = FindOrCreateSolver(DefaultSolverName);
         AZ_Assert(solver, "Error: Default solver failed to be created");
 
+        // Create solver for cloths simulated at a lower level of detail
+        [[maybe_unused]] ISolver* lodSolver = FindOrCreateSolver(LodSolverName);
+        AZ_Assert(lodSolver, "Error: Lod solver failed to be created");
+
         AZ::Interface<IClothSystem>::Register(this);
         AZ::TickBus::Handler::BusConnect();
     }
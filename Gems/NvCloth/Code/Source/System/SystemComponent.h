@@ -66,6 +66,7 @@ namespace NvCloth
         ICloth* GetCloth(ClothId clothId) override;
         bool AddCloth(ICloth* cloth, const AZStd::string& solverName = DefaultSolverName) override;
         void RemoveCloth(ICloth* cloth) override;
+        const ClothFrameBudget& GetLastFrameBudget() const override;
 
         // AZ::TickBus::Handler overrides ...
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
@@ -89,5 +90,8 @@ namespace NvCloth
 
         // List of all the cloths created.
         AZStd::unordered_map<ClothId, AZStd::unique_ptr<Cloth>> m_cloths;
+
+        // Amount of cloth simulated during the last frame.
+        ClothFrameBudget m_lastFrameBudget;
     };
 } // namespace NvCloth
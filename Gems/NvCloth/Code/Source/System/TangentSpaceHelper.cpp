@@ -8,13 +8,74 @@
 
 #include <System/TangentSpaceHelper.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 
 namespace NvCloth
 {
+    AZ_CVAR(AZ::u32, cloth_TangentSpaceJobMinVertices, 4096, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Minimum number of vertices of a mesh to calculate its normals, tangents and bitangents with parallel jobs.");
+
+    AZ_CVAR(AZ::u32, cloth_TangentSpaceJobCount, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of parallel jobs used to calculate the normals, tangents and bitangents of large meshes.");
+
     namespace
     {
         const float Tolerance = 1e-7f;
+
+        // Returns the number of jobs to split the tangent space calculation of a mesh into.
+        size_t GetJobCount(size_t vertexCount)
+        {
+            if (vertexCount < cloth_TangentSpaceJobMinVertices || !AZ::JobContext::GetGlobalContext())
+            {
+                return 1;
+            }
+            return AZStd::max<size_t>(cloth_TangentSpaceJobCount, 1);
+        }
+
+        // Splits the range [0, count) in jobCount chunks and calls function(chunkIndex, begin, end) for each one,
+        // running them in parallel jobs. It returns when all the chunks are done.
+        template<typename Function>
+        void ParallelForChunks(size_t count, size_t jobCount, const Function& function)
+        {
+            if (jobCount <= 1)
+            {
+                function(0, 0, count);
+                return;
+            }
+
+            AZ::JobCompletion jobCompletion;
+            const size_t chunkSize = (count + jobCount - 1) / jobCount;
+            for (size_t chunkIndex = 0; chunkIndex < jobCount; ++chunkIndex)
+            {
+                const size_t begin = chunkIndex * chunkSize;
+                const size_t end = AZStd::min(begin + chunkSize, count);
+                if (begin >= end)
+                {
+                    break;
+                }
+
+                AZ::Job* job = AZ::CreateJobFunction([&function, chunkIndex, begin, end]()
+                    {
+                        AZ_PROFILE_SCOPE(Cloth, "NvCloth::TangentSpaceChunkJob");
+                        function(chunkIndex, begin, end);
+                    }, true /*isAutoDelete*/);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+
+        // Each job accumulates the contributions of its triangles in its own buffer, the first job
+        // uses the output directly. Returns the buffers of the rest of jobs, zero initialized.
+        AZStd::vector<AZStd::vector<AZ::Vector3>> CreateJobAccumulationBuffers(size_t jobCount, size_t vertexCount)
+        {
+            return AZStd::vector<AZStd::vector<AZ::Vector3>>(
+                jobCount - 1, AZStd::vector<AZ::Vector3>(vertexCount, AZ::Vector3::CreateZero()));
+        }
     }
 
     bool TangentSpaceHelper::CalculateNormals(
@@ -39,43 +100,61 @@ namespace NvCloth
         outNormals.resize(vertexCount);
         AZStd::fill(outNormals.begin(), outNormals.end(), AZ::Vector3::CreateZero());
 
+        const size_t jobCount = GetJobCount(vertexCount);
+        AZStd::vector<AZStd::vector<AZ::Vector3>> jobNormals = CreateJobAccumulationBuffers(jobCount, vertexCount);
+
         // calculate the normals per triangle
-        for (size_t i = 0; i < triangleCount; ++i)
-        {
-            TriangleIndices triangleIndices;
-            TrianglePositions trianglePositions;
-            TriangleEdges triangleEdges;
-            GetTriangleData(
-                i, indices, vertices,
-                triangleIndices, trianglePositions, triangleEdges);
+        ParallelForChunks(triangleCount, jobCount,
+            [&](size_t chunkIndex, size_t beginTriangle, size_t endTriangle)
+            {
+                AZStd::vector<AZ::Vector3>& normals = (chunkIndex == 0) ? outNormals : jobNormals[chunkIndex - 1];
 
-            AZ::Vector3 normal;
-            ComputeNormal(triangleEdges, normal);
+                for (size_t i = beginTriangle; i < endTriangle; ++i)
+                {
+                    TriangleIndices triangleIndices;
+                    TrianglePositions trianglePositions;
+                    TriangleEdges triangleEdges;
+                    GetTriangleData(
+                        i, indices, vertices,
+                        triangleIndices, trianglePositions, triangleEdges);
 
-            // distribute the normals to the vertices.
-            for (AZ::u32 vertexIndexInTriangle = 0; vertexIndexInTriangle < 3; ++vertexIndexInTriangle)
-            {
-                const float weight = GetVertexWeightInTriangle(vertexIndexInTriangle, trianglePositions);
+                    AZ::Vector3 normal;
+                    ComputeNormal(triangleEdges, normal);
 
-                const SimIndexType vertexIndex = triangleIndices[vertexIndexInTriangle];
+                    // distribute the normals to the vertices.
+                    for (AZ::u32 vertexIndexInTriangle = 0; vertexIndexInTriangle < 3; ++vertexIndexInTriangle)
+                    {
+                        const float weight = GetVertexWeightInTriangle(vertexIndexInTriangle, trianglePositions);
 
-                outNormals[vertexIndex] += normal * AZStd::max(weight, Tolerance);
-            }
-        }
+                        const SimIndexType vertexIndex = triangleIndices[vertexIndexInTriangle];
 
-        // adjust the normals per vertex
-        for (auto& outNormal : outNormals)
-        {
-            outNormal.NormalizeSafe(Tolerance);
+                        normals[vertexIndex] += normal * AZStd::max(weight, Tolerance);
+                    }
+                }
+            });
 
-            // Safety check for situations where simulation gets out of control.
-            // Particles' positions can have huge floating point values that
-            // could lead to non-finite numbers when calculating tangent spaces.
-            if (!outNormal.IsFinite())
+        // adjust the normals per vertex
+        ParallelForChunks(vertexCount, jobCount,
+            [&]([[maybe_unused]] size_t chunkIndex, size_t beginVertex, size_t endVertex)
             {
-                outNormal = AZ::Vector3::CreateAxisZ();
-            }
-        }
+                for (size_t i = beginVertex; i < endVertex; ++i)
+                {
+                    for (const auto& normals : jobNormals)
+                    {
+                        outNormals[i] += normals[i];
+                    }
+
+                    outNormals[i].NormalizeSafe(Tolerance);
+
+                    // Safety check for situations where simulation gets out of control.
+                    // Particles' positions can have huge floating point values that
+                    // could lead to non-finite numbers when calculating tangent spaces.
+                    if (!outNormals[i].IsFinite())
+                    {
+                        outNormals[i] = AZ::Vector3::CreateAxisZ();
+                    }
+                }
+            });
 
         return true;
     }
@@ -123,47 +202,68 @@ namespace NvCloth
         AZStd::fill(outTangents.begin(), outTangents.end(), AZ::Vector3::CreateZero());
         AZStd::fill(outBitangents.begin(), outBitangents.end(), AZ::Vector3::CreateZero());
 
-        // calculate the base vectors per triangle
-        for (size_t i = 0; i < triangleCount; ++i)
-        {
-            TriangleIndices triangleIndices;
-            TrianglePositions trianglePositions;
-            TriangleEdges triangleEdges;
-            TriangleUVs triangleUVs;
-            GetTriangleData(
-                i, indices, vertices, uvs,
-                triangleIndices, trianglePositions, triangleEdges, triangleUVs);
-
-            AZ::Vector3 tangent, bitangent;
-            ComputeTangentAndBitangent(triangleUVs, triangleEdges, tangent, bitangent);
+        const size_t jobCount = GetJobCount(vertexCount);
+        AZStd::vector<AZStd::vector<AZ::Vector3>> jobTangents = CreateJobAccumulationBuffers(jobCount, vertexCount);
+        AZStd::vector<AZStd::vector<AZ::Vector3>> jobBitangents = CreateJobAccumulationBuffers(jobCount, vertexCount);
 
-            // distribute the uv vectors to the vertices.
-            for (AZ::u32 vertexIndexInTriangle = 0; vertexIndexInTriangle < 3; ++vertexIndexInTriangle)
+        // calculate the base vectors per triangle
+        ParallelForChunks(triangleCount, jobCount,
+            [&](size_t chunkIndex, size_t beginTriangle, size_t endTriangle)
             {
-                const float weight = GetVertexWeightInTriangle(vertexIndexInTriangle, trianglePositions);
-
-                const SimIndexType vertexIndex = triangleIndices[vertexIndexInTriangle];
-
-                outTangents[vertexIndex] += tangent * weight;
-                outBitangents[vertexIndex] += bitangent * weight;
-            }
-        }
+                AZStd::vector<AZ::Vector3>& tangents = (chunkIndex == 0) ? outTangents : jobTangents[chunkIndex - 1];
+                AZStd::vector<AZ::Vector3>& bitangents = (chunkIndex == 0) ? outBitangents : jobBitangents[chunkIndex - 1];
+
+                for (size_t i = beginTriangle; i < endTriangle; ++i)
+                {
+                    TriangleIndices triangleIndices;
+                    TrianglePositions trianglePositions;
+                    TriangleEdges triangleEdges;
+                    TriangleUVs triangleUVs;
+                    GetTriangleData(
+                        i, indices, vertices, uvs,
+                        triangleIndices, trianglePositions, triangleEdges, triangleUVs);
+
+                    AZ::Vector3 tangent, bitangent;
+                    ComputeTangentAndBitangent(triangleUVs, triangleEdges, tangent, bitangent);
+
+                    // distribute the uv vectors to the vertices.
+                    for (AZ::u32 vertexIndexInTriangle = 0; vertexIndexInTriangle < 3; ++vertexIndexInTriangle)
+                    {
+                        const float weight = GetVertexWeightInTriangle(vertexIndexInTriangle, trianglePositions);
+
+                        const SimIndexType vertexIndex = triangleIndices[vertexIndexInTriangle];
+
+                        tangents[vertexIndex] += tangent * weight;
+                        bitangents[vertexIndex] += bitangent * weight;
+                    }
+                }
+            });
 
         // adjust the base vectors per vertex
-        for (size_t i = 0; i < vertexCount; ++i)
-        {
-            AdjustTangentAndBitangent(normals[i], outTangents[i], outBitangents[i]);
-
-            // Safety check for situations where simulation gets out of control.
-            // Particles' positions can have huge floating point values that
-            // could lead to non-finite numbers when calculating tangent spaces.
-            if (!outTangents[i].IsFinite() ||
-                !outBitangents[i].IsFinite())
+        ParallelForChunks(vertexCount, jobCount,
+            [&]([[maybe_unused]] size_t chunkIndex, size_t beginVertex, size_t endVertex)
             {
-                outTangents[i] = AZ::Vector3::CreateAxisX();
-                outBitangents[i] = AZ::Vector3::CreateAxisY();
-            }
-        }
+                for (size_t i = beginVertex; i < endVertex; ++i)
+                {
+                    for (size_t jobIndex = 0; jobIndex < jobTangents.size(); ++jobIndex)
+                    {
+                        outTangents[i] += jobTangents[jobIndex][i];
+                        outBitangents[i] += jobBitangents[jobIndex][i];
+                    }
+
+                    AdjustTangentAndBitangent(normals[i], outTangents[i], outBitangents[i]);
+
+                    // Safety check for situations where simulation gets out of control.
+                    // Particles' positions can have huge floating point values that
+                    // could lead to non-finite numbers when calculating tangent spaces.
+                    if (!outTangents[i].IsFinite() ||
+                        !outBitangents[i].IsFinite())
+                    {
+                        outTangents[i] = AZ::Vector3::CreateAxisX();
+                        outBitangents[i] = AZ::Vector3::CreateAxisY();
+                    }
+                }
+            });
 
         return true;
     }
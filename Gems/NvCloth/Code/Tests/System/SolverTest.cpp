@@ -274,6 +274,36 @@ namespace UnitTest
         m_solver->FinishSimulation();
     }
 
+    TEST_F(NvClothSystemSolver, Solver_SimulationInterval_SimulatesOnceEveryIntervalWithAccumulatedDeltaTime)
+    {
+        const float deltaTimeSim = 1.0f / 60.0f;
+        const AZ::u32 simulationInterval = 3;
+
+        AZ::u32 numSimulations = 0;
+        NvCloth::ISolver::PostSimulationEvent::Handler solverPostSimulationEventHandler(
+            [&numSimulations, deltaTimeSim, simulationInterval](const AZStd::string&, float deltaTime)
+            {
+                EXPECT_NEAR(deltaTimeSim * simulationInterval, deltaTime, Tolerance);
+                ++numSimulations;
+            });
+
+        m_solver->ConnectPostSimulationEventHandler(solverPostSimulationEventHandler);
+
+        m_solver->AddCloth(m_cloth.get()); // Solver needs at least one cloth to simulate
+
+        m_solver->SetSimulationInterval(simulationInterval);
+        EXPECT_EQ(m_solver->GetSimulationInterval(), simulationInterval);
+
+        for (AZ::u32 i = 0; i < simulationInterval * 2; ++i)
+        {
+            m_solver->StartSimulation(deltaTimeSim);
+            EXPECT_EQ(m_solver->IsSimulating(), (i + 1) % simulationInterval == 0);
+            m_solver->FinishSimulation();
+        }
+
+        EXPECT_EQ(numSimulations, 2u);
+    }
+
     TEST_F(NvClothSystemSolver, Solver_StartAndFinishSimulation_SignalsClothSimulationEvents)
     {
         const float deltaTimeSim = 1.0f / 60.0f;
@@ -446,6 +446,37 @@ namespace UnitTest
         EXPECT_THAT(bitangents, ::testing::Each(IsCloseTolerance(AZ::Vector3::CreateAxisY(), Tolerance)));
     }
 
+    // Large meshes calculate their tangent space with parallel jobs (see cloth_TangentSpaceJobMinVertices).
+    TEST(NvClothSystem, TangentSpaceHelper_CalculateNormalsTangentsAndBitangentsLargePlaneXY_ReturnsCorrectTangentSpace)
+    {
+        const float width = 10.0f;
+        const float height = 10.0f;
+        const AZ::u32 segmentsX = 100;
+        const AZ::u32 segmentsY = 100;
+
+        const TriangleInput planeXY = CreatePlane(width, height, segmentsX, segmentsY);
+        const size_t numVertices = planeXY.m_vertices.size();
+
+        AZStd::vector<AZ::Vector3> normals;
+        bool normalsCalculated = AZ::Interface<NvCloth::ITangentSpaceHelper>::Get()->CalculateNormals(
+            planeXY.m_vertices, planeXY.m_indices, normals);
+
+        AZStd::vector<AZ::Vector3> tangents;
+        AZStd::vector<AZ::Vector3> bitangents;
+        bool tangentsCalculated = AZ::Interface<NvCloth::ITangentSpaceHelper>::Get()->CalculateTangentsAndBitagents(
+            planeXY.m_vertices, planeXY.m_indices, planeXY.m_uvs, normals,
+            tangents, bitangents);
+
+        EXPECT_TRUE(normalsCalculated);
+        EXPECT_TRUE(tangentsCalculated);
+        EXPECT_EQ(normals.size(), numVertices);
+        EXPECT_EQ(tangents.size(), numVertices);
+        EXPECT_EQ(bitangents.size(), numVertices);
+        EXPECT_THAT(normals, ::testing::Each(IsCloseTolerance(AZ::Vector3::CreateAxisZ(), Tolerance)));
+        EXPECT_THAT(tangents, ::testing::Each(IsCloseTolerance(AZ::Vector3::CreateAxisX(), Tolerance)));
+        EXPECT_THAT(bitangents, ::testing::Each(IsCloseTolerance(AZ::Vector3::CreateAxisY(), Tolerance)));
+    }
+
     TEST(NvClothSystem, TangentSpaceHelper_CalculateTangentSpacePlaneXY_ReturnsCorrectTangentSpace)
     {
         const float width = 1.0f;
@@ -13,6 +13,7 @@
 #include <PhysX/MathConversion.h>
 #include <PhysX/PhysXLocks.h>
 #include <PhysX/Utils.h>
+#include <Scene/PhysXScene.h>
 #include <System/PhysXSystem.h>
 
 namespace PhysX
@@ -247,6 +248,7 @@ namespace PhysX
         // Add articulation to the scene
         AzPhysics::Scene* scene = sceneInterface->GetScene(m_attachedSceneHandle);
         physx::PxScene* pxScene = static_cast<physx::PxScene*>(scene->GetNativePointer());
+        static_cast<PhysXScene*>(scene)->WarnOnUnbufferedWrite("PxScene::addArticulation");
 
         PHYSX_SCENE_WRITE_LOCK(pxScene);
         pxScene->addArticulation(*m_articulation);
@@ -513,6 +515,7 @@ namespace PhysX
         m_articulationLinks.clear();
 
         physx::PxScene* pxScene = static_cast<physx::PxScene*>(scene->GetNativePointer());
+        static_cast<PhysXScene*>(scene)->WarnOnUnbufferedWrite("PxArticulationReducedCoordinate::release");
         PHYSX_SCENE_WRITE_LOCK(pxScene);
         m_articulation->release();
 
@@ -23,6 +23,7 @@
 #include <PhysX/MathConversion.h>
 #include <Joint/PhysXJoint.h>
 
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/ProfilerBus.h>
 #include <AzCore/std/algorithm.h>
@@ -47,6 +48,8 @@ namespace PhysX
         "Only relevant if batched transform update is enabled.");
     AZ_CVAR(size_t, physx_parallelTransformSyncBatchSize, 250, nullptr, AZ::ConsoleFunctorFlags::Null,
         "How many rigid bodies should be processed per task");
+    AZ_CVAR(size_t, physx_sceneQueryBatchSize, 32, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "How many scene queries of a batch should be processed per task. Batches no larger than this run on the calling thread.");
 
     AZ_CLASS_ALLOCATOR_IMPL(PhysXScene, AZ::SystemAllocator);
 
@@ -516,6 +519,17 @@ namespace PhysX
     {
         m_physicsSystemConfigChanged.Disconnect();
 
+        // Async scene queries read from the PhysX scene, so they need to finish before it's released.
+        WaitForAsyncQueries();
+
+        // Bodies can't be removed while the scene is simulating, so wait for a pipelined simulation step to finish.
+        if (m_simulationInFlight)
+        {
+            PHYSX_SCENE_WRITE_LOCK(m_pxScene);
+            m_pxScene->fetchResults(true);
+            m_simulationInFlight = false;
+        }
+
         s_overlapBuffer = {};
         s_rayCastBuffer = {};
         s_sweepBuffer = {};
@@ -568,13 +582,15 @@ namespace PhysX
 
         PHYSX_SCENE_WRITE_LOCK(m_pxScene);
         m_pxScene->simulate(deltatime);
+        m_simulationInFlight = true;
     }
 
     void PhysXScene::FinishSimulation()
     {
         AZ_PROFILE_SCOPE(Physics, "PhysXScene::FinishSimulation");
 
-        if (!IsEnabled())
+        // A simulation that was started has to be finished even if the scene got disabled in the meantime.
+        if (!IsEnabled() && !m_simulationInFlight)
         {
             return;
         }
@@ -599,6 +615,13 @@ namespace PhysX
 
             // Swap the buffers, invoke callbacks, build the list of active actors.
             m_pxScene->fetchResults(true);
+            m_simulationInFlight = false;
+
+            if (m_gravityChangePending)
+            {
+                m_pxScene->setGravity(PxMathConvert(m_gravity));
+                m_gravityChangePending = false;
+            }
         }
 
         if (activeActorsEnabled)
@@ -692,6 +715,45 @@ namespace PhysX
     AzPhysics::SimulatedBodyHandle PhysXScene::AddSimulatedBody(const AzPhysics::SimulatedBodyConfiguration* simulatedBodyConfig)
     {
         AzPhysics::SimulatedBody* newBody = nullptr;
+        const AzPhysics::SimulatedBodyHandle newBodyHandle = CreateSimulatedBodyInternal(simulatedBodyConfig, newBody);
+
+        // Enable simulation by default (not signaling OnSimulationBodySimulationEnabled event)
+        if (newBody != nullptr && simulatedBodyConfig->m_startSimulationEnabled)
+        {
+            EnableSimulationOfBodyInternal(*newBody);
+        }
+
+        return newBodyHandle;
+    }
+
+    AzPhysics::SimulatedBodyHandleList PhysXScene::AddSimulatedBodies(const AzPhysics::SimulatedBodyConfigurationList& simulatedBodyConfigs)
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::AddSimulatedBodies");
+
+        AzPhysics::SimulatedBodyHandleList newBodyHandles;
+        newBodyHandles.reserve(simulatedBodyConfigs.size());
+        AZStd::vector<AzPhysics::SimulatedBody*> bodiesToEnable;
+        bodiesToEnable.reserve(simulatedBodyConfigs.size());
+        for (auto* config : simulatedBodyConfigs)
+        {
+            AzPhysics::SimulatedBody* newBody = nullptr;
+            newBodyHandles.emplace_back(CreateSimulatedBodyInternal(config, newBody));
+            if (newBody != nullptr && config->m_startSimulationEnabled)
+            {
+                bodiesToEnable.push_back(newBody);
+            }
+        }
+
+        // Insert all the new actors into the scene at once, instead of locking the scene for each of them.
+        EnableSimulationOfBodiesInternal(bodiesToEnable);
+
+        return newBodyHandles;
+    }
+
+    AzPhysics::SimulatedBodyHandle PhysXScene::CreateSimulatedBodyInternal(
+        const AzPhysics::SimulatedBodyConfiguration* simulatedBodyConfig, AzPhysics::SimulatedBody*& newBody)
+    {
+        newBody = nullptr;
         AZ::Crc32 newBodyCrc;
         if (azrtti_istypeof<AzPhysics::RigidBodyConfiguration>(simulatedBodyConfig))
         {
@@ -746,29 +808,12 @@ namespace PhysX
             newBody->m_bodyHandle = newBodyHandle;
             m_simulatedBodyAddedEvent.Signal(m_sceneHandle, newBodyHandle);
 
-            // Enable simulation by default (not signaling OnSimulationBodySimulationEnabled event)
-            if (simulatedBodyConfig->m_startSimulationEnabled)
-            {
-                EnableSimulationOfBodyInternal(*newBody);
-            }
-
             return newBodyHandle;
         }
 
         return AzPhysics::InvalidSimulatedBodyHandle;
     }
 
-    AzPhysics::SimulatedBodyHandleList PhysXScene::AddSimulatedBodies(const AzPhysics::SimulatedBodyConfigurationList& simulatedBodyConfigs)
-    {
-        AzPhysics::SimulatedBodyHandleList newBodyHandles;
-        newBodyHandles.reserve(simulatedBodyConfigs.size());
-        for (auto* config : simulatedBodyConfigs)
-        {
-            newBodyHandles.emplace_back(AddSimulatedBody(config));
-        }
-        return newBodyHandles;
-    }
-
     AzPhysics::SimulatedBody* PhysXScene::GetSimulatedBodyFromHandle(AzPhysics::SimulatedBodyHandle bodyHandle)
     {
         if (bodyHandle == AzPhysics::InvalidSimulatedBodyHandle)
@@ -1014,27 +1059,152 @@ namespace PhysX
 
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::QuerySceneBatch");
+
         AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        if (requests.size() <= AZStd::max<size_t>(physx_sceneQueryBatchSize, 1))
         {
-            results.emplace_back(QueryScene(request.get()));
+            // Not worth the overhead of spinning up tasks for a single batch.
+            results.reserve(requests.size());
+            for (auto& request : requests)
+            {
+                results.emplace_back(QueryScene(request.get()));
+            }
+            return results;
         }
+
+        results.resize(requests.size());
+
+        AZ::TaskGraph taskGraph("Scene Query Batch");
+        AZ::TaskGraphEvent finishEvent("Scene query batch event");
+        AddQuerySceneTasks(taskGraph, requests, results);
+        taskGraph.Submit(&finishEvent);
+        finishEvent.Wait();
+
         return results;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsync([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequest* request, [[maybe_unused]] AzPhysics::SceneQuery::AsyncCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (request == nullptr || !callback)
+        {
+            return false;
+        }
+
+        // The caller only guarantees the request is valid for the duration of this call, so the query runs on a copy.
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> requestCopy;
+        switch (request->m_requestType)
+        {
+        case AzPhysics::SceneQueryRequest::RequestType::Raycast:
+            requestCopy = AZStd::make_shared<AzPhysics::RayCastRequest>(*static_cast<const AzPhysics::RayCastRequest*>(request));
+            break;
+        case AzPhysics::SceneQueryRequest::RequestType::Shapecast:
+            requestCopy = AZStd::make_shared<AzPhysics::ShapeCastRequest>(*static_cast<const AzPhysics::ShapeCastRequest*>(request));
+            break;
+        case AzPhysics::SceneQueryRequest::RequestType::Overlap:
+            requestCopy = AZStd::make_shared<AzPhysics::OverlapRequest>(*static_cast<const AzPhysics::OverlapRequest*>(request));
+            break;
+        default:
+            AZ_Warning("Physx", false, "Unknown Scene Query request type.");
+            return false;
+        }
+
+        return QuerySceneAsyncBatch(requestId, { requestCopy },
+            [callback = AZStd::move(callback)](AzPhysics::SceneQuery::AsyncRequestId batchRequestId, AzPhysics::SceneQueryHitsList hits)
+            {
+                callback(batchRequestId, AZStd::move(hits.front()));
+            });
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequests& requests, [[maybe_unused]] AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQuery::AsyncBatchCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (requests.empty() || !callback)
+        {
+            return false;
+        }
+
+        // The requests are shared pointers, so copying the list keeps them alive until the queries finish.
+        struct AsyncBatch
+        {
+            AzPhysics::SceneQueryRequests m_requests;
+            AzPhysics::SceneQueryHitsList m_results;
+        };
+        auto batch = AZStd::make_shared<AsyncBatch>();
+        batch->m_requests = requests;
+        batch->m_results.resize(requests.size());
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_asyncQueryMutex);
+            ++m_pendingAsyncQueries;
+        }
+
+        AZ::TaskGraph taskGraph("Async Scene Query Batch");
+        AZStd::vector<AZ::TaskToken> queryTasks = AddQuerySceneTasks(taskGraph, batch->m_requests, batch->m_results);
+
+        AZ::TaskDescriptor completionTaskDescriptor{"AsyncSceneQueryCompletion", "Physics"};
+        AZ::TaskToken completionTask = taskGraph.AddTask(
+            completionTaskDescriptor,
+            [this, requestId, batch, callback = AZStd::move(callback)]() mutable
+            {
+                // Callbacks are dispatched on the game thread, so they can safely touch game state.
+                AZ::TickBus::QueueFunction(
+                    [requestId, batch, callback = AZStd::move(callback)]()
+                    {
+                        callback(requestId, AZStd::move(batch->m_results));
+                    });
+
+                AZStd::lock_guard<AZStd::mutex> lock(m_asyncQueryMutex);
+                if (--m_pendingAsyncQueries == 0)
+                {
+                    m_asyncQueryCondition.notify_all();
+                }
+            });
+        for (AZ::TaskToken& queryTask : queryTasks)
+        {
+            queryTask.Precedes(completionTask);
+        }
+
+        taskGraph.Detach();
+        taskGraph.Submit();
+        return true;
+    }
+
+    AZStd::vector<AZ::TaskToken> PhysXScene::AddQuerySceneTasks(
+        AZ::TaskGraph& taskGraph, const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results)
+    {
+        AZ_Assert(results.size() == requests.size(), "The results should be sized to the number of requests.");
+
+        AZStd::vector<AZ::TaskToken> tasks;
+        const size_t batchSize = AZStd::max<size_t>(physx_sceneQueryBatchSize, 1);
+        const size_t fullSize = requests.size();
+        tasks.reserve((fullSize + batchSize - 1) / batchSize);
+        for (size_t i = 0; i < fullSize; i += batchSize)
+        {
+            AZ::TaskDescriptor taskDescriptor{"SceneQueryTask", "Physics"};
+            tasks.push_back(taskGraph.AddTask(
+                taskDescriptor,
+                [start = i, end = AZStd::min(i + batchSize, fullSize), &requests, &results, this]()
+                {
+                    AZ_PROFILE_SCOPE(Physics, "Scene Query Task");
+
+                    // Keep the scene locked for read across the whole batch rather than relocking for every query.
+                    PHYSX_SCENE_READ_LOCK(m_pxScene);
+
+                    for (size_t requestIndex = start; requestIndex < end; ++requestIndex)
+                    {
+                        QueryScene(requests[requestIndex].get(), results[requestIndex]);
+                    }
+                }));
+        }
+        return tasks;
+    }
+
+    void PhysXScene::WaitForAsyncQueries()
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_asyncQueryMutex);
+        m_asyncQueryCondition.wait(lock, [this]() { return m_pendingAsyncQueries == 0; });
     }
 
     void PhysXScene::SuppressCollisionEvents(
@@ -1066,6 +1236,12 @@ namespace PhysX
         if (m_pxScene && !m_gravity.IsClose(gravity))
         {
             m_gravity = gravity;
+            // PhysX ignores setGravity while the scene is simulating, so during a pipelined step it's applied once the step finished.
+            if (m_simulationInFlight)
+            {
+                m_gravityChangePending = true;
+            }
+            else
             {
                 PHYSX_SCENE_WRITE_LOCK(m_pxScene);
                 m_pxScene->setGravity(PxMathConvert(m_gravity));
@@ -1107,6 +1283,49 @@ namespace PhysX
         body.m_simulating = true;
     }
 
+    void PhysXScene::EnableSimulationOfBodiesInternal(const AZStd::vector<AzPhysics::SimulatedBody*>& bodies)
+    {
+        if (bodies.empty())
+        {
+            return;
+        }
+
+        AZStd::vector<physx::PxActor*> pxActors;
+        pxActors.reserve(bodies.size());
+        for (AzPhysics::SimulatedBody* body : bodies)
+        {
+            //character controller is a special actor and only needs the m_simulating flag set,
+            if (!azrtti_istypeof<PhysX::CharacterController>(body) &&
+                !azrtti_istypeof<PhysX::Ragdoll>(body) &&
+                !azrtti_istypeof<PhysX::ArticulationLink>(body))
+            {
+                auto pxActor = static_cast<physx::PxActor*>(body->GetNativePointer());
+                AZ_Assert(pxActor, "Simulated Body doesn't have a valid physx actor");
+                pxActors.push_back(pxActor);
+            }
+        }
+
+        if (!pxActors.empty())
+        {
+            PHYSX_SCENE_WRITE_LOCK(m_pxScene);
+            m_pxScene->addActors(pxActors.data(), aznumeric_cast<physx::PxU32>(pxActors.size()));
+        }
+
+        for (AzPhysics::SimulatedBody* body : bodies)
+        {
+            if (azrtti_istypeof<PhysX::RigidBody>(body))
+            {
+                auto rigidBody = azdynamic_cast<PhysX::RigidBody*>(body);
+                if (rigidBody->ShouldStartAsleep())
+                {
+                    rigidBody->ForceAsleep();
+                }
+            }
+
+            body->m_simulating = true;
+        }
+    }
+
     void PhysXScene::DisableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body)
     {
         //character controller is a special actor and only needs the m_simulating flag set,
@@ -1125,6 +1344,14 @@ namespace PhysX
         body.m_simulating = false;
     }
 
+    void PhysXScene::WarnOnUnbufferedWrite([[maybe_unused]] const char* operation) const
+    {
+        AZ_Warning("PhysXScene", !m_simulationInFlight,
+            "%s is not buffered by PhysX and is ignored while the scene '%s' is simulating. "
+            "Only the buffered PhysX API can be used between two Simulate calls when physx_pipelinedSimulation is on.",
+            operation, m_config.m_sceneName.c_str());
+    }
+
     physx::PxControllerManager* PhysXScene::GetOrCreateControllerManager()
     {
         if (m_controllerManager)
@@ -12,6 +12,9 @@
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <AzFramework/Physics/Configuration/SceneConfiguration.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/Task/TaskGraph.h>
 
 #include <Scene/PhysXSceneSimulationEventCallback.h>
 #include <Scene/PhysXSceneSimulationFilterCallback.h>
@@ -84,6 +87,13 @@ namespace PhysX
         //! Apply batched transform sync events for the current simulation pass. 
         //! This will clear the batched data for the next simulation pass.
         void FlushTransformSync();
+
+        //! Returns true between StartSimulation and FinishSimulation, while PhysX is simulating the scene on its worker threads.
+        bool IsSimulationInFlight() const { return m_simulationInFlight; }
+
+        //! Warns when called while a pipelined simulation step is in flight. PhysX ignores the calls that aren't buffered
+        //! during a step, such as adding an articulation, so they have to be made before Simulate is called.
+        void WarnOnUnbufferedWrite(const char* operation) const;
         
     private:
 
@@ -103,7 +113,13 @@ namespace PhysX
             AZStd::vector<AzPhysics::SimulatedBodyIndex> m_packedIndices;
         };
 
+        //! Creates a simulated body from its configuration and gives it a slot in the scene, without adding it to the simulation.
+        AzPhysics::SimulatedBodyHandle CreateSimulatedBodyInternal(
+            const AzPhysics::SimulatedBodyConfiguration* simulatedBodyConfig, AzPhysics::SimulatedBody*& newBody);
+
         void EnableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
+        //! Same as EnableSimulationOfBodyInternal, but adds the actors of all the bodies to the scene under a single lock.
+        void EnableSimulationOfBodiesInternal(const AZStd::vector<AzPhysics::SimulatedBody*>& bodies);
         void DisableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
 
         void FlushQueuedEvents();
@@ -115,7 +131,18 @@ namespace PhysX
 
         void SyncActiveBodyTransform(const AzPhysics::SimulatedBodyHandleList& activeBodyHandles);
 
+        //! Runs the requests on the task graph in parallel batches, each request writing its hits to the same index of the results.
+        //! The results must already be sized to the number of requests, and have to outlive the tasks.
+        //! Returns the tokens of the added tasks.
+        AZStd::vector<AZ::TaskToken> AddQuerySceneTasks(
+            AZ::TaskGraph& taskGraph, const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results);
+
+        //! Blocks until every async scene query running against this scene has finished.
+        void WaitForAsyncQueries();
+
         bool m_isEnabled = true;
+        bool m_simulationInFlight = false;
+        bool m_gravityChangePending = false; //!< Gravity changed during a pipelined step, applied once it finished.
 
         // Batch transform sync data. Here we store the indices of actors that have moved since the last simulation pass.
         // After the full simulation pass (possibly made of multiple simulation sub-steps) is complete,
@@ -150,6 +177,10 @@ namespace PhysX
         AZ::u32 m_shapecastBufferSize = 32; //!< Maximum number of hits that can be returned from a shapecast.
         AZ::u32 m_overlapBufferSize = 32; //!< Maximum number of overlaps that can be returned from an overlap query.
 
+        AZStd::mutex m_asyncQueryMutex; //!< Guards the count of async scene queries in flight.
+        AZStd::condition_variable m_asyncQueryCondition; //!< Signaled when the last async scene query in flight finishes.
+        AZ::u32 m_pendingAsyncQueries = 0; //!< Number of async scene queries in flight, the scene can't be released before they finish.
+
         SceneSimulationFilterCallback m_collisionFilterCallback; //!< Handles the filtering of collision pairs reported from PhysX.
         SceneSimulationEventCallback m_simulationEventCallback; //!< Handles the collision and trigger events reported from PhysX.
         physx::PxScene* m_pxScene = nullptr; //!< The physx scene
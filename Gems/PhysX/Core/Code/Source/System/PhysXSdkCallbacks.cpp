@@ -10,6 +10,9 @@
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Debug/Trace.h>
 #include <AzCore/Math/Crc.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzCore/std/string/string_view.h>
 
 namespace PhysX
 {
@@ -41,6 +44,81 @@ namespace PhysX
         }
     }
 
+    namespace
+    {
+        using StageClock = AZStd::chrono::steady_clock;
+        constexpr size_t StageCount = static_cast<size_t>(PxAzProfilerCallback::SimulationStage::Count);
+
+        // Per thread state of the stage timing. Zones of the same stage can be nested,
+        // only the outermost one on each thread is measured so the time isn't counted twice.
+        struct ThreadStageTiming
+        {
+            AZStd::array<AZ::u32, StageCount> m_depth{};
+            AZStd::array<StageClock::time_point, StageCount> m_startTime{};
+        };
+        thread_local ThreadStageTiming t_stageTiming;
+
+        bool ContainsCaseInsensitive(AZStd::string_view text, AZStd::string_view pattern)
+        {
+            return AZStd::search(text.begin(), text.end(), pattern.begin(), pattern.end(),
+                [](char a, char b)
+                {
+                    return AZStd::tolower(a) == AZStd::tolower(b);
+                }) != text.end();
+        }
+    }
+
+    void PxAzProfilerCallback::SetStageTimingEnabled(bool enabled)
+    {
+        m_stageTimingEnabled = enabled;
+    }
+
+    bool PxAzProfilerCallback::IsStageTimingEnabled() const
+    {
+        return m_stageTimingEnabled;
+    }
+
+    AZStd::chrono::microseconds PxAzProfilerCallback::TakeStageTime(SimulationStage stage)
+    {
+        const AZ::s64 ticks = m_stageTimes[static_cast<size_t>(stage)].exchange(0);
+        return AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(StageClock::duration(ticks));
+    }
+
+    PxAzProfilerCallback::SimulationStage PxAzProfilerCallback::GetZoneStage(const char* eventName)
+    {
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_zoneStagesMutex);
+            if (auto it = m_zoneStages.find(eventName); it != m_zoneStages.end())
+            {
+                return it->second;
+            }
+        }
+
+        // Articulations are checked first as their zones can also mention the solver.
+        const AZStd::string_view name(eventName);
+        SimulationStage stage = SimulationStage::Count;
+        if (ContainsCaseInsensitive(name, "articulation"))
+        {
+            stage = SimulationStage::Articulations;
+        }
+        else if (ContainsCaseInsensitive(name, "broadphase"))
+        {
+            stage = SimulationStage::BroadPhase;
+        }
+        else if (ContainsCaseInsensitive(name, "narrowphase"))
+        {
+            stage = SimulationStage::NarrowPhase;
+        }
+        else if (ContainsCaseInsensitive(name, "solve"))
+        {
+            stage = SimulationStage::Solver;
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_zoneStagesMutex);
+        m_zoneStages.emplace(eventName, stage);
+        return stage;
+    }
+
     void* PxAzProfilerCallback::zoneStart([[maybe_unused]] const char* eventName, bool detached, [[maybe_unused]] uint64_t contextId)
     {
         if (!detached)
@@ -51,6 +129,22 @@ namespace PhysX
         {
             AZ_PROFILE_INTERVAL_START(Physics, AZ::Crc32(eventName), eventName);
         }
+
+        // Cross thread zones can't be measured with the per thread state.
+        if (!detached && m_stageTimingEnabled)
+        {
+            const SimulationStage stage = GetZoneStage(eventName);
+            if (stage != SimulationStage::Count)
+            {
+                const size_t stageIndex = static_cast<size_t>(stage);
+                if (t_stageTiming.m_depth[stageIndex]++ == 0)
+                {
+                    t_stageTiming.m_startTime[stageIndex] = StageClock::now();
+                }
+                // The stage is passed back to zoneEnd as the profiler data.
+                return reinterpret_cast<void*>(stageIndex + 1);
+            }
+        }
         return nullptr;
     }
 
@@ -65,5 +159,15 @@ namespace PhysX
         {
             AZ_PROFILE_INTERVAL_END(Physics, AZ::Crc32(eventName));
         }
+
+        if (profilerData)
+        {
+            const size_t stageIndex = reinterpret_cast<size_t>(profilerData) - 1;
+            if (--t_stageTiming.m_depth[stageIndex] == 0)
+            {
+                const StageClock::duration duration = StageClock::now() - t_stageTiming.m_startTime[stageIndex];
+                m_stageTimes[stageIndex] += duration.count();
+            }
+        }
     }
 }
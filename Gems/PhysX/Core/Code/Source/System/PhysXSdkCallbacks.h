@@ -7,6 +7,12 @@
  */
 #pragma once
 
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+
 #include <PxPhysicsAPI.h>
 
 namespace PhysX
@@ -20,10 +26,28 @@ namespace PhysX
     };
 
     //! Implementation of the PhysX profiler callback interface.
+    //! It forwards PhysX profile zones to the AZ profiler and, when enabled, it measures the time spent
+    //! in the simulation stages by adding up the duration of their zones.
     class PxAzProfilerCallback
         : public physx::PxProfilerCallback
     {
     public:
+        //! Simulation stages measured from the PhysX profile zones.
+        enum class SimulationStage : AZ::u8
+        {
+            BroadPhase,
+            NarrowPhase,
+            Solver,
+            Articulations,
+            Count
+        };
+
+        //! Enables measuring the time spent in each simulation stage.
+        void SetStageTimingEnabled(bool enabled);
+        bool IsStageTimingEnabled() const;
+
+        //! Returns the time spent in a simulation stage since the last call, added up across all the PhysX worker threads.
+        AZStd::chrono::microseconds TakeStageTime(SimulationStage stage);
 
         //! Mark the beginning of a nested profile block.
         //! @param eventName Event name. Must be a persistent const char *.
@@ -39,5 +63,20 @@ namespace PhysX
         //! @param contextId The context of this zone. Should match the value passed to zoneStart.
         //! Note: eventName plus contextId can be used to uniquely match up start and end of a zone.
         void zoneEnd(void* profilerData, const char* eventName, bool detached, uint64_t contextId) override;
+
+    private:
+        static constexpr size_t StageCount = static_cast<size_t>(SimulationStage::Count);
+
+        //! Returns the simulation stage a zone belongs to, or SimulationStage::Count if it doesn't belong to any.
+        SimulationStage GetZoneStage(const char* eventName);
+
+        AZStd::atomic_bool m_stageTimingEnabled{ false };
+
+        //! Time spent in each stage, in steady clock ticks.
+        AZStd::array<AZStd::atomic<AZ::s64>, StageCount> m_stageTimes{};
+
+        //! Stage of each zone name seen so far. PhysX zone names are persistent strings, so they're keyed by pointer.
+        AZStd::unordered_map<const char*, SimulationStage> m_zoneStages;
+        AZStd::shared_mutex m_zoneStagesMutex;
     };
 }
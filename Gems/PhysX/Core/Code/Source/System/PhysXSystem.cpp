@@ -35,6 +35,15 @@ namespace PhysX
         "Batch entity transform syncs for the entire simulation pass. "
         "True: Sync entity transform once per Simulate call. "
         "False: Sync entity transform for every simulation sub-step.");
+    AZ_CVAR(bool, physx_pipelinedSimulation, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Overlap the last simulation sub-step of each frame with the game logic of the frame. "
+        "True: The last sub-step keeps simulating on the PhysX worker threads after Simulate returns, and its results "
+        "(events and entity transforms) are applied at the start of the next Simulate call, one frame late. "
+        "Only the buffered PhysX API can be used on the scenes between two Simulate calls. "
+        "False: Every sub-step finishes before Simulate returns.");
+    AZ_CVAR(bool, physx_profileSimulationStages, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Measure the time spent in the broad phase, narrow phase, solver and articulations from the PhysX profile zones, "
+        "and record it in the PhysX performance metrics. Requires a PhysX SDK built with profiling enabled.");
 
     AZ_CLASS_ALLOCATOR_IMPL(PhysXSystem, AZ::SystemAllocator);
 
@@ -111,6 +120,10 @@ namespace PhysX
     {
         auto performanceMetrics = AZStd::to_array<AZStd::string_view>({
             PerformanceSpecPhysXSimulationTime,
+            PerformanceSpecPhysXBroadPhaseTime,
+            PerformanceSpecPhysXNarrowPhaseTime,
+            PerformanceSpecPhysXSolverTime,
+            PerformanceSpecPhysXArticulationsTime,
         });
 
         AZStd::string platformName = AZ::GetPlatformName(AZ::g_currentPlatform);
@@ -185,7 +198,17 @@ namespace PhysX
             return;
         }
 
-        auto simulateScenes = [this](float timeStep)
+        // Finish the sub-step left simulating by the previous frame when pipelining, so its results are applied this frame.
+        for (auto& scenePtr : m_sceneList)
+        {
+            if (scenePtr != nullptr && static_cast<PhysXScene*>(scenePtr.get())->IsSimulationInFlight())
+            {
+                AZ::Debug::ScopeDuration performanceScopeDuration(m_performanceCollector.get(), PerformanceSpecPhysXSimulationTime);
+                scenePtr->FinishSimulation();
+            }
+        }
+
+        auto simulateScenes = [this](float timeStep, bool finishSimulation)
         {
             for (auto& scenePtr : m_sceneList)
             {
@@ -193,11 +216,17 @@ namespace PhysX
                 {
                     AZ::Debug::ScopeDuration performanceScopeDuration(m_performanceCollector.get(), PerformanceSpecPhysXSimulationTime);
                     scenePtr->StartSimulation(timeStep);
-                    scenePtr->FinishSimulation();
+                    if (finishSimulation)
+                    {
+                        scenePtr->FinishSimulation();
+                    }
                 }
             }
         };
 
+        const bool pipelinedSimulation = physx_pipelinedSimulation;
+        m_pxAzProfilerCallback.SetStageTimingEnabled(physx_profileSimulationStages);
+
 #ifdef ENABLE_PHYSX_TIMESTEP_WARNING
         if (FrameTimeWarning::NumSamples < FrameTimeWarning::MaxSamples)
         {
@@ -231,18 +260,21 @@ namespace PhysX
 
             while (m_accumulatedTime >= m_systemConfig.m_fixedTimestep)
             {
-                simulateScenes(m_systemConfig.m_fixedTimestep);
                 m_accumulatedTime -= m_systemConfig.m_fixedTimestep;
+                // Only the last sub-step of the frame is left simulating, every other one has to finish before the next starts.
+                const bool lastSubStep = m_accumulatedTime < m_systemConfig.m_fixedTimestep;
+                simulateScenes(m_systemConfig.m_fixedTimestep, !(pipelinedSimulation && lastSubStep));
             }
         }
         else
         {
             m_preSimulateEvent.Signal(tickTime);
 
-            simulateScenes(tickTime);
+            simulateScenes(tickTime, !pipelinedSimulation);
         }
         
         // Flush performance data for this tick
+        RecordSimulationStageTimes();
         m_performanceCollector->FrameTick();
         
         if (physx_batchTransformSync)
@@ -516,6 +548,33 @@ namespace PhysX
         m_systemConfig.m_collisionConfig.m_collisionGroups.CreateGroup(groupName, group);
     }
 
+    void PhysXSystem::RecordSimulationStageTimes()
+    {
+        if (!m_pxAzProfilerCallback.IsStageTimingEnabled())
+        {
+            return;
+        }
+
+        using SimulationStage = PxAzProfilerCallback::SimulationStage;
+        const AZStd::pair<SimulationStage, AZStd::string_view> stageMetrics[] = {
+            { SimulationStage::BroadPhase, PerformanceSpecPhysXBroadPhaseTime },
+            { SimulationStage::NarrowPhase, PerformanceSpecPhysXNarrowPhaseTime },
+            { SimulationStage::Solver, PerformanceSpecPhysXSolverTime },
+            { SimulationStage::Articulations, PerformanceSpecPhysXArticulationsTime },
+        };
+
+        // The stage times are always taken so they don't carry over to the next capture batch.
+        const bool recordSamples = !m_performanceCollector->IsWaitingBeforeCapture();
+        for (const auto& [stage, metricName] : stageMetrics)
+        {
+            const AZStd::chrono::microseconds stageTime = m_pxAzProfilerCallback.TakeStageTime(stage);
+            if (recordSamples)
+            {
+                m_performanceCollector->RecordSample(metricName, stageTime);
+            }
+        }
+    }
+
     AZ::Debug::PerformanceCollector* PhysXSystem::GetPerformanceCollector()
     {
         return m_performanceCollector.get();
@@ -96,6 +96,9 @@ namespace PhysX
 
         void InitializePerformanceCollector();
 
+        //! Records the time spent in each simulation stage since the last call into the performance collector.
+        void RecordSimulationStageTimes();
+
         PhysXSystemConfiguration m_systemConfig;
         AzPhysics::SceneConfiguration m_defaultSceneConfiguration;
         AzPhysics::SceneList m_sceneList;
@@ -131,6 +134,10 @@ namespace PhysX
 
         static constexpr AZStd::string_view PerformanceLogCategory = "PhysX";
         static constexpr AZStd::string_view PerformanceSpecPhysXSimulationTime = "PhysX Simulation Time";
+        static constexpr AZStd::string_view PerformanceSpecPhysXBroadPhaseTime = "PhysX Broad Phase Time";
+        static constexpr AZStd::string_view PerformanceSpecPhysXNarrowPhaseTime = "PhysX Narrow Phase Time";
+        static constexpr AZStd::string_view PerformanceSpecPhysXSolverTime = "PhysX Solver Time";
+        static constexpr AZStd::string_view PerformanceSpecPhysXArticulationsTime = "PhysX Articulations Time";
 
         AZStd::unique_ptr<AZ::Debug::PerformanceCollector> m_performanceCollector;
     };
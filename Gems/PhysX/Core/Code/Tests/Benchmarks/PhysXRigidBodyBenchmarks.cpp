@@ -88,6 +88,23 @@ namespace PhysX::Benchmarks
             //! Number of iterations for each test
             static const int NumIterations = 10;
         } // namespace ActivationBenchmarkSettings
+
+        //! Settings used to setup the creation benchmark
+        namespace CreationBenchmarkSettings
+        {
+            //! Values passed to creation benchmark to select the number of rigid bodies to create during each test
+            //! Current values will run tests between StartRange to EndRange (inclusive), multiplying by RangeMultiplier each step.
+            static const int StartRange = 128;
+            static const int EndRange = 8192;
+            static const int RangeMultipler = 4;
+
+            //! Flags to select how the rigid bodies are added to the scene
+            static const int AddOneAtATime = 0; // call AddSimulatedBody for each rigid body
+            static const int AddAsBatch = 1; // call AddSimulatedBodies once with all the rigid bodies
+
+            //! Number of iterations for each test
+            static const int NumIterations = 10;
+        } // namespace CreationBenchmarkSettings
     } // namespace RigidBodyConstants
 
     namespace Utils
@@ -549,6 +566,72 @@ namespace PhysX::Benchmarks
         Utils::ReportStandardDeviationAndMeanCounters(state, activationTimes);
     }
 
+    //! BM_RigidBody_Creation - This test will measure the time it takes to add the requested number of rigid bodies
+    //! to the scene, either one at a time or as a single batch.
+    BENCHMARK_DEFINE_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_Creation)(benchmark::State& state)
+    {
+        // get the request number of rigid bodies and how to add them
+        const int numRigidBodies = aznumeric_cast<int>(state.range(0));
+        const int addMode = aznumeric_cast<int>(state.range(1));
+
+        const float boxSize = 1.0f;
+        const float boxSizeWithSpacing = boxSize + 0.25f;
+        const int boxesPerCol = static_cast<const int>(RigidBodyConstants::TerrainSize / boxSizeWithSpacing) - 1;
+
+        // all the rigid bodies share the same collider and shape configuration, like a debris spawn would
+        auto colliderConfiguration = AZStd::make_shared<Physics::ColliderConfiguration>();
+        auto boxShapeConfiguration = AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3(boxSize));
+
+        AZStd::vector<AzPhysics::RigidBodyConfiguration> rigidBodyConfigs(numRigidBodies);
+        AzPhysics::SimulatedBodyConfigurationList rigidBodyConfigPtrs;
+        rigidBodyConfigPtrs.reserve(numRigidBodies);
+        for (int i = 0; i < numRigidBodies; i++)
+        {
+            AzPhysics::RigidBodyConfiguration& rigidBodyConfig = rigidBodyConfigs[i];
+            rigidBodyConfig.m_ccdEnabled = RigidBodyConstants::CCDEnabled;
+            rigidBodyConfig.m_position = AZ::Vector3(
+                boxSizeWithSpacing * (1 + (i % boxesPerCol)), boxSizeWithSpacing * (1 + (i / boxesPerCol)), boxSize / 2.0f);
+            rigidBodyConfig.m_colliderAndShapeData = AzPhysics::ShapeColliderPair(colliderConfiguration, boxShapeConfiguration);
+            rigidBodyConfigPtrs.push_back(&rigidBodyConfig);
+        }
+
+        AzPhysics::Scene* scene = AZ::Interface<AzPhysics::SystemInterface>::Get()->GetScene(GetDefaultSceneHandle());
+
+        Types::TimeList creationTimes;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            // Measure time to add the rigid bodies to the scene
+            auto start = AZStd::chrono::steady_clock::now();
+
+            AzPhysics::SimulatedBodyHandleList bodyHandles;
+            if (addMode == RigidBodyConstants::CreationBenchmarkSettings::AddAsBatch)
+            {
+                bodyHandles = scene->AddSimulatedBodies(rigidBodyConfigPtrs);
+            }
+            else
+            {
+                bodyHandles.reserve(numRigidBodies);
+                for (AzPhysics::SimulatedBodyConfiguration* rigidBodyConfig : rigidBodyConfigPtrs)
+                {
+                    bodyHandles.push_back(scene->AddSimulatedBody(rigidBodyConfig));
+                }
+            }
+
+            auto tickElapsedMilliseconds = Types::double_milliseconds(AZStd::chrono::steady_clock::now() - start);
+            creationTimes.emplace_back(tickElapsedMilliseconds.count());
+
+            // Remove the rigid bodies for the next state iteration
+            scene->RemoveSimulatedBodies(bodyHandles);
+        }
+
+        // sort the creation times and get the P50, P90, P99 percentiles
+        Utils::ReportPercentiles(state, creationTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, creationTimes);
+
+        state.SetLabel(addMode == RigidBodyConstants::CreationBenchmarkSettings::AddAsBatch ? "AddAsBatch" : "AddOneAtATime");
+    }
+
     //! Same as the PhysXRigidbodyBenchmarkFixture, adds a world event handler to receive collision events
     class PhysXRigidbodyCollisionsBenchmarkFixture
         : public PhysXRigidbodyBenchmarkFixture
@@ -776,6 +859,15 @@ namespace PhysX::Benchmarks
         ->MeasureProcessCPUTime();
         ;
 
+    BENCHMARK_REGISTER_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_Creation)
+        ->RangeMultiplier(RigidBodyConstants::CreationBenchmarkSettings::RangeMultipler)
+        ->Ranges({ { RigidBodyConstants::CreationBenchmarkSettings::StartRange, RigidBodyConstants::CreationBenchmarkSettings::EndRange },
+                   { RigidBodyConstants::CreationBenchmarkSettings::AddOneAtATime, RigidBodyConstants::CreationBenchmarkSettings::AddAsBatch } })
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(RigidBodyConstants::CreationBenchmarkSettings::NumIterations)
+        ->MeasureProcessCPUTime();
+        ;
+
     BENCHMARK_REGISTER_F(PhysXRigidbodyCollisionsBenchmarkFixture, BM_RigidBody_MovingAndColliding_CollisionHandlers)
         ->RangeMultiplier(RigidBodyConstants::BenchmarkSettings::RangeMultipler)
         ->Ranges({  {RigidBodyConstants::BenchmarkSettings::StartRange, RigidBodyConstants::BenchmarkSettings::EndRange},
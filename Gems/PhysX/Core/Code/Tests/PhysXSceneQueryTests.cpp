@@ -6,7 +6,9 @@
  *
  */
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
@@ -1007,4 +1009,82 @@ namespace PhysX
             }
         }
     }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_LargeBatch_ReturnsExpectedHits)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        //setup a body on each axis
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 10.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        for (const AZ::Vector3& pos : positions)
+        {
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, pos, 1.0f));
+        }
+
+        //create enough requests to be split across multiple tasks
+        constexpr size_t RequestCount = 300;
+        AzPhysics::SceneQueryRequests requests;
+        for (size_t i = 0; i < RequestCount; i++)
+        {
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = positions[i % positions.size()].GetNormalized();
+            request->m_distance = 200.0f;
+
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        //run query
+        AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+        //results should come back in the same order as the requests
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            ASSERT_EQ(results[i].m_hits.size(), 1);
+            EXPECT_TRUE(results[i].m_hits[0].m_bodyHandle == simBodies[i % simBodies.size()]);
+        }
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_CallbackReceivesExpectedHits)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AzPhysics::SimulatedBodyHandle targetHandle =
+            TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f);
+
+        AzPhysics::RayCastRequest request;
+        request.m_start = AZ::Vector3::CreateZero();
+        request.m_direction = AZ::Vector3::CreateAxisX(1.0f);
+        request.m_distance = 200.0f;
+
+        static constexpr AzPhysics::SceneQuery::AsyncRequestId TestRequestId = 7;
+        bool callbackCalled = false;
+        AzPhysics::SceneQueryHits asyncHits;
+        const bool queued = sceneInterface->QuerySceneAsync(m_testSceneHandle, TestRequestId, &request,
+            [&callbackCalled, &asyncHits](AzPhysics::SceneQuery::AsyncRequestId requestId, AzPhysics::SceneQueryHits hits)
+            {
+                EXPECT_EQ(requestId, TestRequestId);
+                asyncHits = AZStd::move(hits);
+                callbackCalled = true;
+            });
+        ASSERT_TRUE(queued);
+
+        //the callback is dispatched through the tick bus once the query has finished
+        for (int attempt = 0; attempt < 1000 && !callbackCalled; attempt++)
+        {
+            AZ::TickBus::ExecuteQueuedEvents();
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+        }
+
+        ASSERT_TRUE(callbackCalled);
+        ASSERT_EQ(asyncHits.m_hits.size(), 1);
+        EXPECT_TRUE(asyncHits.m_hits[0].m_bodyHandle == targetHandle);
+    }
 }
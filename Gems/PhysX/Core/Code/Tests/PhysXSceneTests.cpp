@@ -6,11 +6,17 @@
  *
  */
 #include <AzTest/AzTest.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
 #include <Tests/PhysXTestCommon.h>
 
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/Configuration/StaticRigidBodyConfiguration.h>
 #include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/RigidBody.h>
+#include <AzCore/Console/IConsole.h>
+#include <PhysX/MathConversion.h>
+#include <PhysX/PhysXLocks.h>
+#include <Scene/PhysXScene.h>
 
 namespace PhysX
 {
@@ -139,6 +145,45 @@ namespace PhysX
         configs.clear();
     }
 
+    TEST_F(PhysXSceneFixture, AddSimulatedBodies_BodiesStartSimulatingAsConfigured)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        AzPhysics::ShapeColliderPair shapeColliderData(
+            AZStd::make_shared<Physics::ColliderConfiguration>(),
+            AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3::CreateOne()));
+
+        //every other body starts with simulation disabled
+        constexpr const int numberOfBodies = 10;
+        AZStd::vector<AzPhysics::RigidBodyConfiguration> rigidBodyConfigs(numberOfBodies);
+        AzPhysics::SimulatedBodyConfigurationList configs;
+        for (int i = 0; i < numberOfBodies; i++)
+        {
+            rigidBodyConfigs[i].m_colliderAndShapeData = shapeColliderData;
+            rigidBodyConfigs[i].m_position = AZ::Vector3::CreateAxisX(2.0f * static_cast<float>(i));
+            rigidBodyConfigs[i].m_startSimulationEnabled = (i % 2) == 0;
+            configs.emplace_back(&rigidBodyConfigs[i]);
+        }
+
+        AzPhysics::SimulatedBodyHandleList newBodies = sceneInterface->AddSimulatedBodies(m_testSceneHandle, configs);
+        ASSERT_EQ(newBodies.size(), configs.size());
+
+        for (int i = 0; i < numberOfBodies; i++)
+        {
+            AzPhysics::SimulatedBody* body = sceneInterface->GetSimulatedBodyFromHandle(m_testSceneHandle, newBodies[i]);
+            ASSERT_NE(body, nullptr);
+            EXPECT_EQ(body->m_simulating, rigidBodyConfigs[i].m_startSimulationEnabled);
+        }
+
+        //bodies added as a batch can be disabled and enabled individually like any other
+        sceneInterface->DisableSimulationOfBody(m_testSceneHandle, newBodies[0]);
+        EXPECT_FALSE(sceneInterface->GetSimulatedBodyFromHandle(m_testSceneHandle, newBodies[0])->m_simulating);
+        sceneInterface->EnableSimulationOfBody(m_testSceneHandle, newBodies[1]);
+        EXPECT_TRUE(sceneInterface->GetSimulatedBodyFromHandle(m_testSceneHandle, newBodies[1])->m_simulating);
+
+        sceneInterface->RemoveSimulatedBodies(m_testSceneHandle, newBodies);
+    }
+
     TEST_F(PhysXSceneFixture, GetSimulatedBodies_returnsExpected)
     {
         auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
@@ -588,4 +633,110 @@ namespace PhysX
 
         EXPECT_TRUE(handlerTriggered);
     }
+
+    class PhysXScenePipelinedSimulationFixture
+        : public testing::Test
+    {
+    public:
+        void TearDown() override
+        {
+            SetPipelinedSimulation(false);
+        }
+
+        static void SetPipelinedSimulation(bool enabled)
+        {
+            if (auto* console = AZ::Interface<AZ::IConsole>::Get())
+            {
+                console->PerformCommand(enabled ? "physx_pipelinedSimulation true" : "physx_pipelinedSimulation false");
+            }
+        }
+
+        //! Drops a box on the floor in a new scene and returns its position after every Simulate call.
+        //! Gravity changes halfway through, which PhysX doesn't buffer while a pipelined step is in flight.
+        static AZStd::vector<AZ::Vector3> SimulateFallingBox(bool pipelined)
+        {
+            auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+            auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+            SetPipelinedSimulation(pipelined);
+
+            AzPhysics::SceneConfiguration sceneConfig;
+            sceneConfig.m_sceneName = "PipelinedTestScene";
+            AzPhysics::SceneHandle sceneHandle = physicsSystem->AddScene(sceneConfig);
+            TestUtils::AddStaticFloorToScene(sceneHandle);
+            AzPhysics::RigidBody* box = TestUtils::AddUnitBoxToScene(sceneHandle, AZ::Vector3(0.0f, 0.0f, 2.0f));
+
+            AZStd::vector<AZ::Vector3> positions;
+            if (box)
+            {
+                const float timeStep = physicsSystem->GetConfiguration()->m_fixedTimestep;
+                for (size_t frame = 0; frame < NumFrames; ++frame)
+                {
+                    if (frame == NumFrames / 2)
+                    {
+                        sceneInterface->SetGravity(sceneHandle, AZ::Vector3(8.0f, 0.0f, -9.81f));
+                    }
+                    physicsSystem->Simulate(timeStep);
+                    positions.push_back(box->GetPosition());
+                }
+            }
+
+            physicsSystem->RemoveScene(sceneHandle);
+            return positions;
+        }
+
+        static constexpr size_t NumFrames = 60;
+    };
+
+    TEST_F(PhysXScenePipelinedSimulationFixture, PipelinedSimulation_MatchesSimulationOneFrameLate)
+    {
+        const AZStd::vector<AZ::Vector3> positions = SimulateFallingBox(false);
+        const AZStd::vector<AZ::Vector3> pipelinedPositions = SimulateFallingBox(true);
+        ASSERT_EQ(positions.size(), NumFrames);
+        ASSERT_EQ(pipelinedPositions.size(), NumFrames);
+
+        // the box fell onto the floor and slid along the changed gravity
+        EXPECT_LT(positions.back().GetZ(), 1.5f);
+        EXPECT_GT(positions.back().GetX(), 0.0f);
+
+        // the first step is still in flight after the first Simulate call, so the box hasn't moved yet
+        EXPECT_THAT(pipelinedPositions.front(), UnitTest::IsClose(AZ::Vector3(0.0f, 0.0f, 2.0f)));
+
+        // from then on, each frame shows the results of the step the non-pipelined simulation finished the frame before
+        for (size_t frame = 1; frame < NumFrames; ++frame)
+        {
+            EXPECT_THAT(pipelinedPositions[frame], UnitTest::IsCloseTolerance(positions[frame - 1], 1e-4f)) << "frame " << frame;
+        }
+    }
+
+    TEST_F(PhysXScenePipelinedSimulationFixture, PipelinedSimulation_SetGravityDuringStep_AppliedAfterStep)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        SetPipelinedSimulation(true);
+
+        AzPhysics::SceneConfiguration sceneConfig;
+        sceneConfig.m_sceneName = "PipelinedTestScene";
+        AzPhysics::SceneHandle sceneHandle = physicsSystem->AddScene(sceneConfig);
+        auto* scene = static_cast<PhysXScene*>(physicsSystem->GetScene(sceneHandle));
+        ASSERT_NE(scene, nullptr);
+        auto* pxScene = static_cast<physx::PxScene*>(scene->GetNativePointer());
+
+        physicsSystem->Simulate(physicsSystem->GetConfiguration()->m_fixedTimestep);
+        EXPECT_TRUE(scene->IsSimulationInFlight());
+
+        const AZ::Vector3 gravity(0.0f, 0.0f, -2.0f);
+        sceneInterface->SetGravity(sceneHandle, gravity);
+        EXPECT_THAT(scene->GetGravity(), UnitTest::IsClose(gravity));
+
+        // the in-flight step is finished at the start of the next Simulate call, before the gravity is needed again
+        physicsSystem->Simulate(physicsSystem->GetConfiguration()->m_fixedTimestep);
+        {
+            PHYSX_SCENE_READ_LOCK(pxScene);
+            EXPECT_THAT(PxMathConvert(pxScene->getGravity()), UnitTest::IsClose(gravity));
+        }
+
+        physicsSystem->RemoveScene(sceneHandle);
+    }
 }
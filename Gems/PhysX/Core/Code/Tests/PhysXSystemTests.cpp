@@ -13,6 +13,9 @@
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 
 #include <PhysX/Configuration/PhysXConfiguration.h>
+#include <System/PhysXSdkCallbacks.h>
+
+#include <AzCore/std/parallel/thread.h>
 
 namespace PhysX
 {
@@ -328,4 +331,35 @@ namespace PhysX
         physicsSystem->RemoveScenes(sceneHandles);
         EXPECT_EQ(removedCount, m_sceneConfigs.size());
     }
+
+    TEST(PxAzProfilerCallbackTest, StageTiming_ZonesOfSimulationStages_AreMeasuredWhenEnabled)
+    {
+        using SimulationStage = PxAzProfilerCallback::SimulationStage;
+        PxAzProfilerCallback profilerCallback;
+
+        //zones are not measured while stage timing is disabled
+        void* profilerData = profilerCallback.zoneStart("Sim.broadPhase", false, 0);
+        EXPECT_EQ(profilerData, nullptr);
+        profilerCallback.zoneEnd(profilerData, "Sim.broadPhase", false, 0);
+
+        profilerCallback.SetStageTimingEnabled(true);
+
+        //zones not belonging to any stage are not measured
+        profilerData = profilerCallback.zoneStart("Sim.updateKinematics", false, 0);
+        EXPECT_EQ(profilerData, nullptr);
+        profilerCallback.zoneEnd(profilerData, "Sim.updateKinematics", false, 0);
+
+        //nested zones of the same stage are measured by the outermost one
+        void* outerProfilerData = profilerCallback.zoneStart("Sim.broadPhase", false, 0);
+        void* innerProfilerData = profilerCallback.zoneStart("BroadPhase.update", false, 0);
+        EXPECT_NE(outerProfilerData, nullptr);
+        EXPECT_NE(innerProfilerData, nullptr);
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(2));
+        profilerCallback.zoneEnd(innerProfilerData, "BroadPhase.update", false, 0);
+        profilerCallback.zoneEnd(outerProfilerData, "Sim.broadPhase", false, 0);
+
+        EXPECT_GE(profilerCallback.TakeStageTime(SimulationStage::BroadPhase), AZStd::chrono::milliseconds(2));
+        EXPECT_EQ(profilerCallback.TakeStageTime(SimulationStage::BroadPhase).count(), 0);
+        EXPECT_EQ(profilerCallback.TakeStageTime(SimulationStage::Solver).count(), 0);
+    }
 }
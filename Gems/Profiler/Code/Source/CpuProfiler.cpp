@@ -8,9 +8,11 @@
 
 #include <CpuProfiler.h>
 
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Statistics/StatisticalProfilerProxy.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/time.h>
 
@@ -63,6 +65,7 @@ namespace Profiler
         m_initialized = true;
         AZ::SystemTickBus::Handler::BusConnect();
         m_continuousCaptureData.set_capacity(10);
+        m_timelineRegions.set_capacity(MaxTimelineRegions);
     }
 
     void CpuProfiler::Shutdown()
@@ -86,6 +89,10 @@ namespace Profiler
         m_initialized = false;
         m_continuousCaptureInProgress.store(false);
         m_continuousCaptureData.clear();
+        {
+            AZStd::unique_lock<AZStd::mutex> timelineLock(m_timelineRegionsMutex);
+            m_timelineRegions.clear();
+        }
         AZ::SystemTickBus::Handler::BusDisconnect();
     }
 
@@ -94,17 +101,30 @@ namespace Profiler
         // Try to lock here, the shutdownMutex will only be contested when the CpuProfiler is shutting down.
         if (m_shutdownMutex.try_lock_shared())
         {
-            if (m_enabled)
+            const bool enabled = m_enabled;
+            const bool flightRecorderEnabled = m_flightRecorderEnabled;
+            if (enabled || flightRecorderEnabled)
             {
                 // Lazy initialization, creates an instance of the Thread local data if it's not created, and registers it
                 RegisterThreadStorage();
+            }
+
+            if (enabled)
+            {
                 va_list args;
                 va_start(args, eventName);
                 // Push it to the stack
                 CachedTimeRegion timeRegion({ budget->Name(), AZStd::fixed_string<512>::format_arg(eventName, args).c_str() });
+                va_end(args);
                 ms_threadLocalStorage->RegionStackPushBack(timeRegion);
             }
 
+            // The flight recorder keeps the unformatted event name, formatting and interning it is most of the cost of a region
+            if (flightRecorderEnabled)
+            {
+                ms_threadLocalStorage->FlightRecorderPushBack(budget->Name(), eventName);
+            }
+
             m_shutdownMutex.unlock_shared();
         }
     }
@@ -115,9 +135,17 @@ namespace Profiler
         if (m_shutdownMutex.try_lock_shared())
         {
             // guard against enabling mid-marker
-            if (m_enabled && ms_threadLocalStorage != nullptr)
+            if (ms_threadLocalStorage != nullptr)
             {
-                ms_threadLocalStorage->RegionStackPopBack();
+                if (m_enabled)
+                {
+                    ms_threadLocalStorage->RegionStackPopBack();
+                }
+
+                if (m_flightRecorderEnabled)
+                {
+                    ms_threadLocalStorage->FlightRecorderPopBack();
+                }
             }
 
             m_shutdownMutex.unlock_shared();
@@ -203,6 +231,74 @@ namespace Profiler
         return m_enabled;
     }
 
+    void CpuProfiler::SetFlightRecorderEnabled(bool enabled)
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
+
+        if (m_flightRecorderEnabled == enabled)
+        {
+            return;
+        }
+
+        // Regions that began before the recorder was disabled would otherwise be matched with the first ends after it is enabled again
+        if (enabled)
+        {
+            for (auto& threadLocal : m_registeredThreads)
+            {
+                threadLocal->m_clearContainers = true;
+            }
+        }
+
+        m_flightRecorderEnabled = enabled;
+    }
+
+    bool CpuProfiler::IsFlightRecorderEnabled() const
+    {
+        return m_flightRecorderEnabled;
+    }
+
+    FlightRecording CpuProfiler::CaptureFlightRecording(float seconds)
+    {
+        const AZStd::sys_time_t sinceTick = AZStd::GetTimeNowTicks() -
+            static_cast<AZStd::sys_time_t>(seconds * static_cast<float>(AZStd::GetTimeTicksPerSecond()));
+
+        AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
+
+        FlightRecording recording;
+        for (auto& threadLocal : m_registeredThreads)
+        {
+            AZStd::vector<FlightRecorderRegion> regions;
+            threadLocal->CopyFlightRecording(sinceTick, regions);
+            if (!regions.empty())
+            {
+                recording.m_threadRegions[threadLocal->m_executingThreadId] = AZStd::move(regions);
+            }
+        }
+        lock.unlock();
+
+        AZStd::unique_lock<AZStd::mutex> timelineLock(m_timelineRegionsMutex);
+        for (const TimelineRegion& region : m_timelineRegions)
+        {
+            if (region.m_endTick >= sinceTick)
+            {
+                recording.m_timelineRegions.push_back(region);
+            }
+        }
+        return recording;
+    }
+
+    void CpuProfiler::AddTimelineRegion(
+        AZStd::string_view trackName, AZStd::string_view regionName, AZStd::sys_time_t startTick, AZStd::sys_time_t endTick)
+    {
+        if (!m_flightRecorderEnabled)
+        {
+            return;
+        }
+
+        AZStd::unique_lock<AZStd::mutex> lock(m_timelineRegionsMutex);
+        m_timelineRegions.push_back({ AZ::Name(trackName), AZ::Name(regionName), startTick, endTick });
+    }
+
     void CpuProfiler::OnSystemTick()
     {
         if (!m_enabled)
@@ -245,12 +341,15 @@ namespace Profiler
 
     void CpuProfiler::RegisterThreadStorage()
     {
-        AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
-        if (!ms_threadLocalStorage)
+        // Only the owning thread sets its storage, so the lock is only needed the first time
+        if (ms_threadLocalStorage)
         {
-            ms_threadLocalStorage = aznew CpuTimingLocalStorage();
-            m_registeredThreads.emplace_back(ms_threadLocalStorage);
+            return;
         }
+
+        AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
+        ms_threadLocalStorage = aznew CpuTimingLocalStorage();
+        m_registeredThreads.emplace_back(ms_threadLocalStorage);
     }
 
     // --- CpuTimingLocalStorage ---
@@ -265,9 +364,9 @@ namespace Profiler
         m_deleteFlag = true;
     }
 
-    void CpuTimingLocalStorage::RegionStackPushBack(CachedTimeRegion& timeRegion)
+    void CpuTimingLocalStorage::ClearContainersIfRequested()
     {
-        // If it was (re)enabled, clear the lists first
+        // If the profiler or the flight recorder was (re)enabled, clear the lists first
         if (m_clearContainers)
         {
             m_clearContainers = false;
@@ -275,8 +374,14 @@ namespace Profiler
             m_stackLevel = 0;
             m_cachedTimeRegionMap.clear();
             m_timeRegionStack.clear();
+            m_flightRecorderStack.clear();
             ResetCachedData();
         }
+    }
+
+    void CpuTimingLocalStorage::RegionStackPushBack(CachedTimeRegion& timeRegion)
+    {
+        ClearContainersIfRequested();
 
         timeRegion.m_stackDepth = aznumeric_cast<uint16_t>(m_stackLevel);
 
@@ -389,6 +494,212 @@ namespace Profiler
         m_cachedDataLimitReached = false;
     }
 
+    void CpuTimingLocalStorage::FlightRecorderPushBack(const char* groupName, const char* eventName)
+    {
+        ClearContainersIfRequested();
+
+        if (m_flightRecorderRegions.empty())
+        {
+            // Never resized again, CopyFlightRecording only reads it once m_flightRecorderWriteCount was published
+            m_flightRecorderRegions.resize(FlightRecorderCapacity);
+        }
+
+        AZ_Assert(m_flightRecorderStack.size() < TimeRegionStackSize, "Adding too many time regions to the stack. Increase the size of TimeRegionStackSize.");
+        FlightRecorderRegion& region = m_flightRecorderStack.emplace_back();
+        region.m_groupName = groupName;
+        region.m_eventName = eventName;
+        region.m_stackDepth = aznumeric_cast<uint16_t>(m_flightRecorderStack.size() - 1);
+
+        // Set the starting time at the end, to avoid recording the minor overhead
+        region.m_startTick = AZStd::GetTimeNowTicks();
+    }
+
+    void CpuTimingLocalStorage::FlightRecorderPopBack()
+    {
+        // The recorder may have been enabled while the thread was inside profiling markers
+        if (m_flightRecorderStack.empty())
+        {
+            return;
+        }
+
+        const AZStd::sys_time_t endRegionTime = AZStd::GetTimeNowTicks();
+
+        const uint64_t writeCount = m_flightRecorderWriteCount.load(AZStd::memory_order_relaxed);
+        FlightRecorderRegion& region = m_flightRecorderRegions[writeCount & (FlightRecorderCapacity - 1)];
+        region = m_flightRecorderStack.back();
+        region.m_endTick = endRegionTime;
+        m_flightRecorderStack.pop_back();
+
+        m_flightRecorderWriteCount.store(writeCount + 1, AZStd::memory_order_release);
+    }
+
+    void CpuTimingLocalStorage::CopyFlightRecording(AZStd::sys_time_t sinceTick, AZStd::vector<FlightRecorderRegion>& outRegions) const
+    {
+        const uint64_t writeCount = m_flightRecorderWriteCount.load(AZStd::memory_order_acquire);
+        if (writeCount == 0)
+        {
+            return;
+        }
+
+        const uint64_t firstIndex = writeCount > FlightRecorderCapacity ? writeCount - FlightRecorderCapacity : 0;
+        AZStd::vector<FlightRecorderRegion> regions;
+        regions.reserve(writeCount - firstIndex);
+        for (uint64_t index = firstIndex; index < writeCount; ++index)
+        {
+            regions.push_back(m_flightRecorderRegions[index & (FlightRecorderCapacity - 1)]);
+        }
+
+        // The owning thread kept recording while the regions were copied, the oldest copies may have been overwritten mid-copy
+        AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+        const uint64_t writeCountAfterCopy = m_flightRecorderWriteCount.load(AZStd::memory_order_relaxed);
+        const uint64_t overwrittenCount = AZStd::min<uint64_t>(
+            writeCountAfterCopy > firstIndex + FlightRecorderCapacity ? writeCountAfterCopy - firstIndex - FlightRecorderCapacity : 0,
+            regions.size());
+
+        outRegions.reserve(regions.size() - overwrittenCount);
+        for (size_t i = overwrittenCount; i < regions.size(); ++i)
+        {
+            if (regions[i].m_endTick >= sinceTick)
+            {
+                outRegions.push_back(regions[i]);
+            }
+        }
+    }
+
+    // --- FlightRecording ---
+
+    namespace
+    {
+        // Size the pending text may reach before it is written to the file
+        constexpr size_t TraceWriteChunkSize = 256 * 1024;
+
+        void AppendJsonString(AZStd::string& output, const char* value)
+        {
+            output += '"';
+            for (const char* c = value ? value : ""; *c != '\0'; ++c)
+            {
+                switch (*c)
+                {
+                case '"':
+                    output += "\\\"";
+                    break;
+                case '\\':
+                    output += "\\\\";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(*c) < 0x20)
+                    {
+                        output += AZStd::string::format("\\u%04x", static_cast<unsigned int>(*c));
+                    }
+                    else
+                    {
+                        output += *c;
+                    }
+                    break;
+                }
+            }
+            output += '"';
+        }
+    } // namespace
+
+    bool SaveFlightRecording(const FlightRecording& recording, const char* outputFilePath)
+    {
+        AZ::IO::SystemFile file;
+        if (!file.Open(outputFilePath, AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Profiler", false, "Failed to open '%s' to save the flight recording.", outputFilePath);
+            return false;
+        }
+
+        bool writeSucceeded = true;
+        AZStd::string pending;
+        pending.reserve(TraceWriteChunkSize + 1024);
+        auto flush = [&file, &pending, &writeSucceeded]()
+        {
+            if (writeSucceeded && !pending.empty())
+            {
+                writeSucceeded = file.Write(pending.data(), pending.size()) == pending.size();
+            }
+            pending.clear();
+        };
+
+        // Trace event timestamps are in microseconds, relative to the oldest region to keep the numbers short
+        AZStd::sys_time_t firstTick = AZStd::numeric_limits<AZStd::sys_time_t>::max();
+        for (const auto& [threadId, regions] : recording.m_threadRegions)
+        {
+            for (const FlightRecorderRegion& region : regions)
+            {
+                firstTick = AZStd::min(firstTick, region.m_startTick);
+            }
+        }
+        for (const TimelineRegion& region : recording.m_timelineRegions)
+        {
+            firstTick = AZStd::min(firstTick, region.m_startTick);
+        }
+        const double microsecondsPerTick = 1000000.0 / static_cast<double>(AZStd::GetTimeTicksPerSecond());
+
+        pending += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool firstEvent = true;
+        for (const auto& [threadId, regions] : recording.m_threadRegions)
+        {
+            const size_t threadHash = AZStd::hash<AZStd::thread_id>{}(threadId);
+            for (const FlightRecorderRegion& region : regions)
+            {
+                pending += firstEvent ? "\n{\"name\":" : ",\n{\"name\":";
+                firstEvent = false;
+                AppendJsonString(pending, region.m_eventName);
+                pending += ",\"cat\":";
+                AppendJsonString(pending, region.m_groupName);
+                pending += AZStd::string::format(",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%zu}",
+                    static_cast<double>(region.m_startTick - firstTick) * microsecondsPerTick,
+                    static_cast<double>(region.m_endTick - region.m_startTick) * microsecondsPerTick,
+                    threadHash);
+
+                if (pending.size() >= TraceWriteChunkSize)
+                {
+                    flush();
+                }
+            }
+        }
+
+        // Timeline tracks are shown as named threads next to the cpu threads, their ids can't collide with the hashed thread ids
+        // in practice, and using the hash of the name keeps each track on a single row
+        AZStd::unordered_map<AZ::Name, size_t> trackIds;
+        for (const TimelineRegion& region : recording.m_timelineRegions)
+        {
+            auto [trackIt, inserted] = trackIds.try_emplace(region.m_trackName, region.m_trackName.GetHash());
+            if (inserted)
+            {
+                pending += firstEvent ? "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0," : ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,";
+                firstEvent = false;
+                pending += AZStd::string::format("\"tid\":%zu,\"args\":{\"name\":", trackIt->second);
+                AppendJsonString(pending, region.m_trackName.GetCStr());
+                pending += "}}";
+            }
+
+            pending += ",\n{\"name\":";
+            AppendJsonString(pending, region.m_regionName.GetCStr());
+            pending += ",\"cat\":";
+            AppendJsonString(pending, region.m_trackName.GetCStr());
+            pending += AZStd::string::format(",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%zu}",
+                static_cast<double>(region.m_startTick - firstTick) * microsecondsPerTick,
+                static_cast<double>(region.m_endTick - region.m_startTick) * microsecondsPerTick,
+                trackIt->second);
+
+            if (pending.size() >= TraceWriteChunkSize)
+            {
+                flush();
+            }
+        }
+
+        pending += "\n]}\n";
+        flush();
+        file.Close();
+
+        AZ_Warning("Profiler", writeSucceeded, "Failed to write the flight recording to '%s'.", outputFilePath);
+        return writeSucceeded;
+    }
+
     // --- CpuProfilingStatisticsSerializer ---
 
     CpuProfilingStatisticsSerializer::CpuProfilingStatisticsSerializer(const AZStd::ring_buffer<TimeRegionMap>& continuousData)
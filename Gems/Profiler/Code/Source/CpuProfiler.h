@@ -57,6 +57,37 @@ namespace Profiler
     using ThreadTimeRegionMap = AZStd::unordered_map<AZStd::string, AZStd::vector<CachedTimeRegion>>;
     using TimeRegionMap = AZStd::unordered_map<AZStd::thread_id, ThreadTimeRegionMap>;
 
+    //! Compact record of a completed region kept by the flight recorder.
+    //! The names are the unformatted pointers passed to the profiler markers, so the same module lifetime restriction as
+    //! CachedTimeRegion::GroupRegionName applies.
+    struct FlightRecorderRegion
+    {
+        const char* m_groupName = nullptr;
+        const char* m_eventName = nullptr;
+        AZStd::sys_time_t m_startTick = 0;
+        AZStd::sys_time_t m_endTick = 0;
+        uint16_t m_stackDepth = 0u;
+    };
+
+    //! Region added with AZ::Debug::ProfilerRequests::AddTimelineRegion, e.g. a GPU pass converted to the CPU clock.
+    struct TimelineRegion
+    {
+        AZ::Name m_trackName;
+        AZ::Name m_regionName;
+        AZStd::sys_time_t m_startTick = 0;
+        AZStd::sys_time_t m_endTick = 0;
+    };
+
+    struct FlightRecording
+    {
+        AZStd::unordered_map<AZStd::thread_id, AZStd::vector<FlightRecorderRegion>> m_threadRegions;
+        AZStd::vector<TimelineRegion> m_timelineRegions;
+    };
+
+    //! Writes a flight recording as a Chrome trace event file, which can be opened with Perfetto or chrome://tracing.
+    //! The file is streamed out in chunks instead of being built as a json document first.
+    bool SaveFlightRecording(const FlightRecording& recording, const char* outputFilePath);
+
     //! Thread local class to keep track of the thread's cached time regions.
     //! Each thread keeps track of its own time regions, which is communicated from the CpuProfiler.
     //! The CpuProfiler is able to request the cached time regions from the CpuTimingLocalStorage.
@@ -75,6 +106,9 @@ namespace Profiler
         // Maximum stack size
         static constexpr uint32_t TimeRegionStackSize = 2048u;
 
+        // Clears the stacks and caches when m_clearContainers was set
+        void ClearContainersIfRequested();
+
         // Adds a region to the stack, gets called each time a region begins
         void RegionStackPushBack(CachedTimeRegion& timeRegion);
 
@@ -90,6 +124,15 @@ namespace Profiler
         // Clears m_cachedTimeRegions and resets m_cachedDataLimitReached flag.
         void ResetCachedData();
 
+        // Flight recorder counterparts of RegionStackPushBack/RegionStackPopBack. These only touch thread owned memory and
+        // never lock, the completed region is written to the ring buffer and published with m_flightRecorderWriteCount.
+        void FlightRecorderPushBack(const char* groupName, const char* eventName);
+        void FlightRecorderPopBack();
+
+        // Copies the recorded regions that ended after @sinceTick. Can be called from any thread, regions the owning thread
+        // overwrote while they were being copied are dropped.
+        void CopyFlightRecording(AZStd::sys_time_t sinceTick, AZStd::vector<FlightRecorderRegion>& outRegions) const;
+
         AZStd::thread_id m_executingThreadId;
         // Keeps track of the current thread's stack depth
         uint32_t m_stackLevel = 0u;
@@ -118,6 +161,16 @@ namespace Profiler
 
         // Keeps track of the first time cached data limit was reached.
         bool m_cachedDataLimitReached = false;
+
+        // Number of completed regions the flight recorder keeps per thread, must be a power of two.
+        static constexpr uint32_t FlightRecorderCapacity = 1u << 14;
+
+        // Ring buffer of completed regions, allocated by the owning thread on its first flight recorder region.
+        AZStd::vector<FlightRecorderRegion> m_flightRecorderRegions;
+        // Total number of regions written to m_flightRecorderRegions, the next region goes to WriteCount % FlightRecorderCapacity.
+        AZStd::atomic_uint64_t m_flightRecorderWriteCount{ 0 };
+        // Regions that began but did not end yet
+        AZStd::fixed_vector<FlightRecorderRegion, TimeRegionStackSize> m_flightRecorderStack;
     };
 
     //! CpuProfiler will keep track of the registered threads, and
@@ -159,6 +212,17 @@ namespace Profiler
         void SetProfilerEnabled(bool enabled);
         bool IsProfilerEnabled() const;
 
+        //! The flight recorder keeps the last regions of every thread in fixed size ring buffers. It is cheap enough to stay
+        //! enabled in shipping builds, so the moments before a hitch can be saved with CaptureFlightRecording.
+        void SetFlightRecorderEnabled(bool enabled);
+        bool IsFlightRecorderEnabled() const;
+
+        //! Returns the regions of every thread and timeline track that ended in the last @seconds.
+        FlightRecording CaptureFlightRecording(float seconds);
+
+        //! Records a region of a timeline track while the flight recorder is enabled.
+        void AddTimelineRegion(AZStd::string_view trackName, AZStd::string_view regionName, AZStd::sys_time_t startTick, AZStd::sys_time_t endTick);
+
         //! AZ::SystemTickBus::Handler overrides
         //! When fired, the profiler collects all profiling data from registered threads and updates
         //! m_timeRegionMap so that the next frame has up-to-date profiling data.
@@ -185,6 +249,14 @@ namespace Profiler
         // Enable/Disables the threads from profiling
         AZStd::atomic_bool m_enabled = false;
 
+        // Enable/Disables the flight recorder, independently from m_enabled
+        AZStd::atomic_bool m_flightRecorderEnabled = false;
+
+        // Timeline regions are added a frame at a time by a single system, so a locked ring buffer is enough for them
+        static constexpr AZStd::size_t MaxTimelineRegions = 16384;
+        AZStd::ring_buffer<TimelineRegion> m_timelineRegions;
+        AZStd::mutex m_timelineRegionsMutex;
+
         // This lock will only be contested when the CpuProfiler's Shutdown() method has been called
         AZStd::shared_mutex m_shutdownMutex;
 
@@ -12,6 +12,7 @@
 
 #include <CpuProfiler.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/ProfilerBus.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/JSON/filereadstream.h>
@@ -142,6 +143,16 @@ namespace Profiler
                 CollectFrameData();
                 CullFrameData();
 
+                if (m_showEBusDispatchStatistics)
+                {
+                    AZ::EBusDispatchStatistics::GetLastFrameStatistics(m_ebusDispatchStatistics);
+                }
+
+                if (m_showLockContentionStatistics)
+                {
+                    AZ::Debug::LockContentionProfiler::GetStatistics(m_lockContentionStatistics);
+                }
+
                 // Only listen to system ticks when the profiler is active
                 if (!AZ::SystemTickBus::Handler::BusIsConnected())
                 {
@@ -162,6 +173,16 @@ namespace Profiler
             {
                 DrawFilePicker();
             }
+
+            if (m_showEBusDispatchStatistics)
+            {
+                DrawEBusDispatchStatistics();
+            }
+
+            if (m_showLockContentionStatistics)
+            {
+                DrawLockContentionStatistics();
+            }
         }
         ImGui::End();
 
@@ -248,6 +269,18 @@ namespace Profiler
                 });
         }
         
+        ImGui::SameLine();
+        if (ImGui::Button("EBus dispatch"))
+        {
+            m_showEBusDispatchStatistics = true;
+        }
+
+        ImGui::SameLine();
+        if (ImGui::Button("Lock contention"))
+        {
+            m_showLockContentionStatistics = true;
+        }
+
         ImGui::SameLine();
         if (ImGui::Button("Reset All"))
         {
@@ -442,6 +475,125 @@ namespace Profiler
         ImGui::End();
     }
 
+    void ImGuiCpuProfiler::DrawEBusDispatchStatistics()
+    {
+        ImGui::SetNextWindowSize({ 900, 400 }, ImGuiCond_Once);
+        if (ImGui::Begin("EBus Dispatch", &m_showEBusDispatchStatistics))
+        {
+            bool enabled = AZ::EBusDispatchStatistics::IsEnabled();
+            if (ImGui::Checkbox("Enabled", &enabled))
+            {
+                // Go through the cvar so that its value stays in sync
+                if (auto console = AZ::Interface<AZ::IConsole>::Get(); console)
+                {
+                    console->PerformCommand(enabled ? "bus_dispatchStatistics true" : "bus_dispatchStatistics false");
+                }
+                m_ebusDispatchStatistics.clear();
+            }
+
+            ImGui::SameLine();
+            if (ImGui::Button("Print"))
+            {
+                AZ::EBusDispatchStatistics::PrintLastFrameStatistics(m_ebusDispatchStatistics.size());
+            }
+
+            ImGui::SameLine();
+            m_ebusDispatchFilter.Draw("Filter");
+
+            const auto flags = ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY;
+            if (ImGui::BeginTable("EBusDispatchTable", 5, flags))
+            {
+                ImGui::TableSetupColumn("Bus");
+                ImGui::TableSetupColumn("Dispatches");
+                ImGui::TableSetupColumn("Handler calls");
+                ImGui::TableSetupColumn("Dispatch (ms)");
+                ImGui::TableSetupColumn("Lock wait (ms)");
+                ImGui::TableHeadersRow();
+
+                for (const auto& busStatistics : m_ebusDispatchStatistics)
+                {
+                    if (!m_ebusDispatchFilter.PassFilter(busStatistics.m_busName.c_str()))
+                    {
+                        continue;
+                    }
+
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", busStatistics.m_busName.c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", static_cast<unsigned long long>(busStatistics.m_dispatchCount));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", static_cast<unsigned long long>(busStatistics.m_handlerCallCount));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", busStatistics.m_dispatchTimeMs);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", busStatistics.m_lockWaitTimeMs);
+                }
+                ImGui::EndTable();
+            }
+        }
+        ImGui::End();
+    }
+
+    void ImGuiCpuProfiler::DrawLockContentionStatistics()
+    {
+        ImGui::SetNextWindowSize({ 900, 400 }, ImGuiCond_Once);
+        if (ImGui::Begin("Lock Contention", &m_showLockContentionStatistics))
+        {
+            bool enabled = AZ::Debug::LockContentionProfiler::IsEnabled();
+            if (ImGui::Checkbox("Enabled", &enabled))
+            {
+                // Go through the cvar so that its value stays in sync
+                if (auto console = AZ::Interface<AZ::IConsole>::Get(); console)
+                {
+                    console->PerformCommand(enabled ? "sys_lockContentionProfiling true" : "sys_lockContentionProfiling false");
+                }
+            }
+
+            ImGui::SameLine();
+            if (ImGui::Button("Reset"))
+            {
+                AZ::Debug::LockContentionProfiler::ResetStatistics();
+                m_lockContentionStatistics.clear();
+            }
+
+            ImGui::SameLine();
+            if (ImGui::Button("Print"))
+            {
+                AZ::Debug::LockContentionProfiler::PrintStatistics(m_lockContentionStatistics.size());
+            }
+
+            const auto flags = ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY;
+            if (ImGui::BeginTable("LockContentionTable", 6, flags))
+            {
+                ImGui::TableSetupColumn("Lock");
+                ImGui::TableSetupColumn("Acquires");
+                ImGui::TableSetupColumn("Contended");
+                ImGui::TableSetupColumn("Wait (ms)");
+                ImGui::TableSetupColumn("Max wait (ms)");
+                ImGui::TableSetupColumn("Hold (ms)");
+                ImGui::TableHeadersRow();
+
+                for (const auto& siteStatistics : m_lockContentionStatistics)
+                {
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", siteStatistics.m_name.c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", static_cast<unsigned long long>(siteStatistics.m_acquireCount));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", static_cast<unsigned long long>(siteStatistics.m_contendedCount));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", siteStatistics.m_waitTimeMs);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", siteStatistics.m_maxWaitTimeMs);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", siteStatistics.m_holdTimeMs);
+                }
+                ImGui::EndTable();
+            }
+        }
+        ImGui::End();
+    }
+
     AZStd::string ImGuiCpuProfiler::GenerateOutputFile(const char* nameHint)
     {
         AZ::IO::FixedMaxPathString captureOutput = AZ::Debug::GetProfilerCaptureLocation();
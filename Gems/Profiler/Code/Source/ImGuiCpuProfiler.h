@@ -13,6 +13,8 @@
 #include <CpuProfiler.h>
 
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Debug/LockContentionProfiler.h>
+#include <AzCore/EBus/DispatchStatistics.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/map.h>
@@ -119,6 +121,12 @@ namespace Profiler
         //! Draws the file picker window.
         void DrawFilePicker();
 
+        //! Draws the window with the per EBus dispatch cost of the last frame.
+        void DrawEBusDispatchStatistics();
+
+        //! Draws the window with the wait and hold times of the profiled locks.
+        void DrawLockContentionStatistics();
+
         //! Draws the CPU profiling visualizer.
         void DrawVisualizer();
 
@@ -236,6 +244,19 @@ namespace Profiler
 
         bool m_showFilePicker = false;
 
+        bool m_showEBusDispatchStatistics = false;
+
+        // EBus dispatch cost of the last frame before pause, the most expensive bus first.
+        AZStd::vector<AZ::EBusDispatchStatistics::BusStatistics> m_ebusDispatchStatistics;
+
+        // Filter for the bus names in the EBus dispatch window
+        ImGuiTextFilter m_ebusDispatchFilter;
+
+        bool m_showLockContentionStatistics = false;
+
+        // Lock contention since the last reset, the longest total wait first.
+        AZStd::vector<AZ::Debug::LockContentionProfiler::SiteStatistics> m_lockContentionStatistics;
+
         // Cached file paths to previous traces on disk, sorted with the most recent trace at the front.
         AZStd::vector<AZ::IO::Path> m_cachedCapturePaths;
 
@@ -9,6 +9,10 @@
 #if defined(IMGUI_ENABLED)
 
 #include <ImGuiHeapMemoryProfiler.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/StackTracer.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzCore/std/sort.h>
 
 namespace Profiler
@@ -21,6 +25,16 @@ namespace Profiler
         HeapProfilerColumnID_CapacityMem
     };
 
+    enum SampleColumnID
+    {
+        SampleColumnID_CallSite = 0,
+        SampleColumnID_LiveBytes,
+        SampleColumnID_LiveSamples,
+        SampleColumnID_EstimatedBytes,
+        SampleColumnID_EstimatedAllocations,
+        SampleColumnID_Samples
+    };
+
     void ImGuiHeapMemoryProfiler::Draw(bool& draw)
     {
         using namespace AZ;
@@ -98,8 +112,235 @@ namespace Profiler
 
                 ImGui::EndTable();
             }
+
+            DrawAllocationSamples();
         }
         ImGui::End();       
     }
+
+    void ImGuiHeapMemoryProfiler::DrawAllocationSamples()
+    {
+        static constexpr size_t KB = 1u << 10;
+
+        if (!ImGui::CollapsingHeader("Allocation Samples"))
+        {
+            return;
+        }
+
+        AZ::AllocationSampler& sampler = AZ::AllocatorManager::Instance().GetAllocationSampler();
+        bool isSampling = sampler.GetSamplingInterval() != 0;
+        ImGui::SetNextItemWidth(150.0f);
+        ImGui::InputInt("Sampling Interval (bytes)", &m_samplingInterval, 0, 0);
+        m_samplingInterval = AZStd::max(m_samplingInterval, 1);
+        ImGui::SameLine();
+        if (ImGui::Checkbox("Sample SystemAllocator", &isSampling))
+        {
+            sampler.SetSamplingInterval(isSampling ? static_cast<size_t>(m_samplingInterval) : 0);
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Capture"))
+        {
+            CaptureAllocationSamples();
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Reset Samples"))
+        {
+            sampler.Reset();
+        }
+
+        ImGui::InputText("##SamplesPath", m_samplesPath, AZ_ARRAY_SIZE(m_samplesPath));
+        ImGui::SameLine();
+        if (ImGui::Button("Load"))
+        {
+            LoadAllocationSamples(m_samplesPath);
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Save"))
+        {
+            // Without a path the samples are written to the dev write storage
+            if (auto console = AZ::Interface<AZ::IConsole>::Get(); console)
+            {
+                AZ::ConsoleCommandContainer arguments;
+                if (m_samplesPath[0] != '\0')
+                {
+                    arguments.push_back(m_samplesPath);
+                }
+                console->PerformCommand("sys_AllocationSamplingDump", arguments);
+            }
+        }
+        if (!m_samplesStatus.empty())
+        {
+            ImGui::TextUnformatted(m_samplesStatus.c_str());
+        }
+
+        ImGui::Text("Call Site Filter (inc, -exc)");
+        ImGui::SameLine();
+        m_callSiteFilter.Draw("##CallSiteFilter");
+
+        const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Sortable | ImGuiTableFlags_Resizable;
+        constexpr int NumColumns = 6;
+        if (!ImGui::BeginTable("samples", NumColumns, flags))
+        {
+            return;
+        }
+        ImGui::TableSetupColumn("Call Site", ImGuiTableColumnFlags_WidthStretch, 0.f, SampleColumnID_CallSite);
+        ImGui::TableSetupColumn("Live (kB)", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_PreferSortDescending, 0.f, SampleColumnID_LiveBytes);
+        ImGui::TableSetupColumn("Live Samples", ImGuiTableColumnFlags_WidthFixed, 0.f, SampleColumnID_LiveSamples);
+        ImGui::TableSetupColumn("Total (kB)", ImGuiTableColumnFlags_WidthFixed, 0.f, SampleColumnID_EstimatedBytes);
+        ImGui::TableSetupColumn("Allocations", ImGuiTableColumnFlags_WidthFixed, 0.f, SampleColumnID_EstimatedAllocations);
+        ImGui::TableSetupColumn("Samples", ImGuiTableColumnFlags_WidthFixed, 0.f, SampleColumnID_Samples);
+        ImGui::TableHeadersRow();
+
+        if (ImGuiTableSortSpecs* sortsSpecs = ImGui::TableGetSortSpecs())
+        {
+            AZStd::sort(
+                m_callSites.begin(),
+                m_callSites.end(),
+                [sortsSpecs](const SampledCallSite& lhs, const SampledCallSite& rhs)
+                {
+                    const SampledCallSite* left = &lhs;
+                    const SampledCallSite* right = &rhs;
+                    if (sortsSpecs->Specs->SortDirection == ImGuiSortDirection_Descending)
+                    {
+                        AZStd::swap(left, right);
+                    }
+
+                    switch (sortsSpecs->Specs->ColumnUserID)
+                    {
+                    case SampleColumnID_CallSite:
+                        return (left->m_stackTrace.empty() ? AZStd::string() : left->m_stackTrace.front()) <
+                            (right->m_stackTrace.empty() ? AZStd::string() : right->m_stackTrace.front());
+                    case SampleColumnID_LiveBytes:
+                        return left->m_liveEstimatedBytes < right->m_liveEstimatedBytes;
+                    case SampleColumnID_LiveSamples:
+                        return left->m_liveSampleCount < right->m_liveSampleCount;
+                    case SampleColumnID_EstimatedBytes:
+                        return left->m_estimatedBytes < right->m_estimatedBytes;
+                    case SampleColumnID_EstimatedAllocations:
+                        return left->m_estimatedAllocations < right->m_estimatedAllocations;
+                    case SampleColumnID_Samples:
+                        return left->m_sampleCount < right->m_sampleCount;
+                    default:
+                        return false;
+                    }
+                });
+            sortsSpecs->SpecsDirty = false;
+        }
+
+        for (size_t callSiteIndex = 0; callSiteIndex < m_callSites.size(); ++callSiteIndex)
+        {
+            const SampledCallSite& callSite = m_callSites[callSiteIndex];
+            const char* topFrame = callSite.m_stackTrace.empty() ? "<unknown>" : callSite.m_stackTrace.front().c_str();
+            const bool passesFilter = AZStd::any_of(
+                callSite.m_stackTrace.begin(),
+                callSite.m_stackTrace.end(),
+                [this](const AZStd::string& frame)
+                {
+                    return m_callSiteFilter.PassFilter(frame.c_str());
+                });
+            if (!passesFilter && !callSite.m_stackTrace.empty())
+            {
+                continue;
+            }
+
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::PushID(static_cast<int>(callSiteIndex));
+            if (ImGui::TreeNode(topFrame))
+            {
+                for (size_t frameIndex = 1; frameIndex < callSite.m_stackTrace.size(); ++frameIndex)
+                {
+                    ImGui::TextUnformatted(callSite.m_stackTrace[frameIndex].c_str());
+                }
+                ImGui::TreePop();
+            }
+            ImGui::PopID();
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", static_cast<float>(callSite.m_liveEstimatedBytes) / KB);
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", callSite.m_liveSampleCount);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", static_cast<float>(callSite.m_estimatedBytes) / KB);
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", callSite.m_estimatedAllocations);
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", callSite.m_sampleCount);
+        }
+        ImGui::EndTable();
+    }
+
+    void ImGuiHeapMemoryProfiler::CaptureAllocationSamples()
+    {
+        const AZ::AllocationSampler::CallSiteVector callSites = AZ::AllocatorManager::Instance().GetAllocationSampler().GetCallSites();
+
+        m_callSites.clear();
+        m_callSites.reserve(callSites.size());
+        AZ::Debug::SymbolStorage::StackLine lines[AZ::AllocationSampler::MaxStackFrames];
+        for (const AZ::AllocationSampler::CallSite& callSite : callSites)
+        {
+            SampledCallSite& sampledCallSite = m_callSites.emplace_back();
+            sampledCallSite.m_sampleCount = callSite.m_sampleCount;
+            sampledCallSite.m_estimatedAllocations = callSite.m_estimatedAllocations;
+            sampledCallSite.m_estimatedBytes = callSite.m_estimatedBytes;
+            sampledCallSite.m_liveSampleCount = callSite.m_liveSampleCount;
+            sampledCallSite.m_liveEstimatedBytes = callSite.m_liveEstimatedBytes;
+
+            AZ::Debug::SymbolStorage::DecodeFrames(callSite.m_stackTrace, callSite.m_stackFrameCount, lines);
+            for (unsigned int frameIndex = 0; frameIndex < callSite.m_stackFrameCount; ++frameIndex)
+            {
+                sampledCallSite.m_stackTrace.emplace_back(lines[frameIndex]);
+            }
+        }
+        m_samplesStatus = AZStd::string::format("Captured %zu call sites from the running application", m_callSites.size());
+    }
+
+    void ImGuiHeapMemoryProfiler::LoadAllocationSamples(const char* samplesPath)
+    {
+        auto readResult = AZ::JsonSerializationUtils::ReadJsonFile(samplesPath);
+        if (!readResult.IsSuccess())
+        {
+            m_samplesStatus = readResult.TakeError();
+            return;
+        }
+
+        const rapidjson::Document& document = readResult.GetValue();
+        if (!document.IsObject() || !document.HasMember("CallSites") || !document["CallSites"].IsArray())
+        {
+            m_samplesStatus = AZStd::string::format("%s is not an allocation sample file, it doesn't have a CallSites array", samplesPath);
+            return;
+        }
+
+        auto getU64 = [](const rapidjson::Value& object, const char* name) -> AZ::u64
+        {
+            auto member = object.FindMember(name);
+            return member != object.MemberEnd() && member->value.IsUint64() ? member->value.GetUint64() : 0;
+        };
+
+        m_callSites.clear();
+        for (const rapidjson::Value& callSiteValue : document["CallSites"].GetArray())
+        {
+            if (!callSiteValue.IsObject())
+            {
+                continue;
+            }
+            SampledCallSite& sampledCallSite = m_callSites.emplace_back();
+            sampledCallSite.m_sampleCount = getU64(callSiteValue, "SampleCount");
+            sampledCallSite.m_estimatedAllocations = getU64(callSiteValue, "EstimatedAllocations");
+            sampledCallSite.m_estimatedBytes = getU64(callSiteValue, "EstimatedBytes");
+            sampledCallSite.m_liveSampleCount = getU64(callSiteValue, "LiveSampleCount");
+            sampledCallSite.m_liveEstimatedBytes = getU64(callSiteValue, "LiveEstimatedBytes");
+            if (auto stackTrace = callSiteValue.FindMember("StackTrace"); stackTrace != callSiteValue.MemberEnd() && stackTrace->value.IsArray())
+            {
+                for (const rapidjson::Value& frame : stackTrace->value.GetArray())
+                {
+                    if (frame.IsString())
+                    {
+                        sampledCallSite.m_stackTrace.emplace_back(frame.GetString(), frame.GetStringLength());
+                    }
+                }
+            }
+        }
+        m_samplesStatus = AZStd::string::format("Loaded %zu call sites from %s", m_callSites.size(), samplesPath);
+    }
 }
 #endif
@@ -10,7 +10,10 @@
 
 #if defined(IMGUI_ENABLED)
 #include <imgui/imgui.h>
+#include <AzCore/IO/Path/Path_fwd.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
 
 namespace Profiler
 {
@@ -24,7 +27,28 @@ namespace Profiler
         void Draw(bool& draw);
 
     private:
+        //! A call site of the AZ::AllocationSampler, captured from the running application or loaded from a sample file
+        struct SampledCallSite
+        {
+            AZ::u64 m_sampleCount = 0;
+            AZ::u64 m_estimatedAllocations = 0;
+            AZ::u64 m_estimatedBytes = 0;
+            AZ::u64 m_liveSampleCount = 0;
+            AZ::u64 m_liveEstimatedBytes = 0;
+            AZStd::vector<AZStd::string> m_stackTrace;
+        };
+
+        void DrawAllocationSamples();
+        void CaptureAllocationSamples();
+        void LoadAllocationSamples(const char* samplesPath);
+
         ImGuiTextFilter m_filter;
+
+        int m_samplingInterval = static_cast<int>(AZ::AllocationSampler::DefaultSamplingInterval);
+        char m_samplesPath[AZ::IO::MaxPathLength] = { '\0' };
+        AZStd::string m_samplesStatus;
+        AZStd::vector<SampledCallSite> m_callSites;
+        ImGuiTextFilter m_callSiteFilter;
     };
 }
 #endif
@@ -8,17 +8,174 @@
 
 #include <ProfilerSystemComponent.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/IStreamer.h>
+#include <AzCore/Memory/AllocatorManager.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzCore/Serialization/Json/JsonSerializationSettings.h>
 #include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/algorithm.h>
 
 namespace Profiler
 {
     static constexpr AZ::Crc32 profilerServiceCrc = AZ_CRC_CE("ProfilerService");
 
+    // The active component, used by the flight recorder console commands
+    static ProfilerSystemComponent* s_profilerSystemComponent = nullptr;
+
+    AZ_CVAR(bool, profiler_flightRecorder, false,
+        [](const bool& enabled)
+        {
+            if (auto* cpuProfiler = azrtti_cast<CpuProfiler*>(AZ::Interface<AZ::Debug::Profiler>::Get()))
+            {
+                cpuProfiler->SetFlightRecorderEnabled(enabled);
+            }
+        },
+        AZ::ConsoleFunctorFlags::DontReplicate,
+        "Keeps the last profiler regions of every thread in fixed size ring buffers so they can be saved with profiler_saveFlightRecording or on a hitch");
+    AZ_CVAR(float, profiler_flightRecorderSeconds, 5.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "How many seconds of the flight recorder are saved");
+    AZ_CVAR(float, profiler_flightRecorderHitchMs, 0.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Saves a hitch capture when a frame takes longer than this many milliseconds, 0 disables it. "
+        "Hitches closer than profiler_flightRecorderSeconds to the previous saved one are ignored");
+    AZ_CVAR(float, profiler_flightRecorderHitchMedianMultiple, 0.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Saves a hitch capture when a frame takes longer than this multiple of the median of the recent frames, 0 disables it. "
+        "Unlike profiler_flightRecorderHitchMs this follows the usual frame time of the current level and hardware");
+
+    // Number of recent frames the median frame time is computed from
+    static constexpr size_t HitchFrameHistorySize = 120;
+
+    static void AppendStatisticValue(AZStd::string& text, const AZ::IO::Statistic::Value& value)
+    {
+        auto visitor = [&text](auto&& value)
+        {
+            using Type = AZStd::decay_t<decltype(value)>;
+            if constexpr (AZStd::is_same_v<Type, bool>)
+            {
+                text += value ? "true" : "false";
+            }
+            else if constexpr (AZStd::is_same_v<Type, double>)
+            {
+                text += AZStd::string::format("%f", value);
+            }
+            else if constexpr (AZStd::is_same_v<Type, AZ::s64>)
+            {
+                text += AZStd::string::format("%lld", aznumeric_cast<long long>(value));
+            }
+            else if constexpr (AZStd::is_same_v<Type, AZ::IO::Statistic::FloatRange> || AZStd::is_same_v<Type, AZ::IO::Statistic::PercentageRange>)
+            {
+                text += AZStd::string::format("%f (min %f, max %f)", value.m_value, value.m_min, value.m_max);
+            }
+            else if constexpr (AZStd::is_same_v<Type, AZ::IO::Statistic::IntegerRange>)
+            {
+                text += AZStd::string::format("%lld (min %lld, max %lld)", aznumeric_cast<long long>(value.m_value),
+                    aznumeric_cast<long long>(value.m_min), aznumeric_cast<long long>(value.m_max));
+            }
+            else if constexpr (AZStd::is_same_v<Type, AZ::IO::Statistic::Percentage>)
+            {
+                text += AZStd::string::format("%.2f%%", value.m_value * 100.0);
+            }
+            else if constexpr (AZStd::is_same_v<Type, AZ::IO::Statistic::ByteSize>)
+            {
+                text += AZStd::string::format("%llu bytes", aznumeric_cast<unsigned long long>(value.m_value));
+            }
+            else if constexpr (AZStd::is_same_v<Type, AZ::IO::Statistic::ByteSizeRange>)
+            {
+                text += AZStd::string::format("%llu bytes (min %llu, max %llu)", aznumeric_cast<unsigned long long>(value.m_value),
+                    aznumeric_cast<unsigned long long>(value.m_min), aznumeric_cast<unsigned long long>(value.m_max));
+            }
+            else if constexpr (AZStd::is_same_v<Type, AZ::IO::Statistic::Time>)
+            {
+                text += AZStd::string::format("%lld us", aznumeric_cast<long long>(value.m_value.count()));
+            }
+            else if constexpr (AZStd::is_same_v<Type, AZ::IO::Statistic::TimeRange>)
+            {
+                text += AZStd::string::format("%lld us (min %lld, max %lld)", aznumeric_cast<long long>(value.m_value.count()),
+                    aznumeric_cast<long long>(value.m_min.count()), aznumeric_cast<long long>(value.m_max.count()));
+            }
+            else if constexpr (AZStd::is_same_v<Type, AZ::IO::Statistic::BytesPerSecond>)
+            {
+                text += AZStd::string::format("%.0f bytes/s", value.m_value);
+            }
+            else if constexpr (AZStd::is_same_v<Type, AZStd::string> || AZStd::is_same_v<Type, AZStd::string_view>)
+            {
+                text += value;
+            }
+        };
+        AZStd::visit(visitor, value);
+    }
+
+    //! Collects the state of the other subsystems at the time of a hitch, so the report does not have to be pieced together
+    //! from separate tools afterwards.
+    static AZStd::string BuildHitchReport(float frameMs, float medianFrameMs)
+    {
+        AZStd::string report = AZStd::string::format("Frame time: %.3f ms\nMedian of the last %zu frames: %.3f ms\n",
+            frameMs, HitchFrameHistorySize, medianFrameMs);
+
+        if (AZ::AllocatorManager::IsReady())
+        {
+            size_t usedBytes = 0;
+            size_t reservedBytes = 0;
+            AZStd::vector<AZ::AllocatorManager::AllocatorStats> allocatorStats;
+            AZ::AllocatorManager::Instance().GetAllocatorStats(usedBytes, reservedBytes, &allocatorStats);
+
+            report += AZStd::string::format("\n[Allocators]\nTotal allocated: %zu bytes\nTotal capacity: %zu bytes\n", usedBytes, reservedBytes);
+            for (const AZ::AllocatorManager::AllocatorStats& stats : allocatorStats)
+            {
+                report += AZStd::string::format("%s (%s): allocated %zu bytes, capacity %zu bytes\n",
+                    stats.m_name.c_str(), stats.m_parentName.c_str(), stats.m_allocatedBytes, stats.m_capacityBytes);
+            }
+        }
+
+        if (auto* streamer = AZ::Interface<AZ::IO::IStreamer>::Get())
+        {
+            AZStd::vector<AZ::IO::Statistic> streamerStats;
+            streamer->CollectStatistics(streamerStats);
+
+            report += "\n[Streamer]\n";
+            for (const AZ::IO::Statistic& stat : streamerStats)
+            {
+                report += AZStd::string::format("%.*s/%.*s: ", AZ_STRING_ARG(stat.GetOwner()), AZ_STRING_ARG(stat.GetName()));
+                AppendStatisticValue(report, stat.GetValue());
+                report += '\n';
+            }
+        }
+
+        return report;
+    }
+
+    static AZStd::string GenerateFlightRecordingOutputFile(const char* nameHint)
+    {
+        const AZ::IO::FixedMaxPathString captureOutput = AZ::Debug::GetProfilerCaptureLocation();
+
+        // Not .json, the ImGui profiler lists the .json files of the capture folder as CpuProfilingStatisticsSerializer captures
+        const AZ::IO::FixedMaxPathString filePath =
+            AZ::IO::FixedMaxPathString::format("%s/cpu_%s_%lld.trace", captureOutput.c_str(), nameHint, AZStd::GetTimeNowSecond());
+
+        AZ::IO::FixedMaxPath resolvedPath;
+        AZ::IO::FileIOBase::GetInstance()->ResolvePath(resolvedPath, filePath.c_str());
+        return resolvedPath.String();
+    }
+
+    static void profiler_saveFlightRecording(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (s_profilerSystemComponent == nullptr)
+        {
+            AZ_Warning("ProfilerSystemComponent", false, "The profiler is not active");
+            return;
+        }
+
+        s_profilerSystemComponent->SaveFlightRecording(
+            arguments.empty() ? GenerateFlightRecordingOutputFile("flight") : AZStd::string(arguments[0]));
+    }
+    AZ_CONSOLEFREEFUNC(profiler_saveFlightRecording, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Saves the last profiler_flightRecorderSeconds of the flight recorder as a Chrome trace event file that Perfetto can open: [outputFile]");
+
     struct DelayedFunction
     {
         using func_type = AZStd::function<void()>;
@@ -144,10 +301,22 @@ namespace Profiler
     void ProfilerSystemComponent::Activate()
     {
         m_cpuProfiler.Init();
+        m_cpuProfiler.SetFlightRecorderEnabled(profiler_flightRecorder);
+
+        s_profilerSystemComponent = this;
+        m_lastSystemTick = 0;
+        m_recentFrameMs.set_capacity(HitchFrameHistorySize);
+        AZ::SystemTickBus::Handler::BusConnect();
     }
 
     void ProfilerSystemComponent::Deactivate()
     {
+        AZ::SystemTickBus::Handler::BusDisconnect();
+        if (s_profilerSystemComponent == this)
+        {
+            s_profilerSystemComponent = nullptr;
+        }
+
         m_cpuProfiler.Shutdown();
 
         // Block deactivation until the IO thread has finished serializing the CPU data
@@ -249,4 +418,130 @@ namespace Profiler
     {
         return m_cpuProfiler.IsContinuousCaptureInProgress();
     }
+
+    void ProfilerSystemComponent::AddTimelineRegion(
+        AZStd::string_view trackName, AZStd::string_view regionName, AZStd::sys_time_t startTick, AZStd::sys_time_t endTick)
+    {
+        m_cpuProfiler.AddTimelineRegion(trackName, regionName, startTick, endTick);
+    }
+
+    bool ProfilerSystemComponent::SaveFlightRecording(AZStd::string outputFilePath)
+    {
+        return SaveFlightRecording(AZStd::move(outputFilePath), {}, {});
+    }
+
+    bool ProfilerSystemComponent::SaveFlightRecording(AZStd::string outputFilePath, AZStd::string reportFilePath, AZStd::string report)
+    {
+        if (!m_cpuProfiler.IsFlightRecorderEnabled())
+        {
+            AZ_TracePrintf("ProfilerSystemComponent", "Cannot save the flight recording - profiler_flightRecorder is disabled\n");
+            return false;
+        }
+
+        bool expected = false;
+        if (!m_cpuDataSerializationInProgress.compare_exchange_strong(expected, true))
+        {
+            AZ_TracePrintf(
+                "ProfilerSystemComponent",
+                "Cannot save the flight recording - another serialization is currently in progress\n");
+            return false;
+        }
+
+        // Copying the ring buffers is quick, writing them out is left to the IO thread
+        FlightRecording recording = m_cpuProfiler.CaptureFlightRecording(profiler_flightRecorderSeconds);
+
+        auto threadIoFunction =
+            [recording = AZStd::move(recording), filePath = AZStd::move(outputFilePath), reportFilePath = AZStd::move(reportFilePath),
+                report = AZStd::move(report), &flag = m_cpuDataSerializationInProgress]()
+            {
+                bool saved = Profiler::SaveFlightRecording(recording, filePath.c_str());
+                if (saved && !reportFilePath.empty())
+                {
+                    const auto reportResult = AZ::Utils::WriteFile(report, reportFilePath);
+                    AZ_Warning("ProfilerSystemComponent", reportResult.IsSuccess(), "Failed to save the hitch report to file '%s'. Error: %s",
+                        reportFilePath.c_str(), reportResult.IsSuccess() ? "" : reportResult.GetError().c_str());
+                    saved = reportResult.IsSuccess();
+                }
+
+                AZ_Printf("ProfilerSystemComponent", saved ? "Flight recording was saved to file [%s]\n" : "Failed to save the flight recording to file [%s]\n",
+                    filePath.c_str());
+
+                AZ::Debug::ProfilerNotificationBus::Broadcast(&AZ::Debug::ProfilerNotificationBus::Events::OnCaptureFinished,
+                    saved, filePath);
+                flag.store(false);
+            };
+
+        // m_cpuDataSerializationInProgress was false, so joining a previous IO thread will not block.
+        if (m_cpuDataSerializationThread.joinable())
+        {
+            m_cpuDataSerializationThread.join();
+        }
+
+        m_cpuDataSerializationThread = AZStd::thread(threadIoFunction);
+        return true;
+    }
+
+    bool ProfilerSystemComponent::SaveHitchCapture(float frameMs, float medianFrameMs)
+    {
+        // Each hitch gets its own folder with the cpu regions and the state of the other subsystems
+        const AZ::IO::FixedMaxPathString captureOutput = AZ::Debug::GetProfilerCaptureLocation();
+        const AZ::IO::FixedMaxPathString bundlePath =
+            AZ::IO::FixedMaxPathString::format("%s/hitch_%lld", captureOutput.c_str(), AZStd::GetTimeNowSecond());
+
+        AZ::IO::FixedMaxPath resolvedBundlePath;
+        AZ::IO::FileIOBase::GetInstance()->ResolvePath(resolvedBundlePath, bundlePath.c_str());
+
+        return SaveFlightRecording(
+            (resolvedBundlePath / "cpu.trace").String(),
+            (resolvedBundlePath / "hitch.txt").String(),
+            BuildHitchReport(frameMs, medianFrameMs));
+    }
+
+    void ProfilerSystemComponent::OnSystemTick()
+    {
+        const AZStd::sys_time_t now = AZStd::GetTimeNowTicks();
+        const AZStd::sys_time_t lastSystemTick = m_lastSystemTick;
+        m_lastSystemTick = now;
+
+        const float hitchMs = profiler_flightRecorderHitchMs;
+        const float hitchMedianMultiple = profiler_flightRecorderHitchMedianMultiple;
+        if ((hitchMs <= 0.0f && hitchMedianMultiple <= 0.0f) || lastSystemTick == 0 || !m_cpuProfiler.IsFlightRecorderEnabled())
+        {
+            m_recentFrameMs.clear();
+            return;
+        }
+
+        const float ticksPerMs = static_cast<float>(AZStd::GetTimeTicksPerSecond()) / 1000.0f;
+        const float frameMs = static_cast<float>(now - lastSystemTick) / ticksPerMs;
+
+        // The median of the frames before this one, so the hitch does not raise its own threshold
+        float medianFrameMs = 0.0f;
+        if (!m_recentFrameMs.empty())
+        {
+            AZStd::vector<float> sortedFrameMs(m_recentFrameMs.begin(), m_recentFrameMs.end());
+            AZStd::nth_element(sortedFrameMs.begin(), sortedFrameMs.begin() + sortedFrameMs.size() / 2, sortedFrameMs.end());
+            medianFrameMs = sortedFrameMs[sortedFrameMs.size() / 2];
+        }
+
+        m_recentFrameMs.push_back(frameMs);
+
+        const bool aboveThreshold = hitchMs > 0.0f && frameMs >= hitchMs;
+        const bool aboveMedian = hitchMedianMultiple > 0.0f && m_recentFrameMs.full() && frameMs >= medianFrameMs * hitchMedianMultiple;
+        if (!aboveThreshold && !aboveMedian)
+        {
+            return;
+        }
+
+        const float msSinceLastCapture = static_cast<float>(now - m_lastHitchCaptureTick) / ticksPerMs;
+        if (m_lastHitchCaptureTick != 0 && msSinceLastCapture < profiler_flightRecorderSeconds * 1000.0f)
+        {
+            return;
+        }
+
+        AZ_TracePrintf("ProfilerSystemComponent", "Frame took %.1f ms (median %.1f ms), saving a hitch capture\n", frameMs, medianFrameMs);
+        if (SaveHitchCapture(frameMs, medianFrameMs))
+        {
+            m_lastHitchCaptureTick = now;
+        }
+    }
 } // namespace Profiler
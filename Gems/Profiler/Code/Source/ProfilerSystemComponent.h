@@ -11,7 +11,9 @@
 #include <CpuProfiler.h>
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/std/containers/ring_buffer.h>
 #include <AzCore/std/parallel/thread.h>
 
 namespace Profiler
@@ -19,6 +21,7 @@ namespace Profiler
     class ProfilerSystemComponent
         : public AZ::Component
         , protected AZ::Debug::ProfilerRequests
+        , protected AZ::SystemTickBus::Handler
     {
     public:
         AZ_COMPONENT(ProfilerSystemComponent, "{3f52c1d7-d920-4781-8ed7-88077ec4f305}");
@@ -33,6 +36,9 @@ namespace Profiler
         ProfilerSystemComponent();
         ~ProfilerSystemComponent();
 
+        //! Writes the last profiler_flightRecorderSeconds of the flight recorder to @outputFilePath on the IO thread.
+        bool SaveFlightRecording(AZStd::string outputFilePath);
+
     protected:
         // AZ::Component interface implementation
         void Activate() override;
@@ -45,7 +51,16 @@ namespace Profiler
         bool StartCapture(AZStd::string outputFilePath) override;
         bool EndCapture() override;
         bool IsCaptureInProgress() const override;
+        void AddTimelineRegion(AZStd::string_view trackName, AZStd::string_view regionName, AZStd::sys_time_t startTick, AZStd::sys_time_t endTick) override;
+
+        // AZ::SystemTickBus::Handler interface implementation
+        void OnSystemTick() override;
 
+        // Writes the flight recording and, when @reportFilePath is set, @report next to it on the IO thread
+        bool SaveFlightRecording(AZStd::string outputFilePath, AZStd::string reportFilePath, AZStd::string report);
+
+        // Saves the flight recording with a report of the other subsystems into a new folder of the capture location
+        bool SaveHitchCapture(float frameMs, float medianFrameMs);
 
         AZStd::thread m_cpuDataSerializationThread;
         AZStd::atomic_bool m_cpuDataSerializationInProgress{ false };
@@ -54,6 +69,11 @@ namespace Profiler
 
         CpuProfiler m_cpuProfiler;
         AZStd::string m_captureFile;
+
+        // Used to detect hitches for the flight recorder
+        AZStd::sys_time_t m_lastSystemTick = 0;
+        AZStd::sys_time_t m_lastHitchCaptureTick = 0;
+        AZStd::ring_buffer<float> m_recentFrameMs;
     };
 
 } // namespace Profiler
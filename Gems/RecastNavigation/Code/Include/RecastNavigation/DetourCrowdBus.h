@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/ComponentBus.h>
+#include <AzCore/Math/Vector3.h>
+
+namespace RecastNavigation
+{
+    //! Interface for the crowd simulation API.
+    //! Agents are entities moved over the navigation mesh by the crowd, which steers them towards their targets
+    //! while avoiding each other.
+    class DetourCrowdRequests
+        : public AZ::ComponentBus
+    {
+    public:
+        //! An entity with a navigation mesh is required to simulate a crowd.
+        //! @param navMeshEntity an entity with @RecastNavigationMeshComponent
+        virtual void SetNavigationMeshEntity(AZ::EntityId navMeshEntity) = 0;
+
+        //! An entity with a navigation mesh is required to simulate a crowd.
+        //! @return the associated entity with @RecastNavigationMeshComponent
+        virtual AZ::EntityId GetNavigationMeshEntity() const = 0;
+
+        //! Adds an entity to the crowd, starting from its current world position.
+        //! @param agentEntity The entity to move with the crowd. Its translation is set by the crowd every frame.
+        //! @return false if the entity is already in the crowd or the crowd is full.
+        virtual bool AddAgent(AZ::EntityId agentEntity) = 0;
+
+        //! Removes an entity from the crowd. The entity stays where it is.
+        //! @param agentEntity An entity previously added with @AddAgent.
+        virtual void RemoveAgent(AZ::EntityId agentEntity) = 0;
+
+        //! Sets the world position the agent should move to. The crowd finds the path to it.
+        //! @param agentEntity An entity previously added with @AddAgent.
+        //! @param targetWorldPosition The position to move to.
+        //! @return false if the entity isn't in the crowd.
+        virtual bool SetAgentTarget(AZ::EntityId agentEntity, const AZ::Vector3& targetWorldPosition) = 0;
+
+        //! Stops the agent where it is.
+        //! @param agentEntity An entity previously added with @AddAgent.
+        virtual void ResetAgentTarget(AZ::EntityId agentEntity) = 0;
+
+        //! @param agentEntity An entity previously added with @AddAgent.
+        //! @return the velocity of the agent from the last crowd update.
+        virtual AZ::Vector3 GetAgentVelocity(AZ::EntityId agentEntity) const = 0;
+
+        //! @return the number of agents in the crowd.
+        virtual int GetAgentCount() const = 0;
+    };
+
+    //! Request EBus for a crowd simulation component.
+    using DetourCrowdRequestBus = AZ::EBus<DetourCrowdRequests>;
+} // namespace RecastNavigation
@@ -11,6 +11,7 @@
 #include <AzCore/Component/ComponentBus.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/functional.h>
 
 namespace RecastNavigation
 {
@@ -38,6 +39,20 @@ namespace RecastNavigation
         //! @param toWorldPosition The end point of the path to find.
         //! @return If a path is found, returns a vector of waypoints. An empty vector is returned if a path was not found.
         virtual AZStd::vector<AZ::Vector3> FindPathBetweenPositions(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) = 0;
+
+        //! Called on the main thread once an async path request is done.
+        //! @param waypoints If a path was found, the waypoints of the path. Otherwise an empty vector.
+        using PathFoundCallback = AZStd::function<void(AZStd::vector<AZ::Vector3> waypoints)>;
+
+        //! Non-blocking variant of @FindPathBetweenPositions.
+        //! Requests are queued and solved on a worker thread with sliced path finding, a limited number of search iterations
+        //! per frame, so that long searches are spread over several frames instead of stalling the caller.
+        //! Requests still pending when the component deactivates are dropped without calling their callback.
+        //! @param fromWorldPosition The starting point of the path.
+        //! @param toWorldPosition The end point of the path to find.
+        //! @param callback Called on the main thread with the waypoints of the path, or an empty vector if a path was not found.
+        virtual void FindPathBetweenPositionsAsync(
+            const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition, PathFoundCallback callback) = 0;
     };
 
     //! Request EBus for a path finding component.
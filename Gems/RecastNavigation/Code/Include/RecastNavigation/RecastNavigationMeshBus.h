@@ -10,6 +10,7 @@
 
 #include <DetourNavMesh.h>
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/Math/Aabb.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <RecastNavigation/NavMeshQuery.h>
 #include <RecastNavigation/RecastSmartPointer.h>
@@ -29,6 +30,18 @@ namespace RecastNavigation
         //! @returns false if another update operation is already in progress
         virtual bool UpdateNavigationMeshAsync() = 0;
 
+        //! Re-calculates only the tiles of the navigation mesh that overlap a changed region, such as the bounds of a collider
+        //! that moved, and swaps them into the navigation mesh. Tiles whose border overlaps the region are included,
+        //! so that they stay connected to their neighbors. Blocking call.
+        //! @param dirtyRegion the world region that changed
+        //! @returns false if another update operation is already in progress or the region is invalid
+        virtual bool UpdateNavigationMeshRegionBlockUntilCompleted(const AZ::Aabb& dirtyRegion) = 0;
+
+        //! Async variant of @UpdateNavigationMeshRegionBlockUntilCompleted. Notifies when completed using @RecastNavigationMeshNotificationBus.
+        //! @param dirtyRegion the world region that changed
+        //! @returns false if another update operation is already in progress or the region is invalid
+        virtual bool UpdateNavigationMeshRegionAsync(const AZ::Aabb& dirtyRegion) = 0;
+
         //! @returns the underlying navigation objects with the associated synchronization object.
         virtual AZStd::shared_ptr<NavMeshQuery> GetNavigationObject() = 0;
     };
@@ -34,6 +34,19 @@ namespace RecastNavigation
         virtual bool CollectGeometryAsync(float tileSize, float borderSize,
             AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) = 0;
 
+        //! Same as @CollectGeometry, but only collects the tiles whose volume, including the border, overlaps @dirtyRegion.
+        //! The tiles keep the coordinates they have in the full tile grid of the configured area.
+        //! @param dirtyRegion the world region that changed
+        //! @returns a container with triangle data for each tile overlapping the region.
+        virtual AZStd::vector<AZStd::shared_ptr<TileGeometry>> CollectGeometryWithinRegion(
+            float tileSize, float borderSize, const AZ::Aabb& dirtyRegion) = 0;
+
+        //! Same as @CollectGeometryAsync, but only collects the tiles whose volume, including the border, overlaps @dirtyRegion.
+        //! @param dirtyRegion the world region that changed
+        //! @returns true if an async operation was scheduled, false otherwise
+        virtual bool CollectGeometryWithinRegionAsync(float tileSize, float borderSize, const AZ::Aabb& dirtyRegion,
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) = 0;
+
         //! A navigation mesh is made up of tiles. Each tile is a square of the same size.
         //! @param tileSize size of square tiles that make up a navigation mesh.
         //! @returns number of tiles that would be necessary to the cover the required area provided by @GetWorldBounds.
@@ -0,0 +1,394 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <Components/DetourCrowdComponent.h>
+#include <RecastNavigation/RecastHelpers.h>
+#include <RecastNavigation/RecastNavigationMeshBus.h>
+
+AZ_DECLARE_BUDGET(Navigation);
+
+namespace RecastNavigation
+{
+    namespace
+    {
+        // A long frame would make the agents jump through each other, so the crowd never steps further than this at once.
+        constexpr float MaxCrowdDeltaTime = 0.25f;
+    }
+
+    DetourCrowdComponent::DetourCrowdComponent(AZ::EntityId navQueryEntityId, int maxAgents, float agentRadius, float agentHeight,
+        float maxAcceleration, float maxSpeed)
+        : m_navQueryEntityId(navQueryEntityId)
+        , m_maxAgents(maxAgents)
+        , m_agentRadius(agentRadius)
+        , m_agentHeight(agentHeight)
+        , m_maxAcceleration(maxAcceleration)
+        , m_maxSpeed(maxSpeed)
+    {
+    }
+
+    void DetourCrowdComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serialize = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serialize->Class<DetourCrowdComponent, AZ::Component>()
+                ->Field("Navigation Query Entity", &DetourCrowdComponent::m_navQueryEntityId)
+                ->Field("Max Agents", &DetourCrowdComponent::m_maxAgents)
+                ->Field("Agent Radius", &DetourCrowdComponent::m_agentRadius)
+                ->Field("Agent Height", &DetourCrowdComponent::m_agentHeight)
+                ->Field("Max Acceleration", &DetourCrowdComponent::m_maxAcceleration)
+                ->Field("Max Speed", &DetourCrowdComponent::m_maxSpeed)
+                ->Version(1);
+        }
+
+        if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->EBus<DetourCrowdRequestBus>("DetourCrowdRequestBus")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "navigation")
+                ->Attribute(AZ::Script::Attributes::Category, "Recast Navigation")
+                ->Event("SetNavigationMeshEntity", &DetourCrowdRequests::SetNavigationMeshEntity)
+                ->Event("GetNavigationMeshEntity", &DetourCrowdRequests::GetNavigationMeshEntity)
+                ->Event("AddAgent", &DetourCrowdRequests::AddAgent)
+                ->Event("RemoveAgent", &DetourCrowdRequests::RemoveAgent)
+                ->Event("SetAgentTarget", &DetourCrowdRequests::SetAgentTarget)
+                ->Event("ResetAgentTarget", &DetourCrowdRequests::ResetAgentTarget)
+                ->Event("GetAgentVelocity", &DetourCrowdRequests::GetAgentVelocity)
+                ->Event("GetAgentCount", &DetourCrowdRequests::GetAgentCount)
+                ;
+
+            behaviorContext->Class<DetourCrowdComponent>()->RequestBus("DetourCrowdRequestBus");
+        }
+    }
+
+    void DetourCrowdComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("DetourCrowdComponent"));
+    }
+
+    void DetourCrowdComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("DetourCrowdComponent"));
+    }
+
+    void DetourCrowdComponent::SetNavigationMeshEntity(AZ::EntityId navMeshEntity)
+    {
+        m_navQueryEntityId = navMeshEntity;
+    }
+
+    AZ::EntityId DetourCrowdComponent::GetNavigationMeshEntity() const
+    {
+        return m_navQueryEntityId;
+    }
+
+    bool DetourCrowdComponent::AddAgent(AZ::EntityId agentEntity)
+    {
+        if (!agentEntity.IsValid() || m_agents.size() >= aznumeric_cast<size_t>(m_maxAgents))
+        {
+            return false;
+        }
+
+        WaitForCrowdUpdate();
+
+        auto [agentIterator, inserted] = m_agents.emplace(agentEntity, Agent{});
+        if (!inserted)
+        {
+            return false;
+        }
+
+        if (m_crowd)
+        {
+            AZStd::shared_ptr<NavMeshQuery> navMeshQuery;
+            RecastNavigationMeshRequestBus::EventResult(navMeshQuery, m_navQueryEntityId, &RecastNavigationMeshRequests::GetNavigationObject);
+            if (navMeshQuery)
+            {
+                NavMeshQuery::LockGuard lock(*navMeshQuery);
+                if (lock.GetNavMesh() == m_crowdNavMesh)
+                {
+                    AddAgentToCrowd(lock, agentEntity, agentIterator->second);
+                }
+            }
+        }
+
+        // Otherwise the agent is added once the crowd is created on the next frame.
+        return true;
+    }
+
+    void DetourCrowdComponent::RemoveAgent(AZ::EntityId agentEntity)
+    {
+        WaitForCrowdUpdate();
+
+        if (auto agentIterator = m_agents.find(agentEntity); agentIterator != m_agents.end())
+        {
+            if (m_crowd && agentIterator->second.m_crowdIndex >= 0)
+            {
+                m_crowd->removeAgent(agentIterator->second.m_crowdIndex);
+            }
+            m_agents.erase(agentIterator);
+        }
+    }
+
+    bool DetourCrowdComponent::SetAgentTarget(AZ::EntityId agentEntity, const AZ::Vector3& targetWorldPosition)
+    {
+        WaitForCrowdUpdate();
+
+        auto agentIterator = m_agents.find(agentEntity);
+        if (agentIterator == m_agents.end())
+        {
+            return false;
+        }
+
+        Agent& agent = agentIterator->second;
+        agent.m_hasTarget = true;
+        agent.m_target = targetWorldPosition;
+
+        if (m_crowd && agent.m_crowdIndex >= 0)
+        {
+            AZStd::shared_ptr<NavMeshQuery> navMeshQuery;
+            RecastNavigationMeshRequestBus::EventResult(navMeshQuery, m_navQueryEntityId, &RecastNavigationMeshRequests::GetNavigationObject);
+            if (navMeshQuery)
+            {
+                NavMeshQuery::LockGuard lock(*navMeshQuery);
+                if (lock.GetNavMesh() == m_crowdNavMesh)
+                {
+                    RequestAgentTarget(lock, agent);
+                }
+            }
+        }
+
+        return true;
+    }
+
+    void DetourCrowdComponent::ResetAgentTarget(AZ::EntityId agentEntity)
+    {
+        WaitForCrowdUpdate();
+
+        if (auto agentIterator = m_agents.find(agentEntity); agentIterator != m_agents.end())
+        {
+            agentIterator->second.m_hasTarget = false;
+            if (m_crowd && agentIterator->second.m_crowdIndex >= 0)
+            {
+                m_crowd->resetMoveTarget(agentIterator->second.m_crowdIndex);
+            }
+        }
+    }
+
+    AZ::Vector3 DetourCrowdComponent::GetAgentVelocity(AZ::EntityId agentEntity) const
+    {
+        WaitForCrowdUpdate();
+
+        if (auto agentIterator = m_agents.find(agentEntity); agentIterator != m_agents.end())
+        {
+            return agentIterator->second.m_velocity;
+        }
+        return AZ::Vector3::CreateZero();
+    }
+
+    int DetourCrowdComponent::GetAgentCount() const
+    {
+        return aznumeric_cast<int>(m_agents.size());
+    }
+
+    void DetourCrowdComponent::Activate()
+    {
+        if (!m_navQueryEntityId.IsValid())
+        {
+            // Default to looking for the navigation mesh component on the same entity if one is not specified.
+            m_navQueryEntityId = GetEntityId();
+        }
+
+        DetourCrowdRequestBus::Handler::BusConnect(GetEntityId());
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void DetourCrowdComponent::Deactivate()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+        DetourCrowdRequestBus::Handler::BusDisconnect();
+
+        WaitForCrowdUpdate();
+        m_crowdTaskGraphEvent.reset();
+
+        m_agents.clear();
+        m_crowd.reset();
+        m_crowdNavMesh = nullptr;
+        m_pendingDeltaTime = 0.f;
+    }
+
+    void DetourCrowdComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        m_pendingDeltaTime += deltaTime;
+
+        if (m_crowdTaskGraphEvent)
+        {
+            if (!m_crowdTaskGraphEvent->IsSignaled())
+            {
+                // The previous update is still running, its time carries over to the next update.
+                return;
+            }
+
+            ApplyCrowdUpdate();
+            m_crowdTaskGraphEvent.reset();
+        }
+
+        AZStd::shared_ptr<NavMeshQuery> navMeshQuery;
+        RecastNavigationMeshRequestBus::EventResult(navMeshQuery, m_navQueryEntityId, &RecastNavigationMeshRequests::GetNavigationObject);
+        if (!navMeshQuery)
+        {
+            return;
+        }
+
+        {
+            NavMeshQuery::LockGuard lock(*navMeshQuery);
+            if (!UpdateCrowdNavigationMesh(lock))
+            {
+                return;
+            }
+        }
+
+        const float crowdDeltaTime = AZStd::min(m_pendingDeltaTime, MaxCrowdDeltaTime);
+        m_pendingDeltaTime = 0.f;
+        if (m_agents.empty())
+        {
+            return;
+        }
+
+        // The whole crowd is stepped in one task, and the results are picked up on a later frame,
+        // so the main thread only pays for writing the agent transforms.
+        m_crowdTaskGraphEvent = AZStd::make_unique<AZ::TaskGraphEvent>("RecastNavigation Crowd Wait");
+        m_crowdTaskGraph.Reset();
+        m_crowdTaskGraph.AddTask(
+            m_crowdTaskDescriptor, [this, navMeshQuery, crowdDeltaTime]()
+            {
+                AZ_PROFILE_SCOPE(Navigation, "Navigation: task - updating crowd");
+
+                NavMeshQuery::LockGuard lock(*navMeshQuery);
+                if (lock.GetNavMesh() != m_crowdNavMesh)
+                {
+                    return;
+                }
+
+                m_crowd->update(crowdDeltaTime, nullptr);
+
+                for (auto& [agentEntity, agent] : m_agents)
+                {
+                    if (agent.m_crowdIndex >= 0)
+                    {
+                        const dtCrowdAgent* crowdAgent = m_crowd->getAgent(agent.m_crowdIndex);
+                        agent.m_position = RecastVector3::CreateFromFloatValuesWithoutAxisSwapping(crowdAgent->npos).AsVector3WithZup();
+                        agent.m_velocity = RecastVector3::CreateFromFloatValuesWithoutAxisSwapping(crowdAgent->vel).AsVector3WithZup();
+                    }
+                }
+            });
+        m_crowdTaskGraph.Submit(m_crowdTaskGraphEvent.get());
+    }
+
+    void DetourCrowdComponent::WaitForCrowdUpdate() const
+    {
+        if (m_crowdTaskGraphEvent && !m_crowdTaskGraphEvent->IsSignaled())
+        {
+            m_crowdTaskGraphEvent->Wait();
+        }
+    }
+
+    bool DetourCrowdComponent::UpdateCrowdNavigationMesh(NavMeshQuery::LockGuard& lock)
+    {
+        const dtNavMesh* navMesh = lock.GetNavMesh();
+        if (!navMesh)
+        {
+            return false;
+        }
+
+        if (m_crowd && m_crowdNavMesh == navMesh)
+        {
+            return true;
+        }
+
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: create crowd");
+
+        // The navigation mesh was created or re-created, the agents have to be added again to a crowd on the new one.
+        m_crowd.reset(dtAllocCrowd());
+        m_crowdNavMesh = nullptr;
+        if (!m_crowd || !m_crowd->init(m_maxAgents, m_agentRadius, lock.GetNavMesh()))
+        {
+            AZ_Error("Navigation", false, "Could not init Detour crowd");
+            m_crowd.reset();
+            return false;
+        }
+        m_crowdNavMesh = navMesh;
+
+        for (auto& [agentEntity, agent] : m_agents)
+        {
+            agent.m_crowdIndex = -1;
+            AddAgentToCrowd(lock, agentEntity, agent);
+        }
+
+        return true;
+    }
+
+    void DetourCrowdComponent::AddAgentToCrowd(NavMeshQuery::LockGuard& lock, AZ::EntityId agentEntity, Agent& agent)
+    {
+        AZ::Vector3 position = AZ::Vector3::CreateZero();
+        AZ::TransformBus::EventResult(position, agentEntity, &AZ::TransformBus::Events::GetWorldTranslation);
+
+        dtCrowdAgentParams params = {};
+        params.radius = m_agentRadius;
+        params.height = m_agentHeight;
+        params.maxAcceleration = m_maxAcceleration;
+        params.maxSpeed = m_maxSpeed;
+        params.collisionQueryRange = m_agentRadius * 12.f;
+        params.pathOptimizationRange = m_agentRadius * 30.f;
+        params.updateFlags = DT_CROWD_ANTICIPATE_TURNS | DT_CROWD_OPTIMIZE_VIS | DT_CROWD_OPTIMIZE_TOPO |
+            DT_CROWD_OBSTACLE_AVOIDANCE | DT_CROWD_SEPARATION;
+        params.obstacleAvoidanceType = 3;
+        params.separationWeight = 2.f;
+
+        RecastVector3 recastPosition = RecastVector3::CreateFromVector3SwapYZ(position);
+        agent.m_crowdIndex = m_crowd->addAgent(recastPosition.GetData(), &params);
+        agent.m_position = position;
+        agent.m_velocity = AZ::Vector3::CreateZero();
+
+        if (agent.m_crowdIndex >= 0 && agent.m_hasTarget)
+        {
+            RequestAgentTarget(lock, agent);
+        }
+    }
+
+    bool DetourCrowdComponent::RequestAgentTarget([[maybe_unused]] NavMeshQuery::LockGuard& lock, Agent& agent)
+    {
+        RecastVector3 target = RecastVector3::CreateFromVector3SwapYZ(agent.m_target);
+        RecastVector3 nearestTarget;
+        dtPolyRef targetPoly = 0;
+
+        // The crowd has its own query object, which is only used while the navigation mesh is locked.
+        const dtStatus result = m_crowd->getNavMeshQuery()->findNearestPoly(target.GetData(), m_crowd->getQueryHalfExtents(),
+            m_crowd->getFilter(0), &targetPoly, nearestTarget.GetData());
+        if (dtStatusFailed(result) || targetPoly == 0)
+        {
+            return false;
+        }
+
+        return m_crowd->requestMoveTarget(agent.m_crowdIndex, targetPoly, nearestTarget.GetData());
+    }
+
+    void DetourCrowdComponent::ApplyCrowdUpdate()
+    {
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: apply crowd update");
+
+        for (const auto& [agentEntity, agent] : m_agents)
+        {
+            if (agent.m_crowdIndex >= 0)
+            {
+                AZ::TransformBus::Event(agentEntity, &AZ::TransformBus::Events::SetWorldTranslation, agent.m_position);
+            }
+        }
+    }
+} // namespace RecastNavigation
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <DetourCrowd.h>
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Task/TaskDescriptor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <RecastNavigation/DetourCrowdBus.h>
+#include <RecastNavigation/NavMeshQuery.h>
+#include <RecastNavigation/RecastSmartPointer.h>
+
+namespace RecastNavigation
+{
+    template <>
+    struct CustomRecastDeleter<dtCrowd>
+    {
+        void operator ()(dtCrowd* p)
+        {
+            dtFreeCrowd(p);
+        }
+    };
+
+    //! Moves a crowd of agent entities over the associated navigation mesh, steering them towards their targets
+    //! with local avoidance between agents.
+    //! The whole crowd is updated at once on a worker thread, and the agent positions are written back to their
+    //! transforms on the main thread on the following frame.
+    class DetourCrowdComponent final
+        : public AZ::Component
+        , public DetourCrowdRequestBus::Handler
+        , private AZ::TickBus::Handler
+    {
+    public:
+        AZ_COMPONENT(DetourCrowdComponent, "{6F1B3E2A-94C7-4D58-A0E3-2B7C5D9F1E48}");
+        DetourCrowdComponent() = default;
+        //! Constructor to be used by Editor variant to pass the configuration in.
+        //! @param navQueryEntityId entity id of the entity with a navigation mesh component.
+        //! @param maxAgents maximum number of agents in the crowd.
+        //! @param agentRadius radius of every agent.
+        //! @param agentHeight height of every agent.
+        //! @param maxAcceleration maximum acceleration of every agent.
+        //! @param maxSpeed maximum speed of every agent.
+        DetourCrowdComponent(AZ::EntityId navQueryEntityId, int maxAgents, float agentRadius, float agentHeight,
+            float maxAcceleration, float maxSpeed);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        //! DetourCrowdRequestBus overrides ...
+        //! @{
+        void SetNavigationMeshEntity(AZ::EntityId navMeshEntity) override;
+        AZ::EntityId GetNavigationMeshEntity() const override;
+        bool AddAgent(AZ::EntityId agentEntity) override;
+        void RemoveAgent(AZ::EntityId agentEntity) override;
+        bool SetAgentTarget(AZ::EntityId agentEntity, const AZ::Vector3& targetWorldPosition) override;
+        void ResetAgentTarget(AZ::EntityId agentEntity) override;
+        AZ::Vector3 GetAgentVelocity(AZ::EntityId agentEntity) const override;
+        int GetAgentCount() const override;
+        //! @}
+
+        //! AZ::Component overrides ...
+        //! @{
+        void Activate() override;
+        void Deactivate() override;
+        //! @}
+
+    private:
+        //! AZ::TickBus overrides ...
+        //! @{
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        //! @}
+
+        struct Agent
+        {
+            //! Index of the agent in @m_crowd, or -1 if the agent isn't in the crowd yet.
+            int m_crowdIndex = -1;
+
+            bool m_hasTarget = false;
+            AZ::Vector3 m_target = AZ::Vector3::CreateZero();
+
+            //! Results of the last crowd update.
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_velocity = AZ::Vector3::CreateZero();
+        };
+
+        //! Waits for the crowd update in progress, if there is one. The crowd and the agents can only be modified once it's done.
+        void WaitForCrowdUpdate() const;
+
+        //! Creates the crowd again if the navigation mesh is different from the one the crowd was created with.
+        //! @return true if there is a crowd on the current navigation mesh.
+        bool UpdateCrowdNavigationMesh(NavMeshQuery::LockGuard& lock);
+
+        //! Adds an agent to @m_crowd at the current position of its entity.
+        void AddAgentToCrowd(NavMeshQuery::LockGuard& lock, AZ::EntityId agentEntity, Agent& agent);
+
+        //! Asks the crowd to move the agent to its target.
+        bool RequestAgentTarget(NavMeshQuery::LockGuard& lock, Agent& agent);
+
+        //! Moves the agent entities to the positions of the last crowd update.
+        void ApplyCrowdUpdate();
+
+        //! Entity id of the entity with a navigation mesh component.
+        AZ::EntityId m_navQueryEntityId;
+
+        int m_maxAgents = 256;
+        float m_agentRadius = 0.5f;
+        float m_agentHeight = 2.f;
+        float m_maxAcceleration = 8.f;
+        float m_maxSpeed = 3.5f;
+
+        //! Detour crowd, created once the navigation mesh is available.
+        RecastPointer<dtCrowd> m_crowd;
+        //! Navigation mesh @m_crowd was created with, so the crowd can be created again if the navigation mesh is re-created.
+        const dtNavMesh* m_crowdNavMesh = nullptr;
+
+        AZStd::unordered_map<AZ::EntityId, Agent> m_agents;
+
+        //! Time passed since the last crowd update started, including the frames it took to complete.
+        float m_pendingDeltaTime = 0.f;
+
+        //! Task graph objects to update the crowd off the main thread.
+        AZ::TaskGraph m_crowdTaskGraph{ "RecastNavigation Crowd" };
+        AZStd::unique_ptr<AZ::TaskGraphEvent> m_crowdTaskGraphEvent;
+        AZ::TaskDescriptor m_crowdTaskDescriptor{ "Update Crowd", "Recast Navigation" };
+    };
+} // namespace RecastNavigation
@@ -7,16 +7,61 @@
  */
 
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <Components/DetourNavigationComponent.h>
 #include <RecastNavigation/RecastHelpers.h>
 #include <RecastNavigation/RecastNavigationMeshBus.h>
 
+AZ_CVAR(
+    AZ::u32, bg_navmesh_pathIterationsPerFrame, 512, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Number of search iterations each DetourNavigationComponent spends on its async path requests per frame");
+
 AZ_DECLARE_BUDGET(Navigation);
 
 namespace RecastNavigation
 {
+    namespace
+    {
+        // Some reasonable amount of waypoints along the path. Recast isn't made to calculate very long paths.
+        constexpr int MaxPathLength = 100;
+
+        // Same number of search nodes as the query object of the navigation mesh.
+        constexpr int MaxSearchNodes = 2048;
+
+        // The corridor cache is discarded once it gets this large, it's only meant to catch agents repeating the same requests.
+        constexpr size_t MaxCachedPathCorridors = 256;
+
+        // Finds the waypoints along a corridor of polygons found by a path search.
+        AZStd::vector<AZ::Vector3> FindStraightPath(
+            dtNavMeshQuery* navQuery, RecastVector3 start, RecastVector3 end, const dtPolyRef* path, int pathLength)
+        {
+            AZStd::array<RecastVector3, MaxPathLength> detailedPath;
+            AZStd::array<AZ::u8, MaxPathLength> detailedPathFlags;
+            AZStd::array<dtPolyRef, MaxPathLength> detailedPolyPathRefs;
+            int detailedPathCount = 0;
+
+            const dtStatus result = navQuery->findStraightPath(start.GetData(), end.GetData(), path, pathLength,
+                detailedPath[0].GetData(), detailedPathFlags.data(), detailedPolyPathRefs.data(),
+                &detailedPathCount, MaxPathLength, DT_STRAIGHTPATH_ALL_CROSSINGS);
+            if (dtStatusFailed(result))
+            {
+                return {};
+            }
+
+            AZStd::vector<AZ::Vector3> pathPoints;
+            pathPoints.reserve(detailedPathCount);
+            // Note: Recast uses +Y, O3DE used +Z as up vectors.
+            for (int i = 0; i < detailedPathCount; ++i)
+            {
+                pathPoints.push_back(detailedPath[i].AsVector3WithZup());
+            }
+
+            return pathPoints;
+        }
+    } // namespace
+
     DetourNavigationComponent::DetourNavigationComponent(AZ::EntityId navQueryEntityId, float nearestDistance)
         : m_navQueryEntityId(navQueryEntityId), m_nearestDistance(nearestDistance)
     {
@@ -103,9 +148,6 @@ namespace RecastNavigation
             return {};
         }
 
-        // Some reasonable amount of waypoints along the path. Recast isn't made to calculate very long paths.
-        constexpr int MaxPathLength = 100;
-
         AZStd::array<dtPolyRef, MaxPathLength> path;
         int pathLength = 0;
 
@@ -117,34 +159,247 @@ namespace RecastNavigation
             return {};
         }
 
-        AZStd::array<RecastVector3, MaxPathLength> detailedPath;
-        AZStd::array<AZ::u8, MaxPathLength> detailedPathFlags;
-        AZStd::array<dtPolyRef, MaxPathLength> detailedPolyPathRefs;
-        int detailedPathCount = 0;
-
         // Then the detailed path. This gives us actual specific waypoints along the path over the polygons found earlier.
-        result = lock.GetNavQuery()->findStraightPath(startRecast.GetData(), endRecast.GetData(), path.data(), pathLength,
-            detailedPath[0].GetData(), detailedPathFlags.data(), detailedPolyPathRefs.data(),
-            &detailedPathCount, MaxPathLength, DT_STRAIGHTPATH_ALL_CROSSINGS);
-        if (dtStatusFailed(result))
+        return FindStraightPath(lock.GetNavQuery(), startRecast, endRecast, path.data(), pathLength);
+    }
+
+    void DetourNavigationComponent::FindPathBetweenPositionsAsync(
+        const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition, PathFoundCallback callback)
+    {
+        PathRequest request;
+        request.m_start = RecastVector3::CreateFromVector3SwapYZ(fromWorldPosition);
+        request.m_end = RecastVector3::CreateFromVector3SwapYZ(toWorldPosition);
+        request.m_callback = AZStd::move(callback);
+
+        AZStd::lock_guard lock(m_queuedPathRequestsMutex);
+        m_queuedPathRequests.push_back(AZStd::move(request));
+    }
+
+    void DetourNavigationComponent::OnPathUpdateTick()
+    {
+        if (m_pathTaskGraphEvent && !m_pathTaskGraphEvent->IsSignaled())
         {
-            return {};
+            // The searches of the previous frame are still running, pick up their results on the next frame.
+            return;
         }
 
-        AZStd::vector<AZ::Vector3> pathPoints;
-        pathPoints.reserve(detailedPathCount);
-        // Note: Recast uses +Y, O3DE used +Z as up vectors.
-        for (int i = 0; i < detailedPathCount; ++i)
+        AZStd::vector<PathRequest> completedPathRequests;
+        completedPathRequests.swap(m_completedPathRequests);
+
         {
-            pathPoints.push_back(detailedPath[i].AsVector3WithZup());
+            AZStd::lock_guard lock(m_queuedPathRequestsMutex);
+            for (PathRequest& request : m_queuedPathRequests)
+            {
+                m_activePathRequests.push_back(AZStd::move(request));
+            }
+            m_queuedPathRequests.clear();
         }
 
-        return pathPoints;
+        if (!m_activePathRequests.empty())
+        {
+            AZStd::shared_ptr<NavMeshQuery> navMeshQuery;
+            RecastNavigationMeshRequestBus::EventResult(navMeshQuery, m_navQueryEntityId, &RecastNavigationMeshRequests::GetNavigationObject);
+            if (navMeshQuery)
+            {
+                AZ_PROFILE_SCOPE(Navigation, "Navigation: submit path requests");
+
+                m_pathTaskGraphEvent = AZStd::make_unique<AZ::TaskGraphEvent>("RecastNavigation Path Finding Wait");
+                m_pathTaskGraph.Reset();
+                m_pathTaskGraph.AddTask(
+                    m_pathTaskDescriptor, [this, navMeshQuery, iterationBudget = aznumeric_cast<int>(bg_navmesh_pathIterationsPerFrame)]()
+                    {
+                        UpdatePathRequests(*navMeshQuery, iterationBudget);
+                    });
+                m_pathTaskGraph.Submit(m_pathTaskGraphEvent.get());
+            }
+            else
+            {
+                // Without a navigation mesh none of the requests can succeed.
+                while (!m_activePathRequests.empty())
+                {
+                    completedPathRequests.push_back(AZStd::move(m_activePathRequests.front()));
+                    m_activePathRequests.pop_front();
+                }
+            }
+        }
+
+        // The callbacks are free to queue new requests, those are picked up on the next frame.
+        for (PathRequest& request : completedPathRequests)
+        {
+            if (request.m_callback)
+            {
+                request.m_callback(AZStd::move(request.m_waypoints));
+            }
+        }
+    }
+
+    void DetourNavigationComponent::UpdatePathRequests(NavMeshQuery& navMeshQuery, int iterationBudget)
+    {
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: task - updating path requests");
+
+        if (m_pathCorridorCacheOutdated.exchange(false))
+        {
+            m_pathCorridorCache.clear();
+        }
+
+        // The lock is held for the whole budget, which is small enough not to hold off navigation mesh updates for long.
+        NavMeshQuery::LockGuard lock(navMeshQuery);
+        const dtNavMesh* navMesh = lock.GetNavMesh();
+        if (!navMesh)
+        {
+            while (!m_activePathRequests.empty())
+            {
+                CompleteFirstPathRequest();
+            }
+            return;
+        }
+
+        if (!m_slicedQuery || m_slicedQueryNavMesh != navMesh)
+        {
+            // The navigation mesh was re-created, so any search in progress has to start over on the new one.
+            m_slicedQuery.reset(dtAllocNavMeshQuery());
+            if (!m_slicedQuery || dtStatusFailed(m_slicedQuery->init(navMesh, MaxSearchNodes)))
+            {
+                AZ_Error("Navigation", false, "Could not init Detour navmesh query for async path requests");
+                m_slicedQuery.reset();
+                m_slicedQueryNavMesh = nullptr;
+                while (!m_activePathRequests.empty())
+                {
+                    CompleteFirstPathRequest();
+                }
+                return;
+            }
+
+            m_slicedQueryNavMesh = navMesh;
+            m_pathCorridorCache.clear();
+            for (PathRequest& request : m_activePathRequests)
+            {
+                request.m_searchStarted = false;
+            }
+        }
+
+        while (iterationBudget > 0 && !m_activePathRequests.empty())
+        {
+            PathRequest& request = m_activePathRequests.front();
+            if (!request.m_searchStarted)
+            {
+                // Finding the end points isn't part of the sliced search, count it as one iteration.
+                --iterationBudget;
+                if (StartPathRequest(lock, request))
+                {
+                    CompleteFirstPathRequest();
+                }
+                continue;
+            }
+
+            int iterationsDone = 0;
+            dtStatus status = m_slicedQuery->updateSlicedFindPath(iterationBudget, &iterationsDone);
+            iterationBudget -= iterationsDone;
+            if (dtStatusInProgress(status))
+            {
+                // Out of budget, the search continues on the next frame.
+                continue;
+            }
+
+            if (dtStatusSucceed(status))
+            {
+                AZStd::array<dtPolyRef, MaxPathLength> path;
+                int pathLength = 0;
+                status = m_slicedQuery->finalizeSlicedFindPath(path.data(), &pathLength, MaxPathLength);
+                if (dtStatusSucceed(status) && pathLength > 0)
+                {
+                    request.m_waypoints = FindStraightPath(m_slicedQuery.get(), request.m_start, request.m_end, path.data(), pathLength);
+
+                    // A partial path doesn't reach the end polygon, so it isn't worth reusing.
+                    if (!dtStatusDetail(status, DT_PARTIAL_RESULT))
+                    {
+                        if (m_pathCorridorCache.size() >= MaxCachedPathCorridors)
+                        {
+                            m_pathCorridorCache.clear();
+                        }
+                        m_pathCorridorCache[{ request.m_startPoly, request.m_endPoly }].assign(path.begin(), path.begin() + pathLength);
+                    }
+                }
+            }
+
+            CompleteFirstPathRequest();
+        }
+    }
+
+    bool DetourNavigationComponent::StartPathRequest(NavMeshQuery::LockGuard& lock, PathRequest& request)
+    {
+        const float halfExtents[3] = { m_nearestDistance, m_nearestDistance, m_nearestDistance };
+        RecastVector3 nearestStartPoint, nearestEndPoint;
+
+        dtStatus result = m_slicedQuery->findNearestPoly(request.m_start.GetData(), halfExtents, &m_slicedQueryFilter,
+            &request.m_startPoly, nearestStartPoint.GetData());
+        if (dtStatusFailed(result) || request.m_startPoly == 0)
+        {
+            return true;
+        }
+
+        result = m_slicedQuery->findNearestPoly(request.m_end.GetData(), halfExtents, &m_slicedQueryFilter,
+            &request.m_endPoly, nearestEndPoint.GetData());
+        if (dtStatusFailed(result) || request.m_endPoly == 0)
+        {
+            return true;
+        }
+
+        if (auto corridor = m_pathCorridorCache.find({ request.m_startPoly, request.m_endPoly }); corridor != m_pathCorridorCache.end())
+        {
+            // Tiles rebuilt since the corridor was found make its polygons invalid.
+            bool corridorIsValid = true;
+            for (const dtPolyRef polyRef : corridor->second)
+            {
+                if (!lock.GetNavMesh()->isValidPolyRef(polyRef))
+                {
+                    corridorIsValid = false;
+                    break;
+                }
+            }
+
+            if (corridorIsValid)
+            {
+                request.m_waypoints = FindStraightPath(m_slicedQuery.get(), request.m_start, request.m_end,
+                    corridor->second.data(), aznumeric_cast<int>(corridor->second.size()));
+                return true;
+            }
+
+            m_pathCorridorCache.erase(corridor);
+        }
+
+        result = m_slicedQuery->initSlicedFindPath(request.m_startPoly, request.m_endPoly,
+            nearestStartPoint.GetData(), nearestEndPoint.GetData(), &m_slicedQueryFilter);
+        if (dtStatusFailed(result))
+        {
+            return true;
+        }
+
+        request.m_searchStarted = true;
+        return false;
+    }
+
+    void DetourNavigationComponent::CompleteFirstPathRequest()
+    {
+        m_completedPathRequests.push_back(AZStd::move(m_activePathRequests.front()));
+        m_activePathRequests.pop_front();
+    }
+
+    void DetourNavigationComponent::OnNavigationMeshUpdated([[maybe_unused]] AZ::EntityId navigationMeshEntity)
+    {
+        m_pathCorridorCacheOutdated = true;
     }
 
     void DetourNavigationComponent::SetNavigationMeshEntity(AZ::EntityId navMeshEntity)
     {
         m_navQueryEntityId = navMeshEntity;
+        m_pathCorridorCacheOutdated = true;
+
+        if (RecastNavigationMeshNotificationBus::Handler::BusIsConnected())
+        {
+            RecastNavigationMeshNotificationBus::Handler::BusDisconnect();
+            RecastNavigationMeshNotificationBus::Handler::BusConnect(m_navQueryEntityId);
+        }
     }
 
     AZ::EntityId DetourNavigationComponent::GetNavigationMeshEntity() const
@@ -161,10 +416,31 @@ namespace RecastNavigation
         }
 
         DetourNavigationRequestBus::Handler::BusConnect(GetEntityId());
+        RecastNavigationMeshNotificationBus::Handler::BusConnect(m_navQueryEntityId);
+        m_pathUpdateEvent.Enqueue(AZ::TimeMs{ 0 }, true);
     }
 
     void DetourNavigationComponent::Deactivate()
     {
+        m_pathUpdateEvent.RemoveFromQueue();
+        RecastNavigationMeshNotificationBus::Handler::BusDisconnect();
         DetourNavigationRequestBus::Handler::BusDisconnect();
+
+        if (m_pathTaskGraphEvent && !m_pathTaskGraphEvent->IsSignaled())
+        {
+            // If the path finding task is still in progress, wait until it's finished.
+            m_pathTaskGraphEvent->Wait();
+        }
+        m_pathTaskGraphEvent.reset();
+
+        {
+            AZStd::lock_guard lock(m_queuedPathRequestsMutex);
+            m_queuedPathRequests.clear();
+        }
+        m_activePathRequests.clear();
+        m_completedPathRequests.clear();
+        m_pathCorridorCache.clear();
+        m_slicedQuery.reset();
+        m_slicedQueryNavMesh = nullptr;
     }
 } // namespace RecastNavigation
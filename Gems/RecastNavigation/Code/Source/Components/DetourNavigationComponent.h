@@ -8,8 +8,18 @@
 
 #pragma once
 
+#include <DetourNavMeshQuery.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/Task/TaskDescriptor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <RecastNavigation/DetourNavigationBus.h>
+#include <RecastNavigation/RecastHelpers.h>
+#include <RecastNavigation/RecastNavigationMeshBus.h>
 
 namespace RecastNavigation
 {
@@ -18,6 +28,7 @@ namespace RecastNavigation
     class DetourNavigationComponent final
         : public AZ::Component
         , public DetourNavigationRequestBus::Handler
+        , private RecastNavigationMeshNotificationBus::Handler
     {
     public:
         AZ_COMPONENT(DetourNavigationComponent, "{B9A8F260-2772-4C94-8DE4-850C94A8F2AC}");
@@ -34,6 +45,8 @@ namespace RecastNavigation
         //! @{
         AZStd::vector<AZ::Vector3> FindPathBetweenEntities(AZ::EntityId fromEntity, AZ::EntityId toEntity) override;
         AZStd::vector<AZ::Vector3> FindPathBetweenPositions(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) override;
+        void FindPathBetweenPositionsAsync(
+            const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition, PathFoundCallback callback) override;
         void SetNavigationMeshEntity(AZ::EntityId navMeshEntity) override;
         AZ::EntityId GetNavigationMeshEntity() const override;
         //! @}
@@ -45,9 +58,73 @@ namespace RecastNavigation
         //! @}
 
     private:
+        //! RecastNavigationMeshNotificationBus overrides ...
+        //! @{
+        void OnNavigationMeshUpdated(AZ::EntityId navigationMeshEntity) override;
+        void OnNavigationMeshBeganRecalculating([[maybe_unused]] AZ::EntityId navigationMeshEntity) override {}
+        //! @}
+
+        //! An async path request, from the moment it's queued until its callback is called.
+        struct PathRequest
+        {
+            RecastVector3 m_start;
+            RecastVector3 m_end;
+            PathFoundCallback m_callback;
+
+            //! True once the sliced search of this request was started on @m_slicedQuery.
+            bool m_searchStarted = false;
+            dtPolyRef m_startPoly = 0;
+            dtPolyRef m_endPoly = 0;
+
+            AZStd::vector<AZ::Vector3> m_waypoints;
+        };
+
+        //! Called every frame to hand new requests to the path finding task and call the callbacks of the completed ones.
+        void OnPathUpdateTick();
+
+        //! Advances the searches of the active requests, one at a time, until the iteration budget runs out. Runs on a worker thread.
+        void UpdatePathRequests(NavMeshQuery& navMeshQuery, int iterationBudget);
+
+        //! Finds the polygons of the end points of a request and starts its sliced search. Runs on a worker thread.
+        //! @return true if the request is already complete, either because it failed or because its corridor was cached.
+        bool StartPathRequest(NavMeshQuery::LockGuard& lock, PathRequest& request);
+
+        //! Moves the first active request to the completed requests, so that its callback is called on the main thread.
+        void CompleteFirstPathRequest();
+
         //! Entity id of the entity with a navigation mesh component.
         AZ::EntityId m_navQueryEntityId;
         //! Distance to use when finding nearest point on the navigation mesh when points provided to FindPath are outside of the navigation mesh.
         float m_nearestDistance = 3.f;
+
+        //! Requests queued since the last frame, from any thread.
+        AZStd::deque<PathRequest> m_queuedPathRequests;
+        AZStd::mutex m_queuedPathRequestsMutex;
+
+        //! Requests being searched and requests waiting for their callback.
+        //! Only accessed by the path finding task, or by the main thread while the task isn't running.
+        AZStd::deque<PathRequest> m_activePathRequests;
+        AZStd::vector<PathRequest> m_completedPathRequests;
+
+        //! Query object used by the sliced searches, separate from the navigation mesh's own query so that blocking
+        //! requests can run between the slices of a search.
+        RecastPointer<dtNavMeshQuery> m_slicedQuery;
+        //! Navigation mesh @m_slicedQuery was initialized with, so it can be initialized again if the navigation mesh is re-created.
+        const dtNavMesh* m_slicedQueryNavMesh = nullptr;
+        //! A sliced search keeps a pointer to its filter, so it has to outlive the search.
+        dtQueryFilter m_slicedQueryFilter;
+
+        //! Polygon corridors of the paths found by async requests, by their start and end polygons.
+        //! Requests between the same polygons only need to find the waypoints along the cached corridor.
+        AZStd::unordered_map<AZStd::pair<dtPolyRef, dtPolyRef>, AZStd::vector<dtPolyRef>> m_pathCorridorCache;
+        //! Set when the navigation mesh changes, so the path finding task discards the cached corridors.
+        AZStd::atomic_bool m_pathCorridorCacheOutdated{ false };
+
+        //! Task graph objects to run the path finding off the main thread.
+        AZ::TaskGraph m_pathTaskGraph{ "RecastNavigation Path Finding" };
+        AZStd::unique_ptr<AZ::TaskGraphEvent> m_pathTaskGraphEvent;
+        AZ::TaskDescriptor m_pathTaskDescriptor{ "Find Paths", "Recast Navigation" };
+
+        AZ::ScheduledEvent m_pathUpdateEvent{ [this]() { OnPathUpdateTick(); }, AZ::Name("DetourNavigationPathUpdate") };
     };
 } // namespace RecastNavigation
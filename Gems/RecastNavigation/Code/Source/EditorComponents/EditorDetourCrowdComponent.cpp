@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "EditorDetourCrowdComponent.h"
+
+#include <AzCore/Serialization/EditContext.h>
+#include <Components/DetourCrowdComponent.h>
+
+namespace RecastNavigation
+{
+    void EditorDetourCrowdComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<EditorDetourCrowdComponent, AZ::Component>()
+                ->Field("Navigation Mesh", &EditorDetourCrowdComponent::m_navQueryEntityId)
+                ->Field("Max Agents", &EditorDetourCrowdComponent::m_maxAgents)
+                ->Field("Agent Radius", &EditorDetourCrowdComponent::m_agentRadius)
+                ->Field("Agent Height", &EditorDetourCrowdComponent::m_agentHeight)
+                ->Field("Max Acceleration", &EditorDetourCrowdComponent::m_maxAcceleration)
+                ->Field("Max Speed", &EditorDetourCrowdComponent::m_maxSpeed)
+                ->Version(1)
+                ;
+
+            if (AZ::EditContext* editContext = serializeContext->GetEditContext())
+            {
+                editContext->Class<EditorDetourCrowdComponent>("Detour Crowd Component",
+                    "[Moves a crowd of agent entities over an associated navigation mesh, with local avoidance between agents.]")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &EditorDetourCrowdComponent::m_navQueryEntityId,
+                        "Navigation Mesh", "Entity with Recast Navigation Mesh component")
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &EditorDetourCrowdComponent::m_maxAgents,
+                        "Max Agents", "Maximum number of agents in the crowd.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 1)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &EditorDetourCrowdComponent::m_agentRadius,
+                        "Agent Radius", "Radius of every agent.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.01f)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &EditorDetourCrowdComponent::m_agentHeight,
+                        "Agent Height", "Height of every agent.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.01f)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &EditorDetourCrowdComponent::m_maxAcceleration,
+                        "Max Acceleration", "Maximum acceleration of every agent.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &EditorDetourCrowdComponent::m_maxSpeed,
+                        "Max Speed", "Maximum speed of every agent.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ;
+            }
+        }
+    }
+
+    void EditorDetourCrowdComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("DetourCrowdComponent"));
+    }
+
+    void EditorDetourCrowdComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("DetourCrowdComponent"));
+    }
+
+    void EditorDetourCrowdComponent::BuildGameEntity(AZ::Entity* gameEntity)
+    {
+        gameEntity->CreateComponent<DetourCrowdComponent>(
+            m_navQueryEntityId, m_maxAgents, m_agentRadius, m_agentHeight, m_maxAcceleration, m_maxSpeed);
+    }
+} // namespace RecastNavigation
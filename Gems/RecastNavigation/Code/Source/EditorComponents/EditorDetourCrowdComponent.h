@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <ToolsComponents/EditorComponentBase.h>
+
+namespace RecastNavigation
+{
+    //! Editor version of a crowd simulation component, @DetourCrowdComponent.
+    class EditorDetourCrowdComponent final
+        : public AzToolsFramework::Components::EditorComponentBase
+    {
+    public:
+        AZ_EDITOR_COMPONENT(EditorDetourCrowdComponent, "{0D4A7C93-5E1F-4B26-8A3D-C6E9F2B41570}", AzToolsFramework::Components::EditorComponentBase);
+        static void Reflect(AZ::ReflectContext* context);
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        //! EditorComponentBase overrides ...
+        //! @{
+        void BuildGameEntity(AZ::Entity* gameEntity) override;
+        //! @}
+
+    private:
+        //! Entity with Recast Navigation Mesh component.
+        AZ::EntityId m_navQueryEntityId;
+        //! Maximum number of agents in the crowd.
+        int m_maxAgents = 256;
+        //! Radius of every agent.
+        float m_agentRadius = 0.5f;
+        //! Height of every agent.
+        float m_agentHeight = 2.f;
+        //! Maximum acceleration of every agent.
+        float m_maxAcceleration = 8.f;
+        //! Maximum speed of every agent.
+        float m_maxSpeed = 3.5f;
+    };
+} // namespace RecastNavigation
@@ -76,6 +76,36 @@ namespace RecastNavigation
             &RecastNavigationProviderRequests::CollectGeometry,
             m_configuration.m_tileSize, aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize);
 
+        UpdateTilesBlockUntilCompleted(tiles);
+        return true;
+    }
+
+    bool RecastNavigationMeshComponentController::UpdateNavigationMeshRegionBlockUntilCompleted(const AZ::Aabb& dirtyRegion)
+    {
+        if (!dirtyRegion.IsValid())
+        {
+            return false;
+        }
+
+        bool notInProgress = false;
+        if (!m_updateInProgress.compare_exchange_strong(notInProgress, true))
+        {
+            return false;
+        }
+
+        AZStd::vector<AZStd::shared_ptr<TileGeometry>> tiles;
+
+        // Blocking call.
+        RecastNavigationProviderRequestBus::EventResult(tiles, m_entityComponentIdPair.GetEntityId(),
+            &RecastNavigationProviderRequests::CollectGeometryWithinRegion,
+            m_configuration.m_tileSize, aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize, dirtyRegion);
+
+        UpdateTilesBlockUntilCompleted(tiles);
+        return true;
+    }
+
+    void RecastNavigationMeshComponentController::UpdateTilesBlockUntilCompleted(AZStd::vector<AZStd::shared_ptr<TileGeometry>>& tiles)
+    {
         RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
             &RecastNavigationMeshNotificationBus::Events::OnNavigationMeshBeganRecalculating, m_entityComponentIdPair.GetEntityId());
 
@@ -111,7 +141,6 @@ namespace RecastNavigation
         RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
             &RecastNavigationMeshNotifications::OnNavigationMeshUpdated, m_entityComponentIdPair.GetEntityId());
         m_updateInProgress = false;
-        return true;
     }
 
     bool RecastNavigationMeshComponentController::UpdateNavigationMeshAsync()
@@ -141,6 +170,41 @@ namespace RecastNavigation
         return false;
     }
 
+    bool RecastNavigationMeshComponentController::UpdateNavigationMeshRegionAsync(const AZ::Aabb& dirtyRegion)
+    {
+        if (!dirtyRegion.IsValid())
+        {
+            return false;
+        }
+
+        bool notInProgress = false;
+        if (m_updateInProgress.compare_exchange_strong(notInProgress, true))
+        {
+            AZ_PROFILE_SCOPE(Navigation, "Navigation: UpdateNavigationMeshRegionAsync");
+
+            // Only the tiles overlapping the region are collected. Each one is rebuilt on its own task and replaces the old tile
+            // at the same location, the rest of the navigation mesh stays usable in the meantime.
+            bool operationScheduled = false;
+            RecastNavigationProviderRequestBus::EventResult(operationScheduled, m_entityComponentIdPair.GetEntityId(),
+                &RecastNavigationProviderRequests::CollectGeometryWithinRegionAsync,
+                m_configuration.m_tileSize, aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize,
+                dirtyRegion,
+                [this](AZStd::shared_ptr<TileGeometry> tile)
+                {
+                    OnTileProcessedEvent(tile);
+                });
+
+            if (!operationScheduled)
+            {
+                m_updateInProgress = false;
+                return false;
+            }
+            return true;
+        }
+
+        return false;
+    }
+
     AZStd::shared_ptr<NavMeshQuery> RecastNavigationMeshComponentController::GetNavigationObject()
     {
         return m_navObject;
@@ -72,6 +72,8 @@ namespace RecastNavigation
         //! @{
         bool UpdateNavigationMeshBlockUntilCompleted() override;
         bool UpdateNavigationMeshAsync() override;
+        bool UpdateNavigationMeshRegionBlockUntilCompleted(const AZ::Aabb& dirtyRegion) override;
+        bool UpdateNavigationMeshRegionAsync(const AZ::Aabb& dirtyRegion) override;
         AZStd::shared_ptr<NavMeshQuery> GetNavigationObject() override;
         //! @}
 
@@ -83,6 +85,11 @@ namespace RecastNavigation
 
         void OnSendNotificationTick();
 
+        //! Builds Recast tiles from the collected geometry and swaps them into the navigation mesh, replacing the tiles at the same locations.
+        //! Blocking call, expects @m_updateInProgress to be set and clears it once done.
+        //! @param tiles geometry of the tiles to rebuild
+        void UpdateTilesBlockUntilCompleted(AZStd::vector<AZStd::shared_ptr<TileGeometry>>& tiles);
+
         //! Tick event to notify on navigation mesh updates from the main thread.
         //! This is often needed for script environment, such as Script Canvas.
         AZ::ScheduledEvent m_sendNotificationEvent{ [this]() { OnSendNotificationTick(); }, AZ::Name("RecastNavigationMeshUpdated") };
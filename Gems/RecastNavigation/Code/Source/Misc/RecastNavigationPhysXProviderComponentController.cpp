@@ -124,6 +124,32 @@ namespace RecastNavigation
         return CollectGeometryAsyncImpl(tileSize, borderSize, GetWorldBounds(), AZStd::move(tileCallback));
     }
 
+    AZStd::vector<AZStd::shared_ptr<TileGeometry>> RecastNavigationPhysXProviderComponentController::CollectGeometryWithinRegion(
+        float tileSize, float borderSize, const AZ::Aabb& dirtyRegion)
+    {
+        if (!dirtyRegion.IsValid())
+        {
+            return {};
+        }
+
+        // Blocking call.
+        return CollectGeometryImpl(tileSize, borderSize, GetWorldBounds(), dirtyRegion);
+    }
+
+    bool RecastNavigationPhysXProviderComponentController::CollectGeometryWithinRegionAsync(
+        float tileSize,
+        float borderSize,
+        const AZ::Aabb& dirtyRegion,
+        AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
+    {
+        if (!dirtyRegion.IsValid())
+        {
+            return false;
+        }
+
+        return CollectGeometryAsyncImpl(tileSize, borderSize, GetWorldBounds(), AZStd::move(tileCallback), dirtyRegion);
+    }
+
     AZ::Aabb RecastNavigationPhysXProviderComponentController::GetWorldBounds() const
     {
         AZ::Aabb worldBounds = AZ::Aabb::CreateNull();
@@ -266,7 +292,7 @@ namespace RecastNavigation
     }
 
     AZStd::vector<AZStd::shared_ptr<TileGeometry>> RecastNavigationPhysXProviderComponentController::CollectGeometryImpl(
-        float tileSize, float borderSize, const AZ::Aabb& worldVolume)
+        float tileSize, float borderSize, const AZ::Aabb& worldVolume, const AZ::Aabb& dirtyRegion)
     {
         AZ_PROFILE_SCOPE(Navigation, "Navigation: CollectGeometry");
 
@@ -313,6 +339,11 @@ namespace RecastNavigation
                 AZ::Aabb tileVolume = AZ::Aabb::CreateFromMinMax(tileMin, tileMax);
                 AZ::Aabb scanVolume = AZ::Aabb::CreateFromMinMax(tileMin - border, tileMax + border);
 
+                if (dirtyRegion.IsValid() && !scanVolume.Overlaps(dirtyRegion))
+                {
+                    continue;
+                }
+
                 QueryHits results;
                 CollectCollidersWithinVolume(scanVolume, results);
 
@@ -358,7 +389,8 @@ namespace RecastNavigation
         float tileSize,
         float borderSize,
         const AZ::Aabb& worldVolume,
-        AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
+        AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback,
+        const AZ::Aabb& dirtyRegion)
     {
         bool notInProgress = false;
         if (!m_updateInProgress.compare_exchange_strong(notInProgress, true))
@@ -408,6 +440,13 @@ namespace RecastNavigation
 
                     AZ::Aabb tileVolume = AZ::Aabb::CreateFromMinMax(tileMin, tileMax);
                     AZ::Aabb scanVolume = AZ::Aabb::CreateFromMinMax(tileMin - border, tileMax + border);
+
+                    // Only the tiles that could see geometry from the dirty region need to be rebuilt.
+                    if (dirtyRegion.IsValid() && !scanVolume.Overlaps(dirtyRegion))
+                    {
+                        continue;
+                    }
+
                     AZStd::shared_ptr<TileGeometry> geometryData = AZStd::make_unique<TileGeometry>();
                     geometryData->m_tileCallback = tileCallback;
                     geometryData->m_worldBounds = tileVolume;
@@ -47,6 +47,10 @@ namespace RecastNavigation
         //! @{
         AZStd::vector<AZStd::shared_ptr<TileGeometry>> CollectGeometry(float tileSize, float borderSize) override;
         bool CollectGeometryAsync(float tileSize, float borderSize, AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) override;
+        AZStd::vector<AZStd::shared_ptr<TileGeometry>> CollectGeometryWithinRegion(
+            float tileSize, float borderSize, const AZ::Aabb& dirtyRegion) override;
+        bool CollectGeometryWithinRegionAsync(float tileSize, float borderSize, const AZ::Aabb& dirtyRegion,
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) override;
         AZ::Aabb GetWorldBounds() const override;
         int GetNumberOfTiles(float tileSize) const override;
         //! @}
@@ -58,11 +62,13 @@ namespace RecastNavigation
         //! @param tileSize the result is packaged in tiles, which are squares covering the provided volume of @worldVolume
         //! @param borderSize an additional extend in all direction around the tile volume, this additional geometry will allow Recast to connect tiles together.
         //! @param worldVolume the overall volume to collect static PhysX geometry
+        //! @param dirtyRegion if valid, only the tiles whose scan volume overlaps this region are collected
         //! @returns an array of tiles, each containing indexed geometry
         AZStd::vector<AZStd::shared_ptr<TileGeometry>> CollectGeometryImpl(
             float tileSize,
             float borderSize,
-            const AZ::Aabb& worldVolume);
+            const AZ::Aabb& worldVolume,
+            const AZ::Aabb& dirtyRegion = AZ::Aabb::CreateNull());
 
         //! Async variant of @CollectGeometryImpl. Tiles are returned via a callback @tileCallback.
         //!   Calls on @tileCallback will come from a task graph (not a main thread).
@@ -78,12 +84,14 @@ namespace RecastNavigation
         //! @param borderSize an additional extend in all direction around the tile volume, this additional geometry will allow Recast to connect tiles together
         //! @param worldVolume worldVolume the overall volume to collect static PhysX geometry
         //! @param tileCallback an empty tile indicates the end of the operation, otherwise a valid shared_ptr is returned with tile geometry
+        //! @param dirtyRegion if valid, only the tiles whose scan volume overlaps this region are collected
         //! @returns true if an async operation was scheduled, false otherwise
         bool CollectGeometryAsyncImpl(
             float tileSize,
             float borderSize,
             const AZ::Aabb& worldVolume,
-            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback);
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback,
+            const AZ::Aabb& dirtyRegion = AZ::Aabb::CreateNull());
 
         //! Finds all the static PhysX colliders within a given volume.
         //! @param volume the world to look for static colliders
@@ -8,6 +8,7 @@
 
 #include <RecastNavigationModuleInterface.h>
 #include <RecastNavigationEditorSystemComponent.h>
+#include <EditorComponents/EditorDetourCrowdComponent.h>
 #include <EditorComponents/EditorDetourNavigationComponent.h>
 #include <EditorComponents/EditorRecastNavigationMeshComponent.h>
 #include <EditorComponents/EditorRecastNavigationPhysXProviderComponent.h>
@@ -29,6 +30,7 @@ namespace RecastNavigation
             // This happens through the [MyComponent]::Reflect() function.
             m_descriptors.insert(m_descriptors.end(), {
                 RecastNavigationEditorSystemComponent::CreateDescriptor(),
+                EditorDetourCrowdComponent::CreateDescriptor(),
                 EditorDetourNavigationComponent::CreateDescriptor(),
                 EditorRecastNavigationMeshComponent::CreateDescriptor(),
                 EditorRecastNavigationPhysXProviderComponent::CreateDescriptor(),
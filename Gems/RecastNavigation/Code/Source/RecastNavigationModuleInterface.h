@@ -9,6 +9,7 @@
 #include <RecastNavigationSystemComponent.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Module/Module.h>
+#include <Components/DetourCrowdComponent.h>
 #include <Components/DetourNavigationComponent.h>
 #include <Components/RecastNavigationMeshComponent.h>
 #include <Components/RecastNavigationPhysXProviderComponent.h>
@@ -30,6 +31,7 @@ namespace RecastNavigation
             // This happens through the [MyComponent]::Reflect() function.
             m_descriptors.insert(m_descriptors.end(), {
                 RecastNavigationSystemComponent::CreateDescriptor(),
+                DetourCrowdComponent::CreateDescriptor(),
                 DetourNavigationComponent::CreateDescriptor(),
                 RecastNavigationMeshComponent::CreateDescriptor(),
                 RecastNavigationPhysXProviderComponent::CreateDescriptor(),
@@ -18,6 +18,7 @@
 #include <AzCore/UnitTest/Mocks/MockITime.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
 #include <AzFramework/Physics/PhysicsScene.h>
+#include <Components/DetourCrowdComponent.h>
 #include <Components/DetourNavigationComponent.h>
 #include <Components/RecastNavigationMeshComponent.h>
 #include <Components/RecastNavigationPhysXProviderComponent.h>
@@ -41,6 +42,9 @@ namespace RecastNavigationTests
     using RecastNavigation::NavMeshQuery;
     using RecastNavigation::DetourNavigationComponent;
     using RecastNavigation::DetourNavigationRequestBus;
+    using RecastNavigation::DetourCrowdComponent;
+    using RecastNavigation::DetourCrowdRequestBus;
+    using RecastNavigation::DetourCrowdRequests;
 
     class NavigationTest
         : public ::UnitTest::LeakDetectionFixture
@@ -78,6 +82,7 @@ namespace RecastNavigationTests
             RegisterComponent<AZ::EventSchedulerSystemComponent>();
             RegisterComponent<RecastNavigation::RecastNavigationSystemComponent>();
             RegisterComponent<RecastNavigation::DetourNavigationComponent>();
+            RegisterComponent<RecastNavigation::DetourCrowdComponent>();
 
             m_timeSystem = AZStd::make_unique<NiceMock<AZ::MockTimeSystem>>();
             m_mockSceneInterface = AZStd::make_unique<NiceMock<UnitTest::MockSceneInterface>>();
@@ -936,4 +941,106 @@ namespace RecastNavigationTests
             AZ::Vector3(0.f, 0.f, 0.f), AZ::Vector3(2.f, 2.f, 0.f));
         EXPECT_EQ(waypoints.size(), 0);
     }
+
+    TEST_F(NavigationTest, RegionUpdateOnlyRebuildsTilesOverlappingTheRegion)
+    {
+        Entity e;
+        PopulateEntity(e);
+        e.CreateComponent<DetourNavigationComponent>(e.GetId(), 3.f);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        ON_CALL(*m_mockPhysicsShape.get(), GetGeometry(_, _, _)).WillByDefault(Invoke([this]
+        (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb*)
+            {
+                AddTestGeometry(vertices, indices, true);
+            }));
+
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted);
+
+        ON_CALL(*m_mockPhysicsShape.get(), GetGeometry(_, _, _)).WillByDefault(Invoke([]
+        (
+            [[maybe_unused]] AZStd::vector<AZ::Vector3>& vertices,
+            [[maybe_unused]] AZStd::vector<AZ::u32>& indices,
+            [[maybe_unused]] const AZ::Aabb*)
+            {
+                // Act as if there colliders are gone.
+            }));
+
+        // A region far away from the navigation mesh doesn't touch any tile, so the old tile is kept.
+        bool result = false;
+        RecastNavigationMeshRequestBus::EventResult(result, e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshRegionBlockUntilCompleted,
+            AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3(500.f, 500.f, 0.f), AZ::Vector3::CreateOne()));
+        EXPECT_TRUE(result);
+
+        AZStd::vector<AZ::Vector3> waypoints;
+        DetourNavigationRequestBus::EventResult(waypoints, AZ::EntityId(1), &DetourNavigationRequests::FindPathBetweenPositions,
+            AZ::Vector3(0.f, 0.f, 0.f), AZ::Vector3(2.f, 2.f, 0.f));
+        EXPECT_GT(waypoints.size(), 1);
+
+        // A region overlapping the tile rebuilds it without the colliders.
+        RecastNavigationMeshRequestBus::EventResult(result, e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshRegionBlockUntilCompleted,
+            AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3::CreateOne()));
+        EXPECT_TRUE(result);
+
+        waypoints.clear();
+        DetourNavigationRequestBus::EventResult(waypoints, AZ::EntityId(1), &DetourNavigationRequests::FindPathBetweenPositions,
+            AZ::Vector3(0.f, 0.f, 0.f), AZ::Vector3(2.f, 2.f, 0.f));
+        EXPECT_EQ(waypoints.size(), 0);
+    }
+
+    TEST_F(NavigationTest, RegionUpdateWithInvalidRegionReturnsFalse)
+    {
+        Entity e;
+        PopulateEntity(e);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        bool result = true;
+        RecastNavigationMeshRequestBus::EventResult(result, e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshRegionBlockUntilCompleted,
+            AZ::Aabb::CreateNull());
+        EXPECT_FALSE(result);
+
+        result = true;
+        RecastNavigationMeshRequestBus::EventResult(result, e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshRegionAsync,
+            AZ::Aabb::CreateNull());
+        EXPECT_FALSE(result);
+    }
+
+    TEST_F(NavigationTest, CrowdAddAndRemoveAgents)
+    {
+        Entity e;
+        PopulateEntity(e);
+        e.CreateComponent<DetourCrowdComponent>(e.GetId(), 2, 0.5f, 2.f, 8.f, 3.5f);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        bool result = false;
+        DetourCrowdRequestBus::EventResult(result, e.GetId(), &DetourCrowdRequests::AddAgent, AZ::EntityId(100));
+        EXPECT_TRUE(result);
+
+        // The same entity can't be added twice.
+        DetourCrowdRequestBus::EventResult(result, e.GetId(), &DetourCrowdRequests::AddAgent, AZ::EntityId(100));
+        EXPECT_FALSE(result);
+
+        DetourCrowdRequestBus::EventResult(result, e.GetId(), &DetourCrowdRequests::AddAgent, AZ::EntityId(101));
+        EXPECT_TRUE(result);
+
+        // The crowd is full.
+        DetourCrowdRequestBus::EventResult(result, e.GetId(), &DetourCrowdRequests::AddAgent, AZ::EntityId(102));
+        EXPECT_FALSE(result);
+
+        int agentCount = 0;
+        DetourCrowdRequestBus::EventResult(agentCount, e.GetId(), &DetourCrowdRequests::GetAgentCount);
+        EXPECT_EQ(agentCount, 2);
+
+        DetourCrowdRequestBus::EventResult(result, e.GetId(), &DetourCrowdRequests::SetAgentTarget, AZ::EntityId(100), AZ::Vector3(2.f, 2.f, 0.f));
+        EXPECT_TRUE(result);
+        DetourCrowdRequestBus::EventResult(result, e.GetId(), &DetourCrowdRequests::SetAgentTarget, AZ::EntityId(102), AZ::Vector3(2.f, 2.f, 0.f));
+        EXPECT_FALSE(result);
+
+        DetourCrowdRequestBus::Event(e.GetId(), &DetourCrowdRequests::RemoveAgent, AZ::EntityId(100));
+        DetourCrowdRequestBus::EventResult(agentCount, e.GetId(), &DetourCrowdRequests::GetAgentCount);
+        EXPECT_EQ(agentCount, 1);
+    }
 }
@@ -11,6 +11,7 @@ set(FILES
     Include/RecastNavigation/RecastHelpers.h
     Include/RecastNavigation/RecastSmartPointer.h
 
+    Include/RecastNavigation/DetourCrowdBus.h
     Include/RecastNavigation/DetourNavigationBus.h
     Include/RecastNavigation/RecastNavigationBus.h
     Include/RecastNavigation/RecastNavigationMeshBus.h
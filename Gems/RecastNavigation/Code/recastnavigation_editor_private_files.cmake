@@ -10,6 +10,8 @@ set(FILES
     Source/RecastNavigationEditorSystemComponent.cpp
     Source/RecastNavigationEditorSystemComponent.h
 
+    Source/EditorComponents/EditorDetourCrowdComponent.h
+    Source/EditorComponents/EditorDetourCrowdComponent.cpp
     Source/EditorComponents/EditorDetourNavigationComponent.h
     Source/EditorComponents/EditorDetourNavigationComponent.cpp
     Source/EditorComponents/EditorRecastNavigationMeshComponent.h
@@ -11,6 +11,8 @@ set(FILES
     Source/RecastNavigationSystemComponent.cpp
     Source/RecastNavigationSystemComponent.h
 
+    Source/Components/DetourCrowdComponent.h
+    Source/Components/DetourCrowdComponent.cpp
     Source/Components/DetourNavigationComponent.h
     Source/Components/DetourNavigationComponent.cpp
     Source/Components/RecastNavigationMeshComponent.h
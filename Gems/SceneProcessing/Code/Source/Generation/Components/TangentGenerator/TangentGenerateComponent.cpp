@@ -27,8 +27,11 @@
 #include <SceneAPI/SceneData/GraphData/MeshVertexBitangentData.h>
 #include <SceneAPI/SceneData/GraphData/MeshVertexTangentData.h>
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/Vector4.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 
@@ -131,25 +134,60 @@ namespace AZ::SceneGenerationComponents
             meshes.emplace_back(mesh, nodeIndex);
         }
 
-        // Iterate over them. We had to build the array before as this method can insert new nodes, so using the iterator directly would fail.
-        for (auto& [mesh, nodeIndex] : meshes)
+        // Prepare the tangent layers of every mesh first. We had to build the array before as this inserts new nodes, so using the iterator directly would fail.
+        AZStd::vector<MeshTangentGeneration> generations(meshes.size());
+        bool allSuccess = true;
+        for (size_t meshIndex = 0; meshIndex < meshes.size(); ++meshIndex)
         {
-            // Generate tangents for the mesh (if this is desired or needed).
-            if (!GenerateTangentsForMesh(context.GetScene(), nodeIndex, mesh, generationMethod))
+            auto& [mesh, nodeIndex] = meshes[meshIndex];
+            allSuccess &= GenerateTangentsForMesh(context.GetScene(), nodeIndex, mesh, generationMethod, generations[meshIndex]);
+        }
+
+        if (!allSuccess)
+        {
+            return AZ::SceneAPI::Events::ProcessingResult::Failure;
+        }
+
+        // The graph is no longer modified, so the meshes can generate their tangents in parallel.
+        AZStd::atomic_bool generationSuccess{ true };
+        AZ::JobCompletion jobCompletion;
+        for (const MeshTangentGeneration& generation : generations)
+        {
+            if (generation.m_uvSets.empty())
             {
-                return AZ::SceneAPI::Events::ProcessingResult::Failure;
+                continue;
             }
 
-            // Now that we have the tangents and bitangents, calculate the tangent w values for the ones that we imported from the scene file, as they only have xyz.
-            // But only do this if we are getting tangents from the source scene, because MikkT will provide us with a correct tangent.w already
-            if (generationMethod == SceneAPI::DataTypes::TangentGenerationMethod::FromSourceScene)
+            AZ::Job* job = AZ::CreateJobFunction([&generation, &generationSuccess]()
+            {
+                AZ_PROFILE_SCOPE(Animation, "TangentGenerateComponent::GenerateTangentData::MeshJob");
+                if (!RunTangentGeneration(generation))
+                {
+                    generationSuccess = false;
+                }
+            }, true, nullptr);
+
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+
+        if (!generationSuccess)
+        {
+            return AZ::SceneAPI::Events::ProcessingResult::Failure;
+        }
+
+        // Now that we have the tangents and bitangents, calculate the tangent w values for the ones that we imported from the scene file, as they only have xyz.
+        // But only do this if we are getting tangents from the source scene, because MikkT will provide us with a correct tangent.w already
+        if (generationMethod == SceneAPI::DataTypes::TangentGenerationMethod::FromSourceScene)
+        {
+            for (auto& [mesh, nodeIndex] : meshes)
             {
                 if (!UpdateFbxTangentWValues(graph, nodeIndex, mesh, debugBitangentFlip))
                 {
                     return AZ::SceneAPI::Events::ProcessingResult::Failure;
                 }
             }
-            
         }
 
         return AZ::SceneAPI::Events::ProcessingResult::Success;
@@ -254,7 +292,8 @@ namespace AZ::SceneGenerationComponents
         AZ::SceneAPI::Containers::Scene& scene,
         const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
         AZ::SceneAPI::DataTypes::IMeshData* meshData,
-        AZ::SceneAPI::DataTypes::TangentGenerationMethod ruleGenerationMethod)
+        AZ::SceneAPI::DataTypes::TangentGenerationMethod ruleGenerationMethod,
+        MeshTangentGeneration& outGeneration)
     {
         AZ::SceneAPI::Containers::SceneGraph& graph = scene.GetGraph();
 
@@ -269,10 +308,9 @@ namespace AZ::SceneGenerationComponents
         const AZ::SceneAPI::SceneData::TangentsRule* tangentsRule = GetTangentRule(scene);
 
         // Find all blend shape data under the mesh. We need to generate the tangent and bitangent for blend shape as well.
-        AZStd::vector<AZ::SceneData::GraphData::BlendShapeData*> blendShapes;
-        FindBlendShapes(graph, nodeIndex, blendShapes);
+        FindBlendShapes(graph, nodeIndex, outGeneration.m_blendShapes);
 
-        // Generate tangents/bitangents for all uv sets.
+        // Prepare the generation of tangents/bitangents for all uv sets.
         bool allSuccess = true;
         for (size_t uvSetIndex = 0; uvSetIndex < uvSetCount; ++uvSetIndex)
         {
@@ -338,14 +376,13 @@ namespace AZ::SceneGenerationComponents
             // Generate using MikkT space.
             case AZ::SceneAPI::DataTypes::TangentGenerationMethod::MikkT:
             {
-                const AZ::SceneAPI::DataTypes::MikkTSpaceMethod tSpaceMethod = tangentsRule ? tangentsRule->GetMikkTSpaceMethod() : AZ::SceneAPI::DataTypes::MikkTSpaceMethod::TSpace;
-
-                allSuccess &= AZ::TangentGeneration::Mesh::MikkT::GenerateTangents(meshData, uvData, tangentData, bitangentData, tSpaceMethod);
-
-                for (AZ::SceneData::GraphData::BlendShapeData* blendShape : blendShapes)
-                {
-                    allSuccess &= AZ::TangentGeneration::BlendShape::MikkT::GenerateTangents(blendShape, uvSetIndex, tSpaceMethod);
-                }
+                UvSetTangentGeneration& uvSetGeneration = outGeneration.m_uvSets.emplace_back();
+                uvSetGeneration.m_meshData = meshData;
+                uvSetGeneration.m_uvData = uvData;
+                uvSetGeneration.m_tangentData = tangentData;
+                uvSetGeneration.m_bitangentData = bitangentData;
+                uvSetGeneration.m_uvSetIndex = uvSetIndex;
+                uvSetGeneration.m_tSpaceMethod = tangentsRule ? tangentsRule->GetMikkTSpaceMethod() : AZ::SceneAPI::DataTypes::MikkTSpaceMethod::TSpace;
             }
             break;
 
@@ -360,6 +397,23 @@ namespace AZ::SceneGenerationComponents
         return allSuccess;
     }
 
+    bool TangentGenerateComponent::RunTangentGeneration(const MeshTangentGeneration& generation)
+    {
+        bool allSuccess = true;
+        for (const UvSetTangentGeneration& uvSet : generation.m_uvSets)
+        {
+            allSuccess &= AZ::TangentGeneration::Mesh::MikkT::GenerateTangents(
+                uvSet.m_meshData, uvSet.m_uvData, uvSet.m_tangentData, uvSet.m_bitangentData, uvSet.m_tSpaceMethod);
+
+            for (AZ::SceneData::GraphData::BlendShapeData* blendShape : generation.m_blendShapes)
+            {
+                allSuccess &= AZ::TangentGeneration::BlendShape::MikkT::GenerateTangents(blendShape, uvSet.m_uvSetIndex, uvSet.m_tSpaceMethod);
+            }
+        }
+
+        return allSuccess;
+    }
+
     size_t TangentGenerateComponent::CalcUvSetCount(AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex) const
     {
         const auto nameContentView = AZ::SceneAPI::Containers::Views::MakePairView(graph.GetNameStorage(), graph.GetContentStorage());
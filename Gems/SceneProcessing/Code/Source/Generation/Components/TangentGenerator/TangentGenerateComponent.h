@@ -55,6 +55,27 @@ namespace AZ::SceneGenerationComponents
         AZ::SceneAPI::Events::ProcessingResult GenerateTangentData(TangentGenerateContext& context);
 
     private:
+        //! MikkT generation for one uv set of a mesh. The tangent layers are created in the scene graph up front on the calling thread,
+        //! so running the generation itself only touches the data of its own mesh and can be done on a job.
+        struct UvSetTangentGeneration
+        {
+            AZ::SceneAPI::DataTypes::IMeshData* m_meshData = nullptr;
+            AZ::SceneAPI::DataTypes::IMeshVertexUVData* m_uvData = nullptr;
+            AZ::SceneAPI::DataTypes::IMeshVertexTangentData* m_tangentData = nullptr;
+            AZ::SceneAPI::DataTypes::IMeshVertexBitangentData* m_bitangentData = nullptr;
+            size_t m_uvSetIndex = 0;
+            AZ::SceneAPI::DataTypes::MikkTSpaceMethod m_tSpaceMethod = AZ::SceneAPI::DataTypes::MikkTSpaceMethod::TSpace;
+        };
+
+        //! All uv sets of a mesh are generated in order by the same job, as the blend shapes of the mesh store a single tangent set.
+        struct MeshTangentGeneration
+        {
+            AZStd::vector<UvSetTangentGeneration> m_uvSets;
+            AZStd::vector<AZ::SceneData::GraphData::BlendShapeData*> m_blendShapes;
+        };
+
+        static bool RunTangentGeneration(const MeshTangentGeneration& generation);
+
         void FindBlendShapes(
             AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
             AZStd::vector<AZ::SceneData::GraphData::BlendShapeData*>& outBlendShapes) const;
@@ -62,7 +83,8 @@ namespace AZ::SceneGenerationComponents
             AZ::SceneAPI::Containers::Scene& scene,
             const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
             AZ::SceneAPI::DataTypes::IMeshData* meshData,
-            AZ::SceneAPI::DataTypes::TangentGenerationMethod defaultGenerationMethod);
+            AZ::SceneAPI::DataTypes::TangentGenerationMethod defaultGenerationMethod,
+            MeshTangentGeneration& outGeneration);
         bool UpdateFbxTangentWValues(
             AZ::SceneAPI::Containers::SceneGraph& graph,
             const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
@@ -70,6 +70,8 @@ namespace ScriptCanvasBuilder
         AddExplicitDestructCallForMemberVariables,
         DoNotLoadScriptEventsDuringCreateJobs,
         FixEntityIdReturnValuesInEvents,
+        PoolInterpretedInstances,
+        NativeGraphThreadSafety,
         // add new entries above
         Current,
     };
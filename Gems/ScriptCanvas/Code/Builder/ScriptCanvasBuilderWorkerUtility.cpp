@@ -25,6 +25,7 @@
 #include <ScriptCanvas/Core/Node.h>
 #include <ScriptCanvas/Grammar/AbstractCodeModel.h>
 #include <ScriptCanvas/Results/ErrorText.h>
+#include <ScriptCanvas/Translation/TranslationUtilities.h>
 #include <ScriptCanvas/Utils/BehaviorContextUtils.h>
 #include <Source/Components/SceneComponent.h>
 #include <ScriptCanvas/Core/Core.h>
@@ -229,6 +230,33 @@ namespace ScriptCanvasBuilder
 
         const auto& translation = translationResult.m_translations.find(ScriptCanvas::Translation::TargetFlags::Lua)->second;
 
+        if (ScriptCanvas::Grammar::g_emitNativeTranslation)
+        {
+            auto dotH = translationResult.m_translations.find(ScriptCanvas::Translation::TargetFlags::Hpp);
+            auto dotCPP = translationResult.m_translations.find(ScriptCanvas::Translation::TargetFlags::Cpp);
+
+            if (dotH != translationResult.m_translations.end() && dotCPP != translationResult.m_translations.end())
+            {
+                // the raw save already wrote them out
+                if (!request.rawSaveDebugOutput)
+                {
+                    const ScriptCanvas::Grammar::Source& source = translationResult.m_model->GetSource();
+                    auto saveOutcome = ScriptCanvas::Translation::SaveDotH(source, dotH->second.m_text);
+                    if (saveOutcome.IsSuccess())
+                    {
+                        saveOutcome = ScriptCanvas::Translation::SaveDotCPP(source, dotCPP->second.m_text);
+                    }
+
+                    AZ_Warning(s_scriptCanvasBuilder, saveOutcome.IsSuccess(), "Failed to save the native translation of %s: %s"
+                        , input.fileNameOnly.c_str(), saveOutcome.IsSuccess() ? "" : saveOutcome.GetError().c_str());
+                }
+            }
+            else
+            {
+                AZ_TracePrintf(s_scriptCanvasBuilder, "%s has no native translation, it will execute interpreted", input.fileNameOnly.c_str());
+            }
+        }
+
         AZ::IO::MemoryStream inputStream(translation.m_text.data(), translation.m_text.size());
         AzFramework::ScriptCompileRequest compileRequest;
 
@@ -398,6 +426,12 @@ namespace ScriptCanvasBuilder
     ScriptCanvas::Translation::Result TranslateToLua(ScriptCanvas::Grammar::Request& request)
     {
         request.translationTargetFlags = ScriptCanvas::Translation::TargetFlags::Lua;
+
+        if (ScriptCanvas::Grammar::g_emitNativeTranslation)
+        {
+            request.translationTargetFlags |= ScriptCanvas::Translation::TargetFlags::Cpp | ScriptCanvas::Translation::TargetFlags::Hpp;
+        }
+
         return ScriptCanvas::Translation::ParseAndTranslateGraph(request);
     }
 }
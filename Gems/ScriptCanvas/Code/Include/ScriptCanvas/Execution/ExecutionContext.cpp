@@ -14,6 +14,7 @@
 #include <ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPerActivation.h>
 #include <ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPure.h>
 #include <ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedSingleton.h>
+#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>
 
 #include <ScriptCanvas/Execution/ExecutionContext.h>
 
@@ -121,7 +122,7 @@ namespace ScriptCanvas
             }
 
             // \todo, the stack push functions could be retrieved here
-            InitializeStaticCreationFunction(runtimeData);
+            InitializeStaticCreationFunction(runtimeData, *behaviorContext);
             InitializeStaticActivationInputs(runtimeData, *behaviorContext);
             InitializeStaticCloners(runtimeData, *behaviorContext);
         }
@@ -185,10 +186,27 @@ namespace ScriptCanvas
             }
         }
 
-        void Context::InitializeStaticCreationFunction(RuntimeData& runtimeData)
+        void Context::InitializeStaticCreationFunction(RuntimeData& runtimeData, AZ::BehaviorContext& behaviorContext)
         {
             const Grammar::ExecutionStateSelection selection = runtimeData.m_input.m_executionSelection;
 
+            // pure graphs translated ahead of time to C++ skip the Lua VM entirely, if the project compiled and registered them
+            if (selection == Grammar::ExecutionStateSelection::InterpretedPure
+                || selection == Grammar::ExecutionStateSelection::InterpretedPureOnGraphStart)
+            {
+                if (auto registry = GetNativeGraphRegistry())
+                {
+                    if (const NativeGraph* nativeGraph = registry->Find(runtimeData.m_script.GetId().m_guid, behaviorContext))
+                    {
+                        runtimeData.m_createExecution = [nativeGraph](Execution::StateStorage& storage, ExecutionStateConfig& config)->ExecutionState*
+                        {
+                            return Execution::CreateNative(storage, config, *nativeGraph);
+                        };
+                        return;
+                    }
+                }
+            }
+
             switch (selection)
             {
             case Grammar::ExecutionStateSelection::InterpretedPure:
@@ -54,7 +54,7 @@ namespace ScriptCanvas
         private:
             static void InitializeStaticActivationInputs(RuntimeData& runtimeData, AZ::BehaviorContext& behaviorContext);
             static void InitializeStaticCloners(RuntimeData& runtimeData, AZ::BehaviorContext& behaviorContext);
-            static void InitializeStaticCreationFunction(RuntimeData& runtimeData);
+            static void InitializeStaticCreationFunction(RuntimeData& runtimeData, AZ::BehaviorContext& behaviorContext);
         };
 
         class TypeErasedReference
@@ -24,6 +24,12 @@ namespace ScriptCanvas
             return reinterpret_cast<ExecutionState*>(&storage.data);
         }
 
+        ExecutionState* CreateNative(StateStorage& storage, ExecutionStateConfig& config, const NativeGraph& graph)
+        {
+            new (&storage.data) ExecutionStateNative(config, graph);
+            return reinterpret_cast<ExecutionState*>(&storage.data);
+        }
+
         ExecutionState* CreatePure(StateStorage& storage, ExecutionStateConfig& config)
         {
             new (&storage.data) ExecutionStateInterpretedPure(config);
@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Script/ScriptContext.h>
 #include <AzCore/Script/lua/lua.h>
 #include <ScriptCanvas/Execution/Interpreted/ExecutionInterpretedAPI.h>
@@ -13,11 +14,111 @@
 #include <ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPerActivation.h>
 #include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
 
+namespace ExecutionStateInterpretedPerActivationCpp
+{
+    using namespace ScriptCanvas;
+
+    AZ_CVAR(AZ::u32, g_maxPooledInstancesPerGraph, 64, {}, AZ::ConsoleFunctorFlags::Null
+        , "The maximum number of deactivated Lua instances kept per Script Canvas graph for reuse by later activations, 0 disables pooling.");
+
+    // Lua: graph_VM
+    // if the graph supports renewal and has a pooled instance:
+    //      Lua: graph_VM, graph_VM['Renew_SCVM'], instance, and returns true
+    // otherwise:
+    //      Lua: graph_VM, and returns false
+    bool PushPooledInstance(lua_State* lua)
+    {
+        const int graphIndex = lua_gettop(lua);
+
+        lua_pushstring(lua, Grammar::k_InstancePoolNameInterpretedClass);
+        lua_rawget(lua, graphIndex);
+        // Lua: graph_VM, pool?
+        const lua_Integer poolCount = lua_istable(lua, -1) ? static_cast<lua_Integer>(lua_rawlen(lua, -1)) : 0;
+        if (poolCount == 0)
+        {
+            lua_pop(lua, 1);
+            // Lua: graph_VM
+            return false;
+        }
+
+        lua_getfield(lua, graphIndex, Grammar::k_RenewNameInterpretedClass);
+        // Lua: graph_VM, pool, graph_VM['Renew_SCVM']
+        lua_rawgeti(lua, -2, poolCount);
+        // Lua: graph_VM, pool, graph_VM['Renew_SCVM'], instance
+        lua_pushnil(lua);
+        lua_rawseti(lua, -4, poolCount);
+        lua_remove(lua, -3);
+        // Lua: graph_VM, graph_VM['Renew_SCVM'], instance
+        return true;
+    }
+
+    // Lua: instance
+    // clears and pools the instance, if there is room and the graph supports renewal
+    // Lua:
+    void PoolInstance(lua_State* lua)
+    {
+        const AZ::u32 maxPooledInstances = g_maxPooledInstancesPerGraph;
+        const int instanceIndex = lua_gettop(lua);
+
+        if (maxPooledInstances == 0 || !lua_istable(lua, instanceIndex) || !lua_getmetatable(lua, instanceIndex))
+        {
+            lua_settop(lua, instanceIndex - 1);
+            return;
+        }
+
+        // Lua: instance, graph_Instance_MT
+        lua_getfield(lua, -1, "__index");
+        // Lua: instance, graph_Instance_MT, graph_VM
+        const int graphIndex = lua_gettop(lua);
+        lua_getfield(lua, graphIndex, Grammar::k_RenewNameInterpretedClass);
+        // Lua: instance, graph_Instance_MT, graph_VM, graph_VM['Renew_SCVM']
+        const bool supportsRenewal = lua_isfunction(lua, -1);
+        lua_pop(lua, 1);
+
+        if (supportsRenewal && lua_istable(lua, graphIndex))
+        {
+            lua_pushstring(lua, Grammar::k_InstancePoolNameInterpretedClass);
+            lua_rawget(lua, graphIndex);
+            // Lua: instance, graph_Instance_MT, graph_VM, pool?
+            if (!lua_istable(lua, -1))
+            {
+                lua_pop(lua, 1);
+                lua_createtable(lua, static_cast<int>(AZStd::min(maxPooledInstances, 16u)), 0);
+                lua_pushstring(lua, Grammar::k_InstancePoolNameInterpretedClass);
+                lua_pushvalue(lua, -2);
+                lua_rawset(lua, graphIndex);
+            }
+
+            // Lua: instance, graph_Instance_MT, graph_VM, pool
+            const lua_Integer poolCount = static_cast<lua_Integer>(lua_rawlen(lua, -1));
+            if (poolCount < static_cast<lua_Integer>(maxPooledInstances))
+            {
+                // every field goes, so nothing from the previous activation survives Renew_SCVM, but the table keeps its storage
+                lua_pushnil(lua);
+                while (lua_next(lua, instanceIndex))
+                {
+                    lua_pop(lua, 1);
+                    lua_pushvalue(lua, -1);
+                    lua_pushnil(lua);
+                    lua_rawset(lua, instanceIndex);
+                }
+
+                lua_pushvalue(lua, instanceIndex);
+                lua_rawseti(lua, -2, poolCount + 1);
+            }
+        }
+
+        lua_settop(lua, instanceIndex - 1);
+        // Lua:
+    }
+}
+
 namespace ScriptCanvas
 {
     ExecutionStateInterpretedPerActivation::ExecutionStateInterpretedPerActivation(ExecutionStateConfig& config)
         : ExecutionStateInterpreted(config)
         , m_deactivationRequired(false)
+        , m_isReusable(false)
         , m_luaRegistryIndex(LUA_NOREF)
     {}
 
@@ -49,12 +150,20 @@ namespace ScriptCanvas
 
     void ExecutionStateInterpretedPerActivation::Initialize()
     {
+        using namespace ExecutionStateInterpretedPerActivationCpp;
+
         auto lua = LoadLuaScript();
         // Lua: graph_VM
-        lua_getfield(lua, -1, "new");
-        // Lua: graph_VM, graph_VM['new']
+        const int instanceArgCount = PushPooledInstance(lua) ? 1 : 0;
+
+        if (instanceArgCount == 0)
+        {
+            lua_getfield(lua, -1, "new");
+        }
+
+        // Lua: graph_VM, graph_VM['new'] or graph_VM, graph_VM['Renew_SCVM'], instance
         Execution::ExecutionStatePush(lua, this);
-        // Lua: graph_VM, graph_VM['new'], executionState
+        // Lua: graph_VM, graph_VM['new'], (instance), executionState
         Execution::ActivationInputArray storage;
         Execution::ActivationData data(GetRuntimeDataOverrides(), storage);
         Execution::ActivationInputRange range = Execution::Context::CreateActivateInputRange(data);
@@ -64,16 +173,16 @@ namespace ScriptCanvas
             SC_RUNTIME_CHECK_RETURN(!data.variableOverrides.m_dependencies.empty()
                 , "ExecutionStateInterpretedPerActivation::Initialize dependencies are empty or null, check the processing of this asset");
             lua_pushlightuserdata(lua, const_cast<void*>(reinterpret_cast<const void*>(&data.variableOverrides.m_dependencies)));
-            // Lua: graph_VM, graph_VM['new'], executionState, runtimeDataOverrides
+            // Lua: graph_VM, graph_VM['new'], (instance), executionState, runtimeDataOverrides
             Execution::PushActivationArgs(lua, range.inputs, range.totalCount);
-            // Lua: graph_VM, graph_VM['new'], executionState, runtimeDataOverrides, args...
-            AZ::Internal::LuaSafeCall(lua, aznumeric_caster(2 + range.totalCount), 1);
+            // Lua: graph_VM, graph_VM['new'], (instance), executionState, runtimeDataOverrides, args...
+            AZ::Internal::LuaSafeCall(lua, aznumeric_caster(instanceArgCount + 2 + range.totalCount), 1);
         }
         else
         {
             Execution::PushActivationArgs(lua, range.inputs, range.totalCount);
-            // Lua: graph_VM, graph_VM['new'], executionState, args...
-            AZ::Internal::LuaSafeCall(lua, aznumeric_caster(1 + range.totalCount), 1);
+            // Lua: graph_VM, graph_VM['new'], (instance), executionState, args...
+            AZ::Internal::LuaSafeCall(lua, aznumeric_caster(instanceArgCount + 1 + range.totalCount), 1);
         }
 
         // Lua: graph_VM, instance
@@ -100,13 +209,15 @@ namespace ScriptCanvas
             // Lua: instance, instance['Deactivate']
             lua_pushvalue(lua, -2);
             // Lua: instance, instance['Deactivate'], instance
-            AZ::Internal::LuaSafeCall(lua, 1, 0);
+            const bool isDeactivated = AZ::Internal::LuaSafeCall(lua, 1, 0);
             // Lua: instance
             lua_getfield(lua, -1, "Destruct");
             // Lua: instance, instance['Destruct']
             lua_pushvalue(lua, -2);
             // Lua: instance, instance['Destruct'], instance
-            AZ::Internal::LuaSafeCall(lua, 1, 0);
+            const bool isDestructed = AZ::Internal::LuaSafeCall(lua, 1, 0);
+            // an instance that failed to shut down may still be referenced by handlers, and must not be reused
+            m_isReusable = isDeactivated && isDestructed;
             // Lua: instance
             AZ::Internal::azlua_pop(lua, 1);
             // Lua:
@@ -124,6 +235,16 @@ namespace ScriptCanvas
 
     void ExecutionStateInterpretedPerActivation::ReleaseInterpretedInstanceUnchecked()
     {
+        if (m_isReusable)
+        {
+            // Lua:
+            lua_rawgeti(m_luaState, LUA_REGISTRYINDEX, m_luaRegistryIndex);
+            // Lua: instance
+            ExecutionStateInterpretedPerActivationCpp::PoolInstance(m_luaState);
+            // Lua:
+            m_isReusable = false;
+        }
+
         luaL_unref(m_luaState, LUA_REGISTRYINDEX, m_luaRegistryIndex);
         m_luaRegistryIndex = LUA_NOREF;
     }
@@ -31,6 +31,8 @@ namespace ScriptCanvas
 
     protected:
         bool m_deactivationRequired;
+        // true once the instance has been cleanly deactivated, so it can be cleared and pooled for the next activation of the graph
+        bool m_isReusable;
 
         void ClearLuaRegistryIndex();
 
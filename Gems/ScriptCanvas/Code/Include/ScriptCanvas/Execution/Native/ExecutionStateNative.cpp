@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/ScriptCanvas/ScriptCanvasAttributes.h>
+#include <ScriptCanvas/Execution/ExecutionContext.h>
+
+#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>
+
+namespace ExecutionStateNativeCpp
+{
+    AZ_CVAR(bool, g_executeThreadSafeGraphsInParallel, true, {}, AZ::ConsoleFunctorFlags::Null
+        , "When enabled, natively compiled graphs that only call thread safe methods execute on worker threads instead of the main thread.");
+}
+
+namespace ScriptCanvas
+{
+    namespace Execution
+    {
+        static AZ::EnvironmentVariable<NativeGraphRegistry> s_nativeGraphRegistry;
+
+        void NativeGraphRegistry::Register(const AZ::Uuid& sourceId, NativeGraphFactory factory)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            Entry& entry = m_graphs[sourceId];
+            AZ_Warning("ScriptCanvas", !entry.m_graph, "Native graph %s registered more than once, the last registration wins", sourceId.ToString<AZStd::string>().c_str());
+            entry.m_graph = factory();
+            entry.m_isInitialized = false;
+            entry.m_isValid = false;
+        }
+
+        void NativeGraphRegistry::Unregister(const AZ::Uuid& sourceId)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_graphs.erase(sourceId);
+        }
+
+        const NativeGraph* NativeGraphRegistry::Find(const AZ::Uuid& sourceId, AZ::BehaviorContext& behaviorContext)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            auto iter = m_graphs.find(sourceId);
+            if (iter == m_graphs.end() || !iter->second.m_graph)
+            {
+                return nullptr;
+            }
+
+            Entry& entry = iter->second;
+            if (!entry.m_isInitialized)
+            {
+                entry.m_isInitialized = true;
+                entry.m_isValid = entry.m_graph->Initialize(behaviorContext);
+                AZ_Warning("ScriptCanvas", entry.m_isValid, "Native graph %s failed to initialize against the BehaviorContext, it will run interpreted"
+                    , sourceId.ToString<AZStd::string>().c_str());
+            }
+
+            return entry.m_isValid ? entry.m_graph.get() : nullptr;
+        }
+
+        void InitNativeGraphRegistry()
+        {
+            s_nativeGraphRegistry = AZ::Environment::CreateVariable<NativeGraphRegistry>(s_nativeGraphRegistryName);
+        }
+
+        void ResetNativeGraphRegistry()
+        {
+            s_nativeGraphRegistry.Reset();
+        }
+
+        AZ::EnvironmentVariable<NativeGraphRegistry> GetNativeGraphRegistry()
+        {
+            return AZ::Environment::FindVariable<NativeGraphRegistry>(s_nativeGraphRegistryName);
+        }
+
+        const AZ::BehaviorMethod* FindNativeMethod(AZ::BehaviorContext& behaviorContext, const char* className, const char* methodName)
+        {
+            if (!className || className[0] == '\0')
+            {
+                auto methodIter = behaviorContext.m_methods.find(methodName);
+                return methodIter != behaviorContext.m_methods.end() ? methodIter->second : nullptr;
+            }
+
+            auto classIter = behaviorContext.m_classes.find(className);
+            if (classIter == behaviorContext.m_classes.end())
+            {
+                return nullptr;
+            }
+
+            auto methodIter = classIter->second->m_methods.find(methodName);
+            return methodIter != classIter->second->m_methods.end() ? methodIter->second : nullptr;
+        }
+
+        const AZ::BehaviorMethod* FindNativeMethod(AZ::BehaviorContext& behaviorContext, const AZ::TypeId& classType, const char* methodName)
+        {
+            auto classIter = behaviorContext.m_typeToClassMap.find(classType);
+            if (classIter == behaviorContext.m_typeToClassMap.end())
+            {
+                return nullptr;
+            }
+
+            auto methodIter = classIter->second->m_methods.find(methodName);
+            return methodIter != classIter->second->m_methods.end() ? methodIter->second : nullptr;
+        }
+
+        bool IsNativeMethodThreadSafe(const AZ::BehaviorMethod* method)
+        {
+            return method && AZ::FindAttribute(AZ::ScriptCanvasAttributes::ThreadSafe, method->m_attributes);
+        }
+    }
+
+    ExecutionStateNative::ExecutionStateNative(ExecutionStateConfig& config, const Execution::NativeGraph& graph)
+        : ExecutionState(config)
+        , m_graph(graph)
+    {}
+
+    ExecutionStateNative::~ExecutionStateNative()
+    {
+        WaitForWorkerThread();
+    }
+
+    void ExecutionStateNative::Execute()
+    {
+        WaitForWorkerThread();
+
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (!m_graph.IsThreadSafe() || !ExecutionStateNativeCpp::g_executeThreadSafeGraphsInParallel || !jobContext)
+        {
+            ExecuteOnCurrentThread();
+            return;
+        }
+
+        // the activation inputs refer to the runtime overrides, which outlive the job, since this state waits for it before it is stopped
+        m_workerCompletion = AZStd::make_unique<AZ::JobCompletion>(jobContext);
+        AZ::Job* job = AZ::CreateJobFunction([this]()
+        {
+            ExecuteOnCurrentThread();
+        }, true, jobContext);
+        job->SetDependent(m_workerCompletion.get());
+        job->Start();
+    }
+
+    void ExecutionStateNative::ExecuteOnCurrentThread()
+    {
+        Execution::ActivationInputArray storage;
+        Execution::ActivationData data(GetRuntimeDataOverrides(), storage);
+        Execution::ActivationInputRange range = Execution::Context::CreateActivateInputRange(data);
+        m_graph.Execute(*this, range.inputs, range.totalCount);
+    }
+
+    ExecutionMode ExecutionStateNative::GetExecutionMode() const
+    {
+        return ExecutionMode::Native;
+    }
+
+    void ExecutionStateNative::Initialize()
+    {}
+
+    bool ExecutionStateNative::IsPure() const
+    {
+        return true;
+    }
+
+    void ExecutionStateNative::StopExecution()
+    {
+        WaitForWorkerThread();
+    }
+
+    void ExecutionStateNative::WaitForWorkerThread()
+    {
+        if (m_workerCompletion)
+        {
+            m_workerCompletion->StartAndWaitForCompletion();
+            m_workerCompletion.reset();
+        }
+    }
+}
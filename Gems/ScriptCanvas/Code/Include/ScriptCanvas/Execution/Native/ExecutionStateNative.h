@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Module/Environment.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <ScriptCanvas/Execution/ExecutionState.h>
+
+namespace AZ
+{
+    class BehaviorContext;
+    class BehaviorMethod;
+    class JobCompletion;
+    struct BehaviorArgument;
+}
+
+namespace ScriptCanvas
+{
+    namespace Execution
+    {
+        /// <summary>
+        /// \class NativeGraph - the interface implemented by the C++ code that GraphToCpp generates for a graph ahead of time.
+        /// A single instance is shared by all execution states of the graph, so implementations must not keep per activation state.
+        /// </summary>
+        class NativeGraph
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(NativeGraph, AZ::SystemAllocator);
+
+            virtual ~NativeGraph() = default;
+
+            /// Resolves everything the graph needs from the BehaviorContext, returns false if anything is missing.
+            virtual bool Initialize(AZ::BehaviorContext& behaviorContext) = 0;
+
+            /// Executes the graph, the inputs are the activation inputs of the graph, in the same order the interpreted version receives them.
+            virtual void Execute(ExecutionState& executionState, AZ::BehaviorArgument* inputs, size_t inputCount) const = 0;
+
+            /// True if every method the graph calls is marked with AZ::ScriptCanvasAttributes::ThreadSafe, only valid after Initialize.
+            virtual bool IsThreadSafe() const { return false; }
+        };
+
+        using NativeGraphFactory = AZStd::unique_ptr<NativeGraph>(*)();
+
+        /// Holds the natively compiled graphs, keyed by the source asset id of the graph they were translated from.
+        struct NativeGraphRegistry final
+        {
+            AZ_TYPE_INFO(NativeGraphRegistry, "{6D9AE8A4-1C6F-4E63-9E33-54F5B9A2C7E1}");
+            AZ_CLASS_ALLOCATOR(NativeGraphRegistry, AZ::SystemAllocator);
+
+            void Register(const AZ::Uuid& sourceId, NativeGraphFactory factory);
+            void Unregister(const AZ::Uuid& sourceId);
+
+            /// Returns the initialized native graph for the source asset, or nullptr if there is none, or it failed to initialize.
+            const NativeGraph* Find(const AZ::Uuid& sourceId, AZ::BehaviorContext& behaviorContext);
+
+        private:
+            struct Entry
+            {
+                AZStd::unique_ptr<NativeGraph> m_graph;
+                bool m_isInitialized = false;
+                bool m_isValid = false;
+            };
+
+            AZStd::mutex m_mutex;
+            AZStd::unordered_map<AZ::Uuid, Entry> m_graphs;
+        };
+
+        void InitNativeGraphRegistry();
+        void ResetNativeGraphRegistry();
+        AZ::EnvironmentVariable<NativeGraphRegistry> GetNativeGraphRegistry();
+
+        static constexpr const char* s_nativeGraphRegistryName = "ScriptCanvasNativeGraphRegistry";
+
+        /// Used by generated code to resolve a method once, at initialization. An empty class name finds a global method.
+        const AZ::BehaviorMethod* FindNativeMethod(AZ::BehaviorContext& behaviorContext, const char* className, const char* methodName);
+
+        /// Used by generated code to resolve a method called on a variable, by the type of the variable.
+        const AZ::BehaviorMethod* FindNativeMethod(AZ::BehaviorContext& behaviorContext, const AZ::TypeId& classType, const char* methodName);
+
+        /// Used by generated code to determine if the graph may execute on a worker thread.
+        bool IsNativeMethodThreadSafe(const AZ::BehaviorMethod* method);
+    }
+
+    /// <summary>
+    /// \class ExecutionStateNative - executes a pure graph through its ahead of time translation to C++, rather than through Lua.
+    /// Graphs that are thread safe execute on a worker thread, StopExecution waits for them to complete.
+    /// </summary>
+    class ExecutionStateNative
+        : public ExecutionState
+    {
+    public:
+        AZ_RTTI(ExecutionStateNative, "{0F3B7F2C-8E1D-4C55-A9B4-2E0D7C1E9B35}", ExecutionState);
+        AZ_CLASS_ALLOCATOR(ExecutionStateNative, AZ::SystemAllocator);
+
+        ExecutionStateNative(ExecutionStateConfig& config, const Execution::NativeGraph& graph);
+
+        ~ExecutionStateNative() override;
+
+        void Execute() override;
+
+        ExecutionMode GetExecutionMode() const override;
+
+        void Initialize() override;
+
+        bool IsPure() const override;
+
+        void StopExecution() override;
+
+    private:
+        const Execution::NativeGraph& m_graph;
+        // only allocated while the graph executes on a worker thread
+        AZStd::unique_ptr<AZ::JobCompletion> m_workerCompletion;
+
+        void ExecuteOnCurrentThread();
+
+        void WaitForWorkerThread();
+    };
+}
@@ -12,6 +12,7 @@ namespace ScriptCanvas
 {
     namespace Grammar
     {
+        AZ_CVAR(bool, g_emitNativeTranslation, false, {}, AZ::ConsoleFunctorFlags::Null, "Also translate pure graphs to C++, which a project can compile in to execute them without the Lua VM.");
         AZ_CVAR(bool, g_disableParseOnGraphValidation, false, {}, AZ::ConsoleFunctorFlags::Null, "In case parsing the graph is interfering with opening a graph, disable parsing on validation");
         AZ_CVAR(bool, g_printAbstractCodeModel, false, {}, AZ::ConsoleFunctorFlags::Null, "Print out the Abstract Code Model at the end of parsing for debug purposes.");
         AZ_CVAR(bool, g_printAbstractCodeModelAtPrefabTime, false, {}, AZ::ConsoleFunctorFlags::Null, "Print out the Abstract Code Model at the end of parsing (at prefab time) for debug purposes.");
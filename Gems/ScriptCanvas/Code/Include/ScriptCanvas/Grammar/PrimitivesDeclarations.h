@@ -115,6 +115,10 @@ namespace ScriptCanvas
 
         constexpr const char* k_GetExecutionOutNameInterpretedClass = "GetExecutionOutClass_SCVM";
         constexpr const char* k_InitializeExecutionOutsNameInterpretedClass = "InitializeExecutionOutsClass_SCVM";
+        // the cleared instances of a graph class, kept in the class table for reuse by later activations
+        constexpr const char* k_InstancePoolNameInterpretedClass = "InstancePool_SCVM";
+        // (re)initializes a new or pooled instance, the arguments after self match those of new()
+        constexpr const char* k_RenewNameInterpretedClass = "Renew_SCVM";
         constexpr const char* k_SetExecutionOutNameInterpretedClass = "SetExecutionOutClass_SCVM";
 
         constexpr const char* k_TypeSafeEBusResultName = "TypeSafeEBusResult";
@@ -248,6 +252,7 @@ namespace ScriptCanvas
         using VariableWriteHandlingConstSet = AZStd::unordered_set<VariableWriteHandlingConstPtr>;
         using VariableWriteHandlingByVariable = AZStd::unordered_map<VariableConstPtr, VariableWriteHandlingSet>;
 
+        AZ_CVAR_EXTERNED(bool, g_emitNativeTranslation);
         AZ_CVAR_EXTERNED(bool, g_disableParseOnGraphValidation);
         AZ_CVAR_EXTERNED(bool, g_printAbstractCodeModel);
         AZ_CVAR_EXTERNED(bool, g_printAbstractCodeModelAtPrefabTime);
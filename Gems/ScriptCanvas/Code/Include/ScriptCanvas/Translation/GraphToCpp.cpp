@@ -0,0 +1,1033 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Serialization/Locale.h>
+#include <ScriptCanvas/Core/Node.h>
+#include <ScriptCanvas/Data/Data.h>
+#include <ScriptCanvas/Debugger/ValidationEvents/ParsingValidation/ParsingValidations.h>
+#include <ScriptCanvas/Grammar/AbstractCodeModel.h>
+#include <ScriptCanvas/Grammar/ParsingUtilities.h>
+#include <ScriptCanvas/Grammar/Primitives.h>
+#include <ScriptCanvas/Grammar/PrimitivesExecution.h>
+
+#include <ScriptCanvas/Translation/GraphToCpp.h>
+
+namespace GraphToCppCpp
+{
+    using namespace ScriptCanvas;
+
+    constexpr const char* k_graphClassName = "Graph";
+    constexpr const char* k_inputsName = "inputs";
+    constexpr const char* k_inputCountName = "inputCount";
+
+    AZStd::string ToFloatingPointLiteral(double value, bool isFloat)
+    {
+        AZStd::string literal = AZStd::string::format(isFloat ? "%.9g" : "%.17g", value);
+
+        if (literal.find_first_of(".eEn") == AZStd::string::npos)
+        {
+            literal += ".0";
+        }
+
+        if (isFloat)
+        {
+            literal += "f";
+        }
+
+        return literal;
+    }
+
+    AZStd::string ToStringLiteral(const AZStd::string& value)
+    {
+        AZStd::string literal = "\"";
+
+        for (char character : value)
+        {
+            switch (character)
+            {
+            case '\\':
+                literal += "\\\\";
+                break;
+            case '"':
+                literal += "\\\"";
+                break;
+            case '\n':
+                literal += "\\n";
+                break;
+            case '\r':
+                literal += "\\r";
+                break;
+            case '\t':
+                literal += "\\t";
+                break;
+            default:
+                literal.push_back(character);
+                break;
+            }
+        }
+
+        literal += "\"";
+        return literal;
+    }
+}
+
+namespace ScriptCanvas
+{
+    namespace Translation
+    {
+        Configuration CreateCppConfig([[maybe_unused]] const Grammar::AbstractCodeModel& source)
+        {
+            Configuration configuration;
+            configuration.m_blockCommentClose = "*/";
+            configuration.m_blockCommentOpen = "/*";
+            configuration.m_dependencyDelimiter = "/";
+            configuration.m_executionStateName = "executionState";
+            configuration.m_executionStateReferenceGraph = "executionState";
+            configuration.m_executionStateReferenceLocal = configuration.m_executionStateName;
+            configuration.m_executionStateScriptCanvasIdName = "m_scriptCanvasId";
+            configuration.m_functionBlockClose = "}";
+            configuration.m_functionBlockOpen = "{";
+            configuration.m_lexicalScopeDelimiter = "::";
+            configuration.m_lexicalScopeVariable = ".";
+            configuration.m_namespaceClose = "}";
+            configuration.m_namespaceOpen = "{";
+            configuration.m_namespaceOpenPrefix = "namespace";
+            configuration.m_scopeClose = "}";
+            configuration.m_scopeOpen = "{";
+            configuration.m_singleLineComment = "//";
+            configuration.m_suffix = "";
+
+            // #scriptcanvas_component_extension, references to the graph owner are not supported natively yet
+            configuration.m_executionStateEntityIdRefInitialization = "";
+            configuration.m_executionStateEntityIdRef = "";
+            return configuration;
+        }
+
+        GraphToCpp::GraphToCpp(const Grammar::AbstractCodeModel& source)
+            : GraphToX(CreateCppConfig(source), source)
+        {
+            MarkTranslationStart();
+
+            m_namespaceName = AZStd::string::format("%.*s::%s", AZ_STRING_ARG(GetAutoNativeNamespace()), GetFileName(m_model.GetSource()).c_str());
+
+            if (IsSupported())
+            {
+                TranslateStart();
+
+                if (IsSuccessfull())
+                {
+                    TranslateHeader();
+                    TranslateSource();
+                }
+            }
+
+            MarkTranslationStop();
+        }
+
+        void GraphToCpp::AddUnsupportedError(Grammar::ExecutionTreeConstPtr execution, AZStd::string_view description)
+        {
+            const AZ::EntityId nodeId = execution ? execution->GetNodeId() : AZ::EntityId();
+            AddError(execution, aznew Internal::ParseError(nodeId, AZStd::string::format("Native translation of graph %.*s is not supported: %.*s"
+                , AZ_STRING_ARG(GetGraphName()), AZ_STRING_ARG(description))));
+        }
+
+        size_t GraphToCpp::FindOrAddMethod(Grammar::ExecutionTreeConstPtr execution)
+        {
+            NativeMethod method;
+            method.m_name = execution->GetName();
+
+            const Grammar::LexicalScope& lexicalScope = execution->GetNameLexicalScope();
+            if (lexicalScope.m_type == Grammar::LexicalScopeType::Variable)
+            {
+                method.m_objectType = execution->GetInput(0).m_value->m_datum.GetType().GetAZType();
+            }
+            else if (!lexicalScope.m_namespaces.empty())
+            {
+                // the BehaviorContext does not nest classes, the innermost scope is the name the class was reflected with
+                method.m_className = lexicalScope.m_namespaces.back();
+            }
+
+            const AZStd::string key = AZStd::string::format("%s%s::%s"
+                , method.m_className.c_str()
+                , method.m_objectType.IsNull() ? "" : method.m_objectType.ToString<AZStd::string>().c_str()
+                , method.m_name.c_str());
+
+            auto iter = m_methodIndexByKey.find(key);
+            if (iter != m_methodIndexByKey.end())
+            {
+                return iter->second;
+            }
+
+            const size_t index = m_methods.size();
+            m_methods.push_back(AZStd::move(method));
+            m_methodIndexByKey.emplace(key, index);
+            return index;
+        }
+
+        AZStd::string GraphToCpp::GetFileName(const Grammar::Source& source)
+        {
+            return Grammar::ToIdentifierSafe(source.m_name);
+        }
+
+        AZStd::string_view GraphToCpp::GetOperatorString(Grammar::ExecutionTreeConstPtr execution)
+        {
+            switch (execution->GetSymbol())
+            {
+            case Grammar::Symbol::OperatorAddition:
+                return " + ";
+            case Grammar::Symbol::OperatorDivision:
+                return " / ";
+            case Grammar::Symbol::OperatorMultiplication:
+                return " * ";
+            case Grammar::Symbol::OperatorSubraction:
+                return " - ";
+            default:
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::UntranslatedArithmetic));
+                return "";
+            }
+        }
+
+        GraphToCpp::IsNamed GraphToCpp::IsInputNamed(Grammar::VariableConstPtr input, Grammar::ExecutionTreeConstPtr execution)
+        {
+            return input->m_source != execution || input->m_requiresCreationFunction ? IsNamed::Yes : IsNamed::No;
+        }
+
+        bool GraphToCpp::IsSupported()
+        {
+            if (m_model.GetExecutionCharacteristics() != Grammar::ExecutionCharacteristics::Pure)
+            {
+                AddUnsupportedError(nullptr, "only pure graphs can be executed natively");
+                return false;
+            }
+
+            if (!m_model.GetEBusHandlings().empty() || !m_model.GetEventHandlings().empty())
+            {
+                AddUnsupportedError(nullptr, "event handling requires the interpreted runtime");
+                return false;
+            }
+
+            if (!m_model.GetNodeableParse().empty() || !m_model.GetRuntimeInputs().m_nodeables.empty())
+            {
+                AddUnsupportedError(nullptr, "nodeables require the interpreted runtime");
+                return false;
+            }
+
+            if (!m_model.GetOrderedDependencies().orderedAssetIds.empty())
+            {
+                AddUnsupportedError(nullptr, "dependencies on other graphs require the interpreted runtime");
+                return false;
+            }
+
+            if (!m_model.GetStaticVariablesNames().empty())
+            {
+                AddUnsupportedError(nullptr, "variables that are not code constructible require the interpreted runtime");
+                return false;
+            }
+
+            for (const auto& idAndDatum : m_model.GetRuntimeInputs().m_variables)
+            {
+                if (ToCppTypeString(idAndDatum.second.GetType()).empty())
+                {
+                    AddUnsupportedError(nullptr, AZStd::string::format("variables of type %s", Data::GetName(idAndDatum.second.GetType()).c_str()));
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        bool GraphToCpp::IsSupported(Grammar::VariableConstPtr variable)
+        {
+            if (variable->m_isMember)
+            {
+                AddUnsupportedError(nullptr, AZStd::string::format("member variable %s", variable->m_name.c_str()));
+                return false;
+            }
+
+            if (ToCppTypeString(variable->m_datum.GetType()).empty())
+            {
+                AddUnsupportedError(nullptr, AZStd::string::format("variable %s of type %s", variable->m_name.c_str(), Data::GetName(variable->m_datum.GetType()).c_str()));
+                return false;
+            }
+
+            return true;
+        }
+
+        HeaderAndSource GraphToCpp::MoveResult()
+        {
+            HeaderAndSource result;
+            result.first.m_text = m_dotH.MoveOutput();
+            result.first.m_duration = GetTranslationDuration();
+            result.second.m_text = m_dotCpp.MoveOutput();
+            result.second.m_duration = GetTranslationDuration();
+            return result;
+        }
+
+        AZ::Outcome<HeaderAndSource, ErrorList> GraphToCpp::Translate(const Grammar::AbstractCodeModel& model)
+        {
+            GraphToCpp translation(model);
+
+            if (translation.IsSuccessfull())
+            {
+                return AZ::Success(translation.MoveResult());
+            }
+            else
+            {
+                return AZ::Failure(translation.MoveErrors());
+            }
+        }
+
+        void GraphToCpp::TranslateExecutionTreeChildPre(Grammar::ExecutionTreeConstPtr execution, size_t index)
+        {
+            if (execution->GetSymbol() == Grammar::Symbol::IfCondition && index > 0)
+            {
+                CloseScope(m_executeBody);
+                m_executeBody.WriteLineIndented("else");
+                OpenScope(m_executeBody);
+            }
+        }
+
+        void GraphToCpp::TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution)
+        {
+            TranslateExecutionTreeEntryPre(execution);
+            TranslateExecutionTreeEntryRecurse(execution);
+            TranslateExecutionTreeEntryPost(execution);
+        }
+
+        void GraphToCpp::TranslateExecutionTreeEntryPost(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (execution->GetSymbol() == Grammar::Symbol::IfCondition)
+            {
+                CloseScope(m_executeBody);
+            }
+        }
+
+        void GraphToCpp::TranslateExecutionTreeEntryPre(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (execution->GetSymbol() == Grammar::Symbol::IfCondition)
+            {
+                m_executeBody.WriteIndented("if (");
+                WriteFunctionCallInput(execution, 0);
+                m_executeBody.WriteLine(")");
+                OpenScope(m_executeBody);
+            }
+        }
+
+        void GraphToCpp::TranslateExecutionTreeEntryRecurse(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (!IsSuccessfull())
+            {
+                return;
+            }
+
+            switch (execution->GetSymbol())
+            {
+            case Grammar::Symbol::CompareEqual:
+            case Grammar::Symbol::CompareGreater:
+            case Grammar::Symbol::CompareGreaterEqual:
+            case Grammar::Symbol::CompareLess:
+            case Grammar::Symbol::CompareLessEqual:
+            case Grammar::Symbol::CompareNotEqual:
+            case Grammar::Symbol::LogicalAND:
+            case Grammar::Symbol::LogicalNOT:
+            case Grammar::Symbol::LogicalOR:
+            case Grammar::Symbol::FunctionCall:
+            case Grammar::Symbol::OperatorAddition:
+            case Grammar::Symbol::OperatorDivision:
+            case Grammar::Symbol::OperatorMultiplication:
+            case Grammar::Symbol::OperatorSubraction:
+            case Grammar::Symbol::VariableAssignment:
+                TranslateExecutionTreeFunctionCall(execution);
+                break;
+
+            case Grammar::Symbol::VariableDeclaration:
+            {
+                auto variable = execution->GetInput(0).m_value;
+                if (IsSupported(variable))
+                {
+                    m_executeBody.WriteLineIndented("%s %s = %s;"
+                        , ToCppTypeString(variable->m_datum.GetType()).c_str()
+                        , variable->m_name.c_str()
+                        , ToCppValueString(variable->m_datum).c_str());
+                }
+                break;
+            }
+
+            case Grammar::Symbol::Break:
+            case Grammar::Symbol::Cycle:
+            case Grammar::Symbol::ForEach:
+            case Grammar::Symbol::IsNull:
+            case Grammar::Symbol::RandomSwitch:
+            case Grammar::Symbol::Switch:
+            case Grammar::Symbol::UserOut:
+            case Grammar::Symbol::While:
+                AddUnsupportedError(execution, Grammar::GetSymbolName(execution->GetSymbol()));
+                return;
+
+            default:
+                break;
+            }
+
+            for (size_t childIndex = 0; childIndex < execution->GetChildrenCount(); ++childIndex)
+            {
+                const auto& child = execution->GetChild(childIndex);
+
+                if (child.m_execution && !child.m_execution->IsInternalOut())
+                {
+                    TranslateExecutionTreeChildPre(execution, childIndex);
+                    TranslateExecutionTreeEntry(child.m_execution);
+                }
+            }
+        }
+
+        void GraphToCpp::TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution)
+        {
+            static const AZStd::vector<AZStd::pair<const Slot*, Grammar::OutputAssignmentConstPtr>> k_noOutput;
+            const auto& output = execution->GetChildrenCount() == 1 ? execution->GetChild(0).m_output : k_noOutput;
+
+            if (output.size() > 1)
+            {
+                AddUnsupportedError(execution, "functions with multiple results");
+                return;
+            }
+
+            Grammar::VariableConstPtr result = output.empty() ? nullptr : output[0].second->m_source;
+            if (result && !IsSupported(result))
+            {
+                return;
+            }
+
+            if (Grammar::IsLogicalExpression(execution)
+                || Grammar::IsOperatorArithmetic(execution)
+                || Grammar::IsVariableGet(execution)
+                || Grammar::IsVariableSet(execution)
+                || execution->GetSymbol() == Grammar::Symbol::VariableAssignment)
+            {
+                m_executeBody.WriteIndent();
+
+                if (result)
+                {
+                    WriteVariableWrite(execution, result);
+                }
+                else
+                {
+                    m_executeBody.Write("static_cast<void>(");
+                }
+
+                if (Grammar::IsLogicalExpression(execution))
+                {
+                    WriteLogicalExpression(execution);
+                }
+                else if (Grammar::IsOperatorArithmetic(execution))
+                {
+                    WriteOperatorArithmetic(execution);
+                }
+                else
+                {
+                    WriteFunctionCallInput(execution, 0);
+                }
+
+                m_executeBody.WriteLine(result ? ";" : ");");
+            }
+            else if (Grammar::IsWrittenMathExpression(execution))
+            {
+                // the expression string is written in Lua syntax
+                AddUnsupportedError(execution, "math expressions");
+                return;
+            }
+            else if (execution->GetEventType() != EventType::Count
+                || Grammar::IsEventConnectCall(execution)
+                || Grammar::IsEventDisconnectCall(execution)
+                || Grammar::IsUserFunctionCall(execution))
+            {
+                AddUnsupportedError(execution, "events and calls to other graphs");
+                return;
+            }
+            else if (Grammar::IsExecutedPropertyExtraction(execution)
+                || Grammar::IsGlobalPropertyRead(execution)
+                || Grammar::IsClassPropertyRead(execution)
+                || Grammar::IsClassPropertyWrite(execution)
+                || Grammar::IsFunctionCallNullCheckRequired(execution))
+            {
+                AddUnsupportedError(execution, "property access");
+                return;
+            }
+            else
+            {
+                if (result && result->m_source == execution)
+                {
+                    m_executeBody.WriteLineIndented("%s %s{};", ToCppTypeString(result->m_datum.GetType()).c_str(), result->m_name.c_str());
+                }
+
+                m_executeBody.WriteIndent();
+                WriteFunctionCallOfNode(execution);
+                m_executeBody.WriteLine(";");
+            }
+
+            WriteOutputAssignments(execution);
+        }
+
+        void GraphToCpp::TranslateHeader()
+        {
+            WriteCopyright(m_dotH);
+            m_dotH.WriteNewLine();
+            WriteDoNotModify(m_dotH);
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLine("#pragma once");
+            m_dotH.WriteNewLine();
+            OpenNamespace(m_dotH, m_namespaceName);
+            m_dotH.WriteLineIndented("// Registers the native version of %s with the Script Canvas runtime, call it once the Script Canvas gem is active.", GetGraphName().data());
+            m_dotH.WriteLineIndented("void Register();");
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLineIndented("void Unregister();");
+            CloseNamespace(m_dotH, m_namespaceName);
+        }
+
+        void GraphToCpp::TranslateSource()
+        {
+            using namespace GraphToCppCpp;
+
+            WriteCopyright(m_dotCpp);
+            m_dotCpp.WriteNewLine();
+            WriteDoNotModify(m_dotCpp);
+            m_dotCpp.WriteNewLine();
+            m_dotCpp.WriteLine("#include <AzCore/RTTI/BehaviorContext.h>");
+            m_dotCpp.WriteLine("#include <ScriptCanvas/Data/Data.h>");
+            m_dotCpp.WriteLine("#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>");
+            m_dotCpp.WriteNewLine();
+            OpenNamespace(m_dotCpp, m_namespaceName);
+            {
+                m_dotCpp.WriteLineIndented("class %s final", k_graphClassName);
+                m_dotCpp.Indent();
+                m_dotCpp.WriteLineIndented(": public ScriptCanvas::Execution::NativeGraph");
+                m_dotCpp.Outdent();
+                m_dotCpp.WriteLineIndented("{");
+                m_dotCpp.WriteLineIndented("public:");
+                m_dotCpp.Indent();
+                m_dotCpp.WriteLineIndented("AZ_CLASS_ALLOCATOR(%s, AZ::SystemAllocator);", k_graphClassName);
+                m_dotCpp.WriteNewLine();
+
+                // resolve every method once, rather than on every call
+                m_dotCpp.WriteLineIndented("bool Initialize([[maybe_unused]] AZ::BehaviorContext& behaviorContext) override");
+                OpenFunctionBlock(m_dotCpp);
+                {
+                    for (size_t index = 0; index < m_methods.size(); ++index)
+                    {
+                        const NativeMethod& method = m_methods[index];
+                        if (method.m_objectType.IsNull())
+                        {
+                            m_dotCpp.WriteLineIndented("m_method%zu = ScriptCanvas::Execution::FindNativeMethod(behaviorContext, %s, %s);"
+                                , index, ToStringLiteral(method.m_className).c_str(), ToStringLiteral(method.m_name).c_str());
+                        }
+                        else
+                        {
+                            m_dotCpp.WriteLineIndented("m_method%zu = ScriptCanvas::Execution::FindNativeMethod(behaviorContext, AZ::TypeId(\"%s\"), %s);"
+                                , index, method.m_objectType.ToString<AZStd::string>().c_str(), ToStringLiteral(method.m_name).c_str());
+                        }
+                    }
+
+                    // pure graphs have no state of their own, so they may execute on a worker thread if everything they call allows it
+                    m_dotCpp.WriteIndented("m_isThreadSafe = true");
+                    for (size_t index = 0; index < m_methods.size(); ++index)
+                    {
+                        m_dotCpp.Write(" && ScriptCanvas::Execution::IsNativeMethodThreadSafe(m_method%zu)", index);
+                    }
+                    m_dotCpp.WriteLine(";");
+
+                    m_dotCpp.WriteIndented("return true");
+                    for (size_t index = 0; index < m_methods.size(); ++index)
+                    {
+                        m_dotCpp.Write(" && m_method%zu", index);
+                    }
+                    m_dotCpp.WriteLine(";");
+                }
+                CloseFunctionBlock(m_dotCpp);
+                m_dotCpp.WriteNewLine();
+
+                m_dotCpp.WriteLineIndented("bool IsThreadSafe() const override");
+                OpenFunctionBlock(m_dotCpp);
+                m_dotCpp.WriteLineIndented("return m_isThreadSafe;");
+                CloseFunctionBlock(m_dotCpp);
+                m_dotCpp.WriteNewLine();
+
+                m_dotCpp.WriteLineIndented("void Execute([[maybe_unused]] ScriptCanvas::ExecutionState& %s, [[maybe_unused]] AZ::BehaviorArgument* %s, [[maybe_unused]] size_t %s) const override"
+                    , m_configuration.m_executionStateName.data(), k_inputsName, k_inputCountName);
+                OpenFunctionBlock(m_dotCpp);
+                {
+                    // the body was written at the indentation it is expected at
+                    m_dotCpp.Write(m_executeBody.GetOutput());
+                }
+                CloseFunctionBlock(m_dotCpp);
+
+                m_dotCpp.WriteNewLine();
+                m_dotCpp.Outdent();
+                m_dotCpp.WriteLineIndented("private:");
+                m_dotCpp.Indent();
+                m_dotCpp.WriteLineIndented("bool m_isThreadSafe = false;");
+                for (size_t index = 0; index < m_methods.size(); ++index)
+                {
+                    const NativeMethod& method = m_methods[index];
+                    m_dotCpp.WriteIndented("const AZ::BehaviorMethod* m_method%zu = nullptr; // ", index);
+                    m_dotCpp.Write(method.m_className.empty() ? AZStd::string_view(method.m_name) : AZStd::string_view(method.m_className));
+                    if (!method.m_className.empty())
+                    {
+                        m_dotCpp.Write(m_configuration.m_lexicalScopeDelimiter);
+                        m_dotCpp.Write(method.m_name);
+                    }
+                    m_dotCpp.WriteNewLine();
+                }
+
+                m_dotCpp.Outdent();
+                m_dotCpp.WriteLineIndented("};");
+                m_dotCpp.WriteNewLine();
+
+                const AZStd::string sourceId = m_model.GetSource().m_assetId.m_guid.ToString<AZStd::string>();
+
+                m_dotCpp.WriteLineIndented("void Register()");
+                OpenFunctionBlock(m_dotCpp);
+                {
+                    m_dotCpp.WriteLineIndented("if (auto registry = ScriptCanvas::Execution::GetNativeGraphRegistry())");
+                    OpenScope(m_dotCpp);
+                    m_dotCpp.WriteLineIndented("registry->Register(AZ::Uuid(\"%s\"), []() -> AZStd::unique_ptr<ScriptCanvas::Execution::NativeGraph> { return AZStd::make_unique<%s>(); });"
+                        , sourceId.c_str(), k_graphClassName);
+                    CloseScope(m_dotCpp);
+                }
+                CloseFunctionBlock(m_dotCpp);
+                m_dotCpp.WriteNewLine();
+
+                m_dotCpp.WriteLineIndented("void Unregister()");
+                OpenFunctionBlock(m_dotCpp);
+                {
+                    m_dotCpp.WriteLineIndented("if (auto registry = ScriptCanvas::Execution::GetNativeGraphRegistry())");
+                    OpenScope(m_dotCpp);
+                    m_dotCpp.WriteLineIndented("registry->Unregister(AZ::Uuid(\"%s\"));", sourceId.c_str());
+                    CloseScope(m_dotCpp);
+                }
+                CloseFunctionBlock(m_dotCpp);
+            }
+            CloseNamespace(m_dotCpp, m_namespaceName);
+        }
+
+        void GraphToCpp::TranslateStart()
+        {
+            using namespace GraphToCppCpp;
+
+            // the namespace, the class body, and the function body
+            m_executeBody.SetIndent(3);
+
+            auto start = m_model.GetStart();
+            if (!start)
+            {
+                return;
+            }
+
+            if (start->RefersToSelfEntityId())
+            {
+                AddUnsupportedError(start, "references to the entity that owns the graph");
+                return;
+            }
+
+            // the activation inputs arrive in the same order the interpreted OnGraphStart receives them
+            const auto& runtimeInputs = m_model.GetRuntimeInputs();
+            const AZStd::vector<Grammar::VariableConstPtr> constructionArguments
+                = m_model.CombineVariableLists(runtimeInputs.m_nodeables, runtimeInputs.m_variables, runtimeInputs.m_entityIds);
+
+            if (!constructionArguments.empty())
+            {
+                m_executeBody.WriteLineIndented("AZ_Assert(%s == %zu, \"%s expected %zu inputs\");", k_inputCountName, constructionArguments.size()
+                    , GetGraphName().data(), constructionArguments.size());
+
+                for (size_t index = 0; index < constructionArguments.size(); ++index)
+                {
+                    const auto& argument = constructionArguments[index];
+                    const AZStd::string type = ToCppTypeString(argument->m_datum.GetType());
+                    if (type.empty())
+                    {
+                        AddUnsupportedError(start, AZStd::string::format("input %s", argument->m_name.c_str()));
+                        return;
+                    }
+
+                    m_executeBody.WriteLineIndented("%s %s = *%s[%zu].GetAsUnsafe<%s>();", type.c_str(), argument->m_name.c_str(), k_inputsName, index, type.c_str());
+                }
+            }
+
+            WriteOutputAssignments(start);
+            WriteLocalVariableInitialization(start);
+
+            if (start->GetChildrenCount() > 0 && start->GetChild(0).m_execution)
+            {
+                TranslateExecutionTreeEntry(start->GetChild(0).m_execution);
+            }
+        }
+
+        void GraphToCpp::WriteConversionPost(Grammar::ExecutionTreeConstPtr execution, const Grammar::ConversionByIndex& conversions, size_t index)
+        {
+            auto iter = conversions.find(index);
+            if (iter == conversions.end())
+            {
+                return;
+            }
+
+            switch (iter->second.GetType())
+            {
+            case Data::eType::Boolean:
+                m_executeBody.Write(" != 0.0)");
+                break;
+
+            case Data::eType::Number:
+                m_executeBody.Write(" ? 1.0 : 0.0)");
+                break;
+
+            default:
+                AddUnsupportedError(execution, AZStd::string::format("conversions to %s", Data::GetName(iter->second).c_str()));
+                break;
+            }
+        }
+
+        void GraphToCpp::WriteConversionPre(Grammar::ExecutionTreeConstPtr execution, const Grammar::ConversionByIndex& conversions, size_t index)
+        {
+            auto iter = conversions.find(index);
+            if (iter == conversions.end())
+            {
+                return;
+            }
+
+            switch (iter->second.GetType())
+            {
+            case Data::eType::Boolean:
+            case Data::eType::Number:
+                m_executeBody.Write("(");
+                break;
+
+            default:
+                AddUnsupportedError(execution, AZStd::string::format("conversions to %s", Data::GetName(iter->second).c_str()));
+                break;
+            }
+        }
+
+        void GraphToCpp::WriteFunctionCallInput(Grammar::ExecutionTreeConstPtr execution, size_t index)
+        {
+            const auto& input = execution->GetInput(index).m_value;
+
+            WriteConversionPre(execution, execution->GetConversions(), index);
+
+            if (IsInputNamed(input, execution) == IsNamed::Yes)
+            {
+                if (input->m_isMember)
+                {
+                    AddUnsupportedError(execution, AZStd::string::format("member variable %s", input->m_name.c_str()));
+                }
+
+                m_executeBody.Write(input->m_name);
+            }
+            else
+            {
+                const AZStd::string value = ToCppValueString(input->m_datum);
+                if (value.empty())
+                {
+                    AddUnsupportedError(execution, AZStd::string::format("values of type %s", Data::GetName(input->m_datum.GetType()).c_str()));
+                }
+
+                m_executeBody.Write(value);
+            }
+
+            WriteConversionPost(execution, execution->GetConversions(), index);
+        }
+
+        void GraphToCpp::WriteFunctionCallOfNode(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (execution->GetName().empty())
+            {
+                AddUnsupportedError(execution, "function calls without a name");
+                return;
+            }
+
+            const size_t methodIndex = FindOrAddMethod(execution);
+            const bool hasResult = execution->GetChildrenCount() == 1 && !execution->GetChild(0).m_output.empty();
+
+            if (!hasResult)
+            {
+                m_executeBody.Write("m_method%zu->Invoke(", methodIndex);
+            }
+            else
+            {
+                m_executeBody.Write("m_method%zu->InvokeResult(%s", methodIndex, execution->GetChild(0).m_output[0].second->m_source->m_name.c_str());
+
+                if (execution->GetInputCount() > 0)
+                {
+                    m_executeBody.Write(", ");
+                }
+            }
+
+            for (size_t index = 0; index < execution->GetInputCount(); ++index)
+            {
+                if (index > 0)
+                {
+                    m_executeBody.Write(", ");
+                }
+
+                WriteFunctionCallInput(execution, index);
+            }
+
+            m_executeBody.Write(")");
+        }
+
+        void GraphToCpp::WriteLocalVariableInitialization(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (const auto& localDeclaredVariables = m_model.GetLocalVariables(execution))
+            {
+                for (const auto& variable : *localDeclaredVariables)
+                {
+                    if (Grammar::ParseConstructionRequirement(variable) == Grammar::VariableConstructionRequirement::None && IsSupported(variable))
+                    {
+                        m_executeBody.WriteLineIndented("%s %s = %s;"
+                            , ToCppTypeString(variable->m_datum.GetType()).c_str()
+                            , variable->m_name.c_str()
+                            , ToCppValueString(variable->m_datum).c_str());
+                    }
+                }
+            }
+        }
+
+        void GraphToCpp::WriteLogicalExpression(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (execution->GetSymbol() == Grammar::Symbol::LogicalNOT)
+            {
+                m_executeBody.Write("!(");
+                WriteFunctionCallInput(execution, 0);
+                m_executeBody.Write(")");
+            }
+            else if (Grammar::IsFloatingPointNumberEqualityComparison(execution))
+            {
+                // match the tolerance of the interpreted comparison, so both runtimes take the same branches
+                m_executeBody.Write("(AZStd::abs(");
+                WriteFunctionCallInput(execution, 0);
+                m_executeBody.Write(" - ");
+                WriteFunctionCallInput(execution, 1);
+                m_executeBody.Write(execution->GetSymbol() == Grammar::Symbol::CompareEqual ? ") <= %s)" : ") > %s)", Grammar::k_LuaEpsilonString);
+            }
+            else
+            {
+                m_executeBody.Write("(");
+                WriteFunctionCallInput(execution, 0);
+
+                switch (execution->GetSymbol())
+                {
+                case Grammar::Symbol::CompareEqual:
+                    m_executeBody.Write(" == ");
+                    break;
+                case Grammar::Symbol::CompareGreater:
+                    m_executeBody.Write(" > ");
+                    break;
+                case Grammar::Symbol::CompareGreaterEqual:
+                    m_executeBody.Write(" >= ");
+                    break;
+                case Grammar::Symbol::CompareLess:
+                    m_executeBody.Write(" < ");
+                    break;
+                case Grammar::Symbol::CompareLessEqual:
+                    m_executeBody.Write(" <= ");
+                    break;
+                case Grammar::Symbol::CompareNotEqual:
+                    m_executeBody.Write(" != ");
+                    break;
+                case Grammar::Symbol::LogicalAND:
+                    m_executeBody.Write(" && ");
+                    break;
+                case Grammar::Symbol::LogicalOR:
+                    m_executeBody.Write(" || ");
+                    break;
+                default:
+                    AddUnsupportedError(execution, Grammar::GetSymbolName(execution->GetSymbol()));
+                    break;
+                }
+
+                WriteFunctionCallInput(execution, 1);
+                m_executeBody.Write(")");
+            }
+        }
+
+        void GraphToCpp::WriteOperatorArithmetic(Grammar::ExecutionTreeConstPtr execution)
+        {
+            const auto count = execution->GetInputCount();
+
+            if (count < 2)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NotEnoughInputForArithmeticOperator));
+                return;
+            }
+
+            const AZStd::string_view operatorString = GetOperatorString(execution);
+
+            for (size_t i(0); i < (count - 1); ++i)
+            {
+                m_executeBody.Write("(");
+            }
+
+            WriteFunctionCallInput(execution, 0);
+            m_executeBody.Write(operatorString);
+            WriteFunctionCallInput(execution, 1);
+            m_executeBody.Write(")");
+
+            for (size_t i(2); i < count; ++i)
+            {
+                m_executeBody.Write(operatorString);
+                WriteFunctionCallInput(execution, i);
+                m_executeBody.Write(")");
+            }
+        }
+
+        void GraphToCpp::WriteOutputAssignments(Grammar::ExecutionTreeConstPtr execution)
+        {
+            const auto output = execution->GetLocalOutput();
+            if (!output)
+            {
+                return;
+            }
+
+            for (const auto& outputIter : *output)
+            {
+                const Grammar::OutputAssignmentConstPtr& assignment = outputIter.second;
+
+                for (size_t i(0); i < assignment->m_assignments.size(); ++i)
+                {
+                    if (!IsSupported(assignment->m_assignments[i]))
+                    {
+                        return;
+                    }
+
+                    m_executeBody.WriteIndented("%s = ", assignment->m_assignments[i]->m_name.c_str());
+                    WriteConversionPre(execution, assignment->m_sourceConversions, i);
+                    m_executeBody.Write(assignment->m_source->m_name);
+                    WriteConversionPost(execution, assignment->m_sourceConversions, i);
+                    m_executeBody.WriteLine(";");
+                }
+            }
+        }
+
+        void GraphToCpp::WriteVariableWrite([[maybe_unused]] Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable)
+        {
+            if (variable->m_source == execution)
+            {
+                m_executeBody.Write("%s %s = ", ToCppTypeString(variable->m_datum.GetType()).c_str(), variable->m_name.c_str());
+            }
+            else
+            {
+                m_executeBody.Write("%s = ", variable->m_name.c_str());
+            }
+        }
+
+        AZStd::string ToCppTypeString(const Data::Type& type)
+        {
+            switch (type.GetType())
+            {
+            case Data::eType::Boolean:
+                return "ScriptCanvas::Data::BooleanType";
+            case Data::eType::Color:
+                return "ScriptCanvas::Data::ColorType";
+            case Data::eType::CRC:
+                return "ScriptCanvas::Data::CRCType";
+            case Data::eType::EntityID:
+                return "ScriptCanvas::Data::EntityIDType";
+            case Data::eType::Number:
+                return "ScriptCanvas::Data::NumberType";
+            case Data::eType::Quaternion:
+                return "ScriptCanvas::Data::QuaternionType";
+            case Data::eType::String:
+                return "ScriptCanvas::Data::StringType";
+            case Data::eType::Vector2:
+                return "ScriptCanvas::Data::Vector2Type";
+            case Data::eType::Vector3:
+                return "ScriptCanvas::Data::Vector3Type";
+            case Data::eType::Vector4:
+                return "ScriptCanvas::Data::Vector4Type";
+            default:
+                return "";
+            }
+        }
+
+        AZStd::string ToCppValueString(const Datum& datum)
+        {
+            using namespace GraphToCppCpp;
+
+            AZ::Locale::ScopedSerializationLocale scopedLocale;
+
+            switch (datum.GetType().GetType())
+            {
+            case Data::eType::Boolean:
+                return *datum.GetAs<Data::BooleanType>() ? "true" : "false";
+
+            case Data::eType::Color:
+            {
+                const auto value = datum.GetAs<Data::ColorType>();
+                return AZStd::string::format("ScriptCanvas::Data::ColorType(%s, %s, %s, %s)"
+                    , ToFloatingPointLiteral(value->GetR(), true).c_str()
+                    , ToFloatingPointLiteral(value->GetG(), true).c_str()
+                    , ToFloatingPointLiteral(value->GetB(), true).c_str()
+                    , ToFloatingPointLiteral(value->GetA(), true).c_str());
+            }
+
+            case Data::eType::CRC:
+                return AZStd::string::format("ScriptCanvas::Data::CRCType(%uu)", static_cast<AZ::u32>(*datum.GetAs<Data::CRCType>()));
+
+            case Data::eType::EntityID:
+            {
+                // direct references are not supported, and the graph owner is not available natively yet
+                const Data::EntityIDType entityId = *datum.GetAs<Data::EntityIDType>();
+                return entityId == GraphOwnerId || entityId == UniqueId ? "" : "ScriptCanvas::Data::EntityIDType()";
+            }
+
+            case Data::eType::Number:
+                return ToFloatingPointLiteral(*datum.GetAs<Data::NumberType>(), false);
+
+            case Data::eType::Quaternion:
+            {
+                const auto value = datum.GetAs<Data::QuaternionType>();
+                return AZStd::string::format("ScriptCanvas::Data::QuaternionType(%s, %s, %s, %s)"
+                    , ToFloatingPointLiteral(value->GetX(), true).c_str()
+                    , ToFloatingPointLiteral(value->GetY(), true).c_str()
+                    , ToFloatingPointLiteral(value->GetZ(), true).c_str()
+                    , ToFloatingPointLiteral(value->GetW(), true).c_str());
+            }
+
+            case Data::eType::String:
+                return AZStd::string::format("ScriptCanvas::Data::StringType(%s)", ToStringLiteral(*datum.GetAs<Data::StringType>()).c_str());
+
+            case Data::eType::Vector2:
+            {
+                const auto value = datum.GetAs<Data::Vector2Type>();
+                return AZStd::string::format("ScriptCanvas::Data::Vector2Type(%s, %s)"
+                    , ToFloatingPointLiteral(value->GetX(), true).c_str()
+                    , ToFloatingPointLiteral(value->GetY(), true).c_str());
+            }
+
+            case Data::eType::Vector3:
+            {
+                const auto value = datum.GetAs<Data::Vector3Type>();
+                return AZStd::string::format("ScriptCanvas::Data::Vector3Type(%s, %s, %s)"
+                    , ToFloatingPointLiteral(value->GetX(), true).c_str()
+                    , ToFloatingPointLiteral(value->GetY(), true).c_str()
+                    , ToFloatingPointLiteral(value->GetZ(), true).c_str());
+            }
+
+            case Data::eType::Vector4:
+            {
+                const auto value = datum.GetAs<Data::Vector4Type>();
+                return AZStd::string::format("ScriptCanvas::Data::Vector4Type(%s, %s, %s, %s)"
+                    , ToFloatingPointLiteral(value->GetX(), true).c_str()
+                    , ToFloatingPointLiteral(value->GetY(), true).c_str()
+                    , ToFloatingPointLiteral(value->GetZ(), true).c_str()
+                    , ToFloatingPointLiteral(value->GetW(), true).c_str());
+            }
+
+            default:
+                return "";
+            }
+        }
+    }
+}
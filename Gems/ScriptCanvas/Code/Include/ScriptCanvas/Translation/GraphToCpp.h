@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/utility/pair.h>
+#include <AzCore/Outcome/Outcome.h>
+
+#include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
+
+#include "GraphToX.h"
+#include "TranslationResult.h"
+#include "TranslationUtilities.h"
+
+namespace ScriptCanvas
+{
+    class Datum;
+
+    namespace Data
+    {
+        class Type;
+    }
+
+    namespace Translation
+    {
+        using HeaderAndSource = AZStd::pair<TargetResult, TargetResult>;
+
+        // Translates pure graphs ahead of time to C++ that implements Execution::NativeGraph, so shipping builds can execute them
+        // without the Lua VM. Calls into the BehaviorContext are resolved once, when the native graph is initialized.
+        // Only a subset of the grammar is supported. A graph that uses anything else fails to translate, and keeps running interpreted.
+        class GraphToCpp
+            : public GraphToX
+        {
+        public:
+            static AZ::Outcome<HeaderAndSource, ErrorList> Translate(const Grammar::AbstractCodeModel& source);
+
+            // the file name, without extension, the generated header and source are expected to be saved under
+            static AZStd::string GetFileName(const Grammar::Source& source);
+
+        protected:
+            enum class IsNamed { No, Yes };
+
+            struct NativeMethod
+            {
+                // empty for global methods, and for methods called on a variable
+                AZStd::string m_className;
+                // only valid for methods called on a variable, which are found by the type of the variable
+                AZ::TypeId m_objectType = AZ::TypeId::CreateNull();
+                AZStd::string m_name;
+            };
+
+            static IsNamed IsInputNamed(Grammar::VariableConstPtr input, Grammar::ExecutionTreeConstPtr execution);
+
+            AZStd::string m_namespaceName;
+            Writer m_dotH;
+            Writer m_dotCpp;
+            // the body of the Execute method, written before the declarations of the methods it needs
+            Writer m_executeBody;
+            AZStd::vector<NativeMethod> m_methods;
+            AZStd::unordered_map<AZStd::string, size_t> m_methodIndexByKey;
+
+            GraphToCpp(const Grammar::AbstractCodeModel& source);
+
+            void AddUnsupportedError(Grammar::ExecutionTreeConstPtr execution, AZStd::string_view description);
+            size_t FindOrAddMethod(Grammar::ExecutionTreeConstPtr execution);
+            AZStd::string_view GetOperatorString(Grammar::ExecutionTreeConstPtr execution);
+            bool IsSupported();
+            bool IsSupported(Grammar::VariableConstPtr variable);
+            HeaderAndSource MoveResult();
+            void TranslateExecutionTreeChildPre(Grammar::ExecutionTreeConstPtr execution, size_t index);
+            void TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeEntryPost(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeEntryPre(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeEntryRecurse(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateHeader();
+            void TranslateSource();
+            void TranslateStart();
+            void WriteConversionPost(Grammar::ExecutionTreeConstPtr execution, const Grammar::ConversionByIndex& conversions, size_t index);
+            void WriteConversionPre(Grammar::ExecutionTreeConstPtr execution, const Grammar::ConversionByIndex& conversions, size_t index);
+            void WriteFunctionCallInput(Grammar::ExecutionTreeConstPtr execution, size_t index);
+            void WriteFunctionCallOfNode(Grammar::ExecutionTreeConstPtr execution);
+            void WriteLocalVariableInitialization(Grammar::ExecutionTreeConstPtr execution);
+            void WriteLogicalExpression(Grammar::ExecutionTreeConstPtr execution);
+            void WriteOperatorArithmetic(Grammar::ExecutionTreeConstPtr execution);
+            void WriteOutputAssignments(Grammar::ExecutionTreeConstPtr execution);
+            void WriteVariableWrite(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable);
+        };
+
+        // the C++ type and value of Script Canvas data, for the types GraphToCpp supports, returns an empty string for any other
+        AZStd::string ToCppTypeString(const Data::Type& type);
+        AZStd::string ToCppValueString(const Datum& datum);
+    }
+}
@@ -366,11 +366,25 @@ namespace ScriptCanvas
 
             OpenFunctionBlock(m_dotLua);
             {
-                // local self = setmetatable({}, GraphNameInstance_MT)
-                m_dotLua.WriteLineIndented("local self = setmetatable({}, %s%s)"
+                // return GraphName.Renew_SCVM(setmetatable({}, GraphNameInstance_MT), executionState, ...)
+                m_dotLua.WriteIndented("return %s.%s(setmetatable({}, %s%s), executionState"
+                    , m_tableName.c_str()
+                    , Grammar::k_RenewNameInterpretedClass
                     , m_tableName.c_str()
                     , Grammar::k_MetaTableSuffix);
+                WriteConstructionInput();
+                m_dotLua.WriteLine(")");
+            }
+            CloseFunctionBlock(m_dotLua);
+            m_dotLua.WriteNewLine();
 
+            // the runtime calls this directly on pooled instances, which it has cleared of all their fields
+            m_dotLua.Write("function %s.%s(self, executionState", m_tableName.c_str(), Grammar::k_RenewNameInterpretedClass);
+            WriteConstructionInput();
+            m_dotLua.WriteLine(")");
+
+            OpenFunctionBlock(m_dotLua);
+            {
                 // self.executionState = executionState
                 m_dotLua.WriteLineIndented("self.%s = %s"
                     , Grammar::k_executionStateVariableName, Grammar::k_executionStateVariableName);
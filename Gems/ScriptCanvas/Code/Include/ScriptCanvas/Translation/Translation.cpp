@@ -18,6 +18,7 @@
 
 #include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
 #include <ScriptCanvas/Grammar/AbstractCodeModel.h>
+#include <ScriptCanvas/Translation/GraphToCpp.h>
 #include <ScriptCanvas/Translation/GraphToLua.h>
 #include <ScriptCanvas/Core/Graph.h>
 
@@ -52,6 +53,33 @@ namespace TranslationCPP
             return AZ::Failure(outcome.TakeError());
         }
     }
+
+    AZ::Outcome<HeaderAndSource, ErrorList> ToCPlusPlus(const Grammar::AbstractCodeModel& model, bool rawSave = false)
+    {
+        auto outcome = GraphToCpp::Translate(model);
+        if (outcome.IsSuccess())
+        {
+            if (rawSave)
+            {
+                auto saveOutcome = SaveDotH(model.GetSource(), outcome.GetValue().first.m_text);
+                if (saveOutcome.IsSuccess())
+                {
+                    saveOutcome = SaveDotCPP(model.GetSource(), outcome.GetValue().second.m_text);
+                }
+
+                if (!saveOutcome.IsSuccess())
+                {
+                    AZ_TracePrintf("ScriptCanvas", "Save failed %s", saveOutcome.GetError().data());
+                }
+            }
+
+            return AZ::Success(outcome.TakeValue());
+        }
+        else
+        {
+            return AZ::Failure(outcome.TakeError());
+        }
+    }
 }
 
 namespace ScriptCanvas
@@ -98,31 +126,24 @@ namespace ScriptCanvas
                     }
                 }
 
-                // Translation to C++ (executed via BehaviorContext calls) has been demonstrated in the past and is partially in progress.
+                // Translation to C++ executes via BehaviorContext calls, and only supports pure graphs that use a subset of the grammar.
                 // These calls allow for users to execute multiple translations from the same abstract code model.
-                // More work is required to complete all the latest features of the ACM, and do integrate output files into the build.
-                // 
-                //                 if (targetFlags & (TargetFlags::Cpp | TargetFlags::Hpp))
-                //                 {
-                //                     auto outcomeCPP = TranslationCPP::ToCPlusPlus(*model.get(), rawSave);
-                //                     if (outcomeCPP.IsSuccess())
-                //                     {
-                //                         auto hppAndCpp = outcomeCPP.TakeValue();
-                //                         
-                //                         TargetResult cppResult;
-                //                         cppResult.m_text = AZStd::move(hppAndCpp.first);
-                //                         translations.emplace(TargetFlags::Hpp, AZStd::move(cppResult));
-                //                         TargetResult hppResult;
-                //                         hppResult.m_text = AZStd::move(hppAndCpp.second);
-                //                         translations.emplace(TargetFlags::Cpp, AZStd::move(hppResult));
-                //                     }
-                //                     else
-                //                     {
-                //                         auto hppAndCpp = outcomeCPP.TakeError();
-                //                         errors.emplace(TargetFlags::Hpp, AZStd::move(hppAndCpp.first));
-                //                         errors.emplace(TargetFlags::Cpp, AZStd::move(hppAndCpp.second));
-                //                     }
-                //                 }
+                if (request.translationTargetFlags & (TargetFlags::Cpp | TargetFlags::Hpp))
+                {
+                    auto outcomeCPP = TranslationCPP::ToCPlusPlus(*model.get(), request.rawSaveDebugOutput);
+                    if (outcomeCPP.IsSuccess())
+                    {
+                        auto hppAndCpp = outcomeCPP.TakeValue();
+                        translations.emplace(TargetFlags::Hpp, AZStd::move(hppAndCpp.first));
+                        translations.emplace(TargetFlags::Cpp, AZStd::move(hppAndCpp.second));
+                    }
+                    else
+                    {
+                        auto cppErrors = outcomeCPP.TakeError();
+                        errors.emplace(TargetFlags::Hpp, cppErrors);
+                        errors.emplace(TargetFlags::Cpp, AZStd::move(cppErrors));
+                    }
+                }
 
             }
 
@@ -18,6 +18,7 @@
 #include <ScriptCanvas/Libraries/Libraries.h>
 
 #include <ScriptCanvas/Debugger/Debugger.h>
+#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>
 #include <ScriptCanvas/Execution/RuntimeComponent.h>
 #include <ScriptCanvas/Libraries/Libraries.h>
 #include <ScriptCanvas/Libraries/Math/MathNodeUtilities.h>
@@ -55,6 +56,7 @@ namespace ScriptCanvas
 
         MathNodeUtilities::RandomEngineInit();
         InitDataRegistry();
+        ScriptCanvas::Execution::InitNativeGraphRegistry();
 
         ScriptCanvasModel::Instance().Init();
     }
@@ -64,6 +66,7 @@ namespace ScriptCanvas
         MathNodeUtilities::RandomEngineReset();
         ScriptCanvas::ResetLibraries();
         ResetDataRegistry();
+        ScriptCanvas::Execution::ResetNativeGraphRegistry();
     }
 
     AZ::ComponentTypeList ScriptCanvasModuleCommon::GetCommonSystemComponents() const
@@ -81,6 +81,7 @@ set(FILES
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPure.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedSingleton.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedUtility.cpp
+    Include/ScriptCanvas/Execution/Native/ExecutionStateNative.cpp
     Include/ScriptCanvas/Grammar/AbstractCodeModel.cpp
     Include/ScriptCanvas/Grammar/ASTModifications.cpp
     Include/ScriptCanvas/Grammar/DebugMap.cpp
@@ -191,6 +192,7 @@ set(FILES
     Include/ScriptCanvas/Serialization/BehaviorContextObjectSerializer.cpp
     Include/ScriptCanvas/Serialization/DatumSerializer.cpp
     Include/ScriptCanvas/Serialization/RuntimeVariableSerializer.cpp
+    Include/ScriptCanvas/Translation/GraphToCpp.cpp
     Include/ScriptCanvas/Translation/GraphToLua.cpp
     Include/ScriptCanvas/Translation/GraphToLuaUtility.cpp
     Include/ScriptCanvas/Translation/GraphToX.cpp
@@ -106,6 +106,7 @@ set(FILES
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPure.h
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedSingleton.h
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedUtility.h
+    Include/ScriptCanvas/Execution/Native/ExecutionStateNative.h
     Include/ScriptCanvas/Grammar/AbstractCodeModel.h
     Include/ScriptCanvas/Grammar/ASTModifications.h
     Include/ScriptCanvas/Grammar/DebugMap.h
@@ -319,6 +320,7 @@ set(FILES
     Include/ScriptCanvas/Serialization/DatumSerializer.h
     Include/ScriptCanvas/Serialization/RuntimeVariableSerializer.h
     Include/ScriptCanvas/Translation/Configuration.h
+    Include/ScriptCanvas/Translation/GraphToCpp.h
     Include/ScriptCanvas/Translation/GraphToLua.h
     Include/ScriptCanvas/Translation/GraphToLuaUtility.h
     Include/ScriptCanvas/Translation/GraphToX.h
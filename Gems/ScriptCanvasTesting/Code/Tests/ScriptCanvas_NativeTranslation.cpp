@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Framework/ScriptCanvasTestFixture.h>
+#include <Source/Framework/ScriptCanvasTestUtilities.h>
+
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Script/ScriptAsset.h>
+#include <ScriptCanvas/Asset/RuntimeAsset.h>
+#include <ScriptCanvas/Core/ModifiableDatumView.h>
+#include <ScriptCanvas/Execution/ExecutionContext.h>
+#include <ScriptCanvas/Execution/ExecutionStateStorage.h>
+#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>
+#include <ScriptCanvas/Libraries/Core/GetVariable.h>
+#include <ScriptCanvas/Libraries/Core/Method.h>
+#include <ScriptCanvas/Libraries/Core/SetVariable.h>
+#include <ScriptCanvas/Libraries/Core/Start.h>
+#include <ScriptCanvas/Libraries/Logic/Gate.h>
+#include <ScriptCanvas/Libraries/Operators/Math/OperatorAdd.h>
+#include <ScriptCanvas/Translation/Translation.h>
+#include <ScriptCanvas/Variable/GraphVariableManagerComponent.h>
+
+using namespace ScriptCanvasTests;
+
+namespace NativeTranslationTestCpp
+{
+    class NativeTranslationTestMath
+    {
+    public:
+        AZ_TYPE_INFO(NativeTranslationTestMath, "{4C2A8E51-7D0B-4F36-9A1E-2B6F3D8C5E70}");
+
+        static double Twice(double value)
+        {
+            return value * 2.0;
+        }
+
+        static void Reflect(AZ::ReflectContext* reflectContext)
+        {
+            if (AZ::BehaviorContext* behaviorContext = azrtti_cast<AZ::BehaviorContext*>(reflectContext))
+            {
+                behaviorContext->Class<NativeTranslationTestMath>("NativeTranslationTestMath")
+                    ->Method("Twice", &NativeTranslationTestMath::Twice)
+                    ;
+            }
+        }
+    };
+
+    // stands in for the code GraphToCpp generates, and counts how the runtime uses it
+    class CountingNativeGraph final
+        : public ScriptCanvas::Execution::NativeGraph
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CountingNativeGraph, AZ::SystemAllocator);
+
+        static bool s_initializeResult;
+        static int s_initializeCount;
+        static int s_executeCount;
+
+        bool Initialize([[maybe_unused]] AZ::BehaviorContext& behaviorContext) override
+        {
+            ++s_initializeCount;
+            return s_initializeResult;
+        }
+
+        void Execute([[maybe_unused]] ScriptCanvas::ExecutionState& executionState, [[maybe_unused]] AZ::BehaviorArgument* inputs, size_t inputCount) const override
+        {
+            EXPECT_EQ(inputCount, 0);
+            ++s_executeCount;
+        }
+    };
+
+    bool CountingNativeGraph::s_initializeResult = true;
+    int CountingNativeGraph::s_initializeCount = 0;
+    int CountingNativeGraph::s_executeCount = 0;
+
+    AZStd::unique_ptr<ScriptCanvas::Execution::NativeGraph> CreateCountingNativeGraph()
+    {
+        return AZStd::make_unique<CountingNativeGraph>();
+    }
+}
+
+class ScriptCanvasNativeTranslationTestFixture
+    : public ScriptCanvasTestFixture
+{
+protected:
+    void SetUp() override
+    {
+        ScriptCanvasTestFixture::SetUp();
+        NativeTranslationTestCpp::NativeTranslationTestMath::Reflect(m_behaviorContext);
+
+        NativeTranslationTestCpp::CountingNativeGraph::s_initializeResult = true;
+        NativeTranslationTestCpp::CountingNativeGraph::s_initializeCount = 0;
+        NativeTranslationTestCpp::CountingNativeGraph::s_executeCount = 0;
+    }
+
+    void TearDown() override
+    {
+        m_variableEntity.reset();
+
+        m_behaviorContext->EnableRemoveReflection();
+        NativeTranslationTestCpp::NativeTranslationTestMath::Reflect(m_behaviorContext);
+        m_behaviorContext->DisableRemoveReflection();
+
+        ScriptCanvasTestFixture::TearDown();
+    }
+
+    // On Graph Start -> Get Count -> Get Enabled -> If (Enabled) -> True -> Count + 3 -> NativeTranslationTestMath::Twice -> Set Result
+    ScriptCanvas::Graph* CreatePureGraph()
+    {
+        using namespace ScriptCanvas;
+
+        ScriptCanvas::Graph* graph = CreateGraph();
+        const ScriptCanvasId& scriptCanvasId = graph->GetScriptCanvasId();
+
+        m_variableEntity = AZStd::make_unique<AZ::Entity>("NativeTranslationVariables");
+        m_variableEntity->CreateComponent<GraphVariableManagerComponent>(scriptCanvasId);
+        m_variableEntity->Init();
+        m_variableEntity->Activate();
+
+        const VariableId countId = CreateVariable(scriptCanvasId, Data::NumberType(2.0), "Count");
+        const VariableId enabledId = CreateVariable(scriptCanvasId, Data::BooleanType(true), "Enabled");
+        const VariableId resultId = CreateVariable(scriptCanvasId, Data::NumberType(0.0), "Result");
+
+        AZ::EntityId startId;
+        CreateTestNode<Nodes::Core::Start>(scriptCanvasId, startId);
+
+        AZ::EntityId getCountId;
+        auto getCount = CreateTestNode<Nodes::Core::GetVariableNode>(scriptCanvasId, getCountId);
+        getCount->SetId(countId);
+
+        AZ::EntityId getEnabledId;
+        auto getEnabled = CreateTestNode<Nodes::Core::GetVariableNode>(scriptCanvasId, getEnabledId);
+        getEnabled->SetId(enabledId);
+
+        AZ::EntityId ifId;
+        CreateTestNode<Nodes::Logic::Gate>(scriptCanvasId, ifId);
+
+        // the operands are renamed once the dynamic type is set, so they are found first
+        AZ::EntityId addId;
+        auto add = CreateTestNode<Nodes::Operators::OperatorAdd>(scriptCanvasId, addId);
+        const SlotId addValue1 = add->GetSlotId("Value 1");
+        const SlotId addValue2 = add->GetSlotId("Value 2");
+        const SlotId addResult = add->GetSlotId("Result");
+        add->SetDisplayType(add->GetArithmeticDynamicTypeGroup(), Data::Type::Number());
+        ModifiableDatumView addValue2View;
+        add->FindModifiableDatumView(addValue2, addValue2View);
+        EXPECT_TRUE(addValue2View.IsValid());
+        addValue2View.SetAs(Data::NumberType(3.0));
+
+        const AZ::EntityId twiceId = CreateClassFunctionNode(scriptCanvasId, "NativeTranslationTestMath", "Twice");
+        auto twice = GetTestNode<Nodes::Core::Method>(scriptCanvasId, twiceId);
+        const auto twiceInputs = twice->GetAllSlotsByDescriptor(SlotDescriptors::DataIn());
+        const auto twiceOutputs = twice->GetAllSlotsByDescriptor(SlotDescriptors::DataOut());
+        EXPECT_EQ(twiceInputs.size(), 1);
+        EXPECT_EQ(twiceOutputs.size(), 1);
+
+        AZ::EntityId setResultId;
+        auto setResult = CreateTestNode<Nodes::Core::SetVariableNode>(scriptCanvasId, setResultId);
+        setResult->SetId(resultId);
+
+        EXPECT_TRUE(Connect(*graph, startId, "Out", getCountId, "In"));
+        EXPECT_TRUE(Connect(*graph, getCountId, "Out", getEnabledId, "In"));
+        EXPECT_TRUE(Connect(*graph, getEnabledId, "Out", ifId, "In"));
+        EXPECT_TRUE(graph->Connect(getEnabledId, getEnabled->GetDataOutSlotId(), ifId, graph->FindNode(ifId)->GetSlotId("Condition")));
+        EXPECT_TRUE(Connect(*graph, ifId, "True", addId, "In"));
+        EXPECT_TRUE(graph->Connect(getCountId, getCount->GetDataOutSlotId(), addId, addValue1));
+        EXPECT_TRUE(Connect(*graph, addId, "Out", twiceId, "In"));
+        EXPECT_TRUE(graph->Connect(addId, addResult, twiceId, twiceInputs.front()->GetId()));
+        EXPECT_TRUE(Connect(*graph, twiceId, "Out", setResultId, "In"));
+        EXPECT_TRUE(graph->Connect(twiceId, twiceOutputs.front()->GetId(), setResultId, setResult->GetDataInSlotId()));
+
+        graph->Activate();
+        graph->PostActivate();
+        return graph;
+    }
+
+    ScriptCanvas::Translation::Result Translate(const ScriptCanvas::Graph& graph, const AZ::Data::AssetId& assetId)
+    {
+        ScriptCanvas::Grammar::Request request;
+        request.scriptAssetId = assetId;
+        request.graph = &graph;
+        request.name = "NativeTranslationTest";
+        request.addDebugInformation = false;
+        request.translationTargetFlags
+            = ScriptCanvas::Translation::TargetFlags::Lua | ScriptCanvas::Translation::TargetFlags::Cpp | ScriptCanvas::Translation::TargetFlags::Hpp;
+        return ScriptCanvas::Translation::ParseAndTranslateGraph(request);
+    }
+
+    AZStd::unique_ptr<AZ::Entity> m_variableEntity;
+};
+
+TEST_F(ScriptCanvasNativeTranslationTestFixture, ParseAndTranslateGraph_PureGraph_EmitsNativeGraph)
+{
+    using namespace ScriptCanvas::Translation;
+
+    ScriptCanvas::Graph* graph = CreatePureGraph();
+    const AZ::Data::AssetId assetId(AZ::Uuid::CreateRandom(), 0);
+    const Result result = Translate(*graph, assetId);
+
+    ASSERT_TRUE(result.IsModelValid());
+    EXPECT_EQ(result.m_model->GetExecutionCharacteristics(), ScriptCanvas::Grammar::ExecutionCharacteristics::Pure);
+    EXPECT_TRUE(result.IsSuccess(TargetFlags::Lua).IsSuccess());
+
+    auto cppSuccess = result.IsSuccess(TargetFlags::Cpp);
+    ASSERT_TRUE(cppSuccess.IsSuccess()) << cppSuccess.GetError().c_str();
+    ASSERT_TRUE(result.IsSuccess(TargetFlags::Hpp).IsSuccess());
+
+    const AZStd::string& header = result.m_translations.find(TargetFlags::Hpp)->second.m_text;
+    EXPECT_NE(header.find("namespace"), AZStd::string::npos);
+    EXPECT_NE(header.find("void Register();"), AZStd::string::npos);
+    EXPECT_NE(header.find("void Unregister();"), AZStd::string::npos);
+
+    const AZStd::string& source = result.m_translations.find(TargetFlags::Cpp)->second.m_text;
+    EXPECT_NE(source.find(": public ScriptCanvas::Execution::NativeGraph"), AZStd::string::npos);
+    // the call is resolved once against the BehaviorContext, then invoked through the method pointer
+    EXPECT_NE(source.find("ScriptCanvas::Execution::FindNativeMethod(behaviorContext, \"NativeTranslationTestMath\", \"Twice\")"), AZStd::string::npos);
+    EXPECT_NE(source.find("m_method0->InvokeResult("), AZStd::string::npos);
+    // the if branch, the operator with its literal operand, and the variables
+    EXPECT_NE(source.find("if ("), AZStd::string::npos);
+    EXPECT_NE(source.find(" + 3.0)"), AZStd::string::npos);
+    EXPECT_NE(source.find("ScriptCanvas::Data::NumberType"), AZStd::string::npos);
+    EXPECT_NE(source.find("ScriptCanvas::Data::BooleanType"), AZStd::string::npos);
+    // the method isn't marked thread safe, so neither is the graph
+    EXPECT_NE(source.find("m_isThreadSafe = true && ScriptCanvas::Execution::IsNativeMethodThreadSafe(m_method0);"), AZStd::string::npos);
+    // the generated graph registers under the id of the source asset, which the runtime looks it up by
+    const AZStd::string registration = AZStd::string::format("registry->Register(AZ::Uuid(\"%s\")", assetId.m_guid.ToString<AZStd::string>().c_str());
+    EXPECT_NE(source.find(registration), AZStd::string::npos);
+}
+
+TEST_F(ScriptCanvasNativeTranslationTestFixture, ParseAndTranslateGraph_CppNotRequested_OnlyLuaTranslated)
+{
+    using namespace ScriptCanvas::Translation;
+
+    ScriptCanvas::Graph* graph = CreatePureGraph();
+
+    ScriptCanvas::Grammar::Request request;
+    request.scriptAssetId = AZ::Data::AssetId(AZ::Uuid::CreateRandom(), 0);
+    request.graph = graph;
+    request.name = "NativeTranslationTest";
+    request.addDebugInformation = false;
+    request.translationTargetFlags = TargetFlags::Lua;
+    const Result result = ParseAndTranslateGraph(request);
+
+    EXPECT_TRUE(result.IsSuccess(TargetFlags::Lua).IsSuccess());
+    EXPECT_EQ(result.m_translations.find(TargetFlags::Cpp), result.m_translations.end());
+    EXPECT_EQ(result.m_translations.find(TargetFlags::Hpp), result.m_translations.end());
+}
+
+TEST_F(ScriptCanvasNativeTranslationTestFixture, InitializeStaticActivationData_RegisteredPureGraph_CreatesNativeExecutionState)
+{
+    using namespace ScriptCanvas;
+    using namespace NativeTranslationTestCpp;
+
+    auto registry = Execution::GetNativeGraphRegistry();
+    ASSERT_TRUE(registry);
+
+    const AZ::Uuid sourceId = AZ::Uuid::CreateRandom();
+    registry->Register(sourceId, &CreateCountingNativeGraph);
+
+    AZ::Data::Asset<RuntimeAsset> runtimeAsset(aznew RuntimeAsset(AZ::Data::AssetId(sourceId, 0)), AZ::Data::AssetLoadBehavior::Default);
+    RuntimeData& runtimeData = runtimeAsset->m_runtimeData;
+    runtimeData.m_input.m_executionSelection = Grammar::ExecutionStateSelection::InterpretedPure;
+    runtimeData.m_script = AZ::Data::Asset<AZ::ScriptAsset>(AZ::Data::AssetId(sourceId, AZ::ScriptAsset::CompiledAssetSubId), azrtti_typeid<AZ::ScriptAsset>());
+
+    Execution::Context::InitializeStaticActivationData(runtimeData);
+    EXPECT_EQ(CountingNativeGraph::s_initializeCount, 1);
+    ASSERT_TRUE(runtimeData.m_createExecution);
+
+    RuntimeDataOverrides overrides;
+    overrides.m_runtimeAsset = runtimeAsset;
+    ExecutionStateConfig config(overrides);
+    Execution::StateStorage storage;
+    ExecutionState* executionState = runtimeData.m_createExecution(storage, config);
+    ASSERT_NE(executionState, nullptr);
+    EXPECT_NE(azrtti_cast<ExecutionStateNative*>(executionState), nullptr);
+    EXPECT_EQ(executionState->GetExecutionMode(), ExecutionMode::Native);
+    EXPECT_TRUE(executionState->IsPure());
+
+    executionState->Execute();
+    executionState->StopExecution();
+    EXPECT_EQ(CountingNativeGraph::s_executeCount, 1);
+    Execution::Destruct(storage);
+
+    // the graph is initialized once, and shared by every asset that looks it up
+    Execution::Context::InitializeStaticActivationData(runtimeData);
+    EXPECT_EQ(CountingNativeGraph::s_initializeCount, 1);
+
+    registry->Unregister(sourceId);
+}
+
+TEST_F(ScriptCanvasNativeTranslationTestFixture, InitializeStaticActivationData_PerActivationGraph_NativeGraphNotUsed)
+{
+    using namespace ScriptCanvas;
+    using namespace NativeTranslationTestCpp;
+
+    auto registry = Execution::GetNativeGraphRegistry();
+    ASSERT_TRUE(registry);
+
+    const AZ::Uuid sourceId = AZ::Uuid::CreateRandom();
+    registry->Register(sourceId, &CreateCountingNativeGraph);
+
+    RuntimeData runtimeData;
+    runtimeData.m_input.m_executionSelection = Grammar::ExecutionStateSelection::InterpretedObject;
+    runtimeData.m_script = AZ::Data::Asset<AZ::ScriptAsset>(AZ::Data::AssetId(sourceId, AZ::ScriptAsset::CompiledAssetSubId), azrtti_typeid<AZ::ScriptAsset>());
+
+    Execution::Context::InitializeStaticActivationData(runtimeData);
+    EXPECT_EQ(CountingNativeGraph::s_initializeCount, 0);
+    EXPECT_TRUE(runtimeData.m_createExecution);
+
+    registry->Unregister(sourceId);
+}
+
+TEST_F(ScriptCanvasNativeTranslationTestFixture, NativeGraphRegistryFind_GraphFailsToInitialize_ReturnsNullOnce)
+{
+    using namespace ScriptCanvas;
+    using namespace NativeTranslationTestCpp;
+
+    auto registry = Execution::GetNativeGraphRegistry();
+    ASSERT_TRUE(registry);
+
+    const AZ::Uuid sourceId = AZ::Uuid::CreateRandom();
+    EXPECT_EQ(registry->Find(sourceId, *m_behaviorContext), nullptr);
+
+    CountingNativeGraph::s_initializeResult = false;
+    registry->Register(sourceId, &CreateCountingNativeGraph);
+
+    EXPECT_EQ(registry->Find(sourceId, *m_behaviorContext), nullptr);
+
+    // a graph that failed to initialize keeps running interpreted, without trying again
+    EXPECT_EQ(registry->Find(sourceId, *m_behaviorContext), nullptr);
+    EXPECT_EQ(CountingNativeGraph::s_initializeCount, 1);
+
+    registry->Unregister(sourceId);
+}
@@ -98,6 +98,13 @@ namespace SurfaceData
         //! @param surfaceModifierHandle - The handle to the surface modifier that will modify the surface weights.
         void ModifySurfaceWeights(const SurfaceDataRegistryHandle& surfaceModifierHandle);
 
+        //! Modify the surface weights for each surface point in the list with a set of surface modifiers, run in the given order.
+        //! Modifiers only touch the weights of the points they're given, so large lists are split into batches of points
+        //! that run through all the modifiers in parallel jobs.
+        //! @param surfaceModifierHandles - The handles to the surface modifiers that will modify the surface weights.
+        //! @param pointsPerJob - The number of points modified by each job. 0 modifies every point on the calling thread.
+        void ModifySurfaceWeights(AZStd::span<const SurfaceDataRegistryHandle> surfaceModifierHandles, size_t pointsPerJob);
+
         //! End construction of the SurfacePointList.
         //! After this is called, surface points can no longer be added or modified, and all of the query APIs can start getting used.
         void EndListConstruction();
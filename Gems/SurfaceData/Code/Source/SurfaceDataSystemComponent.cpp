@@ -24,6 +24,12 @@ AZ_DEFINE_BUDGET(SurfaceData);
 
 namespace SurfaceData
 {
+    namespace
+    {
+        // Number of surface points each job runs through the surface modifiers. Smaller lists are modified on the calling thread.
+        constexpr size_t ModifierPointsPerJob = 4096;
+    }
+
     void SurfaceDataSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         SurfaceTag::Reflect(context);
@@ -423,15 +429,25 @@ namespace SurfaceData
         // within a water volume.
         {
             SURFACE_DATA_PROFILE_SCOPE_VERBOSE("GetSurfacePointsFromListInternal: ModifySurfaceWeights");
+            AZStd::vector<SurfaceDataRegistryHandle> modifierHandles;
             for (const auto& [modifierHandle, modifier] : m_registeredSurfaceDataModifiers)
             {
                 bool hasInfiniteBounds = !modifier.m_bounds.IsValid();
 
                 if (hasInfiniteBounds || AabbOverlaps2D(modifier.m_bounds, surfacePointLists.GetSurfacePointAabb()))
                 {
-                    surfacePointLists.ModifySurfaceWeights(modifierHandle);
+                    modifierHandles.push_back(modifierHandle);
                 }
             }
+
+            // The modifiers can run surface queries of their own on the job threads, so release the registration lock first to
+            // keep a pending registration from blocking those queries while this thread waits on them.
+            registrationLock.unlock();
+
+            if (!modifierHandles.empty())
+            {
+                surfacePointLists.ModifySurfaceWeights(modifierHandles, ModifierPointsPerJob);
+            }
         }
 
         // Notify the output structure that we're done building up the list.
@@ -6,6 +6,8 @@
  *
  */
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <SurfaceData/Utility/SurfaceDataUtility.h>
 #include <SurfaceData/SurfacePointList.h>
 #include <SurfaceData/SurfaceDataModifierRequestBus.h>
@@ -197,6 +199,50 @@ namespace SurfaceData
             m_surfacePositionList, m_surfaceCreatorIdList, m_surfaceWeightsList);
     }
 
+    void SurfacePointList::ModifySurfaceWeights(
+        AZStd::span<const SurfaceDataRegistryHandle> surfaceModifierHandles, size_t pointsPerJob)
+    {
+        AZ_Assert(m_listIsBeingConstructed, "Trying to modify surface weights on a SurfacePointList that isn't under construction.");
+
+        const size_t pointCount = m_surfacePositionList.size();
+
+        auto modifyPoints = [this, surfaceModifierHandles](size_t startIndex, size_t count)
+        {
+            AZStd::span<const AZ::Vector3> positions(m_surfacePositionList.data() + startIndex, count);
+            AZStd::span<const AZ::EntityId> creatorEntityIds(m_surfaceCreatorIdList.data() + startIndex, count);
+            AZStd::span<SurfaceTagWeights> weights(m_surfaceWeightsList.data() + startIndex, count);
+
+            for (const auto& surfaceModifierHandle : surfaceModifierHandles)
+            {
+                SurfaceDataModifierRequestBus::Event(
+                    surfaceModifierHandle, &SurfaceDataModifierRequestBus::Events::ModifySurfacePoints, positions, creatorEntityIds,
+                    weights);
+            }
+        };
+
+        if ((pointsPerJob == 0) || (pointCount <= pointsPerJob))
+        {
+            modifyPoints(0, pointCount);
+            return;
+        }
+
+        // The modifier bus uses shared dispatches, so every batch can run through the modifiers at the same time.
+        AZ::JobCompletion jobCompletion;
+        for (size_t startIndex = 0; startIndex < pointCount; startIndex += pointsPerJob)
+        {
+            const size_t count = AZStd::min(pointsPerJob, pointCount - startIndex);
+            AZ::Job* job = AZ::CreateJobFunction(
+                [&modifyPoints, startIndex, count]()
+                {
+                    modifyPoints(startIndex, count);
+                },
+                true);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
     void SurfacePointList::FilterPoints(AZStd::span<const SurfaceTag> desiredTags)
     {
         AZ_Assert(m_listIsBeingConstructed, "Trying to filter a SurfacePointList that isn't under construction.");
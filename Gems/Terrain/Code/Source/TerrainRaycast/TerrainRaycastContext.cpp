@@ -10,6 +10,7 @@
 #include <TerrainSystem/TerrainSystem.h>
 
 #include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/sort.h>
 
 using namespace Terrain;
@@ -63,6 +64,20 @@ namespace
         }
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Integer division that rounds towards negative infinity, so that negative coordinates map to the right block.
+    static int32_t FloorDivide(int32_t value, int32_t divisor)
+    {
+        return (value >= 0) ? (value / divisor) : ((value - divisor + 1) / divisor);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Pack block coordinates into a single key.
+    static uint64_t GetBlockKey(int32_t blockX, int32_t blockY)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(blockX)) << 32) | static_cast<uint64_t>(static_cast<uint32_t>(blockY));
+    }
+
 } // namespace
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -79,6 +94,106 @@ TerrainRaycastContext::~TerrainRaycastContext()
     AzFramework::RenderGeometry::IntersectorBus::Handler::BusDisconnect();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TerrainRaycastContext::InvalidateRegion(const AZ::Aabb& region)
+{
+    if (!region.IsValid())
+    {
+        return;
+    }
+
+    AZStd::unique_lock<AZStd::shared_mutex> lock(m_blockMutex);
+
+    // Blocks that are being calculated right now might overlap the region, so they can't be cached either.
+    ++m_blockGeneration;
+
+    const float blockWorldSize = m_blockGridResolution * BlockSize;
+    const AZ::Vector3& regionMin = region.GetMin();
+    const AZ::Vector3& regionMax = region.GetMax();
+
+    // A block uses the grid points on both its min and max edges, so the bounds are inclusive on both sides.
+    AZStd::erase_if(
+        m_blockHeightBounds,
+        [=](const auto& item)
+        {
+            const int32_t blockX = static_cast<int32_t>(static_cast<uint32_t>(item.first >> 32));
+            const int32_t blockY = static_cast<int32_t>(static_cast<uint32_t>(item.first & 0xFFFFFFFF));
+            const float blockMinX = blockX * blockWorldSize;
+            const float blockMinY = blockY * blockWorldSize;
+
+            return (blockMinX <= regionMax.GetX()) && (blockMinX + blockWorldSize >= regionMin.GetX()) &&
+                (blockMinY <= regionMax.GetY()) && (blockMinY + blockWorldSize >= regionMin.GetY());
+        });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TerrainRaycastContext::ClearHeightBounds()
+{
+    AZStd::unique_lock<AZStd::shared_mutex> lock(m_blockMutex);
+    m_blockHeightBounds.clear();
+    ++m_blockGeneration;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TerrainRaycastContext::BlockHeightBounds TerrainRaycastContext::GetBlockHeightBounds(
+    int32_t blockX, int32_t blockY, float gridResolution)
+{
+    const uint64_t blockKey = GetBlockKey(blockX, blockY);
+
+    uint64_t generation = 0;
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_blockMutex);
+        if (m_blockGridResolution == gridResolution)
+        {
+            if (auto blockIterator = m_blockHeightBounds.find(blockKey); blockIterator != m_blockHeightBounds.end())
+            {
+                return blockIterator->second;
+            }
+        }
+        generation = m_blockGeneration;
+    }
+
+    // Query the heights of all the grid points used by the terrain squares in the block in a single bulk query.
+    const float blockWorldSize = gridResolution * BlockSize;
+    const AzFramework::Terrain::TerrainQueryRegion queryRegion(
+        AZ::Vector2(blockX * blockWorldSize, blockY * blockWorldSize), BlockSize + 1, BlockSize + 1, AZ::Vector2(gridResolution));
+
+    BlockHeightBounds bounds{ AZStd::numeric_limits<float>::max(), AZStd::numeric_limits<float>::lowest() };
+    m_terrainSystem.QueryRegion(
+        queryRegion,
+        AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights,
+        [&bounds]([[maybe_unused]] size_t xIndex, [[maybe_unused]] size_t yIndex,
+                  const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+        {
+            bounds.m_minHeight = AZStd::min(bounds.m_minHeight, surfacePoint.m_position.GetZ());
+            bounds.m_maxHeight = AZStd::max(bounds.m_maxHeight, surfacePoint.m_position.GetZ());
+        },
+        AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+
+    AZStd::unique_lock<AZStd::shared_mutex> lock(m_blockMutex);
+
+    // Only cache the bounds if the terrain data didn't change while they were calculated.
+    const bool isCurrent = (generation == m_blockGeneration);
+
+    if (m_blockGridResolution != gridResolution)
+    {
+        m_blockHeightBounds.clear();
+        m_blockGridResolution = gridResolution;
+        ++m_blockGeneration;
+    }
+
+    if (isCurrent && (bounds.m_minHeight <= bounds.m_maxHeight))
+    {
+        if (m_blockHeightBounds.size() >= MaxCachedBlocks)
+        {
+            m_blockHeightBounds.clear();
+        }
+        m_blockHeightBounds.emplace(blockKey, bounds);
+    }
+
+    return bounds;
+}
+
 /*
    Iterative function that divides an AABB encompasing terrain points into grid squares based on
    the given grid resolution and steps along the ray visiting each voxel it intersects in order
@@ -200,10 +315,69 @@ AzFramework::RenderGeometry::RayResult TerrainRaycastContext::RayIntersect(
     const AZ::Vector2 gridIncrementX(gridIncrement.GetX(), 0.0f);
     const AZ::Vector2 gridIncrementY(0.0f, gridIncrement.GetY());
 
+    // Move forward along the line (either horizontally or vertically) to the next terrain square.
+    auto moveToNextSquare = [&]()
+    {
+        if (tUntilNextBoundary.GetY() < tUntilNextBoundary.GetX())
+        {
+            curGridCorner += gridIncrementY;
+            tUntilNextBoundary += tDeltaY;
+        }
+        else
+        {
+            curGridCorner += gridIncrementX;
+            tUntilNextBoundary += tDeltaX;
+        }
+    };
+
+    // The squares are grouped in blocks with cached min and max heights. When the ray passes above or below the height bounds of
+    // a block, none of its squares can be hit, so the ray keeps walking through them without querying any terrain heights.
+    const float blockWorldSize = terrainResolution.GetX() * BlockSize;
+    int32_t currentBlockX = 0;
+    int32_t currentBlockY = 0;
+    bool isFirstBlock = true;
+    bool skipCurrentBlock = false;
+
     // Walk through each grid square in the terrain that intersects the XY coordinates of the line.
     // We'll check each square to see if the ray intersections actually intersect the terrain triangles in the square.
     for (int terrainSquare = 0; terrainSquare < numTerrainSquares; terrainSquare++)
     {
+        // Find the block containing this square, and check the ray against its height bounds when entering a new block.
+        const AZ::Vector2 gridSquare = ((curGridCorner / terrainResolution) + AZ::Vector2(0.5f)).GetFloor();
+        const int32_t blockX = FloorDivide(aznumeric_cast<int32_t>(gridSquare.GetX()), BlockSize);
+        const int32_t blockY = FloorDivide(aznumeric_cast<int32_t>(gridSquare.GetY()), BlockSize);
+        if (isFirstBlock || (blockX != currentBlockX) || (blockY != currentBlockY))
+        {
+            isFirstBlock = false;
+            currentBlockX = blockX;
+            currentBlockY = blockY;
+
+            const BlockHeightBounds bounds = GetBlockHeightBounds(blockX, blockY, terrainResolution.GetX());
+            if (bounds.m_minHeight <= bounds.m_maxHeight)
+            {
+                // Pad the bounds to account for precision differences between the bulk query and the per-square queries.
+                const float padding = 0.01f + (bounds.m_maxHeight - bounds.m_minHeight) * 0.01f;
+                const AZ::Aabb blockBounds = AZ::Aabb::CreateFromMinMax(
+                    AZ::Vector3(blockX * blockWorldSize, blockY * blockWorldSize, bounds.m_minHeight),
+                    AZ::Vector3((blockX + 1) * blockWorldSize, (blockY + 1) * blockWorldSize, bounds.m_maxHeight)).GetExpanded(AZ::Vector3(padding));
+
+                AZ::Vector3 blockRayStart = ray.m_startWorldPosition;
+                AZ::Vector3 blockRayEnd = ray.m_endWorldPosition;
+                float tBlockStart, tBlockEnd;
+                skipCurrentBlock = !AZ::Intersect::ClipRayWithAabb(blockBounds, blockRayStart, blockRayEnd, tBlockStart, tBlockEnd);
+            }
+            else
+            {
+                skipCurrentBlock = false;
+            }
+        }
+
+        if (skipCurrentBlock)
+        {
+            moveToNextSquare();
+            continue;
+        }
+
         // Create a bounding volume for this terrain square.
         AZ::Aabb currentVoxel = AZ::Aabb::CreateFromMinMax(
             AZ::Vector3(curGridCorner, terrainWorldBounds.GetMin().GetZ()),
@@ -225,17 +399,8 @@ AzFramework::RenderGeometry::RayResult TerrainRaycastContext::RayIntersect(
             break;
         }
 
-        // No hit yet, so move forward along the line (either horizontally or vertically) to the next terrain square.
-        if (tUntilNextBoundary.GetY() < tUntilNextBoundary.GetX())
-        {
-            curGridCorner += gridIncrementY;
-            tUntilNextBoundary += tDeltaY;
-        }
-        else
-        {
-            curGridCorner += gridIncrementX;
-            tUntilNextBoundary += tDeltaX;
-        }
+        // No hit yet, so move forward along the line to the next terrain square.
+        moveToNextSquare();
     }
 
     // If needed we could call m_terrainSystem.FindBestAreaEntityAtPosition in order to set
@@ -9,6 +9,8 @@
 #pragma once
 
 #include <AzFramework/Render/IntersectorInterface.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 namespace Terrain
@@ -41,6 +43,16 @@ namespace Terrain
         //! \ref AzFramework::RenderGeometry::RayIntersect
         AzFramework::RenderGeometry::RayResult RayIntersect(const AzFramework::RenderGeometry::RayRequest& ray) override;
 
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Discard the cached height bounds of the blocks overlapping a region, so they get
+        //! recalculated from the current terrain data the next time a ray crosses them.
+        //! \param[in] region The region whose terrain data changed. Z is ignored.
+        void InvalidateRegion(const AZ::Aabb& region);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Discard all the cached height bounds
+        void ClearHeightBounds();
+
     protected:
         ////////////////////////////////////////////////////////////////////////////////////////////
         // RenderGeometry::IntersectorBus inherits from RenderGeometry::IntersectionNotifications,
@@ -54,9 +66,34 @@ namespace Terrain
         ///@}
 
     private:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Min and max terrain heights of the grid points in a block of terrain squares
+        struct BlockHeightBounds
+        {
+            float m_minHeight = 0.0f;
+            float m_maxHeight = 0.0f;
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Get the height bounds of a block, querying the terrain heights if they aren't cached
+        //! \param[in] blockX, blockY The block coordinates
+        //! \param[in] gridResolution The distance between terrain grid points
+        //! eturn The height bounds of the block
+        BlockHeightBounds GetBlockHeightBounds(int32_t blockX, int32_t blockY, float gridResolution);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        // Constants
+        static constexpr int32_t BlockSize = 16; //!< Number of terrain squares along each side of a block
+        static constexpr size_t MaxCachedBlocks = 64 * 1024; //!< The cache is discarded when it grows past this
+
         ////////////////////////////////////////////////////////////////////////////////////////////
         // Variables
         TerrainSystem& m_terrainSystem; //!< Terrain system that owns this terrain raycast context
         AzFramework::EntityContextId m_entityContextId; //!< This object's entity context id
+
+        AZStd::shared_mutex m_blockMutex; //!< Guards the cached block height bounds
+        AZStd::unordered_map<uint64_t, BlockHeightBounds> m_blockHeightBounds; //!< Cached block height bounds by block coordinates
+        float m_blockGridResolution = 0.0f; //!< Grid resolution the cached block height bounds were calculated with
+        uint64_t m_blockGeneration = 0; //!< Incremented when blocks are discarded, to avoid caching bounds of stale data
     };
 } // namespace Terrain
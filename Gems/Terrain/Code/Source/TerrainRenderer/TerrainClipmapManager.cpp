@@ -69,9 +69,50 @@ namespace Terrain
         AZ::ConsoleFunctorFlags::Null,
         "A multiplier to the final output of the clipmap texture's debug display.");
 
+    AZ_CVAR(
+        uint32_t,
+        r_terrainClipmapUpdateTexelBudget,
+        1024 * 1024,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "The max number of texels updated per frame in each of the macro and detail clipmap stacks when the camera moves.\n"
+        "Levels are updated from the one nearest to the camera, and levels over the budget keep their previous center until a later frame.\n"
+        "The level nearest to the camera that needs an update is always updated. 0: no budget.");
+
     namespace
     {
         [[maybe_unused]] static const char* TerrainClipmapManagerName = "TerrainClipmapManager";
+
+        uint32_t GetUpdateRegionTexelCount(const ClipmapBoundsRegionList& updateRegionList)
+        {
+            uint32_t texelCount = 0;
+            for (const ClipmapBoundsRegion& updateRegion : updateRegionList)
+            {
+                const Vector2i regionSize = updateRegion.m_localAabb.m_max - updateRegion.m_localAabb.m_min;
+                texelCount += aznumeric_cast<uint32_t>(regionSize.m_x * regionSize.m_y);
+            }
+            return texelCount;
+        }
+
+        //! Returns true if the update regions of a clipmap level fit in the remaining texel budget of the frame, and
+        //! subtracts them from it. The first level with an update always fits, so that the clipmaps keep making progress.
+        bool ConsumeUpdateTexelBudget(const ClipmapBoundsRegionList& updateRegionList, bool hasUpdatedLevel, uint32_t& remainingTexelBudget)
+        {
+            const uint32_t texelBudget = r_terrainClipmapUpdateTexelBudget;
+            if (texelBudget == 0)
+            {
+                return true;
+            }
+
+            const uint32_t texelCount = GetUpdateRegionTexelCount(updateRegionList);
+            if (texelCount > remainingTexelBudget && hasUpdatedLevel)
+            {
+                return false;
+            }
+
+            remainingTexelBudget -= AZStd::min(texelCount, remainingTexelBudget);
+            return true;
+        }
     }
 
     //! Calculate how many layers of clipmap is needed.
@@ -644,11 +685,26 @@ namespace Terrain
         }
 
         // macro clipmap data:
+        // Levels are ordered from the nearest to the camera, so the nearest levels get the texel budget first.
+        // Once a level is over the budget, it and the levels after it keep their current center, so the texels
+        // of every level stay consistent with its center and the levels stay nested.
+        uint32_t remainingMacroTexelBudget = r_terrainClipmapUpdateTexelBudget;
+        bool hasMacroUpdatedLevel = false;
         for (uint32_t clipmapIndex = 0; clipmapIndex < m_macroClipmapStackSize; ++clipmapIndex)
         {
             ClipmapBounds& clipmapBounds = m_macroClipmapBounds[clipmapIndex];
 
-            ClipmapBoundsRegionList updateRegionList = clipmapBounds.UpdateCenter(currentViewPosition);
+            ClipmapBounds updatedClipmapBounds = clipmapBounds;
+            ClipmapBoundsRegionList updateRegionList = updatedClipmapBounds.UpdateCenter(currentViewPosition);
+            if (!updateRegionList.empty())
+            {
+                if (!ConsumeUpdateTexelBudget(updateRegionList, hasMacroUpdatedLevel, remainingMacroTexelBudget))
+                {
+                    break;
+                }
+                hasMacroUpdatedLevel = true;
+            }
+            clipmapBounds = updatedClipmapBounds;
 
             // write updated center
             Vector2i center = clipmapBounds.GetModCenter();
@@ -689,12 +745,24 @@ namespace Terrain
             m_clipmapData.m_macroDispatchGroupCountY = 1;
         }
 
-        // detail clipmap data:
+        // detail clipmap data, with its own texel budget:
+        uint32_t remainingDetailTexelBudget = r_terrainClipmapUpdateTexelBudget;
+        bool hasDetailUpdatedLevel = false;
         for (uint32_t clipmapIndex = 0; clipmapIndex < m_detailClipmapStackSize; ++clipmapIndex)
         {
             ClipmapBounds& clipmapBounds = m_detailClipmapBounds[clipmapIndex];
 
-            ClipmapBoundsRegionList updateRegionList = clipmapBounds.UpdateCenter(currentViewPosition);
+            ClipmapBounds updatedClipmapBounds = clipmapBounds;
+            ClipmapBoundsRegionList updateRegionList = updatedClipmapBounds.UpdateCenter(currentViewPosition);
+            if (!updateRegionList.empty())
+            {
+                if (!ConsumeUpdateTexelBudget(updateRegionList, hasDetailUpdatedLevel, remainingDetailTexelBudget))
+                {
+                    break;
+                }
+                hasDetailUpdatedLevel = true;
+            }
+            clipmapBounds = updatedClipmapBounds;
 
             // write updated center
             Vector2i center = clipmapBounds.GetModCenter();
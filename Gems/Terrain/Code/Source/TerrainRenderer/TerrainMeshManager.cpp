@@ -948,31 +948,29 @@ namespace Terrain
         sector.m_lodHeightsNormalsBuffer->UpdateData(clodHeightNormals.data(), clodHeightNormals.size() * sizeof(HeightNormalVertex), 0);
     }
 
-    void TerrainMeshManager::GatherMeshData(SectorDataRequest request, AZStd::vector<HeightNormalVertex>& meshHeightsNormals, AZ::Aabb& meshAabb, bool& terrainExistsAnywhere)
+    void TerrainMeshManager::QuerySectorHeights(const SectorDataRequest& request, uint16_t border, SectorHeights& sectorHeights)
     {
         const AZ::Vector2 stepSize(request.m_vertexSpacing);
 
-        const uint16_t querySamplesX = request.m_samplesX + 2; // extra row / column on each side for normals.
-        const uint16_t querySamplesY = request.m_samplesY + 2; // extra row / column on each side for normals.
-        const uint16_t querySamplesCount = querySamplesX * querySamplesY;
-        const uint16_t outputSamplesCount = request.m_samplesX * request.m_samplesY;
+        const uint16_t querySamplesX = request.m_samplesX + 2 * border;
+        const uint16_t querySamplesY = request.m_samplesY + 2 * border;
 
-        AZStd::vector<float> heights;
-        heights.resize_no_construct(querySamplesCount);
+        sectorHeights.m_heights.resize_no_construct(querySamplesX * querySamplesY);
+        sectorHeights.m_stride = querySamplesX;
+        sectorHeights.m_border = border;
+        sectorHeights.m_terrainExistsAnywhere = false;
 
-        meshHeightsNormals.resize_no_construct(outputSamplesCount);
-
-        auto perPositionCallback = [this, &heights, querySamplesX, &terrainExistsAnywhere]
+        auto perPositionCallback = [this, &sectorHeights, querySamplesX]
         (size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
         {
             static constexpr float HeightDoesNotExistValue = -1.0f;
             const float height = surfacePoint.m_position.GetZ() - m_worldHeightBounds.m_min;
-            heights.at(yIndex * querySamplesX + xIndex) = terrainExists ? height : HeightDoesNotExistValue;
-            terrainExistsAnywhere = terrainExistsAnywhere || terrainExists;
+            sectorHeights.m_heights.at(yIndex * querySamplesX + xIndex) = terrainExists ? height : HeightDoesNotExistValue;
+            sectorHeights.m_terrainExistsAnywhere = sectorHeights.m_terrainExistsAnywhere || terrainExists;
         };
 
         AzFramework::Terrain::TerrainQueryRegion queryRegion(
-            request.m_worldStartPosition - stepSize, querySamplesX, querySamplesY, stepSize);
+            request.m_worldStartPosition - stepSize * aznumeric_cast<float>(border), querySamplesX, querySamplesY, stepSize);
 
         AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
             &AzFramework::Terrain::TerrainDataRequests::QueryRegion,
@@ -980,12 +978,23 @@ namespace Terrain
             AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights,
             perPositionCallback,
             request.m_samplerType);
+    }
 
-        if (!terrainExistsAnywhere)
-        {
-            // No height data, so just return
-            return;
-        }
+    void TerrainMeshManager::GatherMeshData(
+        const SectorDataRequest& request,
+        const SectorHeights& sectorHeights,
+        uint16_t sampleStep,
+        AZStd::vector<HeightNormalVertex>& meshHeightsNormals,
+        AZ::Aabb& meshAabb)
+    {
+        AZ_Assert(sectorHeights.m_border >= sampleStep, "Sector heights need a border of at least one sample step for normals.");
+
+        const AZStd::vector<float>& heights = sectorHeights.m_heights;
+        const uint16_t querySamplesX = sectorHeights.m_stride;
+        const uint16_t neighborOffsetX = sampleStep;
+        const uint16_t neighborOffsetY = sampleStep * querySamplesX;
+
+        meshHeightsNormals.resize_no_construct(request.m_samplesX * request.m_samplesY);
 
         float zExtents = (m_worldHeightBounds.m_max - m_worldHeightBounds.m_min);
         const float rcpWorldZ = 1.0f / zExtents;
@@ -1001,11 +1010,11 @@ namespace Terrain
 
         for (uint16_t y = 0; y < request.m_samplesY; ++y)
         {
-            const uint16_t queryY = y + 1;
+            const uint16_t queryY = sectorHeights.m_border + y * sampleStep;
 
             for (uint16_t x = 0; x < request.m_samplesX; ++x)
             {
-                const uint16_t queryX = x + 1;
+                const uint16_t queryX = sectorHeights.m_border + x * sampleStep;
                 const uint16_t queryCoord = queryY * querySamplesX + queryX;
 
                 uint16_t coord = y * request.m_samplesX + x;
@@ -1017,7 +1026,7 @@ namespace Terrain
                     // Primary terrain height is limited to every-other bit, and clod heights can be in-between or the same
                     // as any of the primary heights. This leaves the max value as the single value that is never used by a
                     // legitimate height.
-                    meshHeightsNormals.at(coord).m_height = NoTerrainVertexHeight;
+                    meshHeightsNormals.at(coord) = { NoTerrainVertexHeight, NormalXYDataType(NormalDataType(0), NormalDataType(0)) };
                     continue;
                 }
 
@@ -1064,13 +1073,13 @@ namespace Terrain
                     }
                 };
 
-                const float leftHeight = heights.at(queryCoord - 1);
-                const float rightHeight = heights.at(queryCoord + 1);
+                const float leftHeight = heights.at(queryCoord - neighborOffsetX);
+                const float rightHeight = heights.at(queryCoord + neighborOffsetX);
                 const float xSlope = getSlope(leftHeight, rightHeight);
                 const float normalX = xSlope / sqrt(xSlope * xSlope + 1); // sin(arctan(xSlope)
 
-                const float upHeight = heights.at(queryCoord - querySamplesX);
-                const float downHeight = heights.at(queryCoord + querySamplesX);
+                const float upHeight = heights.at(queryCoord - neighborOffsetY);
+                const float downHeight = heights.at(queryCoord + neighborOffsetY);
                 const float ySlope = getSlope(upHeight, downHeight);
                 const float normalY = ySlope / sqrt(ySlope * ySlope + 1); // sin(arctan(ySlope)
 
@@ -1117,6 +1126,11 @@ namespace Terrain
                 {
                     AZStd::vector<HeightNormalVertex> meshHeightsNormals;
 
+                    // The vertices of the next lod are every other vertex of this one, so a single query with a border wide
+                    // enough for the normals of the next lod provides the heights for both.
+                    const uint16_t heightsBorder = m_config.m_clodEnabled ? 2 : 1;
+                    SectorHeights sectorHeights;
+
                     {
                         SectorDataRequest request;
                         request.m_samplesX = m_gridVerts1D;
@@ -1125,9 +1139,11 @@ namespace Terrain
                         request.m_vertexSpacing = gridMeters / m_gridSize;
                         request.m_useVertexOrderRemap = true;
 
-                        GatherMeshData(request, meshHeightsNormals, sector->m_aabb, sector->m_hasData);
+                        QuerySectorHeights(request, heightsBorder, sectorHeights);
+                        sector->m_hasData = sectorHeights.m_terrainExistsAnywhere;
                         if (sector->m_hasData)
                         {
+                            GatherMeshData(request, sectorHeights, 1, meshHeightsNormals, sector->m_aabb);
                             UpdateSectorBuffers(*sector, meshHeightsNormals);
                         }
 
@@ -1144,17 +1160,10 @@ namespace Terrain
                         request.m_worldStartPosition = sector->m_worldCoord.ToVector2() * gridMeters;
                         request.m_vertexSpacing = gridMeters / m_gridSizeNextLod;
 
+                        // Vertices without terrain get a height that represents "no data", which is handled when building the lod buffers.
                         AZ::Aabb dummyAabb = AZ::Aabb::CreateNull(); // Don't update the sector aabb based on only the clod vertices.
-                        bool terrainExists = false;
                         AZStd::vector<HeightNormalVertex> meshLodHeightsNormals;
-                        GatherMeshData(request, meshLodHeightsNormals, dummyAabb, terrainExists);
-                        if (!terrainExists)
-                        {
-                            // It's unlikely but possible for the higher lod to have data and the lower lod to not. In that case 
-                            // meshLodHeights will be empty, so fill it with values that represent "no data".
-                            HeightNormalVertex defaultValue = { NoTerrainVertexHeight, NormalXYDataType(NormalDataType(0), NormalDataType(0)) };
-                            AZStd::fill(meshLodHeightsNormals.begin(), meshLodHeightsNormals.end(), defaultValue);
-                        }
+                        GatherMeshData(request, sectorHeights, 2, meshLodHeightsNormals, dummyAabb);
                         UpdateSectorLodBuffers(*sector, meshHeightsNormals, meshLodHeightsNormals);
                     }
                 };
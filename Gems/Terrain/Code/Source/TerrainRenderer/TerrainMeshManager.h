@@ -212,6 +212,16 @@ namespace Terrain
             bool m_useVertexOrderRemap = false;
         };
 
+        //! Heights queried for a sector, with a border of extra samples on each side for calculating normals.
+        //! Heights without terrain are negative.
+        struct SectorHeights
+        {
+            AZStd::vector<float> m_heights;
+            uint16_t m_stride = 0;
+            uint16_t m_border = 0;
+            bool m_terrainExistsAnywhere = false;
+        };
+
         struct CachedDrawData
         {
             AZ::Data::Instance<AZ::RPI::Shader> m_shader;
@@ -267,7 +277,14 @@ namespace Terrain
         void UpdateSectorLodBuffers(Sector& sector,
             const AZStd::span<const HeightNormalVertex> originalHeightsNormals,
             const AZStd::span<const HeightNormalVertex> lodHeightsNormals);
-        void GatherMeshData(SectorDataRequest request, AZStd::vector<HeightNormalVertex>& meshHeightsNormals, AZ::Aabb& meshAabb, bool& terrainExistsAnywhere);
+        void QuerySectorHeights(const SectorDataRequest& request, uint16_t border, SectorHeights& sectorHeights);
+        //! Builds the vertices of a request from every sampleStep-th height of the sector heights.
+        void GatherMeshData(
+            const SectorDataRequest& request,
+            const SectorHeights& sectorHeights,
+            uint16_t sampleStep,
+            AZStd::vector<HeightNormalVertex>& meshHeightsNormals,
+            AZ::Aabb& meshAabb);
 
         void CheckLodGridsForUpdate(AZ::Vector3 newPosition);
         void ProcessSectorUpdates(AZStd::vector<AZStd::vector<Sector*>>& sectorUpdates);
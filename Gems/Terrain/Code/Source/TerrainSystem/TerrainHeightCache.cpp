@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TerrainSystem/TerrainHeightCache.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
+#include <TerrainProfiler.h>
+
+namespace Terrain
+{
+    namespace
+    {
+        // Grid points further than this from the origin aren't cached, to keep the tile coordinates within 32 bits.
+        constexpr float MaxGridCoordinate = static_cast<float>(1 << 30);
+
+        int32_t FloorDivide(int32_t value, int32_t divisor)
+        {
+            return (value >= 0) ? (value / divisor) : ((value - divisor + 1) / divisor);
+        }
+    }
+
+    TerrainHeightCache::TerrainHeightCache(GenerateHeightsCallback generateHeightsCallback)
+        : m_generateHeightsCallback(AZStd::move(generateHeightsCallback))
+    {
+    }
+
+    void TerrainHeightCache::SetMemoryBudget(size_t memoryBudget)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+        if (m_memoryBudget == memoryBudget)
+        {
+            return;
+        }
+
+        m_memoryBudget = memoryBudget;
+        if (m_memoryBudget == 0)
+        {
+            m_tiles.clear();
+            ++m_generation;
+        }
+        else
+        {
+            EvictTiles();
+        }
+    }
+
+    bool TerrainHeightCache::IsEnabled() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        return m_memoryBudget > 0;
+    }
+
+    void TerrainHeightCache::SetQueryResolution(float queryResolution)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+        if (m_queryResolution != queryResolution)
+        {
+            m_queryResolution = queryResolution;
+            m_tiles.clear();
+            ++m_generation;
+        }
+    }
+
+    void TerrainHeightCache::GetHeights(
+        AZStd::span<AZ::Vector3> positions, AZStd::span<bool> terrainExists, AZStd::vector<size_t>& outUncachedIndices)
+    {
+        TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+        AZ_Assert(positions.size() == terrainExists.size(), "The sizes of the positions list and terrain exists list should match.");
+
+        float queryResolution = 0.0f;
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+            queryResolution = m_queryResolution;
+        }
+
+        // Consecutive positions are usually in the same tile, so keep the last tile around instead of looking it up every time.
+        uint64_t lastTileKey = 0;
+        AZStd::shared_ptr<const Tile> lastTile;
+
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            const float gridX = positions[index].GetX() / queryResolution;
+            const float gridY = positions[index].GetY() / queryResolution;
+            const float roundedGridX = floorf(gridX + 0.5f);
+            const float roundedGridY = floorf(gridY + 0.5f);
+
+            if ((fabsf(gridX - roundedGridX) > GridTolerance) || (fabsf(gridY - roundedGridY) > GridTolerance) ||
+                (fabsf(roundedGridX) > MaxGridCoordinate) || (fabsf(roundedGridY) > MaxGridCoordinate))
+            {
+                outUncachedIndices.push_back(index);
+                continue;
+            }
+
+            const int32_t pointX = aznumeric_cast<int32_t>(roundedGridX);
+            const int32_t pointY = aznumeric_cast<int32_t>(roundedGridY);
+            const int32_t tileX = FloorDivide(pointX, TileSize);
+            const int32_t tileY = FloorDivide(pointY, TileSize);
+
+            const uint64_t tileKey = GetTileKey(tileX, tileY);
+            if (!lastTile || (tileKey != lastTileKey))
+            {
+                lastTile = GetOrCreateTile(tileX, tileY);
+                lastTileKey = tileKey;
+                lastTile->m_lastUsed = ++m_useCounter;
+            }
+
+            const size_t pointIndex = aznumeric_cast<size_t>((pointY - (tileY * TileSize)) * TileSize + (pointX - (tileX * TileSize)));
+            positions[index].SetZ(lastTile->m_heights[pointIndex]);
+            terrainExists[index] = lastTile->m_terrainExists[pointIndex];
+        }
+    }
+
+    void TerrainHeightCache::Invalidate(const AZ::Aabb& region)
+    {
+        if (!region.IsValid())
+        {
+            return;
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+        // Tiles that are being generated right now might overlap the region, so they need to be discarded as well.
+        ++m_generation;
+
+        const float tileWorldSize = m_queryResolution * TileSize;
+        const float lastPointOffset = m_queryResolution * (TileSize - 1);
+        const float regionMinX = region.GetMin().GetX();
+        const float regionMinY = region.GetMin().GetY();
+        const float regionMaxX = region.GetMax().GetX();
+        const float regionMaxY = region.GetMax().GetY();
+
+        AZStd::erase_if(
+            m_tiles,
+            [=](const auto& item)
+            {
+                const int32_t tileX = static_cast<int32_t>(static_cast<uint32_t>(item.first >> 32));
+                const int32_t tileY = static_cast<int32_t>(static_cast<uint32_t>(item.first & 0xFFFFFFFF));
+                const float tileMinX = tileX * tileWorldSize;
+                const float tileMinY = tileY * tileWorldSize;
+
+                return (tileMinX <= regionMaxX) && (tileMinX + lastPointOffset >= regionMinX) &&
+                    (tileMinY <= regionMaxY) && (tileMinY + lastPointOffset >= regionMinY);
+            });
+    }
+
+    void TerrainHeightCache::Clear()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        m_tiles.clear();
+        ++m_generation;
+    }
+
+    size_t TerrainHeightCache::GetMemoryUsage() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        return m_tiles.size() * GetTileMemorySize();
+    }
+
+    size_t TerrainHeightCache::GetTileCount() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        return m_tiles.size();
+    }
+
+    uint64_t TerrainHeightCache::GetTileKey(int32_t tileX, int32_t tileY)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(tileX)) << 32) | static_cast<uint64_t>(static_cast<uint32_t>(tileY));
+    }
+
+    size_t TerrainHeightCache::GetTileMemorySize()
+    {
+        return sizeof(Tile) + (TileSize * TileSize * (sizeof(float) + sizeof(bool)));
+    }
+
+    AZStd::shared_ptr<const TerrainHeightCache::Tile> TerrainHeightCache::GetOrCreateTile(int32_t tileX, int32_t tileY)
+    {
+        const uint64_t tileKey = GetTileKey(tileX, tileY);
+
+        uint64_t generation = 0;
+        float queryResolution = 0.0f;
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+            if (auto tileIterator = m_tiles.find(tileKey); tileIterator != m_tiles.end())
+            {
+                return tileIterator->second;
+            }
+            generation = m_generation;
+            queryResolution = m_queryResolution;
+        }
+
+        AZ_PROFILE_SCOPE(Terrain, "TerrainHeightCache: GenerateTile");
+
+        // Generate the tile without holding the lock, so other queries can keep reading the cache in the meantime.
+        constexpr size_t PointCount = TileSize * TileSize;
+        AZStd::vector<AZ::Vector3> positions;
+        positions.reserve(PointCount);
+        for (int32_t y = 0; y < TileSize; ++y)
+        {
+            const float worldY = aznumeric_cast<float>((tileY * TileSize) + y) * queryResolution;
+            for (int32_t x = 0; x < TileSize; ++x)
+            {
+                const float worldX = aznumeric_cast<float>((tileX * TileSize) + x) * queryResolution;
+                positions.emplace_back(worldX, worldY, 0.0f);
+            }
+        }
+
+        auto tile = AZStd::make_shared<Tile>();
+        tile->m_terrainExists.resize(PointCount, false);
+        m_generateHeightsCallback(positions, tile->m_terrainExists);
+
+        tile->m_heights.resize_no_construct(PointCount);
+        for (size_t index = 0; index < PointCount; ++index)
+        {
+            tile->m_heights[index] = positions[index].GetZ();
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+        // If tiles were discarded while this one was generated, it might contain stale data, so it's only used for this query.
+        if ((generation == m_generation) && (m_memoryBudget > 0))
+        {
+            auto [tileIterator, inserted] = m_tiles.emplace(tileKey, tile);
+            if (!inserted)
+            {
+                // Another query generated the same tile in the meantime.
+                return tileIterator->second;
+            }
+            EvictTiles();
+        }
+
+        return tile;
+    }
+
+    void TerrainHeightCache::EvictTiles()
+    {
+        const size_t tileMemorySize = GetTileMemorySize();
+        if (m_tiles.size() * tileMemorySize <= m_memoryBudget)
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(Terrain, "TerrainHeightCache: EvictTiles");
+
+        // Evict down to three quarters of the budget, so the eviction doesn't run again on every new tile.
+        const size_t targetTileCount = (m_memoryBudget / tileMemorySize) * 3 / 4;
+
+        AZStd::vector<AZStd::pair<uint64_t, uint64_t>> tilesByLastUse;
+        tilesByLastUse.reserve(m_tiles.size());
+        for (const auto& [tileKey, tile] : m_tiles)
+        {
+            tilesByLastUse.emplace_back(tile->m_lastUsed.load(), tileKey);
+        }
+        AZStd::sort(tilesByLastUse.begin(), tilesByLastUse.end());
+
+        const size_t evictedTileCount = m_tiles.size() - targetTileCount;
+        for (size_t index = 0; index < evictedTileCount; ++index)
+        {
+            m_tiles.erase(tilesByLastUse[index].second);
+        }
+    }
+} // namespace Terrain
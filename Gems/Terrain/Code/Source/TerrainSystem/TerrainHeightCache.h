@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace Terrain
+{
+    //! Caches the heights of the terrain height grid points in square tiles, so that repeated height queries over the same area
+    //! don't evaluate the height gradients of the terrain areas again.
+    //! A tile is generated in a single bulk query the first time a query touches it. Once the memory used by the tiles goes over
+    //! the memory budget, the least recently used tiles are evicted. Tiles overlapping a region are discarded when the region
+    //! is invalidated, and the whole cache is discarded when the query resolution changes.
+    class TerrainHeightCache
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TerrainHeightCache, AZ::SystemAllocator);
+
+        //! Fills in the height (as the Z value) and the existence flag of a list of positions on the height grid.
+        using GenerateHeightsCallback = AZStd::function<void(AZStd::span<AZ::Vector3> positions, AZStd::span<bool> terrainExists)>;
+
+        //! Number of grid points along each side of a tile.
+        static constexpr int32_t TileSize = 64;
+
+        //! Fraction of the query resolution a position can be away from a grid point and still be considered on it.
+        static constexpr float GridTolerance = 0.001f;
+
+        explicit TerrainHeightCache(GenerateHeightsCallback generateHeightsCallback);
+
+        //! Sets the memory budget in bytes, evicting tiles if it's lower than the memory currently used. 0 disables the cache.
+        void SetMemoryBudget(size_t memoryBudget);
+        bool IsEnabled() const;
+
+        //! Sets the distance between grid points, and discards every tile if it changed.
+        void SetQueryResolution(float queryResolution);
+
+        //! Replaces the Z value and existence flag of every position that lies on a grid point with the cached values,
+        //! generating the missing tiles. The indices of the positions that don't lie on a grid point are added to
+        //! outUncachedIndices, and those positions are left untouched.
+        void GetHeights(AZStd::span<AZ::Vector3> positions, AZStd::span<bool> terrainExists, AZStd::vector<size_t>& outUncachedIndices);
+
+        //! Discards the tiles overlapping the region. Z is ignored.
+        void Invalidate(const AZ::Aabb& region);
+
+        //! Discards every tile.
+        void Clear();
+
+        //! Memory used by the tiles in bytes.
+        size_t GetMemoryUsage() const;
+        size_t GetTileCount() const;
+
+    private:
+        struct Tile
+        {
+            AZStd::vector<float> m_heights;
+            AZStd::vector<bool> m_terrainExists;
+            //! Value of the use counter the last time the tile was read, used to evict the least recently used tiles.
+            mutable AZStd::atomic_uint64_t m_lastUsed{ 0 };
+        };
+
+        static uint64_t GetTileKey(int32_t tileX, int32_t tileY);
+        static size_t GetTileMemorySize();
+
+        //! Returns the tile, generating it if it isn't in the cache.
+        AZStd::shared_ptr<const Tile> GetOrCreateTile(int32_t tileX, int32_t tileY);
+
+        //! Evicts the least recently used tiles until the memory usage is under the budget. Requires the unique lock.
+        void EvictTiles();
+
+        GenerateHeightsCallback m_generateHeightsCallback;
+
+        mutable AZStd::shared_mutex m_tileMutex;
+        AZStd::unordered_map<uint64_t, AZStd::shared_ptr<Tile>> m_tiles;
+        float m_queryResolution = 1.0f;
+        size_t m_memoryBudget = 0;
+
+        //! Incremented every time tiles are discarded, so tiles generated from data that changed in the meantime aren't added.
+        uint64_t m_generation = 0;
+
+        AZStd::atomic_uint64_t m_useCounter{ 0 };
+    };
+} // namespace Terrain
@@ -7,6 +7,8 @@
  */
 
 #include <TerrainSystem/TerrainSystem.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/sort.h>
 #include <SurfaceData/SurfaceDataTypes.h>
@@ -25,6 +27,13 @@ using namespace Terrain;
 
 AZ_DEFINE_BUDGET(Terrain);
 
+namespace Terrain
+{
+    AZ_CVAR(uint32_t, cl_terrainHeightCacheMemoryBudgetMB, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Memory budget in megabytes of the cache of terrain heights, used to avoid evaluating the terrain height gradients "
+        "again for areas that were already queried. 0 disables the cache.");
+}
+
 bool TerrainLayerPriorityComparator::operator()(const AZ::EntityId& layer1id, const AZ::EntityId& layer2id) const
 {
     // Comparator for insertion/key lookup.
@@ -56,6 +65,11 @@ bool TerrainLayerPriorityComparator::operator()(const AZ::EntityId& layer1id, co
 
 TerrainSystem::TerrainSystem()
     : m_terrainRaycastContext(*this)
+    , m_heightCache(
+          [this](AZStd::span<AZ::Vector3> positions, AZStd::span<bool> terrainExists)
+          {
+              GetHeightsFromAreas(positions, terrainExists);
+          })
 {
     Terrain::TerrainSystemServiceRequestBus::Handler::BusConnect();
     AZ::TickBus::Handler::BusConnect();
@@ -93,6 +107,8 @@ void TerrainSystem::Activate()
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_areaMutex);
         m_registeredAreas.clear();
     }
+    m_heightCache.Clear();
+    m_terrainRaycastContext.ClearHeightBounds();
 
     AzFramework::Terrain::TerrainDataRequestBus::Handler::BusConnect();
 
@@ -134,6 +150,8 @@ void TerrainSystem::Deactivate()
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_areaMutex);
         m_registeredAreas.clear();
     }
+    m_heightCache.Clear();
+    m_terrainRaycastContext.ClearHeightBounds();
 
     m_dirtyRegion = AZ::Aabb::CreateNull();
     m_terrainDirtyMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All;
@@ -447,41 +465,35 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
 
     GenerateQueryPositions(inPositions, outPositions, queryResolution, sampler);
 
-    auto callback = [this]([[maybe_unused]] const AZStd::span<const AZ::Vector3> inPositions,
-                        AZStd::span<AZ::Vector3> outPositions,
-                        AZStd::span<bool> outTerrainExists,
-                        [[maybe_unused]] AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights,
-                        AZ::EntityId areaId)
-                        {
-                            AZ_Assert((inPositions.size() == outPositions.size() && inPositions.size() == outTerrainExists.size()),
-                                "The sizes of the terrain exists list and in/out positions list should match.");
-                            Terrain::TerrainAreaHeightRequestBus::Event(areaId, &Terrain::TerrainAreaHeightRequestBus::Events::GetHeights,
-                                outPositions, outTerrainExists);
-
-                            // If the area has "use ground plane" checked, make sure any points that fall in the area that didn't
-                            // return data are filled in with the area's minimum height.
-                            const auto& area = m_registeredAreas.find(areaId);
-                            if ((area != m_registeredAreas.end()) && area->second.m_useGroundPlane)
-                            {
-                                const float areaMin = AZStd::clamp(
-                                    area->second.m_areaBounds.GetMin().GetZ(),
-                                    m_currentSettings.m_heightRange.m_min,
-                                    m_currentSettings.m_heightRange.m_max);
+    if (m_heightCache.IsEnabled())
+    {
+        // Fill in the grid aligned positions from the cache, and only query the terrain areas for the remaining ones.
+        AZStd::vector<size_t> uncachedIndices;
+        m_heightCache.GetHeights(outPositions, outTerrainExists, uncachedIndices);
 
-                                for (size_t index = 0; index < outPositions.size(); index++)
-                                {
-                                    if (!outTerrainExists[index])
-                                    {
-                                        outTerrainExists[index] = true;
-                                        outPositions[index].SetZ(areaMin);
-                                    }
-                                }
-                            }
-                        };
+        if (!uncachedIndices.empty())
+        {
+            AZStd::vector<AZ::Vector3> uncachedPositions;
+            AZStd::vector<bool> uncachedTerrainExists(uncachedIndices.size(), false);
+            uncachedPositions.reserve(uncachedIndices.size());
+            for (size_t index : uncachedIndices)
+            {
+                uncachedPositions.emplace_back(outPositions[index]);
+            }
 
-    // This will be unused for heights. It's fine if it's empty.
-    AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights;
-    MakeBulkQueries(outPositions, outPositions, outTerrainExists, outSurfaceWeights, callback);
+            GetHeightsFromAreas(uncachedPositions, uncachedTerrainExists);
+
+            for (size_t uncachedIndex = 0; uncachedIndex < uncachedIndices.size(); uncachedIndex++)
+            {
+                outPositions[uncachedIndices[uncachedIndex]] = uncachedPositions[uncachedIndex];
+                outTerrainExists[uncachedIndices[uncachedIndex]] = uncachedTerrainExists[uncachedIndex];
+            }
+        }
+    }
+    else
+    {
+        GetHeightsFromAreas(outPositions, outTerrainExists);
+    }
 
     // Compute/store the final result
     for (size_t i = 0, iteratorIndex = 0; i < inPositions.size(); i++, iteratorIndex += indexStepSize)
@@ -520,6 +532,60 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
     }
 }
 
+void TerrainSystem::GetHeightsFromAreas(AZStd::span<AZ::Vector3> positions, AZStd::span<bool> terrainExists) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+    if (positions.empty())
+    {
+        return;
+    }
+
+    // Positions that aren't in any terrain area keep the minimum height and don't exist.
+    const float minHeight = m_currentSettings.m_heightRange.m_min;
+    for (size_t index = 0; index < positions.size(); index++)
+    {
+        positions[index].SetZ(minHeight);
+        terrainExists[index] = false;
+    }
+
+    auto callback = [this]([[maybe_unused]] const AZStd::span<const AZ::Vector3> inPositions,
+                    AZStd::span<AZ::Vector3> outPositions,
+                    AZStd::span<bool> outTerrainExists,
+                    [[maybe_unused]] AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights,
+                    AZ::EntityId areaId)
+                    {
+                        AZ_Assert((inPositions.size() == outPositions.size() && inPositions.size() == outTerrainExists.size()),
+                            "The sizes of the terrain exists list and in/out positions list should match.");
+                        Terrain::TerrainAreaHeightRequestBus::Event(areaId, &Terrain::TerrainAreaHeightRequestBus::Events::GetHeights,
+                            outPositions, outTerrainExists);
+
+                        // If the area has "use ground plane" checked, make sure any points that fall in the area that didn't
+                        // return data are filled in with the area's minimum height.
+                        const auto& area = m_registeredAreas.find(areaId);
+                        if ((area != m_registeredAreas.end()) && area->second.m_useGroundPlane)
+                        {
+                            const float areaMin = AZStd::clamp(
+                                area->second.m_areaBounds.GetMin().GetZ(),
+                                m_currentSettings.m_heightRange.m_min,
+                                m_currentSettings.m_heightRange.m_max);
+
+                            for (size_t index = 0; index < outPositions.size(); index++)
+                            {
+                                if (!outTerrainExists[index])
+                                {
+                                    outTerrainExists[index] = true;
+                                    outPositions[index].SetZ(areaMin);
+                                }
+                            }
+                        }
+                    };
+
+    // This will be unused for heights. It's fine if it's empty.
+    AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights;
+    MakeBulkQueries(positions, positions, terrainExists, outSurfaceWeights, callback);
+}
+
 float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, bool* terrainExistsPtr) const
 {
     bool terrainExists = false;
@@ -543,10 +609,10 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
             const AZ::Vector2 pos1 = pos0 + AZ::Vector2(queryResolution);
 
             AZStd::array<bool,4> exists = { false, false, false, false };
-            const AZStd::array<float, 4> queriedHeights = { GetTerrainAreaHeight(pos0.GetX(), pos0.GetY(), exists[0]),
-                                                            GetTerrainAreaHeight(pos1.GetX(), pos0.GetY(), exists[1]),
-                                                            GetTerrainAreaHeight(pos0.GetX(), pos1.GetY(), exists[2]),
-                                                            GetTerrainAreaHeight(pos1.GetX(), pos1.GetY(), exists[3]) };
+            const AZStd::array<float, 4> queriedHeights = { GetGridHeight(pos0.GetX(), pos0.GetY(), exists[0]),
+                                                            GetGridHeight(pos1.GetX(), pos0.GetY(), exists[1]),
+                                                            GetGridHeight(pos0.GetX(), pos1.GetY(), exists[2]),
+                                                            GetGridHeight(pos1.GetX(), pos1.GetY(), exists[3]) };
 
             InterpolateHeights(queriedHeights, exists, normalizedDelta.GetX(), normalizedDelta.GetY(), height, terrainExists);
         }
@@ -558,7 +624,7 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
             AZ::Vector2 clampedPosition;
             RoundPosition(x, y, queryResolution, clampedPosition);
 
-            height = GetTerrainAreaHeight(clampedPosition.GetX(), clampedPosition.GetY(), terrainExists);
+            height = GetGridHeight(clampedPosition.GetX(), clampedPosition.GetY(), terrainExists);
         }
         break;
 
@@ -614,6 +680,24 @@ float TerrainSystem::GetTerrainAreaHeight(float x, float y, bool& terrainExists)
     return height;
 }
 
+float TerrainSystem::GetGridHeight(float x, float y, bool& terrainExists) const
+{
+    if (m_heightCache.IsEnabled())
+    {
+        AZ::Vector3 position(x, y, m_currentSettings.m_heightRange.m_min);
+        bool exists = false;
+        AZStd::vector<size_t> uncachedIndices;
+        m_heightCache.GetHeights(AZStd::span<AZ::Vector3>(&position, 1), AZStd::span<bool>(&exists, 1), uncachedIndices);
+        if (uncachedIndices.empty())
+        {
+            terrainExists = exists;
+            return position.GetZ();
+        }
+    }
+
+    return GetTerrainAreaHeight(x, y, terrainExists);
+}
+
 float TerrainSystem::GetHeight(const AZ::Vector3& position, Sampler sampler, bool* terrainExistsPtr) const
 {
     return GetHeightSynchronous(position.GetX(), position.GetY(), sampler, terrainExistsPtr);
@@ -1102,6 +1186,48 @@ AzFramework::RenderGeometry::RayResult TerrainSystem::GetClosestIntersection(
     return m_terrainRaycastContext.RayIntersect(ray);
 }
 
+void TerrainSystem::GetClosestIntersections(
+    AZStd::span<const AzFramework::RenderGeometry::RayRequest> rays,
+    AZStd::span<AzFramework::RenderGeometry::RayResult> outResults) const
+{
+    AZ_PROFILE_FUNCTION(Terrain);
+
+    if (rays.size() != outResults.size())
+    {
+        AZ_Assert(false, "The sizes of the ray and result lists should match (%zu vs %zu).", rays.size(), outResults.size());
+        return;
+    }
+
+    // Each ray is independent, so large batches are split into jobs that run in parallel.
+    constexpr size_t RaysPerJob = 16;
+    if (rays.size() <= RaysPerJob)
+    {
+        for (size_t index = 0; index < rays.size(); index++)
+        {
+            outResults[index] = m_terrainRaycastContext.RayIntersect(rays[index]);
+        }
+        return;
+    }
+
+    AZ::JobCompletion jobCompletion;
+    for (size_t jobStart = 0; jobStart < rays.size(); jobStart += RaysPerJob)
+    {
+        const size_t jobEnd = AZStd::min(jobStart + RaysPerJob, rays.size());
+        AZ::Job* job = AZ::CreateJobFunction(
+            [this, rays, outResults, jobStart, jobEnd]()
+            {
+                for (size_t index = jobStart; index < jobEnd; index++)
+                {
+                    outResults[index] = m_terrainRaycastContext.RayIntersect(rays[index]);
+                }
+            },
+            true, nullptr);
+        job->SetDependent(&jobCompletion);
+        job->Start();
+    }
+    jobCompletion.StartAndWaitForCompletion();
+}
+
 AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> TerrainSystem::QueryListAsync(
     const AZStd::span<const AZ::Vector3>& inPositions,
     TerrainDataMask requestedData,
@@ -1686,6 +1812,8 @@ void TerrainSystem::RegisterArea(AZ::EntityId areaId)
 
     m_registeredAreas[areaId] = { aabb, useGroundPlane };
     m_dirtyRegion.AddAabb(aabb);
+    m_heightCache.Invalidate(aabb);
+    m_terrainRaycastContext.InvalidateRegion(aabb);
     m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
         AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
     m_cachedAreaBounds.AddAabb(aabb);
@@ -1706,6 +1834,8 @@ void TerrainSystem::UnregisterArea(AZ::EntityId areaId)
             if (areaId == entityId)
             {
                 m_dirtyRegion.AddAabb(areaData.m_areaBounds);
+                m_heightCache.Invalidate(areaData.m_areaBounds);
+                m_terrainRaycastContext.InvalidateRegion(areaData.m_areaBounds);
                 m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
                     AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
 
@@ -1760,6 +1890,8 @@ void TerrainSystem::RefreshRegion(
     const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask)
 {
     m_dirtyRegion.AddAabb(dirtyRegion);
+    m_heightCache.Invalidate(dirtyRegion);
+    m_terrainRaycastContext.InvalidateRegion(dirtyRegion);
 
     // Keep track of which types of data have changed so that we can send out the appropriate notifications later.
     m_terrainDirtyMask |= changeMask;
@@ -1771,6 +1903,8 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
 
     bool terrainSettingsChanged = false;
 
+    m_heightCache.SetMemoryBudget(static_cast<size_t>(static_cast<uint32_t>(cl_terrainHeightCacheMemoryBudgetMB)) * 1024 * 1024);
+
     if ((m_terrainDirtyMask & AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::Settings) ==
         AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::Settings)
     {
@@ -1804,6 +1938,11 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
         }
 
         m_currentSettings = m_requestedSettings;
+
+        // The cached heights depend on the query resolution and the height range.
+        m_heightCache.SetQueryResolution(m_currentSettings.m_heightQueryResolution);
+        m_heightCache.Clear();
+        m_terrainRaycastContext.ClearHeightBounds();
     }
 
     if (terrainSettingsChanged || (m_terrainDirtyMask != AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::None))
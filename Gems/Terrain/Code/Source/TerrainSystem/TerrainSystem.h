@@ -25,6 +25,7 @@
 
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 #include <TerrainRaycast/TerrainRaycastContext.h>
+#include <TerrainSystem/TerrainHeightCache.h>
 #include <TerrainSystem/TerrainSystemBus.h>
 
 AZ_DECLARE_BUDGET(Terrain);
@@ -171,6 +172,9 @@ namespace Terrain
         AzFramework::EntityContextId GetTerrainRaycastEntityContextId() const override;
         AzFramework::RenderGeometry::RayResult GetClosestIntersection(
             const AzFramework::RenderGeometry::RayRequest& ray) const override;
+        void GetClosestIntersections(
+            AZStd::span<const AzFramework::RenderGeometry::RayRequest> rays,
+            AZStd::span<AzFramework::RenderGeometry::RayResult> outResults) const override;
 
         AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> QueryListAsync(
             const AZStd::span<const AZ::Vector3>& inPositions,
@@ -233,6 +237,8 @@ namespace Terrain
             bool* terrainExistsPtr) const;
         float GetHeightSynchronous(float x, float y, Sampler sampler, bool* terrainExistsPtr) const;
         float GetTerrainAreaHeight(float x, float y, bool& terrainExists) const;
+        //! Gets the height at a grid point, from the height cache when it's enabled.
+        float GetGridHeight(float x, float y, bool& terrainExists) const;
         AZ::Vector3 GetNormalSynchronous(const AZ::Vector3& position, Sampler sampler, bool* terrainExistsPtr) const;
 
         typedef AZStd::function<void(
@@ -246,6 +252,8 @@ namespace Terrain
             const AZStd::span<const AZ::Vector3>& inPositions,
             Sampler sampler, AZStd::span<float> heights,
             AZStd::span<bool> terrainExists) const;
+        //! Queries the terrain areas for the heights at the given positions, bypassing the height cache.
+        void GetHeightsFromAreas(AZStd::span<AZ::Vector3> positions, AZStd::span<bool> terrainExists) const;
         void GetNormalsSynchronous(
             const AZStd::span<const AZ::Vector3>& inPositions,
             Sampler sampler, AZStd::span<AZ::Vector3> normals,
@@ -314,6 +322,9 @@ namespace Terrain
 
         mutable TerrainRaycastContext m_terrainRaycastContext;
 
+        // Cached heights of the grid points, enabled when cl_terrainHeightCacheMemoryBudgetMB isn't 0.
+        mutable TerrainHeightCache m_heightCache;
+
         AZ::JobManager* m_terrainJobManager = nullptr;
         mutable AZStd::mutex m_activeTerrainJobContextMutex;
         mutable AZStd::condition_variable m_activeTerrainJobContextMutexConditionVariable;
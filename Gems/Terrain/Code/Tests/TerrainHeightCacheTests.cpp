@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <gtest/gtest.h>
+
+#include <TerrainSystem/TerrainHeightCache.h>
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace UnitTest
+{
+    class TerrainHeightCacheTests
+        : public testing::Test
+    {
+    public:
+        static constexpr float QueryResolution = 0.5f;
+
+        // Generates heights that encode the grid position, and says terrain only exists for positive X values.
+        AZStd::unique_ptr<Terrain::TerrainHeightCache> CreateCache()
+        {
+            auto cache = AZStd::make_unique<Terrain::TerrainHeightCache>(
+                [this](AZStd::span<AZ::Vector3> positions, AZStd::span<bool> terrainExists)
+                {
+                    ++m_generatedTileCount;
+                    for (size_t index = 0; index < positions.size(); ++index)
+                    {
+                        positions[index].SetZ(GetExpectedHeight(positions[index].GetX(), positions[index].GetY()));
+                        terrainExists[index] = positions[index].GetX() >= 0.0f;
+                    }
+                });
+            cache->SetQueryResolution(QueryResolution);
+            cache->SetMemoryBudget(64 * 1024 * 1024);
+            return cache;
+        }
+
+        static float GetExpectedHeight(float x, float y)
+        {
+            return x + (y * 1000.0f);
+        }
+
+        int m_generatedTileCount = 0;
+    };
+
+    TEST_F(TerrainHeightCacheTests, CacheIsDisabledWithoutMemoryBudget)
+    {
+        Terrain::TerrainHeightCache cache([](AZStd::span<AZ::Vector3>, AZStd::span<bool>) {});
+        EXPECT_FALSE(cache.IsEnabled());
+
+        cache.SetMemoryBudget(1024 * 1024);
+        EXPECT_TRUE(cache.IsEnabled());
+    }
+
+    TEST_F(TerrainHeightCacheTests, GridPositionsAreReadFromGeneratedTiles)
+    {
+        auto cache = CreateCache();
+
+        AZStd::vector<AZ::Vector3> positions = { AZ::Vector3(0.0f, 0.0f, 0.0f), AZ::Vector3(1.5f, 2.0f, 0.0f),
+                                                 AZ::Vector3(-3.0f, 4.5f, 0.0f) };
+        AZStd::vector<bool> terrainExists(positions.size(), false);
+        AZStd::vector<size_t> uncachedIndices;
+        cache->GetHeights(positions, terrainExists, uncachedIndices);
+
+        EXPECT_TRUE(uncachedIndices.empty());
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            EXPECT_FLOAT_EQ(positions[index].GetZ(), GetExpectedHeight(positions[index].GetX(), positions[index].GetY()));
+            EXPECT_EQ(terrainExists[index], positions[index].GetX() >= 0.0f);
+        }
+
+        // The negative X position is in a different tile.
+        EXPECT_EQ(m_generatedTileCount, 2);
+        EXPECT_EQ(cache->GetTileCount(), 2);
+
+        // Querying the same positions again doesn't generate any tile.
+        cache->GetHeights(positions, terrainExists, uncachedIndices);
+        EXPECT_EQ(m_generatedTileCount, 2);
+    }
+
+    TEST_F(TerrainHeightCacheTests, PositionsBetweenGridPointsAreNotCached)
+    {
+        auto cache = CreateCache();
+
+        AZStd::vector<AZ::Vector3> positions = { AZ::Vector3(0.25f, 0.0f, 7.0f), AZ::Vector3(1.0f, 1.0f, 0.0f) };
+        AZStd::vector<bool> terrainExists(positions.size(), false);
+        AZStd::vector<size_t> uncachedIndices;
+        cache->GetHeights(positions, terrainExists, uncachedIndices);
+
+        ASSERT_EQ(uncachedIndices.size(), 1);
+        EXPECT_EQ(uncachedIndices[0], 0);
+        EXPECT_FLOAT_EQ(positions[0].GetZ(), 7.0f);
+        EXPECT_FLOAT_EQ(positions[1].GetZ(), GetExpectedHeight(1.0f, 1.0f));
+    }
+
+    TEST_F(TerrainHeightCacheTests, InvalidateDiscardsOverlappingTiles)
+    {
+        auto cache = CreateCache();
+
+        // One tile covers 32 meters at a 0.5 meter resolution, so these positions are in two different tiles.
+        AZStd::vector<AZ::Vector3> positions = { AZ::Vector3(1.0f, 1.0f, 0.0f), AZ::Vector3(40.0f, 1.0f, 0.0f) };
+        AZStd::vector<bool> terrainExists(positions.size(), false);
+        AZStd::vector<size_t> uncachedIndices;
+        cache->GetHeights(positions, terrainExists, uncachedIndices);
+        EXPECT_EQ(cache->GetTileCount(), 2);
+
+        cache->Invalidate(AZ::Aabb::CreateFromMinMaxValues(0.0f, 0.0f, 0.0f, 2.0f, 2.0f, 0.0f));
+        EXPECT_EQ(cache->GetTileCount(), 1);
+
+        cache->GetHeights(positions, terrainExists, uncachedIndices);
+        EXPECT_EQ(m_generatedTileCount, 3);
+
+        cache->SetQueryResolution(1.0f);
+        EXPECT_EQ(cache->GetTileCount(), 0);
+    }
+
+    TEST_F(TerrainHeightCacheTests, LeastRecentlyUsedTilesAreEvictedOverBudget)
+    {
+        auto cache = CreateCache();
+
+        AZStd::vector<AZ::Vector3> positions;
+        for (int tile = 0; tile < 8; ++tile)
+        {
+            positions.emplace_back(tile * 32.0f, 0.0f, 0.0f);
+        }
+        AZStd::vector<bool> terrainExists(positions.size(), false);
+        AZStd::vector<size_t> uncachedIndices;
+        cache->GetHeights(positions, terrainExists, uncachedIndices);
+        EXPECT_EQ(cache->GetTileCount(), 8);
+
+        const size_t tileMemorySize = cache->GetMemoryUsage() / 8;
+        cache->SetMemoryBudget(tileMemorySize * 4);
+        EXPECT_LE(cache->GetMemoryUsage(), tileMemorySize * 4);
+
+        // The last queried tile is the most recently used one, so it's still cached.
+        AZStd::vector<AZ::Vector3> lastPosition = { positions.back() };
+        AZStd::vector<bool> lastTerrainExists(1, false);
+        const int generatedTileCount = m_generatedTileCount;
+        cache->GetHeights(lastPosition, lastTerrainExists, uncachedIndices);
+        EXPECT_EQ(m_generatedTileCount, generatedTileCount);
+        EXPECT_FLOAT_EQ(lastPosition[0].GetZ(), GetExpectedHeight(positions.back().GetX(), 0.0f));
+    }
+}
@@ -1480,6 +1480,50 @@ namespace UnitTest
         EXPECT_EQ(numFailures, 0);
     }
 
+    TEST_F(TerrainSystemTest, TerrainGetClosestIntersectionsMatchesGetClosestIntersection)
+    {
+        // Create a Terrain Spawner with a box from (-200, -200, 0) to (200, 200, 50) with a sloped height, so that the raycast
+        // height bounds vary from block to block.
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-200.0f, -200.0f, 0.0f, 200.0f, 200.0f, 50.0f);
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(25.0f + ((position.GetX() + position.GetY()) / 16.0f));
+                terrainExists = true;
+            });
+
+        constexpr unsigned int Seed = 1;
+        std::mt19937_64 rng(Seed);
+        std::uniform_real_distribution<float> unif(-100.0f, 100.0f);
+
+        auto terrainSystem = CreateAndActivateTerrainSystem(0.5f);
+
+        // Mix rays that go through the terrain with rays that stay above it, so that both hits and misses get compared.
+        constexpr size_t NumRays = 200;
+        AZStd::vector<AzFramework::RenderGeometry::RayRequest> rays(NumRays);
+        for (size_t test = 0; test < NumRays; test++)
+        {
+            const float endHeight = (test % 2) ? -1.0f : 49.0f;
+            rays[test].m_startWorldPosition = AZ::Vector3(unif(rng), unif(rng), 60.0f);
+            rays[test].m_endWorldPosition = AZ::Vector3(unif(rng), unif(rng), endHeight);
+        }
+
+        AZStd::vector<AzFramework::RenderGeometry::RayResult> results(NumRays);
+        terrainSystem->GetClosestIntersections(rays, results);
+
+        for (size_t test = 0; test < NumRays; test++)
+        {
+            auto expectedResult = terrainSystem->GetClosestIntersection(rays[test]);
+            EXPECT_EQ(static_cast<bool>(results[test]), static_cast<bool>(expectedResult));
+            if (expectedResult)
+            {
+                EXPECT_THAT(results[test].m_worldPosition, IsClose(expectedResult.m_worldPosition));
+                EXPECT_THAT(results[test].m_worldNormal, IsClose(expectedResult.m_worldNormal));
+            }
+        }
+    }
+
     TEST_F(TerrainSystemTest, TerrainProcessAsyncCancellation)
     {
         // Tests cancellation of the asynchronous terrain API.
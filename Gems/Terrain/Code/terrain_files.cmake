@@ -58,6 +58,8 @@ set(FILES
     Source/TerrainRenderer/TerrainMacroMaterialBus.h
     Source/TerrainRenderer/Vector2i.cpp
     Source/TerrainRenderer/Vector2i.h
+    Source/TerrainSystem/TerrainHeightCache.cpp
+    Source/TerrainSystem/TerrainHeightCache.h
     Source/TerrainSystem/TerrainSystem.cpp
     Source/TerrainSystem/TerrainSystem.h
     Source/TerrainSystem/TerrainSystemBus.h
@@ -9,11 +9,12 @@
 #pragma once
 
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/std/containers/span.h>
+#include <Vegetation/InstanceData.h>
 
 namespace Vegetation
 {
     struct Descriptor;
-    struct InstanceData;
 
     //stages determine the order of execution of filter requests
     enum class FilterStage : AZ::u8
@@ -34,6 +35,24 @@ namespace Vegetation
 
         virtual bool Evaluate(const InstanceData& instanceData) const = 0;
 
+        //! Evaluates a batch of instances, clearing the accepted flag of every instance the filter rejects.
+        //! Instances that are already rejected aren't evaluated again.
+        virtual void EvaluateBatch(AZStd::span<const InstanceData> instances, AZStd::span<bool> accepted) const
+        {
+            AZ_Assert(instances.size() == accepted.size(), "The sizes of the instance list and accepted list should match.");
+            for (size_t index = 0; index < instances.size(); ++index)
+            {
+                if (accepted[index])
+                {
+                    accepted[index] = Evaluate(instances[index]);
+                }
+            }
+        }
+
+        //! Returns true if the result depends on the instances placed so far, in which case instances
+        //! have to be evaluated one at a time instead of in batches.
+        virtual bool DependsOnPlacedInstances() const { return false; }
+
         virtual void SetFilterStage(FilterStage filterStage) = 0;
 
         virtual FilterStage GetFilterStage() const { return FilterStage::Default; };
@@ -10,11 +10,12 @@
 
 #include <AzCore/Component/ComponentBus.h>
 #include <AzCore/EBus/Policies.h>
+#include <AzCore/std/containers/span.h>
+#include <Vegetation/InstanceData.h>
 
 namespace Vegetation
 {
     struct Descriptor;
-    struct InstanceData;
 
     //stages determine the order of execution of modifier requests
     //currently used to ensure that positional modifiers occur first since surface related modifiers rely on a final position
@@ -48,6 +49,15 @@ namespace Vegetation
 
         virtual void Execute(InstanceData& instanceData) const = 0;
 
+        //! Modifies a batch of instances. Modifiers that sample gradients override this to sample them all at once.
+        virtual void ExecuteBatch(AZStd::span<InstanceData> instances) const
+        {
+            for (InstanceData& instanceData : instances)
+            {
+                Execute(instanceData);
+            }
+        }
+
         virtual ModifierStage GetModifierStage() const { return ModifierStage::Standard; };
     };
 
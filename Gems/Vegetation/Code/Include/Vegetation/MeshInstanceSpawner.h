@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Vegetation/InstanceSpawner.h>
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <Atom/Feature/Mesh/MeshFeatureProcessorInterface.h>
+#include <Atom/RPI.Reflect/Material/MaterialAsset.h>
+#include <Atom/RPI.Reflect/Model/ModelAsset.h>
+
+namespace Vegetation
+{
+    /**
+    * Instance spawner of meshes rendered directly by the mesh feature processor.
+    * Instances don't have entities or components, each one only owns a mesh handle. Instances that share the same model and
+    * material are merged into instanced draws by the mesh feature processor when r_meshInstancingEnabled is set.
+    */
+    class MeshInstanceSpawner
+        : public InstanceSpawner
+        , private AZ::Data::AssetBus::MultiHandler
+    {
+    public:
+        AZ_RTTI(MeshInstanceSpawner, "{5B3E7A61-9C2D-4F84-8E1A-3D6F0B27C495}", InstanceSpawner);
+        AZ_CLASS_ALLOCATOR(MeshInstanceSpawner, AZ::SystemAllocator);
+        static void Reflect(AZ::ReflectContext* context);
+
+        MeshInstanceSpawner();
+        virtual ~MeshInstanceSpawner();
+
+        //! Start loading any assets that the spawner will need.
+        void LoadAssets() override;
+
+        //! Unload any assets that the spawner loaded.
+        void UnloadAssets() override;
+
+        //! Perform any extra initialization needed at the point of registering with the vegetation system.
+        void OnRegisterUniqueDescriptor() override;
+
+        //! Perform any extra cleanup needed at the point of unregistering with the vegetation system.
+        void OnReleaseUniqueDescriptor() override;
+
+        //! Does this exist but have empty asset references?
+        bool HasEmptyAssetReferences() const override;
+
+        //! Has this finished loading any assets that are needed?
+        bool IsLoaded() const override;
+
+        //! Are the assets loaded, initialized, and spawnable?
+        bool IsSpawnable() const override;
+
+        //! Does this spawner have the capability to provide radius data?
+        bool HasRadiusData() const override { return true; }
+
+        //! Radius of the instances that will be spawned, used by the Distance Between filter.
+        float GetRadius() const override;
+
+        //! Display name of the instances that will be spawned.
+        AZStd::string GetName() const override;
+
+        //! Create a single instance.
+        InstancePtr CreateInstance(const InstanceData& instanceData) override;
+
+        //! Destroy a single instance.
+        void DestroyInstance(InstanceId id, InstancePtr instance) override;
+
+        AZStd::string GetModelAssetPath() const;
+        void SetModelAssetPath(const AZStd::string& assetPath);
+
+        AZ::Data::AssetId GetModelAssetId() const;
+        void SetModelAssetId(const AZ::Data::AssetId& assetId);
+
+        AZ::Data::AssetId GetMaterialAssetId() const;
+        void SetMaterialAssetId(const AZ::Data::AssetId& assetId);
+
+    private:
+        //! Opaque instance data handed to the vegetation system.
+        struct MeshInstance
+        {
+            AZ_CLASS_ALLOCATOR(MeshInstance, AZ::SystemAllocator);
+
+            AZ::Render::MeshFeatureProcessorInterface* m_featureProcessor = nullptr;
+            AZ::Render::MeshFeatureProcessorInterface::MeshHandle m_meshHandle;
+        };
+
+        bool DataIsEquivalent(const InstanceSpawner& rhs) const override;
+
+        //////////////////////////////////////////////////////////////////////////
+        // AZ::Data::AssetBus::Handler
+        void OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset) override;
+        void OnAssetReloaded(AZ::Data::Asset<AZ::Data::AssetData> asset) override;
+
+        AZ::u32 AssetChanged();
+        void ResetAssets();
+
+        void UpdateCachedValues();
+
+        //! Release the mesh handle of an instance, leaving the instance itself to be deleted by DestroyInstance.
+        void ReleaseMeshInstance(MeshInstance* meshInstance);
+
+        //! Cached values so that assets aren't accessed on other threads
+        bool m_assetsLoadedAndSpawnable = false;
+        float m_radius = 0.0f;
+
+        //! Material created from the material asset, shared by all the instances.
+        AZ::Data::Instance<AZ::RPI::Material> m_material;
+
+        //! Collection of created instances, needed for releasing their meshes when the assets unload.
+        AZStd::unordered_set<MeshInstance*> m_meshInstances;
+
+        //! asset data
+        AZ::Data::Asset<AZ::RPI::ModelAsset> m_modelAsset;
+        AZ::Data::Asset<AZ::RPI::MaterialAsset> m_materialAsset;
+
+        //! Ray tracing is off by default, since dense foliage adds a lot of geometry to the ray tracing scene.
+        bool m_rayTracingEnabled = false;
+    };
+
+} // namespace Vegetation
@@ -22,6 +22,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/sort.h>
@@ -143,6 +144,8 @@ namespace Vegetation
                 ->Field("ThreadProcessingIntervalMs", &AreaSystemConfig::m_threadProcessingIntervalMs)
                 ->Field("SectorSearchPadding", &AreaSystemConfig::m_sectorSearchPadding)
                 ->Field("SectorPointSnapMode", &AreaSystemConfig::m_sectorPointSnapMode)
+                ->Field("SectorPointBatchSize", &AreaSystemConfig::m_sectorPointBatchSize)
+                ->Field("SectorPointCacheSize", &AreaSystemConfig::m_sectorPointCacheSize)
             ;
 
             AZ::EditContext* edit = serialize->GetEditContext();
@@ -173,6 +176,12 @@ namespace Vegetation
                     ->DataElement(AZ::Edit::UIHandlers::ComboBox, &AreaSystemConfig::m_sectorPointSnapMode, "Sector Point Snap Mode", "Controls whether vegetation placement points are located at the corner or the center of the cell.")
                     ->EnumAttribute(SnapMode::Corner, "Corner")
                     ->EnumAttribute(SnapMode::Center, "Center")
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &AreaSystemConfig::m_sectorPointBatchSize, "Sector Point Batch Size", "The number of sectors whose placement points are gathered in parallel before they're filled.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 1)
+                    ->Attribute(AZ::Edit::Attributes::Max, 64)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &AreaSystemConfig::m_sectorPointCacheSize, "Sector Point Cache Size", "The number of sectors outside of the view area whose placement points are kept, so they aren't gathered again when the sectors come back into view. 0 disables the cache.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0)
+                    ->Attribute(AZ::Edit::Attributes::Max, 1024)
                 ;
             }
         }
@@ -186,6 +195,8 @@ namespace Vegetation
                 ->Property("sectorDensity", BehaviorValueProperty(&AreaSystemConfig::m_sectorDensity))
                 ->Property("sectorSizeInMeters", BehaviorValueProperty(&AreaSystemConfig::m_sectorSizeInMeters))
                 ->Property("threadProcessingIntervalMs", BehaviorValueProperty(&AreaSystemConfig::m_threadProcessingIntervalMs))
+                ->Property("sectorPointBatchSize", BehaviorValueProperty(&AreaSystemConfig::m_sectorPointBatchSize))
+                ->Property("sectorPointCacheSize", BehaviorValueProperty(&AreaSystemConfig::m_sectorPointCacheSize))
                 ->Property("sectorPointSnapMode",
                 [](AreaSystemConfig* config) { return static_cast<AZ::u8>(config->m_sectorPointSnapMode); },
                 [](AreaSystemConfig* config, const AZ::u8& i) { config->m_sectorPointSnapMode = static_cast<SnapMode>(i); })
@@ -561,6 +572,7 @@ namespace Vegetation
                                              cachedMainThreadData.m_worldToSector, cachedMainThreadData.m_currViewRect);
                 vegTasks->MarkDirtySectors(AZ::Aabb::CreateNull(), threadData->m_dirtySectorSurfacePoints,
                                              cachedMainThreadData.m_worldToSector, cachedMainThreadData.m_currViewRect);
+                vegTasks->InvalidateCachedSectorPoints(AZ::Aabb::CreateNull());
             });
     }
 
@@ -613,6 +625,10 @@ namespace Vegetation
                 cachedMainThreadData.m_worldToSector, cachedMainThreadData.m_currViewRect);
             vegTasks->MarkDirtySectors(newBounds, threadData->m_dirtySectorSurfacePoints,
                 cachedMainThreadData.m_worldToSector, cachedMainThreadData.m_currViewRect);
+
+            // Sectors outside of the view area can't be marked dirty, so their cached points get discarded instead.
+            vegTasks->InvalidateCachedSectorPoints(oldBounds);
+            vegTasks->InvalidateCachedSectorPoints(newBounds);
         });
     }
 
@@ -779,6 +795,8 @@ namespace Vegetation
                     m_cachedMainThreadData.m_sectorSizeInMeters = m_configuration.m_sectorSizeInMeters;
                     m_cachedMainThreadData.m_sectorDensity = m_configuration.m_sectorDensity;
                     m_cachedMainThreadData.m_sectorPointSnapMode = m_configuration.m_sectorPointSnapMode;
+                    m_cachedMainThreadData.m_sectorPointBatchSize = m_configuration.m_sectorPointBatchSize;
+                    m_cachedMainThreadData.m_sectorPointCacheSize = m_configuration.m_sectorPointCacheSize;
                 }
 
                 // Set the state to Dirty to signal the thread that it will need to pull a new copy of the main thread state data
@@ -1082,6 +1100,13 @@ namespace Vegetation
         sectorInfo.m_bounds = GetSectorBounds(sectorId, sectorSizeInMeters);
         UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
 
+        return AddSector(AZStd::move(sectorInfo));
+    }
+
+    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::AddSector(SectorInfo&& sectorInfo)
+    {
+        VEGETATION_PROFILE_FUNCTION_VERBOSE
+
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
         SectorInfo& sectorInfoRef = m_sectorRollingWindow[sectorInfo.m_id] = AZStd::move(sectorInfo);
         UpdateSectorCallbacks(sectorInfoRef);
@@ -1183,7 +1208,7 @@ namespace Vegetation
         };
     }
 
-    void AreaSystemComponent::VegetationThreadTasks::DeleteSector(const SectorId& sectorId)
+    void AreaSystemComponent::VegetationThreadTasks::DeleteSector(const SectorId& sectorId, int sectorPointCacheSize)
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
@@ -1193,6 +1218,10 @@ namespace Vegetation
         {
             SectorInfo& sectorInfo(itSector->second);
             EmptySector(sectorInfo);
+            if (sectorPointCacheSize > 0)
+            {
+                CacheSectorPoints(sectorInfo, sectorPointCacheSize);
+            }
             m_sectorRollingWindow.erase(itSector);
         }
         else
@@ -1390,6 +1419,71 @@ namespace Vegetation
 
         // Clear any pending unregistrations; since all of the sectors have been cleared anyways, these don't affect anything
         m_unregisteredVegetationAreaSet.clear();
+
+        // The sector settings might be changing, so the cached points of deleted sectors can't be reused either.
+        InvalidateCachedSectorPoints(AZ::Aabb::CreateNull());
+    }
+
+    void AreaSystemComponent::VegetationThreadTasks::CacheSectorPoints(SectorInfo& sectorInfo, int sectorPointCacheSize)
+    {
+        VEGETATION_PROFILE_FUNCTION_VERBOSE
+
+        AZStd::lock_guard<decltype(m_sectorPointCacheMutex)> lock(m_sectorPointCacheMutex);
+
+        CachedSectorPoints& cachedPoints = m_sectorPointCache[sectorInfo.m_id];
+        cachedPoints.m_bounds = sectorInfo.m_bounds;
+        cachedPoints.m_masks = AZStd::move(sectorInfo.m_baseContext.m_masks);
+        cachedPoints.m_availablePoints = AZStd::move(sectorInfo.m_baseContext.m_availablePoints);
+        cachedPoints.m_cachedOrder = ++m_sectorPointCacheCounter;
+
+        // Sectors are deleted one at a time, so this only ever evicts a single sector unless the cache size was lowered.
+        while (m_sectorPointCache.size() > aznumeric_cast<size_t>(sectorPointCacheSize))
+        {
+            auto oldestEntry = m_sectorPointCache.begin();
+            for (auto itEntry = m_sectorPointCache.begin(); itEntry != m_sectorPointCache.end(); ++itEntry)
+            {
+                if (itEntry->second.m_cachedOrder < oldestEntry->second.m_cachedOrder)
+                {
+                    oldestEntry = itEntry;
+                }
+            }
+            m_sectorPointCache.erase(oldestEntry);
+        }
+    }
+
+    bool AreaSystemComponent::VegetationThreadTasks::TakeCachedSectorPoints(SectorInfo& sectorInfo)
+    {
+        VEGETATION_PROFILE_FUNCTION_VERBOSE
+
+        AZStd::lock_guard<decltype(m_sectorPointCacheMutex)> lock(m_sectorPointCacheMutex);
+
+        auto itCachedPoints = m_sectorPointCache.find(sectorInfo.m_id);
+        if (itCachedPoints == m_sectorPointCache.end())
+        {
+            return false;
+        }
+
+        sectorInfo.m_baseContext.m_masks = AZStd::move(itCachedPoints->second.m_masks);
+        sectorInfo.m_baseContext.m_availablePoints = AZStd::move(itCachedPoints->second.m_availablePoints);
+        m_sectorPointCache.erase(itCachedPoints);
+        return true;
+    }
+
+    void AreaSystemComponent::VegetationThreadTasks::InvalidateCachedSectorPoints(const AZ::Aabb& bounds)
+    {
+        AZStd::lock_guard<decltype(m_sectorPointCacheMutex)> lock(m_sectorPointCacheMutex);
+
+        if (!bounds.IsValid())
+        {
+            m_sectorPointCache.clear();
+            return;
+        }
+
+        AZStd::erase_if(m_sectorPointCache,
+            [&bounds](const auto& cachedPoints)
+            {
+                return cachedPoints.second.m_bounds.Overlaps(bounds);
+            });
     }
 
     void AreaSystemComponent::VegetationThreadTasks::CreateClaim(SectorInfo& sectorInfo, const ClaimHandle handle, const InstanceData& instanceData)
@@ -1770,7 +1864,7 @@ namespace Vegetation
 
             if ((vegTasks->m_sectorRollingWindow.size() > m_viewRectSectorCount) || m_updateWorkList.empty())
             {
-                vegTasks->DeleteSector(m_deleteWorkList.back());
+                vegTasks->DeleteSector(m_deleteWorkList.back(), m_cachedMainThreadData.m_sectorPointCacheSize);
                 m_deleteWorkList.pop_back();
                 return true;
             }
@@ -1779,25 +1873,67 @@ namespace Vegetation
         // Create / update if there's anything to do and we didn't prioritize a delete.
         if (!m_updateWorkList.empty())
         {
-            auto& updateEntry = m_updateWorkList.back();
-            SectorId sectorId = updateEntry.first;
-            UpdateMode mode = updateEntry.second;
-            m_updateWorkList.pop_back();
-
+            auto& sectorDensity = m_cachedMainThreadData.m_sectorDensity;
+            auto& sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
+            auto& sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
+
+            // Pull the next batch of sectors off the end of the work list, closest first.
+            const size_t batchSize =
+                AZStd::min(aznumeric_cast<size_t>(AZStd::max(m_cachedMainThreadData.m_sectorPointBatchSize, 1)), m_updateWorkList.size());
+            AZStd::vector<AZStd::pair<SectorId, UpdateMode>> updateBatch(m_updateWorkList.rbegin(), m_updateWorkList.rbegin() + batchSize);
+            m_updateWorkList.resize(m_updateWorkList.size() - batchSize);
+
+            // Gathering the surface points is usually the most expensive part of creating or rebuilding a sector, and it only
+            // reads surface data, so the points of the whole batch are gathered in parallel without holding the rolling window lock.
+            // The sectors are still filled one at a time in priority order below, since areas only connect to their buses for the
+            // duration of a fill.
+            AZStd::vector<SectorInfo> gatheredSectors(updateBatch.size());
             {
-                AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
+                AZ_PROFILE_SCOPE(Entity, "Vegetation::AreaSystemComponent::UpdateContext::GatherSectorPoints");
 
-                auto& sectorDensity = m_cachedMainThreadData.m_sectorDensity;
-                auto& sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
-                auto& sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
+                AZ::JobCompletion jobCompletion;
+                for (size_t batchIndex = 0; batchIndex < updateBatch.size(); ++batchIndex)
+                {
+                    if (updateBatch[batchIndex].second == UpdateMode::Fill)
+                    {
+                        continue;
+                    }
+
+                    SectorInfo& sectorInfo = gatheredSectors[batchIndex];
+                    sectorInfo.m_id = updateBatch[batchIndex].first;
+                    sectorInfo.m_bounds = VegetationThreadTasks::GetSectorBounds(sectorInfo.m_id, sectorSizeInMeters);
+
+                    // Sectors that scrolled out of view and back in again can reuse the points gathered the last time.
+                    if ((updateBatch[batchIndex].second == UpdateMode::Create) && vegTasks->TakeCachedSectorPoints(sectorInfo))
+                    {
+                        continue;
+                    }
+
+                    auto job = AZ::CreateJobFunction([vegTasks, &sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode]()
+                    {
+                        vegTasks->UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                    }, true);
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
+                }
+                jobCompletion.StartAndWaitForCompletion();
+            }
+
+            AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
+
+            for (size_t batchIndex = 0; batchIndex < updateBatch.size(); ++batchIndex)
+            {
+                const SectorId& sectorId = updateBatch[batchIndex].first;
 
-                switch (mode)
+                switch (updateBatch[batchIndex].second)
                 {
                     case UpdateMode::RebuildSurfaceCacheAndFill:
                     {
                         auto sectorInfo = vegTasks->GetSector(sectorId);
                         AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
-                        vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        sectorInfo->m_baseContext.m_masks = AZStd::move(gatheredSectors[batchIndex].m_baseContext.m_masks);
+                        sectorInfo->m_baseContext.m_availablePoints =
+                            AZStd::move(gatheredSectors[batchIndex].m_baseContext.m_availablePoints);
                         vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
                     }
                     break;
@@ -1813,7 +1949,7 @@ namespace Vegetation
                     case UpdateMode::Create:
                     {
                         AZ_Assert(!vegTasks->GetSector(sectorId), "Sector update mode is 'Create' but sector already exists");
-                        auto sectorInfo = vegTasks->CreateSector(sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        auto sectorInfo = vegTasks->AddSector(AZStd::move(gatheredSectors[batchIndex]));
                         vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
                     }
                     break;
@@ -49,7 +49,9 @@ namespace Vegetation
                    && m_sectorSizeInMeters == other.m_sectorSizeInMeters
                    && m_threadProcessingIntervalMs == other.m_threadProcessingIntervalMs
                    && m_sectorSearchPadding == other.m_sectorSearchPadding
-                   && m_sectorPointSnapMode == other.m_sectorPointSnapMode;
+                   && m_sectorPointSnapMode == other.m_sectorPointSnapMode
+                   && m_sectorPointBatchSize == other.m_sectorPointBatchSize
+                   && m_sectorPointCacheSize == other.m_sectorPointCacheSize;
         }
 
         int m_viewRectangleSize = 13;
@@ -58,6 +60,8 @@ namespace Vegetation
         int m_threadProcessingIntervalMs = 500;
         int m_sectorSearchPadding = 0;
         SnapMode m_sectorPointSnapMode = SnapMode::Corner;
+        int m_sectorPointBatchSize = 4;
+        int m_sectorPointCacheSize = 0;
     private:
         static const int s_maxViewRectangleSize;
         static const int s_maxSectorDensity;
@@ -271,6 +275,8 @@ namespace Vegetation
             int m_sectorSizeInMeters = 0;
             int m_sectorDensity = 0;
             SnapMode m_sectorPointSnapMode = SnapMode::Corner;
+            int m_sectorPointBatchSize = 1;
+            int m_sectorPointCacheSize = 0;
         };
 
         // VegetationThreadTasks is the task queue that's used equally by the main thread and the vegetation thread.
@@ -292,11 +298,18 @@ namespace Vegetation
             SectorInfo* GetSector(const SectorId& sectorId);
 
             SectorInfo* CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
+            //! Adds a sector whose points have already been gathered to the rolling window.
+            SectorInfo* AddSector(SectorInfo&& sectorInfo);
             void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
             void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas);
-            void DeleteSector(const SectorId& sectorId);
+            void DeleteSector(const SectorId& sectorId, int sectorPointCacheSize);
             void ClearSectors();
 
+            //! Moves the surface points of a recently deleted sector back into the sector. Returns false if they aren't cached.
+            bool TakeCachedSectorPoints(SectorInfo& sectorInfo);
+            //! Discards the cached surface points of the deleted sectors overlapping the bounds, or all of them if the bounds are invalid.
+            void InvalidateCachedSectorPoints(const AZ::Aabb& bounds);
+
             //! Gets the AABB for a sector
             static AZ::Aabb GetSectorBounds(const SectorId& sectorId, int sectorSizeInMeters);
 
@@ -323,6 +336,9 @@ namespace Vegetation
 
             static void EmptySector(SectorInfo& sectorInfo);
 
+            //! Keeps the surface points of a deleted sector, evicting the least recently deleted sectors over the cache size.
+            void CacheSectorPoints(SectorInfo& sectorInfo, int sectorPointCacheSize);
+
             // Calls the given function on each sector in the box
             template<class Fn>
             static void EnumerateSectorsInAabb(const AZ::Aabb& bounds, float worldToSector, const ViewRect& viewRect, Fn&& fn);
@@ -334,6 +350,19 @@ namespace Vegetation
             using VegetationThreadTaskList = AZStd::list<AZStd::function<void(UpdateContext* context, PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)>>;
             VegetationThreadTaskList m_vegetationThreadTasks;
 
+            //! Surface points of recently deleted sectors, so that sectors scrolling back into view don't query the surface
+            //! data again.
+            struct CachedSectorPoints
+            {
+                AZ::Aabb m_bounds = AZ::Aabb::CreateNull();
+                SurfaceData::SurfaceTagWeights m_masks;
+                AZStd::vector<ClaimPoint> m_availablePoints;
+                AZ::u64 m_cachedOrder = 0;
+            };
+            mutable AZStd::recursive_mutex m_sectorPointCacheMutex;
+            AZStd::unordered_map<SectorId, CachedSectorPoints> m_sectorPointCache;
+            AZ::u64 m_sectorPointCacheCounter = 0;
+
             //! Map from sectors to areas affecting that sector which have been unregistered and need to have their claims released
             //! Note: This is only updated from the vegetation thread when processing vegetation tasks.
             UnregisteredVegetationAreaMap m_unregisteredVegetationAreaSet;
@@ -216,6 +216,12 @@ namespace Vegetation
         return !intersects;
     }
 
+    bool DistanceBetweenFilterComponent::DependsOnPlacedInstances() const
+    {
+        // Each instance is tested against the instances placed before it, so the claim order matters.
+        return true;
+    }
+
     FilterStage DistanceBetweenFilterComponent::GetFilterStage() const
     {
         return FilterStage::PostProcess;
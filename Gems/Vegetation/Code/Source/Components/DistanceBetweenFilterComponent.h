@@ -69,6 +69,7 @@ namespace Vegetation
         //////////////////////////////////////////////////////////////////////////
         // VegetationFilterRequestBus
         bool Evaluate(const InstanceData& instanceData) const override;
+        bool DependsOnPlacedInstances() const override;
         FilterStage GetFilterStage() const override;
         void SetFilterStage(FilterStage filterStage) override;
 
@@ -201,6 +201,39 @@ namespace Vegetation
         return result;
     }
 
+    void DistributionFilterComponent::EvaluateBatch(AZStd::span<const InstanceData> instances, AZStd::span<bool> accepted) const
+    {
+        VEGETATION_PROFILE_FUNCTION_VERBOSE
+
+        AZ_Assert(instances.size() == accepted.size(), "The sizes of the instance list and accepted list should match.");
+
+        // Sample the gradient for all the instances that are still accepted in a single query.
+        AZStd::vector<size_t> indices;
+        AZStd::vector<AZ::Vector3> positions;
+        indices.reserve(instances.size());
+        positions.reserve(instances.size());
+        for (size_t index = 0; index < instances.size(); ++index)
+        {
+            if (accepted[index])
+            {
+                indices.push_back(index);
+                positions.push_back(instances[index].m_position);
+            }
+        }
+
+        AZStd::vector<float> noise(positions.size());
+        m_configuration.m_gradientSampler.GetValues(positions, noise);
+
+        for (size_t noiseIndex = 0; noiseIndex < noise.size(); ++noiseIndex)
+        {
+            if ((noise[noiseIndex] < m_configuration.m_thresholdMin) || (noise[noiseIndex] > m_configuration.m_thresholdMax))
+            {
+                accepted[indices[noiseIndex]] = false;
+                VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FilterInstance, instances[indices[noiseIndex]].m_id, AZStd::string_view("DistributionFilter")));
+            }
+        }
+    }
+
     FilterStage DistributionFilterComponent::GetFilterStage() const
     {
         return m_configuration.m_filterStage;
@@ -85,6 +85,7 @@ namespace Vegetation
         //////////////////////////////////////////////////////////////////////////
         // VegetationModifierRequestBus
         void Execute(InstanceData& instanceData) const override;
+        void ExecuteBatch(AZStd::span<InstanceData> instances) const override;
         ModifierStage GetModifierStage() const override;
 
     protected:
@@ -105,6 +106,8 @@ namespace Vegetation
         void AddTag(AZStd::string tag) override;
 
     private:
+        void ApplyOffset(InstanceData& instanceData, const AZ::Vector3& factors) const;
+
         PositionModifierConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
 
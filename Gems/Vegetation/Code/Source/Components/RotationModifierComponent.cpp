@@ -242,9 +242,42 @@ namespace Vegetation
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
         const GradientSignal::GradientSampleParams sampleParams(instanceData.m_position);
-        float factorX = m_configuration.m_gradientSamplerX.GetValue(sampleParams);
-        float factorY = m_configuration.m_gradientSamplerY.GetValue(sampleParams);
-        float factorZ = m_configuration.m_gradientSamplerZ.GetValue(sampleParams);
+        const AZ::Vector3 factors(
+            m_configuration.m_gradientSamplerX.GetValue(sampleParams),
+            m_configuration.m_gradientSamplerY.GetValue(sampleParams),
+            m_configuration.m_gradientSamplerZ.GetValue(sampleParams));
+        ApplyRotation(instanceData, factors);
+    }
+
+    void RotationModifierComponent::ExecuteBatch(AZStd::span<InstanceData> instances) const
+    {
+        VEGETATION_PROFILE_FUNCTION_VERBOSE
+
+        AZStd::vector<AZ::Vector3> positions;
+        positions.reserve(instances.size());
+        for (const InstanceData& instanceData : instances)
+        {
+            positions.push_back(instanceData.m_position);
+        }
+
+        AZStd::vector<float> factorsX(instances.size());
+        AZStd::vector<float> factorsY(instances.size());
+        AZStd::vector<float> factorsZ(instances.size());
+        m_configuration.m_gradientSamplerX.GetValues(positions, factorsX);
+        m_configuration.m_gradientSamplerY.GetValues(positions, factorsY);
+        m_configuration.m_gradientSamplerZ.GetValues(positions, factorsZ);
+
+        for (size_t index = 0; index < instances.size(); ++index)
+        {
+            ApplyRotation(instances[index], AZ::Vector3(factorsX[index], factorsY[index], factorsZ[index]));
+        }
+    }
+
+    void RotationModifierComponent::ApplyRotation(InstanceData& instanceData, const AZ::Vector3& factors) const
+    {
+        const float factorX = factors.GetX();
+        const float factorY = factors.GetY();
+        const float factorZ = factors.GetZ();
 
         const bool useOverrides = m_configuration.m_allowOverrides && instanceData.m_descriptorPtr && instanceData.m_descriptorPtr->m_rotationOverrideEnabled;
         const AZ::Vector3& min = useOverrides ? instanceData.m_descriptorPtr->GetRotationMin() : GetRangeMin();
@@ -77,6 +77,7 @@ namespace Vegetation
         //////////////////////////////////////////////////////////////////////////
         // VegetationModifierRequestBus
         void Execute(InstanceData& instanceData) const override;
+        void ExecuteBatch(AZStd::span<InstanceData> instances) const override;
 
     protected:
         //////////////////////////////////////////////////////////////////////////
@@ -91,6 +92,8 @@ namespace Vegetation
         GradientSignal::GradientSampler& GetGradientSamplerY() override;
         GradientSignal::GradientSampler& GetGradientSamplerZ() override;
     private:
+        void ApplyRotation(InstanceData& instanceData, const AZ::Vector3& factors) const;
+
         RotationModifierConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
     };
@@ -165,8 +165,31 @@ namespace Vegetation
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
         const GradientSignal::GradientSampleParams sampleParams(instanceData.m_position);
-        float factor = m_configuration.m_gradientSampler.GetValue(sampleParams);
+        ApplyScale(instanceData, m_configuration.m_gradientSampler.GetValue(sampleParams));
+    }
+
+    void ScaleModifierComponent::ExecuteBatch(AZStd::span<InstanceData> instances) const
+    {
+        VEGETATION_PROFILE_FUNCTION_VERBOSE
+
+        AZStd::vector<AZ::Vector3> positions;
+        positions.reserve(instances.size());
+        for (const InstanceData& instanceData : instances)
+        {
+            positions.push_back(instanceData.m_position);
+        }
 
+        AZStd::vector<float> factors(instances.size());
+        m_configuration.m_gradientSampler.GetValues(positions, factors);
+
+        for (size_t index = 0; index < instances.size(); ++index)
+        {
+            ApplyScale(instances[index], factors[index]);
+        }
+    }
+
+    void ScaleModifierComponent::ApplyScale(InstanceData& instanceData, float factor) const
+    {
         const bool useOverrides = m_configuration.m_allowOverrides && instanceData.m_descriptorPtr && instanceData.m_descriptorPtr->m_scaleOverrideEnabled;
         const float min = useOverrides ? instanceData.m_descriptorPtr->m_scaleMin : m_configuration.m_rangeMin;
         const float max = useOverrides ? instanceData.m_descriptorPtr->m_scaleMax : m_configuration.m_rangeMax;
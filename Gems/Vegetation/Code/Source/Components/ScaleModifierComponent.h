@@ -68,6 +68,7 @@ namespace Vegetation
         //////////////////////////////////////////////////////////////////////////
         // VegetationModifierRequestBus
         void Execute(InstanceData& instanceData) const override;
+        void ExecuteBatch(AZStd::span<InstanceData> instances) const override;
 
     protected:
         //////////////////////////////////////////////////////////////////////////
@@ -82,6 +83,8 @@ namespace Vegetation
 
 
     private:
+        void ApplyScale(InstanceData& instanceData, float factor) const;
+
         ScaleModifierConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
     };
@@ -300,10 +300,58 @@ namespace Vegetation
         return accepted;
     }
 
-    bool SpawnerComponent::ProcessInstance(EntityIdStack& processedIds, const ClaimPoint& point, InstanceData& instanceData, DescriptorPtr descriptorPtr)
+    void SpawnerComponent::EvaluateFiltersBatch(
+        EntityIdStack& processedIds, AZStd::span<const InstanceData> instances, AZStd::span<bool> accepted, const FilterStage intendedStage) const
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
+        for (const auto& id : processedIds)
+        {
+            FilterRequestBus::EnumerateHandlersId(id, [this, instances, accepted, intendedStage](FilterRequestBus::Events* handler) {
+                const FilterStage stage = handler->GetFilterStage();
+                if (stage == intendedStage || (stage == FilterStage::Default && m_configuration.m_filterStage == intendedStage))
+                {
+                    handler->EvaluateBatch(instances, accepted);
+                }
+                return true;
+            });
+        }
+    }
+
+    bool SpawnerComponent::HasOrderDependentFilters(EntityIdStack& processedIds) const
+    {
+        bool orderDependent = false;
+        for (const auto& id : processedIds)
+        {
+            FilterRequestBus::EnumerateHandlersId(id, [&orderDependent](FilterRequestBus::Events* handler) {
+                orderDependent = handler->DependsOnPlacedInstances();
+                return !orderDependent;
+            });
+            if (orderDependent)
+            {
+                break;
+            }
+        }
+        return orderDependent;
+    }
+
+    bool SpawnerComponent::IsPointInsideShapes(EntityIdStack& processedIds, const ClaimPoint& point, [[maybe_unused]] const InstanceData& instanceData) const
+    {
+        for (const auto& id : processedIds)
+        {
+            bool accepted = true;
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(accepted, id, &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInside, point.m_position);
+            if (!accepted)
+            {
+                VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FilterInstance, instanceData.m_id, AZStd::string_view("ShapeFilter")));
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool SpawnerComponent::CanSpawnDescriptor(const DescriptorPtr& descriptorPtr) const
+    {
         if (!descriptorPtr)
         {
             AZ_Error("vegetation", descriptorPtr, "DescriptorPtr should always be valid when spawning!");
@@ -311,11 +359,11 @@ namespace Vegetation
         }
 
         // If this is an empty mesh asset (no valid id) AND we don't allow empty meshes, skip this descriptor
-        if (!m_configuration.m_allowEmptyMeshes && descriptorPtr->HasEmptyAssetReferences())
-        {
-            return false;
-        }
+        return m_configuration.m_allowEmptyMeshes || !descriptorPtr->HasEmptyAssetReferences();
+    }
 
+    void SpawnerComponent::InitializeInstance(const ClaimPoint& point, InstanceData& instanceData, DescriptorPtr descriptorPtr) const
+    {
         //generate details for a single vegetation instance using the current descriptor
         static const AZ::Quaternion identityQuat = AZ::Quaternion::CreateIdentity();
         instanceData.m_descriptorPtr = descriptorPtr;
@@ -326,6 +374,18 @@ namespace Vegetation
         instanceData.m_rotation = identityQuat;
         instanceData.m_alignment = identityQuat;
         instanceData.m_scale = 1.0f;
+    }
+
+    bool SpawnerComponent::ProcessInstance(EntityIdStack& processedIds, const ClaimPoint& point, InstanceData& instanceData, DescriptorPtr descriptorPtr)
+    {
+        VEGETATION_PROFILE_FUNCTION_VERBOSE
+
+        if (!CanSpawnDescriptor(descriptorPtr))
+        {
+            return false;
+        }
+
+        InitializeInstance(point, instanceData, descriptorPtr);
 
         // run pre-process filters on unmodified instance data
         if (!EvaluateFilters(processedIds, instanceData, FilterStage::PreProcess))
@@ -376,15 +436,9 @@ namespace Vegetation
 #endif
 
         // test shape bus as first pass to claim the point
-        for (const auto& id : processedIds)
+        if (!IsPointInsideShapes(processedIds, point, instanceData))
         {
-            bool accepted = true;
-            LmbrCentral::ShapeComponentRequestsBus::EventResult(accepted, id, &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInside, point.m_position);
-            if (!accepted)
-            {
-                VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FilterInstance, instanceData.m_id, AZStd::string_view("ShapeFilter")));
-                return false;
-            }
+            return false;
         }
 
         //generate uvw sample coordinates
@@ -411,6 +465,161 @@ namespace Vegetation
         return false;
     }
 
+    bool SpawnerComponent::PlaceInstance(ClaimContext& context, const ClaimPoint& point, InstanceData& instanceData)
+    {
+        // Check if an identical instance already exists for reuse
+        if (context.m_existedCallback(point, instanceData))
+        {
+            return true;
+        }
+
+        if (!CreateInstance(point, instanceData))
+        {
+            return false;
+        }
+
+        //notify the caller that this claim succeeded so it can do any cleanup or registration
+        context.m_createdCallback(point, instanceData);
+
+        //only store the instance id after all claim logic executes in case prior claim and instance gets released
+        AZStd::lock_guard<decltype(m_claimInstanceMappingMutex)> claimInstanceMappingMutexLock(m_claimInstanceMappingMutex);
+        m_claimInstanceMapping[point.m_handle] = instanceData.m_instanceId;
+        return true;
+    }
+
+    void SpawnerComponent::ClaimPositionsBatched(EntityIdStack& processedIds, ClaimContext& context, const InstanceData& instanceTemplate)
+    {
+        VEGETATION_PROFILE_FUNCTION_VERBOSE
+
+        const size_t pointCount = context.m_availablePoints.size();
+
+        // The shape tests and descriptor selection only depend on the point, so they still run one point at a time.
+        AZStd::vector<DescriptorPtrVec> pointDescriptors(pointCount);
+        AZStd::vector<size_t> pendingPoints;
+        pendingPoints.reserve(pointCount);
+        {
+            AZStd::lock_guard<decltype(m_selectableDescriptorMutex)> selectableDescriptorLock(m_selectableDescriptorMutex);
+            for (size_t pointIndex = 0; pointIndex < pointCount; ++pointIndex)
+            {
+                const ClaimPoint& point = context.m_availablePoints[pointIndex];
+                if (!IsPointInsideShapes(processedIds, point, instanceTemplate))
+                {
+                    continue;
+                }
+
+                DescriptorSelectorParams selectorParams;
+                selectorParams.m_position = point.m_position;
+
+                DescriptorPtrVec& selectedDescriptors = pointDescriptors[pointIndex];
+                selectedDescriptors = m_selectableDescriptorCache;
+                for (const auto& id : processedIds)
+                {
+                    DescriptorSelectorRequestBus::Event(id, &DescriptorSelectorRequestBus::Events::SelectDescriptors, selectorParams, selectedDescriptors);
+                }
+
+                if (!selectedDescriptors.empty())
+                {
+                    pendingPoints.push_back(pointIndex);
+                }
+            }
+        }
+
+        // Every round tries the next selected descriptor of the points that haven't been claimed yet, running each filter
+        // and modifier over the whole batch at once. The first descriptor that passes claims the point, like the per point path.
+        AZStd::vector<InstanceData> claimedInstances(pointCount);
+        AZStd::vector<bool> claimed(pointCount, false);
+        AZStd::vector<InstanceData> instances;
+        AZStd::vector<size_t> instancePoints;
+        AZStd::vector<bool> accepted;
+        instances.reserve(pendingPoints.size());
+        instancePoints.reserve(pendingPoints.size());
+
+        for (size_t descriptorIndex = 0; !pendingPoints.empty(); ++descriptorIndex)
+        {
+            AZStd::erase_if(pendingPoints, [&](size_t pointIndex) {
+                return claimed[pointIndex] || (descriptorIndex >= pointDescriptors[pointIndex].size());
+            });
+
+            instances.clear();
+            instancePoints.clear();
+            for (size_t pointIndex : pendingPoints)
+            {
+                const DescriptorPtr& descriptorPtr = pointDescriptors[pointIndex][descriptorIndex];
+                if (CanSpawnDescriptor(descriptorPtr))
+                {
+                    InstanceData& instanceData = instances.emplace_back(instanceTemplate);
+                    InitializeInstance(context.m_availablePoints[pointIndex], instanceData, descriptorPtr);
+                    instancePoints.push_back(pointIndex);
+                }
+            }
+
+            if (instances.empty())
+            {
+                continue;
+            }
+
+            // run pre-process filters on unmodified instance data
+            accepted.assign(instances.size(), true);
+            EvaluateFiltersBatch(processedIds, instances, accepted, FilterStage::PreProcess);
+
+            // only the instances that passed the pre-process filters get modified
+            size_t acceptedCount = 0;
+            for (size_t index = 0; index < instances.size(); ++index)
+            {
+                if (accepted[index])
+                {
+                    if (index != acceptedCount)
+                    {
+                        instances[acceptedCount] = AZStd::move(instances[index]);
+                        instancePoints[acceptedCount] = instancePoints[index];
+                    }
+                    ++acceptedCount;
+                }
+            }
+            instances.resize(acceptedCount);
+            instancePoints.resize(acceptedCount);
+
+            for (const auto& id : processedIds)
+            {
+                ModifierRequestBus::Event(id, &ModifierRequestBus::Events::ExecuteBatch, AZStd::span<InstanceData>(instances));
+            }
+
+            // run post-process filters on modified instance data
+            accepted.assign(instances.size(), true);
+            EvaluateFiltersBatch(processedIds, instances, accepted, FilterStage::PostProcess);
+
+            for (size_t index = 0; index < instances.size(); ++index)
+            {
+                if (accepted[index])
+                {
+                    claimedInstances[instancePoints[index]] = AZStd::move(instances[index]);
+                    claimed[instancePoints[index]] = true;
+                }
+            }
+        }
+
+        // Create the instances in point order and keep the points that weren't claimed available for the next areas.
+        size_t numAvailablePoints = 0;
+        for (size_t pointIndex = 0; pointIndex < pointCount; ++pointIndex)
+        {
+            ClaimPoint& point = context.m_availablePoints[pointIndex];
+            if (claimed[pointIndex] && PlaceInstance(context, point, claimedInstances[pointIndex]))
+            {
+                continue;
+            }
+
+            UnclaimPosition(point.m_handle);
+            if (numAvailablePoints != pointIndex)
+            {
+                context.m_availablePoints[numAvailablePoints] = AZStd::move(point);
+            }
+            ++numAvailablePoints;
+        }
+
+        //resize to remove all used points
+        context.m_availablePoints.resize(numAvailablePoints);
+    }
+
     void SpawnerComponent::ClaimPositions(EntityIdStack& stackIds, ClaimContext& context)
     {
         AZ_PROFILE_FUNCTION(Vegetation);
@@ -433,35 +642,20 @@ namespace Vegetation
         instanceData.m_id = GetEntityId();
         instanceData.m_changeIndex = GetChangeIndex();
 
+        // Filters that look at the instances placed so far need every point to be placed before the next one is evaluated,
+        // otherwise the filters and modifiers run over all the points of the claim at once.
+        if (!VEG_SPAWNER_ENABLE_CACHING && !HasOrderDependentFilters(processedIds))
+        {
+            ClaimPositionsBatched(processedIds, context, instanceData);
+            return;
+        }
+
         size_t numAvailablePoints = context.m_availablePoints.size();
         for (size_t pointIndex = 0; pointIndex < numAvailablePoints; )
         {
             ClaimPoint& point = context.m_availablePoints[pointIndex];
 
-            bool accepted = false;
-            if (ClaimPosition(processedIds, point, instanceData))
-            {
-                // Check if an identical instance already exists for reuse
-                if (context.m_existedCallback(point, instanceData))
-                {
-                    accepted = true;
-                }
-                else
-                {
-                    if (CreateInstance(point, instanceData))
-                    {
-                        accepted = true;
-
-                        //notify the caller that this claim succeeded so it can do any cleanup or registration
-                        context.m_createdCallback(point, instanceData);
-
-                        //only store the instance id after all claim logic executes in case prior claim and instance gets released
-                        AZStd::lock_guard<decltype(m_claimInstanceMappingMutex)> claimInstanceMappingMutexLock(m_claimInstanceMappingMutex);
-                        m_claimInstanceMapping[point.m_handle] = instanceData.m_instanceId;
-                    }
-                }
-            }
-
+            const bool accepted = ClaimPosition(processedIds, point, instanceData) && PlaceInstance(context, point, instanceData);
             if (accepted)
             {
                 //Swap an available point from the end of the list
@@ -119,8 +119,16 @@ namespace Vegetation
         void ClearSelectableDescriptors();
         bool CreateInstance(const ClaimPoint &point, InstanceData& instanceData);
         bool EvaluateFilters(EntityIdStack& processedIds, InstanceData& instanceData, const FilterStage intendedStage) const;
+        void EvaluateFiltersBatch(
+            EntityIdStack& processedIds, AZStd::span<const InstanceData> instances, AZStd::span<bool> accepted, const FilterStage intendedStage) const;
+        bool HasOrderDependentFilters(EntityIdStack& processedIds) const;
+        bool IsPointInsideShapes(EntityIdStack& processedIds, const ClaimPoint& point, const InstanceData& instanceData) const;
+        bool CanSpawnDescriptor(const DescriptorPtr& descriptorPtr) const;
+        void InitializeInstance(const ClaimPoint& point, InstanceData& instanceData, DescriptorPtr descriptorPtr) const;
         bool ProcessInstance(EntityIdStack& processedIds, const ClaimPoint& point, InstanceData& instanceData, DescriptorPtr descriptorPtr);
         bool ClaimPosition(EntityIdStack& processedIds, const ClaimPoint& point, InstanceData& instanceData);
+        bool PlaceInstance(ClaimContext& context, const ClaimPoint& point, InstanceData& instanceData);
+        void ClaimPositionsBatched(EntityIdStack& processedIds, ClaimContext& context, const InstanceData& instanceTemplate);
         void DestroyAllInstances();
         void CalcInstanceDebugColor(const EntityIdStack& processedIds);
 
@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Vegetation/MeshInstanceSpawner.h>
+
+#include <Atom/RPI.Public/Material/Material.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Asset/AssetSerializer.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <AzFramework/StringFunc/StringFunc.h>
+#include <Vegetation/InstanceData.h>
+
+namespace Vegetation
+{
+
+    MeshInstanceSpawner::MeshInstanceSpawner()
+    {
+        UnloadAssets();
+    }
+
+    MeshInstanceSpawner::~MeshInstanceSpawner()
+    {
+        UnloadAssets();
+        AZ_Assert(m_meshInstances.empty(), "Destroying spawner while %zu mesh instances still exist!", m_meshInstances.size());
+    }
+
+    void MeshInstanceSpawner::Reflect(AZ::ReflectContext* context)
+    {
+        AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context);
+        if (serialize)
+        {
+            serialize->Class<MeshInstanceSpawner, InstanceSpawner>()
+                ->Version(0)
+                ->Field("ModelAsset", &MeshInstanceSpawner::m_modelAsset)
+                ->Field("MaterialAsset", &MeshInstanceSpawner::m_materialAsset)
+                ->Field("RayTracingEnabled", &MeshInstanceSpawner::m_rayTracingEnabled)
+                ;
+
+            AZ::EditContext* edit = serialize->GetEditContext();
+            if (edit)
+            {
+                edit->Class<MeshInstanceSpawner>(
+                    "Mesh", "Mesh Instance")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AZ::Edit::Attributes::Visibility, AZ::Edit::PropertyVisibility::ShowChildrenOnly)
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &MeshInstanceSpawner::m_modelAsset, "Mesh Asset", "Mesh asset")
+                    ->Attribute(AZ::Edit::Attributes::ShowProductAssetFileName, false)
+                    ->Attribute(AZ::Edit::Attributes::AssetPickerTitle, "a Mesh")
+                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, &MeshInstanceSpawner::AssetChanged)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &MeshInstanceSpawner::m_materialAsset, "Material Asset",
+                        "Material used for the whole mesh. The materials of the mesh asset are used when empty.")
+                    ->Attribute(AZ::Edit::Attributes::ShowProductAssetFileName, false)
+                    ->Attribute(AZ::Edit::Attributes::AssetPickerTitle, "a Material")
+                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, &MeshInstanceSpawner::AssetChanged)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &MeshInstanceSpawner::m_rayTracingEnabled, "Ray Tracing",
+                        "Add the instances to the ray tracing scene.")
+                    ;
+            }
+        }
+        if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->Class<MeshInstanceSpawner>()
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Category, "Vegetation")
+                ->Attribute(AZ::Script::Attributes::Module, "vegetation")
+                ->Constructor()
+                ->Method("GetModelAssetPath", &MeshInstanceSpawner::GetModelAssetPath)
+                ->Method("SetModelAssetPath", &MeshInstanceSpawner::SetModelAssetPath)
+                ->Method("GetModelAssetId", &MeshInstanceSpawner::GetModelAssetId)
+                ->Method("SetModelAssetId", &MeshInstanceSpawner::SetModelAssetId)
+                ->Method("GetMaterialAssetId", &MeshInstanceSpawner::GetMaterialAssetId)
+                ->Method("SetMaterialAssetId", &MeshInstanceSpawner::SetMaterialAssetId);
+        }
+    }
+
+    bool MeshInstanceSpawner::DataIsEquivalent(const InstanceSpawner& baseRhs) const
+    {
+        if (const auto* rhs = azrtti_cast<const MeshInstanceSpawner*>(&baseRhs))
+        {
+            return m_modelAsset == rhs->m_modelAsset && m_materialAsset == rhs->m_materialAsset &&
+                m_rayTracingEnabled == rhs->m_rayTracingEnabled;
+        }
+
+        // Not the same subtypes, so definitely not a data match.
+        return false;
+    }
+
+    void MeshInstanceSpawner::LoadAssets()
+    {
+        UnloadAssets();
+
+        // Load the assets before marking the spawner as ready, so the first instances don't wait on them and the
+        // assets don't get released every time all the instances are destroyed.
+        m_modelAsset.QueueLoad();
+        AZ::Data::AssetBus::MultiHandler::BusConnect(m_modelAsset.GetId());
+
+        if (m_materialAsset.GetId().IsValid())
+        {
+            m_materialAsset.QueueLoad();
+            AZ::Data::AssetBus::MultiHandler::BusConnect(m_materialAsset.GetId());
+        }
+    }
+
+    void MeshInstanceSpawner::UnloadAssets()
+    {
+        // As with prefab instances, the assets can unload before the vegetation system destroys all the instances.
+        // Release the meshes here, but leave the instances in the list so DestroyInstance can still delete them.
+        for (MeshInstance* meshInstance : m_meshInstances)
+        {
+            ReleaseMeshInstance(meshInstance);
+        }
+        ResetAssets();
+        NotifyOnAssetsUnloaded();
+    }
+
+    void MeshInstanceSpawner::ResetAssets()
+    {
+        AZ::Data::AssetBus::MultiHandler::BusDisconnect();
+
+        m_material = nullptr;
+        m_modelAsset.Release();
+        m_materialAsset.Release();
+        UpdateCachedValues();
+        m_modelAsset.SetAutoLoadBehavior(AZ::Data::AssetLoadBehavior::QueueLoad);
+        m_materialAsset.SetAutoLoadBehavior(AZ::Data::AssetLoadBehavior::QueueLoad);
+    }
+
+    void MeshInstanceSpawner::UpdateCachedValues()
+    {
+        // Once our assets are loaded and at the point that they're getting registered,
+        // cache off the spawnable state and the radius for use from multiple threads.
+        const bool materialReady = !m_materialAsset.GetId().IsValid() || m_material;
+        m_assetsLoadedAndSpawnable = m_modelAsset.IsReady() && materialReady;
+
+        m_radius = 0.0f;
+        if (m_modelAsset.IsReady())
+        {
+            const AZ::Aabb modelAabb = m_modelAsset->GetAabb();
+            m_radius = modelAabb.IsValid() ? (modelAabb.GetExtents().GetMaxElement() * 0.5f) : 0.0f;
+        }
+    }
+
+    void MeshInstanceSpawner::OnRegisterUniqueDescriptor()
+    {
+        UpdateCachedValues();
+    }
+
+    void MeshInstanceSpawner::OnReleaseUniqueDescriptor()
+    {
+    }
+
+    bool MeshInstanceSpawner::HasEmptyAssetReferences() const
+    {
+        // If we don't have a valid model asset, then that means we're expecting to spawn empty instances.
+        return !m_modelAsset.GetId().IsValid();
+    }
+
+    bool MeshInstanceSpawner::IsLoaded() const
+    {
+        return m_assetsLoadedAndSpawnable;
+    }
+
+    bool MeshInstanceSpawner::IsSpawnable() const
+    {
+        return m_assetsLoadedAndSpawnable;
+    }
+
+    float MeshInstanceSpawner::GetRadius() const
+    {
+        return m_radius;
+    }
+
+    AZStd::string MeshInstanceSpawner::GetName() const
+    {
+        AZStd::string assetName;
+        if (!HasEmptyAssetReferences())
+        {
+            // Get the asset file name
+            assetName = m_modelAsset.GetHint();
+            if (!m_modelAsset.GetHint().empty())
+            {
+                AzFramework::StringFunc::Path::GetFileName(m_modelAsset.GetHint().c_str(), assetName);
+            }
+        }
+        else
+        {
+            assetName = "<asset name>";
+        }
+
+        return assetName;
+    }
+
+    void MeshInstanceSpawner::OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset)
+    {
+        if (m_modelAsset.GetId() == asset.GetId())
+        {
+            m_modelAsset = asset;
+        }
+        else if (m_materialAsset.GetId() == asset.GetId())
+        {
+            m_materialAsset = asset;
+            m_material = AZ::RPI::Material::FindOrCreate(m_materialAsset);
+        }
+        else
+        {
+            return;
+        }
+
+        UpdateCachedValues();
+        if (m_assetsLoadedAndSpawnable)
+        {
+            NotifyOnAssetsLoaded();
+        }
+    }
+
+    void MeshInstanceSpawner::OnAssetReloaded(AZ::Data::Asset<AZ::Data::AssetData> asset)
+    {
+        OnAssetReady(asset);
+    }
+
+    AZStd::string MeshInstanceSpawner::GetModelAssetPath() const
+    {
+        AZStd::string assetPathString;
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+            assetPathString, &AZ::Data::AssetCatalogRequests::GetAssetPathById, m_modelAsset.GetId());
+        return assetPathString;
+    }
+
+    void MeshInstanceSpawner::SetModelAssetPath(const AZStd::string& assetPath)
+    {
+        if (!assetPath.empty())
+        {
+            AZ::Data::AssetId assetId;
+            AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+                assetId, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetIdByPath, assetPath.c_str(),
+                AZ::Data::s_invalidAssetType, false);
+            if (assetId.IsValid())
+            {
+                SetModelAssetId(assetId);
+            }
+            else
+            {
+                AZ_Error("Vegetation", false, "Asset '%s' is invalid.", assetPath.c_str());
+            }
+        }
+        else
+        {
+            SetModelAssetId(AZ::Data::AssetId());
+        }
+    }
+
+    AZ::Data::AssetId MeshInstanceSpawner::GetModelAssetId() const
+    {
+        return m_modelAsset.GetId();
+    }
+
+    void MeshInstanceSpawner::SetModelAssetId(const AZ::Data::AssetId& assetId)
+    {
+        if (assetId.IsValid())
+        {
+            AZ::Data::AssetInfo assetInfo;
+            AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+                assetInfo, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetInfoById, assetId);
+            if (assetInfo.m_assetType == m_modelAsset.GetType())
+            {
+                m_modelAsset.Create(assetId, false);
+                LoadAssets();
+            }
+            else
+            {
+                AZ_Error(
+                    "Vegetation", false, "Asset '%s' is of type %s, but expected a Model type.",
+                    assetId.ToString<AZStd::string>().c_str(), assetInfo.m_assetType.ToString<AZStd::string>().c_str());
+            }
+        }
+        else
+        {
+            // An invalid asset ID is treated as a valid way to spawn "empty" instances, so don't print an error, just clear out
+            // the asset to that it has an invalid asset reference.  (See also HasEmptyAssetReferences() above)
+            m_modelAsset = AZ::Data::Asset<AZ::RPI::ModelAsset>();
+            LoadAssets();
+        }
+    }
+
+    AZ::Data::AssetId MeshInstanceSpawner::GetMaterialAssetId() const
+    {
+        return m_materialAsset.GetId();
+    }
+
+    void MeshInstanceSpawner::SetMaterialAssetId(const AZ::Data::AssetId& assetId)
+    {
+        if (assetId.IsValid())
+        {
+            AZ::Data::AssetInfo assetInfo;
+            AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+                assetInfo, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetInfoById, assetId);
+            if (assetInfo.m_assetType != m_materialAsset.GetType())
+            {
+                AZ_Error(
+                    "Vegetation", false, "Asset '%s' is of type %s, but expected a Material type.",
+                    assetId.ToString<AZStd::string>().c_str(), assetInfo.m_assetType.ToString<AZStd::string>().c_str());
+                return;
+            }
+            m_materialAsset.Create(assetId, false);
+        }
+        else
+        {
+            // Without a material asset the instances use the materials of the model asset.
+            m_materialAsset = AZ::Data::Asset<AZ::RPI::MaterialAsset>();
+        }
+        LoadAssets();
+    }
+
+    AZ::u32 MeshInstanceSpawner::AssetChanged()
+    {
+        // Whenever we change an asset, force a refresh of the Entity Inspector
+        // since we want the Descriptor List to refresh the name of the entry.
+        NotifyOnAssetsUnloaded();
+        return AZ::Edit::PropertyRefreshLevels::AttributesAndValues;
+    }
+
+    InstancePtr MeshInstanceSpawner::CreateInstance(const InstanceData& instanceData)
+    {
+        // The meshes go into the scene of the vegetation area that placed the instance.
+        auto* featureProcessor = AZ::RPI::Scene::GetFeatureProcessorForEntity<AZ::Render::MeshFeatureProcessorInterface>(instanceData.m_id);
+        if (!featureProcessor)
+        {
+            return nullptr;
+        }
+
+        AZ::Render::MeshHandleDescriptor meshDescriptor =
+            m_material ? AZ::Render::MeshHandleDescriptor(m_modelAsset, m_material) : AZ::Render::MeshHandleDescriptor(m_modelAsset);
+        meshDescriptor.m_isRayTracingEnabled = m_rayTracingEnabled;
+
+        // Create the instance here.  This pointer is going to get handed off to the vegetation system as opaque instance data,
+        // and passed back in to DestroyInstance at the end of the lifetime, which is the one place where it gets deleted.
+        auto meshInstance = aznew MeshInstance();
+        meshInstance->m_featureProcessor = featureProcessor;
+        meshInstance->m_meshHandle = featureProcessor->AcquireMesh(meshDescriptor);
+
+        AZ::Transform world = AZ::Transform::CreateFromQuaternionAndTranslation(
+            instanceData.m_alignment * instanceData.m_rotation, instanceData.m_position);
+        world.MultiplyByUniformScale(instanceData.m_scale);
+        featureProcessor->SetTransform(meshInstance->m_meshHandle, world);
+
+        m_meshInstances.emplace(meshInstance);
+        return meshInstance;
+    }
+
+    void MeshInstanceSpawner::ReleaseMeshInstance(MeshInstance* meshInstance)
+    {
+        if (meshInstance->m_featureProcessor && meshInstance->m_meshHandle.IsValid())
+        {
+            meshInstance->m_featureProcessor->ReleaseMesh(meshInstance->m_meshHandle);
+        }
+    }
+
+    void MeshInstanceSpawner::DestroyInstance([[maybe_unused]] InstanceId id, InstancePtr instance)
+    {
+        if (instance)
+        {
+            auto meshInstance = reinterpret_cast<MeshInstance*>(instance);
+
+            auto foundInstance = m_meshInstances.find(meshInstance);
+            AZ_Assert(foundInstance != m_meshInstances.end(), "Couldn't find CreateInstance entry for the mesh instance.");
+            if (foundInstance != m_meshInstances.end())
+            {
+                ReleaseMeshInstance(meshInstance);
+                m_meshInstances.erase(foundInstance);
+            }
+
+            // The vegetation system has stopped tracking this instance, so it's now safe to delete it.
+            delete meshInstance;
+        }
+    }
+} // namespace Vegetation
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include "VegetationTest.h"
+#include "VegetationMocks.h"
+
+#include <AzCore/Component/Entity.h>
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Vegetation/MeshInstanceSpawner.h>
+
+namespace UnitTest
+{
+    // Mock VegetationSystemComponent is needed to reflect only the MeshInstanceSpawner.
+    class MockMeshInstanceVegetationSystemComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(MockMeshInstanceVegetationSystemComponent, "{0C8E2F47-6A1B-4D39-B5E2-7F94C3A1D086}", AZ::Component);
+
+        void Activate() override {}
+        void Deactivate() override {}
+
+        static void Reflect(AZ::ReflectContext* reflect)
+        {
+            Vegetation::InstanceSpawner::Reflect(reflect);
+            Vegetation::MeshInstanceSpawner::Reflect(reflect);
+        }
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+        {
+            provided.push_back(AZ_CRC_CE("VegetationSystemService"));
+        }
+    };
+
+    class MeshInstanceSpawnerTests
+        : public VegetationComponentTests
+    {
+    public:
+        void RegisterComponentDescriptors() override
+        {
+            m_app.RegisterComponentDescriptor(MockMeshInstanceVegetationSystemComponent::CreateDescriptor());
+        }
+    };
+
+    TEST_F(MeshInstanceSpawnerTests, BasicInitializationTest)
+    {
+        // Basic test to make sure we can construct / destroy without errors.
+
+        Vegetation::MeshInstanceSpawner instanceSpawner;
+    }
+
+    TEST_F(MeshInstanceSpawnerTests, DefaultSpawnersAreEqual)
+    {
+        // Two different instances of the default MeshInstanceSpawner should be considered data-equivalent.
+
+        Vegetation::MeshInstanceSpawner instanceSpawner1;
+        Vegetation::MeshInstanceSpawner instanceSpawner2;
+
+        EXPECT_TRUE(instanceSpawner1 == instanceSpawner2);
+    }
+
+    TEST_F(MeshInstanceSpawnerTests, DefaultSpawnerHasEmptyAssetReferences)
+    {
+        // Without a model asset, the spawner has empty asset references and isn't spawnable.
+
+        Vegetation::MeshInstanceSpawner instanceSpawner;
+        EXPECT_TRUE(instanceSpawner.HasEmptyAssetReferences());
+        EXPECT_FALSE(instanceSpawner.IsSpawnable());
+        EXPECT_TRUE(instanceSpawner.HasRadiusData());
+        EXPECT_EQ(0.0f, instanceSpawner.GetRadius());
+    }
+
+    TEST_F(MeshInstanceSpawnerTests, CreateInstanceWithoutSceneFails)
+    {
+        // Without a render scene there's no mesh feature processor to create the instance in.
+
+        Vegetation::MeshInstanceSpawner instanceSpawner;
+        Vegetation::InstanceData instanceData;
+        Vegetation::InstancePtr instance = instanceSpawner.CreateInstance(instanceData);
+        EXPECT_FALSE(instance);
+    }
+
+    TEST_F(MeshInstanceSpawnerTests, SpawnerRegisteredWithDescriptor)
+    {
+        // Validate that the Descriptor successfully gets MeshInstanceSpawner registered with it,
+        // as long as InstanceSpawner and MeshInstanceSpawner have been reflected.
+
+        MockMeshInstanceVegetationSystemComponent* component = nullptr;
+        auto entity = CreateEntity(&component);
+
+        Vegetation::Descriptor descriptor;
+        descriptor.RefreshSpawnerTypeList();
+        auto spawnerTypes = descriptor.GetSpawnerTypeList();
+        EXPECT_TRUE(spawnerTypes.size() == 1);
+        EXPECT_TRUE(spawnerTypes[0].first == Vegetation::MeshInstanceSpawner::RTTI_Type());
+    }
+}
@@ -295,4 +295,39 @@ namespace UnitTest
         }
     }
 
+    TEST_F(VegetationComponentFilterTests, DistributionFilterComponentEvaluateBatch)
+    {
+        MockGradientRequestHandler mockGradient;
+        mockGradient.m_valueGetter = [&mockGradient]()
+        {
+            // Alternate between a value inside and a value outside of the threshold range.
+            return (mockGradient.m_count % 2) ? 0.5f : 0.0f;
+        };
+
+        Vegetation::DistributionFilterConfig config;
+        config.m_filterStage = Vegetation::FilterStage::Default;
+        config.m_gradientSampler.m_gradientId = mockGradient.m_entity.GetId();
+        config.m_thresholdMax = 0.90f;
+        config.m_thresholdMin = 0.10f;
+
+        Vegetation::DistributionFilterComponent* component = nullptr;
+        auto entity = CreateEntity(config, &component, [](AZ::Entity* e)
+        {
+            e->CreateComponent<MockVegetationAreaServiceComponent>();
+        });
+
+        AZStd::vector<Vegetation::InstanceData> instances(4);
+        AZStd::vector<bool> accepted = { true, false, true, true };
+        Vegetation::FilterRequestBus::Event(
+            entity->GetId(), &Vegetation::FilterRequestBus::Events::EvaluateBatch, AZStd::span<const Vegetation::InstanceData>(instances),
+            AZStd::span<bool>(accepted));
+
+        // The instance that was already rejected isn't sampled, and the others alternate between accepted and rejected.
+        EXPECT_EQ(3, mockGradient.m_count);
+        EXPECT_TRUE(accepted[0]);
+        EXPECT_FALSE(accepted[1]);
+        EXPECT_FALSE(accepted[2]);
+        EXPECT_TRUE(accepted[3]);
+    }
+
 }